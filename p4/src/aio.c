@@ -0,0 +1,146 @@
+// Asynchronous file reads.
+//
+// aread() queues disk reads for a range of a file, holding
+// its blocks in the buffer cache with bhold() so they stay
+// there, and returns at once; apoll() tells whether they are
+// done, and await() copies the range out to the caller's
+// buffer, sleeping only on blocks whose reads haven't
+// finished.  A process can have NAIO reads outstanding, each
+// spanning at most NAIOBLK blocks, and can compute or start
+// more reads while the disk works through them.  aread()
+// fails rather than block if the cache can't hold the range.
+//
+// aread() never waits for the disk.  If part of the range is
+// mapped by an indirect block that isn't cached, it queues a
+// read of that block instead, and await() reads the rest of
+// the range itself.
+//
+// The copy happens in await(), so await() returns the file's
+// contents as of the await() call, not of the aread() call,
+// if the range was written in between.  sys_aread() checks with argptrw()
+// that dst is mapped and writable when the read is started;
+// await() checks again, since it may have been unmapped since.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
+#include "stat.h"
+#include "fs.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "file.h"
+
+// Release a's blocks and file, freeing the slot.
+static void
+aiodone(struct aio *a)
+{
+  while(a->nb > 0)
+    bunhold(a->b[--a->nb]);
+  fileclose(a->f);
+  a->f = 0;
+}
+
+// Start reading n bytes from f at its current offset into
+// dst, advancing the offset.  Returns an id for await(),
+// or -1.
+int
+aread(struct file *f, char *dst, int n)
+{
+  struct proc *curproc = myproc();
+  struct aio *a;
+  struct inode *ip;
+
+  if(f->type != FD_INODE || !f->readable || n < 0)
+    return -1;
+  for(a = curproc->aio; a < &curproc->aio[NAIO]; a++)
+    if(a->f == 0)
+      break;
+  if(a == &curproc->aio[NAIO])
+    return -1;
+
+  ip = f->ip;
+  ilock(ip);
+  if(ip->type == T_DEV){
+    iunlock(ip);
+    return -1;
+  }
+  if(f->off >= ip->size)
+    n = 0;
+  else if(n > ip->size - f->off)
+    n = ip->size - f->off;
+  a->nb = 0;
+  if(n > 0 && ((f->off + n - 1)/BSIZE - f->off/BSIZE >= NAIOBLK ||
+               (a->nb = ihold(ip, f->off, n, a->b)) < 0)){
+    iunlock(ip);
+    return -1;
+  }
+  a->off = f->off;
+  f->off += n;
+  iunlock(ip);
+
+  a->f = filedup(f);
+  a->dst = dst;
+  a->n = n;
+  return a - curproc->aio;
+}
+
+// Wait for the read started by aread() with the given id
+// and copy the range's current contents out.  Returns the
+// number of bytes read, or -1.
+int
+await(int id)
+{
+  struct proc *curproc = myproc();
+  struct aio *a;
+  uint dst, end;
+  int r;
+
+  if(id < 0 || id >= NAIO || curproc->aio[id].f == 0)
+    return -1;
+  a = &curproc->aio[id];
+
+  // The buffer may have been unmapped since aread().
+  dst = (uint)a->dst;
+  r = -1;
+  if(a->n == 0)
+    r = 0;
+  else if((end = uend(curproc, dst)) != 0 && dst + a->n <= end &&
+          faultin(curproc, dst, a->n, 1) == 0){
+    ilock(a->f->ip);
+    r = readi(a->f->ip, a->dst, a->off, a->n);
+    iunlock(a->f->ip);
+  }
+  aiodone(a);
+  return r;
+}
+
+// Is the read started by aread() with the given id done?
+// Returns 1 if so, 0 if not, or -1.  Never sleeps.
+int
+apoll(int id)
+{
+  struct proc *curproc = myproc();
+  struct aio *a;
+  int i;
+
+  if(id < 0 || id >= NAIO || curproc->aio[id].f == 0)
+    return -1;
+  a = &curproc->aio[id];
+  for(i = 0; i < a->nb; i++)
+    if(!bpoll(a->b[i]))
+      return 0;
+  return 1;
+}
+
+// Abandon p's outstanding reads.
+void
+aiofree(struct proc *p)
+{
+  struct aio *a;
+
+  for(a = p->aio; a < &p->aio[NAIO]; a++)
+    if(a->f)
+      aiodone(a);
+}
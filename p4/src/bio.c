@@ -1,6 +1,6 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a set of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
@@ -9,10 +9,43 @@
 // * To get a buffer for a particular disk block, call bread.
 // * After changing buffer data, call bwrite to write it to disk.
 // * When done with the buffer, call brelse.
+// * To have several requests in flight, start each with bstart
+//     (read) or bawrite (write), then wait with bwait or bwaitany
+//     before using the data or calling brelse; bpoll tells
+//     whether a request is done without waiting.
+// * To read a block in the background and keep it cached for
+//     later, call bhold, and bunhold when done with it.
 // * Do not use the buffer after calling brelse.
 // * Only one process at a time can use a buffer,
 //     so do not keep them longer than necessary.
 //
+// Cached blocks are found through a hash table of (dev, blockno)
+// buckets, each with its own lock, so lookups of different blocks
+// don't contend.
+//
+// Buffers are allocated from a slab cache as they are first
+// needed, up to a limit set at boot from the amount of physical
+// memory.  Once the limit is reached, a miss recycles a buffer
+// chosen by the 2Q policy (Johnson and Shasha, VLDB '94), which
+// keeps one scan over a large file from flushing the blocks that
+// are used over and over:
+// * a block read for the first time goes on the A1in queue,
+//     which is FIFO and is emptied first once it holds more
+//     than a quarter of the buffers;
+// * a block evicted from A1in is remembered (without its data)
+//     on the A1out ghost queue;
+// * a block read again while on A1out goes on the Am queue,
+//     which is LRU and holds the working set.
+//
+// Locking: a bucket lock protects its chain and the dev, blockno
+// and refcnt of the buffers on it; lrulock protects the queues
+// and may be acquired while holding a bucket lock.  Recycling a
+// buffer changes which bucket it is on, so misses are serialized
+// by evictlock, which also protects A1out and the miss and
+// eviction counters; only the holder of evictlock ever holds two bucket
+// locks at once.  A1out entries are chained into the same hash
+// buckets as buffers, so checking for one doesn't scan the ring.
+//
 // The implementation uses two state flags internally:
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
@@ -25,70 +58,328 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "bstat.h"
 
-struct {
+#define NBUCKET 251
+#define BUFFRAC 64   // use up to 1/BUFFRAC of memory for buffers
+
+struct bucket {
   struct spinlock lock;
-  struct buf buf[NBUF];
+  struct buf *head;     // chain through hnext
+  int ghost;            // first A1out slot hashed here, or -1;
+                        // under evictlock
+  uint hits;
+};
+
+struct ghost {
+  uint dev;
+  uint blockno;         // ~0 if the slot is unused
+  int hnext;            // next slot in the same bucket, or -1
+};
+
+struct {
+  struct spinlock evictlock;
+  struct spinlock lrulock;
+  struct kmcache *cache;
+  struct bucket bucket[NBUCKET];
+  int nbuf;             // buffers allocated so far
+  int maxbuf;
+
+  // Queues of buffers, through prev/next.  head.next is the
+  // most recently added (A1in) or used (Am).
+  struct buf a1in;
+  struct buf am;
+  int nin, nam;
+
+  // Ring of blocks recently evicted from A1in.
+  struct ghost a1out[MAXNBUF/2];
+  int nout;             // size of the ring, maxbuf/2
+  int outnext;          // slot to fill next
+
+  uint misses, evictions, promotions;
 
-  // Linked list of all buffers, through prev/next.
-  // head.next is most recently used.
-  struct buf head;
+  int nasync;           // prefetches in flight, under lrulock
+  int nheld;            // bhold() references, under lrulock
 } bcache;
 
+static struct bucket*
+hash(uint dev, uint blockno)
+{
+  return &bcache.bucket[(dev * 1009 + blockno) % NBUCKET];
+}
+
+// Add b to the front of queue q.  Caller holds lrulock.
+static void
+qpush(struct buf *q, struct buf *b)
+{
+  b->next = q->next;
+  b->prev = q;
+  q->next->prev = b;
+  q->next = b;
+}
+
+// Remove b from its queue.  Caller holds lrulock.
+static void
+qremove(struct buf *b)
+{
+  b->next->prev = b->prev;
+  b->prev->next = b->next;
+}
+
 void
 binit(void)
 {
-  struct buf *b;
+  int i;
 
-  initlock(&bcache.lock, "bcache");
-
-  // Create linked list of buffers
-  bcache.head.prev = &bcache.head;
-  bcache.head.next = &bcache.head;
-  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+  initlock(&bcache.evictlock, "bcache.evict");
+  initlock(&bcache.lrulock, "bcache.lru");
+  for(i = 0; i < NBUCKET; i++){
+    initlock(&bcache.bucket[i].lock, "bcache.bucket");
+    bcache.bucket[i].ghost = -1;
   }
+  bcache.cache = kmcache_create("buf", sizeof(struct buf));
+
+  bcache.maxbuf = phystop / BUFFRAC / sizeof(struct buf);
+  if(bcache.maxbuf < NBUF)
+    bcache.maxbuf = NBUF;
+  if(bcache.maxbuf > MAXNBUF)
+    bcache.maxbuf = MAXNBUF;
+  bcache.nout = bcache.maxbuf / 2;
+  for(i = 0; i < bcache.nout; i++)
+    bcache.a1out[i].blockno = ~0;
+
+  bcache.a1in.prev = bcache.a1in.next = &bcache.a1in;
+  bcache.am.prev = bcache.am.next = &bcache.am;
 }
 
-// Look through buffer cache for block on device dev.
-// If not found, allocate a buffer.
-// In either case, return locked buffer.
+// Look for block on device dev in bucket h.  If found, take
+// a reference and return it.  Caller holds h->lock.
 static struct buf*
-bget(uint dev, uint blockno)
+bfind(struct bucket *h, uint dev, uint blockno)
 {
   struct buf *b;
 
-  acquire(&bcache.lock);
-
-  // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
+  for(b = h->head; b; b = b->hnext){
     if(b->dev == dev && b->blockno == blockno){
       b->refcnt++;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
       return b;
     }
   }
+  return 0;
+}
+
+// Find an unused buffer on queue q, starting from the
+// least recently used end.  Caller holds lrulock.
+static struct buf*
+qvictim(struct buf *q)
+{
+  struct buf *b;
 
-  // Not cached; recycle an unused buffer.
   // Even if refcnt==0, B_DIRTY indicates a buffer is in use
   // because log.c has modified it but not yet committed it.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
-      b->dev = dev;
-      b->blockno = blockno;
-      b->flags = 0;
-      b->refcnt = 1;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
+  for(b = q->prev; b != q; b = b->prev)
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0)
       return b;
+  return 0;
+}
+
+// Remove A1out slot i from its bucket's chain and mark it
+// unused.  Caller holds evictlock.
+static void
+ghostunlink(int i)
+{
+  struct ghost *g;
+  int *pp;
+
+  g = &bcache.a1out[i];
+  for(pp = &hash(g->dev, g->blockno)->ghost; *pp != i; pp = &bcache.a1out[*pp].hnext)
+    ;
+  *pp = g->hnext;
+  g->blockno = ~0;
+}
+
+// Remember block as evicted from A1in, in the oldest slot of
+// the A1out ring.  Caller holds evictlock.
+static void
+ghostadd(uint dev, uint blockno)
+{
+  struct bucket *h;
+  struct ghost *g;
+  int i;
+
+  i = bcache.outnext;
+  bcache.outnext = (i + 1) % bcache.nout;
+  g = &bcache.a1out[i];
+  if(g->blockno != ~0)
+    ghostunlink(i);
+  h = hash(dev, blockno);
+  g->dev = dev;
+  g->blockno = blockno;
+  g->hnext = h->ghost;
+  h->ghost = i;
+}
+
+// Was block recently evicted from A1in?  If so, forget it,
+// since it's about to be cached again.  Caller holds evictlock.
+static int
+ghost(uint dev, uint blockno)
+{
+  struct ghost *g;
+  int i;
+
+  for(i = hash(dev, blockno)->ghost; i >= 0; i = g->hnext){
+    g = &bcache.a1out[i];
+    if(g->dev == dev && g->blockno == blockno){
+      ghostunlink(i);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// Take an unused buffer off its queue and out of its bucket.
+// Caller holds evictlock and no bucket locks.
+static struct buf*
+bevict(void)
+{
+  struct buf *b, **pp;
+  struct bucket *h;
+
+  for(;;){
+    acquire(&bcache.lrulock);
+    b = 0;
+    if(bcache.nin > bcache.maxbuf / 4)
+      b = qvictim(&bcache.a1in);
+    if(b == 0)
+      b = qvictim(&bcache.am);
+    if(b == 0)
+      b = qvictim(&bcache.a1in);
+    release(&bcache.lrulock);
+    if(b == 0)
+      panic("bget: no buffers");
+
+    // b's identity can't change under us, since we hold
+    // evictlock, but someone may pick it up (and dirty it)
+    // before we lock its bucket; if so, try again.
+    h = hash(b->dev, b->blockno);
+    acquire(&h->lock);
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0){
+      acquire(&bcache.lrulock);
+      qremove(b);
+      if(b->hot)
+        bcache.nam--;
+      else
+        bcache.nin--;
+      release(&bcache.lrulock);
+      for(pp = &h->head; *pp; pp = &(*pp)->hnext){
+        if(*pp == b){
+          *pp = b->hnext;
+          break;
+        }
+      }
+      release(&h->lock);
+      break;
+    }
+    release(&h->lock);
+  }
+
+  bcache.evictions++;
+  if(!b->hot)
+    ghostadd(b->dev, b->blockno);
+  return b;
+}
+
+// Look through buffer cache for block on device dev.
+// If not found, allocate a buffer.
+// In either case, return referenced but unlocked buffer.
+static struct buf*
+bref(uint dev, uint blockno)
+{
+  struct bucket *h;
+  struct buf *b;
+
+  h = hash(dev, blockno);
+
+  // Is the block already cached?
+  acquire(&h->lock);
+  if((b = bfind(h, dev, blockno)) != 0)
+    h->hits++;
+  release(&h->lock);
+  if(b)
+    return b;
+
+  // Not cached; allocate a new buffer or recycle an unused one.
+  // Check again with evictlock held, since buffers only join a
+  // bucket under it.
+  acquire(&bcache.evictlock);
+  acquire(&h->lock);
+  if((b = bfind(h, dev, blockno)) != 0)
+    h->hits++;
+  release(&h->lock);
+  if(b == 0){
+    bcache.misses++;
+    if(bcache.nbuf < bcache.maxbuf && (b = kmcache_alloc(bcache.cache)) != 0){
+      initsleeplock(&b->lock, "buffer");
+      bcache.nbuf++;
     }
+    if(b == 0)
+      b = bevict();
+    b->dev = dev;
+    b->blockno = blockno;
+    b->flags = 0;
+    b->refcnt = 1;
+    b->hot = ghost(dev, blockno);
+    if(b->hot)
+      bcache.promotions++;
+
+    acquire(&h->lock);
+    acquire(&bcache.lrulock);
+    if(b->hot){
+      qpush(&bcache.am, b);
+      bcache.nam++;
+    } else {
+      qpush(&bcache.a1in, b);
+      bcache.nin++;
+    }
+    release(&bcache.lrulock);
+    b->hnext = h->head;
+    h->head = b;
+    release(&h->lock);
   }
-  panic("bget: no buffers");
+  release(&bcache.evictlock);
+  return b;
+}
+
+// Drop a reference to b.  If it is on Am and no one else
+// holds it, move it to the head of Am; A1in is kept in the
+// order blocks were read.
+static void
+bunref(struct buf *b)
+{
+  struct bucket *h;
+
+  h = hash(b->dev, b->blockno);
+  acquire(&h->lock);
+  b->refcnt--;
+  if (b->refcnt == 0 && b->hot) {
+    // no one is waiting for it.
+    acquire(&bcache.lrulock);
+    qremove(b);
+    qpush(&bcache.am, b);
+    release(&bcache.lrulock);
+  }
+  release(&h->lock);
+}
+
+// Return locked buffer for block on device dev.
+static struct buf*
+bget(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  b = bref(dev, blockno);
+  acquiresleep(&b->lock);
+  return b;
 }
 
 // Return a locked buf with the contents of the indicated block.
@@ -114,8 +405,52 @@ bwrite(struct buf *b)
   iderw(b);
 }
 
+// Return a locked buf for the indicated block, starting to
+// read it from disk if it isn't cached, without waiting.
+// Call bwait before looking at the data.
+struct buf*
+bstart(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  b = bget(dev, blockno);
+  if((b->flags & B_VALID) == 0)
+    idesubmit(b);
+  return b;
+}
+
+// Start writing b's contents to disk, without waiting.
+// Must be locked.  Call bwait before releasing it.
+void
+bawrite(struct buf *b)
+{
+  if(!holdingsleep(&b->lock))
+    panic("bawrite");
+  b->flags |= B_DIRTY;
+  idesubmit(b);
+}
+
+// Wait for the request on b started by bstart or bawrite.
+void
+bwait(struct buf *b)
+{
+  bwaitany(&b, 1);
+}
+
+// Wait for any one of the n buffers in bufs to finish its
+// request and return its index.
+int
+bwaitany(struct buf **bufs, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++)
+    if(!holdingsleep(&bufs[i]->lock))
+      panic("bwaitany");
+  return idewaitany(bufs, n);
+}
+
 // Release a locked buffer.
-// Move to the head of the MRU list.
 void
 brelse(struct buf *b)
 {
@@ -123,20 +458,186 @@ brelse(struct buf *b)
     panic("brelse");
 
   releasesleep(&b->lock);
+  bunref(b);
+}
 
-  acquire(&bcache.lock);
-  b->refcnt--;
-  if (b->refcnt == 0) {
-    // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+// Allocate a buffer that is not part of the cache, for writing
+// data to a block without disturbing its cached copy.  The
+// caller locks it and drives it with bawrite and bwaitany.
+struct buf*
+bprivate(uint dev)
+{
+  struct buf *b;
+
+  if((b = kmcache_alloc(bcache.cache)) == 0)
+    return 0;
+  memset(b, 0, sizeof(*b));
+  initsleeplock(&b->lock, "private buffer");
+  b->dev = dev;
+  return b;
+}
+
+// Start reading a block into the cache, unless it is cached
+// or someone is already using it, without waiting for the
+// read to finish.  The disk driver releases the buffer with
+// bdone() when the read completes; until then, bread() of
+// the block sleeps on the buffer's lock.  Prefetches may tie
+// up at most a quarter of the cache, so that bget() can
+// always find a buffer to recycle.
+void
+bprefetch(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  acquire(&bcache.lrulock);
+  if(bcache.nasync >= bcache.maxbuf / 4){
+    release(&bcache.lrulock);
+    return;
   }
-  
-  release(&bcache.lock);
+  bcache.nasync++;
+  release(&bcache.lrulock);
+
+  b = bref(dev, blockno);
+  if((b->flags & B_VALID) == 0 && tryacquiresleep(&b->lock)){
+    if((b->flags & B_VALID) == 0){
+      b->flags |= B_ASYNC;
+      idesubmit(b);
+      return;
+    }
+    releasesleep(&b->lock);
+  }
+  bunref(b);
+  acquire(&bcache.lrulock);
+  bcache.nasync--;
+  release(&bcache.lrulock);
 }
-// Blank page.
 
+// Release a prefetched buffer once its read is done.
+// Called by the disk driver, possibly from an interrupt.
+void
+bdone(struct buf *b)
+{
+  releasesleep(&b->lock);
+  bunref(b);
+  acquire(&bcache.lrulock);
+  bcache.nasync--;
+  release(&bcache.lrulock);
+}
+
+// Is the request started on b by bstart, bawrite or bhold
+// done?  Never sleeps.
+int
+bpoll(struct buf *b)
+{
+  return (b->flags & (B_VALID|B_IO)) == B_VALID;
+}
+
+// Start reading a block into the cache, unless it is cached,
+// and return it, unlocked, with a reference that keeps it
+// cached until bunhold.  Use bpoll to see if the read is done
+// and bread to wait for it.  Returns 0, without sleeping, if
+// held buffers already tie up an eighth of the cache.
+struct buf*
+bhold(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  acquire(&bcache.lrulock);
+  if(bcache.nheld >= bcache.maxbuf / 8){
+    release(&bcache.lrulock);
+    return 0;
+  }
+  bcache.nheld++;
+  release(&bcache.lrulock);
+
+  b = bref(dev, blockno);
+  if((b->flags & B_VALID) == 0 && tryacquiresleep(&b->lock)){
+    if((b->flags & B_VALID) == 0){
+      // The read takes a reference of its own for bdone.
+      bref(dev, blockno);
+      acquire(&bcache.lrulock);
+      bcache.nasync++;
+      release(&bcache.lrulock);
+      b->flags |= B_ASYNC;
+      idesubmit(b);
+      return b;
+    }
+    releasesleep(&b->lock);
+  }
+  return b;
+}
+
+// Drop a reference taken by bhold.
+void
+bunhold(struct buf *b)
+{
+  bunref(b);
+  acquire(&bcache.lrulock);
+  bcache.nheld--;
+  release(&bcache.lrulock);
+}
+
+// Return a locked buffer for the block if it is cached and no
+// one is using it, or 0.  Never sleeps.
+struct buf*
+bpeek(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  b = bref(dev, blockno);
+  if((b->flags & B_VALID) && tryacquiresleep(&b->lock)){
+    if(b->flags & B_VALID)
+      return b;
+    releasesleep(&b->lock);
+  }
+  bunref(b);
+  return 0;
+}
+
+// Forget the contents of every cached block that no one is
+// using, so that the next reads of them go to the disk.
+// For benchmarks; returns the number of blocks dropped.
+int
+bdrop(void)
+{
+  struct bucket *h;
+  struct buf *b;
+  int n;
+
+  n = 0;
+  for(h = bcache.bucket; h < &bcache.bucket[NBUCKET]; h++){
+    acquire(&h->lock);
+    for(b = h->head; b; b = b->hnext){
+      // Dirty blocks belong to the log.
+      if(b->refcnt == 0 && (b->flags & (B_VALID|B_DIRTY)) == B_VALID){
+        b->flags &= ~B_VALID;
+        n++;
+      }
+    }
+    release(&h->lock);
+  }
+  return n;
+}
+
+// Copy buffer cache statistics into *st.
+int
+bstat(struct bstat *st)
+{
+  int i;
+
+  memset(st, 0, sizeof(*st));
+  for(i = 0; i < NBUCKET; i++)
+    st->hits += bcache.bucket[i].hits;
+  acquire(&bcache.evictlock);
+  st->nbuf = bcache.nbuf;
+  st->maxbuf = bcache.maxbuf;
+  st->misses = bcache.misses;
+  st->evictions = bcache.evictions;
+  st->promotions = bcache.promotions;
+  acquire(&bcache.lrulock);
+  st->nin = bcache.nin;
+  st->nam = bcache.nam;
+  release(&bcache.lrulock);
+  release(&bcache.evictlock);
+  return 0;
+}
@@ -0,0 +1,16 @@
+#ifndef _BSTAT_H_
+#define _BSTAT_H_
+
+// Buffer cache statistics, filled in by the bstat() system call.
+struct bstat {
+  int nbuf;           // buffers allocated
+  int maxbuf;         // limit on buffers, set at boot
+  int nin;            // buffers on the A1in (seen once) queue
+  int nam;            // buffers on the Am (seen again) queue
+  uint hits;          // lookups that found the block cached
+  uint misses;        // lookups that had to read the block
+  uint evictions;     // buffers recycled for another block
+  uint promotions;    // misses on recently evicted blocks, cached on Am
+};
+
+#endif // _BSTAT_H_
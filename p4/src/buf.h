@@ -6,9 +6,17 @@ struct buf {
   uint refcnt;
   struct buf *prev; // LRU cache list
   struct buf *next;
+  struct buf *hnext; // hash bucket
+  int hot;           // on the Am queue rather than A1in
   struct buf *qnext; // disk queue
+  struct buf *fprev; // disk queue, in arrival order
+  struct buf *fnext;
+  int qidx;          // position in disk queue heap
+  uint qtime;        // ticks when queued
   uchar data[BSIZE];
 };
 #define B_VALID 0x2  // buffer has been read from disk
 #define B_DIRTY 0x4  // buffer needs to be written to disk
+#define B_ASYNC 0x8  // release buffer when the disk is done with it
+#define B_IO    0x10 // request queued or in progress at the disk
 
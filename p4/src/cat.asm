@@ -0,0 +1,1193 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <cat>:
+
+char buf[512];
+
+void
+cat(int fd)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	56                   	push   %esi
+   4:	53                   	push   %ebx
+   5:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n;
+
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+   8:	83 ec 04             	sub    $0x4,%esp
+   b:	68 00 02 00 00       	push   $0x200
+  10:	68 a0 0a 00 00       	push   $0xaa0
+  15:	56                   	push   %esi
+  16:	e8 96 02 00 00       	call   2b1 <read>
+  1b:	89 c3                	mov    %eax,%ebx
+  1d:	83 c4 10             	add    $0x10,%esp
+  20:	85 c0                	test   %eax,%eax
+  22:	7e 2b                	jle    4f <cat+0x4f>
+    if (write(1, buf, n) != n) {
+  24:	83 ec 04             	sub    $0x4,%esp
+  27:	53                   	push   %ebx
+  28:	68 a0 0a 00 00       	push   $0xaa0
+  2d:	6a 01                	push   $0x1
+  2f:	e8 85 02 00 00       	call   2b9 <write>
+  34:	83 c4 10             	add    $0x10,%esp
+  37:	39 d8                	cmp    %ebx,%eax
+  39:	74 cd                	je     8 <cat+0x8>
+      printf(1, "cat: write error\n");
+  3b:	83 ec 08             	sub    $0x8,%esp
+  3e:	68 20 07 00 00       	push   $0x720
+  43:	6a 01                	push   $0x1
+  45:	e8 26 04 00 00       	call   470 <printf>
+      exit();
+  4a:	e8 4a 02 00 00       	call   299 <exit>
+    }
+  }
+  if(n < 0){
+  4f:	78 07                	js     58 <cat+0x58>
+    printf(1, "cat: read error\n");
+    exit();
+  }
+}
+  51:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  54:	5b                   	pop    %ebx
+  55:	5e                   	pop    %esi
+  56:	5d                   	pop    %ebp
+  57:	c3                   	ret
+    printf(1, "cat: read error\n");
+  58:	83 ec 08             	sub    $0x8,%esp
+  5b:	68 32 07 00 00       	push   $0x732
+  60:	6a 01                	push   $0x1
+  62:	e8 09 04 00 00       	call   470 <printf>
+    exit();
+  67:	e8 2d 02 00 00       	call   299 <exit>
+
+0000006c <main>:
+
+int
+main(int argc, char *argv[])
+{
+  6c:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  70:	83 e4 f0             	and    $0xfffffff0,%esp
+  73:	ff 71 fc             	push   -0x4(%ecx)
+  76:	55                   	push   %ebp
+  77:	89 e5                	mov    %esp,%ebp
+  79:	57                   	push   %edi
+  7a:	56                   	push   %esi
+  7b:	53                   	push   %ebx
+  7c:	51                   	push   %ecx
+  7d:	83 ec 18             	sub    $0x18,%esp
+  80:	8b 01                	mov    (%ecx),%eax
+  82:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  85:	8b 51 04             	mov    0x4(%ecx),%edx
+  88:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  int fd, i;
+
+  if(argc <= 1){
+  8b:	83 f8 01             	cmp    $0x1,%eax
+  8e:	7e 07                	jle    97 <main+0x2b>
+    cat(0);
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  90:	be 01 00 00 00       	mov    $0x1,%esi
+  95:	eb 26                	jmp    bd <main+0x51>
+    cat(0);
+  97:	83 ec 0c             	sub    $0xc,%esp
+  9a:	6a 00                	push   $0x0
+  9c:	e8 5f ff ff ff       	call   0 <cat>
+    exit();
+  a1:	e8 f3 01 00 00       	call   299 <exit>
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+  a6:	83 ec 0c             	sub    $0xc,%esp
+  a9:	50                   	push   %eax
+  aa:	e8 51 ff ff ff       	call   0 <cat>
+    close(fd);
+  af:	89 1c 24             	mov    %ebx,(%esp)
+  b2:	e8 0a 02 00 00       	call   2c1 <close>
+  for(i = 1; i < argc; i++){
+  b7:	83 c6 01             	add    $0x1,%esi
+  ba:	83 c4 10             	add    $0x10,%esp
+  bd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  c0:	39 c6                	cmp    %eax,%esi
+  c2:	7d 31                	jge    f5 <main+0x89>
+    if((fd = open(argv[i], 0)) < 0){
+  c4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  c7:	8d 3c b0             	lea    (%eax,%esi,4),%edi
+  ca:	83 ec 08             	sub    $0x8,%esp
+  cd:	6a 00                	push   $0x0
+  cf:	ff 37                	push   (%edi)
+  d1:	e8 03 02 00 00       	call   2d9 <open>
+  d6:	89 c3                	mov    %eax,%ebx
+  d8:	83 c4 10             	add    $0x10,%esp
+  db:	85 c0                	test   %eax,%eax
+  dd:	79 c7                	jns    a6 <main+0x3a>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+  df:	83 ec 04             	sub    $0x4,%esp
+  e2:	ff 37                	push   (%edi)
+  e4:	68 43 07 00 00       	push   $0x743
+  e9:	6a 01                	push   $0x1
+  eb:	e8 80 03 00 00       	call   470 <printf>
+      exit();
+  f0:	e8 a4 01 00 00       	call   299 <exit>
+  }
+  exit();
+  f5:	e8 9f 01 00 00       	call   299 <exit>
+
+000000fa <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  fa:	55                   	push   %ebp
+  fb:	89 e5                	mov    %esp,%ebp
+  fd:	56                   	push   %esi
+  fe:	53                   	push   %ebx
+  ff:	8b 75 08             	mov    0x8(%ebp),%esi
+ 102:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 105:	89 f0                	mov    %esi,%eax
+ 107:	89 d1                	mov    %edx,%ecx
+ 109:	83 c2 01             	add    $0x1,%edx
+ 10c:	89 c3                	mov    %eax,%ebx
+ 10e:	83 c0 01             	add    $0x1,%eax
+ 111:	0f b6 09             	movzbl (%ecx),%ecx
+ 114:	88 0b                	mov    %cl,(%ebx)
+ 116:	84 c9                	test   %cl,%cl
+ 118:	75 ed                	jne    107 <strcpy+0xd>
+    ;
+  return os;
+}
+ 11a:	89 f0                	mov    %esi,%eax
+ 11c:	5b                   	pop    %ebx
+ 11d:	5e                   	pop    %esi
+ 11e:	5d                   	pop    %ebp
+ 11f:	c3                   	ret
+
+00000120 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 126:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 129:	eb 06                	jmp    131 <strcmp+0x11>
+    p++, q++;
+ 12b:	83 c1 01             	add    $0x1,%ecx
+ 12e:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 131:	0f b6 01             	movzbl (%ecx),%eax
+ 134:	84 c0                	test   %al,%al
+ 136:	74 04                	je     13c <strcmp+0x1c>
+ 138:	3a 02                	cmp    (%edx),%al
+ 13a:	74 ef                	je     12b <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 13c:	0f b6 c0             	movzbl %al,%eax
+ 13f:	0f b6 12             	movzbl (%edx),%edx
+ 142:	29 d0                	sub    %edx,%eax
+}
+ 144:	5d                   	pop    %ebp
+ 145:	c3                   	ret
+
+00000146 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 146:	55                   	push   %ebp
+ 147:	89 e5                	mov    %esp,%ebp
+ 149:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 14c:	b8 00 00 00 00       	mov    $0x0,%eax
+ 151:	eb 03                	jmp    156 <strlen+0x10>
+ 153:	83 c0 01             	add    $0x1,%eax
+ 156:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 15a:	75 f7                	jne    153 <strlen+0xd>
+    ;
+  return n;
+}
+ 15c:	5d                   	pop    %ebp
+ 15d:	c3                   	ret
+
+0000015e <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 15e:	55                   	push   %ebp
+ 15f:	89 e5                	mov    %esp,%ebp
+ 161:	57                   	push   %edi
+ 162:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 165:	89 d7                	mov    %edx,%edi
+ 167:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 16a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 16d:	fc                   	cld
+ 16e:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 170:	89 d0                	mov    %edx,%eax
+ 172:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 175:	c9                   	leave
+ 176:	c3                   	ret
+
+00000177 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 177:	55                   	push   %ebp
+ 178:	89 e5                	mov    %esp,%ebp
+ 17a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 17d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 181:	eb 03                	jmp    186 <strchr+0xf>
+ 183:	83 c0 01             	add    $0x1,%eax
+ 186:	0f b6 10             	movzbl (%eax),%edx
+ 189:	84 d2                	test   %dl,%dl
+ 18b:	74 06                	je     193 <strchr+0x1c>
+    if(*s == c)
+ 18d:	38 ca                	cmp    %cl,%dl
+ 18f:	75 f2                	jne    183 <strchr+0xc>
+ 191:	eb 05                	jmp    198 <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 193:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 198:	5d                   	pop    %ebp
+ 199:	c3                   	ret
+
+0000019a <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 19a:	55                   	push   %ebp
+ 19b:	89 e5                	mov    %esp,%ebp
+ 19d:	57                   	push   %edi
+ 19e:	56                   	push   %esi
+ 19f:	53                   	push   %ebx
+ 1a0:	83 ec 1c             	sub    $0x1c,%esp
+ 1a3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 1a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 1ab:	89 de                	mov    %ebx,%esi
+ 1ad:	83 c3 01             	add    $0x1,%ebx
+ 1b0:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1b3:	7d 2e                	jge    1e3 <gets+0x49>
+    cc = read(0, &c, 1);
+ 1b5:	83 ec 04             	sub    $0x4,%esp
+ 1b8:	6a 01                	push   $0x1
+ 1ba:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 1bd:	50                   	push   %eax
+ 1be:	6a 00                	push   $0x0
+ 1c0:	e8 ec 00 00 00       	call   2b1 <read>
+    if(cc < 1)
+ 1c5:	83 c4 10             	add    $0x10,%esp
+ 1c8:	85 c0                	test   %eax,%eax
+ 1ca:	7e 17                	jle    1e3 <gets+0x49>
+      break;
+    buf[i++] = c;
+ 1cc:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1d0:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 1d3:	3c 0a                	cmp    $0xa,%al
+ 1d5:	0f 94 c2             	sete   %dl
+ 1d8:	3c 0d                	cmp    $0xd,%al
+ 1da:	0f 94 c0             	sete   %al
+ 1dd:	08 c2                	or     %al,%dl
+ 1df:	74 ca                	je     1ab <gets+0x11>
+    buf[i++] = c;
+ 1e1:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 1e3:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 1e7:	89 f8                	mov    %edi,%eax
+ 1e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1ec:	5b                   	pop    %ebx
+ 1ed:	5e                   	pop    %esi
+ 1ee:	5f                   	pop    %edi
+ 1ef:	5d                   	pop    %ebp
+ 1f0:	c3                   	ret
+
+000001f1 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1f1:	55                   	push   %ebp
+ 1f2:	89 e5                	mov    %esp,%ebp
+ 1f4:	56                   	push   %esi
+ 1f5:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1f6:	83 ec 08             	sub    $0x8,%esp
+ 1f9:	6a 00                	push   $0x0
+ 1fb:	ff 75 08             	push   0x8(%ebp)
+ 1fe:	e8 d6 00 00 00       	call   2d9 <open>
+  if(fd < 0)
+ 203:	83 c4 10             	add    $0x10,%esp
+ 206:	85 c0                	test   %eax,%eax
+ 208:	78 24                	js     22e <stat+0x3d>
+ 20a:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 20c:	83 ec 08             	sub    $0x8,%esp
+ 20f:	ff 75 0c             	push   0xc(%ebp)
+ 212:	50                   	push   %eax
+ 213:	e8 d9 00 00 00       	call   2f1 <fstat>
+ 218:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 21a:	89 1c 24             	mov    %ebx,(%esp)
+ 21d:	e8 9f 00 00 00       	call   2c1 <close>
+  return r;
+ 222:	83 c4 10             	add    $0x10,%esp
+}
+ 225:	89 f0                	mov    %esi,%eax
+ 227:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 22a:	5b                   	pop    %ebx
+ 22b:	5e                   	pop    %esi
+ 22c:	5d                   	pop    %ebp
+ 22d:	c3                   	ret
+    return -1;
+ 22e:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 233:	eb f0                	jmp    225 <stat+0x34>
+
+00000235 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 235:	55                   	push   %ebp
+ 236:	89 e5                	mov    %esp,%ebp
+ 238:	53                   	push   %ebx
+ 239:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+ 23c:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+ 241:	eb 10                	jmp    253 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+ 243:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+ 246:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+ 249:	83 c1 01             	add    $0x1,%ecx
+ 24c:	0f be c0             	movsbl %al,%eax
+ 24f:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+ 253:	0f b6 01             	movzbl (%ecx),%eax
+ 256:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 259:	80 fb 09             	cmp    $0x9,%bl
+ 25c:	76 e5                	jbe    243 <atoi+0xe>
+  return n;
+}
+ 25e:	89 d0                	mov    %edx,%eax
+ 260:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 263:	c9                   	leave
+ 264:	c3                   	ret
+
+00000265 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 265:	55                   	push   %ebp
+ 266:	89 e5                	mov    %esp,%ebp
+ 268:	56                   	push   %esi
+ 269:	53                   	push   %ebx
+ 26a:	8b 75 08             	mov    0x8(%ebp),%esi
+ 26d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 270:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 273:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 275:	eb 0d                	jmp    284 <memmove+0x1f>
+    *dst++ = *src++;
+ 277:	0f b6 01             	movzbl (%ecx),%eax
+ 27a:	88 02                	mov    %al,(%edx)
+ 27c:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 27f:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 282:	89 d8                	mov    %ebx,%eax
+ 284:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 287:	85 c0                	test   %eax,%eax
+ 289:	7f ec                	jg     277 <memmove+0x12>
+  return vdst;
+}
+ 28b:	89 f0                	mov    %esi,%eax
+ 28d:	5b                   	pop    %ebx
+ 28e:	5e                   	pop    %esi
+ 28f:	5d                   	pop    %ebp
+ 290:	c3                   	ret
+
+00000291 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 291:	b8 01 00 00 00       	mov    $0x1,%eax
+ 296:	cd 40                	int    $0x40
+ 298:	c3                   	ret
+
+00000299 <exit>:
+SYSCALL(exit)
+ 299:	b8 02 00 00 00       	mov    $0x2,%eax
+ 29e:	cd 40                	int    $0x40
+ 2a0:	c3                   	ret
+
+000002a1 <wait>:
+SYSCALL(wait)
+ 2a1:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2a6:	cd 40                	int    $0x40
+ 2a8:	c3                   	ret
+
+000002a9 <pipe>:
+SYSCALL(pipe)
+ 2a9:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2ae:	cd 40                	int    $0x40
+ 2b0:	c3                   	ret
+
+000002b1 <read>:
+SYSCALL(read)
+ 2b1:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2b6:	cd 40                	int    $0x40
+ 2b8:	c3                   	ret
+
+000002b9 <write>:
+SYSCALL(write)
+ 2b9:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2be:	cd 40                	int    $0x40
+ 2c0:	c3                   	ret
+
+000002c1 <close>:
+SYSCALL(close)
+ 2c1:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2c6:	cd 40                	int    $0x40
+ 2c8:	c3                   	ret
+
+000002c9 <kill>:
+SYSCALL(kill)
+ 2c9:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2ce:	cd 40                	int    $0x40
+ 2d0:	c3                   	ret
+
+000002d1 <exec>:
+SYSCALL(exec)
+ 2d1:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2d6:	cd 40                	int    $0x40
+ 2d8:	c3                   	ret
+
+000002d9 <open>:
+SYSCALL(open)
+ 2d9:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2de:	cd 40                	int    $0x40
+ 2e0:	c3                   	ret
+
+000002e1 <mknod>:
+SYSCALL(mknod)
+ 2e1:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2e6:	cd 40                	int    $0x40
+ 2e8:	c3                   	ret
+
+000002e9 <unlink>:
+SYSCALL(unlink)
+ 2e9:	b8 12 00 00 00       	mov    $0x12,%eax
+ 2ee:	cd 40                	int    $0x40
+ 2f0:	c3                   	ret
+
+000002f1 <fstat>:
+SYSCALL(fstat)
+ 2f1:	b8 08 00 00 00       	mov    $0x8,%eax
+ 2f6:	cd 40                	int    $0x40
+ 2f8:	c3                   	ret
+
+000002f9 <link>:
+SYSCALL(link)
+ 2f9:	b8 13 00 00 00       	mov    $0x13,%eax
+ 2fe:	cd 40                	int    $0x40
+ 300:	c3                   	ret
+
+00000301 <mkdir>:
+SYSCALL(mkdir)
+ 301:	b8 14 00 00 00       	mov    $0x14,%eax
+ 306:	cd 40                	int    $0x40
+ 308:	c3                   	ret
+
+00000309 <chdir>:
+SYSCALL(chdir)
+ 309:	b8 09 00 00 00       	mov    $0x9,%eax
+ 30e:	cd 40                	int    $0x40
+ 310:	c3                   	ret
+
+00000311 <dup>:
+SYSCALL(dup)
+ 311:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 316:	cd 40                	int    $0x40
+ 318:	c3                   	ret
+
+00000319 <getpid>:
+SYSCALL(getpid)
+ 319:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 31e:	cd 40                	int    $0x40
+ 320:	c3                   	ret
+
+00000321 <sbrk>:
+SYSCALL(sbrk)
+ 321:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 326:	cd 40                	int    $0x40
+ 328:	c3                   	ret
+
+00000329 <sleep>:
+SYSCALL(sleep)
+ 329:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 32e:	cd 40                	int    $0x40
+ 330:	c3                   	ret
+
+00000331 <uptime>:
+SYSCALL(uptime)
+ 331:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 336:	cd 40                	int    $0x40
+ 338:	c3                   	ret
+
+00000339 <setpri>:
+SYSCALL(setpri)
+ 339:	b8 16 00 00 00       	mov    $0x16,%eax
+ 33e:	cd 40                	int    $0x40
+ 340:	c3                   	ret
+
+00000341 <getpri>:
+SYSCALL(getpri)
+ 341:	b8 17 00 00 00       	mov    $0x17,%eax
+ 346:	cd 40                	int    $0x40
+ 348:	c3                   	ret
+
+00000349 <fork2>:
+SYSCALL(fork2)
+ 349:	b8 18 00 00 00       	mov    $0x18,%eax
+ 34e:	cd 40                	int    $0x40
+ 350:	c3                   	ret
+
+00000351 <getpinfo>:
+SYSCALL(getpinfo)
+ 351:	b8 19 00 00 00       	mov    $0x19,%eax
+ 356:	cd 40                	int    $0x40
+ 358:	c3                   	ret
+
+00000359 <spawn>:
+SYSCALL(spawn)
+ 359:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 35e:	cd 40                	int    $0x40
+ 360:	c3                   	ret
+
+00000361 <spawnn>:
+SYSCALL(spawnn)
+ 361:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 366:	cd 40                	int    $0x40
+ 368:	c3                   	ret
+
+00000369 <kmstat>:
+SYSCALL(kmstat)
+ 369:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 36e:	cd 40                	int    $0x40
+ 370:	c3                   	ret
+
+00000371 <slabstat>:
+SYSCALL(slabstat)
+ 371:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 376:	cd 40                	int    $0x40
+ 378:	c3                   	ret
+
+00000379 <shmget>:
+SYSCALL(shmget)
+ 379:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 37e:	cd 40                	int    $0x40
+ 380:	c3                   	ret
+
+00000381 <shmat>:
+SYSCALL(shmat)
+ 381:	b8 20 00 00 00       	mov    $0x20,%eax
+ 386:	cd 40                	int    $0x40
+ 388:	c3                   	ret
+
+00000389 <shmdt>:
+SYSCALL(shmdt)
+ 389:	b8 21 00 00 00       	mov    $0x21,%eax
+ 38e:	cd 40                	int    $0x40
+ 390:	c3                   	ret
+
+00000391 <mmap>:
+SYSCALL(mmap)
+ 391:	b8 22 00 00 00       	mov    $0x22,%eax
+ 396:	cd 40                	int    $0x40
+ 398:	c3                   	ret
+
+00000399 <munmap>:
+SYSCALL(munmap)
+ 399:	b8 23 00 00 00       	mov    $0x23,%eax
+ 39e:	cd 40                	int    $0x40
+ 3a0:	c3                   	ret
+
+000003a1 <bstat>:
+SYSCALL(bstat)
+ 3a1:	b8 24 00 00 00       	mov    $0x24,%eax
+ 3a6:	cd 40                	int    $0x40
+ 3a8:	c3                   	ret
+
+000003a9 <aread>:
+SYSCALL(aread)
+ 3a9:	b8 25 00 00 00       	mov    $0x25,%eax
+ 3ae:	cd 40                	int    $0x40
+ 3b0:	c3                   	ret
+
+000003b1 <await>:
+SYSCALL(await)
+ 3b1:	b8 26 00 00 00       	mov    $0x26,%eax
+ 3b6:	cd 40                	int    $0x40
+ 3b8:	c3                   	ret
+
+000003b9 <bdrop>:
+SYSCALL(bdrop)
+ 3b9:	b8 27 00 00 00       	mov    $0x27,%eax
+ 3be:	cd 40                	int    $0x40
+ 3c0:	c3                   	ret
+
+000003c1 <vfork>:
+# exec or exit, and its ret would leave the slot holding our
+# return address free for it to overwrite.  Keep the return
+# address in %ecx, which the kernel restores for both sides.
+.globl vfork
+vfork:
+  popl %ecx
+ 3c1:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+ 3c2:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  int $T_SYSCALL
+ 3c7:	cd 40                	int    $0x40
+  pushl %ecx
+ 3c9:	51                   	push   %ecx
+  ret
+ 3ca:	c3                   	ret
+
+000003cb <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 3cb:	55                   	push   %ebp
+ 3cc:	89 e5                	mov    %esp,%ebp
+ 3ce:	83 ec 1c             	sub    $0x1c,%esp
+ 3d1:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 3d4:	6a 01                	push   $0x1
+ 3d6:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 3d9:	52                   	push   %edx
+ 3da:	50                   	push   %eax
+ 3db:	e8 d9 fe ff ff       	call   2b9 <write>
+}
+ 3e0:	83 c4 10             	add    $0x10,%esp
+ 3e3:	c9                   	leave
+ 3e4:	c3                   	ret
+
+000003e5 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3e5:	55                   	push   %ebp
+ 3e6:	89 e5                	mov    %esp,%ebp
+ 3e8:	57                   	push   %edi
+ 3e9:	56                   	push   %esi
+ 3ea:	53                   	push   %ebx
+ 3eb:	83 ec 2c             	sub    $0x2c,%esp
+ 3ee:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 3f1:	89 d0                	mov    %edx,%eax
+ 3f3:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 3f5:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 3f9:	0f 95 c1             	setne  %cl
+ 3fc:	c1 ea 1f             	shr    $0x1f,%edx
+ 3ff:	84 d1                	test   %dl,%cl
+ 401:	74 44                	je     447 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 403:	f7 d8                	neg    %eax
+ 405:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 407:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 40e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 413:	89 c8                	mov    %ecx,%eax
+ 415:	ba 00 00 00 00       	mov    $0x0,%edx
+ 41a:	f7 f6                	div    %esi
+ 41c:	89 df                	mov    %ebx,%edi
+ 41e:	83 c3 01             	add    $0x1,%ebx
+ 421:	0f b6 92 b8 07 00 00 	movzbl 0x7b8(%edx),%edx
+ 428:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 42c:	89 ca                	mov    %ecx,%edx
+ 42e:	89 c1                	mov    %eax,%ecx
+ 430:	39 f2                	cmp    %esi,%edx
+ 432:	73 df                	jae    413 <printint+0x2e>
+  if(neg)
+ 434:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 438:	74 31                	je     46b <printint+0x86>
+    buf[i++] = '-';
+ 43a:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 43f:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 442:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 445:	eb 17                	jmp    45e <printint+0x79>
+    x = xx;
+ 447:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 449:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 450:	eb bc                	jmp    40e <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 452:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 457:	89 f0                	mov    %esi,%eax
+ 459:	e8 6d ff ff ff       	call   3cb <putc>
+  while(--i >= 0)
+ 45e:	83 eb 01             	sub    $0x1,%ebx
+ 461:	79 ef                	jns    452 <printint+0x6d>
+}
+ 463:	83 c4 2c             	add    $0x2c,%esp
+ 466:	5b                   	pop    %ebx
+ 467:	5e                   	pop    %esi
+ 468:	5f                   	pop    %edi
+ 469:	5d                   	pop    %ebp
+ 46a:	c3                   	ret
+ 46b:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 46e:	eb ee                	jmp    45e <printint+0x79>
+
+00000470 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	57                   	push   %edi
+ 474:	56                   	push   %esi
+ 475:	53                   	push   %ebx
+ 476:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 479:	8d 45 10             	lea    0x10(%ebp),%eax
+ 47c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 47f:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 484:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 489:	eb 14                	jmp    49f <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 48b:	89 fa                	mov    %edi,%edx
+ 48d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 490:	e8 36 ff ff ff       	call   3cb <putc>
+ 495:	eb 05                	jmp    49c <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 497:	83 fe 25             	cmp    $0x25,%esi
+ 49a:	74 25                	je     4c1 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 49c:	83 c3 01             	add    $0x1,%ebx
+ 49f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4a2:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 4a6:	84 c0                	test   %al,%al
+ 4a8:	0f 84 20 01 00 00    	je     5ce <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 4ae:	0f be f8             	movsbl %al,%edi
+ 4b1:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 4b4:	85 f6                	test   %esi,%esi
+ 4b6:	75 df                	jne    497 <printf+0x27>
+      if(c == '%'){
+ 4b8:	83 f8 25             	cmp    $0x25,%eax
+ 4bb:	75 ce                	jne    48b <printf+0x1b>
+        state = '%';
+ 4bd:	89 c6                	mov    %eax,%esi
+ 4bf:	eb db                	jmp    49c <printf+0x2c>
+      if(c == 'd'){
+ 4c1:	83 f8 25             	cmp    $0x25,%eax
+ 4c4:	0f 84 cf 00 00 00    	je     599 <printf+0x129>
+ 4ca:	0f 8c dd 00 00 00    	jl     5ad <printf+0x13d>
+ 4d0:	83 f8 78             	cmp    $0x78,%eax
+ 4d3:	0f 8f d4 00 00 00    	jg     5ad <printf+0x13d>
+ 4d9:	83 f8 63             	cmp    $0x63,%eax
+ 4dc:	0f 8c cb 00 00 00    	jl     5ad <printf+0x13d>
+ 4e2:	83 e8 63             	sub    $0x63,%eax
+ 4e5:	83 f8 15             	cmp    $0x15,%eax
+ 4e8:	0f 87 bf 00 00 00    	ja     5ad <printf+0x13d>
+ 4ee:	ff 24 85 60 07 00 00 	jmp    *0x760(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 4f5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 4f8:	8b 17                	mov    (%edi),%edx
+ 4fa:	83 ec 0c             	sub    $0xc,%esp
+ 4fd:	6a 01                	push   $0x1
+ 4ff:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 504:	8b 45 08             	mov    0x8(%ebp),%eax
+ 507:	e8 d9 fe ff ff       	call   3e5 <printint>
+        ap++;
+ 50c:	83 c7 04             	add    $0x4,%edi
+ 50f:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 512:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 515:	be 00 00 00 00       	mov    $0x0,%esi
+ 51a:	eb 80                	jmp    49c <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 51c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 51f:	8b 17                	mov    (%edi),%edx
+ 521:	83 ec 0c             	sub    $0xc,%esp
+ 524:	6a 00                	push   $0x0
+ 526:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 52b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 52e:	e8 b2 fe ff ff       	call   3e5 <printint>
+        ap++;
+ 533:	83 c7 04             	add    $0x4,%edi
+ 536:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 539:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 53c:	be 00 00 00 00       	mov    $0x0,%esi
+ 541:	e9 56 ff ff ff       	jmp    49c <printf+0x2c>
+        s = (char*)*ap;
+ 546:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 549:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 54b:	83 c0 04             	add    $0x4,%eax
+ 54e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 551:	85 f6                	test   %esi,%esi
+ 553:	75 15                	jne    56a <printf+0xfa>
+          s = "(null)";
+ 555:	be 58 07 00 00       	mov    $0x758,%esi
+ 55a:	eb 0e                	jmp    56a <printf+0xfa>
+          putc(fd, *s);
+ 55c:	0f be d2             	movsbl %dl,%edx
+ 55f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 562:	e8 64 fe ff ff       	call   3cb <putc>
+          s++;
+ 567:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 56a:	0f b6 16             	movzbl (%esi),%edx
+ 56d:	84 d2                	test   %dl,%dl
+ 56f:	75 eb                	jne    55c <printf+0xec>
+      state = 0;
+ 571:	be 00 00 00 00       	mov    $0x0,%esi
+ 576:	e9 21 ff ff ff       	jmp    49c <printf+0x2c>
+        putc(fd, *ap);
+ 57b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 57e:	0f be 17             	movsbl (%edi),%edx
+ 581:	8b 45 08             	mov    0x8(%ebp),%eax
+ 584:	e8 42 fe ff ff       	call   3cb <putc>
+        ap++;
+ 589:	83 c7 04             	add    $0x4,%edi
+ 58c:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 58f:	be 00 00 00 00       	mov    $0x0,%esi
+ 594:	e9 03 ff ff ff       	jmp    49c <printf+0x2c>
+        putc(fd, c);
+ 599:	89 fa                	mov    %edi,%edx
+ 59b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 59e:	e8 28 fe ff ff       	call   3cb <putc>
+      state = 0;
+ 5a3:	be 00 00 00 00       	mov    $0x0,%esi
+ 5a8:	e9 ef fe ff ff       	jmp    49c <printf+0x2c>
+        putc(fd, '%');
+ 5ad:	ba 25 00 00 00       	mov    $0x25,%edx
+ 5b2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b5:	e8 11 fe ff ff       	call   3cb <putc>
+        putc(fd, c);
+ 5ba:	89 fa                	mov    %edi,%edx
+ 5bc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5bf:	e8 07 fe ff ff       	call   3cb <putc>
+      state = 0;
+ 5c4:	be 00 00 00 00       	mov    $0x0,%esi
+ 5c9:	e9 ce fe ff ff       	jmp    49c <printf+0x2c>
+    }
+  }
+}
+ 5ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5d1:	5b                   	pop    %ebx
+ 5d2:	5e                   	pop    %esi
+ 5d3:	5f                   	pop    %edi
+ 5d4:	5d                   	pop    %ebp
+ 5d5:	c3                   	ret
+
+000005d6 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 5d6:	55                   	push   %ebp
+ 5d7:	89 e5                	mov    %esp,%ebp
+ 5d9:	57                   	push   %edi
+ 5da:	56                   	push   %esi
+ 5db:	53                   	push   %ebx
+ 5dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 5df:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 5e2:	a1 a0 0c 00 00       	mov    0xca0,%eax
+ 5e7:	eb 02                	jmp    5eb <free+0x15>
+ 5e9:	89 d0                	mov    %edx,%eax
+ 5eb:	39 c8                	cmp    %ecx,%eax
+ 5ed:	73 04                	jae    5f3 <free+0x1d>
+ 5ef:	3b 08                	cmp    (%eax),%ecx
+ 5f1:	72 12                	jb     605 <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 5f3:	8b 10                	mov    (%eax),%edx
+ 5f5:	39 d0                	cmp    %edx,%eax
+ 5f7:	72 f0                	jb     5e9 <free+0x13>
+ 5f9:	39 c8                	cmp    %ecx,%eax
+ 5fb:	72 08                	jb     605 <free+0x2f>
+ 5fd:	39 d1                	cmp    %edx,%ecx
+ 5ff:	72 04                	jb     605 <free+0x2f>
+ 601:	89 d0                	mov    %edx,%eax
+ 603:	eb e6                	jmp    5eb <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 605:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 608:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 60b:	8b 10                	mov    (%eax),%edx
+ 60d:	39 d7                	cmp    %edx,%edi
+ 60f:	74 19                	je     62a <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 611:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 614:	8b 50 04             	mov    0x4(%eax),%edx
+ 617:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 61a:	39 ce                	cmp    %ecx,%esi
+ 61c:	74 1b                	je     639 <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 61e:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 620:	a3 a0 0c 00 00       	mov    %eax,0xca0
+}
+ 625:	5b                   	pop    %ebx
+ 626:	5e                   	pop    %esi
+ 627:	5f                   	pop    %edi
+ 628:	5d                   	pop    %ebp
+ 629:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 62a:	03 72 04             	add    0x4(%edx),%esi
+ 62d:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 630:	8b 10                	mov    (%eax),%edx
+ 632:	8b 12                	mov    (%edx),%edx
+ 634:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 637:	eb db                	jmp    614 <free+0x3e>
+    p->s.size += bp->s.size;
+ 639:	03 53 fc             	add    -0x4(%ebx),%edx
+ 63c:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 63f:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 642:	89 10                	mov    %edx,(%eax)
+ 644:	eb da                	jmp    620 <free+0x4a>
+
+00000646 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 646:	55                   	push   %ebp
+ 647:	89 e5                	mov    %esp,%ebp
+ 649:	53                   	push   %ebx
+ 64a:	83 ec 04             	sub    $0x4,%esp
+ 64d:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 64f:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 654:	77 05                	ja     65b <morecore+0x15>
+    nu = 4096;
+ 656:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 65b:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 662:	83 ec 0c             	sub    $0xc,%esp
+ 665:	50                   	push   %eax
+ 666:	e8 b6 fc ff ff       	call   321 <sbrk>
+  if(p == (char*)-1)
+ 66b:	83 c4 10             	add    $0x10,%esp
+ 66e:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 671:	74 1c                	je     68f <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 673:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 676:	83 c0 08             	add    $0x8,%eax
+ 679:	83 ec 0c             	sub    $0xc,%esp
+ 67c:	50                   	push   %eax
+ 67d:	e8 54 ff ff ff       	call   5d6 <free>
+  return freep;
+ 682:	a1 a0 0c 00 00       	mov    0xca0,%eax
+ 687:	83 c4 10             	add    $0x10,%esp
+}
+ 68a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 68d:	c9                   	leave
+ 68e:	c3                   	ret
+    return 0;
+ 68f:	b8 00 00 00 00       	mov    $0x0,%eax
+ 694:	eb f4                	jmp    68a <morecore+0x44>
+
+00000696 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 696:	55                   	push   %ebp
+ 697:	89 e5                	mov    %esp,%ebp
+ 699:	53                   	push   %ebx
+ 69a:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 69d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6a0:	8d 58 07             	lea    0x7(%eax),%ebx
+ 6a3:	c1 eb 03             	shr    $0x3,%ebx
+ 6a6:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 6a9:	8b 0d a0 0c 00 00    	mov    0xca0,%ecx
+ 6af:	85 c9                	test   %ecx,%ecx
+ 6b1:	74 04                	je     6b7 <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6b3:	8b 01                	mov    (%ecx),%eax
+ 6b5:	eb 4a                	jmp    701 <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 6b7:	c7 05 a0 0c 00 00 a4 	movl   $0xca4,0xca0
+ 6be:	0c 00 00 
+ 6c1:	c7 05 a4 0c 00 00 a4 	movl   $0xca4,0xca4
+ 6c8:	0c 00 00 
+    base.s.size = 0;
+ 6cb:	c7 05 a8 0c 00 00 00 	movl   $0x0,0xca8
+ 6d2:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 6d5:	b9 a4 0c 00 00       	mov    $0xca4,%ecx
+ 6da:	eb d7                	jmp    6b3 <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 6dc:	74 19                	je     6f7 <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 6de:	29 da                	sub    %ebx,%edx
+ 6e0:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 6e3:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 6e6:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 6e9:	89 0d a0 0c 00 00    	mov    %ecx,0xca0
+      return (void*)(p + 1);
+ 6ef:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 6f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 6f5:	c9                   	leave
+ 6f6:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 6f7:	8b 10                	mov    (%eax),%edx
+ 6f9:	89 11                	mov    %edx,(%ecx)
+ 6fb:	eb ec                	jmp    6e9 <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6fd:	89 c1                	mov    %eax,%ecx
+ 6ff:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 701:	8b 50 04             	mov    0x4(%eax),%edx
+ 704:	39 da                	cmp    %ebx,%edx
+ 706:	73 d4                	jae    6dc <malloc+0x46>
+    if(p == freep)
+ 708:	39 05 a0 0c 00 00    	cmp    %eax,0xca0
+ 70e:	75 ed                	jne    6fd <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 710:	89 d8                	mov    %ebx,%eax
+ 712:	e8 2f ff ff ff       	call   646 <morecore>
+ 717:	85 c0                	test   %eax,%eax
+ 719:	75 e2                	jne    6fd <malloc+0x67>
+ 71b:	eb d5                	jmp    6f2 <malloc+0x5c>
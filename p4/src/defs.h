@@ -1,4 +1,5 @@
 struct buf;
+struct bstat;
 struct context;
 struct file;
 struct inode;
@@ -10,12 +11,36 @@ struct sleeplock;
 struct stat;
 struct superblock;
 struct pstat;
+struct kmstat;
+struct kmcache;
+struct slabstat;
+struct shm;
+struct vma;
+
+// aio.c
+int             aread(struct file*, char*, int);
+int             await(int);
+int             apoll(int);
+void            aiofree(struct proc*);
 
 // bio.c
 void            binit(void);
 struct buf*     bread(uint, uint);
 void            brelse(struct buf*);
 void            bwrite(struct buf*);
+int             bstat(struct bstat*);
+int             bdrop(void);
+void            bprefetch(uint, uint);
+void            bdone(struct buf*);
+int             bpoll(struct buf*);
+struct buf*     bhold(uint, uint);
+void            bunhold(struct buf*);
+struct buf*     bpeek(uint, uint);
+struct buf*     bstart(uint, uint);
+void            bawrite(struct buf*);
+void            bwait(struct buf*);
+int             bwaitany(struct buf**, int);
+struct buf*     bprivate(uint);
 
 // console.c
 void            consoleinit(void);
@@ -25,6 +50,7 @@ void            panic(char*) __attribute__((noreturn));
 
 // exec.c
 int             exec(char*, char**);
+int             execinto(struct proc*, char*, char**);
 
 // file.c
 struct file*    filealloc(void);
@@ -42,6 +68,7 @@ struct inode*   dirlookup(struct inode*, char*, uint*);
 struct inode*   ialloc(uint, short);
 struct inode*   idup(struct inode*);
 void            iinit(int dev);
+void            itext(struct inode*, int);
 void            ilock(struct inode*);
 void            iput(struct inode*);
 void            iunlock(struct inode*);
@@ -51,6 +78,8 @@ int             namecmp(const char*, const char*);
 struct inode*   namei(char*);
 struct inode*   nameiparent(char*, char*);
 int             readi(struct inode*, char*, uint, uint);
+void            iprefetch(struct inode*, uint, uint);
+int             ihold(struct inode*, uint, uint, struct buf**);
 void            stati(struct inode*, struct stat*);
 int             writei(struct inode*, char*, uint, uint);
 
@@ -58,22 +87,36 @@ int             writei(struct inode*, char*, uint, uint);
 void            ideinit(void);
 void            ideintr(void);
 void            iderw(struct buf*);
+void            idesubmit(struct buf*);
+int             idewaitany(struct buf**, int);
+void            idedone(struct buf*);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
+void            ioapicenablelevel(int irq, int cpu);
 extern uchar    ioapicid;
 void            ioapicinit(void);
 
 // kalloc.c
+extern uint     phystop;
 char*           kalloc(void);
+char*           kalloc_zeroed(void);
+char*           kalloc_order(int);
+void            kfree_order(char*, int);
+char*           kdup(char*);
 void            kfree(char*);
+int             kfreepages(void);
+int             krefcnt(char*);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
+int             kmstat(struct kmstat*);
+void            kzeroidle(void);
 
 // kbd.c
 void            kbdintr(void);
 
 // lapic.c
+uint            cmosmemtop(void);
 void            cmostime(struct rtcdate *r);
 int             lapicid(void);
 extern volatile uint*    lapic;
@@ -87,17 +130,35 @@ void            initlog(int dev);
 void            log_write(struct buf*);
 void            begin_op();
 void            end_op();
+void            logtick(void);
+void            logsync(void);
 
 // mp.c
 extern int      ismp;
 void            mpinit(void);
 
+// mmap.c
+int             mmap(struct file*, uint, uint, int, int);
+int             munmap(uint, uint);
+
+// pgcache.c
+void            pcinit(void);
+char*           pcget(struct inode*, uint, uint);
+void            pcinval(struct inode*);
+
+// pci.c
+uint            pciread(uint, int);
+void            pciwrite(uint, int, uint);
+int             pcifindid(ushort, ushort);
+int             pcifindclass(uchar, uchar);
+
 // picirq.c
 void            picenable(int);
 void            picinit(void);
 
 // pipe.c
 int             pipealloc(struct file**, struct file**);
+void            pipeinit(void);
 void            pipeclose(struct pipe*, int);
 int             piperead(struct pipe*, char*, int);
 int             pipewrite(struct pipe*, char*, int);
@@ -108,6 +169,7 @@ void            exit(void);
 int             fork(void);
 int             growproc(int);
 int             kill(int);
+int             kthread(char*, void (*)(void));
 struct cpu*     mycpu(void);
 struct proc*    myproc();
 void            pinit(void);
@@ -124,6 +186,10 @@ int             setpri(int , int );
 int             getpri(int);
 int             fork2(int);
 int             getpinfo(struct pstat *);
+int             spawn(char*, char**, int);
+int             spawnn(char*, char**, int, int, int*);
+int             vfork(void);
+void            vforkdone(struct proc*);
 
 
 
@@ -139,8 +205,25 @@ void            release(struct spinlock*);
 void            pushcli(void);
 void            popcli(void);
 
+// shm.c
+void            shminit(void);
+int             shmget(char*, int);
+int             shmat(int);
+int             shmdt(uint);
+void            shmdup(struct shm*);
+void            shmput(struct shm*);
+void            shmrelease(struct proc*);
+
+// slab.c
+void            kmcacheinit(void);
+struct kmcache* kmcache_create(char*, uint);
+void*           kmcache_alloc(struct kmcache*);
+void            kmcache_free(struct kmcache*, void*);
+int             slabstat(struct slabstat*);
+
 // sleeplock.c
 void            acquiresleep(struct sleeplock*);
+int             tryacquiresleep(struct sleeplock*);
 void            releasesleep(struct sleeplock*);
 int             holdingsleep(struct sleeplock*);
 void            initsleeplock(struct sleeplock*, char*);
@@ -157,6 +240,7 @@ char*           strncpy(char*, const char*, int);
 // syscall.c
 int             argint(int, int*);
 int             argptr(int, char**, int);
+int             argptrw(int, char**, int);
 int             argstr(int, char**);
 int             fetchint(uint, int*);
 int             fetchstr(uint, char**);
@@ -176,6 +260,12 @@ void            uartinit(void);
 void            uartintr(void);
 void            uartputc(int);
 
+// virtio.c
+extern int      virtioirq;
+int             virtioinit(void);
+void            virtiosubmit(struct buf*);
+void            virtiointr(void);
+
 // vm.c
 void            seginit(void);
 void            kvmalloc(void);
@@ -185,12 +275,21 @@ int             allocuvm(pde_t*, uint, uint);
 int             deallocuvm(pde_t*, uint, uint);
 void            freevm(pde_t*);
 void            inituvm(pde_t*, char*, uint);
-int             loaduvm(pde_t*, char*, struct inode*, uint, uint);
 pde_t*          copyuvm(pde_t*, uint);
 void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
+int             cowfault(pde_t*, uint);
+int             pagefault(struct proc*, uint, int);
+int             faultin(struct proc*, uint, uint, int);
+int             vmaadd(struct vma*, uint, uint, uint, struct inode*, int);
+void            vmadup(struct vma*, struct vma*);
+void            vmafree(struct vma*);
+struct vma*     vmaslot(struct vma*);
+uint            vmagap(struct vma*, uint);
+int             mapshared(pde_t*, uint, char**, int);
+uint            uend(struct proc*, uint);
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
@@ -6,9 +6,22 @@
 #include "defs.h"
 #include "x86.h"
 #include "elf.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
 
 int
 exec(char *path, char **argv)
+{
+  return execinto(myproc(), path, argv);
+}
+
+// Replace the user image of p with the program at path.
+// p is either the current process (exec) or a freshly
+// allocated process that has no image yet (spawn).
+int
+execinto(struct proc *p, char *path, char **argv)
 {
   char *s, *last;
   int i, off;
@@ -17,8 +30,9 @@ exec(char *path, char **argv)
   struct inode *ip;
   struct proghdr ph;
   pde_t *pgdir, *oldpgdir;
-  struct proc *curproc = myproc();
+  struct vma vma[NVMA];
 
+  memset(vma, 0, sizeof(vma));
   begin_op();
 
   if((ip = namei(path)) == 0){
@@ -38,7 +52,10 @@ exec(char *path, char **argv)
   if((pgdir = setupkvm()) == 0)
     goto bad;
 
-  // Load program into memory.
+  // Map the program.  Nothing is read yet: each segment is
+  // recorded as a file-backed region that pagefault() loads a
+  // page at a time as the program touches it, and bss pages
+  // are zero-filled on demand like the heap.
   sz = 0;
   for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
     if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
@@ -47,13 +64,17 @@ exec(char *path, char **argv)
       continue;
     if(ph.memsz < ph.filesz)
       goto bad;
-    if(ph.vaddr + ph.memsz < ph.vaddr)
-      goto bad;
-    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
+    if(ph.vaddr + ph.memsz < ph.vaddr || ph.vaddr + ph.memsz >= UMAPBASE)
       goto bad;
     if(ph.vaddr % PGSIZE != 0)
       goto bad;
-    if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
+    if(ph.off + ph.filesz < ph.off || ph.off + ph.filesz > ip->size)
+      goto bad;
+    if(ph.vaddr + ph.memsz > sz)
+      sz = ph.vaddr + ph.memsz;
+    if(ph.filesz == 0)
+      continue;
+    if(vmaadd(vma, ph.vaddr, ph.filesz, ph.off, ip, VMA_WRITE) < 0)
       goto bad;
   }
   iunlockput(ip);
@@ -91,16 +112,24 @@ exec(char *path, char **argv)
   for(last=s=path; *s; s++)
     if(*s == '/')
       last = s+1;
-  safestrcpy(curproc->name, last, sizeof(curproc->name));
+  safestrcpy(p->name, last, sizeof(p->name));
 
   // Commit to the user image.
-  oldpgdir = curproc->pgdir;
-  curproc->pgdir = pgdir;
-  curproc->sz = sz;
-  curproc->tf->eip = elf.entry;  // main
-  curproc->tf->esp = sp;
-  switchuvm(curproc);
-  freevm(oldpgdir);
+  oldpgdir = p->pgdir;
+  p->pgdir = pgdir;
+  p->sz = sz;
+  p->tf->eip = elf.entry;  // main
+  p->tf->esp = sp;
+  if(p == myproc())
+    switchuvm(p);
+  if(p->borrowed)
+    vforkdone(p);  // oldpgdir belongs to the vfork parent
+  else if(oldpgdir)
+    freevm(oldpgdir);
+  vmafree(p->vma);
+  memmove(p->vma, vma, sizeof(vma));
+  aiofree(p);
+  shmrelease(p);
   return 0;
 
  bad:
@@ -110,5 +139,6 @@ exec(char *path, char **argv)
     iunlockput(ip);
     end_op();
   }
+  vmafree(vma);
   return -1;
 }
@@ -14,6 +14,7 @@ struct inode {
   uint dev;           // Device number
   uint inum;          // Inode number
   int ref;            // Reference count
+  int ntext;          // # of program vmas mapping it; no writes
   struct sleeplock lock; // protects everything below here
   int valid;          // inode has been read from disk?
 
@@ -23,6 +24,10 @@ struct inode {
   short nlink;
   uint size;
   uint addrs[NDIRECT+1];
+
+  uint ranext;        // block after the last one read
+  uint raend;         // block after the last one prefetched
+  uint rawin;         // read-ahead window in blocks; 0 if off
 };
 
 // table mapping major device number to
@@ -0,0 +1,1256 @@
+
+_forkbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+struct kmstat st;
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 1c             	sub    $0x1c,%esp
+  int i, j, n, pid, t0, t1;
+  uint allocs, hits;
+  char *base, *p;
+
+  printf(1, "forkbench: %d forks per size\n", N);
+  14:	6a 64                	push   $0x64
+  16:	68 18 08 00 00       	push   $0x818
+  1b:	6a 01                	push   $0x1
+  1d:	e8 49 05 00 00       	call   56b <printf>
+  base = sbrk(0);
+  22:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  29:	e8 ee 03 00 00       	call   41c <sbrk>
+  2e:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < sizeof(sizes)/sizeof(sizes[0]); i++){
+  30:	83 c4 10             	add    $0x10,%esp
+  33:	bf 00 00 00 00       	mov    $0x0,%edi
+  38:	83 ff 04             	cmp    $0x4,%edi
+  3b:	77 42                	ja     7f <main+0x7f>
+    p = sbrk(sizes[i] - (sbrk(0) - base));
+  3d:	8b 1c bd 64 0c 00 00 	mov    0xc64(,%edi,4),%ebx
+  44:	83 ec 0c             	sub    $0xc,%esp
+  47:	6a 00                	push   $0x0
+  49:	e8 ce 03 00 00       	call   41c <sbrk>
+  4e:	29 f0                	sub    %esi,%eax
+  50:	29 c3                	sub    %eax,%ebx
+  52:	89 1c 24             	mov    %ebx,(%esp)
+  55:	e8 c2 03 00 00       	call   41c <sbrk>
+    if(p == (char*)-1){
+  5a:	83 c4 10             	add    $0x10,%esp
+  5d:	83 f8 ff             	cmp    $0xffffffff,%eax
+  60:	74 04                	je     66 <main+0x66>
+      printf(1, "forkbench: sbrk %d failed\n", sizes[i]);
+      break;
+    }
+    for(p = base; p < base + sizes[i]; p += 4096)
+  62:	89 f0                	mov    %esi,%eax
+  64:	eb 51                	jmp    b7 <main+0xb7>
+      printf(1, "forkbench: sbrk %d failed\n", sizes[i]);
+  66:	83 ec 04             	sub    $0x4,%esp
+  69:	ff 34 bd 64 0c 00 00 	push   0xc64(,%edi,4)
+  70:	68 36 08 00 00       	push   $0x836
+  75:	6a 01                	push   $0x1
+  77:	e8 ef 04 00 00       	call   56b <printf>
+      break;
+  7c:	83 c4 10             	add    $0x10,%esp
+
+    j = sizes[i] / 1024;
+    printf(1, "forkbench: parent +%d KB: %d ticks for %d forks\n", j, t1 - t0, N);
+  }
+
+  if(kmstat(&st) < 0){
+  7f:	83 ec 0c             	sub    $0xc,%esp
+  82:	68 80 0c 00 00       	push   $0xc80
+  87:	e8 d8 03 00 00       	call   464 <kmstat>
+  8c:	83 c4 10             	add    $0x10,%esp
+  8f:	85 c0                	test   %eax,%eax
+  91:	0f 88 a6 00 00 00    	js     13d <main+0x13d>
+    printf(1, "forkbench: kmstat failed\n");
+    exit();
+  }
+  allocs = hits = 0;
+  97:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  9e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  for(i = 0; i < st.ncpu; i++){
+  a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  aa:	e9 ee 00 00 00       	jmp    19d <main+0x19d>
+      *p = 1;
+  af:	c6 00 01             	movb   $0x1,(%eax)
+    for(p = base; p < base + sizes[i]; p += 4096)
+  b2:	05 00 10 00 00       	add    $0x1000,%eax
+  b7:	89 f2                	mov    %esi,%edx
+  b9:	03 14 bd 64 0c 00 00 	add    0xc64(,%edi,4),%edx
+  c0:	39 d0                	cmp    %edx,%eax
+  c2:	72 eb                	jb     af <main+0xaf>
+    t0 = uptime();
+  c4:	e8 63 03 00 00       	call   42c <uptime>
+  c9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    for(n = 0; n < N; n++){
+  cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  d1:	83 fb 63             	cmp    $0x63,%ebx
+  d4:	7f 2e                	jg     104 <main+0x104>
+      pid = fork();
+  d6:	e8 b1 02 00 00       	call   38c <fork>
+      if(pid < 0){
+  db:	85 c0                	test   %eax,%eax
+  dd:	78 0c                	js     eb <main+0xeb>
+      if(pid == 0)
+  df:	74 1e                	je     ff <main+0xff>
+      wait();
+  e1:	e8 b6 02 00 00       	call   39c <wait>
+    for(n = 0; n < N; n++){
+  e6:	83 c3 01             	add    $0x1,%ebx
+  e9:	eb e6                	jmp    d1 <main+0xd1>
+        printf(1, "forkbench: fork failed\n");
+  eb:	83 ec 08             	sub    $0x8,%esp
+  ee:	68 51 08 00 00       	push   $0x851
+  f3:	6a 01                	push   $0x1
+  f5:	e8 71 04 00 00       	call   56b <printf>
+        exit();
+  fa:	e8 95 02 00 00       	call   394 <exit>
+        exit();
+  ff:	e8 90 02 00 00       	call   394 <exit>
+    t1 = uptime();
+ 104:	e8 23 03 00 00       	call   42c <uptime>
+ 109:	89 c1                	mov    %eax,%ecx
+    j = sizes[i] / 1024;
+ 10b:	8b 04 bd 64 0c 00 00 	mov    0xc64(,%edi,4),%eax
+ 112:	bb 00 04 00 00       	mov    $0x400,%ebx
+ 117:	99                   	cltd
+ 118:	f7 fb                	idiv   %ebx
+    printf(1, "forkbench: parent +%d KB: %d ticks for %d forks\n", j, t1 - t0, N);
+ 11a:	83 ec 0c             	sub    $0xc,%esp
+ 11d:	6a 64                	push   $0x64
+ 11f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+ 122:	29 d9                	sub    %ebx,%ecx
+ 124:	51                   	push   %ecx
+ 125:	50                   	push   %eax
+ 126:	68 84 08 00 00       	push   $0x884
+ 12b:	6a 01                	push   $0x1
+ 12d:	e8 39 04 00 00       	call   56b <printf>
+  for(i = 0; i < sizeof(sizes)/sizeof(sizes[0]); i++){
+ 132:	83 c7 01             	add    $0x1,%edi
+ 135:	83 c4 20             	add    $0x20,%esp
+ 138:	e9 fb fe ff ff       	jmp    38 <main+0x38>
+    printf(1, "forkbench: kmstat failed\n");
+ 13d:	83 ec 08             	sub    $0x8,%esp
+ 140:	68 69 08 00 00       	push   $0x869
+ 145:	6a 01                	push   $0x1
+ 147:	e8 1f 04 00 00       	call   56b <printf>
+    exit();
+ 14c:	e8 43 02 00 00       	call   394 <exit>
+    printf(1, "forkbench: cpu%d: %d allocs, %d hits, %d refills, %d drains\n",
+ 151:	83 ec 04             	sub    $0x4,%esp
+ 154:	ff 34 9d 30 0d 00 00 	push   0xd30(,%ebx,4)
+ 15b:	ff 34 9d 10 0d 00 00 	push   0xd10(,%ebx,4)
+ 162:	8d 73 14             	lea    0x14(%ebx),%esi
+ 165:	ff 34 b5 80 0c 00 00 	push   0xc80(,%esi,4)
+ 16c:	8d 7b 0c             	lea    0xc(%ebx),%edi
+ 16f:	ff 34 bd 80 0c 00 00 	push   0xc80(,%edi,4)
+ 176:	53                   	push   %ebx
+ 177:	68 b8 08 00 00       	push   $0x8b8
+ 17c:	6a 01                	push   $0x1
+ 17e:	e8 e8 03 00 00       	call   56b <printf>
+           i, st.allocs[i], st.hits[i], st.refills[i], st.drains[i]);
+    allocs += st.allocs[i];
+ 183:	8b 0c bd 80 0c 00 00 	mov    0xc80(,%edi,4),%ecx
+ 18a:	01 4d e4             	add    %ecx,-0x1c(%ebp)
+    hits += st.hits[i];
+ 18d:	8b 0c b5 80 0c 00 00 	mov    0xc80(,%esi,4),%ecx
+ 194:	01 4d e0             	add    %ecx,-0x20(%ebp)
+  for(i = 0; i < st.ncpu; i++){
+ 197:	83 c3 01             	add    $0x1,%ebx
+ 19a:	83 c4 20             	add    $0x20,%esp
+ 19d:	39 1d 80 0c 00 00    	cmp    %ebx,0xc80
+ 1a3:	7f ac                	jg     151 <main+0x151>
+  }
+  if(allocs > 0)
+ 1a5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 1a9:	75 29                	jne    1d4 <main+0x1d4>
+    printf(1, "forkbench: page cache hit rate %d%%\n", hits * 100 / allocs);
+  printf(1, "forkbench: zeroed pool: %d pages, %d hits, %d misses\n",
+ 1ab:	83 ec 0c             	sub    $0xc,%esp
+ 1ae:	ff 35 58 0d 00 00    	push   0xd58
+ 1b4:	ff 35 54 0d 00 00    	push   0xd54
+ 1ba:	ff 35 50 0d 00 00    	push   0xd50
+ 1c0:	68 20 09 00 00       	push   $0x920
+ 1c5:	6a 01                	push   $0x1
+ 1c7:	e8 9f 03 00 00       	call   56b <printf>
+         st.zeroed, st.zhits, st.zmisses);
+  exit();
+ 1cc:	83 c4 20             	add    $0x20,%esp
+ 1cf:	e8 c0 01 00 00       	call   394 <exit>
+    printf(1, "forkbench: page cache hit rate %d%%\n", hits * 100 / allocs);
+ 1d4:	6b 45 e0 64          	imul   $0x64,-0x20(%ebp),%eax
+ 1d8:	83 ec 04             	sub    $0x4,%esp
+ 1db:	ba 00 00 00 00       	mov    $0x0,%edx
+ 1e0:	f7 75 e4             	divl   -0x1c(%ebp)
+ 1e3:	50                   	push   %eax
+ 1e4:	68 f8 08 00 00       	push   $0x8f8
+ 1e9:	6a 01                	push   $0x1
+ 1eb:	e8 7b 03 00 00       	call   56b <printf>
+ 1f0:	83 c4 10             	add    $0x10,%esp
+ 1f3:	eb b6                	jmp    1ab <main+0x1ab>
+
+000001f5 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1f5:	55                   	push   %ebp
+ 1f6:	89 e5                	mov    %esp,%ebp
+ 1f8:	56                   	push   %esi
+ 1f9:	53                   	push   %ebx
+ 1fa:	8b 75 08             	mov    0x8(%ebp),%esi
+ 1fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 200:	89 f0                	mov    %esi,%eax
+ 202:	89 d1                	mov    %edx,%ecx
+ 204:	83 c2 01             	add    $0x1,%edx
+ 207:	89 c3                	mov    %eax,%ebx
+ 209:	83 c0 01             	add    $0x1,%eax
+ 20c:	0f b6 09             	movzbl (%ecx),%ecx
+ 20f:	88 0b                	mov    %cl,(%ebx)
+ 211:	84 c9                	test   %cl,%cl
+ 213:	75 ed                	jne    202 <strcpy+0xd>
+    ;
+  return os;
+}
+ 215:	89 f0                	mov    %esi,%eax
+ 217:	5b                   	pop    %ebx
+ 218:	5e                   	pop    %esi
+ 219:	5d                   	pop    %ebp
+ 21a:	c3                   	ret
+
+0000021b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 21b:	55                   	push   %ebp
+ 21c:	89 e5                	mov    %esp,%ebp
+ 21e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 221:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 224:	eb 06                	jmp    22c <strcmp+0x11>
+    p++, q++;
+ 226:	83 c1 01             	add    $0x1,%ecx
+ 229:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 22c:	0f b6 01             	movzbl (%ecx),%eax
+ 22f:	84 c0                	test   %al,%al
+ 231:	74 04                	je     237 <strcmp+0x1c>
+ 233:	3a 02                	cmp    (%edx),%al
+ 235:	74 ef                	je     226 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 237:	0f b6 c0             	movzbl %al,%eax
+ 23a:	0f b6 12             	movzbl (%edx),%edx
+ 23d:	29 d0                	sub    %edx,%eax
+}
+ 23f:	5d                   	pop    %ebp
+ 240:	c3                   	ret
+
+00000241 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 241:	55                   	push   %ebp
+ 242:	89 e5                	mov    %esp,%ebp
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 247:	b8 00 00 00 00       	mov    $0x0,%eax
+ 24c:	eb 03                	jmp    251 <strlen+0x10>
+ 24e:	83 c0 01             	add    $0x1,%eax
+ 251:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 255:	75 f7                	jne    24e <strlen+0xd>
+    ;
+  return n;
+}
+ 257:	5d                   	pop    %ebp
+ 258:	c3                   	ret
+
+00000259 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 259:	55                   	push   %ebp
+ 25a:	89 e5                	mov    %esp,%ebp
+ 25c:	57                   	push   %edi
+ 25d:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 260:	89 d7                	mov    %edx,%edi
+ 262:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 265:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 268:	fc                   	cld
+ 269:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 26b:	89 d0                	mov    %edx,%eax
+ 26d:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 270:	c9                   	leave
+ 271:	c3                   	ret
+
+00000272 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 272:	55                   	push   %ebp
+ 273:	89 e5                	mov    %esp,%ebp
+ 275:	8b 45 08             	mov    0x8(%ebp),%eax
+ 278:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 27c:	eb 03                	jmp    281 <strchr+0xf>
+ 27e:	83 c0 01             	add    $0x1,%eax
+ 281:	0f b6 10             	movzbl (%eax),%edx
+ 284:	84 d2                	test   %dl,%dl
+ 286:	74 06                	je     28e <strchr+0x1c>
+    if(*s == c)
+ 288:	38 ca                	cmp    %cl,%dl
+ 28a:	75 f2                	jne    27e <strchr+0xc>
+ 28c:	eb 05                	jmp    293 <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 28e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 293:	5d                   	pop    %ebp
+ 294:	c3                   	ret
+
+00000295 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 295:	55                   	push   %ebp
+ 296:	89 e5                	mov    %esp,%ebp
+ 298:	57                   	push   %edi
+ 299:	56                   	push   %esi
+ 29a:	53                   	push   %ebx
+ 29b:	83 ec 1c             	sub    $0x1c,%esp
+ 29e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 2a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 2a6:	89 de                	mov    %ebx,%esi
+ 2a8:	83 c3 01             	add    $0x1,%ebx
+ 2ab:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2ae:	7d 2e                	jge    2de <gets+0x49>
+    cc = read(0, &c, 1);
+ 2b0:	83 ec 04             	sub    $0x4,%esp
+ 2b3:	6a 01                	push   $0x1
+ 2b5:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 2b8:	50                   	push   %eax
+ 2b9:	6a 00                	push   $0x0
+ 2bb:	e8 ec 00 00 00       	call   3ac <read>
+    if(cc < 1)
+ 2c0:	83 c4 10             	add    $0x10,%esp
+ 2c3:	85 c0                	test   %eax,%eax
+ 2c5:	7e 17                	jle    2de <gets+0x49>
+      break;
+    buf[i++] = c;
+ 2c7:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2cb:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 2ce:	3c 0a                	cmp    $0xa,%al
+ 2d0:	0f 94 c2             	sete   %dl
+ 2d3:	3c 0d                	cmp    $0xd,%al
+ 2d5:	0f 94 c0             	sete   %al
+ 2d8:	08 c2                	or     %al,%dl
+ 2da:	74 ca                	je     2a6 <gets+0x11>
+    buf[i++] = c;
+ 2dc:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 2de:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 2e2:	89 f8                	mov    %edi,%eax
+ 2e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2e7:	5b                   	pop    %ebx
+ 2e8:	5e                   	pop    %esi
+ 2e9:	5f                   	pop    %edi
+ 2ea:	5d                   	pop    %ebp
+ 2eb:	c3                   	ret
+
+000002ec <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2ec:	55                   	push   %ebp
+ 2ed:	89 e5                	mov    %esp,%ebp
+ 2ef:	56                   	push   %esi
+ 2f0:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2f1:	83 ec 08             	sub    $0x8,%esp
+ 2f4:	6a 00                	push   $0x0
+ 2f6:	ff 75 08             	push   0x8(%ebp)
+ 2f9:	e8 d6 00 00 00       	call   3d4 <open>
+  if(fd < 0)
+ 2fe:	83 c4 10             	add    $0x10,%esp
+ 301:	85 c0                	test   %eax,%eax
+ 303:	78 24                	js     329 <stat+0x3d>
+ 305:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 307:	83 ec 08             	sub    $0x8,%esp
+ 30a:	ff 75 0c             	push   0xc(%ebp)
+ 30d:	50                   	push   %eax
+ 30e:	e8 d9 00 00 00       	call   3ec <fstat>
+ 313:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 315:	89 1c 24             	mov    %ebx,(%esp)
+ 318:	e8 9f 00 00 00       	call   3bc <close>
+  return r;
+ 31d:	83 c4 10             	add    $0x10,%esp
+}
+ 320:	89 f0                	mov    %esi,%eax
+ 322:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 325:	5b                   	pop    %ebx
+ 326:	5e                   	pop    %esi
+ 327:	5d                   	pop    %ebp
+ 328:	c3                   	ret
+    return -1;
+ 329:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 32e:	eb f0                	jmp    320 <stat+0x34>
+
+00000330 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	53                   	push   %ebx
+ 334:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+ 337:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+ 33c:	eb 10                	jmp    34e <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+ 33e:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+ 341:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+ 344:	83 c1 01             	add    $0x1,%ecx
+ 347:	0f be c0             	movsbl %al,%eax
+ 34a:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+ 34e:	0f b6 01             	movzbl (%ecx),%eax
+ 351:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 354:	80 fb 09             	cmp    $0x9,%bl
+ 357:	76 e5                	jbe    33e <atoi+0xe>
+  return n;
+}
+ 359:	89 d0                	mov    %edx,%eax
+ 35b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 35e:	c9                   	leave
+ 35f:	c3                   	ret
+
+00000360 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	56                   	push   %esi
+ 364:	53                   	push   %ebx
+ 365:	8b 75 08             	mov    0x8(%ebp),%esi
+ 368:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 36b:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 36e:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 370:	eb 0d                	jmp    37f <memmove+0x1f>
+    *dst++ = *src++;
+ 372:	0f b6 01             	movzbl (%ecx),%eax
+ 375:	88 02                	mov    %al,(%edx)
+ 377:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 37a:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 37d:	89 d8                	mov    %ebx,%eax
+ 37f:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 382:	85 c0                	test   %eax,%eax
+ 384:	7f ec                	jg     372 <memmove+0x12>
+  return vdst;
+}
+ 386:	89 f0                	mov    %esi,%eax
+ 388:	5b                   	pop    %ebx
+ 389:	5e                   	pop    %esi
+ 38a:	5d                   	pop    %ebp
+ 38b:	c3                   	ret
+
+0000038c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 38c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 391:	cd 40                	int    $0x40
+ 393:	c3                   	ret
+
+00000394 <exit>:
+SYSCALL(exit)
+ 394:	b8 02 00 00 00       	mov    $0x2,%eax
+ 399:	cd 40                	int    $0x40
+ 39b:	c3                   	ret
+
+0000039c <wait>:
+SYSCALL(wait)
+ 39c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3a1:	cd 40                	int    $0x40
+ 3a3:	c3                   	ret
+
+000003a4 <pipe>:
+SYSCALL(pipe)
+ 3a4:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3a9:	cd 40                	int    $0x40
+ 3ab:	c3                   	ret
+
+000003ac <read>:
+SYSCALL(read)
+ 3ac:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3b1:	cd 40                	int    $0x40
+ 3b3:	c3                   	ret
+
+000003b4 <write>:
+SYSCALL(write)
+ 3b4:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3b9:	cd 40                	int    $0x40
+ 3bb:	c3                   	ret
+
+000003bc <close>:
+SYSCALL(close)
+ 3bc:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3c1:	cd 40                	int    $0x40
+ 3c3:	c3                   	ret
+
+000003c4 <kill>:
+SYSCALL(kill)
+ 3c4:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3c9:	cd 40                	int    $0x40
+ 3cb:	c3                   	ret
+
+000003cc <exec>:
+SYSCALL(exec)
+ 3cc:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3d1:	cd 40                	int    $0x40
+ 3d3:	c3                   	ret
+
+000003d4 <open>:
+SYSCALL(open)
+ 3d4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3d9:	cd 40                	int    $0x40
+ 3db:	c3                   	ret
+
+000003dc <mknod>:
+SYSCALL(mknod)
+ 3dc:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3e1:	cd 40                	int    $0x40
+ 3e3:	c3                   	ret
+
+000003e4 <unlink>:
+SYSCALL(unlink)
+ 3e4:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3e9:	cd 40                	int    $0x40
+ 3eb:	c3                   	ret
+
+000003ec <fstat>:
+SYSCALL(fstat)
+ 3ec:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3f1:	cd 40                	int    $0x40
+ 3f3:	c3                   	ret
+
+000003f4 <link>:
+SYSCALL(link)
+ 3f4:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3f9:	cd 40                	int    $0x40
+ 3fb:	c3                   	ret
+
+000003fc <mkdir>:
+SYSCALL(mkdir)
+ 3fc:	b8 14 00 00 00       	mov    $0x14,%eax
+ 401:	cd 40                	int    $0x40
+ 403:	c3                   	ret
+
+00000404 <chdir>:
+SYSCALL(chdir)
+ 404:	b8 09 00 00 00       	mov    $0x9,%eax
+ 409:	cd 40                	int    $0x40
+ 40b:	c3                   	ret
+
+0000040c <dup>:
+SYSCALL(dup)
+ 40c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 411:	cd 40                	int    $0x40
+ 413:	c3                   	ret
+
+00000414 <getpid>:
+SYSCALL(getpid)
+ 414:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 419:	cd 40                	int    $0x40
+ 41b:	c3                   	ret
+
+0000041c <sbrk>:
+SYSCALL(sbrk)
+ 41c:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 421:	cd 40                	int    $0x40
+ 423:	c3                   	ret
+
+00000424 <sleep>:
+SYSCALL(sleep)
+ 424:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 429:	cd 40                	int    $0x40
+ 42b:	c3                   	ret
+
+0000042c <uptime>:
+SYSCALL(uptime)
+ 42c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 431:	cd 40                	int    $0x40
+ 433:	c3                   	ret
+
+00000434 <setpri>:
+SYSCALL(setpri)
+ 434:	b8 16 00 00 00       	mov    $0x16,%eax
+ 439:	cd 40                	int    $0x40
+ 43b:	c3                   	ret
+
+0000043c <getpri>:
+SYSCALL(getpri)
+ 43c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 441:	cd 40                	int    $0x40
+ 443:	c3                   	ret
+
+00000444 <fork2>:
+SYSCALL(fork2)
+ 444:	b8 18 00 00 00       	mov    $0x18,%eax
+ 449:	cd 40                	int    $0x40
+ 44b:	c3                   	ret
+
+0000044c <getpinfo>:
+SYSCALL(getpinfo)
+ 44c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 451:	cd 40                	int    $0x40
+ 453:	c3                   	ret
+
+00000454 <spawn>:
+SYSCALL(spawn)
+ 454:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 459:	cd 40                	int    $0x40
+ 45b:	c3                   	ret
+
+0000045c <spawnn>:
+SYSCALL(spawnn)
+ 45c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 461:	cd 40                	int    $0x40
+ 463:	c3                   	ret
+
+00000464 <kmstat>:
+SYSCALL(kmstat)
+ 464:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 469:	cd 40                	int    $0x40
+ 46b:	c3                   	ret
+
+0000046c <slabstat>:
+SYSCALL(slabstat)
+ 46c:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 471:	cd 40                	int    $0x40
+ 473:	c3                   	ret
+
+00000474 <shmget>:
+SYSCALL(shmget)
+ 474:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 479:	cd 40                	int    $0x40
+ 47b:	c3                   	ret
+
+0000047c <shmat>:
+SYSCALL(shmat)
+ 47c:	b8 20 00 00 00       	mov    $0x20,%eax
+ 481:	cd 40                	int    $0x40
+ 483:	c3                   	ret
+
+00000484 <shmdt>:
+SYSCALL(shmdt)
+ 484:	b8 21 00 00 00       	mov    $0x21,%eax
+ 489:	cd 40                	int    $0x40
+ 48b:	c3                   	ret
+
+0000048c <mmap>:
+SYSCALL(mmap)
+ 48c:	b8 22 00 00 00       	mov    $0x22,%eax
+ 491:	cd 40                	int    $0x40
+ 493:	c3                   	ret
+
+00000494 <munmap>:
+SYSCALL(munmap)
+ 494:	b8 23 00 00 00       	mov    $0x23,%eax
+ 499:	cd 40                	int    $0x40
+ 49b:	c3                   	ret
+
+0000049c <bstat>:
+SYSCALL(bstat)
+ 49c:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4a1:	cd 40                	int    $0x40
+ 4a3:	c3                   	ret
+
+000004a4 <aread>:
+SYSCALL(aread)
+ 4a4:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4a9:	cd 40                	int    $0x40
+ 4ab:	c3                   	ret
+
+000004ac <await>:
+SYSCALL(await)
+ 4ac:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4b1:	cd 40                	int    $0x40
+ 4b3:	c3                   	ret
+
+000004b4 <bdrop>:
+SYSCALL(bdrop)
+ 4b4:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4b9:	cd 40                	int    $0x40
+ 4bb:	c3                   	ret
+
+000004bc <vfork>:
+# exec or exit, and its ret would leave the slot holding our
+# return address free for it to overwrite.  Keep the return
+# address in %ecx, which the kernel restores for both sides.
+.globl vfork
+vfork:
+  popl %ecx
+ 4bc:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+ 4bd:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  int $T_SYSCALL
+ 4c2:	cd 40                	int    $0x40
+  pushl %ecx
+ 4c4:	51                   	push   %ecx
+  ret
+ 4c5:	c3                   	ret
+
+000004c6 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 4c6:	55                   	push   %ebp
+ 4c7:	89 e5                	mov    %esp,%ebp
+ 4c9:	83 ec 1c             	sub    $0x1c,%esp
+ 4cc:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 4cf:	6a 01                	push   $0x1
+ 4d1:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 4d4:	52                   	push   %edx
+ 4d5:	50                   	push   %eax
+ 4d6:	e8 d9 fe ff ff       	call   3b4 <write>
+}
+ 4db:	83 c4 10             	add    $0x10,%esp
+ 4de:	c9                   	leave
+ 4df:	c3                   	ret
+
+000004e0 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	57                   	push   %edi
+ 4e4:	56                   	push   %esi
+ 4e5:	53                   	push   %ebx
+ 4e6:	83 ec 2c             	sub    $0x2c,%esp
+ 4e9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 4ec:	89 d0                	mov    %edx,%eax
+ 4ee:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 4f0:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 4f4:	0f 95 c1             	setne  %cl
+ 4f7:	c1 ea 1f             	shr    $0x1f,%edx
+ 4fa:	84 d1                	test   %dl,%cl
+ 4fc:	74 44                	je     542 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 4fe:	f7 d8                	neg    %eax
+ 500:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 502:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 509:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 50e:	89 c8                	mov    %ecx,%eax
+ 510:	ba 00 00 00 00       	mov    $0x0,%edx
+ 515:	f7 f6                	div    %esi
+ 517:	89 df                	mov    %ebx,%edi
+ 519:	83 c3 01             	add    $0x1,%ebx
+ 51c:	0f b6 92 b8 09 00 00 	movzbl 0x9b8(%edx),%edx
+ 523:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 527:	89 ca                	mov    %ecx,%edx
+ 529:	89 c1                	mov    %eax,%ecx
+ 52b:	39 f2                	cmp    %esi,%edx
+ 52d:	73 df                	jae    50e <printint+0x2e>
+  if(neg)
+ 52f:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 533:	74 31                	je     566 <printint+0x86>
+    buf[i++] = '-';
+ 535:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 53a:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 53d:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 540:	eb 17                	jmp    559 <printint+0x79>
+    x = xx;
+ 542:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 544:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 54b:	eb bc                	jmp    509 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 54d:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 552:	89 f0                	mov    %esi,%eax
+ 554:	e8 6d ff ff ff       	call   4c6 <putc>
+  while(--i >= 0)
+ 559:	83 eb 01             	sub    $0x1,%ebx
+ 55c:	79 ef                	jns    54d <printint+0x6d>
+}
+ 55e:	83 c4 2c             	add    $0x2c,%esp
+ 561:	5b                   	pop    %ebx
+ 562:	5e                   	pop    %esi
+ 563:	5f                   	pop    %edi
+ 564:	5d                   	pop    %ebp
+ 565:	c3                   	ret
+ 566:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 569:	eb ee                	jmp    559 <printint+0x79>
+
+0000056b <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 56b:	55                   	push   %ebp
+ 56c:	89 e5                	mov    %esp,%ebp
+ 56e:	57                   	push   %edi
+ 56f:	56                   	push   %esi
+ 570:	53                   	push   %ebx
+ 571:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 574:	8d 45 10             	lea    0x10(%ebp),%eax
+ 577:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 57a:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 57f:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 584:	eb 14                	jmp    59a <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 586:	89 fa                	mov    %edi,%edx
+ 588:	8b 45 08             	mov    0x8(%ebp),%eax
+ 58b:	e8 36 ff ff ff       	call   4c6 <putc>
+ 590:	eb 05                	jmp    597 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 592:	83 fe 25             	cmp    $0x25,%esi
+ 595:	74 25                	je     5bc <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 597:	83 c3 01             	add    $0x1,%ebx
+ 59a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 59d:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 5a1:	84 c0                	test   %al,%al
+ 5a3:	0f 84 20 01 00 00    	je     6c9 <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 5a9:	0f be f8             	movsbl %al,%edi
+ 5ac:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 5af:	85 f6                	test   %esi,%esi
+ 5b1:	75 df                	jne    592 <printf+0x27>
+      if(c == '%'){
+ 5b3:	83 f8 25             	cmp    $0x25,%eax
+ 5b6:	75 ce                	jne    586 <printf+0x1b>
+        state = '%';
+ 5b8:	89 c6                	mov    %eax,%esi
+ 5ba:	eb db                	jmp    597 <printf+0x2c>
+      if(c == 'd'){
+ 5bc:	83 f8 25             	cmp    $0x25,%eax
+ 5bf:	0f 84 cf 00 00 00    	je     694 <printf+0x129>
+ 5c5:	0f 8c dd 00 00 00    	jl     6a8 <printf+0x13d>
+ 5cb:	83 f8 78             	cmp    $0x78,%eax
+ 5ce:	0f 8f d4 00 00 00    	jg     6a8 <printf+0x13d>
+ 5d4:	83 f8 63             	cmp    $0x63,%eax
+ 5d7:	0f 8c cb 00 00 00    	jl     6a8 <printf+0x13d>
+ 5dd:	83 e8 63             	sub    $0x63,%eax
+ 5e0:	83 f8 15             	cmp    $0x15,%eax
+ 5e3:	0f 87 bf 00 00 00    	ja     6a8 <printf+0x13d>
+ 5e9:	ff 24 85 60 09 00 00 	jmp    *0x960(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 5f0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 5f3:	8b 17                	mov    (%edi),%edx
+ 5f5:	83 ec 0c             	sub    $0xc,%esp
+ 5f8:	6a 01                	push   $0x1
+ 5fa:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5ff:	8b 45 08             	mov    0x8(%ebp),%eax
+ 602:	e8 d9 fe ff ff       	call   4e0 <printint>
+        ap++;
+ 607:	83 c7 04             	add    $0x4,%edi
+ 60a:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 60d:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 610:	be 00 00 00 00       	mov    $0x0,%esi
+ 615:	eb 80                	jmp    597 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 617:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 61a:	8b 17                	mov    (%edi),%edx
+ 61c:	83 ec 0c             	sub    $0xc,%esp
+ 61f:	6a 00                	push   $0x0
+ 621:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 626:	8b 45 08             	mov    0x8(%ebp),%eax
+ 629:	e8 b2 fe ff ff       	call   4e0 <printint>
+        ap++;
+ 62e:	83 c7 04             	add    $0x4,%edi
+ 631:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 634:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 637:	be 00 00 00 00       	mov    $0x0,%esi
+ 63c:	e9 56 ff ff ff       	jmp    597 <printf+0x2c>
+        s = (char*)*ap;
+ 641:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 644:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 646:	83 c0 04             	add    $0x4,%eax
+ 649:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 64c:	85 f6                	test   %esi,%esi
+ 64e:	75 15                	jne    665 <printf+0xfa>
+          s = "(null)";
+ 650:	be 56 09 00 00       	mov    $0x956,%esi
+ 655:	eb 0e                	jmp    665 <printf+0xfa>
+          putc(fd, *s);
+ 657:	0f be d2             	movsbl %dl,%edx
+ 65a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 65d:	e8 64 fe ff ff       	call   4c6 <putc>
+          s++;
+ 662:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 665:	0f b6 16             	movzbl (%esi),%edx
+ 668:	84 d2                	test   %dl,%dl
+ 66a:	75 eb                	jne    657 <printf+0xec>
+      state = 0;
+ 66c:	be 00 00 00 00       	mov    $0x0,%esi
+ 671:	e9 21 ff ff ff       	jmp    597 <printf+0x2c>
+        putc(fd, *ap);
+ 676:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 679:	0f be 17             	movsbl (%edi),%edx
+ 67c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 67f:	e8 42 fe ff ff       	call   4c6 <putc>
+        ap++;
+ 684:	83 c7 04             	add    $0x4,%edi
+ 687:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 68a:	be 00 00 00 00       	mov    $0x0,%esi
+ 68f:	e9 03 ff ff ff       	jmp    597 <printf+0x2c>
+        putc(fd, c);
+ 694:	89 fa                	mov    %edi,%edx
+ 696:	8b 45 08             	mov    0x8(%ebp),%eax
+ 699:	e8 28 fe ff ff       	call   4c6 <putc>
+      state = 0;
+ 69e:	be 00 00 00 00       	mov    $0x0,%esi
+ 6a3:	e9 ef fe ff ff       	jmp    597 <printf+0x2c>
+        putc(fd, '%');
+ 6a8:	ba 25 00 00 00       	mov    $0x25,%edx
+ 6ad:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6b0:	e8 11 fe ff ff       	call   4c6 <putc>
+        putc(fd, c);
+ 6b5:	89 fa                	mov    %edi,%edx
+ 6b7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6ba:	e8 07 fe ff ff       	call   4c6 <putc>
+      state = 0;
+ 6bf:	be 00 00 00 00       	mov    $0x0,%esi
+ 6c4:	e9 ce fe ff ff       	jmp    597 <printf+0x2c>
+    }
+  }
+}
+ 6c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6cc:	5b                   	pop    %ebx
+ 6cd:	5e                   	pop    %esi
+ 6ce:	5f                   	pop    %edi
+ 6cf:	5d                   	pop    %ebp
+ 6d0:	c3                   	ret
+
+000006d1 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6d1:	55                   	push   %ebp
+ 6d2:	89 e5                	mov    %esp,%ebp
+ 6d4:	57                   	push   %edi
+ 6d5:	56                   	push   %esi
+ 6d6:	53                   	push   %ebx
+ 6d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 6da:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6dd:	a1 88 0d 00 00       	mov    0xd88,%eax
+ 6e2:	eb 02                	jmp    6e6 <free+0x15>
+ 6e4:	89 d0                	mov    %edx,%eax
+ 6e6:	39 c8                	cmp    %ecx,%eax
+ 6e8:	73 04                	jae    6ee <free+0x1d>
+ 6ea:	3b 08                	cmp    (%eax),%ecx
+ 6ec:	72 12                	jb     700 <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6ee:	8b 10                	mov    (%eax),%edx
+ 6f0:	39 d0                	cmp    %edx,%eax
+ 6f2:	72 f0                	jb     6e4 <free+0x13>
+ 6f4:	39 c8                	cmp    %ecx,%eax
+ 6f6:	72 08                	jb     700 <free+0x2f>
+ 6f8:	39 d1                	cmp    %edx,%ecx
+ 6fa:	72 04                	jb     700 <free+0x2f>
+ 6fc:	89 d0                	mov    %edx,%eax
+ 6fe:	eb e6                	jmp    6e6 <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 700:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 703:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 706:	8b 10                	mov    (%eax),%edx
+ 708:	39 d7                	cmp    %edx,%edi
+ 70a:	74 19                	je     725 <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 70c:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 70f:	8b 50 04             	mov    0x4(%eax),%edx
+ 712:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 715:	39 ce                	cmp    %ecx,%esi
+ 717:	74 1b                	je     734 <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 719:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 71b:	a3 88 0d 00 00       	mov    %eax,0xd88
+}
+ 720:	5b                   	pop    %ebx
+ 721:	5e                   	pop    %esi
+ 722:	5f                   	pop    %edi
+ 723:	5d                   	pop    %ebp
+ 724:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 725:	03 72 04             	add    0x4(%edx),%esi
+ 728:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 72b:	8b 10                	mov    (%eax),%edx
+ 72d:	8b 12                	mov    (%edx),%edx
+ 72f:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 732:	eb db                	jmp    70f <free+0x3e>
+    p->s.size += bp->s.size;
+ 734:	03 53 fc             	add    -0x4(%ebx),%edx
+ 737:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 73a:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 73d:	89 10                	mov    %edx,(%eax)
+ 73f:	eb da                	jmp    71b <free+0x4a>
+
+00000741 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 741:	55                   	push   %ebp
+ 742:	89 e5                	mov    %esp,%ebp
+ 744:	53                   	push   %ebx
+ 745:	83 ec 04             	sub    $0x4,%esp
+ 748:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 74a:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 74f:	77 05                	ja     756 <morecore+0x15>
+    nu = 4096;
+ 751:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 756:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 75d:	83 ec 0c             	sub    $0xc,%esp
+ 760:	50                   	push   %eax
+ 761:	e8 b6 fc ff ff       	call   41c <sbrk>
+  if(p == (char*)-1)
+ 766:	83 c4 10             	add    $0x10,%esp
+ 769:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 76c:	74 1c                	je     78a <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 76e:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 771:	83 c0 08             	add    $0x8,%eax
+ 774:	83 ec 0c             	sub    $0xc,%esp
+ 777:	50                   	push   %eax
+ 778:	e8 54 ff ff ff       	call   6d1 <free>
+  return freep;
+ 77d:	a1 88 0d 00 00       	mov    0xd88,%eax
+ 782:	83 c4 10             	add    $0x10,%esp
+}
+ 785:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 788:	c9                   	leave
+ 789:	c3                   	ret
+    return 0;
+ 78a:	b8 00 00 00 00       	mov    $0x0,%eax
+ 78f:	eb f4                	jmp    785 <morecore+0x44>
+
+00000791 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 791:	55                   	push   %ebp
+ 792:	89 e5                	mov    %esp,%ebp
+ 794:	53                   	push   %ebx
+ 795:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 798:	8b 45 08             	mov    0x8(%ebp),%eax
+ 79b:	8d 58 07             	lea    0x7(%eax),%ebx
+ 79e:	c1 eb 03             	shr    $0x3,%ebx
+ 7a1:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 7a4:	8b 0d 88 0d 00 00    	mov    0xd88,%ecx
+ 7aa:	85 c9                	test   %ecx,%ecx
+ 7ac:	74 04                	je     7b2 <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7ae:	8b 01                	mov    (%ecx),%eax
+ 7b0:	eb 4a                	jmp    7fc <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 7b2:	c7 05 88 0d 00 00 8c 	movl   $0xd8c,0xd88
+ 7b9:	0d 00 00 
+ 7bc:	c7 05 8c 0d 00 00 8c 	movl   $0xd8c,0xd8c
+ 7c3:	0d 00 00 
+    base.s.size = 0;
+ 7c6:	c7 05 90 0d 00 00 00 	movl   $0x0,0xd90
+ 7cd:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 7d0:	b9 8c 0d 00 00       	mov    $0xd8c,%ecx
+ 7d5:	eb d7                	jmp    7ae <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 7d7:	74 19                	je     7f2 <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 7d9:	29 da                	sub    %ebx,%edx
+ 7db:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 7de:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 7e1:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 7e4:	89 0d 88 0d 00 00    	mov    %ecx,0xd88
+      return (void*)(p + 1);
+ 7ea:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 7ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 7f0:	c9                   	leave
+ 7f1:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 7f2:	8b 10                	mov    (%eax),%edx
+ 7f4:	89 11                	mov    %edx,(%ecx)
+ 7f6:	eb ec                	jmp    7e4 <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7f8:	89 c1                	mov    %eax,%ecx
+ 7fa:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 7fc:	8b 50 04             	mov    0x4(%eax),%edx
+ 7ff:	39 da                	cmp    %ebx,%edx
+ 801:	73 d4                	jae    7d7 <malloc+0x46>
+    if(p == freep)
+ 803:	39 05 88 0d 00 00    	cmp    %eax,0xd88
+ 809:	75 ed                	jne    7f8 <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 80b:	89 d8                	mov    %ebx,%eax
+ 80d:	e8 2f ff ff ff       	call   741 <morecore>
+ 812:	85 c0                	test   %eax,%eax
+ 814:	75 e2                	jne    7f8 <malloc+0x67>
+ 816:	eb d5                	jmp    7ed <malloc+0x5c>
@@ -0,0 +1,71 @@
+// Measure fork() latency as a function of the parent's size.
+// Each round grows the parent with sbrk, touches every page so
+// that it is really backed, and then times N fork/exit/wait
+// cycles.  With copy-on-write fork the cost should stay nearly
+// flat as the parent grows.  At the end it reports how often
+// kalloc() was served from the per-CPU page caches and how
+// often kalloc_zeroed() found a pre-zeroed page.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "kmstat.h"
+
+#define N 100
+
+int sizes[] = { 0, 256*1024, 1024*1024, 4*1024*1024, 16*1024*1024 };
+
+struct kmstat st;
+
+int
+main(int argc, char *argv[])
+{
+  int i, j, n, pid, t0, t1;
+  uint allocs, hits;
+  char *base, *p;
+
+  printf(1, "forkbench: %d forks per size\n", N);
+  base = sbrk(0);
+  for(i = 0; i < sizeof(sizes)/sizeof(sizes[0]); i++){
+    p = sbrk(sizes[i] - (sbrk(0) - base));
+    if(p == (char*)-1){
+      printf(1, "forkbench: sbrk %d failed\n", sizes[i]);
+      break;
+    }
+    for(p = base; p < base + sizes[i]; p += 4096)
+      *p = 1;
+
+    t0 = uptime();
+    for(n = 0; n < N; n++){
+      pid = fork();
+      if(pid < 0){
+        printf(1, "forkbench: fork failed\n");
+        exit();
+      }
+      if(pid == 0)
+        exit();
+      wait();
+    }
+    t1 = uptime();
+
+    j = sizes[i] / 1024;
+    printf(1, "forkbench: parent +%d KB: %d ticks for %d forks\n", j, t1 - t0, N);
+  }
+
+  if(kmstat(&st) < 0){
+    printf(1, "forkbench: kmstat failed\n");
+    exit();
+  }
+  allocs = hits = 0;
+  for(i = 0; i < st.ncpu; i++){
+    printf(1, "forkbench: cpu%d: %d allocs, %d hits, %d refills, %d drains\n",
+           i, st.allocs[i], st.hits[i], st.refills[i], st.drains[i]);
+    allocs += st.allocs[i];
+    hits += st.hits[i];
+  }
+  if(allocs > 0)
+    printf(1, "forkbench: page cache hit rate %d%%\n", hits * 100 / allocs);
+  printf(1, "forkbench: zeroed pool: %d pages, %d hits, %d misses\n",
+         st.zeroed, st.zhits, st.zmisses);
+  exit();
+}
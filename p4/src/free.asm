@@ -0,0 +1,1142 @@
+
+_free:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+struct kmstat st;
+struct bstat bst;
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 10             	sub    $0x10,%esp
+  if(kmstat(&st) < 0){
+  11:	68 e0 0a 00 00       	push   $0xae0
+  16:	e8 3e 03 00 00       	call   359 <kmstat>
+  1b:	83 c4 10             	add    $0x10,%esp
+  1e:	85 c0                	test   %eax,%eax
+  20:	0f 88 9c 00 00 00    	js     c2 <main+0xc2>
+    printf(2, "free: kmstat failed\n");
+    exit();
+  }
+  printf(1, "physical memory: %d KB\n", st.phystop / 1024);
+  26:	83 ec 04             	sub    $0x4,%esp
+  29:	a1 e4 0a 00 00       	mov    0xae4,%eax
+  2e:	c1 e8 0a             	shr    $0xa,%eax
+  31:	50                   	push   %eax
+  32:	68 25 07 00 00       	push   $0x725
+  37:	6a 01                	push   $0x1
+  39:	e8 22 04 00 00       	call   460 <printf>
+  printf(1, "total: %d KB\n", st.npage * 4);
+  3e:	83 c4 0c             	add    $0xc,%esp
+  41:	a1 e8 0a 00 00       	mov    0xae8,%eax
+  46:	c1 e0 02             	shl    $0x2,%eax
+  49:	50                   	push   %eax
+  4a:	68 3d 07 00 00       	push   $0x73d
+  4f:	6a 01                	push   $0x1
+  51:	e8 0a 04 00 00       	call   460 <printf>
+  printf(1, "free:  %d KB\n", st.nfree * 4);
+  56:	83 c4 0c             	add    $0xc,%esp
+  59:	a1 ec 0a 00 00       	mov    0xaec,%eax
+  5e:	c1 e0 02             	shl    $0x2,%eax
+  61:	50                   	push   %eax
+  62:	68 4b 07 00 00       	push   $0x74b
+  67:	6a 01                	push   $0x1
+  69:	e8 f2 03 00 00       	call   460 <printf>
+  if(bstat(&bst) < 0){
+  6e:	c7 04 24 c0 0a 00 00 	movl   $0xac0,(%esp)
+  75:	e8 17 03 00 00       	call   391 <bstat>
+  7a:	83 c4 10             	add    $0x10,%esp
+  7d:	85 c0                	test   %eax,%eax
+  7f:	78 55                	js     d6 <main+0xd6>
+    printf(2, "free: bstat failed\n");
+    exit();
+  }
+  printf(1, "buffers: %d of %d (%d once, %d hot), %d hits, %d misses, %d evictions\n",
+  81:	83 ec 0c             	sub    $0xc,%esp
+  84:	ff 35 d8 0a 00 00    	push   0xad8
+  8a:	ff 35 d4 0a 00 00    	push   0xad4
+  90:	ff 35 d0 0a 00 00    	push   0xad0
+  96:	ff 35 cc 0a 00 00    	push   0xacc
+  9c:	ff 35 c8 0a 00 00    	push   0xac8
+  a2:	ff 35 c4 0a 00 00    	push   0xac4
+  a8:	ff 35 c0 0a 00 00    	push   0xac0
+  ae:	68 70 07 00 00       	push   $0x770
+  b3:	6a 01                	push   $0x1
+  b5:	e8 a6 03 00 00       	call   460 <printf>
+         bst.nbuf, bst.maxbuf, bst.nin, bst.nam, bst.hits, bst.misses, bst.evictions);
+  exit();
+  ba:	83 c4 30             	add    $0x30,%esp
+  bd:	e8 c7 01 00 00       	call   289 <exit>
+    printf(2, "free: kmstat failed\n");
+  c2:	83 ec 08             	sub    $0x8,%esp
+  c5:	68 10 07 00 00       	push   $0x710
+  ca:	6a 02                	push   $0x2
+  cc:	e8 8f 03 00 00       	call   460 <printf>
+    exit();
+  d1:	e8 b3 01 00 00       	call   289 <exit>
+    printf(2, "free: bstat failed\n");
+  d6:	83 ec 08             	sub    $0x8,%esp
+  d9:	68 59 07 00 00       	push   $0x759
+  de:	6a 02                	push   $0x2
+  e0:	e8 7b 03 00 00       	call   460 <printf>
+    exit();
+  e5:	e8 9f 01 00 00       	call   289 <exit>
+
+000000ea <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  ea:	55                   	push   %ebp
+  eb:	89 e5                	mov    %esp,%ebp
+  ed:	56                   	push   %esi
+  ee:	53                   	push   %ebx
+  ef:	8b 75 08             	mov    0x8(%ebp),%esi
+  f2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  f5:	89 f0                	mov    %esi,%eax
+  f7:	89 d1                	mov    %edx,%ecx
+  f9:	83 c2 01             	add    $0x1,%edx
+  fc:	89 c3                	mov    %eax,%ebx
+  fe:	83 c0 01             	add    $0x1,%eax
+ 101:	0f b6 09             	movzbl (%ecx),%ecx
+ 104:	88 0b                	mov    %cl,(%ebx)
+ 106:	84 c9                	test   %cl,%cl
+ 108:	75 ed                	jne    f7 <strcpy+0xd>
+    ;
+  return os;
+}
+ 10a:	89 f0                	mov    %esi,%eax
+ 10c:	5b                   	pop    %ebx
+ 10d:	5e                   	pop    %esi
+ 10e:	5d                   	pop    %ebp
+ 10f:	c3                   	ret
+
+00000110 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 116:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 119:	eb 06                	jmp    121 <strcmp+0x11>
+    p++, q++;
+ 11b:	83 c1 01             	add    $0x1,%ecx
+ 11e:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 121:	0f b6 01             	movzbl (%ecx),%eax
+ 124:	84 c0                	test   %al,%al
+ 126:	74 04                	je     12c <strcmp+0x1c>
+ 128:	3a 02                	cmp    (%edx),%al
+ 12a:	74 ef                	je     11b <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 12c:	0f b6 c0             	movzbl %al,%eax
+ 12f:	0f b6 12             	movzbl (%edx),%edx
+ 132:	29 d0                	sub    %edx,%eax
+}
+ 134:	5d                   	pop    %ebp
+ 135:	c3                   	ret
+
+00000136 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 136:	55                   	push   %ebp
+ 137:	89 e5                	mov    %esp,%ebp
+ 139:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 13c:	b8 00 00 00 00       	mov    $0x0,%eax
+ 141:	eb 03                	jmp    146 <strlen+0x10>
+ 143:	83 c0 01             	add    $0x1,%eax
+ 146:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 14a:	75 f7                	jne    143 <strlen+0xd>
+    ;
+  return n;
+}
+ 14c:	5d                   	pop    %ebp
+ 14d:	c3                   	ret
+
+0000014e <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 14e:	55                   	push   %ebp
+ 14f:	89 e5                	mov    %esp,%ebp
+ 151:	57                   	push   %edi
+ 152:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 155:	89 d7                	mov    %edx,%edi
+ 157:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 15a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 15d:	fc                   	cld
+ 15e:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 160:	89 d0                	mov    %edx,%eax
+ 162:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 165:	c9                   	leave
+ 166:	c3                   	ret
+
+00000167 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 167:	55                   	push   %ebp
+ 168:	89 e5                	mov    %esp,%ebp
+ 16a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 171:	eb 03                	jmp    176 <strchr+0xf>
+ 173:	83 c0 01             	add    $0x1,%eax
+ 176:	0f b6 10             	movzbl (%eax),%edx
+ 179:	84 d2                	test   %dl,%dl
+ 17b:	74 06                	je     183 <strchr+0x1c>
+    if(*s == c)
+ 17d:	38 ca                	cmp    %cl,%dl
+ 17f:	75 f2                	jne    173 <strchr+0xc>
+ 181:	eb 05                	jmp    188 <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 183:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 188:	5d                   	pop    %ebp
+ 189:	c3                   	ret
+
+0000018a <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 18a:	55                   	push   %ebp
+ 18b:	89 e5                	mov    %esp,%ebp
+ 18d:	57                   	push   %edi
+ 18e:	56                   	push   %esi
+ 18f:	53                   	push   %ebx
+ 190:	83 ec 1c             	sub    $0x1c,%esp
+ 193:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 196:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 19b:	89 de                	mov    %ebx,%esi
+ 19d:	83 c3 01             	add    $0x1,%ebx
+ 1a0:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1a3:	7d 2e                	jge    1d3 <gets+0x49>
+    cc = read(0, &c, 1);
+ 1a5:	83 ec 04             	sub    $0x4,%esp
+ 1a8:	6a 01                	push   $0x1
+ 1aa:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 1ad:	50                   	push   %eax
+ 1ae:	6a 00                	push   $0x0
+ 1b0:	e8 ec 00 00 00       	call   2a1 <read>
+    if(cc < 1)
+ 1b5:	83 c4 10             	add    $0x10,%esp
+ 1b8:	85 c0                	test   %eax,%eax
+ 1ba:	7e 17                	jle    1d3 <gets+0x49>
+      break;
+    buf[i++] = c;
+ 1bc:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1c0:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 1c3:	3c 0a                	cmp    $0xa,%al
+ 1c5:	0f 94 c2             	sete   %dl
+ 1c8:	3c 0d                	cmp    $0xd,%al
+ 1ca:	0f 94 c0             	sete   %al
+ 1cd:	08 c2                	or     %al,%dl
+ 1cf:	74 ca                	je     19b <gets+0x11>
+    buf[i++] = c;
+ 1d1:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 1d3:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 1d7:	89 f8                	mov    %edi,%eax
+ 1d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1dc:	5b                   	pop    %ebx
+ 1dd:	5e                   	pop    %esi
+ 1de:	5f                   	pop    %edi
+ 1df:	5d                   	pop    %ebp
+ 1e0:	c3                   	ret
+
+000001e1 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1e1:	55                   	push   %ebp
+ 1e2:	89 e5                	mov    %esp,%ebp
+ 1e4:	56                   	push   %esi
+ 1e5:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1e6:	83 ec 08             	sub    $0x8,%esp
+ 1e9:	6a 00                	push   $0x0
+ 1eb:	ff 75 08             	push   0x8(%ebp)
+ 1ee:	e8 d6 00 00 00       	call   2c9 <open>
+  if(fd < 0)
+ 1f3:	83 c4 10             	add    $0x10,%esp
+ 1f6:	85 c0                	test   %eax,%eax
+ 1f8:	78 24                	js     21e <stat+0x3d>
+ 1fa:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 1fc:	83 ec 08             	sub    $0x8,%esp
+ 1ff:	ff 75 0c             	push   0xc(%ebp)
+ 202:	50                   	push   %eax
+ 203:	e8 d9 00 00 00       	call   2e1 <fstat>
+ 208:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 20a:	89 1c 24             	mov    %ebx,(%esp)
+ 20d:	e8 9f 00 00 00       	call   2b1 <close>
+  return r;
+ 212:	83 c4 10             	add    $0x10,%esp
+}
+ 215:	89 f0                	mov    %esi,%eax
+ 217:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 21a:	5b                   	pop    %ebx
+ 21b:	5e                   	pop    %esi
+ 21c:	5d                   	pop    %ebp
+ 21d:	c3                   	ret
+    return -1;
+ 21e:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 223:	eb f0                	jmp    215 <stat+0x34>
+
+00000225 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 225:	55                   	push   %ebp
+ 226:	89 e5                	mov    %esp,%ebp
+ 228:	53                   	push   %ebx
+ 229:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+ 22c:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+ 231:	eb 10                	jmp    243 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+ 233:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+ 236:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+ 239:	83 c1 01             	add    $0x1,%ecx
+ 23c:	0f be c0             	movsbl %al,%eax
+ 23f:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+ 243:	0f b6 01             	movzbl (%ecx),%eax
+ 246:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 249:	80 fb 09             	cmp    $0x9,%bl
+ 24c:	76 e5                	jbe    233 <atoi+0xe>
+  return n;
+}
+ 24e:	89 d0                	mov    %edx,%eax
+ 250:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 253:	c9                   	leave
+ 254:	c3                   	ret
+
+00000255 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 255:	55                   	push   %ebp
+ 256:	89 e5                	mov    %esp,%ebp
+ 258:	56                   	push   %esi
+ 259:	53                   	push   %ebx
+ 25a:	8b 75 08             	mov    0x8(%ebp),%esi
+ 25d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 260:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 263:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 265:	eb 0d                	jmp    274 <memmove+0x1f>
+    *dst++ = *src++;
+ 267:	0f b6 01             	movzbl (%ecx),%eax
+ 26a:	88 02                	mov    %al,(%edx)
+ 26c:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 26f:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 272:	89 d8                	mov    %ebx,%eax
+ 274:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 277:	85 c0                	test   %eax,%eax
+ 279:	7f ec                	jg     267 <memmove+0x12>
+  return vdst;
+}
+ 27b:	89 f0                	mov    %esi,%eax
+ 27d:	5b                   	pop    %ebx
+ 27e:	5e                   	pop    %esi
+ 27f:	5d                   	pop    %ebp
+ 280:	c3                   	ret
+
+00000281 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 281:	b8 01 00 00 00       	mov    $0x1,%eax
+ 286:	cd 40                	int    $0x40
+ 288:	c3                   	ret
+
+00000289 <exit>:
+SYSCALL(exit)
+ 289:	b8 02 00 00 00       	mov    $0x2,%eax
+ 28e:	cd 40                	int    $0x40
+ 290:	c3                   	ret
+
+00000291 <wait>:
+SYSCALL(wait)
+ 291:	b8 03 00 00 00       	mov    $0x3,%eax
+ 296:	cd 40                	int    $0x40
+ 298:	c3                   	ret
+
+00000299 <pipe>:
+SYSCALL(pipe)
+ 299:	b8 04 00 00 00       	mov    $0x4,%eax
+ 29e:	cd 40                	int    $0x40
+ 2a0:	c3                   	ret
+
+000002a1 <read>:
+SYSCALL(read)
+ 2a1:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2a6:	cd 40                	int    $0x40
+ 2a8:	c3                   	ret
+
+000002a9 <write>:
+SYSCALL(write)
+ 2a9:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2ae:	cd 40                	int    $0x40
+ 2b0:	c3                   	ret
+
+000002b1 <close>:
+SYSCALL(close)
+ 2b1:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2b6:	cd 40                	int    $0x40
+ 2b8:	c3                   	ret
+
+000002b9 <kill>:
+SYSCALL(kill)
+ 2b9:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2be:	cd 40                	int    $0x40
+ 2c0:	c3                   	ret
+
+000002c1 <exec>:
+SYSCALL(exec)
+ 2c1:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2c6:	cd 40                	int    $0x40
+ 2c8:	c3                   	ret
+
+000002c9 <open>:
+SYSCALL(open)
+ 2c9:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2ce:	cd 40                	int    $0x40
+ 2d0:	c3                   	ret
+
+000002d1 <mknod>:
+SYSCALL(mknod)
+ 2d1:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2d6:	cd 40                	int    $0x40
+ 2d8:	c3                   	ret
+
+000002d9 <unlink>:
+SYSCALL(unlink)
+ 2d9:	b8 12 00 00 00       	mov    $0x12,%eax
+ 2de:	cd 40                	int    $0x40
+ 2e0:	c3                   	ret
+
+000002e1 <fstat>:
+SYSCALL(fstat)
+ 2e1:	b8 08 00 00 00       	mov    $0x8,%eax
+ 2e6:	cd 40                	int    $0x40
+ 2e8:	c3                   	ret
+
+000002e9 <link>:
+SYSCALL(link)
+ 2e9:	b8 13 00 00 00       	mov    $0x13,%eax
+ 2ee:	cd 40                	int    $0x40
+ 2f0:	c3                   	ret
+
+000002f1 <mkdir>:
+SYSCALL(mkdir)
+ 2f1:	b8 14 00 00 00       	mov    $0x14,%eax
+ 2f6:	cd 40                	int    $0x40
+ 2f8:	c3                   	ret
+
+000002f9 <chdir>:
+SYSCALL(chdir)
+ 2f9:	b8 09 00 00 00       	mov    $0x9,%eax
+ 2fe:	cd 40                	int    $0x40
+ 300:	c3                   	ret
+
+00000301 <dup>:
+SYSCALL(dup)
+ 301:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 306:	cd 40                	int    $0x40
+ 308:	c3                   	ret
+
+00000309 <getpid>:
+SYSCALL(getpid)
+ 309:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 30e:	cd 40                	int    $0x40
+ 310:	c3                   	ret
+
+00000311 <sbrk>:
+SYSCALL(sbrk)
+ 311:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 316:	cd 40                	int    $0x40
+ 318:	c3                   	ret
+
+00000319 <sleep>:
+SYSCALL(sleep)
+ 319:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 31e:	cd 40                	int    $0x40
+ 320:	c3                   	ret
+
+00000321 <uptime>:
+SYSCALL(uptime)
+ 321:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 326:	cd 40                	int    $0x40
+ 328:	c3                   	ret
+
+00000329 <setpri>:
+SYSCALL(setpri)
+ 329:	b8 16 00 00 00       	mov    $0x16,%eax
+ 32e:	cd 40                	int    $0x40
+ 330:	c3                   	ret
+
+00000331 <getpri>:
+SYSCALL(getpri)
+ 331:	b8 17 00 00 00       	mov    $0x17,%eax
+ 336:	cd 40                	int    $0x40
+ 338:	c3                   	ret
+
+00000339 <fork2>:
+SYSCALL(fork2)
+ 339:	b8 18 00 00 00       	mov    $0x18,%eax
+ 33e:	cd 40                	int    $0x40
+ 340:	c3                   	ret
+
+00000341 <getpinfo>:
+SYSCALL(getpinfo)
+ 341:	b8 19 00 00 00       	mov    $0x19,%eax
+ 346:	cd 40                	int    $0x40
+ 348:	c3                   	ret
+
+00000349 <spawn>:
+SYSCALL(spawn)
+ 349:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 34e:	cd 40                	int    $0x40
+ 350:	c3                   	ret
+
+00000351 <spawnn>:
+SYSCALL(spawnn)
+ 351:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 356:	cd 40                	int    $0x40
+ 358:	c3                   	ret
+
+00000359 <kmstat>:
+SYSCALL(kmstat)
+ 359:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 35e:	cd 40                	int    $0x40
+ 360:	c3                   	ret
+
+00000361 <slabstat>:
+SYSCALL(slabstat)
+ 361:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 366:	cd 40                	int    $0x40
+ 368:	c3                   	ret
+
+00000369 <shmget>:
+SYSCALL(shmget)
+ 369:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 36e:	cd 40                	int    $0x40
+ 370:	c3                   	ret
+
+00000371 <shmat>:
+SYSCALL(shmat)
+ 371:	b8 20 00 00 00       	mov    $0x20,%eax
+ 376:	cd 40                	int    $0x40
+ 378:	c3                   	ret
+
+00000379 <shmdt>:
+SYSCALL(shmdt)
+ 379:	b8 21 00 00 00       	mov    $0x21,%eax
+ 37e:	cd 40                	int    $0x40
+ 380:	c3                   	ret
+
+00000381 <mmap>:
+SYSCALL(mmap)
+ 381:	b8 22 00 00 00       	mov    $0x22,%eax
+ 386:	cd 40                	int    $0x40
+ 388:	c3                   	ret
+
+00000389 <munmap>:
+SYSCALL(munmap)
+ 389:	b8 23 00 00 00       	mov    $0x23,%eax
+ 38e:	cd 40                	int    $0x40
+ 390:	c3                   	ret
+
+00000391 <bstat>:
+SYSCALL(bstat)
+ 391:	b8 24 00 00 00       	mov    $0x24,%eax
+ 396:	cd 40                	int    $0x40
+ 398:	c3                   	ret
+
+00000399 <aread>:
+SYSCALL(aread)
+ 399:	b8 25 00 00 00       	mov    $0x25,%eax
+ 39e:	cd 40                	int    $0x40
+ 3a0:	c3                   	ret
+
+000003a1 <await>:
+SYSCALL(await)
+ 3a1:	b8 26 00 00 00       	mov    $0x26,%eax
+ 3a6:	cd 40                	int    $0x40
+ 3a8:	c3                   	ret
+
+000003a9 <bdrop>:
+SYSCALL(bdrop)
+ 3a9:	b8 27 00 00 00       	mov    $0x27,%eax
+ 3ae:	cd 40                	int    $0x40
+ 3b0:	c3                   	ret
+
+000003b1 <vfork>:
+# exec or exit, and its ret would leave the slot holding our
+# return address free for it to overwrite.  Keep the return
+# address in %ecx, which the kernel restores for both sides.
+.globl vfork
+vfork:
+  popl %ecx
+ 3b1:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+ 3b2:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  int $T_SYSCALL
+ 3b7:	cd 40                	int    $0x40
+  pushl %ecx
+ 3b9:	51                   	push   %ecx
+  ret
+ 3ba:	c3                   	ret
+
+000003bb <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 3bb:	55                   	push   %ebp
+ 3bc:	89 e5                	mov    %esp,%ebp
+ 3be:	83 ec 1c             	sub    $0x1c,%esp
+ 3c1:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 3c4:	6a 01                	push   $0x1
+ 3c6:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 3c9:	52                   	push   %edx
+ 3ca:	50                   	push   %eax
+ 3cb:	e8 d9 fe ff ff       	call   2a9 <write>
+}
+ 3d0:	83 c4 10             	add    $0x10,%esp
+ 3d3:	c9                   	leave
+ 3d4:	c3                   	ret
+
+000003d5 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3d5:	55                   	push   %ebp
+ 3d6:	89 e5                	mov    %esp,%ebp
+ 3d8:	57                   	push   %edi
+ 3d9:	56                   	push   %esi
+ 3da:	53                   	push   %ebx
+ 3db:	83 ec 2c             	sub    $0x2c,%esp
+ 3de:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 3e1:	89 d0                	mov    %edx,%eax
+ 3e3:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 3e5:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 3e9:	0f 95 c1             	setne  %cl
+ 3ec:	c1 ea 1f             	shr    $0x1f,%edx
+ 3ef:	84 d1                	test   %dl,%cl
+ 3f1:	74 44                	je     437 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 3f3:	f7 d8                	neg    %eax
+ 3f5:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 3f7:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 3fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 403:	89 c8                	mov    %ecx,%eax
+ 405:	ba 00 00 00 00       	mov    $0x0,%edx
+ 40a:	f7 f6                	div    %esi
+ 40c:	89 df                	mov    %ebx,%edi
+ 40e:	83 c3 01             	add    $0x1,%ebx
+ 411:	0f b6 92 18 08 00 00 	movzbl 0x818(%edx),%edx
+ 418:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 41c:	89 ca                	mov    %ecx,%edx
+ 41e:	89 c1                	mov    %eax,%ecx
+ 420:	39 f2                	cmp    %esi,%edx
+ 422:	73 df                	jae    403 <printint+0x2e>
+  if(neg)
+ 424:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 428:	74 31                	je     45b <printint+0x86>
+    buf[i++] = '-';
+ 42a:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 42f:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 432:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 435:	eb 17                	jmp    44e <printint+0x79>
+    x = xx;
+ 437:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 439:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 440:	eb bc                	jmp    3fe <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 442:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 447:	89 f0                	mov    %esi,%eax
+ 449:	e8 6d ff ff ff       	call   3bb <putc>
+  while(--i >= 0)
+ 44e:	83 eb 01             	sub    $0x1,%ebx
+ 451:	79 ef                	jns    442 <printint+0x6d>
+}
+ 453:	83 c4 2c             	add    $0x2c,%esp
+ 456:	5b                   	pop    %ebx
+ 457:	5e                   	pop    %esi
+ 458:	5f                   	pop    %edi
+ 459:	5d                   	pop    %ebp
+ 45a:	c3                   	ret
+ 45b:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 45e:	eb ee                	jmp    44e <printint+0x79>
+
+00000460 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+ 465:	53                   	push   %ebx
+ 466:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 469:	8d 45 10             	lea    0x10(%ebp),%eax
+ 46c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 46f:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 474:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 479:	eb 14                	jmp    48f <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 47b:	89 fa                	mov    %edi,%edx
+ 47d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 480:	e8 36 ff ff ff       	call   3bb <putc>
+ 485:	eb 05                	jmp    48c <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 487:	83 fe 25             	cmp    $0x25,%esi
+ 48a:	74 25                	je     4b1 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 48c:	83 c3 01             	add    $0x1,%ebx
+ 48f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 492:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 496:	84 c0                	test   %al,%al
+ 498:	0f 84 20 01 00 00    	je     5be <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 49e:	0f be f8             	movsbl %al,%edi
+ 4a1:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 4a4:	85 f6                	test   %esi,%esi
+ 4a6:	75 df                	jne    487 <printf+0x27>
+      if(c == '%'){
+ 4a8:	83 f8 25             	cmp    $0x25,%eax
+ 4ab:	75 ce                	jne    47b <printf+0x1b>
+        state = '%';
+ 4ad:	89 c6                	mov    %eax,%esi
+ 4af:	eb db                	jmp    48c <printf+0x2c>
+      if(c == 'd'){
+ 4b1:	83 f8 25             	cmp    $0x25,%eax
+ 4b4:	0f 84 cf 00 00 00    	je     589 <printf+0x129>
+ 4ba:	0f 8c dd 00 00 00    	jl     59d <printf+0x13d>
+ 4c0:	83 f8 78             	cmp    $0x78,%eax
+ 4c3:	0f 8f d4 00 00 00    	jg     59d <printf+0x13d>
+ 4c9:	83 f8 63             	cmp    $0x63,%eax
+ 4cc:	0f 8c cb 00 00 00    	jl     59d <printf+0x13d>
+ 4d2:	83 e8 63             	sub    $0x63,%eax
+ 4d5:	83 f8 15             	cmp    $0x15,%eax
+ 4d8:	0f 87 bf 00 00 00    	ja     59d <printf+0x13d>
+ 4de:	ff 24 85 c0 07 00 00 	jmp    *0x7c0(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 4e5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 4e8:	8b 17                	mov    (%edi),%edx
+ 4ea:	83 ec 0c             	sub    $0xc,%esp
+ 4ed:	6a 01                	push   $0x1
+ 4ef:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 4f4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4f7:	e8 d9 fe ff ff       	call   3d5 <printint>
+        ap++;
+ 4fc:	83 c7 04             	add    $0x4,%edi
+ 4ff:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 502:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 505:	be 00 00 00 00       	mov    $0x0,%esi
+ 50a:	eb 80                	jmp    48c <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 50c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 50f:	8b 17                	mov    (%edi),%edx
+ 511:	83 ec 0c             	sub    $0xc,%esp
+ 514:	6a 00                	push   $0x0
+ 516:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 51b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 51e:	e8 b2 fe ff ff       	call   3d5 <printint>
+        ap++;
+ 523:	83 c7 04             	add    $0x4,%edi
+ 526:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 529:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 52c:	be 00 00 00 00       	mov    $0x0,%esi
+ 531:	e9 56 ff ff ff       	jmp    48c <printf+0x2c>
+        s = (char*)*ap;
+ 536:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 539:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 53b:	83 c0 04             	add    $0x4,%eax
+ 53e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 541:	85 f6                	test   %esi,%esi
+ 543:	75 15                	jne    55a <printf+0xfa>
+          s = "(null)";
+ 545:	be b7 07 00 00       	mov    $0x7b7,%esi
+ 54a:	eb 0e                	jmp    55a <printf+0xfa>
+          putc(fd, *s);
+ 54c:	0f be d2             	movsbl %dl,%edx
+ 54f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 552:	e8 64 fe ff ff       	call   3bb <putc>
+          s++;
+ 557:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 55a:	0f b6 16             	movzbl (%esi),%edx
+ 55d:	84 d2                	test   %dl,%dl
+ 55f:	75 eb                	jne    54c <printf+0xec>
+      state = 0;
+ 561:	be 00 00 00 00       	mov    $0x0,%esi
+ 566:	e9 21 ff ff ff       	jmp    48c <printf+0x2c>
+        putc(fd, *ap);
+ 56b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 56e:	0f be 17             	movsbl (%edi),%edx
+ 571:	8b 45 08             	mov    0x8(%ebp),%eax
+ 574:	e8 42 fe ff ff       	call   3bb <putc>
+        ap++;
+ 579:	83 c7 04             	add    $0x4,%edi
+ 57c:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 57f:	be 00 00 00 00       	mov    $0x0,%esi
+ 584:	e9 03 ff ff ff       	jmp    48c <printf+0x2c>
+        putc(fd, c);
+ 589:	89 fa                	mov    %edi,%edx
+ 58b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 58e:	e8 28 fe ff ff       	call   3bb <putc>
+      state = 0;
+ 593:	be 00 00 00 00       	mov    $0x0,%esi
+ 598:	e9 ef fe ff ff       	jmp    48c <printf+0x2c>
+        putc(fd, '%');
+ 59d:	ba 25 00 00 00       	mov    $0x25,%edx
+ 5a2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5a5:	e8 11 fe ff ff       	call   3bb <putc>
+        putc(fd, c);
+ 5aa:	89 fa                	mov    %edi,%edx
+ 5ac:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5af:	e8 07 fe ff ff       	call   3bb <putc>
+      state = 0;
+ 5b4:	be 00 00 00 00       	mov    $0x0,%esi
+ 5b9:	e9 ce fe ff ff       	jmp    48c <printf+0x2c>
+    }
+  }
+}
+ 5be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5c1:	5b                   	pop    %ebx
+ 5c2:	5e                   	pop    %esi
+ 5c3:	5f                   	pop    %edi
+ 5c4:	5d                   	pop    %ebp
+ 5c5:	c3                   	ret
+
+000005c6 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 5c6:	55                   	push   %ebp
+ 5c7:	89 e5                	mov    %esp,%ebp
+ 5c9:	57                   	push   %edi
+ 5ca:	56                   	push   %esi
+ 5cb:	53                   	push   %ebx
+ 5cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 5cf:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 5d2:	a1 e8 0b 00 00       	mov    0xbe8,%eax
+ 5d7:	eb 02                	jmp    5db <free+0x15>
+ 5d9:	89 d0                	mov    %edx,%eax
+ 5db:	39 c8                	cmp    %ecx,%eax
+ 5dd:	73 04                	jae    5e3 <free+0x1d>
+ 5df:	3b 08                	cmp    (%eax),%ecx
+ 5e1:	72 12                	jb     5f5 <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 5e3:	8b 10                	mov    (%eax),%edx
+ 5e5:	39 d0                	cmp    %edx,%eax
+ 5e7:	72 f0                	jb     5d9 <free+0x13>
+ 5e9:	39 c8                	cmp    %ecx,%eax
+ 5eb:	72 08                	jb     5f5 <free+0x2f>
+ 5ed:	39 d1                	cmp    %edx,%ecx
+ 5ef:	72 04                	jb     5f5 <free+0x2f>
+ 5f1:	89 d0                	mov    %edx,%eax
+ 5f3:	eb e6                	jmp    5db <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 5f5:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 5f8:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 5fb:	8b 10                	mov    (%eax),%edx
+ 5fd:	39 d7                	cmp    %edx,%edi
+ 5ff:	74 19                	je     61a <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 601:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 604:	8b 50 04             	mov    0x4(%eax),%edx
+ 607:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 60a:	39 ce                	cmp    %ecx,%esi
+ 60c:	74 1b                	je     629 <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 60e:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 610:	a3 e8 0b 00 00       	mov    %eax,0xbe8
+}
+ 615:	5b                   	pop    %ebx
+ 616:	5e                   	pop    %esi
+ 617:	5f                   	pop    %edi
+ 618:	5d                   	pop    %ebp
+ 619:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 61a:	03 72 04             	add    0x4(%edx),%esi
+ 61d:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 620:	8b 10                	mov    (%eax),%edx
+ 622:	8b 12                	mov    (%edx),%edx
+ 624:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 627:	eb db                	jmp    604 <free+0x3e>
+    p->s.size += bp->s.size;
+ 629:	03 53 fc             	add    -0x4(%ebx),%edx
+ 62c:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 62f:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 632:	89 10                	mov    %edx,(%eax)
+ 634:	eb da                	jmp    610 <free+0x4a>
+
+00000636 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 636:	55                   	push   %ebp
+ 637:	89 e5                	mov    %esp,%ebp
+ 639:	53                   	push   %ebx
+ 63a:	83 ec 04             	sub    $0x4,%esp
+ 63d:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 63f:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 644:	77 05                	ja     64b <morecore+0x15>
+    nu = 4096;
+ 646:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 64b:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 652:	83 ec 0c             	sub    $0xc,%esp
+ 655:	50                   	push   %eax
+ 656:	e8 b6 fc ff ff       	call   311 <sbrk>
+  if(p == (char*)-1)
+ 65b:	83 c4 10             	add    $0x10,%esp
+ 65e:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 661:	74 1c                	je     67f <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 663:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 666:	83 c0 08             	add    $0x8,%eax
+ 669:	83 ec 0c             	sub    $0xc,%esp
+ 66c:	50                   	push   %eax
+ 66d:	e8 54 ff ff ff       	call   5c6 <free>
+  return freep;
+ 672:	a1 e8 0b 00 00       	mov    0xbe8,%eax
+ 677:	83 c4 10             	add    $0x10,%esp
+}
+ 67a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 67d:	c9                   	leave
+ 67e:	c3                   	ret
+    return 0;
+ 67f:	b8 00 00 00 00       	mov    $0x0,%eax
+ 684:	eb f4                	jmp    67a <morecore+0x44>
+
+00000686 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 686:	55                   	push   %ebp
+ 687:	89 e5                	mov    %esp,%ebp
+ 689:	53                   	push   %ebx
+ 68a:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 68d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 690:	8d 58 07             	lea    0x7(%eax),%ebx
+ 693:	c1 eb 03             	shr    $0x3,%ebx
+ 696:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 699:	8b 0d e8 0b 00 00    	mov    0xbe8,%ecx
+ 69f:	85 c9                	test   %ecx,%ecx
+ 6a1:	74 04                	je     6a7 <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6a3:	8b 01                	mov    (%ecx),%eax
+ 6a5:	eb 4a                	jmp    6f1 <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 6a7:	c7 05 e8 0b 00 00 ec 	movl   $0xbec,0xbe8
+ 6ae:	0b 00 00 
+ 6b1:	c7 05 ec 0b 00 00 ec 	movl   $0xbec,0xbec
+ 6b8:	0b 00 00 
+    base.s.size = 0;
+ 6bb:	c7 05 f0 0b 00 00 00 	movl   $0x0,0xbf0
+ 6c2:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 6c5:	b9 ec 0b 00 00       	mov    $0xbec,%ecx
+ 6ca:	eb d7                	jmp    6a3 <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 6cc:	74 19                	je     6e7 <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 6ce:	29 da                	sub    %ebx,%edx
+ 6d0:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 6d3:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 6d6:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 6d9:	89 0d e8 0b 00 00    	mov    %ecx,0xbe8
+      return (void*)(p + 1);
+ 6df:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 6e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 6e5:	c9                   	leave
+ 6e6:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 6e7:	8b 10                	mov    (%eax),%edx
+ 6e9:	89 11                	mov    %edx,(%ecx)
+ 6eb:	eb ec                	jmp    6d9 <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6ed:	89 c1                	mov    %eax,%ecx
+ 6ef:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 6f1:	8b 50 04             	mov    0x4(%eax),%edx
+ 6f4:	39 da                	cmp    %ebx,%edx
+ 6f6:	73 d4                	jae    6cc <malloc+0x46>
+    if(p == freep)
+ 6f8:	39 05 e8 0b 00 00    	cmp    %eax,0xbe8
+ 6fe:	75 ed                	jne    6ed <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 700:	89 d8                	mov    %ebx,%eax
+ 702:	e8 2f ff ff ff       	call   636 <morecore>
+ 707:	85 c0                	test   %eax,%eax
+ 709:	75 e2                	jne    6ed <malloc+0x67>
+ 70b:	eb d5                	jmp    6e2 <malloc+0x5c>
@@ -0,0 +1,29 @@
+// Print total and free physical memory and buffer cache usage.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "kmstat.h"
+#include "bstat.h"
+
+struct kmstat st;
+struct bstat bst;
+
+int
+main(int argc, char *argv[])
+{
+  if(kmstat(&st) < 0){
+    printf(2, "free: kmstat failed\n");
+    exit();
+  }
+  printf(1, "physical memory: %d KB\n", st.phystop / 1024);
+  printf(1, "total: %d KB\n", st.npage * 4);
+  printf(1, "free:  %d KB\n", st.nfree * 4);
+  if(bstat(&bst) < 0){
+    printf(2, "free: bstat failed\n");
+    exit();
+  }
+  printf(1, "buffers: %d of %d (%d once, %d hot), %d hits, %d misses, %d evictions\n",
+         bst.nbuf, bst.maxbuf, bst.nin, bst.nam, bst.hits, bst.misses, bst.evictions);
+  exit();
+}
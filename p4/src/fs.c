@@ -266,6 +266,7 @@ iget(uint dev, uint inum)
   ip->inum = inum;
   ip->ref = 1;
   ip->valid = 0;
+  ip->ranext = ip->raend = ip->rawin = 0;
   release(&icache.lock);
 
   return ip;
@@ -282,6 +283,18 @@ idup(struct inode *ip)
   return ip;
 }
 
+// Count a program mapping ip's pages (n = 1) or one going
+// away (n = -1).  While any remain, filewrite() refuses to
+// change the file, so that running programs, which fault
+// their text in from it, never see a mix of old and new pages.
+void
+itext(struct inode *ip, int n)
+{
+  acquire(&icache.lock);
+  ip->ntext += n;
+  release(&icache.lock);
+}
+
 // Lock the given inode.
 // Reads the inode from disk if necessary.
 void
@@ -431,6 +444,7 @@ itrunc(struct inode *ip)
 
   ip->size = 0;
   iupdate(ip);
+  pcinval(ip);
 }
 
 // Copy stat information from inode.
@@ -445,6 +459,95 @@ stati(struct inode *ip, struct stat *st)
   st->size = ip->size;
 }
 
+// Hold the blocks holding n > 0 bytes of ip at off in the
+// buffer cache with bhold, starting reads of those not yet
+// cached, and store them in b.  Never waits for the disk:
+// if a block's address is in an indirect block that isn't
+// cached, hold the indirect block instead and stop there.
+// Returns the number of bufs held, or -1 (holding none) if
+// the cache won't hold them all.
+// Caller must hold ip->lock.
+int
+ihold(struct inode *ip, uint off, uint n, struct buf **b)
+{
+  struct buf *ib;
+  uint bn, addr;
+  int nb;
+
+  nb = 0;
+  for(bn = off/BSIZE; bn <= (off + n - 1)/BSIZE; bn++){
+    if(bn < NDIRECT)
+      addr = ip->addrs[bn];
+    else if((addr = ip->addrs[NDIRECT]) != 0){
+      if((ib = bpeek(ip->dev, addr)) == 0){
+        if((b[nb] = bhold(ip->dev, addr)) == 0)
+          goto full;
+        nb++;
+        break;
+      }
+      addr = ((uint*)ib->data)[bn - NDIRECT];
+      brelse(ib);
+    }
+    if(addr == 0)
+      break;
+    if((b[nb] = bhold(ip->dev, addr)) == 0)
+      goto full;
+    nb++;
+  }
+  return nb;
+
+full:
+  while(nb > 0)
+    bunhold(b[--nb]);
+  return -1;
+}
+
+// Start reading the blocks holding n bytes of ip at off
+// into the buffer cache, without waiting.  Only blocks the
+// file has are read, so bmap() won't allocate.
+// Caller must hold ip->lock.
+void
+iprefetch(struct inode *ip, uint off, uint n)
+{
+  uint bn, end;
+
+  end = min(off + n, ip->size);
+  if(off >= end)
+    return;
+  for(bn = off/BSIZE; bn <= (end - 1)/BSIZE; bn++)
+    bprefetch(ip->dev, bmap(ip, bn));
+}
+
+// Called by readi() before reading blocks first through last
+// of ip.  If the read continues where the last one left off,
+// start reading the blocks after it into the buffer cache,
+// doubling the window on each sequential read up to RAMAX;
+// any other read turns read-ahead off until reads are
+// sequential again.  Caller must hold ip->lock.
+static void
+readahead(struct inode *ip, uint first, uint last)
+{
+  uint bn, end;
+
+  if(first == ip->ranext || (ip->ranext > 0 && first == ip->ranext - 1)){
+    if(first == ip->ranext)
+      ip->rawin = ip->rawin ? min(2 * ip->rawin, RAMAX) : 2;
+  } else {
+    ip->rawin = 0;
+    ip->raend = 0;
+  }
+  ip->ranext = last + 1;
+  if(ip->rawin == 0)
+    return;
+
+  bn = ip->raend > last ? ip->raend : last + 1;
+  end = last + 1 + ip->rawin;
+  if(bn < end)
+    iprefetch(ip, bn*BSIZE, (end - bn)*BSIZE);
+  if(end > ip->raend)
+    ip->raend = end;
+}
+
 // Read data from inode.
 // Caller must hold ip->lock.
 int
@@ -466,6 +569,11 @@ readi(struct inode *ip, char *dst, uint off, uint n)
 
   for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    // Start read-ahead only once the first block the caller
+    // wants is in, so the elevator can't serve prefetches
+    // ahead of it.
+    if(tot == 0)
+      readahead(ip, off/BSIZE, (off + n - 1)/BSIZE);
     m = min(n - tot, BSIZE - off%BSIZE);
     memmove(dst, bp->data + off%BSIZE, m);
     brelse(bp);
@@ -499,6 +607,8 @@ writei(struct inode *ip, char *src, uint off, uint n)
     log_write(bp);
     brelse(bp);
   }
+  if(n > 0)
+    pcinval(ip);
 
   if(n > 0 && off > ip->size){
     ip->size = off;
@@ -1,4 +1,6 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// IDE driver code: bus-master DMA on a PCI IDE controller
+// (such as the PIIX that QEMU emulates), or simple PIO if
+// there is none.
 
 #include "types.h"
 #include "defs.h"
@@ -23,16 +25,80 @@
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_SETMUL 0xc6
+#define IDE_CMD_RDDMA 0xc8
+#define IDE_CMD_WRDMA 0xca
 
-// idequeue points to the buf now being read/written to the disk.
-// idequeue->qnext points to the next buf to be processed.
+// Bus-master registers, at the I/O address in BAR4 of the
+// controller's PCI configuration space.
+#define BM_CMD        0     // command
+#define BM_STATUS     2     // status
+#define BM_PRDT       4     // physical address of PRD table
+#define BM_START      0x01  // in BM_CMD: start transfer
+#define BM_TOMEM      0x08  // in BM_CMD: transfer from disk to memory
+#define BM_ERR        0x02  // in BM_STATUS: transfer failed
+#define BM_INTR       0x04  // in BM_STATUS: interrupt raised
+#define PRD_EOT       0x8000  // last entry in the PRD table
+
+#define IDEMULT       16   // sectors per READ/WRITE MULTIPLE
+#define IDERETRY      3    // times to retry a failed command
+
+#define IDEDEADLINE   50   // ticks a request may wait before it
+                           // is served ahead of its turn
+
+#define NIDEQ (MAXNBUF+LOGSIZE)  // every buf, cached or the log's,
+                                 // can be queued at once
+
+// idecur points to the buf now being read/written to the disk,
+// and through qnext to any bufs for the following blocks that
+// are being transferred by the same command.
+// Waiting requests are served in C-SCAN order: sweep holds
+// those at or beyond idepos, the block of the last request
+// started, and next holds those before it, to be served once
+// the head has wrapped around.  Both are binary heaps on the
+// block number, so queueing or removing a request takes
+// O(log n) time.
+// Every waiting request is also on a list in arrival order
+// from fifo, so the oldest is found in constant time; once it
+// has waited IDEDEADLINE ticks it is served next whatever its
+// block, so that a stream of requests ahead of the head can't
+// starve it.
 // You must hold idelock while manipulating queue.
 
+struct ideq {
+  int n;
+  struct buf *b[NIDEQ];
+};
+
 static struct spinlock idelock;
-static struct buf *idequeue;
+static struct buf *idecur;
+static struct ideq q[2];
+static struct ideq *sweep = &q[0], *next = &q[1];
+static struct buf *fifo, *fifotail;
+static uint idepos;
+static int idemerge = 1;   // most bufs in one command
+static int ideerrs;        // failures of idecur's command so far
+
+// Physical region descriptor: one buffer of a DMA transfer.
+// The table must not cross a 64KB boundary, nor may any
+// buffer; a buf's data lies within one page.
+struct prd {
+  uint addr;
+  ushort len;
+  ushort flags;
+};
+
+static ushort idebm;       // bus-master I/O base, or 0 for PIO
+static struct prd ideprd[IDEMULT] __attribute__((aligned(sizeof(struct prd)*IDEMULT)));
 
 static int havedisk1;
+static int virtiodisk1;    // disk 1 is a virtio device
+static int idesetmult(int);
+static void idedmainit(void);
+static struct buf *idefinish(struct buf*);
+static void idedoneasync(struct buf*);
 static void idestart(struct buf*);
+static void idenext(void);
 
 // Wait for IDE disk to become ready.
 static int
@@ -67,33 +133,114 @@ ideinit(void)
 
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0<<4));
+
+  // A virtio block device, if there is one, replaces
+  // IDE disk 1, the file system disk.
+  if(!havedisk1 && virtioinit() == 0)
+    virtiodisk1 = 1;
+
+  idedmainit();
+
+  // Transfer up to IDEMULT sectors per interrupt, so that
+  // requests for adjacent blocks can be merged.
+  if(BSIZE/SECTOR_SIZE <= IDEMULT &&
+     (idebm || (idesetmult(0) == 0 && (!havedisk1 || idesetmult(1) == 0))))
+    idemerge = IDEMULT / (BSIZE/SECTOR_SIZE);
+}
+
+// Find a PCI IDE controller that can do bus-master DMA and
+// enable it, setting idebm.  Otherwise the driver uses PIO.
+static void
+idedmainit(void)
+{
+  int tag;
+  uint bar;
+
+  if((tag = pcifindclass(0x01, 0x01)) < 0)    // mass storage, IDE
+    return;
+  if(!(pciread(tag, 0x08) & 0x8000))          // prog IF: bus master
+    return;
+  bar = pciread(tag, 0x20);                   // BAR4
+  if(!(bar & 1) || (bar & ~3) == 0)           // must be I/O space
+    return;
+  pciwrite(tag, 0x04, pciread(tag, 0x04) | 0x5);  // I/O and bus master
+  idebm = bar & ~3;
+  outb(idebm + BM_CMD, 0);
+  outb(idebm + BM_STATUS, BM_ERR|BM_INTR);
+  cprintf("ide: bus-master DMA at 0x%x\n", idebm);
+}
+
+// Set drive d to transfer IDEMULT sectors per interrupt
+// with READ/WRITE MULTIPLE.  Returns -1 if it can't.
+static int
+idesetmult(int d)
+{
+  int r;
+
+  idewait(0);
+  outb(0x3f6, 2);  // no interrupt
+  outb(0x1f2, IDEMULT);
+  outb(0x1f6, 0xe0 | (d<<4));
+  outb(0x1f7, IDE_CMD_SETMUL);
+  r = idewait(1);
+  outb(0x3f6, 0);
+  outb(0x1f6, 0xe0 | (0<<4));
+  return r;
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Start the request for b and the bufs chained to it through
+// qnext, which are for the blocks after b's, in one command.
+// Caller must hold idelock.
 static void
 idestart(struct buf *b)
 {
+  struct buf *b1;
+  int n;
+
   if(b == 0)
     panic("idestart");
-  if(b->blockno >= FSSIZE)
+  n = 0;
+  for(b1 = b; b1; b1 = b1->qnext)
+    n++;
+  if(b->blockno + n > FSSIZE)
     panic("incorrect blockno");
   int sector_per_block =  BSIZE/SECTOR_SIZE;
   int sector = b->blockno * sector_per_block;
-  int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
-  int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+  int nsector = n * sector_per_block;
+  int read_cmd = (nsector == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
+  int write_cmd = (nsector == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
 
   if (sector_per_block > 7) panic("idestart");
 
+  if(idebm){
+    // Describe the bufs to the bus master, which will
+    // move the data once the disk has the command.
+    for(n = 0, b1 = b; b1; b1 = b1->qnext, n++){
+      ideprd[n].addr = V2P(b1->data);
+      ideprd[n].len = BSIZE;
+      ideprd[n].flags = b1->qnext ? 0 : PRD_EOT;
+    }
+    outl(idebm + BM_PRDT, V2P(ideprd));
+    outb(idebm + BM_CMD, (b->flags & B_DIRTY) ? 0 : BM_TOMEM);
+    outb(idebm + BM_STATUS, BM_ERR|BM_INTR);
+    read_cmd = IDE_CMD_RDDMA;
+    write_cmd = IDE_CMD_WRDMA;
+  }
+
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f2, nsector);  // number of sectors
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
-  if(b->flags & B_DIRTY){
+  if(idebm){
+    outb(0x1f7, (b->flags & B_DIRTY) ? write_cmd : read_cmd);
+    outb(idebm + BM_CMD, inb(idebm + BM_CMD) | BM_START);
+  } else if(b->flags & B_DIRTY){
     outb(0x1f7, write_cmd);
-    outsl(0x1f0, b->data, BSIZE/4);
+    for(b1 = b; b1; b1 = b1->qnext)
+      outsl(0x1f0, b1->data, BSIZE/4);
   } else {
     outb(0x1f7, read_cmd);
   }
@@ -103,59 +250,278 @@ idestart(struct buf *b)
 void
 ideintr(void)
 {
-  struct buf *b;
+  struct buf *b, *b1, *async;
+  int err, st;
 
-  // First queued buffer is the active request.
+  // idecur is the active request.
   acquire(&idelock);
 
-  if((b = idequeue) == 0){
+  if((b = idecur) == 0){
     release(&idelock);
     return;
   }
-  idequeue = b->qnext;
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE/4);
+  // Read data if needed; with DMA, it is already in place.
+  if(idebm){
+    st = inb(idebm + BM_STATUS);
+    outb(idebm + BM_CMD, 0);
+    outb(idebm + BM_STATUS, BM_ERR|BM_INTR);
+    err = (st & BM_ERR) || idewait(1) < 0;
+  } else {
+    err = idewait(1) < 0;
+    if(!err && !(b->flags & B_DIRTY))
+      for(b1 = b; b1; b1 = b1->qnext)
+        insl(0x1f0, b1->data, BSIZE/4);
+  }
 
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+  // The bufs are not done until the command succeeds.
+  if(err){
+    if(++ideerrs > IDERETRY)
+      panic("ideintr: disk error");
+    idestart(b);
+    release(&idelock);
+    return;
+  }
+  ideerrs = 0;
+  idecur = 0;
+  async = idefinish(b);
 
   // Start disk on next buf in queue.
-  if(idequeue != 0)
-    idestart(idequeue);
+  idenext();
 
   release(&idelock);
+  idedoneasync(async);
 }
 
-// Sync buf with disk.
-// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
-// Else if B_VALID is not set, read buf from disk, set B_VALID.
+// Mark the bufs on the list through qnext done and wake the
+// processes waiting for them.  Returns the B_ASYNC bufs among
+// them, linked through qnext, for idedoneasync().
+// Caller must hold idelock.
+static struct buf*
+idefinish(struct buf *b)
+{
+  struct buf *bnext, *async;
+
+  async = 0;
+  for(; b; b = bnext){
+    bnext = b->qnext;
+    if(b->flags & B_ASYNC){
+      b->qnext = async;
+      async = b;
+    }
+    b->flags |= B_VALID;
+    b->flags &= ~(B_DIRTY|B_ASYNC|B_IO);
+    wakeup(b);
+  }
+  wakeup(&idecur);  // idewaitany() on several buffers
+  return async;
+}
+
+// No one is waiting for an asynchronous request; release
+// the bufs on the list for their submitters.  Caller must
+// not hold idelock.
+static void
+idedoneasync(struct buf *b)
+{
+  struct buf *bnext;
+
+  for(; b; b = bnext){
+    bnext = b->qnext;
+    bdone(b);
+  }
+}
+
+// Called by another disk driver (virtio.c) when the bufs on
+// the list through qnext are done.
 void
-iderw(struct buf *b)
+idedone(struct buf *b)
+{
+  struct buf *async;
+
+  acquire(&idelock);
+  async = idefinish(b);
+  release(&idelock);
+  idedoneasync(async);
+}
+
+// Put b at position i of heap q.
+static void
+qset(struct ideq *q, int i, struct buf *b)
 {
-  struct buf **pp;
+  q->b[i] = b;
+  b->qidx = i;
+}
 
+// Move the buf at position i of heap q up or down until it
+// is in order.
+static void
+qsift(struct ideq *q, int i)
+{
+  struct buf *b;
+  int c;
+
+  b = q->b[i];
+  for(; i > 0 && q->b[(i-1)/2]->blockno > b->blockno; i = (i-1)/2)
+    qset(q, i, q->b[(i-1)/2]);
+  for(; (c = 2*i+1) < q->n; i = c){
+    if(c+1 < q->n && q->b[c+1]->blockno < q->b[c]->blockno)
+      c++;
+    if(q->b[c]->blockno >= b->blockno)
+      break;
+    qset(q, i, q->b[c]);
+  }
+  qset(q, i, b);
+}
+
+// Add b to heap q and to the end of fifo.
+static void
+qinsert(struct ideq *q, struct buf *b)
+{
+  if(q->n == NIDEQ)
+    panic("qinsert");
+  qset(q, q->n++, b);
+  qsift(q, q->n-1);
+
+  b->qtime = ticks;
+  b->fnext = 0;
+  b->fprev = fifotail;
+  if(fifotail)
+    fifotail->fnext = b;
+  else
+    fifo = b;
+  fifotail = b;
+}
+
+// Remove b from heap q and from fifo.
+static void
+qremove(struct ideq *q, struct buf *b)
+{
+  int i;
+
+  i = b->qidx;
+  if(i != --q->n){
+    qset(q, i, q->b[q->n]);
+    qsift(q, i);
+  }
+
+  if(b->fprev)
+    b->fprev->fnext = b->fnext;
+  else
+    fifo = b->fnext;
+  if(b->fnext)
+    b->fnext->fprev = b->fprev;
+  else
+    fifotail = b->fprev;
+}
+
+// Start the next request, if any.  Caller must hold idelock
+// and the disk must be idle.
+static void
+idenext(void)
+{
+  struct ideq *t;
+  struct buf *b, *b1;
+  int n;
+
+  if((b = fifo) != 0 && ticks - b->qtime >= IDEDEADLINE){
+    // Served out of turn; find which heap it is on.
+    qremove(b->qidx < sweep->n && sweep->b[b->qidx] == b ? sweep : next, b);
+  } else {
+    if(sweep->n == 0){
+      // Reached the end; start the next sweep.
+      t = sweep;
+      sweep = next;
+      next = t;
+    }
+    if(sweep->n == 0)
+      return;
+    b = sweep->b[0];
+    qremove(sweep, b);
+    idepos = b->blockno;
+  }
+  idecur = b;
+
+  // Requests for the following blocks, if any, are next on
+  // sweep; transfer them in the same command.
+  for(n = 1; n < idemerge && sweep->n != 0; n++){
+    b1 = sweep->b[0];
+    if(b1->dev != b->dev || b1->blockno != b->blockno + 1 ||
+       (b1->flags & B_DIRTY) != (b->flags & B_DIRTY))
+      break;
+    qremove(sweep, b1);
+    b->qnext = b1;
+    b = b1;
+    idepos = b->blockno;
+  }
+  b->qnext = 0;
+  idestart(idecur);
+}
+
+// Queue b for the disk, starting the disk if it is idle.
+// Caller must hold idelock.
+static void
+ideappend(struct buf *b)
+{
   if(!holdingsleep(&b->lock))
     panic("iderw: buf not locked");
   if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
     panic("iderw: nothing to do");
+  b->flags |= B_IO;
+  if(b->dev != 0 && virtiodisk1){
+    virtiosubmit(b);
+    return;
+  }
   if(b->dev != 0 && !havedisk1)
     panic("iderw: ide disk 1 not present");
 
-  acquire(&idelock);  //DOC:acquire-lock
-
-  // Append b to idequeue.
-  b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
-    ;
-  *pp = b;
+  qinsert(b->blockno >= idepos ? sweep : next, b);  //DOC:insert-queue
 
   // Start disk if necessary.
-  if(idequeue == b)
-    idestart(b);
+  if(idecur == 0)
+    idenext();
+}
+
+// Start syncing buf with disk, as iderw() does, without
+// waiting.  Wait for the request with idewaitany(), or set
+// B_ASYNC to have the buffer released with bdone() when the
+// request finishes.
+void
+idesubmit(struct buf *b)
+{
+  acquire(&idelock);
+  ideappend(b);
+  release(&idelock);
+}
+
+// Wait until the disk is done with one of the n buffers in
+// bufs and return its index.  The buffers must be locked and
+// not have B_ASYNC set.
+int
+idewaitany(struct buf **bufs, int n)
+{
+  int i;
+
+  acquire(&idelock);
+  for(;;){
+    for(i = 0; i < n; i++){
+      if((bufs[i]->flags & (B_VALID|B_DIRTY)) == B_VALID){
+        release(&idelock);
+        return i;
+      }
+    }
+    sleep(n == 1 ? (void*)bufs[0] : (void*)&idecur, &idelock);
+  }
+}
+
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderw(struct buf *b)
+{
+  acquire(&idelock);  //DOC:acquire-lock
+
+  ideappend(b);
 
   // Wait for request to finish.
   while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
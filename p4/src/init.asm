@@ -0,0 +1,1160 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+   f:	83 ec 08             	sub    $0x8,%esp
+  12:	6a 02                	push   $0x2
+  14:	68 00 07 00 00       	push   $0x700
+  19:	e8 9e 02 00 00       	call   2bc <open>
+  1e:	83 c4 10             	add    $0x10,%esp
+  21:	85 c0                	test   %eax,%eax
+  23:	78 1b                	js     40 <main+0x40>
+    mknod("console", 1, 1);
+    open("console", O_RDWR);
+  }
+  dup(0);  // stdout
+  25:	83 ec 0c             	sub    $0xc,%esp
+  28:	6a 00                	push   $0x0
+  2a:	e8 c5 02 00 00       	call   2f4 <dup>
+  dup(0);  // stderr
+  2f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  36:	e8 b9 02 00 00       	call   2f4 <dup>
+  3b:	83 c4 10             	add    $0x10,%esp
+  3e:	eb 58                	jmp    98 <main+0x98>
+    mknod("console", 1, 1);
+  40:	83 ec 04             	sub    $0x4,%esp
+  43:	6a 01                	push   $0x1
+  45:	6a 01                	push   $0x1
+  47:	68 00 07 00 00       	push   $0x700
+  4c:	e8 73 02 00 00       	call   2c4 <mknod>
+    open("console", O_RDWR);
+  51:	83 c4 08             	add    $0x8,%esp
+  54:	6a 02                	push   $0x2
+  56:	68 00 07 00 00       	push   $0x700
+  5b:	e8 5c 02 00 00       	call   2bc <open>
+  60:	83 c4 10             	add    $0x10,%esp
+  63:	eb c0                	jmp    25 <main+0x25>
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+    pid = fork();
+    if(pid < 0){
+      printf(1, "init: fork failed\n");
+  65:	83 ec 08             	sub    $0x8,%esp
+  68:	68 1b 07 00 00       	push   $0x71b
+  6d:	6a 01                	push   $0x1
+  6f:	e8 df 03 00 00       	call   453 <printf>
+      exit();
+  74:	e8 03 02 00 00       	call   27c <exit>
+      exec("sh", argv);
+      printf(1, "init: exec sh failed\n");
+      exit();
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+      printf(1, "zombie!\n");
+  79:	83 ec 08             	sub    $0x8,%esp
+  7c:	68 47 07 00 00       	push   $0x747
+  81:	6a 01                	push   $0x1
+  83:	e8 cb 03 00 00       	call   453 <printf>
+  88:	83 c4 10             	add    $0x10,%esp
+    while((wpid=wait()) >= 0 && wpid != pid)
+  8b:	e8 f4 01 00 00       	call   284 <wait>
+  90:	85 c0                	test   %eax,%eax
+  92:	78 04                	js     98 <main+0x98>
+  94:	39 c3                	cmp    %eax,%ebx
+  96:	75 e1                	jne    79 <main+0x79>
+    printf(1, "init: starting sh\n");
+  98:	83 ec 08             	sub    $0x8,%esp
+  9b:	68 08 07 00 00       	push   $0x708
+  a0:	6a 01                	push   $0x1
+  a2:	e8 ac 03 00 00       	call   453 <printf>
+    pid = fork();
+  a7:	e8 c8 01 00 00       	call   274 <fork>
+  ac:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+  ae:	83 c4 10             	add    $0x10,%esp
+  b1:	85 c0                	test   %eax,%eax
+  b3:	78 b0                	js     65 <main+0x65>
+    if(pid == 0){
+  b5:	75 d4                	jne    8b <main+0x8b>
+      exec("sh", argv);
+  b7:	83 ec 08             	sub    $0x8,%esp
+  ba:	68 54 0a 00 00       	push   $0xa54
+  bf:	68 2e 07 00 00       	push   $0x72e
+  c4:	e8 eb 01 00 00       	call   2b4 <exec>
+      printf(1, "init: exec sh failed\n");
+  c9:	83 c4 08             	add    $0x8,%esp
+  cc:	68 31 07 00 00       	push   $0x731
+  d1:	6a 01                	push   $0x1
+  d3:	e8 7b 03 00 00       	call   453 <printf>
+      exit();
+  d8:	e8 9f 01 00 00       	call   27c <exit>
+
+000000dd <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  dd:	55                   	push   %ebp
+  de:	89 e5                	mov    %esp,%ebp
+  e0:	56                   	push   %esi
+  e1:	53                   	push   %ebx
+  e2:	8b 75 08             	mov    0x8(%ebp),%esi
+  e5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  e8:	89 f0                	mov    %esi,%eax
+  ea:	89 d1                	mov    %edx,%ecx
+  ec:	83 c2 01             	add    $0x1,%edx
+  ef:	89 c3                	mov    %eax,%ebx
+  f1:	83 c0 01             	add    $0x1,%eax
+  f4:	0f b6 09             	movzbl (%ecx),%ecx
+  f7:	88 0b                	mov    %cl,(%ebx)
+  f9:	84 c9                	test   %cl,%cl
+  fb:	75 ed                	jne    ea <strcpy+0xd>
+    ;
+  return os;
+}
+  fd:	89 f0                	mov    %esi,%eax
+  ff:	5b                   	pop    %ebx
+ 100:	5e                   	pop    %esi
+ 101:	5d                   	pop    %ebp
+ 102:	c3                   	ret
+
+00000103 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 103:	55                   	push   %ebp
+ 104:	89 e5                	mov    %esp,%ebp
+ 106:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 109:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 10c:	eb 06                	jmp    114 <strcmp+0x11>
+    p++, q++;
+ 10e:	83 c1 01             	add    $0x1,%ecx
+ 111:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 114:	0f b6 01             	movzbl (%ecx),%eax
+ 117:	84 c0                	test   %al,%al
+ 119:	74 04                	je     11f <strcmp+0x1c>
+ 11b:	3a 02                	cmp    (%edx),%al
+ 11d:	74 ef                	je     10e <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 11f:	0f b6 c0             	movzbl %al,%eax
+ 122:	0f b6 12             	movzbl (%edx),%edx
+ 125:	29 d0                	sub    %edx,%eax
+}
+ 127:	5d                   	pop    %ebp
+ 128:	c3                   	ret
+
+00000129 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 129:	55                   	push   %ebp
+ 12a:	89 e5                	mov    %esp,%ebp
+ 12c:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 12f:	b8 00 00 00 00       	mov    $0x0,%eax
+ 134:	eb 03                	jmp    139 <strlen+0x10>
+ 136:	83 c0 01             	add    $0x1,%eax
+ 139:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 13d:	75 f7                	jne    136 <strlen+0xd>
+    ;
+  return n;
+}
+ 13f:	5d                   	pop    %ebp
+ 140:	c3                   	ret
+
+00000141 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 141:	55                   	push   %ebp
+ 142:	89 e5                	mov    %esp,%ebp
+ 144:	57                   	push   %edi
+ 145:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 148:	89 d7                	mov    %edx,%edi
+ 14a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 14d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 150:	fc                   	cld
+ 151:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 153:	89 d0                	mov    %edx,%eax
+ 155:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 158:	c9                   	leave
+ 159:	c3                   	ret
+
+0000015a <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 15a:	55                   	push   %ebp
+ 15b:	89 e5                	mov    %esp,%ebp
+ 15d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 160:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 164:	eb 03                	jmp    169 <strchr+0xf>
+ 166:	83 c0 01             	add    $0x1,%eax
+ 169:	0f b6 10             	movzbl (%eax),%edx
+ 16c:	84 d2                	test   %dl,%dl
+ 16e:	74 06                	je     176 <strchr+0x1c>
+    if(*s == c)
+ 170:	38 ca                	cmp    %cl,%dl
+ 172:	75 f2                	jne    166 <strchr+0xc>
+ 174:	eb 05                	jmp    17b <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 176:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 17b:	5d                   	pop    %ebp
+ 17c:	c3                   	ret
+
+0000017d <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 17d:	55                   	push   %ebp
+ 17e:	89 e5                	mov    %esp,%ebp
+ 180:	57                   	push   %edi
+ 181:	56                   	push   %esi
+ 182:	53                   	push   %ebx
+ 183:	83 ec 1c             	sub    $0x1c,%esp
+ 186:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 189:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 18e:	89 de                	mov    %ebx,%esi
+ 190:	83 c3 01             	add    $0x1,%ebx
+ 193:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 196:	7d 2e                	jge    1c6 <gets+0x49>
+    cc = read(0, &c, 1);
+ 198:	83 ec 04             	sub    $0x4,%esp
+ 19b:	6a 01                	push   $0x1
+ 19d:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 1a0:	50                   	push   %eax
+ 1a1:	6a 00                	push   $0x0
+ 1a3:	e8 ec 00 00 00       	call   294 <read>
+    if(cc < 1)
+ 1a8:	83 c4 10             	add    $0x10,%esp
+ 1ab:	85 c0                	test   %eax,%eax
+ 1ad:	7e 17                	jle    1c6 <gets+0x49>
+      break;
+    buf[i++] = c;
+ 1af:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1b3:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 1b6:	3c 0a                	cmp    $0xa,%al
+ 1b8:	0f 94 c2             	sete   %dl
+ 1bb:	3c 0d                	cmp    $0xd,%al
+ 1bd:	0f 94 c0             	sete   %al
+ 1c0:	08 c2                	or     %al,%dl
+ 1c2:	74 ca                	je     18e <gets+0x11>
+    buf[i++] = c;
+ 1c4:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 1c6:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 1ca:	89 f8                	mov    %edi,%eax
+ 1cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1cf:	5b                   	pop    %ebx
+ 1d0:	5e                   	pop    %esi
+ 1d1:	5f                   	pop    %edi
+ 1d2:	5d                   	pop    %ebp
+ 1d3:	c3                   	ret
+
+000001d4 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1d4:	55                   	push   %ebp
+ 1d5:	89 e5                	mov    %esp,%ebp
+ 1d7:	56                   	push   %esi
+ 1d8:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1d9:	83 ec 08             	sub    $0x8,%esp
+ 1dc:	6a 00                	push   $0x0
+ 1de:	ff 75 08             	push   0x8(%ebp)
+ 1e1:	e8 d6 00 00 00       	call   2bc <open>
+  if(fd < 0)
+ 1e6:	83 c4 10             	add    $0x10,%esp
+ 1e9:	85 c0                	test   %eax,%eax
+ 1eb:	78 24                	js     211 <stat+0x3d>
+ 1ed:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 1ef:	83 ec 08             	sub    $0x8,%esp
+ 1f2:	ff 75 0c             	push   0xc(%ebp)
+ 1f5:	50                   	push   %eax
+ 1f6:	e8 d9 00 00 00       	call   2d4 <fstat>
+ 1fb:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1fd:	89 1c 24             	mov    %ebx,(%esp)
+ 200:	e8 9f 00 00 00       	call   2a4 <close>
+  return r;
+ 205:	83 c4 10             	add    $0x10,%esp
+}
+ 208:	89 f0                	mov    %esi,%eax
+ 20a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 20d:	5b                   	pop    %ebx
+ 20e:	5e                   	pop    %esi
+ 20f:	5d                   	pop    %ebp
+ 210:	c3                   	ret
+    return -1;
+ 211:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 216:	eb f0                	jmp    208 <stat+0x34>
+
+00000218 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 218:	55                   	push   %ebp
+ 219:	89 e5                	mov    %esp,%ebp
+ 21b:	53                   	push   %ebx
+ 21c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+ 21f:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+ 224:	eb 10                	jmp    236 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+ 226:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+ 229:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+ 22c:	83 c1 01             	add    $0x1,%ecx
+ 22f:	0f be c0             	movsbl %al,%eax
+ 232:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+ 236:	0f b6 01             	movzbl (%ecx),%eax
+ 239:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 23c:	80 fb 09             	cmp    $0x9,%bl
+ 23f:	76 e5                	jbe    226 <atoi+0xe>
+  return n;
+}
+ 241:	89 d0                	mov    %edx,%eax
+ 243:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 246:	c9                   	leave
+ 247:	c3                   	ret
+
+00000248 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 248:	55                   	push   %ebp
+ 249:	89 e5                	mov    %esp,%ebp
+ 24b:	56                   	push   %esi
+ 24c:	53                   	push   %ebx
+ 24d:	8b 75 08             	mov    0x8(%ebp),%esi
+ 250:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 253:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 256:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 258:	eb 0d                	jmp    267 <memmove+0x1f>
+    *dst++ = *src++;
+ 25a:	0f b6 01             	movzbl (%ecx),%eax
+ 25d:	88 02                	mov    %al,(%edx)
+ 25f:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 262:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 265:	89 d8                	mov    %ebx,%eax
+ 267:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 26a:	85 c0                	test   %eax,%eax
+ 26c:	7f ec                	jg     25a <memmove+0x12>
+  return vdst;
+}
+ 26e:	89 f0                	mov    %esi,%eax
+ 270:	5b                   	pop    %ebx
+ 271:	5e                   	pop    %esi
+ 272:	5d                   	pop    %ebp
+ 273:	c3                   	ret
+
+00000274 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 274:	b8 01 00 00 00       	mov    $0x1,%eax
+ 279:	cd 40                	int    $0x40
+ 27b:	c3                   	ret
+
+0000027c <exit>:
+SYSCALL(exit)
+ 27c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 281:	cd 40                	int    $0x40
+ 283:	c3                   	ret
+
+00000284 <wait>:
+SYSCALL(wait)
+ 284:	b8 03 00 00 00       	mov    $0x3,%eax
+ 289:	cd 40                	int    $0x40
+ 28b:	c3                   	ret
+
+0000028c <pipe>:
+SYSCALL(pipe)
+ 28c:	b8 04 00 00 00       	mov    $0x4,%eax
+ 291:	cd 40                	int    $0x40
+ 293:	c3                   	ret
+
+00000294 <read>:
+SYSCALL(read)
+ 294:	b8 05 00 00 00       	mov    $0x5,%eax
+ 299:	cd 40                	int    $0x40
+ 29b:	c3                   	ret
+
+0000029c <write>:
+SYSCALL(write)
+ 29c:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2a1:	cd 40                	int    $0x40
+ 2a3:	c3                   	ret
+
+000002a4 <close>:
+SYSCALL(close)
+ 2a4:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2a9:	cd 40                	int    $0x40
+ 2ab:	c3                   	ret
+
+000002ac <kill>:
+SYSCALL(kill)
+ 2ac:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2b1:	cd 40                	int    $0x40
+ 2b3:	c3                   	ret
+
+000002b4 <exec>:
+SYSCALL(exec)
+ 2b4:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2b9:	cd 40                	int    $0x40
+ 2bb:	c3                   	ret
+
+000002bc <open>:
+SYSCALL(open)
+ 2bc:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2c1:	cd 40                	int    $0x40
+ 2c3:	c3                   	ret
+
+000002c4 <mknod>:
+SYSCALL(mknod)
+ 2c4:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2c9:	cd 40                	int    $0x40
+ 2cb:	c3                   	ret
+
+000002cc <unlink>:
+SYSCALL(unlink)
+ 2cc:	b8 12 00 00 00       	mov    $0x12,%eax
+ 2d1:	cd 40                	int    $0x40
+ 2d3:	c3                   	ret
+
+000002d4 <fstat>:
+SYSCALL(fstat)
+ 2d4:	b8 08 00 00 00       	mov    $0x8,%eax
+ 2d9:	cd 40                	int    $0x40
+ 2db:	c3                   	ret
+
+000002dc <link>:
+SYSCALL(link)
+ 2dc:	b8 13 00 00 00       	mov    $0x13,%eax
+ 2e1:	cd 40                	int    $0x40
+ 2e3:	c3                   	ret
+
+000002e4 <mkdir>:
+SYSCALL(mkdir)
+ 2e4:	b8 14 00 00 00       	mov    $0x14,%eax
+ 2e9:	cd 40                	int    $0x40
+ 2eb:	c3                   	ret
+
+000002ec <chdir>:
+SYSCALL(chdir)
+ 2ec:	b8 09 00 00 00       	mov    $0x9,%eax
+ 2f1:	cd 40                	int    $0x40
+ 2f3:	c3                   	ret
+
+000002f4 <dup>:
+SYSCALL(dup)
+ 2f4:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 2f9:	cd 40                	int    $0x40
+ 2fb:	c3                   	ret
+
+000002fc <getpid>:
+SYSCALL(getpid)
+ 2fc:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 301:	cd 40                	int    $0x40
+ 303:	c3                   	ret
+
+00000304 <sbrk>:
+SYSCALL(sbrk)
+ 304:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 309:	cd 40                	int    $0x40
+ 30b:	c3                   	ret
+
+0000030c <sleep>:
+SYSCALL(sleep)
+ 30c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 311:	cd 40                	int    $0x40
+ 313:	c3                   	ret
+
+00000314 <uptime>:
+SYSCALL(uptime)
+ 314:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 319:	cd 40                	int    $0x40
+ 31b:	c3                   	ret
+
+0000031c <setpri>:
+SYSCALL(setpri)
+ 31c:	b8 16 00 00 00       	mov    $0x16,%eax
+ 321:	cd 40                	int    $0x40
+ 323:	c3                   	ret
+
+00000324 <getpri>:
+SYSCALL(getpri)
+ 324:	b8 17 00 00 00       	mov    $0x17,%eax
+ 329:	cd 40                	int    $0x40
+ 32b:	c3                   	ret
+
+0000032c <fork2>:
+SYSCALL(fork2)
+ 32c:	b8 18 00 00 00       	mov    $0x18,%eax
+ 331:	cd 40                	int    $0x40
+ 333:	c3                   	ret
+
+00000334 <getpinfo>:
+SYSCALL(getpinfo)
+ 334:	b8 19 00 00 00       	mov    $0x19,%eax
+ 339:	cd 40                	int    $0x40
+ 33b:	c3                   	ret
+
+0000033c <spawn>:
+SYSCALL(spawn)
+ 33c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 341:	cd 40                	int    $0x40
+ 343:	c3                   	ret
+
+00000344 <spawnn>:
+SYSCALL(spawnn)
+ 344:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 349:	cd 40                	int    $0x40
+ 34b:	c3                   	ret
+
+0000034c <kmstat>:
+SYSCALL(kmstat)
+ 34c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 351:	cd 40                	int    $0x40
+ 353:	c3                   	ret
+
+00000354 <slabstat>:
+SYSCALL(slabstat)
+ 354:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 359:	cd 40                	int    $0x40
+ 35b:	c3                   	ret
+
+0000035c <shmget>:
+SYSCALL(shmget)
+ 35c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 361:	cd 40                	int    $0x40
+ 363:	c3                   	ret
+
+00000364 <shmat>:
+SYSCALL(shmat)
+ 364:	b8 20 00 00 00       	mov    $0x20,%eax
+ 369:	cd 40                	int    $0x40
+ 36b:	c3                   	ret
+
+0000036c <shmdt>:
+SYSCALL(shmdt)
+ 36c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 371:	cd 40                	int    $0x40
+ 373:	c3                   	ret
+
+00000374 <mmap>:
+SYSCALL(mmap)
+ 374:	b8 22 00 00 00       	mov    $0x22,%eax
+ 379:	cd 40                	int    $0x40
+ 37b:	c3                   	ret
+
+0000037c <munmap>:
+SYSCALL(munmap)
+ 37c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 381:	cd 40                	int    $0x40
+ 383:	c3                   	ret
+
+00000384 <bstat>:
+SYSCALL(bstat)
+ 384:	b8 24 00 00 00       	mov    $0x24,%eax
+ 389:	cd 40                	int    $0x40
+ 38b:	c3                   	ret
+
+0000038c <aread>:
+SYSCALL(aread)
+ 38c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 391:	cd 40                	int    $0x40
+ 393:	c3                   	ret
+
+00000394 <await>:
+SYSCALL(await)
+ 394:	b8 26 00 00 00       	mov    $0x26,%eax
+ 399:	cd 40                	int    $0x40
+ 39b:	c3                   	ret
+
+0000039c <bdrop>:
+SYSCALL(bdrop)
+ 39c:	b8 27 00 00 00       	mov    $0x27,%eax
+ 3a1:	cd 40                	int    $0x40
+ 3a3:	c3                   	ret
+
+000003a4 <vfork>:
+# exec or exit, and its ret would leave the slot holding our
+# return address free for it to overwrite.  Keep the return
+# address in %ecx, which the kernel restores for both sides.
+.globl vfork
+vfork:
+  popl %ecx
+ 3a4:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+ 3a5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  int $T_SYSCALL
+ 3aa:	cd 40                	int    $0x40
+  pushl %ecx
+ 3ac:	51                   	push   %ecx
+  ret
+ 3ad:	c3                   	ret
+
+000003ae <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 3ae:	55                   	push   %ebp
+ 3af:	89 e5                	mov    %esp,%ebp
+ 3b1:	83 ec 1c             	sub    $0x1c,%esp
+ 3b4:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 3b7:	6a 01                	push   $0x1
+ 3b9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 3bc:	52                   	push   %edx
+ 3bd:	50                   	push   %eax
+ 3be:	e8 d9 fe ff ff       	call   29c <write>
+}
+ 3c3:	83 c4 10             	add    $0x10,%esp
+ 3c6:	c9                   	leave
+ 3c7:	c3                   	ret
+
+000003c8 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3c8:	55                   	push   %ebp
+ 3c9:	89 e5                	mov    %esp,%ebp
+ 3cb:	57                   	push   %edi
+ 3cc:	56                   	push   %esi
+ 3cd:	53                   	push   %ebx
+ 3ce:	83 ec 2c             	sub    $0x2c,%esp
+ 3d1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 3d4:	89 d0                	mov    %edx,%eax
+ 3d6:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 3d8:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 3dc:	0f 95 c1             	setne  %cl
+ 3df:	c1 ea 1f             	shr    $0x1f,%edx
+ 3e2:	84 d1                	test   %dl,%cl
+ 3e4:	74 44                	je     42a <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 3e6:	f7 d8                	neg    %eax
+ 3e8:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 3ea:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 3f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 3f6:	89 c8                	mov    %ecx,%eax
+ 3f8:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3fd:	f7 f6                	div    %esi
+ 3ff:	89 df                	mov    %ebx,%edi
+ 401:	83 c3 01             	add    $0x1,%ebx
+ 404:	0f b6 92 b0 07 00 00 	movzbl 0x7b0(%edx),%edx
+ 40b:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 40f:	89 ca                	mov    %ecx,%edx
+ 411:	89 c1                	mov    %eax,%ecx
+ 413:	39 f2                	cmp    %esi,%edx
+ 415:	73 df                	jae    3f6 <printint+0x2e>
+  if(neg)
+ 417:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 41b:	74 31                	je     44e <printint+0x86>
+    buf[i++] = '-';
+ 41d:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 422:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 425:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 428:	eb 17                	jmp    441 <printint+0x79>
+    x = xx;
+ 42a:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 42c:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 433:	eb bc                	jmp    3f1 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 435:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 43a:	89 f0                	mov    %esi,%eax
+ 43c:	e8 6d ff ff ff       	call   3ae <putc>
+  while(--i >= 0)
+ 441:	83 eb 01             	sub    $0x1,%ebx
+ 444:	79 ef                	jns    435 <printint+0x6d>
+}
+ 446:	83 c4 2c             	add    $0x2c,%esp
+ 449:	5b                   	pop    %ebx
+ 44a:	5e                   	pop    %esi
+ 44b:	5f                   	pop    %edi
+ 44c:	5d                   	pop    %ebp
+ 44d:	c3                   	ret
+ 44e:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 451:	eb ee                	jmp    441 <printint+0x79>
+
+00000453 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 453:	55                   	push   %ebp
+ 454:	89 e5                	mov    %esp,%ebp
+ 456:	57                   	push   %edi
+ 457:	56                   	push   %esi
+ 458:	53                   	push   %ebx
+ 459:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 45c:	8d 45 10             	lea    0x10(%ebp),%eax
+ 45f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 462:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 467:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 46c:	eb 14                	jmp    482 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 46e:	89 fa                	mov    %edi,%edx
+ 470:	8b 45 08             	mov    0x8(%ebp),%eax
+ 473:	e8 36 ff ff ff       	call   3ae <putc>
+ 478:	eb 05                	jmp    47f <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 47a:	83 fe 25             	cmp    $0x25,%esi
+ 47d:	74 25                	je     4a4 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 47f:	83 c3 01             	add    $0x1,%ebx
+ 482:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 485:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 489:	84 c0                	test   %al,%al
+ 48b:	0f 84 20 01 00 00    	je     5b1 <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 491:	0f be f8             	movsbl %al,%edi
+ 494:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 497:	85 f6                	test   %esi,%esi
+ 499:	75 df                	jne    47a <printf+0x27>
+      if(c == '%'){
+ 49b:	83 f8 25             	cmp    $0x25,%eax
+ 49e:	75 ce                	jne    46e <printf+0x1b>
+        state = '%';
+ 4a0:	89 c6                	mov    %eax,%esi
+ 4a2:	eb db                	jmp    47f <printf+0x2c>
+      if(c == 'd'){
+ 4a4:	83 f8 25             	cmp    $0x25,%eax
+ 4a7:	0f 84 cf 00 00 00    	je     57c <printf+0x129>
+ 4ad:	0f 8c dd 00 00 00    	jl     590 <printf+0x13d>
+ 4b3:	83 f8 78             	cmp    $0x78,%eax
+ 4b6:	0f 8f d4 00 00 00    	jg     590 <printf+0x13d>
+ 4bc:	83 f8 63             	cmp    $0x63,%eax
+ 4bf:	0f 8c cb 00 00 00    	jl     590 <printf+0x13d>
+ 4c5:	83 e8 63             	sub    $0x63,%eax
+ 4c8:	83 f8 15             	cmp    $0x15,%eax
+ 4cb:	0f 87 bf 00 00 00    	ja     590 <printf+0x13d>
+ 4d1:	ff 24 85 58 07 00 00 	jmp    *0x758(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 4d8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 4db:	8b 17                	mov    (%edi),%edx
+ 4dd:	83 ec 0c             	sub    $0xc,%esp
+ 4e0:	6a 01                	push   $0x1
+ 4e2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 4e7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4ea:	e8 d9 fe ff ff       	call   3c8 <printint>
+        ap++;
+ 4ef:	83 c7 04             	add    $0x4,%edi
+ 4f2:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 4f5:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 4f8:	be 00 00 00 00       	mov    $0x0,%esi
+ 4fd:	eb 80                	jmp    47f <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 4ff:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 502:	8b 17                	mov    (%edi),%edx
+ 504:	83 ec 0c             	sub    $0xc,%esp
+ 507:	6a 00                	push   $0x0
+ 509:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 50e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 511:	e8 b2 fe ff ff       	call   3c8 <printint>
+        ap++;
+ 516:	83 c7 04             	add    $0x4,%edi
+ 519:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 51c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 51f:	be 00 00 00 00       	mov    $0x0,%esi
+ 524:	e9 56 ff ff ff       	jmp    47f <printf+0x2c>
+        s = (char*)*ap;
+ 529:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 52c:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 52e:	83 c0 04             	add    $0x4,%eax
+ 531:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 534:	85 f6                	test   %esi,%esi
+ 536:	75 15                	jne    54d <printf+0xfa>
+          s = "(null)";
+ 538:	be 50 07 00 00       	mov    $0x750,%esi
+ 53d:	eb 0e                	jmp    54d <printf+0xfa>
+          putc(fd, *s);
+ 53f:	0f be d2             	movsbl %dl,%edx
+ 542:	8b 45 08             	mov    0x8(%ebp),%eax
+ 545:	e8 64 fe ff ff       	call   3ae <putc>
+          s++;
+ 54a:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 54d:	0f b6 16             	movzbl (%esi),%edx
+ 550:	84 d2                	test   %dl,%dl
+ 552:	75 eb                	jne    53f <printf+0xec>
+      state = 0;
+ 554:	be 00 00 00 00       	mov    $0x0,%esi
+ 559:	e9 21 ff ff ff       	jmp    47f <printf+0x2c>
+        putc(fd, *ap);
+ 55e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 561:	0f be 17             	movsbl (%edi),%edx
+ 564:	8b 45 08             	mov    0x8(%ebp),%eax
+ 567:	e8 42 fe ff ff       	call   3ae <putc>
+        ap++;
+ 56c:	83 c7 04             	add    $0x4,%edi
+ 56f:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 572:	be 00 00 00 00       	mov    $0x0,%esi
+ 577:	e9 03 ff ff ff       	jmp    47f <printf+0x2c>
+        putc(fd, c);
+ 57c:	89 fa                	mov    %edi,%edx
+ 57e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 581:	e8 28 fe ff ff       	call   3ae <putc>
+      state = 0;
+ 586:	be 00 00 00 00       	mov    $0x0,%esi
+ 58b:	e9 ef fe ff ff       	jmp    47f <printf+0x2c>
+        putc(fd, '%');
+ 590:	ba 25 00 00 00       	mov    $0x25,%edx
+ 595:	8b 45 08             	mov    0x8(%ebp),%eax
+ 598:	e8 11 fe ff ff       	call   3ae <putc>
+        putc(fd, c);
+ 59d:	89 fa                	mov    %edi,%edx
+ 59f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5a2:	e8 07 fe ff ff       	call   3ae <putc>
+      state = 0;
+ 5a7:	be 00 00 00 00       	mov    $0x0,%esi
+ 5ac:	e9 ce fe ff ff       	jmp    47f <printf+0x2c>
+    }
+  }
+}
+ 5b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5b4:	5b                   	pop    %ebx
+ 5b5:	5e                   	pop    %esi
+ 5b6:	5f                   	pop    %edi
+ 5b7:	5d                   	pop    %ebp
+ 5b8:	c3                   	ret
+
+000005b9 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 5b9:	55                   	push   %ebp
+ 5ba:	89 e5                	mov    %esp,%ebp
+ 5bc:	57                   	push   %edi
+ 5bd:	56                   	push   %esi
+ 5be:	53                   	push   %ebx
+ 5bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 5c2:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 5c5:	a1 5c 0a 00 00       	mov    0xa5c,%eax
+ 5ca:	eb 02                	jmp    5ce <free+0x15>
+ 5cc:	89 d0                	mov    %edx,%eax
+ 5ce:	39 c8                	cmp    %ecx,%eax
+ 5d0:	73 04                	jae    5d6 <free+0x1d>
+ 5d2:	3b 08                	cmp    (%eax),%ecx
+ 5d4:	72 12                	jb     5e8 <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 5d6:	8b 10                	mov    (%eax),%edx
+ 5d8:	39 d0                	cmp    %edx,%eax
+ 5da:	72 f0                	jb     5cc <free+0x13>
+ 5dc:	39 c8                	cmp    %ecx,%eax
+ 5de:	72 08                	jb     5e8 <free+0x2f>
+ 5e0:	39 d1                	cmp    %edx,%ecx
+ 5e2:	72 04                	jb     5e8 <free+0x2f>
+ 5e4:	89 d0                	mov    %edx,%eax
+ 5e6:	eb e6                	jmp    5ce <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 5e8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 5eb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 5ee:	8b 10                	mov    (%eax),%edx
+ 5f0:	39 d7                	cmp    %edx,%edi
+ 5f2:	74 19                	je     60d <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 5f4:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 5f7:	8b 50 04             	mov    0x4(%eax),%edx
+ 5fa:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 5fd:	39 ce                	cmp    %ecx,%esi
+ 5ff:	74 1b                	je     61c <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 601:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 603:	a3 5c 0a 00 00       	mov    %eax,0xa5c
+}
+ 608:	5b                   	pop    %ebx
+ 609:	5e                   	pop    %esi
+ 60a:	5f                   	pop    %edi
+ 60b:	5d                   	pop    %ebp
+ 60c:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 60d:	03 72 04             	add    0x4(%edx),%esi
+ 610:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 613:	8b 10                	mov    (%eax),%edx
+ 615:	8b 12                	mov    (%edx),%edx
+ 617:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 61a:	eb db                	jmp    5f7 <free+0x3e>
+    p->s.size += bp->s.size;
+ 61c:	03 53 fc             	add    -0x4(%ebx),%edx
+ 61f:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 622:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 625:	89 10                	mov    %edx,(%eax)
+ 627:	eb da                	jmp    603 <free+0x4a>
+
+00000629 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 629:	55                   	push   %ebp
+ 62a:	89 e5                	mov    %esp,%ebp
+ 62c:	53                   	push   %ebx
+ 62d:	83 ec 04             	sub    $0x4,%esp
+ 630:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 632:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 637:	77 05                	ja     63e <morecore+0x15>
+    nu = 4096;
+ 639:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 63e:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 645:	83 ec 0c             	sub    $0xc,%esp
+ 648:	50                   	push   %eax
+ 649:	e8 b6 fc ff ff       	call   304 <sbrk>
+  if(p == (char*)-1)
+ 64e:	83 c4 10             	add    $0x10,%esp
+ 651:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 654:	74 1c                	je     672 <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 656:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 659:	83 c0 08             	add    $0x8,%eax
+ 65c:	83 ec 0c             	sub    $0xc,%esp
+ 65f:	50                   	push   %eax
+ 660:	e8 54 ff ff ff       	call   5b9 <free>
+  return freep;
+ 665:	a1 5c 0a 00 00       	mov    0xa5c,%eax
+ 66a:	83 c4 10             	add    $0x10,%esp
+}
+ 66d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 670:	c9                   	leave
+ 671:	c3                   	ret
+    return 0;
+ 672:	b8 00 00 00 00       	mov    $0x0,%eax
+ 677:	eb f4                	jmp    66d <morecore+0x44>
+
+00000679 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 679:	55                   	push   %ebp
+ 67a:	89 e5                	mov    %esp,%ebp
+ 67c:	53                   	push   %ebx
+ 67d:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 680:	8b 45 08             	mov    0x8(%ebp),%eax
+ 683:	8d 58 07             	lea    0x7(%eax),%ebx
+ 686:	c1 eb 03             	shr    $0x3,%ebx
+ 689:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 68c:	8b 0d 5c 0a 00 00    	mov    0xa5c,%ecx
+ 692:	85 c9                	test   %ecx,%ecx
+ 694:	74 04                	je     69a <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 696:	8b 01                	mov    (%ecx),%eax
+ 698:	eb 4a                	jmp    6e4 <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 69a:	c7 05 5c 0a 00 00 60 	movl   $0xa60,0xa5c
+ 6a1:	0a 00 00 
+ 6a4:	c7 05 60 0a 00 00 60 	movl   $0xa60,0xa60
+ 6ab:	0a 00 00 
+    base.s.size = 0;
+ 6ae:	c7 05 64 0a 00 00 00 	movl   $0x0,0xa64
+ 6b5:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 6b8:	b9 60 0a 00 00       	mov    $0xa60,%ecx
+ 6bd:	eb d7                	jmp    696 <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 6bf:	74 19                	je     6da <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 6c1:	29 da                	sub    %ebx,%edx
+ 6c3:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 6c6:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 6c9:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 6cc:	89 0d 5c 0a 00 00    	mov    %ecx,0xa5c
+      return (void*)(p + 1);
+ 6d2:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 6d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 6d8:	c9                   	leave
+ 6d9:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 6da:	8b 10                	mov    (%eax),%edx
+ 6dc:	89 11                	mov    %edx,(%ecx)
+ 6de:	eb ec                	jmp    6cc <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6e0:	89 c1                	mov    %eax,%ecx
+ 6e2:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 6e4:	8b 50 04             	mov    0x4(%eax),%edx
+ 6e7:	39 da                	cmp    %ebx,%edx
+ 6e9:	73 d4                	jae    6bf <malloc+0x46>
+    if(p == freep)
+ 6eb:	39 05 5c 0a 00 00    	cmp    %eax,0xa5c
+ 6f1:	75 ed                	jne    6e0 <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 6f3:	89 d8                	mov    %ebx,%eax
+ 6f5:	e8 2f ff ff ff       	call   629 <morecore>
+ 6fa:	85 c0                	test   %eax,%eax
+ 6fc:	75 e2                	jne    6e0 <malloc+0x67>
+ 6fe:	eb d5                	jmp    6d5 <malloc+0x5c>
@@ -73,3 +73,15 @@ ioapicenable(int irq, int cpunum)
   ioapicwrite(REG_TABLE+2*irq, T_IRQ0 + irq);
   ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
 }
+
+// Like ioapicenable, for a PCI interrupt line: level-triggered,
+// so that a device that finishes more work while its interrupt
+// is being handled raises it again.  QEMU's MADT describes the
+// IRQs its PCI links are routed to (5, 9, 10 and 11) as level-
+// triggered and active high, so that is the polarity used.
+void
+ioapicenablelevel(int irq, int cpunum)
+{
+  ioapicwrite(REG_TABLE+2*irq, INT_LEVEL | (T_IRQ0 + irq));
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+}
@@ -0,0 +1,1322 @@
+
+_iobench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <mkfile>:
+
+char buf[BSIZE];
+
+void
+mkfile(char *name)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	57                   	push   %edi
+   4:	56                   	push   %esi
+   5:	53                   	push   %ebx
+   6:	83 ec 14             	sub    $0x14,%esp
+   9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int fd, i;
+
+  if((fd = open(name, O_CREATE|O_RDWR)) < 0){
+   c:	68 02 02 00 00       	push   $0x202
+  11:	57                   	push   %edi
+  12:	e8 ce 03 00 00       	call   3e5 <open>
+  17:	83 c4 10             	add    $0x10,%esp
+  1a:	85 c0                	test   %eax,%eax
+  1c:	78 2e                	js     4c <mkfile+0x4c>
+  1e:	89 c6                	mov    %eax,%esi
+    printf(1, "iobench: create %s failed\n", name);
+    exit();
+  }
+  for(i = 0; i < NBLOCK; i++){
+  20:	bb 00 00 00 00       	mov    $0x0,%ebx
+  25:	83 fb 3f             	cmp    $0x3f,%ebx
+  28:	7f 4c                	jg     76 <mkfile+0x76>
+    if(write(fd, buf, BSIZE) != BSIZE){
+  2a:	83 ec 04             	sub    $0x4,%esp
+  2d:	68 00 02 00 00       	push   $0x200
+  32:	68 80 0c 00 00       	push   $0xc80
+  37:	56                   	push   %esi
+  38:	e8 88 03 00 00       	call   3c5 <write>
+  3d:	83 c4 10             	add    $0x10,%esp
+  40:	3d 00 02 00 00       	cmp    $0x200,%eax
+  45:	75 1a                	jne    61 <mkfile+0x61>
+  for(i = 0; i < NBLOCK; i++){
+  47:	83 c3 01             	add    $0x1,%ebx
+  4a:	eb d9                	jmp    25 <mkfile+0x25>
+    printf(1, "iobench: create %s failed\n", name);
+  4c:	83 ec 04             	sub    $0x4,%esp
+  4f:	57                   	push   %edi
+  50:	68 2c 08 00 00       	push   $0x82c
+  55:	6a 01                	push   $0x1
+  57:	e8 20 05 00 00       	call   57c <printf>
+    exit();
+  5c:	e8 44 03 00 00       	call   3a5 <exit>
+      printf(1, "iobench: write %s failed\n", name);
+  61:	83 ec 04             	sub    $0x4,%esp
+  64:	57                   	push   %edi
+  65:	68 47 08 00 00       	push   $0x847
+  6a:	6a 01                	push   $0x1
+  6c:	e8 0b 05 00 00       	call   57c <printf>
+      exit();
+  71:	e8 2f 03 00 00       	call   3a5 <exit>
+    }
+  }
+  close(fd);
+  76:	83 ec 0c             	sub    $0xc,%esp
+  79:	56                   	push   %esi
+  7a:	e8 4e 03 00 00       	call   3cd <close>
+}
+  7f:	83 c4 10             	add    $0x10,%esp
+  82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  85:	5b                   	pop    %ebx
+  86:	5e                   	pop    %esi
+  87:	5f                   	pop    %edi
+  88:	5d                   	pop    %ebp
+  89:	c3                   	ret
+
+0000008a <readfile>:
+
+void
+readfile(char *name)
+{
+  8a:	55                   	push   %ebp
+  8b:	89 e5                	mov    %esp,%ebp
+  8d:	57                   	push   %edi
+  8e:	56                   	push   %esi
+  8f:	53                   	push   %ebx
+  90:	83 ec 14             	sub    $0x14,%esp
+  93:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int fd, n;
+
+  if((fd = open(name, O_RDONLY)) < 0){
+  96:	6a 00                	push   $0x0
+  98:	57                   	push   %edi
+  99:	e8 47 03 00 00       	call   3e5 <open>
+  9e:	83 c4 10             	add    $0x10,%esp
+  a1:	85 c0                	test   %eax,%eax
+  a3:	78 09                	js     ae <readfile+0x24>
+  a5:	89 c6                	mov    %eax,%esi
+    printf(1, "iobench: open %s failed\n", name);
+    exit();
+  }
+  n = 0;
+  a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  ac:	eb 18                	jmp    c6 <readfile+0x3c>
+    printf(1, "iobench: open %s failed\n", name);
+  ae:	83 ec 04             	sub    $0x4,%esp
+  b1:	57                   	push   %edi
+  b2:	68 61 08 00 00       	push   $0x861
+  b7:	6a 01                	push   $0x1
+  b9:	e8 be 04 00 00       	call   57c <printf>
+    exit();
+  be:	e8 e2 02 00 00       	call   3a5 <exit>
+  while(read(fd, buf, BSIZE) == BSIZE)
+    n++;
+  c3:	83 c3 01             	add    $0x1,%ebx
+  while(read(fd, buf, BSIZE) == BSIZE)
+  c6:	83 ec 04             	sub    $0x4,%esp
+  c9:	68 00 02 00 00       	push   $0x200
+  ce:	68 80 0c 00 00       	push   $0xc80
+  d3:	56                   	push   %esi
+  d4:	e8 e4 02 00 00       	call   3bd <read>
+  d9:	83 c4 10             	add    $0x10,%esp
+  dc:	3d 00 02 00 00       	cmp    $0x200,%eax
+  e1:	74 e0                	je     c3 <readfile+0x39>
+  if(n != NBLOCK)
+  e3:	83 fb 40             	cmp    $0x40,%ebx
+  e6:	75 14                	jne    fc <readfile+0x72>
+    printf(1, "iobench: %s: read %d blocks\n", name, n);
+  close(fd);
+  e8:	83 ec 0c             	sub    $0xc,%esp
+  eb:	56                   	push   %esi
+  ec:	e8 dc 02 00 00       	call   3cd <close>
+}
+  f1:	83 c4 10             	add    $0x10,%esp
+  f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  f7:	5b                   	pop    %ebx
+  f8:	5e                   	pop    %esi
+  f9:	5f                   	pop    %edi
+  fa:	5d                   	pop    %ebp
+  fb:	c3                   	ret
+    printf(1, "iobench: %s: read %d blocks\n", name, n);
+  fc:	53                   	push   %ebx
+  fd:	57                   	push   %edi
+  fe:	68 7a 08 00 00       	push   $0x87a
+ 103:	6a 01                	push   $0x1
+ 105:	e8 72 04 00 00       	call   57c <printf>
+ 10a:	83 c4 10             	add    $0x10,%esp
+ 10d:	eb d9                	jmp    e8 <readfile+0x5e>
+
+0000010f <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 10f:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 113:	83 e4 f0             	and    $0xfffffff0,%esp
+ 116:	ff 71 fc             	push   -0x4(%ecx)
+ 119:	55                   	push   %ebp
+ 11a:	89 e5                	mov    %esp,%ebp
+ 11c:	56                   	push   %esi
+ 11d:	53                   	push   %ebx
+ 11e:	51                   	push   %ecx
+ 11f:	83 ec 1c             	sub    $0x1c,%esp
+  char name[] = "iobench0";
+ 122:	c7 45 df 69 6f 62 65 	movl   $0x65626f69,-0x21(%ebp)
+ 129:	c7 45 e3 6e 63 68 30 	movl   $0x3068636e,-0x1d(%ebp)
+ 130:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+  int i, t0, t1;
+
+  for(i = 0; i < NREADER; i++){
+ 134:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 139:	eb 18                	jmp    153 <main+0x44>
+    name[7] = '0' + i;
+ 13b:	8d 43 30             	lea    0x30(%ebx),%eax
+ 13e:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    mkfile(name);
+ 141:	83 ec 0c             	sub    $0xc,%esp
+ 144:	8d 45 df             	lea    -0x21(%ebp),%eax
+ 147:	50                   	push   %eax
+ 148:	e8 b3 fe ff ff       	call   0 <mkfile>
+  for(i = 0; i < NREADER; i++){
+ 14d:	83 c3 01             	add    $0x1,%ebx
+ 150:	83 c4 10             	add    $0x10,%esp
+ 153:	83 fb 03             	cmp    $0x3,%ebx
+ 156:	7e e3                	jle    13b <main+0x2c>
+  }
+
+  if(bdrop() < 0)
+ 158:	e8 68 03 00 00       	call   4c5 <bdrop>
+ 15d:	85 c0                	test   %eax,%eax
+ 15f:	78 25                	js     186 <main+0x77>
+    printf(1, "iobench: bdrop disabled, files may be cached; build with -DBDROP\n");
+  t0 = uptime();
+ 161:	e8 d7 02 00 00       	call   43d <uptime>
+ 166:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < NREADER; i++){
+ 168:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 16d:	83 fb 03             	cmp    $0x3,%ebx
+ 170:	7f 39                	jg     1ab <main+0x9c>
+    name[7] = '0' + i;
+ 172:	8d 43 30             	lea    0x30(%ebx),%eax
+ 175:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    if(fork() == 0){
+ 178:	e8 20 02 00 00       	call   39d <fork>
+ 17d:	85 c0                	test   %eax,%eax
+ 17f:	74 19                	je     19a <main+0x8b>
+  for(i = 0; i < NREADER; i++){
+ 181:	83 c3 01             	add    $0x1,%ebx
+ 184:	eb e7                	jmp    16d <main+0x5e>
+    printf(1, "iobench: bdrop disabled, files may be cached; build with -DBDROP\n");
+ 186:	83 ec 08             	sub    $0x8,%esp
+ 189:	68 98 08 00 00       	push   $0x898
+ 18e:	6a 01                	push   $0x1
+ 190:	e8 e7 03 00 00       	call   57c <printf>
+ 195:	83 c4 10             	add    $0x10,%esp
+ 198:	eb c7                	jmp    161 <main+0x52>
+      readfile(name);
+ 19a:	83 ec 0c             	sub    $0xc,%esp
+ 19d:	8d 45 df             	lea    -0x21(%ebp),%eax
+ 1a0:	50                   	push   %eax
+ 1a1:	e8 e4 fe ff ff       	call   8a <readfile>
+      exit();
+ 1a6:	e8 fa 01 00 00       	call   3a5 <exit>
+    }
+  }
+  for(i = 0; i < NREADER; i++)
+ 1ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 1b0:	eb 08                	jmp    1ba <main+0xab>
+    wait();
+ 1b2:	e8 f6 01 00 00       	call   3ad <wait>
+  for(i = 0; i < NREADER; i++)
+ 1b7:	83 c3 01             	add    $0x1,%ebx
+ 1ba:	83 fb 03             	cmp    $0x3,%ebx
+ 1bd:	7e f3                	jle    1b2 <main+0xa3>
+  t1 = uptime();
+ 1bf:	e8 79 02 00 00       	call   43d <uptime>
+
+  printf(1, "iobench: %d readers x %d blocks: %d ticks\n",
+ 1c4:	83 ec 0c             	sub    $0xc,%esp
+ 1c7:	29 f0                	sub    %esi,%eax
+ 1c9:	50                   	push   %eax
+ 1ca:	6a 40                	push   $0x40
+ 1cc:	6a 04                	push   $0x4
+ 1ce:	68 dc 08 00 00       	push   $0x8dc
+ 1d3:	6a 01                	push   $0x1
+ 1d5:	e8 a2 03 00 00       	call   57c <printf>
+         NREADER, NBLOCK, t1 - t0);
+
+  for(i = 0; i < NREADER; i++){
+ 1da:	83 c4 20             	add    $0x20,%esp
+ 1dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 1e2:	eb 18                	jmp    1fc <main+0xed>
+    name[7] = '0' + i;
+ 1e4:	8d 43 30             	lea    0x30(%ebx),%eax
+ 1e7:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    unlink(name);
+ 1ea:	83 ec 0c             	sub    $0xc,%esp
+ 1ed:	8d 45 df             	lea    -0x21(%ebp),%eax
+ 1f0:	50                   	push   %eax
+ 1f1:	e8 ff 01 00 00       	call   3f5 <unlink>
+  for(i = 0; i < NREADER; i++){
+ 1f6:	83 c3 01             	add    $0x1,%ebx
+ 1f9:	83 c4 10             	add    $0x10,%esp
+ 1fc:	83 fb 03             	cmp    $0x3,%ebx
+ 1ff:	7e e3                	jle    1e4 <main+0xd5>
+  }
+  exit();
+ 201:	e8 9f 01 00 00       	call   3a5 <exit>
+
+00000206 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 206:	55                   	push   %ebp
+ 207:	89 e5                	mov    %esp,%ebp
+ 209:	56                   	push   %esi
+ 20a:	53                   	push   %ebx
+ 20b:	8b 75 08             	mov    0x8(%ebp),%esi
+ 20e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 211:	89 f0                	mov    %esi,%eax
+ 213:	89 d1                	mov    %edx,%ecx
+ 215:	83 c2 01             	add    $0x1,%edx
+ 218:	89 c3                	mov    %eax,%ebx
+ 21a:	83 c0 01             	add    $0x1,%eax
+ 21d:	0f b6 09             	movzbl (%ecx),%ecx
+ 220:	88 0b                	mov    %cl,(%ebx)
+ 222:	84 c9                	test   %cl,%cl
+ 224:	75 ed                	jne    213 <strcpy+0xd>
+    ;
+  return os;
+}
+ 226:	89 f0                	mov    %esi,%eax
+ 228:	5b                   	pop    %ebx
+ 229:	5e                   	pop    %esi
+ 22a:	5d                   	pop    %ebp
+ 22b:	c3                   	ret
+
+0000022c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 22c:	55                   	push   %ebp
+ 22d:	89 e5                	mov    %esp,%ebp
+ 22f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 232:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 235:	eb 06                	jmp    23d <strcmp+0x11>
+    p++, q++;
+ 237:	83 c1 01             	add    $0x1,%ecx
+ 23a:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 23d:	0f b6 01             	movzbl (%ecx),%eax
+ 240:	84 c0                	test   %al,%al
+ 242:	74 04                	je     248 <strcmp+0x1c>
+ 244:	3a 02                	cmp    (%edx),%al
+ 246:	74 ef                	je     237 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 248:	0f b6 c0             	movzbl %al,%eax
+ 24b:	0f b6 12             	movzbl (%edx),%edx
+ 24e:	29 d0                	sub    %edx,%eax
+}
+ 250:	5d                   	pop    %ebp
+ 251:	c3                   	ret
+
+00000252 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 252:	55                   	push   %ebp
+ 253:	89 e5                	mov    %esp,%ebp
+ 255:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 258:	b8 00 00 00 00       	mov    $0x0,%eax
+ 25d:	eb 03                	jmp    262 <strlen+0x10>
+ 25f:	83 c0 01             	add    $0x1,%eax
+ 262:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 266:	75 f7                	jne    25f <strlen+0xd>
+    ;
+  return n;
+}
+ 268:	5d                   	pop    %ebp
+ 269:	c3                   	ret
+
+0000026a <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 26a:	55                   	push   %ebp
+ 26b:	89 e5                	mov    %esp,%ebp
+ 26d:	57                   	push   %edi
+ 26e:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 271:	89 d7                	mov    %edx,%edi
+ 273:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 276:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 279:	fc                   	cld
+ 27a:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 27c:	89 d0                	mov    %edx,%eax
+ 27e:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 281:	c9                   	leave
+ 282:	c3                   	ret
+
+00000283 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 283:	55                   	push   %ebp
+ 284:	89 e5                	mov    %esp,%ebp
+ 286:	8b 45 08             	mov    0x8(%ebp),%eax
+ 289:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 28d:	eb 03                	jmp    292 <strchr+0xf>
+ 28f:	83 c0 01             	add    $0x1,%eax
+ 292:	0f b6 10             	movzbl (%eax),%edx
+ 295:	84 d2                	test   %dl,%dl
+ 297:	74 06                	je     29f <strchr+0x1c>
+    if(*s == c)
+ 299:	38 ca                	cmp    %cl,%dl
+ 29b:	75 f2                	jne    28f <strchr+0xc>
+ 29d:	eb 05                	jmp    2a4 <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 29f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 2a4:	5d                   	pop    %ebp
+ 2a5:	c3                   	ret
+
+000002a6 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2a6:	55                   	push   %ebp
+ 2a7:	89 e5                	mov    %esp,%ebp
+ 2a9:	57                   	push   %edi
+ 2aa:	56                   	push   %esi
+ 2ab:	53                   	push   %ebx
+ 2ac:	83 ec 1c             	sub    $0x1c,%esp
+ 2af:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 2b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 2b7:	89 de                	mov    %ebx,%esi
+ 2b9:	83 c3 01             	add    $0x1,%ebx
+ 2bc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2bf:	7d 2e                	jge    2ef <gets+0x49>
+    cc = read(0, &c, 1);
+ 2c1:	83 ec 04             	sub    $0x4,%esp
+ 2c4:	6a 01                	push   $0x1
+ 2c6:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 2c9:	50                   	push   %eax
+ 2ca:	6a 00                	push   $0x0
+ 2cc:	e8 ec 00 00 00       	call   3bd <read>
+    if(cc < 1)
+ 2d1:	83 c4 10             	add    $0x10,%esp
+ 2d4:	85 c0                	test   %eax,%eax
+ 2d6:	7e 17                	jle    2ef <gets+0x49>
+      break;
+    buf[i++] = c;
+ 2d8:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2dc:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 2df:	3c 0a                	cmp    $0xa,%al
+ 2e1:	0f 94 c2             	sete   %dl
+ 2e4:	3c 0d                	cmp    $0xd,%al
+ 2e6:	0f 94 c0             	sete   %al
+ 2e9:	08 c2                	or     %al,%dl
+ 2eb:	74 ca                	je     2b7 <gets+0x11>
+    buf[i++] = c;
+ 2ed:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 2ef:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 2f3:	89 f8                	mov    %edi,%eax
+ 2f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2f8:	5b                   	pop    %ebx
+ 2f9:	5e                   	pop    %esi
+ 2fa:	5f                   	pop    %edi
+ 2fb:	5d                   	pop    %ebp
+ 2fc:	c3                   	ret
+
+000002fd <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2fd:	55                   	push   %ebp
+ 2fe:	89 e5                	mov    %esp,%ebp
+ 300:	56                   	push   %esi
+ 301:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 302:	83 ec 08             	sub    $0x8,%esp
+ 305:	6a 00                	push   $0x0
+ 307:	ff 75 08             	push   0x8(%ebp)
+ 30a:	e8 d6 00 00 00       	call   3e5 <open>
+  if(fd < 0)
+ 30f:	83 c4 10             	add    $0x10,%esp
+ 312:	85 c0                	test   %eax,%eax
+ 314:	78 24                	js     33a <stat+0x3d>
+ 316:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 318:	83 ec 08             	sub    $0x8,%esp
+ 31b:	ff 75 0c             	push   0xc(%ebp)
+ 31e:	50                   	push   %eax
+ 31f:	e8 d9 00 00 00       	call   3fd <fstat>
+ 324:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 326:	89 1c 24             	mov    %ebx,(%esp)
+ 329:	e8 9f 00 00 00       	call   3cd <close>
+  return r;
+ 32e:	83 c4 10             	add    $0x10,%esp
+}
+ 331:	89 f0                	mov    %esi,%eax
+ 333:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 336:	5b                   	pop    %ebx
+ 337:	5e                   	pop    %esi
+ 338:	5d                   	pop    %ebp
+ 339:	c3                   	ret
+    return -1;
+ 33a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 33f:	eb f0                	jmp    331 <stat+0x34>
+
+00000341 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 341:	55                   	push   %ebp
+ 342:	89 e5                	mov    %esp,%ebp
+ 344:	53                   	push   %ebx
+ 345:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+ 348:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+ 34d:	eb 10                	jmp    35f <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+ 34f:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+ 352:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+ 355:	83 c1 01             	add    $0x1,%ecx
+ 358:	0f be c0             	movsbl %al,%eax
+ 35b:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+ 35f:	0f b6 01             	movzbl (%ecx),%eax
+ 362:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 365:	80 fb 09             	cmp    $0x9,%bl
+ 368:	76 e5                	jbe    34f <atoi+0xe>
+  return n;
+}
+ 36a:	89 d0                	mov    %edx,%eax
+ 36c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 36f:	c9                   	leave
+ 370:	c3                   	ret
+
+00000371 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 371:	55                   	push   %ebp
+ 372:	89 e5                	mov    %esp,%ebp
+ 374:	56                   	push   %esi
+ 375:	53                   	push   %ebx
+ 376:	8b 75 08             	mov    0x8(%ebp),%esi
+ 379:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 37c:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 37f:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 381:	eb 0d                	jmp    390 <memmove+0x1f>
+    *dst++ = *src++;
+ 383:	0f b6 01             	movzbl (%ecx),%eax
+ 386:	88 02                	mov    %al,(%edx)
+ 388:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 38b:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 38e:	89 d8                	mov    %ebx,%eax
+ 390:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 393:	85 c0                	test   %eax,%eax
+ 395:	7f ec                	jg     383 <memmove+0x12>
+  return vdst;
+}
+ 397:	89 f0                	mov    %esi,%eax
+ 399:	5b                   	pop    %ebx
+ 39a:	5e                   	pop    %esi
+ 39b:	5d                   	pop    %ebp
+ 39c:	c3                   	ret
+
+0000039d <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 39d:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3a2:	cd 40                	int    $0x40
+ 3a4:	c3                   	ret
+
+000003a5 <exit>:
+SYSCALL(exit)
+ 3a5:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3aa:	cd 40                	int    $0x40
+ 3ac:	c3                   	ret
+
+000003ad <wait>:
+SYSCALL(wait)
+ 3ad:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3b2:	cd 40                	int    $0x40
+ 3b4:	c3                   	ret
+
+000003b5 <pipe>:
+SYSCALL(pipe)
+ 3b5:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3ba:	cd 40                	int    $0x40
+ 3bc:	c3                   	ret
+
+000003bd <read>:
+SYSCALL(read)
+ 3bd:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3c2:	cd 40                	int    $0x40
+ 3c4:	c3                   	ret
+
+000003c5 <write>:
+SYSCALL(write)
+ 3c5:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3ca:	cd 40                	int    $0x40
+ 3cc:	c3                   	ret
+
+000003cd <close>:
+SYSCALL(close)
+ 3cd:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3d2:	cd 40                	int    $0x40
+ 3d4:	c3                   	ret
+
+000003d5 <kill>:
+SYSCALL(kill)
+ 3d5:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3da:	cd 40                	int    $0x40
+ 3dc:	c3                   	ret
+
+000003dd <exec>:
+SYSCALL(exec)
+ 3dd:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3e2:	cd 40                	int    $0x40
+ 3e4:	c3                   	ret
+
+000003e5 <open>:
+SYSCALL(open)
+ 3e5:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3ea:	cd 40                	int    $0x40
+ 3ec:	c3                   	ret
+
+000003ed <mknod>:
+SYSCALL(mknod)
+ 3ed:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3f2:	cd 40                	int    $0x40
+ 3f4:	c3                   	ret
+
+000003f5 <unlink>:
+SYSCALL(unlink)
+ 3f5:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3fa:	cd 40                	int    $0x40
+ 3fc:	c3                   	ret
+
+000003fd <fstat>:
+SYSCALL(fstat)
+ 3fd:	b8 08 00 00 00       	mov    $0x8,%eax
+ 402:	cd 40                	int    $0x40
+ 404:	c3                   	ret
+
+00000405 <link>:
+SYSCALL(link)
+ 405:	b8 13 00 00 00       	mov    $0x13,%eax
+ 40a:	cd 40                	int    $0x40
+ 40c:	c3                   	ret
+
+0000040d <mkdir>:
+SYSCALL(mkdir)
+ 40d:	b8 14 00 00 00       	mov    $0x14,%eax
+ 412:	cd 40                	int    $0x40
+ 414:	c3                   	ret
+
+00000415 <chdir>:
+SYSCALL(chdir)
+ 415:	b8 09 00 00 00       	mov    $0x9,%eax
+ 41a:	cd 40                	int    $0x40
+ 41c:	c3                   	ret
+
+0000041d <dup>:
+SYSCALL(dup)
+ 41d:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 422:	cd 40                	int    $0x40
+ 424:	c3                   	ret
+
+00000425 <getpid>:
+SYSCALL(getpid)
+ 425:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 42a:	cd 40                	int    $0x40
+ 42c:	c3                   	ret
+
+0000042d <sbrk>:
+SYSCALL(sbrk)
+ 42d:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 432:	cd 40                	int    $0x40
+ 434:	c3                   	ret
+
+00000435 <sleep>:
+SYSCALL(sleep)
+ 435:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 43a:	cd 40                	int    $0x40
+ 43c:	c3                   	ret
+
+0000043d <uptime>:
+SYSCALL(uptime)
+ 43d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 442:	cd 40                	int    $0x40
+ 444:	c3                   	ret
+
+00000445 <setpri>:
+SYSCALL(setpri)
+ 445:	b8 16 00 00 00       	mov    $0x16,%eax
+ 44a:	cd 40                	int    $0x40
+ 44c:	c3                   	ret
+
+0000044d <getpri>:
+SYSCALL(getpri)
+ 44d:	b8 17 00 00 00       	mov    $0x17,%eax
+ 452:	cd 40                	int    $0x40
+ 454:	c3                   	ret
+
+00000455 <fork2>:
+SYSCALL(fork2)
+ 455:	b8 18 00 00 00       	mov    $0x18,%eax
+ 45a:	cd 40                	int    $0x40
+ 45c:	c3                   	ret
+
+0000045d <getpinfo>:
+SYSCALL(getpinfo)
+ 45d:	b8 19 00 00 00       	mov    $0x19,%eax
+ 462:	cd 40                	int    $0x40
+ 464:	c3                   	ret
+
+00000465 <spawn>:
+SYSCALL(spawn)
+ 465:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 46a:	cd 40                	int    $0x40
+ 46c:	c3                   	ret
+
+0000046d <spawnn>:
+SYSCALL(spawnn)
+ 46d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 472:	cd 40                	int    $0x40
+ 474:	c3                   	ret
+
+00000475 <kmstat>:
+SYSCALL(kmstat)
+ 475:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 47a:	cd 40                	int    $0x40
+ 47c:	c3                   	ret
+
+0000047d <slabstat>:
+SYSCALL(slabstat)
+ 47d:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 482:	cd 40                	int    $0x40
+ 484:	c3                   	ret
+
+00000485 <shmget>:
+SYSCALL(shmget)
+ 485:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 48a:	cd 40                	int    $0x40
+ 48c:	c3                   	ret
+
+0000048d <shmat>:
+SYSCALL(shmat)
+ 48d:	b8 20 00 00 00       	mov    $0x20,%eax
+ 492:	cd 40                	int    $0x40
+ 494:	c3                   	ret
+
+00000495 <shmdt>:
+SYSCALL(shmdt)
+ 495:	b8 21 00 00 00       	mov    $0x21,%eax
+ 49a:	cd 40                	int    $0x40
+ 49c:	c3                   	ret
+
+0000049d <mmap>:
+SYSCALL(mmap)
+ 49d:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4a2:	cd 40                	int    $0x40
+ 4a4:	c3                   	ret
+
+000004a5 <munmap>:
+SYSCALL(munmap)
+ 4a5:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4aa:	cd 40                	int    $0x40
+ 4ac:	c3                   	ret
+
+000004ad <bstat>:
+SYSCALL(bstat)
+ 4ad:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4b2:	cd 40                	int    $0x40
+ 4b4:	c3                   	ret
+
+000004b5 <aread>:
+SYSCALL(aread)
+ 4b5:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4ba:	cd 40                	int    $0x40
+ 4bc:	c3                   	ret
+
+000004bd <await>:
+SYSCALL(await)
+ 4bd:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4c2:	cd 40                	int    $0x40
+ 4c4:	c3                   	ret
+
+000004c5 <bdrop>:
+SYSCALL(bdrop)
+ 4c5:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4ca:	cd 40                	int    $0x40
+ 4cc:	c3                   	ret
+
+000004cd <vfork>:
+# exec or exit, and its ret would leave the slot holding our
+# return address free for it to overwrite.  Keep the return
+# address in %ecx, which the kernel restores for both sides.
+.globl vfork
+vfork:
+  popl %ecx
+ 4cd:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+ 4ce:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  int $T_SYSCALL
+ 4d3:	cd 40                	int    $0x40
+  pushl %ecx
+ 4d5:	51                   	push   %ecx
+  ret
+ 4d6:	c3                   	ret
+
+000004d7 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 4d7:	55                   	push   %ebp
+ 4d8:	89 e5                	mov    %esp,%ebp
+ 4da:	83 ec 1c             	sub    $0x1c,%esp
+ 4dd:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 4e0:	6a 01                	push   $0x1
+ 4e2:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 4e5:	52                   	push   %edx
+ 4e6:	50                   	push   %eax
+ 4e7:	e8 d9 fe ff ff       	call   3c5 <write>
+}
+ 4ec:	83 c4 10             	add    $0x10,%esp
+ 4ef:	c9                   	leave
+ 4f0:	c3                   	ret
+
+000004f1 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4f1:	55                   	push   %ebp
+ 4f2:	89 e5                	mov    %esp,%ebp
+ 4f4:	57                   	push   %edi
+ 4f5:	56                   	push   %esi
+ 4f6:	53                   	push   %ebx
+ 4f7:	83 ec 2c             	sub    $0x2c,%esp
+ 4fa:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 4fd:	89 d0                	mov    %edx,%eax
+ 4ff:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 501:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 505:	0f 95 c1             	setne  %cl
+ 508:	c1 ea 1f             	shr    $0x1f,%edx
+ 50b:	84 d1                	test   %dl,%cl
+ 50d:	74 44                	je     553 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 50f:	f7 d8                	neg    %eax
+ 511:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 513:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 51a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 51f:	89 c8                	mov    %ecx,%eax
+ 521:	ba 00 00 00 00       	mov    $0x0,%edx
+ 526:	f7 f6                	div    %esi
+ 528:	89 df                	mov    %ebx,%edi
+ 52a:	83 c3 01             	add    $0x1,%ebx
+ 52d:	0f b6 92 68 09 00 00 	movzbl 0x968(%edx),%edx
+ 534:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 538:	89 ca                	mov    %ecx,%edx
+ 53a:	89 c1                	mov    %eax,%ecx
+ 53c:	39 f2                	cmp    %esi,%edx
+ 53e:	73 df                	jae    51f <printint+0x2e>
+  if(neg)
+ 540:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 544:	74 31                	je     577 <printint+0x86>
+    buf[i++] = '-';
+ 546:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 54b:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 54e:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 551:	eb 17                	jmp    56a <printint+0x79>
+    x = xx;
+ 553:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 555:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 55c:	eb bc                	jmp    51a <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 55e:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 563:	89 f0                	mov    %esi,%eax
+ 565:	e8 6d ff ff ff       	call   4d7 <putc>
+  while(--i >= 0)
+ 56a:	83 eb 01             	sub    $0x1,%ebx
+ 56d:	79 ef                	jns    55e <printint+0x6d>
+}
+ 56f:	83 c4 2c             	add    $0x2c,%esp
+ 572:	5b                   	pop    %ebx
+ 573:	5e                   	pop    %esi
+ 574:	5f                   	pop    %edi
+ 575:	5d                   	pop    %ebp
+ 576:	c3                   	ret
+ 577:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 57a:	eb ee                	jmp    56a <printint+0x79>
+
+0000057c <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 57c:	55                   	push   %ebp
+ 57d:	89 e5                	mov    %esp,%ebp
+ 57f:	57                   	push   %edi
+ 580:	56                   	push   %esi
+ 581:	53                   	push   %ebx
+ 582:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 585:	8d 45 10             	lea    0x10(%ebp),%eax
+ 588:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 58b:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 590:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 595:	eb 14                	jmp    5ab <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 597:	89 fa                	mov    %edi,%edx
+ 599:	8b 45 08             	mov    0x8(%ebp),%eax
+ 59c:	e8 36 ff ff ff       	call   4d7 <putc>
+ 5a1:	eb 05                	jmp    5a8 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 5a3:	83 fe 25             	cmp    $0x25,%esi
+ 5a6:	74 25                	je     5cd <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 5a8:	83 c3 01             	add    $0x1,%ebx
+ 5ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5ae:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 5b2:	84 c0                	test   %al,%al
+ 5b4:	0f 84 20 01 00 00    	je     6da <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 5ba:	0f be f8             	movsbl %al,%edi
+ 5bd:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 5c0:	85 f6                	test   %esi,%esi
+ 5c2:	75 df                	jne    5a3 <printf+0x27>
+      if(c == '%'){
+ 5c4:	83 f8 25             	cmp    $0x25,%eax
+ 5c7:	75 ce                	jne    597 <printf+0x1b>
+        state = '%';
+ 5c9:	89 c6                	mov    %eax,%esi
+ 5cb:	eb db                	jmp    5a8 <printf+0x2c>
+      if(c == 'd'){
+ 5cd:	83 f8 25             	cmp    $0x25,%eax
+ 5d0:	0f 84 cf 00 00 00    	je     6a5 <printf+0x129>
+ 5d6:	0f 8c dd 00 00 00    	jl     6b9 <printf+0x13d>
+ 5dc:	83 f8 78             	cmp    $0x78,%eax
+ 5df:	0f 8f d4 00 00 00    	jg     6b9 <printf+0x13d>
+ 5e5:	83 f8 63             	cmp    $0x63,%eax
+ 5e8:	0f 8c cb 00 00 00    	jl     6b9 <printf+0x13d>
+ 5ee:	83 e8 63             	sub    $0x63,%eax
+ 5f1:	83 f8 15             	cmp    $0x15,%eax
+ 5f4:	0f 87 bf 00 00 00    	ja     6b9 <printf+0x13d>
+ 5fa:	ff 24 85 10 09 00 00 	jmp    *0x910(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 601:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 604:	8b 17                	mov    (%edi),%edx
+ 606:	83 ec 0c             	sub    $0xc,%esp
+ 609:	6a 01                	push   $0x1
+ 60b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 610:	8b 45 08             	mov    0x8(%ebp),%eax
+ 613:	e8 d9 fe ff ff       	call   4f1 <printint>
+        ap++;
+ 618:	83 c7 04             	add    $0x4,%edi
+ 61b:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 61e:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 621:	be 00 00 00 00       	mov    $0x0,%esi
+ 626:	eb 80                	jmp    5a8 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 628:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 62b:	8b 17                	mov    (%edi),%edx
+ 62d:	83 ec 0c             	sub    $0xc,%esp
+ 630:	6a 00                	push   $0x0
+ 632:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 637:	8b 45 08             	mov    0x8(%ebp),%eax
+ 63a:	e8 b2 fe ff ff       	call   4f1 <printint>
+        ap++;
+ 63f:	83 c7 04             	add    $0x4,%edi
+ 642:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 645:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 648:	be 00 00 00 00       	mov    $0x0,%esi
+ 64d:	e9 56 ff ff ff       	jmp    5a8 <printf+0x2c>
+        s = (char*)*ap;
+ 652:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 655:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 657:	83 c0 04             	add    $0x4,%eax
+ 65a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 65d:	85 f6                	test   %esi,%esi
+ 65f:	75 15                	jne    676 <printf+0xfa>
+          s = "(null)";
+ 661:	be 07 09 00 00       	mov    $0x907,%esi
+ 666:	eb 0e                	jmp    676 <printf+0xfa>
+          putc(fd, *s);
+ 668:	0f be d2             	movsbl %dl,%edx
+ 66b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 66e:	e8 64 fe ff ff       	call   4d7 <putc>
+          s++;
+ 673:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 676:	0f b6 16             	movzbl (%esi),%edx
+ 679:	84 d2                	test   %dl,%dl
+ 67b:	75 eb                	jne    668 <printf+0xec>
+      state = 0;
+ 67d:	be 00 00 00 00       	mov    $0x0,%esi
+ 682:	e9 21 ff ff ff       	jmp    5a8 <printf+0x2c>
+        putc(fd, *ap);
+ 687:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 68a:	0f be 17             	movsbl (%edi),%edx
+ 68d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 690:	e8 42 fe ff ff       	call   4d7 <putc>
+        ap++;
+ 695:	83 c7 04             	add    $0x4,%edi
+ 698:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 69b:	be 00 00 00 00       	mov    $0x0,%esi
+ 6a0:	e9 03 ff ff ff       	jmp    5a8 <printf+0x2c>
+        putc(fd, c);
+ 6a5:	89 fa                	mov    %edi,%edx
+ 6a7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6aa:	e8 28 fe ff ff       	call   4d7 <putc>
+      state = 0;
+ 6af:	be 00 00 00 00       	mov    $0x0,%esi
+ 6b4:	e9 ef fe ff ff       	jmp    5a8 <printf+0x2c>
+        putc(fd, '%');
+ 6b9:	ba 25 00 00 00       	mov    $0x25,%edx
+ 6be:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6c1:	e8 11 fe ff ff       	call   4d7 <putc>
+        putc(fd, c);
+ 6c6:	89 fa                	mov    %edi,%edx
+ 6c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6cb:	e8 07 fe ff ff       	call   4d7 <putc>
+      state = 0;
+ 6d0:	be 00 00 00 00       	mov    $0x0,%esi
+ 6d5:	e9 ce fe ff ff       	jmp    5a8 <printf+0x2c>
+    }
+  }
+}
+ 6da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6dd:	5b                   	pop    %ebx
+ 6de:	5e                   	pop    %esi
+ 6df:	5f                   	pop    %edi
+ 6e0:	5d                   	pop    %ebp
+ 6e1:	c3                   	ret
+
+000006e2 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6e2:	55                   	push   %ebp
+ 6e3:	89 e5                	mov    %esp,%ebp
+ 6e5:	57                   	push   %edi
+ 6e6:	56                   	push   %esi
+ 6e7:	53                   	push   %ebx
+ 6e8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 6eb:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6ee:	a1 80 0e 00 00       	mov    0xe80,%eax
+ 6f3:	eb 02                	jmp    6f7 <free+0x15>
+ 6f5:	89 d0                	mov    %edx,%eax
+ 6f7:	39 c8                	cmp    %ecx,%eax
+ 6f9:	73 04                	jae    6ff <free+0x1d>
+ 6fb:	3b 08                	cmp    (%eax),%ecx
+ 6fd:	72 12                	jb     711 <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6ff:	8b 10                	mov    (%eax),%edx
+ 701:	39 d0                	cmp    %edx,%eax
+ 703:	72 f0                	jb     6f5 <free+0x13>
+ 705:	39 c8                	cmp    %ecx,%eax
+ 707:	72 08                	jb     711 <free+0x2f>
+ 709:	39 d1                	cmp    %edx,%ecx
+ 70b:	72 04                	jb     711 <free+0x2f>
+ 70d:	89 d0                	mov    %edx,%eax
+ 70f:	eb e6                	jmp    6f7 <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 711:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 714:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 717:	8b 10                	mov    (%eax),%edx
+ 719:	39 d7                	cmp    %edx,%edi
+ 71b:	74 19                	je     736 <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 71d:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 720:	8b 50 04             	mov    0x4(%eax),%edx
+ 723:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 726:	39 ce                	cmp    %ecx,%esi
+ 728:	74 1b                	je     745 <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 72a:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 72c:	a3 80 0e 00 00       	mov    %eax,0xe80
+}
+ 731:	5b                   	pop    %ebx
+ 732:	5e                   	pop    %esi
+ 733:	5f                   	pop    %edi
+ 734:	5d                   	pop    %ebp
+ 735:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 736:	03 72 04             	add    0x4(%edx),%esi
+ 739:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 73c:	8b 10                	mov    (%eax),%edx
+ 73e:	8b 12                	mov    (%edx),%edx
+ 740:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 743:	eb db                	jmp    720 <free+0x3e>
+    p->s.size += bp->s.size;
+ 745:	03 53 fc             	add    -0x4(%ebx),%edx
+ 748:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 74b:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 74e:	89 10                	mov    %edx,(%eax)
+ 750:	eb da                	jmp    72c <free+0x4a>
+
+00000752 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 752:	55                   	push   %ebp
+ 753:	89 e5                	mov    %esp,%ebp
+ 755:	53                   	push   %ebx
+ 756:	83 ec 04             	sub    $0x4,%esp
+ 759:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 75b:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 760:	77 05                	ja     767 <morecore+0x15>
+    nu = 4096;
+ 762:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 767:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 76e:	83 ec 0c             	sub    $0xc,%esp
+ 771:	50                   	push   %eax
+ 772:	e8 b6 fc ff ff       	call   42d <sbrk>
+  if(p == (char*)-1)
+ 777:	83 c4 10             	add    $0x10,%esp
+ 77a:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 77d:	74 1c                	je     79b <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 77f:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 782:	83 c0 08             	add    $0x8,%eax
+ 785:	83 ec 0c             	sub    $0xc,%esp
+ 788:	50                   	push   %eax
+ 789:	e8 54 ff ff ff       	call   6e2 <free>
+  return freep;
+ 78e:	a1 80 0e 00 00       	mov    0xe80,%eax
+ 793:	83 c4 10             	add    $0x10,%esp
+}
+ 796:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 799:	c9                   	leave
+ 79a:	c3                   	ret
+    return 0;
+ 79b:	b8 00 00 00 00       	mov    $0x0,%eax
+ 7a0:	eb f4                	jmp    796 <morecore+0x44>
+
+000007a2 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 7a2:	55                   	push   %ebp
+ 7a3:	89 e5                	mov    %esp,%ebp
+ 7a5:	53                   	push   %ebx
+ 7a6:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7a9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7ac:	8d 58 07             	lea    0x7(%eax),%ebx
+ 7af:	c1 eb 03             	shr    $0x3,%ebx
+ 7b2:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 7b5:	8b 0d 80 0e 00 00    	mov    0xe80,%ecx
+ 7bb:	85 c9                	test   %ecx,%ecx
+ 7bd:	74 04                	je     7c3 <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7bf:	8b 01                	mov    (%ecx),%eax
+ 7c1:	eb 4a                	jmp    80d <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 7c3:	c7 05 80 0e 00 00 84 	movl   $0xe84,0xe80
+ 7ca:	0e 00 00 
+ 7cd:	c7 05 84 0e 00 00 84 	movl   $0xe84,0xe84
+ 7d4:	0e 00 00 
+    base.s.size = 0;
+ 7d7:	c7 05 88 0e 00 00 00 	movl   $0x0,0xe88
+ 7de:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 7e1:	b9 84 0e 00 00       	mov    $0xe84,%ecx
+ 7e6:	eb d7                	jmp    7bf <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 7e8:	74 19                	je     803 <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 7ea:	29 da                	sub    %ebx,%edx
+ 7ec:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 7ef:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 7f2:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 7f5:	89 0d 80 0e 00 00    	mov    %ecx,0xe80
+      return (void*)(p + 1);
+ 7fb:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 7fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 801:	c9                   	leave
+ 802:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 803:	8b 10                	mov    (%eax),%edx
+ 805:	89 11                	mov    %edx,(%ecx)
+ 807:	eb ec                	jmp    7f5 <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 809:	89 c1                	mov    %eax,%ecx
+ 80b:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 80d:	8b 50 04             	mov    0x4(%eax),%edx
+ 810:	39 da                	cmp    %ebx,%edx
+ 812:	73 d4                	jae    7e8 <malloc+0x46>
+    if(p == freep)
+ 814:	39 05 80 0e 00 00    	cmp    %eax,0xe80
+ 81a:	75 ed                	jne    809 <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 81c:	89 d8                	mov    %ebx,%eax
+ 81e:	e8 2f ff ff ff       	call   752 <morecore>
+ 823:	85 c0                	test   %eax,%eax
+ 825:	75 e2                	jne    809 <malloc+0x67>
+ 827:	eb d5                	jmp    7fe <malloc+0x5c>
@@ -0,0 +1,87 @@
+// Measure disk throughput with several concurrent readers.
+// Each of NREADER processes reads its own NBLOCK-block file
+// sequentially, starting with nothing cached, so their
+// read-ahead requests interleave at the disk; the disk
+// scheduler should serve them in block order rather than
+// seeking back and forth between the files.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "fs.h"
+
+#define NREADER 4
+#define NBLOCK  64
+
+char buf[BSIZE];
+
+void
+mkfile(char *name)
+{
+  int fd, i;
+
+  if((fd = open(name, O_CREATE|O_RDWR)) < 0){
+    printf(1, "iobench: create %s failed\n", name);
+    exit();
+  }
+  for(i = 0; i < NBLOCK; i++){
+    if(write(fd, buf, BSIZE) != BSIZE){
+      printf(1, "iobench: write %s failed\n", name);
+      exit();
+    }
+  }
+  close(fd);
+}
+
+void
+readfile(char *name)
+{
+  int fd, n;
+
+  if((fd = open(name, O_RDONLY)) < 0){
+    printf(1, "iobench: open %s failed\n", name);
+    exit();
+  }
+  n = 0;
+  while(read(fd, buf, BSIZE) == BSIZE)
+    n++;
+  if(n != NBLOCK)
+    printf(1, "iobench: %s: read %d blocks\n", name, n);
+  close(fd);
+}
+
+int
+main(int argc, char *argv[])
+{
+  char name[] = "iobench0";
+  int i, t0, t1;
+
+  for(i = 0; i < NREADER; i++){
+    name[7] = '0' + i;
+    mkfile(name);
+  }
+
+  if(bdrop() < 0)
+    printf(1, "iobench: bdrop disabled, files may be cached; build with -DBDROP\n");
+  t0 = uptime();
+  for(i = 0; i < NREADER; i++){
+    name[7] = '0' + i;
+    if(fork() == 0){
+      readfile(name);
+      exit();
+    }
+  }
+  for(i = 0; i < NREADER; i++)
+    wait();
+  t1 = uptime();
+
+  printf(1, "iobench: %d readers x %d blocks: %d ticks\n",
+         NREADER, NBLOCK, t1 - t0);
+
+  for(i = 0; i < NREADER; i++){
+    name[7] = '0' + i;
+    unlink(name);
+  }
+  exit();
+}
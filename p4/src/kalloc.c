@@ -1,6 +1,13 @@
 // Physical memory allocator, intended to allocate
 // memory for user processes, kernel stacks, page table pages,
-// and pipe buffers. Allocates 4096-byte pages.
+// and pipe buffers. Allocates 4096-byte pages, and with
+// kalloc_order() physically contiguous blocks of 2^order pages.
+//
+// Free memory is kept by a buddy allocator: kmem.free[o] lists
+// free blocks of 2^o pages, each aligned to its own size.  A
+// block's buddy is the block it was split from or would merge
+// with; freeing a block whose buddy is also free merges the
+// two into one block of the next order.
 
 #include "types.h"
 #include "defs.h"
@@ -8,30 +15,94 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "spinlock.h"
+#include "proc.h"
+#include "kmstat.h"
 
 void freerange(void *vstart, void *vend);
+static char* kzeroget(void);
 extern char end[]; // first address after kernel loaded from ELF file
                    // defined by the kernel linker script in kernel.ld
 
 struct run {
   struct run *next;
+  struct run *prev;  // only used on the buddy free lists
 };
 
+#define KFREE 0x80  // kmem.order flag: page heads a free block
+
+uint phystop;  // top of usable physical memory, set by kinit1()
+
+// The per-page arrays are sized to phystop at boot and
+// placed at the start of the memory given to kinit1().
 struct {
   struct spinlock lock;
   int use_lock;
-  struct run *freelist;
+  struct run *free[MAXORDER+1];  // free blocks of each order
+  int nblock[MAXORDER+1];        // # of blocks on each free list
+  int nfree;                     // # of pages on the free lists
+  int npage;                     // # of pages given to the allocator
+  uchar *order;                  // KFREE|order for free block heads
+  ushort *ref;                   // # of page tables etc. sharing each page
 } kmem;
 
+// Each CPU keeps a small cache of free pages so that most
+// kalloc() and kfree() calls don't touch kmem.lock.  A cache
+// that runs dry is refilled from the buddy lists KBATCH pages
+// at a time, and one that fills up drains KBATCH pages back.
+// The per-cache lock is only contended when another CPU has
+// run out of memory and comes to steal pages.
+#define KCACHE 64
+#define KBATCH 32
+
+struct kcache {
+  struct spinlock lock;
+  struct run *freelist;
+  int n;
+  uint allocs, hits, frees, refills, drains;
+} kcache[NCPU];
+
+// Pages that have already been zeroed, for kalloc_zeroed().
+// The scheduler tops the pool up when a CPU has nothing to run.
+// Pages in the pool count as allocated (reference count 1).
+#define KZERO 256
+
+struct {
+  struct spinlock lock;
+  struct run *freelist;
+  int n;
+  uint hits, misses;  // approximate; updated without the lock
+} kzero;
+
 // Initialization happens in two phases.
 // 1. main() calls kinit1() while still using entrypgdir to place just
 // the pages mapped by entrypgdir on free list.
 // 2. main() calls kinit2() with the rest of the physical pages
 // after installing a full page table that maps them on all cores.
+// kinit1() also finds out how much memory there is and carves
+// the per-page arrays out of the start of [vstart, vend).
 void
 kinit1(void *vstart, void *vend)
 {
+  struct kcache *c;
+  uint n;
+
+  phystop = PGROUNDDOWN(cmosmemtop());
+  if(phystop > PHYSMAX)
+    phystop = PHYSMAX;
+  if(phystop < V2P(vend))
+    panic("kinit1: not enough memory");
+  n = phystop / PGSIZE;
+  kmem.ref = (ushort*)vstart;
+  kmem.order = (uchar*)(kmem.ref + n);
+  vstart = kmem.order + n;
+  if(vstart >= vend)
+    panic("kinit1: page arrays");
+  memset(kmem.ref, 0, n*sizeof(kmem.ref[0]) + n*sizeof(kmem.order[0]));
+
   initlock(&kmem.lock, "kmem");
+  initlock(&kzero.lock, "kzero");
+  for(c = kcache; c < &kcache[NCPU]; c++)
+    initlock(&c->lock, "kcache");
   kmem.use_lock = 0;
   freerange(vstart, vend);
 }
@@ -48,31 +119,165 @@ freerange(void *vstart, void *vend)
 {
   char *p;
   p = (char*)PGROUNDUP((uint)vstart);
-  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+    kmem.npage++;
     kfree(p);
+  }
+}
+
+// Buddy free list operations.  Caller must hold kmem.lock
+// (or be initializing, with use_lock still 0).
+
+static void
+bpush(struct run *r, int o)
+{
+  r->prev = 0;
+  r->next = kmem.free[o];
+  if(r->next)
+    r->next->prev = r;
+  kmem.free[o] = r;
+  kmem.nblock[o]++;
+  kmem.order[V2P(r)/PGSIZE] = KFREE | o;
+}
+
+static void
+bremove(struct run *r, int o)
+{
+  if(r->prev)
+    r->prev->next = r->next;
+  else
+    kmem.free[o] = r->next;
+  if(r->next)
+    r->next->prev = r->prev;
+  kmem.nblock[o]--;
+  kmem.order[V2P(r)/PGSIZE] = 0;
+}
+
+// Take a block of 2^o pages off the free lists, splitting
+// a larger block if there is no block of that order.
+static struct run*
+buddyalloc(int o)
+{
+  struct run *r;
+  int k;
+
+  for(k = o; k <= MAXORDER && kmem.free[k] == 0; k++)
+    ;
+  if(k > MAXORDER)
+    return 0;
+  r = kmem.free[k];
+  bremove(r, k);
+  // Give back the upper half until the block is small enough.
+  while(k > o){
+    k--;
+    bpush((struct run*)((char*)r + (PGSIZE << k)), k);
+  }
+  kmem.nfree -= 1 << o;
+  return r;
+}
+
+// Put a block of 2^o pages back, merging it with its buddy
+// for as long as the buddy is free too.
+static void
+buddyfree(struct run *r, int o)
+{
+  uint i, b;
+
+  kmem.nfree += 1 << o;
+  i = V2P(r)/PGSIZE;
+  for(; o < MAXORDER; o++){
+    b = i ^ (1 << o);
+    if(b >= phystop/PGSIZE || kmem.order[b] != (KFREE | o))
+      break;
+    bremove((struct run*)P2V(b*PGSIZE), o);
+    if(b < i)
+      i = b;
+  }
+  bpush((struct run*)P2V(i*PGSIZE), o);
 }
 // Free the page of physical memory pointed at by v,
 // which normally should have been returned by a
 // call to kalloc().  (The exception is when
 // initializing the allocator; see kinit above.)
+// A page shared with kdup() is only put back on the
+// free list when its last reference is dropped.
 void
 kfree(char *v)
 {
   struct run *r;
+  struct kcache *c;
+  ushort *ref;
+  int i;
 
-  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+  if((uint)v % PGSIZE || v < end || V2P(v) >= phystop)
     panic("kfree");
 
+  // A count of 1 means the caller holds the only reference,
+  // so nobody else can be changing it and we can skip the lock.
+  ref = &kmem.ref[V2P(v)/PGSIZE];
+  if(*ref > 1){
+    if(kmem.use_lock)
+      acquire(&kmem.lock);
+    if(*ref > 1){
+      (*ref)--;
+      if(kmem.use_lock)
+        release(&kmem.lock);
+      return;
+    }
+    if(kmem.use_lock)
+      release(&kmem.lock);
+  }
+  *ref = 0;
+
+#ifdef KJUNK
   // Fill with junk to catch dangling refs.
   memset(v, 1, PGSIZE);
+#endif
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
   r = (struct run*)v;
-  r->next = kmem.freelist;
-  kmem.freelist = r;
-  if(kmem.use_lock)
+  if(!kmem.use_lock){
+    buddyfree(r, 0);
+    return;
+  }
+
+  pushcli();
+  c = &kcache[cpuid()];
+  acquire(&c->lock);
+  r->next = c->freelist;
+  c->freelist = r;
+  c->n++;
+  c->frees++;
+  if(c->n >= KCACHE){
+    acquire(&kmem.lock);
+    for(i = 0; i < KBATCH; i++){
+      r = c->freelist;
+      c->freelist = r->next;
+      buddyfree(r, 0);
+    }
     release(&kmem.lock);
+    c->n -= KBATCH;
+    c->drains++;
+  }
+  release(&c->lock);
+  popcli();
+}
+
+// Move up to n pages from list *from to the cache c,
+// whose lock must be held.  Returns the number moved.
+static int
+kmove(struct kcache *c, struct run **from, int n)
+{
+  struct run *r;
+  int i;
+
+  for(i = 0; i < n && *from; i++){
+    r = *from;
+    *from = r->next;
+    r->next = c->freelist;
+    c->freelist = r;
+  }
+  c->n += i;
+  return i;
 }
 
 // Allocate one 4096-byte page of physical memory.
@@ -82,14 +287,276 @@ char*
 kalloc(void)
 {
   struct run *r;
+  struct kcache *c, *o;
+  int i, n;
+
+  if(!kmem.use_lock){
+    if((r = buddyalloc(0)) != 0)
+      kmem.ref[V2P(r)/PGSIZE] = 1;
+    return (char*)r;
+  }
 
-  if(kmem.use_lock)
+  pushcli();
+  c = &kcache[cpuid()];
+  acquire(&c->lock);
+  c->allocs++;
+  if(c->n > 0)
+    c->hits++;
+  else {
     acquire(&kmem.lock);
-  r = kmem.freelist;
-  if(r)
-    kmem.freelist = r->next;
-  if(kmem.use_lock)
+    for(i = 0; i < KBATCH && (r = buddyalloc(0)) != 0; i++){
+      r->next = c->freelist;
+      c->freelist = r;
+    }
+    c->n += i;
     release(&kmem.lock);
+    c->refills++;
+  }
+  if(c->n == 0){
+    // Out of memory except perhaps in other CPUs' caches.
+    // Never hold two cache locks at once.
+    release(&c->lock);
+    for(o = kcache; o < &kcache[ncpu]; o++){
+      if(o == c)
+        continue;
+      acquire(&o->lock);
+      n = o->n;
+      o->n = 0;
+      r = o->freelist;
+      o->freelist = 0;
+      release(&o->lock);
+      if(n > 0){
+        acquire(&c->lock);
+        if(kmove(c, &r, n) != n)
+          panic("kalloc: steal");
+        release(&c->lock);
+        break;
+      }
+    }
+    acquire(&c->lock);
+  }
+  r = c->freelist;
+  if(r){
+    c->freelist = r->next;
+    c->n--;
+    kmem.ref[V2P(r)/PGSIZE] = 1;
+  }
+  release(&c->lock);
+  popcli();
+  if(r == 0)
+    r = (struct run*)kzeroget();
   return (char*)r;
 }
 
+// Return every page in the per-CPU caches to the buddy
+// lists, so that they can merge into larger blocks.
+static void
+kdrainall(void)
+{
+  struct kcache *c;
+  struct run *r, *next;
+
+  for(c = kcache; c < &kcache[ncpu]; c++){
+    acquire(&c->lock);
+    r = c->freelist;
+    c->freelist = 0;
+    c->n = 0;
+    release(&c->lock);
+    acquire(&kmem.lock);
+    for(; r; r = next){
+      next = r->next;
+      buddyfree(r, 0);
+    }
+    release(&kmem.lock);
+  }
+}
+
+// Allocate 2^order physically contiguous pages, aligned
+// to their size.  Order 0 is the same as kalloc().
+// Returns 0 if no large enough block is free.
+char*
+kalloc_order(int order)
+{
+  struct run *r;
+  int i, tries;
+
+  if(order < 0 || order > MAXORDER)
+    return 0;
+  if(order == 0)
+    return kalloc();
+
+  r = 0;
+  for(tries = 0; tries < 2 && r == 0; tries++){
+    // Pages parked in per-CPU caches may be all that is
+    // keeping a large block from forming.
+    if(tries > 0)
+      kdrainall();
+    acquire(&kmem.lock);
+    r = buddyalloc(order);
+    release(&kmem.lock);
+  }
+  if(r)
+    for(i = 0; i < (1 << order); i++)
+      kmem.ref[V2P(r)/PGSIZE + i] = 1;
+  return (char*)r;
+}
+
+// Free a block returned by kalloc_order(order).
+// Large blocks can't be shared with kdup().
+void
+kfree_order(char *v, int order)
+{
+  int i;
+
+  if(order == 0){
+    kfree(v);
+    return;
+  }
+  if(order < 0 || order > MAXORDER || V2P(v) % (PGSIZE << order) ||
+     v < end || V2P(v) + (PGSIZE << order) > phystop)
+    panic("kfree_order");
+  for(i = 0; i < (1 << order); i++){
+    if(kmem.ref[V2P(v)/PGSIZE + i] != 1)
+      panic("kfree_order: ref");
+    kmem.ref[V2P(v)/PGSIZE + i] = 0;
+  }
+
+#ifdef KJUNK
+  memset(v, 1, PGSIZE << order);
+#endif
+
+  acquire(&kmem.lock);
+  buddyfree((struct run*)v, order);
+  release(&kmem.lock);
+}
+
+// Take a page from the pre-zeroed pool, or return 0.
+static char*
+kzeroget(void)
+{
+  struct run *r;
+
+  acquire(&kzero.lock);
+  r = kzero.freelist;
+  if(r){
+    kzero.freelist = r->next;
+    kzero.n--;
+  }
+  release(&kzero.lock);
+  if(r)
+    r->next = 0;
+  return (char*)r;
+}
+
+// Allocate one zero-filled page, preferably from the
+// pre-zeroed pool.  Returns 0 if out of memory.
+char*
+kalloc_zeroed(void)
+{
+  char *v;
+
+  if(kmem.use_lock && (v = kzeroget()) != 0){
+    kzero.hits++;
+    return v;
+  }
+  kzero.misses++;
+  if((v = kalloc()) != 0)
+    memset(v, 0, PGSIZE);
+  return v;
+}
+
+// Zero one page into the pool if it isn't full.
+// Called by the scheduler when it has nothing to run.
+void
+kzeroidle(void)
+{
+  struct run *r;
+
+  if(kzero.n >= KZERO || kmem.nfree == 0)
+    return;
+  if((r = (struct run*)kalloc()) == 0)
+    return;
+  memset(r, 0, PGSIZE);
+  acquire(&kzero.lock);
+  r->next = kzero.freelist;
+  kzero.freelist = r;
+  kzero.n++;
+  release(&kzero.lock);
+}
+
+// Add a reference to the allocated page v, which will
+// then survive one more kfree().  Used to share pages
+// copy-on-write between parent and child after fork.
+char*
+kdup(char *v)
+{
+  if((uint)v % PGSIZE || v < end || V2P(v) >= phystop)
+    panic("kdup");
+
+  acquire(&kmem.lock);
+  if(kmem.ref[V2P(v)/PGSIZE] < 1)
+    panic("kdup: free page");
+  kmem.ref[V2P(v)/PGSIZE]++;
+  release(&kmem.lock);
+  return v;
+}
+
+// Return the number of free pages, including those
+// sitting in the per-CPU caches and the zeroed pool.
+int
+kfreepages(void)
+{
+  int i, n;
+
+  n = kmem.nfree + kzero.n;
+  for(i = 0; i < ncpu; i++)
+    n += kcache[i].n;
+  return n;
+}
+
+// Return the number of references to page v.
+int
+krefcnt(char *v)
+{
+  int n;
+
+  acquire(&kmem.lock);
+  n = kmem.ref[V2P(v)/PGSIZE];
+  release(&kmem.lock);
+  return n;
+}
+
+// Copy the page allocator statistics into *st.
+int
+kmstat(struct kmstat *st)
+{
+  struct kcache *c;
+  int i;
+
+  memset(st, 0, sizeof(*st));
+  st->ncpu = ncpu;
+  st->nfree = kfreepages();
+  st->npage = kmem.npage;
+  st->phystop = phystop;
+  acquire(&kzero.lock);
+  st->zeroed = kzero.n;
+  st->zhits = kzero.hits;
+  st->zmisses = kzero.misses;
+  release(&kzero.lock);
+  acquire(&kmem.lock);
+  for(i = 0; i <= MAXORDER; i++)
+    st->nblock[i] = kmem.nblock[i];
+  release(&kmem.lock);
+  for(i = 0; i < ncpu; i++){
+    c = &kcache[i];
+    acquire(&c->lock);
+    st->cached[i] = c->n;
+    st->allocs[i] = c->allocs;
+    st->hits[i] = c->hits;
+    st->frees[i] = c->frees;
+    st->refills[i] = c->refills;
+    st->drains[i] = c->drains;
+    release(&c->lock);
+  }
+  return 0;
+}
@@ -0,0 +1,1329 @@
+
+_kallocbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <rand>:
+uint seed;
+
+uint
+rand(void)
+{
+  seed = seed * 1664525 + 1013904223;
+   0:	69 05 a0 0c 00 00 0d 	imul   $0x19660d,0xca0,%eax
+   7:	66 19 00 
+   a:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+   f:	a3 a0 0c 00 00       	mov    %eax,0xca0
+  return seed;
+}
+  14:	c3                   	ret
+
+00000015 <report>:
+
+void
+report(char *when)
+{
+  15:	55                   	push   %ebp
+  16:	89 e5                	mov    %esp,%ebp
+  18:	57                   	push   %edi
+  19:	56                   	push   %esi
+  1a:	53                   	push   %ebx
+  1b:	83 ec 18             	sub    $0x18,%esp
+  int i, big;
+
+  if(kmstat(&st) < 0){
+  1e:	68 c0 0c 00 00       	push   $0xcc0
+  23:	e8 54 04 00 00       	call   47c <kmstat>
+  28:	83 c4 10             	add    $0x10,%esp
+  2b:	85 c0                	test   %eax,%eax
+  2d:	78 24                	js     53 <report+0x3e>
+    printf(1, "kallocbench: kmstat failed\n");
+    exit();
+  }
+  printf(1, "kallocbench: %s: %d pages free, blocks by order:", when, st.nfree);
+  2f:	ff 35 cc 0c 00 00    	push   0xccc
+  35:	ff 75 08             	push   0x8(%ebp)
+  38:	68 94 08 00 00       	push   $0x894
+  3d:	6a 01                	push   $0x1
+  3f:	e8 3f 05 00 00       	call   583 <printf>
+  big = -1;
+  for(i = 0; i <= MAXORDER; i++){
+  44:	83 c4 10             	add    $0x10,%esp
+  big = -1;
+  47:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+  for(i = 0; i <= MAXORDER; i++){
+  4c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  51:	eb 17                	jmp    6a <report+0x55>
+    printf(1, "kallocbench: kmstat failed\n");
+  53:	83 ec 08             	sub    $0x8,%esp
+  56:	68 30 08 00 00       	push   $0x830
+  5b:	6a 01                	push   $0x1
+  5d:	e8 21 05 00 00       	call   583 <printf>
+    exit();
+  62:	e8 45 03 00 00       	call   3ac <exit>
+  for(i = 0; i <= MAXORDER; i++){
+  67:	83 c3 01             	add    $0x1,%ebx
+  6a:	83 fb 0a             	cmp    $0xa,%ebx
+  6d:	7f 2a                	jg     99 <report+0x84>
+    printf(1, " %d", st.nblock[i]);
+  6f:	83 ec 04             	sub    $0x4,%esp
+  72:	8d 73 34             	lea    0x34(%ebx),%esi
+  75:	ff 34 b5 cc 0c 00 00 	push   0xccc(,%esi,4)
+  7c:	68 4c 08 00 00       	push   $0x84c
+  81:	6a 01                	push   $0x1
+  83:	e8 fb 04 00 00       	call   583 <printf>
+    if(st.nblock[i] > 0)
+  88:	83 c4 10             	add    $0x10,%esp
+  8b:	83 3c b5 cc 0c 00 00 	cmpl   $0x0,0xccc(,%esi,4)
+  92:	00 
+  93:	7e d2                	jle    67 <report+0x52>
+      big = i;
+  95:	89 df                	mov    %ebx,%edi
+  97:	eb ce                	jmp    67 <report+0x52>
+  }
+  printf(1, "\nkallocbench: %s: largest free block %d pages\n", when,
+  99:	85 ff                	test   %edi,%edi
+  9b:	78 24                	js     c1 <report+0xac>
+  9d:	b8 01 00 00 00       	mov    $0x1,%eax
+  a2:	89 f9                	mov    %edi,%ecx
+  a4:	d3 e0                	shl    %cl,%eax
+  a6:	50                   	push   %eax
+  a7:	ff 75 08             	push   0x8(%ebp)
+  aa:	68 c8 08 00 00       	push   $0x8c8
+  af:	6a 01                	push   $0x1
+  b1:	e8 cd 04 00 00       	call   583 <printf>
+         big < 0 ? 0 : 1 << big);
+}
+  b6:	83 c4 10             	add    $0x10,%esp
+  b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  bc:	5b                   	pop    %ebx
+  bd:	5e                   	pop    %esi
+  be:	5f                   	pop    %edi
+  bf:	5d                   	pop    %ebp
+  c0:	c3                   	ret
+  printf(1, "\nkallocbench: %s: largest free block %d pages\n", when,
+  c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  c6:	eb de                	jmp    a6 <report+0x91>
+
+000000c8 <churn>:
+
+void
+churn(void)
+{
+  c8:	55                   	push   %ebp
+  c9:	89 e5                	mov    %esp,%ebp
+  cb:	57                   	push   %edi
+  cc:	56                   	push   %esi
+  cd:	53                   	push   %ebx
+  ce:	83 ec 1c             	sub    $0x1c,%esp
+  int r, n, pid;
+  char *a, *p;
+
+  for(r = 0; r < ROUNDS; r++){
+  d1:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  d8:	eb 34                	jmp    10e <churn+0x46>
+    if(a == (char*)-1){
+      printf(1, "kallocbench: sbrk failed\n");
+      exit();
+    }
+    for(p = a; p < a + n * 4096; p += 4096)
+      *p = r;
+  da:	0f b6 55 e4          	movzbl -0x1c(%ebp),%edx
+  de:	88 10                	mov    %dl,(%eax)
+    for(p = a; p < a + n * 4096; p += 4096)
+  e0:	05 00 10 00 00       	add    $0x1000,%eax
+  e5:	8d 34 1f             	lea    (%edi,%ebx,1),%esi
+  e8:	39 f0                	cmp    %esi,%eax
+  ea:	72 ee                	jb     da <churn+0x12>
+    pid = fork();
+  ec:	e8 b3 02 00 00       	call   3a4 <fork>
+    if(pid < 0){
+  f1:	85 c0                	test   %eax,%eax
+  f3:	78 56                	js     14b <churn+0x83>
+      printf(1, "kallocbench: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+  f5:	74 71                	je     168 <churn+0xa0>
+      for(p = a; p < a + n * 4096; p += 4 * 4096)
+        *p = 0;
+      exit();
+    }
+    wait();
+  f7:	e8 b8 02 00 00       	call   3b4 <wait>
+    sbrk(-n * 4096);
+  fc:	83 ec 0c             	sub    $0xc,%esp
+  ff:	f7 db                	neg    %ebx
+ 101:	53                   	push   %ebx
+ 102:	e8 2d 03 00 00       	call   434 <sbrk>
+  for(r = 0; r < ROUNDS; r++){
+ 107:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+ 10b:	83 c4 10             	add    $0x10,%esp
+ 10e:	83 7d e4 31          	cmpl   $0x31,-0x1c(%ebp)
+ 112:	7f 5d                	jg     171 <churn+0xa9>
+    n = rand() % MAXPAGES + 1;
+ 114:	e8 e7 fe ff ff       	call   0 <rand>
+ 119:	83 e0 3f             	and    $0x3f,%eax
+ 11c:	89 c3                	mov    %eax,%ebx
+ 11e:	83 c3 01             	add    $0x1,%ebx
+    a = sbrk(n * 4096);
+ 121:	c1 e3 0c             	shl    $0xc,%ebx
+ 124:	83 ec 0c             	sub    $0xc,%esp
+ 127:	53                   	push   %ebx
+ 128:	e8 07 03 00 00       	call   434 <sbrk>
+ 12d:	89 c7                	mov    %eax,%edi
+    if(a == (char*)-1){
+ 12f:	83 c4 10             	add    $0x10,%esp
+ 132:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 135:	75 ae                	jne    e5 <churn+0x1d>
+      printf(1, "kallocbench: sbrk failed\n");
+ 137:	83 ec 08             	sub    $0x8,%esp
+ 13a:	68 50 08 00 00       	push   $0x850
+ 13f:	6a 01                	push   $0x1
+ 141:	e8 3d 04 00 00       	call   583 <printf>
+      exit();
+ 146:	e8 61 02 00 00       	call   3ac <exit>
+      printf(1, "kallocbench: fork failed\n");
+ 14b:	83 ec 08             	sub    $0x8,%esp
+ 14e:	68 6a 08 00 00       	push   $0x86a
+ 153:	6a 01                	push   $0x1
+ 155:	e8 29 04 00 00       	call   583 <printf>
+      exit();
+ 15a:	e8 4d 02 00 00       	call   3ac <exit>
+        *p = 0;
+ 15f:	c6 07 00             	movb   $0x0,(%edi)
+      for(p = a; p < a + n * 4096; p += 4 * 4096)
+ 162:	81 c7 00 40 00 00    	add    $0x4000,%edi
+ 168:	39 f7                	cmp    %esi,%edi
+ 16a:	72 f3                	jb     15f <churn+0x97>
+      exit();
+ 16c:	e8 3b 02 00 00       	call   3ac <exit>
+  }
+}
+ 171:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 174:	5b                   	pop    %ebx
+ 175:	5e                   	pop    %esi
+ 176:	5f                   	pop    %edi
+ 177:	5d                   	pop    %ebp
+ 178:	c3                   	ret
+
+00000179 <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 179:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 17d:	83 e4 f0             	and    $0xfffffff0,%esp
+ 180:	ff 71 fc             	push   -0x4(%ecx)
+ 183:	55                   	push   %ebp
+ 184:	89 e5                	mov    %esp,%ebp
+ 186:	56                   	push   %esi
+ 187:	53                   	push   %ebx
+ 188:	51                   	push   %ecx
+ 189:	83 ec 18             	sub    $0x18,%esp
+  int i, t0, t1;
+
+  report("before");
+ 18c:	68 84 08 00 00       	push   $0x884
+ 191:	e8 7f fe ff ff       	call   15 <report>
+  t0 = uptime();
+ 196:	e8 a9 02 00 00       	call   444 <uptime>
+ 19b:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < NCHILD; i++){
+ 19d:	83 c4 10             	add    $0x10,%esp
+ 1a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 1a5:	83 fb 07             	cmp    $0x7,%ebx
+ 1a8:	7f 22                	jg     1cc <main+0x53>
+    if(fork() == 0){
+ 1aa:	e8 f5 01 00 00       	call   3a4 <fork>
+ 1af:	85 c0                	test   %eax,%eax
+ 1b1:	74 05                	je     1b8 <main+0x3f>
+  for(i = 0; i < NCHILD; i++){
+ 1b3:	83 c3 01             	add    $0x1,%ebx
+ 1b6:	eb ed                	jmp    1a5 <main+0x2c>
+      seed = getpid();
+ 1b8:	e8 6f 02 00 00       	call   42c <getpid>
+ 1bd:	a3 a0 0c 00 00       	mov    %eax,0xca0
+      churn();
+ 1c2:	e8 01 ff ff ff       	call   c8 <churn>
+      exit();
+ 1c7:	e8 e0 01 00 00       	call   3ac <exit>
+    }
+  }
+  for(i = 0; i < NCHILD; i++)
+ 1cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 1d1:	eb 08                	jmp    1db <main+0x62>
+    wait();
+ 1d3:	e8 dc 01 00 00       	call   3b4 <wait>
+  for(i = 0; i < NCHILD; i++)
+ 1d8:	83 c3 01             	add    $0x1,%ebx
+ 1db:	83 fb 07             	cmp    $0x7,%ebx
+ 1de:	7e f3                	jle    1d3 <main+0x5a>
+  t1 = uptime();
+ 1e0:	e8 5f 02 00 00       	call   444 <uptime>
+  printf(1, "kallocbench: %d procs x %d rounds: %d ticks\n", NCHILD, ROUNDS, t1 - t0);
+ 1e5:	83 ec 0c             	sub    $0xc,%esp
+ 1e8:	29 f0                	sub    %esi,%eax
+ 1ea:	50                   	push   %eax
+ 1eb:	6a 32                	push   $0x32
+ 1ed:	6a 08                	push   $0x8
+ 1ef:	68 f8 08 00 00       	push   $0x8f8
+ 1f4:	6a 01                	push   $0x1
+ 1f6:	e8 88 03 00 00       	call   583 <printf>
+  report("after");
+ 1fb:	83 c4 14             	add    $0x14,%esp
+ 1fe:	68 8b 08 00 00       	push   $0x88b
+ 203:	e8 0d fe ff ff       	call   15 <report>
+  exit();
+ 208:	e8 9f 01 00 00       	call   3ac <exit>
+
+0000020d <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 20d:	55                   	push   %ebp
+ 20e:	89 e5                	mov    %esp,%ebp
+ 210:	56                   	push   %esi
+ 211:	53                   	push   %ebx
+ 212:	8b 75 08             	mov    0x8(%ebp),%esi
+ 215:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 218:	89 f0                	mov    %esi,%eax
+ 21a:	89 d1                	mov    %edx,%ecx
+ 21c:	83 c2 01             	add    $0x1,%edx
+ 21f:	89 c3                	mov    %eax,%ebx
+ 221:	83 c0 01             	add    $0x1,%eax
+ 224:	0f b6 09             	movzbl (%ecx),%ecx
+ 227:	88 0b                	mov    %cl,(%ebx)
+ 229:	84 c9                	test   %cl,%cl
+ 22b:	75 ed                	jne    21a <strcpy+0xd>
+    ;
+  return os;
+}
+ 22d:	89 f0                	mov    %esi,%eax
+ 22f:	5b                   	pop    %ebx
+ 230:	5e                   	pop    %esi
+ 231:	5d                   	pop    %ebp
+ 232:	c3                   	ret
+
+00000233 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 233:	55                   	push   %ebp
+ 234:	89 e5                	mov    %esp,%ebp
+ 236:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 239:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 23c:	eb 06                	jmp    244 <strcmp+0x11>
+    p++, q++;
+ 23e:	83 c1 01             	add    $0x1,%ecx
+ 241:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 244:	0f b6 01             	movzbl (%ecx),%eax
+ 247:	84 c0                	test   %al,%al
+ 249:	74 04                	je     24f <strcmp+0x1c>
+ 24b:	3a 02                	cmp    (%edx),%al
+ 24d:	74 ef                	je     23e <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 24f:	0f b6 c0             	movzbl %al,%eax
+ 252:	0f b6 12             	movzbl (%edx),%edx
+ 255:	29 d0                	sub    %edx,%eax
+}
+ 257:	5d                   	pop    %ebp
+ 258:	c3                   	ret
+
+00000259 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 259:	55                   	push   %ebp
+ 25a:	89 e5                	mov    %esp,%ebp
+ 25c:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 25f:	b8 00 00 00 00       	mov    $0x0,%eax
+ 264:	eb 03                	jmp    269 <strlen+0x10>
+ 266:	83 c0 01             	add    $0x1,%eax
+ 269:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 26d:	75 f7                	jne    266 <strlen+0xd>
+    ;
+  return n;
+}
+ 26f:	5d                   	pop    %ebp
+ 270:	c3                   	ret
+
+00000271 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 271:	55                   	push   %ebp
+ 272:	89 e5                	mov    %esp,%ebp
+ 274:	57                   	push   %edi
+ 275:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 278:	89 d7                	mov    %edx,%edi
+ 27a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 27d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 280:	fc                   	cld
+ 281:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 283:	89 d0                	mov    %edx,%eax
+ 285:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 288:	c9                   	leave
+ 289:	c3                   	ret
+
+0000028a <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 28a:	55                   	push   %ebp
+ 28b:	89 e5                	mov    %esp,%ebp
+ 28d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 290:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 294:	eb 03                	jmp    299 <strchr+0xf>
+ 296:	83 c0 01             	add    $0x1,%eax
+ 299:	0f b6 10             	movzbl (%eax),%edx
+ 29c:	84 d2                	test   %dl,%dl
+ 29e:	74 06                	je     2a6 <strchr+0x1c>
+    if(*s == c)
+ 2a0:	38 ca                	cmp    %cl,%dl
+ 2a2:	75 f2                	jne    296 <strchr+0xc>
+ 2a4:	eb 05                	jmp    2ab <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 2a6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 2ab:	5d                   	pop    %ebp
+ 2ac:	c3                   	ret
+
+000002ad <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2ad:	55                   	push   %ebp
+ 2ae:	89 e5                	mov    %esp,%ebp
+ 2b0:	57                   	push   %edi
+ 2b1:	56                   	push   %esi
+ 2b2:	53                   	push   %ebx
+ 2b3:	83 ec 1c             	sub    $0x1c,%esp
+ 2b6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 2b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 2be:	89 de                	mov    %ebx,%esi
+ 2c0:	83 c3 01             	add    $0x1,%ebx
+ 2c3:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2c6:	7d 2e                	jge    2f6 <gets+0x49>
+    cc = read(0, &c, 1);
+ 2c8:	83 ec 04             	sub    $0x4,%esp
+ 2cb:	6a 01                	push   $0x1
+ 2cd:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 2d0:	50                   	push   %eax
+ 2d1:	6a 00                	push   $0x0
+ 2d3:	e8 ec 00 00 00       	call   3c4 <read>
+    if(cc < 1)
+ 2d8:	83 c4 10             	add    $0x10,%esp
+ 2db:	85 c0                	test   %eax,%eax
+ 2dd:	7e 17                	jle    2f6 <gets+0x49>
+      break;
+    buf[i++] = c;
+ 2df:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2e3:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 2e6:	3c 0a                	cmp    $0xa,%al
+ 2e8:	0f 94 c2             	sete   %dl
+ 2eb:	3c 0d                	cmp    $0xd,%al
+ 2ed:	0f 94 c0             	sete   %al
+ 2f0:	08 c2                	or     %al,%dl
+ 2f2:	74 ca                	je     2be <gets+0x11>
+    buf[i++] = c;
+ 2f4:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 2f6:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 2fa:	89 f8                	mov    %edi,%eax
+ 2fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2ff:	5b                   	pop    %ebx
+ 300:	5e                   	pop    %esi
+ 301:	5f                   	pop    %edi
+ 302:	5d                   	pop    %ebp
+ 303:	c3                   	ret
+
+00000304 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 304:	55                   	push   %ebp
+ 305:	89 e5                	mov    %esp,%ebp
+ 307:	56                   	push   %esi
+ 308:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 309:	83 ec 08             	sub    $0x8,%esp
+ 30c:	6a 00                	push   $0x0
+ 30e:	ff 75 08             	push   0x8(%ebp)
+ 311:	e8 d6 00 00 00       	call   3ec <open>
+  if(fd < 0)
+ 316:	83 c4 10             	add    $0x10,%esp
+ 319:	85 c0                	test   %eax,%eax
+ 31b:	78 24                	js     341 <stat+0x3d>
+ 31d:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 31f:	83 ec 08             	sub    $0x8,%esp
+ 322:	ff 75 0c             	push   0xc(%ebp)
+ 325:	50                   	push   %eax
+ 326:	e8 d9 00 00 00       	call   404 <fstat>
+ 32b:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 32d:	89 1c 24             	mov    %ebx,(%esp)
+ 330:	e8 9f 00 00 00       	call   3d4 <close>
+  return r;
+ 335:	83 c4 10             	add    $0x10,%esp
+}
+ 338:	89 f0                	mov    %esi,%eax
+ 33a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 33d:	5b                   	pop    %ebx
+ 33e:	5e                   	pop    %esi
+ 33f:	5d                   	pop    %ebp
+ 340:	c3                   	ret
+    return -1;
+ 341:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 346:	eb f0                	jmp    338 <stat+0x34>
+
+00000348 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 348:	55                   	push   %ebp
+ 349:	89 e5                	mov    %esp,%ebp
+ 34b:	53                   	push   %ebx
+ 34c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+ 34f:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+ 354:	eb 10                	jmp    366 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+ 356:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+ 359:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+ 35c:	83 c1 01             	add    $0x1,%ecx
+ 35f:	0f be c0             	movsbl %al,%eax
+ 362:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+ 366:	0f b6 01             	movzbl (%ecx),%eax
+ 369:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 36c:	80 fb 09             	cmp    $0x9,%bl
+ 36f:	76 e5                	jbe    356 <atoi+0xe>
+  return n;
+}
+ 371:	89 d0                	mov    %edx,%eax
+ 373:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 376:	c9                   	leave
+ 377:	c3                   	ret
+
+00000378 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 378:	55                   	push   %ebp
+ 379:	89 e5                	mov    %esp,%ebp
+ 37b:	56                   	push   %esi
+ 37c:	53                   	push   %ebx
+ 37d:	8b 75 08             	mov    0x8(%ebp),%esi
+ 380:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 383:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 386:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 388:	eb 0d                	jmp    397 <memmove+0x1f>
+    *dst++ = *src++;
+ 38a:	0f b6 01             	movzbl (%ecx),%eax
+ 38d:	88 02                	mov    %al,(%edx)
+ 38f:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 392:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 395:	89 d8                	mov    %ebx,%eax
+ 397:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 39a:	85 c0                	test   %eax,%eax
+ 39c:	7f ec                	jg     38a <memmove+0x12>
+  return vdst;
+}
+ 39e:	89 f0                	mov    %esi,%eax
+ 3a0:	5b                   	pop    %ebx
+ 3a1:	5e                   	pop    %esi
+ 3a2:	5d                   	pop    %ebp
+ 3a3:	c3                   	ret
+
+000003a4 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3a4:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3a9:	cd 40                	int    $0x40
+ 3ab:	c3                   	ret
+
+000003ac <exit>:
+SYSCALL(exit)
+ 3ac:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3b1:	cd 40                	int    $0x40
+ 3b3:	c3                   	ret
+
+000003b4 <wait>:
+SYSCALL(wait)
+ 3b4:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3b9:	cd 40                	int    $0x40
+ 3bb:	c3                   	ret
+
+000003bc <pipe>:
+SYSCALL(pipe)
+ 3bc:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3c1:	cd 40                	int    $0x40
+ 3c3:	c3                   	ret
+
+000003c4 <read>:
+SYSCALL(read)
+ 3c4:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3c9:	cd 40                	int    $0x40
+ 3cb:	c3                   	ret
+
+000003cc <write>:
+SYSCALL(write)
+ 3cc:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3d1:	cd 40                	int    $0x40
+ 3d3:	c3                   	ret
+
+000003d4 <close>:
+SYSCALL(close)
+ 3d4:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3d9:	cd 40                	int    $0x40
+ 3db:	c3                   	ret
+
+000003dc <kill>:
+SYSCALL(kill)
+ 3dc:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3e1:	cd 40                	int    $0x40
+ 3e3:	c3                   	ret
+
+000003e4 <exec>:
+SYSCALL(exec)
+ 3e4:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3e9:	cd 40                	int    $0x40
+ 3eb:	c3                   	ret
+
+000003ec <open>:
+SYSCALL(open)
+ 3ec:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3f1:	cd 40                	int    $0x40
+ 3f3:	c3                   	ret
+
+000003f4 <mknod>:
+SYSCALL(mknod)
+ 3f4:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3f9:	cd 40                	int    $0x40
+ 3fb:	c3                   	ret
+
+000003fc <unlink>:
+SYSCALL(unlink)
+ 3fc:	b8 12 00 00 00       	mov    $0x12,%eax
+ 401:	cd 40                	int    $0x40
+ 403:	c3                   	ret
+
+00000404 <fstat>:
+SYSCALL(fstat)
+ 404:	b8 08 00 00 00       	mov    $0x8,%eax
+ 409:	cd 40                	int    $0x40
+ 40b:	c3                   	ret
+
+0000040c <link>:
+SYSCALL(link)
+ 40c:	b8 13 00 00 00       	mov    $0x13,%eax
+ 411:	cd 40                	int    $0x40
+ 413:	c3                   	ret
+
+00000414 <mkdir>:
+SYSCALL(mkdir)
+ 414:	b8 14 00 00 00       	mov    $0x14,%eax
+ 419:	cd 40                	int    $0x40
+ 41b:	c3                   	ret
+
+0000041c <chdir>:
+SYSCALL(chdir)
+ 41c:	b8 09 00 00 00       	mov    $0x9,%eax
+ 421:	cd 40                	int    $0x40
+ 423:	c3                   	ret
+
+00000424 <dup>:
+SYSCALL(dup)
+ 424:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 429:	cd 40                	int    $0x40
+ 42b:	c3                   	ret
+
+0000042c <getpid>:
+SYSCALL(getpid)
+ 42c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 431:	cd 40                	int    $0x40
+ 433:	c3                   	ret
+
+00000434 <sbrk>:
+SYSCALL(sbrk)
+ 434:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 439:	cd 40                	int    $0x40
+ 43b:	c3                   	ret
+
+0000043c <sleep>:
+SYSCALL(sleep)
+ 43c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 441:	cd 40                	int    $0x40
+ 443:	c3                   	ret
+
+00000444 <uptime>:
+SYSCALL(uptime)
+ 444:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 449:	cd 40                	int    $0x40
+ 44b:	c3                   	ret
+
+0000044c <setpri>:
+SYSCALL(setpri)
+ 44c:	b8 16 00 00 00       	mov    $0x16,%eax
+ 451:	cd 40                	int    $0x40
+ 453:	c3                   	ret
+
+00000454 <getpri>:
+SYSCALL(getpri)
+ 454:	b8 17 00 00 00       	mov    $0x17,%eax
+ 459:	cd 40                	int    $0x40
+ 45b:	c3                   	ret
+
+0000045c <fork2>:
+SYSCALL(fork2)
+ 45c:	b8 18 00 00 00       	mov    $0x18,%eax
+ 461:	cd 40                	int    $0x40
+ 463:	c3                   	ret
+
+00000464 <getpinfo>:
+SYSCALL(getpinfo)
+ 464:	b8 19 00 00 00       	mov    $0x19,%eax
+ 469:	cd 40                	int    $0x40
+ 46b:	c3                   	ret
+
+0000046c <spawn>:
+SYSCALL(spawn)
+ 46c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 471:	cd 40                	int    $0x40
+ 473:	c3                   	ret
+
+00000474 <spawnn>:
+SYSCALL(spawnn)
+ 474:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 479:	cd 40                	int    $0x40
+ 47b:	c3                   	ret
+
+0000047c <kmstat>:
+SYSCALL(kmstat)
+ 47c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 481:	cd 40                	int    $0x40
+ 483:	c3                   	ret
+
+00000484 <slabstat>:
+SYSCALL(slabstat)
+ 484:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 489:	cd 40                	int    $0x40
+ 48b:	c3                   	ret
+
+0000048c <shmget>:
+SYSCALL(shmget)
+ 48c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 491:	cd 40                	int    $0x40
+ 493:	c3                   	ret
+
+00000494 <shmat>:
+SYSCALL(shmat)
+ 494:	b8 20 00 00 00       	mov    $0x20,%eax
+ 499:	cd 40                	int    $0x40
+ 49b:	c3                   	ret
+
+0000049c <shmdt>:
+SYSCALL(shmdt)
+ 49c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4a1:	cd 40                	int    $0x40
+ 4a3:	c3                   	ret
+
+000004a4 <mmap>:
+SYSCALL(mmap)
+ 4a4:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4a9:	cd 40                	int    $0x40
+ 4ab:	c3                   	ret
+
+000004ac <munmap>:
+SYSCALL(munmap)
+ 4ac:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4b1:	cd 40                	int    $0x40
+ 4b3:	c3                   	ret
+
+000004b4 <bstat>:
+SYSCALL(bstat)
+ 4b4:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4b9:	cd 40                	int    $0x40
+ 4bb:	c3                   	ret
+
+000004bc <aread>:
+SYSCALL(aread)
+ 4bc:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4c1:	cd 40                	int    $0x40
+ 4c3:	c3                   	ret
+
+000004c4 <await>:
+SYSCALL(await)
+ 4c4:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4c9:	cd 40                	int    $0x40
+ 4cb:	c3                   	ret
+
+000004cc <bdrop>:
+SYSCALL(bdrop)
+ 4cc:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4d1:	cd 40                	int    $0x40
+ 4d3:	c3                   	ret
+
+000004d4 <vfork>:
+# exec or exit, and its ret would leave the slot holding our
+# return address free for it to overwrite.  Keep the return
+# address in %ecx, which the kernel restores for both sides.
+.globl vfork
+vfork:
+  popl %ecx
+ 4d4:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+ 4d5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  int $T_SYSCALL
+ 4da:	cd 40                	int    $0x40
+  pushl %ecx
+ 4dc:	51                   	push   %ecx
+  ret
+ 4dd:	c3                   	ret
+
+000004de <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 4de:	55                   	push   %ebp
+ 4df:	89 e5                	mov    %esp,%ebp
+ 4e1:	83 ec 1c             	sub    $0x1c,%esp
+ 4e4:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 4e7:	6a 01                	push   $0x1
+ 4e9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 4ec:	52                   	push   %edx
+ 4ed:	50                   	push   %eax
+ 4ee:	e8 d9 fe ff ff       	call   3cc <write>
+}
+ 4f3:	83 c4 10             	add    $0x10,%esp
+ 4f6:	c9                   	leave
+ 4f7:	c3                   	ret
+
+000004f8 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4f8:	55                   	push   %ebp
+ 4f9:	89 e5                	mov    %esp,%ebp
+ 4fb:	57                   	push   %edi
+ 4fc:	56                   	push   %esi
+ 4fd:	53                   	push   %ebx
+ 4fe:	83 ec 2c             	sub    $0x2c,%esp
+ 501:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 504:	89 d0                	mov    %edx,%eax
+ 506:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 508:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 50c:	0f 95 c1             	setne  %cl
+ 50f:	c1 ea 1f             	shr    $0x1f,%edx
+ 512:	84 d1                	test   %dl,%cl
+ 514:	74 44                	je     55a <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 516:	f7 d8                	neg    %eax
+ 518:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 51a:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 521:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 526:	89 c8                	mov    %ecx,%eax
+ 528:	ba 00 00 00 00       	mov    $0x0,%edx
+ 52d:	f7 f6                	div    %esi
+ 52f:	89 df                	mov    %ebx,%edi
+ 531:	83 c3 01             	add    $0x1,%ebx
+ 534:	0f b6 92 84 09 00 00 	movzbl 0x984(%edx),%edx
+ 53b:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 53f:	89 ca                	mov    %ecx,%edx
+ 541:	89 c1                	mov    %eax,%ecx
+ 543:	39 f2                	cmp    %esi,%edx
+ 545:	73 df                	jae    526 <printint+0x2e>
+  if(neg)
+ 547:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 54b:	74 31                	je     57e <printint+0x86>
+    buf[i++] = '-';
+ 54d:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 552:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 555:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 558:	eb 17                	jmp    571 <printint+0x79>
+    x = xx;
+ 55a:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 55c:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 563:	eb bc                	jmp    521 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 565:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 56a:	89 f0                	mov    %esi,%eax
+ 56c:	e8 6d ff ff ff       	call   4de <putc>
+  while(--i >= 0)
+ 571:	83 eb 01             	sub    $0x1,%ebx
+ 574:	79 ef                	jns    565 <printint+0x6d>
+}
+ 576:	83 c4 2c             	add    $0x2c,%esp
+ 579:	5b                   	pop    %ebx
+ 57a:	5e                   	pop    %esi
+ 57b:	5f                   	pop    %edi
+ 57c:	5d                   	pop    %ebp
+ 57d:	c3                   	ret
+ 57e:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 581:	eb ee                	jmp    571 <printint+0x79>
+
+00000583 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 583:	55                   	push   %ebp
+ 584:	89 e5                	mov    %esp,%ebp
+ 586:	57                   	push   %edi
+ 587:	56                   	push   %esi
+ 588:	53                   	push   %ebx
+ 589:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 58c:	8d 45 10             	lea    0x10(%ebp),%eax
+ 58f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 592:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 597:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 59c:	eb 14                	jmp    5b2 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 59e:	89 fa                	mov    %edi,%edx
+ 5a0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5a3:	e8 36 ff ff ff       	call   4de <putc>
+ 5a8:	eb 05                	jmp    5af <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 5aa:	83 fe 25             	cmp    $0x25,%esi
+ 5ad:	74 25                	je     5d4 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 5af:	83 c3 01             	add    $0x1,%ebx
+ 5b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5b5:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 5b9:	84 c0                	test   %al,%al
+ 5bb:	0f 84 20 01 00 00    	je     6e1 <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 5c1:	0f be f8             	movsbl %al,%edi
+ 5c4:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 5c7:	85 f6                	test   %esi,%esi
+ 5c9:	75 df                	jne    5aa <printf+0x27>
+      if(c == '%'){
+ 5cb:	83 f8 25             	cmp    $0x25,%eax
+ 5ce:	75 ce                	jne    59e <printf+0x1b>
+        state = '%';
+ 5d0:	89 c6                	mov    %eax,%esi
+ 5d2:	eb db                	jmp    5af <printf+0x2c>
+      if(c == 'd'){
+ 5d4:	83 f8 25             	cmp    $0x25,%eax
+ 5d7:	0f 84 cf 00 00 00    	je     6ac <printf+0x129>
+ 5dd:	0f 8c dd 00 00 00    	jl     6c0 <printf+0x13d>
+ 5e3:	83 f8 78             	cmp    $0x78,%eax
+ 5e6:	0f 8f d4 00 00 00    	jg     6c0 <printf+0x13d>
+ 5ec:	83 f8 63             	cmp    $0x63,%eax
+ 5ef:	0f 8c cb 00 00 00    	jl     6c0 <printf+0x13d>
+ 5f5:	83 e8 63             	sub    $0x63,%eax
+ 5f8:	83 f8 15             	cmp    $0x15,%eax
+ 5fb:	0f 87 bf 00 00 00    	ja     6c0 <printf+0x13d>
+ 601:	ff 24 85 2c 09 00 00 	jmp    *0x92c(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 608:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 60b:	8b 17                	mov    (%edi),%edx
+ 60d:	83 ec 0c             	sub    $0xc,%esp
+ 610:	6a 01                	push   $0x1
+ 612:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 617:	8b 45 08             	mov    0x8(%ebp),%eax
+ 61a:	e8 d9 fe ff ff       	call   4f8 <printint>
+        ap++;
+ 61f:	83 c7 04             	add    $0x4,%edi
+ 622:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 625:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 628:	be 00 00 00 00       	mov    $0x0,%esi
+ 62d:	eb 80                	jmp    5af <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 62f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 632:	8b 17                	mov    (%edi),%edx
+ 634:	83 ec 0c             	sub    $0xc,%esp
+ 637:	6a 00                	push   $0x0
+ 639:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 63e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 641:	e8 b2 fe ff ff       	call   4f8 <printint>
+        ap++;
+ 646:	83 c7 04             	add    $0x4,%edi
+ 649:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 64c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 64f:	be 00 00 00 00       	mov    $0x0,%esi
+ 654:	e9 56 ff ff ff       	jmp    5af <printf+0x2c>
+        s = (char*)*ap;
+ 659:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 65c:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 65e:	83 c0 04             	add    $0x4,%eax
+ 661:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 664:	85 f6                	test   %esi,%esi
+ 666:	75 15                	jne    67d <printf+0xfa>
+          s = "(null)";
+ 668:	be 25 09 00 00       	mov    $0x925,%esi
+ 66d:	eb 0e                	jmp    67d <printf+0xfa>
+          putc(fd, *s);
+ 66f:	0f be d2             	movsbl %dl,%edx
+ 672:	8b 45 08             	mov    0x8(%ebp),%eax
+ 675:	e8 64 fe ff ff       	call   4de <putc>
+          s++;
+ 67a:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 67d:	0f b6 16             	movzbl (%esi),%edx
+ 680:	84 d2                	test   %dl,%dl
+ 682:	75 eb                	jne    66f <printf+0xec>
+      state = 0;
+ 684:	be 00 00 00 00       	mov    $0x0,%esi
+ 689:	e9 21 ff ff ff       	jmp    5af <printf+0x2c>
+        putc(fd, *ap);
+ 68e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 691:	0f be 17             	movsbl (%edi),%edx
+ 694:	8b 45 08             	mov    0x8(%ebp),%eax
+ 697:	e8 42 fe ff ff       	call   4de <putc>
+        ap++;
+ 69c:	83 c7 04             	add    $0x4,%edi
+ 69f:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 6a2:	be 00 00 00 00       	mov    $0x0,%esi
+ 6a7:	e9 03 ff ff ff       	jmp    5af <printf+0x2c>
+        putc(fd, c);
+ 6ac:	89 fa                	mov    %edi,%edx
+ 6ae:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6b1:	e8 28 fe ff ff       	call   4de <putc>
+      state = 0;
+ 6b6:	be 00 00 00 00       	mov    $0x0,%esi
+ 6bb:	e9 ef fe ff ff       	jmp    5af <printf+0x2c>
+        putc(fd, '%');
+ 6c0:	ba 25 00 00 00       	mov    $0x25,%edx
+ 6c5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6c8:	e8 11 fe ff ff       	call   4de <putc>
+        putc(fd, c);
+ 6cd:	89 fa                	mov    %edi,%edx
+ 6cf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6d2:	e8 07 fe ff ff       	call   4de <putc>
+      state = 0;
+ 6d7:	be 00 00 00 00       	mov    $0x0,%esi
+ 6dc:	e9 ce fe ff ff       	jmp    5af <printf+0x2c>
+    }
+  }
+}
+ 6e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6e4:	5b                   	pop    %ebx
+ 6e5:	5e                   	pop    %esi
+ 6e6:	5f                   	pop    %edi
+ 6e7:	5d                   	pop    %ebp
+ 6e8:	c3                   	ret
+
+000006e9 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6e9:	55                   	push   %ebp
+ 6ea:	89 e5                	mov    %esp,%ebp
+ 6ec:	57                   	push   %edi
+ 6ed:	56                   	push   %esi
+ 6ee:	53                   	push   %ebx
+ 6ef:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 6f2:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6f5:	a1 c8 0d 00 00       	mov    0xdc8,%eax
+ 6fa:	eb 02                	jmp    6fe <free+0x15>
+ 6fc:	89 d0                	mov    %edx,%eax
+ 6fe:	39 c8                	cmp    %ecx,%eax
+ 700:	73 04                	jae    706 <free+0x1d>
+ 702:	3b 08                	cmp    (%eax),%ecx
+ 704:	72 12                	jb     718 <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 706:	8b 10                	mov    (%eax),%edx
+ 708:	39 d0                	cmp    %edx,%eax
+ 70a:	72 f0                	jb     6fc <free+0x13>
+ 70c:	39 c8                	cmp    %ecx,%eax
+ 70e:	72 08                	jb     718 <free+0x2f>
+ 710:	39 d1                	cmp    %edx,%ecx
+ 712:	72 04                	jb     718 <free+0x2f>
+ 714:	89 d0                	mov    %edx,%eax
+ 716:	eb e6                	jmp    6fe <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 718:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 71b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 71e:	8b 10                	mov    (%eax),%edx
+ 720:	39 d7                	cmp    %edx,%edi
+ 722:	74 19                	je     73d <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 724:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 727:	8b 50 04             	mov    0x4(%eax),%edx
+ 72a:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 72d:	39 ce                	cmp    %ecx,%esi
+ 72f:	74 1b                	je     74c <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 731:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 733:	a3 c8 0d 00 00       	mov    %eax,0xdc8
+}
+ 738:	5b                   	pop    %ebx
+ 739:	5e                   	pop    %esi
+ 73a:	5f                   	pop    %edi
+ 73b:	5d                   	pop    %ebp
+ 73c:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 73d:	03 72 04             	add    0x4(%edx),%esi
+ 740:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 743:	8b 10                	mov    (%eax),%edx
+ 745:	8b 12                	mov    (%edx),%edx
+ 747:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 74a:	eb db                	jmp    727 <free+0x3e>
+    p->s.size += bp->s.size;
+ 74c:	03 53 fc             	add    -0x4(%ebx),%edx
+ 74f:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 752:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 755:	89 10                	mov    %edx,(%eax)
+ 757:	eb da                	jmp    733 <free+0x4a>
+
+00000759 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 759:	55                   	push   %ebp
+ 75a:	89 e5                	mov    %esp,%ebp
+ 75c:	53                   	push   %ebx
+ 75d:	83 ec 04             	sub    $0x4,%esp
+ 760:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 762:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 767:	77 05                	ja     76e <morecore+0x15>
+    nu = 4096;
+ 769:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 76e:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 775:	83 ec 0c             	sub    $0xc,%esp
+ 778:	50                   	push   %eax
+ 779:	e8 b6 fc ff ff       	call   434 <sbrk>
+  if(p == (char*)-1)
+ 77e:	83 c4 10             	add    $0x10,%esp
+ 781:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 784:	74 1c                	je     7a2 <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 786:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 789:	83 c0 08             	add    $0x8,%eax
+ 78c:	83 ec 0c             	sub    $0xc,%esp
+ 78f:	50                   	push   %eax
+ 790:	e8 54 ff ff ff       	call   6e9 <free>
+  return freep;
+ 795:	a1 c8 0d 00 00       	mov    0xdc8,%eax
+ 79a:	83 c4 10             	add    $0x10,%esp
+}
+ 79d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 7a0:	c9                   	leave
+ 7a1:	c3                   	ret
+    return 0;
+ 7a2:	b8 00 00 00 00       	mov    $0x0,%eax
+ 7a7:	eb f4                	jmp    79d <morecore+0x44>
+
+000007a9 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 7a9:	55                   	push   %ebp
+ 7aa:	89 e5                	mov    %esp,%ebp
+ 7ac:	53                   	push   %ebx
+ 7ad:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7b0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7b3:	8d 58 07             	lea    0x7(%eax),%ebx
+ 7b6:	c1 eb 03             	shr    $0x3,%ebx
+ 7b9:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 7bc:	8b 0d c8 0d 00 00    	mov    0xdc8,%ecx
+ 7c2:	85 c9                	test   %ecx,%ecx
+ 7c4:	74 04                	je     7ca <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7c6:	8b 01                	mov    (%ecx),%eax
+ 7c8:	eb 4a                	jmp    814 <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 7ca:	c7 05 c8 0d 00 00 cc 	movl   $0xdcc,0xdc8
+ 7d1:	0d 00 00 
+ 7d4:	c7 05 cc 0d 00 00 cc 	movl   $0xdcc,0xdcc
+ 7db:	0d 00 00 
+    base.s.size = 0;
+ 7de:	c7 05 d0 0d 00 00 00 	movl   $0x0,0xdd0
+ 7e5:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 7e8:	b9 cc 0d 00 00       	mov    $0xdcc,%ecx
+ 7ed:	eb d7                	jmp    7c6 <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 7ef:	74 19                	je     80a <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 7f1:	29 da                	sub    %ebx,%edx
+ 7f3:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 7f6:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 7f9:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 7fc:	89 0d c8 0d 00 00    	mov    %ecx,0xdc8
+      return (void*)(p + 1);
+ 802:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 805:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 808:	c9                   	leave
+ 809:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 80a:	8b 10                	mov    (%eax),%edx
+ 80c:	89 11                	mov    %edx,(%ecx)
+ 80e:	eb ec                	jmp    7fc <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 810:	89 c1                	mov    %eax,%ecx
+ 812:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 814:	8b 50 04             	mov    0x4(%eax),%edx
+ 817:	39 da                	cmp    %ebx,%edx
+ 819:	73 d4                	jae    7ef <malloc+0x46>
+    if(p == freep)
+ 81b:	39 05 c8 0d 00 00    	cmp    %eax,0xdc8
+ 821:	75 ed                	jne    810 <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 823:	89 d8                	mov    %ebx,%eax
+ 825:	e8 2f ff ff ff       	call   759 <morecore>
+ 82a:	85 c0                	test   %eax,%eax
+ 82c:	75 e2                	jne    810 <malloc+0x67>
+ 82e:	eb d5                	jmp    805 <malloc+0x5c>
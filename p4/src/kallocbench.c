@@ -0,0 +1,98 @@
+// Stress the physical page allocator and report fragmentation.
+// NCHILD processes each repeatedly grow their memory by a
+// random number of pages, touch every new page, fork a child
+// that writes to some of them, and shrink again.  Before and
+// after, print the buddy allocator's free blocks per order;
+// with coalescing the large blocks should come back once the
+// children are gone.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "kmstat.h"
+
+#define NCHILD 8
+#define ROUNDS 50
+#define MAXPAGES 64
+
+struct kmstat st;
+uint seed;
+
+uint
+rand(void)
+{
+  seed = seed * 1664525 + 1013904223;
+  return seed;
+}
+
+void
+report(char *when)
+{
+  int i, big;
+
+  if(kmstat(&st) < 0){
+    printf(1, "kallocbench: kmstat failed\n");
+    exit();
+  }
+  printf(1, "kallocbench: %s: %d pages free, blocks by order:", when, st.nfree);
+  big = -1;
+  for(i = 0; i <= MAXORDER; i++){
+    printf(1, " %d", st.nblock[i]);
+    if(st.nblock[i] > 0)
+      big = i;
+  }
+  printf(1, "\nkallocbench: %s: largest free block %d pages\n", when,
+         big < 0 ? 0 : 1 << big);
+}
+
+void
+churn(void)
+{
+  int r, n, pid;
+  char *a, *p;
+
+  for(r = 0; r < ROUNDS; r++){
+    n = rand() % MAXPAGES + 1;
+    a = sbrk(n * 4096);
+    if(a == (char*)-1){
+      printf(1, "kallocbench: sbrk failed\n");
+      exit();
+    }
+    for(p = a; p < a + n * 4096; p += 4096)
+      *p = r;
+    pid = fork();
+    if(pid < 0){
+      printf(1, "kallocbench: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      for(p = a; p < a + n * 4096; p += 4 * 4096)
+        *p = 0;
+      exit();
+    }
+    wait();
+    sbrk(-n * 4096);
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, t0, t1;
+
+  report("before");
+  t0 = uptime();
+  for(i = 0; i < NCHILD; i++){
+    if(fork() == 0){
+      seed = getpid();
+      churn();
+      exit();
+    }
+  }
+  for(i = 0; i < NCHILD; i++)
+    wait();
+  t1 = uptime();
+  printf(1, "kallocbench: %d procs x %d rounds: %d ticks\n", NCHILD, ROUNDS, t1 - t0);
+  report("after");
+  exit();
+}
@@ -0,0 +1,23717 @@
+
+kernel:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+80100000 <multiboot_header>:
+80100000:	02 b0 ad 1b 00 00    	add    0x1bad(%eax),%dh
+80100006:	00 00                	add    %al,(%eax)
+80100008:	fe 4f 52             	decb   0x52(%edi)
+8010000b:	e4                   	.byte 0xe4
+
+8010000c <entry>:
+
+# Entering xv6 on boot processor, with paging off.
+.globl entry
+entry:
+  # Turn on page size extension for 4Mbyte pages
+  movl    %cr4, %eax
+8010000c:	0f 20 e0             	mov    %cr4,%eax
+  orl     $(CR4_PSE), %eax
+8010000f:	83 c8 10             	or     $0x10,%eax
+  movl    %eax, %cr4
+80100012:	0f 22 e0             	mov    %eax,%cr4
+  # Set page directory
+  movl    $(V2P_WO(entrypgdir)), %eax
+80100015:	b8 00 e0 10 00       	mov    $0x10e000,%eax
+  movl    %eax, %cr3
+8010001a:	0f 22 d8             	mov    %eax,%cr3
+  # Turn on paging.
+  movl    %cr0, %eax
+8010001d:	0f 20 c0             	mov    %cr0,%eax
+  orl     $(CR0_PG|CR0_WP), %eax
+80100020:	0d 00 00 01 80       	or     $0x80010000,%eax
+  movl    %eax, %cr0
+80100025:	0f 22 c0             	mov    %eax,%cr0
+
+  # Set up the stack pointer.
+  movl $(stack + KSTACKSIZE), %esp
+80100028:	bc 70 67 13 80       	mov    $0x80136770,%esp
+
+  # Jump to main(), and switch to executing at
+  # high addresses. The indirect call is needed because
+  # the assembler produces a PC-relative instruction
+  # for a direct jump.
+  mov $main, %eax
+8010002d:	b8 bd 4c 10 80       	mov    $0x80104cbd,%eax
+  jmp *%eax
+80100032:	ff e0                	jmp    *%eax
+
+80100034 <aread>:
+// Start reading n bytes from f at its current offset into
+// dst, advancing the offset.  Returns an id for await(),
+// or -1.
+int
+aread(struct file *f, char *dst, int n)
+{
+80100034:	55                   	push   %ebp
+80100035:	89 e5                	mov    %esp,%ebp
+80100037:	57                   	push   %edi
+80100038:	56                   	push   %esi
+80100039:	53                   	push   %ebx
+8010003a:	83 ec 1c             	sub    $0x1c,%esp
+8010003d:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct proc *curproc = myproc();
+80100040:	e8 c6 5c 00 00       	call   80105d0b <myproc>
+  struct aio *a;
+  struct inode *ip;
+
+  if(f->type != FD_INODE || !f->readable || n < 0)
+80100045:	83 3e 02             	cmpl   $0x2,(%esi)
+80100048:	0f 85 cd 00 00 00    	jne    8010011b <aread+0xe7>
+8010004e:	80 7e 08 00          	cmpb   $0x0,0x8(%esi)
+80100052:	0f 84 ca 00 00 00    	je     80100122 <aread+0xee>
+80100058:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+8010005c:	0f 88 c7 00 00 00    	js     80100129 <aread+0xf5>
+    return -1;
+  for(a = curproc->aio; a < &curproc->aio[NAIO]; a++)
+80100062:	8d 88 28 02 00 00    	lea    0x228(%eax),%ecx
+80100068:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+8010006b:	89 cb                	mov    %ecx,%ebx
+8010006d:	8d 90 a8 02 00 00    	lea    0x2a8(%eax),%edx
+80100073:	39 d3                	cmp    %edx,%ebx
+80100075:	73 0a                	jae    80100081 <aread+0x4d>
+    if(a->f == 0)
+80100077:	83 3b 00             	cmpl   $0x0,(%ebx)
+8010007a:	74 05                	je     80100081 <aread+0x4d>
+  for(a = curproc->aio; a < &curproc->aio[NAIO]; a++)
+8010007c:	83 c3 10             	add    $0x10,%ebx
+8010007f:	eb ec                	jmp    8010006d <aread+0x39>
+      break;
+  if(a == &curproc->aio[NAIO])
+80100081:	39 da                	cmp    %ebx,%edx
+80100083:	0f 84 a7 00 00 00    	je     80100130 <aread+0xfc>
+    return -1;
+
+  ip = f->ip;
+80100089:	8b 7e 10             	mov    0x10(%esi),%edi
+  ilock(ip);
+8010008c:	83 ec 0c             	sub    $0xc,%esp
+8010008f:	57                   	push   %edi
+80100090:	e8 cc 1f 00 00       	call   80102061 <ilock>
+  if(ip->type == T_DEV){
+80100095:	83 c4 10             	add    $0x10,%esp
+80100098:	66 83 7f 50 03       	cmpw   $0x3,0x50(%edi)
+8010009d:	74 16                	je     801000b5 <aread+0x81>
+    iunlock(ip);
+    return -1;
+  }
+  if(f->off >= ip->size)
+8010009f:	8b 56 14             	mov    0x14(%esi),%edx
+801000a2:	8b 47 58             	mov    0x58(%edi),%eax
+801000a5:	39 c2                	cmp    %eax,%edx
+801000a7:	73 1f                	jae    801000c8 <aread+0x94>
+    n = 0;
+  else if(n > ip->size - f->off)
+801000a9:	29 d0                	sub    %edx,%eax
+801000ab:	3b 45 10             	cmp    0x10(%ebp),%eax
+801000ae:	73 1f                	jae    801000cf <aread+0x9b>
+    n = ip->size - f->off;
+801000b0:	89 45 10             	mov    %eax,0x10(%ebp)
+801000b3:	eb 1a                	jmp    801000cf <aread+0x9b>
+    iunlock(ip);
+801000b5:	83 ec 0c             	sub    $0xc,%esp
+801000b8:	57                   	push   %edi
+801000b9:	e8 65 20 00 00       	call   80102123 <iunlock>
+    return -1;
+801000be:	83 c4 10             	add    $0x10,%esp
+801000c1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801000c6:	eb 4b                	jmp    80100113 <aread+0xdf>
+    n = 0;
+801000c8:	c7 45 10 00 00 00 00 	movl   $0x0,0x10(%ebp)
+  iprefetch(ip, f->off, n);
+801000cf:	83 ec 04             	sub    $0x4,%esp
+801000d2:	ff 75 10             	push   0x10(%ebp)
+801000d5:	52                   	push   %edx
+801000d6:	57                   	push   %edi
+801000d7:	e8 77 21 00 00       	call   80102253 <iprefetch>
+  a->off = f->off;
+801000dc:	8b 46 14             	mov    0x14(%esi),%eax
+801000df:	89 43 08             	mov    %eax,0x8(%ebx)
+  f->off += n;
+801000e2:	03 45 10             	add    0x10(%ebp),%eax
+801000e5:	89 46 14             	mov    %eax,0x14(%esi)
+  iunlock(ip);
+801000e8:	89 3c 24             	mov    %edi,(%esp)
+801000eb:	e8 33 20 00 00       	call   80102123 <iunlock>
+
+  a->f = filedup(f);
+801000f0:	89 34 24             	mov    %esi,(%esp)
+801000f3:	e8 38 16 00 00       	call   80101730 <filedup>
+801000f8:	89 03                	mov    %eax,(%ebx)
+  a->dst = dst;
+801000fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+801000fd:	89 43 04             	mov    %eax,0x4(%ebx)
+  a->n = n;
+80100100:	8b 45 10             	mov    0x10(%ebp),%eax
+80100103:	89 43 0c             	mov    %eax,0xc(%ebx)
+  return a - curproc->aio;
+80100106:	89 d8                	mov    %ebx,%eax
+80100108:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010010b:	29 c8                	sub    %ecx,%eax
+8010010d:	c1 f8 04             	sar    $0x4,%eax
+80100110:	83 c4 10             	add    $0x10,%esp
+}
+80100113:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100116:	5b                   	pop    %ebx
+80100117:	5e                   	pop    %esi
+80100118:	5f                   	pop    %edi
+80100119:	5d                   	pop    %ebp
+8010011a:	c3                   	ret
+    return -1;
+8010011b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80100120:	eb f1                	jmp    80100113 <aread+0xdf>
+80100122:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80100127:	eb ea                	jmp    80100113 <aread+0xdf>
+80100129:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010012e:	eb e3                	jmp    80100113 <aread+0xdf>
+    return -1;
+80100130:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80100135:	eb dc                	jmp    80100113 <aread+0xdf>
+
+80100137 <await>:
+// Wait for the read started by aread() with the given id
+// and copy the range's current contents out.  Returns the
+// number of bytes read, or -1.
+int
+await(int id)
+{
+80100137:	55                   	push   %ebp
+80100138:	89 e5                	mov    %esp,%ebp
+8010013a:	57                   	push   %edi
+8010013b:	56                   	push   %esi
+8010013c:	53                   	push   %ebx
+8010013d:	83 ec 1c             	sub    $0x1c,%esp
+80100140:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct proc *curproc = myproc();
+80100143:	e8 c3 5b 00 00       	call   80105d0b <myproc>
+  struct aio *a;
+  uint dst, end;
+  int r;
+
+  if(id < 0 || id >= NAIO || curproc->aio[id].f == 0)
+80100148:	83 fe 07             	cmp    $0x7,%esi
+8010014b:	0f 87 e7 00 00 00    	ja     80100238 <await+0x101>
+80100151:	89 c3                	mov    %eax,%ebx
+80100153:	8d 46 22             	lea    0x22(%esi),%eax
+80100156:	c1 e0 04             	shl    $0x4,%eax
+80100159:	83 7c 03 08 00       	cmpl   $0x0,0x8(%ebx,%eax,1)
+8010015e:	0f 84 de 00 00 00    	je     80100242 <await+0x10b>
+    return -1;
+  a = &curproc->aio[id];
+
+  // The buffer may have been unmapped since aread().
+  dst = (uint)a->dst;
+80100164:	8d 46 22             	lea    0x22(%esi),%eax
+80100167:	c1 e0 04             	shl    $0x4,%eax
+8010016a:	01 d8                	add    %ebx,%eax
+8010016c:	8b 48 0c             	mov    0xc(%eax),%ecx
+8010016f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  r = -1;
+  if(a->n == 0)
+80100172:	8b 78 14             	mov    0x14(%eax),%edi
+80100175:	85 ff                	test   %edi,%edi
+80100177:	75 27                	jne    801001a0 <await+0x69>
+          faultin(curproc, dst, a->n, 1) == 0){
+    ilock(a->f->ip);
+    r = readi(a->f->ip, a->dst, a->off, a->n);
+    iunlock(a->f->ip);
+  }
+  fileclose(a->f);
+80100179:	83 ec 0c             	sub    $0xc,%esp
+8010017c:	83 c6 22             	add    $0x22,%esi
+8010017f:	c1 e6 04             	shl    $0x4,%esi
+80100182:	01 f3                	add    %esi,%ebx
+80100184:	ff 73 08             	push   0x8(%ebx)
+80100187:	e8 e9 15 00 00       	call   80101775 <fileclose>
+  a->f = 0;
+8010018c:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  return r;
+80100193:	83 c4 10             	add    $0x10,%esp
+}
+80100196:	89 f8                	mov    %edi,%eax
+80100198:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010019b:	5b                   	pop    %ebx
+8010019c:	5e                   	pop    %esi
+8010019d:	5f                   	pop    %edi
+8010019e:	5d                   	pop    %ebp
+8010019f:	c3                   	ret
+  else if((end = uend(curproc, dst)) != 0 && dst + a->n <= end &&
+801001a0:	83 ec 08             	sub    $0x8,%esp
+801001a3:	89 cf                	mov    %ecx,%edi
+801001a5:	51                   	push   %ecx
+801001a6:	53                   	push   %ebx
+801001a7:	e8 80 b4 00 00       	call   8010b62c <uend>
+801001ac:	83 c4 10             	add    $0x10,%esp
+801001af:	85 c0                	test   %eax,%eax
+801001b1:	74 7b                	je     8010022e <await+0xf7>
+801001b3:	8d 56 22             	lea    0x22(%esi),%edx
+801001b6:	c1 e2 04             	shl    $0x4,%edx
+801001b9:	8b 54 13 14          	mov    0x14(%ebx,%edx,1),%edx
+801001bd:	8d 0c 3a             	lea    (%edx,%edi,1),%ecx
+801001c0:	39 c8                	cmp    %ecx,%eax
+801001c2:	73 07                	jae    801001cb <await+0x94>
+  r = -1;
+801001c4:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+801001c9:	eb ae                	jmp    80100179 <await+0x42>
+          faultin(curproc, dst, a->n, 1) == 0){
+801001cb:	6a 01                	push   $0x1
+801001cd:	52                   	push   %edx
+801001ce:	ff 75 e4             	push   -0x1c(%ebp)
+801001d1:	53                   	push   %ebx
+801001d2:	e8 b2 b5 00 00       	call   8010b789 <faultin>
+  else if((end = uend(curproc, dst)) != 0 && dst + a->n <= end &&
+801001d7:	83 c4 10             	add    $0x10,%esp
+801001da:	85 c0                	test   %eax,%eax
+801001dc:	74 07                	je     801001e5 <await+0xae>
+  r = -1;
+801001de:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+801001e3:	eb 94                	jmp    80100179 <await+0x42>
+    ilock(a->f->ip);
+801001e5:	8d 46 22             	lea    0x22(%esi),%eax
+801001e8:	c1 e0 04             	shl    $0x4,%eax
+801001eb:	8d 3c 03             	lea    (%ebx,%eax,1),%edi
+801001ee:	8b 47 08             	mov    0x8(%edi),%eax
+801001f1:	83 ec 0c             	sub    $0xc,%esp
+801001f4:	ff 70 10             	push   0x10(%eax)
+801001f7:	e8 65 1e 00 00       	call   80102061 <ilock>
+    r = readi(a->f->ip, a->dst, a->off, a->n);
+801001fc:	8b 47 08             	mov    0x8(%edi),%eax
+801001ff:	ff 77 14             	push   0x14(%edi)
+80100202:	ff 77 10             	push   0x10(%edi)
+80100205:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80100208:	ff 77 0c             	push   0xc(%edi)
+8010020b:	ff 70 10             	push   0x10(%eax)
+8010020e:	e8 44 21 00 00       	call   80102357 <readi>
+80100213:	89 c7                	mov    %eax,%edi
+    iunlock(a->f->ip);
+80100215:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80100218:	8b 42 08             	mov    0x8(%edx),%eax
+8010021b:	83 c4 14             	add    $0x14,%esp
+8010021e:	ff 70 10             	push   0x10(%eax)
+80100221:	e8 fd 1e 00 00       	call   80102123 <iunlock>
+80100226:	83 c4 10             	add    $0x10,%esp
+80100229:	e9 4b ff ff ff       	jmp    80100179 <await+0x42>
+  r = -1;
+8010022e:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+80100233:	e9 41 ff ff ff       	jmp    80100179 <await+0x42>
+    return -1;
+80100238:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+8010023d:	e9 54 ff ff ff       	jmp    80100196 <await+0x5f>
+80100242:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+80100247:	e9 4a ff ff ff       	jmp    80100196 <await+0x5f>
+
+8010024c <aiofree>:
+
+// Abandon p's outstanding reads.
+void
+aiofree(struct proc *p)
+{
+8010024c:	55                   	push   %ebp
+8010024d:	89 e5                	mov    %esp,%ebp
+8010024f:	56                   	push   %esi
+80100250:	53                   	push   %ebx
+80100251:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct aio *a;
+
+  for(a = p->aio; a < &p->aio[NAIO]; a++){
+80100254:	8d 9e 28 02 00 00    	lea    0x228(%esi),%ebx
+8010025a:	eb 03                	jmp    8010025f <aiofree+0x13>
+8010025c:	83 c3 10             	add    $0x10,%ebx
+8010025f:	8d 86 a8 02 00 00    	lea    0x2a8(%esi),%eax
+80100265:	39 c3                	cmp    %eax,%ebx
+80100267:	73 1a                	jae    80100283 <aiofree+0x37>
+    if(a->f){
+80100269:	8b 03                	mov    (%ebx),%eax
+8010026b:	85 c0                	test   %eax,%eax
+8010026d:	74 ed                	je     8010025c <aiofree+0x10>
+      fileclose(a->f);
+8010026f:	83 ec 0c             	sub    $0xc,%esp
+80100272:	50                   	push   %eax
+80100273:	e8 fd 14 00 00       	call   80101775 <fileclose>
+      a->f = 0;
+80100278:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+8010027e:	83 c4 10             	add    $0x10,%esp
+80100281:	eb d9                	jmp    8010025c <aiofree+0x10>
+    }
+  }
+}
+80100283:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80100286:	5b                   	pop    %ebx
+80100287:	5e                   	pop    %esi
+80100288:	5d                   	pop    %ebp
+80100289:	c3                   	ret
+
+8010028a <hash>:
+} bcache;
+
+static struct bucket*
+hash(uint dev, uint blockno)
+{
+  return &bcache.bucket[(dev * 1009 + blockno) % NBUCKET];
+8010028a:	69 c0 f1 03 00 00    	imul   $0x3f1,%eax,%eax
+80100290:	8d 0c 10             	lea    (%eax,%edx,1),%ecx
+80100293:	ba bf bf 8c 82       	mov    $0x828cbfbf,%edx
+80100298:	89 c8                	mov    %ecx,%eax
+8010029a:	f7 e2                	mul    %edx
+8010029c:	c1 ea 07             	shr    $0x7,%edx
+8010029f:	69 c2 fb 00 00 00    	imul   $0xfb,%edx,%eax
+801002a5:	29 c1                	sub    %eax,%ecx
+801002a7:	6b d1 3c             	imul   $0x3c,%ecx,%edx
+801002aa:	8d 82 ec f5 10 80    	lea    -0x7fef0a14(%edx),%eax
+}
+801002b0:	c3                   	ret
+
+801002b1 <qpush>:
+
+// Add b to the front of queue q.  Caller holds lrulock.
+static void
+qpush(struct buf *q, struct buf *b)
+{
+  b->next = q->next;
+801002b1:	8b 48 54             	mov    0x54(%eax),%ecx
+801002b4:	89 4a 54             	mov    %ecx,0x54(%edx)
+  b->prev = q;
+801002b7:	89 42 50             	mov    %eax,0x50(%edx)
+  q->next->prev = b;
+801002ba:	8b 48 54             	mov    0x54(%eax),%ecx
+801002bd:	89 51 50             	mov    %edx,0x50(%ecx)
+  q->next = b;
+801002c0:	89 50 54             	mov    %edx,0x54(%eax)
+}
+801002c3:	c3                   	ret
+
+801002c4 <qremove>:
+
+// Remove b from its queue.  Caller holds lrulock.
+static void
+qremove(struct buf *b)
+{
+  b->next->prev = b->prev;
+801002c4:	8b 48 54             	mov    0x54(%eax),%ecx
+801002c7:	8b 50 50             	mov    0x50(%eax),%edx
+801002ca:	89 51 50             	mov    %edx,0x50(%ecx)
+  b->prev->next = b->next;
+801002cd:	8b 40 54             	mov    0x54(%eax),%eax
+801002d0:	89 42 54             	mov    %eax,0x54(%edx)
+}
+801002d3:	c3                   	ret
+
+801002d4 <bfind>:
+static struct buf*
+bfind(struct bucket *h, uint dev, uint blockno)
+{
+  struct buf *b;
+
+  for(b = h->head; b; b = b->hnext){
+801002d4:	8b 40 34             	mov    0x34(%eax),%eax
+801002d7:	eb 03                	jmp    801002dc <bfind+0x8>
+801002d9:	8b 40 58             	mov    0x58(%eax),%eax
+801002dc:	85 c0                	test   %eax,%eax
+801002de:	74 14                	je     801002f4 <bfind+0x20>
+    if(b->dev == dev && b->blockno == blockno){
+801002e0:	39 50 04             	cmp    %edx,0x4(%eax)
+801002e3:	75 f4                	jne    801002d9 <bfind+0x5>
+801002e5:	39 48 08             	cmp    %ecx,0x8(%eax)
+801002e8:	75 ef                	jne    801002d9 <bfind+0x5>
+      b->refcnt++;
+801002ea:	8b 48 4c             	mov    0x4c(%eax),%ecx
+801002ed:	8d 51 01             	lea    0x1(%ecx),%edx
+801002f0:	89 50 4c             	mov    %edx,0x4c(%eax)
+      return b;
+801002f3:	c3                   	ret
+    }
+  }
+  return 0;
+}
+801002f4:	c3                   	ret
+
+801002f5 <qvictim>:
+
+// Find an unused buffer on queue q, starting from the
+// least recently used end.  Caller holds lrulock.
+static struct buf*
+qvictim(struct buf *q)
+{
+801002f5:	89 c2                	mov    %eax,%edx
+  struct buf *b;
+
+  // Even if refcnt==0, B_DIRTY indicates a buffer is in use
+  // because log.c has modified it but not yet committed it.
+  for(b = q->prev; b != q; b = b->prev)
+801002f7:	8b 40 50             	mov    0x50(%eax),%eax
+801002fa:	eb 03                	jmp    801002ff <qvictim+0xa>
+801002fc:	8b 40 50             	mov    0x50(%eax),%eax
+801002ff:	39 d0                	cmp    %edx,%eax
+80100301:	74 0d                	je     80100310 <qvictim+0x1b>
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0)
+80100303:	83 78 4c 00          	cmpl   $0x0,0x4c(%eax)
+80100307:	75 f3                	jne    801002fc <qvictim+0x7>
+80100309:	f6 00 04             	testb  $0x4,(%eax)
+8010030c:	75 ee                	jne    801002fc <qvictim+0x7>
+8010030e:	eb 05                	jmp    80100315 <qvictim+0x20>
+      return b;
+  return 0;
+80100310:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80100315:	c3                   	ret
+
+80100316 <ghost>:
+
+// Was block recently evicted from A1in?  If so, forget it,
+// since it's about to be cached again.  Caller holds evictlock.
+static int
+ghost(uint dev, uint blockno)
+{
+80100316:	55                   	push   %ebp
+80100317:	89 e5                	mov    %esp,%ebp
+80100319:	53                   	push   %ebx
+8010031a:	89 c3                	mov    %eax,%ebx
+  struct ghost *g;
+
+  for(g = bcache.a1out; g < &bcache.a1out[bcache.nout]; g++){
+8010031c:	b8 b8 35 11 80       	mov    $0x801135b8,%eax
+80100321:	eb 03                	jmp    80100326 <ghost+0x10>
+80100323:	83 c0 08             	add    $0x8,%eax
+80100326:	8b 0d b8 75 11 80    	mov    0x801175b8,%ecx
+8010032c:	8d 0c cd b8 35 11 80 	lea    -0x7feeca48(,%ecx,8),%ecx
+80100333:	39 c8                	cmp    %ecx,%eax
+80100335:	73 17                	jae    8010034e <ghost+0x38>
+    if(g->dev == dev && g->blockno == blockno){
+80100337:	39 18                	cmp    %ebx,(%eax)
+80100339:	75 e8                	jne    80100323 <ghost+0xd>
+8010033b:	39 50 04             	cmp    %edx,0x4(%eax)
+8010033e:	75 e3                	jne    80100323 <ghost+0xd>
+      g->blockno = ~0;
+80100340:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+      return 1;
+80100347:	b8 01 00 00 00       	mov    $0x1,%eax
+8010034c:	eb 05                	jmp    80100353 <ghost+0x3d>
+    }
+  }
+  return 0;
+8010034e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80100353:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100356:	c9                   	leave
+80100357:	c3                   	ret
+
+80100358 <bunref>:
+// Drop a reference to b.  If it is on Am and no one else
+// holds it, move it to the head of Am; A1in is kept in the
+// order blocks were read.
+static void
+bunref(struct buf *b)
+{
+80100358:	55                   	push   %ebp
+80100359:	89 e5                	mov    %esp,%ebp
+8010035b:	56                   	push   %esi
+8010035c:	53                   	push   %ebx
+8010035d:	89 c3                	mov    %eax,%ebx
+  struct bucket *h;
+
+  h = hash(b->dev, b->blockno);
+8010035f:	8b 50 08             	mov    0x8(%eax),%edx
+80100362:	8b 40 04             	mov    0x4(%eax),%eax
+80100365:	e8 20 ff ff ff       	call   8010028a <hash>
+8010036a:	89 c6                	mov    %eax,%esi
+  acquire(&h->lock);
+8010036c:	83 ec 0c             	sub    $0xc,%esp
+8010036f:	50                   	push   %eax
+80100370:	e8 1d 77 00 00       	call   80107a92 <acquire>
+  b->refcnt--;
+80100375:	8b 43 4c             	mov    0x4c(%ebx),%eax
+80100378:	83 e8 01             	sub    $0x1,%eax
+8010037b:	89 43 4c             	mov    %eax,0x4c(%ebx)
+  if (b->refcnt == 0 && b->hot) {
+8010037e:	83 c4 10             	add    $0x10,%esp
+80100381:	85 c0                	test   %eax,%eax
+80100383:	75 06                	jne    8010038b <bunref+0x33>
+80100385:	83 7b 5c 00          	cmpl   $0x0,0x5c(%ebx)
+80100389:	75 13                	jne    8010039e <bunref+0x46>
+    acquire(&bcache.lrulock);
+    qremove(b);
+    qpush(&bcache.am, b);
+    release(&bcache.lrulock);
+  }
+  release(&h->lock);
+8010038b:	83 ec 0c             	sub    $0xc,%esp
+8010038e:	56                   	push   %esi
+8010038f:	e8 63 77 00 00       	call   80107af7 <release>
+}
+80100394:	83 c4 10             	add    $0x10,%esp
+80100397:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010039a:	5b                   	pop    %ebx
+8010039b:	5e                   	pop    %esi
+8010039c:	5d                   	pop    %ebp
+8010039d:	c3                   	ret
+    acquire(&bcache.lrulock);
+8010039e:	83 ec 0c             	sub    $0xc,%esp
+801003a1:	68 b4 f5 10 80       	push   $0x8010f5b4
+801003a6:	e8 e7 76 00 00       	call   80107a92 <acquire>
+    qremove(b);
+801003ab:	89 d8                	mov    %ebx,%eax
+801003ad:	e8 12 ff ff ff       	call   801002c4 <qremove>
+    qpush(&bcache.am, b);
+801003b2:	89 da                	mov    %ebx,%edx
+801003b4:	b8 3c 33 11 80       	mov    $0x8011333c,%eax
+801003b9:	e8 f3 fe ff ff       	call   801002b1 <qpush>
+    release(&bcache.lrulock);
+801003be:	c7 04 24 b4 f5 10 80 	movl   $0x8010f5b4,(%esp)
+801003c5:	e8 2d 77 00 00       	call   80107af7 <release>
+801003ca:	83 c4 10             	add    $0x10,%esp
+801003cd:	eb bc                	jmp    8010038b <bunref+0x33>
+
+801003cf <bevict>:
+{
+801003cf:	55                   	push   %ebp
+801003d0:	89 e5                	mov    %esp,%ebp
+801003d2:	56                   	push   %esi
+801003d3:	53                   	push   %ebx
+801003d4:	eb 5c                	jmp    80100432 <bevict+0x63>
+      b = qvictim(&bcache.am);
+801003d6:	b8 3c 33 11 80       	mov    $0x8011333c,%eax
+801003db:	e8 15 ff ff ff       	call   801002f5 <qvictim>
+801003e0:	89 c3                	mov    %eax,%ebx
+    if(b == 0)
+801003e2:	85 c0                	test   %eax,%eax
+801003e4:	0f 84 8e 00 00 00    	je     80100478 <bevict+0xa9>
+    release(&bcache.lrulock);
+801003ea:	83 ec 0c             	sub    $0xc,%esp
+801003ed:	68 b4 f5 10 80       	push   $0x8010f5b4
+801003f2:	e8 00 77 00 00       	call   80107af7 <release>
+    if(b == 0)
+801003f7:	83 c4 10             	add    $0x10,%esp
+801003fa:	85 db                	test   %ebx,%ebx
+801003fc:	0f 84 87 00 00 00    	je     80100489 <bevict+0xba>
+    h = hash(b->dev, b->blockno);
+80100402:	8b 53 08             	mov    0x8(%ebx),%edx
+80100405:	8b 43 04             	mov    0x4(%ebx),%eax
+80100408:	e8 7d fe ff ff       	call   8010028a <hash>
+8010040d:	89 c6                	mov    %eax,%esi
+    acquire(&h->lock);
+8010040f:	83 ec 0c             	sub    $0xc,%esp
+80100412:	50                   	push   %eax
+80100413:	e8 7a 76 00 00       	call   80107a92 <acquire>
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0){
+80100418:	83 c4 10             	add    $0x10,%esp
+8010041b:	83 7b 4c 00          	cmpl   $0x0,0x4c(%ebx)
+8010041f:	75 05                	jne    80100426 <bevict+0x57>
+80100421:	f6 03 04             	testb  $0x4,(%ebx)
+80100424:	74 70                	je     80100496 <bevict+0xc7>
+    release(&h->lock);
+80100426:	83 ec 0c             	sub    $0xc,%esp
+80100429:	56                   	push   %esi
+8010042a:	e8 c8 76 00 00       	call   80107af7 <release>
+    acquire(&bcache.lrulock);
+8010042f:	83 c4 10             	add    $0x10,%esp
+80100432:	83 ec 0c             	sub    $0xc,%esp
+80100435:	68 b4 f5 10 80       	push   $0x8010f5b4
+8010043a:	e8 53 76 00 00       	call   80107a92 <acquire>
+    if(bcache.nin > bcache.maxbuf / 4)
+8010043f:	8b 15 c4 30 11 80    	mov    0x801130c4,%edx
+80100445:	8d 42 03             	lea    0x3(%edx),%eax
+80100448:	83 c4 10             	add    $0x10,%esp
+8010044b:	85 d2                	test   %edx,%edx
+8010044d:	0f 49 c2             	cmovns %edx,%eax
+80100450:	c1 f8 02             	sar    $0x2,%eax
+80100453:	39 05 b0 35 11 80    	cmp    %eax,0x801135b0
+80100459:	0f 8e 77 ff ff ff    	jle    801003d6 <bevict+0x7>
+      b = qvictim(&bcache.a1in);
+8010045f:	b8 c8 30 11 80       	mov    $0x801130c8,%eax
+80100464:	e8 8c fe ff ff       	call   801002f5 <qvictim>
+80100469:	89 c3                	mov    %eax,%ebx
+    if(b == 0)
+8010046b:	85 c0                	test   %eax,%eax
+8010046d:	0f 85 77 ff ff ff    	jne    801003ea <bevict+0x1b>
+80100473:	e9 5e ff ff ff       	jmp    801003d6 <bevict+0x7>
+      b = qvictim(&bcache.a1in);
+80100478:	b8 c8 30 11 80       	mov    $0x801130c8,%eax
+8010047d:	e8 73 fe ff ff       	call   801002f5 <qvictim>
+80100482:	89 c3                	mov    %eax,%ebx
+80100484:	e9 61 ff ff ff       	jmp    801003ea <bevict+0x1b>
+      panic("bget: no buffers");
+80100489:	83 ec 0c             	sub    $0xc,%esp
+8010048c:	68 60 b9 10 80       	push   $0x8010b960
+80100491:	e8 95 08 00 00       	call   80100d2b <panic>
+      acquire(&bcache.lrulock);
+80100496:	83 ec 0c             	sub    $0xc,%esp
+80100499:	68 b4 f5 10 80       	push   $0x8010f5b4
+8010049e:	e8 ef 75 00 00       	call   80107a92 <acquire>
+      qremove(b);
+801004a3:	89 d8                	mov    %ebx,%eax
+801004a5:	e8 1a fe ff ff       	call   801002c4 <qremove>
+      if(b->hot)
+801004aa:	83 c4 10             	add    $0x10,%esp
+801004ad:	83 7b 5c 00          	cmpl   $0x0,0x5c(%ebx)
+801004b1:	74 2f                	je     801004e2 <bevict+0x113>
+        bcache.nam--;
+801004b3:	a1 b4 35 11 80       	mov    0x801135b4,%eax
+801004b8:	83 e8 01             	sub    $0x1,%eax
+801004bb:	a3 b4 35 11 80       	mov    %eax,0x801135b4
+      release(&bcache.lrulock);
+801004c0:	83 ec 0c             	sub    $0xc,%esp
+801004c3:	68 b4 f5 10 80       	push   $0x8010f5b4
+801004c8:	e8 2a 76 00 00       	call   80107af7 <release>
+      for(pp = &h->head; *pp; pp = &(*pp)->hnext){
+801004cd:	8d 56 34             	lea    0x34(%esi),%edx
+801004d0:	83 c4 10             	add    $0x10,%esp
+801004d3:	8b 02                	mov    (%edx),%eax
+801004d5:	85 c0                	test   %eax,%eax
+801004d7:	74 1d                	je     801004f6 <bevict+0x127>
+        if(*pp == b){
+801004d9:	39 d8                	cmp    %ebx,%eax
+801004db:	74 14                	je     801004f1 <bevict+0x122>
+      for(pp = &h->head; *pp; pp = &(*pp)->hnext){
+801004dd:	8d 50 58             	lea    0x58(%eax),%edx
+801004e0:	eb f1                	jmp    801004d3 <bevict+0x104>
+        bcache.nin--;
+801004e2:	a1 b0 35 11 80       	mov    0x801135b0,%eax
+801004e7:	83 e8 01             	sub    $0x1,%eax
+801004ea:	a3 b0 35 11 80       	mov    %eax,0x801135b0
+801004ef:	eb cf                	jmp    801004c0 <bevict+0xf1>
+          *pp = b->hnext;
+801004f1:	8b 43 58             	mov    0x58(%ebx),%eax
+801004f4:	89 02                	mov    %eax,(%edx)
+      release(&h->lock);
+801004f6:	83 ec 0c             	sub    $0xc,%esp
+801004f9:	56                   	push   %esi
+801004fa:	e8 f8 75 00 00       	call   80107af7 <release>
+  bcache.evictions++;
+801004ff:	a1 c4 75 11 80       	mov    0x801175c4,%eax
+80100504:	83 c0 01             	add    $0x1,%eax
+80100507:	a3 c4 75 11 80       	mov    %eax,0x801175c4
+  if(!b->hot){
+8010050c:	83 c4 10             	add    $0x10,%esp
+8010050f:	83 7b 5c 00          	cmpl   $0x0,0x5c(%ebx)
+80100513:	74 09                	je     8010051e <bevict+0x14f>
+}
+80100515:	89 d8                	mov    %ebx,%eax
+80100517:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010051a:	5b                   	pop    %ebx
+8010051b:	5e                   	pop    %esi
+8010051c:	5d                   	pop    %ebp
+8010051d:	c3                   	ret
+    bcache.a1out[bcache.outnext].dev = b->dev;
+8010051e:	a1 bc 75 11 80       	mov    0x801175bc,%eax
+80100523:	8b 4b 04             	mov    0x4(%ebx),%ecx
+80100526:	8d 90 06 08 00 00    	lea    0x806(%eax),%edx
+8010052c:	89 0c d5 88 f5 10 80 	mov    %ecx,-0x7fef0a78(,%edx,8)
+    bcache.a1out[bcache.outnext].blockno = b->blockno;
+80100533:	8b 4b 08             	mov    0x8(%ebx),%ecx
+80100536:	89 0c d5 8c f5 10 80 	mov    %ecx,-0x7fef0a74(,%edx,8)
+    bcache.outnext = (bcache.outnext + 1) % bcache.nout;
+8010053d:	83 c0 01             	add    $0x1,%eax
+80100540:	99                   	cltd
+80100541:	f7 3d b8 75 11 80    	idivl  0x801175b8
+80100547:	89 15 bc 75 11 80    	mov    %edx,0x801175bc
+  return b;
+8010054d:	eb c6                	jmp    80100515 <bevict+0x146>
+
+8010054f <bref>:
+{
+8010054f:	55                   	push   %ebp
+80100550:	89 e5                	mov    %esp,%ebp
+80100552:	57                   	push   %edi
+80100553:	56                   	push   %esi
+80100554:	53                   	push   %ebx
+80100555:	83 ec 1c             	sub    $0x1c,%esp
+80100558:	89 c6                	mov    %eax,%esi
+8010055a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010055d:	89 d7                	mov    %edx,%edi
+  h = hash(dev, blockno);
+8010055f:	e8 26 fd ff ff       	call   8010028a <hash>
+80100564:	89 c3                	mov    %eax,%ebx
+  acquire(&h->lock);
+80100566:	83 ec 0c             	sub    $0xc,%esp
+80100569:	50                   	push   %eax
+8010056a:	e8 23 75 00 00       	call   80107a92 <acquire>
+  if((b = bfind(h, dev, blockno)) != 0)
+8010056f:	89 f9                	mov    %edi,%ecx
+80100571:	89 f2                	mov    %esi,%edx
+80100573:	89 d8                	mov    %ebx,%eax
+80100575:	e8 5a fd ff ff       	call   801002d4 <bfind>
+8010057a:	89 c6                	mov    %eax,%esi
+8010057c:	83 c4 10             	add    $0x10,%esp
+8010057f:	85 c0                	test   %eax,%eax
+80100581:	74 09                	je     8010058c <bref+0x3d>
+    h->hits++;
+80100583:	8b 43 38             	mov    0x38(%ebx),%eax
+80100586:	83 c0 01             	add    $0x1,%eax
+80100589:	89 43 38             	mov    %eax,0x38(%ebx)
+  release(&h->lock);
+8010058c:	83 ec 0c             	sub    $0xc,%esp
+8010058f:	53                   	push   %ebx
+80100590:	e8 62 75 00 00       	call   80107af7 <release>
+  if(b)
+80100595:	83 c4 10             	add    $0x10,%esp
+80100598:	85 f6                	test   %esi,%esi
+8010059a:	74 0a                	je     801005a6 <bref+0x57>
+}
+8010059c:	89 f0                	mov    %esi,%eax
+8010059e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801005a1:	5b                   	pop    %ebx
+801005a2:	5e                   	pop    %esi
+801005a3:	5f                   	pop    %edi
+801005a4:	5d                   	pop    %ebp
+801005a5:	c3                   	ret
+  acquire(&bcache.evictlock);
+801005a6:	83 ec 0c             	sub    $0xc,%esp
+801005a9:	68 80 f5 10 80       	push   $0x8010f580
+801005ae:	e8 df 74 00 00       	call   80107a92 <acquire>
+  acquire(&h->lock);
+801005b3:	89 1c 24             	mov    %ebx,(%esp)
+801005b6:	e8 d7 74 00 00       	call   80107a92 <acquire>
+  if((b = bfind(h, dev, blockno)) != 0)
+801005bb:	89 f9                	mov    %edi,%ecx
+801005bd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801005c0:	89 d8                	mov    %ebx,%eax
+801005c2:	e8 0d fd ff ff       	call   801002d4 <bfind>
+801005c7:	89 c6                	mov    %eax,%esi
+801005c9:	83 c4 10             	add    $0x10,%esp
+801005cc:	85 c0                	test   %eax,%eax
+801005ce:	74 09                	je     801005d9 <bref+0x8a>
+    h->hits++;
+801005d0:	8b 43 38             	mov    0x38(%ebx),%eax
+801005d3:	83 c0 01             	add    $0x1,%eax
+801005d6:	89 43 38             	mov    %eax,0x38(%ebx)
+  release(&h->lock);
+801005d9:	83 ec 0c             	sub    $0xc,%esp
+801005dc:	53                   	push   %ebx
+801005dd:	e8 15 75 00 00       	call   80107af7 <release>
+  if(b == 0){
+801005e2:	83 c4 10             	add    $0x10,%esp
+801005e5:	85 f6                	test   %esi,%esi
+801005e7:	74 12                	je     801005fb <bref+0xac>
+  release(&bcache.evictlock);
+801005e9:	83 ec 0c             	sub    $0xc,%esp
+801005ec:	68 80 f5 10 80       	push   $0x8010f580
+801005f1:	e8 01 75 00 00       	call   80107af7 <release>
+  return b;
+801005f6:	83 c4 10             	add    $0x10,%esp
+801005f9:	eb a1                	jmp    8010059c <bref+0x4d>
+    bcache.misses++;
+801005fb:	a1 c0 75 11 80       	mov    0x801175c0,%eax
+80100600:	83 c0 01             	add    $0x1,%eax
+80100603:	a3 c0 75 11 80       	mov    %eax,0x801175c0
+    if(bcache.nbuf < bcache.maxbuf && (b = kmcache_alloc(bcache.cache)) != 0){
+80100608:	a1 c4 30 11 80       	mov    0x801130c4,%eax
+8010060d:	39 05 c0 30 11 80    	cmp    %eax,0x801130c0
+80100613:	0f 8c 9a 00 00 00    	jl     801006b3 <bref+0x164>
+    if(b == 0)
+80100619:	85 f6                	test   %esi,%esi
+8010061b:	0f 84 cf 00 00 00    	je     801006f0 <bref+0x1a1>
+    b->dev = dev;
+80100621:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80100624:	89 46 04             	mov    %eax,0x4(%esi)
+    b->blockno = blockno;
+80100627:	89 7e 08             	mov    %edi,0x8(%esi)
+    b->flags = 0;
+8010062a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    b->refcnt = 1;
+80100630:	c7 46 4c 01 00 00 00 	movl   $0x1,0x4c(%esi)
+    b->hot = ghost(dev, blockno);
+80100637:	89 fa                	mov    %edi,%edx
+80100639:	e8 d8 fc ff ff       	call   80100316 <ghost>
+8010063e:	89 46 5c             	mov    %eax,0x5c(%esi)
+    if(b->hot)
+80100641:	85 c0                	test   %eax,%eax
+80100643:	74 0d                	je     80100652 <bref+0x103>
+      bcache.promotions++;
+80100645:	a1 c8 75 11 80       	mov    0x801175c8,%eax
+8010064a:	83 c0 01             	add    $0x1,%eax
+8010064d:	a3 c8 75 11 80       	mov    %eax,0x801175c8
+    acquire(&h->lock);
+80100652:	83 ec 0c             	sub    $0xc,%esp
+80100655:	53                   	push   %ebx
+80100656:	e8 37 74 00 00       	call   80107a92 <acquire>
+    acquire(&bcache.lrulock);
+8010065b:	c7 04 24 b4 f5 10 80 	movl   $0x8010f5b4,(%esp)
+80100662:	e8 2b 74 00 00       	call   80107a92 <acquire>
+    if(b->hot){
+80100667:	83 c4 10             	add    $0x10,%esp
+8010066a:	83 7e 5c 00          	cmpl   $0x0,0x5c(%esi)
+8010066e:	0f 84 88 00 00 00    	je     801006fc <bref+0x1ad>
+      qpush(&bcache.am, b);
+80100674:	89 f2                	mov    %esi,%edx
+80100676:	b8 3c 33 11 80       	mov    $0x8011333c,%eax
+8010067b:	e8 31 fc ff ff       	call   801002b1 <qpush>
+      bcache.nam++;
+80100680:	a1 b4 35 11 80       	mov    0x801135b4,%eax
+80100685:	83 c0 01             	add    $0x1,%eax
+80100688:	a3 b4 35 11 80       	mov    %eax,0x801135b4
+    release(&bcache.lrulock);
+8010068d:	83 ec 0c             	sub    $0xc,%esp
+80100690:	68 b4 f5 10 80       	push   $0x8010f5b4
+80100695:	e8 5d 74 00 00       	call   80107af7 <release>
+    b->hnext = h->head;
+8010069a:	8b 43 34             	mov    0x34(%ebx),%eax
+8010069d:	89 46 58             	mov    %eax,0x58(%esi)
+    h->head = b;
+801006a0:	89 73 34             	mov    %esi,0x34(%ebx)
+    release(&h->lock);
+801006a3:	89 1c 24             	mov    %ebx,(%esp)
+801006a6:	e8 4c 74 00 00       	call   80107af7 <release>
+801006ab:	83 c4 10             	add    $0x10,%esp
+801006ae:	e9 36 ff ff ff       	jmp    801005e9 <bref+0x9a>
+    if(bcache.nbuf < bcache.maxbuf && (b = kmcache_alloc(bcache.cache)) != 0){
+801006b3:	83 ec 0c             	sub    $0xc,%esp
+801006b6:	ff 35 e8 f5 10 80    	push   0x8010f5e8
+801006bc:	e8 c8 6f 00 00       	call   80107689 <kmcache_alloc>
+801006c1:	89 c6                	mov    %eax,%esi
+801006c3:	83 c4 10             	add    $0x10,%esp
+801006c6:	85 c0                	test   %eax,%eax
+801006c8:	74 26                	je     801006f0 <bref+0x1a1>
+      initsleeplock(&b->lock, "buffer");
+801006ca:	83 ec 08             	sub    $0x8,%esp
+801006cd:	68 c2 b9 10 80       	push   $0x8010b9c2
+801006d2:	8d 40 0c             	lea    0xc(%eax),%eax
+801006d5:	50                   	push   %eax
+801006d6:	e8 de 6b 00 00       	call   801072b9 <initsleeplock>
+      bcache.nbuf++;
+801006db:	a1 c0 30 11 80       	mov    0x801130c0,%eax
+801006e0:	83 c0 01             	add    $0x1,%eax
+801006e3:	a3 c0 30 11 80       	mov    %eax,0x801130c0
+801006e8:	83 c4 10             	add    $0x10,%esp
+801006eb:	e9 29 ff ff ff       	jmp    80100619 <bref+0xca>
+      b = bevict();
+801006f0:	e8 da fc ff ff       	call   801003cf <bevict>
+801006f5:	89 c6                	mov    %eax,%esi
+801006f7:	e9 25 ff ff ff       	jmp    80100621 <bref+0xd2>
+      qpush(&bcache.a1in, b);
+801006fc:	89 f2                	mov    %esi,%edx
+801006fe:	b8 c8 30 11 80       	mov    $0x801130c8,%eax
+80100703:	e8 a9 fb ff ff       	call   801002b1 <qpush>
+      bcache.nin++;
+80100708:	a1 b0 35 11 80       	mov    0x801135b0,%eax
+8010070d:	83 c0 01             	add    $0x1,%eax
+80100710:	a3 b0 35 11 80       	mov    %eax,0x801135b0
+80100715:	e9 73 ff ff ff       	jmp    8010068d <bref+0x13e>
+
+8010071a <bget>:
+
+// Return locked buffer for block on device dev.
+static struct buf*
+bget(uint dev, uint blockno)
+{
+8010071a:	55                   	push   %ebp
+8010071b:	89 e5                	mov    %esp,%ebp
+8010071d:	53                   	push   %ebx
+8010071e:	83 ec 04             	sub    $0x4,%esp
+  struct buf *b;
+
+  b = bref(dev, blockno);
+80100721:	e8 29 fe ff ff       	call   8010054f <bref>
+80100726:	89 c3                	mov    %eax,%ebx
+  acquiresleep(&b->lock);
+80100728:	83 ec 0c             	sub    $0xc,%esp
+8010072b:	8d 40 0c             	lea    0xc(%eax),%eax
+8010072e:	50                   	push   %eax
+8010072f:	e8 b8 6b 00 00       	call   801072ec <acquiresleep>
+  return b;
+}
+80100734:	89 d8                	mov    %ebx,%eax
+80100736:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100739:	c9                   	leave
+8010073a:	c3                   	ret
+
+8010073b <binit>:
+{
+8010073b:	55                   	push   %ebp
+8010073c:	89 e5                	mov    %esp,%ebp
+8010073e:	53                   	push   %ebx
+8010073f:	83 ec 0c             	sub    $0xc,%esp
+  initlock(&bcache.evictlock, "bcache.evict");
+80100742:	68 71 b9 10 80       	push   $0x8010b971
+80100747:	68 80 f5 10 80       	push   $0x8010f580
+8010074c:	e8 fd 71 00 00       	call   8010794e <initlock>
+  initlock(&bcache.lrulock, "bcache.lru");
+80100751:	83 c4 08             	add    $0x8,%esp
+80100754:	68 7e b9 10 80       	push   $0x8010b97e
+80100759:	68 b4 f5 10 80       	push   $0x8010f5b4
+8010075e:	e8 eb 71 00 00       	call   8010794e <initlock>
+  for(i = 0; i < NBUCKET; i++)
+80100763:	83 c4 10             	add    $0x10,%esp
+80100766:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010076b:	eb 1c                	jmp    80100789 <binit+0x4e>
+    initlock(&bcache.bucket[i].lock, "bcache.bucket");
+8010076d:	83 ec 08             	sub    $0x8,%esp
+80100770:	68 89 b9 10 80       	push   $0x8010b989
+80100775:	6b c3 3c             	imul   $0x3c,%ebx,%eax
+80100778:	05 ec f5 10 80       	add    $0x8010f5ec,%eax
+8010077d:	50                   	push   %eax
+8010077e:	e8 cb 71 00 00       	call   8010794e <initlock>
+  for(i = 0; i < NBUCKET; i++)
+80100783:	83 c3 01             	add    $0x1,%ebx
+80100786:	83 c4 10             	add    $0x10,%esp
+80100789:	81 fb fa 00 00 00    	cmp    $0xfa,%ebx
+8010078f:	7e dc                	jle    8010076d <binit+0x32>
+  bcache.cache = kmcache_create("buf", sizeof(struct buf));
+80100791:	83 ec 08             	sub    $0x8,%esp
+80100794:	68 74 02 00 00       	push   $0x274
+80100799:	68 97 b9 10 80       	push   $0x8010b997
+8010079e:	e8 1a 6e 00 00       	call   801075bd <kmcache_create>
+801007a3:	a3 e8 f5 10 80       	mov    %eax,0x8010f5e8
+  bcache.maxbuf = phystop / BUFFRAC / sizeof(struct buf);
+801007a8:	ba f3 a7 2d 34       	mov    $0x342da7f3,%edx
+801007ad:	89 d0                	mov    %edx,%eax
+801007af:	f7 25 60 1c 12 80    	mull   0x80121c60
+801007b5:	c1 ea 0d             	shr    $0xd,%edx
+801007b8:	89 15 c4 30 11 80    	mov    %edx,0x801130c4
+  if(bcache.maxbuf < NBUF)
+801007be:	83 c4 10             	add    $0x10,%esp
+801007c1:	83 fa 77             	cmp    $0x77,%edx
+801007c4:	7f 0a                	jg     801007d0 <binit+0x95>
+    bcache.maxbuf = NBUF;
+801007c6:	c7 05 c4 30 11 80 78 	movl   $0x78,0x801130c4
+801007cd:	00 00 00 
+  if(bcache.maxbuf > MAXNBUF)
+801007d0:	81 3d c4 30 11 80 00 	cmpl   $0x1000,0x801130c4
+801007d7:	10 00 00 
+801007da:	7e 0a                	jle    801007e6 <binit+0xab>
+    bcache.maxbuf = MAXNBUF;
+801007dc:	c7 05 c4 30 11 80 00 	movl   $0x1000,0x801130c4
+801007e3:	10 00 00 
+  bcache.nout = bcache.maxbuf / 2;
+801007e6:	a1 c4 30 11 80       	mov    0x801130c4,%eax
+801007eb:	89 c2                	mov    %eax,%edx
+801007ed:	c1 ea 1f             	shr    $0x1f,%edx
+801007f0:	01 c2                	add    %eax,%edx
+801007f2:	d1 fa                	sar    %edx
+801007f4:	89 15 b8 75 11 80    	mov    %edx,0x801175b8
+  for(i = 0; i < bcache.nout; i++)
+801007fa:	b8 00 00 00 00       	mov    $0x0,%eax
+801007ff:	eb 0e                	jmp    8010080f <binit+0xd4>
+    bcache.a1out[i].blockno = ~0;
+80100801:	c7 04 c5 bc 35 11 80 	movl   $0xffffffff,-0x7feeca44(,%eax,8)
+80100808:	ff ff ff ff 
+  for(i = 0; i < bcache.nout; i++)
+8010080c:	83 c0 01             	add    $0x1,%eax
+8010080f:	39 c2                	cmp    %eax,%edx
+80100811:	7f ee                	jg     80100801 <binit+0xc6>
+  bcache.a1in.prev = bcache.a1in.next = &bcache.a1in;
+80100813:	c7 05 1c 31 11 80 c8 	movl   $0x801130c8,0x8011311c
+8010081a:	30 11 80 
+8010081d:	c7 05 18 31 11 80 c8 	movl   $0x801130c8,0x80113118
+80100824:	30 11 80 
+  bcache.am.prev = bcache.am.next = &bcache.am;
+80100827:	c7 05 90 33 11 80 3c 	movl   $0x8011333c,0x80113390
+8010082e:	33 11 80 
+80100831:	c7 05 8c 33 11 80 3c 	movl   $0x8011333c,0x8011338c
+80100838:	33 11 80 
+}
+8010083b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010083e:	c9                   	leave
+8010083f:	c3                   	ret
+
+80100840 <bread>:
+
+// Return a locked buf with the contents of the indicated block.
+struct buf*
+bread(uint dev, uint blockno)
+{
+80100840:	55                   	push   %ebp
+80100841:	89 e5                	mov    %esp,%ebp
+80100843:	53                   	push   %ebx
+80100844:	83 ec 04             	sub    $0x4,%esp
+  struct buf *b;
+
+  b = bget(dev, blockno);
+80100847:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010084a:	8b 45 08             	mov    0x8(%ebp),%eax
+8010084d:	e8 c8 fe ff ff       	call   8010071a <bget>
+80100852:	89 c3                	mov    %eax,%ebx
+  if((b->flags & B_VALID) == 0) {
+80100854:	f6 00 02             	testb  $0x2,(%eax)
+80100857:	74 07                	je     80100860 <bread+0x20>
+    iderw(b);
+  }
+  return b;
+}
+80100859:	89 d8                	mov    %ebx,%eax
+8010085b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010085e:	c9                   	leave
+8010085f:	c3                   	ret
+    iderw(b);
+80100860:	83 ec 0c             	sub    $0xc,%esp
+80100863:	50                   	push   %eax
+80100864:	e8 de 28 00 00       	call   80103147 <iderw>
+80100869:	83 c4 10             	add    $0x10,%esp
+  return b;
+8010086c:	eb eb                	jmp    80100859 <bread+0x19>
+
+8010086e <bwrite>:
+
+// Write b's contents to disk.  Must be locked.
+void
+bwrite(struct buf *b)
+{
+8010086e:	55                   	push   %ebp
+8010086f:	89 e5                	mov    %esp,%ebp
+80100871:	53                   	push   %ebx
+80100872:	83 ec 10             	sub    $0x10,%esp
+80100875:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holdingsleep(&b->lock))
+80100878:	8d 43 0c             	lea    0xc(%ebx),%eax
+8010087b:	50                   	push   %eax
+8010087c:	e8 40 6b 00 00       	call   801073c1 <holdingsleep>
+80100881:	83 c4 10             	add    $0x10,%esp
+80100884:	85 c0                	test   %eax,%eax
+80100886:	74 18                	je     801008a0 <bwrite+0x32>
+    panic("bwrite");
+  b->flags |= B_DIRTY;
+80100888:	8b 03                	mov    (%ebx),%eax
+8010088a:	83 c8 04             	or     $0x4,%eax
+8010088d:	89 03                	mov    %eax,(%ebx)
+  iderw(b);
+8010088f:	83 ec 0c             	sub    $0xc,%esp
+80100892:	53                   	push   %ebx
+80100893:	e8 af 28 00 00       	call   80103147 <iderw>
+}
+80100898:	83 c4 10             	add    $0x10,%esp
+8010089b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010089e:	c9                   	leave
+8010089f:	c3                   	ret
+    panic("bwrite");
+801008a0:	83 ec 0c             	sub    $0xc,%esp
+801008a3:	68 9b b9 10 80       	push   $0x8010b99b
+801008a8:	e8 7e 04 00 00       	call   80100d2b <panic>
+
+801008ad <bstart>:
+// Return a locked buf for the indicated block, starting to
+// read it from disk if it isn't cached, without waiting.
+// Call bwait before looking at the data.
+struct buf*
+bstart(uint dev, uint blockno)
+{
+801008ad:	55                   	push   %ebp
+801008ae:	89 e5                	mov    %esp,%ebp
+801008b0:	53                   	push   %ebx
+801008b1:	83 ec 04             	sub    $0x4,%esp
+  struct buf *b;
+
+  b = bget(dev, blockno);
+801008b4:	8b 55 0c             	mov    0xc(%ebp),%edx
+801008b7:	8b 45 08             	mov    0x8(%ebp),%eax
+801008ba:	e8 5b fe ff ff       	call   8010071a <bget>
+801008bf:	89 c3                	mov    %eax,%ebx
+  if((b->flags & B_VALID) == 0)
+801008c1:	f6 00 02             	testb  $0x2,(%eax)
+801008c4:	74 07                	je     801008cd <bstart+0x20>
+    idesubmit(b);
+  return b;
+}
+801008c6:	89 d8                	mov    %ebx,%eax
+801008c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801008cb:	c9                   	leave
+801008cc:	c3                   	ret
+    idesubmit(b);
+801008cd:	83 ec 0c             	sub    $0xc,%esp
+801008d0:	50                   	push   %eax
+801008d1:	e8 d9 27 00 00       	call   801030af <idesubmit>
+801008d6:	83 c4 10             	add    $0x10,%esp
+  return b;
+801008d9:	eb eb                	jmp    801008c6 <bstart+0x19>
+
+801008db <bawrite>:
+
+// Start writing b's contents to disk, without waiting.
+// Must be locked.  Call bwait before releasing it.
+void
+bawrite(struct buf *b)
+{
+801008db:	55                   	push   %ebp
+801008dc:	89 e5                	mov    %esp,%ebp
+801008de:	53                   	push   %ebx
+801008df:	83 ec 10             	sub    $0x10,%esp
+801008e2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holdingsleep(&b->lock))
+801008e5:	8d 43 0c             	lea    0xc(%ebx),%eax
+801008e8:	50                   	push   %eax
+801008e9:	e8 d3 6a 00 00       	call   801073c1 <holdingsleep>
+801008ee:	83 c4 10             	add    $0x10,%esp
+801008f1:	85 c0                	test   %eax,%eax
+801008f3:	74 18                	je     8010090d <bawrite+0x32>
+    panic("bawrite");
+  b->flags |= B_DIRTY;
+801008f5:	8b 03                	mov    (%ebx),%eax
+801008f7:	83 c8 04             	or     $0x4,%eax
+801008fa:	89 03                	mov    %eax,(%ebx)
+  idesubmit(b);
+801008fc:	83 ec 0c             	sub    $0xc,%esp
+801008ff:	53                   	push   %ebx
+80100900:	e8 aa 27 00 00       	call   801030af <idesubmit>
+}
+80100905:	83 c4 10             	add    $0x10,%esp
+80100908:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010090b:	c9                   	leave
+8010090c:	c3                   	ret
+    panic("bawrite");
+8010090d:	83 ec 0c             	sub    $0xc,%esp
+80100910:	68 a2 b9 10 80       	push   $0x8010b9a2
+80100915:	e8 11 04 00 00       	call   80100d2b <panic>
+
+8010091a <bwaitany>:
+
+// Wait for any one of the n buffers in bufs to finish its
+// request and return its index.
+int
+bwaitany(struct buf **bufs, int n)
+{
+8010091a:	55                   	push   %ebp
+8010091b:	89 e5                	mov    %esp,%ebp
+8010091d:	57                   	push   %edi
+8010091e:	56                   	push   %esi
+8010091f:	53                   	push   %ebx
+80100920:	83 ec 0c             	sub    $0xc,%esp
+80100923:	8b 7d 08             	mov    0x8(%ebp),%edi
+80100926:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int i;
+
+  for(i = 0; i < n; i++)
+80100929:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010092e:	39 f3                	cmp    %esi,%ebx
+80100930:	7d 28                	jge    8010095a <bwaitany+0x40>
+    if(!holdingsleep(&bufs[i]->lock))
+80100932:	83 ec 0c             	sub    $0xc,%esp
+80100935:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+80100938:	83 c0 0c             	add    $0xc,%eax
+8010093b:	50                   	push   %eax
+8010093c:	e8 80 6a 00 00       	call   801073c1 <holdingsleep>
+80100941:	83 c4 10             	add    $0x10,%esp
+80100944:	85 c0                	test   %eax,%eax
+80100946:	74 05                	je     8010094d <bwaitany+0x33>
+  for(i = 0; i < n; i++)
+80100948:	83 c3 01             	add    $0x1,%ebx
+8010094b:	eb e1                	jmp    8010092e <bwaitany+0x14>
+      panic("bwaitany");
+8010094d:	83 ec 0c             	sub    $0xc,%esp
+80100950:	68 aa b9 10 80       	push   $0x8010b9aa
+80100955:	e8 d1 03 00 00       	call   80100d2b <panic>
+  return idewaitany(bufs, n);
+8010095a:	83 ec 08             	sub    $0x8,%esp
+8010095d:	56                   	push   %esi
+8010095e:	57                   	push   %edi
+8010095f:	e8 74 27 00 00       	call   801030d8 <idewaitany>
+}
+80100964:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100967:	5b                   	pop    %ebx
+80100968:	5e                   	pop    %esi
+80100969:	5f                   	pop    %edi
+8010096a:	5d                   	pop    %ebp
+8010096b:	c3                   	ret
+
+8010096c <bwait>:
+{
+8010096c:	55                   	push   %ebp
+8010096d:	89 e5                	mov    %esp,%ebp
+8010096f:	83 ec 10             	sub    $0x10,%esp
+  bwaitany(&b, 1);
+80100972:	6a 01                	push   $0x1
+80100974:	8d 45 08             	lea    0x8(%ebp),%eax
+80100977:	50                   	push   %eax
+80100978:	e8 9d ff ff ff       	call   8010091a <bwaitany>
+}
+8010097d:	83 c4 10             	add    $0x10,%esp
+80100980:	c9                   	leave
+80100981:	c3                   	ret
+
+80100982 <brelse>:
+
+// Release a locked buffer.
+void
+brelse(struct buf *b)
+{
+80100982:	55                   	push   %ebp
+80100983:	89 e5                	mov    %esp,%ebp
+80100985:	56                   	push   %esi
+80100986:	53                   	push   %ebx
+80100987:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holdingsleep(&b->lock))
+8010098a:	8d 73 0c             	lea    0xc(%ebx),%esi
+8010098d:	83 ec 0c             	sub    $0xc,%esp
+80100990:	56                   	push   %esi
+80100991:	e8 2b 6a 00 00       	call   801073c1 <holdingsleep>
+80100996:	83 c4 10             	add    $0x10,%esp
+80100999:	85 c0                	test   %eax,%eax
+8010099b:	74 1a                	je     801009b7 <brelse+0x35>
+    panic("brelse");
+
+  releasesleep(&b->lock);
+8010099d:	83 ec 0c             	sub    $0xc,%esp
+801009a0:	56                   	push   %esi
+801009a1:	e8 e0 69 00 00       	call   80107386 <releasesleep>
+  bunref(b);
+801009a6:	89 d8                	mov    %ebx,%eax
+801009a8:	e8 ab f9 ff ff       	call   80100358 <bunref>
+}
+801009ad:	83 c4 10             	add    $0x10,%esp
+801009b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801009b3:	5b                   	pop    %ebx
+801009b4:	5e                   	pop    %esi
+801009b5:	5d                   	pop    %ebp
+801009b6:	c3                   	ret
+    panic("brelse");
+801009b7:	83 ec 0c             	sub    $0xc,%esp
+801009ba:	68 b3 b9 10 80       	push   $0x8010b9b3
+801009bf:	e8 67 03 00 00       	call   80100d2b <panic>
+
+801009c4 <bprivate>:
+// Allocate a buffer that is not part of the cache, for writing
+// data to a block without disturbing its cached copy.  The
+// caller locks it and drives it with bawrite and bwaitany.
+struct buf*
+bprivate(uint dev)
+{
+801009c4:	55                   	push   %ebp
+801009c5:	89 e5                	mov    %esp,%ebp
+801009c7:	53                   	push   %ebx
+801009c8:	83 ec 10             	sub    $0x10,%esp
+  struct buf *b;
+
+  if((b = kmcache_alloc(bcache.cache)) == 0)
+801009cb:	ff 35 e8 f5 10 80    	push   0x8010f5e8
+801009d1:	e8 b3 6c 00 00       	call   80107689 <kmcache_alloc>
+801009d6:	89 c3                	mov    %eax,%ebx
+801009d8:	83 c4 10             	add    $0x10,%esp
+801009db:	85 c0                	test   %eax,%eax
+801009dd:	74 2a                	je     80100a09 <bprivate+0x45>
+    return 0;
+  memset(b, 0, sizeof(*b));
+801009df:	83 ec 04             	sub    $0x4,%esp
+801009e2:	68 74 02 00 00       	push   $0x274
+801009e7:	6a 00                	push   $0x0
+801009e9:	50                   	push   %eax
+801009ea:	e8 4f 71 00 00       	call   80107b3e <memset>
+  initsleeplock(&b->lock, "private buffer");
+801009ef:	83 c4 08             	add    $0x8,%esp
+801009f2:	68 ba b9 10 80       	push   $0x8010b9ba
+801009f7:	8d 43 0c             	lea    0xc(%ebx),%eax
+801009fa:	50                   	push   %eax
+801009fb:	e8 b9 68 00 00       	call   801072b9 <initsleeplock>
+  b->dev = dev;
+80100a00:	8b 45 08             	mov    0x8(%ebp),%eax
+80100a03:	89 43 04             	mov    %eax,0x4(%ebx)
+  return b;
+80100a06:	83 c4 10             	add    $0x10,%esp
+}
+80100a09:	89 d8                	mov    %ebx,%eax
+80100a0b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100a0e:	c9                   	leave
+80100a0f:	c3                   	ret
+
+80100a10 <bprefetch>:
+// the block sleeps on the buffer's lock.  Prefetches may tie
+// up at most a quarter of the cache, so that bget() can
+// always find a buffer to recycle.
+void
+bprefetch(uint dev, uint blockno)
+{
+80100a10:	55                   	push   %ebp
+80100a11:	89 e5                	mov    %esp,%ebp
+80100a13:	56                   	push   %esi
+80100a14:	53                   	push   %ebx
+  struct buf *b;
+
+  acquire(&bcache.lrulock);
+80100a15:	83 ec 0c             	sub    $0xc,%esp
+80100a18:	68 b4 f5 10 80       	push   $0x8010f5b4
+80100a1d:	e8 70 70 00 00       	call   80107a92 <acquire>
+  if(bcache.nasync >= bcache.maxbuf / 4){
+80100a22:	8b 0d cc 75 11 80    	mov    0x801175cc,%ecx
+80100a28:	8b 15 c4 30 11 80    	mov    0x801130c4,%edx
+80100a2e:	8d 42 03             	lea    0x3(%edx),%eax
+80100a31:	83 c4 10             	add    $0x10,%esp
+80100a34:	85 d2                	test   %edx,%edx
+80100a36:	0f 49 c2             	cmovns %edx,%eax
+80100a39:	c1 f8 02             	sar    $0x2,%eax
+80100a3c:	39 c1                	cmp    %eax,%ecx
+80100a3e:	0f 8d 87 00 00 00    	jge    80100acb <bprefetch+0xbb>
+    release(&bcache.lrulock);
+    return;
+  }
+  bcache.nasync++;
+80100a44:	83 c1 01             	add    $0x1,%ecx
+80100a47:	89 0d cc 75 11 80    	mov    %ecx,0x801175cc
+  release(&bcache.lrulock);
+80100a4d:	83 ec 0c             	sub    $0xc,%esp
+80100a50:	68 b4 f5 10 80       	push   $0x8010f5b4
+80100a55:	e8 9d 70 00 00       	call   80107af7 <release>
+
+  b = bref(dev, blockno);
+80100a5a:	8b 55 0c             	mov    0xc(%ebp),%edx
+80100a5d:	8b 45 08             	mov    0x8(%ebp),%eax
+80100a60:	e8 ea fa ff ff       	call   8010054f <bref>
+80100a65:	89 c3                	mov    %eax,%ebx
+  if((b->flags & B_VALID) == 0 && tryacquiresleep(&b->lock)){
+80100a67:	83 c4 10             	add    $0x10,%esp
+80100a6a:	f6 00 02             	testb  $0x2,(%eax)
+80100a6d:	75 25                	jne    80100a94 <bprefetch+0x84>
+80100a6f:	8d 70 0c             	lea    0xc(%eax),%esi
+80100a72:	83 ec 0c             	sub    $0xc,%esp
+80100a75:	56                   	push   %esi
+80100a76:	e8 c0 68 00 00       	call   8010733b <tryacquiresleep>
+80100a7b:	83 c4 10             	add    $0x10,%esp
+80100a7e:	85 c0                	test   %eax,%eax
+80100a80:	74 12                	je     80100a94 <bprefetch+0x84>
+    if((b->flags & B_VALID) == 0){
+80100a82:	8b 03                	mov    (%ebx),%eax
+80100a84:	a8 02                	test   $0x2,%al
+80100a86:	74 55                	je     80100add <bprefetch+0xcd>
+      b->flags |= B_ASYNC;
+      idesubmit(b);
+      return;
+    }
+    releasesleep(&b->lock);
+80100a88:	83 ec 0c             	sub    $0xc,%esp
+80100a8b:	56                   	push   %esi
+80100a8c:	e8 f5 68 00 00       	call   80107386 <releasesleep>
+80100a91:	83 c4 10             	add    $0x10,%esp
+  }
+  bunref(b);
+80100a94:	89 d8                	mov    %ebx,%eax
+80100a96:	e8 bd f8 ff ff       	call   80100358 <bunref>
+  acquire(&bcache.lrulock);
+80100a9b:	83 ec 0c             	sub    $0xc,%esp
+80100a9e:	68 b4 f5 10 80       	push   $0x8010f5b4
+80100aa3:	e8 ea 6f 00 00       	call   80107a92 <acquire>
+  bcache.nasync--;
+80100aa8:	a1 cc 75 11 80       	mov    0x801175cc,%eax
+80100aad:	83 e8 01             	sub    $0x1,%eax
+80100ab0:	a3 cc 75 11 80       	mov    %eax,0x801175cc
+  release(&bcache.lrulock);
+80100ab5:	c7 04 24 b4 f5 10 80 	movl   $0x8010f5b4,(%esp)
+80100abc:	e8 36 70 00 00       	call   80107af7 <release>
+80100ac1:	83 c4 10             	add    $0x10,%esp
+}
+80100ac4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80100ac7:	5b                   	pop    %ebx
+80100ac8:	5e                   	pop    %esi
+80100ac9:	5d                   	pop    %ebp
+80100aca:	c3                   	ret
+    release(&bcache.lrulock);
+80100acb:	83 ec 0c             	sub    $0xc,%esp
+80100ace:	68 b4 f5 10 80       	push   $0x8010f5b4
+80100ad3:	e8 1f 70 00 00       	call   80107af7 <release>
+    return;
+80100ad8:	83 c4 10             	add    $0x10,%esp
+80100adb:	eb e7                	jmp    80100ac4 <bprefetch+0xb4>
+      b->flags |= B_ASYNC;
+80100add:	83 c8 08             	or     $0x8,%eax
+80100ae0:	89 03                	mov    %eax,(%ebx)
+      idesubmit(b);
+80100ae2:	83 ec 0c             	sub    $0xc,%esp
+80100ae5:	53                   	push   %ebx
+80100ae6:	e8 c4 25 00 00       	call   801030af <idesubmit>
+      return;
+80100aeb:	83 c4 10             	add    $0x10,%esp
+80100aee:	eb d4                	jmp    80100ac4 <bprefetch+0xb4>
+
+80100af0 <bdone>:
+
+// Release a prefetched buffer once its read is done.
+// Called by the disk driver, possibly from an interrupt.
+void
+bdone(struct buf *b)
+{
+80100af0:	55                   	push   %ebp
+80100af1:	89 e5                	mov    %esp,%ebp
+80100af3:	53                   	push   %ebx
+80100af4:	83 ec 10             	sub    $0x10,%esp
+80100af7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  releasesleep(&b->lock);
+80100afa:	8d 43 0c             	lea    0xc(%ebx),%eax
+80100afd:	50                   	push   %eax
+80100afe:	e8 83 68 00 00       	call   80107386 <releasesleep>
+  bunref(b);
+80100b03:	89 d8                	mov    %ebx,%eax
+80100b05:	e8 4e f8 ff ff       	call   80100358 <bunref>
+  acquire(&bcache.lrulock);
+80100b0a:	c7 04 24 b4 f5 10 80 	movl   $0x8010f5b4,(%esp)
+80100b11:	e8 7c 6f 00 00       	call   80107a92 <acquire>
+  bcache.nasync--;
+80100b16:	a1 cc 75 11 80       	mov    0x801175cc,%eax
+80100b1b:	83 e8 01             	sub    $0x1,%eax
+80100b1e:	a3 cc 75 11 80       	mov    %eax,0x801175cc
+  release(&bcache.lrulock);
+80100b23:	c7 04 24 b4 f5 10 80 	movl   $0x8010f5b4,(%esp)
+80100b2a:	e8 c8 6f 00 00       	call   80107af7 <release>
+}
+80100b2f:	83 c4 10             	add    $0x10,%esp
+80100b32:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100b35:	c9                   	leave
+80100b36:	c3                   	ret
+
+80100b37 <bdrop>:
+// Forget the contents of every cached block that no one is
+// using, so that the next reads of them go to the disk.
+// For benchmarks; returns the number of blocks dropped.
+int
+bdrop(void)
+{
+80100b37:	55                   	push   %ebp
+80100b38:	89 e5                	mov    %esp,%ebp
+80100b3a:	57                   	push   %edi
+80100b3b:	56                   	push   %esi
+80100b3c:	53                   	push   %ebx
+80100b3d:	83 ec 0c             	sub    $0xc,%esp
+  struct bucket *h;
+  struct buf *b;
+  int n;
+
+  n = 0;
+80100b40:	be 00 00 00 00       	mov    $0x0,%esi
+  for(h = bcache.bucket; h < &bcache.bucket[NBUCKET]; h++){
+80100b45:	bb ec f5 10 80       	mov    $0x8010f5ec,%ebx
+80100b4a:	eb 32                	jmp    80100b7e <bdrop+0x47>
+    acquire(&h->lock);
+    for(b = h->head; b; b = b->hnext){
+80100b4c:	8b 40 58             	mov    0x58(%eax),%eax
+80100b4f:	85 c0                	test   %eax,%eax
+80100b51:	74 1c                	je     80100b6f <bdrop+0x38>
+      // Dirty blocks belong to the log.
+      if(b->refcnt == 0 && (b->flags & (B_VALID|B_DIRTY)) == B_VALID){
+80100b53:	83 78 4c 00          	cmpl   $0x0,0x4c(%eax)
+80100b57:	75 f3                	jne    80100b4c <bdrop+0x15>
+80100b59:	8b 10                	mov    (%eax),%edx
+80100b5b:	89 d1                	mov    %edx,%ecx
+80100b5d:	83 e1 06             	and    $0x6,%ecx
+80100b60:	83 f9 02             	cmp    $0x2,%ecx
+80100b63:	75 e7                	jne    80100b4c <bdrop+0x15>
+        b->flags &= ~B_VALID;
+80100b65:	83 e2 fd             	and    $0xfffffffd,%edx
+80100b68:	89 10                	mov    %edx,(%eax)
+        n++;
+80100b6a:	83 c6 01             	add    $0x1,%esi
+80100b6d:	eb dd                	jmp    80100b4c <bdrop+0x15>
+      }
+    }
+    release(&h->lock);
+80100b6f:	83 ec 0c             	sub    $0xc,%esp
+80100b72:	57                   	push   %edi
+80100b73:	e8 7f 6f 00 00       	call   80107af7 <release>
+  for(h = bcache.bucket; h < &bcache.bucket[NBUCKET]; h++){
+80100b78:	83 c3 3c             	add    $0x3c,%ebx
+80100b7b:	83 c4 10             	add    $0x10,%esp
+80100b7e:	81 fb c0 30 11 80    	cmp    $0x801130c0,%ebx
+80100b84:	73 13                	jae    80100b99 <bdrop+0x62>
+    acquire(&h->lock);
+80100b86:	89 df                	mov    %ebx,%edi
+80100b88:	83 ec 0c             	sub    $0xc,%esp
+80100b8b:	53                   	push   %ebx
+80100b8c:	e8 01 6f 00 00       	call   80107a92 <acquire>
+    for(b = h->head; b; b = b->hnext){
+80100b91:	8b 43 34             	mov    0x34(%ebx),%eax
+80100b94:	83 c4 10             	add    $0x10,%esp
+80100b97:	eb b6                	jmp    80100b4f <bdrop+0x18>
+  }
+  return n;
+}
+80100b99:	89 f0                	mov    %esi,%eax
+80100b9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100b9e:	5b                   	pop    %ebx
+80100b9f:	5e                   	pop    %esi
+80100ba0:	5f                   	pop    %edi
+80100ba1:	5d                   	pop    %ebp
+80100ba2:	c3                   	ret
+
+80100ba3 <bstat>:
+
+// Copy buffer cache statistics into *st.
+int
+bstat(struct bstat *st)
+{
+80100ba3:	55                   	push   %ebp
+80100ba4:	89 e5                	mov    %esp,%ebp
+80100ba6:	53                   	push   %ebx
+80100ba7:	83 ec 08             	sub    $0x8,%esp
+80100baa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int i;
+
+  memset(st, 0, sizeof(*st));
+80100bad:	6a 20                	push   $0x20
+80100baf:	6a 00                	push   $0x0
+80100bb1:	53                   	push   %ebx
+80100bb2:	e8 87 6f 00 00       	call   80107b3e <memset>
+  for(i = 0; i < NBUCKET; i++)
+80100bb7:	83 c4 10             	add    $0x10,%esp
+80100bba:	b8 00 00 00 00       	mov    $0x0,%eax
+80100bbf:	eb 0f                	jmp    80100bd0 <bstat+0x2d>
+    st->hits += bcache.bucket[i].hits;
+80100bc1:	6b d0 3c             	imul   $0x3c,%eax,%edx
+80100bc4:	8b 92 24 f6 10 80    	mov    -0x7fef09dc(%edx),%edx
+80100bca:	01 53 10             	add    %edx,0x10(%ebx)
+  for(i = 0; i < NBUCKET; i++)
+80100bcd:	83 c0 01             	add    $0x1,%eax
+80100bd0:	3d fa 00 00 00       	cmp    $0xfa,%eax
+80100bd5:	7e ea                	jle    80100bc1 <bstat+0x1e>
+  acquire(&bcache.evictlock);
+80100bd7:	83 ec 0c             	sub    $0xc,%esp
+80100bda:	68 80 f5 10 80       	push   $0x8010f580
+80100bdf:	e8 ae 6e 00 00       	call   80107a92 <acquire>
+  st->nbuf = bcache.nbuf;
+80100be4:	a1 c0 30 11 80       	mov    0x801130c0,%eax
+80100be9:	89 03                	mov    %eax,(%ebx)
+  st->maxbuf = bcache.maxbuf;
+80100beb:	a1 c4 30 11 80       	mov    0x801130c4,%eax
+80100bf0:	89 43 04             	mov    %eax,0x4(%ebx)
+  st->misses = bcache.misses;
+80100bf3:	a1 c0 75 11 80       	mov    0x801175c0,%eax
+80100bf8:	89 43 14             	mov    %eax,0x14(%ebx)
+  st->evictions = bcache.evictions;
+80100bfb:	a1 c4 75 11 80       	mov    0x801175c4,%eax
+80100c00:	89 43 18             	mov    %eax,0x18(%ebx)
+  st->promotions = bcache.promotions;
+80100c03:	a1 c8 75 11 80       	mov    0x801175c8,%eax
+80100c08:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  acquire(&bcache.lrulock);
+80100c0b:	c7 04 24 b4 f5 10 80 	movl   $0x8010f5b4,(%esp)
+80100c12:	e8 7b 6e 00 00       	call   80107a92 <acquire>
+  st->nin = bcache.nin;
+80100c17:	a1 b0 35 11 80       	mov    0x801135b0,%eax
+80100c1c:	89 43 08             	mov    %eax,0x8(%ebx)
+  st->nam = bcache.nam;
+80100c1f:	a1 b4 35 11 80       	mov    0x801135b4,%eax
+80100c24:	89 43 0c             	mov    %eax,0xc(%ebx)
+  release(&bcache.lrulock);
+80100c27:	c7 04 24 b4 f5 10 80 	movl   $0x8010f5b4,(%esp)
+80100c2e:	e8 c4 6e 00 00       	call   80107af7 <release>
+  release(&bcache.evictlock);
+80100c33:	c7 04 24 80 f5 10 80 	movl   $0x8010f580,(%esp)
+80100c3a:	e8 b8 6e 00 00       	call   80107af7 <release>
+  return 0;
+}
+80100c3f:	b8 00 00 00 00       	mov    $0x0,%eax
+80100c44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100c47:	c9                   	leave
+80100c48:	c3                   	ret
+
+80100c49 <consoleread>:
+  }
+}
+
+int
+consoleread(struct inode *ip, char *dst, int n)
+{
+80100c49:	55                   	push   %ebp
+80100c4a:	89 e5                	mov    %esp,%ebp
+80100c4c:	57                   	push   %edi
+80100c4d:	56                   	push   %esi
+80100c4e:	53                   	push   %ebx
+80100c4f:	83 ec 28             	sub    $0x28,%esp
+80100c52:	8b 7d 08             	mov    0x8(%ebp),%edi
+80100c55:	8b 75 0c             	mov    0xc(%ebp),%esi
+80100c58:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  uint target;
+  int c;
+
+  iunlock(ip);
+80100c5b:	57                   	push   %edi
+80100c5c:	e8 c2 14 00 00       	call   80102123 <iunlock>
+  target = n;
+80100c61:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  acquire(&cons.lock);
+80100c64:	c7 04 24 80 76 11 80 	movl   $0x80117680,(%esp)
+80100c6b:	e8 22 6e 00 00       	call   80107a92 <acquire>
+  while(n > 0){
+80100c70:	83 c4 10             	add    $0x10,%esp
+80100c73:	85 db                	test   %ebx,%ebx
+80100c75:	0f 8e 91 00 00 00    	jle    80100d0c <consoleread+0xc3>
+    while(input.r == input.w){
+80100c7b:	a1 60 76 11 80       	mov    0x80117660,%eax
+80100c80:	3b 05 64 76 11 80    	cmp    0x80117664,%eax
+80100c86:	75 47                	jne    80100ccf <consoleread+0x86>
+      if(myproc()->killed){
+80100c88:	e8 7e 50 00 00       	call   80105d0b <myproc>
+80100c8d:	83 78 24 00          	cmpl   $0x0,0x24(%eax)
+80100c91:	75 17                	jne    80100caa <consoleread+0x61>
+        release(&cons.lock);
+        ilock(ip);
+        return -1;
+      }
+      sleep(&input.r, &cons.lock);
+80100c93:	83 ec 08             	sub    $0x8,%esp
+80100c96:	68 80 76 11 80       	push   $0x80117680
+80100c9b:	68 60 76 11 80       	push   $0x80117660
+80100ca0:	e8 c1 58 00 00       	call   80106566 <sleep>
+80100ca5:	83 c4 10             	add    $0x10,%esp
+80100ca8:	eb d1                	jmp    80100c7b <consoleread+0x32>
+        release(&cons.lock);
+80100caa:	83 ec 0c             	sub    $0xc,%esp
+80100cad:	68 80 76 11 80       	push   $0x80117680
+80100cb2:	e8 40 6e 00 00       	call   80107af7 <release>
+        ilock(ip);
+80100cb7:	89 3c 24             	mov    %edi,(%esp)
+80100cba:	e8 a2 13 00 00       	call   80102061 <ilock>
+        return -1;
+80100cbf:	83 c4 10             	add    $0x10,%esp
+80100cc2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  }
+  release(&cons.lock);
+  ilock(ip);
+
+  return target - n;
+}
+80100cc7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100cca:	5b                   	pop    %ebx
+80100ccb:	5e                   	pop    %esi
+80100ccc:	5f                   	pop    %edi
+80100ccd:	5d                   	pop    %ebp
+80100cce:	c3                   	ret
+    c = input.buf[input.r++ % INPUT_BUF];
+80100ccf:	8d 50 01             	lea    0x1(%eax),%edx
+80100cd2:	89 15 60 76 11 80    	mov    %edx,0x80117660
+80100cd8:	89 c2                	mov    %eax,%edx
+80100cda:	83 e2 7f             	and    $0x7f,%edx
+80100cdd:	0f b6 92 e0 75 11 80 	movzbl -0x7fee8a20(%edx),%edx
+80100ce4:	0f be ca             	movsbl %dl,%ecx
+    if(c == C('D')){  // EOF
+80100ce7:	80 fa 04             	cmp    $0x4,%dl
+80100cea:	74 14                	je     80100d00 <consoleread+0xb7>
+    *dst++ = c;
+80100cec:	8d 46 01             	lea    0x1(%esi),%eax
+80100cef:	88 16                	mov    %dl,(%esi)
+    --n;
+80100cf1:	83 eb 01             	sub    $0x1,%ebx
+    if(c == '\n')
+80100cf4:	83 f9 0a             	cmp    $0xa,%ecx
+80100cf7:	74 13                	je     80100d0c <consoleread+0xc3>
+    *dst++ = c;
+80100cf9:	89 c6                	mov    %eax,%esi
+80100cfb:	e9 73 ff ff ff       	jmp    80100c73 <consoleread+0x2a>
+      if(n < target){
+80100d00:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80100d03:	39 cb                	cmp    %ecx,%ebx
+80100d05:	73 05                	jae    80100d0c <consoleread+0xc3>
+        input.r--;
+80100d07:	a3 60 76 11 80       	mov    %eax,0x80117660
+  release(&cons.lock);
+80100d0c:	83 ec 0c             	sub    $0xc,%esp
+80100d0f:	68 80 76 11 80       	push   $0x80117680
+80100d14:	e8 de 6d 00 00       	call   80107af7 <release>
+  ilock(ip);
+80100d19:	89 3c 24             	mov    %edi,(%esp)
+80100d1c:	e8 40 13 00 00       	call   80102061 <ilock>
+  return target - n;
+80100d21:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80100d24:	29 d8                	sub    %ebx,%eax
+80100d26:	83 c4 10             	add    $0x10,%esp
+80100d29:	eb 9c                	jmp    80100cc7 <consoleread+0x7e>
+
+80100d2b <panic>:
+{
+80100d2b:	55                   	push   %ebp
+80100d2c:	89 e5                	mov    %esp,%ebp
+80100d2e:	53                   	push   %ebx
+80100d2f:	83 ec 34             	sub    $0x34,%esp
+}
+
+static inline void
+cli(void)
+{
+  asm volatile("cli");
+80100d32:	fa                   	cli
+  cons.locking = 0;
+80100d33:	c7 05 b4 76 11 80 00 	movl   $0x0,0x801176b4
+80100d3a:	00 00 00 
+  cprintf("lapicid %d: panic: ", lapicid());
+80100d3d:	e8 f2 33 00 00       	call   80104134 <lapicid>
+80100d42:	83 ec 08             	sub    $0x8,%esp
+80100d45:	50                   	push   %eax
+80100d46:	68 c9 b9 10 80       	push   $0x8010b9c9
+80100d4b:	e8 9c 02 00 00       	call   80100fec <cprintf>
+  cprintf(s);
+80100d50:	83 c4 04             	add    $0x4,%esp
+80100d53:	ff 75 08             	push   0x8(%ebp)
+80100d56:	e8 91 02 00 00       	call   80100fec <cprintf>
+  cprintf("\n");
+80100d5b:	c7 04 24 0d c5 10 80 	movl   $0x8010c50d,(%esp)
+80100d62:	e8 85 02 00 00       	call   80100fec <cprintf>
+  getcallerpcs(&s, pcs);
+80100d67:	83 c4 08             	add    $0x8,%esp
+80100d6a:	8d 45 d0             	lea    -0x30(%ebp),%eax
+80100d6d:	50                   	push   %eax
+80100d6e:	8d 45 08             	lea    0x8(%ebp),%eax
+80100d71:	50                   	push   %eax
+80100d72:	e8 f2 6b 00 00       	call   80107969 <getcallerpcs>
+  for(i=0; i<10; i++)
+80100d77:	83 c4 10             	add    $0x10,%esp
+80100d7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+80100d7f:	eb 17                	jmp    80100d98 <panic+0x6d>
+    cprintf(" %p", pcs[i]);
+80100d81:	83 ec 08             	sub    $0x8,%esp
+80100d84:	ff 74 9d d0          	push   -0x30(%ebp,%ebx,4)
+80100d88:	68 dd b9 10 80       	push   $0x8010b9dd
+80100d8d:	e8 5a 02 00 00       	call   80100fec <cprintf>
+  for(i=0; i<10; i++)
+80100d92:	83 c3 01             	add    $0x1,%ebx
+80100d95:	83 c4 10             	add    $0x10,%esp
+80100d98:	83 fb 09             	cmp    $0x9,%ebx
+80100d9b:	7e e4                	jle    80100d81 <panic+0x56>
+  panicked = 1; // freeze other CPU
+80100d9d:	c7 05 b8 76 11 80 01 	movl   $0x1,0x801176b8
+80100da4:	00 00 00 
+  for(;;)
+80100da7:	eb fe                	jmp    80100da7 <panic+0x7c>
+
+80100da9 <cgaputc>:
+{
+80100da9:	55                   	push   %ebp
+80100daa:	89 e5                	mov    %esp,%ebp
+80100dac:	57                   	push   %edi
+80100dad:	56                   	push   %esi
+80100dae:	53                   	push   %ebx
+80100daf:	83 ec 0c             	sub    $0xc,%esp
+80100db2:	89 c3                	mov    %eax,%ebx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100db4:	bf d4 03 00 00       	mov    $0x3d4,%edi
+80100db9:	b8 0e 00 00 00       	mov    $0xe,%eax
+80100dbe:	89 fa                	mov    %edi,%edx
+80100dc0:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100dc1:	b9 d5 03 00 00       	mov    $0x3d5,%ecx
+80100dc6:	89 ca                	mov    %ecx,%edx
+80100dc8:	ec                   	in     (%dx),%al
+  pos = inb(CRTPORT+1) << 8;
+80100dc9:	0f b6 f0             	movzbl %al,%esi
+80100dcc:	c1 e6 08             	shl    $0x8,%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100dcf:	b8 0f 00 00 00       	mov    $0xf,%eax
+80100dd4:	89 fa                	mov    %edi,%edx
+80100dd6:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100dd7:	89 ca                	mov    %ecx,%edx
+80100dd9:	ec                   	in     (%dx),%al
+  pos |= inb(CRTPORT+1);
+80100dda:	0f b6 c8             	movzbl %al,%ecx
+80100ddd:	09 f1                	or     %esi,%ecx
+  if(c == '\n')
+80100ddf:	83 fb 0a             	cmp    $0xa,%ebx
+80100de2:	74 60                	je     80100e44 <cgaputc+0x9b>
+  else if(c == BACKSPACE){
+80100de4:	81 fb 00 01 00 00    	cmp    $0x100,%ebx
+80100dea:	74 79                	je     80100e65 <cgaputc+0xbc>
+    crt[pos++] = (c&0xff) | 0x0700;  // black on white
+80100dec:	0f b6 c3             	movzbl %bl,%eax
+80100def:	8d 59 01             	lea    0x1(%ecx),%ebx
+80100df2:	80 cc 07             	or     $0x7,%ah
+80100df5:	66 89 84 09 00 80 0b 	mov    %ax,-0x7ff48000(%ecx,%ecx,1)
+80100dfc:	80 
+  if(pos < 0 || pos > 25*80)
+80100dfd:	81 fb d0 07 00 00    	cmp    $0x7d0,%ebx
+80100e03:	77 6d                	ja     80100e72 <cgaputc+0xc9>
+  if((pos/80) >= 24){  // Scroll up.
+80100e05:	81 fb 7f 07 00 00    	cmp    $0x77f,%ebx
+80100e0b:	7f 72                	jg     80100e7f <cgaputc+0xd6>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100e0d:	be d4 03 00 00       	mov    $0x3d4,%esi
+80100e12:	b8 0e 00 00 00       	mov    $0xe,%eax
+80100e17:	89 f2                	mov    %esi,%edx
+80100e19:	ee                   	out    %al,(%dx)
+  outb(CRTPORT+1, pos>>8);
+80100e1a:	0f b6 c7             	movzbl %bh,%eax
+80100e1d:	b9 d5 03 00 00       	mov    $0x3d5,%ecx
+80100e22:	89 ca                	mov    %ecx,%edx
+80100e24:	ee                   	out    %al,(%dx)
+80100e25:	b8 0f 00 00 00       	mov    $0xf,%eax
+80100e2a:	89 f2                	mov    %esi,%edx
+80100e2c:	ee                   	out    %al,(%dx)
+80100e2d:	89 d8                	mov    %ebx,%eax
+80100e2f:	89 ca                	mov    %ecx,%edx
+80100e31:	ee                   	out    %al,(%dx)
+  crt[pos] = ' ' | 0x0700;
+80100e32:	66 c7 84 1b 00 80 0b 	movw   $0x720,-0x7ff48000(%ebx,%ebx,1)
+80100e39:	80 20 07 
+}
+80100e3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100e3f:	5b                   	pop    %ebx
+80100e40:	5e                   	pop    %esi
+80100e41:	5f                   	pop    %edi
+80100e42:	5d                   	pop    %ebp
+80100e43:	c3                   	ret
+    pos += 80 - pos%80;
+80100e44:	ba 67 66 66 66       	mov    $0x66666667,%edx
+80100e49:	89 c8                	mov    %ecx,%eax
+80100e4b:	f7 ea                	imul   %edx
+80100e4d:	c1 fa 05             	sar    $0x5,%edx
+80100e50:	8d 04 92             	lea    (%edx,%edx,4),%eax
+80100e53:	c1 e0 04             	shl    $0x4,%eax
+80100e56:	89 ca                	mov    %ecx,%edx
+80100e58:	29 c2                	sub    %eax,%edx
+80100e5a:	bb 50 00 00 00       	mov    $0x50,%ebx
+80100e5f:	29 d3                	sub    %edx,%ebx
+80100e61:	01 cb                	add    %ecx,%ebx
+80100e63:	eb 98                	jmp    80100dfd <cgaputc+0x54>
+    if(pos > 0) --pos;
+80100e65:	85 c9                	test   %ecx,%ecx
+80100e67:	7e 05                	jle    80100e6e <cgaputc+0xc5>
+80100e69:	8d 59 ff             	lea    -0x1(%ecx),%ebx
+80100e6c:	eb 8f                	jmp    80100dfd <cgaputc+0x54>
+  pos |= inb(CRTPORT+1);
+80100e6e:	89 cb                	mov    %ecx,%ebx
+80100e70:	eb 8b                	jmp    80100dfd <cgaputc+0x54>
+    panic("pos under/overflow");
+80100e72:	83 ec 0c             	sub    $0xc,%esp
+80100e75:	68 e1 b9 10 80       	push   $0x8010b9e1
+80100e7a:	e8 ac fe ff ff       	call   80100d2b <panic>
+    memmove(crt, crt+80, sizeof(crt[0])*23*80);
+80100e7f:	83 ec 04             	sub    $0x4,%esp
+80100e82:	68 60 0e 00 00       	push   $0xe60
+80100e87:	68 a0 80 0b 80       	push   $0x800b80a0
+80100e8c:	68 00 80 0b 80       	push   $0x800b8000
+80100e91:	e8 20 6d 00 00       	call   80107bb6 <memmove>
+    pos -= 80;
+80100e96:	83 eb 50             	sub    $0x50,%ebx
+    memset(crt+pos, 0, sizeof(crt[0])*(24*80 - pos));
+80100e99:	b8 80 07 00 00       	mov    $0x780,%eax
+80100e9e:	29 d8                	sub    %ebx,%eax
+80100ea0:	8d 94 1b 00 80 0b 80 	lea    -0x7ff48000(%ebx,%ebx,1),%edx
+80100ea7:	83 c4 0c             	add    $0xc,%esp
+80100eaa:	01 c0                	add    %eax,%eax
+80100eac:	50                   	push   %eax
+80100ead:	6a 00                	push   $0x0
+80100eaf:	52                   	push   %edx
+80100eb0:	e8 89 6c 00 00       	call   80107b3e <memset>
+80100eb5:	83 c4 10             	add    $0x10,%esp
+80100eb8:	e9 50 ff ff ff       	jmp    80100e0d <cgaputc+0x64>
+
+80100ebd <consputc>:
+  if(panicked){
+80100ebd:	83 3d b8 76 11 80 00 	cmpl   $0x0,0x801176b8
+80100ec4:	74 03                	je     80100ec9 <consputc+0xc>
+  asm volatile("cli");
+80100ec6:	fa                   	cli
+    for(;;)
+80100ec7:	eb fe                	jmp    80100ec7 <consputc+0xa>
+{
+80100ec9:	55                   	push   %ebp
+80100eca:	89 e5                	mov    %esp,%ebp
+80100ecc:	53                   	push   %ebx
+80100ecd:	83 ec 04             	sub    $0x4,%esp
+80100ed0:	89 c3                	mov    %eax,%ebx
+  if(c == BACKSPACE){
+80100ed2:	3d 00 01 00 00       	cmp    $0x100,%eax
+80100ed7:	74 18                	je     80100ef1 <consputc+0x34>
+    uartputc(c);
+80100ed9:	83 ec 0c             	sub    $0xc,%esp
+80100edc:	50                   	push   %eax
+80100edd:	e8 e9 85 00 00       	call   801094cb <uartputc>
+80100ee2:	83 c4 10             	add    $0x10,%esp
+  cgaputc(c);
+80100ee5:	89 d8                	mov    %ebx,%eax
+80100ee7:	e8 bd fe ff ff       	call   80100da9 <cgaputc>
+}
+80100eec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100eef:	c9                   	leave
+80100ef0:	c3                   	ret
+    uartputc('\b'); uartputc(' '); uartputc('\b');
+80100ef1:	83 ec 0c             	sub    $0xc,%esp
+80100ef4:	6a 08                	push   $0x8
+80100ef6:	e8 d0 85 00 00       	call   801094cb <uartputc>
+80100efb:	c7 04 24 20 00 00 00 	movl   $0x20,(%esp)
+80100f02:	e8 c4 85 00 00       	call   801094cb <uartputc>
+80100f07:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+80100f0e:	e8 b8 85 00 00       	call   801094cb <uartputc>
+80100f13:	83 c4 10             	add    $0x10,%esp
+80100f16:	eb cd                	jmp    80100ee5 <consputc+0x28>
+
+80100f18 <printint>:
+{
+80100f18:	55                   	push   %ebp
+80100f19:	89 e5                	mov    %esp,%ebp
+80100f1b:	57                   	push   %edi
+80100f1c:	56                   	push   %esi
+80100f1d:	53                   	push   %ebx
+80100f1e:	83 ec 2c             	sub    $0x2c,%esp
+80100f21:	89 c3                	mov    %eax,%ebx
+80100f23:	89 d6                	mov    %edx,%esi
+80100f25:	89 c8                	mov    %ecx,%eax
+  if(sign && (sign = xx < 0))
+80100f27:	85 c9                	test   %ecx,%ecx
+80100f29:	74 09                	je     80100f34 <printint+0x1c>
+80100f2b:	89 d8                	mov    %ebx,%eax
+80100f2d:	c1 e8 1f             	shr    $0x1f,%eax
+80100f30:	85 db                	test   %ebx,%ebx
+80100f32:	78 3c                	js     80100f70 <printint+0x58>
+    x = xx;
+80100f34:	89 d9                	mov    %ebx,%ecx
+  i = 0;
+80100f36:	bb 00 00 00 00       	mov    $0x0,%ebx
+80100f3b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    buf[i++] = digits[x % base];
+80100f3e:	89 c8                	mov    %ecx,%eax
+80100f40:	ba 00 00 00 00       	mov    $0x0,%edx
+80100f45:	f7 f6                	div    %esi
+80100f47:	89 df                	mov    %ebx,%edi
+80100f49:	83 c3 01             	add    $0x1,%ebx
+80100f4c:	0f b6 92 0c ba 10 80 	movzbl -0x7fef45f4(%edx),%edx
+80100f53:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+80100f57:	89 ca                	mov    %ecx,%edx
+80100f59:	89 c1                	mov    %eax,%ecx
+80100f5b:	39 f2                	cmp    %esi,%edx
+80100f5d:	73 df                	jae    80100f3e <printint+0x26>
+  if(sign)
+80100f5f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80100f62:	85 c0                	test   %eax,%eax
+80100f64:	74 1a                	je     80100f80 <printint+0x68>
+    buf[i++] = '-';
+80100f66:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+80100f6b:	8d 5f 02             	lea    0x2(%edi),%ebx
+80100f6e:	eb 10                	jmp    80100f80 <printint+0x68>
+    x = -xx;
+80100f70:	89 d9                	mov    %ebx,%ecx
+80100f72:	f7 d9                	neg    %ecx
+80100f74:	eb c0                	jmp    80100f36 <printint+0x1e>
+    consputc(buf[i]);
+80100f76:	0f be 44 1d d8       	movsbl -0x28(%ebp,%ebx,1),%eax
+80100f7b:	e8 3d ff ff ff       	call   80100ebd <consputc>
+  while(--i >= 0)
+80100f80:	83 eb 01             	sub    $0x1,%ebx
+80100f83:	79 f1                	jns    80100f76 <printint+0x5e>
+}
+80100f85:	83 c4 2c             	add    $0x2c,%esp
+80100f88:	5b                   	pop    %ebx
+80100f89:	5e                   	pop    %esi
+80100f8a:	5f                   	pop    %edi
+80100f8b:	5d                   	pop    %ebp
+80100f8c:	c3                   	ret
+
+80100f8d <consolewrite>:
+
+int
+consolewrite(struct inode *ip, char *buf, int n)
+{
+80100f8d:	55                   	push   %ebp
+80100f8e:	89 e5                	mov    %esp,%ebp
+80100f90:	57                   	push   %edi
+80100f91:	56                   	push   %esi
+80100f92:	53                   	push   %ebx
+80100f93:	83 ec 18             	sub    $0x18,%esp
+80100f96:	8b 7d 0c             	mov    0xc(%ebp),%edi
+80100f99:	8b 75 10             	mov    0x10(%ebp),%esi
+  int i;
+
+  iunlock(ip);
+80100f9c:	ff 75 08             	push   0x8(%ebp)
+80100f9f:	e8 7f 11 00 00       	call   80102123 <iunlock>
+  acquire(&cons.lock);
+80100fa4:	c7 04 24 80 76 11 80 	movl   $0x80117680,(%esp)
+80100fab:	e8 e2 6a 00 00       	call   80107a92 <acquire>
+  for(i = 0; i < n; i++)
+80100fb0:	83 c4 10             	add    $0x10,%esp
+80100fb3:	bb 00 00 00 00       	mov    $0x0,%ebx
+80100fb8:	eb 0c                	jmp    80100fc6 <consolewrite+0x39>
+    consputc(buf[i] & 0xff);
+80100fba:	0f b6 04 1f          	movzbl (%edi,%ebx,1),%eax
+80100fbe:	e8 fa fe ff ff       	call   80100ebd <consputc>
+  for(i = 0; i < n; i++)
+80100fc3:	83 c3 01             	add    $0x1,%ebx
+80100fc6:	39 f3                	cmp    %esi,%ebx
+80100fc8:	7c f0                	jl     80100fba <consolewrite+0x2d>
+  release(&cons.lock);
+80100fca:	83 ec 0c             	sub    $0xc,%esp
+80100fcd:	68 80 76 11 80       	push   $0x80117680
+80100fd2:	e8 20 6b 00 00       	call   80107af7 <release>
+  ilock(ip);
+80100fd7:	83 c4 04             	add    $0x4,%esp
+80100fda:	ff 75 08             	push   0x8(%ebp)
+80100fdd:	e8 7f 10 00 00       	call   80102061 <ilock>
+
+  return n;
+}
+80100fe2:	89 f0                	mov    %esi,%eax
+80100fe4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100fe7:	5b                   	pop    %ebx
+80100fe8:	5e                   	pop    %esi
+80100fe9:	5f                   	pop    %edi
+80100fea:	5d                   	pop    %ebp
+80100feb:	c3                   	ret
+
+80100fec <cprintf>:
+{
+80100fec:	55                   	push   %ebp
+80100fed:	89 e5                	mov    %esp,%ebp
+80100fef:	57                   	push   %edi
+80100ff0:	56                   	push   %esi
+80100ff1:	53                   	push   %ebx
+80100ff2:	83 ec 1c             	sub    $0x1c,%esp
+  locking = cons.locking;
+80100ff5:	a1 b4 76 11 80       	mov    0x801176b4,%eax
+80100ffa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(locking)
+80100ffd:	85 c0                	test   %eax,%eax
+80100fff:	75 10                	jne    80101011 <cprintf+0x25>
+  if (fmt == 0)
+80101001:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+80101005:	74 1c                	je     80101023 <cprintf+0x37>
+  argp = (uint*)(void*)(&fmt + 1);
+80101007:	8d 7d 0c             	lea    0xc(%ebp),%edi
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+8010100a:	be 00 00 00 00       	mov    $0x0,%esi
+8010100f:	eb 27                	jmp    80101038 <cprintf+0x4c>
+    acquire(&cons.lock);
+80101011:	83 ec 0c             	sub    $0xc,%esp
+80101014:	68 80 76 11 80       	push   $0x80117680
+80101019:	e8 74 6a 00 00       	call   80107a92 <acquire>
+8010101e:	83 c4 10             	add    $0x10,%esp
+80101021:	eb de                	jmp    80101001 <cprintf+0x15>
+    panic("null fmt");
+80101023:	83 ec 0c             	sub    $0xc,%esp
+80101026:	68 fb b9 10 80       	push   $0x8010b9fb
+8010102b:	e8 fb fc ff ff       	call   80100d2b <panic>
+      consputc(c);
+80101030:	e8 88 fe ff ff       	call   80100ebd <consputc>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80101035:	83 c6 01             	add    $0x1,%esi
+80101038:	8b 55 08             	mov    0x8(%ebp),%edx
+8010103b:	0f b6 04 32          	movzbl (%edx,%esi,1),%eax
+8010103f:	85 c0                	test   %eax,%eax
+80101041:	0f 84 b1 00 00 00    	je     801010f8 <cprintf+0x10c>
+    if(c != '%'){
+80101047:	83 f8 25             	cmp    $0x25,%eax
+8010104a:	75 e4                	jne    80101030 <cprintf+0x44>
+    c = fmt[++i] & 0xff;
+8010104c:	83 c6 01             	add    $0x1,%esi
+8010104f:	0f b6 1c 32          	movzbl (%edx,%esi,1),%ebx
+    if(c == 0)
+80101053:	85 db                	test   %ebx,%ebx
+80101055:	0f 84 9d 00 00 00    	je     801010f8 <cprintf+0x10c>
+    switch(c){
+8010105b:	83 fb 70             	cmp    $0x70,%ebx
+8010105e:	74 2e                	je     8010108e <cprintf+0xa2>
+80101060:	7f 22                	jg     80101084 <cprintf+0x98>
+80101062:	83 fb 25             	cmp    $0x25,%ebx
+80101065:	74 6c                	je     801010d3 <cprintf+0xe7>
+80101067:	83 fb 64             	cmp    $0x64,%ebx
+8010106a:	75 76                	jne    801010e2 <cprintf+0xf6>
+      printint(*argp++, 10, 1);
+8010106c:	8d 5f 04             	lea    0x4(%edi),%ebx
+8010106f:	8b 07                	mov    (%edi),%eax
+80101071:	b9 01 00 00 00       	mov    $0x1,%ecx
+80101076:	ba 0a 00 00 00       	mov    $0xa,%edx
+8010107b:	e8 98 fe ff ff       	call   80100f18 <printint>
+80101080:	89 df                	mov    %ebx,%edi
+      break;
+80101082:	eb b1                	jmp    80101035 <cprintf+0x49>
+    switch(c){
+80101084:	83 fb 73             	cmp    $0x73,%ebx
+80101087:	74 1d                	je     801010a6 <cprintf+0xba>
+80101089:	83 fb 78             	cmp    $0x78,%ebx
+8010108c:	75 54                	jne    801010e2 <cprintf+0xf6>
+      printint(*argp++, 16, 0);
+8010108e:	8d 5f 04             	lea    0x4(%edi),%ebx
+80101091:	8b 07                	mov    (%edi),%eax
+80101093:	b9 00 00 00 00       	mov    $0x0,%ecx
+80101098:	ba 10 00 00 00       	mov    $0x10,%edx
+8010109d:	e8 76 fe ff ff       	call   80100f18 <printint>
+801010a2:	89 df                	mov    %ebx,%edi
+      break;
+801010a4:	eb 8f                	jmp    80101035 <cprintf+0x49>
+      if((s = (char*)*argp++) == 0)
+801010a6:	8d 47 04             	lea    0x4(%edi),%eax
+801010a9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801010ac:	8b 1f                	mov    (%edi),%ebx
+801010ae:	85 db                	test   %ebx,%ebx
+801010b0:	75 12                	jne    801010c4 <cprintf+0xd8>
+        s = "(null)";
+801010b2:	bb f4 b9 10 80       	mov    $0x8010b9f4,%ebx
+801010b7:	eb 0b                	jmp    801010c4 <cprintf+0xd8>
+        consputc(*s);
+801010b9:	0f be c0             	movsbl %al,%eax
+801010bc:	e8 fc fd ff ff       	call   80100ebd <consputc>
+      for(; *s; s++)
+801010c1:	83 c3 01             	add    $0x1,%ebx
+801010c4:	0f b6 03             	movzbl (%ebx),%eax
+801010c7:	84 c0                	test   %al,%al
+801010c9:	75 ee                	jne    801010b9 <cprintf+0xcd>
+      if((s = (char*)*argp++) == 0)
+801010cb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+801010ce:	e9 62 ff ff ff       	jmp    80101035 <cprintf+0x49>
+      consputc('%');
+801010d3:	b8 25 00 00 00       	mov    $0x25,%eax
+801010d8:	e8 e0 fd ff ff       	call   80100ebd <consputc>
+      break;
+801010dd:	e9 53 ff ff ff       	jmp    80101035 <cprintf+0x49>
+      consputc('%');
+801010e2:	b8 25 00 00 00       	mov    $0x25,%eax
+801010e7:	e8 d1 fd ff ff       	call   80100ebd <consputc>
+      consputc(c);
+801010ec:	89 d8                	mov    %ebx,%eax
+801010ee:	e8 ca fd ff ff       	call   80100ebd <consputc>
+      break;
+801010f3:	e9 3d ff ff ff       	jmp    80101035 <cprintf+0x49>
+  if(locking)
+801010f8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+801010fc:	75 08                	jne    80101106 <cprintf+0x11a>
+}
+801010fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101101:	5b                   	pop    %ebx
+80101102:	5e                   	pop    %esi
+80101103:	5f                   	pop    %edi
+80101104:	5d                   	pop    %ebp
+80101105:	c3                   	ret
+    release(&cons.lock);
+80101106:	83 ec 0c             	sub    $0xc,%esp
+80101109:	68 80 76 11 80       	push   $0x80117680
+8010110e:	e8 e4 69 00 00       	call   80107af7 <release>
+80101113:	83 c4 10             	add    $0x10,%esp
+}
+80101116:	eb e6                	jmp    801010fe <cprintf+0x112>
+
+80101118 <consoleintr>:
+{
+80101118:	55                   	push   %ebp
+80101119:	89 e5                	mov    %esp,%ebp
+8010111b:	57                   	push   %edi
+8010111c:	56                   	push   %esi
+8010111d:	53                   	push   %ebx
+8010111e:	83 ec 18             	sub    $0x18,%esp
+80101121:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&cons.lock);
+80101124:	68 80 76 11 80       	push   $0x80117680
+80101129:	e8 64 69 00 00       	call   80107a92 <acquire>
+  while((c = getc()) >= 0){
+8010112e:	83 c4 10             	add    $0x10,%esp
+  int c, doprocdump = 0;
+80101131:	be 00 00 00 00       	mov    $0x0,%esi
+  while((c = getc()) >= 0){
+80101136:	eb 13                	jmp    8010114b <consoleintr+0x33>
+    switch(c){
+80101138:	83 ff 08             	cmp    $0x8,%edi
+8010113b:	0f 84 d9 00 00 00    	je     8010121a <consoleintr+0x102>
+80101141:	83 ff 10             	cmp    $0x10,%edi
+80101144:	75 25                	jne    8010116b <consoleintr+0x53>
+80101146:	be 01 00 00 00       	mov    $0x1,%esi
+  while((c = getc()) >= 0){
+8010114b:	ff d3                	call   *%ebx
+8010114d:	89 c7                	mov    %eax,%edi
+8010114f:	85 c0                	test   %eax,%eax
+80101151:	0f 88 f5 00 00 00    	js     8010124c <consoleintr+0x134>
+    switch(c){
+80101157:	83 ff 15             	cmp    $0x15,%edi
+8010115a:	0f 84 93 00 00 00    	je     801011f3 <consoleintr+0xdb>
+80101160:	7e d6                	jle    80101138 <consoleintr+0x20>
+80101162:	83 ff 7f             	cmp    $0x7f,%edi
+80101165:	0f 84 af 00 00 00    	je     8010121a <consoleintr+0x102>
+      if(c != 0 && input.e-input.r < INPUT_BUF){
+8010116b:	85 ff                	test   %edi,%edi
+8010116d:	74 dc                	je     8010114b <consoleintr+0x33>
+8010116f:	a1 68 76 11 80       	mov    0x80117668,%eax
+80101174:	89 c2                	mov    %eax,%edx
+80101176:	2b 15 60 76 11 80    	sub    0x80117660,%edx
+8010117c:	83 fa 7f             	cmp    $0x7f,%edx
+8010117f:	77 ca                	ja     8010114b <consoleintr+0x33>
+        c = (c == '\r') ? '\n' : c;
+80101181:	83 ff 0d             	cmp    $0xd,%edi
+80101184:	0f 84 b8 00 00 00    	je     80101242 <consoleintr+0x12a>
+        input.buf[input.e++ % INPUT_BUF] = c;
+8010118a:	8d 50 01             	lea    0x1(%eax),%edx
+8010118d:	89 15 68 76 11 80    	mov    %edx,0x80117668
+80101193:	83 e0 7f             	and    $0x7f,%eax
+80101196:	89 f9                	mov    %edi,%ecx
+80101198:	88 88 e0 75 11 80    	mov    %cl,-0x7fee8a20(%eax)
+        consputc(c);
+8010119e:	89 f8                	mov    %edi,%eax
+801011a0:	e8 18 fd ff ff       	call   80100ebd <consputc>
+        if(c == '\n' || c == C('D') || input.e == input.r+INPUT_BUF){
+801011a5:	83 ff 0a             	cmp    $0xa,%edi
+801011a8:	0f 94 c0             	sete   %al
+801011ab:	83 ff 04             	cmp    $0x4,%edi
+801011ae:	0f 94 c2             	sete   %dl
+801011b1:	08 d0                	or     %dl,%al
+801011b3:	75 10                	jne    801011c5 <consoleintr+0xad>
+801011b5:	a1 60 76 11 80       	mov    0x80117660,%eax
+801011ba:	83 e8 80             	sub    $0xffffff80,%eax
+801011bd:	39 05 68 76 11 80    	cmp    %eax,0x80117668
+801011c3:	75 86                	jne    8010114b <consoleintr+0x33>
+          input.w = input.e;
+801011c5:	a1 68 76 11 80       	mov    0x80117668,%eax
+801011ca:	a3 64 76 11 80       	mov    %eax,0x80117664
+          wakeup(&input.r);
+801011cf:	83 ec 0c             	sub    $0xc,%esp
+801011d2:	68 60 76 11 80       	push   $0x80117660
+801011d7:	e8 59 56 00 00       	call   80106835 <wakeup>
+801011dc:	83 c4 10             	add    $0x10,%esp
+801011df:	e9 67 ff ff ff       	jmp    8010114b <consoleintr+0x33>
+        input.e--;
+801011e4:	a3 68 76 11 80       	mov    %eax,0x80117668
+        consputc(BACKSPACE);
+801011e9:	b8 00 01 00 00       	mov    $0x100,%eax
+801011ee:	e8 ca fc ff ff       	call   80100ebd <consputc>
+      while(input.e != input.w &&
+801011f3:	a1 68 76 11 80       	mov    0x80117668,%eax
+801011f8:	3b 05 64 76 11 80    	cmp    0x80117664,%eax
+801011fe:	0f 84 47 ff ff ff    	je     8010114b <consoleintr+0x33>
+            input.buf[(input.e-1) % INPUT_BUF] != '\n'){
+80101204:	83 e8 01             	sub    $0x1,%eax
+80101207:	89 c2                	mov    %eax,%edx
+80101209:	83 e2 7f             	and    $0x7f,%edx
+      while(input.e != input.w &&
+8010120c:	80 ba e0 75 11 80 0a 	cmpb   $0xa,-0x7fee8a20(%edx)
+80101213:	75 cf                	jne    801011e4 <consoleintr+0xcc>
+80101215:	e9 31 ff ff ff       	jmp    8010114b <consoleintr+0x33>
+      if(input.e != input.w){
+8010121a:	a1 68 76 11 80       	mov    0x80117668,%eax
+8010121f:	3b 05 64 76 11 80    	cmp    0x80117664,%eax
+80101225:	0f 84 20 ff ff ff    	je     8010114b <consoleintr+0x33>
+        input.e--;
+8010122b:	83 e8 01             	sub    $0x1,%eax
+8010122e:	a3 68 76 11 80       	mov    %eax,0x80117668
+        consputc(BACKSPACE);
+80101233:	b8 00 01 00 00       	mov    $0x100,%eax
+80101238:	e8 80 fc ff ff       	call   80100ebd <consputc>
+8010123d:	e9 09 ff ff ff       	jmp    8010114b <consoleintr+0x33>
+        c = (c == '\r') ? '\n' : c;
+80101242:	bf 0a 00 00 00       	mov    $0xa,%edi
+80101247:	e9 3e ff ff ff       	jmp    8010118a <consoleintr+0x72>
+  release(&cons.lock);
+8010124c:	83 ec 0c             	sub    $0xc,%esp
+8010124f:	68 80 76 11 80       	push   $0x80117680
+80101254:	e8 9e 68 00 00       	call   80107af7 <release>
+  if(doprocdump) {
+80101259:	83 c4 10             	add    $0x10,%esp
+8010125c:	85 f6                	test   %esi,%esi
+8010125e:	75 08                	jne    80101268 <consoleintr+0x150>
+}
+80101260:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101263:	5b                   	pop    %ebx
+80101264:	5e                   	pop    %esi
+80101265:	5f                   	pop    %edi
+80101266:	5d                   	pop    %ebp
+80101267:	c3                   	ret
+    procdump();  // now call procdump() wo. cons.lock held
+80101268:	e8 67 56 00 00       	call   801068d4 <procdump>
+}
+8010126d:	eb f1                	jmp    80101260 <consoleintr+0x148>
+
+8010126f <consoleinit>:
+
+void
+consoleinit(void)
+{
+8010126f:	55                   	push   %ebp
+80101270:	89 e5                	mov    %esp,%ebp
+80101272:	83 ec 10             	sub    $0x10,%esp
+  initlock(&cons.lock, "console");
+80101275:	68 04 ba 10 80       	push   $0x8010ba04
+8010127a:	68 80 76 11 80       	push   $0x80117680
+8010127f:	e8 ca 66 00 00       	call   8010794e <initlock>
+
+  devsw[CONSOLE].write = consolewrite;
+80101284:	c7 05 0c 77 11 80 8d 	movl   $0x80100f8d,0x8011770c
+8010128b:	0f 10 80 
+  devsw[CONSOLE].read = consoleread;
+8010128e:	c7 05 08 77 11 80 49 	movl   $0x80100c49,0x80117708
+80101295:	0c 10 80 
+  cons.locking = 1;
+80101298:	c7 05 b4 76 11 80 01 	movl   $0x1,0x801176b4
+8010129f:	00 00 00 
+
+  ioapicenable(IRQ_KBD, 0);
+801012a2:	83 c4 08             	add    $0x8,%esp
+801012a5:	6a 00                	push   $0x0
+801012a7:	6a 01                	push   $0x1
+801012a9:	e8 8f 1f 00 00       	call   8010323d <ioapicenable>
+}
+801012ae:	83 c4 10             	add    $0x10,%esp
+801012b1:	c9                   	leave
+801012b2:	c3                   	ret
+
+801012b3 <execinto>:
+// Replace the user image of p with the program at path.
+// p is either the current process (exec) or a freshly
+// allocated process that has no image yet (spawn).
+int
+execinto(struct proc *p, char *path, char **argv)
+{
+801012b3:	55                   	push   %ebp
+801012b4:	89 e5                	mov    %esp,%ebp
+801012b6:	57                   	push   %edi
+801012b7:	56                   	push   %esi
+801012b8:	53                   	push   %ebx
+801012b9:	81 ec 90 02 00 00    	sub    $0x290,%esp
+801012bf:	8b 75 0c             	mov    0xc(%ebp),%esi
+  struct inode *ip;
+  struct proghdr ph;
+  pde_t *pgdir, *oldpgdir;
+  struct vma vma[NVMA];
+
+  memset(vma, 0, sizeof(vma));
+801012c2:	68 80 01 00 00       	push   $0x180
+801012c7:	6a 00                	push   $0x0
+801012c9:	8d 85 84 fd ff ff    	lea    -0x27c(%ebp),%eax
+801012cf:	50                   	push   %eax
+801012d0:	e8 69 68 00 00       	call   80107b3e <memset>
+  begin_op();
+801012d5:	e8 60 37 00 00       	call   80104a3a <begin_op>
+
+  if((ip = namei(path)) == 0){
+801012da:	89 34 24             	mov    %esi,(%esp)
+801012dd:	e8 10 15 00 00       	call   801027f2 <namei>
+801012e2:	83 c4 10             	add    $0x10,%esp
+801012e5:	85 c0                	test   %eax,%eax
+801012e7:	74 65                	je     8010134e <execinto+0x9b>
+801012e9:	89 c7                	mov    %eax,%edi
+    end_op();
+    cprintf("exec: fail\n");
+    return -1;
+  }
+  ilock(ip);
+801012eb:	83 ec 0c             	sub    $0xc,%esp
+801012ee:	50                   	push   %eax
+801012ef:	e8 6d 0d 00 00       	call   80102061 <ilock>
+  pgdir = 0;
+
+  // Check ELF header
+  if(readi(ip, (char*)&elf, 0, sizeof(elf)) != sizeof(elf))
+801012f4:	6a 34                	push   $0x34
+801012f6:	6a 00                	push   $0x0
+801012f8:	8d 85 24 ff ff ff    	lea    -0xdc(%ebp),%eax
+801012fe:	50                   	push   %eax
+801012ff:	57                   	push   %edi
+80101300:	e8 52 10 00 00       	call   80102357 <readi>
+80101305:	83 c4 20             	add    $0x20,%esp
+80101308:	83 f8 34             	cmp    $0x34,%eax
+8010130b:	0f 85 68 03 00 00    	jne    80101679 <execinto+0x3c6>
+    goto bad;
+  if(elf.magic != ELF_MAGIC)
+80101311:	81 bd 24 ff ff ff 7f 	cmpl   $0x464c457f,-0xdc(%ebp)
+80101318:	45 4c 46 
+8010131b:	0f 85 58 03 00 00    	jne    80101679 <execinto+0x3c6>
+    goto bad;
+
+  if((pgdir = setupkvm()) == 0)
+80101321:	e8 4b 9d 00 00       	call   8010b071 <setupkvm>
+80101326:	89 85 68 fd ff ff    	mov    %eax,-0x298(%ebp)
+8010132c:	85 c0                	test   %eax,%eax
+8010132e:	0f 84 45 03 00 00    	je     80101679 <execinto+0x3c6>
+  // Map the program.  Nothing is read yet: each segment is
+  // recorded as a file-backed region that pagefault() loads a
+  // page at a time as the program touches it, and bss pages
+  // are zero-filled on demand like the heap.
+  sz = 0;
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80101334:	8b 85 40 ff ff ff    	mov    -0xc0(%ebp),%eax
+  sz = 0;
+8010133a:	c7 85 6c fd ff ff 00 	movl   $0x0,-0x294(%ebp)
+80101341:	00 00 00 
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80101344:	bb 00 00 00 00       	mov    $0x0,%ebx
+80101349:	89 75 0c             	mov    %esi,0xc(%ebp)
+8010134c:	eb 2b                	jmp    80101379 <execinto+0xc6>
+    end_op();
+8010134e:	e8 7b 37 00 00       	call   80104ace <end_op>
+    cprintf("exec: fail\n");
+80101353:	83 ec 0c             	sub    $0xc,%esp
+80101356:	68 1d ba 10 80       	push   $0x8010ba1d
+8010135b:	e8 8c fc ff ff       	call   80100fec <cprintf>
+    return -1;
+80101360:	83 c4 10             	add    $0x10,%esp
+80101363:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101368:	e9 38 03 00 00       	jmp    801016a5 <execinto+0x3f2>
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+8010136d:	83 c3 01             	add    $0x1,%ebx
+80101370:	8b 85 74 fd ff ff    	mov    -0x28c(%ebp),%eax
+80101376:	83 c0 20             	add    $0x20,%eax
+80101379:	0f b7 95 50 ff ff ff 	movzwl -0xb0(%ebp),%edx
+80101380:	39 da                	cmp    %ebx,%edx
+80101382:	0f 8e c4 00 00 00    	jle    8010144c <execinto+0x199>
+    if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
+80101388:	89 85 74 fd ff ff    	mov    %eax,-0x28c(%ebp)
+8010138e:	6a 20                	push   $0x20
+80101390:	50                   	push   %eax
+80101391:	8d 85 04 ff ff ff    	lea    -0xfc(%ebp),%eax
+80101397:	50                   	push   %eax
+80101398:	57                   	push   %edi
+80101399:	e8 b9 0f 00 00       	call   80102357 <readi>
+8010139e:	83 c4 10             	add    $0x10,%esp
+801013a1:	83 f8 20             	cmp    $0x20,%eax
+801013a4:	0f 85 be 02 00 00    	jne    80101668 <execinto+0x3b5>
+      goto bad;
+    if(ph.type != ELF_PROG_LOAD)
+801013aa:	83 bd 04 ff ff ff 01 	cmpl   $0x1,-0xfc(%ebp)
+801013b1:	75 ba                	jne    8010136d <execinto+0xba>
+      continue;
+    if(ph.memsz < ph.filesz)
+801013b3:	8b 85 18 ff ff ff    	mov    -0xe8(%ebp),%eax
+801013b9:	8b 95 14 ff ff ff    	mov    -0xec(%ebp),%edx
+801013bf:	39 d0                	cmp    %edx,%eax
+801013c1:	0f 82 a1 02 00 00    	jb     80101668 <execinto+0x3b5>
+      goto bad;
+    if(ph.vaddr + ph.memsz < ph.vaddr || ph.vaddr + ph.memsz >= UMAPBASE)
+801013c7:	8b 8d 0c ff ff ff    	mov    -0xf4(%ebp),%ecx
+801013cd:	01 c8                	add    %ecx,%eax
+801013cf:	0f 82 93 02 00 00    	jb     80101668 <execinto+0x3b5>
+801013d5:	89 85 70 fd ff ff    	mov    %eax,-0x290(%ebp)
+801013db:	3d ff ff ff 5f       	cmp    $0x5fffffff,%eax
+801013e0:	0f 87 82 02 00 00    	ja     80101668 <execinto+0x3b5>
+      goto bad;
+    if(ph.vaddr % PGSIZE != 0)
+801013e6:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+801013ec:	0f 85 76 02 00 00    	jne    80101668 <execinto+0x3b5>
+      goto bad;
+    if(ph.off + ph.filesz < ph.off || ph.off + ph.filesz > ip->size)
+801013f2:	8b b5 08 ff ff ff    	mov    -0xf8(%ebp),%esi
+801013f8:	89 d0                	mov    %edx,%eax
+801013fa:	01 f0                	add    %esi,%eax
+801013fc:	0f 82 66 02 00 00    	jb     80101668 <execinto+0x3b5>
+80101402:	39 47 58             	cmp    %eax,0x58(%edi)
+80101405:	0f 82 5d 02 00 00    	jb     80101668 <execinto+0x3b5>
+      goto bad;
+    if(ph.vaddr + ph.memsz > sz)
+8010140b:	8b 85 70 fd ff ff    	mov    -0x290(%ebp),%eax
+80101411:	39 85 6c fd ff ff    	cmp    %eax,-0x294(%ebp)
+80101417:	73 06                	jae    8010141f <execinto+0x16c>
+      sz = ph.vaddr + ph.memsz;
+80101419:	89 85 6c fd ff ff    	mov    %eax,-0x294(%ebp)
+    if(ph.filesz == 0)
+8010141f:	85 d2                	test   %edx,%edx
+80101421:	0f 84 46 ff ff ff    	je     8010136d <execinto+0xba>
+      continue;
+    if(vmaadd(vma, ph.vaddr, ph.filesz, ph.off, ip, VMA_WRITE) < 0)
+80101427:	83 ec 08             	sub    $0x8,%esp
+8010142a:	6a 01                	push   $0x1
+8010142c:	57                   	push   %edi
+8010142d:	56                   	push   %esi
+8010142e:	52                   	push   %edx
+8010142f:	51                   	push   %ecx
+80101430:	8d 85 84 fd ff ff    	lea    -0x27c(%ebp),%eax
+80101436:	50                   	push   %eax
+80101437:	e8 3f 9f 00 00       	call   8010b37b <vmaadd>
+8010143c:	83 c4 20             	add    $0x20,%esp
+8010143f:	85 c0                	test   %eax,%eax
+80101441:	0f 89 26 ff ff ff    	jns    8010136d <execinto+0xba>
+80101447:	e9 1c 02 00 00       	jmp    80101668 <execinto+0x3b5>
+      goto bad;
+  }
+  iunlockput(ip);
+8010144c:	8b 75 0c             	mov    0xc(%ebp),%esi
+8010144f:	83 ec 0c             	sub    $0xc,%esp
+80101452:	57                   	push   %edi
+80101453:	e8 b0 0d 00 00       	call   80102208 <iunlockput>
+  end_op();
+80101458:	e8 71 36 00 00       	call   80104ace <end_op>
+  ip = 0;
+
+  // Allocate two pages at the next page boundary.
+  // Make the first inaccessible.  Use the second as the user stack.
+  sz = PGROUNDUP(sz);
+8010145d:	8b 85 6c fd ff ff    	mov    -0x294(%ebp),%eax
+80101463:	05 ff 0f 00 00       	add    $0xfff,%eax
+80101468:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
+8010146d:	83 c4 0c             	add    $0xc,%esp
+80101470:	8d 90 00 20 00 00    	lea    0x2000(%eax),%edx
+80101476:	52                   	push   %edx
+80101477:	50                   	push   %eax
+80101478:	8b bd 68 fd ff ff    	mov    -0x298(%ebp),%edi
+8010147e:	57                   	push   %edi
+8010147f:	e8 a1 9a 00 00       	call   8010af25 <allocuvm>
+80101484:	89 c3                	mov    %eax,%ebx
+80101486:	89 85 74 fd ff ff    	mov    %eax,-0x28c(%ebp)
+8010148c:	83 c4 10             	add    $0x10,%esp
+8010148f:	85 c0                	test   %eax,%eax
+80101491:	0f 84 be 01 00 00    	je     80101655 <execinto+0x3a2>
+    goto bad;
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+80101497:	8d 80 00 e0 ff ff    	lea    -0x2000(%eax),%eax
+8010149d:	83 ec 08             	sub    $0x8,%esp
+801014a0:	50                   	push   %eax
+801014a1:	57                   	push   %edi
+801014a2:	e8 4c 9c 00 00       	call   8010b0f3 <clearpteu>
+  sp = sz;
+
+  // Push argument strings, prepare rest of stack in ustack.
+  for(argc = 0; argv[argc]; argc++) {
+801014a7:	83 c4 10             	add    $0x10,%esp
+  sp = sz;
+801014aa:	89 d8                	mov    %ebx,%eax
+  for(argc = 0; argv[argc]; argc++) {
+801014ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+801014b1:	89 75 0c             	mov    %esi,0xc(%ebp)
+801014b4:	89 c6                	mov    %eax,%esi
+801014b6:	8b 45 10             	mov    0x10(%ebp),%eax
+801014b9:	8d 3c 98             	lea    (%eax,%ebx,4),%edi
+801014bc:	8b 07                	mov    (%edi),%eax
+801014be:	85 c0                	test   %eax,%eax
+801014c0:	74 4d                	je     8010150f <execinto+0x25c>
+    if(argc >= MAXARG)
+801014c2:	83 fb 1f             	cmp    $0x1f,%ebx
+801014c5:	0f 87 91 01 00 00    	ja     8010165c <execinto+0x3a9>
+      goto bad;
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+801014cb:	83 ec 0c             	sub    $0xc,%esp
+801014ce:	50                   	push   %eax
+801014cf:	e8 13 68 00 00       	call   80107ce7 <strlen>
+801014d4:	29 c6                	sub    %eax,%esi
+801014d6:	83 ee 01             	sub    $0x1,%esi
+801014d9:	83 e6 fc             	and    $0xfffffffc,%esi
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+801014dc:	83 c4 04             	add    $0x4,%esp
+801014df:	ff 37                	push   (%edi)
+801014e1:	e8 01 68 00 00       	call   80107ce7 <strlen>
+801014e6:	83 c0 01             	add    $0x1,%eax
+801014e9:	50                   	push   %eax
+801014ea:	ff 37                	push   (%edi)
+801014ec:	56                   	push   %esi
+801014ed:	ff b5 68 fd ff ff    	push   -0x298(%ebp)
+801014f3:	e8 86 a3 00 00       	call   8010b87e <copyout>
+801014f8:	83 c4 20             	add    $0x20,%esp
+801014fb:	85 c0                	test   %eax,%eax
+801014fd:	0f 88 60 01 00 00    	js     80101663 <execinto+0x3b0>
+      goto bad;
+    ustack[3+argc] = sp;
+80101503:	89 b4 9d 64 ff ff ff 	mov    %esi,-0x9c(%ebp,%ebx,4)
+  for(argc = 0; argv[argc]; argc++) {
+8010150a:	83 c3 01             	add    $0x1,%ebx
+8010150d:	eb a7                	jmp    801014b6 <execinto+0x203>
+  }
+  ustack[3+argc] = 0;
+8010150f:	89 f1                	mov    %esi,%ecx
+80101511:	89 c7                	mov    %eax,%edi
+80101513:	8b 75 0c             	mov    0xc(%ebp),%esi
+80101516:	c7 84 9d 64 ff ff ff 	movl   $0x0,-0x9c(%ebp,%ebx,4)
+8010151d:	00 00 00 00 
+
+  ustack[0] = 0xffffffff;  // fake return PC
+80101521:	c7 85 58 ff ff ff ff 	movl   $0xffffffff,-0xa8(%ebp)
+80101528:	ff ff ff 
+  ustack[1] = argc;
+8010152b:	89 9d 5c ff ff ff    	mov    %ebx,-0xa4(%ebp)
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+80101531:	8d 14 9d 04 00 00 00 	lea    0x4(,%ebx,4),%edx
+80101538:	89 c8                	mov    %ecx,%eax
+8010153a:	29 d0                	sub    %edx,%eax
+8010153c:	89 85 60 ff ff ff    	mov    %eax,-0xa0(%ebp)
+
+  sp -= (3+argc+1) * 4;
+80101542:	8d 04 9d 10 00 00 00 	lea    0x10(,%ebx,4),%eax
+80101549:	29 c1                	sub    %eax,%ecx
+8010154b:	89 cb                	mov    %ecx,%ebx
+  if(copyout(pgdir, sp, ustack, (3+argc+1)*4) < 0)
+8010154d:	50                   	push   %eax
+8010154e:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+80101554:	50                   	push   %eax
+80101555:	51                   	push   %ecx
+80101556:	ff b5 68 fd ff ff    	push   -0x298(%ebp)
+8010155c:	e8 1d a3 00 00       	call   8010b87e <copyout>
+80101561:	83 c4 10             	add    $0x10,%esp
+80101564:	85 c0                	test   %eax,%eax
+80101566:	0f 88 fc 00 00 00    	js     80101668 <execinto+0x3b5>
+    goto bad;
+
+  // Save program name for debugging.
+  for(last=s=path; *s; s++)
+8010156c:	89 f2                	mov    %esi,%edx
+8010156e:	eb 03                	jmp    80101573 <execinto+0x2c0>
+80101570:	83 c6 01             	add    $0x1,%esi
+80101573:	0f b6 06             	movzbl (%esi),%eax
+80101576:	84 c0                	test   %al,%al
+80101578:	74 09                	je     80101583 <execinto+0x2d0>
+    if(*s == '/')
+8010157a:	3c 2f                	cmp    $0x2f,%al
+8010157c:	75 f2                	jne    80101570 <execinto+0x2bd>
+      last = s+1;
+8010157e:	8d 56 01             	lea    0x1(%esi),%edx
+80101581:	eb ed                	jmp    80101570 <execinto+0x2bd>
+  safestrcpy(p->name, last, sizeof(p->name));
+80101583:	8b 45 08             	mov    0x8(%ebp),%eax
+80101586:	83 c0 6c             	add    $0x6c,%eax
+80101589:	83 ec 04             	sub    $0x4,%esp
+8010158c:	6a 10                	push   $0x10
+8010158e:	52                   	push   %edx
+8010158f:	50                   	push   %eax
+80101590:	e8 15 67 00 00       	call   80107caa <safestrcpy>
+
+  // Commit to the user image.
+  oldpgdir = p->pgdir;
+80101595:	8b 45 08             	mov    0x8(%ebp),%eax
+80101598:	8b 70 04             	mov    0x4(%eax),%esi
+  p->pgdir = pgdir;
+8010159b:	8b 8d 68 fd ff ff    	mov    -0x298(%ebp),%ecx
+801015a1:	89 48 04             	mov    %ecx,0x4(%eax)
+  p->sz = sz;
+801015a4:	8b 8d 74 fd ff ff    	mov    -0x28c(%ebp),%ecx
+801015aa:	89 08                	mov    %ecx,(%eax)
+  p->tf->eip = elf.entry;  // main
+801015ac:	8b 40 18             	mov    0x18(%eax),%eax
+801015af:	8b 95 3c ff ff ff    	mov    -0xc4(%ebp),%edx
+801015b5:	89 50 38             	mov    %edx,0x38(%eax)
+  p->tf->esp = sp;
+801015b8:	8b 45 08             	mov    0x8(%ebp),%eax
+801015bb:	8b 40 18             	mov    0x18(%eax),%eax
+801015be:	89 58 44             	mov    %ebx,0x44(%eax)
+  if(p == myproc())
+801015c1:	e8 45 47 00 00       	call   80105d0b <myproc>
+801015c6:	83 c4 10             	add    $0x10,%esp
+801015c9:	39 45 08             	cmp    %eax,0x8(%ebp)
+801015cc:	74 69                	je     80101637 <execinto+0x384>
+    switchuvm(p);
+  if(p->borrowed)
+801015ce:	8b 45 08             	mov    0x8(%ebp),%eax
+801015d1:	83 b8 a4 00 00 00 00 	cmpl   $0x0,0xa4(%eax)
+801015d8:	75 6d                	jne    80101647 <execinto+0x394>
+    vforkdone(p);  // oldpgdir belongs to the vfork parent
+  else if(oldpgdir){
+801015da:	85 f6                	test   %esi,%esi
+801015dc:	74 1d                	je     801015fb <execinto+0x348>
+    vmasync(oldpgdir, p->vma);
+801015de:	8b 45 08             	mov    0x8(%ebp),%eax
+801015e1:	05 a8 00 00 00       	add    $0xa8,%eax
+801015e6:	83 ec 08             	sub    $0x8,%esp
+801015e9:	50                   	push   %eax
+801015ea:	56                   	push   %esi
+801015eb:	e8 d2 39 00 00       	call   80104fc2 <vmasync>
+    freevm(oldpgdir);
+801015f0:	89 34 24             	mov    %esi,(%esp)
+801015f3:	e8 00 9a 00 00       	call   8010aff8 <freevm>
+801015f8:	83 c4 10             	add    $0x10,%esp
+  }
+  vmafree(p->vma);
+801015fb:	8b 45 08             	mov    0x8(%ebp),%eax
+801015fe:	8d 98 a8 00 00 00    	lea    0xa8(%eax),%ebx
+80101604:	83 ec 0c             	sub    $0xc,%esp
+80101607:	53                   	push   %ebx
+80101608:	e8 e7 9e 00 00       	call   8010b4f4 <vmafree>
+  memmove(p->vma, vma, sizeof(vma));
+8010160d:	83 c4 0c             	add    $0xc,%esp
+80101610:	68 80 01 00 00       	push   $0x180
+80101615:	8d 85 84 fd ff ff    	lea    -0x27c(%ebp),%eax
+8010161b:	50                   	push   %eax
+8010161c:	53                   	push   %ebx
+8010161d:	e8 94 65 00 00       	call   80107bb6 <memmove>
+  aiofree(p);
+80101622:	83 c4 04             	add    $0x4,%esp
+80101625:	ff 75 08             	push   0x8(%ebp)
+80101628:	e8 1f ec ff ff       	call   8010024c <aiofree>
+  return 0;
+8010162d:	83 c4 10             	add    $0x10,%esp
+80101630:	b8 00 00 00 00       	mov    $0x0,%eax
+80101635:	eb 6e                	jmp    801016a5 <execinto+0x3f2>
+    switchuvm(p);
+80101637:	83 ec 0c             	sub    $0xc,%esp
+8010163a:	ff 75 08             	push   0x8(%ebp)
+8010163d:	e8 62 96 00 00       	call   8010aca4 <switchuvm>
+80101642:	83 c4 10             	add    $0x10,%esp
+80101645:	eb 87                	jmp    801015ce <execinto+0x31b>
+    vforkdone(p);  // oldpgdir belongs to the vfork parent
+80101647:	83 ec 0c             	sub    $0xc,%esp
+8010164a:	50                   	push   %eax
+8010164b:	e8 ff 4a 00 00       	call   8010614f <vforkdone>
+80101650:	83 c4 10             	add    $0x10,%esp
+80101653:	eb a6                	jmp    801015fb <execinto+0x348>
+  ip = 0;
+80101655:	bf 00 00 00 00       	mov    $0x0,%edi
+8010165a:	eb 0c                	jmp    80101668 <execinto+0x3b5>
+8010165c:	bf 00 00 00 00       	mov    $0x0,%edi
+80101661:	eb 05                	jmp    80101668 <execinto+0x3b5>
+80101663:	bf 00 00 00 00       	mov    $0x0,%edi
+
+ bad:
+  if(pgdir)
+    freevm(pgdir);
+80101668:	83 ec 0c             	sub    $0xc,%esp
+8010166b:	ff b5 68 fd ff ff    	push   -0x298(%ebp)
+80101671:	e8 82 99 00 00       	call   8010aff8 <freevm>
+80101676:	83 c4 10             	add    $0x10,%esp
+  if(ip){
+80101679:	85 ff                	test   %edi,%edi
+8010167b:	74 11                	je     8010168e <execinto+0x3db>
+    iunlockput(ip);
+8010167d:	83 ec 0c             	sub    $0xc,%esp
+80101680:	57                   	push   %edi
+80101681:	e8 82 0b 00 00       	call   80102208 <iunlockput>
+    end_op();
+80101686:	e8 43 34 00 00       	call   80104ace <end_op>
+8010168b:	83 c4 10             	add    $0x10,%esp
+  }
+  vmafree(vma);
+8010168e:	83 ec 0c             	sub    $0xc,%esp
+80101691:	8d 85 84 fd ff ff    	lea    -0x27c(%ebp),%eax
+80101697:	50                   	push   %eax
+80101698:	e8 57 9e 00 00       	call   8010b4f4 <vmafree>
+  return -1;
+8010169d:	83 c4 10             	add    $0x10,%esp
+801016a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801016a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801016a8:	5b                   	pop    %ebx
+801016a9:	5e                   	pop    %esi
+801016aa:	5f                   	pop    %edi
+801016ab:	5d                   	pop    %ebp
+801016ac:	c3                   	ret
+
+801016ad <exec>:
+{
+801016ad:	55                   	push   %ebp
+801016ae:	89 e5                	mov    %esp,%ebp
+801016b0:	83 ec 08             	sub    $0x8,%esp
+  return execinto(myproc(), path, argv);
+801016b3:	e8 53 46 00 00       	call   80105d0b <myproc>
+801016b8:	83 ec 04             	sub    $0x4,%esp
+801016bb:	ff 75 0c             	push   0xc(%ebp)
+801016be:	ff 75 08             	push   0x8(%ebp)
+801016c1:	50                   	push   %eax
+801016c2:	e8 ec fb ff ff       	call   801012b3 <execinto>
+}
+801016c7:	c9                   	leave
+801016c8:	c3                   	ret
+
+801016c9 <fileinit>:
+  struct kmcache *cache;
+} ftable;
+
+void
+fileinit(void)
+{
+801016c9:	55                   	push   %ebp
+801016ca:	89 e5                	mov    %esp,%ebp
+801016cc:	83 ec 10             	sub    $0x10,%esp
+  initlock(&ftable.lock, "ftable");
+801016cf:	68 29 ba 10 80       	push   $0x8010ba29
+801016d4:	68 c0 76 11 80       	push   $0x801176c0
+801016d9:	e8 70 62 00 00       	call   8010794e <initlock>
+  ftable.cache = kmcache_create("file", sizeof(struct file));
+801016de:	83 c4 08             	add    $0x8,%esp
+801016e1:	6a 18                	push   $0x18
+801016e3:	68 30 ba 10 80       	push   $0x8010ba30
+801016e8:	e8 d0 5e 00 00       	call   801075bd <kmcache_create>
+801016ed:	a3 f4 76 11 80       	mov    %eax,0x801176f4
+}
+801016f2:	83 c4 10             	add    $0x10,%esp
+801016f5:	c9                   	leave
+801016f6:	c3                   	ret
+
+801016f7 <filealloc>:
+
+// Allocate a file structure.
+struct file*
+filealloc(void)
+{
+801016f7:	55                   	push   %ebp
+801016f8:	89 e5                	mov    %esp,%ebp
+801016fa:	53                   	push   %ebx
+801016fb:	83 ec 10             	sub    $0x10,%esp
+  struct file *f;
+
+  if((f = kmcache_alloc(ftable.cache)) == 0)
+801016fe:	ff 35 f4 76 11 80    	push   0x801176f4
+80101704:	e8 80 5f 00 00       	call   80107689 <kmcache_alloc>
+80101709:	89 c3                	mov    %eax,%ebx
+8010170b:	83 c4 10             	add    $0x10,%esp
+8010170e:	85 c0                	test   %eax,%eax
+80101710:	74 17                	je     80101729 <filealloc+0x32>
+    return 0;
+  memset(f, 0, sizeof(*f));
+80101712:	83 ec 04             	sub    $0x4,%esp
+80101715:	6a 18                	push   $0x18
+80101717:	6a 00                	push   $0x0
+80101719:	50                   	push   %eax
+8010171a:	e8 1f 64 00 00       	call   80107b3e <memset>
+  f->ref = 1;
+8010171f:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+  return f;
+80101726:	83 c4 10             	add    $0x10,%esp
+}
+80101729:	89 d8                	mov    %ebx,%eax
+8010172b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010172e:	c9                   	leave
+8010172f:	c3                   	ret
+
+80101730 <filedup>:
+
+// Increment ref count for file f.
+struct file*
+filedup(struct file *f)
+{
+80101730:	55                   	push   %ebp
+80101731:	89 e5                	mov    %esp,%ebp
+80101733:	53                   	push   %ebx
+80101734:	83 ec 10             	sub    $0x10,%esp
+80101737:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&ftable.lock);
+8010173a:	68 c0 76 11 80       	push   $0x801176c0
+8010173f:	e8 4e 63 00 00       	call   80107a92 <acquire>
+  if(f->ref < 1)
+80101744:	8b 43 04             	mov    0x4(%ebx),%eax
+80101747:	83 c4 10             	add    $0x10,%esp
+8010174a:	85 c0                	test   %eax,%eax
+8010174c:	7e 1a                	jle    80101768 <filedup+0x38>
+    panic("filedup");
+  f->ref++;
+8010174e:	83 c0 01             	add    $0x1,%eax
+80101751:	89 43 04             	mov    %eax,0x4(%ebx)
+  release(&ftable.lock);
+80101754:	83 ec 0c             	sub    $0xc,%esp
+80101757:	68 c0 76 11 80       	push   $0x801176c0
+8010175c:	e8 96 63 00 00       	call   80107af7 <release>
+  return f;
+}
+80101761:	89 d8                	mov    %ebx,%eax
+80101763:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101766:	c9                   	leave
+80101767:	c3                   	ret
+    panic("filedup");
+80101768:	83 ec 0c             	sub    $0xc,%esp
+8010176b:	68 35 ba 10 80       	push   $0x8010ba35
+80101770:	e8 b6 f5 ff ff       	call   80100d2b <panic>
+
+80101775 <fileclose>:
+
+// Close file f.  (Decrement ref count, close when reaches 0.)
+void
+fileclose(struct file *f)
+{
+80101775:	55                   	push   %ebp
+80101776:	89 e5                	mov    %esp,%ebp
+80101778:	53                   	push   %ebx
+80101779:	83 ec 30             	sub    $0x30,%esp
+8010177c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct file ff;
+
+  acquire(&ftable.lock);
+8010177f:	68 c0 76 11 80       	push   $0x801176c0
+80101784:	e8 09 63 00 00       	call   80107a92 <acquire>
+  if(f->ref < 1)
+80101789:	8b 43 04             	mov    0x4(%ebx),%eax
+8010178c:	83 c4 10             	add    $0x10,%esp
+8010178f:	85 c0                	test   %eax,%eax
+80101791:	0f 8e 84 00 00 00    	jle    8010181b <fileclose+0xa6>
+    panic("fileclose");
+  if(--f->ref > 0){
+80101797:	83 e8 01             	sub    $0x1,%eax
+8010179a:	89 43 04             	mov    %eax,0x4(%ebx)
+8010179d:	85 c0                	test   %eax,%eax
+8010179f:	0f 8f 83 00 00 00    	jg     80101828 <fileclose+0xb3>
+    release(&ftable.lock);
+    return;
+  }
+  ff = *f;
+801017a5:	8b 03                	mov    (%ebx),%eax
+801017a7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801017aa:	8b 43 04             	mov    0x4(%ebx),%eax
+801017ad:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801017b0:	8b 43 08             	mov    0x8(%ebx),%eax
+801017b3:	89 45 e8             	mov    %eax,-0x18(%ebp)
+801017b6:	8b 43 0c             	mov    0xc(%ebx),%eax
+801017b9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+801017bc:	8b 43 10             	mov    0x10(%ebx),%eax
+801017bf:	89 45 f0             	mov    %eax,-0x10(%ebp)
+801017c2:	8b 43 14             	mov    0x14(%ebx),%eax
+801017c5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  f->ref = 0;
+801017c8:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  f->type = FD_NONE;
+801017cf:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  release(&ftable.lock);
+801017d5:	83 ec 0c             	sub    $0xc,%esp
+801017d8:	68 c0 76 11 80       	push   $0x801176c0
+801017dd:	e8 15 63 00 00       	call   80107af7 <release>
+  kmcache_free(ftable.cache, f);
+801017e2:	83 c4 08             	add    $0x8,%esp
+801017e5:	53                   	push   %ebx
+801017e6:	ff 35 f4 76 11 80    	push   0x801176f4
+801017ec:	e8 6a 5f 00 00       	call   8010775b <kmcache_free>
+
+  if(ff.type == FD_PIPE)
+801017f1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801017f4:	83 c4 10             	add    $0x10,%esp
+801017f7:	83 f8 01             	cmp    $0x1,%eax
+801017fa:	74 41                	je     8010183d <fileclose+0xc8>
+    pipeclose(ff.pipe, ff.writable);
+  else if(ff.type == FD_INODE){
+801017fc:	83 f8 02             	cmp    $0x2,%eax
+801017ff:	75 37                	jne    80101838 <fileclose+0xc3>
+    begin_op();
+80101801:	e8 34 32 00 00       	call   80104a3a <begin_op>
+    iput(ff.ip);
+80101806:	83 ec 0c             	sub    $0xc,%esp
+80101809:	ff 75 f0             	push   -0x10(%ebp)
+8010180c:	e8 57 09 00 00       	call   80102168 <iput>
+    end_op();
+80101811:	e8 b8 32 00 00       	call   80104ace <end_op>
+80101816:	83 c4 10             	add    $0x10,%esp
+80101819:	eb 1d                	jmp    80101838 <fileclose+0xc3>
+    panic("fileclose");
+8010181b:	83 ec 0c             	sub    $0xc,%esp
+8010181e:	68 3d ba 10 80       	push   $0x8010ba3d
+80101823:	e8 03 f5 ff ff       	call   80100d2b <panic>
+    release(&ftable.lock);
+80101828:	83 ec 0c             	sub    $0xc,%esp
+8010182b:	68 c0 76 11 80       	push   $0x801176c0
+80101830:	e8 c2 62 00 00       	call   80107af7 <release>
+    return;
+80101835:	83 c4 10             	add    $0x10,%esp
+  }
+}
+80101838:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010183b:	c9                   	leave
+8010183c:	c3                   	ret
+    pipeclose(ff.pipe, ff.writable);
+8010183d:	83 ec 08             	sub    $0x8,%esp
+80101840:	0f be 45 e9          	movsbl -0x17(%ebp),%eax
+80101844:	50                   	push   %eax
+80101845:	ff 75 ec             	push   -0x14(%ebp)
+80101848:	e8 fa 3f 00 00       	call   80105847 <pipeclose>
+8010184d:	83 c4 10             	add    $0x10,%esp
+80101850:	eb e6                	jmp    80101838 <fileclose+0xc3>
+
+80101852 <filestat>:
+
+// Get metadata about file f.
+int
+filestat(struct file *f, struct stat *st)
+{
+80101852:	55                   	push   %ebp
+80101853:	89 e5                	mov    %esp,%ebp
+80101855:	53                   	push   %ebx
+80101856:	83 ec 04             	sub    $0x4,%esp
+80101859:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->type == FD_INODE){
+8010185c:	83 3b 02             	cmpl   $0x2,(%ebx)
+8010185f:	75 31                	jne    80101892 <filestat+0x40>
+    ilock(f->ip);
+80101861:	83 ec 0c             	sub    $0xc,%esp
+80101864:	ff 73 10             	push   0x10(%ebx)
+80101867:	e8 f5 07 00 00       	call   80102061 <ilock>
+    stati(f->ip, st);
+8010186c:	83 c4 08             	add    $0x8,%esp
+8010186f:	ff 75 0c             	push   0xc(%ebp)
+80101872:	ff 73 10             	push   0x10(%ebx)
+80101875:	e8 ae 09 00 00       	call   80102228 <stati>
+    iunlock(f->ip);
+8010187a:	83 c4 04             	add    $0x4,%esp
+8010187d:	ff 73 10             	push   0x10(%ebx)
+80101880:	e8 9e 08 00 00       	call   80102123 <iunlock>
+    return 0;
+80101885:	83 c4 10             	add    $0x10,%esp
+80101888:	b8 00 00 00 00       	mov    $0x0,%eax
+  }
+  return -1;
+}
+8010188d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101890:	c9                   	leave
+80101891:	c3                   	ret
+  return -1;
+80101892:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101897:	eb f4                	jmp    8010188d <filestat+0x3b>
+
+80101899 <fileread>:
+
+// Read from file f.
+int
+fileread(struct file *f, char *addr, int n)
+{
+80101899:	55                   	push   %ebp
+8010189a:	89 e5                	mov    %esp,%ebp
+8010189c:	56                   	push   %esi
+8010189d:	53                   	push   %ebx
+8010189e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+
+  if(f->readable == 0)
+801018a1:	80 7b 08 00          	cmpb   $0x0,0x8(%ebx)
+801018a5:	74 70                	je     80101917 <fileread+0x7e>
+    return -1;
+  if(f->type == FD_PIPE)
+801018a7:	8b 03                	mov    (%ebx),%eax
+801018a9:	83 f8 01             	cmp    $0x1,%eax
+801018ac:	74 44                	je     801018f2 <fileread+0x59>
+    return piperead(f->pipe, addr, n);
+  if(f->type == FD_INODE){
+801018ae:	83 f8 02             	cmp    $0x2,%eax
+801018b1:	75 57                	jne    8010190a <fileread+0x71>
+    ilock(f->ip);
+801018b3:	83 ec 0c             	sub    $0xc,%esp
+801018b6:	ff 73 10             	push   0x10(%ebx)
+801018b9:	e8 a3 07 00 00       	call   80102061 <ilock>
+    if((r = readi(f->ip, addr, f->off, n)) > 0)
+801018be:	ff 75 10             	push   0x10(%ebp)
+801018c1:	ff 73 14             	push   0x14(%ebx)
+801018c4:	ff 75 0c             	push   0xc(%ebp)
+801018c7:	ff 73 10             	push   0x10(%ebx)
+801018ca:	e8 88 0a 00 00       	call   80102357 <readi>
+801018cf:	89 c6                	mov    %eax,%esi
+801018d1:	83 c4 20             	add    $0x20,%esp
+801018d4:	85 c0                	test   %eax,%eax
+801018d6:	7e 03                	jle    801018db <fileread+0x42>
+      f->off += r;
+801018d8:	01 43 14             	add    %eax,0x14(%ebx)
+    iunlock(f->ip);
+801018db:	83 ec 0c             	sub    $0xc,%esp
+801018de:	ff 73 10             	push   0x10(%ebx)
+801018e1:	e8 3d 08 00 00       	call   80102123 <iunlock>
+    return r;
+801018e6:	83 c4 10             	add    $0x10,%esp
+  }
+  panic("fileread");
+}
+801018e9:	89 f0                	mov    %esi,%eax
+801018eb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801018ee:	5b                   	pop    %ebx
+801018ef:	5e                   	pop    %esi
+801018f0:	5d                   	pop    %ebp
+801018f1:	c3                   	ret
+    return piperead(f->pipe, addr, n);
+801018f2:	83 ec 04             	sub    $0x4,%esp
+801018f5:	ff 75 10             	push   0x10(%ebp)
+801018f8:	ff 75 0c             	push   0xc(%ebp)
+801018fb:	ff 73 0c             	push   0xc(%ebx)
+801018fe:	e8 9c 40 00 00       	call   8010599f <piperead>
+80101903:	89 c6                	mov    %eax,%esi
+80101905:	83 c4 10             	add    $0x10,%esp
+80101908:	eb df                	jmp    801018e9 <fileread+0x50>
+  panic("fileread");
+8010190a:	83 ec 0c             	sub    $0xc,%esp
+8010190d:	68 47 ba 10 80       	push   $0x8010ba47
+80101912:	e8 14 f4 ff ff       	call   80100d2b <panic>
+    return -1;
+80101917:	be ff ff ff ff       	mov    $0xffffffff,%esi
+8010191c:	eb cb                	jmp    801018e9 <fileread+0x50>
+
+8010191e <filewrite>:
+
+// Write to file f.
+int
+filewrite(struct file *f, char *addr, int n)
+{
+8010191e:	55                   	push   %ebp
+8010191f:	89 e5                	mov    %esp,%ebp
+80101921:	57                   	push   %edi
+80101922:	56                   	push   %esi
+80101923:	53                   	push   %ebx
+80101924:	83 ec 1c             	sub    $0x1c,%esp
+80101927:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+
+  if(f->writable == 0)
+8010192a:	80 7e 09 00          	cmpb   $0x0,0x9(%esi)
+8010192e:	0f 84 cc 00 00 00    	je     80101a00 <filewrite+0xe2>
+    return -1;
+  if(f->type == FD_PIPE)
+80101934:	8b 06                	mov    (%esi),%eax
+80101936:	83 f8 01             	cmp    $0x1,%eax
+80101939:	74 10                	je     8010194b <filewrite+0x2d>
+    return pipewrite(f->pipe, addr, n);
+  if(f->type == FD_INODE){
+8010193b:	83 f8 02             	cmp    $0x2,%eax
+8010193e:	0f 85 af 00 00 00    	jne    801019f3 <filewrite+0xd5>
+    // i-node, indirect block, allocation blocks,
+    // and 2 blocks of slop for non-aligned writes.
+    // this really belongs lower down, since writei()
+    // might be writing a device like the console.
+    int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
+    int i = 0;
+80101944:	bf 00 00 00 00       	mov    $0x0,%edi
+80101949:	eb 67                	jmp    801019b2 <filewrite+0x94>
+    return pipewrite(f->pipe, addr, n);
+8010194b:	83 ec 04             	sub    $0x4,%esp
+8010194e:	ff 75 10             	push   0x10(%ebp)
+80101951:	ff 75 0c             	push   0xc(%ebp)
+80101954:	ff 76 0c             	push   0xc(%esi)
+80101957:	e8 7e 3f 00 00       	call   801058da <pipewrite>
+8010195c:	83 c4 10             	add    $0x10,%esp
+8010195f:	e9 82 00 00 00       	jmp    801019e6 <filewrite+0xc8>
+    while(i < n){
+      int n1 = n - i;
+      if(n1 > max)
+        n1 = max;
+
+      begin_op();
+80101964:	e8 d1 30 00 00       	call   80104a3a <begin_op>
+      ilock(f->ip);
+80101969:	83 ec 0c             	sub    $0xc,%esp
+8010196c:	ff 76 10             	push   0x10(%esi)
+8010196f:	e8 ed 06 00 00       	call   80102061 <ilock>
+      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
+80101974:	ff 75 e4             	push   -0x1c(%ebp)
+80101977:	ff 76 14             	push   0x14(%esi)
+8010197a:	89 f8                	mov    %edi,%eax
+8010197c:	03 45 0c             	add    0xc(%ebp),%eax
+8010197f:	50                   	push   %eax
+80101980:	ff 76 10             	push   0x10(%esi)
+80101983:	e8 eb 0a 00 00       	call   80102473 <writei>
+80101988:	89 c3                	mov    %eax,%ebx
+8010198a:	83 c4 20             	add    $0x20,%esp
+8010198d:	85 c0                	test   %eax,%eax
+8010198f:	7e 03                	jle    80101994 <filewrite+0x76>
+        f->off += r;
+80101991:	01 46 14             	add    %eax,0x14(%esi)
+      iunlock(f->ip);
+80101994:	83 ec 0c             	sub    $0xc,%esp
+80101997:	ff 76 10             	push   0x10(%esi)
+8010199a:	e8 84 07 00 00       	call   80102123 <iunlock>
+      end_op();
+8010199f:	e8 2a 31 00 00       	call   80104ace <end_op>
+
+      if(r < 0)
+801019a4:	83 c4 10             	add    $0x10,%esp
+801019a7:	85 db                	test   %ebx,%ebx
+801019a9:	78 31                	js     801019dc <filewrite+0xbe>
+        break;
+      if(r != n1)
+801019ab:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+801019ae:	75 1f                	jne    801019cf <filewrite+0xb1>
+        panic("short filewrite");
+      i += r;
+801019b0:	01 df                	add    %ebx,%edi
+    while(i < n){
+801019b2:	3b 7d 10             	cmp    0x10(%ebp),%edi
+801019b5:	7d 25                	jge    801019dc <filewrite+0xbe>
+      int n1 = n - i;
+801019b7:	8b 45 10             	mov    0x10(%ebp),%eax
+801019ba:	29 f8                	sub    %edi,%eax
+801019bc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      if(n1 > max)
+801019bf:	3d 00 06 00 00       	cmp    $0x600,%eax
+801019c4:	7e 9e                	jle    80101964 <filewrite+0x46>
+        n1 = max;
+801019c6:	c7 45 e4 00 06 00 00 	movl   $0x600,-0x1c(%ebp)
+801019cd:	eb 95                	jmp    80101964 <filewrite+0x46>
+        panic("short filewrite");
+801019cf:	83 ec 0c             	sub    $0xc,%esp
+801019d2:	68 50 ba 10 80       	push   $0x8010ba50
+801019d7:	e8 4f f3 ff ff       	call   80100d2b <panic>
+    }
+    return i == n ? n : -1;
+801019dc:	3b 7d 10             	cmp    0x10(%ebp),%edi
+801019df:	74 0d                	je     801019ee <filewrite+0xd0>
+801019e1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  }
+  panic("filewrite");
+}
+801019e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801019e9:	5b                   	pop    %ebx
+801019ea:	5e                   	pop    %esi
+801019eb:	5f                   	pop    %edi
+801019ec:	5d                   	pop    %ebp
+801019ed:	c3                   	ret
+    return i == n ? n : -1;
+801019ee:	8b 45 10             	mov    0x10(%ebp),%eax
+801019f1:	eb f3                	jmp    801019e6 <filewrite+0xc8>
+  panic("filewrite");
+801019f3:	83 ec 0c             	sub    $0xc,%esp
+801019f6:	68 56 ba 10 80       	push   $0x8010ba56
+801019fb:	e8 2b f3 ff ff       	call   80100d2b <panic>
+    return -1;
+80101a00:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101a05:	eb df                	jmp    801019e6 <filewrite+0xc8>
+
+80101a07 <skipelem>:
+//   skipelem("a", name) = "", setting name = "a"
+//   skipelem("", name) = skipelem("////", name) = 0
+//
+static char*
+skipelem(char *path, char *name)
+{
+80101a07:	55                   	push   %ebp
+80101a08:	89 e5                	mov    %esp,%ebp
+80101a0a:	57                   	push   %edi
+80101a0b:	56                   	push   %esi
+80101a0c:	53                   	push   %ebx
+80101a0d:	83 ec 0c             	sub    $0xc,%esp
+80101a10:	89 d6                	mov    %edx,%esi
+  char *s;
+  int len;
+
+  while(*path == '/')
+80101a12:	eb 03                	jmp    80101a17 <skipelem+0x10>
+    path++;
+80101a14:	83 c0 01             	add    $0x1,%eax
+  while(*path == '/')
+80101a17:	0f b6 10             	movzbl (%eax),%edx
+80101a1a:	80 fa 2f             	cmp    $0x2f,%dl
+80101a1d:	74 f5                	je     80101a14 <skipelem+0xd>
+  if(*path == 0)
+80101a1f:	84 d2                	test   %dl,%dl
+80101a21:	74 53                	je     80101a76 <skipelem+0x6f>
+80101a23:	89 c3                	mov    %eax,%ebx
+80101a25:	eb 03                	jmp    80101a2a <skipelem+0x23>
+    return 0;
+  s = path;
+  while(*path != '/' && *path != 0)
+    path++;
+80101a27:	83 c3 01             	add    $0x1,%ebx
+  while(*path != '/' && *path != 0)
+80101a2a:	0f b6 13             	movzbl (%ebx),%edx
+80101a2d:	80 fa 2f             	cmp    $0x2f,%dl
+80101a30:	74 04                	je     80101a36 <skipelem+0x2f>
+80101a32:	84 d2                	test   %dl,%dl
+80101a34:	75 f1                	jne    80101a27 <skipelem+0x20>
+  len = path - s;
+80101a36:	89 df                	mov    %ebx,%edi
+80101a38:	29 c7                	sub    %eax,%edi
+  if(len >= DIRSIZ)
+80101a3a:	83 ff 0d             	cmp    $0xd,%edi
+80101a3d:	7e 11                	jle    80101a50 <skipelem+0x49>
+    memmove(name, s, DIRSIZ);
+80101a3f:	83 ec 04             	sub    $0x4,%esp
+80101a42:	6a 0e                	push   $0xe
+80101a44:	50                   	push   %eax
+80101a45:	56                   	push   %esi
+80101a46:	e8 6b 61 00 00       	call   80107bb6 <memmove>
+80101a4b:	83 c4 10             	add    $0x10,%esp
+80101a4e:	eb 17                	jmp    80101a67 <skipelem+0x60>
+  else {
+    memmove(name, s, len);
+80101a50:	83 ec 04             	sub    $0x4,%esp
+80101a53:	57                   	push   %edi
+80101a54:	50                   	push   %eax
+80101a55:	56                   	push   %esi
+80101a56:	e8 5b 61 00 00       	call   80107bb6 <memmove>
+    name[len] = 0;
+80101a5b:	c6 04 3e 00          	movb   $0x0,(%esi,%edi,1)
+80101a5f:	83 c4 10             	add    $0x10,%esp
+80101a62:	eb 03                	jmp    80101a67 <skipelem+0x60>
+  }
+  while(*path == '/')
+    path++;
+80101a64:	83 c3 01             	add    $0x1,%ebx
+  while(*path == '/')
+80101a67:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+80101a6a:	74 f8                	je     80101a64 <skipelem+0x5d>
+  return path;
+}
+80101a6c:	89 d8                	mov    %ebx,%eax
+80101a6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101a71:	5b                   	pop    %ebx
+80101a72:	5e                   	pop    %esi
+80101a73:	5f                   	pop    %edi
+80101a74:	5d                   	pop    %ebp
+80101a75:	c3                   	ret
+    return 0;
+80101a76:	bb 00 00 00 00       	mov    $0x0,%ebx
+80101a7b:	eb ef                	jmp    80101a6c <skipelem+0x65>
+
+80101a7d <bzero>:
+{
+80101a7d:	55                   	push   %ebp
+80101a7e:	89 e5                	mov    %esp,%ebp
+80101a80:	53                   	push   %ebx
+80101a81:	83 ec 0c             	sub    $0xc,%esp
+  bp = bread(dev, bno);
+80101a84:	52                   	push   %edx
+80101a85:	50                   	push   %eax
+80101a86:	e8 b5 ed ff ff       	call   80100840 <bread>
+80101a8b:	89 c3                	mov    %eax,%ebx
+  memset(bp->data, 0, BSIZE);
+80101a8d:	8d 40 74             	lea    0x74(%eax),%eax
+80101a90:	83 c4 0c             	add    $0xc,%esp
+80101a93:	68 00 02 00 00       	push   $0x200
+80101a98:	6a 00                	push   $0x0
+80101a9a:	50                   	push   %eax
+80101a9b:	e8 9e 60 00 00       	call   80107b3e <memset>
+  log_write(bp);
+80101aa0:	89 1c 24             	mov    %ebx,(%esp)
+80101aa3:	e8 60 30 00 00       	call   80104b08 <log_write>
+  brelse(bp);
+80101aa8:	89 1c 24             	mov    %ebx,(%esp)
+80101aab:	e8 d2 ee ff ff       	call   80100982 <brelse>
+}
+80101ab0:	83 c4 10             	add    $0x10,%esp
+80101ab3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101ab6:	c9                   	leave
+80101ab7:	c3                   	ret
+
+80101ab8 <balloc>:
+{
+80101ab8:	55                   	push   %ebp
+80101ab9:	89 e5                	mov    %esp,%ebp
+80101abb:	57                   	push   %edi
+80101abc:	56                   	push   %esi
+80101abd:	53                   	push   %ebx
+80101abe:	83 ec 1c             	sub    $0x1c,%esp
+80101ac1:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  for(b = 0; b < sb.size; b += BPB){
+80101ac4:	be 00 00 00 00       	mov    $0x0,%esi
+80101ac9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+80101acc:	eb 15                	jmp    80101ae3 <balloc+0x2b>
+    brelse(bp);
+80101ace:	83 ec 0c             	sub    $0xc,%esp
+80101ad1:	ff 75 e0             	push   -0x20(%ebp)
+80101ad4:	e8 a9 ee ff ff       	call   80100982 <brelse>
+  for(b = 0; b < sb.size; b += BPB){
+80101ad9:	81 45 e4 00 10 00 00 	addl   $0x1000,-0x1c(%ebp)
+80101ae0:	83 c4 10             	add    $0x10,%esp
+80101ae3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101ae6:	3b 05 0c 96 11 80    	cmp    0x8011960c,%eax
+80101aec:	73 6e                	jae    80101b5c <balloc+0xa4>
+    bp = bread(dev, BBLOCK(b, sb));
+80101aee:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80101af1:	8d 83 ff 0f 00 00    	lea    0xfff(%ebx),%eax
+80101af7:	85 db                	test   %ebx,%ebx
+80101af9:	0f 49 c3             	cmovns %ebx,%eax
+80101afc:	c1 f8 0c             	sar    $0xc,%eax
+80101aff:	83 ec 08             	sub    $0x8,%esp
+80101b02:	03 05 24 96 11 80    	add    0x80119624,%eax
+80101b08:	50                   	push   %eax
+80101b09:	ff 75 dc             	push   -0x24(%ebp)
+80101b0c:	e8 2f ed ff ff       	call   80100840 <bread>
+80101b11:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
+80101b14:	83 c4 10             	add    $0x10,%esp
+80101b17:	b8 00 00 00 00       	mov    $0x0,%eax
+80101b1c:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+80101b21:	7f ab                	jg     80101ace <balloc+0x16>
+80101b23:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80101b26:	8d 1c 07             	lea    (%edi,%eax,1),%ebx
+80101b29:	3b 1d 0c 96 11 80    	cmp    0x8011960c,%ebx
+80101b2f:	73 9d                	jae    80101ace <balloc+0x16>
+      m = 1 << (bi % 8);
+80101b31:	89 c1                	mov    %eax,%ecx
+80101b33:	83 e1 07             	and    $0x7,%ecx
+80101b36:	be 01 00 00 00       	mov    $0x1,%esi
+80101b3b:	d3 e6                	shl    %cl,%esi
+      if((bp->data[bi/8] & m) == 0){  // Is block free?
+80101b3d:	8d 50 07             	lea    0x7(%eax),%edx
+80101b40:	85 c0                	test   %eax,%eax
+80101b42:	0f 49 d0             	cmovns %eax,%edx
+80101b45:	c1 fa 03             	sar    $0x3,%edx
+80101b48:	8b 7d e0             	mov    -0x20(%ebp),%edi
+80101b4b:	0f b6 4c 17 74       	movzbl 0x74(%edi,%edx,1),%ecx
+80101b50:	0f b6 f9             	movzbl %cl,%edi
+80101b53:	85 f7                	test   %esi,%edi
+80101b55:	74 12                	je     80101b69 <balloc+0xb1>
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
+80101b57:	83 c0 01             	add    $0x1,%eax
+80101b5a:	eb c0                	jmp    80101b1c <balloc+0x64>
+  panic("balloc: out of blocks");
+80101b5c:	83 ec 0c             	sub    $0xc,%esp
+80101b5f:	68 60 ba 10 80       	push   $0x8010ba60
+80101b64:	e8 c2 f1 ff ff       	call   80100d2b <panic>
+        bp->data[bi/8] |= m;  // Mark block in use.
+80101b69:	89 c8                	mov    %ecx,%eax
+80101b6b:	89 f1                	mov    %esi,%ecx
+80101b6d:	09 c1                	or     %eax,%ecx
+80101b6f:	8b 75 e0             	mov    -0x20(%ebp),%esi
+80101b72:	88 4c 16 74          	mov    %cl,0x74(%esi,%edx,1)
+        log_write(bp);
+80101b76:	83 ec 0c             	sub    $0xc,%esp
+80101b79:	56                   	push   %esi
+80101b7a:	e8 89 2f 00 00       	call   80104b08 <log_write>
+        brelse(bp);
+80101b7f:	89 34 24             	mov    %esi,(%esp)
+80101b82:	e8 fb ed ff ff       	call   80100982 <brelse>
+        bzero(dev, b + bi);
+80101b87:	89 da                	mov    %ebx,%edx
+80101b89:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80101b8c:	e8 ec fe ff ff       	call   80101a7d <bzero>
+}
+80101b91:	89 d8                	mov    %ebx,%eax
+80101b93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101b96:	5b                   	pop    %ebx
+80101b97:	5e                   	pop    %esi
+80101b98:	5f                   	pop    %edi
+80101b99:	5d                   	pop    %ebp
+80101b9a:	c3                   	ret
+
+80101b9b <bmap>:
+{
+80101b9b:	55                   	push   %ebp
+80101b9c:	89 e5                	mov    %esp,%ebp
+80101b9e:	57                   	push   %edi
+80101b9f:	56                   	push   %esi
+80101ba0:	53                   	push   %ebx
+80101ba1:	83 ec 1c             	sub    $0x1c,%esp
+80101ba4:	89 c3                	mov    %eax,%ebx
+80101ba6:	89 d7                	mov    %edx,%edi
+  if(bn < NDIRECT){
+80101ba8:	83 fa 0b             	cmp    $0xb,%edx
+80101bab:	76 45                	jbe    80101bf2 <bmap+0x57>
+  bn -= NDIRECT;
+80101bad:	8d 72 f4             	lea    -0xc(%edx),%esi
+  if(bn < NINDIRECT){
+80101bb0:	83 fe 7f             	cmp    $0x7f,%esi
+80101bb3:	77 7f                	ja     80101c34 <bmap+0x99>
+    if((addr = ip->addrs[NDIRECT]) == 0)
+80101bb5:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+80101bbb:	85 c0                	test   %eax,%eax
+80101bbd:	74 4a                	je     80101c09 <bmap+0x6e>
+    bp = bread(ip->dev, addr);
+80101bbf:	83 ec 08             	sub    $0x8,%esp
+80101bc2:	50                   	push   %eax
+80101bc3:	ff 33                	push   (%ebx)
+80101bc5:	e8 76 ec ff ff       	call   80100840 <bread>
+80101bca:	89 c7                	mov    %eax,%edi
+    if((addr = a[bn]) == 0){
+80101bcc:	8d 44 b0 74          	lea    0x74(%eax,%esi,4),%eax
+80101bd0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80101bd3:	8b 30                	mov    (%eax),%esi
+80101bd5:	83 c4 10             	add    $0x10,%esp
+80101bd8:	85 f6                	test   %esi,%esi
+80101bda:	74 3c                	je     80101c18 <bmap+0x7d>
+    brelse(bp);
+80101bdc:	83 ec 0c             	sub    $0xc,%esp
+80101bdf:	57                   	push   %edi
+80101be0:	e8 9d ed ff ff       	call   80100982 <brelse>
+    return addr;
+80101be5:	83 c4 10             	add    $0x10,%esp
+}
+80101be8:	89 f0                	mov    %esi,%eax
+80101bea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101bed:	5b                   	pop    %ebx
+80101bee:	5e                   	pop    %esi
+80101bef:	5f                   	pop    %edi
+80101bf0:	5d                   	pop    %ebp
+80101bf1:	c3                   	ret
+    if((addr = ip->addrs[bn]) == 0)
+80101bf2:	8b 74 90 5c          	mov    0x5c(%eax,%edx,4),%esi
+80101bf6:	85 f6                	test   %esi,%esi
+80101bf8:	75 ee                	jne    80101be8 <bmap+0x4d>
+      ip->addrs[bn] = addr = balloc(ip->dev);
+80101bfa:	8b 00                	mov    (%eax),%eax
+80101bfc:	e8 b7 fe ff ff       	call   80101ab8 <balloc>
+80101c01:	89 c6                	mov    %eax,%esi
+80101c03:	89 44 bb 5c          	mov    %eax,0x5c(%ebx,%edi,4)
+    return addr;
+80101c07:	eb df                	jmp    80101be8 <bmap+0x4d>
+      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+80101c09:	8b 03                	mov    (%ebx),%eax
+80101c0b:	e8 a8 fe ff ff       	call   80101ab8 <balloc>
+80101c10:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+80101c16:	eb a7                	jmp    80101bbf <bmap+0x24>
+      a[bn] = addr = balloc(ip->dev);
+80101c18:	8b 03                	mov    (%ebx),%eax
+80101c1a:	e8 99 fe ff ff       	call   80101ab8 <balloc>
+80101c1f:	89 c6                	mov    %eax,%esi
+80101c21:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101c24:	89 30                	mov    %esi,(%eax)
+      log_write(bp);
+80101c26:	83 ec 0c             	sub    $0xc,%esp
+80101c29:	57                   	push   %edi
+80101c2a:	e8 d9 2e 00 00       	call   80104b08 <log_write>
+80101c2f:	83 c4 10             	add    $0x10,%esp
+80101c32:	eb a8                	jmp    80101bdc <bmap+0x41>
+  panic("bmap: out of range");
+80101c34:	83 ec 0c             	sub    $0xc,%esp
+80101c37:	68 76 ba 10 80       	push   $0x8010ba76
+80101c3c:	e8 ea f0 ff ff       	call   80100d2b <panic>
+
+80101c41 <iget>:
+{
+80101c41:	55                   	push   %ebp
+80101c42:	89 e5                	mov    %esp,%ebp
+80101c44:	57                   	push   %edi
+80101c45:	56                   	push   %esi
+80101c46:	53                   	push   %ebx
+80101c47:	83 ec 28             	sub    $0x28,%esp
+80101c4a:	89 c7                	mov    %eax,%edi
+80101c4c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  acquire(&icache.lock);
+80101c4f:	68 60 77 11 80       	push   $0x80117760
+80101c54:	e8 39 5e 00 00       	call   80107a92 <acquire>
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+80101c59:	83 c4 10             	add    $0x10,%esp
+  empty = 0;
+80101c5c:	be 00 00 00 00       	mov    $0x0,%esi
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+80101c61:	bb 94 77 11 80       	mov    $0x80117794,%ebx
+80101c66:	eb 0a                	jmp    80101c72 <iget+0x31>
+    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
+80101c68:	85 f6                	test   %esi,%esi
+80101c6a:	74 3b                	je     80101ca7 <iget+0x66>
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+80101c6c:	81 c3 9c 00 00 00    	add    $0x9c,%ebx
+80101c72:	81 fb 0c 96 11 80    	cmp    $0x8011960c,%ebx
+80101c78:	73 35                	jae    80101caf <iget+0x6e>
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+80101c7a:	8b 43 08             	mov    0x8(%ebx),%eax
+80101c7d:	85 c0                	test   %eax,%eax
+80101c7f:	7e e7                	jle    80101c68 <iget+0x27>
+80101c81:	39 3b                	cmp    %edi,(%ebx)
+80101c83:	75 e3                	jne    80101c68 <iget+0x27>
+80101c85:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80101c88:	39 4b 04             	cmp    %ecx,0x4(%ebx)
+80101c8b:	75 db                	jne    80101c68 <iget+0x27>
+      ip->ref++;
+80101c8d:	83 c0 01             	add    $0x1,%eax
+80101c90:	89 43 08             	mov    %eax,0x8(%ebx)
+      release(&icache.lock);
+80101c93:	83 ec 0c             	sub    $0xc,%esp
+80101c96:	68 60 77 11 80       	push   $0x80117760
+80101c9b:	e8 57 5e 00 00       	call   80107af7 <release>
+      return ip;
+80101ca0:	83 c4 10             	add    $0x10,%esp
+80101ca3:	89 de                	mov    %ebx,%esi
+80101ca5:	eb 50                	jmp    80101cf7 <iget+0xb6>
+    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
+80101ca7:	85 c0                	test   %eax,%eax
+80101ca9:	75 c1                	jne    80101c6c <iget+0x2b>
+      empty = ip;
+80101cab:	89 de                	mov    %ebx,%esi
+80101cad:	eb bd                	jmp    80101c6c <iget+0x2b>
+  if(empty == 0)
+80101caf:	85 f6                	test   %esi,%esi
+80101cb1:	74 4e                	je     80101d01 <iget+0xc0>
+  ip->dev = dev;
+80101cb3:	89 3e                	mov    %edi,(%esi)
+  ip->inum = inum;
+80101cb5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101cb8:	89 46 04             	mov    %eax,0x4(%esi)
+  ip->ref = 1;
+80101cbb:	c7 46 08 01 00 00 00 	movl   $0x1,0x8(%esi)
+  ip->valid = 0;
+80101cc2:	c7 46 4c 00 00 00 00 	movl   $0x0,0x4c(%esi)
+  ip->ranext = ip->raend = ip->rawin = 0;
+80101cc9:	c7 86 98 00 00 00 00 	movl   $0x0,0x98(%esi)
+80101cd0:	00 00 00 
+80101cd3:	c7 86 94 00 00 00 00 	movl   $0x0,0x94(%esi)
+80101cda:	00 00 00 
+80101cdd:	c7 86 90 00 00 00 00 	movl   $0x0,0x90(%esi)
+80101ce4:	00 00 00 
+  release(&icache.lock);
+80101ce7:	83 ec 0c             	sub    $0xc,%esp
+80101cea:	68 60 77 11 80       	push   $0x80117760
+80101cef:	e8 03 5e 00 00       	call   80107af7 <release>
+  return ip;
+80101cf4:	83 c4 10             	add    $0x10,%esp
+}
+80101cf7:	89 f0                	mov    %esi,%eax
+80101cf9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101cfc:	5b                   	pop    %ebx
+80101cfd:	5e                   	pop    %esi
+80101cfe:	5f                   	pop    %edi
+80101cff:	5d                   	pop    %ebp
+80101d00:	c3                   	ret
+    panic("iget: no inodes");
+80101d01:	83 ec 0c             	sub    $0xc,%esp
+80101d04:	68 89 ba 10 80       	push   $0x8010ba89
+80101d09:	e8 1d f0 ff ff       	call   80100d2b <panic>
+
+80101d0e <readsb>:
+{
+80101d0e:	55                   	push   %ebp
+80101d0f:	89 e5                	mov    %esp,%ebp
+80101d11:	53                   	push   %ebx
+80101d12:	83 ec 0c             	sub    $0xc,%esp
+  bp = bread(dev, 1);
+80101d15:	6a 01                	push   $0x1
+80101d17:	ff 75 08             	push   0x8(%ebp)
+80101d1a:	e8 21 eb ff ff       	call   80100840 <bread>
+80101d1f:	89 c3                	mov    %eax,%ebx
+  memmove(sb, bp->data, sizeof(*sb));
+80101d21:	8d 40 74             	lea    0x74(%eax),%eax
+80101d24:	83 c4 0c             	add    $0xc,%esp
+80101d27:	6a 1c                	push   $0x1c
+80101d29:	50                   	push   %eax
+80101d2a:	ff 75 0c             	push   0xc(%ebp)
+80101d2d:	e8 84 5e 00 00       	call   80107bb6 <memmove>
+  brelse(bp);
+80101d32:	89 1c 24             	mov    %ebx,(%esp)
+80101d35:	e8 48 ec ff ff       	call   80100982 <brelse>
+}
+80101d3a:	83 c4 10             	add    $0x10,%esp
+80101d3d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101d40:	c9                   	leave
+80101d41:	c3                   	ret
+
+80101d42 <bfree>:
+{
+80101d42:	55                   	push   %ebp
+80101d43:	89 e5                	mov    %esp,%ebp
+80101d45:	56                   	push   %esi
+80101d46:	53                   	push   %ebx
+80101d47:	89 c3                	mov    %eax,%ebx
+80101d49:	89 d6                	mov    %edx,%esi
+  readsb(dev, &sb);
+80101d4b:	83 ec 08             	sub    $0x8,%esp
+80101d4e:	68 0c 96 11 80       	push   $0x8011960c
+80101d53:	50                   	push   %eax
+80101d54:	e8 b5 ff ff ff       	call   80101d0e <readsb>
+  bp = bread(dev, BBLOCK(b, sb));
+80101d59:	89 f0                	mov    %esi,%eax
+80101d5b:	c1 e8 0c             	shr    $0xc,%eax
+80101d5e:	83 c4 08             	add    $0x8,%esp
+80101d61:	03 05 24 96 11 80    	add    0x80119624,%eax
+80101d67:	50                   	push   %eax
+80101d68:	53                   	push   %ebx
+80101d69:	e8 d2 ea ff ff       	call   80100840 <bread>
+80101d6e:	89 c3                	mov    %eax,%ebx
+  bi = b % BPB;
+80101d70:	89 f2                	mov    %esi,%edx
+80101d72:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  m = 1 << (bi % 8);
+80101d78:	89 f1                	mov    %esi,%ecx
+80101d7a:	83 e1 07             	and    $0x7,%ecx
+80101d7d:	b8 01 00 00 00       	mov    $0x1,%eax
+80101d82:	d3 e0                	shl    %cl,%eax
+  if((bp->data[bi/8] & m) == 0)
+80101d84:	83 c4 10             	add    $0x10,%esp
+80101d87:	c1 fa 03             	sar    $0x3,%edx
+80101d8a:	0f b6 4c 13 74       	movzbl 0x74(%ebx,%edx,1),%ecx
+80101d8f:	0f b6 f1             	movzbl %cl,%esi
+80101d92:	85 c6                	test   %eax,%esi
+80101d94:	74 23                	je     80101db9 <bfree+0x77>
+  bp->data[bi/8] &= ~m;
+80101d96:	f7 d0                	not    %eax
+80101d98:	21 c8                	and    %ecx,%eax
+80101d9a:	88 44 13 74          	mov    %al,0x74(%ebx,%edx,1)
+  log_write(bp);
+80101d9e:	83 ec 0c             	sub    $0xc,%esp
+80101da1:	53                   	push   %ebx
+80101da2:	e8 61 2d 00 00       	call   80104b08 <log_write>
+  brelse(bp);
+80101da7:	89 1c 24             	mov    %ebx,(%esp)
+80101daa:	e8 d3 eb ff ff       	call   80100982 <brelse>
+}
+80101daf:	83 c4 10             	add    $0x10,%esp
+80101db2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101db5:	5b                   	pop    %ebx
+80101db6:	5e                   	pop    %esi
+80101db7:	5d                   	pop    %ebp
+80101db8:	c3                   	ret
+    panic("freeing free block");
+80101db9:	83 ec 0c             	sub    $0xc,%esp
+80101dbc:	68 99 ba 10 80       	push   $0x8010ba99
+80101dc1:	e8 65 ef ff ff       	call   80100d2b <panic>
+
+80101dc6 <iinit>:
+{
+80101dc6:	55                   	push   %ebp
+80101dc7:	89 e5                	mov    %esp,%ebp
+80101dc9:	53                   	push   %ebx
+80101dca:	83 ec 0c             	sub    $0xc,%esp
+  initlock(&icache.lock, "icache");
+80101dcd:	68 ac ba 10 80       	push   $0x8010baac
+80101dd2:	68 60 77 11 80       	push   $0x80117760
+80101dd7:	e8 72 5b 00 00       	call   8010794e <initlock>
+  for(i = 0; i < NINODE; i++) {
+80101ddc:	83 c4 10             	add    $0x10,%esp
+80101ddf:	bb 00 00 00 00       	mov    $0x0,%ebx
+80101de4:	eb 1f                	jmp    80101e05 <iinit+0x3f>
+    initsleeplock(&icache.inode[i].lock, "inode");
+80101de6:	83 ec 08             	sub    $0x8,%esp
+80101de9:	68 b3 ba 10 80       	push   $0x8010bab3
+80101dee:	69 c3 9c 00 00 00    	imul   $0x9c,%ebx,%eax
+80101df4:	05 a0 77 11 80       	add    $0x801177a0,%eax
+80101df9:	50                   	push   %eax
+80101dfa:	e8 ba 54 00 00       	call   801072b9 <initsleeplock>
+  for(i = 0; i < NINODE; i++) {
+80101dff:	83 c3 01             	add    $0x1,%ebx
+80101e02:	83 c4 10             	add    $0x10,%esp
+80101e05:	83 fb 31             	cmp    $0x31,%ebx
+80101e08:	7e dc                	jle    80101de6 <iinit+0x20>
+  readsb(dev, &sb);
+80101e0a:	83 ec 08             	sub    $0x8,%esp
+80101e0d:	68 0c 96 11 80       	push   $0x8011960c
+80101e12:	ff 75 08             	push   0x8(%ebp)
+80101e15:	e8 f4 fe ff ff       	call   80101d0e <readsb>
+  cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
+80101e1a:	ff 35 24 96 11 80    	push   0x80119624
+80101e20:	ff 35 20 96 11 80    	push   0x80119620
+80101e26:	ff 35 1c 96 11 80    	push   0x8011961c
+80101e2c:	ff 35 18 96 11 80    	push   0x80119618
+80101e32:	ff 35 14 96 11 80    	push   0x80119614
+80101e38:	ff 35 10 96 11 80    	push   0x80119610
+80101e3e:	ff 35 0c 96 11 80    	push   0x8011960c
+80101e44:	68 18 bb 10 80       	push   $0x8010bb18
+80101e49:	e8 9e f1 ff ff       	call   80100fec <cprintf>
+}
+80101e4e:	83 c4 30             	add    $0x30,%esp
+80101e51:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101e54:	c9                   	leave
+80101e55:	c3                   	ret
+
+80101e56 <ialloc>:
+{
+80101e56:	55                   	push   %ebp
+80101e57:	89 e5                	mov    %esp,%ebp
+80101e59:	57                   	push   %edi
+80101e5a:	56                   	push   %esi
+80101e5b:	53                   	push   %ebx
+80101e5c:	83 ec 1c             	sub    $0x1c,%esp
+80101e5f:	8b 45 0c             	mov    0xc(%ebp),%eax
+80101e62:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for(inum = 1; inum < sb.ninodes; inum++){
+80101e65:	bb 01 00 00 00       	mov    $0x1,%ebx
+80101e6a:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+80101e6d:	3b 1d 14 96 11 80    	cmp    0x80119614,%ebx
+80101e73:	73 3f                	jae    80101eb4 <ialloc+0x5e>
+    bp = bread(dev, IBLOCK(inum, sb));
+80101e75:	89 d8                	mov    %ebx,%eax
+80101e77:	c1 e8 03             	shr    $0x3,%eax
+80101e7a:	83 ec 08             	sub    $0x8,%esp
+80101e7d:	03 05 20 96 11 80    	add    0x80119620,%eax
+80101e83:	50                   	push   %eax
+80101e84:	ff 75 08             	push   0x8(%ebp)
+80101e87:	e8 b4 e9 ff ff       	call   80100840 <bread>
+80101e8c:	89 c6                	mov    %eax,%esi
+    dip = (struct dinode*)bp->data + inum%IPB;
+80101e8e:	89 d8                	mov    %ebx,%eax
+80101e90:	83 e0 07             	and    $0x7,%eax
+80101e93:	c1 e0 06             	shl    $0x6,%eax
+80101e96:	8d 7c 06 74          	lea    0x74(%esi,%eax,1),%edi
+    if(dip->type == 0){  // a free inode
+80101e9a:	83 c4 10             	add    $0x10,%esp
+80101e9d:	66 83 3f 00          	cmpw   $0x0,(%edi)
+80101ea1:	74 1e                	je     80101ec1 <ialloc+0x6b>
+    brelse(bp);
+80101ea3:	83 ec 0c             	sub    $0xc,%esp
+80101ea6:	56                   	push   %esi
+80101ea7:	e8 d6 ea ff ff       	call   80100982 <brelse>
+  for(inum = 1; inum < sb.ninodes; inum++){
+80101eac:	83 c3 01             	add    $0x1,%ebx
+80101eaf:	83 c4 10             	add    $0x10,%esp
+80101eb2:	eb b6                	jmp    80101e6a <ialloc+0x14>
+  panic("ialloc: no inodes");
+80101eb4:	83 ec 0c             	sub    $0xc,%esp
+80101eb7:	68 b9 ba 10 80       	push   $0x8010bab9
+80101ebc:	e8 6a ee ff ff       	call   80100d2b <panic>
+      memset(dip, 0, sizeof(*dip));
+80101ec1:	83 ec 04             	sub    $0x4,%esp
+80101ec4:	6a 40                	push   $0x40
+80101ec6:	6a 00                	push   $0x0
+80101ec8:	57                   	push   %edi
+80101ec9:	e8 70 5c 00 00       	call   80107b3e <memset>
+      dip->type = type;
+80101ece:	0f b7 45 e0          	movzwl -0x20(%ebp),%eax
+80101ed2:	66 89 07             	mov    %ax,(%edi)
+      log_write(bp);   // mark it allocated on the disk
+80101ed5:	89 34 24             	mov    %esi,(%esp)
+80101ed8:	e8 2b 2c 00 00       	call   80104b08 <log_write>
+      brelse(bp);
+80101edd:	89 34 24             	mov    %esi,(%esp)
+80101ee0:	e8 9d ea ff ff       	call   80100982 <brelse>
+      return iget(dev, inum);
+80101ee5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80101ee8:	8b 45 08             	mov    0x8(%ebp),%eax
+80101eeb:	e8 51 fd ff ff       	call   80101c41 <iget>
+}
+80101ef0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101ef3:	5b                   	pop    %ebx
+80101ef4:	5e                   	pop    %esi
+80101ef5:	5f                   	pop    %edi
+80101ef6:	5d                   	pop    %ebp
+80101ef7:	c3                   	ret
+
+80101ef8 <iupdate>:
+{
+80101ef8:	55                   	push   %ebp
+80101ef9:	89 e5                	mov    %esp,%ebp
+80101efb:	56                   	push   %esi
+80101efc:	53                   	push   %ebx
+80101efd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80101f00:	8b 43 04             	mov    0x4(%ebx),%eax
+80101f03:	c1 e8 03             	shr    $0x3,%eax
+80101f06:	83 ec 08             	sub    $0x8,%esp
+80101f09:	03 05 20 96 11 80    	add    0x80119620,%eax
+80101f0f:	50                   	push   %eax
+80101f10:	ff 33                	push   (%ebx)
+80101f12:	e8 29 e9 ff ff       	call   80100840 <bread>
+80101f17:	89 c6                	mov    %eax,%esi
+  dip = (struct dinode*)bp->data + ip->inum%IPB;
+80101f19:	8b 43 04             	mov    0x4(%ebx),%eax
+80101f1c:	83 e0 07             	and    $0x7,%eax
+80101f1f:	c1 e0 06             	shl    $0x6,%eax
+80101f22:	8d 44 06 74          	lea    0x74(%esi,%eax,1),%eax
+  dip->type = ip->type;
+80101f26:	0f b7 53 50          	movzwl 0x50(%ebx),%edx
+80101f2a:	66 89 10             	mov    %dx,(%eax)
+  dip->major = ip->major;
+80101f2d:	0f b7 53 52          	movzwl 0x52(%ebx),%edx
+80101f31:	66 89 50 02          	mov    %dx,0x2(%eax)
+  dip->minor = ip->minor;
+80101f35:	0f b7 53 54          	movzwl 0x54(%ebx),%edx
+80101f39:	66 89 50 04          	mov    %dx,0x4(%eax)
+  dip->nlink = ip->nlink;
+80101f3d:	0f b7 53 56          	movzwl 0x56(%ebx),%edx
+80101f41:	66 89 50 06          	mov    %dx,0x6(%eax)
+  dip->size = ip->size;
+80101f45:	8b 53 58             	mov    0x58(%ebx),%edx
+80101f48:	89 50 08             	mov    %edx,0x8(%eax)
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+80101f4b:	83 c3 5c             	add    $0x5c,%ebx
+80101f4e:	83 c0 0c             	add    $0xc,%eax
+80101f51:	83 c4 0c             	add    $0xc,%esp
+80101f54:	6a 34                	push   $0x34
+80101f56:	53                   	push   %ebx
+80101f57:	50                   	push   %eax
+80101f58:	e8 59 5c 00 00       	call   80107bb6 <memmove>
+  log_write(bp);
+80101f5d:	89 34 24             	mov    %esi,(%esp)
+80101f60:	e8 a3 2b 00 00       	call   80104b08 <log_write>
+  brelse(bp);
+80101f65:	89 34 24             	mov    %esi,(%esp)
+80101f68:	e8 15 ea ff ff       	call   80100982 <brelse>
+}
+80101f6d:	83 c4 10             	add    $0x10,%esp
+80101f70:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101f73:	5b                   	pop    %ebx
+80101f74:	5e                   	pop    %esi
+80101f75:	5d                   	pop    %ebp
+80101f76:	c3                   	ret
+
+80101f77 <itrunc>:
+{
+80101f77:	55                   	push   %ebp
+80101f78:	89 e5                	mov    %esp,%ebp
+80101f7a:	57                   	push   %edi
+80101f7b:	56                   	push   %esi
+80101f7c:	53                   	push   %ebx
+80101f7d:	83 ec 1c             	sub    $0x1c,%esp
+80101f80:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < NDIRECT; i++){
+80101f82:	bb 00 00 00 00       	mov    $0x0,%ebx
+80101f87:	eb 03                	jmp    80101f8c <itrunc+0x15>
+80101f89:	83 c3 01             	add    $0x1,%ebx
+80101f8c:	83 fb 0b             	cmp    $0xb,%ebx
+80101f8f:	7f 19                	jg     80101faa <itrunc+0x33>
+    if(ip->addrs[i]){
+80101f91:	8b 54 9e 5c          	mov    0x5c(%esi,%ebx,4),%edx
+80101f95:	85 d2                	test   %edx,%edx
+80101f97:	74 f0                	je     80101f89 <itrunc+0x12>
+      bfree(ip->dev, ip->addrs[i]);
+80101f99:	8b 06                	mov    (%esi),%eax
+80101f9b:	e8 a2 fd ff ff       	call   80101d42 <bfree>
+      ip->addrs[i] = 0;
+80101fa0:	c7 44 9e 5c 00 00 00 	movl   $0x0,0x5c(%esi,%ebx,4)
+80101fa7:	00 
+80101fa8:	eb df                	jmp    80101f89 <itrunc+0x12>
+  if(ip->addrs[NDIRECT]){
+80101faa:	8b 86 8c 00 00 00    	mov    0x8c(%esi),%eax
+80101fb0:	85 c0                	test   %eax,%eax
+80101fb2:	75 23                	jne    80101fd7 <itrunc+0x60>
+  ip->size = 0;
+80101fb4:	c7 46 58 00 00 00 00 	movl   $0x0,0x58(%esi)
+  iupdate(ip);
+80101fbb:	83 ec 0c             	sub    $0xc,%esp
+80101fbe:	56                   	push   %esi
+80101fbf:	e8 34 ff ff ff       	call   80101ef8 <iupdate>
+  pcinval(ip);
+80101fc4:	89 34 24             	mov    %esi,(%esp)
+80101fc7:	e8 e5 36 00 00       	call   801056b1 <pcinval>
+}
+80101fcc:	83 c4 10             	add    $0x10,%esp
+80101fcf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101fd2:	5b                   	pop    %ebx
+80101fd3:	5e                   	pop    %esi
+80101fd4:	5f                   	pop    %edi
+80101fd5:	5d                   	pop    %ebp
+80101fd6:	c3                   	ret
+    bp = bread(ip->dev, ip->addrs[NDIRECT]);
+80101fd7:	83 ec 08             	sub    $0x8,%esp
+80101fda:	50                   	push   %eax
+80101fdb:	ff 36                	push   (%esi)
+80101fdd:	e8 5e e8 ff ff       	call   80100840 <bread>
+80101fe2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    a = (uint*)bp->data;
+80101fe5:	8d 78 74             	lea    0x74(%eax),%edi
+    for(j = 0; j < NINDIRECT; j++){
+80101fe8:	83 c4 10             	add    $0x10,%esp
+80101feb:	bb 00 00 00 00       	mov    $0x0,%ebx
+80101ff0:	eb 03                	jmp    80101ff5 <itrunc+0x7e>
+80101ff2:	83 c3 01             	add    $0x1,%ebx
+80101ff5:	83 fb 7f             	cmp    $0x7f,%ebx
+80101ff8:	77 10                	ja     8010200a <itrunc+0x93>
+      if(a[j])
+80101ffa:	8b 14 9f             	mov    (%edi,%ebx,4),%edx
+80101ffd:	85 d2                	test   %edx,%edx
+80101fff:	74 f1                	je     80101ff2 <itrunc+0x7b>
+        bfree(ip->dev, a[j]);
+80102001:	8b 06                	mov    (%esi),%eax
+80102003:	e8 3a fd ff ff       	call   80101d42 <bfree>
+80102008:	eb e8                	jmp    80101ff2 <itrunc+0x7b>
+    brelse(bp);
+8010200a:	83 ec 0c             	sub    $0xc,%esp
+8010200d:	ff 75 e4             	push   -0x1c(%ebp)
+80102010:	e8 6d e9 ff ff       	call   80100982 <brelse>
+    bfree(ip->dev, ip->addrs[NDIRECT]);
+80102015:	8b 06                	mov    (%esi),%eax
+80102017:	8b 96 8c 00 00 00    	mov    0x8c(%esi),%edx
+8010201d:	e8 20 fd ff ff       	call   80101d42 <bfree>
+    ip->addrs[NDIRECT] = 0;
+80102022:	c7 86 8c 00 00 00 00 	movl   $0x0,0x8c(%esi)
+80102029:	00 00 00 
+8010202c:	83 c4 10             	add    $0x10,%esp
+8010202f:	eb 83                	jmp    80101fb4 <itrunc+0x3d>
+
+80102031 <idup>:
+{
+80102031:	55                   	push   %ebp
+80102032:	89 e5                	mov    %esp,%ebp
+80102034:	53                   	push   %ebx
+80102035:	83 ec 10             	sub    $0x10,%esp
+80102038:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&icache.lock);
+8010203b:	68 60 77 11 80       	push   $0x80117760
+80102040:	e8 4d 5a 00 00       	call   80107a92 <acquire>
+  ip->ref++;
+80102045:	8b 43 08             	mov    0x8(%ebx),%eax
+80102048:	83 c0 01             	add    $0x1,%eax
+8010204b:	89 43 08             	mov    %eax,0x8(%ebx)
+  release(&icache.lock);
+8010204e:	c7 04 24 60 77 11 80 	movl   $0x80117760,(%esp)
+80102055:	e8 9d 5a 00 00       	call   80107af7 <release>
+}
+8010205a:	89 d8                	mov    %ebx,%eax
+8010205c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010205f:	c9                   	leave
+80102060:	c3                   	ret
+
+80102061 <ilock>:
+{
+80102061:	55                   	push   %ebp
+80102062:	89 e5                	mov    %esp,%ebp
+80102064:	56                   	push   %esi
+80102065:	53                   	push   %ebx
+80102066:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || ip->ref < 1)
+80102069:	85 db                	test   %ebx,%ebx
+8010206b:	74 22                	je     8010208f <ilock+0x2e>
+8010206d:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+80102071:	7e 1c                	jle    8010208f <ilock+0x2e>
+  acquiresleep(&ip->lock);
+80102073:	83 ec 0c             	sub    $0xc,%esp
+80102076:	8d 43 0c             	lea    0xc(%ebx),%eax
+80102079:	50                   	push   %eax
+8010207a:	e8 6d 52 00 00       	call   801072ec <acquiresleep>
+  if(ip->valid == 0){
+8010207f:	83 c4 10             	add    $0x10,%esp
+80102082:	83 7b 4c 00          	cmpl   $0x0,0x4c(%ebx)
+80102086:	74 14                	je     8010209c <ilock+0x3b>
+}
+80102088:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010208b:	5b                   	pop    %ebx
+8010208c:	5e                   	pop    %esi
+8010208d:	5d                   	pop    %ebp
+8010208e:	c3                   	ret
+    panic("ilock");
+8010208f:	83 ec 0c             	sub    $0xc,%esp
+80102092:	68 cb ba 10 80       	push   $0x8010bacb
+80102097:	e8 8f ec ff ff       	call   80100d2b <panic>
+    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+8010209c:	8b 43 04             	mov    0x4(%ebx),%eax
+8010209f:	c1 e8 03             	shr    $0x3,%eax
+801020a2:	83 ec 08             	sub    $0x8,%esp
+801020a5:	03 05 20 96 11 80    	add    0x80119620,%eax
+801020ab:	50                   	push   %eax
+801020ac:	ff 33                	push   (%ebx)
+801020ae:	e8 8d e7 ff ff       	call   80100840 <bread>
+801020b3:	89 c6                	mov    %eax,%esi
+    dip = (struct dinode*)bp->data + ip->inum%IPB;
+801020b5:	8b 43 04             	mov    0x4(%ebx),%eax
+801020b8:	83 e0 07             	and    $0x7,%eax
+801020bb:	c1 e0 06             	shl    $0x6,%eax
+801020be:	8d 44 06 74          	lea    0x74(%esi,%eax,1),%eax
+    ip->type = dip->type;
+801020c2:	0f b7 10             	movzwl (%eax),%edx
+801020c5:	66 89 53 50          	mov    %dx,0x50(%ebx)
+    ip->major = dip->major;
+801020c9:	0f b7 50 02          	movzwl 0x2(%eax),%edx
+801020cd:	66 89 53 52          	mov    %dx,0x52(%ebx)
+    ip->minor = dip->minor;
+801020d1:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+801020d5:	66 89 53 54          	mov    %dx,0x54(%ebx)
+    ip->nlink = dip->nlink;
+801020d9:	0f b7 50 06          	movzwl 0x6(%eax),%edx
+801020dd:	66 89 53 56          	mov    %dx,0x56(%ebx)
+    ip->size = dip->size;
+801020e1:	8b 50 08             	mov    0x8(%eax),%edx
+801020e4:	89 53 58             	mov    %edx,0x58(%ebx)
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+801020e7:	83 c0 0c             	add    $0xc,%eax
+801020ea:	8d 53 5c             	lea    0x5c(%ebx),%edx
+801020ed:	83 c4 0c             	add    $0xc,%esp
+801020f0:	6a 34                	push   $0x34
+801020f2:	50                   	push   %eax
+801020f3:	52                   	push   %edx
+801020f4:	e8 bd 5a 00 00       	call   80107bb6 <memmove>
+    brelse(bp);
+801020f9:	89 34 24             	mov    %esi,(%esp)
+801020fc:	e8 81 e8 ff ff       	call   80100982 <brelse>
+    ip->valid = 1;
+80102101:	c7 43 4c 01 00 00 00 	movl   $0x1,0x4c(%ebx)
+    if(ip->type == 0)
+80102108:	83 c4 10             	add    $0x10,%esp
+8010210b:	66 83 7b 50 00       	cmpw   $0x0,0x50(%ebx)
+80102110:	0f 85 72 ff ff ff    	jne    80102088 <ilock+0x27>
+      panic("ilock: no type");
+80102116:	83 ec 0c             	sub    $0xc,%esp
+80102119:	68 d1 ba 10 80       	push   $0x8010bad1
+8010211e:	e8 08 ec ff ff       	call   80100d2b <panic>
+
+80102123 <iunlock>:
+{
+80102123:	55                   	push   %ebp
+80102124:	89 e5                	mov    %esp,%ebp
+80102126:	56                   	push   %esi
+80102127:	53                   	push   %ebx
+80102128:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+8010212b:	85 db                	test   %ebx,%ebx
+8010212d:	74 2c                	je     8010215b <iunlock+0x38>
+8010212f:	8d 73 0c             	lea    0xc(%ebx),%esi
+80102132:	83 ec 0c             	sub    $0xc,%esp
+80102135:	56                   	push   %esi
+80102136:	e8 86 52 00 00       	call   801073c1 <holdingsleep>
+8010213b:	83 c4 10             	add    $0x10,%esp
+8010213e:	85 c0                	test   %eax,%eax
+80102140:	74 19                	je     8010215b <iunlock+0x38>
+80102142:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+80102146:	7e 13                	jle    8010215b <iunlock+0x38>
+  releasesleep(&ip->lock);
+80102148:	83 ec 0c             	sub    $0xc,%esp
+8010214b:	56                   	push   %esi
+8010214c:	e8 35 52 00 00       	call   80107386 <releasesleep>
+}
+80102151:	83 c4 10             	add    $0x10,%esp
+80102154:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102157:	5b                   	pop    %ebx
+80102158:	5e                   	pop    %esi
+80102159:	5d                   	pop    %ebp
+8010215a:	c3                   	ret
+    panic("iunlock");
+8010215b:	83 ec 0c             	sub    $0xc,%esp
+8010215e:	68 e0 ba 10 80       	push   $0x8010bae0
+80102163:	e8 c3 eb ff ff       	call   80100d2b <panic>
+
+80102168 <iput>:
+{
+80102168:	55                   	push   %ebp
+80102169:	89 e5                	mov    %esp,%ebp
+8010216b:	57                   	push   %edi
+8010216c:	56                   	push   %esi
+8010216d:	53                   	push   %ebx
+8010216e:	83 ec 18             	sub    $0x18,%esp
+80102171:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquiresleep(&ip->lock);
+80102174:	8d 73 0c             	lea    0xc(%ebx),%esi
+80102177:	56                   	push   %esi
+80102178:	e8 6f 51 00 00       	call   801072ec <acquiresleep>
+  if(ip->valid && ip->nlink == 0){
+8010217d:	83 c4 10             	add    $0x10,%esp
+80102180:	83 7b 4c 00          	cmpl   $0x0,0x4c(%ebx)
+80102184:	74 07                	je     8010218d <iput+0x25>
+80102186:	66 83 7b 56 00       	cmpw   $0x0,0x56(%ebx)
+8010218b:	74 35                	je     801021c2 <iput+0x5a>
+  releasesleep(&ip->lock);
+8010218d:	83 ec 0c             	sub    $0xc,%esp
+80102190:	56                   	push   %esi
+80102191:	e8 f0 51 00 00       	call   80107386 <releasesleep>
+  acquire(&icache.lock);
+80102196:	c7 04 24 60 77 11 80 	movl   $0x80117760,(%esp)
+8010219d:	e8 f0 58 00 00       	call   80107a92 <acquire>
+  ip->ref--;
+801021a2:	8b 43 08             	mov    0x8(%ebx),%eax
+801021a5:	83 e8 01             	sub    $0x1,%eax
+801021a8:	89 43 08             	mov    %eax,0x8(%ebx)
+  release(&icache.lock);
+801021ab:	c7 04 24 60 77 11 80 	movl   $0x80117760,(%esp)
+801021b2:	e8 40 59 00 00       	call   80107af7 <release>
+}
+801021b7:	83 c4 10             	add    $0x10,%esp
+801021ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801021bd:	5b                   	pop    %ebx
+801021be:	5e                   	pop    %esi
+801021bf:	5f                   	pop    %edi
+801021c0:	5d                   	pop    %ebp
+801021c1:	c3                   	ret
+    acquire(&icache.lock);
+801021c2:	83 ec 0c             	sub    $0xc,%esp
+801021c5:	68 60 77 11 80       	push   $0x80117760
+801021ca:	e8 c3 58 00 00       	call   80107a92 <acquire>
+    int r = ip->ref;
+801021cf:	8b 7b 08             	mov    0x8(%ebx),%edi
+    release(&icache.lock);
+801021d2:	c7 04 24 60 77 11 80 	movl   $0x80117760,(%esp)
+801021d9:	e8 19 59 00 00       	call   80107af7 <release>
+    if(r == 1){
+801021de:	83 c4 10             	add    $0x10,%esp
+801021e1:	83 ff 01             	cmp    $0x1,%edi
+801021e4:	75 a7                	jne    8010218d <iput+0x25>
+      itrunc(ip);
+801021e6:	89 d8                	mov    %ebx,%eax
+801021e8:	e8 8a fd ff ff       	call   80101f77 <itrunc>
+      ip->type = 0;
+801021ed:	66 c7 43 50 00 00    	movw   $0x0,0x50(%ebx)
+      iupdate(ip);
+801021f3:	83 ec 0c             	sub    $0xc,%esp
+801021f6:	53                   	push   %ebx
+801021f7:	e8 fc fc ff ff       	call   80101ef8 <iupdate>
+      ip->valid = 0;
+801021fc:	c7 43 4c 00 00 00 00 	movl   $0x0,0x4c(%ebx)
+80102203:	83 c4 10             	add    $0x10,%esp
+80102206:	eb 85                	jmp    8010218d <iput+0x25>
+
+80102208 <iunlockput>:
+{
+80102208:	55                   	push   %ebp
+80102209:	89 e5                	mov    %esp,%ebp
+8010220b:	53                   	push   %ebx
+8010220c:	83 ec 10             	sub    $0x10,%esp
+8010220f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  iunlock(ip);
+80102212:	53                   	push   %ebx
+80102213:	e8 0b ff ff ff       	call   80102123 <iunlock>
+  iput(ip);
+80102218:	89 1c 24             	mov    %ebx,(%esp)
+8010221b:	e8 48 ff ff ff       	call   80102168 <iput>
+}
+80102220:	83 c4 10             	add    $0x10,%esp
+80102223:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102226:	c9                   	leave
+80102227:	c3                   	ret
+
+80102228 <stati>:
+{
+80102228:	55                   	push   %ebp
+80102229:	89 e5                	mov    %esp,%ebp
+8010222b:	8b 55 08             	mov    0x8(%ebp),%edx
+8010222e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  st->dev = ip->dev;
+80102231:	8b 0a                	mov    (%edx),%ecx
+80102233:	89 48 04             	mov    %ecx,0x4(%eax)
+  st->ino = ip->inum;
+80102236:	8b 4a 04             	mov    0x4(%edx),%ecx
+80102239:	89 48 08             	mov    %ecx,0x8(%eax)
+  st->type = ip->type;
+8010223c:	0f b7 4a 50          	movzwl 0x50(%edx),%ecx
+80102240:	66 89 08             	mov    %cx,(%eax)
+  st->nlink = ip->nlink;
+80102243:	0f b7 4a 56          	movzwl 0x56(%edx),%ecx
+80102247:	66 89 48 0c          	mov    %cx,0xc(%eax)
+  st->size = ip->size;
+8010224b:	8b 52 58             	mov    0x58(%edx),%edx
+8010224e:	89 50 10             	mov    %edx,0x10(%eax)
+}
+80102251:	5d                   	pop    %ebp
+80102252:	c3                   	ret
+
+80102253 <iprefetch>:
+{
+80102253:	55                   	push   %ebp
+80102254:	89 e5                	mov    %esp,%ebp
+80102256:	57                   	push   %edi
+80102257:	56                   	push   %esi
+80102258:	53                   	push   %ebx
+80102259:	83 ec 0c             	sub    $0xc,%esp
+8010225c:	8b 75 08             	mov    0x8(%ebp),%esi
+8010225f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  end = min(off + n, ip->size);
+80102262:	8b 7e 58             	mov    0x58(%esi),%edi
+80102265:	89 d8                	mov    %ebx,%eax
+80102267:	03 45 10             	add    0x10(%ebp),%eax
+8010226a:	39 c7                	cmp    %eax,%edi
+8010226c:	0f 47 f8             	cmova  %eax,%edi
+  if(off >= end)
+8010226f:	39 fb                	cmp    %edi,%ebx
+80102271:	73 29                	jae    8010229c <iprefetch+0x49>
+  for(bn = off/BSIZE; bn <= (end - 1)/BSIZE; bn++)
+80102273:	c1 eb 09             	shr    $0x9,%ebx
+80102276:	eb 1a                	jmp    80102292 <iprefetch+0x3f>
+    bprefetch(ip->dev, bmap(ip, bn));
+80102278:	89 da                	mov    %ebx,%edx
+8010227a:	89 f0                	mov    %esi,%eax
+8010227c:	e8 1a f9 ff ff       	call   80101b9b <bmap>
+80102281:	83 ec 08             	sub    $0x8,%esp
+80102284:	50                   	push   %eax
+80102285:	ff 36                	push   (%esi)
+80102287:	e8 84 e7 ff ff       	call   80100a10 <bprefetch>
+  for(bn = off/BSIZE; bn <= (end - 1)/BSIZE; bn++)
+8010228c:	83 c3 01             	add    $0x1,%ebx
+8010228f:	83 c4 10             	add    $0x10,%esp
+80102292:	8d 47 ff             	lea    -0x1(%edi),%eax
+80102295:	c1 e8 09             	shr    $0x9,%eax
+80102298:	39 d8                	cmp    %ebx,%eax
+8010229a:	73 dc                	jae    80102278 <iprefetch+0x25>
+}
+8010229c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010229f:	5b                   	pop    %ebx
+801022a0:	5e                   	pop    %esi
+801022a1:	5f                   	pop    %edi
+801022a2:	5d                   	pop    %ebp
+801022a3:	c3                   	ret
+
+801022a4 <readahead>:
+{
+801022a4:	55                   	push   %ebp
+801022a5:	89 e5                	mov    %esp,%ebp
+801022a7:	56                   	push   %esi
+801022a8:	53                   	push   %ebx
+801022a9:	89 c3                	mov    %eax,%ebx
+801022ab:	89 c8                	mov    %ecx,%eax
+  if(first == ip->ranext || (ip->ranext > 0 && first == ip->ranext - 1)){
+801022ad:	8b 8b 90 00 00 00    	mov    0x90(%ebx),%ecx
+801022b3:	39 d1                	cmp    %edx,%ecx
+801022b5:	74 5b                	je     80102312 <readahead+0x6e>
+801022b7:	85 c9                	test   %ecx,%ecx
+801022b9:	74 07                	je     801022c2 <readahead+0x1e>
+801022bb:	8d 71 ff             	lea    -0x1(%ecx),%esi
+801022be:	39 d6                	cmp    %edx,%esi
+801022c0:	74 50                	je     80102312 <readahead+0x6e>
+    ip->rawin = 0;
+801022c2:	c7 83 98 00 00 00 00 	movl   $0x0,0x98(%ebx)
+801022c9:	00 00 00 
+    ip->raend = 0;
+801022cc:	c7 83 94 00 00 00 00 	movl   $0x0,0x94(%ebx)
+801022d3:	00 00 00 
+  ip->ranext = last + 1;
+801022d6:	8d 48 01             	lea    0x1(%eax),%ecx
+801022d9:	89 8b 90 00 00 00    	mov    %ecx,0x90(%ebx)
+  if(ip->rawin == 0)
+801022df:	8b 93 98 00 00 00    	mov    0x98(%ebx),%edx
+801022e5:	85 d2                	test   %edx,%edx
+801022e7:	74 22                	je     8010230b <readahead+0x67>
+  bn = ip->raend > last ? ip->raend : last + 1;
+801022e9:	8b b3 94 00 00 00    	mov    0x94(%ebx),%esi
+801022ef:	39 f0                	cmp    %esi,%eax
+801022f1:	73 02                	jae    801022f5 <readahead+0x51>
+801022f3:	89 f1                	mov    %esi,%ecx
+  end = last + 1 + ip->rawin;
+801022f5:	8d 74 02 01          	lea    0x1(%edx,%eax,1),%esi
+  if(bn < end)
+801022f9:	39 f1                	cmp    %esi,%ecx
+801022fb:	72 3e                	jb     8010233b <readahead+0x97>
+  if(end > ip->raend)
+801022fd:	39 b3 94 00 00 00    	cmp    %esi,0x94(%ebx)
+80102303:	73 06                	jae    8010230b <readahead+0x67>
+    ip->raend = end;
+80102305:	89 b3 94 00 00 00    	mov    %esi,0x94(%ebx)
+}
+8010230b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010230e:	5b                   	pop    %ebx
+8010230f:	5e                   	pop    %esi
+80102310:	5d                   	pop    %ebp
+80102311:	c3                   	ret
+    if(first == ip->ranext)
+80102312:	39 d1                	cmp    %edx,%ecx
+80102314:	75 c0                	jne    801022d6 <readahead+0x32>
+      ip->rawin = ip->rawin ? min(2 * ip->rawin, RAMAX) : 2;
+80102316:	8b 93 98 00 00 00    	mov    0x98(%ebx),%edx
+8010231c:	85 d2                	test   %edx,%edx
+8010231e:	74 14                	je     80102334 <readahead+0x90>
+80102320:	01 d2                	add    %edx,%edx
+80102322:	b9 20 00 00 00       	mov    $0x20,%ecx
+80102327:	39 ca                	cmp    %ecx,%edx
+80102329:	0f 47 d1             	cmova  %ecx,%edx
+8010232c:	89 93 98 00 00 00    	mov    %edx,0x98(%ebx)
+80102332:	eb a2                	jmp    801022d6 <readahead+0x32>
+80102334:	ba 02 00 00 00       	mov    $0x2,%edx
+80102339:	eb f1                	jmp    8010232c <readahead+0x88>
+    iprefetch(ip, bn*BSIZE, (end - bn)*BSIZE);
+8010233b:	89 f0                	mov    %esi,%eax
+8010233d:	29 c8                	sub    %ecx,%eax
+8010233f:	83 ec 04             	sub    $0x4,%esp
+80102342:	c1 e0 09             	shl    $0x9,%eax
+80102345:	50                   	push   %eax
+80102346:	89 c8                	mov    %ecx,%eax
+80102348:	c1 e0 09             	shl    $0x9,%eax
+8010234b:	50                   	push   %eax
+8010234c:	53                   	push   %ebx
+8010234d:	e8 01 ff ff ff       	call   80102253 <iprefetch>
+80102352:	83 c4 10             	add    $0x10,%esp
+80102355:	eb a6                	jmp    801022fd <readahead+0x59>
+
+80102357 <readi>:
+{
+80102357:	55                   	push   %ebp
+80102358:	89 e5                	mov    %esp,%ebp
+8010235a:	57                   	push   %edi
+8010235b:	56                   	push   %esi
+8010235c:	53                   	push   %ebx
+8010235d:	83 ec 1c             	sub    $0x1c,%esp
+80102360:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(ip->type == T_DEV){
+80102363:	8b 45 08             	mov    0x8(%ebp),%eax
+80102366:	66 83 78 50 03       	cmpw   $0x3,0x50(%eax)
+8010236b:	74 32                	je     8010239f <readi+0x48>
+  if(off > ip->size || off + n < off)
+8010236d:	8b 45 08             	mov    0x8(%ebp),%eax
+80102370:	8b 40 58             	mov    0x58(%eax),%eax
+80102373:	39 f8                	cmp    %edi,%eax
+80102375:	0f 82 ea 00 00 00    	jb     80102465 <readi+0x10e>
+8010237b:	89 fa                	mov    %edi,%edx
+8010237d:	03 55 14             	add    0x14(%ebp),%edx
+80102380:	0f 82 e6 00 00 00    	jb     8010246c <readi+0x115>
+  if(off + n > ip->size)
+80102386:	39 d0                	cmp    %edx,%eax
+80102388:	73 05                	jae    8010238f <readi+0x38>
+    n = ip->size - off;
+8010238a:	29 f8                	sub    %edi,%eax
+8010238c:	89 45 14             	mov    %eax,0x14(%ebp)
+  if(n > 0)
+8010238f:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+80102393:	75 3b                	jne    801023d0 <readi+0x79>
+{
+80102395:	be 00 00 00 00       	mov    $0x0,%esi
+8010239a:	e9 a8 00 00 00       	jmp    80102447 <readi+0xf0>
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
+8010239f:	0f b7 40 52          	movzwl 0x52(%eax),%eax
+801023a3:	66 83 f8 09          	cmp    $0x9,%ax
+801023a7:	0f 87 aa 00 00 00    	ja     80102457 <readi+0x100>
+801023ad:	98                   	cwtl
+801023ae:	8b 04 c5 00 77 11 80 	mov    -0x7fee8900(,%eax,8),%eax
+801023b5:	85 c0                	test   %eax,%eax
+801023b7:	0f 84 a1 00 00 00    	je     8010245e <readi+0x107>
+    return devsw[ip->major].read(ip, dst, n);
+801023bd:	83 ec 04             	sub    $0x4,%esp
+801023c0:	ff 75 14             	push   0x14(%ebp)
+801023c3:	ff 75 0c             	push   0xc(%ebp)
+801023c6:	ff 75 08             	push   0x8(%ebp)
+801023c9:	ff d0                	call   *%eax
+801023cb:	83 c4 10             	add    $0x10,%esp
+801023ce:	eb 7f                	jmp    8010244f <readi+0xf8>
+    readahead(ip, off/BSIZE, (off + n - 1)/BSIZE);
+801023d0:	8b 45 14             	mov    0x14(%ebp),%eax
+801023d3:	8d 4c 07 ff          	lea    -0x1(%edi,%eax,1),%ecx
+801023d7:	c1 e9 09             	shr    $0x9,%ecx
+801023da:	89 fa                	mov    %edi,%edx
+801023dc:	c1 ea 09             	shr    $0x9,%edx
+801023df:	8b 45 08             	mov    0x8(%ebp),%eax
+801023e2:	e8 bd fe ff ff       	call   801022a4 <readahead>
+801023e7:	eb ac                	jmp    80102395 <readi+0x3e>
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+801023e9:	89 fa                	mov    %edi,%edx
+801023eb:	c1 ea 09             	shr    $0x9,%edx
+801023ee:	8b 45 08             	mov    0x8(%ebp),%eax
+801023f1:	e8 a5 f7 ff ff       	call   80101b9b <bmap>
+801023f6:	83 ec 08             	sub    $0x8,%esp
+801023f9:	50                   	push   %eax
+801023fa:	8b 45 08             	mov    0x8(%ebp),%eax
+801023fd:	ff 30                	push   (%eax)
+801023ff:	e8 3c e4 ff ff       	call   80100840 <bread>
+80102404:	89 c1                	mov    %eax,%ecx
+    m = min(n - tot, BSIZE - off%BSIZE);
+80102406:	89 f8                	mov    %edi,%eax
+80102408:	25 ff 01 00 00       	and    $0x1ff,%eax
+8010240d:	bb 00 02 00 00       	mov    $0x200,%ebx
+80102412:	29 c3                	sub    %eax,%ebx
+80102414:	8b 55 14             	mov    0x14(%ebp),%edx
+80102417:	29 f2                	sub    %esi,%edx
+80102419:	39 d3                	cmp    %edx,%ebx
+8010241b:	0f 47 da             	cmova  %edx,%ebx
+    memmove(dst, bp->data + off%BSIZE, m);
+8010241e:	83 c4 0c             	add    $0xc,%esp
+80102421:	53                   	push   %ebx
+80102422:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80102425:	8d 44 01 74          	lea    0x74(%ecx,%eax,1),%eax
+80102429:	50                   	push   %eax
+8010242a:	ff 75 0c             	push   0xc(%ebp)
+8010242d:	e8 84 57 00 00       	call   80107bb6 <memmove>
+    brelse(bp);
+80102432:	83 c4 04             	add    $0x4,%esp
+80102435:	ff 75 e4             	push   -0x1c(%ebp)
+80102438:	e8 45 e5 ff ff       	call   80100982 <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+8010243d:	01 de                	add    %ebx,%esi
+8010243f:	01 df                	add    %ebx,%edi
+80102441:	01 5d 0c             	add    %ebx,0xc(%ebp)
+80102444:	83 c4 10             	add    $0x10,%esp
+80102447:	3b 75 14             	cmp    0x14(%ebp),%esi
+8010244a:	72 9d                	jb     801023e9 <readi+0x92>
+  return n;
+8010244c:	8b 45 14             	mov    0x14(%ebp),%eax
+}
+8010244f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102452:	5b                   	pop    %ebx
+80102453:	5e                   	pop    %esi
+80102454:	5f                   	pop    %edi
+80102455:	5d                   	pop    %ebp
+80102456:	c3                   	ret
+      return -1;
+80102457:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010245c:	eb f1                	jmp    8010244f <readi+0xf8>
+8010245e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80102463:	eb ea                	jmp    8010244f <readi+0xf8>
+    return -1;
+80102465:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010246a:	eb e3                	jmp    8010244f <readi+0xf8>
+8010246c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80102471:	eb dc                	jmp    8010244f <readi+0xf8>
+
+80102473 <writei>:
+{
+80102473:	55                   	push   %ebp
+80102474:	89 e5                	mov    %esp,%ebp
+80102476:	57                   	push   %edi
+80102477:	56                   	push   %esi
+80102478:	53                   	push   %ebx
+80102479:	83 ec 1c             	sub    $0x1c,%esp
+8010247c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(ip->type == T_DEV){
+8010247f:	8b 45 08             	mov    0x8(%ebp),%eax
+80102482:	66 83 78 50 03       	cmpw   $0x3,0x50(%eax)
+80102487:	74 2c                	je     801024b5 <writei+0x42>
+  if(off > ip->size || off + n < off)
+80102489:	8b 45 08             	mov    0x8(%ebp),%eax
+8010248c:	39 78 58             	cmp    %edi,0x58(%eax)
+8010248f:	0f 82 05 01 00 00    	jb     8010259a <writei+0x127>
+80102495:	89 f8                	mov    %edi,%eax
+80102497:	03 45 14             	add    0x14(%ebp),%eax
+8010249a:	0f 82 01 01 00 00    	jb     801025a1 <writei+0x12e>
+  if(off + n > MAXFILE*BSIZE)
+801024a0:	3d 00 18 01 00       	cmp    $0x11800,%eax
+801024a5:	0f 87 fd 00 00 00    	ja     801025a8 <writei+0x135>
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+801024ab:	be 00 00 00 00       	mov    $0x0,%esi
+801024b0:	e9 9a 00 00 00       	jmp    8010254f <writei+0xdc>
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
+801024b5:	0f b7 40 52          	movzwl 0x52(%eax),%eax
+801024b9:	66 83 f8 09          	cmp    $0x9,%ax
+801024bd:	0f 87 c9 00 00 00    	ja     8010258c <writei+0x119>
+801024c3:	98                   	cwtl
+801024c4:	8b 04 c5 04 77 11 80 	mov    -0x7fee88fc(,%eax,8),%eax
+801024cb:	85 c0                	test   %eax,%eax
+801024cd:	0f 84 c0 00 00 00    	je     80102593 <writei+0x120>
+    return devsw[ip->major].write(ip, src, n);
+801024d3:	83 ec 04             	sub    $0x4,%esp
+801024d6:	ff 75 14             	push   0x14(%ebp)
+801024d9:	ff 75 0c             	push   0xc(%ebp)
+801024dc:	ff 75 08             	push   0x8(%ebp)
+801024df:	ff d0                	call   *%eax
+801024e1:	83 c4 10             	add    $0x10,%esp
+801024e4:	eb 77                	jmp    8010255d <writei+0xea>
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+801024e6:	89 fa                	mov    %edi,%edx
+801024e8:	c1 ea 09             	shr    $0x9,%edx
+801024eb:	8b 45 08             	mov    0x8(%ebp),%eax
+801024ee:	e8 a8 f6 ff ff       	call   80101b9b <bmap>
+801024f3:	83 ec 08             	sub    $0x8,%esp
+801024f6:	50                   	push   %eax
+801024f7:	8b 45 08             	mov    0x8(%ebp),%eax
+801024fa:	ff 30                	push   (%eax)
+801024fc:	e8 3f e3 ff ff       	call   80100840 <bread>
+80102501:	89 c1                	mov    %eax,%ecx
+    m = min(n - tot, BSIZE - off%BSIZE);
+80102503:	89 f8                	mov    %edi,%eax
+80102505:	25 ff 01 00 00       	and    $0x1ff,%eax
+8010250a:	bb 00 02 00 00       	mov    $0x200,%ebx
+8010250f:	29 c3                	sub    %eax,%ebx
+80102511:	8b 55 14             	mov    0x14(%ebp),%edx
+80102514:	29 f2                	sub    %esi,%edx
+80102516:	39 d3                	cmp    %edx,%ebx
+80102518:	0f 47 da             	cmova  %edx,%ebx
+    memmove(bp->data + off%BSIZE, src, m);
+8010251b:	83 c4 0c             	add    $0xc,%esp
+8010251e:	53                   	push   %ebx
+8010251f:	ff 75 0c             	push   0xc(%ebp)
+80102522:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80102525:	8d 44 01 74          	lea    0x74(%ecx,%eax,1),%eax
+80102529:	50                   	push   %eax
+8010252a:	e8 87 56 00 00       	call   80107bb6 <memmove>
+    log_write(bp);
+8010252f:	83 c4 04             	add    $0x4,%esp
+80102532:	ff 75 e4             	push   -0x1c(%ebp)
+80102535:	e8 ce 25 00 00       	call   80104b08 <log_write>
+    brelse(bp);
+8010253a:	83 c4 04             	add    $0x4,%esp
+8010253d:	ff 75 e4             	push   -0x1c(%ebp)
+80102540:	e8 3d e4 ff ff       	call   80100982 <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+80102545:	01 de                	add    %ebx,%esi
+80102547:	01 df                	add    %ebx,%edi
+80102549:	01 5d 0c             	add    %ebx,0xc(%ebp)
+8010254c:	83 c4 10             	add    $0x10,%esp
+8010254f:	3b 75 14             	cmp    0x14(%ebp),%esi
+80102552:	72 92                	jb     801024e6 <writei+0x73>
+  if(n > 0)
+80102554:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+80102558:	75 0b                	jne    80102565 <writei+0xf2>
+  return n;
+8010255a:	8b 45 14             	mov    0x14(%ebp),%eax
+}
+8010255d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102560:	5b                   	pop    %ebx
+80102561:	5e                   	pop    %esi
+80102562:	5f                   	pop    %edi
+80102563:	5d                   	pop    %ebp
+80102564:	c3                   	ret
+    pcinval(ip);
+80102565:	83 ec 0c             	sub    $0xc,%esp
+80102568:	ff 75 08             	push   0x8(%ebp)
+8010256b:	e8 41 31 00 00       	call   801056b1 <pcinval>
+  if(n > 0 && off > ip->size){
+80102570:	83 c4 10             	add    $0x10,%esp
+80102573:	8b 45 08             	mov    0x8(%ebp),%eax
+80102576:	39 78 58             	cmp    %edi,0x58(%eax)
+80102579:	73 df                	jae    8010255a <writei+0xe7>
+    ip->size = off;
+8010257b:	89 78 58             	mov    %edi,0x58(%eax)
+    iupdate(ip);
+8010257e:	83 ec 0c             	sub    $0xc,%esp
+80102581:	50                   	push   %eax
+80102582:	e8 71 f9 ff ff       	call   80101ef8 <iupdate>
+80102587:	83 c4 10             	add    $0x10,%esp
+8010258a:	eb ce                	jmp    8010255a <writei+0xe7>
+      return -1;
+8010258c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80102591:	eb ca                	jmp    8010255d <writei+0xea>
+80102593:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80102598:	eb c3                	jmp    8010255d <writei+0xea>
+    return -1;
+8010259a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010259f:	eb bc                	jmp    8010255d <writei+0xea>
+801025a1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801025a6:	eb b5                	jmp    8010255d <writei+0xea>
+    return -1;
+801025a8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801025ad:	eb ae                	jmp    8010255d <writei+0xea>
+
+801025af <namecmp>:
+{
+801025af:	55                   	push   %ebp
+801025b0:	89 e5                	mov    %esp,%ebp
+801025b2:	83 ec 0c             	sub    $0xc,%esp
+  return strncmp(s, t, DIRSIZ);
+801025b5:	6a 0e                	push   $0xe
+801025b7:	ff 75 0c             	push   0xc(%ebp)
+801025ba:	ff 75 08             	push   0x8(%ebp)
+801025bd:	e8 60 56 00 00       	call   80107c22 <strncmp>
+}
+801025c2:	c9                   	leave
+801025c3:	c3                   	ret
+
+801025c4 <dirlookup>:
+{
+801025c4:	55                   	push   %ebp
+801025c5:	89 e5                	mov    %esp,%ebp
+801025c7:	57                   	push   %edi
+801025c8:	56                   	push   %esi
+801025c9:	53                   	push   %ebx
+801025ca:	83 ec 1c             	sub    $0x1c,%esp
+801025cd:	8b 75 08             	mov    0x8(%ebp),%esi
+801025d0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(dp->type != T_DIR)
+801025d3:	66 83 7e 50 01       	cmpw   $0x1,0x50(%esi)
+801025d8:	75 07                	jne    801025e1 <dirlookup+0x1d>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+801025da:	bb 00 00 00 00       	mov    $0x0,%ebx
+801025df:	eb 1d                	jmp    801025fe <dirlookup+0x3a>
+    panic("dirlookup not DIR");
+801025e1:	83 ec 0c             	sub    $0xc,%esp
+801025e4:	68 e8 ba 10 80       	push   $0x8010bae8
+801025e9:	e8 3d e7 ff ff       	call   80100d2b <panic>
+      panic("dirlookup read");
+801025ee:	83 ec 0c             	sub    $0xc,%esp
+801025f1:	68 fa ba 10 80       	push   $0x8010bafa
+801025f6:	e8 30 e7 ff ff       	call   80100d2b <panic>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+801025fb:	83 c3 10             	add    $0x10,%ebx
+801025fe:	3b 5e 58             	cmp    0x58(%esi),%ebx
+80102601:	73 48                	jae    8010264b <dirlookup+0x87>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80102603:	6a 10                	push   $0x10
+80102605:	53                   	push   %ebx
+80102606:	8d 45 d8             	lea    -0x28(%ebp),%eax
+80102609:	50                   	push   %eax
+8010260a:	56                   	push   %esi
+8010260b:	e8 47 fd ff ff       	call   80102357 <readi>
+80102610:	83 c4 10             	add    $0x10,%esp
+80102613:	83 f8 10             	cmp    $0x10,%eax
+80102616:	75 d6                	jne    801025ee <dirlookup+0x2a>
+    if(de.inum == 0)
+80102618:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+8010261d:	74 dc                	je     801025fb <dirlookup+0x37>
+    if(namecmp(name, de.name) == 0){
+8010261f:	83 ec 08             	sub    $0x8,%esp
+80102622:	8d 45 da             	lea    -0x26(%ebp),%eax
+80102625:	50                   	push   %eax
+80102626:	57                   	push   %edi
+80102627:	e8 83 ff ff ff       	call   801025af <namecmp>
+8010262c:	83 c4 10             	add    $0x10,%esp
+8010262f:	85 c0                	test   %eax,%eax
+80102631:	75 c8                	jne    801025fb <dirlookup+0x37>
+      if(poff)
+80102633:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+80102637:	74 05                	je     8010263e <dirlookup+0x7a>
+        *poff = off;
+80102639:	8b 45 10             	mov    0x10(%ebp),%eax
+8010263c:	89 18                	mov    %ebx,(%eax)
+      inum = de.inum;
+8010263e:	0f b7 55 d8          	movzwl -0x28(%ebp),%edx
+      return iget(dp->dev, inum);
+80102642:	8b 06                	mov    (%esi),%eax
+80102644:	e8 f8 f5 ff ff       	call   80101c41 <iget>
+80102649:	eb 05                	jmp    80102650 <dirlookup+0x8c>
+  return 0;
+8010264b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80102650:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102653:	5b                   	pop    %ebx
+80102654:	5e                   	pop    %esi
+80102655:	5f                   	pop    %edi
+80102656:	5d                   	pop    %ebp
+80102657:	c3                   	ret
+
+80102658 <namex>:
+// If parent != 0, return the inode for the parent and copy the final
+// path element into name, which must have room for DIRSIZ bytes.
+// Must be called inside a transaction since it calls iput().
+static struct inode*
+namex(char *path, int nameiparent, char *name)
+{
+80102658:	55                   	push   %ebp
+80102659:	89 e5                	mov    %esp,%ebp
+8010265b:	57                   	push   %edi
+8010265c:	56                   	push   %esi
+8010265d:	53                   	push   %ebx
+8010265e:	83 ec 1c             	sub    $0x1c,%esp
+80102661:	89 c3                	mov    %eax,%ebx
+80102663:	89 55 e0             	mov    %edx,-0x20(%ebp)
+80102666:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  struct inode *ip, *next;
+
+  if(*path == '/')
+80102669:	80 38 2f             	cmpb   $0x2f,(%eax)
+8010266c:	74 17                	je     80102685 <namex+0x2d>
+    ip = iget(ROOTDEV, ROOTINO);
+  else
+    ip = idup(myproc()->cwd);
+8010266e:	e8 98 36 00 00       	call   80105d0b <myproc>
+80102673:	83 ec 0c             	sub    $0xc,%esp
+80102676:	ff 70 68             	push   0x68(%eax)
+80102679:	e8 b3 f9 ff ff       	call   80102031 <idup>
+8010267e:	89 c6                	mov    %eax,%esi
+80102680:	83 c4 10             	add    $0x10,%esp
+80102683:	eb 53                	jmp    801026d8 <namex+0x80>
+    ip = iget(ROOTDEV, ROOTINO);
+80102685:	ba 01 00 00 00       	mov    $0x1,%edx
+8010268a:	b8 01 00 00 00       	mov    $0x1,%eax
+8010268f:	e8 ad f5 ff ff       	call   80101c41 <iget>
+80102694:	89 c6                	mov    %eax,%esi
+80102696:	eb 40                	jmp    801026d8 <namex+0x80>
+
+  while((path = skipelem(path, name)) != 0){
+    ilock(ip);
+    if(ip->type != T_DIR){
+      iunlockput(ip);
+80102698:	83 ec 0c             	sub    $0xc,%esp
+8010269b:	56                   	push   %esi
+8010269c:	e8 67 fb ff ff       	call   80102208 <iunlockput>
+      return 0;
+801026a1:	83 c4 10             	add    $0x10,%esp
+801026a4:	be 00 00 00 00       	mov    $0x0,%esi
+  if(nameiparent){
+    iput(ip);
+    return 0;
+  }
+  return ip;
+}
+801026a9:	89 f0                	mov    %esi,%eax
+801026ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801026ae:	5b                   	pop    %ebx
+801026af:	5e                   	pop    %esi
+801026b0:	5f                   	pop    %edi
+801026b1:	5d                   	pop    %ebp
+801026b2:	c3                   	ret
+    if((next = dirlookup(ip, name, 0)) == 0){
+801026b3:	83 ec 04             	sub    $0x4,%esp
+801026b6:	6a 00                	push   $0x0
+801026b8:	ff 75 e4             	push   -0x1c(%ebp)
+801026bb:	56                   	push   %esi
+801026bc:	e8 03 ff ff ff       	call   801025c4 <dirlookup>
+801026c1:	89 c7                	mov    %eax,%edi
+801026c3:	83 c4 10             	add    $0x10,%esp
+801026c6:	85 c0                	test   %eax,%eax
+801026c8:	74 4a                	je     80102714 <namex+0xbc>
+    iunlockput(ip);
+801026ca:	83 ec 0c             	sub    $0xc,%esp
+801026cd:	56                   	push   %esi
+801026ce:	e8 35 fb ff ff       	call   80102208 <iunlockput>
+801026d3:	83 c4 10             	add    $0x10,%esp
+    ip = next;
+801026d6:	89 fe                	mov    %edi,%esi
+  while((path = skipelem(path, name)) != 0){
+801026d8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801026db:	89 d8                	mov    %ebx,%eax
+801026dd:	e8 25 f3 ff ff       	call   80101a07 <skipelem>
+801026e2:	89 c3                	mov    %eax,%ebx
+801026e4:	85 c0                	test   %eax,%eax
+801026e6:	74 3c                	je     80102724 <namex+0xcc>
+    ilock(ip);
+801026e8:	83 ec 0c             	sub    $0xc,%esp
+801026eb:	56                   	push   %esi
+801026ec:	e8 70 f9 ff ff       	call   80102061 <ilock>
+    if(ip->type != T_DIR){
+801026f1:	83 c4 10             	add    $0x10,%esp
+801026f4:	66 83 7e 50 01       	cmpw   $0x1,0x50(%esi)
+801026f9:	75 9d                	jne    80102698 <namex+0x40>
+    if(nameiparent && *path == '\0'){
+801026fb:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+801026ff:	74 b2                	je     801026b3 <namex+0x5b>
+80102701:	80 3b 00             	cmpb   $0x0,(%ebx)
+80102704:	75 ad                	jne    801026b3 <namex+0x5b>
+      iunlock(ip);
+80102706:	83 ec 0c             	sub    $0xc,%esp
+80102709:	56                   	push   %esi
+8010270a:	e8 14 fa ff ff       	call   80102123 <iunlock>
+      return ip;
+8010270f:	83 c4 10             	add    $0x10,%esp
+80102712:	eb 95                	jmp    801026a9 <namex+0x51>
+      iunlockput(ip);
+80102714:	83 ec 0c             	sub    $0xc,%esp
+80102717:	56                   	push   %esi
+80102718:	e8 eb fa ff ff       	call   80102208 <iunlockput>
+      return 0;
+8010271d:	83 c4 10             	add    $0x10,%esp
+80102720:	89 fe                	mov    %edi,%esi
+80102722:	eb 85                	jmp    801026a9 <namex+0x51>
+  if(nameiparent){
+80102724:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+80102728:	0f 84 7b ff ff ff    	je     801026a9 <namex+0x51>
+    iput(ip);
+8010272e:	83 ec 0c             	sub    $0xc,%esp
+80102731:	56                   	push   %esi
+80102732:	e8 31 fa ff ff       	call   80102168 <iput>
+    return 0;
+80102737:	83 c4 10             	add    $0x10,%esp
+8010273a:	89 de                	mov    %ebx,%esi
+8010273c:	e9 68 ff ff ff       	jmp    801026a9 <namex+0x51>
+
+80102741 <dirlink>:
+{
+80102741:	55                   	push   %ebp
+80102742:	89 e5                	mov    %esp,%ebp
+80102744:	57                   	push   %edi
+80102745:	56                   	push   %esi
+80102746:	53                   	push   %ebx
+80102747:	83 ec 20             	sub    $0x20,%esp
+8010274a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010274d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if((ip = dirlookup(dp, name, 0)) != 0){
+80102750:	6a 00                	push   $0x0
+80102752:	57                   	push   %edi
+80102753:	53                   	push   %ebx
+80102754:	e8 6b fe ff ff       	call   801025c4 <dirlookup>
+80102759:	83 c4 10             	add    $0x10,%esp
+8010275c:	85 c0                	test   %eax,%eax
+8010275e:	75 2d                	jne    8010278d <dirlink+0x4c>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+80102760:	b8 00 00 00 00       	mov    $0x0,%eax
+80102765:	89 c6                	mov    %eax,%esi
+80102767:	3b 43 58             	cmp    0x58(%ebx),%eax
+8010276a:	73 41                	jae    801027ad <dirlink+0x6c>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+8010276c:	6a 10                	push   $0x10
+8010276e:	50                   	push   %eax
+8010276f:	8d 45 d8             	lea    -0x28(%ebp),%eax
+80102772:	50                   	push   %eax
+80102773:	53                   	push   %ebx
+80102774:	e8 de fb ff ff       	call   80102357 <readi>
+80102779:	83 c4 10             	add    $0x10,%esp
+8010277c:	83 f8 10             	cmp    $0x10,%eax
+8010277f:	75 1f                	jne    801027a0 <dirlink+0x5f>
+    if(de.inum == 0)
+80102781:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+80102786:	74 25                	je     801027ad <dirlink+0x6c>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+80102788:	8d 46 10             	lea    0x10(%esi),%eax
+8010278b:	eb d8                	jmp    80102765 <dirlink+0x24>
+    iput(ip);
+8010278d:	83 ec 0c             	sub    $0xc,%esp
+80102790:	50                   	push   %eax
+80102791:	e8 d2 f9 ff ff       	call   80102168 <iput>
+    return -1;
+80102796:	83 c4 10             	add    $0x10,%esp
+80102799:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010279e:	eb 3d                	jmp    801027dd <dirlink+0x9c>
+      panic("dirlink read");
+801027a0:	83 ec 0c             	sub    $0xc,%esp
+801027a3:	68 09 bb 10 80       	push   $0x8010bb09
+801027a8:	e8 7e e5 ff ff       	call   80100d2b <panic>
+  strncpy(de.name, name, DIRSIZ);
+801027ad:	83 ec 04             	sub    $0x4,%esp
+801027b0:	6a 0e                	push   $0xe
+801027b2:	57                   	push   %edi
+801027b3:	8d 7d d8             	lea    -0x28(%ebp),%edi
+801027b6:	8d 45 da             	lea    -0x26(%ebp),%eax
+801027b9:	50                   	push   %eax
+801027ba:	e8 a2 54 00 00       	call   80107c61 <strncpy>
+  de.inum = inum;
+801027bf:	8b 45 10             	mov    0x10(%ebp),%eax
+801027c2:	66 89 45 d8          	mov    %ax,-0x28(%ebp)
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+801027c6:	6a 10                	push   $0x10
+801027c8:	56                   	push   %esi
+801027c9:	57                   	push   %edi
+801027ca:	53                   	push   %ebx
+801027cb:	e8 a3 fc ff ff       	call   80102473 <writei>
+801027d0:	83 c4 20             	add    $0x20,%esp
+801027d3:	83 f8 10             	cmp    $0x10,%eax
+801027d6:	75 0d                	jne    801027e5 <dirlink+0xa4>
+  return 0;
+801027d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+801027dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801027e0:	5b                   	pop    %ebx
+801027e1:	5e                   	pop    %esi
+801027e2:	5f                   	pop    %edi
+801027e3:	5d                   	pop    %ebp
+801027e4:	c3                   	ret
+    panic("dirlink");
+801027e5:	83 ec 0c             	sub    $0xc,%esp
+801027e8:	68 78 c2 10 80       	push   $0x8010c278
+801027ed:	e8 39 e5 ff ff       	call   80100d2b <panic>
+
+801027f2 <namei>:
+
+struct inode*
+namei(char *path)
+{
+801027f2:	55                   	push   %ebp
+801027f3:	89 e5                	mov    %esp,%ebp
+801027f5:	83 ec 18             	sub    $0x18,%esp
+  char name[DIRSIZ];
+  return namex(path, 0, name);
+801027f8:	8d 4d ea             	lea    -0x16(%ebp),%ecx
+801027fb:	ba 00 00 00 00       	mov    $0x0,%edx
+80102800:	8b 45 08             	mov    0x8(%ebp),%eax
+80102803:	e8 50 fe ff ff       	call   80102658 <namex>
+}
+80102808:	c9                   	leave
+80102809:	c3                   	ret
+
+8010280a <nameiparent>:
+
+struct inode*
+nameiparent(char *path, char *name)
+{
+8010280a:	55                   	push   %ebp
+8010280b:	89 e5                	mov    %esp,%ebp
+8010280d:	83 ec 08             	sub    $0x8,%esp
+  return namex(path, 1, name);
+80102810:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80102813:	ba 01 00 00 00       	mov    $0x1,%edx
+80102818:	8b 45 08             	mov    0x8(%ebp),%eax
+8010281b:	e8 38 fe ff ff       	call   80102658 <namex>
+}
+80102820:	c9                   	leave
+80102821:	c3                   	ret
+
+80102822 <idewait>:
+static void idenext(void);
+
+// Wait for IDE disk to become ready.
+static int
+idewait(int checkerr)
+{
+80102822:	89 c1                	mov    %eax,%ecx
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102824:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80102829:	ec                   	in     (%dx),%al
+  int r;
+
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+8010282a:	89 c2                	mov    %eax,%edx
+8010282c:	83 e2 c0             	and    $0xffffffc0,%edx
+8010282f:	80 fa 40             	cmp    $0x40,%dl
+80102832:	75 f0                	jne    80102824 <idewait+0x2>
+    ;
+  if(checkerr && (r & (IDE_DF|IDE_ERR)) != 0)
+80102834:	85 c9                	test   %ecx,%ecx
+80102836:	74 09                	je     80102841 <idewait+0x1f>
+80102838:	a8 21                	test   $0x21,%al
+8010283a:	75 08                	jne    80102844 <idewait+0x22>
+    return -1;
+  return 0;
+8010283c:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+80102841:	89 c8                	mov    %ecx,%eax
+80102843:	c3                   	ret
+    return -1;
+80102844:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+80102849:	eb f6                	jmp    80102841 <idewait+0x1f>
+
+8010284b <idesetmult>:
+
+// Set drive d to transfer IDEMULT sectors per interrupt
+// with READ/WRITE MULTIPLE.  Returns -1 if it can't.
+static int
+idesetmult(int d)
+{
+8010284b:	55                   	push   %ebp
+8010284c:	89 e5                	mov    %esp,%ebp
+8010284e:	56                   	push   %esi
+8010284f:	53                   	push   %ebx
+80102850:	89 c3                	mov    %eax,%ebx
+  int r;
+
+  idewait(0);
+80102852:	b8 00 00 00 00       	mov    $0x0,%eax
+80102857:	e8 c6 ff ff ff       	call   80102822 <idewait>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010285c:	be f6 03 00 00       	mov    $0x3f6,%esi
+80102861:	b8 02 00 00 00       	mov    $0x2,%eax
+80102866:	89 f2                	mov    %esi,%edx
+80102868:	ee                   	out    %al,(%dx)
+80102869:	b8 10 00 00 00       	mov    $0x10,%eax
+8010286e:	ba f2 01 00 00       	mov    $0x1f2,%edx
+80102873:	ee                   	out    %al,(%dx)
+  outb(0x3f6, 2);  // no interrupt
+  outb(0x1f2, IDEMULT);
+  outb(0x1f6, 0xe0 | (d<<4));
+80102874:	89 d8                	mov    %ebx,%eax
+80102876:	c1 e0 04             	shl    $0x4,%eax
+80102879:	83 c8 e0             	or     $0xffffffe0,%eax
+8010287c:	bb f6 01 00 00       	mov    $0x1f6,%ebx
+80102881:	89 da                	mov    %ebx,%edx
+80102883:	ee                   	out    %al,(%dx)
+80102884:	b8 c6 ff ff ff       	mov    $0xffffffc6,%eax
+80102889:	ba f7 01 00 00       	mov    $0x1f7,%edx
+8010288e:	ee                   	out    %al,(%dx)
+  outb(0x1f7, IDE_CMD_SETMUL);
+  r = idewait(1);
+8010288f:	b8 01 00 00 00       	mov    $0x1,%eax
+80102894:	e8 89 ff ff ff       	call   80102822 <idewait>
+80102899:	89 c1                	mov    %eax,%ecx
+8010289b:	b8 00 00 00 00       	mov    $0x0,%eax
+801028a0:	89 f2                	mov    %esi,%edx
+801028a2:	ee                   	out    %al,(%dx)
+801028a3:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+801028a8:	89 da                	mov    %ebx,%edx
+801028aa:	ee                   	out    %al,(%dx)
+  outb(0x3f6, 0);
+  outb(0x1f6, 0xe0 | (0<<4));
+  return r;
+}
+801028ab:	89 c8                	mov    %ecx,%eax
+801028ad:	5b                   	pop    %ebx
+801028ae:	5e                   	pop    %esi
+801028af:	5d                   	pop    %ebp
+801028b0:	c3                   	ret
+
+801028b1 <qset>:
+
+// Put b at position i of heap q.
+static void
+qset(struct ideq *q, int i, struct buf *b)
+{
+  q->b[i] = b;
+801028b1:	89 4c 90 04          	mov    %ecx,0x4(%eax,%edx,4)
+  b->qidx = i;
+801028b5:	89 51 6c             	mov    %edx,0x6c(%ecx)
+}
+801028b8:	c3                   	ret
+
+801028b9 <qsift>:
+
+// Move the buf at position i of heap q up or down until it
+// is in order.
+static void
+qsift(struct ideq *q, int i)
+{
+801028b9:	55                   	push   %ebp
+801028ba:	89 e5                	mov    %esp,%ebp
+801028bc:	57                   	push   %edi
+801028bd:	56                   	push   %esi
+801028be:	53                   	push   %ebx
+801028bf:	83 ec 1c             	sub    $0x1c,%esp
+801028c2:	89 c6                	mov    %eax,%esi
+  struct buf *b;
+  int c;
+
+  b = q->b[i];
+801028c4:	8b 7c 90 04          	mov    0x4(%eax,%edx,4),%edi
+  for(; i > 0 && q->b[(i-1)/2]->blockno > b->blockno; i = (i-1)/2)
+801028c8:	eb 09                	jmp    801028d3 <qsift+0x1a>
+    qset(q, i, q->b[(i-1)/2]);
+801028ca:	89 f0                	mov    %esi,%eax
+801028cc:	e8 e0 ff ff ff       	call   801028b1 <qset>
+  for(; i > 0 && q->b[(i-1)/2]->blockno > b->blockno; i = (i-1)/2)
+801028d1:	89 da                	mov    %ebx,%edx
+801028d3:	85 d2                	test   %edx,%edx
+801028d5:	7e 5b                	jle    80102932 <qsift+0x79>
+801028d7:	8d 42 ff             	lea    -0x1(%edx),%eax
+801028da:	89 c3                	mov    %eax,%ebx
+801028dc:	c1 eb 1f             	shr    $0x1f,%ebx
+801028df:	01 c3                	add    %eax,%ebx
+801028e1:	d1 fb                	sar    %ebx
+801028e3:	8b 4c 9e 04          	mov    0x4(%esi,%ebx,4),%ecx
+801028e7:	8b 41 08             	mov    0x8(%ecx),%eax
+801028ea:	39 47 08             	cmp    %eax,0x8(%edi)
+801028ed:	72 db                	jb     801028ca <qsift+0x11>
+801028ef:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+801028f2:	eb 18                	jmp    8010290c <qsift+0x53>
+  for(; (c = 2*i+1) < q->n; i = c){
+    if(c+1 < q->n && q->b[c+1]->blockno < q->b[c]->blockno)
+      c++;
+    if(q->b[c]->blockno >= b->blockno)
+801028f4:	8b 4c 9e 04          	mov    0x4(%esi,%ebx,4),%ecx
+801028f8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801028fb:	8b 40 08             	mov    0x8(%eax),%eax
+801028fe:	39 41 08             	cmp    %eax,0x8(%ecx)
+80102901:	73 34                	jae    80102937 <qsift+0x7e>
+      break;
+    qset(q, i, q->b[c]);
+80102903:	89 f0                	mov    %esi,%eax
+80102905:	e8 a7 ff ff ff       	call   801028b1 <qset>
+  for(; (c = 2*i+1) < q->n; i = c){
+8010290a:	89 da                	mov    %ebx,%edx
+8010290c:	8d 5c 12 01          	lea    0x1(%edx,%edx,1),%ebx
+80102910:	8b 0e                	mov    (%esi),%ecx
+80102912:	39 d9                	cmp    %ebx,%ecx
+80102914:	7e 21                	jle    80102937 <qsift+0x7e>
+    if(c+1 < q->n && q->b[c+1]->blockno < q->b[c]->blockno)
+80102916:	8d 44 12 02          	lea    0x2(%edx,%edx,1),%eax
+8010291a:	39 c8                	cmp    %ecx,%eax
+8010291c:	7d d6                	jge    801028f4 <qsift+0x3b>
+8010291e:	8b 7c 9e 04          	mov    0x4(%esi,%ebx,4),%edi
+80102922:	8b 4c 86 04          	mov    0x4(%esi,%eax,4),%ecx
+80102926:	8b 7f 08             	mov    0x8(%edi),%edi
+80102929:	39 79 08             	cmp    %edi,0x8(%ecx)
+8010292c:	73 c6                	jae    801028f4 <qsift+0x3b>
+      c++;
+8010292e:	89 c3                	mov    %eax,%ebx
+80102930:	eb c2                	jmp    801028f4 <qsift+0x3b>
+80102932:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80102935:	eb d5                	jmp    8010290c <qsift+0x53>
+  }
+  qset(q, i, b);
+80102937:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+8010293a:	89 f9                	mov    %edi,%ecx
+8010293c:	89 f0                	mov    %esi,%eax
+8010293e:	e8 6e ff ff ff       	call   801028b1 <qset>
+}
+80102943:	83 c4 1c             	add    $0x1c,%esp
+80102946:	5b                   	pop    %ebx
+80102947:	5e                   	pop    %esi
+80102948:	5f                   	pop    %edi
+80102949:	5d                   	pop    %ebp
+8010294a:	c3                   	ret
+
+8010294b <qremove>:
+}
+
+// Remove b from heap q and from fifo.
+static void
+qremove(struct ideq *q, struct buf *b)
+{
+8010294b:	55                   	push   %ebp
+8010294c:	89 e5                	mov    %esp,%ebp
+8010294e:	57                   	push   %edi
+8010294f:	56                   	push   %esi
+80102950:	53                   	push   %ebx
+80102951:	83 ec 0c             	sub    $0xc,%esp
+80102954:	89 c6                	mov    %eax,%esi
+80102956:	89 d3                	mov    %edx,%ebx
+  int i;
+
+  i = b->qidx;
+80102958:	8b 7a 6c             	mov    0x6c(%edx),%edi
+  if(i != --q->n){
+8010295b:	8b 00                	mov    (%eax),%eax
+8010295d:	83 e8 01             	sub    $0x1,%eax
+80102960:	89 06                	mov    %eax,(%esi)
+80102962:	39 f8                	cmp    %edi,%eax
+80102964:	75 22                	jne    80102988 <qremove+0x3d>
+    qset(q, i, q->b[q->n]);
+    qsift(q, i);
+  }
+
+  if(b->fprev)
+80102966:	8b 43 64             	mov    0x64(%ebx),%eax
+80102969:	85 c0                	test   %eax,%eax
+8010296b:	74 33                	je     801029a0 <qremove+0x55>
+    b->fprev->fnext = b->fnext;
+8010296d:	8b 53 68             	mov    0x68(%ebx),%edx
+80102970:	89 50 68             	mov    %edx,0x68(%eax)
+  else
+    fifo = b->fnext;
+  if(b->fnext)
+80102973:	8b 43 68             	mov    0x68(%ebx),%eax
+80102976:	85 c0                	test   %eax,%eax
+80102978:	74 30                	je     801029aa <qremove+0x5f>
+    b->fnext->fprev = b->fprev;
+8010297a:	8b 53 64             	mov    0x64(%ebx),%edx
+8010297d:	89 50 64             	mov    %edx,0x64(%eax)
+  else
+    fifotail = b->fprev;
+}
+80102980:	83 c4 0c             	add    $0xc,%esp
+80102983:	5b                   	pop    %ebx
+80102984:	5e                   	pop    %esi
+80102985:	5f                   	pop    %edi
+80102986:	5d                   	pop    %ebp
+80102987:	c3                   	ret
+    qset(q, i, q->b[q->n]);
+80102988:	8b 4c 86 04          	mov    0x4(%esi,%eax,4),%ecx
+8010298c:	89 fa                	mov    %edi,%edx
+8010298e:	89 f0                	mov    %esi,%eax
+80102990:	e8 1c ff ff ff       	call   801028b1 <qset>
+    qsift(q, i);
+80102995:	89 fa                	mov    %edi,%edx
+80102997:	89 f0                	mov    %esi,%eax
+80102999:	e8 1b ff ff ff       	call   801028b9 <qsift>
+8010299e:	eb c6                	jmp    80102966 <qremove+0x1b>
+    fifo = b->fnext;
+801029a0:	8b 43 68             	mov    0x68(%ebx),%eax
+801029a3:	a3 90 97 11 80       	mov    %eax,0x80119790
+801029a8:	eb c9                	jmp    80102973 <qremove+0x28>
+    fifotail = b->fprev;
+801029aa:	8b 43 64             	mov    0x64(%ebx),%eax
+801029ad:	a3 8c 97 11 80       	mov    %eax,0x8011978c
+}
+801029b2:	eb cc                	jmp    80102980 <qremove+0x35>
+
+801029b4 <idedmainit>:
+{
+801029b4:	55                   	push   %ebp
+801029b5:	89 e5                	mov    %esp,%ebp
+801029b7:	56                   	push   %esi
+801029b8:	53                   	push   %ebx
+  if((tag = pcifindclass(0x01, 0x01)) < 0)    // mass storage, IDE
+801029b9:	83 ec 08             	sub    $0x8,%esp
+801029bc:	6a 01                	push   $0x1
+801029be:	6a 01                	push   $0x1
+801029c0:	e8 84 2a 00 00       	call   80105449 <pcifindclass>
+801029c5:	83 c4 10             	add    $0x10,%esp
+801029c8:	85 c0                	test   %eax,%eax
+801029ca:	78 15                	js     801029e1 <idedmainit+0x2d>
+801029cc:	89 c3                	mov    %eax,%ebx
+  if(!(pciread(tag, 0x08) & 0x8000))          // prog IF: bus master
+801029ce:	83 ec 08             	sub    $0x8,%esp
+801029d1:	6a 08                	push   $0x8
+801029d3:	50                   	push   %eax
+801029d4:	e8 2f 29 00 00       	call   80105308 <pciread>
+801029d9:	83 c4 10             	add    $0x10,%esp
+801029dc:	f6 c4 80             	test   $0x80,%ah
+801029df:	75 07                	jne    801029e8 <idedmainit+0x34>
+}
+801029e1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801029e4:	5b                   	pop    %ebx
+801029e5:	5e                   	pop    %esi
+801029e6:	5d                   	pop    %ebp
+801029e7:	c3                   	ret
+  bar = pciread(tag, 0x20);                   // BAR4
+801029e8:	83 ec 08             	sub    $0x8,%esp
+801029eb:	6a 20                	push   $0x20
+801029ed:	53                   	push   %ebx
+801029ee:	e8 15 29 00 00       	call   80105308 <pciread>
+801029f3:	89 c6                	mov    %eax,%esi
+  if(!(bar & 1) || (bar & ~3) == 0)           // must be I/O space
+801029f5:	83 c4 10             	add    $0x10,%esp
+801029f8:	a8 01                	test   $0x1,%al
+801029fa:	74 e5                	je     801029e1 <idedmainit+0x2d>
+801029fc:	83 f8 03             	cmp    $0x3,%eax
+801029ff:	76 e0                	jbe    801029e1 <idedmainit+0x2d>
+  pciwrite(tag, 0x04, pciread(tag, 0x04) | 0x5);  // I/O and bus master
+80102a01:	83 ec 08             	sub    $0x8,%esp
+80102a04:	6a 04                	push   $0x4
+80102a06:	53                   	push   %ebx
+80102a07:	e8 fc 28 00 00       	call   80105308 <pciread>
+80102a0c:	83 c4 0c             	add    $0xc,%esp
+80102a0f:	83 c8 05             	or     $0x5,%eax
+80102a12:	50                   	push   %eax
+80102a13:	6a 04                	push   $0x4
+80102a15:	53                   	push   %ebx
+80102a16:	e8 eb 29 00 00       	call   80105406 <pciwrite>
+  idebm = bar & ~3;
+80102a1b:	89 f2                	mov    %esi,%edx
+80102a1d:	83 e2 fc             	and    $0xfffffffc,%edx
+80102a20:	66 89 15 80 97 11 80 	mov    %dx,0x80119780
+  outb(idebm + BM_CMD, 0);
+80102a27:	0f b7 ca             	movzwl %dx,%ecx
+80102a2a:	b8 00 00 00 00       	mov    $0x0,%eax
+80102a2f:	ee                   	out    %al,(%dx)
+  outb(idebm + BM_STATUS, BM_ERR|BM_INTR);
+80102a30:	83 c2 02             	add    $0x2,%edx
+80102a33:	b8 06 00 00 00       	mov    $0x6,%eax
+80102a38:	ee                   	out    %al,(%dx)
+  cprintf("ide: bus-master DMA at 0x%x\n", idebm);
+80102a39:	83 c4 08             	add    $0x8,%esp
+80102a3c:	51                   	push   %ecx
+80102a3d:	68 6b bb 10 80       	push   $0x8010bb6b
+80102a42:	e8 a5 e5 ff ff       	call   80100fec <cprintf>
+80102a47:	83 c4 10             	add    $0x10,%esp
+80102a4a:	eb 95                	jmp    801029e1 <idedmainit+0x2d>
+
+80102a4c <idestart>:
+{
+80102a4c:	55                   	push   %ebp
+80102a4d:	89 e5                	mov    %esp,%ebp
+80102a4f:	57                   	push   %edi
+80102a50:	56                   	push   %esi
+80102a51:	53                   	push   %ebx
+80102a52:	83 ec 1c             	sub    $0x1c,%esp
+  if(b == 0)
+80102a55:	85 c0                	test   %eax,%eax
+80102a57:	74 09                	je     80102a62 <idestart+0x16>
+80102a59:	89 c7                	mov    %eax,%edi
+  n = 0;
+80102a5b:	bb 00 00 00 00       	mov    $0x0,%ebx
+80102a60:	eb 13                	jmp    80102a75 <idestart+0x29>
+    panic("idestart");
+80102a62:	83 ec 0c             	sub    $0xc,%esp
+80102a65:	68 88 bb 10 80       	push   $0x8010bb88
+80102a6a:	e8 bc e2 ff ff       	call   80100d2b <panic>
+    n++;
+80102a6f:	83 c3 01             	add    $0x1,%ebx
+  for(b1 = b; b1; b1 = b1->qnext)
+80102a72:	8b 40 60             	mov    0x60(%eax),%eax
+80102a75:	85 c0                	test   %eax,%eax
+80102a77:	75 f6                	jne    80102a6f <idestart+0x23>
+  if(b->blockno + n > FSSIZE)
+80102a79:	8b 77 08             	mov    0x8(%edi),%esi
+80102a7c:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+80102a7f:	3d e8 03 00 00       	cmp    $0x3e8,%eax
+80102a84:	77 2f                	ja     80102ab5 <idestart+0x69>
+  int read_cmd = (nsector == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
+80102a86:	83 fb 01             	cmp    $0x1,%ebx
+80102a89:	74 37                	je     80102ac2 <idestart+0x76>
+80102a8b:	c7 45 e4 c4 00 00 00 	movl   $0xc4,-0x1c(%ebp)
+  int write_cmd = (nsector == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+80102a92:	c7 45 e0 c5 00 00 00 	movl   $0xc5,-0x20(%ebp)
+  if(idebm){
+80102a99:	0f b7 0d 80 97 11 80 	movzwl 0x80119780,%ecx
+80102aa0:	66 85 c9             	test   %cx,%cx
+80102aa3:	0f 84 98 00 00 00    	je     80102b41 <idestart+0xf5>
+    for(n = 0, b1 = b; b1; b1 = b1->qnext, n++){
+80102aa9:	89 f8                	mov    %edi,%eax
+80102aab:	ba 00 00 00 00       	mov    $0x0,%edx
+80102ab0:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+80102ab3:	eb 30                	jmp    80102ae5 <idestart+0x99>
+    panic("incorrect blockno");
+80102ab5:	83 ec 0c             	sub    $0xc,%esp
+80102ab8:	68 91 bb 10 80       	push   $0x8010bb91
+80102abd:	e8 69 e2 ff ff       	call   80100d2b <panic>
+  int read_cmd = (nsector == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
+80102ac2:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%ebp)
+  int write_cmd = (nsector == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+80102ac9:	c7 45 e0 30 00 00 00 	movl   $0x30,-0x20(%ebp)
+80102ad0:	eb c7                	jmp    80102a99 <idestart+0x4d>
+      ideprd[n].flags = b1->qnext ? 0 : PRD_EOT;
+80102ad2:	be 00 80 ff ff       	mov    $0xffff8000,%esi
+80102ad7:	66 89 34 d5 06 97 11 	mov    %si,-0x7fee68fa(,%edx,8)
+80102ade:	80 
+    for(n = 0, b1 = b; b1; b1 = b1->qnext, n++){
+80102adf:	8b 40 60             	mov    0x60(%eax),%eax
+80102ae2:	83 c2 01             	add    $0x1,%edx
+80102ae5:	85 c0                	test   %eax,%eax
+80102ae7:	74 24                	je     80102b0d <idestart+0xc1>
+      ideprd[n].addr = V2P(b1->data);
+80102ae9:	8d b0 74 00 00 80    	lea    -0x7fffff8c(%eax),%esi
+80102aef:	89 34 d5 00 97 11 80 	mov    %esi,-0x7fee6900(,%edx,8)
+      ideprd[n].len = BSIZE;
+80102af6:	66 c7 04 d5 04 97 11 	movw   $0x200,-0x7fee68fc(,%edx,8)
+80102afd:	80 00 02 
+      ideprd[n].flags = b1->qnext ? 0 : PRD_EOT;
+80102b00:	83 78 60 00          	cmpl   $0x0,0x60(%eax)
+80102b04:	74 cc                	je     80102ad2 <idestart+0x86>
+80102b06:	be 00 00 00 00       	mov    $0x0,%esi
+80102b0b:	eb ca                	jmp    80102ad7 <idestart+0x8b>
+    outl(idebm + BM_PRDT, V2P(ideprd));
+80102b0d:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+80102b10:	8d 51 04             	lea    0x4(%ecx),%edx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102b13:	b8 00 97 11 00       	mov    $0x119700,%eax
+80102b18:	ef                   	out    %eax,(%dx)
+    outb(idebm + BM_CMD, (b->flags & B_DIRTY) ? 0 : BM_TOMEM);
+80102b19:	f6 07 04             	testb  $0x4,(%edi)
+80102b1c:	0f 84 9f 00 00 00    	je     80102bc1 <idestart+0x175>
+80102b22:	b8 00 00 00 00       	mov    $0x0,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102b27:	89 ca                	mov    %ecx,%edx
+80102b29:	ee                   	out    %al,(%dx)
+    outb(idebm + BM_STATUS, BM_ERR|BM_INTR);
+80102b2a:	8d 51 02             	lea    0x2(%ecx),%edx
+80102b2d:	b8 06 00 00 00       	mov    $0x6,%eax
+80102b32:	ee                   	out    %al,(%dx)
+    write_cmd = IDE_CMD_WRDMA;
+80102b33:	c7 45 e0 ca 00 00 00 	movl   $0xca,-0x20(%ebp)
+    read_cmd = IDE_CMD_RDDMA;
+80102b3a:	c7 45 e4 c8 00 00 00 	movl   $0xc8,-0x1c(%ebp)
+  idewait(0);
+80102b41:	b8 00 00 00 00       	mov    $0x0,%eax
+80102b46:	e8 d7 fc ff ff       	call   80102822 <idewait>
+80102b4b:	b8 00 00 00 00       	mov    $0x0,%eax
+80102b50:	ba f6 03 00 00       	mov    $0x3f6,%edx
+80102b55:	ee                   	out    %al,(%dx)
+80102b56:	ba f2 01 00 00       	mov    $0x1f2,%edx
+80102b5b:	89 d8                	mov    %ebx,%eax
+80102b5d:	ee                   	out    %al,(%dx)
+80102b5e:	ba f3 01 00 00       	mov    $0x1f3,%edx
+80102b63:	89 f0                	mov    %esi,%eax
+80102b65:	ee                   	out    %al,(%dx)
+  outb(0x1f4, (sector >> 8) & 0xff);
+80102b66:	89 f0                	mov    %esi,%eax
+80102b68:	0f b6 c4             	movzbl %ah,%eax
+80102b6b:	ba f4 01 00 00       	mov    $0x1f4,%edx
+80102b70:	ee                   	out    %al,(%dx)
+  outb(0x1f5, (sector >> 16) & 0xff);
+80102b71:	89 f0                	mov    %esi,%eax
+80102b73:	c1 f8 10             	sar    $0x10,%eax
+80102b76:	ba f5 01 00 00       	mov    $0x1f5,%edx
+80102b7b:	ee                   	out    %al,(%dx)
+  outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
+80102b7c:	0f b6 47 04          	movzbl 0x4(%edi),%eax
+80102b80:	c1 e0 04             	shl    $0x4,%eax
+80102b83:	83 e0 10             	and    $0x10,%eax
+80102b86:	c1 fe 18             	sar    $0x18,%esi
+80102b89:	83 e6 0f             	and    $0xf,%esi
+80102b8c:	09 f0                	or     %esi,%eax
+80102b8e:	83 c8 e0             	or     $0xffffffe0,%eax
+80102b91:	ba f6 01 00 00       	mov    $0x1f6,%edx
+80102b96:	ee                   	out    %al,(%dx)
+  if(idebm){
+80102b97:	0f b7 0d 80 97 11 80 	movzwl 0x80119780,%ecx
+80102b9e:	66 85 c9             	test   %cx,%cx
+80102ba1:	74 2e                	je     80102bd1 <idestart+0x185>
+    outb(0x1f7, (b->flags & B_DIRTY) ? write_cmd : read_cmd);
+80102ba3:	f6 07 04             	testb  $0x4,(%edi)
+80102ba6:	74 23                	je     80102bcb <idestart+0x17f>
+80102ba8:	0f b6 45 e0          	movzbl -0x20(%ebp),%eax
+80102bac:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80102bb1:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102bb2:	89 ca                	mov    %ecx,%edx
+80102bb4:	ec                   	in     (%dx),%al
+    outb(idebm + BM_CMD, inb(idebm + BM_CMD) | BM_START);
+80102bb5:	83 c8 01             	or     $0x1,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102bb8:	ee                   	out    %al,(%dx)
+}
+80102bb9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102bbc:	5b                   	pop    %ebx
+80102bbd:	5e                   	pop    %esi
+80102bbe:	5f                   	pop    %edi
+80102bbf:	5d                   	pop    %ebp
+80102bc0:	c3                   	ret
+    outb(idebm + BM_CMD, (b->flags & B_DIRTY) ? 0 : BM_TOMEM);
+80102bc1:	b8 08 00 00 00       	mov    $0x8,%eax
+80102bc6:	e9 5c ff ff ff       	jmp    80102b27 <idestart+0xdb>
+80102bcb:	0f b6 45 e4          	movzbl -0x1c(%ebp),%eax
+80102bcf:	eb db                	jmp    80102bac <idestart+0x160>
+  } else if(b->flags & B_DIRTY){
+80102bd1:	f6 07 04             	testb  $0x4,(%edi)
+80102bd4:	74 25                	je     80102bfb <idestart+0x1af>
+80102bd6:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80102bdb:	0f b6 45 e0          	movzbl -0x20(%ebp),%eax
+80102bdf:	ee                   	out    %al,(%dx)
+    for(b1 = b; b1; b1 = b1->qnext)
+80102be0:	eb 13                	jmp    80102bf5 <idestart+0x1a9>
+      outsl(0x1f0, b1->data, BSIZE/4);
+80102be2:	8d 77 74             	lea    0x74(%edi),%esi
+  asm volatile("cld; rep outsl" :
+80102be5:	b9 80 00 00 00       	mov    $0x80,%ecx
+80102bea:	ba f0 01 00 00       	mov    $0x1f0,%edx
+80102bef:	fc                   	cld
+80102bf0:	f3 6f                	rep outsl %ds:(%esi),(%dx)
+    for(b1 = b; b1; b1 = b1->qnext)
+80102bf2:	8b 7f 60             	mov    0x60(%edi),%edi
+80102bf5:	85 ff                	test   %edi,%edi
+80102bf7:	75 e9                	jne    80102be2 <idestart+0x196>
+80102bf9:	eb be                	jmp    80102bb9 <idestart+0x16d>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102bfb:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80102c00:	0f b6 45 e4          	movzbl -0x1c(%ebp),%eax
+80102c04:	ee                   	out    %al,(%dx)
+}
+80102c05:	eb b2                	jmp    80102bb9 <idestart+0x16d>
+
+80102c07 <idenext>:
+
+// Start the next request, if any.  Caller must hold idelock
+// and the disk must be idle.
+static void
+idenext(void)
+{
+80102c07:	55                   	push   %ebp
+80102c08:	89 e5                	mov    %esp,%ebp
+80102c0a:	57                   	push   %edi
+80102c0b:	56                   	push   %esi
+80102c0c:	53                   	push   %ebx
+80102c0d:	83 ec 0c             	sub    $0xc,%esp
+  struct ideq *t;
+  struct buf *b, *b1;
+  int n;
+
+  if((b = fifo) != 0 && ticks - b->qtime >= IDEDEADLINE){
+80102c10:	8b 35 90 97 11 80    	mov    0x80119790,%esi
+80102c16:	85 f6                	test   %esi,%esi
+80102c18:	0f 84 80 00 00 00    	je     80102c9e <idenext+0x97>
+80102c1e:	a1 80 34 13 80       	mov    0x80133480,%eax
+80102c23:	2b 46 70             	sub    0x70(%esi),%eax
+80102c26:	83 f8 31             	cmp    $0x31,%eax
+80102c29:	76 73                	jbe    80102c9e <idenext+0x97>
+    // Served out of turn; find which heap it is on.
+    qremove(b->qidx < sweep->n && sweep->b[b->qidx] == b ? sweep : next, b);
+80102c2b:	8b 56 6c             	mov    0x6c(%esi),%edx
+80102c2e:	a1 08 d0 10 80       	mov    0x8010d008,%eax
+80102c33:	3b 10                	cmp    (%eax),%edx
+80102c35:	7d 06                	jge    80102c3d <idenext+0x36>
+80102c37:	39 74 90 04          	cmp    %esi,0x4(%eax,%edx,4)
+80102c3b:	74 05                	je     80102c42 <idenext+0x3b>
+80102c3d:	a1 04 d0 10 80       	mov    0x8010d004,%eax
+80102c42:	89 f2                	mov    %esi,%edx
+80102c44:	e8 02 fd ff ff       	call   8010294b <qremove>
+      return;
+    b = sweep->b[0];
+    qremove(sweep, b);
+    idepos = b->blockno;
+  }
+  idecur = b;
+80102c49:	89 35 98 18 12 80    	mov    %esi,0x80121898
+
+  // Requests for the following blocks, if any, are next on
+  // sweep; transfer them in the same command.
+  for(n = 1; n < idemerge && sweep->n != 0; n++){
+80102c4f:	bf 01 00 00 00       	mov    $0x1,%edi
+80102c54:	39 3d 00 d0 10 80    	cmp    %edi,0x8010d000
+80102c5a:	7e 7e                	jle    80102cda <idenext+0xd3>
+80102c5c:	a1 08 d0 10 80       	mov    0x8010d008,%eax
+80102c61:	83 38 00             	cmpl   $0x0,(%eax)
+80102c64:	74 74                	je     80102cda <idenext+0xd3>
+    b1 = sweep->b[0];
+80102c66:	8b 58 04             	mov    0x4(%eax),%ebx
+    if(b1->dev != b->dev || b1->blockno != b->blockno + 1 ||
+80102c69:	8b 4e 04             	mov    0x4(%esi),%ecx
+80102c6c:	39 4b 04             	cmp    %ecx,0x4(%ebx)
+80102c6f:	75 69                	jne    80102cda <idenext+0xd3>
+80102c71:	8b 4e 08             	mov    0x8(%esi),%ecx
+80102c74:	8d 51 01             	lea    0x1(%ecx),%edx
+80102c77:	39 53 08             	cmp    %edx,0x8(%ebx)
+80102c7a:	75 5e                	jne    80102cda <idenext+0xd3>
+       (b1->flags & B_DIRTY) != (b->flags & B_DIRTY))
+80102c7c:	8b 16                	mov    (%esi),%edx
+80102c7e:	33 13                	xor    (%ebx),%edx
+    if(b1->dev != b->dev || b1->blockno != b->blockno + 1 ||
+80102c80:	f6 c2 04             	test   $0x4,%dl
+80102c83:	75 55                	jne    80102cda <idenext+0xd3>
+      break;
+    qremove(sweep, b1);
+80102c85:	89 da                	mov    %ebx,%edx
+80102c87:	e8 bf fc ff ff       	call   8010294b <qremove>
+    b->qnext = b1;
+80102c8c:	89 5e 60             	mov    %ebx,0x60(%esi)
+    b = b1;
+    idepos = b->blockno;
+80102c8f:	8b 43 08             	mov    0x8(%ebx),%eax
+80102c92:	a3 88 97 11 80       	mov    %eax,0x80119788
+  for(n = 1; n < idemerge && sweep->n != 0; n++){
+80102c97:	83 c7 01             	add    $0x1,%edi
+    b = b1;
+80102c9a:	89 de                	mov    %ebx,%esi
+80102c9c:	eb b6                	jmp    80102c54 <idenext+0x4d>
+    if(sweep->n == 0){
+80102c9e:	a1 08 d0 10 80       	mov    0x8010d008,%eax
+80102ca3:	83 38 00             	cmpl   $0x0,(%eax)
+80102ca6:	75 11                	jne    80102cb9 <idenext+0xb2>
+      sweep = next;
+80102ca8:	8b 15 04 d0 10 80    	mov    0x8010d004,%edx
+80102cae:	89 15 08 d0 10 80    	mov    %edx,0x8010d008
+      next = t;
+80102cb4:	a3 04 d0 10 80       	mov    %eax,0x8010d004
+    if(sweep->n == 0)
+80102cb9:	a1 08 d0 10 80       	mov    0x8010d008,%eax
+80102cbe:	83 38 00             	cmpl   $0x0,(%eax)
+80102cc1:	74 28                	je     80102ceb <idenext+0xe4>
+    b = sweep->b[0];
+80102cc3:	8b 70 04             	mov    0x4(%eax),%esi
+    qremove(sweep, b);
+80102cc6:	89 f2                	mov    %esi,%edx
+80102cc8:	e8 7e fc ff ff       	call   8010294b <qremove>
+    idepos = b->blockno;
+80102ccd:	8b 46 08             	mov    0x8(%esi),%eax
+80102cd0:	a3 88 97 11 80       	mov    %eax,0x80119788
+80102cd5:	e9 6f ff ff ff       	jmp    80102c49 <idenext+0x42>
+  }
+  b->qnext = 0;
+80102cda:	c7 46 60 00 00 00 00 	movl   $0x0,0x60(%esi)
+  idestart(idecur);
+80102ce1:	a1 98 18 12 80       	mov    0x80121898,%eax
+80102ce6:	e8 61 fd ff ff       	call   80102a4c <idestart>
+}
+80102ceb:	83 c4 0c             	add    $0xc,%esp
+80102cee:	5b                   	pop    %ebx
+80102cef:	5e                   	pop    %esi
+80102cf0:	5f                   	pop    %edi
+80102cf1:	5d                   	pop    %ebp
+80102cf2:	c3                   	ret
+
+80102cf3 <qinsert>:
+{
+80102cf3:	55                   	push   %ebp
+80102cf4:	89 e5                	mov    %esp,%ebp
+80102cf6:	56                   	push   %esi
+80102cf7:	53                   	push   %ebx
+80102cf8:	89 d3                	mov    %edx,%ebx
+  if(q->n == NIDEQ)
+80102cfa:	8b 10                	mov    (%eax),%edx
+80102cfc:	81 fa 1e 10 00 00    	cmp    $0x101e,%edx
+80102d02:	74 47                	je     80102d4b <qinsert+0x58>
+80102d04:	89 c6                	mov    %eax,%esi
+  qset(q, q->n++, b);
+80102d06:	8d 42 01             	lea    0x1(%edx),%eax
+80102d09:	89 06                	mov    %eax,(%esi)
+80102d0b:	89 d9                	mov    %ebx,%ecx
+80102d0d:	89 f0                	mov    %esi,%eax
+80102d0f:	e8 9d fb ff ff       	call   801028b1 <qset>
+  qsift(q, q->n-1);
+80102d14:	8b 06                	mov    (%esi),%eax
+80102d16:	8d 50 ff             	lea    -0x1(%eax),%edx
+80102d19:	89 f0                	mov    %esi,%eax
+80102d1b:	e8 99 fb ff ff       	call   801028b9 <qsift>
+  b->qtime = ticks;
+80102d20:	a1 80 34 13 80       	mov    0x80133480,%eax
+80102d25:	89 43 70             	mov    %eax,0x70(%ebx)
+  b->fnext = 0;
+80102d28:	c7 43 68 00 00 00 00 	movl   $0x0,0x68(%ebx)
+  b->fprev = fifotail;
+80102d2f:	a1 8c 97 11 80       	mov    0x8011978c,%eax
+80102d34:	89 43 64             	mov    %eax,0x64(%ebx)
+  if(fifotail)
+80102d37:	85 c0                	test   %eax,%eax
+80102d39:	74 1d                	je     80102d58 <qinsert+0x65>
+    fifotail->fnext = b;
+80102d3b:	89 58 68             	mov    %ebx,0x68(%eax)
+  fifotail = b;
+80102d3e:	89 1d 8c 97 11 80    	mov    %ebx,0x8011978c
+}
+80102d44:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102d47:	5b                   	pop    %ebx
+80102d48:	5e                   	pop    %esi
+80102d49:	5d                   	pop    %ebp
+80102d4a:	c3                   	ret
+    panic("qinsert");
+80102d4b:	83 ec 0c             	sub    $0xc,%esp
+80102d4e:	68 a3 bb 10 80       	push   $0x8010bba3
+80102d53:	e8 d3 df ff ff       	call   80100d2b <panic>
+    fifo = b;
+80102d58:	89 1d 90 97 11 80    	mov    %ebx,0x80119790
+80102d5e:	eb de                	jmp    80102d3e <qinsert+0x4b>
+
+80102d60 <idefinish>:
+{
+80102d60:	55                   	push   %ebp
+80102d61:	89 e5                	mov    %esp,%ebp
+80102d63:	56                   	push   %esi
+80102d64:	53                   	push   %ebx
+  async = 0;
+80102d65:	be 00 00 00 00       	mov    $0x0,%esi
+  for(; b; b = bnext){
+80102d6a:	eb 1d                	jmp    80102d89 <idefinish+0x29>
+    b->flags |= B_VALID;
+80102d6c:	89 d1                	mov    %edx,%ecx
+80102d6e:	83 c9 02             	or     $0x2,%ecx
+80102d71:	89 08                	mov    %ecx,(%eax)
+    b->flags &= ~(B_DIRTY|B_ASYNC);
+80102d73:	83 e2 f3             	and    $0xfffffff3,%edx
+80102d76:	83 ca 02             	or     $0x2,%edx
+80102d79:	89 10                	mov    %edx,(%eax)
+    wakeup(b);
+80102d7b:	83 ec 0c             	sub    $0xc,%esp
+80102d7e:	50                   	push   %eax
+80102d7f:	e8 b1 3a 00 00       	call   80106835 <wakeup>
+80102d84:	83 c4 10             	add    $0x10,%esp
+  for(; b; b = bnext){
+80102d87:	89 d8                	mov    %ebx,%eax
+80102d89:	85 c0                	test   %eax,%eax
+80102d8b:	74 11                	je     80102d9e <idefinish+0x3e>
+    bnext = b->qnext;
+80102d8d:	8b 58 60             	mov    0x60(%eax),%ebx
+    if(b->flags & B_ASYNC){
+80102d90:	8b 10                	mov    (%eax),%edx
+80102d92:	f6 c2 08             	test   $0x8,%dl
+80102d95:	74 d5                	je     80102d6c <idefinish+0xc>
+      b->qnext = async;
+80102d97:	89 70 60             	mov    %esi,0x60(%eax)
+      async = b;
+80102d9a:	89 c6                	mov    %eax,%esi
+80102d9c:	eb ce                	jmp    80102d6c <idefinish+0xc>
+  wakeup(&idecur);  // idewaitany() on several buffers
+80102d9e:	83 ec 0c             	sub    $0xc,%esp
+80102da1:	68 98 18 12 80       	push   $0x80121898
+80102da6:	e8 8a 3a 00 00       	call   80106835 <wakeup>
+}
+80102dab:	89 f0                	mov    %esi,%eax
+80102dad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102db0:	5b                   	pop    %ebx
+80102db1:	5e                   	pop    %esi
+80102db2:	5d                   	pop    %ebp
+80102db3:	c3                   	ret
+
+80102db4 <idedoneasync>:
+  for(; b; b = bnext){
+80102db4:	85 c0                	test   %eax,%eax
+80102db6:	74 21                	je     80102dd9 <idedoneasync+0x25>
+{
+80102db8:	55                   	push   %ebp
+80102db9:	89 e5                	mov    %esp,%ebp
+80102dbb:	53                   	push   %ebx
+80102dbc:	83 ec 04             	sub    $0x4,%esp
+    bnext = b->qnext;
+80102dbf:	8b 58 60             	mov    0x60(%eax),%ebx
+    bdone(b);
+80102dc2:	83 ec 0c             	sub    $0xc,%esp
+80102dc5:	50                   	push   %eax
+80102dc6:	e8 25 dd ff ff       	call   80100af0 <bdone>
+80102dcb:	83 c4 10             	add    $0x10,%esp
+  for(; b; b = bnext){
+80102dce:	89 d8                	mov    %ebx,%eax
+80102dd0:	85 db                	test   %ebx,%ebx
+80102dd2:	75 eb                	jne    80102dbf <idedoneasync+0xb>
+}
+80102dd4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102dd7:	c9                   	leave
+80102dd8:	c3                   	ret
+80102dd9:	c3                   	ret
+
+80102dda <ideappend>:
+
+// Queue b for the disk, starting the disk if it is idle.
+// Caller must hold idelock.
+static void
+ideappend(struct buf *b)
+{
+80102dda:	55                   	push   %ebp
+80102ddb:	89 e5                	mov    %esp,%ebp
+80102ddd:	53                   	push   %ebx
+80102dde:	83 ec 10             	sub    $0x10,%esp
+80102de1:	89 c3                	mov    %eax,%ebx
+  if(!holdingsleep(&b->lock))
+80102de3:	8d 40 0c             	lea    0xc(%eax),%eax
+80102de6:	50                   	push   %eax
+80102de7:	e8 d5 45 00 00       	call   801073c1 <holdingsleep>
+80102dec:	83 c4 10             	add    $0x10,%esp
+80102def:	85 c0                	test   %eax,%eax
+80102df1:	74 4b                	je     80102e3e <ideappend+0x64>
+    panic("iderw: buf not locked");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+80102df3:	8b 03                	mov    (%ebx),%eax
+80102df5:	83 e0 06             	and    $0x6,%eax
+80102df8:	83 f8 02             	cmp    $0x2,%eax
+80102dfb:	74 4e                	je     80102e4b <ideappend+0x71>
+    panic("iderw: nothing to do");
+  if(b->dev != 0 && virtiodisk1){
+80102dfd:	8b 43 04             	mov    0x4(%ebx),%eax
+80102e00:	85 c0                	test   %eax,%eax
+80102e02:	74 09                	je     80102e0d <ideappend+0x33>
+80102e04:	83 3d 80 96 11 80 00 	cmpl   $0x0,0x80119680
+80102e0b:	75 4b                	jne    80102e58 <ideappend+0x7e>
+    virtiosubmit(b);
+    return;
+  }
+  if(b->dev != 0 && !havedisk1)
+80102e0d:	85 c0                	test   %eax,%eax
+80102e0f:	74 09                	je     80102e1a <ideappend+0x40>
+80102e11:	83 3d 84 96 11 80 00 	cmpl   $0x0,0x80119684
+80102e18:	74 4c                	je     80102e66 <ideappend+0x8c>
+    panic("iderw: ide disk 1 not present");
+
+  qinsert(b->blockno >= idepos ? sweep : next, b);  //DOC:insert-queue
+80102e1a:	a1 88 97 11 80       	mov    0x80119788,%eax
+80102e1f:	39 43 08             	cmp    %eax,0x8(%ebx)
+80102e22:	72 4f                	jb     80102e73 <ideappend+0x99>
+80102e24:	a1 08 d0 10 80       	mov    0x8010d008,%eax
+80102e29:	89 da                	mov    %ebx,%edx
+80102e2b:	e8 c3 fe ff ff       	call   80102cf3 <qinsert>
+
+  // Start disk if necessary.
+  if(idecur == 0)
+80102e30:	83 3d 98 18 12 80 00 	cmpl   $0x0,0x80121898
+80102e37:	74 41                	je     80102e7a <ideappend+0xa0>
+    idenext();
+}
+80102e39:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102e3c:	c9                   	leave
+80102e3d:	c3                   	ret
+    panic("iderw: buf not locked");
+80102e3e:	83 ec 0c             	sub    $0xc,%esp
+80102e41:	68 ab bb 10 80       	push   $0x8010bbab
+80102e46:	e8 e0 de ff ff       	call   80100d2b <panic>
+    panic("iderw: nothing to do");
+80102e4b:	83 ec 0c             	sub    $0xc,%esp
+80102e4e:	68 c1 bb 10 80       	push   $0x8010bbc1
+80102e53:	e8 d3 de ff ff       	call   80100d2b <panic>
+    virtiosubmit(b);
+80102e58:	83 ec 0c             	sub    $0xc,%esp
+80102e5b:	53                   	push   %ebx
+80102e5c:	e8 91 75 00 00       	call   8010a3f2 <virtiosubmit>
+    return;
+80102e61:	83 c4 10             	add    $0x10,%esp
+80102e64:	eb d3                	jmp    80102e39 <ideappend+0x5f>
+    panic("iderw: ide disk 1 not present");
+80102e66:	83 ec 0c             	sub    $0xc,%esp
+80102e69:	68 d6 bb 10 80       	push   $0x8010bbd6
+80102e6e:	e8 b8 de ff ff       	call   80100d2b <panic>
+  qinsert(b->blockno >= idepos ? sweep : next, b);  //DOC:insert-queue
+80102e73:	a1 04 d0 10 80       	mov    0x8010d004,%eax
+80102e78:	eb af                	jmp    80102e29 <ideappend+0x4f>
+    idenext();
+80102e7a:	e8 88 fd ff ff       	call   80102c07 <idenext>
+80102e7f:	eb b8                	jmp    80102e39 <ideappend+0x5f>
+
+80102e81 <ideinit>:
+{
+80102e81:	55                   	push   %ebp
+80102e82:	89 e5                	mov    %esp,%ebp
+80102e84:	83 ec 10             	sub    $0x10,%esp
+  initlock(&idelock, "ide");
+80102e87:	68 f4 bb 10 80       	push   $0x8010bbf4
+80102e8c:	68 a0 18 12 80       	push   $0x801218a0
+80102e91:	e8 b8 4a 00 00       	call   8010794e <initlock>
+  ioapicenable(IRQ_IDE, ncpu - 1);
+80102e96:	83 c4 08             	add    $0x8,%esp
+80102e99:	a1 64 1e 12 80       	mov    0x80121e64,%eax
+80102e9e:	83 e8 01             	sub    $0x1,%eax
+80102ea1:	50                   	push   %eax
+80102ea2:	6a 0e                	push   $0xe
+80102ea4:	e8 94 03 00 00       	call   8010323d <ioapicenable>
+  idewait(0);
+80102ea9:	b8 00 00 00 00       	mov    $0x0,%eax
+80102eae:	e8 6f f9 ff ff       	call   80102822 <idewait>
+80102eb3:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+80102eb8:	ba f6 01 00 00       	mov    $0x1f6,%edx
+80102ebd:	ee                   	out    %al,(%dx)
+  for(i=0; i<1000; i++){
+80102ebe:	83 c4 10             	add    $0x10,%esp
+80102ec1:	b9 00 00 00 00       	mov    $0x0,%ecx
+80102ec6:	81 f9 e7 03 00 00    	cmp    $0x3e7,%ecx
+80102ecc:	7f 19                	jg     80102ee7 <ideinit+0x66>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102ece:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80102ed3:	ec                   	in     (%dx),%al
+    if(inb(0x1f7) != 0){
+80102ed4:	84 c0                	test   %al,%al
+80102ed6:	75 05                	jne    80102edd <ideinit+0x5c>
+  for(i=0; i<1000; i++){
+80102ed8:	83 c1 01             	add    $0x1,%ecx
+80102edb:	eb e9                	jmp    80102ec6 <ideinit+0x45>
+      havedisk1 = 1;
+80102edd:	c7 05 84 96 11 80 01 	movl   $0x1,0x80119684
+80102ee4:	00 00 00 
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102ee7:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+80102eec:	ba f6 01 00 00       	mov    $0x1f6,%edx
+80102ef1:	ee                   	out    %al,(%dx)
+  if(!havedisk1 && virtioinit() == 0)
+80102ef2:	83 3d 84 96 11 80 00 	cmpl   $0x0,0x80119684
+80102ef9:	74 1b                	je     80102f16 <ideinit+0x95>
+  idedmainit();
+80102efb:	e8 b4 fa ff ff       	call   801029b4 <idedmainit>
+  if(BSIZE/SECTOR_SIZE <= IDEMULT &&
+80102f00:	66 83 3d 80 97 11 80 	cmpw   $0x0,0x80119780
+80102f07:	00 
+80102f08:	74 21                	je     80102f2b <ideinit+0xaa>
+    idemerge = IDEMULT / (BSIZE/SECTOR_SIZE);
+80102f0a:	c7 05 00 d0 10 80 10 	movl   $0x10,0x8010d000
+80102f11:	00 00 00 
+}
+80102f14:	c9                   	leave
+80102f15:	c3                   	ret
+  if(!havedisk1 && virtioinit() == 0)
+80102f16:	e8 c0 72 00 00       	call   8010a1db <virtioinit>
+80102f1b:	85 c0                	test   %eax,%eax
+80102f1d:	75 dc                	jne    80102efb <ideinit+0x7a>
+    virtiodisk1 = 1;
+80102f1f:	c7 05 80 96 11 80 01 	movl   $0x1,0x80119680
+80102f26:	00 00 00 
+80102f29:	eb d0                	jmp    80102efb <ideinit+0x7a>
+     (idebm || (idesetmult(0) == 0 && (!havedisk1 || idesetmult(1) == 0))))
+80102f2b:	b8 00 00 00 00       	mov    $0x0,%eax
+80102f30:	e8 16 f9 ff ff       	call   8010284b <idesetmult>
+  if(BSIZE/SECTOR_SIZE <= IDEMULT &&
+80102f35:	85 c0                	test   %eax,%eax
+80102f37:	75 db                	jne    80102f14 <ideinit+0x93>
+     (idebm || (idesetmult(0) == 0 && (!havedisk1 || idesetmult(1) == 0))))
+80102f39:	83 3d 84 96 11 80 00 	cmpl   $0x0,0x80119684
+80102f40:	74 c8                	je     80102f0a <ideinit+0x89>
+80102f42:	b8 01 00 00 00       	mov    $0x1,%eax
+80102f47:	e8 ff f8 ff ff       	call   8010284b <idesetmult>
+80102f4c:	85 c0                	test   %eax,%eax
+80102f4e:	75 c4                	jne    80102f14 <ideinit+0x93>
+80102f50:	eb b8                	jmp    80102f0a <ideinit+0x89>
+
+80102f52 <ideintr>:
+{
+80102f52:	55                   	push   %ebp
+80102f53:	89 e5                	mov    %esp,%ebp
+80102f55:	57                   	push   %edi
+80102f56:	56                   	push   %esi
+80102f57:	53                   	push   %ebx
+80102f58:	83 ec 18             	sub    $0x18,%esp
+  acquire(&idelock);
+80102f5b:	68 a0 18 12 80       	push   $0x801218a0
+80102f60:	e8 2d 4b 00 00       	call   80107a92 <acquire>
+  if((b = idecur) == 0){
+80102f65:	8b 1d 98 18 12 80    	mov    0x80121898,%ebx
+80102f6b:	83 c4 10             	add    $0x10,%esp
+80102f6e:	85 db                	test   %ebx,%ebx
+80102f70:	74 61                	je     80102fd3 <ideintr+0x81>
+  if(idebm){
+80102f72:	0f b7 0d 80 97 11 80 	movzwl 0x80119780,%ecx
+80102f79:	66 85 c9             	test   %cx,%cx
+80102f7c:	74 77                	je     80102ff5 <ideintr+0xa3>
+    st = inb(idebm + BM_STATUS);
+80102f7e:	8d 71 02             	lea    0x2(%ecx),%esi
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102f81:	89 f2                	mov    %esi,%edx
+80102f83:	ec                   	in     (%dx),%al
+80102f84:	89 c7                	mov    %eax,%edi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102f86:	b8 00 00 00 00       	mov    $0x0,%eax
+80102f8b:	89 ca                	mov    %ecx,%edx
+80102f8d:	ee                   	out    %al,(%dx)
+80102f8e:	b8 06 00 00 00       	mov    $0x6,%eax
+80102f93:	89 f2                	mov    %esi,%edx
+80102f95:	ee                   	out    %al,(%dx)
+    err = (st & BM_ERR) || idewait(1) < 0;
+80102f96:	f7 c7 02 00 00 00    	test   $0x2,%edi
+80102f9c:	74 47                	je     80102fe5 <ideintr+0x93>
+    if(++ideerrs > IDERETRY)
+80102f9e:	a1 84 97 11 80       	mov    0x80119784,%eax
+80102fa3:	83 c0 01             	add    $0x1,%eax
+80102fa6:	a3 84 97 11 80       	mov    %eax,0x80119784
+80102fab:	83 f8 03             	cmp    $0x3,%eax
+80102fae:	0f 8f b8 00 00 00    	jg     8010306c <ideintr+0x11a>
+    idestart(b);
+80102fb4:	89 d8                	mov    %ebx,%eax
+80102fb6:	e8 91 fa ff ff       	call   80102a4c <idestart>
+    release(&idelock);
+80102fbb:	83 ec 0c             	sub    $0xc,%esp
+80102fbe:	68 a0 18 12 80       	push   $0x801218a0
+80102fc3:	e8 2f 4b 00 00       	call   80107af7 <release>
+    return;
+80102fc8:	83 c4 10             	add    $0x10,%esp
+}
+80102fcb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102fce:	5b                   	pop    %ebx
+80102fcf:	5e                   	pop    %esi
+80102fd0:	5f                   	pop    %edi
+80102fd1:	5d                   	pop    %ebp
+80102fd2:	c3                   	ret
+    release(&idelock);
+80102fd3:	83 ec 0c             	sub    $0xc,%esp
+80102fd6:	68 a0 18 12 80       	push   $0x801218a0
+80102fdb:	e8 17 4b 00 00       	call   80107af7 <release>
+    return;
+80102fe0:	83 c4 10             	add    $0x10,%esp
+80102fe3:	eb e6                	jmp    80102fcb <ideintr+0x79>
+    err = (st & BM_ERR) || idewait(1) < 0;
+80102fe5:	b8 01 00 00 00       	mov    $0x1,%eax
+80102fea:	e8 33 f8 ff ff       	call   80102822 <idewait>
+80102fef:	85 c0                	test   %eax,%eax
+80102ff1:	79 1e                	jns    80103011 <ideintr+0xbf>
+80102ff3:	eb a9                	jmp    80102f9e <ideintr+0x4c>
+    err = idewait(1) < 0;
+80102ff5:	b8 01 00 00 00       	mov    $0x1,%eax
+80102ffa:	e8 23 f8 ff ff       	call   80102822 <idewait>
+80102fff:	89 c6                	mov    %eax,%esi
+80103001:	c1 ee 1f             	shr    $0x1f,%esi
+    if(!err && !(b->flags & B_DIRTY))
+80103004:	85 c0                	test   %eax,%eax
+80103006:	78 05                	js     8010300d <ideintr+0xbb>
+80103008:	f6 03 04             	testb  $0x4,(%ebx)
+8010300b:	74 5b                	je     80103068 <ideintr+0x116>
+  if(err){
+8010300d:	85 f6                	test   %esi,%esi
+8010300f:	75 8d                	jne    80102f9e <ideintr+0x4c>
+  ideerrs = 0;
+80103011:	c7 05 84 97 11 80 00 	movl   $0x0,0x80119784
+80103018:	00 00 00 
+  idecur = 0;
+8010301b:	c7 05 98 18 12 80 00 	movl   $0x0,0x80121898
+80103022:	00 00 00 
+  async = idefinish(b);
+80103025:	89 d8                	mov    %ebx,%eax
+80103027:	e8 34 fd ff ff       	call   80102d60 <idefinish>
+8010302c:	89 c3                	mov    %eax,%ebx
+  idenext();
+8010302e:	e8 d4 fb ff ff       	call   80102c07 <idenext>
+  release(&idelock);
+80103033:	83 ec 0c             	sub    $0xc,%esp
+80103036:	68 a0 18 12 80       	push   $0x801218a0
+8010303b:	e8 b7 4a 00 00       	call   80107af7 <release>
+  idedoneasync(async);
+80103040:	89 d8                	mov    %ebx,%eax
+80103042:	e8 6d fd ff ff       	call   80102db4 <idedoneasync>
+80103047:	83 c4 10             	add    $0x10,%esp
+8010304a:	e9 7c ff ff ff       	jmp    80102fcb <ideintr+0x79>
+        insl(0x1f0, b1->data, BSIZE/4);
+8010304f:	8d 78 74             	lea    0x74(%eax),%edi
+  asm volatile("cld; rep insl" :
+80103052:	b9 80 00 00 00       	mov    $0x80,%ecx
+80103057:	ba f0 01 00 00       	mov    $0x1f0,%edx
+8010305c:	fc                   	cld
+8010305d:	f3 6d                	rep insl (%dx),%es:(%edi)
+      for(b1 = b; b1; b1 = b1->qnext)
+8010305f:	8b 40 60             	mov    0x60(%eax),%eax
+80103062:	85 c0                	test   %eax,%eax
+80103064:	75 e9                	jne    8010304f <ideintr+0xfd>
+80103066:	eb a5                	jmp    8010300d <ideintr+0xbb>
+80103068:	89 d8                	mov    %ebx,%eax
+8010306a:	eb f6                	jmp    80103062 <ideintr+0x110>
+      panic("ideintr: disk error");
+8010306c:	83 ec 0c             	sub    $0xc,%esp
+8010306f:	68 f8 bb 10 80       	push   $0x8010bbf8
+80103074:	e8 b2 dc ff ff       	call   80100d2b <panic>
+
+80103079 <idedone>:
+{
+80103079:	55                   	push   %ebp
+8010307a:	89 e5                	mov    %esp,%ebp
+8010307c:	53                   	push   %ebx
+8010307d:	83 ec 10             	sub    $0x10,%esp
+  acquire(&idelock);
+80103080:	68 a0 18 12 80       	push   $0x801218a0
+80103085:	e8 08 4a 00 00       	call   80107a92 <acquire>
+  async = idefinish(b);
+8010308a:	8b 45 08             	mov    0x8(%ebp),%eax
+8010308d:	e8 ce fc ff ff       	call   80102d60 <idefinish>
+80103092:	89 c3                	mov    %eax,%ebx
+  release(&idelock);
+80103094:	c7 04 24 a0 18 12 80 	movl   $0x801218a0,(%esp)
+8010309b:	e8 57 4a 00 00       	call   80107af7 <release>
+  idedoneasync(async);
+801030a0:	89 d8                	mov    %ebx,%eax
+801030a2:	e8 0d fd ff ff       	call   80102db4 <idedoneasync>
+}
+801030a7:	83 c4 10             	add    $0x10,%esp
+801030aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801030ad:	c9                   	leave
+801030ae:	c3                   	ret
+
+801030af <idesubmit>:
+// waiting.  Wait for the request with idewaitany(), or set
+// B_ASYNC to have the buffer released with bdone() when the
+// request finishes.
+void
+idesubmit(struct buf *b)
+{
+801030af:	55                   	push   %ebp
+801030b0:	89 e5                	mov    %esp,%ebp
+801030b2:	83 ec 14             	sub    $0x14,%esp
+  acquire(&idelock);
+801030b5:	68 a0 18 12 80       	push   $0x801218a0
+801030ba:	e8 d3 49 00 00       	call   80107a92 <acquire>
+  ideappend(b);
+801030bf:	8b 45 08             	mov    0x8(%ebp),%eax
+801030c2:	e8 13 fd ff ff       	call   80102dda <ideappend>
+  release(&idelock);
+801030c7:	c7 04 24 a0 18 12 80 	movl   $0x801218a0,(%esp)
+801030ce:	e8 24 4a 00 00       	call   80107af7 <release>
+}
+801030d3:	83 c4 10             	add    $0x10,%esp
+801030d6:	c9                   	leave
+801030d7:	c3                   	ret
+
+801030d8 <idewaitany>:
+// Wait until the disk is done with one of the n buffers in
+// bufs and return its index.  The buffers must be locked and
+// not have B_ASYNC set.
+int
+idewaitany(struct buf **bufs, int n)
+{
+801030d8:	55                   	push   %ebp
+801030d9:	89 e5                	mov    %esp,%ebp
+801030db:	57                   	push   %edi
+801030dc:	56                   	push   %esi
+801030dd:	53                   	push   %ebx
+801030de:	83 ec 18             	sub    $0x18,%esp
+801030e1:	8b 7d 08             	mov    0x8(%ebp),%edi
+801030e4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int i;
+
+  acquire(&idelock);
+801030e7:	68 a0 18 12 80       	push   $0x801218a0
+801030ec:	e8 a1 49 00 00       	call   80107a92 <acquire>
+801030f1:	83 c4 10             	add    $0x10,%esp
+801030f4:	eb 1b                	jmp    80103111 <idewaitany+0x39>
+      if((bufs[i]->flags & (B_VALID|B_DIRTY)) == B_VALID){
+        release(&idelock);
+        return i;
+      }
+    }
+    sleep(n == 1 ? (void*)bufs[0] : (void*)&idecur, &idelock);
+801030f6:	83 fe 01             	cmp    $0x1,%esi
+801030f9:	74 31                	je     8010312c <idewaitany+0x54>
+801030fb:	b8 98 18 12 80       	mov    $0x80121898,%eax
+80103100:	83 ec 08             	sub    $0x8,%esp
+80103103:	68 a0 18 12 80       	push   $0x801218a0
+80103108:	50                   	push   %eax
+80103109:	e8 58 34 00 00       	call   80106566 <sleep>
+    for(i = 0; i < n; i++){
+8010310e:	83 c4 10             	add    $0x10,%esp
+80103111:	bb 00 00 00 00       	mov    $0x0,%ebx
+80103116:	39 f3                	cmp    %esi,%ebx
+80103118:	7d dc                	jge    801030f6 <idewaitany+0x1e>
+      if((bufs[i]->flags & (B_VALID|B_DIRTY)) == B_VALID){
+8010311a:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+8010311d:	8b 00                	mov    (%eax),%eax
+8010311f:	83 e0 06             	and    $0x6,%eax
+80103122:	83 f8 02             	cmp    $0x2,%eax
+80103125:	74 09                	je     80103130 <idewaitany+0x58>
+    for(i = 0; i < n; i++){
+80103127:	83 c3 01             	add    $0x1,%ebx
+8010312a:	eb ea                	jmp    80103116 <idewaitany+0x3e>
+    sleep(n == 1 ? (void*)bufs[0] : (void*)&idecur, &idelock);
+8010312c:	8b 07                	mov    (%edi),%eax
+8010312e:	eb d0                	jmp    80103100 <idewaitany+0x28>
+        release(&idelock);
+80103130:	83 ec 0c             	sub    $0xc,%esp
+80103133:	68 a0 18 12 80       	push   $0x801218a0
+80103138:	e8 ba 49 00 00       	call   80107af7 <release>
+  }
+}
+8010313d:	89 d8                	mov    %ebx,%eax
+8010313f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103142:	5b                   	pop    %ebx
+80103143:	5e                   	pop    %esi
+80103144:	5f                   	pop    %edi
+80103145:	5d                   	pop    %ebp
+80103146:	c3                   	ret
+
+80103147 <iderw>:
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderw(struct buf *b)
+{
+80103147:	55                   	push   %ebp
+80103148:	89 e5                	mov    %esp,%ebp
+8010314a:	53                   	push   %ebx
+8010314b:	83 ec 10             	sub    $0x10,%esp
+8010314e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&idelock);  //DOC:acquire-lock
+80103151:	68 a0 18 12 80       	push   $0x801218a0
+80103156:	e8 37 49 00 00       	call   80107a92 <acquire>
+
+  ideappend(b);
+8010315b:	89 d8                	mov    %ebx,%eax
+8010315d:	e8 78 fc ff ff       	call   80102dda <ideappend>
+
+  // Wait for request to finish.
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+80103162:	83 c4 10             	add    $0x10,%esp
+80103165:	eb 11                	jmp    80103178 <iderw+0x31>
+    sleep(b, &idelock);
+80103167:	83 ec 08             	sub    $0x8,%esp
+8010316a:	68 a0 18 12 80       	push   $0x801218a0
+8010316f:	53                   	push   %ebx
+80103170:	e8 f1 33 00 00       	call   80106566 <sleep>
+80103175:	83 c4 10             	add    $0x10,%esp
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+80103178:	8b 03                	mov    (%ebx),%eax
+8010317a:	83 e0 06             	and    $0x6,%eax
+8010317d:	83 f8 02             	cmp    $0x2,%eax
+80103180:	75 e5                	jne    80103167 <iderw+0x20>
+  }
+
+
+  release(&idelock);
+80103182:	83 ec 0c             	sub    $0xc,%esp
+80103185:	68 a0 18 12 80       	push   $0x801218a0
+8010318a:	e8 68 49 00 00       	call   80107af7 <release>
+}
+8010318f:	83 c4 10             	add    $0x10,%esp
+80103192:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103195:	c9                   	leave
+80103196:	c3                   	ret
+
+80103197 <ioapicread>:
+};
+
+static uint
+ioapicread(int reg)
+{
+  ioapic->reg = reg;
+80103197:	8b 15 d4 18 12 80    	mov    0x801218d4,%edx
+8010319d:	89 02                	mov    %eax,(%edx)
+  return ioapic->data;
+8010319f:	a1 d4 18 12 80       	mov    0x801218d4,%eax
+801031a4:	8b 40 10             	mov    0x10(%eax),%eax
+}
+801031a7:	c3                   	ret
+
+801031a8 <ioapicwrite>:
+
+static void
+ioapicwrite(int reg, uint data)
+{
+  ioapic->reg = reg;
+801031a8:	8b 0d d4 18 12 80    	mov    0x801218d4,%ecx
+801031ae:	89 01                	mov    %eax,(%ecx)
+  ioapic->data = data;
+801031b0:	a1 d4 18 12 80       	mov    0x801218d4,%eax
+801031b5:	89 50 10             	mov    %edx,0x10(%eax)
+}
+801031b8:	c3                   	ret
+
+801031b9 <ioapicinit>:
+
+void
+ioapicinit(void)
+{
+801031b9:	55                   	push   %ebp
+801031ba:	89 e5                	mov    %esp,%ebp
+801031bc:	57                   	push   %edi
+801031bd:	56                   	push   %esi
+801031be:	53                   	push   %ebx
+801031bf:	83 ec 0c             	sub    $0xc,%esp
+  int i, id, maxintr;
+
+  ioapic = (volatile struct ioapic*)IOAPIC;
+801031c2:	c7 05 d4 18 12 80 00 	movl   $0xfec00000,0x801218d4
+801031c9:	00 c0 fe 
+  maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+801031cc:	b8 01 00 00 00       	mov    $0x1,%eax
+801031d1:	e8 c1 ff ff ff       	call   80103197 <ioapicread>
+801031d6:	c1 e8 10             	shr    $0x10,%eax
+801031d9:	0f b6 f8             	movzbl %al,%edi
+  id = ioapicread(REG_ID) >> 24;
+801031dc:	b8 00 00 00 00       	mov    $0x0,%eax
+801031e1:	e8 b1 ff ff ff       	call   80103197 <ioapicread>
+801031e6:	c1 e8 18             	shr    $0x18,%eax
+  if(id != ioapicid)
+801031e9:	0f b6 15 60 1e 12 80 	movzbl 0x80121e60,%edx
+801031f0:	39 c2                	cmp    %eax,%edx
+801031f2:	75 07                	jne    801031fb <ioapicinit+0x42>
+{
+801031f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+801031f9:	eb 36                	jmp    80103231 <ioapicinit+0x78>
+    cprintf("ioapicinit: id isn't equal to ioapicid; not a MP\n");
+801031fb:	83 ec 0c             	sub    $0xc,%esp
+801031fe:	68 0c bc 10 80       	push   $0x8010bc0c
+80103203:	e8 e4 dd ff ff       	call   80100fec <cprintf>
+80103208:	83 c4 10             	add    $0x10,%esp
+8010320b:	eb e7                	jmp    801031f4 <ioapicinit+0x3b>
+
+  // Mark all interrupts edge-triggered, active high, disabled,
+  // and not routed to any CPUs.
+  for(i = 0; i <= maxintr; i++){
+    ioapicwrite(REG_TABLE+2*i, INT_DISABLED | (T_IRQ0 + i));
+8010320d:	8d 53 20             	lea    0x20(%ebx),%edx
+80103210:	81 ca 00 00 01 00    	or     $0x10000,%edx
+80103216:	8d 74 1b 10          	lea    0x10(%ebx,%ebx,1),%esi
+8010321a:	89 f0                	mov    %esi,%eax
+8010321c:	e8 87 ff ff ff       	call   801031a8 <ioapicwrite>
+    ioapicwrite(REG_TABLE+2*i+1, 0);
+80103221:	8d 46 01             	lea    0x1(%esi),%eax
+80103224:	ba 00 00 00 00       	mov    $0x0,%edx
+80103229:	e8 7a ff ff ff       	call   801031a8 <ioapicwrite>
+  for(i = 0; i <= maxintr; i++){
+8010322e:	83 c3 01             	add    $0x1,%ebx
+80103231:	39 fb                	cmp    %edi,%ebx
+80103233:	7e d8                	jle    8010320d <ioapicinit+0x54>
+  }
+}
+80103235:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103238:	5b                   	pop    %ebx
+80103239:	5e                   	pop    %esi
+8010323a:	5f                   	pop    %edi
+8010323b:	5d                   	pop    %ebp
+8010323c:	c3                   	ret
+
+8010323d <ioapicenable>:
+
+void
+ioapicenable(int irq, int cpunum)
+{
+8010323d:	55                   	push   %ebp
+8010323e:	89 e5                	mov    %esp,%ebp
+80103240:	53                   	push   %ebx
+80103241:	83 ec 04             	sub    $0x4,%esp
+80103244:	8b 45 08             	mov    0x8(%ebp),%eax
+  // Mark interrupt edge-triggered, active high,
+  // enabled, and routed to the given cpunum,
+  // which happens to be that cpu's APIC ID.
+  ioapicwrite(REG_TABLE+2*irq, T_IRQ0 + irq);
+80103247:	8d 50 20             	lea    0x20(%eax),%edx
+8010324a:	8d 5c 00 10          	lea    0x10(%eax,%eax,1),%ebx
+8010324e:	89 d8                	mov    %ebx,%eax
+80103250:	e8 53 ff ff ff       	call   801031a8 <ioapicwrite>
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+80103255:	8b 55 0c             	mov    0xc(%ebp),%edx
+80103258:	c1 e2 18             	shl    $0x18,%edx
+8010325b:	8d 43 01             	lea    0x1(%ebx),%eax
+8010325e:	e8 45 ff ff ff       	call   801031a8 <ioapicwrite>
+}
+80103263:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103266:	c9                   	leave
+80103267:	c3                   	ret
+
+80103268 <bpush>:
+// Buddy free list operations.  Caller must hold kmem.lock
+// (or be initializing, with use_lock still 0).
+
+static void
+bpush(struct run *r, int o)
+{
+80103268:	55                   	push   %ebp
+80103269:	89 e5                	mov    %esp,%ebp
+8010326b:	53                   	push   %ebx
+  r->prev = 0;
+8010326c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  r->next = kmem.free[o];
+80103273:	8b 0c 95 f8 1b 12 80 	mov    -0x7fede408(,%edx,4),%ecx
+8010327a:	89 08                	mov    %ecx,(%eax)
+  if(r->next)
+8010327c:	85 c9                	test   %ecx,%ecx
+8010327e:	74 03                	je     80103283 <bpush+0x1b>
+    r->next->prev = r;
+80103280:	89 41 04             	mov    %eax,0x4(%ecx)
+  kmem.free[o] = r;
+80103283:	89 04 95 f8 1b 12 80 	mov    %eax,-0x7fede408(,%edx,4)
+  kmem.nblock[o]++;
+8010328a:	8d 5a 18             	lea    0x18(%edx),%ebx
+8010328d:	8b 0c 9d c4 1b 12 80 	mov    -0x7fede43c(,%ebx,4),%ecx
+80103294:	83 c1 01             	add    $0x1,%ecx
+80103297:	89 0c 9d c4 1b 12 80 	mov    %ecx,-0x7fede43c(,%ebx,4)
+  kmem.order[V2P(r)/PGSIZE] = KFREE | o;
+8010329e:	05 00 00 00 80       	add    $0x80000000,%eax
+801032a3:	c1 e8 0c             	shr    $0xc,%eax
+801032a6:	03 05 58 1c 12 80    	add    0x80121c58,%eax
+801032ac:	83 ca 80             	or     $0xffffff80,%edx
+801032af:	88 10                	mov    %dl,(%eax)
+}
+801032b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801032b4:	c9                   	leave
+801032b5:	c3                   	ret
+
+801032b6 <bremove>:
+
+static void
+bremove(struct run *r, int o)
+{
+801032b6:	55                   	push   %ebp
+801032b7:	89 e5                	mov    %esp,%ebp
+801032b9:	53                   	push   %ebx
+  if(r->prev)
+801032ba:	8b 48 04             	mov    0x4(%eax),%ecx
+801032bd:	85 c9                	test   %ecx,%ecx
+801032bf:	74 3a                	je     801032fb <bremove+0x45>
+    r->prev->next = r->next;
+801032c1:	8b 18                	mov    (%eax),%ebx
+801032c3:	89 19                	mov    %ebx,(%ecx)
+  else
+    kmem.free[o] = r->next;
+  if(r->next)
+801032c5:	8b 08                	mov    (%eax),%ecx
+801032c7:	85 c9                	test   %ecx,%ecx
+801032c9:	74 06                	je     801032d1 <bremove+0x1b>
+    r->next->prev = r->prev;
+801032cb:	8b 58 04             	mov    0x4(%eax),%ebx
+801032ce:	89 59 04             	mov    %ebx,0x4(%ecx)
+  kmem.nblock[o]--;
+801032d1:	83 c2 18             	add    $0x18,%edx
+801032d4:	8b 0c 95 c4 1b 12 80 	mov    -0x7fede43c(,%edx,4),%ecx
+801032db:	83 e9 01             	sub    $0x1,%ecx
+801032de:	89 0c 95 c4 1b 12 80 	mov    %ecx,-0x7fede43c(,%edx,4)
+  kmem.order[V2P(r)/PGSIZE] = 0;
+801032e5:	05 00 00 00 80       	add    $0x80000000,%eax
+801032ea:	c1 e8 0c             	shr    $0xc,%eax
+801032ed:	03 05 58 1c 12 80    	add    0x80121c58,%eax
+801032f3:	c6 00 00             	movb   $0x0,(%eax)
+}
+801032f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801032f9:	c9                   	leave
+801032fa:	c3                   	ret
+    kmem.free[o] = r->next;
+801032fb:	8b 08                	mov    (%eax),%ecx
+801032fd:	89 0c 95 f8 1b 12 80 	mov    %ecx,-0x7fede408(,%edx,4)
+80103304:	eb bf                	jmp    801032c5 <bremove+0xf>
+
+80103306 <buddyalloc>:
+
+// Take a block of 2^o pages off the free lists, splitting
+// a larger block if there is no block of that order.
+static struct run*
+buddyalloc(int o)
+{
+80103306:	55                   	push   %ebp
+80103307:	89 e5                	mov    %esp,%ebp
+80103309:	57                   	push   %edi
+8010330a:	56                   	push   %esi
+8010330b:	53                   	push   %ebx
+8010330c:	83 ec 0c             	sub    $0xc,%esp
+8010330f:	89 c6                	mov    %eax,%esi
+  struct run *r;
+  int k;
+
+  for(k = o; k <= MAXORDER && kmem.free[k] == 0; k++)
+80103311:	89 c3                	mov    %eax,%ebx
+80103313:	eb 03                	jmp    80103318 <buddyalloc+0x12>
+80103315:	83 c3 01             	add    $0x1,%ebx
+80103318:	83 fb 0a             	cmp    $0xa,%ebx
+8010331b:	7f 0a                	jg     80103327 <buddyalloc+0x21>
+8010331d:	83 3c 9d f8 1b 12 80 	cmpl   $0x0,-0x7fede408(,%ebx,4)
+80103324:	00 
+80103325:	74 ee                	je     80103315 <buddyalloc+0xf>
+    ;
+  if(k > MAXORDER)
+80103327:	83 fb 0a             	cmp    $0xa,%ebx
+8010332a:	7f 4c                	jg     80103378 <buddyalloc+0x72>
+    return 0;
+  r = kmem.free[k];
+8010332c:	8b 3c 9d f8 1b 12 80 	mov    -0x7fede408(,%ebx,4),%edi
+  bremove(r, k);
+80103333:	89 da                	mov    %ebx,%edx
+80103335:	89 f8                	mov    %edi,%eax
+80103337:	e8 7a ff ff ff       	call   801032b6 <bremove>
+  // Give back the upper half until the block is small enough.
+  while(k > o){
+8010333c:	39 f3                	cmp    %esi,%ebx
+8010333e:	7e 17                	jle    80103357 <buddyalloc+0x51>
+    k--;
+80103340:	83 eb 01             	sub    $0x1,%ebx
+    bpush((struct run*)((char*)r + (PGSIZE << k)), k);
+80103343:	b8 00 10 00 00       	mov    $0x1000,%eax
+80103348:	89 d9                	mov    %ebx,%ecx
+8010334a:	d3 e0                	shl    %cl,%eax
+8010334c:	01 f8                	add    %edi,%eax
+8010334e:	89 da                	mov    %ebx,%edx
+80103350:	e8 13 ff ff ff       	call   80103268 <bpush>
+80103355:	eb e5                	jmp    8010333c <buddyalloc+0x36>
+  }
+  kmem.nfree -= 1 << o;
+80103357:	b8 01 00 00 00       	mov    $0x1,%eax
+8010335c:	89 f1                	mov    %esi,%ecx
+8010335e:	d3 e0                	shl    %cl,%eax
+80103360:	89 c2                	mov    %eax,%edx
+80103362:	a1 50 1c 12 80       	mov    0x80121c50,%eax
+80103367:	29 d0                	sub    %edx,%eax
+80103369:	a3 50 1c 12 80       	mov    %eax,0x80121c50
+  return r;
+}
+8010336e:	89 f8                	mov    %edi,%eax
+80103370:	83 c4 0c             	add    $0xc,%esp
+80103373:	5b                   	pop    %ebx
+80103374:	5e                   	pop    %esi
+80103375:	5f                   	pop    %edi
+80103376:	5d                   	pop    %ebp
+80103377:	c3                   	ret
+    return 0;
+80103378:	bf 00 00 00 00       	mov    $0x0,%edi
+8010337d:	eb ef                	jmp    8010336e <buddyalloc+0x68>
+
+8010337f <buddyfree>:
+
+// Put a block of 2^o pages back, merging it with its buddy
+// for as long as the buddy is free too.
+static void
+buddyfree(struct run *r, int o)
+{
+8010337f:	55                   	push   %ebp
+80103380:	89 e5                	mov    %esp,%ebp
+80103382:	57                   	push   %edi
+80103383:	56                   	push   %esi
+80103384:	53                   	push   %ebx
+80103385:	83 ec 0c             	sub    $0xc,%esp
+80103388:	89 d3                	mov    %edx,%ebx
+  uint i, b;
+
+  kmem.nfree += 1 << o;
+8010338a:	ba 01 00 00 00       	mov    $0x1,%edx
+8010338f:	89 d9                	mov    %ebx,%ecx
+80103391:	d3 e2                	shl    %cl,%edx
+80103393:	01 15 50 1c 12 80    	add    %edx,0x80121c50
+  i = V2P(r)/PGSIZE;
+80103399:	8d b8 00 00 00 80    	lea    -0x80000000(%eax),%edi
+8010339f:	c1 ef 0c             	shr    $0xc,%edi
+  for(; o < MAXORDER; o++){
+801033a2:	eb 03                	jmp    801033a7 <buddyfree+0x28>
+801033a4:	83 c3 01             	add    $0x1,%ebx
+801033a7:	83 fb 09             	cmp    $0x9,%ebx
+801033aa:	7f 3a                	jg     801033e6 <buddyfree+0x67>
+    b = i ^ (1 << o);
+801033ac:	89 fe                	mov    %edi,%esi
+801033ae:	0f bb de             	btc    %ebx,%esi
+    if(b >= phystop/PGSIZE || kmem.order[b] != (KFREE | o))
+801033b1:	a1 60 1c 12 80       	mov    0x80121c60,%eax
+801033b6:	c1 e8 0c             	shr    $0xc,%eax
+801033b9:	39 c6                	cmp    %eax,%esi
+801033bb:	73 29                	jae    801033e6 <buddyfree+0x67>
+801033bd:	a1 58 1c 12 80       	mov    0x80121c58,%eax
+801033c2:	0f b6 14 30          	movzbl (%eax,%esi,1),%edx
+801033c6:	89 d8                	mov    %ebx,%eax
+801033c8:	0c 80                	or     $0x80,%al
+801033ca:	39 c2                	cmp    %eax,%edx
+801033cc:	75 18                	jne    801033e6 <buddyfree+0x67>
+      break;
+    bremove((struct run*)P2V(b*PGSIZE), o);
+801033ce:	8d 86 00 00 08 00    	lea    0x80000(%esi),%eax
+801033d4:	c1 e0 0c             	shl    $0xc,%eax
+801033d7:	89 da                	mov    %ebx,%edx
+801033d9:	e8 d8 fe ff ff       	call   801032b6 <bremove>
+    if(b < i)
+801033de:	39 fe                	cmp    %edi,%esi
+801033e0:	73 c2                	jae    801033a4 <buddyfree+0x25>
+      i = b;
+801033e2:	89 f7                	mov    %esi,%edi
+801033e4:	eb be                	jmp    801033a4 <buddyfree+0x25>
+  }
+  bpush((struct run*)P2V(i*PGSIZE), o);
+801033e6:	8d 87 00 00 08 00    	lea    0x80000(%edi),%eax
+801033ec:	c1 e0 0c             	shl    $0xc,%eax
+801033ef:	89 da                	mov    %ebx,%edx
+801033f1:	e8 72 fe ff ff       	call   80103268 <bpush>
+}
+801033f6:	83 c4 0c             	add    $0xc,%esp
+801033f9:	5b                   	pop    %ebx
+801033fa:	5e                   	pop    %esi
+801033fb:	5f                   	pop    %edi
+801033fc:	5d                   	pop    %ebp
+801033fd:	c3                   	ret
+
+801033fe <kmove>:
+
+// Move up to n pages from list *from to the cache c,
+// whose lock must be held.  Returns the number moved.
+static int
+kmove(struct kcache *c, struct run **from, int n)
+{
+801033fe:	55                   	push   %ebp
+801033ff:	89 e5                	mov    %esp,%ebp
+80103401:	57                   	push   %edi
+80103402:	56                   	push   %esi
+80103403:	53                   	push   %ebx
+80103404:	89 c3                	mov    %eax,%ebx
+80103406:	89 d6                	mov    %edx,%esi
+80103408:	89 cf                	mov    %ecx,%edi
+  struct run *r;
+  int i;
+
+  for(i = 0; i < n && *from; i++){
+8010340a:	ba 00 00 00 00       	mov    $0x0,%edx
+8010340f:	eb 0f                	jmp    80103420 <kmove+0x22>
+    r = *from;
+    *from = r->next;
+80103411:	8b 08                	mov    (%eax),%ecx
+80103413:	89 0e                	mov    %ecx,(%esi)
+    r->next = c->freelist;
+80103415:	8b 4b 34             	mov    0x34(%ebx),%ecx
+80103418:	89 08                	mov    %ecx,(%eax)
+    c->freelist = r;
+8010341a:	89 43 34             	mov    %eax,0x34(%ebx)
+  for(i = 0; i < n && *from; i++){
+8010341d:	83 c2 01             	add    $0x1,%edx
+80103420:	39 fa                	cmp    %edi,%edx
+80103422:	7d 06                	jge    8010342a <kmove+0x2c>
+80103424:	8b 06                	mov    (%esi),%eax
+80103426:	85 c0                	test   %eax,%eax
+80103428:	75 e7                	jne    80103411 <kmove+0x13>
+  }
+  c->n += i;
+8010342a:	01 53 38             	add    %edx,0x38(%ebx)
+  return i;
+}
+8010342d:	89 d0                	mov    %edx,%eax
+8010342f:	5b                   	pop    %ebx
+80103430:	5e                   	pop    %esi
+80103431:	5f                   	pop    %edi
+80103432:	5d                   	pop    %ebp
+80103433:	c3                   	ret
+
+80103434 <kzeroget>:
+}
+
+// Take a page from the pre-zeroed pool, or return 0.
+static char*
+kzeroget(void)
+{
+80103434:	55                   	push   %ebp
+80103435:	89 e5                	mov    %esp,%ebp
+80103437:	53                   	push   %ebx
+80103438:	83 ec 10             	sub    $0x10,%esp
+  struct run *r;
+
+  acquire(&kzero.lock);
+8010343b:	68 e0 18 12 80       	push   $0x801218e0
+80103440:	e8 4d 46 00 00       	call   80107a92 <acquire>
+  r = kzero.freelist;
+80103445:	8b 1d 14 19 12 80    	mov    0x80121914,%ebx
+  if(r){
+8010344b:	83 c4 10             	add    $0x10,%esp
+8010344e:	85 db                	test   %ebx,%ebx
+80103450:	74 14                	je     80103466 <kzeroget+0x32>
+    kzero.freelist = r->next;
+80103452:	8b 03                	mov    (%ebx),%eax
+80103454:	a3 14 19 12 80       	mov    %eax,0x80121914
+    kzero.n--;
+80103459:	a1 18 19 12 80       	mov    0x80121918,%eax
+8010345e:	83 e8 01             	sub    $0x1,%eax
+80103461:	a3 18 19 12 80       	mov    %eax,0x80121918
+  }
+  release(&kzero.lock);
+80103466:	83 ec 0c             	sub    $0xc,%esp
+80103469:	68 e0 18 12 80       	push   $0x801218e0
+8010346e:	e8 84 46 00 00       	call   80107af7 <release>
+  if(r)
+80103473:	83 c4 10             	add    $0x10,%esp
+80103476:	85 db                	test   %ebx,%ebx
+80103478:	74 06                	je     80103480 <kzeroget+0x4c>
+    r->next = 0;
+8010347a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  return (char*)r;
+}
+80103480:	89 d8                	mov    %ebx,%eax
+80103482:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103485:	c9                   	leave
+80103486:	c3                   	ret
+
+80103487 <kdrainall>:
+{
+80103487:	55                   	push   %ebp
+80103488:	89 e5                	mov    %esp,%ebp
+8010348a:	57                   	push   %edi
+8010348b:	56                   	push   %esi
+8010348c:	53                   	push   %ebx
+8010348d:	83 ec 0c             	sub    $0xc,%esp
+  for(c = kcache; c < &kcache[ncpu]; c++){
+80103490:	bf 40 19 12 80       	mov    $0x80121940,%edi
+80103495:	eb 27                	jmp    801034be <kdrainall+0x37>
+      next = r->next;
+80103497:	8b 33                	mov    (%ebx),%esi
+      buddyfree(r, 0);
+80103499:	ba 00 00 00 00       	mov    $0x0,%edx
+8010349e:	89 d8                	mov    %ebx,%eax
+801034a0:	e8 da fe ff ff       	call   8010337f <buddyfree>
+    for(; r; r = next){
+801034a5:	89 f3                	mov    %esi,%ebx
+801034a7:	85 db                	test   %ebx,%ebx
+801034a9:	75 ec                	jne    80103497 <kdrainall+0x10>
+    release(&kmem.lock);
+801034ab:	83 ec 0c             	sub    $0xc,%esp
+801034ae:	68 c0 1b 12 80       	push   $0x80121bc0
+801034b3:	e8 3f 46 00 00       	call   80107af7 <release>
+  for(c = kcache; c < &kcache[ncpu]; c++){
+801034b8:	83 c7 50             	add    $0x50,%edi
+801034bb:	83 c4 10             	add    $0x10,%esp
+801034be:	a1 64 1e 12 80       	mov    0x80121e64,%eax
+801034c3:	8d 14 80             	lea    (%eax,%eax,4),%edx
+801034c6:	89 d0                	mov    %edx,%eax
+801034c8:	c1 e0 04             	shl    $0x4,%eax
+801034cb:	05 40 19 12 80       	add    $0x80121940,%eax
+801034d0:	39 c7                	cmp    %eax,%edi
+801034d2:	73 33                	jae    80103507 <kdrainall+0x80>
+    acquire(&c->lock);
+801034d4:	83 ec 0c             	sub    $0xc,%esp
+801034d7:	57                   	push   %edi
+801034d8:	e8 b5 45 00 00       	call   80107a92 <acquire>
+    r = c->freelist;
+801034dd:	8b 5f 34             	mov    0x34(%edi),%ebx
+    c->freelist = 0;
+801034e0:	c7 47 34 00 00 00 00 	movl   $0x0,0x34(%edi)
+    c->n = 0;
+801034e7:	c7 47 38 00 00 00 00 	movl   $0x0,0x38(%edi)
+    release(&c->lock);
+801034ee:	89 3c 24             	mov    %edi,(%esp)
+801034f1:	e8 01 46 00 00       	call   80107af7 <release>
+    acquire(&kmem.lock);
+801034f6:	c7 04 24 c0 1b 12 80 	movl   $0x80121bc0,(%esp)
+801034fd:	e8 90 45 00 00       	call   80107a92 <acquire>
+    for(; r; r = next){
+80103502:	83 c4 10             	add    $0x10,%esp
+80103505:	eb a0                	jmp    801034a7 <kdrainall+0x20>
+}
+80103507:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010350a:	5b                   	pop    %ebx
+8010350b:	5e                   	pop    %esi
+8010350c:	5f                   	pop    %edi
+8010350d:	5d                   	pop    %ebp
+8010350e:	c3                   	ret
+
+8010350f <kfree>:
+{
+8010350f:	55                   	push   %ebp
+80103510:	89 e5                	mov    %esp,%ebp
+80103512:	57                   	push   %edi
+80103513:	56                   	push   %esi
+80103514:	53                   	push   %ebx
+80103515:	83 ec 0c             	sub    $0xc,%esp
+80103518:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((uint)v % PGSIZE || v < end || V2P(v) >= phystop)
+8010351b:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+80103521:	0f 85 c4 00 00 00    	jne    801035eb <kfree+0xdc>
+80103527:	81 fb 70 67 13 80    	cmp    $0x80136770,%ebx
+8010352d:	0f 82 b8 00 00 00    	jb     801035eb <kfree+0xdc>
+80103533:	8d b3 00 00 00 80    	lea    -0x80000000(%ebx),%esi
+80103539:	3b 35 60 1c 12 80    	cmp    0x80121c60,%esi
+8010353f:	0f 83 a6 00 00 00    	jae    801035eb <kfree+0xdc>
+  ref = &kmem.ref[V2P(v)/PGSIZE];
+80103545:	c1 ee 0c             	shr    $0xc,%esi
+80103548:	01 f6                	add    %esi,%esi
+8010354a:	03 35 5c 1c 12 80    	add    0x80121c5c,%esi
+  if(*ref > 1){
+80103550:	66 83 3e 01          	cmpw   $0x1,(%esi)
+80103554:	76 27                	jbe    8010357d <kfree+0x6e>
+    if(kmem.use_lock)
+80103556:	83 3d f4 1b 12 80 00 	cmpl   $0x0,0x80121bf4
+8010355d:	0f 85 95 00 00 00    	jne    801035f8 <kfree+0xe9>
+    if(*ref > 1){
+80103563:	0f b7 06             	movzwl (%esi),%eax
+80103566:	66 83 f8 01          	cmp    $0x1,%ax
+8010356a:	0f 87 9d 00 00 00    	ja     8010360d <kfree+0xfe>
+    if(kmem.use_lock)
+80103570:	83 3d f4 1b 12 80 00 	cmpl   $0x0,0x80121bf4
+80103577:	0f 85 b1 00 00 00    	jne    8010362e <kfree+0x11f>
+  *ref = 0;
+8010357d:	66 c7 06 00 00       	movw   $0x0,(%esi)
+  if(!kmem.use_lock){
+80103582:	83 3d f4 1b 12 80 00 	cmpl   $0x0,0x80121bf4
+80103589:	0f 84 b4 00 00 00    	je     80103643 <kfree+0x134>
+  pushcli();
+8010358f:	e8 1b 44 00 00       	call   801079af <pushcli>
+  c = &kcache[cpuid()];
+80103594:	e8 57 27 00 00       	call   80105cf0 <cpuid>
+80103599:	89 c6                	mov    %eax,%esi
+  acquire(&c->lock);
+8010359b:	8d 3c 80             	lea    (%eax,%eax,4),%edi
+8010359e:	c1 e7 04             	shl    $0x4,%edi
+801035a1:	81 c7 40 19 12 80    	add    $0x80121940,%edi
+801035a7:	83 ec 0c             	sub    $0xc,%esp
+801035aa:	57                   	push   %edi
+801035ab:	e8 e2 44 00 00       	call   80107a92 <acquire>
+  r->next = c->freelist;
+801035b0:	8b 47 34             	mov    0x34(%edi),%eax
+801035b3:	89 03                	mov    %eax,(%ebx)
+  c->freelist = r;
+801035b5:	89 5f 34             	mov    %ebx,0x34(%edi)
+  c->n++;
+801035b8:	8b 47 38             	mov    0x38(%edi),%eax
+801035bb:	83 c0 01             	add    $0x1,%eax
+801035be:	89 47 38             	mov    %eax,0x38(%edi)
+  c->frees++;
+801035c1:	8b 4f 44             	mov    0x44(%edi),%ecx
+801035c4:	8d 51 01             	lea    0x1(%ecx),%edx
+801035c7:	89 57 44             	mov    %edx,0x44(%edi)
+  if(c->n >= KCACHE){
+801035ca:	83 c4 10             	add    $0x10,%esp
+801035cd:	83 f8 3f             	cmp    $0x3f,%eax
+801035d0:	7f 7f                	jg     80103651 <kfree+0x142>
+  release(&c->lock);
+801035d2:	83 ec 0c             	sub    $0xc,%esp
+801035d5:	57                   	push   %edi
+801035d6:	e8 1c 45 00 00       	call   80107af7 <release>
+  popcli();
+801035db:	e8 13 44 00 00       	call   801079f3 <popcli>
+801035e0:	83 c4 10             	add    $0x10,%esp
+}
+801035e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801035e6:	5b                   	pop    %ebx
+801035e7:	5e                   	pop    %esi
+801035e8:	5f                   	pop    %edi
+801035e9:	5d                   	pop    %ebp
+801035ea:	c3                   	ret
+    panic("kfree");
+801035eb:	83 ec 0c             	sub    $0xc,%esp
+801035ee:	68 3e bc 10 80       	push   $0x8010bc3e
+801035f3:	e8 33 d7 ff ff       	call   80100d2b <panic>
+      acquire(&kmem.lock);
+801035f8:	83 ec 0c             	sub    $0xc,%esp
+801035fb:	68 c0 1b 12 80       	push   $0x80121bc0
+80103600:	e8 8d 44 00 00       	call   80107a92 <acquire>
+80103605:	83 c4 10             	add    $0x10,%esp
+80103608:	e9 56 ff ff ff       	jmp    80103563 <kfree+0x54>
+      (*ref)--;
+8010360d:	83 e8 01             	sub    $0x1,%eax
+80103610:	66 89 06             	mov    %ax,(%esi)
+      if(kmem.use_lock)
+80103613:	83 3d f4 1b 12 80 00 	cmpl   $0x0,0x80121bf4
+8010361a:	74 c7                	je     801035e3 <kfree+0xd4>
+        release(&kmem.lock);
+8010361c:	83 ec 0c             	sub    $0xc,%esp
+8010361f:	68 c0 1b 12 80       	push   $0x80121bc0
+80103624:	e8 ce 44 00 00       	call   80107af7 <release>
+80103629:	83 c4 10             	add    $0x10,%esp
+      return;
+8010362c:	eb b5                	jmp    801035e3 <kfree+0xd4>
+      release(&kmem.lock);
+8010362e:	83 ec 0c             	sub    $0xc,%esp
+80103631:	68 c0 1b 12 80       	push   $0x80121bc0
+80103636:	e8 bc 44 00 00       	call   80107af7 <release>
+8010363b:	83 c4 10             	add    $0x10,%esp
+8010363e:	e9 3a ff ff ff       	jmp    8010357d <kfree+0x6e>
+    buddyfree(r, 0);
+80103643:	ba 00 00 00 00       	mov    $0x0,%edx
+80103648:	89 d8                	mov    %ebx,%eax
+8010364a:	e8 30 fd ff ff       	call   8010337f <buddyfree>
+    return;
+8010364f:	eb 92                	jmp    801035e3 <kfree+0xd4>
+    acquire(&kmem.lock);
+80103651:	83 ec 0c             	sub    $0xc,%esp
+80103654:	68 c0 1b 12 80       	push   $0x80121bc0
+80103659:	e8 34 44 00 00       	call   80107a92 <acquire>
+    for(i = 0; i < KBATCH; i++){
+8010365e:	83 c4 10             	add    $0x10,%esp
+80103661:	bb 00 00 00 00       	mov    $0x0,%ebx
+80103666:	eb 23                	jmp    8010368b <kfree+0x17c>
+      r = c->freelist;
+80103668:	8d 04 b6             	lea    (%esi,%esi,4),%eax
+8010366b:	c1 e0 04             	shl    $0x4,%eax
+8010366e:	8b 88 74 19 12 80    	mov    -0x7fede68c(%eax),%ecx
+      c->freelist = r->next;
+80103674:	8b 11                	mov    (%ecx),%edx
+80103676:	89 90 74 19 12 80    	mov    %edx,-0x7fede68c(%eax)
+      buddyfree(r, 0);
+8010367c:	ba 00 00 00 00       	mov    $0x0,%edx
+80103681:	89 c8                	mov    %ecx,%eax
+80103683:	e8 f7 fc ff ff       	call   8010337f <buddyfree>
+    for(i = 0; i < KBATCH; i++){
+80103688:	83 c3 01             	add    $0x1,%ebx
+8010368b:	83 fb 1f             	cmp    $0x1f,%ebx
+8010368e:	7e d8                	jle    80103668 <kfree+0x159>
+    release(&kmem.lock);
+80103690:	83 ec 0c             	sub    $0xc,%esp
+80103693:	68 c0 1b 12 80       	push   $0x80121bc0
+80103698:	e8 5a 44 00 00       	call   80107af7 <release>
+    c->n -= KBATCH;
+8010369d:	8d 14 b5 00 00 00 00 	lea    0x0(,%esi,4),%edx
+801036a4:	8d 04 32             	lea    (%edx,%esi,1),%eax
+801036a7:	c1 e0 04             	shl    $0x4,%eax
+801036aa:	8b 98 78 19 12 80    	mov    -0x7fede688(%eax),%ebx
+801036b0:	8d 4b e0             	lea    -0x20(%ebx),%ecx
+801036b3:	89 88 78 19 12 80    	mov    %ecx,-0x7fede688(%eax)
+801036b9:	05 40 19 12 80       	add    $0x80121940,%eax
+    c->drains++;
+801036be:	8b 40 4c             	mov    0x4c(%eax),%eax
+801036c1:	01 f2                	add    %esi,%edx
+801036c3:	c1 e2 04             	shl    $0x4,%edx
+801036c6:	83 c0 01             	add    $0x1,%eax
+801036c9:	89 82 8c 19 12 80    	mov    %eax,-0x7fede674(%edx)
+801036cf:	83 c4 10             	add    $0x10,%esp
+801036d2:	e9 fb fe ff ff       	jmp    801035d2 <kfree+0xc3>
+
+801036d7 <freerange>:
+{
+801036d7:	55                   	push   %ebp
+801036d8:	89 e5                	mov    %esp,%ebp
+801036da:	56                   	push   %esi
+801036db:	53                   	push   %ebx
+801036dc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  p = (char*)PGROUNDUP((uint)vstart);
+801036df:	8b 45 08             	mov    0x8(%ebp),%eax
+801036e2:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+801036e8:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+801036ee:	eb 1b                	jmp    8010370b <freerange+0x34>
+    kmem.npage++;
+801036f0:	a1 54 1c 12 80       	mov    0x80121c54,%eax
+801036f5:	83 c0 01             	add    $0x1,%eax
+801036f8:	a3 54 1c 12 80       	mov    %eax,0x80121c54
+    kfree(p);
+801036fd:	83 ec 0c             	sub    $0xc,%esp
+80103700:	52                   	push   %edx
+80103701:	e8 09 fe ff ff       	call   8010350f <kfree>
+80103706:	83 c4 10             	add    $0x10,%esp
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80103709:	89 da                	mov    %ebx,%edx
+8010370b:	8d 9a 00 10 00 00    	lea    0x1000(%edx),%ebx
+80103711:	39 de                	cmp    %ebx,%esi
+80103713:	73 db                	jae    801036f0 <freerange+0x19>
+}
+80103715:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103718:	5b                   	pop    %ebx
+80103719:	5e                   	pop    %esi
+8010371a:	5d                   	pop    %ebp
+8010371b:	c3                   	ret
+
+8010371c <kinit1>:
+{
+8010371c:	55                   	push   %ebp
+8010371d:	89 e5                	mov    %esp,%ebp
+8010371f:	57                   	push   %edi
+80103720:	56                   	push   %esi
+80103721:	53                   	push   %ebx
+80103722:	83 ec 0c             	sub    $0xc,%esp
+80103725:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80103728:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  phystop = PGROUNDDOWN(cmosmemtop());
+8010372b:	e8 d7 0a 00 00       	call   80104207 <cmosmemtop>
+80103730:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+80103735:	a3 60 1c 12 80       	mov    %eax,0x80121c60
+  if(phystop > PHYSMAX)
+8010373a:	3d 00 00 00 7e       	cmp    $0x7e000000,%eax
+8010373f:	76 0a                	jbe    8010374b <kinit1+0x2f>
+    phystop = PHYSMAX;
+80103741:	c7 05 60 1c 12 80 00 	movl   $0x7e000000,0x80121c60
+80103748:	00 00 7e 
+  if(phystop < V2P(vend))
+8010374b:	8d 97 00 00 00 80    	lea    -0x80000000(%edi),%edx
+80103751:	a1 60 1c 12 80       	mov    0x80121c60,%eax
+80103756:	39 d0                	cmp    %edx,%eax
+80103758:	72 55                	jb     801037af <kinit1+0x93>
+  n = phystop / PGSIZE;
+8010375a:	c1 e8 0c             	shr    $0xc,%eax
+  kmem.ref = (ushort*)vstart;
+8010375d:	89 1d 5c 1c 12 80    	mov    %ebx,0x80121c5c
+  kmem.order = (uchar*)(kmem.ref + n);
+80103763:	8d 34 43             	lea    (%ebx,%eax,2),%esi
+80103766:	89 35 58 1c 12 80    	mov    %esi,0x80121c58
+  vstart = kmem.order + n;
+8010376c:	01 c6                	add    %eax,%esi
+  if(vstart >= vend)
+8010376e:	39 fe                	cmp    %edi,%esi
+80103770:	73 4a                	jae    801037bc <kinit1+0xa0>
+  memset(kmem.ref, 0, n*sizeof(kmem.ref[0]) + n*sizeof(kmem.order[0]));
+80103772:	83 ec 04             	sub    $0x4,%esp
+80103775:	8d 04 40             	lea    (%eax,%eax,2),%eax
+80103778:	50                   	push   %eax
+80103779:	6a 00                	push   $0x0
+8010377b:	53                   	push   %ebx
+8010377c:	e8 bd 43 00 00       	call   80107b3e <memset>
+  initlock(&kmem.lock, "kmem");
+80103781:	83 c4 08             	add    $0x8,%esp
+80103784:	68 72 bc 10 80       	push   $0x8010bc72
+80103789:	68 c0 1b 12 80       	push   $0x80121bc0
+8010378e:	e8 bb 41 00 00       	call   8010794e <initlock>
+  initlock(&kzero.lock, "kzero");
+80103793:	83 c4 08             	add    $0x8,%esp
+80103796:	68 77 bc 10 80       	push   $0x8010bc77
+8010379b:	68 e0 18 12 80       	push   $0x801218e0
+801037a0:	e8 a9 41 00 00       	call   8010794e <initlock>
+  for(c = kcache; c < &kcache[NCPU]; c++)
+801037a5:	83 c4 10             	add    $0x10,%esp
+801037a8:	bb 40 19 12 80       	mov    $0x80121940,%ebx
+801037ad:	eb 2e                	jmp    801037dd <kinit1+0xc1>
+    panic("kinit1: not enough memory");
+801037af:	83 ec 0c             	sub    $0xc,%esp
+801037b2:	68 44 bc 10 80       	push   $0x8010bc44
+801037b7:	e8 6f d5 ff ff       	call   80100d2b <panic>
+    panic("kinit1: page arrays");
+801037bc:	83 ec 0c             	sub    $0xc,%esp
+801037bf:	68 5e bc 10 80       	push   $0x8010bc5e
+801037c4:	e8 62 d5 ff ff       	call   80100d2b <panic>
+    initlock(&c->lock, "kcache");
+801037c9:	83 ec 08             	sub    $0x8,%esp
+801037cc:	68 7d bc 10 80       	push   $0x8010bc7d
+801037d1:	53                   	push   %ebx
+801037d2:	e8 77 41 00 00       	call   8010794e <initlock>
+  for(c = kcache; c < &kcache[NCPU]; c++)
+801037d7:	83 c3 50             	add    $0x50,%ebx
+801037da:	83 c4 10             	add    $0x10,%esp
+801037dd:	81 fb c0 1b 12 80    	cmp    $0x80121bc0,%ebx
+801037e3:	72 e4                	jb     801037c9 <kinit1+0xad>
+  kmem.use_lock = 0;
+801037e5:	c7 05 f4 1b 12 80 00 	movl   $0x0,0x80121bf4
+801037ec:	00 00 00 
+  freerange(vstart, vend);
+801037ef:	83 ec 08             	sub    $0x8,%esp
+801037f2:	57                   	push   %edi
+801037f3:	56                   	push   %esi
+801037f4:	e8 de fe ff ff       	call   801036d7 <freerange>
+}
+801037f9:	83 c4 10             	add    $0x10,%esp
+801037fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801037ff:	5b                   	pop    %ebx
+80103800:	5e                   	pop    %esi
+80103801:	5f                   	pop    %edi
+80103802:	5d                   	pop    %ebp
+80103803:	c3                   	ret
+
+80103804 <kinit2>:
+{
+80103804:	55                   	push   %ebp
+80103805:	89 e5                	mov    %esp,%ebp
+80103807:	83 ec 10             	sub    $0x10,%esp
+  freerange(vstart, vend);
+8010380a:	ff 75 0c             	push   0xc(%ebp)
+8010380d:	ff 75 08             	push   0x8(%ebp)
+80103810:	e8 c2 fe ff ff       	call   801036d7 <freerange>
+  kmem.use_lock = 1;
+80103815:	c7 05 f4 1b 12 80 01 	movl   $0x1,0x80121bf4
+8010381c:	00 00 00 
+}
+8010381f:	83 c4 10             	add    $0x10,%esp
+80103822:	c9                   	leave
+80103823:	c3                   	ret
+
+80103824 <kalloc>:
+{
+80103824:	55                   	push   %ebp
+80103825:	89 e5                	mov    %esp,%ebp
+80103827:	57                   	push   %edi
+80103828:	56                   	push   %esi
+80103829:	53                   	push   %ebx
+8010382a:	83 ec 2c             	sub    $0x2c,%esp
+  if(!kmem.use_lock){
+8010382d:	83 3d f4 1b 12 80 00 	cmpl   $0x0,0x80121bf4
+80103834:	0f 84 cd 00 00 00    	je     80103907 <kalloc+0xe3>
+  pushcli();
+8010383a:	e8 70 41 00 00       	call   801079af <pushcli>
+  c = &kcache[cpuid()];
+8010383f:	e8 ac 24 00 00       	call   80105cf0 <cpuid>
+80103844:	89 c6                	mov    %eax,%esi
+80103846:	8d 3c 80             	lea    (%eax,%eax,4),%edi
+80103849:	c1 e7 04             	shl    $0x4,%edi
+8010384c:	81 c7 40 19 12 80    	add    $0x80121940,%edi
+  acquire(&c->lock);
+80103852:	83 ec 0c             	sub    $0xc,%esp
+80103855:	57                   	push   %edi
+80103856:	e8 37 42 00 00       	call   80107a92 <acquire>
+  c->allocs++;
+8010385b:	8b 47 3c             	mov    0x3c(%edi),%eax
+8010385e:	83 c0 01             	add    $0x1,%eax
+80103861:	89 47 3c             	mov    %eax,0x3c(%edi)
+  if(c->n > 0)
+80103864:	83 c4 10             	add    $0x10,%esp
+80103867:	83 7f 38 00          	cmpl   $0x0,0x38(%edi)
+8010386b:	0f 8e c1 00 00 00    	jle    80103932 <kalloc+0x10e>
+    c->hits++;
+80103871:	8b 4f 40             	mov    0x40(%edi),%ecx
+80103874:	8d 51 01             	lea    0x1(%ecx),%edx
+80103877:	89 57 40             	mov    %edx,0x40(%edi)
+  if(c->n == 0){
+8010387a:	8d 04 b6             	lea    (%esi,%esi,4),%eax
+8010387d:	c1 e0 04             	shl    $0x4,%eax
+80103880:	83 b8 78 19 12 80 00 	cmpl   $0x0,-0x7fede688(%eax)
+80103887:	0f 84 2d 01 00 00    	je     801039ba <kalloc+0x196>
+  r = c->freelist;
+8010388d:	8d 04 b6             	lea    (%esi,%esi,4),%eax
+80103890:	c1 e0 04             	shl    $0x4,%eax
+80103893:	8b 80 74 19 12 80    	mov    -0x7fede68c(%eax),%eax
+80103899:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(r){
+8010389c:	85 c0                	test   %eax,%eax
+8010389e:	74 41                	je     801038e1 <kalloc+0xbd>
+    c->freelist = r->next;
+801038a0:	8b 18                	mov    (%eax),%ebx
+801038a2:	8d 14 b5 00 00 00 00 	lea    0x0(,%esi,4),%edx
+801038a9:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+801038ac:	c1 e1 04             	shl    $0x4,%ecx
+801038af:	89 99 74 19 12 80    	mov    %ebx,-0x7fede68c(%ecx)
+801038b5:	81 c1 40 19 12 80    	add    $0x80121940,%ecx
+    c->n--;
+801038bb:	8b 49 38             	mov    0x38(%ecx),%ecx
+801038be:	01 f2                	add    %esi,%edx
+801038c0:	c1 e2 04             	shl    $0x4,%edx
+801038c3:	83 e9 01             	sub    $0x1,%ecx
+801038c6:	89 8a 78 19 12 80    	mov    %ecx,-0x7fede688(%edx)
+    kmem.ref[V2P(r)/PGSIZE] = 1;
+801038cc:	05 00 00 00 80       	add    $0x80000000,%eax
+801038d1:	c1 e8 0c             	shr    $0xc,%eax
+801038d4:	01 c0                	add    %eax,%eax
+801038d6:	03 05 5c 1c 12 80    	add    0x80121c5c,%eax
+801038dc:	66 c7 00 01 00       	movw   $0x1,(%eax)
+  release(&c->lock);
+801038e1:	83 ec 0c             	sub    $0xc,%esp
+801038e4:	57                   	push   %edi
+801038e5:	e8 0d 42 00 00       	call   80107af7 <release>
+  popcli();
+801038ea:	e8 04 41 00 00       	call   801079f3 <popcli>
+  if(r == 0)
+801038ef:	83 c4 10             	add    $0x10,%esp
+801038f2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+801038f6:	0f 84 69 01 00 00    	je     80103a65 <kalloc+0x241>
+  return (char*)r;
+801038fc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+}
+801038ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103902:	5b                   	pop    %ebx
+80103903:	5e                   	pop    %esi
+80103904:	5f                   	pop    %edi
+80103905:	5d                   	pop    %ebp
+80103906:	c3                   	ret
+    if((r = buddyalloc(0)) != 0)
+80103907:	b8 00 00 00 00       	mov    $0x0,%eax
+8010390c:	e8 f5 f9 ff ff       	call   80103306 <buddyalloc>
+80103911:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80103914:	85 c0                	test   %eax,%eax
+80103916:	74 15                	je     8010392d <kalloc+0x109>
+      kmem.ref[V2P(r)/PGSIZE] = 1;
+80103918:	05 00 00 00 80       	add    $0x80000000,%eax
+8010391d:	c1 e8 0c             	shr    $0xc,%eax
+80103920:	01 c0                	add    %eax,%eax
+80103922:	03 05 5c 1c 12 80    	add    0x80121c5c,%eax
+80103928:	66 c7 00 01 00       	movw   $0x1,(%eax)
+    return (char*)r;
+8010392d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80103930:	eb cd                	jmp    801038ff <kalloc+0xdb>
+    acquire(&kmem.lock);
+80103932:	83 ec 0c             	sub    $0xc,%esp
+80103935:	68 c0 1b 12 80       	push   $0x80121bc0
+8010393a:	e8 53 41 00 00       	call   80107a92 <acquire>
+    for(i = 0; i < KBATCH && (r = buddyalloc(0)) != 0; i++){
+8010393f:	83 c4 10             	add    $0x10,%esp
+80103942:	bb 00 00 00 00       	mov    $0x0,%ebx
+80103947:	83 fb 1f             	cmp    $0x1f,%ebx
+8010394a:	7f 2f                	jg     8010397b <kalloc+0x157>
+8010394c:	b8 00 00 00 00       	mov    $0x0,%eax
+80103951:	e8 b0 f9 ff ff       	call   80103306 <buddyalloc>
+80103956:	89 c2                	mov    %eax,%edx
+80103958:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010395b:	85 c0                	test   %eax,%eax
+8010395d:	74 1c                	je     8010397b <kalloc+0x157>
+      r->next = c->freelist;
+8010395f:	8d 04 b6             	lea    (%esi,%esi,4),%eax
+80103962:	c1 e0 04             	shl    $0x4,%eax
+80103965:	8b 88 74 19 12 80    	mov    -0x7fede68c(%eax),%ecx
+8010396b:	89 0a                	mov    %ecx,(%edx)
+      c->freelist = r;
+8010396d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80103970:	89 90 74 19 12 80    	mov    %edx,-0x7fede68c(%eax)
+    for(i = 0; i < KBATCH && (r = buddyalloc(0)) != 0; i++){
+80103976:	83 c3 01             	add    $0x1,%ebx
+80103979:	eb cc                	jmp    80103947 <kalloc+0x123>
+    c->n += i;
+8010397b:	8d 04 b6             	lea    (%esi,%esi,4),%eax
+8010397e:	c1 e0 04             	shl    $0x4,%eax
+80103981:	8d 88 40 19 12 80    	lea    -0x7fede6c0(%eax),%ecx
+80103987:	03 98 78 19 12 80    	add    -0x7fede688(%eax),%ebx
+8010398d:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+80103990:	89 98 78 19 12 80    	mov    %ebx,-0x7fede688(%eax)
+    release(&kmem.lock);
+80103996:	83 ec 0c             	sub    $0xc,%esp
+80103999:	68 c0 1b 12 80       	push   $0x80121bc0
+8010399e:	e8 54 41 00 00       	call   80107af7 <release>
+    c->refills++;
+801039a3:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+801039a6:	8b 41 48             	mov    0x48(%ecx),%eax
+801039a9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+801039ac:	83 c0 01             	add    $0x1,%eax
+801039af:	89 41 48             	mov    %eax,0x48(%ecx)
+801039b2:	83 c4 10             	add    $0x10,%esp
+801039b5:	e9 c0 fe ff ff       	jmp    8010387a <kalloc+0x56>
+    release(&c->lock);
+801039ba:	83 ec 0c             	sub    $0xc,%esp
+801039bd:	57                   	push   %edi
+801039be:	e8 34 41 00 00       	call   80107af7 <release>
+    for(o = kcache; o < &kcache[ncpu]; o++){
+801039c3:	83 c4 10             	add    $0x10,%esp
+801039c6:	bb 40 19 12 80       	mov    $0x80121940,%ebx
+801039cb:	eb 10                	jmp    801039dd <kalloc+0x1b9>
+          panic("kalloc: steal");
+801039cd:	83 ec 0c             	sub    $0xc,%esp
+801039d0:	68 84 bc 10 80       	push   $0x8010bc84
+801039d5:	e8 51 d3 ff ff       	call   80100d2b <panic>
+    for(o = kcache; o < &kcache[ncpu]; o++){
+801039da:	83 c3 50             	add    $0x50,%ebx
+801039dd:	a1 64 1e 12 80       	mov    0x80121e64,%eax
+801039e2:	8d 04 80             	lea    (%eax,%eax,4),%eax
+801039e5:	c1 e0 04             	shl    $0x4,%eax
+801039e8:	05 40 19 12 80       	add    $0x80121940,%eax
+801039ed:	39 c3                	cmp    %eax,%ebx
+801039ef:	73 63                	jae    80103a54 <kalloc+0x230>
+      if(o == c)
+801039f1:	39 fb                	cmp    %edi,%ebx
+801039f3:	74 e5                	je     801039da <kalloc+0x1b6>
+      acquire(&o->lock);
+801039f5:	83 ec 0c             	sub    $0xc,%esp
+801039f8:	53                   	push   %ebx
+801039f9:	e8 94 40 00 00       	call   80107a92 <acquire>
+      n = o->n;
+801039fe:	8b 43 38             	mov    0x38(%ebx),%eax
+80103a01:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+      o->n = 0;
+80103a04:	c7 43 38 00 00 00 00 	movl   $0x0,0x38(%ebx)
+      r = o->freelist;
+80103a0b:	8b 43 34             	mov    0x34(%ebx),%eax
+80103a0e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      o->freelist = 0;
+80103a11:	c7 43 34 00 00 00 00 	movl   $0x0,0x34(%ebx)
+      release(&o->lock);
+80103a18:	89 1c 24             	mov    %ebx,(%esp)
+80103a1b:	e8 d7 40 00 00       	call   80107af7 <release>
+      if(n > 0){
+80103a20:	83 c4 10             	add    $0x10,%esp
+80103a23:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+80103a27:	7e b1                	jle    801039da <kalloc+0x1b6>
+        acquire(&c->lock);
+80103a29:	83 ec 0c             	sub    $0xc,%esp
+80103a2c:	57                   	push   %edi
+80103a2d:	e8 60 40 00 00       	call   80107a92 <acquire>
+        if(kmove(c, &r, n) != n)
+80103a32:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+80103a35:	89 d9                	mov    %ebx,%ecx
+80103a37:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+80103a3a:	89 f8                	mov    %edi,%eax
+80103a3c:	e8 bd f9 ff ff       	call   801033fe <kmove>
+80103a41:	83 c4 10             	add    $0x10,%esp
+80103a44:	39 d8                	cmp    %ebx,%eax
+80103a46:	75 85                	jne    801039cd <kalloc+0x1a9>
+        release(&c->lock);
+80103a48:	83 ec 0c             	sub    $0xc,%esp
+80103a4b:	57                   	push   %edi
+80103a4c:	e8 a6 40 00 00       	call   80107af7 <release>
+        break;
+80103a51:	83 c4 10             	add    $0x10,%esp
+    acquire(&c->lock);
+80103a54:	83 ec 0c             	sub    $0xc,%esp
+80103a57:	57                   	push   %edi
+80103a58:	e8 35 40 00 00       	call   80107a92 <acquire>
+80103a5d:	83 c4 10             	add    $0x10,%esp
+80103a60:	e9 28 fe ff ff       	jmp    8010388d <kalloc+0x69>
+    r = (struct run*)kzeroget();
+80103a65:	e8 ca f9 ff ff       	call   80103434 <kzeroget>
+80103a6a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80103a6d:	e9 8a fe ff ff       	jmp    801038fc <kalloc+0xd8>
+
+80103a72 <kalloc_order>:
+{
+80103a72:	55                   	push   %ebp
+80103a73:	89 e5                	mov    %esp,%ebp
+80103a75:	57                   	push   %edi
+80103a76:	56                   	push   %esi
+80103a77:	53                   	push   %ebx
+80103a78:	83 ec 0c             	sub    $0xc,%esp
+80103a7b:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(order < 0 || order > MAXORDER)
+80103a7e:	83 fe 0a             	cmp    $0xa,%esi
+80103a81:	0f 87 9c 00 00 00    	ja     80103b23 <kalloc_order+0xb1>
+  if(order == 0)
+80103a87:	85 f6                	test   %esi,%esi
+80103a89:	74 0c                	je     80103a97 <kalloc_order+0x25>
+  for(tries = 0; tries < 2 && r == 0; tries++){
+80103a8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  r = 0;
+80103a90:	bb 00 00 00 00       	mov    $0x0,%ebx
+80103a95:	eb 36                	jmp    80103acd <kalloc_order+0x5b>
+    return kalloc();
+80103a97:	e8 88 fd ff ff       	call   80103824 <kalloc>
+80103a9c:	89 c3                	mov    %eax,%ebx
+80103a9e:	eb 79                	jmp    80103b19 <kalloc_order+0xa7>
+      kdrainall();
+80103aa0:	e8 e2 f9 ff ff       	call   80103487 <kdrainall>
+    acquire(&kmem.lock);
+80103aa5:	83 ec 0c             	sub    $0xc,%esp
+80103aa8:	68 c0 1b 12 80       	push   $0x80121bc0
+80103aad:	e8 e0 3f 00 00       	call   80107a92 <acquire>
+    r = buddyalloc(order);
+80103ab2:	89 f0                	mov    %esi,%eax
+80103ab4:	e8 4d f8 ff ff       	call   80103306 <buddyalloc>
+80103ab9:	89 c3                	mov    %eax,%ebx
+    release(&kmem.lock);
+80103abb:	c7 04 24 c0 1b 12 80 	movl   $0x80121bc0,(%esp)
+80103ac2:	e8 30 40 00 00       	call   80107af7 <release>
+  for(tries = 0; tries < 2 && r == 0; tries++){
+80103ac7:	83 c7 01             	add    $0x1,%edi
+80103aca:	83 c4 10             	add    $0x10,%esp
+80103acd:	83 ff 01             	cmp    $0x1,%edi
+80103ad0:	0f 9e c0             	setle  %al
+80103ad3:	85 db                	test   %ebx,%ebx
+80103ad5:	0f 94 c2             	sete   %dl
+80103ad8:	84 c0                	test   %al,%al
+80103ada:	74 0a                	je     80103ae6 <kalloc_order+0x74>
+80103adc:	84 d2                	test   %dl,%dl
+80103ade:	74 06                	je     80103ae6 <kalloc_order+0x74>
+    if(tries > 0)
+80103ae0:	85 ff                	test   %edi,%edi
+80103ae2:	7e c1                	jle    80103aa5 <kalloc_order+0x33>
+80103ae4:	eb ba                	jmp    80103aa0 <kalloc_order+0x2e>
+  if(r)
+80103ae6:	85 db                	test   %ebx,%ebx
+80103ae8:	74 2f                	je     80103b19 <kalloc_order+0xa7>
+    for(i = 0; i < (1 << order); i++)
+80103aea:	ba 00 00 00 00       	mov    $0x0,%edx
+80103aef:	eb 1b                	jmp    80103b0c <kalloc_order+0x9a>
+      kmem.ref[V2P(r)/PGSIZE + i] = 1;
+80103af1:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+80103af7:	c1 e8 0c             	shr    $0xc,%eax
+80103afa:	01 d0                	add    %edx,%eax
+80103afc:	01 c0                	add    %eax,%eax
+80103afe:	03 05 5c 1c 12 80    	add    0x80121c5c,%eax
+80103b04:	66 c7 00 01 00       	movw   $0x1,(%eax)
+    for(i = 0; i < (1 << order); i++)
+80103b09:	83 c2 01             	add    $0x1,%edx
+80103b0c:	b8 01 00 00 00       	mov    $0x1,%eax
+80103b11:	89 f1                	mov    %esi,%ecx
+80103b13:	d3 e0                	shl    %cl,%eax
+80103b15:	39 d0                	cmp    %edx,%eax
+80103b17:	7f d8                	jg     80103af1 <kalloc_order+0x7f>
+}
+80103b19:	89 d8                	mov    %ebx,%eax
+80103b1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103b1e:	5b                   	pop    %ebx
+80103b1f:	5e                   	pop    %esi
+80103b20:	5f                   	pop    %edi
+80103b21:	5d                   	pop    %ebp
+80103b22:	c3                   	ret
+    return 0;
+80103b23:	bb 00 00 00 00       	mov    $0x0,%ebx
+80103b28:	eb ef                	jmp    80103b19 <kalloc_order+0xa7>
+
+80103b2a <kfree_order>:
+{
+80103b2a:	55                   	push   %ebp
+80103b2b:	89 e5                	mov    %esp,%ebp
+80103b2d:	57                   	push   %edi
+80103b2e:	56                   	push   %esi
+80103b2f:	53                   	push   %ebx
+80103b30:	83 ec 0c             	sub    $0xc,%esp
+80103b33:	8b 75 08             	mov    0x8(%ebp),%esi
+80103b36:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(order == 0){
+80103b39:	85 db                	test   %ebx,%ebx
+80103b3b:	74 63                	je     80103ba0 <kfree_order+0x76>
+  if(order < 0 || order > MAXORDER || V2P(v) % (PGSIZE << order) ||
+80103b3d:	83 fb 0a             	cmp    $0xa,%ebx
+80103b40:	77 6c                	ja     80103bae <kfree_order+0x84>
+80103b42:	8d be 00 00 00 80    	lea    -0x80000000(%esi),%edi
+80103b48:	b8 00 10 00 00       	mov    $0x1000,%eax
+80103b4d:	89 d9                	mov    %ebx,%ecx
+80103b4f:	d3 e0                	shl    %cl,%eax
+80103b51:	8d 50 ff             	lea    -0x1(%eax),%edx
+80103b54:	85 d7                	test   %edx,%edi
+80103b56:	75 56                	jne    80103bae <kfree_order+0x84>
+80103b58:	81 fe 70 67 13 80    	cmp    $0x80136770,%esi
+80103b5e:	72 4e                	jb     80103bae <kfree_order+0x84>
+     v < end || V2P(v) + (PGSIZE << order) > phystop)
+80103b60:	8d 84 06 00 00 00 80 	lea    -0x80000000(%esi,%eax,1),%eax
+80103b67:	39 05 60 1c 12 80    	cmp    %eax,0x80121c60
+80103b6d:	72 3f                	jb     80103bae <kfree_order+0x84>
+  for(i = 0; i < (1 << order); i++){
+80103b6f:	ba 00 00 00 00       	mov    $0x0,%edx
+80103b74:	b8 01 00 00 00       	mov    $0x1,%eax
+80103b79:	89 d9                	mov    %ebx,%ecx
+80103b7b:	d3 e0                	shl    %cl,%eax
+80103b7d:	39 d0                	cmp    %edx,%eax
+80103b7f:	7e 47                	jle    80103bc8 <kfree_order+0x9e>
+    if(kmem.ref[V2P(v)/PGSIZE + i] != 1)
+80103b81:	89 f8                	mov    %edi,%eax
+80103b83:	c1 e8 0c             	shr    $0xc,%eax
+80103b86:	01 d0                	add    %edx,%eax
+80103b88:	01 c0                	add    %eax,%eax
+80103b8a:	03 05 5c 1c 12 80    	add    0x80121c5c,%eax
+80103b90:	66 83 38 01          	cmpw   $0x1,(%eax)
+80103b94:	75 25                	jne    80103bbb <kfree_order+0x91>
+    kmem.ref[V2P(v)/PGSIZE + i] = 0;
+80103b96:	66 c7 00 00 00       	movw   $0x0,(%eax)
+  for(i = 0; i < (1 << order); i++){
+80103b9b:	83 c2 01             	add    $0x1,%edx
+80103b9e:	eb d4                	jmp    80103b74 <kfree_order+0x4a>
+    kfree(v);
+80103ba0:	83 ec 0c             	sub    $0xc,%esp
+80103ba3:	56                   	push   %esi
+80103ba4:	e8 66 f9 ff ff       	call   8010350f <kfree>
+    return;
+80103ba9:	83 c4 10             	add    $0x10,%esp
+80103bac:	eb 3f                	jmp    80103bed <kfree_order+0xc3>
+    panic("kfree_order");
+80103bae:	83 ec 0c             	sub    $0xc,%esp
+80103bb1:	68 92 bc 10 80       	push   $0x8010bc92
+80103bb6:	e8 70 d1 ff ff       	call   80100d2b <panic>
+      panic("kfree_order: ref");
+80103bbb:	83 ec 0c             	sub    $0xc,%esp
+80103bbe:	68 9e bc 10 80       	push   $0x8010bc9e
+80103bc3:	e8 63 d1 ff ff       	call   80100d2b <panic>
+  acquire(&kmem.lock);
+80103bc8:	83 ec 0c             	sub    $0xc,%esp
+80103bcb:	68 c0 1b 12 80       	push   $0x80121bc0
+80103bd0:	e8 bd 3e 00 00       	call   80107a92 <acquire>
+  buddyfree((struct run*)v, order);
+80103bd5:	89 da                	mov    %ebx,%edx
+80103bd7:	89 f0                	mov    %esi,%eax
+80103bd9:	e8 a1 f7 ff ff       	call   8010337f <buddyfree>
+  release(&kmem.lock);
+80103bde:	c7 04 24 c0 1b 12 80 	movl   $0x80121bc0,(%esp)
+80103be5:	e8 0d 3f 00 00       	call   80107af7 <release>
+80103bea:	83 c4 10             	add    $0x10,%esp
+}
+80103bed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103bf0:	5b                   	pop    %ebx
+80103bf1:	5e                   	pop    %esi
+80103bf2:	5f                   	pop    %edi
+80103bf3:	5d                   	pop    %ebp
+80103bf4:	c3                   	ret
+
+80103bf5 <kalloc_zeroed>:
+
+// Allocate one zero-filled page, preferably from the
+// pre-zeroed pool.  Returns 0 if out of memory.
+char*
+kalloc_zeroed(void)
+{
+80103bf5:	55                   	push   %ebp
+80103bf6:	89 e5                	mov    %esp,%ebp
+80103bf8:	53                   	push   %ebx
+80103bf9:	83 ec 04             	sub    $0x4,%esp
+  char *v;
+
+  if(kmem.use_lock && (v = kzeroget()) != 0){
+80103bfc:	83 3d f4 1b 12 80 00 	cmpl   $0x0,0x80121bf4
+80103c03:	74 1a                	je     80103c1f <kalloc_zeroed+0x2a>
+80103c05:	e8 2a f8 ff ff       	call   80103434 <kzeroget>
+80103c0a:	89 c3                	mov    %eax,%ebx
+80103c0c:	85 c0                	test   %eax,%eax
+80103c0e:	74 0f                	je     80103c1f <kalloc_zeroed+0x2a>
+    kzero.hits++;
+80103c10:	a1 1c 19 12 80       	mov    0x8012191c,%eax
+80103c15:	83 c0 01             	add    $0x1,%eax
+80103c18:	a3 1c 19 12 80       	mov    %eax,0x8012191c
+    return v;
+80103c1d:	eb 2b                	jmp    80103c4a <kalloc_zeroed+0x55>
+  }
+  kzero.misses++;
+80103c1f:	a1 20 19 12 80       	mov    0x80121920,%eax
+80103c24:	83 c0 01             	add    $0x1,%eax
+80103c27:	a3 20 19 12 80       	mov    %eax,0x80121920
+  if((v = kalloc()) != 0)
+80103c2c:	e8 f3 fb ff ff       	call   80103824 <kalloc>
+80103c31:	89 c3                	mov    %eax,%ebx
+80103c33:	85 c0                	test   %eax,%eax
+80103c35:	74 13                	je     80103c4a <kalloc_zeroed+0x55>
+    memset(v, 0, PGSIZE);
+80103c37:	83 ec 04             	sub    $0x4,%esp
+80103c3a:	68 00 10 00 00       	push   $0x1000
+80103c3f:	6a 00                	push   $0x0
+80103c41:	50                   	push   %eax
+80103c42:	e8 f7 3e 00 00       	call   80107b3e <memset>
+80103c47:	83 c4 10             	add    $0x10,%esp
+  return v;
+}
+80103c4a:	89 d8                	mov    %ebx,%eax
+80103c4c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103c4f:	c9                   	leave
+80103c50:	c3                   	ret
+
+80103c51 <kzeroidle>:
+void
+kzeroidle(void)
+{
+  struct run *r;
+
+  if(kzero.n >= KZERO || kmem.nfree == 0)
+80103c51:	81 3d 18 19 12 80 ff 	cmpl   $0xff,0x80121918
+80103c58:	00 00 00 
+80103c5b:	7f 09                	jg     80103c66 <kzeroidle+0x15>
+80103c5d:	83 3d 50 1c 12 80 00 	cmpl   $0x0,0x80121c50
+80103c64:	75 01                	jne    80103c67 <kzeroidle+0x16>
+80103c66:	c3                   	ret
+{
+80103c67:	55                   	push   %ebp
+80103c68:	89 e5                	mov    %esp,%ebp
+80103c6a:	53                   	push   %ebx
+80103c6b:	83 ec 04             	sub    $0x4,%esp
+    return;
+  if((r = (struct run*)kalloc()) == 0)
+80103c6e:	e8 b1 fb ff ff       	call   80103824 <kalloc>
+80103c73:	89 c3                	mov    %eax,%ebx
+80103c75:	85 c0                	test   %eax,%eax
+80103c77:	74 45                	je     80103cbe <kzeroidle+0x6d>
+    return;
+  memset(r, 0, PGSIZE);
+80103c79:	83 ec 04             	sub    $0x4,%esp
+80103c7c:	68 00 10 00 00       	push   $0x1000
+80103c81:	6a 00                	push   $0x0
+80103c83:	50                   	push   %eax
+80103c84:	e8 b5 3e 00 00       	call   80107b3e <memset>
+  acquire(&kzero.lock);
+80103c89:	c7 04 24 e0 18 12 80 	movl   $0x801218e0,(%esp)
+80103c90:	e8 fd 3d 00 00       	call   80107a92 <acquire>
+  r->next = kzero.freelist;
+80103c95:	a1 14 19 12 80       	mov    0x80121914,%eax
+80103c9a:	89 03                	mov    %eax,(%ebx)
+  kzero.freelist = r;
+80103c9c:	89 1d 14 19 12 80    	mov    %ebx,0x80121914
+  kzero.n++;
+80103ca2:	a1 18 19 12 80       	mov    0x80121918,%eax
+80103ca7:	83 c0 01             	add    $0x1,%eax
+80103caa:	a3 18 19 12 80       	mov    %eax,0x80121918
+  release(&kzero.lock);
+80103caf:	c7 04 24 e0 18 12 80 	movl   $0x801218e0,(%esp)
+80103cb6:	e8 3c 3e 00 00       	call   80107af7 <release>
+80103cbb:	83 c4 10             	add    $0x10,%esp
+}
+80103cbe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103cc1:	c9                   	leave
+80103cc2:	c3                   	ret
+
+80103cc3 <kdup>:
+// Add a reference to the allocated page v, which will
+// then survive one more kfree().  Used to share pages
+// copy-on-write between parent and child after fork.
+char*
+kdup(char *v)
+{
+80103cc3:	55                   	push   %ebp
+80103cc4:	89 e5                	mov    %esp,%ebp
+80103cc6:	56                   	push   %esi
+80103cc7:	53                   	push   %ebx
+80103cc8:	8b 75 08             	mov    0x8(%ebp),%esi
+  if((uint)v % PGSIZE || v < end || V2P(v) >= phystop)
+80103ccb:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+80103cd1:	75 55                	jne    80103d28 <kdup+0x65>
+80103cd3:	81 fe 70 67 13 80    	cmp    $0x80136770,%esi
+80103cd9:	72 4d                	jb     80103d28 <kdup+0x65>
+80103cdb:	8d 9e 00 00 00 80    	lea    -0x80000000(%esi),%ebx
+80103ce1:	3b 1d 60 1c 12 80    	cmp    0x80121c60,%ebx
+80103ce7:	73 3f                	jae    80103d28 <kdup+0x65>
+    panic("kdup");
+
+  acquire(&kmem.lock);
+80103ce9:	83 ec 0c             	sub    $0xc,%esp
+80103cec:	68 c0 1b 12 80       	push   $0x80121bc0
+80103cf1:	e8 9c 3d 00 00       	call   80107a92 <acquire>
+  if(kmem.ref[V2P(v)/PGSIZE] < 1)
+80103cf6:	c1 eb 0c             	shr    $0xc,%ebx
+80103cf9:	01 db                	add    %ebx,%ebx
+80103cfb:	03 1d 5c 1c 12 80    	add    0x80121c5c,%ebx
+80103d01:	0f b7 03             	movzwl (%ebx),%eax
+80103d04:	83 c4 10             	add    $0x10,%esp
+80103d07:	66 85 c0             	test   %ax,%ax
+80103d0a:	74 29                	je     80103d35 <kdup+0x72>
+    panic("kdup: free page");
+  kmem.ref[V2P(v)/PGSIZE]++;
+80103d0c:	83 c0 01             	add    $0x1,%eax
+80103d0f:	66 89 03             	mov    %ax,(%ebx)
+  release(&kmem.lock);
+80103d12:	83 ec 0c             	sub    $0xc,%esp
+80103d15:	68 c0 1b 12 80       	push   $0x80121bc0
+80103d1a:	e8 d8 3d 00 00       	call   80107af7 <release>
+  return v;
+}
+80103d1f:	89 f0                	mov    %esi,%eax
+80103d21:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103d24:	5b                   	pop    %ebx
+80103d25:	5e                   	pop    %esi
+80103d26:	5d                   	pop    %ebp
+80103d27:	c3                   	ret
+    panic("kdup");
+80103d28:	83 ec 0c             	sub    $0xc,%esp
+80103d2b:	68 af bc 10 80       	push   $0x8010bcaf
+80103d30:	e8 f6 cf ff ff       	call   80100d2b <panic>
+    panic("kdup: free page");
+80103d35:	83 ec 0c             	sub    $0xc,%esp
+80103d38:	68 b4 bc 10 80       	push   $0x8010bcb4
+80103d3d:	e8 e9 cf ff ff       	call   80100d2b <panic>
+
+80103d42 <kfreepages>:
+
+// Return the number of free pages, including those
+// sitting in the per-CPU caches and the zeroed pool.
+int
+kfreepages(void)
+{
+80103d42:	55                   	push   %ebp
+80103d43:	89 e5                	mov    %esp,%ebp
+80103d45:	53                   	push   %ebx
+  int i, n;
+
+  n = kmem.nfree + kzero.n;
+80103d46:	8b 1d 18 19 12 80    	mov    0x80121918,%ebx
+80103d4c:	03 1d 50 1c 12 80    	add    0x80121c50,%ebx
+  for(i = 0; i < ncpu; i++)
+80103d52:	ba 00 00 00 00       	mov    $0x0,%edx
+80103d57:	eb 0f                	jmp    80103d68 <kfreepages+0x26>
+    n += kcache[i].n;
+80103d59:	8d 04 92             	lea    (%edx,%edx,4),%eax
+80103d5c:	c1 e0 04             	shl    $0x4,%eax
+80103d5f:	03 98 78 19 12 80    	add    -0x7fede688(%eax),%ebx
+  for(i = 0; i < ncpu; i++)
+80103d65:	83 c2 01             	add    $0x1,%edx
+80103d68:	39 15 64 1e 12 80    	cmp    %edx,0x80121e64
+80103d6e:	7f e9                	jg     80103d59 <kfreepages+0x17>
+  return n;
+}
+80103d70:	89 d8                	mov    %ebx,%eax
+80103d72:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103d75:	c9                   	leave
+80103d76:	c3                   	ret
+
+80103d77 <krefcnt>:
+
+// Return the number of references to page v.
+int
+krefcnt(char *v)
+{
+80103d77:	55                   	push   %ebp
+80103d78:	89 e5                	mov    %esp,%ebp
+80103d7a:	53                   	push   %ebx
+80103d7b:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  acquire(&kmem.lock);
+80103d7e:	68 c0 1b 12 80       	push   $0x80121bc0
+80103d83:	e8 0a 3d 00 00       	call   80107a92 <acquire>
+  n = kmem.ref[V2P(v)/PGSIZE];
+80103d88:	8b 45 08             	mov    0x8(%ebp),%eax
+80103d8b:	05 00 00 00 80       	add    $0x80000000,%eax
+80103d90:	c1 e8 0c             	shr    $0xc,%eax
+80103d93:	8b 15 5c 1c 12 80    	mov    0x80121c5c,%edx
+80103d99:	0f b7 1c 42          	movzwl (%edx,%eax,2),%ebx
+  release(&kmem.lock);
+80103d9d:	c7 04 24 c0 1b 12 80 	movl   $0x80121bc0,(%esp)
+80103da4:	e8 4e 3d 00 00       	call   80107af7 <release>
+  return n;
+}
+80103da9:	89 d8                	mov    %ebx,%eax
+80103dab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103dae:	c9                   	leave
+80103daf:	c3                   	ret
+
+80103db0 <kmstat>:
+
+// Copy the page allocator statistics into *st.
+int
+kmstat(struct kmstat *st)
+{
+80103db0:	55                   	push   %ebp
+80103db1:	89 e5                	mov    %esp,%ebp
+80103db3:	57                   	push   %edi
+80103db4:	56                   	push   %esi
+80103db5:	53                   	push   %ebx
+80103db6:	83 ec 10             	sub    $0x10,%esp
+80103db9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct kcache *c;
+  int i;
+
+  memset(st, 0, sizeof(*st));
+80103dbc:	68 08 01 00 00       	push   $0x108
+80103dc1:	6a 00                	push   $0x0
+80103dc3:	57                   	push   %edi
+80103dc4:	e8 75 3d 00 00       	call   80107b3e <memset>
+  st->ncpu = ncpu;
+80103dc9:	a1 64 1e 12 80       	mov    0x80121e64,%eax
+80103dce:	89 07                	mov    %eax,(%edi)
+  st->nfree = kfreepages();
+80103dd0:	e8 6d ff ff ff       	call   80103d42 <kfreepages>
+80103dd5:	89 47 0c             	mov    %eax,0xc(%edi)
+  st->npage = kmem.npage;
+80103dd8:	a1 54 1c 12 80       	mov    0x80121c54,%eax
+80103ddd:	89 47 08             	mov    %eax,0x8(%edi)
+  st->phystop = phystop;
+80103de0:	a1 60 1c 12 80       	mov    0x80121c60,%eax
+80103de5:	89 47 04             	mov    %eax,0x4(%edi)
+  acquire(&kzero.lock);
+80103de8:	c7 04 24 e0 18 12 80 	movl   $0x801218e0,(%esp)
+80103def:	e8 9e 3c 00 00       	call   80107a92 <acquire>
+  st->zeroed = kzero.n;
+80103df4:	a1 18 19 12 80       	mov    0x80121918,%eax
+80103df9:	89 87 d0 00 00 00    	mov    %eax,0xd0(%edi)
+  st->zhits = kzero.hits;
+80103dff:	a1 1c 19 12 80       	mov    0x8012191c,%eax
+80103e04:	89 87 d4 00 00 00    	mov    %eax,0xd4(%edi)
+  st->zmisses = kzero.misses;
+80103e0a:	a1 20 19 12 80       	mov    0x80121920,%eax
+80103e0f:	89 87 d8 00 00 00    	mov    %eax,0xd8(%edi)
+  release(&kzero.lock);
+80103e15:	c7 04 24 e0 18 12 80 	movl   $0x801218e0,(%esp)
+80103e1c:	e8 d6 3c 00 00       	call   80107af7 <release>
+  acquire(&kmem.lock);
+80103e21:	c7 04 24 c0 1b 12 80 	movl   $0x80121bc0,(%esp)
+80103e28:	e8 65 3c 00 00       	call   80107a92 <acquire>
+  for(i = 0; i <= MAXORDER; i++)
+80103e2d:	83 c4 10             	add    $0x10,%esp
+80103e30:	b8 00 00 00 00       	mov    $0x0,%eax
+80103e35:	eb 11                	jmp    80103e48 <kmstat+0x98>
+    st->nblock[i] = kmem.nblock[i];
+80103e37:	8b 14 85 24 1c 12 80 	mov    -0x7fede3dc(,%eax,4),%edx
+80103e3e:	89 94 87 dc 00 00 00 	mov    %edx,0xdc(%edi,%eax,4)
+  for(i = 0; i <= MAXORDER; i++)
+80103e45:	83 c0 01             	add    $0x1,%eax
+80103e48:	83 f8 0a             	cmp    $0xa,%eax
+80103e4b:	7e ea                	jle    80103e37 <kmstat+0x87>
+  release(&kmem.lock);
+80103e4d:	83 ec 0c             	sub    $0xc,%esp
+80103e50:	68 c0 1b 12 80       	push   $0x80121bc0
+80103e55:	e8 9d 3c 00 00       	call   80107af7 <release>
+  for(i = 0; i < ncpu; i++){
+80103e5a:	83 c4 10             	add    $0x10,%esp
+80103e5d:	be 00 00 00 00       	mov    $0x0,%esi
+80103e62:	eb 53                	jmp    80103eb7 <kmstat+0x107>
+    c = &kcache[i];
+    acquire(&c->lock);
+80103e64:	8d 1c b6             	lea    (%esi,%esi,4),%ebx
+80103e67:	c1 e3 04             	shl    $0x4,%ebx
+80103e6a:	81 c3 40 19 12 80    	add    $0x80121940,%ebx
+80103e70:	83 ec 0c             	sub    $0xc,%esp
+80103e73:	53                   	push   %ebx
+80103e74:	e8 19 3c 00 00       	call   80107a92 <acquire>
+    st->cached[i] = c->n;
+80103e79:	8b 43 38             	mov    0x38(%ebx),%eax
+80103e7c:	89 44 b7 10          	mov    %eax,0x10(%edi,%esi,4)
+    st->allocs[i] = c->allocs;
+80103e80:	8b 43 3c             	mov    0x3c(%ebx),%eax
+80103e83:	89 44 b7 30          	mov    %eax,0x30(%edi,%esi,4)
+    st->hits[i] = c->hits;
+80103e87:	8b 43 40             	mov    0x40(%ebx),%eax
+80103e8a:	89 44 b7 50          	mov    %eax,0x50(%edi,%esi,4)
+    st->frees[i] = c->frees;
+80103e8e:	8b 43 44             	mov    0x44(%ebx),%eax
+80103e91:	89 44 b7 70          	mov    %eax,0x70(%edi,%esi,4)
+    st->refills[i] = c->refills;
+80103e95:	8b 43 48             	mov    0x48(%ebx),%eax
+80103e98:	89 84 b7 90 00 00 00 	mov    %eax,0x90(%edi,%esi,4)
+    st->drains[i] = c->drains;
+80103e9f:	8b 43 4c             	mov    0x4c(%ebx),%eax
+80103ea2:	89 84 b7 b0 00 00 00 	mov    %eax,0xb0(%edi,%esi,4)
+    release(&c->lock);
+80103ea9:	89 1c 24             	mov    %ebx,(%esp)
+80103eac:	e8 46 3c 00 00       	call   80107af7 <release>
+  for(i = 0; i < ncpu; i++){
+80103eb1:	83 c6 01             	add    $0x1,%esi
+80103eb4:	83 c4 10             	add    $0x10,%esp
+80103eb7:	39 35 64 1e 12 80    	cmp    %esi,0x80121e64
+80103ebd:	7f a5                	jg     80103e64 <kmstat+0xb4>
+  }
+  return 0;
+}
+80103ebf:	b8 00 00 00 00       	mov    $0x0,%eax
+80103ec4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103ec7:	5b                   	pop    %ebx
+80103ec8:	5e                   	pop    %esi
+80103ec9:	5f                   	pop    %edi
+80103eca:	5d                   	pop    %ebp
+80103ecb:	c3                   	ret
+
+80103ecc <kbdgetc>:
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103ecc:	ba 64 00 00 00       	mov    $0x64,%edx
+80103ed1:	ec                   	in     (%dx),%al
+    normalmap, shiftmap, ctlmap, ctlmap
+  };
+  uint st, data, c;
+
+  st = inb(KBSTATP);
+  if((st & KBS_DIB) == 0)
+80103ed2:	a8 01                	test   $0x1,%al
+80103ed4:	0f 84 b4 00 00 00    	je     80103f8e <kbdgetc+0xc2>
+80103eda:	ba 60 00 00 00       	mov    $0x60,%edx
+80103edf:	ec                   	in     (%dx),%al
+    return -1;
+  data = inb(KBDATAP);
+80103ee0:	0f b6 c8             	movzbl %al,%ecx
+
+  if(data == 0xE0){
+80103ee3:	3c e0                	cmp    $0xe0,%al
+80103ee5:	74 61                	je     80103f48 <kbdgetc+0x7c>
+    shift |= E0ESC;
+    return 0;
+  } else if(data & 0x80){
+80103ee7:	84 c0                	test   %al,%al
+80103ee9:	78 6a                	js     80103f55 <kbdgetc+0x89>
+    // Key released
+    data = (shift & E0ESC ? data : data & 0x7F);
+    shift &= ~(shiftcode[data] | E0ESC);
+    return 0;
+  } else if(shift & E0ESC){
+80103eeb:	8b 15 64 1c 12 80    	mov    0x80121c64,%edx
+80103ef1:	f6 c2 40             	test   $0x40,%dl
+80103ef4:	74 0f                	je     80103f05 <kbdgetc+0x39>
+    // Last character was an E0 escape; or with 0x80
+    data |= 0x80;
+80103ef6:	83 c8 80             	or     $0xffffff80,%eax
+80103ef9:	0f b6 c8             	movzbl %al,%ecx
+    shift &= ~E0ESC;
+80103efc:	83 e2 bf             	and    $0xffffffbf,%edx
+80103eff:	89 15 64 1c 12 80    	mov    %edx,0x80121c64
+  }
+
+  shift |= shiftcode[data];
+80103f05:	0f b6 91 00 be 10 80 	movzbl -0x7fef4200(%ecx),%edx
+80103f0c:	0b 15 64 1c 12 80    	or     0x80121c64,%edx
+80103f12:	89 15 64 1c 12 80    	mov    %edx,0x80121c64
+  shift ^= togglecode[data];
+80103f18:	0f b6 81 00 bd 10 80 	movzbl -0x7fef4300(%ecx),%eax
+80103f1f:	31 c2                	xor    %eax,%edx
+80103f21:	89 15 64 1c 12 80    	mov    %edx,0x80121c64
+  c = charcode[shift & (CTL | SHIFT)][data];
+80103f27:	89 d0                	mov    %edx,%eax
+80103f29:	83 e0 03             	and    $0x3,%eax
+80103f2c:	8b 04 85 e0 bc 10 80 	mov    -0x7fef4320(,%eax,4),%eax
+80103f33:	0f b6 04 08          	movzbl (%eax,%ecx,1),%eax
+  if(shift & CAPSLOCK){
+80103f37:	f6 c2 08             	test   $0x8,%dl
+80103f3a:	74 57                	je     80103f93 <kbdgetc+0xc7>
+    if('a' <= c && c <= 'z')
+80103f3c:	8d 50 9f             	lea    -0x61(%eax),%edx
+80103f3f:	83 fa 19             	cmp    $0x19,%edx
+80103f42:	77 3e                	ja     80103f82 <kbdgetc+0xb6>
+      c += 'A' - 'a';
+80103f44:	83 e8 20             	sub    $0x20,%eax
+80103f47:	c3                   	ret
+    shift |= E0ESC;
+80103f48:	83 0d 64 1c 12 80 40 	orl    $0x40,0x80121c64
+    return 0;
+80103f4f:	b8 00 00 00 00       	mov    $0x0,%eax
+80103f54:	c3                   	ret
+    data = (shift & E0ESC ? data : data & 0x7F);
+80103f55:	8b 15 64 1c 12 80    	mov    0x80121c64,%edx
+80103f5b:	f6 c2 40             	test   $0x40,%dl
+80103f5e:	75 05                	jne    80103f65 <kbdgetc+0x99>
+80103f60:	89 c1                	mov    %eax,%ecx
+80103f62:	83 e1 7f             	and    $0x7f,%ecx
+    shift &= ~(shiftcode[data] | E0ESC);
+80103f65:	0f b6 81 00 be 10 80 	movzbl -0x7fef4200(%ecx),%eax
+80103f6c:	83 c8 40             	or     $0x40,%eax
+80103f6f:	0f b6 c0             	movzbl %al,%eax
+80103f72:	f7 d0                	not    %eax
+80103f74:	21 c2                	and    %eax,%edx
+80103f76:	89 15 64 1c 12 80    	mov    %edx,0x80121c64
+    return 0;
+80103f7c:	b8 00 00 00 00       	mov    $0x0,%eax
+80103f81:	c3                   	ret
+    else if('A' <= c && c <= 'Z')
+80103f82:	8d 50 bf             	lea    -0x41(%eax),%edx
+80103f85:	83 fa 19             	cmp    $0x19,%edx
+80103f88:	77 09                	ja     80103f93 <kbdgetc+0xc7>
+      c += 'a' - 'A';
+80103f8a:	83 c0 20             	add    $0x20,%eax
+  }
+  return c;
+80103f8d:	c3                   	ret
+    return -1;
+80103f8e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80103f93:	c3                   	ret
+
+80103f94 <kbdintr>:
+
+void
+kbdintr(void)
+{
+80103f94:	55                   	push   %ebp
+80103f95:	89 e5                	mov    %esp,%ebp
+80103f97:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(kbdgetc);
+80103f9a:	68 cc 3e 10 80       	push   $0x80103ecc
+80103f9f:	e8 74 d1 ff ff       	call   80101118 <consoleintr>
+}
+80103fa4:	83 c4 10             	add    $0x10,%esp
+80103fa7:	c9                   	leave
+80103fa8:	c3                   	ret
+
+80103fa9 <lapicw>:
+volatile uint *lapic;  // Initialized in mp.c
+
+static void
+lapicw(int index, int value)
+{
+  lapic[index] = value;
+80103fa9:	8b 0d 68 1c 12 80    	mov    0x80121c68,%ecx
+80103faf:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+80103fb2:	89 10                	mov    %edx,(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80103fb4:	a1 68 1c 12 80       	mov    0x80121c68,%eax
+80103fb9:	8b 40 20             	mov    0x20(%eax),%eax
+}
+80103fbc:	c3                   	ret
+
+80103fbd <cmos_read>:
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103fbd:	ba 70 00 00 00       	mov    $0x70,%edx
+80103fc2:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103fc3:	ba 71 00 00 00       	mov    $0x71,%edx
+80103fc8:	ec                   	in     (%dx),%al
+cmos_read(uint reg)
+{
+  outb(CMOS_PORT,  reg);
+  microdelay(200);
+
+  return inb(CMOS_RETURN);
+80103fc9:	0f b6 c0             	movzbl %al,%eax
+}
+80103fcc:	c3                   	ret
+
+80103fcd <fill_rtcdate>:
+  return 1024*1024 + n*1024;
+}
+
+static void
+fill_rtcdate(struct rtcdate *r)
+{
+80103fcd:	55                   	push   %ebp
+80103fce:	89 e5                	mov    %esp,%ebp
+80103fd0:	53                   	push   %ebx
+80103fd1:	83 ec 04             	sub    $0x4,%esp
+80103fd4:	89 c3                	mov    %eax,%ebx
+  r->second = cmos_read(SECS);
+80103fd6:	b8 00 00 00 00       	mov    $0x0,%eax
+80103fdb:	e8 dd ff ff ff       	call   80103fbd <cmos_read>
+80103fe0:	89 03                	mov    %eax,(%ebx)
+  r->minute = cmos_read(MINS);
+80103fe2:	b8 02 00 00 00       	mov    $0x2,%eax
+80103fe7:	e8 d1 ff ff ff       	call   80103fbd <cmos_read>
+80103fec:	89 43 04             	mov    %eax,0x4(%ebx)
+  r->hour   = cmos_read(HOURS);
+80103fef:	b8 04 00 00 00       	mov    $0x4,%eax
+80103ff4:	e8 c4 ff ff ff       	call   80103fbd <cmos_read>
+80103ff9:	89 43 08             	mov    %eax,0x8(%ebx)
+  r->day    = cmos_read(DAY);
+80103ffc:	b8 07 00 00 00       	mov    $0x7,%eax
+80104001:	e8 b7 ff ff ff       	call   80103fbd <cmos_read>
+80104006:	89 43 0c             	mov    %eax,0xc(%ebx)
+  r->month  = cmos_read(MONTH);
+80104009:	b8 08 00 00 00       	mov    $0x8,%eax
+8010400e:	e8 aa ff ff ff       	call   80103fbd <cmos_read>
+80104013:	89 43 10             	mov    %eax,0x10(%ebx)
+  r->year   = cmos_read(YEAR);
+80104016:	b8 09 00 00 00       	mov    $0x9,%eax
+8010401b:	e8 9d ff ff ff       	call   80103fbd <cmos_read>
+80104020:	89 43 14             	mov    %eax,0x14(%ebx)
+}
+80104023:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104026:	c9                   	leave
+80104027:	c3                   	ret
+
+80104028 <lapicinit>:
+  if(!lapic)
+80104028:	83 3d 68 1c 12 80 00 	cmpl   $0x0,0x80121c68
+8010402f:	0f 84 fe 00 00 00    	je     80104133 <lapicinit+0x10b>
+{
+80104035:	55                   	push   %ebp
+80104036:	89 e5                	mov    %esp,%ebp
+80104038:	83 ec 08             	sub    $0x8,%esp
+  lapicw(SVR, ENABLE | (T_IRQ0 + IRQ_SPURIOUS));
+8010403b:	ba 3f 01 00 00       	mov    $0x13f,%edx
+80104040:	b8 3c 00 00 00       	mov    $0x3c,%eax
+80104045:	e8 5f ff ff ff       	call   80103fa9 <lapicw>
+  lapicw(TDCR, X1);
+8010404a:	ba 0b 00 00 00       	mov    $0xb,%edx
+8010404f:	b8 f8 00 00 00       	mov    $0xf8,%eax
+80104054:	e8 50 ff ff ff       	call   80103fa9 <lapicw>
+  lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
+80104059:	ba 20 00 02 00       	mov    $0x20020,%edx
+8010405e:	b8 c8 00 00 00       	mov    $0xc8,%eax
+80104063:	e8 41 ff ff ff       	call   80103fa9 <lapicw>
+  lapicw(TICR, 10000000);
+80104068:	ba 80 96 98 00       	mov    $0x989680,%edx
+8010406d:	b8 e0 00 00 00       	mov    $0xe0,%eax
+80104072:	e8 32 ff ff ff       	call   80103fa9 <lapicw>
+  lapicw(LINT0, MASKED);
+80104077:	ba 00 00 01 00       	mov    $0x10000,%edx
+8010407c:	b8 d4 00 00 00       	mov    $0xd4,%eax
+80104081:	e8 23 ff ff ff       	call   80103fa9 <lapicw>
+  lapicw(LINT1, MASKED);
+80104086:	ba 00 00 01 00       	mov    $0x10000,%edx
+8010408b:	b8 d8 00 00 00       	mov    $0xd8,%eax
+80104090:	e8 14 ff ff ff       	call   80103fa9 <lapicw>
+  if(((lapic[VER]>>16) & 0xFF) >= 4)
+80104095:	a1 68 1c 12 80       	mov    0x80121c68,%eax
+8010409a:	8b 40 30             	mov    0x30(%eax),%eax
+8010409d:	c1 e8 10             	shr    $0x10,%eax
+801040a0:	a8 fc                	test   $0xfc,%al
+801040a2:	75 7b                	jne    8010411f <lapicinit+0xf7>
+  lapicw(ERROR, T_IRQ0 + IRQ_ERROR);
+801040a4:	ba 33 00 00 00       	mov    $0x33,%edx
+801040a9:	b8 dc 00 00 00       	mov    $0xdc,%eax
+801040ae:	e8 f6 fe ff ff       	call   80103fa9 <lapicw>
+  lapicw(ESR, 0);
+801040b3:	ba 00 00 00 00       	mov    $0x0,%edx
+801040b8:	b8 a0 00 00 00       	mov    $0xa0,%eax
+801040bd:	e8 e7 fe ff ff       	call   80103fa9 <lapicw>
+  lapicw(ESR, 0);
+801040c2:	ba 00 00 00 00       	mov    $0x0,%edx
+801040c7:	b8 a0 00 00 00       	mov    $0xa0,%eax
+801040cc:	e8 d8 fe ff ff       	call   80103fa9 <lapicw>
+  lapicw(EOI, 0);
+801040d1:	ba 00 00 00 00       	mov    $0x0,%edx
+801040d6:	b8 2c 00 00 00       	mov    $0x2c,%eax
+801040db:	e8 c9 fe ff ff       	call   80103fa9 <lapicw>
+  lapicw(ICRHI, 0);
+801040e0:	ba 00 00 00 00       	mov    $0x0,%edx
+801040e5:	b8 c4 00 00 00       	mov    $0xc4,%eax
+801040ea:	e8 ba fe ff ff       	call   80103fa9 <lapicw>
+  lapicw(ICRLO, BCAST | INIT | LEVEL);
+801040ef:	ba 00 85 08 00       	mov    $0x88500,%edx
+801040f4:	b8 c0 00 00 00       	mov    $0xc0,%eax
+801040f9:	e8 ab fe ff ff       	call   80103fa9 <lapicw>
+  while(lapic[ICRLO] & DELIVS)
+801040fe:	a1 68 1c 12 80       	mov    0x80121c68,%eax
+80104103:	8b 80 00 03 00 00    	mov    0x300(%eax),%eax
+80104109:	f6 c4 10             	test   $0x10,%ah
+8010410c:	75 f0                	jne    801040fe <lapicinit+0xd6>
+  lapicw(TPR, 0);
+8010410e:	ba 00 00 00 00       	mov    $0x0,%edx
+80104113:	b8 20 00 00 00       	mov    $0x20,%eax
+80104118:	e8 8c fe ff ff       	call   80103fa9 <lapicw>
+}
+8010411d:	c9                   	leave
+8010411e:	c3                   	ret
+    lapicw(PCINT, MASKED);
+8010411f:	ba 00 00 01 00       	mov    $0x10000,%edx
+80104124:	b8 d0 00 00 00       	mov    $0xd0,%eax
+80104129:	e8 7b fe ff ff       	call   80103fa9 <lapicw>
+8010412e:	e9 71 ff ff ff       	jmp    801040a4 <lapicinit+0x7c>
+80104133:	c3                   	ret
+
+80104134 <lapicid>:
+  if (!lapic)
+80104134:	a1 68 1c 12 80       	mov    0x80121c68,%eax
+80104139:	85 c0                	test   %eax,%eax
+8010413b:	74 07                	je     80104144 <lapicid+0x10>
+  return lapic[ID] >> 24;
+8010413d:	8b 40 20             	mov    0x20(%eax),%eax
+80104140:	c1 e8 18             	shr    $0x18,%eax
+80104143:	c3                   	ret
+    return 0;
+80104144:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80104149:	c3                   	ret
+
+8010414a <lapiceoi>:
+  if(lapic)
+8010414a:	83 3d 68 1c 12 80 00 	cmpl   $0x0,0x80121c68
+80104151:	74 17                	je     8010416a <lapiceoi+0x20>
+{
+80104153:	55                   	push   %ebp
+80104154:	89 e5                	mov    %esp,%ebp
+80104156:	83 ec 08             	sub    $0x8,%esp
+    lapicw(EOI, 0);
+80104159:	ba 00 00 00 00       	mov    $0x0,%edx
+8010415e:	b8 2c 00 00 00       	mov    $0x2c,%eax
+80104163:	e8 41 fe ff ff       	call   80103fa9 <lapicw>
+}
+80104168:	c9                   	leave
+80104169:	c3                   	ret
+8010416a:	c3                   	ret
+
+8010416b <microdelay>:
+}
+8010416b:	c3                   	ret
+
+8010416c <lapicstartap>:
+{
+8010416c:	55                   	push   %ebp
+8010416d:	89 e5                	mov    %esp,%ebp
+8010416f:	57                   	push   %edi
+80104170:	56                   	push   %esi
+80104171:	53                   	push   %ebx
+80104172:	83 ec 0c             	sub    $0xc,%esp
+80104175:	8b 75 08             	mov    0x8(%ebp),%esi
+80104178:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010417b:	b8 0f 00 00 00       	mov    $0xf,%eax
+80104180:	ba 70 00 00 00       	mov    $0x70,%edx
+80104185:	ee                   	out    %al,(%dx)
+80104186:	b8 0a 00 00 00       	mov    $0xa,%eax
+8010418b:	ba 71 00 00 00       	mov    $0x71,%edx
+80104190:	ee                   	out    %al,(%dx)
+  wrv[0] = 0;
+80104191:	66 c7 05 67 04 00 80 	movw   $0x0,0x80000467
+80104198:	00 00 
+  wrv[1] = addr >> 4;
+8010419a:	89 f8                	mov    %edi,%eax
+8010419c:	c1 e8 04             	shr    $0x4,%eax
+8010419f:	66 a3 69 04 00 80    	mov    %ax,0x80000469
+  lapicw(ICRHI, apicid<<24);
+801041a5:	c1 e6 18             	shl    $0x18,%esi
+801041a8:	89 f2                	mov    %esi,%edx
+801041aa:	b8 c4 00 00 00       	mov    $0xc4,%eax
+801041af:	e8 f5 fd ff ff       	call   80103fa9 <lapicw>
+  lapicw(ICRLO, INIT | LEVEL | ASSERT);
+801041b4:	ba 00 c5 00 00       	mov    $0xc500,%edx
+801041b9:	b8 c0 00 00 00       	mov    $0xc0,%eax
+801041be:	e8 e6 fd ff ff       	call   80103fa9 <lapicw>
+  lapicw(ICRLO, INIT | LEVEL);
+801041c3:	ba 00 85 00 00       	mov    $0x8500,%edx
+801041c8:	b8 c0 00 00 00       	mov    $0xc0,%eax
+801041cd:	e8 d7 fd ff ff       	call   80103fa9 <lapicw>
+  for(i = 0; i < 2; i++){
+801041d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+801041d7:	eb 21                	jmp    801041fa <lapicstartap+0x8e>
+    lapicw(ICRHI, apicid<<24);
+801041d9:	89 f2                	mov    %esi,%edx
+801041db:	b8 c4 00 00 00       	mov    $0xc4,%eax
+801041e0:	e8 c4 fd ff ff       	call   80103fa9 <lapicw>
+    lapicw(ICRLO, STARTUP | (addr>>12));
+801041e5:	89 fa                	mov    %edi,%edx
+801041e7:	c1 ea 0c             	shr    $0xc,%edx
+801041ea:	80 ce 06             	or     $0x6,%dh
+801041ed:	b8 c0 00 00 00       	mov    $0xc0,%eax
+801041f2:	e8 b2 fd ff ff       	call   80103fa9 <lapicw>
+  for(i = 0; i < 2; i++){
+801041f7:	83 c3 01             	add    $0x1,%ebx
+801041fa:	83 fb 01             	cmp    $0x1,%ebx
+801041fd:	7e da                	jle    801041d9 <lapicstartap+0x6d>
+}
+801041ff:	83 c4 0c             	add    $0xc,%esp
+80104202:	5b                   	pop    %ebx
+80104203:	5e                   	pop    %esi
+80104204:	5f                   	pop    %edi
+80104205:	5d                   	pop    %ebp
+80104206:	c3                   	ret
+
+80104207 <cmosmemtop>:
+{
+80104207:	55                   	push   %ebp
+80104208:	89 e5                	mov    %esp,%ebp
+8010420a:	53                   	push   %ebx
+8010420b:	83 ec 04             	sub    $0x4,%esp
+  n = cmos_read(0x34) | (cmos_read(0x35) << 8);
+8010420e:	b8 34 00 00 00       	mov    $0x34,%eax
+80104213:	e8 a5 fd ff ff       	call   80103fbd <cmos_read>
+80104218:	89 c3                	mov    %eax,%ebx
+8010421a:	b8 35 00 00 00       	mov    $0x35,%eax
+8010421f:	e8 99 fd ff ff       	call   80103fbd <cmos_read>
+80104224:	c1 e0 08             	shl    $0x8,%eax
+  if(n > 0)
+80104227:	09 c3                	or     %eax,%ebx
+80104229:	74 0e                	je     80104239 <cmosmemtop+0x32>
+    return 16*1024*1024 + n*64*1024;
+8010422b:	8d 83 00 01 00 00    	lea    0x100(%ebx),%eax
+80104231:	c1 e0 10             	shl    $0x10,%eax
+}
+80104234:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104237:	c9                   	leave
+80104238:	c3                   	ret
+  n = cmos_read(0x30) | (cmos_read(0x31) << 8);
+80104239:	b8 30 00 00 00       	mov    $0x30,%eax
+8010423e:	e8 7a fd ff ff       	call   80103fbd <cmos_read>
+80104243:	89 c3                	mov    %eax,%ebx
+80104245:	b8 31 00 00 00       	mov    $0x31,%eax
+8010424a:	e8 6e fd ff ff       	call   80103fbd <cmos_read>
+8010424f:	c1 e0 08             	shl    $0x8,%eax
+80104252:	09 c3                	or     %eax,%ebx
+  return 1024*1024 + n*1024;
+80104254:	8d 83 00 04 00 00    	lea    0x400(%ebx),%eax
+8010425a:	c1 e0 0a             	shl    $0xa,%eax
+8010425d:	eb d5                	jmp    80104234 <cmosmemtop+0x2d>
+
+8010425f <cmostime>:
+
+// qemu seems to use 24-hour GWT and the values are BCD encoded
+void
+cmostime(struct rtcdate *r)
+{
+8010425f:	55                   	push   %ebp
+80104260:	89 e5                	mov    %esp,%ebp
+80104262:	57                   	push   %edi
+80104263:	56                   	push   %esi
+80104264:	53                   	push   %ebx
+80104265:	83 ec 3c             	sub    $0x3c,%esp
+80104268:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct rtcdate t1, t2;
+  int sb, bcd;
+
+  sb = cmos_read(CMOS_STATB);
+8010426b:	b8 0b 00 00 00       	mov    $0xb,%eax
+80104270:	e8 48 fd ff ff       	call   80103fbd <cmos_read>
+
+  bcd = (sb & (1 << 2)) == 0;
+80104275:	83 e0 04             	and    $0x4,%eax
+80104278:	89 c7                	mov    %eax,%edi
+
+  // make sure CMOS doesn't modify time while we read it
+  for(;;) {
+    fill_rtcdate(&t1);
+8010427a:	8d 45 d0             	lea    -0x30(%ebp),%eax
+8010427d:	e8 4b fd ff ff       	call   80103fcd <fill_rtcdate>
+    if(cmos_read(CMOS_STATA) & CMOS_UIP)
+80104282:	b8 0a 00 00 00       	mov    $0xa,%eax
+80104287:	e8 31 fd ff ff       	call   80103fbd <cmos_read>
+8010428c:	a8 80                	test   $0x80,%al
+8010428e:	75 ea                	jne    8010427a <cmostime+0x1b>
+        continue;
+    fill_rtcdate(&t2);
+80104290:	8d 5d b8             	lea    -0x48(%ebp),%ebx
+80104293:	89 d8                	mov    %ebx,%eax
+80104295:	e8 33 fd ff ff       	call   80103fcd <fill_rtcdate>
+    if(memcmp(&t1, &t2, sizeof(t1)) == 0)
+8010429a:	83 ec 04             	sub    $0x4,%esp
+8010429d:	6a 18                	push   $0x18
+8010429f:	53                   	push   %ebx
+801042a0:	8d 45 d0             	lea    -0x30(%ebp),%eax
+801042a3:	50                   	push   %eax
+801042a4:	e8 d8 38 00 00       	call   80107b81 <memcmp>
+801042a9:	83 c4 10             	add    $0x10,%esp
+801042ac:	85 c0                	test   %eax,%eax
+801042ae:	75 ca                	jne    8010427a <cmostime+0x1b>
+      break;
+  }
+
+  // convert
+  if(bcd) {
+801042b0:	85 ff                	test   %edi,%edi
+801042b2:	75 78                	jne    8010432c <cmostime+0xcd>
+#define    CONV(x)     (t1.x = ((t1.x >> 4) * 10) + (t1.x & 0xf))
+    CONV(second);
+801042b4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+801042b7:	89 c2                	mov    %eax,%edx
+801042b9:	c1 ea 04             	shr    $0x4,%edx
+801042bc:	8d 14 92             	lea    (%edx,%edx,4),%edx
+801042bf:	83 e0 0f             	and    $0xf,%eax
+801042c2:	8d 04 50             	lea    (%eax,%edx,2),%eax
+801042c5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    CONV(minute);
+801042c8:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+801042cb:	89 c2                	mov    %eax,%edx
+801042cd:	c1 ea 04             	shr    $0x4,%edx
+801042d0:	8d 14 92             	lea    (%edx,%edx,4),%edx
+801042d3:	83 e0 0f             	and    $0xf,%eax
+801042d6:	8d 04 50             	lea    (%eax,%edx,2),%eax
+801042d9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    CONV(hour  );
+801042dc:	8b 45 d8             	mov    -0x28(%ebp),%eax
+801042df:	89 c2                	mov    %eax,%edx
+801042e1:	c1 ea 04             	shr    $0x4,%edx
+801042e4:	8d 14 92             	lea    (%edx,%edx,4),%edx
+801042e7:	83 e0 0f             	and    $0xf,%eax
+801042ea:	8d 04 50             	lea    (%eax,%edx,2),%eax
+801042ed:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    CONV(day   );
+801042f0:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801042f3:	89 c2                	mov    %eax,%edx
+801042f5:	c1 ea 04             	shr    $0x4,%edx
+801042f8:	8d 14 92             	lea    (%edx,%edx,4),%edx
+801042fb:	83 e0 0f             	and    $0xf,%eax
+801042fe:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80104301:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    CONV(month );
+80104304:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80104307:	89 c2                	mov    %eax,%edx
+80104309:	c1 ea 04             	shr    $0x4,%edx
+8010430c:	8d 14 92             	lea    (%edx,%edx,4),%edx
+8010430f:	83 e0 0f             	and    $0xf,%eax
+80104312:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80104315:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    CONV(year  );
+80104318:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010431b:	89 c2                	mov    %eax,%edx
+8010431d:	c1 ea 04             	shr    $0x4,%edx
+80104320:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80104323:	83 e0 0f             	and    $0xf,%eax
+80104326:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80104329:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+#undef     CONV
+  }
+
+  *r = t1;
+8010432c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+8010432f:	89 06                	mov    %eax,(%esi)
+80104331:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80104334:	89 46 04             	mov    %eax,0x4(%esi)
+80104337:	8b 45 d8             	mov    -0x28(%ebp),%eax
+8010433a:	89 46 08             	mov    %eax,0x8(%esi)
+8010433d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80104340:	89 46 0c             	mov    %eax,0xc(%esi)
+80104343:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80104346:	89 46 10             	mov    %eax,0x10(%esi)
+80104349:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010434c:	89 46 14             	mov    %eax,0x14(%esi)
+  r->year += 2000;
+8010434f:	05 d0 07 00 00       	add    $0x7d0,%eax
+80104354:	89 46 14             	mov    %eax,0x14(%esi)
+}
+80104357:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010435a:	5b                   	pop    %ebx
+8010435b:	5e                   	pop    %esi
+8010435c:	5f                   	pop    %edi
+8010435d:	5d                   	pop    %ebp
+8010435e:	c3                   	ret
+
+8010435f <latest>:
+static int
+latest(struct logheader *lh, int i)
+{
+  int j;
+
+  for (j = i+1; j < lh->n; j++)
+8010435f:	8d 4a 01             	lea    0x1(%edx),%ecx
+80104362:	39 08                	cmp    %ecx,(%eax)
+80104364:	7e 26                	jle    8010438c <latest+0x2d>
+{
+80104366:	55                   	push   %ebp
+80104367:	89 e5                	mov    %esp,%ebp
+80104369:	53                   	push   %ebx
+    if (lh->block[j] == lh->block[i])
+8010436a:	8b 5c 90 04          	mov    0x4(%eax,%edx,4),%ebx
+8010436e:	39 5c 88 04          	cmp    %ebx,0x4(%eax,%ecx,4)
+80104372:	74 11                	je     80104385 <latest+0x26>
+  for (j = i+1; j < lh->n; j++)
+80104374:	83 c1 01             	add    $0x1,%ecx
+80104377:	39 08                	cmp    %ecx,(%eax)
+80104379:	7f ef                	jg     8010436a <latest+0xb>
+      return 0;
+  return 1;
+8010437b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+80104380:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104383:	c9                   	leave
+80104384:	c3                   	ret
+      return 0;
+80104385:	b8 00 00 00 00       	mov    $0x0,%eax
+8010438a:	eb f4                	jmp    80104380 <latest+0x21>
+  return 1;
+8010438c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+80104391:	c3                   	ret
+
+80104392 <read_head>:
+}
+
+// Read the log header from disk into the in-memory log header
+static void
+read_head(void)
+{
+80104392:	55                   	push   %ebp
+80104393:	89 e5                	mov    %esp,%ebp
+80104395:	53                   	push   %ebx
+80104396:	83 ec 0c             	sub    $0xc,%esp
+  struct buf *buf = bread(log.dev, log.start);
+80104399:	ff 35 b4 1c 12 80    	push   0x80121cb4
+8010439f:	ff 35 d0 1c 12 80    	push   0x80121cd0
+801043a5:	e8 96 c4 ff ff       	call   80100840 <bread>
+  struct logheader *lh = (struct logheader *) (buf->data);
+  int i;
+  log.lh.n = lh->n;
+801043aa:	8b 58 74             	mov    0x74(%eax),%ebx
+801043ad:	89 1d d4 1c 12 80    	mov    %ebx,0x80121cd4
+  for (i = 0; i < log.lh.n; i++) {
+801043b3:	83 c4 10             	add    $0x10,%esp
+801043b6:	ba 00 00 00 00       	mov    $0x0,%edx
+801043bb:	eb 0e                	jmp    801043cb <read_head+0x39>
+    log.lh.block[i] = lh->block[i];
+801043bd:	8b 4c 90 78          	mov    0x78(%eax,%edx,4),%ecx
+801043c1:	89 0c 95 d8 1c 12 80 	mov    %ecx,-0x7fede328(,%edx,4)
+  for (i = 0; i < log.lh.n; i++) {
+801043c8:	83 c2 01             	add    $0x1,%edx
+801043cb:	39 d3                	cmp    %edx,%ebx
+801043cd:	7f ee                	jg     801043bd <read_head+0x2b>
+  }
+  brelse(buf);
+801043cf:	83 ec 0c             	sub    $0xc,%esp
+801043d2:	50                   	push   %eax
+801043d3:	e8 aa c5 ff ff       	call   80100982 <brelse>
+}
+801043d8:	83 c4 10             	add    $0x10,%esp
+801043db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801043de:	c9                   	leave
+801043df:	c3                   	ret
+
+801043e0 <shadowwait>:
+}
+
+// Wait for the writes of the n shadow buffers in b.
+static void
+shadowwait(struct buf **b, int n)
+{
+801043e0:	55                   	push   %ebp
+801043e1:	89 e5                	mov    %esp,%ebp
+801043e3:	56                   	push   %esi
+801043e4:	53                   	push   %ebx
+801043e5:	89 c6                	mov    %eax,%esi
+801043e7:	89 d3                	mov    %edx,%ebx
+  int i;
+
+  while (n > 0) {
+801043e9:	eb 16                	jmp    80104401 <shadowwait+0x21>
+    i = bwaitany(b, n);
+801043eb:	83 ec 08             	sub    $0x8,%esp
+801043ee:	53                   	push   %ebx
+801043ef:	56                   	push   %esi
+801043f0:	e8 25 c5 ff ff       	call   8010091a <bwaitany>
+    b[i] = b[--n];
+801043f5:	83 eb 01             	sub    $0x1,%ebx
+801043f8:	8b 14 9e             	mov    (%esi,%ebx,4),%edx
+801043fb:	89 14 86             	mov    %edx,(%esi,%eax,4)
+801043fe:	83 c4 10             	add    $0x10,%esp
+  while (n > 0) {
+80104401:	85 db                	test   %ebx,%ebx
+80104403:	7f e6                	jg     801043eb <shadowwait+0xb>
+  }
+}
+80104405:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104408:	5b                   	pop    %ebx
+80104409:	5e                   	pop    %esi
+8010440a:	5d                   	pop    %ebp
+8010440b:	c3                   	ret
+
+8010440c <brelseall>:
+{
+8010440c:	55                   	push   %ebp
+8010440d:	89 e5                	mov    %esp,%ebp
+8010440f:	57                   	push   %edi
+80104410:	56                   	push   %esi
+80104411:	53                   	push   %ebx
+80104412:	83 ec 0c             	sub    $0xc,%esp
+80104415:	89 c6                	mov    %eax,%esi
+80104417:	89 d3                	mov    %edx,%ebx
+  while (n > 0) {
+80104419:	eb 22                	jmp    8010443d <brelseall+0x31>
+    i = bwaitany(b, n);
+8010441b:	83 ec 08             	sub    $0x8,%esp
+8010441e:	53                   	push   %ebx
+8010441f:	56                   	push   %esi
+80104420:	e8 f5 c4 ff ff       	call   8010091a <bwaitany>
+    brelse(b[i]);
+80104425:	8d 3c 86             	lea    (%esi,%eax,4),%edi
+80104428:	83 c4 04             	add    $0x4,%esp
+8010442b:	ff 37                	push   (%edi)
+8010442d:	e8 50 c5 ff ff       	call   80100982 <brelse>
+    b[i] = b[--n];
+80104432:	83 eb 01             	sub    $0x1,%ebx
+80104435:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+80104438:	89 07                	mov    %eax,(%edi)
+8010443a:	83 c4 10             	add    $0x10,%esp
+  while (n > 0) {
+8010443d:	85 db                	test   %ebx,%ebx
+8010443f:	7f da                	jg     8010441b <brelseall+0xf>
+}
+80104441:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104444:	5b                   	pop    %ebx
+80104445:	5e                   	pop    %esi
+80104446:	5f                   	pop    %edi
+80104447:	5d                   	pop    %ebp
+80104448:	c3                   	ret
+
+80104449 <write_head>:
+{
+80104449:	55                   	push   %ebp
+8010444a:	89 e5                	mov    %esp,%ebp
+8010444c:	56                   	push   %esi
+8010444d:	53                   	push   %ebx
+8010444e:	89 c3                	mov    %eax,%ebx
+  struct buf *buf = bread(log.dev, log.start);
+80104450:	83 ec 08             	sub    $0x8,%esp
+80104453:	ff 35 b4 1c 12 80    	push   0x80121cb4
+80104459:	ff 35 d0 1c 12 80    	push   0x80121cd0
+8010445f:	e8 dc c3 ff ff       	call   80100840 <bread>
+80104464:	89 c6                	mov    %eax,%esi
+  hb->n = lh->n;
+80104466:	8b 03                	mov    (%ebx),%eax
+80104468:	89 46 74             	mov    %eax,0x74(%esi)
+  for (i = 0; i < lh->n; i++) {
+8010446b:	83 c4 10             	add    $0x10,%esp
+8010446e:	b8 00 00 00 00       	mov    $0x0,%eax
+80104473:	eb 0b                	jmp    80104480 <write_head+0x37>
+    hb->block[i] = lh->block[i];
+80104475:	8b 54 83 04          	mov    0x4(%ebx,%eax,4),%edx
+80104479:	89 54 86 78          	mov    %edx,0x78(%esi,%eax,4)
+  for (i = 0; i < lh->n; i++) {
+8010447d:	83 c0 01             	add    $0x1,%eax
+80104480:	39 03                	cmp    %eax,(%ebx)
+80104482:	7f f1                	jg     80104475 <write_head+0x2c>
+  bwrite(buf);
+80104484:	83 ec 0c             	sub    $0xc,%esp
+80104487:	56                   	push   %esi
+80104488:	e8 e1 c3 ff ff       	call   8010086e <bwrite>
+  brelse(buf);
+8010448d:	89 34 24             	mov    %esi,(%esp)
+80104490:	e8 ed c4 ff ff       	call   80100982 <brelse>
+}
+80104495:	83 c4 10             	add    $0x10,%esp
+80104498:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010449b:	5b                   	pop    %ebx
+8010449c:	5e                   	pop    %esi
+8010449d:	5d                   	pop    %ebp
+8010449e:	c3                   	ret
+
+8010449f <checkpoint>:
+checkpoint(void)
+{
+  struct buf *b[LOGSIZE];
+  int i, j, n;
+
+  if (log.dlh.n == 0)
+8010449f:	83 3d 50 1d 12 80 00 	cmpl   $0x0,0x80121d50
+801044a6:	74 18                	je     801044c0 <checkpoint+0x21>
+{
+801044a8:	55                   	push   %ebp
+801044a9:	89 e5                	mov    %esp,%ebp
+801044ab:	57                   	push   %edi
+801044ac:	56                   	push   %esi
+801044ad:	53                   	push   %ebx
+801044ae:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+    return;
+  n = 0;
+801044b4:	be 00 00 00 00       	mov    $0x0,%esi
+  for (i = 0; i < log.dlh.n; i++) {
+801044b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+801044be:	eb 04                	jmp    801044c4 <checkpoint+0x25>
+801044c0:	c3                   	ret
+801044c1:	83 c3 01             	add    $0x1,%ebx
+801044c4:	39 1d 50 1d 12 80    	cmp    %ebx,0x80121d50
+801044ca:	7e 41                	jle    8010450d <checkpoint+0x6e>
+    if (!latest(&log.dlh, i))
+801044cc:	89 da                	mov    %ebx,%edx
+801044ce:	b8 50 1d 12 80       	mov    $0x80121d50,%eax
+801044d3:	e8 87 fe ff ff       	call   8010435f <latest>
+801044d8:	85 c0                	test   %eax,%eax
+801044da:	74 e5                	je     801044c1 <checkpoint+0x22>
+      continue;
+    b[n] = shadow[i];
+801044dc:	8b 04 9d e0 1d 12 80 	mov    -0x7fede220(,%ebx,4),%eax
+801044e3:	89 84 b5 70 ff ff ff 	mov    %eax,-0x90(%ebp,%esi,4)
+    b[n]->blockno = log.dlh.block[i];
+801044ea:	8b 14 9d 54 1d 12 80 	mov    -0x7fede2ac(,%ebx,4),%edx
+801044f1:	89 50 08             	mov    %edx,0x8(%eax)
+    bawrite(b[n++]);
+801044f4:	8d 7e 01             	lea    0x1(%esi),%edi
+801044f7:	83 ec 0c             	sub    $0xc,%esp
+801044fa:	ff b4 b5 70 ff ff ff 	push   -0x90(%ebp,%esi,4)
+80104501:	e8 d5 c3 ff ff       	call   801008db <bawrite>
+80104506:	83 c4 10             	add    $0x10,%esp
+80104509:	89 fe                	mov    %edi,%esi
+8010450b:	eb b4                	jmp    801044c1 <checkpoint+0x22>
+  }
+  shadowwait(b, n);
+8010450d:	89 f2                	mov    %esi,%edx
+8010450f:	8d 85 70 ff ff ff    	lea    -0x90(%ebp),%eax
+80104515:	e8 c6 fe ff ff       	call   801043e0 <shadowwait>
+
+  for (i = 0; i < log.dlh.n; i++) {
+8010451a:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010451f:	eb 29                	jmp    8010454a <checkpoint+0xab>
+    b[0] = bread(log.dev, log.dlh.block[i]);
+    acquire(&log.lock);
+    for (j = 0; j < log.lh.n; j++)
+      if (log.lh.block[j] == b[0]->blockno)
+        break;
+    if (j == log.lh.n)
+80104521:	39 c2                	cmp    %eax,%edx
+80104523:	0f 84 8d 00 00 00    	je     801045b6 <checkpoint+0x117>
+      b[0]->flags &= ~B_DIRTY;
+    release(&log.lock);
+80104529:	83 ec 0c             	sub    $0xc,%esp
+8010452c:	68 80 1c 12 80       	push   $0x80121c80
+80104531:	e8 c1 35 00 00       	call   80107af7 <release>
+    brelse(b[0]);
+80104536:	83 c4 04             	add    $0x4,%esp
+80104539:	ff b5 70 ff ff ff    	push   -0x90(%ebp)
+8010453f:	e8 3e c4 ff ff       	call   80100982 <brelse>
+80104544:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < log.dlh.n; i++) {
+80104547:	83 c3 01             	add    $0x1,%ebx
+8010454a:	39 1d 50 1d 12 80    	cmp    %ebx,0x80121d50
+80104550:	7e 76                	jle    801045c8 <checkpoint+0x129>
+    if (!latest(&log.dlh, i))
+80104552:	89 da                	mov    %ebx,%edx
+80104554:	b8 50 1d 12 80       	mov    $0x80121d50,%eax
+80104559:	e8 01 fe ff ff       	call   8010435f <latest>
+8010455e:	85 c0                	test   %eax,%eax
+80104560:	74 e5                	je     80104547 <checkpoint+0xa8>
+    b[0] = bread(log.dev, log.dlh.block[i]);
+80104562:	83 ec 08             	sub    $0x8,%esp
+80104565:	ff 34 9d 54 1d 12 80 	push   -0x7fede2ac(,%ebx,4)
+8010456c:	ff 35 d0 1c 12 80    	push   0x80121cd0
+80104572:	e8 c9 c2 ff ff       	call   80100840 <bread>
+80104577:	89 85 70 ff ff ff    	mov    %eax,-0x90(%ebp)
+    acquire(&log.lock);
+8010457d:	c7 04 24 80 1c 12 80 	movl   $0x80121c80,(%esp)
+80104584:	e8 09 35 00 00       	call   80107a92 <acquire>
+    for (j = 0; j < log.lh.n; j++)
+80104589:	83 c4 10             	add    $0x10,%esp
+8010458c:	b8 00 00 00 00       	mov    $0x0,%eax
+80104591:	8b 15 d4 1c 12 80    	mov    0x80121cd4,%edx
+80104597:	39 c2                	cmp    %eax,%edx
+80104599:	7e 86                	jle    80104521 <checkpoint+0x82>
+      if (log.lh.block[j] == b[0]->blockno)
+8010459b:	8b 8d 70 ff ff ff    	mov    -0x90(%ebp),%ecx
+801045a1:	8b 79 08             	mov    0x8(%ecx),%edi
+801045a4:	39 3c 85 d8 1c 12 80 	cmp    %edi,-0x7fede328(,%eax,4)
+801045ab:	0f 84 70 ff ff ff    	je     80104521 <checkpoint+0x82>
+    for (j = 0; j < log.lh.n; j++)
+801045b1:	83 c0 01             	add    $0x1,%eax
+801045b4:	eb db                	jmp    80104591 <checkpoint+0xf2>
+      b[0]->flags &= ~B_DIRTY;
+801045b6:	8b 95 70 ff ff ff    	mov    -0x90(%ebp),%edx
+801045bc:	8b 02                	mov    (%edx),%eax
+801045be:	83 e0 fb             	and    $0xfffffffb,%eax
+801045c1:	89 02                	mov    %eax,(%edx)
+801045c3:	e9 61 ff ff ff       	jmp    80104529 <checkpoint+0x8a>
+  }
+
+  log.dlh.n = 0;
+801045c8:	c7 05 50 1d 12 80 00 	movl   $0x0,0x80121d50
+801045cf:	00 00 00 
+  write_head(&log.dlh); // Erase the checkpointed blocks from the log
+801045d2:	b8 50 1d 12 80       	mov    $0x80121d50,%eax
+801045d7:	e8 6d fe ff ff       	call   80104449 <write_head>
+}
+801045dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801045df:	5b                   	pop    %ebx
+801045e0:	5e                   	pop    %esi
+801045e1:	5f                   	pop    %edi
+801045e2:	5d                   	pop    %ebp
+801045e3:	c3                   	ret
+
+801045e4 <commit>:
+  if (tail == log.dlh.n)
+801045e4:	39 05 50 1d 12 80    	cmp    %eax,0x80121d50
+801045ea:	74 17                	je     80104603 <commit+0x1f>
+{
+801045ec:	55                   	push   %ebp
+801045ed:	89 e5                	mov    %esp,%ebp
+801045ef:	57                   	push   %edi
+801045f0:	56                   	push   %esi
+801045f1:	53                   	push   %ebx
+801045f2:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+801045f8:	89 c7                	mov    %eax,%edi
+  for (i = tail; i < log.dlh.n; i++) {
+801045fa:	89 c3                	mov    %eax,%ebx
+  n = 0;
+801045fc:	ba 00 00 00 00       	mov    $0x0,%edx
+80104601:	eb 37                	jmp    8010463a <commit+0x56>
+80104603:	c3                   	ret
+    b[n] = shadow[i];
+80104604:	8b 0c 9d e0 1d 12 80 	mov    -0x7fede220(,%ebx,4),%ecx
+8010460b:	89 8c 95 70 ff ff ff 	mov    %ecx,-0x90(%ebp,%edx,4)
+    b[n]->blockno = log.start+i+1;
+80104612:	89 d8                	mov    %ebx,%eax
+80104614:	03 05 b4 1c 12 80    	add    0x80121cb4,%eax
+8010461a:	83 c0 01             	add    $0x1,%eax
+8010461d:	89 41 08             	mov    %eax,0x8(%ecx)
+    bawrite(b[n++]);
+80104620:	8d 72 01             	lea    0x1(%edx),%esi
+80104623:	83 ec 0c             	sub    $0xc,%esp
+80104626:	ff b4 95 70 ff ff ff 	push   -0x90(%ebp,%edx,4)
+8010462d:	e8 a9 c2 ff ff       	call   801008db <bawrite>
+  for (i = tail; i < log.dlh.n; i++) {
+80104632:	83 c3 01             	add    $0x1,%ebx
+80104635:	83 c4 10             	add    $0x10,%esp
+    bawrite(b[n++]);
+80104638:	89 f2                	mov    %esi,%edx
+  for (i = tail; i < log.dlh.n; i++) {
+8010463a:	39 1d 50 1d 12 80    	cmp    %ebx,0x80121d50
+80104640:	7f c2                	jg     80104604 <commit+0x20>
+  shadowwait(b, n);
+80104642:	8d 85 70 ff ff ff    	lea    -0x90(%ebp),%eax
+80104648:	e8 93 fd ff ff       	call   801043e0 <shadowwait>
+  write_head(&log.dlh); // Write header to disk -- the real commit
+8010464d:	b8 50 1d 12 80       	mov    $0x80121d50,%eax
+80104652:	e8 f2 fd ff ff       	call   80104449 <write_head>
+  if (tail == 0)
+80104657:	85 ff                	test   %edi,%edi
+80104659:	75 0a                	jne    80104665 <commit+0x81>
+    log.ckpt = ticks;
+8010465b:	a1 80 34 13 80       	mov    0x80133480,%eax
+80104660:	a3 cc 1c 12 80       	mov    %eax,0x80121ccc
+}
+80104665:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104668:	5b                   	pop    %ebx
+80104669:	5e                   	pop    %esi
+8010466a:	5f                   	pop    %edi
+8010466b:	5d                   	pop    %ebp
+8010466c:	c3                   	ret
+
+8010466d <install_trans>:
+{
+8010466d:	55                   	push   %ebp
+8010466e:	89 e5                	mov    %esp,%ebp
+80104670:	57                   	push   %edi
+80104671:	56                   	push   %esi
+80104672:	53                   	push   %ebx
+80104673:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  n = 0;
+80104679:	bf 00 00 00 00       	mov    $0x0,%edi
+  for (tail = 0; tail < log.lh.n; tail++) {
+8010467e:	bb 00 00 00 00       	mov    $0x0,%ebx
+80104683:	eb 03                	jmp    80104688 <install_trans+0x1b>
+80104685:	83 c3 01             	add    $0x1,%ebx
+80104688:	39 1d d4 1c 12 80    	cmp    %ebx,0x80121cd4
+8010468e:	0f 8e 8b 00 00 00    	jle    8010471f <install_trans+0xb2>
+    if (!latest(&log.lh, tail))
+80104694:	89 da                	mov    %ebx,%edx
+80104696:	b8 d4 1c 12 80       	mov    $0x80121cd4,%eax
+8010469b:	e8 bf fc ff ff       	call   8010435f <latest>
+801046a0:	85 c0                	test   %eax,%eax
+801046a2:	74 e1                	je     80104685 <install_trans+0x18>
+    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
+801046a4:	89 d8                	mov    %ebx,%eax
+801046a6:	03 05 b4 1c 12 80    	add    0x80121cb4,%eax
+801046ac:	83 c0 01             	add    $0x1,%eax
+801046af:	83 ec 08             	sub    $0x8,%esp
+801046b2:	50                   	push   %eax
+801046b3:	ff 35 d0 1c 12 80    	push   0x80121cd0
+801046b9:	e8 82 c1 ff ff       	call   80100840 <bread>
+801046be:	89 c6                	mov    %eax,%esi
+    dbuf[n] = bread(log.dev, log.lh.block[tail]); // read dst
+801046c0:	83 c4 08             	add    $0x8,%esp
+801046c3:	ff 34 9d d8 1c 12 80 	push   -0x7fede328(,%ebx,4)
+801046ca:	ff 35 d0 1c 12 80    	push   0x80121cd0
+801046d0:	e8 6b c1 ff ff       	call   80100840 <bread>
+801046d5:	89 84 bd 70 ff ff ff 	mov    %eax,-0x90(%ebp,%edi,4)
+    memmove(dbuf[n]->data, lbuf->data, BSIZE);  // copy block to dst
+801046dc:	8d 56 74             	lea    0x74(%esi),%edx
+801046df:	83 c0 74             	add    $0x74,%eax
+801046e2:	83 c4 0c             	add    $0xc,%esp
+801046e5:	68 00 02 00 00       	push   $0x200
+801046ea:	52                   	push   %edx
+801046eb:	50                   	push   %eax
+801046ec:	e8 c5 34 00 00       	call   80107bb6 <memmove>
+    bawrite(dbuf[n++]);  // start writing dst to disk
+801046f1:	8d 47 01             	lea    0x1(%edi),%eax
+801046f4:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+801046fa:	83 c4 04             	add    $0x4,%esp
+801046fd:	ff b4 bd 70 ff ff ff 	push   -0x90(%ebp,%edi,4)
+80104704:	e8 d2 c1 ff ff       	call   801008db <bawrite>
+    brelse(lbuf);
+80104709:	89 34 24             	mov    %esi,(%esp)
+8010470c:	e8 71 c2 ff ff       	call   80100982 <brelse>
+80104711:	83 c4 10             	add    $0x10,%esp
+    bawrite(dbuf[n++]);  // start writing dst to disk
+80104714:	8b bd 64 ff ff ff    	mov    -0x9c(%ebp),%edi
+8010471a:	e9 66 ff ff ff       	jmp    80104685 <install_trans+0x18>
+  brelseall(dbuf, n);
+8010471f:	89 fa                	mov    %edi,%edx
+80104721:	8d 85 70 ff ff ff    	lea    -0x90(%ebp),%eax
+80104727:	e8 e0 fc ff ff       	call   8010440c <brelseall>
+}
+8010472c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010472f:	5b                   	pop    %ebx
+80104730:	5e                   	pop    %esi
+80104731:	5f                   	pop    %edi
+80104732:	5d                   	pop    %ebp
+80104733:	c3                   	ret
+
+80104734 <recover_from_log>:
+{
+80104734:	55                   	push   %ebp
+80104735:	89 e5                	mov    %esp,%ebp
+80104737:	83 ec 08             	sub    $0x8,%esp
+  read_head();
+8010473a:	e8 53 fc ff ff       	call   80104392 <read_head>
+  install_trans(); // if committed, copy from log to disk
+8010473f:	e8 29 ff ff ff       	call   8010466d <install_trans>
+  log.lh.n = 0;
+80104744:	c7 05 d4 1c 12 80 00 	movl   $0x0,0x80121cd4
+8010474b:	00 00 00 
+  write_head(&log.lh); // clear the log
+8010474e:	b8 d4 1c 12 80       	mov    $0x80121cd4,%eax
+80104753:	e8 f1 fc ff ff       	call   80104449 <write_head>
+}
+80104758:	c9                   	leave
+80104759:	c3                   	ret
+
+8010475a <snapshot>:
+{
+8010475a:	55                   	push   %ebp
+8010475b:	89 e5                	mov    %esp,%ebp
+8010475d:	57                   	push   %edi
+8010475e:	56                   	push   %esi
+8010475f:	53                   	push   %ebx
+80104760:	83 ec 0c             	sub    $0xc,%esp
+  for (tail = 0; tail < log.lh.n; tail++) {
+80104763:	bb 00 00 00 00       	mov    $0x0,%ebx
+80104768:	eb 62                	jmp    801047cc <snapshot+0x72>
+    b = bread(log.dev, log.lh.block[tail]); // pinned, so cached
+8010476a:	8d 7b 14             	lea    0x14(%ebx),%edi
+8010476d:	83 ec 08             	sub    $0x8,%esp
+80104770:	ff 34 bd 88 1c 12 80 	push   -0x7fede378(,%edi,4)
+80104777:	ff 35 d0 1c 12 80    	push   0x80121cd0
+8010477d:	e8 be c0 ff ff       	call   80100840 <bread>
+80104782:	89 c6                	mov    %eax,%esi
+    memmove(shadow[log.dlh.n+tail]->data, b->data, BSIZE);
+80104784:	8d 50 74             	lea    0x74(%eax),%edx
+80104787:	89 d8                	mov    %ebx,%eax
+80104789:	03 05 50 1d 12 80    	add    0x80121d50,%eax
+8010478f:	8b 04 85 e0 1d 12 80 	mov    -0x7fede220(,%eax,4),%eax
+80104796:	83 c0 74             	add    $0x74,%eax
+80104799:	83 c4 0c             	add    $0xc,%esp
+8010479c:	68 00 02 00 00       	push   $0x200
+801047a1:	52                   	push   %edx
+801047a2:	50                   	push   %eax
+801047a3:	e8 0e 34 00 00       	call   80107bb6 <memmove>
+    log.dlh.block[log.dlh.n+tail] = log.lh.block[tail];
+801047a8:	89 d8                	mov    %ebx,%eax
+801047aa:	03 05 50 1d 12 80    	add    0x80121d50,%eax
+801047b0:	8b 14 bd 88 1c 12 80 	mov    -0x7fede378(,%edi,4),%edx
+801047b7:	89 14 85 54 1d 12 80 	mov    %edx,-0x7fede2ac(,%eax,4)
+    brelse(b);
+801047be:	89 34 24             	mov    %esi,(%esp)
+801047c1:	e8 bc c1 ff ff       	call   80100982 <brelse>
+  for (tail = 0; tail < log.lh.n; tail++) {
+801047c6:	83 c3 01             	add    $0x1,%ebx
+801047c9:	83 c4 10             	add    $0x10,%esp
+801047cc:	39 1d d4 1c 12 80    	cmp    %ebx,0x80121cd4
+801047d2:	7f 96                	jg     8010476a <snapshot+0x10>
+  acquire(&log.lock);
+801047d4:	83 ec 0c             	sub    $0xc,%esp
+801047d7:	68 80 1c 12 80       	push   $0x80121c80
+801047dc:	e8 b1 32 00 00       	call   80107a92 <acquire>
+  log.dlh.n += log.lh.n;
+801047e1:	a1 d4 1c 12 80       	mov    0x80121cd4,%eax
+801047e6:	01 05 50 1d 12 80    	add    %eax,0x80121d50
+  log.lh.n = 0;
+801047ec:	c7 05 d4 1c 12 80 00 	movl   $0x0,0x80121cd4
+801047f3:	00 00 00 
+  log.committing = 0;
+801047f6:	c7 05 c0 1c 12 80 00 	movl   $0x0,0x80121cc0
+801047fd:	00 00 00 
+  wakeup(&log);
+80104800:	c7 04 24 80 1c 12 80 	movl   $0x80121c80,(%esp)
+80104807:	e8 29 20 00 00       	call   80106835 <wakeup>
+  release(&log.lock);
+8010480c:	c7 04 24 80 1c 12 80 	movl   $0x80121c80,(%esp)
+80104813:	e8 df 32 00 00       	call   80107af7 <release>
+}
+80104818:	83 c4 10             	add    $0x10,%esp
+8010481b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010481e:	5b                   	pop    %ebx
+8010481f:	5e                   	pop    %esi
+80104820:	5f                   	pop    %edi
+80104821:	5d                   	pop    %ebp
+80104822:	c3                   	ret
+
+80104823 <logd>:
+// COMMITTICKS old or begin_op() is out of log space, then
+// waits for its operations to end and commits it.  Also
+// checkpoints the log when it is full or CHECKPOINTTICKS old.
+static void
+logd(void)
+{
+80104823:	55                   	push   %ebp
+80104824:	89 e5                	mov    %esp,%ebp
+80104826:	53                   	push   %ebx
+80104827:	83 ec 04             	sub    $0x4,%esp
+  int i, tail;
+
+  for (i = 0; i < LOGSIZE; i++) {
+8010482a:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010482f:	83 fb 1d             	cmp    $0x1d,%ebx
+80104832:	0f 8f 7a 01 00 00    	jg     801049b2 <logd+0x18f>
+    if ((shadow[i] = bprivate(log.dev)) == 0)
+80104838:	83 ec 0c             	sub    $0xc,%esp
+8010483b:	ff 35 d0 1c 12 80    	push   0x80121cd0
+80104841:	e8 7e c1 ff ff       	call   801009c4 <bprivate>
+80104846:	89 04 9d e0 1d 12 80 	mov    %eax,-0x7fede220(,%ebx,4)
+8010484d:	83 c4 10             	add    $0x10,%esp
+80104850:	85 c0                	test   %eax,%eax
+80104852:	74 14                	je     80104868 <logd+0x45>
+      panic("logd: shadow");
+    acquiresleep(&shadow[i]->lock);
+80104854:	83 ec 0c             	sub    $0xc,%esp
+80104857:	83 c0 0c             	add    $0xc,%eax
+8010485a:	50                   	push   %eax
+8010485b:	e8 8c 2a 00 00       	call   801072ec <acquiresleep>
+  for (i = 0; i < LOGSIZE; i++) {
+80104860:	83 c3 01             	add    $0x1,%ebx
+80104863:	83 c4 10             	add    $0x10,%esp
+80104866:	eb c7                	jmp    8010482f <logd+0xc>
+      panic("logd: shadow");
+80104868:	83 ec 0c             	sub    $0xc,%esp
+8010486b:	68 00 bf 10 80       	push   $0x8010bf00
+80104870:	e8 b6 c4 ff ff       	call   80100d2b <panic>
+            (log.waiting == 0 && ticks - log.first < COMMITTICKS)) &&
+           (log.dlh.n == 0 || ticks - log.ckpt < CHECKPOINTTICKS)) {
+      if (log.lh.n == 0 && log.dlh.n == 0)
+        sleep(&log.lh, &log.lock);
+      else
+        sleep(&ticks, &log.lock);
+80104875:	83 ec 08             	sub    $0x8,%esp
+80104878:	68 80 1c 12 80       	push   $0x80121c80
+8010487d:	68 80 34 13 80       	push   $0x80133480
+80104882:	e8 df 1c 00 00       	call   80106566 <sleep>
+80104887:	83 c4 10             	add    $0x10,%esp
+    while ((log.lh.n == 0 ||
+8010488a:	a1 d4 1c 12 80       	mov    0x80121cd4,%eax
+            (log.waiting == 0 && ticks - log.first < COMMITTICKS)) &&
+8010488f:	85 c0                	test   %eax,%eax
+80104891:	74 1a                	je     801048ad <logd+0x8a>
+    while ((log.lh.n == 0 ||
+80104893:	83 3d c4 1c 12 80 00 	cmpl   $0x0,0x80121cc4
+8010489a:	75 4b                	jne    801048e7 <logd+0xc4>
+            (log.waiting == 0 && ticks - log.first < COMMITTICKS)) &&
+8010489c:	8b 15 80 34 13 80    	mov    0x80133480,%edx
+801048a2:	2b 15 c8 1c 12 80    	sub    0x80121cc8,%edx
+801048a8:	83 fa 01             	cmp    $0x1,%edx
+801048ab:	77 3a                	ja     801048e7 <logd+0xc4>
+           (log.dlh.n == 0 || ticks - log.ckpt < CHECKPOINTTICKS)) {
+801048ad:	8b 15 50 1d 12 80    	mov    0x80121d50,%edx
+            (log.waiting == 0 && ticks - log.first < COMMITTICKS)) &&
+801048b3:	85 d2                	test   %edx,%edx
+801048b5:	74 11                	je     801048c8 <logd+0xa5>
+           (log.dlh.n == 0 || ticks - log.ckpt < CHECKPOINTTICKS)) {
+801048b7:	8b 0d 80 34 13 80    	mov    0x80133480,%ecx
+801048bd:	2b 0d cc 1c 12 80    	sub    0x80121ccc,%ecx
+801048c3:	83 f9 63             	cmp    $0x63,%ecx
+801048c6:	77 1f                	ja     801048e7 <logd+0xc4>
+      if (log.lh.n == 0 && log.dlh.n == 0)
+801048c8:	85 c0                	test   %eax,%eax
+801048ca:	75 a9                	jne    80104875 <logd+0x52>
+801048cc:	85 d2                	test   %edx,%edx
+801048ce:	75 a5                	jne    80104875 <logd+0x52>
+        sleep(&log.lh, &log.lock);
+801048d0:	83 ec 08             	sub    $0x8,%esp
+801048d3:	68 80 1c 12 80       	push   $0x80121c80
+801048d8:	68 d4 1c 12 80       	push   $0x80121cd4
+801048dd:	e8 84 1c 00 00       	call   80106566 <sleep>
+801048e2:	83 c4 10             	add    $0x10,%esp
+801048e5:	eb a3                	jmp    8010488a <logd+0x67>
+    }
+    if (log.lh.n == 0) {
+801048e7:	85 c0                	test   %eax,%eax
+801048e9:	74 5d                	je     80104948 <logd+0x125>
+      checkpoint();
+      continue;
+    }
+    // Make room in the log before holding off operations,
+    // counting what the active ones may still log.
+    if (log.dlh.n + log.lh.n + log.outstanding*MAXOPBLOCKS > log.size - 1 ||
+801048eb:	8b 0d 50 1d 12 80    	mov    0x80121d50,%ecx
+801048f1:	01 c8                	add    %ecx,%eax
+801048f3:	8b 15 bc 1c 12 80    	mov    0x80121cbc,%edx
+801048f9:	8d 14 92             	lea    (%edx,%edx,4),%edx
+801048fc:	8d 04 50             	lea    (%eax,%edx,2),%eax
+801048ff:	39 05 b8 1c 12 80    	cmp    %eax,0x80121cb8
+80104905:	7e 14                	jle    8010491b <logd+0xf8>
+80104907:	85 c9                	test   %ecx,%ecx
+80104909:	7e 31                	jle    8010493c <logd+0x119>
+       (log.dlh.n > 0 && ticks - log.ckpt >= CHECKPOINTTICKS)) {
+8010490b:	a1 80 34 13 80       	mov    0x80133480,%eax
+80104910:	2b 05 cc 1c 12 80    	sub    0x80121ccc,%eax
+80104916:	83 f8 63             	cmp    $0x63,%eax
+80104919:	76 21                	jbe    8010493c <logd+0x119>
+      release(&log.lock);
+8010491b:	83 ec 0c             	sub    $0xc,%esp
+8010491e:	68 80 1c 12 80       	push   $0x80121c80
+80104923:	e8 cf 31 00 00       	call   80107af7 <release>
+      checkpoint();
+80104928:	e8 72 fb ff ff       	call   8010449f <checkpoint>
+      acquire(&log.lock);
+8010492d:	c7 04 24 80 1c 12 80 	movl   $0x80121c80,(%esp)
+80104934:	e8 59 31 00 00       	call   80107a92 <acquire>
+80104939:	83 c4 10             	add    $0x10,%esp
+    }
+    log.committing = 1;
+8010493c:	c7 05 c0 1c 12 80 01 	movl   $0x1,0x80121cc0
+80104943:	00 00 00 
+    while (log.outstanding > 0)
+80104946:	eb 2c                	jmp    80104974 <logd+0x151>
+      release(&log.lock);
+80104948:	83 ec 0c             	sub    $0xc,%esp
+8010494b:	68 80 1c 12 80       	push   $0x80121c80
+80104950:	e8 a2 31 00 00       	call   80107af7 <release>
+      checkpoint();
+80104955:	e8 45 fb ff ff       	call   8010449f <checkpoint>
+      continue;
+8010495a:	83 c4 10             	add    $0x10,%esp
+8010495d:	eb 53                	jmp    801049b2 <logd+0x18f>
+      sleep(&log, &log.lock);
+8010495f:	83 ec 08             	sub    $0x8,%esp
+80104962:	68 80 1c 12 80       	push   $0x80121c80
+80104967:	68 80 1c 12 80       	push   $0x80121c80
+8010496c:	e8 f5 1b 00 00       	call   80106566 <sleep>
+80104971:	83 c4 10             	add    $0x10,%esp
+    while (log.outstanding > 0)
+80104974:	83 3d bc 1c 12 80 00 	cmpl   $0x0,0x80121cbc
+8010497b:	7f e2                	jg     8010495f <logd+0x13c>
+    release(&log.lock);
+8010497d:	83 ec 0c             	sub    $0xc,%esp
+80104980:	68 80 1c 12 80       	push   $0x80121c80
+80104985:	e8 6d 31 00 00       	call   80107af7 <release>
+
+    if (log.dlh.n + log.lh.n > log.size - 1)
+8010498a:	a1 d4 1c 12 80       	mov    0x80121cd4,%eax
+8010498f:	03 05 50 1d 12 80    	add    0x80121d50,%eax
+80104995:	83 c4 10             	add    $0x10,%esp
+80104998:	39 05 b8 1c 12 80    	cmp    %eax,0x80121cb8
+8010499e:	7e 27                	jle    801049c7 <logd+0x1a4>
+      checkpoint();
+    tail = log.dlh.n;
+801049a0:	8b 1d 50 1d 12 80    	mov    0x80121d50,%ebx
+    snapshot();
+801049a6:	e8 af fd ff ff       	call   8010475a <snapshot>
+    commit(tail);
+801049ab:	89 d8                	mov    %ebx,%eax
+801049ad:	e8 32 fc ff ff       	call   801045e4 <commit>
+    acquire(&log.lock);
+801049b2:	83 ec 0c             	sub    $0xc,%esp
+801049b5:	68 80 1c 12 80       	push   $0x80121c80
+801049ba:	e8 d3 30 00 00       	call   80107a92 <acquire>
+    while ((log.lh.n == 0 ||
+801049bf:	83 c4 10             	add    $0x10,%esp
+801049c2:	e9 c3 fe ff ff       	jmp    8010488a <logd+0x67>
+      checkpoint();
+801049c7:	e8 d3 fa ff ff       	call   8010449f <checkpoint>
+801049cc:	eb d2                	jmp    801049a0 <logd+0x17d>
+
+801049ce <initlog>:
+{
+801049ce:	55                   	push   %ebp
+801049cf:	89 e5                	mov    %esp,%ebp
+801049d1:	53                   	push   %ebx
+801049d2:	83 ec 2c             	sub    $0x2c,%esp
+801049d5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&log.lock, "log");
+801049d8:	68 0d bf 10 80       	push   $0x8010bf0d
+801049dd:	68 80 1c 12 80       	push   $0x80121c80
+801049e2:	e8 67 2f 00 00       	call   8010794e <initlock>
+  readsb(dev, &sb);
+801049e7:	83 c4 08             	add    $0x8,%esp
+801049ea:	8d 45 dc             	lea    -0x24(%ebp),%eax
+801049ed:	50                   	push   %eax
+801049ee:	53                   	push   %ebx
+801049ef:	e8 1a d3 ff ff       	call   80101d0e <readsb>
+  log.start = sb.logstart;
+801049f4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+801049f7:	a3 b4 1c 12 80       	mov    %eax,0x80121cb4
+  log.size = sb.nlog;
+801049fc:	8b 45 e8             	mov    -0x18(%ebp),%eax
+801049ff:	a3 b8 1c 12 80       	mov    %eax,0x80121cb8
+  log.dev = dev;
+80104a04:	89 1d d0 1c 12 80    	mov    %ebx,0x80121cd0
+  recover_from_log();
+80104a0a:	e8 25 fd ff ff       	call   80104734 <recover_from_log>
+  if(kthread("logd", logd) < 0)
+80104a0f:	83 c4 08             	add    $0x8,%esp
+80104a12:	68 23 48 10 80       	push   $0x80104823
+80104a17:	68 1a bf 10 80       	push   $0x8010bf1a
+80104a1c:	e8 49 14 00 00       	call   80105e6a <kthread>
+80104a21:	83 c4 10             	add    $0x10,%esp
+80104a24:	85 c0                	test   %eax,%eax
+80104a26:	78 05                	js     80104a2d <initlog+0x5f>
+}
+80104a28:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104a2b:	c9                   	leave
+80104a2c:	c3                   	ret
+    panic("initlog: logd");
+80104a2d:	83 ec 0c             	sub    $0xc,%esp
+80104a30:	68 11 bf 10 80       	push   $0x8010bf11
+80104a35:	e8 f1 c2 ff ff       	call   80100d2b <panic>
+
+80104a3a <begin_op>:
+{
+80104a3a:	55                   	push   %ebp
+80104a3b:	89 e5                	mov    %esp,%ebp
+80104a3d:	83 ec 14             	sub    $0x14,%esp
+  acquire(&log.lock);
+80104a40:	68 80 1c 12 80       	push   $0x80121c80
+80104a45:	e8 48 30 00 00       	call   80107a92 <acquire>
+80104a4a:	83 c4 10             	add    $0x10,%esp
+80104a4d:	eb 15                	jmp    80104a64 <begin_op+0x2a>
+      sleep(&log, &log.lock);
+80104a4f:	83 ec 08             	sub    $0x8,%esp
+80104a52:	68 80 1c 12 80       	push   $0x80121c80
+80104a57:	68 80 1c 12 80       	push   $0x80121c80
+80104a5c:	e8 05 1b 00 00       	call   80106566 <sleep>
+80104a61:	83 c4 10             	add    $0x10,%esp
+    if(log.committing){
+80104a64:	83 3d c0 1c 12 80 00 	cmpl   $0x0,0x80121cc0
+80104a6b:	75 e2                	jne    80104a4f <begin_op+0x15>
+    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
+80104a6d:	a1 bc 1c 12 80       	mov    0x80121cbc,%eax
+80104a72:	83 c0 01             	add    $0x1,%eax
+80104a75:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+80104a78:	8d 14 09             	lea    (%ecx,%ecx,1),%edx
+80104a7b:	03 15 d4 1c 12 80    	add    0x80121cd4,%edx
+80104a81:	83 fa 1e             	cmp    $0x1e,%edx
+80104a84:	7e 31                	jle    80104ab7 <begin_op+0x7d>
+      log.waiting++;
+80104a86:	a1 c4 1c 12 80       	mov    0x80121cc4,%eax
+80104a8b:	83 c0 01             	add    $0x1,%eax
+80104a8e:	a3 c4 1c 12 80       	mov    %eax,0x80121cc4
+      sleep(&log, &log.lock);
+80104a93:	83 ec 08             	sub    $0x8,%esp
+80104a96:	68 80 1c 12 80       	push   $0x80121c80
+80104a9b:	68 80 1c 12 80       	push   $0x80121c80
+80104aa0:	e8 c1 1a 00 00       	call   80106566 <sleep>
+      log.waiting--;
+80104aa5:	a1 c4 1c 12 80       	mov    0x80121cc4,%eax
+80104aaa:	83 e8 01             	sub    $0x1,%eax
+80104aad:	a3 c4 1c 12 80       	mov    %eax,0x80121cc4
+80104ab2:	83 c4 10             	add    $0x10,%esp
+80104ab5:	eb ad                	jmp    80104a64 <begin_op+0x2a>
+      log.outstanding += 1;
+80104ab7:	a3 bc 1c 12 80       	mov    %eax,0x80121cbc
+      release(&log.lock);
+80104abc:	83 ec 0c             	sub    $0xc,%esp
+80104abf:	68 80 1c 12 80       	push   $0x80121c80
+80104ac4:	e8 2e 30 00 00       	call   80107af7 <release>
+}
+80104ac9:	83 c4 10             	add    $0x10,%esp
+80104acc:	c9                   	leave
+80104acd:	c3                   	ret
+
+80104ace <end_op>:
+{
+80104ace:	55                   	push   %ebp
+80104acf:	89 e5                	mov    %esp,%ebp
+80104ad1:	83 ec 14             	sub    $0x14,%esp
+  acquire(&log.lock);
+80104ad4:	68 80 1c 12 80       	push   $0x80121c80
+80104ad9:	e8 b4 2f 00 00       	call   80107a92 <acquire>
+  log.outstanding -= 1;
+80104ade:	a1 bc 1c 12 80       	mov    0x80121cbc,%eax
+80104ae3:	83 e8 01             	sub    $0x1,%eax
+80104ae6:	a3 bc 1c 12 80       	mov    %eax,0x80121cbc
+  wakeup(&log);
+80104aeb:	c7 04 24 80 1c 12 80 	movl   $0x80121c80,(%esp)
+80104af2:	e8 3e 1d 00 00       	call   80106835 <wakeup>
+  release(&log.lock);
+80104af7:	c7 04 24 80 1c 12 80 	movl   $0x80121c80,(%esp)
+80104afe:	e8 f4 2f 00 00       	call   80107af7 <release>
+}
+80104b03:	83 c4 10             	add    $0x10,%esp
+80104b06:	c9                   	leave
+80104b07:	c3                   	ret
+
+80104b08 <log_write>:
+//   modify bp->data[]
+//   log_write(bp)
+//   brelse(bp)
+void
+log_write(struct buf *b)
+{
+80104b08:	55                   	push   %ebp
+80104b09:	89 e5                	mov    %esp,%ebp
+80104b0b:	53                   	push   %ebx
+80104b0c:	83 ec 04             	sub    $0x4,%esp
+80104b0f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int i;
+
+  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+80104b12:	8b 15 d4 1c 12 80    	mov    0x80121cd4,%edx
+80104b18:	83 fa 1d             	cmp    $0x1d,%edx
+80104b1b:	7f 2c                	jg     80104b49 <log_write+0x41>
+80104b1d:	a1 b8 1c 12 80       	mov    0x80121cb8,%eax
+80104b22:	83 e8 01             	sub    $0x1,%eax
+80104b25:	39 c2                	cmp    %eax,%edx
+80104b27:	7d 20                	jge    80104b49 <log_write+0x41>
+    panic("too big a transaction");
+  if (log.outstanding < 1)
+80104b29:	83 3d bc 1c 12 80 00 	cmpl   $0x0,0x80121cbc
+80104b30:	7e 24                	jle    80104b56 <log_write+0x4e>
+    panic("log_write outside of trans");
+
+  acquire(&log.lock);
+80104b32:	83 ec 0c             	sub    $0xc,%esp
+80104b35:	68 80 1c 12 80       	push   $0x80121c80
+80104b3a:	e8 53 2f 00 00       	call   80107a92 <acquire>
+  for (i = 0; i < log.lh.n; i++) {
+80104b3f:	83 c4 10             	add    $0x10,%esp
+80104b42:	b8 00 00 00 00       	mov    $0x0,%eax
+80104b47:	eb 1d                	jmp    80104b66 <log_write+0x5e>
+    panic("too big a transaction");
+80104b49:	83 ec 0c             	sub    $0xc,%esp
+80104b4c:	68 1f bf 10 80       	push   $0x8010bf1f
+80104b51:	e8 d5 c1 ff ff       	call   80100d2b <panic>
+    panic("log_write outside of trans");
+80104b56:	83 ec 0c             	sub    $0xc,%esp
+80104b59:	68 35 bf 10 80       	push   $0x8010bf35
+80104b5e:	e8 c8 c1 ff ff       	call   80100d2b <panic>
+  for (i = 0; i < log.lh.n; i++) {
+80104b63:	83 c0 01             	add    $0x1,%eax
+80104b66:	8b 15 d4 1c 12 80    	mov    0x80121cd4,%edx
+80104b6c:	39 c2                	cmp    %eax,%edx
+80104b6e:	7e 0c                	jle    80104b7c <log_write+0x74>
+    if (log.lh.block[i] == b->blockno)   // log absorbtion
+80104b70:	8b 4b 08             	mov    0x8(%ebx),%ecx
+80104b73:	39 0c 85 d8 1c 12 80 	cmp    %ecx,-0x7fede328(,%eax,4)
+80104b7a:	75 e7                	jne    80104b63 <log_write+0x5b>
+      break;
+  }
+  log.lh.block[i] = b->blockno;
+80104b7c:	8b 4b 08             	mov    0x8(%ebx),%ecx
+80104b7f:	89 0c 85 d8 1c 12 80 	mov    %ecx,-0x7fede328(,%eax,4)
+  if (i == log.lh.n) {
+80104b86:	39 c2                	cmp    %eax,%edx
+80104b88:	74 1c                	je     80104ba6 <log_write+0x9e>
+      log.first = ticks;
+      wakeup(&log.lh);  // logd
+    }
+    log.lh.n++;
+  }
+  b->flags |= B_DIRTY; // prevent eviction
+80104b8a:	8b 03                	mov    (%ebx),%eax
+80104b8c:	83 c8 04             	or     $0x4,%eax
+80104b8f:	89 03                	mov    %eax,(%ebx)
+  release(&log.lock);
+80104b91:	83 ec 0c             	sub    $0xc,%esp
+80104b94:	68 80 1c 12 80       	push   $0x80121c80
+80104b99:	e8 59 2f 00 00       	call   80107af7 <release>
+}
+80104b9e:	83 c4 10             	add    $0x10,%esp
+80104ba1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104ba4:	c9                   	leave
+80104ba5:	c3                   	ret
+    if (log.lh.n == 0) {
+80104ba6:	85 d2                	test   %edx,%edx
+80104ba8:	74 0f                	je     80104bb9 <log_write+0xb1>
+    log.lh.n++;
+80104baa:	a1 d4 1c 12 80       	mov    0x80121cd4,%eax
+80104baf:	83 c0 01             	add    $0x1,%eax
+80104bb2:	a3 d4 1c 12 80       	mov    %eax,0x80121cd4
+80104bb7:	eb d1                	jmp    80104b8a <log_write+0x82>
+      log.first = ticks;
+80104bb9:	a1 80 34 13 80       	mov    0x80133480,%eax
+80104bbe:	a3 c8 1c 12 80       	mov    %eax,0x80121cc8
+      wakeup(&log.lh);  // logd
+80104bc3:	83 ec 0c             	sub    $0xc,%esp
+80104bc6:	68 d4 1c 12 80       	push   $0x80121cd4
+80104bcb:	e8 65 1c 00 00       	call   80106835 <wakeup>
+80104bd0:	83 c4 10             	add    $0x10,%esp
+80104bd3:	eb d5                	jmp    80104baa <log_write+0xa2>
+
+80104bd5 <startothers>:
+pde_t entrypgdir[];  // For entry.S
+
+// Start the non-boot (AP) processors.
+static void
+startothers(void)
+{
+80104bd5:	55                   	push   %ebp
+80104bd6:	89 e5                	mov    %esp,%ebp
+80104bd8:	53                   	push   %ebx
+80104bd9:	83 ec 08             	sub    $0x8,%esp
+
+  // Write entry code to unused memory at 0x7000.
+  // The linker has placed the image of entryother.S in
+  // _binary_entryother_start.
+  code = P2V(0x7000);
+  memmove(code, _binary_entryother_start, (uint)_binary_entryother_size);
+80104bdc:	68 8a 00 00 00       	push   $0x8a
+80104be1:	68 8c f4 10 80       	push   $0x8010f48c
+80104be6:	68 00 70 00 80       	push   $0x80007000
+80104beb:	e8 c6 2f 00 00       	call   80107bb6 <memmove>
+
+  for(c = cpus; c < cpus+ncpu; c++){
+80104bf0:	83 c4 10             	add    $0x10,%esp
+80104bf3:	bb 80 1e 12 80       	mov    $0x80121e80,%ebx
+80104bf8:	eb 06                	jmp    80104c00 <startothers+0x2b>
+80104bfa:	81 c3 b0 00 00 00    	add    $0xb0,%ebx
+80104c00:	69 05 64 1e 12 80 b0 	imul   $0xb0,0x80121e64,%eax
+80104c07:	00 00 00 
+80104c0a:	05 80 1e 12 80       	add    $0x80121e80,%eax
+80104c0f:	39 c3                	cmp    %eax,%ebx
+80104c11:	73 4c                	jae    80104c5f <startothers+0x8a>
+    if(c == mycpu())  // We've started already.
+80104c13:	e8 7c 10 00 00       	call   80105c94 <mycpu>
+80104c18:	39 c3                	cmp    %eax,%ebx
+80104c1a:	74 de                	je     80104bfa <startothers+0x25>
+      continue;
+
+    // Tell entryother.S what stack to use, where to enter, and what
+    // pgdir to use. We cannot use kpgdir yet, because the AP processor
+    // is running in low  memory, so we use entrypgdir for the APs too.
+    stack = kalloc();
+80104c1c:	e8 03 ec ff ff       	call   80103824 <kalloc>
+    *(void**)(code-4) = stack + KSTACKSIZE;
+80104c21:	05 00 10 00 00       	add    $0x1000,%eax
+80104c26:	a3 fc 6f 00 80       	mov    %eax,0x80006ffc
+    *(void(**)(void))(code-8) = mpenter;
+80104c2b:	c7 05 f8 6f 00 80 a3 	movl   $0x80104ca3,0x80006ff8
+80104c32:	4c 10 80 
+    *(int**)(code-12) = (void *) V2P(entrypgdir);
+80104c35:	c7 05 f4 6f 00 80 00 	movl   $0x10e000,0x80006ff4
+80104c3c:	e0 10 00 
+
+    lapicstartap(c->apicid, V2P(code));
+80104c3f:	83 ec 08             	sub    $0x8,%esp
+80104c42:	68 00 70 00 00       	push   $0x7000
+80104c47:	0f b6 03             	movzbl (%ebx),%eax
+80104c4a:	50                   	push   %eax
+80104c4b:	e8 1c f5 ff ff       	call   8010416c <lapicstartap>
+
+    // wait for cpu to finish mpmain()
+    while(c->started == 0)
+80104c50:	83 c4 10             	add    $0x10,%esp
+80104c53:	8b 83 a0 00 00 00    	mov    0xa0(%ebx),%eax
+80104c59:	85 c0                	test   %eax,%eax
+80104c5b:	74 f6                	je     80104c53 <startothers+0x7e>
+80104c5d:	eb 9b                	jmp    80104bfa <startothers+0x25>
+      ;
+  }
+}
+80104c5f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104c62:	c9                   	leave
+80104c63:	c3                   	ret
+
+80104c64 <mpmain>:
+{
+80104c64:	55                   	push   %ebp
+80104c65:	89 e5                	mov    %esp,%ebp
+80104c67:	53                   	push   %ebx
+80104c68:	83 ec 04             	sub    $0x4,%esp
+  cprintf("cpu%d: starting %d\n", cpuid(), cpuid());
+80104c6b:	e8 80 10 00 00       	call   80105cf0 <cpuid>
+80104c70:	89 c3                	mov    %eax,%ebx
+80104c72:	e8 79 10 00 00       	call   80105cf0 <cpuid>
+80104c77:	83 ec 04             	sub    $0x4,%esp
+80104c7a:	53                   	push   %ebx
+80104c7b:	50                   	push   %eax
+80104c7c:	68 50 bf 10 80       	push   $0x8010bf50
+80104c81:	e8 66 c3 ff ff       	call   80100fec <cprintf>
+  idtinit();       // load idt register
+80104c86:	e8 a5 45 00 00       	call   80109230 <idtinit>
+  xchg(&(mycpu()->started), 1); // tell startothers() we're up
+80104c8b:	e8 04 10 00 00       	call   80105c94 <mycpu>
+80104c90:	89 c2                	mov    %eax,%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+80104c92:	b8 01 00 00 00       	mov    $0x1,%eax
+80104c97:	f0 87 82 a0 00 00 00 	lock xchg %eax,0xa0(%edx)
+  scheduler();     // start running processes
+80104c9e:	e8 e6 14 00 00       	call   80106189 <scheduler>
+
+80104ca3 <mpenter>:
+{
+80104ca3:	55                   	push   %ebp
+80104ca4:	89 e5                	mov    %esp,%ebp
+80104ca6:	83 ec 08             	sub    $0x8,%esp
+  switchkvm();
+80104ca9:	e8 e8 5f 00 00       	call   8010ac96 <switchkvm>
+  seginit();
+80104cae:	e8 6e 5d 00 00       	call   8010aa21 <seginit>
+  lapicinit();
+80104cb3:	e8 70 f3 ff ff       	call   80104028 <lapicinit>
+  mpmain();
+80104cb8:	e8 a7 ff ff ff       	call   80104c64 <mpmain>
+
+80104cbd <main>:
+{
+80104cbd:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+80104cc1:	83 e4 f0             	and    $0xfffffff0,%esp
+80104cc4:	ff 71 fc             	push   -0x4(%ecx)
+80104cc7:	55                   	push   %ebp
+80104cc8:	89 e5                	mov    %esp,%ebp
+80104cca:	51                   	push   %ecx
+80104ccb:	83 ec 0c             	sub    $0xc,%esp
+  kinit1(end, P2V(4*1024*1024)); // phys page allocator
+80104cce:	68 00 00 40 80       	push   $0x80400000
+80104cd3:	68 70 67 13 80       	push   $0x80136770
+80104cd8:	e8 3f ea ff ff       	call   8010371c <kinit1>
+  kvmalloc();      // kernel page table
+80104cdd:	e8 fa 63 00 00       	call   8010b0dc <kvmalloc>
+  mpinit();        // detect other processors
+80104ce2:	e8 4b 05 00 00       	call   80105232 <mpinit>
+  lapicinit();     // interrupt controller
+80104ce7:	e8 3c f3 ff ff       	call   80104028 <lapicinit>
+  seginit();       // segment descriptors
+80104cec:	e8 30 5d 00 00       	call   8010aa21 <seginit>
+  picinit();       // disable pic
+80104cf1:	e8 26 0a 00 00       	call   8010571c <picinit>
+  ioapicinit();    // another interrupt controller
+80104cf6:	e8 be e4 ff ff       	call   801031b9 <ioapicinit>
+  consoleinit();   // console hardware
+80104cfb:	e8 6f c5 ff ff       	call   8010126f <consoleinit>
+  uartinit();      // serial port
+80104d00:	e8 0b 48 00 00       	call   80109510 <uartinit>
+  pinit();         // process table
+80104d05:	e8 70 0f 00 00       	call   80105c7a <pinit>
+  tvinit();        // trap vectors
+80104d0a:	e8 1c 44 00 00       	call   8010912b <tvinit>
+  kmcacheinit();   // slab allocator
+80104d0f:	e8 8f 28 00 00       	call   801075a3 <kmcacheinit>
+  binit();         // buffer cache
+80104d14:	e8 22 ba ff ff       	call   8010073b <binit>
+  pcinit();        // executable page cache
+80104d19:	e8 2d 08 00 00       	call   8010554b <pcinit>
+  fileinit();      // file table
+80104d1e:	e8 a6 c9 ff ff       	call   801016c9 <fileinit>
+  pipeinit();      // pipes
+80104d23:	e8 06 0a 00 00       	call   8010572e <pipeinit>
+  shminit();       // shared memory segments
+80104d28:	e8 d5 21 00 00       	call   80106f02 <shminit>
+  ideinit();       // disk 
+80104d2d:	e8 4f e1 ff ff       	call   80102e81 <ideinit>
+  startothers();   // start other processors
+80104d32:	e8 9e fe ff ff       	call   80104bd5 <startothers>
+  kinit2(P2V(4*1024*1024), P2V(phystop)); // must come after startothers()
+80104d37:	a1 60 1c 12 80       	mov    0x80121c60,%eax
+80104d3c:	05 00 00 00 80       	add    $0x80000000,%eax
+80104d41:	83 c4 08             	add    $0x8,%esp
+80104d44:	50                   	push   %eax
+80104d45:	68 00 00 40 80       	push   $0x80400000
+80104d4a:	e8 b5 ea ff ff       	call   80103804 <kinit2>
+  userinit();      // first user process
+80104d4f:	e8 da 0f 00 00       	call   80105d2e <userinit>
+  mpmain();        // finish this processor's setup
+80104d54:	e8 0b ff ff ff       	call   80104c64 <mpmain>
+
+80104d59 <writeback>:
+
+// Write the dirty pages of shared region v in pgdir back
+// to its file.  Must not be called inside a transaction.
+static void
+writeback(pde_t *pgdir, struct vma *v)
+{
+80104d59:	55                   	push   %ebp
+80104d5a:	89 e5                	mov    %esp,%ebp
+80104d5c:	57                   	push   %edi
+80104d5d:	56                   	push   %esi
+80104d5e:	53                   	push   %ebx
+80104d5f:	83 ec 1c             	sub    $0x1c,%esp
+80104d62:	89 45 d8             	mov    %eax,-0x28(%ebp)
+80104d65:	89 d7                	mov    %edx,%edi
+  int max = ((MAXOPBLOCKS-1-1-2) / 2) * BSIZE;
+  uint a, i, n, n1;
+  char *mem;
+
+  for(a = v->start; a < v->start + v->len; a += PGSIZE){
+80104d67:	8b 02                	mov    (%edx),%eax
+80104d69:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80104d6c:	eb 61                	jmp    80104dcf <writeback+0x76>
+    // to stay within the log's limit for one transaction.
+    for(i = 0; i < n; i += n1){
+      n1 = n - i;
+      if(n1 > max)
+        n1 = max;
+      begin_op();
+80104d6e:	e8 c7 fc ff ff       	call   80104a3a <begin_op>
+      ilock(v->ip);
+80104d73:	83 ec 0c             	sub    $0xc,%esp
+80104d76:	ff 77 0c             	push   0xc(%edi)
+80104d79:	e8 e3 d2 ff ff       	call   80102061 <ilock>
+      writei(v->ip, mem + i, v->off + (a - v->start) + i, n1);
+80104d7e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80104d81:	2b 07                	sub    (%edi),%eax
+80104d83:	03 47 08             	add    0x8(%edi),%eax
+80104d86:	56                   	push   %esi
+80104d87:	01 d8                	add    %ebx,%eax
+80104d89:	50                   	push   %eax
+80104d8a:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80104d8d:	01 d8                	add    %ebx,%eax
+80104d8f:	50                   	push   %eax
+80104d90:	ff 77 0c             	push   0xc(%edi)
+80104d93:	e8 db d6 ff ff       	call   80102473 <writei>
+      iunlock(v->ip);
+80104d98:	83 c4 14             	add    $0x14,%esp
+80104d9b:	ff 77 0c             	push   0xc(%edi)
+80104d9e:	e8 80 d3 ff ff       	call   80102123 <iunlock>
+      end_op();
+80104da3:	e8 26 fd ff ff       	call   80104ace <end_op>
+    for(i = 0; i < n; i += n1){
+80104da8:	01 f3                	add    %esi,%ebx
+80104daa:	83 c4 10             	add    $0x10,%esp
+80104dad:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80104db0:	39 c3                	cmp    %eax,%ebx
+80104db2:	73 14                	jae    80104dc8 <writeback+0x6f>
+      n1 = n - i;
+80104db4:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+80104db7:	29 de                	sub    %ebx,%esi
+      if(n1 > max)
+80104db9:	81 fe 00 06 00 00    	cmp    $0x600,%esi
+80104dbf:	76 ad                	jbe    80104d6e <writeback+0x15>
+        n1 = max;
+80104dc1:	be 00 06 00 00       	mov    $0x600,%esi
+80104dc6:	eb a6                	jmp    80104d6e <writeback+0x15>
+  for(a = v->start; a < v->start + v->len; a += PGSIZE){
+80104dc8:	81 45 e0 00 10 00 00 	addl   $0x1000,-0x20(%ebp)
+80104dcf:	8b 47 04             	mov    0x4(%edi),%eax
+80104dd2:	03 07                	add    (%edi),%eax
+80104dd4:	39 45 e0             	cmp    %eax,-0x20(%ebp)
+80104dd7:	73 3a                	jae    80104e13 <writeback+0xba>
+    if((mem = uvmclean(pgdir, a)) == 0)
+80104dd9:	83 ec 08             	sub    $0x8,%esp
+80104ddc:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80104ddf:	53                   	push   %ebx
+80104de0:	ff 75 d8             	push   -0x28(%ebp)
+80104de3:	e8 98 68 00 00       	call   8010b680 <uvmclean>
+80104de8:	89 c2                	mov    %eax,%edx
+80104dea:	83 c4 10             	add    $0x10,%esp
+80104ded:	85 c0                	test   %eax,%eax
+80104def:	74 d7                	je     80104dc8 <writeback+0x6f>
+    n = v->start + v->len - a;
+80104df1:	8b 47 04             	mov    0x4(%edi),%eax
+80104df4:	03 07                	add    (%edi),%eax
+80104df6:	29 d8                	sub    %ebx,%eax
+80104df8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(n > PGSIZE)
+80104dfb:	3d 00 10 00 00       	cmp    $0x1000,%eax
+80104e00:	76 07                	jbe    80104e09 <writeback+0xb0>
+      n = PGSIZE;
+80104e02:	c7 45 e4 00 10 00 00 	movl   $0x1000,-0x1c(%ebp)
+    for(i = 0; i < n; i += n1){
+80104e09:	bb 00 00 00 00       	mov    $0x0,%ebx
+80104e0e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+80104e11:	eb 9a                	jmp    80104dad <writeback+0x54>
+    }
+  }
+}
+80104e13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104e16:	5b                   	pop    %ebx
+80104e17:	5e                   	pop    %esi
+80104e18:	5f                   	pop    %edi
+80104e19:	5d                   	pop    %ebp
+80104e1a:	c3                   	ret
+
+80104e1b <mmap>:
+{
+80104e1b:	55                   	push   %ebp
+80104e1c:	89 e5                	mov    %esp,%ebp
+80104e1e:	57                   	push   %edi
+80104e1f:	56                   	push   %esi
+80104e20:	53                   	push   %ebx
+80104e21:	83 ec 1c             	sub    $0x1c,%esp
+80104e24:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *curproc = myproc();
+80104e27:	e8 df 0e 00 00       	call   80105d0b <myproc>
+  if(curproc->borrowed || f->type != FD_INODE || !f->readable)
+80104e2c:	8b b8 a4 00 00 00    	mov    0xa4(%eax),%edi
+80104e32:	85 ff                	test   %edi,%edi
+80104e34:	0f 85 42 01 00 00    	jne    80104f7c <mmap+0x161>
+80104e3a:	89 c6                	mov    %eax,%esi
+80104e3c:	83 3b 02             	cmpl   $0x2,(%ebx)
+80104e3f:	0f 85 3e 01 00 00    	jne    80104f83 <mmap+0x168>
+80104e45:	80 7b 08 00          	cmpb   $0x0,0x8(%ebx)
+80104e49:	0f 84 3b 01 00 00    	je     80104f8a <mmap+0x16f>
+  if(!(prot & PROT_READ) || !(flags & MAP_SHARED) == !(flags & MAP_PRIVATE))
+80104e4f:	f6 45 14 01          	testb  $0x1,0x14(%ebp)
+80104e53:	0f 84 38 01 00 00    	je     80104f91 <mmap+0x176>
+80104e59:	8b 4d 18             	mov    0x18(%ebp),%ecx
+80104e5c:	83 e1 01             	and    $0x1,%ecx
+80104e5f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+80104e62:	0f 95 c2             	setne  %dl
+80104e65:	f6 45 18 02          	testb  $0x2,0x18(%ebp)
+80104e69:	0f 94 c0             	sete   %al
+80104e6c:	38 c2                	cmp    %al,%dl
+80104e6e:	0f 85 24 01 00 00    	jne    80104f98 <mmap+0x17d>
+  if((prot & PROT_WRITE) && (flags & MAP_SHARED) && !f->writable)
+80104e74:	8b 45 14             	mov    0x14(%ebp),%eax
+80104e77:	83 e0 02             	and    $0x2,%eax
+80104e7a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80104e7d:	74 0e                	je     80104e8d <mmap+0x72>
+80104e7f:	85 c9                	test   %ecx,%ecx
+80104e81:	74 0a                	je     80104e8d <mmap+0x72>
+80104e83:	80 7b 09 00          	cmpb   $0x0,0x9(%ebx)
+80104e87:	0f 84 12 01 00 00    	je     80104f9f <mmap+0x184>
+  if(len == 0 || off % PGSIZE != 0 || off + len < off)
+80104e8d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+80104e91:	0f 84 0f 01 00 00    	je     80104fa6 <mmap+0x18b>
+80104e97:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+80104e9e:	0f 85 09 01 00 00    	jne    80104fad <mmap+0x192>
+80104ea4:	8b 45 10             	mov    0x10(%ebp),%eax
+80104ea7:	03 45 0c             	add    0xc(%ebp),%eax
+80104eaa:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80104ead:	0f 82 01 01 00 00    	jb     80104fb4 <mmap+0x199>
+  ilock(f->ip);
+80104eb3:	83 ec 0c             	sub    $0xc,%esp
+80104eb6:	ff 73 10             	push   0x10(%ebx)
+80104eb9:	e8 a3 d1 ff ff       	call   80102061 <ilock>
+  bad = f->ip->type != T_FILE || off + len > f->ip->size;
+80104ebe:	8b 43 10             	mov    0x10(%ebx),%eax
+80104ec1:	83 c4 10             	add    $0x10,%esp
+80104ec4:	66 83 78 50 02       	cmpw   $0x2,0x50(%eax)
+80104ec9:	0f 84 90 00 00 00    	je     80104f5f <mmap+0x144>
+80104ecf:	bf 01 00 00 00       	mov    $0x1,%edi
+  iunlock(f->ip);
+80104ed4:	83 ec 0c             	sub    $0xc,%esp
+80104ed7:	50                   	push   %eax
+80104ed8:	e8 46 d2 ff ff       	call   80102123 <iunlock>
+  if(bad)
+80104edd:	83 c4 10             	add    $0x10,%esp
+80104ee0:	85 ff                	test   %edi,%edi
+80104ee2:	0f 85 d3 00 00 00    	jne    80104fbb <mmap+0x1a0>
+  if((va = vmagap(curproc->vma, len)) == 0 || (v = vmaslot(curproc->vma)) == 0)
+80104ee8:	81 c6 a8 00 00 00    	add    $0xa8,%esi
+80104eee:	83 ec 08             	sub    $0x8,%esp
+80104ef1:	ff 75 10             	push   0x10(%ebp)
+80104ef4:	56                   	push   %esi
+80104ef5:	e8 d2 64 00 00       	call   8010b3cc <vmagap>
+80104efa:	89 c7                	mov    %eax,%edi
+80104efc:	83 c4 10             	add    $0x10,%esp
+80104eff:	85 c0                	test   %eax,%eax
+80104f01:	74 72                	je     80104f75 <mmap+0x15a>
+80104f03:	83 ec 0c             	sub    $0xc,%esp
+80104f06:	56                   	push   %esi
+80104f07:	e8 35 64 00 00       	call   8010b341 <vmaslot>
+80104f0c:	89 c6                	mov    %eax,%esi
+80104f0e:	83 c4 10             	add    $0x10,%esp
+80104f11:	85 c0                	test   %eax,%eax
+80104f13:	74 60                	je     80104f75 <mmap+0x15a>
+  v->start = va;
+80104f15:	89 38                	mov    %edi,(%eax)
+  v->len = len;
+80104f17:	8b 45 10             	mov    0x10(%ebp),%eax
+80104f1a:	89 46 04             	mov    %eax,0x4(%esi)
+  v->off = off;
+80104f1d:	8b 45 0c             	mov    0xc(%ebp),%eax
+80104f20:	89 46 08             	mov    %eax,0x8(%esi)
+  v->flags = VMA_MMAP;
+80104f23:	c7 46 14 04 00 00 00 	movl   $0x4,0x14(%esi)
+  if(prot & PROT_WRITE){
+80104f2a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+80104f2e:	74 14                	je     80104f44 <mmap+0x129>
+    v->flags |= VMA_WRITE;
+80104f30:	c7 46 14 05 00 00 00 	movl   $0x5,0x14(%esi)
+    if(flags & MAP_SHARED)
+80104f37:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+80104f3b:	74 07                	je     80104f44 <mmap+0x129>
+      v->flags |= VMA_SHARED;
+80104f3d:	c7 46 14 07 00 00 00 	movl   $0x7,0x14(%esi)
+  v->ip = idup(f->ip);
+80104f44:	83 ec 0c             	sub    $0xc,%esp
+80104f47:	ff 73 10             	push   0x10(%ebx)
+80104f4a:	e8 e2 d0 ff ff       	call   80102031 <idup>
+80104f4f:	89 46 0c             	mov    %eax,0xc(%esi)
+  return va;
+80104f52:	89 f8                	mov    %edi,%eax
+80104f54:	83 c4 10             	add    $0x10,%esp
+}
+80104f57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104f5a:	5b                   	pop    %ebx
+80104f5b:	5e                   	pop    %esi
+80104f5c:	5f                   	pop    %edi
+80104f5d:	5d                   	pop    %ebp
+80104f5e:	c3                   	ret
+  bad = f->ip->type != T_FILE || off + len > f->ip->size;
+80104f5f:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80104f62:	39 50 58             	cmp    %edx,0x58(%eax)
+80104f65:	0f 83 69 ff ff ff    	jae    80104ed4 <mmap+0xb9>
+80104f6b:	bf 01 00 00 00       	mov    $0x1,%edi
+80104f70:	e9 5f ff ff ff       	jmp    80104ed4 <mmap+0xb9>
+    return -1;
+80104f75:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104f7a:	eb db                	jmp    80104f57 <mmap+0x13c>
+    return -1;
+80104f7c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104f81:	eb d4                	jmp    80104f57 <mmap+0x13c>
+80104f83:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104f88:	eb cd                	jmp    80104f57 <mmap+0x13c>
+80104f8a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104f8f:	eb c6                	jmp    80104f57 <mmap+0x13c>
+    return -1;
+80104f91:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104f96:	eb bf                	jmp    80104f57 <mmap+0x13c>
+80104f98:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104f9d:	eb b8                	jmp    80104f57 <mmap+0x13c>
+    return -1;
+80104f9f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104fa4:	eb b1                	jmp    80104f57 <mmap+0x13c>
+    return -1;
+80104fa6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104fab:	eb aa                	jmp    80104f57 <mmap+0x13c>
+80104fad:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104fb2:	eb a3                	jmp    80104f57 <mmap+0x13c>
+80104fb4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104fb9:	eb 9c                	jmp    80104f57 <mmap+0x13c>
+    return -1;
+80104fbb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104fc0:	eb 95                	jmp    80104f57 <mmap+0x13c>
+
+80104fc2 <vmasync>:
+
+// Write back every shared writable region in v.
+void
+vmasync(pde_t *pgdir, struct vma *v)
+{
+80104fc2:	55                   	push   %ebp
+80104fc3:	89 e5                	mov    %esp,%ebp
+80104fc5:	57                   	push   %edi
+80104fc6:	56                   	push   %esi
+80104fc7:	53                   	push   %ebx
+80104fc8:	83 ec 0c             	sub    $0xc,%esp
+80104fcb:	8b 7d 08             	mov    0x8(%ebp),%edi
+80104fce:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int i;
+
+  for(i = 0; i < NVMA; i++)
+80104fd1:	bb 00 00 00 00       	mov    $0x0,%ebx
+80104fd6:	eb 03                	jmp    80104fdb <vmasync+0x19>
+80104fd8:	83 c3 01             	add    $0x1,%ebx
+80104fdb:	83 fb 0f             	cmp    $0xf,%ebx
+80104fde:	7f 21                	jg     80105001 <vmasync+0x3f>
+    if(v[i].ip && (v[i].flags & VMA_SHARED))
+80104fe0:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+80104fe3:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+80104fea:	01 f2                	add    %esi,%edx
+80104fec:	83 7a 0c 00          	cmpl   $0x0,0xc(%edx)
+80104ff0:	74 e6                	je     80104fd8 <vmasync+0x16>
+80104ff2:	f6 42 14 02          	testb  $0x2,0x14(%edx)
+80104ff6:	74 e0                	je     80104fd8 <vmasync+0x16>
+      writeback(pgdir, &v[i]);
+80104ff8:	89 f8                	mov    %edi,%eax
+80104ffa:	e8 5a fd ff ff       	call   80104d59 <writeback>
+80104fff:	eb d7                	jmp    80104fd8 <vmasync+0x16>
+}
+80105001:	83 c4 0c             	add    $0xc,%esp
+80105004:	5b                   	pop    %ebx
+80105005:	5e                   	pop    %esi
+80105006:	5f                   	pop    %edi
+80105007:	5d                   	pop    %ebp
+80105008:	c3                   	ret
+
+80105009 <munmap>:
+
+// Remove the mapping that mmap() placed at addr.
+int
+munmap(uint addr)
+{
+80105009:	55                   	push   %ebp
+8010500a:	89 e5                	mov    %esp,%ebp
+8010500c:	57                   	push   %edi
+8010500d:	56                   	push   %esi
+8010500e:	53                   	push   %ebx
+8010500f:	83 ec 1c             	sub    $0x1c,%esp
+80105012:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct proc *curproc = myproc();
+80105015:	e8 f1 0c 00 00       	call   80105d0b <myproc>
+8010501a:	89 c6                	mov    %eax,%esi
+  struct vma *v;
+
+  if(curproc->borrowed)
+8010501c:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+80105022:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80105025:	85 c0                	test   %eax,%eax
+80105027:	0f 85 8a 00 00 00    	jne    801050b7 <munmap+0xae>
+    return -1;
+  for(v = curproc->vma; v < &curproc->vma[NVMA]; v++)
+8010502d:	8d 9e a8 00 00 00    	lea    0xa8(%esi),%ebx
+80105033:	eb 03                	jmp    80105038 <munmap+0x2f>
+80105035:	83 c3 18             	add    $0x18,%ebx
+80105038:	8d 86 28 02 00 00    	lea    0x228(%esi),%eax
+8010503e:	39 c3                	cmp    %eax,%ebx
+80105040:	73 10                	jae    80105052 <munmap+0x49>
+    if(v->ip && (v->flags & VMA_MMAP) && v->start == addr)
+80105042:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+80105046:	74 ed                	je     80105035 <munmap+0x2c>
+80105048:	f6 43 14 04          	testb  $0x4,0x14(%ebx)
+8010504c:	74 e7                	je     80105035 <munmap+0x2c>
+8010504e:	39 3b                	cmp    %edi,(%ebx)
+80105050:	75 e3                	jne    80105035 <munmap+0x2c>
+      break;
+  if(v == &curproc->vma[NVMA])
+80105052:	39 d8                	cmp    %ebx,%eax
+80105054:	74 6a                	je     801050c0 <munmap+0xb7>
+    return -1;
+  if(v->flags & VMA_SHARED)
+80105056:	f6 43 14 02          	testb  $0x2,0x14(%ebx)
+8010505a:	75 4f                	jne    801050ab <munmap+0xa2>
+    writeback(curproc->pgdir, v);
+  deallocuvm(curproc->pgdir, PGROUNDUP(v->start + v->len), v->start);
+8010505c:	8b 13                	mov    (%ebx),%edx
+8010505e:	89 d0                	mov    %edx,%eax
+80105060:	03 43 04             	add    0x4(%ebx),%eax
+80105063:	05 ff 0f 00 00       	add    $0xfff,%eax
+80105068:	83 ec 04             	sub    $0x4,%esp
+8010506b:	52                   	push   %edx
+8010506c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+80105071:	50                   	push   %eax
+80105072:	ff 76 04             	push   0x4(%esi)
+80105075:	e8 e3 5d 00 00       	call   8010ae5d <deallocuvm>
+  begin_op();
+8010507a:	e8 bb f9 ff ff       	call   80104a3a <begin_op>
+  iput(v->ip);
+8010507f:	83 c4 04             	add    $0x4,%esp
+80105082:	ff 73 0c             	push   0xc(%ebx)
+80105085:	e8 de d0 ff ff       	call   80102168 <iput>
+  end_op();
+8010508a:	e8 3f fa ff ff       	call   80104ace <end_op>
+  v->ip = 0;
+8010508f:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  v->flags = 0;
+80105096:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+  return 0;
+8010509d:	83 c4 10             	add    $0x10,%esp
+}
+801050a0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801050a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801050a6:	5b                   	pop    %ebx
+801050a7:	5e                   	pop    %esi
+801050a8:	5f                   	pop    %edi
+801050a9:	5d                   	pop    %ebp
+801050aa:	c3                   	ret
+    writeback(curproc->pgdir, v);
+801050ab:	8b 46 04             	mov    0x4(%esi),%eax
+801050ae:	89 da                	mov    %ebx,%edx
+801050b0:	e8 a4 fc ff ff       	call   80104d59 <writeback>
+801050b5:	eb a5                	jmp    8010505c <munmap+0x53>
+    return -1;
+801050b7:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+801050be:	eb e0                	jmp    801050a0 <munmap+0x97>
+    return -1;
+801050c0:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+801050c7:	eb d7                	jmp    801050a0 <munmap+0x97>
+
+801050c9 <sum>:
+int ncpu;
+uchar ioapicid;
+
+static uchar
+sum(uchar *addr, int len)
+{
+801050c9:	55                   	push   %ebp
+801050ca:	89 e5                	mov    %esp,%ebp
+801050cc:	56                   	push   %esi
+801050cd:	53                   	push   %ebx
+801050ce:	89 c6                	mov    %eax,%esi
+  int i, sum;
+
+  sum = 0;
+801050d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  for(i=0; i<len; i++)
+801050d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+801050da:	eb 09                	jmp    801050e5 <sum+0x1c>
+    sum += addr[i];
+801050dc:	0f b6 1c 0e          	movzbl (%esi,%ecx,1),%ebx
+801050e0:	01 d8                	add    %ebx,%eax
+  for(i=0; i<len; i++)
+801050e2:	83 c1 01             	add    $0x1,%ecx
+801050e5:	39 d1                	cmp    %edx,%ecx
+801050e7:	7c f3                	jl     801050dc <sum+0x13>
+  return sum;
+}
+801050e9:	5b                   	pop    %ebx
+801050ea:	5e                   	pop    %esi
+801050eb:	5d                   	pop    %ebp
+801050ec:	c3                   	ret
+
+801050ed <mpsearch1>:
+
+// Look for an MP structure in the len bytes at addr.
+static struct mp*
+mpsearch1(uint a, int len)
+{
+801050ed:	55                   	push   %ebp
+801050ee:	89 e5                	mov    %esp,%ebp
+801050f0:	56                   	push   %esi
+801050f1:	53                   	push   %ebx
+  uchar *e, *p, *addr;
+
+  addr = P2V(a);
+801050f2:	8d b0 00 00 00 80    	lea    -0x80000000(%eax),%esi
+801050f8:	89 f3                	mov    %esi,%ebx
+  e = addr+len;
+801050fa:	01 d6                	add    %edx,%esi
+  for(p = addr; p < e; p += sizeof(struct mp))
+801050fc:	eb 03                	jmp    80105101 <mpsearch1+0x14>
+801050fe:	83 c3 10             	add    $0x10,%ebx
+80105101:	39 f3                	cmp    %esi,%ebx
+80105103:	73 29                	jae    8010512e <mpsearch1+0x41>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+80105105:	83 ec 04             	sub    $0x4,%esp
+80105108:	6a 04                	push   $0x4
+8010510a:	68 64 bf 10 80       	push   $0x8010bf64
+8010510f:	53                   	push   %ebx
+80105110:	e8 6c 2a 00 00       	call   80107b81 <memcmp>
+80105115:	83 c4 10             	add    $0x10,%esp
+80105118:	85 c0                	test   %eax,%eax
+8010511a:	75 e2                	jne    801050fe <mpsearch1+0x11>
+8010511c:	ba 10 00 00 00       	mov    $0x10,%edx
+80105121:	89 d8                	mov    %ebx,%eax
+80105123:	e8 a1 ff ff ff       	call   801050c9 <sum>
+80105128:	84 c0                	test   %al,%al
+8010512a:	75 d2                	jne    801050fe <mpsearch1+0x11>
+8010512c:	eb 05                	jmp    80105133 <mpsearch1+0x46>
+      return (struct mp*)p;
+  return 0;
+8010512e:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+80105133:	89 d8                	mov    %ebx,%eax
+80105135:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105138:	5b                   	pop    %ebx
+80105139:	5e                   	pop    %esi
+8010513a:	5d                   	pop    %ebp
+8010513b:	c3                   	ret
+
+8010513c <mpsearch>:
+// 1) in the first KB of the EBDA;
+// 2) in the last KB of system base memory;
+// 3) in the BIOS ROM between 0xE0000 and 0xFFFFF.
+static struct mp*
+mpsearch(void)
+{
+8010513c:	55                   	push   %ebp
+8010513d:	89 e5                	mov    %esp,%ebp
+8010513f:	83 ec 08             	sub    $0x8,%esp
+  uchar *bda;
+  uint p;
+  struct mp *mp;
+
+  bda = (uchar *) P2V(0x400);
+  if((p = ((bda[0x0F]<<8)| bda[0x0E]) << 4)){
+80105142:	0f b6 05 0f 04 00 80 	movzbl 0x8000040f,%eax
+80105149:	c1 e0 08             	shl    $0x8,%eax
+8010514c:	0f b6 15 0e 04 00 80 	movzbl 0x8000040e,%edx
+80105153:	09 d0                	or     %edx,%eax
+80105155:	c1 e0 04             	shl    $0x4,%eax
+80105158:	74 1f                	je     80105179 <mpsearch+0x3d>
+    if((mp = mpsearch1(p, 1024)))
+8010515a:	ba 00 04 00 00       	mov    $0x400,%edx
+8010515f:	e8 89 ff ff ff       	call   801050ed <mpsearch1>
+80105164:	85 c0                	test   %eax,%eax
+80105166:	75 0f                	jne    80105177 <mpsearch+0x3b>
+  } else {
+    p = ((bda[0x14]<<8)|bda[0x13])*1024;
+    if((mp = mpsearch1(p-1024, 1024)))
+      return mp;
+  }
+  return mpsearch1(0xF0000, 0x10000);
+80105168:	ba 00 00 01 00       	mov    $0x10000,%edx
+8010516d:	b8 00 00 0f 00       	mov    $0xf0000,%eax
+80105172:	e8 76 ff ff ff       	call   801050ed <mpsearch1>
+}
+80105177:	c9                   	leave
+80105178:	c3                   	ret
+    p = ((bda[0x14]<<8)|bda[0x13])*1024;
+80105179:	0f b6 05 14 04 00 80 	movzbl 0x80000414,%eax
+80105180:	c1 e0 08             	shl    $0x8,%eax
+80105183:	0f b6 15 13 04 00 80 	movzbl 0x80000413,%edx
+8010518a:	09 d0                	or     %edx,%eax
+8010518c:	c1 e0 0a             	shl    $0xa,%eax
+    if((mp = mpsearch1(p-1024, 1024)))
+8010518f:	2d 00 04 00 00       	sub    $0x400,%eax
+80105194:	ba 00 04 00 00       	mov    $0x400,%edx
+80105199:	e8 4f ff ff ff       	call   801050ed <mpsearch1>
+8010519e:	85 c0                	test   %eax,%eax
+801051a0:	75 d5                	jne    80105177 <mpsearch+0x3b>
+801051a2:	eb c4                	jmp    80105168 <mpsearch+0x2c>
+
+801051a4 <mpconfig>:
+// Check for correct signature, calculate the checksum and,
+// if correct, check the version.
+// To do: check extended table checksum.
+static struct mpconf*
+mpconfig(struct mp **pmp)
+{
+801051a4:	55                   	push   %ebp
+801051a5:	89 e5                	mov    %esp,%ebp
+801051a7:	57                   	push   %edi
+801051a8:	56                   	push   %esi
+801051a9:	53                   	push   %ebx
+801051aa:	83 ec 1c             	sub    $0x1c,%esp
+801051ad:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct mpconf *conf;
+  struct mp *mp;
+
+  if((mp = mpsearch()) == 0 || mp->physaddr == 0)
+801051b0:	e8 87 ff ff ff       	call   8010513c <mpsearch>
+801051b5:	89 c3                	mov    %eax,%ebx
+801051b7:	85 c0                	test   %eax,%eax
+801051b9:	74 5a                	je     80105215 <mpconfig+0x71>
+801051bb:	8b 70 04             	mov    0x4(%eax),%esi
+801051be:	85 f6                	test   %esi,%esi
+801051c0:	74 57                	je     80105219 <mpconfig+0x75>
+    return 0;
+  conf = (struct mpconf*) P2V((uint) mp->physaddr);
+801051c2:	8d be 00 00 00 80    	lea    -0x80000000(%esi),%edi
+  if(memcmp(conf, "PCMP", 4) != 0)
+801051c8:	83 ec 04             	sub    $0x4,%esp
+801051cb:	6a 04                	push   $0x4
+801051cd:	68 69 bf 10 80       	push   $0x8010bf69
+801051d2:	57                   	push   %edi
+801051d3:	e8 a9 29 00 00       	call   80107b81 <memcmp>
+801051d8:	83 c4 10             	add    $0x10,%esp
+801051db:	85 c0                	test   %eax,%eax
+801051dd:	75 3e                	jne    8010521d <mpconfig+0x79>
+    return 0;
+  if(conf->version != 1 && conf->version != 4)
+801051df:	0f b6 86 06 00 00 80 	movzbl -0x7ffffffa(%esi),%eax
+801051e6:	3c 01                	cmp    $0x1,%al
+801051e8:	0f 95 c2             	setne  %dl
+801051eb:	3c 04                	cmp    $0x4,%al
+801051ed:	0f 95 c0             	setne  %al
+801051f0:	84 c2                	test   %al,%dl
+801051f2:	75 30                	jne    80105224 <mpconfig+0x80>
+    return 0;
+  if(sum((uchar*)conf, conf->length) != 0)
+801051f4:	0f b7 96 04 00 00 80 	movzwl -0x7ffffffc(%esi),%edx
+801051fb:	89 f8                	mov    %edi,%eax
+801051fd:	e8 c7 fe ff ff       	call   801050c9 <sum>
+80105202:	84 c0                	test   %al,%al
+80105204:	75 25                	jne    8010522b <mpconfig+0x87>
+    return 0;
+  *pmp = mp;
+80105206:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80105209:	89 18                	mov    %ebx,(%eax)
+  return conf;
+}
+8010520b:	89 f8                	mov    %edi,%eax
+8010520d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105210:	5b                   	pop    %ebx
+80105211:	5e                   	pop    %esi
+80105212:	5f                   	pop    %edi
+80105213:	5d                   	pop    %ebp
+80105214:	c3                   	ret
+    return 0;
+80105215:	89 c7                	mov    %eax,%edi
+80105217:	eb f2                	jmp    8010520b <mpconfig+0x67>
+80105219:	89 f7                	mov    %esi,%edi
+8010521b:	eb ee                	jmp    8010520b <mpconfig+0x67>
+    return 0;
+8010521d:	bf 00 00 00 00       	mov    $0x0,%edi
+80105222:	eb e7                	jmp    8010520b <mpconfig+0x67>
+    return 0;
+80105224:	bf 00 00 00 00       	mov    $0x0,%edi
+80105229:	eb e0                	jmp    8010520b <mpconfig+0x67>
+    return 0;
+8010522b:	bf 00 00 00 00       	mov    $0x0,%edi
+80105230:	eb d9                	jmp    8010520b <mpconfig+0x67>
+
+80105232 <mpinit>:
+
+void
+mpinit(void)
+{
+80105232:	55                   	push   %ebp
+80105233:	89 e5                	mov    %esp,%ebp
+80105235:	57                   	push   %edi
+80105236:	56                   	push   %esi
+80105237:	53                   	push   %ebx
+80105238:	83 ec 1c             	sub    $0x1c,%esp
+  struct mp *mp;
+  struct mpconf *conf;
+  struct mpproc *proc;
+  struct mpioapic *ioapic;
+
+  if((conf = mpconfig(&mp)) == 0)
+8010523b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+8010523e:	e8 61 ff ff ff       	call   801051a4 <mpconfig>
+80105243:	85 c0                	test   %eax,%eax
+80105245:	74 19                	je     80105260 <mpinit+0x2e>
+    panic("Expect to run on an SMP");
+  ismp = 1;
+  lapic = (uint*)conf->lapicaddr;
+80105247:	8b 50 24             	mov    0x24(%eax),%edx
+8010524a:	89 15 68 1c 12 80    	mov    %edx,0x80121c68
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80105250:	8d 50 2c             	lea    0x2c(%eax),%edx
+80105253:	0f b7 48 04          	movzwl 0x4(%eax),%ecx
+80105257:	01 c1                	add    %eax,%ecx
+  ismp = 1;
+80105259:	bb 01 00 00 00       	mov    $0x1,%ebx
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+8010525e:	eb 20                	jmp    80105280 <mpinit+0x4e>
+    panic("Expect to run on an SMP");
+80105260:	83 ec 0c             	sub    $0xc,%esp
+80105263:	68 6e bf 10 80       	push   $0x8010bf6e
+80105268:	e8 be ba ff ff       	call   80100d2b <panic>
+    switch(*p){
+8010526d:	bb 00 00 00 00       	mov    $0x0,%ebx
+80105272:	eb 0c                	jmp    80105280 <mpinit+0x4e>
+80105274:	83 e8 03             	sub    $0x3,%eax
+80105277:	3c 01                	cmp    $0x1,%al
+80105279:	76 1a                	jbe    80105295 <mpinit+0x63>
+8010527b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80105280:	39 ca                	cmp    %ecx,%edx
+80105282:	73 4d                	jae    801052d1 <mpinit+0x9f>
+    switch(*p){
+80105284:	0f b6 02             	movzbl (%edx),%eax
+80105287:	3c 02                	cmp    $0x2,%al
+80105289:	74 38                	je     801052c3 <mpinit+0x91>
+8010528b:	77 e7                	ja     80105274 <mpinit+0x42>
+8010528d:	84 c0                	test   %al,%al
+8010528f:	74 09                	je     8010529a <mpinit+0x68>
+80105291:	3c 01                	cmp    $0x1,%al
+80105293:	75 d8                	jne    8010526d <mpinit+0x3b>
+      p += sizeof(struct mpioapic);
+      continue;
+    case MPBUS:
+    case MPIOINTR:
+    case MPLINTR:
+      p += 8;
+80105295:	83 c2 08             	add    $0x8,%edx
+      continue;
+80105298:	eb e6                	jmp    80105280 <mpinit+0x4e>
+      if(ncpu < NCPU) {
+8010529a:	8b 35 64 1e 12 80    	mov    0x80121e64,%esi
+801052a0:	83 fe 07             	cmp    $0x7,%esi
+801052a3:	7f 19                	jg     801052be <mpinit+0x8c>
+        cpus[ncpu].apicid = proc->apicid;  // apicid may differ from ncpu
+801052a5:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+801052a9:	69 fe b0 00 00 00    	imul   $0xb0,%esi,%edi
+801052af:	88 87 80 1e 12 80    	mov    %al,-0x7fede180(%edi)
+        ncpu++;
+801052b5:	83 c6 01             	add    $0x1,%esi
+801052b8:	89 35 64 1e 12 80    	mov    %esi,0x80121e64
+      p += sizeof(struct mpproc);
+801052be:	83 c2 14             	add    $0x14,%edx
+      continue;
+801052c1:	eb bd                	jmp    80105280 <mpinit+0x4e>
+      ioapicid = ioapic->apicno;
+801052c3:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+801052c7:	a2 60 1e 12 80       	mov    %al,0x80121e60
+      p += sizeof(struct mpioapic);
+801052cc:	83 c2 08             	add    $0x8,%edx
+      continue;
+801052cf:	eb af                	jmp    80105280 <mpinit+0x4e>
+    default:
+      ismp = 0;
+      break;
+    }
+  }
+  if(!ismp)
+801052d1:	85 db                	test   %ebx,%ebx
+801052d3:	74 26                	je     801052fb <mpinit+0xc9>
+    panic("Didn't find a suitable machine");
+
+  if(mp->imcrp){
+801052d5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801052d8:	80 78 0c 00          	cmpb   $0x0,0xc(%eax)
+801052dc:	74 15                	je     801052f3 <mpinit+0xc1>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801052de:	b8 70 00 00 00       	mov    $0x70,%eax
+801052e3:	ba 22 00 00 00       	mov    $0x22,%edx
+801052e8:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801052e9:	ba 23 00 00 00       	mov    $0x23,%edx
+801052ee:	ec                   	in     (%dx),%al
+    // Bochs doesn't support IMCR, so this doesn't run on Bochs.
+    // But it would on real hardware.
+    outb(0x22, 0x70);   // Select IMCR
+    outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+801052ef:	83 c8 01             	or     $0x1,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801052f2:	ee                   	out    %al,(%dx)
+  }
+}
+801052f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801052f6:	5b                   	pop    %ebx
+801052f7:	5e                   	pop    %esi
+801052f8:	5f                   	pop    %edi
+801052f9:	5d                   	pop    %ebp
+801052fa:	c3                   	ret
+    panic("Didn't find a suitable machine");
+801052fb:	83 ec 0c             	sub    $0xc,%esp
+801052fe:	68 88 bf 10 80       	push   $0x8010bf88
+80105303:	e8 23 ba ff ff       	call   80100d2b <panic>
+
+80105308 <pciread>:
+#define PCI_CLASS     0x08   // class, subclass, prog IF, revision
+#define PCI_HEADER    0x0C   // header type in bits 16-23
+
+uint
+pciread(uint tag, int reg)
+{
+80105308:	55                   	push   %ebp
+80105309:	89 e5                	mov    %esp,%ebp
+  outl(PCI_CONFADDR, 0x80000000 | tag | (reg & 0xFC));
+8010530b:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010530e:	25 fc 00 00 00       	and    $0xfc,%eax
+80105313:	0b 45 08             	or     0x8(%ebp),%eax
+80105316:	0d 00 00 00 80       	or     $0x80000000,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010531b:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+80105320:	ef                   	out    %eax,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80105321:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+80105326:	ed                   	in     (%dx),%eax
+  return inl(PCI_CONFDATA);
+}
+80105327:	5d                   	pop    %ebp
+80105328:	c3                   	ret
+
+80105329 <matchid>:
+  return -1;
+}
+
+static int
+matchid(uint tag, uint id)
+{
+80105329:	55                   	push   %ebp
+8010532a:	89 e5                	mov    %esp,%ebp
+8010532c:	83 ec 10             	sub    $0x10,%esp
+  return pciread(tag, PCI_ID) == id;
+8010532f:	6a 00                	push   $0x0
+80105331:	ff 75 08             	push   0x8(%ebp)
+80105334:	e8 cf ff ff ff       	call   80105308 <pciread>
+80105339:	83 c4 10             	add    $0x10,%esp
+8010533c:	3b 45 0c             	cmp    0xc(%ebp),%eax
+8010533f:	0f 94 c0             	sete   %al
+80105342:	0f b6 c0             	movzbl %al,%eax
+}
+80105345:	c9                   	leave
+80105346:	c3                   	ret
+
+80105347 <pciscan>:
+{
+80105347:	55                   	push   %ebp
+80105348:	89 e5                	mov    %esp,%ebp
+8010534a:	57                   	push   %edi
+8010534b:	56                   	push   %esi
+8010534c:	53                   	push   %ebx
+8010534d:	83 ec 1c             	sub    $0x1c,%esp
+80105350:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80105353:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  for(dev = 0; dev < 32; dev++){
+80105356:	bf 00 00 00 00       	mov    $0x0,%edi
+8010535b:	89 fb                	mov    %edi,%ebx
+8010535d:	eb 6c                	jmp    801053cb <pciscan+0x84>
+      if(match(tag, arg))
+8010535f:	83 ec 08             	sub    $0x8,%esp
+80105362:	ff 75 dc             	push   -0x24(%ebp)
+80105365:	57                   	push   %edi
+80105366:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80105369:	ff d0                	call   *%eax
+8010536b:	83 c4 10             	add    $0x10,%esp
+8010536e:	85 c0                	test   %eax,%eax
+80105370:	75 4c                	jne    801053be <pciscan+0x77>
+    for(func = 0; func < nfunc; func++){
+80105372:	83 c6 01             	add    $0x1,%esi
+80105375:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80105378:	39 c6                	cmp    %eax,%esi
+8010537a:	73 4c                	jae    801053c8 <pciscan+0x81>
+      tag = (dev<<11) | (func<<8);
+8010537c:	89 df                	mov    %ebx,%edi
+8010537e:	c1 e7 0b             	shl    $0xb,%edi
+80105381:	89 f0                	mov    %esi,%eax
+80105383:	c1 e0 08             	shl    $0x8,%eax
+80105386:	09 c7                	or     %eax,%edi
+      if((pciread(tag, PCI_ID) & 0xFFFF) == 0xFFFF)
+80105388:	83 ec 08             	sub    $0x8,%esp
+8010538b:	6a 00                	push   $0x0
+8010538d:	57                   	push   %edi
+8010538e:	e8 75 ff ff ff       	call   80105308 <pciread>
+80105393:	83 c4 10             	add    $0x10,%esp
+80105396:	66 83 f8 ff          	cmp    $0xffff,%ax
+8010539a:	74 d6                	je     80105372 <pciscan+0x2b>
+      if(func == 0 && (pciread(tag, PCI_HEADER) & 0x800000))
+8010539c:	85 f6                	test   %esi,%esi
+8010539e:	75 bf                	jne    8010535f <pciscan+0x18>
+801053a0:	83 ec 08             	sub    $0x8,%esp
+801053a3:	6a 0c                	push   $0xc
+801053a5:	57                   	push   %edi
+801053a6:	e8 5d ff ff ff       	call   80105308 <pciread>
+801053ab:	83 c4 10             	add    $0x10,%esp
+801053ae:	a9 00 00 80 00       	test   $0x800000,%eax
+801053b3:	74 aa                	je     8010535f <pciscan+0x18>
+        nfunc = 8;   // multi-function device
+801053b5:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%ebp)
+801053bc:	eb a1                	jmp    8010535f <pciscan+0x18>
+        return tag;
+801053be:	89 f8                	mov    %edi,%eax
+}
+801053c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801053c3:	5b                   	pop    %ebx
+801053c4:	5e                   	pop    %esi
+801053c5:	5f                   	pop    %edi
+801053c6:	5d                   	pop    %ebp
+801053c7:	c3                   	ret
+  for(dev = 0; dev < 32; dev++){
+801053c8:	83 c3 01             	add    $0x1,%ebx
+801053cb:	83 fb 1f             	cmp    $0x1f,%ebx
+801053ce:	77 0e                	ja     801053de <pciscan+0x97>
+    nfunc = 1;
+801053d0:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+    for(func = 0; func < nfunc; func++){
+801053d7:	be 00 00 00 00       	mov    $0x0,%esi
+801053dc:	eb 97                	jmp    80105375 <pciscan+0x2e>
+  return -1;
+801053de:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801053e3:	eb db                	jmp    801053c0 <pciscan+0x79>
+
+801053e5 <matchclass>:
+
+static int
+matchclass(uint tag, uint class)
+{
+801053e5:	55                   	push   %ebp
+801053e6:	89 e5                	mov    %esp,%ebp
+801053e8:	83 ec 10             	sub    $0x10,%esp
+  return (pciread(tag, PCI_CLASS) >> 16) == class;
+801053eb:	6a 08                	push   $0x8
+801053ed:	ff 75 08             	push   0x8(%ebp)
+801053f0:	e8 13 ff ff ff       	call   80105308 <pciread>
+801053f5:	c1 e8 10             	shr    $0x10,%eax
+801053f8:	83 c4 10             	add    $0x10,%esp
+801053fb:	3b 45 0c             	cmp    0xc(%ebp),%eax
+801053fe:	0f 94 c0             	sete   %al
+80105401:	0f b6 c0             	movzbl %al,%eax
+}
+80105404:	c9                   	leave
+80105405:	c3                   	ret
+
+80105406 <pciwrite>:
+{
+80105406:	55                   	push   %ebp
+80105407:	89 e5                	mov    %esp,%ebp
+  outl(PCI_CONFADDR, 0x80000000 | tag | (reg & 0xFC));
+80105409:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010540c:	25 fc 00 00 00       	and    $0xfc,%eax
+80105411:	0b 45 08             	or     0x8(%ebp),%eax
+80105414:	0d 00 00 00 80       	or     $0x80000000,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80105419:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+8010541e:	ef                   	out    %eax,(%dx)
+8010541f:	8b 45 10             	mov    0x10(%ebp),%eax
+80105422:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+80105427:	ef                   	out    %eax,(%dx)
+}
+80105428:	5d                   	pop    %ebp
+80105429:	c3                   	ret
+
+8010542a <pcifindid>:
+
+// Find a device by vendor and device ID.
+int
+pcifindid(ushort vendor, ushort device)
+{
+8010542a:	55                   	push   %ebp
+8010542b:	89 e5                	mov    %esp,%ebp
+8010542d:	83 ec 08             	sub    $0x8,%esp
+  return pciscan(matchid, ((uint)device << 16) | vendor);
+80105430:	0f b7 45 0c          	movzwl 0xc(%ebp),%eax
+80105434:	c1 e0 10             	shl    $0x10,%eax
+80105437:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+8010543b:	09 c2                	or     %eax,%edx
+8010543d:	b8 29 53 10 80       	mov    $0x80105329,%eax
+80105442:	e8 00 ff ff ff       	call   80105347 <pciscan>
+}
+80105447:	c9                   	leave
+80105448:	c3                   	ret
+
+80105449 <pcifindclass>:
+
+// Find a device by class and subclass.
+int
+pcifindclass(uchar class, uchar subclass)
+{
+80105449:	55                   	push   %ebp
+8010544a:	89 e5                	mov    %esp,%ebp
+8010544c:	83 ec 08             	sub    $0x8,%esp
+  return pciscan(matchclass, ((uint)class << 8) | subclass);
+8010544f:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+80105453:	c1 e0 08             	shl    $0x8,%eax
+80105456:	0f b6 55 0c          	movzbl 0xc(%ebp),%edx
+8010545a:	09 c2                	or     %eax,%edx
+8010545c:	b8 e5 53 10 80       	mov    $0x801053e5,%eax
+80105461:	e8 e1 fe ff ff       	call   80105347 <pciscan>
+}
+80105466:	c9                   	leave
+80105467:	c3                   	ret
+
+80105468 <pclookup>:
+}
+
+// Look up a page.  Caller must hold pgcache.lock.
+static struct pcent*
+pclookup(uint dev, uint inum, uint off, uint n)
+{
+80105468:	55                   	push   %ebp
+80105469:	89 e5                	mov    %esp,%ebp
+8010546b:	56                   	push   %esi
+8010546c:	53                   	push   %ebx
+8010546d:	89 c3                	mov    %eax,%ebx
+8010546f:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct pcent *e;
+
+  for(e = pgcache.ent; e < &pgcache.ent[NPGCACHE]; e++)
+80105472:	b8 34 24 12 80       	mov    $0x80122434,%eax
+80105477:	eb 03                	jmp    8010547c <pclookup+0x14>
+80105479:	83 c0 14             	add    $0x14,%eax
+8010547c:	3d 34 2e 12 80       	cmp    $0x80122e34,%eax
+80105481:	73 1b                	jae    8010549e <pclookup+0x36>
+    if(e->page && e->dev == dev && e->inum == inum &&
+80105483:	83 78 10 00          	cmpl   $0x0,0x10(%eax)
+80105487:	74 f0                	je     80105479 <pclookup+0x11>
+80105489:	39 18                	cmp    %ebx,(%eax)
+8010548b:	75 ec                	jne    80105479 <pclookup+0x11>
+8010548d:	39 50 04             	cmp    %edx,0x4(%eax)
+80105490:	75 e7                	jne    80105479 <pclookup+0x11>
+80105492:	39 48 08             	cmp    %ecx,0x8(%eax)
+80105495:	75 e2                	jne    80105479 <pclookup+0x11>
+       e->off == off && e->n == n)
+80105497:	39 70 0c             	cmp    %esi,0xc(%eax)
+8010549a:	75 dd                	jne    80105479 <pclookup+0x11>
+8010549c:	eb 05                	jmp    801054a3 <pclookup+0x3b>
+      return e;
+  return 0;
+8010549e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+801054a3:	5b                   	pop    %ebx
+801054a4:	5e                   	pop    %esi
+801054a5:	5d                   	pop    %ebp
+801054a6:	c3                   	ret
+
+801054a7 <pcvictim>:
+// Choose an entry to reuse, preferring one that is unused or
+// whose page no process has mapped.  Caller must hold
+// pgcache.lock.
+static struct pcent*
+pcvictim(void)
+{
+801054a7:	55                   	push   %ebp
+801054a8:	89 e5                	mov    %esp,%ebp
+801054aa:	56                   	push   %esi
+801054ab:	53                   	push   %ebx
+  struct pcent *e;
+  int i;
+
+  for(i = 0; i < NPGCACHE; i++){
+801054ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+801054b1:	83 fb 7f             	cmp    $0x7f,%ebx
+801054b4:	7f 71                	jg     80105527 <pcvictim+0x80>
+    e = &pgcache.ent[(pgcache.hand + i) % NPGCACHE];
+801054b6:	89 d8                	mov    %ebx,%eax
+801054b8:	03 05 34 2e 12 80    	add    0x80122e34,%eax
+801054be:	99                   	cltd
+801054bf:	c1 ea 19             	shr    $0x19,%edx
+801054c2:	01 d0                	add    %edx,%eax
+801054c4:	83 e0 7f             	and    $0x7f,%eax
+801054c7:	29 d0                	sub    %edx,%eax
+801054c9:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+801054d0:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+801054d3:	8d 34 8d 34 24 12 80 	lea    -0x7feddbcc(,%ecx,4),%esi
+    if(e->page == 0 || krefcnt(e->page) == 1){
+801054da:	8b 04 8d 44 24 12 80 	mov    -0x7feddbbc(,%ecx,4),%eax
+801054e1:	85 c0                	test   %eax,%eax
+801054e3:	74 16                	je     801054fb <pcvictim+0x54>
+801054e5:	83 ec 0c             	sub    $0xc,%esp
+801054e8:	50                   	push   %eax
+801054e9:	e8 89 e8 ff ff       	call   80103d77 <krefcnt>
+801054ee:	83 c4 10             	add    $0x10,%esp
+801054f1:	83 f8 01             	cmp    $0x1,%eax
+801054f4:	74 05                	je     801054fb <pcvictim+0x54>
+  for(i = 0; i < NPGCACHE; i++){
+801054f6:	83 c3 01             	add    $0x1,%ebx
+801054f9:	eb b6                	jmp    801054b1 <pcvictim+0xa>
+      pgcache.hand = (e - pgcache.ent + 1) % NPGCACHE;
+801054fb:	89 f0                	mov    %esi,%eax
+801054fd:	2d 34 24 12 80       	sub    $0x80122434,%eax
+80105502:	c1 f8 02             	sar    $0x2,%eax
+80105505:	69 c0 cd cc cc cc    	imul   $0xcccccccd,%eax,%eax
+8010550b:	83 c0 01             	add    $0x1,%eax
+8010550e:	99                   	cltd
+8010550f:	c1 ea 19             	shr    $0x19,%edx
+80105512:	01 d0                	add    %edx,%eax
+80105514:	83 e0 7f             	and    $0x7f,%eax
+80105517:	29 d0                	sub    %edx,%eax
+80105519:	a3 34 2e 12 80       	mov    %eax,0x80122e34
+    }
+  }
+  e = &pgcache.ent[pgcache.hand];
+  pgcache.hand = (pgcache.hand + 1) % NPGCACHE;
+  return e;
+}
+8010551e:	89 f0                	mov    %esi,%eax
+80105520:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105523:	5b                   	pop    %ebx
+80105524:	5e                   	pop    %esi
+80105525:	5d                   	pop    %ebp
+80105526:	c3                   	ret
+  e = &pgcache.ent[pgcache.hand];
+80105527:	a1 34 2e 12 80       	mov    0x80122e34,%eax
+8010552c:	8d 14 80             	lea    (%eax,%eax,4),%edx
+8010552f:	8d 34 95 34 24 12 80 	lea    -0x7feddbcc(,%edx,4),%esi
+  pgcache.hand = (pgcache.hand + 1) % NPGCACHE;
+80105536:	83 c0 01             	add    $0x1,%eax
+80105539:	99                   	cltd
+8010553a:	c1 ea 19             	shr    $0x19,%edx
+8010553d:	01 d0                	add    %edx,%eax
+8010553f:	83 e0 7f             	and    $0x7f,%eax
+80105542:	29 d0                	sub    %edx,%eax
+80105544:	a3 34 2e 12 80       	mov    %eax,0x80122e34
+  return e;
+80105549:	eb d3                	jmp    8010551e <pcvictim+0x77>
+
+8010554b <pcinit>:
+{
+8010554b:	55                   	push   %ebp
+8010554c:	89 e5                	mov    %esp,%ebp
+8010554e:	83 ec 10             	sub    $0x10,%esp
+  initlock(&pgcache.lock, "pgcache");
+80105551:	68 a7 bf 10 80       	push   $0x8010bfa7
+80105556:	68 00 24 12 80       	push   $0x80122400
+8010555b:	e8 ee 23 00 00       	call   8010794e <initlock>
+}
+80105560:	83 c4 10             	add    $0x10,%esp
+80105563:	c9                   	leave
+80105564:	c3                   	ret
+
+80105565 <pcget>:
+// by zeroes, with a reference for the caller to drop with kfree().
+// Returns 0 if out of memory or the read fails.
+// ip must not be locked by the caller.
+char*
+pcget(struct inode *ip, uint off, uint n)
+{
+80105565:	55                   	push   %ebp
+80105566:	89 e5                	mov    %esp,%ebp
+80105568:	57                   	push   %edi
+80105569:	56                   	push   %esi
+8010556a:	53                   	push   %ebx
+8010556b:	83 ec 18             	sub    $0x18,%esp
+8010556e:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct pcent *e;
+  char *mem;
+
+  acquire(&pgcache.lock);
+80105571:	68 00 24 12 80       	push   $0x80122400
+80105576:	e8 17 25 00 00       	call   80107a92 <acquire>
+  if((e = pclookup(ip->dev, ip->inum, off, n)) != 0){
+8010557b:	8b 56 04             	mov    0x4(%esi),%edx
+8010557e:	8b 06                	mov    (%esi),%eax
+80105580:	83 c4 04             	add    $0x4,%esp
+80105583:	ff 75 10             	push   0x10(%ebp)
+80105586:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80105589:	e8 da fe ff ff       	call   80105468 <pclookup>
+8010558e:	83 c4 10             	add    $0x10,%esp
+80105591:	89 c7                	mov    %eax,%edi
+80105593:	85 c0                	test   %eax,%eax
+80105595:	74 26                	je     801055bd <pcget+0x58>
+    mem = kdup(e->page);
+80105597:	83 ec 0c             	sub    $0xc,%esp
+8010559a:	ff 70 10             	push   0x10(%eax)
+8010559d:	e8 21 e7 ff ff       	call   80103cc3 <kdup>
+801055a2:	89 c3                	mov    %eax,%ebx
+    release(&pgcache.lock);
+801055a4:	c7 04 24 00 24 12 80 	movl   $0x80122400,(%esp)
+801055ab:	e8 47 25 00 00       	call   80107af7 <release>
+    return mem;
+801055b0:	83 c4 10             	add    $0x10,%esp
+    e->page = kdup(mem);
+  }
+  release(&pgcache.lock);
+  iunlock(ip);
+  return mem;
+}
+801055b3:	89 d8                	mov    %ebx,%eax
+801055b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801055b8:	5b                   	pop    %ebx
+801055b9:	5e                   	pop    %esi
+801055ba:	5f                   	pop    %edi
+801055bb:	5d                   	pop    %ebp
+801055bc:	c3                   	ret
+  release(&pgcache.lock);
+801055bd:	83 ec 0c             	sub    $0xc,%esp
+801055c0:	68 00 24 12 80       	push   $0x80122400
+801055c5:	e8 2d 25 00 00       	call   80107af7 <release>
+  if((mem = kalloc_zeroed()) == 0)
+801055ca:	e8 26 e6 ff ff       	call   80103bf5 <kalloc_zeroed>
+801055cf:	89 c3                	mov    %eax,%ebx
+801055d1:	83 c4 10             	add    $0x10,%esp
+801055d4:	85 c0                	test   %eax,%eax
+801055d6:	74 db                	je     801055b3 <pcget+0x4e>
+  ilock(ip);
+801055d8:	83 ec 0c             	sub    $0xc,%esp
+801055db:	56                   	push   %esi
+801055dc:	e8 80 ca ff ff       	call   80102061 <ilock>
+  if(readi(ip, mem, off, n) != n){
+801055e1:	ff 75 10             	push   0x10(%ebp)
+801055e4:	ff 75 0c             	push   0xc(%ebp)
+801055e7:	53                   	push   %ebx
+801055e8:	56                   	push   %esi
+801055e9:	e8 69 cd ff ff       	call   80102357 <readi>
+801055ee:	83 c4 20             	add    $0x20,%esp
+801055f1:	3b 45 10             	cmp    0x10(%ebp),%eax
+801055f4:	75 5f                	jne    80105655 <pcget+0xf0>
+  acquire(&pgcache.lock);
+801055f6:	83 ec 0c             	sub    $0xc,%esp
+801055f9:	68 00 24 12 80       	push   $0x80122400
+801055fe:	e8 8f 24 00 00       	call   80107a92 <acquire>
+  if((e = pclookup(ip->dev, ip->inum, off, n)) != 0){
+80105603:	8b 56 04             	mov    0x4(%esi),%edx
+80105606:	8b 06                	mov    (%esi),%eax
+80105608:	83 c4 04             	add    $0x4,%esp
+8010560b:	ff 75 10             	push   0x10(%ebp)
+8010560e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80105611:	e8 52 fe ff ff       	call   80105468 <pclookup>
+80105616:	83 c4 10             	add    $0x10,%esp
+80105619:	89 c7                	mov    %eax,%edi
+8010561b:	85 c0                	test   %eax,%eax
+8010561d:	74 51                	je     80105670 <pcget+0x10b>
+    kfree(mem);
+8010561f:	83 ec 0c             	sub    $0xc,%esp
+80105622:	53                   	push   %ebx
+80105623:	e8 e7 de ff ff       	call   8010350f <kfree>
+    mem = kdup(e->page);
+80105628:	83 c4 04             	add    $0x4,%esp
+8010562b:	ff 77 10             	push   0x10(%edi)
+8010562e:	e8 90 e6 ff ff       	call   80103cc3 <kdup>
+80105633:	89 c3                	mov    %eax,%ebx
+80105635:	83 c4 10             	add    $0x10,%esp
+  release(&pgcache.lock);
+80105638:	83 ec 0c             	sub    $0xc,%esp
+8010563b:	68 00 24 12 80       	push   $0x80122400
+80105640:	e8 b2 24 00 00       	call   80107af7 <release>
+  iunlock(ip);
+80105645:	89 34 24             	mov    %esi,(%esp)
+80105648:	e8 d6 ca ff ff       	call   80102123 <iunlock>
+  return mem;
+8010564d:	83 c4 10             	add    $0x10,%esp
+80105650:	e9 5e ff ff ff       	jmp    801055b3 <pcget+0x4e>
+    iunlock(ip);
+80105655:	83 ec 0c             	sub    $0xc,%esp
+80105658:	56                   	push   %esi
+80105659:	e8 c5 ca ff ff       	call   80102123 <iunlock>
+    kfree(mem);
+8010565e:	89 1c 24             	mov    %ebx,(%esp)
+80105661:	e8 a9 de ff ff       	call   8010350f <kfree>
+    return 0;
+80105666:	83 c4 10             	add    $0x10,%esp
+80105669:	89 fb                	mov    %edi,%ebx
+8010566b:	e9 43 ff ff ff       	jmp    801055b3 <pcget+0x4e>
+    e = pcvictim();
+80105670:	e8 32 fe ff ff       	call   801054a7 <pcvictim>
+80105675:	89 c7                	mov    %eax,%edi
+    if(e->page)
+80105677:	8b 40 10             	mov    0x10(%eax),%eax
+8010567a:	85 c0                	test   %eax,%eax
+8010567c:	74 0c                	je     8010568a <pcget+0x125>
+      kfree(e->page);
+8010567e:	83 ec 0c             	sub    $0xc,%esp
+80105681:	50                   	push   %eax
+80105682:	e8 88 de ff ff       	call   8010350f <kfree>
+80105687:	83 c4 10             	add    $0x10,%esp
+    e->dev = ip->dev;
+8010568a:	8b 06                	mov    (%esi),%eax
+8010568c:	89 07                	mov    %eax,(%edi)
+    e->inum = ip->inum;
+8010568e:	8b 46 04             	mov    0x4(%esi),%eax
+80105691:	89 47 04             	mov    %eax,0x4(%edi)
+    e->off = off;
+80105694:	8b 45 0c             	mov    0xc(%ebp),%eax
+80105697:	89 47 08             	mov    %eax,0x8(%edi)
+    e->n = n;
+8010569a:	8b 45 10             	mov    0x10(%ebp),%eax
+8010569d:	89 47 0c             	mov    %eax,0xc(%edi)
+    e->page = kdup(mem);
+801056a0:	83 ec 0c             	sub    $0xc,%esp
+801056a3:	53                   	push   %ebx
+801056a4:	e8 1a e6 ff ff       	call   80103cc3 <kdup>
+801056a9:	89 47 10             	mov    %eax,0x10(%edi)
+801056ac:	83 c4 10             	add    $0x10,%esp
+801056af:	eb 87                	jmp    80105638 <pcget+0xd3>
+
+801056b1 <pcinval>:
+
+// Forget all cached pages of ip, whose contents have changed.
+void
+pcinval(struct inode *ip)
+{
+801056b1:	55                   	push   %ebp
+801056b2:	89 e5                	mov    %esp,%ebp
+801056b4:	56                   	push   %esi
+801056b5:	53                   	push   %ebx
+801056b6:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct pcent *e;
+
+  acquire(&pgcache.lock);
+801056b9:	83 ec 0c             	sub    $0xc,%esp
+801056bc:	68 00 24 12 80       	push   $0x80122400
+801056c1:	e8 cc 23 00 00       	call   80107a92 <acquire>
+  for(e = pgcache.ent; e < &pgcache.ent[NPGCACHE]; e++){
+801056c6:	83 c4 10             	add    $0x10,%esp
+801056c9:	bb 34 24 12 80       	mov    $0x80122434,%ebx
+801056ce:	eb 03                	jmp    801056d3 <pcinval+0x22>
+801056d0:	83 c3 14             	add    $0x14,%ebx
+801056d3:	81 fb 34 2e 12 80    	cmp    $0x80122e34,%ebx
+801056d9:	73 2a                	jae    80105705 <pcinval+0x54>
+    if(e->page && e->dev == ip->dev && e->inum == ip->inum){
+801056db:	8b 43 10             	mov    0x10(%ebx),%eax
+801056de:	85 c0                	test   %eax,%eax
+801056e0:	74 ee                	je     801056d0 <pcinval+0x1f>
+801056e2:	8b 16                	mov    (%esi),%edx
+801056e4:	39 13                	cmp    %edx,(%ebx)
+801056e6:	75 e8                	jne    801056d0 <pcinval+0x1f>
+801056e8:	8b 4e 04             	mov    0x4(%esi),%ecx
+801056eb:	39 4b 04             	cmp    %ecx,0x4(%ebx)
+801056ee:	75 e0                	jne    801056d0 <pcinval+0x1f>
+      kfree(e->page);
+801056f0:	83 ec 0c             	sub    $0xc,%esp
+801056f3:	50                   	push   %eax
+801056f4:	e8 16 de ff ff       	call   8010350f <kfree>
+      e->page = 0;
+801056f9:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+80105700:	83 c4 10             	add    $0x10,%esp
+80105703:	eb cb                	jmp    801056d0 <pcinval+0x1f>
+    }
+  }
+  release(&pgcache.lock);
+80105705:	83 ec 0c             	sub    $0xc,%esp
+80105708:	68 00 24 12 80       	push   $0x80122400
+8010570d:	e8 e5 23 00 00       	call   80107af7 <release>
+}
+80105712:	83 c4 10             	add    $0x10,%esp
+80105715:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105718:	5b                   	pop    %ebx
+80105719:	5e                   	pop    %esi
+8010571a:	5d                   	pop    %ebp
+8010571b:	c3                   	ret
+
+8010571c <picinit>:
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010571c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105721:	ba 21 00 00 00       	mov    $0x21,%edx
+80105726:	ee                   	out    %al,(%dx)
+80105727:	ba a1 00 00 00       	mov    $0xa1,%edx
+8010572c:	ee                   	out    %al,(%dx)
+picinit(void)
+{
+  // mask all interrupts
+  outb(IO_PIC1+1, 0xFF);
+  outb(IO_PIC2+1, 0xFF);
+}
+8010572d:	c3                   	ret
+
+8010572e <pipeinit>:
+
+static struct kmcache *pipecache;
+
+void
+pipeinit(void)
+{
+8010572e:	55                   	push   %ebp
+8010572f:	89 e5                	mov    %esp,%ebp
+80105731:	83 ec 10             	sub    $0x10,%esp
+  pipecache = kmcache_create("pipe", sizeof(struct pipe));
+80105734:	68 44 02 00 00       	push   $0x244
+80105739:	68 af bf 10 80       	push   $0x8010bfaf
+8010573e:	e8 7a 1e 00 00       	call   801075bd <kmcache_create>
+80105743:	a3 38 2e 12 80       	mov    %eax,0x80122e38
+}
+80105748:	83 c4 10             	add    $0x10,%esp
+8010574b:	c9                   	leave
+8010574c:	c3                   	ret
+
+8010574d <pipealloc>:
+
+int
+pipealloc(struct file **f0, struct file **f1)
+{
+8010574d:	55                   	push   %ebp
+8010574e:	89 e5                	mov    %esp,%ebp
+80105750:	57                   	push   %edi
+80105751:	56                   	push   %esi
+80105752:	53                   	push   %ebx
+80105753:	83 ec 0c             	sub    $0xc,%esp
+80105756:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80105759:	8b 75 0c             	mov    0xc(%ebp),%esi
+  struct pipe *p;
+
+  p = 0;
+  *f0 = *f1 = 0;
+8010575c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+80105762:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  if((*f0 = filealloc()) == 0 || (*f1 = filealloc()) == 0)
+80105768:	e8 8a bf ff ff       	call   801016f7 <filealloc>
+8010576d:	89 03                	mov    %eax,(%ebx)
+8010576f:	85 c0                	test   %eax,%eax
+80105771:	0f 84 98 00 00 00    	je     8010580f <pipealloc+0xc2>
+80105777:	e8 7b bf ff ff       	call   801016f7 <filealloc>
+8010577c:	89 06                	mov    %eax,(%esi)
+8010577e:	85 c0                	test   %eax,%eax
+80105780:	0f 84 89 00 00 00    	je     8010580f <pipealloc+0xc2>
+    goto bad;
+  if((p = kmcache_alloc(pipecache)) == 0)
+80105786:	83 ec 0c             	sub    $0xc,%esp
+80105789:	ff 35 38 2e 12 80    	push   0x80122e38
+8010578f:	e8 f5 1e 00 00       	call   80107689 <kmcache_alloc>
+80105794:	89 c7                	mov    %eax,%edi
+80105796:	83 c4 10             	add    $0x10,%esp
+80105799:	85 c0                	test   %eax,%eax
+8010579b:	74 72                	je     8010580f <pipealloc+0xc2>
+    goto bad;
+  p->readopen = 1;
+8010579d:	c7 80 3c 02 00 00 01 	movl   $0x1,0x23c(%eax)
+801057a4:	00 00 00 
+  p->writeopen = 1;
+801057a7:	c7 80 40 02 00 00 01 	movl   $0x1,0x240(%eax)
+801057ae:	00 00 00 
+  p->nwrite = 0;
+801057b1:	c7 80 38 02 00 00 00 	movl   $0x0,0x238(%eax)
+801057b8:	00 00 00 
+  p->nread = 0;
+801057bb:	c7 80 34 02 00 00 00 	movl   $0x0,0x234(%eax)
+801057c2:	00 00 00 
+  initlock(&p->lock, "pipe");
+801057c5:	83 ec 08             	sub    $0x8,%esp
+801057c8:	68 af bf 10 80       	push   $0x8010bfaf
+801057cd:	50                   	push   %eax
+801057ce:	e8 7b 21 00 00       	call   8010794e <initlock>
+  (*f0)->type = FD_PIPE;
+801057d3:	8b 03                	mov    (%ebx),%eax
+801057d5:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  (*f0)->readable = 1;
+801057db:	8b 03                	mov    (%ebx),%eax
+801057dd:	c6 40 08 01          	movb   $0x1,0x8(%eax)
+  (*f0)->writable = 0;
+801057e1:	8b 03                	mov    (%ebx),%eax
+801057e3:	c6 40 09 00          	movb   $0x0,0x9(%eax)
+  (*f0)->pipe = p;
+801057e7:	8b 03                	mov    (%ebx),%eax
+801057e9:	89 78 0c             	mov    %edi,0xc(%eax)
+  (*f1)->type = FD_PIPE;
+801057ec:	8b 06                	mov    (%esi),%eax
+801057ee:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  (*f1)->readable = 0;
+801057f4:	8b 06                	mov    (%esi),%eax
+801057f6:	c6 40 08 00          	movb   $0x0,0x8(%eax)
+  (*f1)->writable = 1;
+801057fa:	8b 06                	mov    (%esi),%eax
+801057fc:	c6 40 09 01          	movb   $0x1,0x9(%eax)
+  (*f1)->pipe = p;
+80105800:	8b 06                	mov    (%esi),%eax
+80105802:	89 78 0c             	mov    %edi,0xc(%eax)
+  return 0;
+80105805:	83 c4 10             	add    $0x10,%esp
+80105808:	b8 00 00 00 00       	mov    $0x0,%eax
+8010580d:	eb 29                	jmp    80105838 <pipealloc+0xeb>
+
+ bad:
+  if(p)
+    kmcache_free(pipecache, p);
+  if(*f0)
+8010580f:	8b 03                	mov    (%ebx),%eax
+80105811:	85 c0                	test   %eax,%eax
+80105813:	74 0c                	je     80105821 <pipealloc+0xd4>
+    fileclose(*f0);
+80105815:	83 ec 0c             	sub    $0xc,%esp
+80105818:	50                   	push   %eax
+80105819:	e8 57 bf ff ff       	call   80101775 <fileclose>
+8010581e:	83 c4 10             	add    $0x10,%esp
+  if(*f1)
+80105821:	8b 06                	mov    (%esi),%eax
+80105823:	85 c0                	test   %eax,%eax
+80105825:	74 19                	je     80105840 <pipealloc+0xf3>
+    fileclose(*f1);
+80105827:	83 ec 0c             	sub    $0xc,%esp
+8010582a:	50                   	push   %eax
+8010582b:	e8 45 bf ff ff       	call   80101775 <fileclose>
+80105830:	83 c4 10             	add    $0x10,%esp
+  return -1;
+80105833:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80105838:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010583b:	5b                   	pop    %ebx
+8010583c:	5e                   	pop    %esi
+8010583d:	5f                   	pop    %edi
+8010583e:	5d                   	pop    %ebp
+8010583f:	c3                   	ret
+  return -1;
+80105840:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105845:	eb f1                	jmp    80105838 <pipealloc+0xeb>
+
+80105847 <pipeclose>:
+
+void
+pipeclose(struct pipe *p, int writable)
+{
+80105847:	55                   	push   %ebp
+80105848:	89 e5                	mov    %esp,%ebp
+8010584a:	53                   	push   %ebx
+8010584b:	83 ec 10             	sub    $0x10,%esp
+8010584e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&p->lock);
+80105851:	53                   	push   %ebx
+80105852:	e8 3b 22 00 00       	call   80107a92 <acquire>
+  if(writable){
+80105857:	83 c4 10             	add    $0x10,%esp
+8010585a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+8010585e:	74 3f                	je     8010589f <pipeclose+0x58>
+    p->writeopen = 0;
+80105860:	c7 83 40 02 00 00 00 	movl   $0x0,0x240(%ebx)
+80105867:	00 00 00 
+    wakeup(&p->nread);
+8010586a:	8d 83 34 02 00 00    	lea    0x234(%ebx),%eax
+80105870:	83 ec 0c             	sub    $0xc,%esp
+80105873:	50                   	push   %eax
+80105874:	e8 bc 0f 00 00       	call   80106835 <wakeup>
+80105879:	83 c4 10             	add    $0x10,%esp
+  } else {
+    p->readopen = 0;
+    wakeup(&p->nwrite);
+  }
+  if(p->readopen == 0 && p->writeopen == 0){
+8010587c:	83 bb 3c 02 00 00 00 	cmpl   $0x0,0x23c(%ebx)
+80105883:	75 09                	jne    8010588e <pipeclose+0x47>
+80105885:	83 bb 40 02 00 00 00 	cmpl   $0x0,0x240(%ebx)
+8010588c:	74 2f                	je     801058bd <pipeclose+0x76>
+    release(&p->lock);
+    kmcache_free(pipecache, p);
+  } else
+    release(&p->lock);
+8010588e:	83 ec 0c             	sub    $0xc,%esp
+80105891:	53                   	push   %ebx
+80105892:	e8 60 22 00 00       	call   80107af7 <release>
+80105897:	83 c4 10             	add    $0x10,%esp
+}
+8010589a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010589d:	c9                   	leave
+8010589e:	c3                   	ret
+    p->readopen = 0;
+8010589f:	c7 83 3c 02 00 00 00 	movl   $0x0,0x23c(%ebx)
+801058a6:	00 00 00 
+    wakeup(&p->nwrite);
+801058a9:	8d 83 38 02 00 00    	lea    0x238(%ebx),%eax
+801058af:	83 ec 0c             	sub    $0xc,%esp
+801058b2:	50                   	push   %eax
+801058b3:	e8 7d 0f 00 00       	call   80106835 <wakeup>
+801058b8:	83 c4 10             	add    $0x10,%esp
+801058bb:	eb bf                	jmp    8010587c <pipeclose+0x35>
+    release(&p->lock);
+801058bd:	83 ec 0c             	sub    $0xc,%esp
+801058c0:	53                   	push   %ebx
+801058c1:	e8 31 22 00 00       	call   80107af7 <release>
+    kmcache_free(pipecache, p);
+801058c6:	83 c4 08             	add    $0x8,%esp
+801058c9:	53                   	push   %ebx
+801058ca:	ff 35 38 2e 12 80    	push   0x80122e38
+801058d0:	e8 86 1e 00 00       	call   8010775b <kmcache_free>
+801058d5:	83 c4 10             	add    $0x10,%esp
+801058d8:	eb c0                	jmp    8010589a <pipeclose+0x53>
+
+801058da <pipewrite>:
+
+int
+pipewrite(struct pipe *p, char *addr, int n)
+{
+801058da:	55                   	push   %ebp
+801058db:	89 e5                	mov    %esp,%ebp
+801058dd:	57                   	push   %edi
+801058de:	56                   	push   %esi
+801058df:	53                   	push   %ebx
+801058e0:	83 ec 18             	sub    $0x18,%esp
+801058e3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801058e6:	8b 75 10             	mov    0x10(%ebp),%esi
+  int i;
+
+  acquire(&p->lock);
+801058e9:	53                   	push   %ebx
+801058ea:	e8 a3 21 00 00       	call   80107a92 <acquire>
+  for(i = 0; i < n; i++){
+801058ef:	83 c4 10             	add    $0x10,%esp
+801058f2:	bf 00 00 00 00       	mov    $0x0,%edi
+801058f7:	39 f7                	cmp    %esi,%edi
+801058f9:	7c 40                	jl     8010593b <pipewrite+0x61>
+      wakeup(&p->nread);
+      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+    }
+    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+  }
+  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+801058fb:	8d 83 34 02 00 00    	lea    0x234(%ebx),%eax
+80105901:	83 ec 0c             	sub    $0xc,%esp
+80105904:	50                   	push   %eax
+80105905:	e8 2b 0f 00 00       	call   80106835 <wakeup>
+  release(&p->lock);
+8010590a:	89 1c 24             	mov    %ebx,(%esp)
+8010590d:	e8 e5 21 00 00       	call   80107af7 <release>
+  return n;
+80105912:	83 c4 10             	add    $0x10,%esp
+80105915:	89 f0                	mov    %esi,%eax
+80105917:	eb 5c                	jmp    80105975 <pipewrite+0x9b>
+      wakeup(&p->nread);
+80105919:	8d 83 34 02 00 00    	lea    0x234(%ebx),%eax
+8010591f:	83 ec 0c             	sub    $0xc,%esp
+80105922:	50                   	push   %eax
+80105923:	e8 0d 0f 00 00       	call   80106835 <wakeup>
+      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+80105928:	8d 83 38 02 00 00    	lea    0x238(%ebx),%eax
+8010592e:	83 c4 08             	add    $0x8,%esp
+80105931:	53                   	push   %ebx
+80105932:	50                   	push   %eax
+80105933:	e8 2e 0c 00 00       	call   80106566 <sleep>
+80105938:	83 c4 10             	add    $0x10,%esp
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+8010593b:	8b 93 38 02 00 00    	mov    0x238(%ebx),%edx
+80105941:	8b 83 34 02 00 00    	mov    0x234(%ebx),%eax
+80105947:	05 00 02 00 00       	add    $0x200,%eax
+8010594c:	39 c2                	cmp    %eax,%edx
+8010594e:	75 2d                	jne    8010597d <pipewrite+0xa3>
+      if(p->readopen == 0 || myproc()->killed){
+80105950:	83 bb 3c 02 00 00 00 	cmpl   $0x0,0x23c(%ebx)
+80105957:	74 0b                	je     80105964 <pipewrite+0x8a>
+80105959:	e8 ad 03 00 00       	call   80105d0b <myproc>
+8010595e:	83 78 24 00          	cmpl   $0x0,0x24(%eax)
+80105962:	74 b5                	je     80105919 <pipewrite+0x3f>
+        release(&p->lock);
+80105964:	83 ec 0c             	sub    $0xc,%esp
+80105967:	53                   	push   %ebx
+80105968:	e8 8a 21 00 00       	call   80107af7 <release>
+        return -1;
+8010596d:	83 c4 10             	add    $0x10,%esp
+80105970:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80105975:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105978:	5b                   	pop    %ebx
+80105979:	5e                   	pop    %esi
+8010597a:	5f                   	pop    %edi
+8010597b:	5d                   	pop    %ebp
+8010597c:	c3                   	ret
+    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+8010597d:	8d 42 01             	lea    0x1(%edx),%eax
+80105980:	89 83 38 02 00 00    	mov    %eax,0x238(%ebx)
+80105986:	81 e2 ff 01 00 00    	and    $0x1ff,%edx
+8010598c:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010598f:	0f b6 04 38          	movzbl (%eax,%edi,1),%eax
+80105993:	88 44 13 34          	mov    %al,0x34(%ebx,%edx,1)
+  for(i = 0; i < n; i++){
+80105997:	83 c7 01             	add    $0x1,%edi
+8010599a:	e9 58 ff ff ff       	jmp    801058f7 <pipewrite+0x1d>
+
+8010599f <piperead>:
+
+int
+piperead(struct pipe *p, char *addr, int n)
+{
+8010599f:	55                   	push   %ebp
+801059a0:	89 e5                	mov    %esp,%ebp
+801059a2:	57                   	push   %edi
+801059a3:	56                   	push   %esi
+801059a4:	53                   	push   %ebx
+801059a5:	83 ec 18             	sub    $0x18,%esp
+801059a8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801059ab:	8b 7d 10             	mov    0x10(%ebp),%edi
+  int i;
+
+  acquire(&p->lock);
+801059ae:	53                   	push   %ebx
+801059af:	e8 de 20 00 00       	call   80107a92 <acquire>
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+801059b4:	83 c4 10             	add    $0x10,%esp
+801059b7:	eb 13                	jmp    801059cc <piperead+0x2d>
+    if(myproc()->killed){
+      release(&p->lock);
+      return -1;
+    }
+    sleep(&p->nread, &p->lock); //DOC: piperead-sleep
+801059b9:	8d 83 34 02 00 00    	lea    0x234(%ebx),%eax
+801059bf:	83 ec 08             	sub    $0x8,%esp
+801059c2:	53                   	push   %ebx
+801059c3:	50                   	push   %eax
+801059c4:	e8 9d 0b 00 00       	call   80106566 <sleep>
+801059c9:	83 c4 10             	add    $0x10,%esp
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+801059cc:	8b 83 38 02 00 00    	mov    0x238(%ebx),%eax
+801059d2:	39 83 34 02 00 00    	cmp    %eax,0x234(%ebx)
+801059d8:	75 7a                	jne    80105a54 <piperead+0xb5>
+801059da:	8b b3 40 02 00 00    	mov    0x240(%ebx),%esi
+801059e0:	85 f6                	test   %esi,%esi
+801059e2:	74 3a                	je     80105a1e <piperead+0x7f>
+    if(myproc()->killed){
+801059e4:	e8 22 03 00 00       	call   80105d0b <myproc>
+801059e9:	83 78 24 00          	cmpl   $0x0,0x24(%eax)
+801059ed:	74 ca                	je     801059b9 <piperead+0x1a>
+      release(&p->lock);
+801059ef:	83 ec 0c             	sub    $0xc,%esp
+801059f2:	53                   	push   %ebx
+801059f3:	e8 ff 20 00 00       	call   80107af7 <release>
+      return -1;
+801059f8:	83 c4 10             	add    $0x10,%esp
+801059fb:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80105a00:	eb 48                	jmp    80105a4a <piperead+0xab>
+  }
+  for(i = 0; i < n; i++){  //DOC: piperead-copy
+    if(p->nread == p->nwrite)
+      break;
+    addr[i] = p->data[p->nread++ % PIPESIZE];
+80105a02:	8d 50 01             	lea    0x1(%eax),%edx
+80105a05:	89 93 34 02 00 00    	mov    %edx,0x234(%ebx)
+80105a0b:	25 ff 01 00 00       	and    $0x1ff,%eax
+80105a10:	0f b6 44 03 34       	movzbl 0x34(%ebx,%eax,1),%eax
+80105a15:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80105a18:	88 04 31             	mov    %al,(%ecx,%esi,1)
+  for(i = 0; i < n; i++){  //DOC: piperead-copy
+80105a1b:	83 c6 01             	add    $0x1,%esi
+80105a1e:	39 fe                	cmp    %edi,%esi
+80105a20:	7d 0e                	jge    80105a30 <piperead+0x91>
+    if(p->nread == p->nwrite)
+80105a22:	8b 83 34 02 00 00    	mov    0x234(%ebx),%eax
+80105a28:	3b 83 38 02 00 00    	cmp    0x238(%ebx),%eax
+80105a2e:	75 d2                	jne    80105a02 <piperead+0x63>
+  }
+  wakeup(&p->nwrite);  //DOC: piperead-wakeup
+80105a30:	8d 83 38 02 00 00    	lea    0x238(%ebx),%eax
+80105a36:	83 ec 0c             	sub    $0xc,%esp
+80105a39:	50                   	push   %eax
+80105a3a:	e8 f6 0d 00 00       	call   80106835 <wakeup>
+  release(&p->lock);
+80105a3f:	89 1c 24             	mov    %ebx,(%esp)
+80105a42:	e8 b0 20 00 00       	call   80107af7 <release>
+  return i;
+80105a47:	83 c4 10             	add    $0x10,%esp
+}
+80105a4a:	89 f0                	mov    %esi,%eax
+80105a4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105a4f:	5b                   	pop    %ebx
+80105a50:	5e                   	pop    %esi
+80105a51:	5f                   	pop    %edi
+80105a52:	5d                   	pop    %ebp
+80105a53:	c3                   	ret
+80105a54:	be 00 00 00 00       	mov    $0x0,%esi
+80105a59:	eb c3                	jmp    80105a1e <piperead+0x7f>
+
+80105a5b <wakeup1>:
+
+// Wake up all processes sleeping on chan.
+// The ptable lock must be held.
+static void
+wakeup1(void *chan)
+{
+80105a5b:	55                   	push   %ebp
+80105a5c:	89 e5                	mov    %esp,%ebp
+80105a5e:	57                   	push   %edi
+80105a5f:	56                   	push   %esi
+80105a60:	53                   	push   %ebx
+80105a61:	83 ec 04             	sub    $0x4,%esp
+80105a64:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  struct proc *p;
+
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+80105a67:	b8 74 2e 12 80       	mov    $0x80122e74,%eax
+80105a6c:	eb 63                	jmp    80105ad1 <wakeup1+0x76>
+        // p->qtail[p->pri]++;
+        // p->ticks_thisturn = 0;
+
+        for (int pindex = ptable.pri_queue[p->pri].head; pindex < ptable.pri_queue[p->pri].tail; pindex++) {
+            if (ptable.pri_queue[p->pri].queue[pindex]->pid == p->pid) {
+                ptable.pri_queue[p->pri].queue[ptable.pri_queue[p->pri].tail] = p;
+80105a6e:	6b c9 42             	imul   $0x42,%ecx,%ecx
+80105a71:	8d 8c 0e 8c 2a 00 00 	lea    0x2a8c(%esi,%ecx,1),%ecx
+80105a78:	89 04 8d 44 2e 12 80 	mov    %eax,-0x7fedd1bc(,%ecx,4)
+                for (int i = pindex; i < ptable.pri_queue[p->pri].tail; i++) {
+80105a7f:	eb 22                	jmp    80105aa3 <wakeup1+0x48>
+                    ptable.pri_queue[p->pri].queue[i] = ptable.pri_queue[p->pri].queue[i+1];
+80105a81:	6b c9 42             	imul   $0x42,%ecx,%ecx
+80105a84:	8d b4 0a 8d 2a 00 00 	lea    0x2a8d(%edx,%ecx,1),%esi
+80105a8b:	8b 34 b5 44 2e 12 80 	mov    -0x7fedd1bc(,%esi,4),%esi
+80105a92:	8d 8c 0a 8c 2a 00 00 	lea    0x2a8c(%edx,%ecx,1),%ecx
+80105a99:	89 34 8d 44 2e 12 80 	mov    %esi,-0x7fedd1bc(,%ecx,4)
+                for (int i = pindex; i < ptable.pri_queue[p->pri].tail; i++) {
+80105aa0:	8d 52 01             	lea    0x1(%edx),%edx
+80105aa3:	8b 48 7c             	mov    0x7c(%eax),%ecx
+80105aa6:	69 f1 08 01 00 00    	imul   $0x108,%ecx,%esi
+80105aac:	39 96 78 d9 12 80    	cmp    %edx,-0x7fed2688(%esi)
+80105ab2:	7f cd                	jg     80105a81 <wakeup1+0x26>
+                }
+                p->qtail[p->pri]++;
+80105ab4:	83 c1 24             	add    $0x24,%ecx
+80105ab7:	8b 5c 88 04          	mov    0x4(%eax,%ecx,4),%ebx
+80105abb:	8d 53 01             	lea    0x1(%ebx),%edx
+80105abe:	89 54 88 04          	mov    %edx,0x4(%eax,%ecx,4)
+                p->ticks_thisturn = 0;
+80105ac2:	c7 80 90 00 00 00 00 	movl   $0x0,0x90(%eax)
+80105ac9:	00 00 00 
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+80105acc:	05 a8 02 00 00       	add    $0x2a8,%eax
+80105ad1:	3d 74 d8 12 80       	cmp    $0x8012d874,%eax
+80105ad6:	73 56                	jae    80105b2e <wakeup1+0xd3>
+    if(p->state == SLEEPING && p->chan == chan) {
+80105ad8:	83 78 0c 02          	cmpl   $0x2,0xc(%eax)
+80105adc:	75 ee                	jne    80105acc <wakeup1+0x71>
+80105ade:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+80105ae1:	39 58 20             	cmp    %ebx,0x20(%eax)
+80105ae4:	75 e6                	jne    80105acc <wakeup1+0x71>
+        p->state = RUNNABLE;
+80105ae6:	c7 40 0c 03 00 00 00 	movl   $0x3,0xc(%eax)
+        for (int pindex = ptable.pri_queue[p->pri].head; pindex < ptable.pri_queue[p->pri].tail; pindex++) {
+80105aed:	8b 48 7c             	mov    0x7c(%eax),%ecx
+80105af0:	69 d1 08 01 00 00    	imul   $0x108,%ecx,%edx
+80105af6:	8b 92 74 d9 12 80    	mov    -0x7fed268c(%edx),%edx
+80105afc:	69 f1 08 01 00 00    	imul   $0x108,%ecx,%esi
+80105b02:	8b b6 78 d9 12 80    	mov    -0x7fed2688(%esi),%esi
+80105b08:	39 d6                	cmp    %edx,%esi
+80105b0a:	7e c0                	jle    80105acc <wakeup1+0x71>
+            if (ptable.pri_queue[p->pri].queue[pindex]->pid == p->pid) {
+80105b0c:	6b f9 42             	imul   $0x42,%ecx,%edi
+80105b0f:	8d bc 3a 8c 2a 00 00 	lea    0x2a8c(%edx,%edi,1),%edi
+80105b16:	8b 3c bd 44 2e 12 80 	mov    -0x7fedd1bc(,%edi,4),%edi
+80105b1d:	8b 58 10             	mov    0x10(%eax),%ebx
+80105b20:	39 5f 10             	cmp    %ebx,0x10(%edi)
+80105b23:	0f 84 45 ff ff ff    	je     80105a6e <wakeup1+0x13>
+        for (int pindex = ptable.pri_queue[p->pri].head; pindex < ptable.pri_queue[p->pri].tail; pindex++) {
+80105b29:	83 c2 01             	add    $0x1,%edx
+80105b2c:	eb ce                	jmp    80105afc <wakeup1+0xa1>
+                break;
+            }
+        }
+    }
+}
+80105b2e:	83 c4 04             	add    $0x4,%esp
+80105b31:	5b                   	pop    %ebx
+80105b32:	5e                   	pop    %esi
+80105b33:	5f                   	pop    %edi
+80105b34:	5d                   	pop    %ebp
+80105b35:	c3                   	ret
+
+80105b36 <allocproc>:
+{
+80105b36:	55                   	push   %ebp
+80105b37:	89 e5                	mov    %esp,%ebp
+80105b39:	53                   	push   %ebx
+80105b3a:	83 ec 10             	sub    $0x10,%esp
+  acquire(&ptable.lock);
+80105b3d:	68 40 2e 12 80       	push   $0x80122e40
+80105b42:	e8 4b 1f 00 00       	call   80107a92 <acquire>
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+80105b47:	83 c4 10             	add    $0x10,%esp
+80105b4a:	bb 74 2e 12 80       	mov    $0x80122e74,%ebx
+80105b4f:	eb 06                	jmp    80105b57 <allocproc+0x21>
+80105b51:	81 c3 a8 02 00 00    	add    $0x2a8,%ebx
+80105b57:	81 fb 74 d8 12 80    	cmp    $0x8012d874,%ebx
+80105b5d:	73 7d                	jae    80105bdc <allocproc+0xa6>
+    if(p->state == UNUSED)
+80105b5f:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+80105b63:	75 ec                	jne    80105b51 <allocproc+0x1b>
+  p->state = EMBRYO;
+80105b65:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+  p->pid = nextpid++;
+80105b6c:	a1 04 f0 10 80       	mov    0x8010f004,%eax
+80105b71:	8d 50 01             	lea    0x1(%eax),%edx
+80105b74:	89 15 04 f0 10 80    	mov    %edx,0x8010f004
+80105b7a:	89 43 10             	mov    %eax,0x10(%ebx)
+  release(&ptable.lock);
+80105b7d:	83 ec 0c             	sub    $0xc,%esp
+80105b80:	68 40 2e 12 80       	push   $0x80122e40
+80105b85:	e8 6d 1f 00 00       	call   80107af7 <release>
+  if((p->kstack = kalloc()) == 0){
+80105b8a:	e8 95 dc ff ff       	call   80103824 <kalloc>
+80105b8f:	89 43 08             	mov    %eax,0x8(%ebx)
+80105b92:	83 c4 10             	add    $0x10,%esp
+80105b95:	85 c0                	test   %eax,%eax
+80105b97:	74 5a                	je     80105bf3 <allocproc+0xbd>
+  sp -= sizeof *p->tf;
+80105b99:	8d 90 b4 0f 00 00    	lea    0xfb4(%eax),%edx
+  p->tf = (struct trapframe*)sp;
+80105b9f:	89 53 18             	mov    %edx,0x18(%ebx)
+  *(uint*)sp = (uint)trapret;
+80105ba2:	c7 80 b0 0f 00 00 20 	movl   $0x80109120,0xfb0(%eax)
+80105ba9:	91 10 80 
+  sp -= sizeof *p->context;
+80105bac:	05 9c 0f 00 00       	add    $0xf9c,%eax
+  p->context = (struct context*)sp;
+80105bb1:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  memset(p->context, 0, sizeof *p->context);
+80105bb4:	83 ec 04             	sub    $0x4,%esp
+80105bb7:	6a 14                	push   $0x14
+80105bb9:	6a 00                	push   $0x0
+80105bbb:	50                   	push   %eax
+80105bbc:	e8 7d 1f 00 00       	call   80107b3e <memset>
+  p->context->eip = (uint)forkret;
+80105bc1:	8b 43 1c             	mov    0x1c(%ebx),%eax
+80105bc4:	c7 40 10 37 5c 10 80 	movl   $0x80105c37,0x10(%eax)
+  p->pri = NLAYER-1;  // set first process to highest priority
+80105bcb:	c7 43 7c 03 00 00 00 	movl   $0x3,0x7c(%ebx)
+  for (int level = 0; level < NLAYER-1; level++) {
+80105bd2:	83 c4 10             	add    $0x10,%esp
+80105bd5:	b8 00 00 00 00       	mov    $0x0,%eax
+80105bda:	eb 3b                	jmp    80105c17 <allocproc+0xe1>
+  release(&ptable.lock);
+80105bdc:	83 ec 0c             	sub    $0xc,%esp
+80105bdf:	68 40 2e 12 80       	push   $0x80122e40
+80105be4:	e8 0e 1f 00 00       	call   80107af7 <release>
+  return 0;
+80105be9:	83 c4 10             	add    $0x10,%esp
+80105bec:	bb 00 00 00 00       	mov    $0x0,%ebx
+80105bf1:	eb 3d                	jmp    80105c30 <allocproc+0xfa>
+    p->state = UNUSED;
+80105bf3:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+    return 0;
+80105bfa:	89 c3                	mov    %eax,%ebx
+80105bfc:	eb 32                	jmp    80105c30 <allocproc+0xfa>
+      p->ticks[level] = 0;
+80105bfe:	c7 84 83 80 00 00 00 	movl   $0x0,0x80(%ebx,%eax,4)
+80105c05:	00 00 00 00 
+      p->qtail[level] = 0;
+80105c09:	c7 84 83 94 00 00 00 	movl   $0x0,0x94(%ebx,%eax,4)
+80105c10:	00 00 00 00 
+  for (int level = 0; level < NLAYER-1; level++) {
+80105c14:	83 c0 01             	add    $0x1,%eax
+80105c17:	83 f8 02             	cmp    $0x2,%eax
+80105c1a:	7e e2                	jle    80105bfe <allocproc+0xc8>
+  p->ticks_thisturn = 0;
+80105c1c:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%ebx)
+80105c23:	00 00 00 
+  p->borrowed = 0;
+80105c26:	c7 83 a4 00 00 00 00 	movl   $0x0,0xa4(%ebx)
+80105c2d:	00 00 00 
+}
+80105c30:	89 d8                	mov    %ebx,%eax
+80105c32:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105c35:	c9                   	leave
+80105c36:	c3                   	ret
+
+80105c37 <forkret>:
+{
+80105c37:	55                   	push   %ebp
+80105c38:	89 e5                	mov    %esp,%ebp
+80105c3a:	83 ec 14             	sub    $0x14,%esp
+  release(&ptable.lock);
+80105c3d:	68 40 2e 12 80       	push   $0x80122e40
+80105c42:	e8 b0 1e 00 00       	call   80107af7 <release>
+  if (first) {
+80105c47:	83 c4 10             	add    $0x10,%esp
+80105c4a:	83 3d 00 f0 10 80 00 	cmpl   $0x0,0x8010f000
+80105c51:	75 02                	jne    80105c55 <forkret+0x1e>
+}
+80105c53:	c9                   	leave
+80105c54:	c3                   	ret
+    first = 0;
+80105c55:	c7 05 00 f0 10 80 00 	movl   $0x0,0x8010f000
+80105c5c:	00 00 00 
+    iinit(ROOTDEV);
+80105c5f:	83 ec 0c             	sub    $0xc,%esp
+80105c62:	6a 01                	push   $0x1
+80105c64:	e8 5d c1 ff ff       	call   80101dc6 <iinit>
+    initlog(ROOTDEV);
+80105c69:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+80105c70:	e8 59 ed ff ff       	call   801049ce <initlog>
+80105c75:	83 c4 10             	add    $0x10,%esp
+}
+80105c78:	eb d9                	jmp    80105c53 <forkret+0x1c>
+
+80105c7a <pinit>:
+{
+80105c7a:	55                   	push   %ebp
+80105c7b:	89 e5                	mov    %esp,%ebp
+80105c7d:	83 ec 10             	sub    $0x10,%esp
+  initlock(&ptable.lock, "ptable");
+80105c80:	68 b4 bf 10 80       	push   $0x8010bfb4
+80105c85:	68 40 2e 12 80       	push   $0x80122e40
+80105c8a:	e8 bf 1c 00 00       	call   8010794e <initlock>
+}
+80105c8f:	83 c4 10             	add    $0x10,%esp
+80105c92:	c9                   	leave
+80105c93:	c3                   	ret
+
+80105c94 <mycpu>:
+{
+80105c94:	55                   	push   %ebp
+80105c95:	89 e5                	mov    %esp,%ebp
+80105c97:	83 ec 08             	sub    $0x8,%esp
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80105c9a:	9c                   	pushf
+80105c9b:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+80105c9c:	f6 c4 02             	test   $0x2,%ah
+80105c9f:	75 28                	jne    80105cc9 <mycpu+0x35>
+  apicid = lapicid();
+80105ca1:	e8 8e e4 ff ff       	call   80104134 <lapicid>
+  for (i = 0; i < ncpu; ++i) {
+80105ca6:	ba 00 00 00 00       	mov    $0x0,%edx
+80105cab:	39 15 64 1e 12 80    	cmp    %edx,0x80121e64
+80105cb1:	7e 23                	jle    80105cd6 <mycpu+0x42>
+    if (cpus[i].apicid == apicid)
+80105cb3:	69 ca b0 00 00 00    	imul   $0xb0,%edx,%ecx
+80105cb9:	0f b6 89 80 1e 12 80 	movzbl -0x7fede180(%ecx),%ecx
+80105cc0:	39 c1                	cmp    %eax,%ecx
+80105cc2:	74 1f                	je     80105ce3 <mycpu+0x4f>
+  for (i = 0; i < ncpu; ++i) {
+80105cc4:	83 c2 01             	add    $0x1,%edx
+80105cc7:	eb e2                	jmp    80105cab <mycpu+0x17>
+    panic("mycpu called with interrupts enabled\n");
+80105cc9:	83 ec 0c             	sub    $0xc,%esp
+80105ccc:	68 98 c0 10 80       	push   $0x8010c098
+80105cd1:	e8 55 b0 ff ff       	call   80100d2b <panic>
+  panic("unknown apicid\n");
+80105cd6:	83 ec 0c             	sub    $0xc,%esp
+80105cd9:	68 bb bf 10 80       	push   $0x8010bfbb
+80105cde:	e8 48 b0 ff ff       	call   80100d2b <panic>
+      return &cpus[i];
+80105ce3:	69 c2 b0 00 00 00    	imul   $0xb0,%edx,%eax
+80105ce9:	05 80 1e 12 80       	add    $0x80121e80,%eax
+}
+80105cee:	c9                   	leave
+80105cef:	c3                   	ret
+
+80105cf0 <cpuid>:
+cpuid() {
+80105cf0:	55                   	push   %ebp
+80105cf1:	89 e5                	mov    %esp,%ebp
+80105cf3:	83 ec 08             	sub    $0x8,%esp
+  return mycpu()-cpus;
+80105cf6:	e8 99 ff ff ff       	call   80105c94 <mycpu>
+80105cfb:	2d 80 1e 12 80       	sub    $0x80121e80,%eax
+80105d00:	c1 f8 04             	sar    $0x4,%eax
+80105d03:	69 c0 a3 8b 2e ba    	imul   $0xba2e8ba3,%eax,%eax
+}
+80105d09:	c9                   	leave
+80105d0a:	c3                   	ret
+
+80105d0b <myproc>:
+myproc(void) {
+80105d0b:	55                   	push   %ebp
+80105d0c:	89 e5                	mov    %esp,%ebp
+80105d0e:	53                   	push   %ebx
+80105d0f:	83 ec 04             	sub    $0x4,%esp
+  pushcli();
+80105d12:	e8 98 1c 00 00       	call   801079af <pushcli>
+  c = mycpu();
+80105d17:	e8 78 ff ff ff       	call   80105c94 <mycpu>
+  p = c->proc;
+80105d1c:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80105d22:	e8 cc 1c 00 00       	call   801079f3 <popcli>
+}
+80105d27:	89 d8                	mov    %ebx,%eax
+80105d29:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105d2c:	c9                   	leave
+80105d2d:	c3                   	ret
+
+80105d2e <userinit>:
+{
+80105d2e:	55                   	push   %ebp
+80105d2f:	89 e5                	mov    %esp,%ebp
+80105d31:	53                   	push   %ebx
+80105d32:	83 ec 04             	sub    $0x4,%esp
+    for (int level = NLAYER-1; level >= 0; level--) {
+80105d35:	ba 03 00 00 00       	mov    $0x3,%edx
+80105d3a:	eb 1d                	jmp    80105d59 <userinit+0x2b>
+        ptable.pri_queue[level].head = 0;
+80105d3c:	69 c2 08 01 00 00    	imul   $0x108,%edx,%eax
+80105d42:	c7 80 74 d9 12 80 00 	movl   $0x0,-0x7fed268c(%eax)
+80105d49:	00 00 00 
+        ptable.pri_queue[level].tail = 0;
+80105d4c:	c7 80 78 d9 12 80 00 	movl   $0x0,-0x7fed2688(%eax)
+80105d53:	00 00 00 
+    for (int level = NLAYER-1; level >= 0; level--) {
+80105d56:	83 ea 01             	sub    $0x1,%edx
+80105d59:	85 d2                	test   %edx,%edx
+80105d5b:	79 df                	jns    80105d3c <userinit+0xe>
+  p = allocproc();
+80105d5d:	e8 d4 fd ff ff       	call   80105b36 <allocproc>
+80105d62:	89 c3                	mov    %eax,%ebx
+  initproc = p;
+80105d64:	a3 94 dc 12 80       	mov    %eax,0x8012dc94
+  if((p->pgdir = setupkvm()) == 0)
+80105d69:	e8 03 53 00 00       	call   8010b071 <setupkvm>
+80105d6e:	89 43 04             	mov    %eax,0x4(%ebx)
+80105d71:	85 c0                	test   %eax,%eax
+80105d73:	0f 84 e4 00 00 00    	je     80105e5d <userinit+0x12f>
+  inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
+80105d79:	83 ec 04             	sub    $0x4,%esp
+80105d7c:	68 2c 00 00 00       	push   $0x2c
+80105d81:	68 60 f4 10 80       	push   $0x8010f460
+80105d86:	50                   	push   %eax
+80105d87:	e8 78 50 00 00       	call   8010ae04 <inituvm>
+  p->sz = PGSIZE;
+80105d8c:	c7 03 00 10 00 00    	movl   $0x1000,(%ebx)
+  memset(p->tf, 0, sizeof(*p->tf));
+80105d92:	8b 43 18             	mov    0x18(%ebx),%eax
+80105d95:	83 c4 0c             	add    $0xc,%esp
+80105d98:	6a 4c                	push   $0x4c
+80105d9a:	6a 00                	push   $0x0
+80105d9c:	50                   	push   %eax
+80105d9d:	e8 9c 1d 00 00       	call   80107b3e <memset>
+  p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+80105da2:	8b 43 18             	mov    0x18(%ebx),%eax
+80105da5:	66 c7 40 3c 1b 00    	movw   $0x1b,0x3c(%eax)
+  p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+80105dab:	8b 43 18             	mov    0x18(%ebx),%eax
+80105dae:	66 c7 40 2c 23 00    	movw   $0x23,0x2c(%eax)
+  p->tf->es = p->tf->ds;
+80105db4:	8b 43 18             	mov    0x18(%ebx),%eax
+80105db7:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80105dbb:	66 89 50 28          	mov    %dx,0x28(%eax)
+  p->tf->ss = p->tf->ds;
+80105dbf:	8b 43 18             	mov    0x18(%ebx),%eax
+80105dc2:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80105dc6:	66 89 50 48          	mov    %dx,0x48(%eax)
+  p->tf->eflags = FL_IF;
+80105dca:	8b 43 18             	mov    0x18(%ebx),%eax
+80105dcd:	c7 40 40 00 02 00 00 	movl   $0x200,0x40(%eax)
+  p->tf->esp = PGSIZE;
+80105dd4:	8b 43 18             	mov    0x18(%ebx),%eax
+80105dd7:	c7 40 44 00 10 00 00 	movl   $0x1000,0x44(%eax)
+  p->tf->eip = 0;  // beginning of initcode.S
+80105dde:	8b 43 18             	mov    0x18(%ebx),%eax
+80105de1:	c7 40 38 00 00 00 00 	movl   $0x0,0x38(%eax)
+  safestrcpy(p->name, "initcode", sizeof(p->name));
+80105de8:	8d 43 6c             	lea    0x6c(%ebx),%eax
+80105deb:	83 c4 0c             	add    $0xc,%esp
+80105dee:	6a 10                	push   $0x10
+80105df0:	68 e4 bf 10 80       	push   $0x8010bfe4
+80105df5:	50                   	push   %eax
+80105df6:	e8 af 1e 00 00       	call   80107caa <safestrcpy>
+  p->cwd = namei("/");
+80105dfb:	c7 04 24 ed bf 10 80 	movl   $0x8010bfed,(%esp)
+80105e02:	e8 eb c9 ff ff       	call   801027f2 <namei>
+80105e07:	89 43 68             	mov    %eax,0x68(%ebx)
+  acquire(&ptable.lock);
+80105e0a:	c7 04 24 40 2e 12 80 	movl   $0x80122e40,(%esp)
+80105e11:	e8 7c 1c 00 00       	call   80107a92 <acquire>
+  p->pri = NLAYER-1;
+80105e16:	c7 43 7c 03 00 00 00 	movl   $0x3,0x7c(%ebx)
+  p->state = RUNNABLE;
+80105e1d:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+  ptable.pri_queue[NLAYER-1].queue[ptable.pri_queue[NLAYER-1].tail] = p;
+80105e24:	a1 90 dc 12 80       	mov    0x8012dc90,%eax
+80105e29:	89 1c 85 8c db 12 80 	mov    %ebx,-0x7fed2474(,%eax,4)
+  ptable.pri_queue[NLAYER-1].tail++;
+80105e30:	83 c0 01             	add    $0x1,%eax
+80105e33:	a3 90 dc 12 80       	mov    %eax,0x8012dc90
+  p->qtail[p->pri]++;
+80105e38:	8b 43 7c             	mov    0x7c(%ebx),%eax
+80105e3b:	83 c0 24             	add    $0x24,%eax
+80105e3e:	8b 4c 83 04          	mov    0x4(%ebx,%eax,4),%ecx
+80105e42:	8d 51 01             	lea    0x1(%ecx),%edx
+80105e45:	89 54 83 04          	mov    %edx,0x4(%ebx,%eax,4)
+  release(&ptable.lock);
+80105e49:	c7 04 24 40 2e 12 80 	movl   $0x80122e40,(%esp)
+80105e50:	e8 a2 1c 00 00       	call   80107af7 <release>
+}
+80105e55:	83 c4 10             	add    $0x10,%esp
+80105e58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105e5b:	c9                   	leave
+80105e5c:	c3                   	ret
+    panic("userinit: out of memory?");
+80105e5d:	83 ec 0c             	sub    $0xc,%esp
+80105e60:	68 cb bf 10 80       	push   $0x8010bfcb
+80105e65:	e8 c1 ae ff ff       	call   80100d2b <panic>
+
+80105e6a <kthread>:
+{
+80105e6a:	55                   	push   %ebp
+80105e6b:	89 e5                	mov    %esp,%ebp
+80105e6d:	53                   	push   %ebx
+80105e6e:	83 ec 04             	sub    $0x4,%esp
+  if((p = allocproc()) == 0)
+80105e71:	e8 c0 fc ff ff       	call   80105b36 <allocproc>
+80105e76:	85 c0                	test   %eax,%eax
+80105e78:	0f 84 c1 00 00 00    	je     80105f3f <kthread+0xd5>
+80105e7e:	89 c3                	mov    %eax,%ebx
+  if((p->pgdir = setupkvm()) == 0){
+80105e80:	e8 ec 51 00 00       	call   8010b071 <setupkvm>
+80105e85:	89 43 04             	mov    %eax,0x4(%ebx)
+80105e88:	85 c0                	test   %eax,%eax
+80105e8a:	0f 84 8c 00 00 00    	je     80105f1c <kthread+0xb2>
+  *(uint*)(p->context + 1) = (uint)fn;
+80105e90:	8b 43 1c             	mov    0x1c(%ebx),%eax
+80105e93:	8b 55 0c             	mov    0xc(%ebp),%edx
+80105e96:	89 50 14             	mov    %edx,0x14(%eax)
+  p->sz = 0;
+80105e99:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  p->parent = initproc;
+80105e9f:	a1 94 dc 12 80       	mov    0x8012dc94,%eax
+80105ea4:	89 43 14             	mov    %eax,0x14(%ebx)
+  safestrcpy(p->name, name, sizeof(p->name));
+80105ea7:	8d 43 6c             	lea    0x6c(%ebx),%eax
+80105eaa:	83 ec 04             	sub    $0x4,%esp
+80105ead:	6a 10                	push   $0x10
+80105eaf:	ff 75 08             	push   0x8(%ebp)
+80105eb2:	50                   	push   %eax
+80105eb3:	e8 f2 1d 00 00       	call   80107caa <safestrcpy>
+  acquire(&ptable.lock);
+80105eb8:	c7 04 24 40 2e 12 80 	movl   $0x80122e40,(%esp)
+80105ebf:	e8 ce 1b 00 00       	call   80107a92 <acquire>
+  p->pri = NLAYER-1;
+80105ec4:	c7 43 7c 03 00 00 00 	movl   $0x3,0x7c(%ebx)
+  p->state = RUNNABLE;
+80105ecb:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+  ptable.pri_queue[p->pri].queue[ptable.pri_queue[p->pri].tail] = p;
+80105ed2:	a1 90 dc 12 80       	mov    0x8012dc90,%eax
+80105ed7:	89 1c 85 8c db 12 80 	mov    %ebx,-0x7fed2474(,%eax,4)
+  ptable.pri_queue[p->pri].tail++;
+80105ede:	69 43 7c 08 01 00 00 	imul   $0x108,0x7c(%ebx),%eax
+80105ee5:	8b 88 78 d9 12 80    	mov    -0x7fed2688(%eax),%ecx
+80105eeb:	8d 51 01             	lea    0x1(%ecx),%edx
+80105eee:	89 90 78 d9 12 80    	mov    %edx,-0x7fed2688(%eax)
+  p->qtail[p->pri]++;
+80105ef4:	8b 43 7c             	mov    0x7c(%ebx),%eax
+80105ef7:	83 c0 24             	add    $0x24,%eax
+80105efa:	8b 4c 83 04          	mov    0x4(%ebx,%eax,4),%ecx
+80105efe:	8d 51 01             	lea    0x1(%ecx),%edx
+80105f01:	89 54 83 04          	mov    %edx,0x4(%ebx,%eax,4)
+  release(&ptable.lock);
+80105f05:	c7 04 24 40 2e 12 80 	movl   $0x80122e40,(%esp)
+80105f0c:	e8 e6 1b 00 00       	call   80107af7 <release>
+  return p->pid;
+80105f11:	8b 43 10             	mov    0x10(%ebx),%eax
+80105f14:	83 c4 10             	add    $0x10,%esp
+}
+80105f17:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105f1a:	c9                   	leave
+80105f1b:	c3                   	ret
+    kfree(p->kstack);
+80105f1c:	83 ec 0c             	sub    $0xc,%esp
+80105f1f:	ff 73 08             	push   0x8(%ebx)
+80105f22:	e8 e8 d5 ff ff       	call   8010350f <kfree>
+    p->kstack = 0;
+80105f27:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    p->state = UNUSED;
+80105f2e:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+    return -1;
+80105f35:	83 c4 10             	add    $0x10,%esp
+80105f38:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105f3d:	eb d8                	jmp    80105f17 <kthread+0xad>
+    return -1;
+80105f3f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105f44:	eb d1                	jmp    80105f17 <kthread+0xad>
+
+80105f46 <growproc>:
+{
+80105f46:	55                   	push   %ebp
+80105f47:	89 e5                	mov    %esp,%ebp
+80105f49:	57                   	push   %edi
+80105f4a:	56                   	push   %esi
+80105f4b:	53                   	push   %ebx
+80105f4c:	83 ec 1c             	sub    $0x1c,%esp
+80105f4f:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct proc *curproc = myproc();
+80105f52:	e8 b4 fd ff ff       	call   80105d0b <myproc>
+  if(curproc->borrowed)
+80105f57:	8b b8 a4 00 00 00    	mov    0xa4(%eax),%edi
+80105f5d:	85 ff                	test   %edi,%edi
+80105f5f:	75 71                	jne    80105fd2 <growproc+0x8c>
+80105f61:	89 c3                	mov    %eax,%ebx
+  sz = curproc->sz;
+80105f63:	8b 00                	mov    (%eax),%eax
+  if(n > 0){
+80105f65:	85 f6                	test   %esi,%esi
+80105f67:	7e 42                	jle    80105fab <growproc+0x65>
+    if(sz + n < sz || sz + n >= UMAPBASE)
+80105f69:	01 c6                	add    %eax,%esi
+80105f6b:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+80105f6e:	72 69                	jb     80105fd9 <growproc+0x93>
+80105f70:	81 fe ff ff ff 5f    	cmp    $0x5fffffff,%esi
+80105f76:	77 68                	ja     80105fe0 <growproc+0x9a>
+    if((PGROUNDUP(sz + n) - PGROUNDUP(sz)) / PGSIZE > kfreepages())
+80105f78:	8d b6 ff 0f 00 00    	lea    0xfff(%esi),%esi
+80105f7e:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+80105f84:	05 ff 0f 00 00       	add    $0xfff,%eax
+80105f89:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+80105f8e:	29 c6                	sub    %eax,%esi
+80105f90:	c1 ee 0c             	shr    $0xc,%esi
+80105f93:	e8 aa dd ff ff       	call   80103d42 <kfreepages>
+80105f98:	39 f0                	cmp    %esi,%eax
+80105f9a:	72 4b                	jb     80105fe7 <growproc+0xa1>
+  curproc->sz = sz;
+80105f9c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80105f9f:	89 03                	mov    %eax,(%ebx)
+}
+80105fa1:	89 f8                	mov    %edi,%eax
+80105fa3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105fa6:	5b                   	pop    %ebx
+80105fa7:	5e                   	pop    %esi
+80105fa8:	5f                   	pop    %edi
+80105fa9:	5d                   	pop    %ebp
+80105faa:	c3                   	ret
+  } else if(n < 0){
+80105fab:	78 05                	js     80105fb2 <growproc+0x6c>
+  sz = curproc->sz;
+80105fad:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80105fb0:	eb ea                	jmp    80105f9c <growproc+0x56>
+    if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
+80105fb2:	83 ec 04             	sub    $0x4,%esp
+80105fb5:	01 c6                	add    %eax,%esi
+80105fb7:	56                   	push   %esi
+80105fb8:	50                   	push   %eax
+80105fb9:	ff 73 04             	push   0x4(%ebx)
+80105fbc:	e8 9c 4e 00 00       	call   8010ae5d <deallocuvm>
+80105fc1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80105fc4:	83 c4 10             	add    $0x10,%esp
+80105fc7:	85 c0                	test   %eax,%eax
+80105fc9:	75 d1                	jne    80105f9c <growproc+0x56>
+      return -1;
+80105fcb:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+80105fd0:	eb cf                	jmp    80105fa1 <growproc+0x5b>
+    return -1;
+80105fd2:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+80105fd7:	eb c8                	jmp    80105fa1 <growproc+0x5b>
+      return -1;
+80105fd9:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+80105fde:	eb c1                	jmp    80105fa1 <growproc+0x5b>
+80105fe0:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+80105fe5:	eb ba                	jmp    80105fa1 <growproc+0x5b>
+      return -1;
+80105fe7:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+80105fec:	eb b3                	jmp    80105fa1 <growproc+0x5b>
+
+80105fee <fork>:
+{
+80105fee:	55                   	push   %ebp
+80105fef:	89 e5                	mov    %esp,%ebp
+80105ff1:	57                   	push   %edi
+80105ff2:	56                   	push   %esi
+80105ff3:	53                   	push   %ebx
+80105ff4:	83 ec 1c             	sub    $0x1c,%esp
+  struct proc *curproc = myproc();
+80105ff7:	e8 0f fd ff ff       	call   80105d0b <myproc>
+80105ffc:	89 c7                	mov    %eax,%edi
+80105ffe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if((np = allocproc()) == 0){
+80106001:	e8 30 fb ff ff       	call   80105b36 <allocproc>
+80106006:	85 c0                	test   %eax,%eax
+80106008:	0f 84 3a 01 00 00    	je     80106148 <fork+0x15a>
+8010600e:	89 c3                	mov    %eax,%ebx
+  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
+80106010:	83 ec 08             	sub    $0x8,%esp
+80106013:	ff 37                	push   (%edi)
+80106015:	ff 77 04             	push   0x4(%edi)
+80106018:	e8 06 51 00 00       	call   8010b123 <copyuvm>
+8010601d:	89 43 04             	mov    %eax,0x4(%ebx)
+80106020:	83 c4 10             	add    $0x10,%esp
+80106023:	85 c0                	test   %eax,%eax
+80106025:	74 28                	je     8010604f <fork+0x61>
+  np->sz = curproc->sz;
+80106027:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010602a:	8b 01                	mov    (%ecx),%eax
+8010602c:	89 03                	mov    %eax,(%ebx)
+  np->parent = curproc;
+8010602e:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  *np->tf = *curproc->tf;
+80106031:	8b 71 18             	mov    0x18(%ecx),%esi
+80106034:	b9 13 00 00 00       	mov    $0x13,%ecx
+80106039:	8b 7b 18             	mov    0x18(%ebx),%edi
+8010603c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    np->tf->eax = 0;
+8010603e:	8b 43 18             	mov    0x18(%ebx),%eax
+80106041:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  for(i = 0; i < NOFILE; i++)
+80106048:	be 00 00 00 00       	mov    $0x0,%esi
+8010604d:	eb 29                	jmp    80106078 <fork+0x8a>
+    kfree(np->kstack);
+8010604f:	83 ec 0c             	sub    $0xc,%esp
+80106052:	ff 73 08             	push   0x8(%ebx)
+80106055:	e8 b5 d4 ff ff       	call   8010350f <kfree>
+    np->kstack = 0;
+8010605a:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    np->state = UNUSED;
+80106061:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+    return -1;
+80106068:	83 c4 10             	add    $0x10,%esp
+8010606b:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80106070:	e9 c9 00 00 00       	jmp    8010613e <fork+0x150>
+  for(i = 0; i < NOFILE; i++)
+80106075:	83 c6 01             	add    $0x1,%esi
+80106078:	83 fe 0f             	cmp    $0xf,%esi
+8010607b:	7f 1d                	jg     8010609a <fork+0xac>
+    if(curproc->ofile[i])
+8010607d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80106080:	8b 44 b0 28          	mov    0x28(%eax,%esi,4),%eax
+80106084:	85 c0                	test   %eax,%eax
+80106086:	74 ed                	je     80106075 <fork+0x87>
+      np->ofile[i] = filedup(curproc->ofile[i]);
+80106088:	83 ec 0c             	sub    $0xc,%esp
+8010608b:	50                   	push   %eax
+8010608c:	e8 9f b6 ff ff       	call   80101730 <filedup>
+80106091:	89 44 b3 28          	mov    %eax,0x28(%ebx,%esi,4)
+80106095:	83 c4 10             	add    $0x10,%esp
+80106098:	eb db                	jmp    80106075 <fork+0x87>
+  np->cwd = idup(curproc->cwd);
+8010609a:	83 ec 0c             	sub    $0xc,%esp
+8010609d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+801060a0:	ff 77 68             	push   0x68(%edi)
+801060a3:	e8 89 bf ff ff       	call   80102031 <idup>
+801060a8:	89 43 68             	mov    %eax,0x68(%ebx)
+  vmadup(np->vma, curproc->vma);
+801060ab:	8d 97 a8 00 00 00    	lea    0xa8(%edi),%edx
+801060b1:	8d 83 a8 00 00 00    	lea    0xa8(%ebx),%eax
+801060b7:	83 c4 08             	add    $0x8,%esp
+801060ba:	52                   	push   %edx
+801060bb:	50                   	push   %eax
+801060bc:	e8 b8 53 00 00       	call   8010b479 <vmadup>
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+801060c1:	8d 47 6c             	lea    0x6c(%edi),%eax
+801060c4:	8d 53 6c             	lea    0x6c(%ebx),%edx
+801060c7:	83 c4 0c             	add    $0xc,%esp
+801060ca:	6a 10                	push   $0x10
+801060cc:	50                   	push   %eax
+801060cd:	52                   	push   %edx
+801060ce:	e8 d7 1b 00 00       	call   80107caa <safestrcpy>
+  pid = np->pid;
+801060d3:	8b 73 10             	mov    0x10(%ebx),%esi
+  acquire(&ptable.lock);
+801060d6:	c7 04 24 40 2e 12 80 	movl   $0x80122e40,(%esp)
+801060dd:	e8 b0 19 00 00       	call   80107a92 <acquire>
+  np->state = RUNNABLE;
+801060e2:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+  np->pri = np->parent->pri;
+801060e9:	8b 43 14             	mov    0x14(%ebx),%eax
+801060ec:	8b 40 7c             	mov    0x7c(%eax),%eax
+801060ef:	89 43 7c             	mov    %eax,0x7c(%ebx)
+  ptable.pri_queue[np->pri].queue[ptable.pri_queue[np->pri].tail] = np;
+801060f2:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+801060f8:	6b c0 42             	imul   $0x42,%eax,%eax
+801060fb:	03 82 78 d9 12 80    	add    -0x7fed2688(%edx),%eax
+80106101:	89 1c 85 74 d8 12 80 	mov    %ebx,-0x7fed278c(,%eax,4)
+  ptable.pri_queue[np->pri].tail++;
+80106108:	69 43 7c 08 01 00 00 	imul   $0x108,0x7c(%ebx),%eax
+8010610f:	8b 90 78 d9 12 80    	mov    -0x7fed2688(%eax),%edx
+80106115:	83 c2 01             	add    $0x1,%edx
+80106118:	89 90 78 d9 12 80    	mov    %edx,-0x7fed2688(%eax)
+  np->qtail[np->pri]++;
+8010611e:	8b 43 7c             	mov    0x7c(%ebx),%eax
+80106121:	83 c0 24             	add    $0x24,%eax
+80106124:	8b 54 83 04          	mov    0x4(%ebx,%eax,4),%edx
+80106128:	83 c2 01             	add    $0x1,%edx
+8010612b:	89 54 83 04          	mov    %edx,0x4(%ebx,%eax,4)
+  release(&ptable.lock);
+8010612f:	c7 04 24 40 2e 12 80 	movl   $0x80122e40,(%esp)
+80106136:	e8 bc 19 00 00       	call   80107af7 <release>
+  return pid;
+8010613b:	83 c4 10             	add    $0x10,%esp
+}
+8010613e:	89 f0                	mov    %esi,%eax
+80106140:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106143:	5b                   	pop    %ebx
+80106144:	5e                   	pop    %esi
+80106145:	5f                   	pop    %edi
+80106146:	5d                   	pop    %ebp
+80106147:	c3                   	ret
+    return -1;
+80106148:	be ff ff ff ff       	mov    $0xffffffff,%esi
+8010614d:	eb ef                	jmp    8010613e <fork+0x150>
+
+8010614f <vforkdone>:
+{
+8010614f:	55                   	push   %ebp
+80106150:	89 e5                	mov    %esp,%ebp
+80106152:	53                   	push   %ebx
+80106153:	83 ec 10             	sub    $0x10,%esp
+80106156:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&ptable.lock);
+80106159:	68 40 2e 12 80       	push   $0x80122e40
+8010615e:	e8 2f 19 00 00       	call   80107a92 <acquire>
+  p->borrowed = 0;
+80106163:	c7 83 a4 00 00 00 00 	movl   $0x0,0xa4(%ebx)
+8010616a:	00 00 00 
+  wakeup1(p->parent);
+8010616d:	8b 43 14             	mov    0x14(%ebx),%eax
+80106170:	e8 e6 f8 ff ff       	call   80105a5b <wakeup1>
+  release(&ptable.lock);
+80106175:	c7 04 24 40 2e 12 80 	movl   $0x80122e40,(%esp)
+8010617c:	e8 76 19 00 00       	call   80107af7 <release>
+}
+80106181:	83 c4 10             	add    $0x10,%esp
+80106184:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106187:	c9                   	leave
+80106188:	c3                   	ret
+
+80106189 <scheduler>:
+{
+80106189:	55                   	push   %ebp
+8010618a:	89 e5                	mov    %esp,%ebp
+8010618c:	57                   	push   %edi
+8010618d:	56                   	push   %esi
+8010618e:	53                   	push   %ebx
+8010618f:	83 ec 1c             	sub    $0x1c,%esp
+  struct cpu *c = mycpu();
+80106192:	e8 fd fa ff ff       	call   80105c94 <mycpu>
+80106197:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  c->proc = 0;
+8010619a:	c7 80 ac 00 00 00 00 	movl   $0x0,0xac(%eax)
+801061a1:	00 00 00 
+801061a4:	e9 cf 00 00 00       	jmp    80106278 <scheduler+0xef>
+                    ptable.pri_queue[p->pri].queue[i] = ptable.pri_queue[p->pri].queue[i+1];
+801061a9:	6b c0 42             	imul   $0x42,%eax,%eax
+801061ac:	8d 94 03 8d 2a 00 00 	lea    0x2a8d(%ebx,%eax,1),%edx
+801061b3:	8b 14 95 44 2e 12 80 	mov    -0x7fedd1bc(,%edx,4),%edx
+801061ba:	8d 84 03 8c 2a 00 00 	lea    0x2a8c(%ebx,%eax,1),%eax
+801061c1:	89 14 85 44 2e 12 80 	mov    %edx,-0x7fedd1bc(,%eax,4)
+                for (int i = pindex; i < ptable.pri_queue[p->pri].tail-1; i++) {
+801061c8:	8d 5b 01             	lea    0x1(%ebx),%ebx
+801061cb:	8b 46 7c             	mov    0x7c(%esi),%eax
+801061ce:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+801061d4:	8b 92 78 d9 12 80    	mov    -0x7fed2688(%edx),%edx
+801061da:	83 ea 01             	sub    $0x1,%edx
+801061dd:	39 da                	cmp    %ebx,%edx
+801061df:	7f c8                	jg     801061a9 <scheduler+0x20>
+                ptable.pri_queue[p->pri].tail--;
+801061e1:	69 c0 08 01 00 00    	imul   $0x108,%eax,%eax
+801061e7:	89 90 78 d9 12 80    	mov    %edx,-0x7fed2688(%eax)
+                goto start;
+801061ed:	e9 97 00 00 00       	jmp    80106289 <scheduler+0x100>
+                pindex < ptable.pri_queue[level].tail; pindex++) {
+801061f2:	83 c3 01             	add    $0x1,%ebx
+801061f5:	e9 a4 00 00 00       	jmp    8010629e <scheduler+0x115>
+                    struct proc* temp = ptable.pri_queue[p->pri].queue[i+1];
+801061fa:	6b 46 7c 42          	imul   $0x42,0x7c(%esi),%eax
+801061fe:	8d 8c 03 8d 2a 00 00 	lea    0x2a8d(%ebx,%eax,1),%ecx
+80106205:	8b 0c 8d 44 2e 12 80 	mov    -0x7fedd1bc(,%ecx,4),%ecx
+                    ptable.pri_queue[p->pri].queue[i] = temp;
+8010620c:	8d 84 03 8c 2a 00 00 	lea    0x2a8c(%ebx,%eax,1),%eax
+80106213:	89 0c 85 44 2e 12 80 	mov    %ecx,-0x7fedd1bc(,%eax,4)
+                for (int i = pindex; i < ptable.pri_queue[level].tail-1; i++) {
+8010621a:	8d 5b 01             	lea    0x1(%ebx),%ebx
+8010621d:	8d 42 ff             	lea    -0x1(%edx),%eax
+80106220:	39 d8                	cmp    %ebx,%eax
+80106222:	7f d6                	jg     801061fa <scheduler+0x71>
+                ptable.pri_queue[p->pri].queue[ptable.pri_queue[p->pri].tail-1] = p;
+80106224:	8b 46 7c             	mov    0x7c(%esi),%eax
+80106227:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+8010622d:	8b 92 78 d9 12 80    	mov    -0x7fed2688(%edx),%edx
+80106233:	6b c0 42             	imul   $0x42,%eax,%eax
+80106236:	8d 84 02 8b 2a 00 00 	lea    0x2a8b(%edx,%eax,1),%eax
+8010623d:	89 34 85 44 2e 12 80 	mov    %esi,-0x7fedd1bc(,%eax,4)
+                p->qtail[level]++;
+80106244:	83 c7 24             	add    $0x24,%edi
+80106247:	8b 44 be 04          	mov    0x4(%esi,%edi,4),%eax
+8010624b:	83 c0 01             	add    $0x1,%eax
+8010624e:	89 44 be 04          	mov    %eax,0x4(%esi,%edi,4)
+                p->ticks_thisturn = 0;
+80106252:	c7 86 90 00 00 00 00 	movl   $0x0,0x90(%esi)
+80106259:	00 00 00 
+                goto start;
+8010625c:	eb 2b                	jmp    80106289 <scheduler+0x100>
+    for (int level = NLAYER-1; level >= 0; level--) {
+8010625e:	83 ef 01             	sub    $0x1,%edi
+80106261:	eb 2b                	jmp    8010628e <scheduler+0x105>
+    release(&ptable.lock);
+80106263:	83 ec 0c             	sub    $0xc,%esp
+80106266:	68 40 2e 12 80       	push   $0x80122e40
+8010626b:	e8 87 18 00 00       	call   80107af7 <release>
+    kzeroidle();
+80106270:	e8 dc d9 ff ff       	call   80103c51 <kzeroidle>
+    sti();
+80106275:	83 c4 10             	add    $0x10,%esp
+  asm volatile("sti");
+80106278:	fb                   	sti
+    acquire(&ptable.lock);
+80106279:	83 ec 0c             	sub    $0xc,%esp
+8010627c:	68 40 2e 12 80       	push   $0x80122e40
+80106281:	e8 0c 18 00 00       	call   80107a92 <acquire>
+80106286:	83 c4 10             	add    $0x10,%esp
+    for (int level = NLAYER-1; level >= 0; level--) {
+80106289:	bf 03 00 00 00       	mov    $0x3,%edi
+8010628e:	85 ff                	test   %edi,%edi
+80106290:	78 d1                	js     80106263 <scheduler+0xda>
+        for(int pindex = ptable.pri_queue[level].head;
+80106292:	69 c7 08 01 00 00    	imul   $0x108,%edi,%eax
+80106298:	8b 98 74 d9 12 80    	mov    -0x7fed268c(%eax),%ebx
+                pindex < ptable.pri_queue[level].tail; pindex++) {
+8010629e:	69 c7 08 01 00 00    	imul   $0x108,%edi,%eax
+801062a4:	39 98 78 d9 12 80    	cmp    %ebx,-0x7fed2688(%eax)
+801062aa:	7e b2                	jle    8010625e <scheduler+0xd5>
+            p = ptable.pri_queue[level].queue[pindex];
+801062ac:	6b c7 42             	imul   $0x42,%edi,%eax
+801062af:	8d 84 03 8c 2a 00 00 	lea    0x2a8c(%ebx,%eax,1),%eax
+801062b6:	8b 34 85 44 2e 12 80 	mov    -0x7fedd1bc(,%eax,4),%esi
+            if(p->state == ZOMBIE || p->state == UNUSED){
+801062bd:	8b 46 0c             	mov    0xc(%esi),%eax
+801062c0:	83 f8 05             	cmp    $0x5,%eax
+801062c3:	0f 94 c2             	sete   %dl
+801062c6:	85 c0                	test   %eax,%eax
+801062c8:	0f 94 c1             	sete   %cl
+801062cb:	08 ca                	or     %cl,%dl
+801062cd:	0f 85 f8 fe ff ff    	jne    801061cb <scheduler+0x42>
+            } else if (p->state == SLEEPING) {
+801062d3:	83 f8 02             	cmp    $0x2,%eax
+801062d6:	0f 84 16 ff ff ff    	je     801061f2 <scheduler+0x69>
+            c->proc = p;
+801062dc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801062df:	89 b0 ac 00 00 00    	mov    %esi,0xac(%eax)
+            switchuvm(p);
+801062e5:	83 ec 0c             	sub    $0xc,%esp
+801062e8:	56                   	push   %esi
+801062e9:	e8 b6 49 00 00       	call   8010aca4 <switchuvm>
+            p->state = RUNNING;
+801062ee:	c7 46 0c 04 00 00 00 	movl   $0x4,0xc(%esi)
+            swtch(&(c->scheduler), p->context);
+801062f5:	83 c4 08             	add    $0x8,%esp
+801062f8:	ff 76 1c             	push   0x1c(%esi)
+801062fb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801062fe:	83 c0 04             	add    $0x4,%eax
+80106301:	50                   	push   %eax
+80106302:	e8 f8 19 00 00       	call   80107cff <swtch>
+            switchkvm();
+80106307:	e8 8a 49 00 00       	call   8010ac96 <switchkvm>
+            p->ticks[p->pri]++;
+8010630c:	8b 56 7c             	mov    0x7c(%esi),%edx
+8010630f:	8d 4a 20             	lea    0x20(%edx),%ecx
+80106312:	8b 04 8e             	mov    (%esi,%ecx,4),%eax
+80106315:	83 c0 01             	add    $0x1,%eax
+80106318:	89 04 8e             	mov    %eax,(%esi,%ecx,4)
+            p->ticks_thisturn++;
+8010631b:	8b 86 90 00 00 00    	mov    0x90(%esi),%eax
+80106321:	83 c0 01             	add    $0x1,%eax
+80106324:	89 86 90 00 00 00    	mov    %eax,0x90(%esi)
+            if (p->ticks_thisturn >= TICK_LIMIT[p->pri]) {
+8010632a:	83 c4 10             	add    $0x10,%esp
+8010632d:	3b 04 95 d8 c0 10 80 	cmp    -0x7fef3f28(,%edx,4),%eax
+80106334:	0f 8c 4f ff ff ff    	jl     80106289 <scheduler+0x100>
+                if (ptable.pri_queue[level].tail == 1) {
+8010633a:	69 c7 08 01 00 00    	imul   $0x108,%edi,%eax
+80106340:	8b 90 78 d9 12 80    	mov    -0x7fed2688(%eax),%edx
+80106346:	83 fa 01             	cmp    $0x1,%edx
+80106349:	0f 85 ce fe ff ff    	jne    8010621d <scheduler+0x94>
+                    p->qtail[level]++;
+8010634f:	83 c7 24             	add    $0x24,%edi
+80106352:	8b 44 be 04          	mov    0x4(%esi,%edi,4),%eax
+80106356:	83 c0 01             	add    $0x1,%eax
+80106359:	89 44 be 04          	mov    %eax,0x4(%esi,%edi,4)
+                    p->ticks_thisturn = 0;
+8010635d:	c7 86 90 00 00 00 00 	movl   $0x0,0x90(%esi)
+80106364:	00 00 00 
+                    goto start;
+80106367:	e9 1d ff ff ff       	jmp    80106289 <scheduler+0x100>
+
+8010636c <sched>:
+{
+8010636c:	55                   	push   %ebp
+8010636d:	89 e5                	mov    %esp,%ebp
+8010636f:	56                   	push   %esi
+80106370:	53                   	push   %ebx
+  struct proc *p = myproc();
+80106371:	e8 95 f9 ff ff       	call   80105d0b <myproc>
+80106376:	89 c3                	mov    %eax,%ebx
+  if(!holding(&ptable.lock))
+80106378:	83 ec 0c             	sub    $0xc,%esp
+8010637b:	68 40 2e 12 80       	push   $0x80122e40
+80106380:	e8 ce 16 00 00       	call   80107a53 <holding>
+80106385:	83 c4 10             	add    $0x10,%esp
+80106388:	85 c0                	test   %eax,%eax
+8010638a:	74 4f                	je     801063db <sched+0x6f>
+  if(mycpu()->ncli != 1)
+8010638c:	e8 03 f9 ff ff       	call   80105c94 <mycpu>
+80106391:	83 b8 a4 00 00 00 01 	cmpl   $0x1,0xa4(%eax)
+80106398:	75 4e                	jne    801063e8 <sched+0x7c>
+  if(p->state == RUNNING)
+8010639a:	83 7b 0c 04          	cmpl   $0x4,0xc(%ebx)
+8010639e:	74 55                	je     801063f5 <sched+0x89>
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+801063a0:	9c                   	pushf
+801063a1:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+801063a2:	f6 c4 02             	test   $0x2,%ah
+801063a5:	75 5b                	jne    80106402 <sched+0x96>
+  intena = mycpu()->intena;
+801063a7:	e8 e8 f8 ff ff       	call   80105c94 <mycpu>
+801063ac:	8b b0 a8 00 00 00    	mov    0xa8(%eax),%esi
+  swtch(&p->context, mycpu()->scheduler);
+801063b2:	e8 dd f8 ff ff       	call   80105c94 <mycpu>
+801063b7:	83 ec 08             	sub    $0x8,%esp
+801063ba:	ff 70 04             	push   0x4(%eax)
+801063bd:	83 c3 1c             	add    $0x1c,%ebx
+801063c0:	53                   	push   %ebx
+801063c1:	e8 39 19 00 00       	call   80107cff <swtch>
+  mycpu()->intena = intena;
+801063c6:	e8 c9 f8 ff ff       	call   80105c94 <mycpu>
+801063cb:	89 b0 a8 00 00 00    	mov    %esi,0xa8(%eax)
+}
+801063d1:	83 c4 10             	add    $0x10,%esp
+801063d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801063d7:	5b                   	pop    %ebx
+801063d8:	5e                   	pop    %esi
+801063d9:	5d                   	pop    %ebp
+801063da:	c3                   	ret
+    panic("sched ptable.lock");
+801063db:	83 ec 0c             	sub    $0xc,%esp
+801063de:	68 ef bf 10 80       	push   $0x8010bfef
+801063e3:	e8 43 a9 ff ff       	call   80100d2b <panic>
+    panic("sched locks");
+801063e8:	83 ec 0c             	sub    $0xc,%esp
+801063eb:	68 01 c0 10 80       	push   $0x8010c001
+801063f0:	e8 36 a9 ff ff       	call   80100d2b <panic>
+    panic("sched running");
+801063f5:	83 ec 0c             	sub    $0xc,%esp
+801063f8:	68 0d c0 10 80       	push   $0x8010c00d
+801063fd:	e8 29 a9 ff ff       	call   80100d2b <panic>
+    panic("sched interruptible");
+80106402:	83 ec 0c             	sub    $0xc,%esp
+80106405:	68 1b c0 10 80       	push   $0x8010c01b
+8010640a:	e8 1c a9 ff ff       	call   80100d2b <panic>
+
+8010640f <exit>:
+{
+8010640f:	55                   	push   %ebp
+80106410:	89 e5                	mov    %esp,%ebp
+80106412:	56                   	push   %esi
+80106413:	53                   	push   %ebx
+  struct proc *curproc = myproc();
+80106414:	e8 f2 f8 ff ff       	call   80105d0b <myproc>
+  if(curproc == initproc)
+80106419:	39 05 94 dc 12 80    	cmp    %eax,0x8012dc94
+8010641f:	74 09                	je     8010642a <exit+0x1b>
+80106421:	89 c6                	mov    %eax,%esi
+  for(fd = 0; fd < NOFILE; fd++){
+80106423:	bb 00 00 00 00       	mov    $0x0,%ebx
+80106428:	eb 24                	jmp    8010644e <exit+0x3f>
+    panic("init exiting");
+8010642a:	83 ec 0c             	sub    $0xc,%esp
+8010642d:	68 2f c0 10 80       	push   $0x8010c02f
+80106432:	e8 f4 a8 ff ff       	call   80100d2b <panic>
+      fileclose(curproc->ofile[fd]);
+80106437:	83 ec 0c             	sub    $0xc,%esp
+8010643a:	50                   	push   %eax
+8010643b:	e8 35 b3 ff ff       	call   80101775 <fileclose>
+      curproc->ofile[fd] = 0;
+80106440:	c7 44 9e 28 00 00 00 	movl   $0x0,0x28(%esi,%ebx,4)
+80106447:	00 
+80106448:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++){
+8010644b:	83 c3 01             	add    $0x1,%ebx
+8010644e:	83 fb 0f             	cmp    $0xf,%ebx
+80106451:	7f 0a                	jg     8010645d <exit+0x4e>
+    if(curproc->ofile[fd]){
+80106453:	8b 44 9e 28          	mov    0x28(%esi,%ebx,4),%eax
+80106457:	85 c0                	test   %eax,%eax
+80106459:	75 dc                	jne    80106437 <exit+0x28>
+8010645b:	eb ee                	jmp    8010644b <exit+0x3c>
+  aiofree(curproc);
+8010645d:	83 ec 0c             	sub    $0xc,%esp
+80106460:	56                   	push   %esi
+80106461:	e8 e6 9d ff ff       	call   8010024c <aiofree>
+  if(!curproc->borrowed)
+80106466:	83 c4 10             	add    $0x10,%esp
+80106469:	83 be a4 00 00 00 00 	cmpl   $0x0,0xa4(%esi)
+80106470:	74 52                	je     801064c4 <exit+0xb5>
+  vmafree(curproc->vma);
+80106472:	8d 86 a8 00 00 00    	lea    0xa8(%esi),%eax
+80106478:	83 ec 0c             	sub    $0xc,%esp
+8010647b:	50                   	push   %eax
+8010647c:	e8 73 50 00 00       	call   8010b4f4 <vmafree>
+  begin_op();
+80106481:	e8 b4 e5 ff ff       	call   80104a3a <begin_op>
+  iput(curproc->cwd);
+80106486:	83 c4 04             	add    $0x4,%esp
+80106489:	ff 76 68             	push   0x68(%esi)
+8010648c:	e8 d7 bc ff ff       	call   80102168 <iput>
+  end_op();
+80106491:	e8 38 e6 ff ff       	call   80104ace <end_op>
+  curproc->cwd = 0;
+80106496:	c7 46 68 00 00 00 00 	movl   $0x0,0x68(%esi)
+  acquire(&ptable.lock);
+8010649d:	c7 04 24 40 2e 12 80 	movl   $0x80122e40,(%esp)
+801064a4:	e8 e9 15 00 00       	call   80107a92 <acquire>
+  if(curproc->borrowed){
+801064a9:	83 c4 10             	add    $0x10,%esp
+801064ac:	83 be a4 00 00 00 00 	cmpl   $0x0,0xa4(%esi)
+801064b3:	75 26                	jne    801064db <exit+0xcc>
+  wakeup1(curproc->parent);
+801064b5:	8b 46 14             	mov    0x14(%esi),%eax
+801064b8:	e8 9e f5 ff ff       	call   80105a5b <wakeup1>
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+801064bd:	bb 74 2e 12 80       	mov    $0x80122e74,%ebx
+801064c2:	eb 35                	jmp    801064f9 <exit+0xea>
+    vmasync(curproc->pgdir, curproc->vma);
+801064c4:	8d 86 a8 00 00 00    	lea    0xa8(%esi),%eax
+801064ca:	83 ec 08             	sub    $0x8,%esp
+801064cd:	50                   	push   %eax
+801064ce:	ff 76 04             	push   0x4(%esi)
+801064d1:	e8 ec ea ff ff       	call   80104fc2 <vmasync>
+801064d6:	83 c4 10             	add    $0x10,%esp
+801064d9:	eb 97                	jmp    80106472 <exit+0x63>
+    switchkvm();
+801064db:	e8 b6 47 00 00       	call   8010ac96 <switchkvm>
+    curproc->pgdir = 0;
+801064e0:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+    curproc->borrowed = 0;
+801064e7:	c7 86 a4 00 00 00 00 	movl   $0x0,0xa4(%esi)
+801064ee:	00 00 00 
+801064f1:	eb c2                	jmp    801064b5 <exit+0xa6>
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+801064f3:	81 c3 a8 02 00 00    	add    $0x2a8,%ebx
+801064f9:	81 fb 74 d8 12 80    	cmp    $0x8012d874,%ebx
+801064ff:	73 1a                	jae    8010651b <exit+0x10c>
+    if(p->parent == curproc){
+80106501:	39 73 14             	cmp    %esi,0x14(%ebx)
+80106504:	75 ed                	jne    801064f3 <exit+0xe4>
+      p->parent = initproc;
+80106506:	a1 94 dc 12 80       	mov    0x8012dc94,%eax
+8010650b:	89 43 14             	mov    %eax,0x14(%ebx)
+      if(p->state == ZOMBIE)
+8010650e:	83 7b 0c 05          	cmpl   $0x5,0xc(%ebx)
+80106512:	75 df                	jne    801064f3 <exit+0xe4>
+        wakeup1(initproc);
+80106514:	e8 42 f5 ff ff       	call   80105a5b <wakeup1>
+80106519:	eb d8                	jmp    801064f3 <exit+0xe4>
+  curproc->state = ZOMBIE;
+8010651b:	c7 46 0c 05 00 00 00 	movl   $0x5,0xc(%esi)
+  sched();
+80106522:	e8 45 fe ff ff       	call   8010636c <sched>
+  panic("zombie exit");
+80106527:	83 ec 0c             	sub    $0xc,%esp
+8010652a:	68 3c c0 10 80       	push   $0x8010c03c
+8010652f:	e8 f7 a7 ff ff       	call   80100d2b <panic>
+
+80106534 <yield>:
+{
+80106534:	55                   	push   %ebp
+80106535:	89 e5                	mov    %esp,%ebp
+80106537:	83 ec 14             	sub    $0x14,%esp
+  acquire(&ptable.lock);  //DOC: yieldlock
+8010653a:	68 40 2e 12 80       	push   $0x80122e40
+8010653f:	e8 4e 15 00 00       	call   80107a92 <acquire>
+  myproc()->state = RUNNABLE;
+80106544:	e8 c2 f7 ff ff       	call   80105d0b <myproc>
+80106549:	c7 40 0c 03 00 00 00 	movl   $0x3,0xc(%eax)
+  sched();
+80106550:	e8 17 fe ff ff       	call   8010636c <sched>
+  release(&ptable.lock);
+80106555:	c7 04 24 40 2e 12 80 	movl   $0x80122e40,(%esp)
+8010655c:	e8 96 15 00 00       	call   80107af7 <release>
+}
+80106561:	83 c4 10             	add    $0x10,%esp
+80106564:	c9                   	leave
+80106565:	c3                   	ret
+
+80106566 <sleep>:
+{
+80106566:	55                   	push   %ebp
+80106567:	89 e5                	mov    %esp,%ebp
+80106569:	56                   	push   %esi
+8010656a:	53                   	push   %ebx
+8010656b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  struct proc *p = myproc();
+8010656e:	e8 98 f7 ff ff       	call   80105d0b <myproc>
+  if(p == 0)
+80106573:	85 c0                	test   %eax,%eax
+80106575:	74 66                	je     801065dd <sleep+0x77>
+80106577:	89 c3                	mov    %eax,%ebx
+  if(lk == 0)
+80106579:	85 f6                	test   %esi,%esi
+8010657b:	74 6d                	je     801065ea <sleep+0x84>
+  if(lk != &ptable.lock){  //DOC: sleeplock0
+8010657d:	81 fe 40 2e 12 80    	cmp    $0x80122e40,%esi
+80106583:	74 18                	je     8010659d <sleep+0x37>
+    acquire(&ptable.lock);  //DOC: sleeplock1
+80106585:	83 ec 0c             	sub    $0xc,%esp
+80106588:	68 40 2e 12 80       	push   $0x80122e40
+8010658d:	e8 00 15 00 00       	call   80107a92 <acquire>
+    release(lk);
+80106592:	89 34 24             	mov    %esi,(%esp)
+80106595:	e8 5d 15 00 00       	call   80107af7 <release>
+8010659a:	83 c4 10             	add    $0x10,%esp
+  p->chan = chan;
+8010659d:	8b 45 08             	mov    0x8(%ebp),%eax
+801065a0:	89 43 20             	mov    %eax,0x20(%ebx)
+  p->state = SLEEPING;
+801065a3:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+  sched();
+801065aa:	e8 bd fd ff ff       	call   8010636c <sched>
+  p->chan = 0;
+801065af:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+  if(lk != &ptable.lock){  //DOC: sleeplock2
+801065b6:	81 fe 40 2e 12 80    	cmp    $0x80122e40,%esi
+801065bc:	74 18                	je     801065d6 <sleep+0x70>
+    release(&ptable.lock);
+801065be:	83 ec 0c             	sub    $0xc,%esp
+801065c1:	68 40 2e 12 80       	push   $0x80122e40
+801065c6:	e8 2c 15 00 00       	call   80107af7 <release>
+    acquire(lk);
+801065cb:	89 34 24             	mov    %esi,(%esp)
+801065ce:	e8 bf 14 00 00       	call   80107a92 <acquire>
+801065d3:	83 c4 10             	add    $0x10,%esp
+}
+801065d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801065d9:	5b                   	pop    %ebx
+801065da:	5e                   	pop    %esi
+801065db:	5d                   	pop    %ebp
+801065dc:	c3                   	ret
+    panic("sleep");
+801065dd:	83 ec 0c             	sub    $0xc,%esp
+801065e0:	68 48 c0 10 80       	push   $0x8010c048
+801065e5:	e8 41 a7 ff ff       	call   80100d2b <panic>
+    panic("sleep without lk");
+801065ea:	83 ec 0c             	sub    $0xc,%esp
+801065ed:	68 4e c0 10 80       	push   $0x8010c04e
+801065f2:	e8 34 a7 ff ff       	call   80100d2b <panic>
+
+801065f7 <vfork>:
+{
+801065f7:	55                   	push   %ebp
+801065f8:	89 e5                	mov    %esp,%ebp
+801065fa:	57                   	push   %edi
+801065fb:	56                   	push   %esi
+801065fc:	53                   	push   %ebx
+801065fd:	83 ec 1c             	sub    $0x1c,%esp
+  struct proc *curproc = myproc();
+80106600:	e8 06 f7 ff ff       	call   80105d0b <myproc>
+80106605:	89 c7                	mov    %eax,%edi
+80106607:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if((np = allocproc()) == 0){
+8010660a:	e8 27 f5 ff ff       	call   80105b36 <allocproc>
+8010660f:	85 c0                	test   %eax,%eax
+80106611:	0f 84 29 01 00 00    	je     80106740 <vfork+0x149>
+80106617:	89 c3                	mov    %eax,%ebx
+  np->pgdir = curproc->pgdir;
+80106619:	8b 47 04             	mov    0x4(%edi),%eax
+8010661c:	89 43 04             	mov    %eax,0x4(%ebx)
+  np->borrowed = 1;
+8010661f:	c7 83 a4 00 00 00 01 	movl   $0x1,0xa4(%ebx)
+80106626:	00 00 00 
+  np->sz = curproc->sz;
+80106629:	8b 07                	mov    (%edi),%eax
+8010662b:	89 03                	mov    %eax,(%ebx)
+  np->parent = curproc;
+8010662d:	89 7b 14             	mov    %edi,0x14(%ebx)
+  *np->tf = *curproc->tf;
+80106630:	8b 77 18             	mov    0x18(%edi),%esi
+80106633:	b9 13 00 00 00       	mov    $0x13,%ecx
+80106638:	8b 7b 18             	mov    0x18(%ebx),%edi
+8010663b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  np->tf->eax = 0;
+8010663d:	8b 43 18             	mov    0x18(%ebx),%eax
+80106640:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  for(i = 0; i < NOFILE; i++)
+80106647:	be 00 00 00 00       	mov    $0x0,%esi
+8010664c:	eb 03                	jmp    80106651 <vfork+0x5a>
+8010664e:	83 c6 01             	add    $0x1,%esi
+80106651:	83 fe 0f             	cmp    $0xf,%esi
+80106654:	7f 1d                	jg     80106673 <vfork+0x7c>
+    if(curproc->ofile[i])
+80106656:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80106659:	8b 44 b0 28          	mov    0x28(%eax,%esi,4),%eax
+8010665d:	85 c0                	test   %eax,%eax
+8010665f:	74 ed                	je     8010664e <vfork+0x57>
+      np->ofile[i] = filedup(curproc->ofile[i]);
+80106661:	83 ec 0c             	sub    $0xc,%esp
+80106664:	50                   	push   %eax
+80106665:	e8 c6 b0 ff ff       	call   80101730 <filedup>
+8010666a:	89 44 b3 28          	mov    %eax,0x28(%ebx,%esi,4)
+8010666e:	83 c4 10             	add    $0x10,%esp
+80106671:	eb db                	jmp    8010664e <vfork+0x57>
+  np->cwd = idup(curproc->cwd);
+80106673:	83 ec 0c             	sub    $0xc,%esp
+80106676:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80106679:	ff 77 68             	push   0x68(%edi)
+8010667c:	e8 b0 b9 ff ff       	call   80102031 <idup>
+80106681:	89 43 68             	mov    %eax,0x68(%ebx)
+  vmadup(np->vma, curproc->vma);
+80106684:	8d 97 a8 00 00 00    	lea    0xa8(%edi),%edx
+8010668a:	8d 83 a8 00 00 00    	lea    0xa8(%ebx),%eax
+80106690:	83 c4 08             	add    $0x8,%esp
+80106693:	52                   	push   %edx
+80106694:	50                   	push   %eax
+80106695:	e8 df 4d 00 00       	call   8010b479 <vmadup>
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+8010669a:	8d 57 6c             	lea    0x6c(%edi),%edx
+8010669d:	8d 43 6c             	lea    0x6c(%ebx),%eax
+801066a0:	83 c4 0c             	add    $0xc,%esp
+801066a3:	6a 10                	push   $0x10
+801066a5:	52                   	push   %edx
+801066a6:	50                   	push   %eax
+801066a7:	e8 fe 15 00 00       	call   80107caa <safestrcpy>
+  pid = np->pid;
+801066ac:	8b 73 10             	mov    0x10(%ebx),%esi
+  acquire(&ptable.lock);
+801066af:	c7 04 24 40 2e 12 80 	movl   $0x80122e40,(%esp)
+801066b6:	e8 d7 13 00 00       	call   80107a92 <acquire>
+  np->state = RUNNABLE;
+801066bb:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+  np->pri = curproc->pri;
+801066c2:	8b 47 7c             	mov    0x7c(%edi),%eax
+801066c5:	89 43 7c             	mov    %eax,0x7c(%ebx)
+  ptable.pri_queue[np->pri].queue[ptable.pri_queue[np->pri].tail] = np;
+801066c8:	69 d0 08 01 00 00    	imul   $0x108,%eax,%edx
+801066ce:	6b c0 42             	imul   $0x42,%eax,%eax
+801066d1:	03 82 78 d9 12 80    	add    -0x7fed2688(%edx),%eax
+801066d7:	89 1c 85 74 d8 12 80 	mov    %ebx,-0x7fed278c(,%eax,4)
+  ptable.pri_queue[np->pri].tail++;
+801066de:	69 43 7c 08 01 00 00 	imul   $0x108,0x7c(%ebx),%eax
+801066e5:	8b 88 78 d9 12 80    	mov    -0x7fed2688(%eax),%ecx
+801066eb:	8d 51 01             	lea    0x1(%ecx),%edx
+801066ee:	89 90 78 d9 12 80    	mov    %edx,-0x7fed2688(%eax)
+  np->qtail[np->pri]++;
+801066f4:	8b 43 7c             	mov    0x7c(%ebx),%eax
+801066f7:	83 c0 24             	add    $0x24,%eax
+801066fa:	8b 4c 83 04          	mov    0x4(%ebx,%eax,4),%ecx
+801066fe:	8d 51 01             	lea    0x1(%ecx),%edx
+80106701:	89 54 83 04          	mov    %edx,0x4(%ebx,%eax,4)
+  while(np->borrowed)
+80106705:	83 c4 10             	add    $0x10,%esp
+80106708:	83 bb a4 00 00 00 00 	cmpl   $0x0,0xa4(%ebx)
+8010670f:	74 15                	je     80106726 <vfork+0x12f>
+    sleep(curproc, &ptable.lock);
+80106711:	83 ec 08             	sub    $0x8,%esp
+80106714:	68 40 2e 12 80       	push   $0x80122e40
+80106719:	ff 75 e4             	push   -0x1c(%ebp)
+8010671c:	e8 45 fe ff ff       	call   80106566 <sleep>
+80106721:	83 c4 10             	add    $0x10,%esp
+80106724:	eb e2                	jmp    80106708 <vfork+0x111>
+  release(&ptable.lock);
+80106726:	83 ec 0c             	sub    $0xc,%esp
+80106729:	68 40 2e 12 80       	push   $0x80122e40
+8010672e:	e8 c4 13 00 00       	call   80107af7 <release>
+  return pid;
+80106733:	83 c4 10             	add    $0x10,%esp
+}
+80106736:	89 f0                	mov    %esi,%eax
+80106738:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010673b:	5b                   	pop    %ebx
+8010673c:	5e                   	pop    %esi
+8010673d:	5f                   	pop    %edi
+8010673e:	5d                   	pop    %ebp
+8010673f:	c3                   	ret
+    return -1;
+80106740:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80106745:	eb ef                	jmp    80106736 <vfork+0x13f>
+
+80106747 <wait>:
+{
+80106747:	55                   	push   %ebp
+80106748:	89 e5                	mov    %esp,%ebp
+8010674a:	56                   	push   %esi
+8010674b:	53                   	push   %ebx
+  struct proc *curproc = myproc();
+8010674c:	e8 ba f5 ff ff       	call   80105d0b <myproc>
+80106751:	89 c6                	mov    %eax,%esi
+  acquire(&ptable.lock);
+80106753:	83 ec 0c             	sub    $0xc,%esp
+80106756:	68 40 2e 12 80       	push   $0x80122e40
+8010675b:	e8 32 13 00 00       	call   80107a92 <acquire>
+80106760:	83 c4 10             	add    $0x10,%esp
+    havekids = 0;
+80106763:	b8 00 00 00 00       	mov    $0x0,%eax
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80106768:	bb 74 2e 12 80       	mov    $0x80122e74,%ebx
+8010676d:	eb 71                	jmp    801067e0 <wait+0x99>
+        pid = p->pid;
+8010676f:	8b 73 10             	mov    0x10(%ebx),%esi
+        kfree(p->kstack);
+80106772:	83 ec 0c             	sub    $0xc,%esp
+80106775:	ff 73 08             	push   0x8(%ebx)
+80106778:	e8 92 cd ff ff       	call   8010350f <kfree>
+        p->kstack = 0;
+8010677d:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+        if(p->pgdir)
+80106784:	8b 43 04             	mov    0x4(%ebx),%eax
+80106787:	83 c4 10             	add    $0x10,%esp
+8010678a:	85 c0                	test   %eax,%eax
+8010678c:	74 0c                	je     8010679a <wait+0x53>
+          freevm(p->pgdir);
+8010678e:	83 ec 0c             	sub    $0xc,%esp
+80106791:	50                   	push   %eax
+80106792:	e8 61 48 00 00       	call   8010aff8 <freevm>
+80106797:	83 c4 10             	add    $0x10,%esp
+        p->pgdir = 0;
+8010679a:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+        p->pid = 0;
+801067a1:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+        p->parent = 0;
+801067a8:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+        p->name[0] = 0;
+801067af:	c6 43 6c 00          	movb   $0x0,0x6c(%ebx)
+        p->killed = 0;
+801067b3:	c7 43 24 00 00 00 00 	movl   $0x0,0x24(%ebx)
+        p->state = UNUSED;
+801067ba:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+        release(&ptable.lock);
+801067c1:	83 ec 0c             	sub    $0xc,%esp
+801067c4:	68 40 2e 12 80       	push   $0x80122e40
+801067c9:	e8 29 13 00 00       	call   80107af7 <release>
+        return pid;
+801067ce:	83 c4 10             	add    $0x10,%esp
+}
+801067d1:	89 f0                	mov    %esi,%eax
+801067d3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801067d6:	5b                   	pop    %ebx
+801067d7:	5e                   	pop    %esi
+801067d8:	5d                   	pop    %ebp
+801067d9:	c3                   	ret
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+801067da:	81 c3 a8 02 00 00    	add    $0x2a8,%ebx
+801067e0:	81 fb 74 d8 12 80    	cmp    $0x8012d874,%ebx
+801067e6:	73 16                	jae    801067fe <wait+0xb7>
+      if(p->parent != curproc)
+801067e8:	39 73 14             	cmp    %esi,0x14(%ebx)
+801067eb:	75 ed                	jne    801067da <wait+0x93>
+      if(p->state == ZOMBIE){
+801067ed:	83 7b 0c 05          	cmpl   $0x5,0xc(%ebx)
+801067f1:	0f 84 78 ff ff ff    	je     8010676f <wait+0x28>
+      havekids = 1;
+801067f7:	b8 01 00 00 00       	mov    $0x1,%eax
+801067fc:	eb dc                	jmp    801067da <wait+0x93>
+    if(!havekids || curproc->killed){
+801067fe:	85 c0                	test   %eax,%eax
+80106800:	74 1c                	je     8010681e <wait+0xd7>
+80106802:	83 7e 24 00          	cmpl   $0x0,0x24(%esi)
+80106806:	75 16                	jne    8010681e <wait+0xd7>
+    sleep(curproc, &ptable.lock);  //DOC: wait-sleep
+80106808:	83 ec 08             	sub    $0x8,%esp
+8010680b:	68 40 2e 12 80       	push   $0x80122e40
+80106810:	56                   	push   %esi
+80106811:	e8 50 fd ff ff       	call   80106566 <sleep>
+    havekids = 0;
+80106816:	83 c4 10             	add    $0x10,%esp
+80106819:	e9 45 ff ff ff       	jmp    80106763 <wait+0x1c>
+      release(&ptable.lock);
+8010681e:	83 ec 0c             	sub    $0xc,%esp
+80106821:	68 40 2e 12 80       	push   $0x80122e40
+80106826:	e8 cc 12 00 00       	call   80107af7 <release>
+      return -1;
+8010682b:	83 c4 10             	add    $0x10,%esp
+8010682e:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80106833:	eb 9c                	jmp    801067d1 <wait+0x8a>
+
+80106835 <wakeup>:
+
+// Wake up all processes sleeping on chan.
+void
+wakeup(void *chan)
+{
+80106835:	55                   	push   %ebp
+80106836:	89 e5                	mov    %esp,%ebp
+80106838:	83 ec 14             	sub    $0x14,%esp
+  acquire(&ptable.lock);
+8010683b:	68 40 2e 12 80       	push   $0x80122e40
+80106840:	e8 4d 12 00 00       	call   80107a92 <acquire>
+  wakeup1(chan);
+80106845:	8b 45 08             	mov    0x8(%ebp),%eax
+80106848:	e8 0e f2 ff ff       	call   80105a5b <wakeup1>
+  release(&ptable.lock);
+8010684d:	c7 04 24 40 2e 12 80 	movl   $0x80122e40,(%esp)
+80106854:	e8 9e 12 00 00       	call   80107af7 <release>
+}
+80106859:	83 c4 10             	add    $0x10,%esp
+8010685c:	c9                   	leave
+8010685d:	c3                   	ret
+
+8010685e <kill>:
+// Kill the process with the given pid.
+// Process won't exit until it returns
+// to user space (see trap in trap.c).
+int
+kill(int pid)
+{
+8010685e:	55                   	push   %ebp
+8010685f:	89 e5                	mov    %esp,%ebp
+80106861:	53                   	push   %ebx
+80106862:	83 ec 10             	sub    $0x10,%esp
+80106865:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *p;
+
+  acquire(&ptable.lock);
+80106868:	68 40 2e 12 80       	push   $0x80122e40
+8010686d:	e8 20 12 00 00       	call   80107a92 <acquire>
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80106872:	83 c4 10             	add    $0x10,%esp
+80106875:	b8 74 2e 12 80       	mov    $0x80122e74,%eax
+8010687a:	eb 0e                	jmp    8010688a <kill+0x2c>
+    if(p->pid == pid){
+      p->killed = 1;
+      // Wake process from sleep if necessary.
+      if(p->state == SLEEPING)
+        p->state = RUNNABLE;
+8010687c:	c7 40 0c 03 00 00 00 	movl   $0x3,0xc(%eax)
+80106883:	eb 1e                	jmp    801068a3 <kill+0x45>
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80106885:	05 a8 02 00 00       	add    $0x2a8,%eax
+8010688a:	3d 74 d8 12 80       	cmp    $0x8012d874,%eax
+8010688f:	73 2c                	jae    801068bd <kill+0x5f>
+    if(p->pid == pid){
+80106891:	39 58 10             	cmp    %ebx,0x10(%eax)
+80106894:	75 ef                	jne    80106885 <kill+0x27>
+      p->killed = 1;
+80106896:	c7 40 24 01 00 00 00 	movl   $0x1,0x24(%eax)
+      if(p->state == SLEEPING)
+8010689d:	83 78 0c 02          	cmpl   $0x2,0xc(%eax)
+801068a1:	74 d9                	je     8010687c <kill+0x1e>
+      release(&ptable.lock);
+801068a3:	83 ec 0c             	sub    $0xc,%esp
+801068a6:	68 40 2e 12 80       	push   $0x80122e40
+801068ab:	e8 47 12 00 00       	call   80107af7 <release>
+      return 0;
+801068b0:	83 c4 10             	add    $0x10,%esp
+801068b3:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+  }
+  release(&ptable.lock);
+  return -1;
+}
+801068b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801068bb:	c9                   	leave
+801068bc:	c3                   	ret
+  release(&ptable.lock);
+801068bd:	83 ec 0c             	sub    $0xc,%esp
+801068c0:	68 40 2e 12 80       	push   $0x80122e40
+801068c5:	e8 2d 12 00 00       	call   80107af7 <release>
+  return -1;
+801068ca:	83 c4 10             	add    $0x10,%esp
+801068cd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801068d2:	eb e4                	jmp    801068b8 <kill+0x5a>
+
+801068d4 <procdump>:
+// Print a process listing to console.  For debugging.
+// Runs when user types ^P on console.
+// No lock to avoid wedging a stuck machine further.
+void
+procdump(void)
+{
+801068d4:	55                   	push   %ebp
+801068d5:	89 e5                	mov    %esp,%ebp
+801068d7:	56                   	push   %esi
+801068d8:	53                   	push   %ebx
+801068d9:	83 ec 30             	sub    $0x30,%esp
+  int i;
+  struct proc *p;
+  char *state;
+  uint pc[10];
+
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+801068dc:	bb 74 2e 12 80       	mov    $0x80122e74,%ebx
+801068e1:	eb 36                	jmp    80106919 <procdump+0x45>
+    if(p->state == UNUSED)
+      continue;
+    if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
+      state = states[p->state];
+    else
+      state = "???";
+801068e3:	b8 5f c0 10 80       	mov    $0x8010c05f,%eax
+    cprintf("%d %s %s", p->pid, state, p->name);
+801068e8:	8d 53 6c             	lea    0x6c(%ebx),%edx
+801068eb:	52                   	push   %edx
+801068ec:	50                   	push   %eax
+801068ed:	ff 73 10             	push   0x10(%ebx)
+801068f0:	68 63 c0 10 80       	push   $0x8010c063
+801068f5:	e8 f2 a6 ff ff       	call   80100fec <cprintf>
+    if(p->state == SLEEPING){
+801068fa:	83 c4 10             	add    $0x10,%esp
+801068fd:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+80106901:	74 3c                	je     8010693f <procdump+0x6b>
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+      for(i=0; i<10 && pc[i] != 0; i++)
+        cprintf(" %p", pc[i]);
+    }
+    cprintf("\n");
+80106903:	83 ec 0c             	sub    $0xc,%esp
+80106906:	68 0d c5 10 80       	push   $0x8010c50d
+8010690b:	e8 dc a6 ff ff       	call   80100fec <cprintf>
+80106910:	83 c4 10             	add    $0x10,%esp
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80106913:	81 c3 a8 02 00 00    	add    $0x2a8,%ebx
+80106919:	81 fb 74 d8 12 80    	cmp    $0x8012d874,%ebx
+8010691f:	73 61                	jae    80106982 <procdump+0xae>
+    if(p->state == UNUSED)
+80106921:	8b 43 0c             	mov    0xc(%ebx),%eax
+80106924:	85 c0                	test   %eax,%eax
+80106926:	74 eb                	je     80106913 <procdump+0x3f>
+    if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
+80106928:	83 f8 05             	cmp    $0x5,%eax
+8010692b:	77 b6                	ja     801068e3 <procdump+0xf>
+8010692d:	8b 04 85 c0 c0 10 80 	mov    -0x7fef3f40(,%eax,4),%eax
+80106934:	85 c0                	test   %eax,%eax
+80106936:	75 b0                	jne    801068e8 <procdump+0x14>
+      state = "???";
+80106938:	b8 5f c0 10 80       	mov    $0x8010c05f,%eax
+8010693d:	eb a9                	jmp    801068e8 <procdump+0x14>
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+8010693f:	8b 43 1c             	mov    0x1c(%ebx),%eax
+80106942:	8b 40 0c             	mov    0xc(%eax),%eax
+80106945:	83 c0 08             	add    $0x8,%eax
+80106948:	83 ec 08             	sub    $0x8,%esp
+8010694b:	8d 55 d0             	lea    -0x30(%ebp),%edx
+8010694e:	52                   	push   %edx
+8010694f:	50                   	push   %eax
+80106950:	e8 14 10 00 00       	call   80107969 <getcallerpcs>
+      for(i=0; i<10 && pc[i] != 0; i++)
+80106955:	83 c4 10             	add    $0x10,%esp
+80106958:	be 00 00 00 00       	mov    $0x0,%esi
+8010695d:	eb 14                	jmp    80106973 <procdump+0x9f>
+        cprintf(" %p", pc[i]);
+8010695f:	83 ec 08             	sub    $0x8,%esp
+80106962:	50                   	push   %eax
+80106963:	68 dd b9 10 80       	push   $0x8010b9dd
+80106968:	e8 7f a6 ff ff       	call   80100fec <cprintf>
+      for(i=0; i<10 && pc[i] != 0; i++)
+8010696d:	83 c6 01             	add    $0x1,%esi
+80106970:	83 c4 10             	add    $0x10,%esp
+80106973:	83 fe 09             	cmp    $0x9,%esi
+80106976:	7f 8b                	jg     80106903 <procdump+0x2f>
+80106978:	8b 44 b5 d0          	mov    -0x30(%ebp,%esi,4),%eax
+8010697c:	85 c0                	test   %eax,%eax
+8010697e:	75 df                	jne    8010695f <procdump+0x8b>
+80106980:	eb 81                	jmp    80106903 <procdump+0x2f>
+  }
+}
+80106982:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106985:	5b                   	pop    %ebx
+80106986:	5e                   	pop    %esi
+80106987:	5d                   	pop    %ebp
+80106988:	c3                   	ret
+
+80106989 <setpri>:
+
+int
+setpri(int pid, int pri)
+{
+80106989:	55                   	push   %ebp
+8010698a:	89 e5                	mov    %esp,%ebp
+8010698c:	57                   	push   %edi
+8010698d:	56                   	push   %esi
+8010698e:	53                   	push   %ebx
+8010698f:	83 ec 0c             	sub    $0xc,%esp
+80106992:	8b 75 08             	mov    0x8(%ebp),%esi
+80106995:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    struct proc *p;
+    if (pri > 3 || pri < 0) {
+80106998:	83 fb 03             	cmp    $0x3,%ebx
+8010699b:	0f 87 2e 01 00 00    	ja     80106acf <setpri+0x146>
+        return -1;
+    }
+    acquire(&ptable.lock);
+801069a1:	83 ec 0c             	sub    $0xc,%esp
+801069a4:	68 40 2e 12 80       	push   $0x80122e40
+801069a9:	e8 e4 10 00 00       	call   80107a92 <acquire>
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+801069ae:	83 c4 10             	add    $0x10,%esp
+801069b1:	b8 74 2e 12 80       	mov    $0x80122e74,%eax
+801069b6:	e9 af 00 00 00       	jmp    80106a6a <setpri+0xe1>
+        if(p->pid == pid){
+            // delete p from old priority queue
+            for(int pindex = ptable.pri_queue[p->pri].head; pindex < ptable.pri_queue[p->pri].tail; pindex++) {
+                if (ptable.pri_queue[p->pri].queue[pindex]->pid == p->pid) {
+                    for (int i = pindex; i < ptable.pri_queue[p->pri].tail-1; i++) {
+801069bb:	8b 48 7c             	mov    0x7c(%eax),%ecx
+801069be:	69 f1 08 01 00 00    	imul   $0x108,%ecx,%esi
+801069c4:	8b b6 78 d9 12 80    	mov    -0x7fed2688(%esi),%esi
+801069ca:	83 ee 01             	sub    $0x1,%esi
+801069cd:	39 d6                	cmp    %edx,%esi
+801069cf:	7e 24                	jle    801069f5 <setpri+0x6c>
+                        ptable.pri_queue[p->pri].queue[i] = ptable.pri_queue[p->pri].queue[i+1];
+801069d1:	6b c9 42             	imul   $0x42,%ecx,%ecx
+801069d4:	8d b4 0a 8d 2a 00 00 	lea    0x2a8d(%edx,%ecx,1),%esi
+801069db:	8b 34 b5 44 2e 12 80 	mov    -0x7fedd1bc(,%esi,4),%esi
+801069e2:	8d 8c 0a 8c 2a 00 00 	lea    0x2a8c(%edx,%ecx,1),%ecx
+801069e9:	89 34 8d 44 2e 12 80 	mov    %esi,-0x7fedd1bc(,%ecx,4)
+                    for (int i = pindex; i < ptable.pri_queue[p->pri].tail-1; i++) {
+801069f0:	8d 52 01             	lea    0x1(%edx),%edx
+801069f3:	eb c6                	jmp    801069bb <setpri+0x32>
+                    }
+                    ptable.pri_queue[p->pri].tail--;
+801069f5:	69 c9 08 01 00 00    	imul   $0x108,%ecx,%ecx
+801069fb:	89 b1 78 d9 12 80    	mov    %esi,-0x7fed2688(%ecx)
+                    break;
+                }
+            }
+            p->pri = pri;
+80106a01:	89 58 7c             	mov    %ebx,0x7c(%eax)
+
+            // add p to the tail of new priority queue
+            // reset its tick time for this level
+            // increment qtail for this level
+            ptable.pri_queue[p->pri].queue[ptable.pri_queue[p->pri].tail] = p;
+80106a04:	69 cb 08 01 00 00    	imul   $0x108,%ebx,%ecx
+80106a0a:	6b d3 42             	imul   $0x42,%ebx,%edx
+80106a0d:	03 91 78 d9 12 80    	add    -0x7fed2688(%ecx),%edx
+80106a13:	89 04 95 74 d8 12 80 	mov    %eax,-0x7fed278c(,%edx,4)
+            ptable.pri_queue[p->pri].tail++;
+80106a1a:	69 50 7c 08 01 00 00 	imul   $0x108,0x7c(%eax),%edx
+80106a21:	8b ba 78 d9 12 80    	mov    -0x7fed2688(%edx),%edi
+80106a27:	8d 4f 01             	lea    0x1(%edi),%ecx
+80106a2a:	89 8a 78 d9 12 80    	mov    %ecx,-0x7fed2688(%edx)
+            p->ticks_thisturn = 0;
+80106a30:	c7 80 90 00 00 00 00 	movl   $0x0,0x90(%eax)
+80106a37:	00 00 00 
+            p->qtail[pri]++;
+80106a3a:	83 c3 24             	add    $0x24,%ebx
+80106a3d:	8b 54 98 04          	mov    0x4(%eax,%ebx,4),%edx
+80106a41:	83 c2 01             	add    $0x1,%edx
+80106a44:	89 54 98 04          	mov    %edx,0x4(%eax,%ebx,4)
+            release(&ptable.lock);
+80106a48:	83 ec 0c             	sub    $0xc,%esp
+80106a4b:	68 40 2e 12 80       	push   $0x80122e40
+80106a50:	e8 a2 10 00 00       	call   80107af7 <release>
+            return 0;
+80106a55:	83 c4 10             	add    $0x10,%esp
+80106a58:	b8 00 00 00 00       	mov    $0x0,%eax
+        }
+    }
+    release(&ptable.lock);
+    return -1;
+}
+80106a5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106a60:	5b                   	pop    %ebx
+80106a61:	5e                   	pop    %esi
+80106a62:	5f                   	pop    %edi
+80106a63:	5d                   	pop    %ebp
+80106a64:	c3                   	ret
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80106a65:	05 a8 02 00 00       	add    $0x2a8,%eax
+80106a6a:	3d 74 d8 12 80       	cmp    $0x8012d874,%eax
+80106a6f:	73 47                	jae    80106ab8 <setpri+0x12f>
+        if(p->pid == pid){
+80106a71:	8b 48 10             	mov    0x10(%eax),%ecx
+80106a74:	39 f1                	cmp    %esi,%ecx
+80106a76:	75 ed                	jne    80106a65 <setpri+0xdc>
+            for(int pindex = ptable.pri_queue[p->pri].head; pindex < ptable.pri_queue[p->pri].tail; pindex++) {
+80106a78:	8b 70 7c             	mov    0x7c(%eax),%esi
+80106a7b:	69 d6 08 01 00 00    	imul   $0x108,%esi,%edx
+80106a81:	8b 92 74 d9 12 80    	mov    -0x7fed268c(%edx),%edx
+80106a87:	69 fe 08 01 00 00    	imul   $0x108,%esi,%edi
+80106a8d:	39 97 78 d9 12 80    	cmp    %edx,-0x7fed2688(%edi)
+80106a93:	0f 8e 68 ff ff ff    	jle    80106a01 <setpri+0x78>
+                if (ptable.pri_queue[p->pri].queue[pindex]->pid == p->pid) {
+80106a99:	6b fe 42             	imul   $0x42,%esi,%edi
+80106a9c:	8d bc 3a 8c 2a 00 00 	lea    0x2a8c(%edx,%edi,1),%edi
+80106aa3:	8b 3c bd 44 2e 12 80 	mov    -0x7fedd1bc(,%edi,4),%edi
+80106aaa:	3b 4f 10             	cmp    0x10(%edi),%ecx
+80106aad:	0f 84 08 ff ff ff    	je     801069bb <setpri+0x32>
+            for(int pindex = ptable.pri_queue[p->pri].head; pindex < ptable.pri_queue[p->pri].tail; pindex++) {
+80106ab3:	83 c2 01             	add    $0x1,%edx
+80106ab6:	eb cf                	jmp    80106a87 <setpri+0xfe>
+    release(&ptable.lock);
+80106ab8:	83 ec 0c             	sub    $0xc,%esp
+80106abb:	68 40 2e 12 80       	push   $0x80122e40
+80106ac0:	e8 32 10 00 00       	call   80107af7 <release>
+    return -1;
+80106ac5:	83 c4 10             	add    $0x10,%esp
+80106ac8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106acd:	eb 8e                	jmp    80106a5d <setpri+0xd4>
+        return -1;
+80106acf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106ad4:	eb 87                	jmp    80106a5d <setpri+0xd4>
+
+80106ad6 <getpri>:
+
+int
+getpri(int pid)
+{
+80106ad6:	55                   	push   %ebp
+80106ad7:	89 e5                	mov    %esp,%ebp
+80106ad9:	56                   	push   %esi
+80106ada:	53                   	push   %ebx
+80106adb:	8b 75 08             	mov    0x8(%ebp),%esi
+    struct proc *p;
+    acquire(&ptable.lock);
+80106ade:	83 ec 0c             	sub    $0xc,%esp
+80106ae1:	68 40 2e 12 80       	push   $0x80122e40
+80106ae6:	e8 a7 0f 00 00       	call   80107a92 <acquire>
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80106aeb:	83 c4 10             	add    $0x10,%esp
+80106aee:	bb 74 2e 12 80       	mov    $0x80122e74,%ebx
+80106af3:	eb 06                	jmp    80106afb <getpri+0x25>
+80106af5:	81 c3 a8 02 00 00    	add    $0x2a8,%ebx
+80106afb:	81 fb 74 d8 12 80    	cmp    $0x8012d874,%ebx
+80106b01:	73 1f                	jae    80106b22 <getpri+0x4c>
+        if(p->pid == pid){
+80106b03:	39 73 10             	cmp    %esi,0x10(%ebx)
+80106b06:	75 ed                	jne    80106af5 <getpri+0x1f>
+            // Wake process from sleep if necessary.
+            release(&ptable.lock);
+80106b08:	83 ec 0c             	sub    $0xc,%esp
+80106b0b:	68 40 2e 12 80       	push   $0x80122e40
+80106b10:	e8 e2 0f 00 00       	call   80107af7 <release>
+            return p->pri;
+80106b15:	8b 43 7c             	mov    0x7c(%ebx),%eax
+80106b18:	83 c4 10             	add    $0x10,%esp
+        }
+    }
+    release(&ptable.lock);
+    return -1;
+}
+80106b1b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106b1e:	5b                   	pop    %ebx
+80106b1f:	5e                   	pop    %esi
+80106b20:	5d                   	pop    %ebp
+80106b21:	c3                   	ret
+    release(&ptable.lock);
+80106b22:	83 ec 0c             	sub    $0xc,%esp
+80106b25:	68 40 2e 12 80       	push   $0x80122e40
+80106b2a:	e8 c8 0f 00 00       	call   80107af7 <release>
+    return -1;
+80106b2f:	83 c4 10             	add    $0x10,%esp
+80106b32:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106b37:	eb e2                	jmp    80106b1b <getpri+0x45>
+
+80106b39 <fork2>:
+
+int
+fork2(int pri)
+{
+80106b39:	55                   	push   %ebp
+80106b3a:	89 e5                	mov    %esp,%ebp
+80106b3c:	57                   	push   %edi
+80106b3d:	56                   	push   %esi
+80106b3e:	53                   	push   %ebx
+80106b3f:	83 ec 1c             	sub    $0x1c,%esp
+    if (pri > 3 || pri < 0) {
+80106b42:	83 7d 08 03          	cmpl   $0x3,0x8(%ebp)
+80106b46:	0f 87 48 01 00 00    	ja     80106c94 <fork2+0x15b>
+        return -1;
+    }
+    int i, pid;
+    struct proc *np;
+    struct proc *curproc = myproc();
+80106b4c:	e8 ba f1 ff ff       	call   80105d0b <myproc>
+80106b51:	89 c7                	mov    %eax,%edi
+80106b53:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+    // Allocate process.
+    if((np = allocproc()) == 0){
+80106b56:	e8 db ef ff ff       	call   80105b36 <allocproc>
+80106b5b:	89 c3                	mov    %eax,%ebx
+80106b5d:	85 c0                	test   %eax,%eax
+80106b5f:	0f 84 36 01 00 00    	je     80106c9b <fork2+0x162>
+      return -1;
+    }
+
+    // Copy process state from proc.
+    if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
+80106b65:	83 ec 08             	sub    $0x8,%esp
+80106b68:	ff 37                	push   (%edi)
+80106b6a:	ff 77 04             	push   0x4(%edi)
+80106b6d:	e8 b1 45 00 00       	call   8010b123 <copyuvm>
+80106b72:	89 43 04             	mov    %eax,0x4(%ebx)
+80106b75:	83 c4 10             	add    $0x10,%esp
+80106b78:	85 c0                	test   %eax,%eax
+80106b7a:	74 2a                	je     80106ba6 <fork2+0x6d>
+      kfree(np->kstack);
+      np->kstack = 0;
+      np->state = UNUSED;
+      return -1;
+    }
+    np->sz = curproc->sz;
+80106b7c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80106b7f:	8b 02                	mov    (%edx),%eax
+80106b81:	89 03                	mov    %eax,(%ebx)
+    np->parent = curproc;
+80106b83:	89 53 14             	mov    %edx,0x14(%ebx)
+    *np->tf = *curproc->tf;
+80106b86:	8b 72 18             	mov    0x18(%edx),%esi
+80106b89:	b9 13 00 00 00       	mov    $0x13,%ecx
+80106b8e:	8b 7b 18             	mov    0x18(%ebx),%edi
+80106b91:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+
+    // Clear %eax so that fork returns 0 in the child.
+    np->tf->eax = 0;
+80106b93:	8b 43 18             	mov    0x18(%ebx),%eax
+80106b96:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+
+    for(i = 0; i < NOFILE; i++)
+80106b9d:	be 00 00 00 00       	mov    $0x0,%esi
+80106ba2:	89 d7                	mov    %edx,%edi
+80106ba4:	eb 39                	jmp    80106bdf <fork2+0xa6>
+      kfree(np->kstack);
+80106ba6:	83 ec 0c             	sub    $0xc,%esp
+80106ba9:	ff 73 08             	push   0x8(%ebx)
+80106bac:	e8 5e c9 ff ff       	call   8010350f <kfree>
+      np->kstack = 0;
+80106bb1:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+      np->state = UNUSED;
+80106bb8:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+      return -1;
+80106bbf:	83 c4 10             	add    $0x10,%esp
+80106bc2:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80106bc7:	e9 be 00 00 00       	jmp    80106c8a <fork2+0x151>
+      if(curproc->ofile[i])
+        np->ofile[i] = filedup(curproc->ofile[i]);
+80106bcc:	83 ec 0c             	sub    $0xc,%esp
+80106bcf:	50                   	push   %eax
+80106bd0:	e8 5b ab ff ff       	call   80101730 <filedup>
+80106bd5:	89 44 b3 28          	mov    %eax,0x28(%ebx,%esi,4)
+80106bd9:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < NOFILE; i++)
+80106bdc:	83 c6 01             	add    $0x1,%esi
+80106bdf:	83 fe 0f             	cmp    $0xf,%esi
+80106be2:	7f 0a                	jg     80106bee <fork2+0xb5>
+      if(curproc->ofile[i])
+80106be4:	8b 44 b7 28          	mov    0x28(%edi,%esi,4),%eax
+80106be8:	85 c0                	test   %eax,%eax
+80106bea:	75 e0                	jne    80106bcc <fork2+0x93>
+80106bec:	eb ee                	jmp    80106bdc <fork2+0xa3>
+    np->cwd = idup(curproc->cwd);
+80106bee:	83 ec 0c             	sub    $0xc,%esp
+80106bf1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80106bf4:	ff 77 68             	push   0x68(%edi)
+80106bf7:	e8 35 b4 ff ff       	call   80102031 <idup>
+80106bfc:	89 43 68             	mov    %eax,0x68(%ebx)
+    vmadup(np->vma, curproc->vma);
+80106bff:	8d 97 a8 00 00 00    	lea    0xa8(%edi),%edx
+80106c05:	8d 83 a8 00 00 00    	lea    0xa8(%ebx),%eax
+80106c0b:	83 c4 08             	add    $0x8,%esp
+80106c0e:	52                   	push   %edx
+80106c0f:	50                   	push   %eax
+80106c10:	e8 64 48 00 00       	call   8010b479 <vmadup>
+
+    safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+80106c15:	8d 47 6c             	lea    0x6c(%edi),%eax
+80106c18:	8d 53 6c             	lea    0x6c(%ebx),%edx
+80106c1b:	83 c4 0c             	add    $0xc,%esp
+80106c1e:	6a 10                	push   $0x10
+80106c20:	50                   	push   %eax
+80106c21:	52                   	push   %edx
+80106c22:	e8 83 10 00 00       	call   80107caa <safestrcpy>
+
+    pid = np->pid;
+80106c27:	8b 73 10             	mov    0x10(%ebx),%esi
+
+    acquire(&ptable.lock);
+80106c2a:	c7 04 24 40 2e 12 80 	movl   $0x80122e40,(%esp)
+80106c31:	e8 5c 0e 00 00       	call   80107a92 <acquire>
+
+
+    np->state = RUNNABLE;
+80106c36:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+    np->pri = pri;
+80106c3d:	8b 45 08             	mov    0x8(%ebp),%eax
+80106c40:	89 43 7c             	mov    %eax,0x7c(%ebx)
+    ptable.pri_queue[np->pri].queue[ptable.pri_queue[np->pri].tail] = np;
+80106c43:	69 c0 08 01 00 00    	imul   $0x108,%eax,%eax
+80106c49:	8b 90 78 d9 12 80    	mov    -0x7fed2688(%eax),%edx
+80106c4f:	6b 4d 08 42          	imul   $0x42,0x8(%ebp),%ecx
+80106c53:	8d 8c 0a 8c 2a 00 00 	lea    0x2a8c(%edx,%ecx,1),%ecx
+80106c5a:	89 1c 8d 44 2e 12 80 	mov    %ebx,-0x7fedd1bc(,%ecx,4)
+    ptable.pri_queue[pri].tail++;
+80106c61:	83 c2 01             	add    $0x1,%edx
+80106c64:	89 90 78 d9 12 80    	mov    %edx,-0x7fed2688(%eax)
+    np->qtail[pri]++;
+80106c6a:	8b 45 08             	mov    0x8(%ebp),%eax
+80106c6d:	83 c0 24             	add    $0x24,%eax
+80106c70:	8b 4c 83 04          	mov    0x4(%ebx,%eax,4),%ecx
+80106c74:	8d 51 01             	lea    0x1(%ecx),%edx
+80106c77:	89 54 83 04          	mov    %edx,0x4(%ebx,%eax,4)
+
+    release(&ptable.lock);
+80106c7b:	c7 04 24 40 2e 12 80 	movl   $0x80122e40,(%esp)
+80106c82:	e8 70 0e 00 00       	call   80107af7 <release>
+
+    return pid;
+80106c87:	83 c4 10             	add    $0x10,%esp
+}
+80106c8a:	89 f0                	mov    %esi,%eax
+80106c8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106c8f:	5b                   	pop    %ebx
+80106c90:	5e                   	pop    %esi
+80106c91:	5f                   	pop    %edi
+80106c92:	5d                   	pop    %ebp
+80106c93:	c3                   	ret
+        return -1;
+80106c94:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80106c99:	eb ef                	jmp    80106c8a <fork2+0x151>
+      return -1;
+80106c9b:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80106ca0:	eb e8                	jmp    80106c8a <fork2+0x151>
+
+80106ca2 <spawn>:
+// exec(), the caller's memory is never copied: the child's
+// page table is built directly from the executable.
+// Returns the child's pid, or -1 on failure.
+int
+spawn(char *path, char **argv, int pri)
+{
+80106ca2:	55                   	push   %ebp
+80106ca3:	89 e5                	mov    %esp,%ebp
+80106ca5:	57                   	push   %edi
+80106ca6:	56                   	push   %esi
+80106ca7:	53                   	push   %ebx
+80106ca8:	83 ec 0c             	sub    $0xc,%esp
+    if (pri > 3 || pri < 0) {
+80106cab:	83 7d 10 03          	cmpl   $0x3,0x10(%ebp)
+80106caf:	0f 87 42 01 00 00    	ja     80106df7 <spawn+0x155>
+        return -1;
+    }
+    int i, pid;
+    struct proc *np;
+    struct proc *curproc = myproc();
+80106cb5:	e8 51 f0 ff ff       	call   80105d0b <myproc>
+80106cba:	89 c7                	mov    %eax,%edi
+
+    // Allocate process.
+    if((np = allocproc()) == 0){
+80106cbc:	e8 75 ee ff ff       	call   80105b36 <allocproc>
+80106cc1:	89 c6                	mov    %eax,%esi
+80106cc3:	85 c0                	test   %eax,%eax
+80106cc5:	0f 84 33 01 00 00    	je     80106dfe <spawn+0x15c>
+      return -1;
+    }
+
+    // Start in user mode at the entry point exec sets up.
+    memset(np->tf, 0, sizeof(*np->tf));
+80106ccb:	8b 40 18             	mov    0x18(%eax),%eax
+80106cce:	83 ec 04             	sub    $0x4,%esp
+80106cd1:	6a 4c                	push   $0x4c
+80106cd3:	6a 00                	push   $0x0
+80106cd5:	50                   	push   %eax
+80106cd6:	e8 63 0e 00 00       	call   80107b3e <memset>
+    np->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+80106cdb:	8b 46 18             	mov    0x18(%esi),%eax
+80106cde:	66 c7 40 3c 1b 00    	movw   $0x1b,0x3c(%eax)
+    np->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+80106ce4:	8b 46 18             	mov    0x18(%esi),%eax
+80106ce7:	66 c7 40 2c 23 00    	movw   $0x23,0x2c(%eax)
+    np->tf->es = np->tf->ds;
+80106ced:	8b 46 18             	mov    0x18(%esi),%eax
+80106cf0:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80106cf4:	66 89 50 28          	mov    %dx,0x28(%eax)
+    np->tf->ss = np->tf->ds;
+80106cf8:	8b 46 18             	mov    0x18(%esi),%eax
+80106cfb:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80106cff:	66 89 50 48          	mov    %dx,0x48(%eax)
+    np->tf->eflags = FL_IF;
+80106d03:	8b 46 18             	mov    0x18(%esi),%eax
+80106d06:	c7 40 40 00 02 00 00 	movl   $0x200,0x40(%eax)
+
+    np->pgdir = 0;
+80106d0d:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+    if(execinto(np, path, argv) < 0){
+80106d14:	83 c4 0c             	add    $0xc,%esp
+80106d17:	ff 75 0c             	push   0xc(%ebp)
+80106d1a:	ff 75 08             	push   0x8(%ebp)
+80106d1d:	56                   	push   %esi
+80106d1e:	e8 90 a5 ff ff       	call   801012b3 <execinto>
+80106d23:	83 c4 10             	add    $0x10,%esp
+80106d26:	85 c0                	test   %eax,%eax
+80106d28:	78 0a                	js     80106d34 <spawn+0x92>
+      kfree(np->kstack);
+      np->kstack = 0;
+      np->state = UNUSED;
+      return -1;
+    }
+    np->parent = curproc;
+80106d2a:	89 7e 14             	mov    %edi,0x14(%esi)
+
+    for(i = 0; i < NOFILE; i++)
+80106d2d:	bb 00 00 00 00       	mov    $0x0,%ebx
+80106d32:	eb 29                	jmp    80106d5d <spawn+0xbb>
+      kfree(np->kstack);
+80106d34:	83 ec 0c             	sub    $0xc,%esp
+80106d37:	ff 76 08             	push   0x8(%esi)
+80106d3a:	e8 d0 c7 ff ff       	call   8010350f <kfree>
+      np->kstack = 0;
+80106d3f:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+      np->state = UNUSED;
+80106d46:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+      return -1;
+80106d4d:	83 c4 10             	add    $0x10,%esp
+80106d50:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80106d55:	e9 93 00 00 00       	jmp    80106ded <spawn+0x14b>
+    for(i = 0; i < NOFILE; i++)
+80106d5a:	83 c3 01             	add    $0x1,%ebx
+80106d5d:	83 fb 0f             	cmp    $0xf,%ebx
+80106d60:	7f 1a                	jg     80106d7c <spawn+0xda>
+      if(curproc->ofile[i])
+80106d62:	8b 44 9f 28          	mov    0x28(%edi,%ebx,4),%eax
+80106d66:	85 c0                	test   %eax,%eax
+80106d68:	74 f0                	je     80106d5a <spawn+0xb8>
+        np->ofile[i] = filedup(curproc->ofile[i]);
+80106d6a:	83 ec 0c             	sub    $0xc,%esp
+80106d6d:	50                   	push   %eax
+80106d6e:	e8 bd a9 ff ff       	call   80101730 <filedup>
+80106d73:	89 44 9e 28          	mov    %eax,0x28(%esi,%ebx,4)
+80106d77:	83 c4 10             	add    $0x10,%esp
+80106d7a:	eb de                	jmp    80106d5a <spawn+0xb8>
+    np->cwd = idup(curproc->cwd);
+80106d7c:	83 ec 0c             	sub    $0xc,%esp
+80106d7f:	ff 77 68             	push   0x68(%edi)
+80106d82:	e8 aa b2 ff ff       	call   80102031 <idup>
+80106d87:	89 46 68             	mov    %eax,0x68(%esi)
+
+    pid = np->pid;
+80106d8a:	8b 5e 10             	mov    0x10(%esi),%ebx
+
+    acquire(&ptable.lock);
+80106d8d:	c7 04 24 40 2e 12 80 	movl   $0x80122e40,(%esp)
+80106d94:	e8 f9 0c 00 00       	call   80107a92 <acquire>
+
+    np->state = RUNNABLE;
+80106d99:	c7 46 0c 03 00 00 00 	movl   $0x3,0xc(%esi)
+    np->pri = pri;
+80106da0:	8b 45 10             	mov    0x10(%ebp),%eax
+80106da3:	89 46 7c             	mov    %eax,0x7c(%esi)
+    ptable.pri_queue[np->pri].queue[ptable.pri_queue[np->pri].tail] = np;
+80106da6:	69 c0 08 01 00 00    	imul   $0x108,%eax,%eax
+80106dac:	8b 90 78 d9 12 80    	mov    -0x7fed2688(%eax),%edx
+80106db2:	6b 4d 10 42          	imul   $0x42,0x10(%ebp),%ecx
+80106db6:	8d 8c 0a 8c 2a 00 00 	lea    0x2a8c(%edx,%ecx,1),%ecx
+80106dbd:	89 34 8d 44 2e 12 80 	mov    %esi,-0x7fedd1bc(,%ecx,4)
+    ptable.pri_queue[pri].tail++;
+80106dc4:	83 c2 01             	add    $0x1,%edx
+80106dc7:	89 90 78 d9 12 80    	mov    %edx,-0x7fed2688(%eax)
+    np->qtail[pri]++;
+80106dcd:	8b 45 10             	mov    0x10(%ebp),%eax
+80106dd0:	83 c0 24             	add    $0x24,%eax
+80106dd3:	8b 4c 86 04          	mov    0x4(%esi,%eax,4),%ecx
+80106dd7:	8d 51 01             	lea    0x1(%ecx),%edx
+80106dda:	89 54 86 04          	mov    %edx,0x4(%esi,%eax,4)
+
+    release(&ptable.lock);
+80106dde:	c7 04 24 40 2e 12 80 	movl   $0x80122e40,(%esp)
+80106de5:	e8 0d 0d 00 00       	call   80107af7 <release>
+
+    return pid;
+80106dea:	83 c4 10             	add    $0x10,%esp
+}
+80106ded:	89 d8                	mov    %ebx,%eax
+80106def:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106df2:	5b                   	pop    %ebx
+80106df3:	5e                   	pop    %esi
+80106df4:	5f                   	pop    %edi
+80106df5:	5d                   	pop    %ebp
+80106df6:	c3                   	ret
+        return -1;
+80106df7:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80106dfc:	eb ef                	jmp    80106ded <spawn+0x14b>
+      return -1;
+80106dfe:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80106e03:	eb e8                	jmp    80106ded <spawn+0x14b>
+
+80106e05 <spawnn>:
+// Launch n copies of path at priority pri, storing their
+// pids in pids[].  Stops at the first failure.
+// Returns the number of processes created.
+int
+spawnn(char *path, char **argv, int pri, int n, int *pids)
+{
+80106e05:	55                   	push   %ebp
+80106e06:	89 e5                	mov    %esp,%ebp
+80106e08:	57                   	push   %edi
+80106e09:	56                   	push   %esi
+80106e0a:	53                   	push   %ebx
+80106e0b:	83 ec 0c             	sub    $0xc,%esp
+80106e0e:	8b 7d 14             	mov    0x14(%ebp),%edi
+    int i;
+
+    for (i = 0; i < n; i++) {
+80106e11:	bb 00 00 00 00       	mov    $0x0,%ebx
+80106e16:	eb 03                	jmp    80106e1b <spawnn+0x16>
+80106e18:	83 c3 01             	add    $0x1,%ebx
+80106e1b:	39 fb                	cmp    %edi,%ebx
+80106e1d:	7d 20                	jge    80106e3f <spawnn+0x3a>
+        if ((pids[i] = spawn(path, argv, pri)) < 0) {
+80106e1f:	8b 45 18             	mov    0x18(%ebp),%eax
+80106e22:	8d 34 98             	lea    (%eax,%ebx,4),%esi
+80106e25:	83 ec 04             	sub    $0x4,%esp
+80106e28:	ff 75 10             	push   0x10(%ebp)
+80106e2b:	ff 75 0c             	push   0xc(%ebp)
+80106e2e:	ff 75 08             	push   0x8(%ebp)
+80106e31:	e8 6c fe ff ff       	call   80106ca2 <spawn>
+80106e36:	89 06                	mov    %eax,(%esi)
+80106e38:	83 c4 10             	add    $0x10,%esp
+80106e3b:	85 c0                	test   %eax,%eax
+80106e3d:	79 d9                	jns    80106e18 <spawnn+0x13>
+            break;
+        }
+    }
+    return i;
+}
+80106e3f:	89 d8                	mov    %ebx,%eax
+80106e41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106e44:	5b                   	pop    %ebx
+80106e45:	5e                   	pop    %esi
+80106e46:	5f                   	pop    %edi
+80106e47:	5d                   	pop    %ebp
+80106e48:	c3                   	ret
+
+80106e49 <getpinfo>:
+
+int
+getpinfo(struct pstat *outStat)
+{
+80106e49:	55                   	push   %ebp
+80106e4a:	89 e5                	mov    %esp,%ebp
+80106e4c:	57                   	push   %edi
+80106e4d:	56                   	push   %esi
+80106e4e:	53                   	push   %ebx
+80106e4f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    if (outStat == 0) {
+80106e52:	85 db                	test   %ebx,%ebx
+80106e54:	0f 84 a1 00 00 00    	je     80106efb <getpinfo+0xb2>
+        return -1;
+    }
+    for(int n = 0; n < NPROC; n++){
+80106e5a:	b8 00 00 00 00       	mov    $0x0,%eax
+80106e5f:	eb 6f                	jmp    80106ed0 <getpinfo+0x87>
+        if (ptable.proc[n].state == UNUSED) {
+            outStat->inuse[n] = 0;
+        } else {
+            outStat->inuse[n] = 1;
+80106e61:	c7 04 83 01 00 00 00 	movl   $0x1,(%ebx,%eax,4)
+            outStat->pid[n] = ptable.proc[n].pid;
+80106e68:	69 d0 a8 02 00 00    	imul   $0x2a8,%eax,%edx
+80106e6e:	8b 8a 84 2e 12 80    	mov    -0x7fedd17c(%edx),%ecx
+80106e74:	89 8c 83 00 01 00 00 	mov    %ecx,0x100(%ebx,%eax,4)
+            outStat->priority[n] = ptable.proc[n].pri;
+80106e7b:	8b 8a f0 2e 12 80    	mov    -0x7fedd110(%edx),%ecx
+            outStat->pid[n] = ptable.proc[n].pid;
+80106e81:	81 c2 40 2e 12 80    	add    $0x80122e40,%edx
+            outStat->priority[n] = ptable.proc[n].pri;
+80106e87:	89 8c 83 00 02 00 00 	mov    %ecx,0x200(%ebx,%eax,4)
+            outStat->state[n] = ptable.proc[n].state;
+80106e8e:	8b 52 40             	mov    0x40(%edx),%edx
+80106e91:	89 94 83 00 03 00 00 	mov    %edx,0x300(%ebx,%eax,4)
+            for (int level = NLAYER-1; level >= 0; level--) {
+80106e98:	ba 03 00 00 00       	mov    $0x3,%edx
+80106e9d:	eb 2a                	jmp    80106ec9 <getpinfo+0x80>
+                outStat->ticks[n][level] = ptable.proc[n].ticks[level];
+80106e9f:	69 c8 aa 00 00 00    	imul   $0xaa,%eax,%ecx
+80106ea5:	01 d1                	add    %edx,%ecx
+80106ea7:	8d 34 82             	lea    (%edx,%eax,4),%esi
+80106eaa:	8b 3c 8d f4 2e 12 80 	mov    -0x7fedd10c(,%ecx,4),%edi
+80106eb1:	89 bc b3 00 04 00 00 	mov    %edi,0x400(%ebx,%esi,4)
+                outStat->qtail[n][level] = ptable.proc[n].qtail[level];
+80106eb8:	8b 0c 8d 08 2f 12 80 	mov    -0x7fedd0f8(,%ecx,4),%ecx
+80106ebf:	89 8c b3 00 08 00 00 	mov    %ecx,0x800(%ebx,%esi,4)
+            for (int level = NLAYER-1; level >= 0; level--) {
+80106ec6:	83 ea 01             	sub    $0x1,%edx
+80106ec9:	85 d2                	test   %edx,%edx
+80106ecb:	79 d2                	jns    80106e9f <getpinfo+0x56>
+    for(int n = 0; n < NPROC; n++){
+80106ecd:	83 c0 01             	add    $0x1,%eax
+80106ed0:	83 f8 3f             	cmp    $0x3f,%eax
+80106ed3:	7f 1c                	jg     80106ef1 <getpinfo+0xa8>
+        if (ptable.proc[n].state == UNUSED) {
+80106ed5:	69 d0 a8 02 00 00    	imul   $0x2a8,%eax,%edx
+80106edb:	83 ba 80 2e 12 80 00 	cmpl   $0x0,-0x7fedd180(%edx)
+80106ee2:	0f 85 79 ff ff ff    	jne    80106e61 <getpinfo+0x18>
+            outStat->inuse[n] = 0;
+80106ee8:	c7 04 83 00 00 00 00 	movl   $0x0,(%ebx,%eax,4)
+80106eef:	eb dc                	jmp    80106ecd <getpinfo+0x84>
+            }
+        }
+    }
+    return 0;
+80106ef1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80106ef6:	5b                   	pop    %ebx
+80106ef7:	5e                   	pop    %esi
+80106ef8:	5f                   	pop    %edi
+80106ef9:	5d                   	pop    %ebp
+80106efa:	c3                   	ret
+        return -1;
+80106efb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106f00:	eb f4                	jmp    80106ef6 <getpinfo+0xad>
+
+80106f02 <shminit>:
+  struct shm seg[NSHM];
+} shmtab;
+
+void
+shminit(void)
+{
+80106f02:	55                   	push   %ebp
+80106f03:	89 e5                	mov    %esp,%ebp
+80106f05:	83 ec 10             	sub    $0x10,%esp
+  initlock(&shmtab.lock, "shm");
+80106f08:	68 e8 c0 10 80       	push   $0x8010c0e8
+80106f0d:	68 a0 dc 12 80       	push   $0x8012dca0
+80106f12:	e8 37 0a 00 00       	call   8010794e <initlock>
+}
+80106f17:	83 c4 10             	add    $0x10,%esp
+80106f1a:	c9                   	leave
+80106f1b:	c3                   	ret
+
+80106f1c <shmget>:
+// with npage zeroed pages if there is none.  An existing
+// segment must have npage pages, or npage may be 0.
+// Returns -1 on error.
+int
+shmget(char *name, int npage)
+{
+80106f1c:	55                   	push   %ebp
+80106f1d:	89 e5                	mov    %esp,%ebp
+80106f1f:	57                   	push   %edi
+80106f20:	56                   	push   %esi
+80106f21:	53                   	push   %ebx
+80106f22:	83 ec 0c             	sub    $0xc,%esp
+80106f25:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  struct shm *s, *free;
+  int i;
+
+  if(npage < 0 || npage > SHMMAXPG)
+80106f28:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+80106f2e:	0f 87 27 01 00 00    	ja     8010705b <shmget+0x13f>
+    return -1;
+  acquire(&shmtab.lock);
+80106f34:	83 ec 0c             	sub    $0xc,%esp
+80106f37:	68 a0 dc 12 80       	push   $0x8012dca0
+80106f3c:	e8 51 0b 00 00       	call   80107a92 <acquire>
+  free = 0;
+  for(s = shmtab.seg; s < &shmtab.seg[NSHM]; s++){
+80106f41:	83 c4 10             	add    $0x10,%esp
+  free = 0;
+80106f44:	be 00 00 00 00       	mov    $0x0,%esi
+  for(s = shmtab.seg; s < &shmtab.seg[NSHM]; s++){
+80106f49:	bb d4 dc 12 80       	mov    $0x8012dcd4,%ebx
+80106f4e:	eb 1b                	jmp    80106f6b <shmget+0x4f>
+    if(s->npage == 0){
+      if(free == 0)
+        free = s;
+    } else if(strncmp(s->name, name, SHMNAME) == 0){
+80106f50:	83 ec 04             	sub    $0x4,%esp
+80106f53:	6a 10                	push   $0x10
+80106f55:	ff 75 08             	push   0x8(%ebp)
+80106f58:	53                   	push   %ebx
+80106f59:	e8 c4 0c 00 00       	call   80107c22 <strncmp>
+80106f5e:	83 c4 10             	add    $0x10,%esp
+80106f61:	85 c0                	test   %eax,%eax
+80106f63:	74 1c                	je     80106f81 <shmget+0x65>
+  for(s = shmtab.seg; s < &shmtab.seg[NSHM]; s++){
+80106f65:	81 c3 18 04 00 00    	add    $0x418,%ebx
+80106f6b:	81 fb 54 1e 13 80    	cmp    $0x80131e54,%ebx
+80106f71:	73 3f                	jae    80106fb2 <shmget+0x96>
+    if(s->npage == 0){
+80106f73:	83 7b 10 00          	cmpl   $0x0,0x10(%ebx)
+80106f77:	75 d7                	jne    80106f50 <shmget+0x34>
+      if(free == 0)
+80106f79:	85 f6                	test   %esi,%esi
+80106f7b:	75 e8                	jne    80106f65 <shmget+0x49>
+        free = s;
+80106f7d:	89 de                	mov    %ebx,%esi
+80106f7f:	eb e4                	jmp    80106f65 <shmget+0x49>
+      release(&shmtab.lock);
+80106f81:	83 ec 0c             	sub    $0xc,%esp
+80106f84:	68 a0 dc 12 80       	push   $0x8012dca0
+80106f89:	e8 69 0b 00 00       	call   80107af7 <release>
+      if(npage != 0 && npage != s->npage)
+80106f8e:	83 c4 10             	add    $0x10,%esp
+80106f91:	85 ff                	test   %edi,%edi
+80106f93:	74 09                	je     80106f9e <shmget+0x82>
+80106f95:	39 7b 10             	cmp    %edi,0x10(%ebx)
+80106f98:	0f 85 c4 00 00 00    	jne    80107062 <shmget+0x146>
+        return -1;
+      return s - shmtab.seg;
+80106f9e:	81 eb d4 dc 12 80    	sub    $0x8012dcd4,%ebx
+80106fa4:	c1 fb 03             	sar    $0x3,%ebx
+80106fa7:	69 c3 2b 4e 48 c9    	imul   $0xc9484e2b,%ebx,%eax
+80106fad:	e9 a1 00 00 00       	jmp    80107053 <shmget+0x137>
+    }
+  }
+  if(free == 0 || npage == 0){
+80106fb2:	85 f6                	test   %esi,%esi
+80106fb4:	0f 94 c0             	sete   %al
+80106fb7:	85 ff                	test   %edi,%edi
+80106fb9:	0f 94 c2             	sete   %dl
+80106fbc:	08 d0                	or     %dl,%al
+80106fbe:	75 1b                	jne    80106fdb <shmget+0xbf>
+    release(&shmtab.lock);
+    return -1;
+  }
+  s = free;
+  for(i = 0; i < npage; i++){
+80106fc0:	bb 00 00 00 00       	mov    $0x0,%ebx
+80106fc5:	39 fb                	cmp    %edi,%ebx
+80106fc7:	7d 54                	jge    8010701d <shmget+0x101>
+    if((s->page[i] = kalloc_zeroed()) == 0){
+80106fc9:	e8 27 cc ff ff       	call   80103bf5 <kalloc_zeroed>
+80106fce:	89 44 9e 18          	mov    %eax,0x18(%esi,%ebx,4)
+80106fd2:	85 c0                	test   %eax,%eax
+80106fd4:	74 2b                	je     80107001 <shmget+0xe5>
+  for(i = 0; i < npage; i++){
+80106fd6:	83 c3 01             	add    $0x1,%ebx
+80106fd9:	eb ea                	jmp    80106fc5 <shmget+0xa9>
+    release(&shmtab.lock);
+80106fdb:	83 ec 0c             	sub    $0xc,%esp
+80106fde:	68 a0 dc 12 80       	push   $0x8012dca0
+80106fe3:	e8 0f 0b 00 00       	call   80107af7 <release>
+    return -1;
+80106fe8:	83 c4 10             	add    $0x10,%esp
+80106feb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106ff0:	eb 61                	jmp    80107053 <shmget+0x137>
+      while(--i >= 0)
+        kfree(s->page[i]);
+80106ff2:	83 ec 0c             	sub    $0xc,%esp
+80106ff5:	ff 74 9e 18          	push   0x18(%esi,%ebx,4)
+80106ff9:	e8 11 c5 ff ff       	call   8010350f <kfree>
+80106ffe:	83 c4 10             	add    $0x10,%esp
+      while(--i >= 0)
+80107001:	83 eb 01             	sub    $0x1,%ebx
+80107004:	79 ec                	jns    80106ff2 <shmget+0xd6>
+      release(&shmtab.lock);
+80107006:	83 ec 0c             	sub    $0xc,%esp
+80107009:	68 a0 dc 12 80       	push   $0x8012dca0
+8010700e:	e8 e4 0a 00 00       	call   80107af7 <release>
+      return -1;
+80107013:	83 c4 10             	add    $0x10,%esp
+80107016:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010701b:	eb 36                	jmp    80107053 <shmget+0x137>
+    }
+  }
+  safestrcpy(s->name, name, SHMNAME);
+8010701d:	83 ec 04             	sub    $0x4,%esp
+80107020:	6a 10                	push   $0x10
+80107022:	ff 75 08             	push   0x8(%ebp)
+80107025:	56                   	push   %esi
+80107026:	e8 7f 0c 00 00       	call   80107caa <safestrcpy>
+  s->npage = npage;
+8010702b:	89 7e 10             	mov    %edi,0x10(%esi)
+  s->nattach = 0;
+8010702e:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+  release(&shmtab.lock);
+80107035:	c7 04 24 a0 dc 12 80 	movl   $0x8012dca0,(%esp)
+8010703c:	e8 b6 0a 00 00       	call   80107af7 <release>
+  return s - shmtab.seg;
+80107041:	81 ee d4 dc 12 80    	sub    $0x8012dcd4,%esi
+80107047:	c1 fe 03             	sar    $0x3,%esi
+8010704a:	69 c6 2b 4e 48 c9    	imul   $0xc9484e2b,%esi,%eax
+80107050:	83 c4 10             	add    $0x10,%esp
+}
+80107053:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107056:	5b                   	pop    %ebx
+80107057:	5e                   	pop    %esi
+80107058:	5f                   	pop    %edi
+80107059:	5d                   	pop    %ebp
+8010705a:	c3                   	ret
+    return -1;
+8010705b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107060:	eb f1                	jmp    80107053 <shmget+0x137>
+        return -1;
+80107062:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107067:	eb ea                	jmp    80107053 <shmget+0x137>
+
+80107069 <shmat>:
+
+// Map segment id into the current process.
+// Returns the address it is mapped at, or -1.
+int
+shmat(int id)
+{
+80107069:	55                   	push   %ebp
+8010706a:	89 e5                	mov    %esp,%ebp
+8010706c:	57                   	push   %edi
+8010706d:	56                   	push   %esi
+8010706e:	53                   	push   %ebx
+8010706f:	83 ec 1c             	sub    $0x1c,%esp
+  struct proc *curproc = myproc();
+80107072:	e8 94 ec ff ff       	call   80105d0b <myproc>
+  struct shm *s;
+  struct vma *v;
+  uint va, len;
+
+  // A vfork child's page table belongs to its parent.
+  if(id < 0 || id >= NSHM || curproc->borrowed)
+80107077:	83 7d 08 0f          	cmpl   $0xf,0x8(%ebp)
+8010707b:	0f 87 0d 01 00 00    	ja     8010718e <shmat+0x125>
+80107081:	89 c7                	mov    %eax,%edi
+80107083:	83 b8 a4 00 00 00 00 	cmpl   $0x0,0xa4(%eax)
+8010708a:	0f 85 05 01 00 00    	jne    80107195 <shmat+0x12c>
+    return -1;
+  s = &shmtab.seg[id];
+80107090:	69 5d 08 18 04 00 00 	imul   $0x418,0x8(%ebp),%ebx
+80107097:	8d 83 d4 dc 12 80    	lea    -0x7fed232c(%ebx),%eax
+8010709d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  acquire(&shmtab.lock);
+801070a0:	83 ec 0c             	sub    $0xc,%esp
+801070a3:	68 a0 dc 12 80       	push   $0x8012dca0
+801070a8:	e8 e5 09 00 00       	call   80107a92 <acquire>
+  if(s->npage == 0){
+801070ad:	8b 83 e4 dc 12 80    	mov    -0x7fed231c(%ebx),%eax
+801070b3:	83 c4 10             	add    $0x10,%esp
+801070b6:	85 c0                	test   %eax,%eax
+801070b8:	0f 84 a2 00 00 00    	je     80107160 <shmat+0xf7>
+    release(&shmtab.lock);
+    return -1;
+  }
+  len = s->npage * PGSIZE;
+801070be:	c1 e0 0c             	shl    $0xc,%eax
+801070c1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if((va = vmagap(curproc->vma, len)) == 0 ||
+801070c4:	8d b7 a8 00 00 00    	lea    0xa8(%edi),%esi
+801070ca:	83 ec 08             	sub    $0x8,%esp
+801070cd:	50                   	push   %eax
+801070ce:	56                   	push   %esi
+801070cf:	e8 f8 42 00 00       	call   8010b3cc <vmagap>
+801070d4:	89 c3                	mov    %eax,%ebx
+801070d6:	83 c4 10             	add    $0x10,%esp
+801070d9:	85 c0                	test   %eax,%eax
+801070db:	0f 84 96 00 00 00    	je     80107177 <shmat+0x10e>
+     (v = vmaslot(curproc->vma)) == 0 ||
+801070e1:	83 ec 0c             	sub    $0xc,%esp
+801070e4:	56                   	push   %esi
+801070e5:	e8 57 42 00 00       	call   8010b341 <vmaslot>
+801070ea:	89 c6                	mov    %eax,%esi
+  if((va = vmagap(curproc->vma, len)) == 0 ||
+801070ec:	83 c4 10             	add    $0x10,%esp
+801070ef:	85 c0                	test   %eax,%eax
+801070f1:	0f 84 80 00 00 00    	je     80107177 <shmat+0x10e>
+     mapshared(curproc->pgdir, va, s->page, s->npage) < 0){
+801070f7:	69 45 08 18 04 00 00 	imul   $0x418,0x8(%ebp),%eax
+801070fe:	8d 90 ec dc 12 80    	lea    -0x7fed2314(%eax),%edx
+80107104:	ff b0 e4 dc 12 80    	push   -0x7fed231c(%eax)
+8010710a:	52                   	push   %edx
+8010710b:	53                   	push   %ebx
+8010710c:	ff 77 04             	push   0x4(%edi)
+8010710f:	e8 99 44 00 00       	call   8010b5ad <mapshared>
+     (v = vmaslot(curproc->vma)) == 0 ||
+80107114:	83 c4 10             	add    $0x10,%esp
+80107117:	85 c0                	test   %eax,%eax
+80107119:	78 5c                	js     80107177 <shmat+0x10e>
+    release(&shmtab.lock);
+    return -1;
+  }
+  v->start = va;
+8010711b:	89 1e                	mov    %ebx,(%esi)
+  v->len = len;
+8010711d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80107120:	89 46 04             	mov    %eax,0x4(%esi)
+  v->off = 0;
+80107123:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  v->shm = s;
+8010712a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010712d:	89 46 10             	mov    %eax,0x10(%esi)
+  s->nattach++;
+80107130:	69 45 08 18 04 00 00 	imul   $0x418,0x8(%ebp),%eax
+80107137:	8b 88 e8 dc 12 80    	mov    -0x7fed2318(%eax),%ecx
+8010713d:	8d 51 01             	lea    0x1(%ecx),%edx
+80107140:	89 90 e8 dc 12 80    	mov    %edx,-0x7fed2318(%eax)
+  release(&shmtab.lock);
+80107146:	83 ec 0c             	sub    $0xc,%esp
+80107149:	68 a0 dc 12 80       	push   $0x8012dca0
+8010714e:	e8 a4 09 00 00       	call   80107af7 <release>
+  return va;
+80107153:	89 d8                	mov    %ebx,%eax
+80107155:	83 c4 10             	add    $0x10,%esp
+}
+80107158:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010715b:	5b                   	pop    %ebx
+8010715c:	5e                   	pop    %esi
+8010715d:	5f                   	pop    %edi
+8010715e:	5d                   	pop    %ebp
+8010715f:	c3                   	ret
+    release(&shmtab.lock);
+80107160:	83 ec 0c             	sub    $0xc,%esp
+80107163:	68 a0 dc 12 80       	push   $0x8012dca0
+80107168:	e8 8a 09 00 00       	call   80107af7 <release>
+    return -1;
+8010716d:	83 c4 10             	add    $0x10,%esp
+80107170:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107175:	eb e1                	jmp    80107158 <shmat+0xef>
+    release(&shmtab.lock);
+80107177:	83 ec 0c             	sub    $0xc,%esp
+8010717a:	68 a0 dc 12 80       	push   $0x8012dca0
+8010717f:	e8 73 09 00 00       	call   80107af7 <release>
+    return -1;
+80107184:	83 c4 10             	add    $0x10,%esp
+80107187:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010718c:	eb ca                	jmp    80107158 <shmat+0xef>
+    return -1;
+8010718e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107193:	eb c3                	jmp    80107158 <shmat+0xef>
+80107195:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010719a:	eb bc                	jmp    80107158 <shmat+0xef>
+
+8010719c <shmdup>:
+}
+
+// Add an attachment to segment s.  Used by fork.
+void
+shmdup(struct shm *s)
+{
+8010719c:	55                   	push   %ebp
+8010719d:	89 e5                	mov    %esp,%ebp
+8010719f:	53                   	push   %ebx
+801071a0:	83 ec 10             	sub    $0x10,%esp
+801071a3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&shmtab.lock);
+801071a6:	68 a0 dc 12 80       	push   $0x8012dca0
+801071ab:	e8 e2 08 00 00       	call   80107a92 <acquire>
+  s->nattach++;
+801071b0:	8b 43 14             	mov    0x14(%ebx),%eax
+801071b3:	83 c0 01             	add    $0x1,%eax
+801071b6:	89 43 14             	mov    %eax,0x14(%ebx)
+  release(&shmtab.lock);
+801071b9:	c7 04 24 a0 dc 12 80 	movl   $0x8012dca0,(%esp)
+801071c0:	e8 32 09 00 00       	call   80107af7 <release>
+}
+801071c5:	83 c4 10             	add    $0x10,%esp
+801071c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801071cb:	c9                   	leave
+801071cc:	c3                   	ret
+
+801071cd <shmput>:
+// Drop an attachment to segment s, freeing the segment
+// if it was the last.  The pages survive as long as some
+// page table still maps them.
+void
+shmput(struct shm *s)
+{
+801071cd:	55                   	push   %ebp
+801071ce:	89 e5                	mov    %esp,%ebp
+801071d0:	56                   	push   %esi
+801071d1:	53                   	push   %ebx
+801071d2:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i;
+
+  acquire(&shmtab.lock);
+801071d5:	83 ec 0c             	sub    $0xc,%esp
+801071d8:	68 a0 dc 12 80       	push   $0x8012dca0
+801071dd:	e8 b0 08 00 00       	call   80107a92 <acquire>
+  if(s->nattach < 1)
+801071e2:	8b 5e 14             	mov    0x14(%esi),%ebx
+801071e5:	83 c4 10             	add    $0x10,%esp
+801071e8:	85 db                	test   %ebx,%ebx
+801071ea:	7e 1f                	jle    8010720b <shmput+0x3e>
+    panic("shmput");
+  if(--s->nattach == 0){
+801071ec:	83 eb 01             	sub    $0x1,%ebx
+801071ef:	89 5e 14             	mov    %ebx,0x14(%esi)
+801071f2:	74 36                	je     8010722a <shmput+0x5d>
+    for(i = 0; i < s->npage; i++)
+      kfree(s->page[i]);
+    s->npage = 0;
+  }
+  release(&shmtab.lock);
+801071f4:	83 ec 0c             	sub    $0xc,%esp
+801071f7:	68 a0 dc 12 80       	push   $0x8012dca0
+801071fc:	e8 f6 08 00 00       	call   80107af7 <release>
+}
+80107201:	83 c4 10             	add    $0x10,%esp
+80107204:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107207:	5b                   	pop    %ebx
+80107208:	5e                   	pop    %esi
+80107209:	5d                   	pop    %ebp
+8010720a:	c3                   	ret
+    panic("shmput");
+8010720b:	83 ec 0c             	sub    $0xc,%esp
+8010720e:	68 ec c0 10 80       	push   $0x8010c0ec
+80107213:	e8 13 9b ff ff       	call   80100d2b <panic>
+      kfree(s->page[i]);
+80107218:	83 ec 0c             	sub    $0xc,%esp
+8010721b:	ff 74 9e 18          	push   0x18(%esi,%ebx,4)
+8010721f:	e8 eb c2 ff ff       	call   8010350f <kfree>
+    for(i = 0; i < s->npage; i++)
+80107224:	83 c3 01             	add    $0x1,%ebx
+80107227:	83 c4 10             	add    $0x10,%esp
+8010722a:	39 5e 10             	cmp    %ebx,0x10(%esi)
+8010722d:	7f e9                	jg     80107218 <shmput+0x4b>
+    s->npage = 0;
+8010722f:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+80107236:	eb bc                	jmp    801071f4 <shmput+0x27>
+
+80107238 <shmdt>:
+{
+80107238:	55                   	push   %ebp
+80107239:	89 e5                	mov    %esp,%ebp
+8010723b:	57                   	push   %edi
+8010723c:	56                   	push   %esi
+8010723d:	53                   	push   %ebx
+8010723e:	83 ec 0c             	sub    $0xc,%esp
+80107241:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct proc *curproc = myproc();
+80107244:	e8 c2 ea ff ff       	call   80105d0b <myproc>
+  if(curproc->borrowed)
+80107249:	8b b8 a4 00 00 00    	mov    0xa4(%eax),%edi
+8010724f:	85 ff                	test   %edi,%edi
+80107251:	75 58                	jne    801072ab <shmdt+0x73>
+80107253:	89 c2                	mov    %eax,%edx
+  for(v = curproc->vma; v < &curproc->vma[NVMA]; v++)
+80107255:	8d 98 a8 00 00 00    	lea    0xa8(%eax),%ebx
+8010725b:	eb 03                	jmp    80107260 <shmdt+0x28>
+8010725d:	83 c3 18             	add    $0x18,%ebx
+80107260:	8d 82 28 02 00 00    	lea    0x228(%edx),%eax
+80107266:	39 c3                	cmp    %eax,%ebx
+80107268:	73 0a                	jae    80107274 <shmdt+0x3c>
+    if(v->shm && v->start == va)
+8010726a:	83 7b 10 00          	cmpl   $0x0,0x10(%ebx)
+8010726e:	74 ed                	je     8010725d <shmdt+0x25>
+80107270:	39 33                	cmp    %esi,(%ebx)
+80107272:	75 e9                	jne    8010725d <shmdt+0x25>
+  if(v == &curproc->vma[NVMA])
+80107274:	39 d8                	cmp    %ebx,%eax
+80107276:	74 3a                	je     801072b2 <shmdt+0x7a>
+  deallocuvm(curproc->pgdir, v->start + v->len, v->start);
+80107278:	8b 03                	mov    (%ebx),%eax
+8010727a:	8b 4b 04             	mov    0x4(%ebx),%ecx
+8010727d:	83 ec 04             	sub    $0x4,%esp
+80107280:	50                   	push   %eax
+80107281:	01 c8                	add    %ecx,%eax
+80107283:	50                   	push   %eax
+80107284:	ff 72 04             	push   0x4(%edx)
+80107287:	e8 d1 3b 00 00       	call   8010ae5d <deallocuvm>
+  shmput(v->shm);
+8010728c:	83 c4 04             	add    $0x4,%esp
+8010728f:	ff 73 10             	push   0x10(%ebx)
+80107292:	e8 36 ff ff ff       	call   801071cd <shmput>
+  v->shm = 0;
+80107297:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  return 0;
+8010729e:	83 c4 10             	add    $0x10,%esp
+}
+801072a1:	89 f8                	mov    %edi,%eax
+801072a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801072a6:	5b                   	pop    %ebx
+801072a7:	5e                   	pop    %esi
+801072a8:	5f                   	pop    %edi
+801072a9:	5d                   	pop    %ebp
+801072aa:	c3                   	ret
+    return -1;
+801072ab:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+801072b0:	eb ef                	jmp    801072a1 <shmdt+0x69>
+    return -1;
+801072b2:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+801072b7:	eb e8                	jmp    801072a1 <shmdt+0x69>
+
+801072b9 <initsleeplock>:
+#include "spinlock.h"
+#include "sleeplock.h"
+
+void
+initsleeplock(struct sleeplock *lk, char *name)
+{
+801072b9:	55                   	push   %ebp
+801072ba:	89 e5                	mov    %esp,%ebp
+801072bc:	53                   	push   %ebx
+801072bd:	83 ec 0c             	sub    $0xc,%esp
+801072c0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&lk->lk, "sleep lock");
+801072c3:	68 f3 c0 10 80       	push   $0x8010c0f3
+801072c8:	8d 43 04             	lea    0x4(%ebx),%eax
+801072cb:	50                   	push   %eax
+801072cc:	e8 7d 06 00 00       	call   8010794e <initlock>
+  lk->name = name;
+801072d1:	8b 45 0c             	mov    0xc(%ebp),%eax
+801072d4:	89 43 38             	mov    %eax,0x38(%ebx)
+  lk->locked = 0;
+801072d7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->pid = 0;
+801072dd:	c7 43 3c 00 00 00 00 	movl   $0x0,0x3c(%ebx)
+}
+801072e4:	83 c4 10             	add    $0x10,%esp
+801072e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801072ea:	c9                   	leave
+801072eb:	c3                   	ret
+
+801072ec <acquiresleep>:
+
+void
+acquiresleep(struct sleeplock *lk)
+{
+801072ec:	55                   	push   %ebp
+801072ed:	89 e5                	mov    %esp,%ebp
+801072ef:	56                   	push   %esi
+801072f0:	53                   	push   %ebx
+801072f1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+801072f4:	8d 73 04             	lea    0x4(%ebx),%esi
+801072f7:	83 ec 0c             	sub    $0xc,%esp
+801072fa:	56                   	push   %esi
+801072fb:	e8 92 07 00 00       	call   80107a92 <acquire>
+  while (lk->locked) {
+80107300:	83 c4 10             	add    $0x10,%esp
+80107303:	eb 0d                	jmp    80107312 <acquiresleep+0x26>
+    sleep(lk, &lk->lk);
+80107305:	83 ec 08             	sub    $0x8,%esp
+80107308:	56                   	push   %esi
+80107309:	53                   	push   %ebx
+8010730a:	e8 57 f2 ff ff       	call   80106566 <sleep>
+8010730f:	83 c4 10             	add    $0x10,%esp
+  while (lk->locked) {
+80107312:	83 3b 00             	cmpl   $0x0,(%ebx)
+80107315:	75 ee                	jne    80107305 <acquiresleep+0x19>
+  }
+  lk->locked = 1;
+80107317:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  lk->pid = myproc()->pid;
+8010731d:	e8 e9 e9 ff ff       	call   80105d0b <myproc>
+80107322:	8b 40 10             	mov    0x10(%eax),%eax
+80107325:	89 43 3c             	mov    %eax,0x3c(%ebx)
+  release(&lk->lk);
+80107328:	83 ec 0c             	sub    $0xc,%esp
+8010732b:	56                   	push   %esi
+8010732c:	e8 c6 07 00 00       	call   80107af7 <release>
+}
+80107331:	83 c4 10             	add    $0x10,%esp
+80107334:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107337:	5b                   	pop    %ebx
+80107338:	5e                   	pop    %esi
+80107339:	5d                   	pop    %ebp
+8010733a:	c3                   	ret
+
+8010733b <tryacquiresleep>:
+
+// Acquire lk if it is free; never sleeps.
+// Returns 1 if lk was acquired, 0 if not.
+int
+tryacquiresleep(struct sleeplock *lk)
+{
+8010733b:	55                   	push   %ebp
+8010733c:	89 e5                	mov    %esp,%ebp
+8010733e:	57                   	push   %edi
+8010733f:	56                   	push   %esi
+80107340:	53                   	push   %ebx
+80107341:	83 ec 18             	sub    $0x18,%esp
+80107344:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+
+  acquire(&lk->lk);
+80107347:	8d 73 04             	lea    0x4(%ebx),%esi
+8010734a:	56                   	push   %esi
+8010734b:	e8 42 07 00 00       	call   80107a92 <acquire>
+  r = !lk->locked;
+80107350:	83 c4 10             	add    $0x10,%esp
+80107353:	83 3b 00             	cmpl   $0x0,(%ebx)
+80107356:	0f 94 c0             	sete   %al
+80107359:	0f b6 c0             	movzbl %al,%eax
+8010735c:	89 c7                	mov    %eax,%edi
+  if(r){
+8010735e:	74 13                	je     80107373 <tryacquiresleep+0x38>
+    lk->locked = 1;
+    lk->pid = myproc()->pid;
+  }
+  release(&lk->lk);
+80107360:	83 ec 0c             	sub    $0xc,%esp
+80107363:	56                   	push   %esi
+80107364:	e8 8e 07 00 00       	call   80107af7 <release>
+  return r;
+}
+80107369:	89 f8                	mov    %edi,%eax
+8010736b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010736e:	5b                   	pop    %ebx
+8010736f:	5e                   	pop    %esi
+80107370:	5f                   	pop    %edi
+80107371:	5d                   	pop    %ebp
+80107372:	c3                   	ret
+    lk->locked = 1;
+80107373:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+    lk->pid = myproc()->pid;
+80107379:	e8 8d e9 ff ff       	call   80105d0b <myproc>
+8010737e:	8b 40 10             	mov    0x10(%eax),%eax
+80107381:	89 43 3c             	mov    %eax,0x3c(%ebx)
+80107384:	eb da                	jmp    80107360 <tryacquiresleep+0x25>
+
+80107386 <releasesleep>:
+
+void
+releasesleep(struct sleeplock *lk)
+{
+80107386:	55                   	push   %ebp
+80107387:	89 e5                	mov    %esp,%ebp
+80107389:	56                   	push   %esi
+8010738a:	53                   	push   %ebx
+8010738b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+8010738e:	8d 73 04             	lea    0x4(%ebx),%esi
+80107391:	83 ec 0c             	sub    $0xc,%esp
+80107394:	56                   	push   %esi
+80107395:	e8 f8 06 00 00       	call   80107a92 <acquire>
+  lk->locked = 0;
+8010739a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->pid = 0;
+801073a0:	c7 43 3c 00 00 00 00 	movl   $0x0,0x3c(%ebx)
+  wakeup(lk);
+801073a7:	89 1c 24             	mov    %ebx,(%esp)
+801073aa:	e8 86 f4 ff ff       	call   80106835 <wakeup>
+  release(&lk->lk);
+801073af:	89 34 24             	mov    %esi,(%esp)
+801073b2:	e8 40 07 00 00       	call   80107af7 <release>
+}
+801073b7:	83 c4 10             	add    $0x10,%esp
+801073ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801073bd:	5b                   	pop    %ebx
+801073be:	5e                   	pop    %esi
+801073bf:	5d                   	pop    %ebp
+801073c0:	c3                   	ret
+
+801073c1 <holdingsleep>:
+
+int
+holdingsleep(struct sleeplock *lk)
+{
+801073c1:	55                   	push   %ebp
+801073c2:	89 e5                	mov    %esp,%ebp
+801073c4:	56                   	push   %esi
+801073c5:	53                   	push   %ebx
+801073c6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  
+  acquire(&lk->lk);
+801073c9:	8d 73 04             	lea    0x4(%ebx),%esi
+801073cc:	83 ec 0c             	sub    $0xc,%esp
+801073cf:	56                   	push   %esi
+801073d0:	e8 bd 06 00 00       	call   80107a92 <acquire>
+  r = lk->locked && (lk->pid == myproc()->pid);
+801073d5:	83 c4 10             	add    $0x10,%esp
+801073d8:	83 3b 00             	cmpl   $0x0,(%ebx)
+801073db:	75 17                	jne    801073f4 <holdingsleep+0x33>
+801073dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  release(&lk->lk);
+801073e2:	83 ec 0c             	sub    $0xc,%esp
+801073e5:	56                   	push   %esi
+801073e6:	e8 0c 07 00 00       	call   80107af7 <release>
+  return r;
+}
+801073eb:	89 d8                	mov    %ebx,%eax
+801073ed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801073f0:	5b                   	pop    %ebx
+801073f1:	5e                   	pop    %esi
+801073f2:	5d                   	pop    %ebp
+801073f3:	c3                   	ret
+  r = lk->locked && (lk->pid == myproc()->pid);
+801073f4:	8b 5b 3c             	mov    0x3c(%ebx),%ebx
+801073f7:	e8 0f e9 ff ff       	call   80105d0b <myproc>
+801073fc:	3b 58 10             	cmp    0x10(%eax),%ebx
+801073ff:	74 07                	je     80107408 <holdingsleep+0x47>
+80107401:	bb 00 00 00 00       	mov    $0x0,%ebx
+80107406:	eb da                	jmp    801073e2 <holdingsleep+0x21>
+80107408:	bb 01 00 00 00       	mov    $0x1,%ebx
+8010740d:	eb d3                	jmp    801073e2 <holdingsleep+0x21>
+
+8010740f <slabunlink>:
+}
+
+static void
+slabunlink(struct kmcache *c, struct slab *s)
+{
+  if(s->prev)
+8010740f:	8b 4a 04             	mov    0x4(%edx),%ecx
+80107412:	85 c9                	test   %ecx,%ecx
+80107414:	74 1e                	je     80107434 <slabunlink+0x25>
+    s->prev->next = s->next;
+80107416:	8b 02                	mov    (%edx),%eax
+80107418:	89 01                	mov    %eax,(%ecx)
+  else
+    c->partial = s->next;
+  if(s->next)
+8010741a:	8b 02                	mov    (%edx),%eax
+8010741c:	85 c0                	test   %eax,%eax
+8010741e:	74 06                	je     80107426 <slabunlink+0x17>
+    s->next->prev = s->prev;
+80107420:	8b 4a 04             	mov    0x4(%edx),%ecx
+80107423:	89 48 04             	mov    %ecx,0x4(%eax)
+  s->next = s->prev = 0;
+80107426:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+8010742d:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+}
+80107433:	c3                   	ret
+    c->partial = s->next;
+80107434:	8b 0a                	mov    (%edx),%ecx
+80107436:	89 48 4c             	mov    %ecx,0x4c(%eax)
+80107439:	eb df                	jmp    8010741a <slabunlink+0xb>
+
+8010743b <slabpush>:
+
+static void
+slabpush(struct kmcache *c, struct slab *s)
+{
+  s->prev = 0;
+8010743b:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+  s->next = c->partial;
+80107442:	8b 48 4c             	mov    0x4c(%eax),%ecx
+80107445:	89 0a                	mov    %ecx,(%edx)
+  if(s->next)
+80107447:	85 c9                	test   %ecx,%ecx
+80107449:	74 03                	je     8010744e <slabpush+0x13>
+    s->next->prev = s;
+8010744b:	89 51 04             	mov    %edx,0x4(%ecx)
+  c->partial = s;
+8010744e:	89 50 4c             	mov    %edx,0x4c(%eax)
+}
+80107451:	c3                   	ret
+
+80107452 <slabget>:
+
+// Take one object from the slabs.  Caller holds c->lock.
+static void*
+slabget(struct kmcache *c)
+{
+80107452:	55                   	push   %ebp
+80107453:	89 e5                	mov    %esp,%ebp
+80107455:	57                   	push   %edi
+80107456:	56                   	push   %esi
+80107457:	53                   	push   %ebx
+80107458:	83 ec 0c             	sub    $0xc,%esp
+8010745b:	89 c6                	mov    %eax,%esi
+  struct slab *s;
+  char *p;
+  void *obj;
+  int i;
+
+  if((s = c->partial) == 0){
+8010745d:	8b 58 4c             	mov    0x4c(%eax),%ebx
+80107460:	85 db                	test   %ebx,%ebx
+80107462:	74 37                	je     8010749b <slabget+0x49>
+    }
+    slabpush(c, s);
+    c->nslab++;
+    c->empty++;
+  }
+  obj = s->free;
+80107464:	8b 7b 10             	mov    0x10(%ebx),%edi
+  s->free = *(void**)obj;
+80107467:	8b 07                	mov    (%edi),%eax
+80107469:	89 43 10             	mov    %eax,0x10(%ebx)
+  if(s->inuse++ == 0)
+8010746c:	8b 43 0c             	mov    0xc(%ebx),%eax
+8010746f:	8d 50 01             	lea    0x1(%eax),%edx
+80107472:	89 53 0c             	mov    %edx,0xc(%ebx)
+80107475:	85 c0                	test   %eax,%eax
+80107477:	75 09                	jne    80107482 <slabget+0x30>
+    c->empty--;
+80107479:	8b 46 58             	mov    0x58(%esi),%eax
+8010747c:	83 e8 01             	sub    $0x1,%eax
+8010747f:	89 46 58             	mov    %eax,0x58(%esi)
+  if(s->free == 0)
+80107482:	83 7b 10 00          	cmpl   $0x0,0x10(%ebx)
+80107486:	74 79                	je     80107501 <slabget+0xaf>
+    slabunlink(c, s);
+  c->inuse++;
+80107488:	8b 46 54             	mov    0x54(%esi),%eax
+8010748b:	83 c0 01             	add    $0x1,%eax
+8010748e:	89 46 54             	mov    %eax,0x54(%esi)
+  return obj;
+}
+80107491:	89 f8                	mov    %edi,%eax
+80107493:	83 c4 0c             	add    $0xc,%esp
+80107496:	5b                   	pop    %ebx
+80107497:	5e                   	pop    %esi
+80107498:	5f                   	pop    %edi
+80107499:	5d                   	pop    %ebp
+8010749a:	c3                   	ret
+    if((s = (struct slab*)kalloc()) == 0)
+8010749b:	e8 84 c3 ff ff       	call   80103824 <kalloc>
+801074a0:	89 c3                	mov    %eax,%ebx
+801074a2:	85 c0                	test   %eax,%eax
+801074a4:	74 69                	je     8010750f <slabget+0xbd>
+    s->next = s->prev = 0;
+801074a6:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+801074ad:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    s->c = c;
+801074b3:	89 70 08             	mov    %esi,0x8(%eax)
+    s->inuse = 0;
+801074b6:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    s->free = 0;
+801074bd:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+    p = (char*)(s + 1);
+801074c4:	8d 40 14             	lea    0x14(%eax),%eax
+    for(i = 0; i < c->perslab; i++, p += c->size){
+801074c7:	ba 00 00 00 00       	mov    $0x0,%edx
+801074cc:	eb 0e                	jmp    801074dc <slabget+0x8a>
+      *(void**)p = s->free;
+801074ce:	8b 4b 10             	mov    0x10(%ebx),%ecx
+801074d1:	89 08                	mov    %ecx,(%eax)
+      s->free = p;
+801074d3:	89 43 10             	mov    %eax,0x10(%ebx)
+    for(i = 0; i < c->perslab; i++, p += c->size){
+801074d6:	83 c2 01             	add    $0x1,%edx
+801074d9:	03 46 44             	add    0x44(%esi),%eax
+801074dc:	39 56 48             	cmp    %edx,0x48(%esi)
+801074df:	7f ed                	jg     801074ce <slabget+0x7c>
+    slabpush(c, s);
+801074e1:	89 da                	mov    %ebx,%edx
+801074e3:	89 f0                	mov    %esi,%eax
+801074e5:	e8 51 ff ff ff       	call   8010743b <slabpush>
+    c->nslab++;
+801074ea:	8b 46 50             	mov    0x50(%esi),%eax
+801074ed:	83 c0 01             	add    $0x1,%eax
+801074f0:	89 46 50             	mov    %eax,0x50(%esi)
+    c->empty++;
+801074f3:	8b 46 58             	mov    0x58(%esi),%eax
+801074f6:	83 c0 01             	add    $0x1,%eax
+801074f9:	89 46 58             	mov    %eax,0x58(%esi)
+801074fc:	e9 63 ff ff ff       	jmp    80107464 <slabget+0x12>
+    slabunlink(c, s);
+80107501:	89 da                	mov    %ebx,%edx
+80107503:	89 f0                	mov    %esi,%eax
+80107505:	e8 05 ff ff ff       	call   8010740f <slabunlink>
+8010750a:	e9 79 ff ff ff       	jmp    80107488 <slabget+0x36>
+      return 0;
+8010750f:	89 c7                	mov    %eax,%edi
+80107511:	e9 7b ff ff ff       	jmp    80107491 <slabget+0x3f>
+
+80107516 <slabput>:
+
+// Return one object to its slab.  Caller holds c->lock.
+static void
+slabput(struct kmcache *c, void *obj)
+{
+80107516:	55                   	push   %ebp
+80107517:	89 e5                	mov    %esp,%ebp
+80107519:	57                   	push   %edi
+8010751a:	56                   	push   %esi
+8010751b:	53                   	push   %ebx
+8010751c:	83 ec 0c             	sub    $0xc,%esp
+  struct slab *s;
+
+  s = (struct slab*)PGROUNDDOWN((uint)obj);
+8010751f:	89 d3                	mov    %edx,%ebx
+80107521:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if(s->c != c || s->inuse < 1)
+80107527:	39 43 08             	cmp    %eax,0x8(%ebx)
+8010752a:	75 41                	jne    8010756d <slabput+0x57>
+8010752c:	89 c6                	mov    %eax,%esi
+8010752e:	89 d7                	mov    %edx,%edi
+80107530:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+80107534:	7e 37                	jle    8010756d <slabput+0x57>
+    panic("kmcache_free");
+  if(s->free == 0)
+80107536:	83 7b 10 00          	cmpl   $0x0,0x10(%ebx)
+8010753a:	74 3e                	je     8010757a <slabput+0x64>
+    slabpush(c, s);
+  *(void**)obj = s->free;
+8010753c:	8b 43 10             	mov    0x10(%ebx),%eax
+8010753f:	89 07                	mov    %eax,(%edi)
+  s->free = obj;
+80107541:	89 7b 10             	mov    %edi,0x10(%ebx)
+  c->inuse--;
+80107544:	8b 46 54             	mov    0x54(%esi),%eax
+80107547:	83 e8 01             	sub    $0x1,%eax
+8010754a:	89 46 54             	mov    %eax,0x54(%esi)
+  if(--s->inuse == 0){
+8010754d:	8b 43 0c             	mov    0xc(%ebx),%eax
+80107550:	83 e8 01             	sub    $0x1,%eax
+80107553:	89 43 0c             	mov    %eax,0xc(%ebx)
+80107556:	75 0d                	jne    80107565 <slabput+0x4f>
+    if(c->empty > 0){
+80107558:	8b 46 58             	mov    0x58(%esi),%eax
+8010755b:	85 c0                	test   %eax,%eax
+8010755d:	7f 24                	jg     80107583 <slabput+0x6d>
+      // Already have an empty slab; give this one back.
+      slabunlink(c, s);
+      c->nslab--;
+      kfree((char*)s);
+    } else
+      c->empty++;
+8010755f:	83 c0 01             	add    $0x1,%eax
+80107562:	89 46 58             	mov    %eax,0x58(%esi)
+  }
+}
+80107565:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107568:	5b                   	pop    %ebx
+80107569:	5e                   	pop    %esi
+8010756a:	5f                   	pop    %edi
+8010756b:	5d                   	pop    %ebp
+8010756c:	c3                   	ret
+    panic("kmcache_free");
+8010756d:	83 ec 0c             	sub    $0xc,%esp
+80107570:	68 fe c0 10 80       	push   $0x8010c0fe
+80107575:	e8 b1 97 ff ff       	call   80100d2b <panic>
+    slabpush(c, s);
+8010757a:	89 da                	mov    %ebx,%edx
+8010757c:	e8 ba fe ff ff       	call   8010743b <slabpush>
+80107581:	eb b9                	jmp    8010753c <slabput+0x26>
+      slabunlink(c, s);
+80107583:	89 da                	mov    %ebx,%edx
+80107585:	89 f0                	mov    %esi,%eax
+80107587:	e8 83 fe ff ff       	call   8010740f <slabunlink>
+      c->nslab--;
+8010758c:	8b 46 50             	mov    0x50(%esi),%eax
+8010758f:	83 e8 01             	sub    $0x1,%eax
+80107592:	89 46 50             	mov    %eax,0x50(%esi)
+      kfree((char*)s);
+80107595:	83 ec 0c             	sub    $0xc,%esp
+80107598:	53                   	push   %ebx
+80107599:	e8 71 bf ff ff       	call   8010350f <kfree>
+8010759e:	83 c4 10             	add    $0x10,%esp
+801075a1:	eb c2                	jmp    80107565 <slabput+0x4f>
+
+801075a3 <kmcacheinit>:
+{
+801075a3:	55                   	push   %ebp
+801075a4:	89 e5                	mov    %esp,%ebp
+801075a6:	83 ec 10             	sub    $0x10,%esp
+  initlock(&kmcaches.lock, "kmcaches");
+801075a9:	68 0b c1 10 80       	push   $0x8010c10b
+801075ae:	68 60 1e 13 80       	push   $0x80131e60
+801075b3:	e8 96 03 00 00       	call   8010794e <initlock>
+}
+801075b8:	83 c4 10             	add    $0x10,%esp
+801075bb:	c9                   	leave
+801075bc:	c3                   	ret
+
+801075bd <kmcache_create>:
+{
+801075bd:	55                   	push   %ebp
+801075be:	89 e5                	mov    %esp,%ebp
+801075c0:	57                   	push   %edi
+801075c1:	56                   	push   %esi
+801075c2:	53                   	push   %ebx
+801075c3:	83 ec 0c             	sub    $0xc,%esp
+  size = (size + sizeof(void*) - 1) & ~(sizeof(void*) - 1);
+801075c6:	8b 45 0c             	mov    0xc(%ebp),%eax
+801075c9:	8d 70 03             	lea    0x3(%eax),%esi
+801075cc:	83 e6 fc             	and    $0xfffffffc,%esi
+  if(size == 0 || size > PGSIZE - sizeof(struct slab))
+801075cf:	8d 46 ff             	lea    -0x1(%esi),%eax
+801075d2:	3d eb 0f 00 00       	cmp    $0xfeb,%eax
+801075d7:	0f 87 92 00 00 00    	ja     8010766f <kmcache_create+0xb2>
+  acquire(&kmcaches.lock);
+801075dd:	83 ec 0c             	sub    $0xc,%esp
+801075e0:	68 60 1e 13 80       	push   $0x80131e60
+801075e5:	e8 a8 04 00 00       	call   80107a92 <acquire>
+  if(kmcaches.n >= NKMCACHE)
+801075ea:	8b 1d 74 34 13 80    	mov    0x80133474,%ebx
+801075f0:	83 c4 10             	add    $0x10,%esp
+801075f3:	83 fb 07             	cmp    $0x7,%ebx
+801075f6:	0f 8f 80 00 00 00    	jg     8010767c <kmcache_create+0xbf>
+  c = &kmcaches.cache[kmcaches.n++];
+801075fc:	8d 43 01             	lea    0x1(%ebx),%eax
+801075ff:	a3 74 34 13 80       	mov    %eax,0x80133474
+80107604:	69 db bc 02 00 00    	imul   $0x2bc,%ebx,%ebx
+8010760a:	8d bb 94 1e 13 80    	lea    -0x7fece16c(%ebx),%edi
+  release(&kmcaches.lock);
+80107610:	83 ec 0c             	sub    $0xc,%esp
+80107613:	68 60 1e 13 80       	push   $0x80131e60
+80107618:	e8 da 04 00 00       	call   80107af7 <release>
+  memset(c, 0, sizeof(*c));
+8010761d:	83 c4 0c             	add    $0xc,%esp
+80107620:	68 bc 02 00 00       	push   $0x2bc
+80107625:	6a 00                	push   $0x0
+80107627:	57                   	push   %edi
+80107628:	e8 11 05 00 00       	call   80107b3e <memset>
+  initlock(&c->lock, name);
+8010762d:	83 c4 08             	add    $0x8,%esp
+80107630:	ff 75 08             	push   0x8(%ebp)
+80107633:	57                   	push   %edi
+80107634:	e8 15 03 00 00       	call   8010794e <initlock>
+  safestrcpy(c->name, name, sizeof(c->name));
+80107639:	8d 83 c8 1e 13 80    	lea    -0x7fece138(%ebx),%eax
+8010763f:	83 c4 0c             	add    $0xc,%esp
+80107642:	6a 10                	push   $0x10
+80107644:	ff 75 08             	push   0x8(%ebp)
+80107647:	50                   	push   %eax
+80107648:	e8 5d 06 00 00       	call   80107caa <safestrcpy>
+  c->size = size;
+8010764d:	89 b3 d8 1e 13 80    	mov    %esi,-0x7fece128(%ebx)
+  c->perslab = (PGSIZE - sizeof(struct slab)) / size;
+80107653:	b8 ec 0f 00 00       	mov    $0xfec,%eax
+80107658:	ba 00 00 00 00       	mov    $0x0,%edx
+8010765d:	f7 f6                	div    %esi
+8010765f:	89 83 dc 1e 13 80    	mov    %eax,-0x7fece124(%ebx)
+}
+80107665:	89 f8                	mov    %edi,%eax
+80107667:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010766a:	5b                   	pop    %ebx
+8010766b:	5e                   	pop    %esi
+8010766c:	5f                   	pop    %edi
+8010766d:	5d                   	pop    %ebp
+8010766e:	c3                   	ret
+    panic("kmcache_create: size");
+8010766f:	83 ec 0c             	sub    $0xc,%esp
+80107672:	68 14 c1 10 80       	push   $0x8010c114
+80107677:	e8 af 96 ff ff       	call   80100d2b <panic>
+    panic("kmcache_create: too many caches");
+8010767c:	83 ec 0c             	sub    $0xc,%esp
+8010767f:	68 2c c1 10 80       	push   $0x8010c12c
+80107684:	e8 a2 96 ff ff       	call   80100d2b <panic>
+
+80107689 <kmcache_alloc>:
+
+// Allocate an object from cache c.
+// Returns 0 if out of memory.
+void*
+kmcache_alloc(struct kmcache *c)
+{
+80107689:	55                   	push   %ebp
+8010768a:	89 e5                	mov    %esp,%ebp
+8010768c:	57                   	push   %edi
+8010768d:	56                   	push   %esi
+8010768e:	53                   	push   %ebx
+8010768f:	83 ec 1c             	sub    $0x1c,%esp
+80107692:	8b 75 08             	mov    0x8(%ebp),%esi
+  void *obj;
+  int i, id;
+
+  pushcli();
+80107695:	e8 15 03 00 00       	call   801079af <pushcli>
+  id = cpuid();
+8010769a:	e8 51 e6 ff ff       	call   80105cf0 <cpuid>
+8010769f:	89 c3                	mov    %eax,%ebx
+  if(c->cpu[id].n == 0){
+801076a1:	6b c0 4c             	imul   $0x4c,%eax,%eax
+801076a4:	8b bc 06 9c 00 00 00 	mov    0x9c(%esi,%eax,1),%edi
+801076ab:	85 ff                	test   %edi,%edi
+801076ad:	74 4c                	je     801076fb <kmcache_alloc+0x72>
+      c->cpu[id].obj[c->cpu[id].n++] = obj;
+    }
+    release(&c->lock);
+  }
+  obj = 0;
+  if(c->cpu[id].n > 0){
+801076af:	6b c3 4c             	imul   $0x4c,%ebx,%eax
+801076b2:	8b 84 06 9c 00 00 00 	mov    0x9c(%esi,%eax,1),%eax
+801076b9:	85 c0                	test   %eax,%eax
+801076bb:	0f 8e 93 00 00 00    	jle    80107754 <kmcache_alloc+0xcb>
+    obj = c->cpu[id].obj[--c->cpu[id].n];
+801076c1:	83 e8 01             	sub    $0x1,%eax
+801076c4:	6b d3 4c             	imul   $0x4c,%ebx,%edx
+801076c7:	01 f2                	add    %esi,%edx
+801076c9:	89 82 9c 00 00 00    	mov    %eax,0x9c(%edx)
+801076cf:	8d 0c db             	lea    (%ebx,%ebx,8),%ecx
+801076d2:	8d 0c 4b             	lea    (%ebx,%ecx,2),%ecx
+801076d5:	8d 44 08 14          	lea    0x14(%eax,%ecx,1),%eax
+801076d9:	8b 5c 86 0c          	mov    0xc(%esi,%eax,4),%ebx
+    c->cpu[id].allocs++;
+801076dd:	8b 82 a0 00 00 00    	mov    0xa0(%edx),%eax
+801076e3:	83 c0 01             	add    $0x1,%eax
+801076e6:	89 82 a0 00 00 00    	mov    %eax,0xa0(%edx)
+  }
+  popcli();
+801076ec:	e8 02 03 00 00       	call   801079f3 <popcli>
+  return obj;
+}
+801076f1:	89 d8                	mov    %ebx,%eax
+801076f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801076f6:	5b                   	pop    %ebx
+801076f7:	5e                   	pop    %esi
+801076f8:	5f                   	pop    %edi
+801076f9:	5d                   	pop    %ebp
+801076fa:	c3                   	ret
+    acquire(&c->lock);
+801076fb:	83 ec 0c             	sub    $0xc,%esp
+801076fe:	56                   	push   %esi
+801076ff:	e8 8e 03 00 00       	call   80107a92 <acquire>
+    for(i = 0; i < KMBATCH; i++){
+80107704:	83 c4 10             	add    $0x10,%esp
+80107707:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+8010770a:	83 7d e4 07          	cmpl   $0x7,-0x1c(%ebp)
+8010770e:	7f 33                	jg     80107743 <kmcache_alloc+0xba>
+      if((obj = slabget(c)) == 0)
+80107710:	89 f0                	mov    %esi,%eax
+80107712:	e8 3b fd ff ff       	call   80107452 <slabget>
+80107717:	85 c0                	test   %eax,%eax
+80107719:	74 28                	je     80107743 <kmcache_alloc+0xba>
+      c->cpu[id].obj[c->cpu[id].n++] = obj;
+8010771b:	6b d3 4c             	imul   $0x4c,%ebx,%edx
+8010771e:	01 f2                	add    %esi,%edx
+80107720:	8b 8a 9c 00 00 00    	mov    0x9c(%edx),%ecx
+80107726:	8d 79 01             	lea    0x1(%ecx),%edi
+80107729:	89 ba 9c 00 00 00    	mov    %edi,0x9c(%edx)
+8010772f:	8d 14 db             	lea    (%ebx,%ebx,8),%edx
+80107732:	8d 14 53             	lea    (%ebx,%edx,2),%edx
+80107735:	8d 54 11 14          	lea    0x14(%ecx,%edx,1),%edx
+80107739:	89 44 96 0c          	mov    %eax,0xc(%esi,%edx,4)
+    for(i = 0; i < KMBATCH; i++){
+8010773d:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+80107741:	eb c7                	jmp    8010770a <kmcache_alloc+0x81>
+    release(&c->lock);
+80107743:	83 ec 0c             	sub    $0xc,%esp
+80107746:	56                   	push   %esi
+80107747:	e8 ab 03 00 00       	call   80107af7 <release>
+8010774c:	83 c4 10             	add    $0x10,%esp
+8010774f:	e9 5b ff ff ff       	jmp    801076af <kmcache_alloc+0x26>
+  obj = 0;
+80107754:	bb 00 00 00 00       	mov    $0x0,%ebx
+80107759:	eb 91                	jmp    801076ec <kmcache_alloc+0x63>
+
+8010775b <kmcache_free>:
+
+// Free an object allocated from cache c.
+void
+kmcache_free(struct kmcache *c, void *obj)
+{
+8010775b:	55                   	push   %ebp
+8010775c:	89 e5                	mov    %esp,%ebp
+8010775e:	57                   	push   %edi
+8010775f:	56                   	push   %esi
+80107760:	53                   	push   %ebx
+80107761:	83 ec 0c             	sub    $0xc,%esp
+80107764:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, id;
+
+  pushcli();
+80107767:	e8 43 02 00 00       	call   801079af <pushcli>
+  id = cpuid();
+8010776c:	e8 7f e5 ff ff       	call   80105cf0 <cpuid>
+80107771:	89 c3                	mov    %eax,%ebx
+  if(c->cpu[id].n == KMCPU){
+80107773:	6b c0 4c             	imul   $0x4c,%eax,%eax
+80107776:	83 bc 06 9c 00 00 00 	cmpl   $0x10,0x9c(%esi,%eax,1)
+8010777d:	10 
+8010777e:	74 41                	je     801077c1 <kmcache_free+0x66>
+    acquire(&c->lock);
+    for(i = 0; i < KMBATCH; i++)
+      slabput(c, c->cpu[id].obj[--c->cpu[id].n]);
+    release(&c->lock);
+  }
+  c->cpu[id].obj[c->cpu[id].n++] = obj;
+80107780:	6b c3 4c             	imul   $0x4c,%ebx,%eax
+80107783:	01 f0                	add    %esi,%eax
+80107785:	8b 90 9c 00 00 00    	mov    0x9c(%eax),%edx
+8010778b:	8d 4a 01             	lea    0x1(%edx),%ecx
+8010778e:	89 88 9c 00 00 00    	mov    %ecx,0x9c(%eax)
+80107794:	8d 0c db             	lea    (%ebx,%ebx,8),%ecx
+80107797:	8d 0c 4b             	lea    (%ebx,%ecx,2),%ecx
+8010779a:	8d 54 0a 14          	lea    0x14(%edx,%ecx,1),%edx
+8010779e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+801077a1:	89 4c 96 0c          	mov    %ecx,0xc(%esi,%edx,4)
+  c->cpu[id].frees++;
+801077a5:	8b b8 a4 00 00 00    	mov    0xa4(%eax),%edi
+801077ab:	8d 57 01             	lea    0x1(%edi),%edx
+801077ae:	89 90 a4 00 00 00    	mov    %edx,0xa4(%eax)
+  popcli();
+801077b4:	e8 3a 02 00 00       	call   801079f3 <popcli>
+}
+801077b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801077bc:	5b                   	pop    %ebx
+801077bd:	5e                   	pop    %esi
+801077be:	5f                   	pop    %edi
+801077bf:	5d                   	pop    %ebp
+801077c0:	c3                   	ret
+    acquire(&c->lock);
+801077c1:	83 ec 0c             	sub    $0xc,%esp
+801077c4:	56                   	push   %esi
+801077c5:	e8 c8 02 00 00       	call   80107a92 <acquire>
+    for(i = 0; i < KMBATCH; i++)
+801077ca:	83 c4 10             	add    $0x10,%esp
+801077cd:	bf 00 00 00 00       	mov    $0x0,%edi
+801077d2:	eb 2c                	jmp    80107800 <kmcache_free+0xa5>
+      slabput(c, c->cpu[id].obj[--c->cpu[id].n]);
+801077d4:	6b d3 4c             	imul   $0x4c,%ebx,%edx
+801077d7:	01 f2                	add    %esi,%edx
+801077d9:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+801077df:	83 e8 01             	sub    $0x1,%eax
+801077e2:	89 82 9c 00 00 00    	mov    %eax,0x9c(%edx)
+801077e8:	8d 14 db             	lea    (%ebx,%ebx,8),%edx
+801077eb:	8d 14 53             	lea    (%ebx,%edx,2),%edx
+801077ee:	8d 44 10 14          	lea    0x14(%eax,%edx,1),%eax
+801077f2:	8b 54 86 0c          	mov    0xc(%esi,%eax,4),%edx
+801077f6:	89 f0                	mov    %esi,%eax
+801077f8:	e8 19 fd ff ff       	call   80107516 <slabput>
+    for(i = 0; i < KMBATCH; i++)
+801077fd:	83 c7 01             	add    $0x1,%edi
+80107800:	83 ff 07             	cmp    $0x7,%edi
+80107803:	7e cf                	jle    801077d4 <kmcache_free+0x79>
+    release(&c->lock);
+80107805:	83 ec 0c             	sub    $0xc,%esp
+80107808:	56                   	push   %esi
+80107809:	e8 e9 02 00 00       	call   80107af7 <release>
+8010780e:	83 c4 10             	add    $0x10,%esp
+80107811:	e9 6a ff ff ff       	jmp    80107780 <kmcache_free+0x25>
+
+80107816 <slabstat>:
+
+// Copy usage statistics for every cache into *st.
+int
+slabstat(struct slabstat *st)
+{
+80107816:	55                   	push   %ebp
+80107817:	89 e5                	mov    %esp,%ebp
+80107819:	57                   	push   %edi
+8010781a:	56                   	push   %esi
+8010781b:	53                   	push   %ebx
+8010781c:	83 ec 20             	sub    $0x20,%esp
+  struct kmcache *c;
+  int i, j, cached;
+
+  memset(st, 0, sizeof(*st));
+8010781f:	68 64 01 00 00       	push   $0x164
+80107824:	6a 00                	push   $0x0
+80107826:	ff 75 08             	push   0x8(%ebp)
+80107829:	e8 10 03 00 00       	call   80107b3e <memset>
+  acquire(&kmcaches.lock);
+8010782e:	c7 04 24 60 1e 13 80 	movl   $0x80131e60,(%esp)
+80107835:	e8 58 02 00 00       	call   80107a92 <acquire>
+  st->n = kmcaches.n;
+8010783a:	a1 74 34 13 80       	mov    0x80133474,%eax
+8010783f:	8b 7d 08             	mov    0x8(%ebp),%edi
+80107842:	89 07                	mov    %eax,(%edi)
+  release(&kmcaches.lock);
+80107844:	c7 04 24 60 1e 13 80 	movl   $0x80131e60,(%esp)
+8010784b:	e8 a7 02 00 00       	call   80107af7 <release>
+  for(i = 0; i < st->n; i++){
+80107850:	83 c4 10             	add    $0x10,%esp
+80107853:	be 00 00 00 00       	mov    $0x0,%esi
+80107858:	8b 7d 08             	mov    0x8(%ebp),%edi
+8010785b:	e9 b1 00 00 00       	jmp    80107911 <slabstat+0xfb>
+    c = &kmcaches.cache[i];
+    acquire(&c->lock);
+    cached = 0;
+    for(j = 0; j < ncpu; j++){
+      cached += c->cpu[j].n;
+80107860:	6b ca 4c             	imul   $0x4c,%edx,%ecx
+80107863:	69 c6 bc 02 00 00    	imul   $0x2bc,%esi,%eax
+80107869:	8d 8c 01 60 1e 13 80 	lea    -0x7fece1a0(%ecx,%eax,1),%ecx
+80107870:	8b 99 d0 00 00 00    	mov    0xd0(%ecx),%ebx
+80107876:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+      st->cache[i].allocs += c->cpu[j].allocs;
+80107879:	6b c6 2c             	imul   $0x2c,%esi,%eax
+8010787c:	01 f8                	add    %edi,%eax
+8010787e:	8b 99 d4 00 00 00    	mov    0xd4(%ecx),%ebx
+80107884:	01 58 28             	add    %ebx,0x28(%eax)
+      st->cache[i].frees += c->cpu[j].frees;
+80107887:	8b 89 d8 00 00 00    	mov    0xd8(%ecx),%ecx
+8010788d:	01 48 2c             	add    %ecx,0x2c(%eax)
+    for(j = 0; j < ncpu; j++){
+80107890:	83 c2 01             	add    $0x1,%edx
+80107893:	39 15 64 1e 12 80    	cmp    %edx,0x80121e64
+80107899:	7f c5                	jg     80107860 <slabstat+0x4a>
+    }
+    safestrcpy(st->cache[i].name, c->name, sizeof(st->cache[i].name));
+8010789b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+8010789e:	69 c6 bc 02 00 00    	imul   $0x2bc,%esi,%eax
+801078a4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801078a7:	8d 90 c8 1e 13 80    	lea    -0x7fece138(%eax),%edx
+801078ad:	6b c6 2c             	imul   $0x2c,%esi,%eax
+801078b0:	8d 0c 07             	lea    (%edi,%eax,1),%ecx
+801078b3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+801078b6:	8d 41 04             	lea    0x4(%ecx),%eax
+801078b9:	83 ec 04             	sub    $0x4,%esp
+801078bc:	6a 10                	push   $0x10
+801078be:	52                   	push   %edx
+801078bf:	50                   	push   %eax
+801078c0:	e8 e5 03 00 00       	call   80107caa <safestrcpy>
+    st->cache[i].size = c->size;
+801078c5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801078c8:	8b 90 d8 1e 13 80    	mov    -0x7fece128(%eax),%edx
+801078ce:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+801078d1:	89 51 14             	mov    %edx,0x14(%ecx)
+    st->cache[i].inuse = c->inuse - cached;
+801078d4:	8b 90 e8 1e 13 80    	mov    -0x7fece118(%eax),%edx
+801078da:	29 da                	sub    %ebx,%edx
+801078dc:	89 51 18             	mov    %edx,0x18(%ecx)
+    st->cache[i].cached = cached;
+801078df:	89 59 1c             	mov    %ebx,0x1c(%ecx)
+    st->cache[i].total = c->nslab * c->perslab;
+801078e2:	8b 90 dc 1e 13 80    	mov    -0x7fece124(%eax),%edx
+801078e8:	0f af 90 e4 1e 13 80 	imul   -0x7fece11c(%eax),%edx
+    st->cache[i].size = c->size;
+801078ef:	05 60 1e 13 80       	add    $0x80131e60,%eax
+    st->cache[i].total = c->nslab * c->perslab;
+801078f4:	89 51 20             	mov    %edx,0x20(%ecx)
+    st->cache[i].slabs = c->nslab;
+801078f7:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+801078fd:	89 41 24             	mov    %eax,0x24(%ecx)
+    release(&c->lock);
+80107900:	83 c4 04             	add    $0x4,%esp
+80107903:	ff 75 e0             	push   -0x20(%ebp)
+80107906:	e8 ec 01 00 00       	call   80107af7 <release>
+  for(i = 0; i < st->n; i++){
+8010790b:	83 c6 01             	add    $0x1,%esi
+8010790e:	83 c4 10             	add    $0x10,%esp
+80107911:	39 37                	cmp    %esi,(%edi)
+80107913:	7e 2c                	jle    80107941 <slabstat+0x12b>
+    acquire(&c->lock);
+80107915:	69 c6 bc 02 00 00    	imul   $0x2bc,%esi,%eax
+8010791b:	05 94 1e 13 80       	add    $0x80131e94,%eax
+80107920:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80107923:	83 ec 0c             	sub    $0xc,%esp
+80107926:	50                   	push   %eax
+80107927:	e8 66 01 00 00       	call   80107a92 <acquire>
+    for(j = 0; j < ncpu; j++){
+8010792c:	83 c4 10             	add    $0x10,%esp
+    cached = 0;
+8010792f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for(j = 0; j < ncpu; j++){
+80107934:	ba 00 00 00 00       	mov    $0x0,%edx
+80107939:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+8010793c:	e9 52 ff ff ff       	jmp    80107893 <slabstat+0x7d>
+  }
+  return 0;
+}
+80107941:	b8 00 00 00 00       	mov    $0x0,%eax
+80107946:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107949:	5b                   	pop    %ebx
+8010794a:	5e                   	pop    %esi
+8010794b:	5f                   	pop    %edi
+8010794c:	5d                   	pop    %ebp
+8010794d:	c3                   	ret
+
+8010794e <initlock>:
+#include "proc.h"
+#include "spinlock.h"
+
+void
+initlock(struct spinlock *lk, char *name)
+{
+8010794e:	55                   	push   %ebp
+8010794f:	89 e5                	mov    %esp,%ebp
+80107951:	8b 45 08             	mov    0x8(%ebp),%eax
+  lk->name = name;
+80107954:	8b 55 0c             	mov    0xc(%ebp),%edx
+80107957:	89 50 04             	mov    %edx,0x4(%eax)
+  lk->locked = 0;
+8010795a:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  lk->cpu = 0;
+80107960:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+}
+80107967:	5d                   	pop    %ebp
+80107968:	c3                   	ret
+
+80107969 <getcallerpcs>:
+}
+
+// Record the current call stack in pcs[] by following the %ebp chain.
+void
+getcallerpcs(void *v, uint pcs[])
+{
+80107969:	55                   	push   %ebp
+8010796a:	89 e5                	mov    %esp,%ebp
+8010796c:	53                   	push   %ebx
+8010796d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  uint *ebp;
+  int i;
+
+  ebp = (uint*)v - 2;
+80107970:	8b 45 08             	mov    0x8(%ebp),%eax
+80107973:	8d 50 f8             	lea    -0x8(%eax),%edx
+  for(i = 0; i < 10; i++){
+80107976:	b8 00 00 00 00       	mov    $0x0,%eax
+8010797b:	83 f8 09             	cmp    $0x9,%eax
+8010797e:	7f 25                	jg     801079a5 <getcallerpcs+0x3c>
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80107980:	8d 9a 00 00 00 80    	lea    -0x80000000(%edx),%ebx
+80107986:	81 fb fe ff ff 7f    	cmp    $0x7ffffffe,%ebx
+8010798c:	77 17                	ja     801079a5 <getcallerpcs+0x3c>
+      break;
+    pcs[i] = ebp[1];     // saved %eip
+8010798e:	8b 5a 04             	mov    0x4(%edx),%ebx
+80107991:	89 1c 81             	mov    %ebx,(%ecx,%eax,4)
+    ebp = (uint*)ebp[0]; // saved %ebp
+80107994:	8b 12                	mov    (%edx),%edx
+  for(i = 0; i < 10; i++){
+80107996:	83 c0 01             	add    $0x1,%eax
+80107999:	eb e0                	jmp    8010797b <getcallerpcs+0x12>
+  }
+  for(; i < 10; i++)
+    pcs[i] = 0;
+8010799b:	c7 04 81 00 00 00 00 	movl   $0x0,(%ecx,%eax,4)
+  for(; i < 10; i++)
+801079a2:	83 c0 01             	add    $0x1,%eax
+801079a5:	83 f8 09             	cmp    $0x9,%eax
+801079a8:	7e f1                	jle    8010799b <getcallerpcs+0x32>
+}
+801079aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801079ad:	c9                   	leave
+801079ae:	c3                   	ret
+
+801079af <pushcli>:
+// it takes two popcli to undo two pushcli.  Also, if interrupts
+// are off, then pushcli, popcli leaves them off.
+
+void
+pushcli(void)
+{
+801079af:	55                   	push   %ebp
+801079b0:	89 e5                	mov    %esp,%ebp
+801079b2:	53                   	push   %ebx
+801079b3:	83 ec 04             	sub    $0x4,%esp
+801079b6:	9c                   	pushf
+801079b7:	5b                   	pop    %ebx
+  asm volatile("cli");
+801079b8:	fa                   	cli
+  int eflags;
+
+  eflags = readeflags();
+  cli();
+  if(mycpu()->ncli == 0)
+801079b9:	e8 d6 e2 ff ff       	call   80105c94 <mycpu>
+801079be:	83 b8 a4 00 00 00 00 	cmpl   $0x0,0xa4(%eax)
+801079c5:	74 19                	je     801079e0 <pushcli+0x31>
+    mycpu()->intena = eflags & FL_IF;
+  mycpu()->ncli += 1;
+801079c7:	e8 c8 e2 ff ff       	call   80105c94 <mycpu>
+801079cc:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+801079d2:	8d 51 01             	lea    0x1(%ecx),%edx
+801079d5:	89 90 a4 00 00 00    	mov    %edx,0xa4(%eax)
+}
+801079db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801079de:	c9                   	leave
+801079df:	c3                   	ret
+    mycpu()->intena = eflags & FL_IF;
+801079e0:	e8 af e2 ff ff       	call   80105c94 <mycpu>
+801079e5:	81 e3 00 02 00 00    	and    $0x200,%ebx
+801079eb:	89 98 a8 00 00 00    	mov    %ebx,0xa8(%eax)
+801079f1:	eb d4                	jmp    801079c7 <pushcli+0x18>
+
+801079f3 <popcli>:
+
+void
+popcli(void)
+{
+801079f3:	55                   	push   %ebp
+801079f4:	89 e5                	mov    %esp,%ebp
+801079f6:	83 ec 08             	sub    $0x8,%esp
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+801079f9:	9c                   	pushf
+801079fa:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+801079fb:	f6 c4 02             	test   $0x2,%ah
+801079fe:	75 28                	jne    80107a28 <popcli+0x35>
+    panic("popcli - interruptible");
+  if(--mycpu()->ncli < 0)
+80107a00:	e8 8f e2 ff ff       	call   80105c94 <mycpu>
+80107a05:	8b 88 a4 00 00 00    	mov    0xa4(%eax),%ecx
+80107a0b:	8d 51 ff             	lea    -0x1(%ecx),%edx
+80107a0e:	89 90 a4 00 00 00    	mov    %edx,0xa4(%eax)
+80107a14:	85 d2                	test   %edx,%edx
+80107a16:	78 1d                	js     80107a35 <popcli+0x42>
+    panic("popcli");
+  if(mycpu()->ncli == 0 && mycpu()->intena)
+80107a18:	e8 77 e2 ff ff       	call   80105c94 <mycpu>
+80107a1d:	83 b8 a4 00 00 00 00 	cmpl   $0x0,0xa4(%eax)
+80107a24:	74 1c                	je     80107a42 <popcli+0x4f>
+    sti();
+}
+80107a26:	c9                   	leave
+80107a27:	c3                   	ret
+    panic("popcli - interruptible");
+80107a28:	83 ec 0c             	sub    $0xc,%esp
+80107a2b:	68 4c c1 10 80       	push   $0x8010c14c
+80107a30:	e8 f6 92 ff ff       	call   80100d2b <panic>
+    panic("popcli");
+80107a35:	83 ec 0c             	sub    $0xc,%esp
+80107a38:	68 63 c1 10 80       	push   $0x8010c163
+80107a3d:	e8 e9 92 ff ff       	call   80100d2b <panic>
+  if(mycpu()->ncli == 0 && mycpu()->intena)
+80107a42:	e8 4d e2 ff ff       	call   80105c94 <mycpu>
+80107a47:	83 b8 a8 00 00 00 00 	cmpl   $0x0,0xa8(%eax)
+80107a4e:	74 d6                	je     80107a26 <popcli+0x33>
+  asm volatile("sti");
+80107a50:	fb                   	sti
+}
+80107a51:	eb d3                	jmp    80107a26 <popcli+0x33>
+
+80107a53 <holding>:
+{
+80107a53:	55                   	push   %ebp
+80107a54:	89 e5                	mov    %esp,%ebp
+80107a56:	53                   	push   %ebx
+80107a57:	83 ec 04             	sub    $0x4,%esp
+80107a5a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pushcli();
+80107a5d:	e8 4d ff ff ff       	call   801079af <pushcli>
+  r = lock->locked && lock->cpu == mycpu();
+80107a62:	83 3b 00             	cmpl   $0x0,(%ebx)
+80107a65:	75 11                	jne    80107a78 <holding+0x25>
+80107a67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  popcli();
+80107a6c:	e8 82 ff ff ff       	call   801079f3 <popcli>
+}
+80107a71:	89 d8                	mov    %ebx,%eax
+80107a73:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107a76:	c9                   	leave
+80107a77:	c3                   	ret
+  r = lock->locked && lock->cpu == mycpu();
+80107a78:	8b 5b 08             	mov    0x8(%ebx),%ebx
+80107a7b:	e8 14 e2 ff ff       	call   80105c94 <mycpu>
+80107a80:	39 c3                	cmp    %eax,%ebx
+80107a82:	74 07                	je     80107a8b <holding+0x38>
+80107a84:	bb 00 00 00 00       	mov    $0x0,%ebx
+80107a89:	eb e1                	jmp    80107a6c <holding+0x19>
+80107a8b:	bb 01 00 00 00       	mov    $0x1,%ebx
+80107a90:	eb da                	jmp    80107a6c <holding+0x19>
+
+80107a92 <acquire>:
+{
+80107a92:	55                   	push   %ebp
+80107a93:	89 e5                	mov    %esp,%ebp
+80107a95:	53                   	push   %ebx
+80107a96:	83 ec 04             	sub    $0x4,%esp
+  pushcli(); // disable interrupts to avoid deadlock.
+80107a99:	e8 11 ff ff ff       	call   801079af <pushcli>
+  if(holding(lk))
+80107a9e:	83 ec 0c             	sub    $0xc,%esp
+80107aa1:	ff 75 08             	push   0x8(%ebp)
+80107aa4:	e8 aa ff ff ff       	call   80107a53 <holding>
+80107aa9:	83 c4 10             	add    $0x10,%esp
+80107aac:	85 c0                	test   %eax,%eax
+80107aae:	75 3a                	jne    80107aea <acquire+0x58>
+  while(xchg(&lk->locked, 1) != 0)
+80107ab0:	8b 55 08             	mov    0x8(%ebp),%edx
+  asm volatile("lock; xchgl %0, %1" :
+80107ab3:	b8 01 00 00 00       	mov    $0x1,%eax
+80107ab8:	f0 87 02             	lock xchg %eax,(%edx)
+80107abb:	85 c0                	test   %eax,%eax
+80107abd:	75 f1                	jne    80107ab0 <acquire+0x1e>
+  __sync_synchronize();
+80107abf:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  lk->cpu = mycpu();
+80107ac4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80107ac7:	e8 c8 e1 ff ff       	call   80105c94 <mycpu>
+80107acc:	89 43 08             	mov    %eax,0x8(%ebx)
+  getcallerpcs(&lk, lk->pcs);
+80107acf:	8b 45 08             	mov    0x8(%ebp),%eax
+80107ad2:	83 c0 0c             	add    $0xc,%eax
+80107ad5:	83 ec 08             	sub    $0x8,%esp
+80107ad8:	50                   	push   %eax
+80107ad9:	8d 45 08             	lea    0x8(%ebp),%eax
+80107adc:	50                   	push   %eax
+80107add:	e8 87 fe ff ff       	call   80107969 <getcallerpcs>
+}
+80107ae2:	83 c4 10             	add    $0x10,%esp
+80107ae5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107ae8:	c9                   	leave
+80107ae9:	c3                   	ret
+    panic("acquire");
+80107aea:	83 ec 0c             	sub    $0xc,%esp
+80107aed:	68 6a c1 10 80       	push   $0x8010c16a
+80107af2:	e8 34 92 ff ff       	call   80100d2b <panic>
+
+80107af7 <release>:
+{
+80107af7:	55                   	push   %ebp
+80107af8:	89 e5                	mov    %esp,%ebp
+80107afa:	53                   	push   %ebx
+80107afb:	83 ec 10             	sub    $0x10,%esp
+80107afe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holding(lk))
+80107b01:	53                   	push   %ebx
+80107b02:	e8 4c ff ff ff       	call   80107a53 <holding>
+80107b07:	83 c4 10             	add    $0x10,%esp
+80107b0a:	85 c0                	test   %eax,%eax
+80107b0c:	74 23                	je     80107b31 <release+0x3a>
+  lk->pcs[0] = 0;
+80107b0e:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  lk->cpu = 0;
+80107b15:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  __sync_synchronize();
+80107b1c:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+80107b21:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  popcli();
+80107b27:	e8 c7 fe ff ff       	call   801079f3 <popcli>
+}
+80107b2c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107b2f:	c9                   	leave
+80107b30:	c3                   	ret
+    panic("release");
+80107b31:	83 ec 0c             	sub    $0xc,%esp
+80107b34:	68 72 c1 10 80       	push   $0x8010c172
+80107b39:	e8 ed 91 ff ff       	call   80100d2b <panic>
+
+80107b3e <memset>:
+#include "types.h"
+#include "x86.h"
+
+void*
+memset(void *dst, int c, uint n)
+{
+80107b3e:	55                   	push   %ebp
+80107b3f:	89 e5                	mov    %esp,%ebp
+80107b41:	57                   	push   %edi
+80107b42:	53                   	push   %ebx
+80107b43:	8b 55 08             	mov    0x8(%ebp),%edx
+80107b46:	8b 45 0c             	mov    0xc(%ebp),%eax
+80107b49:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  if ((int)dst%4 == 0 && n%4 == 0){
+80107b4c:	f6 c2 03             	test   $0x3,%dl
+80107b4f:	75 25                	jne    80107b76 <memset+0x38>
+80107b51:	f6 c1 03             	test   $0x3,%cl
+80107b54:	75 20                	jne    80107b76 <memset+0x38>
+    c &= 0xFF;
+80107b56:	0f b6 f8             	movzbl %al,%edi
+    stosl(dst, (c<<24)|(c<<16)|(c<<8)|c, n/4);
+80107b59:	c1 e9 02             	shr    $0x2,%ecx
+80107b5c:	c1 e0 18             	shl    $0x18,%eax
+80107b5f:	89 fb                	mov    %edi,%ebx
+80107b61:	c1 e3 10             	shl    $0x10,%ebx
+80107b64:	09 d8                	or     %ebx,%eax
+80107b66:	89 fb                	mov    %edi,%ebx
+80107b68:	c1 e3 08             	shl    $0x8,%ebx
+80107b6b:	09 d8                	or     %ebx,%eax
+80107b6d:	09 f8                	or     %edi,%eax
+  asm volatile("cld; rep stosl" :
+80107b6f:	89 d7                	mov    %edx,%edi
+80107b71:	fc                   	cld
+80107b72:	f3 ab                	rep stos %eax,%es:(%edi)
+}
+80107b74:	eb 05                	jmp    80107b7b <memset+0x3d>
+  asm volatile("cld; rep stosb" :
+80107b76:	89 d7                	mov    %edx,%edi
+80107b78:	fc                   	cld
+80107b79:	f3 aa                	rep stos %al,%es:(%edi)
+  } else
+    stosb(dst, c, n);
+  return dst;
+}
+80107b7b:	89 d0                	mov    %edx,%eax
+80107b7d:	5b                   	pop    %ebx
+80107b7e:	5f                   	pop    %edi
+80107b7f:	5d                   	pop    %ebp
+80107b80:	c3                   	ret
+
+80107b81 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+80107b81:	55                   	push   %ebp
+80107b82:	89 e5                	mov    %esp,%ebp
+80107b84:	56                   	push   %esi
+80107b85:	53                   	push   %ebx
+80107b86:	8b 4d 08             	mov    0x8(%ebp),%ecx
+80107b89:	8b 55 0c             	mov    0xc(%ebp),%edx
+80107b8c:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+80107b8f:	eb 08                	jmp    80107b99 <memcmp+0x18>
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+80107b91:	83 c1 01             	add    $0x1,%ecx
+80107b94:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+80107b97:	89 f0                	mov    %esi,%eax
+80107b99:	8d 70 ff             	lea    -0x1(%eax),%esi
+80107b9c:	85 c0                	test   %eax,%eax
+80107b9e:	74 12                	je     80107bb2 <memcmp+0x31>
+    if(*s1 != *s2)
+80107ba0:	0f b6 01             	movzbl (%ecx),%eax
+80107ba3:	0f b6 1a             	movzbl (%edx),%ebx
+80107ba6:	38 d8                	cmp    %bl,%al
+80107ba8:	74 e7                	je     80107b91 <memcmp+0x10>
+      return *s1 - *s2;
+80107baa:	0f b6 c0             	movzbl %al,%eax
+80107bad:	0f b6 db             	movzbl %bl,%ebx
+80107bb0:	29 d8                	sub    %ebx,%eax
+  }
+
+  return 0;
+}
+80107bb2:	5b                   	pop    %ebx
+80107bb3:	5e                   	pop    %esi
+80107bb4:	5d                   	pop    %ebp
+80107bb5:	c3                   	ret
+
+80107bb6 <memmove>:
+
+void*
+memmove(void *dst, const void *src, uint n)
+{
+80107bb6:	55                   	push   %ebp
+80107bb7:	89 e5                	mov    %esp,%ebp
+80107bb9:	56                   	push   %esi
+80107bba:	53                   	push   %ebx
+80107bbb:	8b 75 08             	mov    0x8(%ebp),%esi
+80107bbe:	8b 55 0c             	mov    0xc(%ebp),%edx
+80107bc1:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if(s < d && s + n > d){
+80107bc4:	39 f2                	cmp    %esi,%edx
+80107bc6:	73 3c                	jae    80107c04 <memmove+0x4e>
+80107bc8:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+80107bcb:	39 ce                	cmp    %ecx,%esi
+80107bcd:	73 39                	jae    80107c08 <memmove+0x52>
+    s += n;
+    d += n;
+80107bcf:	8d 14 06             	lea    (%esi,%eax,1),%edx
+    while(n-- > 0)
+80107bd2:	eb 0d                	jmp    80107be1 <memmove+0x2b>
+      *--d = *--s;
+80107bd4:	83 e9 01             	sub    $0x1,%ecx
+80107bd7:	83 ea 01             	sub    $0x1,%edx
+80107bda:	0f b6 01             	movzbl (%ecx),%eax
+80107bdd:	88 02                	mov    %al,(%edx)
+    while(n-- > 0)
+80107bdf:	89 d8                	mov    %ebx,%eax
+80107be1:	8d 58 ff             	lea    -0x1(%eax),%ebx
+80107be4:	85 c0                	test   %eax,%eax
+80107be6:	75 ec                	jne    80107bd4 <memmove+0x1e>
+80107be8:	eb 14                	jmp    80107bfe <memmove+0x48>
+  } else
+    while(n-- > 0)
+      *d++ = *s++;
+80107bea:	0f b6 02             	movzbl (%edx),%eax
+80107bed:	88 01                	mov    %al,(%ecx)
+80107bef:	8d 49 01             	lea    0x1(%ecx),%ecx
+80107bf2:	8d 52 01             	lea    0x1(%edx),%edx
+    while(n-- > 0)
+80107bf5:	89 d8                	mov    %ebx,%eax
+80107bf7:	8d 58 ff             	lea    -0x1(%eax),%ebx
+80107bfa:	85 c0                	test   %eax,%eax
+80107bfc:	75 ec                	jne    80107bea <memmove+0x34>
+
+  return dst;
+}
+80107bfe:	89 f0                	mov    %esi,%eax
+80107c00:	5b                   	pop    %ebx
+80107c01:	5e                   	pop    %esi
+80107c02:	5d                   	pop    %ebp
+80107c03:	c3                   	ret
+80107c04:	89 f1                	mov    %esi,%ecx
+80107c06:	eb ef                	jmp    80107bf7 <memmove+0x41>
+80107c08:	89 f1                	mov    %esi,%ecx
+80107c0a:	eb eb                	jmp    80107bf7 <memmove+0x41>
+
+80107c0c <memcpy>:
+
+// memcpy exists to placate GCC.  Use memmove.
+void*
+memcpy(void *dst, const void *src, uint n)
+{
+80107c0c:	55                   	push   %ebp
+80107c0d:	89 e5                	mov    %esp,%ebp
+80107c0f:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+80107c12:	ff 75 10             	push   0x10(%ebp)
+80107c15:	ff 75 0c             	push   0xc(%ebp)
+80107c18:	ff 75 08             	push   0x8(%ebp)
+80107c1b:	e8 96 ff ff ff       	call   80107bb6 <memmove>
+}
+80107c20:	c9                   	leave
+80107c21:	c3                   	ret
+
+80107c22 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+80107c22:	55                   	push   %ebp
+80107c23:	89 e5                	mov    %esp,%ebp
+80107c25:	53                   	push   %ebx
+80107c26:	8b 55 08             	mov    0x8(%ebp),%edx
+80107c29:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80107c2c:	8b 45 10             	mov    0x10(%ebp),%eax
+  while(n > 0 && *p && *p == *q)
+80107c2f:	eb 09                	jmp    80107c3a <strncmp+0x18>
+    n--, p++, q++;
+80107c31:	83 e8 01             	sub    $0x1,%eax
+80107c34:	83 c2 01             	add    $0x1,%edx
+80107c37:	83 c1 01             	add    $0x1,%ecx
+  while(n > 0 && *p && *p == *q)
+80107c3a:	85 c0                	test   %eax,%eax
+80107c3c:	74 0b                	je     80107c49 <strncmp+0x27>
+80107c3e:	0f b6 1a             	movzbl (%edx),%ebx
+80107c41:	84 db                	test   %bl,%bl
+80107c43:	74 04                	je     80107c49 <strncmp+0x27>
+80107c45:	3a 19                	cmp    (%ecx),%bl
+80107c47:	74 e8                	je     80107c31 <strncmp+0xf>
+  if(n == 0)
+80107c49:	85 c0                	test   %eax,%eax
+80107c4b:	74 0d                	je     80107c5a <strncmp+0x38>
+    return 0;
+  return (uchar)*p - (uchar)*q;
+80107c4d:	0f b6 02             	movzbl (%edx),%eax
+80107c50:	0f b6 11             	movzbl (%ecx),%edx
+80107c53:	29 d0                	sub    %edx,%eax
+}
+80107c55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107c58:	c9                   	leave
+80107c59:	c3                   	ret
+    return 0;
+80107c5a:	b8 00 00 00 00       	mov    $0x0,%eax
+80107c5f:	eb f4                	jmp    80107c55 <strncmp+0x33>
+
+80107c61 <strncpy>:
+
+char*
+strncpy(char *s, const char *t, int n)
+{
+80107c61:	55                   	push   %ebp
+80107c62:	89 e5                	mov    %esp,%ebp
+80107c64:	57                   	push   %edi
+80107c65:	56                   	push   %esi
+80107c66:	53                   	push   %ebx
+80107c67:	8b 7d 08             	mov    0x8(%ebp),%edi
+80107c6a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80107c6d:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *os;
+
+  os = s;
+  while(n-- > 0 && (*s++ = *t++) != 0)
+80107c70:	89 fa                	mov    %edi,%edx
+80107c72:	eb 04                	jmp    80107c78 <strncpy+0x17>
+80107c74:	89 f1                	mov    %esi,%ecx
+80107c76:	89 da                	mov    %ebx,%edx
+80107c78:	89 c3                	mov    %eax,%ebx
+80107c7a:	83 e8 01             	sub    $0x1,%eax
+80107c7d:	85 db                	test   %ebx,%ebx
+80107c7f:	7e 11                	jle    80107c92 <strncpy+0x31>
+80107c81:	8d 71 01             	lea    0x1(%ecx),%esi
+80107c84:	8d 5a 01             	lea    0x1(%edx),%ebx
+80107c87:	0f b6 09             	movzbl (%ecx),%ecx
+80107c8a:	88 0a                	mov    %cl,(%edx)
+80107c8c:	84 c9                	test   %cl,%cl
+80107c8e:	75 e4                	jne    80107c74 <strncpy+0x13>
+80107c90:	89 da                	mov    %ebx,%edx
+    ;
+  while(n-- > 0)
+80107c92:	8d 48 ff             	lea    -0x1(%eax),%ecx
+80107c95:	85 c0                	test   %eax,%eax
+80107c97:	7e 0a                	jle    80107ca3 <strncpy+0x42>
+    *s++ = 0;
+80107c99:	c6 02 00             	movb   $0x0,(%edx)
+  while(n-- > 0)
+80107c9c:	89 c8                	mov    %ecx,%eax
+    *s++ = 0;
+80107c9e:	8d 52 01             	lea    0x1(%edx),%edx
+80107ca1:	eb ef                	jmp    80107c92 <strncpy+0x31>
+  return os;
+}
+80107ca3:	89 f8                	mov    %edi,%eax
+80107ca5:	5b                   	pop    %ebx
+80107ca6:	5e                   	pop    %esi
+80107ca7:	5f                   	pop    %edi
+80107ca8:	5d                   	pop    %ebp
+80107ca9:	c3                   	ret
+
+80107caa <safestrcpy>:
+
+// Like strncpy but guaranteed to NUL-terminate.
+char*
+safestrcpy(char *s, const char *t, int n)
+{
+80107caa:	55                   	push   %ebp
+80107cab:	89 e5                	mov    %esp,%ebp
+80107cad:	57                   	push   %edi
+80107cae:	56                   	push   %esi
+80107caf:	53                   	push   %ebx
+80107cb0:	8b 7d 08             	mov    0x8(%ebp),%edi
+80107cb3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80107cb6:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *os;
+
+  os = s;
+  if(n <= 0)
+80107cb9:	85 c0                	test   %eax,%eax
+80107cbb:	7e 23                	jle    80107ce0 <safestrcpy+0x36>
+80107cbd:	89 fa                	mov    %edi,%edx
+80107cbf:	eb 04                	jmp    80107cc5 <safestrcpy+0x1b>
+    return os;
+  while(--n > 0 && (*s++ = *t++) != 0)
+80107cc1:	89 f1                	mov    %esi,%ecx
+80107cc3:	89 da                	mov    %ebx,%edx
+80107cc5:	83 e8 01             	sub    $0x1,%eax
+80107cc8:	85 c0                	test   %eax,%eax
+80107cca:	7e 11                	jle    80107cdd <safestrcpy+0x33>
+80107ccc:	8d 71 01             	lea    0x1(%ecx),%esi
+80107ccf:	8d 5a 01             	lea    0x1(%edx),%ebx
+80107cd2:	0f b6 09             	movzbl (%ecx),%ecx
+80107cd5:	88 0a                	mov    %cl,(%edx)
+80107cd7:	84 c9                	test   %cl,%cl
+80107cd9:	75 e6                	jne    80107cc1 <safestrcpy+0x17>
+80107cdb:	89 da                	mov    %ebx,%edx
+    ;
+  *s = 0;
+80107cdd:	c6 02 00             	movb   $0x0,(%edx)
+  return os;
+}
+80107ce0:	89 f8                	mov    %edi,%eax
+80107ce2:	5b                   	pop    %ebx
+80107ce3:	5e                   	pop    %esi
+80107ce4:	5f                   	pop    %edi
+80107ce5:	5d                   	pop    %ebp
+80107ce6:	c3                   	ret
+
+80107ce7 <strlen>:
+
+int
+strlen(const char *s)
+{
+80107ce7:	55                   	push   %ebp
+80107ce8:	89 e5                	mov    %esp,%ebp
+80107cea:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+80107ced:	b8 00 00 00 00       	mov    $0x0,%eax
+80107cf2:	eb 03                	jmp    80107cf7 <strlen+0x10>
+80107cf4:	83 c0 01             	add    $0x1,%eax
+80107cf7:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+80107cfb:	75 f7                	jne    80107cf4 <strlen+0xd>
+    ;
+  return n;
+}
+80107cfd:	5d                   	pop    %ebp
+80107cfe:	c3                   	ret
+
+80107cff <swtch>:
+# a struct context, and save its address in *old.
+# Switch stacks to new and pop previously-saved registers.
+
+.globl swtch
+swtch:
+  movl 4(%esp), %eax
+80107cff:	8b 44 24 04          	mov    0x4(%esp),%eax
+  movl 8(%esp), %edx
+80107d03:	8b 54 24 08          	mov    0x8(%esp),%edx
+
+  # Save old callee-saved registers
+  pushl %ebp
+80107d07:	55                   	push   %ebp
+  pushl %ebx
+80107d08:	53                   	push   %ebx
+  pushl %esi
+80107d09:	56                   	push   %esi
+  pushl %edi
+80107d0a:	57                   	push   %edi
+
+  # Switch stacks
+  movl %esp, (%eax)
+80107d0b:	89 20                	mov    %esp,(%eax)
+  movl %edx, %esp
+80107d0d:	89 d4                	mov    %edx,%esp
+
+  # Load new callee-saved registers
+  popl %edi
+80107d0f:	5f                   	pop    %edi
+  popl %esi
+80107d10:	5e                   	pop    %esi
+  popl %ebx
+80107d11:	5b                   	pop    %ebx
+  popl %ebp
+80107d12:	5d                   	pop    %ebp
+  ret
+80107d13:	c3                   	ret
+
+80107d14 <fetchint>:
+// to a saved program counter, and then the first argument.
+
+// Fetch the int at addr from the current process.
+int
+fetchint(uint addr, int *ip)
+{
+80107d14:	55                   	push   %ebp
+80107d15:	89 e5                	mov    %esp,%ebp
+80107d17:	56                   	push   %esi
+80107d18:	53                   	push   %ebx
+80107d19:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *curproc = myproc();
+80107d1c:	e8 ea df ff ff       	call   80105d0b <myproc>
+80107d21:	89 c6                	mov    %eax,%esi
+  uint end;
+
+  if((end = uend(curproc, addr)) == 0 || addr+4 < addr || addr+4 > end)
+80107d23:	83 ec 08             	sub    $0x8,%esp
+80107d26:	53                   	push   %ebx
+80107d27:	50                   	push   %eax
+80107d28:	e8 ff 38 00 00       	call   8010b62c <uend>
+80107d2d:	83 c4 10             	add    $0x10,%esp
+80107d30:	85 c0                	test   %eax,%eax
+80107d32:	74 31                	je     80107d65 <fetchint+0x51>
+80107d34:	83 fb fb             	cmp    $0xfffffffb,%ebx
+80107d37:	77 33                	ja     80107d6c <fetchint+0x58>
+80107d39:	8d 53 04             	lea    0x4(%ebx),%edx
+80107d3c:	39 d0                	cmp    %edx,%eax
+80107d3e:	72 33                	jb     80107d73 <fetchint+0x5f>
+    return -1;
+  if(faultin(curproc, addr, 4, 0) < 0)
+80107d40:	6a 00                	push   $0x0
+80107d42:	6a 04                	push   $0x4
+80107d44:	53                   	push   %ebx
+80107d45:	56                   	push   %esi
+80107d46:	e8 3e 3a 00 00       	call   8010b789 <faultin>
+80107d4b:	83 c4 10             	add    $0x10,%esp
+80107d4e:	85 c0                	test   %eax,%eax
+80107d50:	78 28                	js     80107d7a <fetchint+0x66>
+    return -1;
+  *ip = *(int*)(addr);
+80107d52:	8b 13                	mov    (%ebx),%edx
+80107d54:	8b 45 0c             	mov    0xc(%ebp),%eax
+80107d57:	89 10                	mov    %edx,(%eax)
+  return 0;
+80107d59:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80107d5e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107d61:	5b                   	pop    %ebx
+80107d62:	5e                   	pop    %esi
+80107d63:	5d                   	pop    %ebp
+80107d64:	c3                   	ret
+    return -1;
+80107d65:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107d6a:	eb f2                	jmp    80107d5e <fetchint+0x4a>
+80107d6c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107d71:	eb eb                	jmp    80107d5e <fetchint+0x4a>
+80107d73:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107d78:	eb e4                	jmp    80107d5e <fetchint+0x4a>
+    return -1;
+80107d7a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107d7f:	eb dd                	jmp    80107d5e <fetchint+0x4a>
+
+80107d81 <fetchstr>:
+// Fetch the nul-terminated string at addr from the current process.
+// Doesn't actually copy the string - just sets *pp to point at it.
+// Returns length of string, not including nul.
+int
+fetchstr(uint addr, char **pp)
+{
+80107d81:	55                   	push   %ebp
+80107d82:	89 e5                	mov    %esp,%ebp
+80107d84:	57                   	push   %edi
+80107d85:	56                   	push   %esi
+80107d86:	53                   	push   %ebx
+80107d87:	83 ec 1c             	sub    $0x1c,%esp
+80107d8a:	8b 7d 08             	mov    0x8(%ebp),%edi
+80107d8d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *s, *ep;
+  struct proc *curproc = myproc();
+80107d90:	e8 76 df ff ff       	call   80105d0b <myproc>
+80107d95:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+  if(addr >= curproc->sz)
+80107d98:	3b 38                	cmp    (%eax),%edi
+80107d9a:	73 49                	jae    80107de5 <fetchstr+0x64>
+    return -1;
+  *pp = (char*)addr;
+80107d9c:	89 fb                	mov    %edi,%ebx
+80107d9e:	89 3e                	mov    %edi,(%esi)
+  ep = (char*)curproc->sz;
+80107da0:	8b 38                	mov    (%eax),%edi
+  for(s = *pp; s < ep; s++){
+80107da2:	eb 1c                	jmp    80107dc0 <fetchstr+0x3f>
+    if((s == *pp || (uint)s % PGSIZE == 0) && faultin(curproc, (uint)s, 1, 0) < 0)
+80107da4:	6a 00                	push   $0x0
+80107da6:	6a 01                	push   $0x1
+80107da8:	53                   	push   %ebx
+80107da9:	ff 75 e4             	push   -0x1c(%ebp)
+80107dac:	e8 d8 39 00 00       	call   8010b789 <faultin>
+80107db1:	83 c4 10             	add    $0x10,%esp
+80107db4:	85 c0                	test   %eax,%eax
+80107db6:	78 34                	js     80107dec <fetchstr+0x6b>
+      return -1;
+    if(*s == 0)
+80107db8:	80 3b 00             	cmpb   $0x0,(%ebx)
+80107dbb:	74 15                	je     80107dd2 <fetchstr+0x51>
+  for(s = *pp; s < ep; s++){
+80107dbd:	83 c3 01             	add    $0x1,%ebx
+80107dc0:	39 fb                	cmp    %edi,%ebx
+80107dc2:	73 14                	jae    80107dd8 <fetchstr+0x57>
+    if((s == *pp || (uint)s % PGSIZE == 0) && faultin(curproc, (uint)s, 1, 0) < 0)
+80107dc4:	39 1e                	cmp    %ebx,(%esi)
+80107dc6:	74 dc                	je     80107da4 <fetchstr+0x23>
+80107dc8:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+80107dce:	75 e8                	jne    80107db8 <fetchstr+0x37>
+80107dd0:	eb d2                	jmp    80107da4 <fetchstr+0x23>
+      return s - *pp;
+80107dd2:	89 d8                	mov    %ebx,%eax
+80107dd4:	2b 06                	sub    (%esi),%eax
+80107dd6:	eb 05                	jmp    80107ddd <fetchstr+0x5c>
+  }
+  return -1;
+80107dd8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80107ddd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107de0:	5b                   	pop    %ebx
+80107de1:	5e                   	pop    %esi
+80107de2:	5f                   	pop    %edi
+80107de3:	5d                   	pop    %ebp
+80107de4:	c3                   	ret
+    return -1;
+80107de5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107dea:	eb f1                	jmp    80107ddd <fetchstr+0x5c>
+      return -1;
+80107dec:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107df1:	eb ea                	jmp    80107ddd <fetchstr+0x5c>
+
+80107df3 <argint>:
+
+// Fetch the nth 32-bit system call argument.
+int
+argint(int n, int *ip)
+{
+80107df3:	55                   	push   %ebp
+80107df4:	89 e5                	mov    %esp,%ebp
+80107df6:	83 ec 08             	sub    $0x8,%esp
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80107df9:	e8 0d df ff ff       	call   80105d0b <myproc>
+80107dfe:	8b 50 18             	mov    0x18(%eax),%edx
+80107e01:	8b 45 08             	mov    0x8(%ebp),%eax
+80107e04:	c1 e0 02             	shl    $0x2,%eax
+80107e07:	03 42 44             	add    0x44(%edx),%eax
+80107e0a:	83 ec 08             	sub    $0x8,%esp
+80107e0d:	ff 75 0c             	push   0xc(%ebp)
+80107e10:	83 c0 04             	add    $0x4,%eax
+80107e13:	50                   	push   %eax
+80107e14:	e8 fb fe ff ff       	call   80107d14 <fetchint>
+}
+80107e19:	c9                   	leave
+80107e1a:	c3                   	ret
+
+80107e1b <argbuf>:
+// Fetch the nth word-sized system call argument as a pointer
+// to a block of memory of size bytes, which the kernel will
+// write to if write is set.
+static int
+argbuf(int n, char **pp, int size, int write)
+{
+80107e1b:	55                   	push   %ebp
+80107e1c:	89 e5                	mov    %esp,%ebp
+80107e1e:	57                   	push   %edi
+80107e1f:	56                   	push   %esi
+80107e20:	53                   	push   %ebx
+80107e21:	83 ec 2c             	sub    $0x2c,%esp
+80107e24:	89 c7                	mov    %eax,%edi
+80107e26:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+80107e29:	89 cb                	mov    %ecx,%ebx
+  int i;
+  uint end;
+  struct proc *curproc = myproc();
+80107e2b:	e8 db de ff ff       	call   80105d0b <myproc>
+80107e30:	89 c6                	mov    %eax,%esi
+
+  if(argint(n, &i) < 0)
+80107e32:	83 ec 08             	sub    $0x8,%esp
+80107e35:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80107e38:	50                   	push   %eax
+80107e39:	57                   	push   %edi
+80107e3a:	e8 b4 ff ff ff       	call   80107df3 <argint>
+80107e3f:	83 c4 10             	add    $0x10,%esp
+80107e42:	85 c0                	test   %eax,%eax
+80107e44:	78 52                	js     80107e98 <argbuf+0x7d>
+    return -1;
+  if(size < 0 || (end = uend(curproc, i)) == 0 ||
+80107e46:	85 db                	test   %ebx,%ebx
+80107e48:	78 47                	js     80107e91 <argbuf+0x76>
+80107e4a:	83 ec 08             	sub    $0x8,%esp
+80107e4d:	ff 75 e4             	push   -0x1c(%ebp)
+80107e50:	56                   	push   %esi
+80107e51:	e8 d6 37 00 00       	call   8010b62c <uend>
+80107e56:	83 c4 10             	add    $0x10,%esp
+80107e59:	85 c0                	test   %eax,%eax
+80107e5b:	74 34                	je     80107e91 <argbuf+0x76>
+     (uint)i+size < (uint)i || (uint)i+size > end)
+80107e5d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  if(size < 0 || (end = uend(curproc, i)) == 0 ||
+80107e60:	89 d1                	mov    %edx,%ecx
+80107e62:	01 d9                	add    %ebx,%ecx
+80107e64:	72 2b                	jb     80107e91 <argbuf+0x76>
+     (uint)i+size < (uint)i || (uint)i+size > end)
+80107e66:	39 c8                	cmp    %ecx,%eax
+80107e68:	72 27                	jb     80107e91 <argbuf+0x76>
+    return -1;
+  if(faultin(curproc, i, size, write) < 0)
+80107e6a:	ff 75 08             	push   0x8(%ebp)
+80107e6d:	53                   	push   %ebx
+80107e6e:	52                   	push   %edx
+80107e6f:	56                   	push   %esi
+80107e70:	e8 14 39 00 00       	call   8010b789 <faultin>
+80107e75:	83 c4 10             	add    $0x10,%esp
+80107e78:	85 c0                	test   %eax,%eax
+80107e7a:	78 23                	js     80107e9f <argbuf+0x84>
+    return -1;
+  *pp = (char*)i;
+80107e7c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80107e7f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+80107e82:	89 07                	mov    %eax,(%edi)
+  return 0;
+80107e84:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80107e89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107e8c:	5b                   	pop    %ebx
+80107e8d:	5e                   	pop    %esi
+80107e8e:	5f                   	pop    %edi
+80107e8f:	5d                   	pop    %ebp
+80107e90:	c3                   	ret
+    return -1;
+80107e91:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107e96:	eb f1                	jmp    80107e89 <argbuf+0x6e>
+    return -1;
+80107e98:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107e9d:	eb ea                	jmp    80107e89 <argbuf+0x6e>
+    return -1;
+80107e9f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107ea4:	eb e3                	jmp    80107e89 <argbuf+0x6e>
+
+80107ea6 <argptr>:
+// Fetch the nth word-sized system call argument as a pointer
+// to a block of memory of size bytes.  Check that the pointer
+// lies within the process address space.
+int
+argptr(int n, char **pp, int size)
+{
+80107ea6:	55                   	push   %ebp
+80107ea7:	89 e5                	mov    %esp,%ebp
+80107ea9:	83 ec 14             	sub    $0x14,%esp
+  return argbuf(n, pp, size, 0);
+80107eac:	6a 00                	push   $0x0
+80107eae:	8b 4d 10             	mov    0x10(%ebp),%ecx
+80107eb1:	8b 55 0c             	mov    0xc(%ebp),%edx
+80107eb4:	8b 45 08             	mov    0x8(%ebp),%eax
+80107eb7:	e8 5f ff ff ff       	call   80107e1b <argbuf>
+}
+80107ebc:	c9                   	leave
+80107ebd:	c3                   	ret
+
+80107ebe <argptrw>:
+// Like argptr, for a buffer the kernel will write to: also
+// check that it is writable, breaking copy-on-write sharing
+// now rather than faulting later, perhaps with a lock held.
+int
+argptrw(int n, char **pp, int size)
+{
+80107ebe:	55                   	push   %ebp
+80107ebf:	89 e5                	mov    %esp,%ebp
+80107ec1:	83 ec 14             	sub    $0x14,%esp
+  return argbuf(n, pp, size, 1);
+80107ec4:	6a 01                	push   $0x1
+80107ec6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+80107ec9:	8b 55 0c             	mov    0xc(%ebp),%edx
+80107ecc:	8b 45 08             	mov    0x8(%ebp),%eax
+80107ecf:	e8 47 ff ff ff       	call   80107e1b <argbuf>
+}
+80107ed4:	c9                   	leave
+80107ed5:	c3                   	ret
+
+80107ed6 <argstr>:
+// Check that the pointer is valid and the string is nul-terminated.
+// (Strings are not accepted from shared memory segments, so the
+// string can't change between this check and being used by the kernel.)
+int
+argstr(int n, char **pp)
+{
+80107ed6:	55                   	push   %ebp
+80107ed7:	89 e5                	mov    %esp,%ebp
+80107ed9:	83 ec 20             	sub    $0x20,%esp
+  int addr;
+  if(argint(n, &addr) < 0)
+80107edc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80107edf:	50                   	push   %eax
+80107ee0:	ff 75 08             	push   0x8(%ebp)
+80107ee3:	e8 0b ff ff ff       	call   80107df3 <argint>
+80107ee8:	83 c4 10             	add    $0x10,%esp
+80107eeb:	85 c0                	test   %eax,%eax
+80107eed:	78 13                	js     80107f02 <argstr+0x2c>
+    return -1;
+  return fetchstr(addr, pp);
+80107eef:	83 ec 08             	sub    $0x8,%esp
+80107ef2:	ff 75 0c             	push   0xc(%ebp)
+80107ef5:	ff 75 f4             	push   -0xc(%ebp)
+80107ef8:	e8 84 fe ff ff       	call   80107d81 <fetchstr>
+80107efd:	83 c4 10             	add    $0x10,%esp
+}
+80107f00:	c9                   	leave
+80107f01:	c3                   	ret
+    return -1;
+80107f02:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107f07:	eb f7                	jmp    80107f00 <argstr+0x2a>
+
+80107f09 <syscall>:
+[SYS_bdrop]   sys_bdrop,
+};
+
+void
+syscall(void)
+{
+80107f09:	55                   	push   %ebp
+80107f0a:	89 e5                	mov    %esp,%ebp
+80107f0c:	53                   	push   %ebx
+80107f0d:	83 ec 04             	sub    $0x4,%esp
+  int num;
+  struct proc *curproc = myproc();
+80107f10:	e8 f6 dd ff ff       	call   80105d0b <myproc>
+80107f15:	89 c3                	mov    %eax,%ebx
+
+  num = curproc->tf->eax;
+80107f17:	8b 40 18             	mov    0x18(%eax),%eax
+80107f1a:	8b 40 1c             	mov    0x1c(%eax),%eax
+  if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
+80107f1d:	8d 50 ff             	lea    -0x1(%eax),%edx
+80107f20:	83 fa 26             	cmp    $0x26,%edx
+80107f23:	77 17                	ja     80107f3c <syscall+0x33>
+80107f25:	8b 14 85 a0 c1 10 80 	mov    -0x7fef3e60(,%eax,4),%edx
+80107f2c:	85 d2                	test   %edx,%edx
+80107f2e:	74 0c                	je     80107f3c <syscall+0x33>
+    curproc->tf->eax = syscalls[num]();
+80107f30:	ff d2                	call   *%edx
+80107f32:	89 c2                	mov    %eax,%edx
+80107f34:	8b 43 18             	mov    0x18(%ebx),%eax
+80107f37:	89 50 1c             	mov    %edx,0x1c(%eax)
+80107f3a:	eb 1f                	jmp    80107f5b <syscall+0x52>
+  } else {
+    cprintf("%d %s: unknown sys call %d\n",
+            curproc->pid, curproc->name, num);
+80107f3c:	8d 53 6c             	lea    0x6c(%ebx),%edx
+    cprintf("%d %s: unknown sys call %d\n",
+80107f3f:	50                   	push   %eax
+80107f40:	52                   	push   %edx
+80107f41:	ff 73 10             	push   0x10(%ebx)
+80107f44:	68 7a c1 10 80       	push   $0x8010c17a
+80107f49:	e8 9e 90 ff ff       	call   80100fec <cprintf>
+    curproc->tf->eax = -1;
+80107f4e:	8b 43 18             	mov    0x18(%ebx),%eax
+80107f51:	c7 40 1c ff ff ff ff 	movl   $0xffffffff,0x1c(%eax)
+80107f58:	83 c4 10             	add    $0x10,%esp
+  }
+}
+80107f5b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107f5e:	c9                   	leave
+80107f5f:	c3                   	ret
+
+80107f60 <argfd>:
+
+// Fetch the nth word-sized system call argument as a file descriptor
+// and return both the descriptor and the corresponding struct file.
+static int
+argfd(int n, int *pfd, struct file **pf)
+{
+80107f60:	55                   	push   %ebp
+80107f61:	89 e5                	mov    %esp,%ebp
+80107f63:	56                   	push   %esi
+80107f64:	53                   	push   %ebx
+80107f65:	83 ec 18             	sub    $0x18,%esp
+80107f68:	89 d6                	mov    %edx,%esi
+80107f6a:	89 cb                	mov    %ecx,%ebx
+  int fd;
+  struct file *f;
+
+  if(argint(n, &fd) < 0)
+80107f6c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+80107f6f:	52                   	push   %edx
+80107f70:	50                   	push   %eax
+80107f71:	e8 7d fe ff ff       	call   80107df3 <argint>
+80107f76:	83 c4 10             	add    $0x10,%esp
+80107f79:	85 c0                	test   %eax,%eax
+80107f7b:	78 35                	js     80107fb2 <argfd+0x52>
+    return -1;
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80107f7d:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80107f81:	77 28                	ja     80107fab <argfd+0x4b>
+80107f83:	e8 83 dd ff ff       	call   80105d0b <myproc>
+80107f88:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80107f8b:	8b 44 90 28          	mov    0x28(%eax,%edx,4),%eax
+80107f8f:	85 c0                	test   %eax,%eax
+80107f91:	74 18                	je     80107fab <argfd+0x4b>
+    return -1;
+  if(pfd)
+80107f93:	85 f6                	test   %esi,%esi
+80107f95:	74 02                	je     80107f99 <argfd+0x39>
+    *pfd = fd;
+80107f97:	89 16                	mov    %edx,(%esi)
+  if(pf)
+80107f99:	85 db                	test   %ebx,%ebx
+80107f9b:	74 1c                	je     80107fb9 <argfd+0x59>
+    *pf = f;
+80107f9d:	89 03                	mov    %eax,(%ebx)
+  return 0;
+80107f9f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80107fa4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107fa7:	5b                   	pop    %ebx
+80107fa8:	5e                   	pop    %esi
+80107fa9:	5d                   	pop    %ebp
+80107faa:	c3                   	ret
+    return -1;
+80107fab:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107fb0:	eb f2                	jmp    80107fa4 <argfd+0x44>
+    return -1;
+80107fb2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107fb7:	eb eb                	jmp    80107fa4 <argfd+0x44>
+  return 0;
+80107fb9:	b8 00 00 00 00       	mov    $0x0,%eax
+80107fbe:	eb e4                	jmp    80107fa4 <argfd+0x44>
+
+80107fc0 <fdalloc>:
+
+// Allocate a file descriptor for the given file.
+// Takes over file reference from caller on success.
+static int
+fdalloc(struct file *f)
+{
+80107fc0:	55                   	push   %ebp
+80107fc1:	89 e5                	mov    %esp,%ebp
+80107fc3:	53                   	push   %ebx
+80107fc4:	83 ec 04             	sub    $0x4,%esp
+80107fc7:	89 c3                	mov    %eax,%ebx
+  int fd;
+  struct proc *curproc = myproc();
+80107fc9:	e8 3d dd ff ff       	call   80105d0b <myproc>
+80107fce:	89 c2                	mov    %eax,%edx
+
+  for(fd = 0; fd < NOFILE; fd++){
+80107fd0:	b8 00 00 00 00       	mov    $0x0,%eax
+80107fd5:	83 f8 0f             	cmp    $0xf,%eax
+80107fd8:	7f 12                	jg     80107fec <fdalloc+0x2c>
+    if(curproc->ofile[fd] == 0){
+80107fda:	83 7c 82 28 00       	cmpl   $0x0,0x28(%edx,%eax,4)
+80107fdf:	74 05                	je     80107fe6 <fdalloc+0x26>
+  for(fd = 0; fd < NOFILE; fd++){
+80107fe1:	83 c0 01             	add    $0x1,%eax
+80107fe4:	eb ef                	jmp    80107fd5 <fdalloc+0x15>
+      curproc->ofile[fd] = f;
+80107fe6:	89 5c 82 28          	mov    %ebx,0x28(%edx,%eax,4)
+      return fd;
+80107fea:	eb 05                	jmp    80107ff1 <fdalloc+0x31>
+    }
+  }
+  return -1;
+80107fec:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80107ff1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107ff4:	c9                   	leave
+80107ff5:	c3                   	ret
+
+80107ff6 <isdirempty>:
+}
+
+// Is the directory dp empty except for "." and ".." ?
+static int
+isdirempty(struct inode *dp)
+{
+80107ff6:	55                   	push   %ebp
+80107ff7:	89 e5                	mov    %esp,%ebp
+80107ff9:	56                   	push   %esi
+80107ffa:	53                   	push   %ebx
+80107ffb:	83 ec 10             	sub    $0x10,%esp
+80107ffe:	89 c3                	mov    %eax,%ebx
+  int off;
+  struct dirent de;
+
+  for(off=2*sizeof(de); off<dp->size; off+=sizeof(de)){
+80108000:	b8 20 00 00 00       	mov    $0x20,%eax
+80108005:	89 c6                	mov    %eax,%esi
+80108007:	3b 43 58             	cmp    0x58(%ebx),%eax
+8010800a:	73 2e                	jae    8010803a <isdirempty+0x44>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+8010800c:	6a 10                	push   $0x10
+8010800e:	50                   	push   %eax
+8010800f:	8d 45 e8             	lea    -0x18(%ebp),%eax
+80108012:	50                   	push   %eax
+80108013:	53                   	push   %ebx
+80108014:	e8 3e a3 ff ff       	call   80102357 <readi>
+80108019:	83 c4 10             	add    $0x10,%esp
+8010801c:	83 f8 10             	cmp    $0x10,%eax
+8010801f:	75 0c                	jne    8010802d <isdirempty+0x37>
+      panic("isdirempty: readi");
+    if(de.inum != 0)
+80108021:	66 83 7d e8 00       	cmpw   $0x0,-0x18(%ebp)
+80108026:	75 1e                	jne    80108046 <isdirempty+0x50>
+  for(off=2*sizeof(de); off<dp->size; off+=sizeof(de)){
+80108028:	8d 46 10             	lea    0x10(%esi),%eax
+8010802b:	eb d8                	jmp    80108005 <isdirempty+0xf>
+      panic("isdirempty: readi");
+8010802d:	83 ec 0c             	sub    $0xc,%esp
+80108030:	68 40 c2 10 80       	push   $0x8010c240
+80108035:	e8 f1 8c ff ff       	call   80100d2b <panic>
+      return 0;
+  }
+  return 1;
+8010803a:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+8010803f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108042:	5b                   	pop    %ebx
+80108043:	5e                   	pop    %esi
+80108044:	5d                   	pop    %ebp
+80108045:	c3                   	ret
+      return 0;
+80108046:	b8 00 00 00 00       	mov    $0x0,%eax
+8010804b:	eb f2                	jmp    8010803f <isdirempty+0x49>
+
+8010804d <create>:
+  return -1;
+}
+
+static struct inode*
+create(char *path, short type, short major, short minor)
+{
+8010804d:	55                   	push   %ebp
+8010804e:	89 e5                	mov    %esp,%ebp
+80108050:	57                   	push   %edi
+80108051:	56                   	push   %esi
+80108052:	53                   	push   %ebx
+80108053:	83 ec 44             	sub    $0x44,%esp
+80108056:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+80108059:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+8010805c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  uint off;
+  struct inode *ip, *dp;
+  char name[DIRSIZ];
+
+  if((dp = nameiparent(path, name)) == 0)
+8010805f:	8d 55 d6             	lea    -0x2a(%ebp),%edx
+80108062:	52                   	push   %edx
+80108063:	50                   	push   %eax
+80108064:	e8 a1 a7 ff ff       	call   8010280a <nameiparent>
+80108069:	89 c6                	mov    %eax,%esi
+8010806b:	83 c4 10             	add    $0x10,%esp
+8010806e:	85 c0                	test   %eax,%eax
+80108070:	0f 84 35 01 00 00    	je     801081ab <create+0x15e>
+    return 0;
+  ilock(dp);
+80108076:	83 ec 0c             	sub    $0xc,%esp
+80108079:	50                   	push   %eax
+8010807a:	e8 e2 9f ff ff       	call   80102061 <ilock>
+
+  if((ip = dirlookup(dp, name, &off)) != 0){
+8010807f:	83 c4 0c             	add    $0xc,%esp
+80108082:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80108085:	50                   	push   %eax
+80108086:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+80108089:	50                   	push   %eax
+8010808a:	56                   	push   %esi
+8010808b:	e8 34 a5 ff ff       	call   801025c4 <dirlookup>
+80108090:	89 c3                	mov    %eax,%ebx
+80108092:	83 c4 10             	add    $0x10,%esp
+80108095:	85 c0                	test   %eax,%eax
+80108097:	74 3d                	je     801080d6 <create+0x89>
+    iunlockput(dp);
+80108099:	83 ec 0c             	sub    $0xc,%esp
+8010809c:	56                   	push   %esi
+8010809d:	e8 66 a1 ff ff       	call   80102208 <iunlockput>
+    ilock(ip);
+801080a2:	89 1c 24             	mov    %ebx,(%esp)
+801080a5:	e8 b7 9f ff ff       	call   80102061 <ilock>
+    if(type == T_FILE && ip->type == T_FILE)
+801080aa:	83 c4 10             	add    $0x10,%esp
+801080ad:	66 83 7d c4 02       	cmpw   $0x2,-0x3c(%ebp)
+801080b2:	75 07                	jne    801080bb <create+0x6e>
+801080b4:	66 83 7b 50 02       	cmpw   $0x2,0x50(%ebx)
+801080b9:	74 11                	je     801080cc <create+0x7f>
+      return ip;
+    iunlockput(ip);
+801080bb:	83 ec 0c             	sub    $0xc,%esp
+801080be:	53                   	push   %ebx
+801080bf:	e8 44 a1 ff ff       	call   80102208 <iunlockput>
+    return 0;
+801080c4:	83 c4 10             	add    $0x10,%esp
+801080c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    panic("create: dirlink");
+
+  iunlockput(dp);
+
+  return ip;
+}
+801080cc:	89 d8                	mov    %ebx,%eax
+801080ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801080d1:	5b                   	pop    %ebx
+801080d2:	5e                   	pop    %esi
+801080d3:	5f                   	pop    %edi
+801080d4:	5d                   	pop    %ebp
+801080d5:	c3                   	ret
+  if((ip = ialloc(dp->dev, type)) == 0)
+801080d6:	83 ec 08             	sub    $0x8,%esp
+801080d9:	0f bf 45 c4          	movswl -0x3c(%ebp),%eax
+801080dd:	50                   	push   %eax
+801080de:	ff 36                	push   (%esi)
+801080e0:	e8 71 9d ff ff       	call   80101e56 <ialloc>
+801080e5:	89 c3                	mov    %eax,%ebx
+801080e7:	83 c4 10             	add    $0x10,%esp
+801080ea:	85 c0                	test   %eax,%eax
+801080ec:	74 52                	je     80108140 <create+0xf3>
+  ilock(ip);
+801080ee:	83 ec 0c             	sub    $0xc,%esp
+801080f1:	50                   	push   %eax
+801080f2:	e8 6a 9f ff ff       	call   80102061 <ilock>
+  ip->major = major;
+801080f7:	0f b7 45 c0          	movzwl -0x40(%ebp),%eax
+801080fb:	66 89 43 52          	mov    %ax,0x52(%ebx)
+  ip->minor = minor;
+801080ff:	66 89 7b 54          	mov    %di,0x54(%ebx)
+  ip->nlink = 1;
+80108103:	66 c7 43 56 01 00    	movw   $0x1,0x56(%ebx)
+  iupdate(ip);
+80108109:	89 1c 24             	mov    %ebx,(%esp)
+8010810c:	e8 e7 9d ff ff       	call   80101ef8 <iupdate>
+  if(type == T_DIR){  // Create . and .. entries.
+80108111:	83 c4 10             	add    $0x10,%esp
+80108114:	66 83 7d c4 01       	cmpw   $0x1,-0x3c(%ebp)
+80108119:	74 32                	je     8010814d <create+0x100>
+  if(dirlink(dp, name, ip->inum) < 0)
+8010811b:	83 ec 04             	sub    $0x4,%esp
+8010811e:	ff 73 04             	push   0x4(%ebx)
+80108121:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+80108124:	50                   	push   %eax
+80108125:	56                   	push   %esi
+80108126:	e8 16 a6 ff ff       	call   80102741 <dirlink>
+8010812b:	83 c4 10             	add    $0x10,%esp
+8010812e:	85 c0                	test   %eax,%eax
+80108130:	78 6c                	js     8010819e <create+0x151>
+  iunlockput(dp);
+80108132:	83 ec 0c             	sub    $0xc,%esp
+80108135:	56                   	push   %esi
+80108136:	e8 cd a0 ff ff       	call   80102208 <iunlockput>
+  return ip;
+8010813b:	83 c4 10             	add    $0x10,%esp
+8010813e:	eb 8c                	jmp    801080cc <create+0x7f>
+    panic("create: ialloc");
+80108140:	83 ec 0c             	sub    $0xc,%esp
+80108143:	68 52 c2 10 80       	push   $0x8010c252
+80108148:	e8 de 8b ff ff       	call   80100d2b <panic>
+    dp->nlink++;  // for ".."
+8010814d:	0f b7 46 56          	movzwl 0x56(%esi),%eax
+80108151:	83 c0 01             	add    $0x1,%eax
+80108154:	66 89 46 56          	mov    %ax,0x56(%esi)
+    iupdate(dp);
+80108158:	83 ec 0c             	sub    $0xc,%esp
+8010815b:	56                   	push   %esi
+8010815c:	e8 97 9d ff ff       	call   80101ef8 <iupdate>
+    if(dirlink(ip, ".", ip->inum) < 0 || dirlink(ip, "..", dp->inum) < 0)
+80108161:	83 c4 0c             	add    $0xc,%esp
+80108164:	ff 73 04             	push   0x4(%ebx)
+80108167:	68 62 c2 10 80       	push   $0x8010c262
+8010816c:	53                   	push   %ebx
+8010816d:	e8 cf a5 ff ff       	call   80102741 <dirlink>
+80108172:	83 c4 10             	add    $0x10,%esp
+80108175:	85 c0                	test   %eax,%eax
+80108177:	78 18                	js     80108191 <create+0x144>
+80108179:	83 ec 04             	sub    $0x4,%esp
+8010817c:	ff 76 04             	push   0x4(%esi)
+8010817f:	68 61 c2 10 80       	push   $0x8010c261
+80108184:	53                   	push   %ebx
+80108185:	e8 b7 a5 ff ff       	call   80102741 <dirlink>
+8010818a:	83 c4 10             	add    $0x10,%esp
+8010818d:	85 c0                	test   %eax,%eax
+8010818f:	79 8a                	jns    8010811b <create+0xce>
+      panic("create dots");
+80108191:	83 ec 0c             	sub    $0xc,%esp
+80108194:	68 64 c2 10 80       	push   $0x8010c264
+80108199:	e8 8d 8b ff ff       	call   80100d2b <panic>
+    panic("create: dirlink");
+8010819e:	83 ec 0c             	sub    $0xc,%esp
+801081a1:	68 70 c2 10 80       	push   $0x8010c270
+801081a6:	e8 80 8b ff ff       	call   80100d2b <panic>
+    return 0;
+801081ab:	89 c3                	mov    %eax,%ebx
+801081ad:	e9 1a ff ff ff       	jmp    801080cc <create+0x7f>
+
+801081b2 <argargv>:
+
+// Fetch the nth system call argument as a user argv array
+// of at most MAXARG strings, terminated by a null pointer.
+static int
+argargv(int n, char **argv)
+{
+801081b2:	55                   	push   %ebp
+801081b3:	89 e5                	mov    %esp,%ebp
+801081b5:	56                   	push   %esi
+801081b6:	53                   	push   %ebx
+801081b7:	83 ec 18             	sub    $0x18,%esp
+801081ba:	89 d6                	mov    %edx,%esi
+  int i;
+  uint uargv, uarg;
+
+  if(argint(n, (int*)&uargv) < 0)
+801081bc:	8d 55 f4             	lea    -0xc(%ebp),%edx
+801081bf:	52                   	push   %edx
+801081c0:	50                   	push   %eax
+801081c1:	e8 2d fc ff ff       	call   80107df3 <argint>
+801081c6:	83 c4 10             	add    $0x10,%esp
+801081c9:	85 c0                	test   %eax,%eax
+801081cb:	78 60                	js     8010822d <argargv+0x7b>
+    return -1;
+  memset(argv, 0, MAXARG*sizeof(argv[0]));
+801081cd:	83 ec 04             	sub    $0x4,%esp
+801081d0:	68 80 00 00 00       	push   $0x80
+801081d5:	6a 00                	push   $0x0
+801081d7:	56                   	push   %esi
+801081d8:	e8 61 f9 ff ff       	call   80107b3e <memset>
+801081dd:	83 c4 10             	add    $0x10,%esp
+  for(i=0;; i++){
+801081e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if(i >= MAXARG)
+801081e5:	83 fb 1f             	cmp    $0x1f,%ebx
+801081e8:	7f 4a                	jg     80108234 <argargv+0x82>
+      return -1;
+    if(fetchint(uargv+4*i, (int*)&uarg) < 0)
+801081ea:	83 ec 08             	sub    $0x8,%esp
+801081ed:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801081f0:	50                   	push   %eax
+801081f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+801081f4:	8d 04 98             	lea    (%eax,%ebx,4),%eax
+801081f7:	50                   	push   %eax
+801081f8:	e8 17 fb ff ff       	call   80107d14 <fetchint>
+801081fd:	83 c4 10             	add    $0x10,%esp
+80108200:	85 c0                	test   %eax,%eax
+80108202:	78 3c                	js     80108240 <argargv+0x8e>
+      return -1;
+    if(uarg == 0){
+80108204:	8b 45 f0             	mov    -0x10(%ebp),%eax
+80108207:	85 c0                	test   %eax,%eax
+80108209:	74 19                	je     80108224 <argargv+0x72>
+      argv[i] = 0;
+      break;
+    }
+    if(fetchstr(uarg, &argv[i]) < 0)
+8010820b:	83 ec 08             	sub    $0x8,%esp
+8010820e:	8d 14 9e             	lea    (%esi,%ebx,4),%edx
+80108211:	52                   	push   %edx
+80108212:	50                   	push   %eax
+80108213:	e8 69 fb ff ff       	call   80107d81 <fetchstr>
+80108218:	83 c4 10             	add    $0x10,%esp
+8010821b:	85 c0                	test   %eax,%eax
+8010821d:	78 28                	js     80108247 <argargv+0x95>
+  for(i=0;; i++){
+8010821f:	83 c3 01             	add    $0x1,%ebx
+    if(i >= MAXARG)
+80108222:	eb c1                	jmp    801081e5 <argargv+0x33>
+      argv[i] = 0;
+80108224:	c7 04 9e 00 00 00 00 	movl   $0x0,(%esi,%ebx,4)
+      return -1;
+  }
+  return 0;
+8010822b:	eb 0c                	jmp    80108239 <argargv+0x87>
+    return -1;
+8010822d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108232:	eb 05                	jmp    80108239 <argargv+0x87>
+      return -1;
+80108234:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108239:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010823c:	5b                   	pop    %ebx
+8010823d:	5e                   	pop    %esi
+8010823e:	5d                   	pop    %ebp
+8010823f:	c3                   	ret
+      return -1;
+80108240:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108245:	eb f2                	jmp    80108239 <argargv+0x87>
+      return -1;
+80108247:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010824c:	eb eb                	jmp    80108239 <argargv+0x87>
+
+8010824e <sys_dup>:
+{
+8010824e:	55                   	push   %ebp
+8010824f:	89 e5                	mov    %esp,%ebp
+80108251:	53                   	push   %ebx
+80108252:	83 ec 14             	sub    $0x14,%esp
+  if(argfd(0, 0, &f) < 0)
+80108255:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+80108258:	ba 00 00 00 00       	mov    $0x0,%edx
+8010825d:	b8 00 00 00 00       	mov    $0x0,%eax
+80108262:	e8 f9 fc ff ff       	call   80107f60 <argfd>
+80108267:	85 c0                	test   %eax,%eax
+80108269:	78 23                	js     8010828e <sys_dup+0x40>
+  if((fd=fdalloc(f)) < 0)
+8010826b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+8010826e:	e8 4d fd ff ff       	call   80107fc0 <fdalloc>
+80108273:	89 c3                	mov    %eax,%ebx
+80108275:	85 c0                	test   %eax,%eax
+80108277:	78 1c                	js     80108295 <sys_dup+0x47>
+  filedup(f);
+80108279:	83 ec 0c             	sub    $0xc,%esp
+8010827c:	ff 75 f4             	push   -0xc(%ebp)
+8010827f:	e8 ac 94 ff ff       	call   80101730 <filedup>
+  return fd;
+80108284:	83 c4 10             	add    $0x10,%esp
+}
+80108287:	89 d8                	mov    %ebx,%eax
+80108289:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010828c:	c9                   	leave
+8010828d:	c3                   	ret
+    return -1;
+8010828e:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80108293:	eb f2                	jmp    80108287 <sys_dup+0x39>
+    return -1;
+80108295:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+8010829a:	eb eb                	jmp    80108287 <sys_dup+0x39>
+
+8010829c <sys_read>:
+{
+8010829c:	55                   	push   %ebp
+8010829d:	89 e5                	mov    %esp,%ebp
+8010829f:	83 ec 18             	sub    $0x18,%esp
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptrw(1, &p, n) < 0)
+801082a2:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+801082a5:	ba 00 00 00 00       	mov    $0x0,%edx
+801082aa:	b8 00 00 00 00       	mov    $0x0,%eax
+801082af:	e8 ac fc ff ff       	call   80107f60 <argfd>
+801082b4:	85 c0                	test   %eax,%eax
+801082b6:	78 43                	js     801082fb <sys_read+0x5f>
+801082b8:	83 ec 08             	sub    $0x8,%esp
+801082bb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801082be:	50                   	push   %eax
+801082bf:	6a 02                	push   $0x2
+801082c1:	e8 2d fb ff ff       	call   80107df3 <argint>
+801082c6:	83 c4 10             	add    $0x10,%esp
+801082c9:	85 c0                	test   %eax,%eax
+801082cb:	78 2e                	js     801082fb <sys_read+0x5f>
+801082cd:	83 ec 04             	sub    $0x4,%esp
+801082d0:	ff 75 f0             	push   -0x10(%ebp)
+801082d3:	8d 45 ec             	lea    -0x14(%ebp),%eax
+801082d6:	50                   	push   %eax
+801082d7:	6a 01                	push   $0x1
+801082d9:	e8 e0 fb ff ff       	call   80107ebe <argptrw>
+801082de:	83 c4 10             	add    $0x10,%esp
+801082e1:	85 c0                	test   %eax,%eax
+801082e3:	78 16                	js     801082fb <sys_read+0x5f>
+  return fileread(f, p, n);
+801082e5:	83 ec 04             	sub    $0x4,%esp
+801082e8:	ff 75 f0             	push   -0x10(%ebp)
+801082eb:	ff 75 ec             	push   -0x14(%ebp)
+801082ee:	ff 75 f4             	push   -0xc(%ebp)
+801082f1:	e8 a3 95 ff ff       	call   80101899 <fileread>
+801082f6:	83 c4 10             	add    $0x10,%esp
+}
+801082f9:	c9                   	leave
+801082fa:	c3                   	ret
+    return -1;
+801082fb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108300:	eb f7                	jmp    801082f9 <sys_read+0x5d>
+
+80108302 <sys_write>:
+{
+80108302:	55                   	push   %ebp
+80108303:	89 e5                	mov    %esp,%ebp
+80108305:	83 ec 18             	sub    $0x18,%esp
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+80108308:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+8010830b:	ba 00 00 00 00       	mov    $0x0,%edx
+80108310:	b8 00 00 00 00       	mov    $0x0,%eax
+80108315:	e8 46 fc ff ff       	call   80107f60 <argfd>
+8010831a:	85 c0                	test   %eax,%eax
+8010831c:	78 43                	js     80108361 <sys_write+0x5f>
+8010831e:	83 ec 08             	sub    $0x8,%esp
+80108321:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108324:	50                   	push   %eax
+80108325:	6a 02                	push   $0x2
+80108327:	e8 c7 fa ff ff       	call   80107df3 <argint>
+8010832c:	83 c4 10             	add    $0x10,%esp
+8010832f:	85 c0                	test   %eax,%eax
+80108331:	78 2e                	js     80108361 <sys_write+0x5f>
+80108333:	83 ec 04             	sub    $0x4,%esp
+80108336:	ff 75 f0             	push   -0x10(%ebp)
+80108339:	8d 45 ec             	lea    -0x14(%ebp),%eax
+8010833c:	50                   	push   %eax
+8010833d:	6a 01                	push   $0x1
+8010833f:	e8 62 fb ff ff       	call   80107ea6 <argptr>
+80108344:	83 c4 10             	add    $0x10,%esp
+80108347:	85 c0                	test   %eax,%eax
+80108349:	78 16                	js     80108361 <sys_write+0x5f>
+  return filewrite(f, p, n);
+8010834b:	83 ec 04             	sub    $0x4,%esp
+8010834e:	ff 75 f0             	push   -0x10(%ebp)
+80108351:	ff 75 ec             	push   -0x14(%ebp)
+80108354:	ff 75 f4             	push   -0xc(%ebp)
+80108357:	e8 c2 95 ff ff       	call   8010191e <filewrite>
+8010835c:	83 c4 10             	add    $0x10,%esp
+}
+8010835f:	c9                   	leave
+80108360:	c3                   	ret
+    return -1;
+80108361:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108366:	eb f7                	jmp    8010835f <sys_write+0x5d>
+
+80108368 <sys_close>:
+{
+80108368:	55                   	push   %ebp
+80108369:	89 e5                	mov    %esp,%ebp
+8010836b:	83 ec 18             	sub    $0x18,%esp
+  if(argfd(0, &fd, &f) < 0)
+8010836e:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+80108371:	8d 55 f4             	lea    -0xc(%ebp),%edx
+80108374:	b8 00 00 00 00       	mov    $0x0,%eax
+80108379:	e8 e2 fb ff ff       	call   80107f60 <argfd>
+8010837e:	85 c0                	test   %eax,%eax
+80108380:	78 25                	js     801083a7 <sys_close+0x3f>
+  myproc()->ofile[fd] = 0;
+80108382:	e8 84 d9 ff ff       	call   80105d0b <myproc>
+80108387:	8b 55 f4             	mov    -0xc(%ebp),%edx
+8010838a:	c7 44 90 28 00 00 00 	movl   $0x0,0x28(%eax,%edx,4)
+80108391:	00 
+  fileclose(f);
+80108392:	83 ec 0c             	sub    $0xc,%esp
+80108395:	ff 75 f0             	push   -0x10(%ebp)
+80108398:	e8 d8 93 ff ff       	call   80101775 <fileclose>
+  return 0;
+8010839d:	83 c4 10             	add    $0x10,%esp
+801083a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+801083a5:	c9                   	leave
+801083a6:	c3                   	ret
+    return -1;
+801083a7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801083ac:	eb f7                	jmp    801083a5 <sys_close+0x3d>
+
+801083ae <sys_fstat>:
+{
+801083ae:	55                   	push   %ebp
+801083af:	89 e5                	mov    %esp,%ebp
+801083b1:	83 ec 18             	sub    $0x18,%esp
+  if(argfd(0, 0, &f) < 0 || argptrw(1, (void*)&st, sizeof(*st)) < 0)
+801083b4:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+801083b7:	ba 00 00 00 00       	mov    $0x0,%edx
+801083bc:	b8 00 00 00 00       	mov    $0x0,%eax
+801083c1:	e8 9a fb ff ff       	call   80107f60 <argfd>
+801083c6:	85 c0                	test   %eax,%eax
+801083c8:	78 2a                	js     801083f4 <sys_fstat+0x46>
+801083ca:	83 ec 04             	sub    $0x4,%esp
+801083cd:	6a 14                	push   $0x14
+801083cf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801083d2:	50                   	push   %eax
+801083d3:	6a 01                	push   $0x1
+801083d5:	e8 e4 fa ff ff       	call   80107ebe <argptrw>
+801083da:	83 c4 10             	add    $0x10,%esp
+801083dd:	85 c0                	test   %eax,%eax
+801083df:	78 13                	js     801083f4 <sys_fstat+0x46>
+  return filestat(f, st);
+801083e1:	83 ec 08             	sub    $0x8,%esp
+801083e4:	ff 75 f0             	push   -0x10(%ebp)
+801083e7:	ff 75 f4             	push   -0xc(%ebp)
+801083ea:	e8 63 94 ff ff       	call   80101852 <filestat>
+801083ef:	83 c4 10             	add    $0x10,%esp
+}
+801083f2:	c9                   	leave
+801083f3:	c3                   	ret
+    return -1;
+801083f4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801083f9:	eb f7                	jmp    801083f2 <sys_fstat+0x44>
+
+801083fb <sys_link>:
+{
+801083fb:	55                   	push   %ebp
+801083fc:	89 e5                	mov    %esp,%ebp
+801083fe:	56                   	push   %esi
+801083ff:	53                   	push   %ebx
+80108400:	83 ec 28             	sub    $0x28,%esp
+  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+80108403:	8d 45 e0             	lea    -0x20(%ebp),%eax
+80108406:	50                   	push   %eax
+80108407:	6a 00                	push   $0x0
+80108409:	e8 c8 fa ff ff       	call   80107ed6 <argstr>
+8010840e:	83 c4 10             	add    $0x10,%esp
+80108411:	85 c0                	test   %eax,%eax
+80108413:	0f 88 d3 00 00 00    	js     801084ec <sys_link+0xf1>
+80108419:	83 ec 08             	sub    $0x8,%esp
+8010841c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+8010841f:	50                   	push   %eax
+80108420:	6a 01                	push   $0x1
+80108422:	e8 af fa ff ff       	call   80107ed6 <argstr>
+80108427:	83 c4 10             	add    $0x10,%esp
+8010842a:	85 c0                	test   %eax,%eax
+8010842c:	0f 88 ba 00 00 00    	js     801084ec <sys_link+0xf1>
+  begin_op();
+80108432:	e8 03 c6 ff ff       	call   80104a3a <begin_op>
+  if((ip = namei(old)) == 0){
+80108437:	83 ec 0c             	sub    $0xc,%esp
+8010843a:	ff 75 e0             	push   -0x20(%ebp)
+8010843d:	e8 b0 a3 ff ff       	call   801027f2 <namei>
+80108442:	89 c3                	mov    %eax,%ebx
+80108444:	83 c4 10             	add    $0x10,%esp
+80108447:	85 c0                	test   %eax,%eax
+80108449:	0f 84 a4 00 00 00    	je     801084f3 <sys_link+0xf8>
+  ilock(ip);
+8010844f:	83 ec 0c             	sub    $0xc,%esp
+80108452:	50                   	push   %eax
+80108453:	e8 09 9c ff ff       	call   80102061 <ilock>
+  if(ip->type == T_DIR){
+80108458:	83 c4 10             	add    $0x10,%esp
+8010845b:	66 83 7b 50 01       	cmpw   $0x1,0x50(%ebx)
+80108460:	0f 84 99 00 00 00    	je     801084ff <sys_link+0x104>
+  ip->nlink++;
+80108466:	0f b7 43 56          	movzwl 0x56(%ebx),%eax
+8010846a:	83 c0 01             	add    $0x1,%eax
+8010846d:	66 89 43 56          	mov    %ax,0x56(%ebx)
+  iupdate(ip);
+80108471:	83 ec 0c             	sub    $0xc,%esp
+80108474:	53                   	push   %ebx
+80108475:	e8 7e 9a ff ff       	call   80101ef8 <iupdate>
+  iunlock(ip);
+8010847a:	89 1c 24             	mov    %ebx,(%esp)
+8010847d:	e8 a1 9c ff ff       	call   80102123 <iunlock>
+  if((dp = nameiparent(new, name)) == 0)
+80108482:	83 c4 08             	add    $0x8,%esp
+80108485:	8d 45 ea             	lea    -0x16(%ebp),%eax
+80108488:	50                   	push   %eax
+80108489:	ff 75 e4             	push   -0x1c(%ebp)
+8010848c:	e8 79 a3 ff ff       	call   8010280a <nameiparent>
+80108491:	89 c6                	mov    %eax,%esi
+80108493:	83 c4 10             	add    $0x10,%esp
+80108496:	85 c0                	test   %eax,%eax
+80108498:	0f 84 85 00 00 00    	je     80108523 <sys_link+0x128>
+  ilock(dp);
+8010849e:	83 ec 0c             	sub    $0xc,%esp
+801084a1:	50                   	push   %eax
+801084a2:	e8 ba 9b ff ff       	call   80102061 <ilock>
+  if(dp->dev != ip->dev || dirlink(dp, name, ip->inum) < 0){
+801084a7:	83 c4 10             	add    $0x10,%esp
+801084aa:	8b 03                	mov    (%ebx),%eax
+801084ac:	39 06                	cmp    %eax,(%esi)
+801084ae:	75 67                	jne    80108517 <sys_link+0x11c>
+801084b0:	83 ec 04             	sub    $0x4,%esp
+801084b3:	ff 73 04             	push   0x4(%ebx)
+801084b6:	8d 45 ea             	lea    -0x16(%ebp),%eax
+801084b9:	50                   	push   %eax
+801084ba:	56                   	push   %esi
+801084bb:	e8 81 a2 ff ff       	call   80102741 <dirlink>
+801084c0:	83 c4 10             	add    $0x10,%esp
+801084c3:	85 c0                	test   %eax,%eax
+801084c5:	78 50                	js     80108517 <sys_link+0x11c>
+  iunlockput(dp);
+801084c7:	83 ec 0c             	sub    $0xc,%esp
+801084ca:	56                   	push   %esi
+801084cb:	e8 38 9d ff ff       	call   80102208 <iunlockput>
+  iput(ip);
+801084d0:	89 1c 24             	mov    %ebx,(%esp)
+801084d3:	e8 90 9c ff ff       	call   80102168 <iput>
+  end_op();
+801084d8:	e8 f1 c5 ff ff       	call   80104ace <end_op>
+  return 0;
+801084dd:	83 c4 10             	add    $0x10,%esp
+801084e0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+801084e5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801084e8:	5b                   	pop    %ebx
+801084e9:	5e                   	pop    %esi
+801084ea:	5d                   	pop    %ebp
+801084eb:	c3                   	ret
+    return -1;
+801084ec:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801084f1:	eb f2                	jmp    801084e5 <sys_link+0xea>
+    end_op();
+801084f3:	e8 d6 c5 ff ff       	call   80104ace <end_op>
+    return -1;
+801084f8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801084fd:	eb e6                	jmp    801084e5 <sys_link+0xea>
+    iunlockput(ip);
+801084ff:	83 ec 0c             	sub    $0xc,%esp
+80108502:	53                   	push   %ebx
+80108503:	e8 00 9d ff ff       	call   80102208 <iunlockput>
+    end_op();
+80108508:	e8 c1 c5 ff ff       	call   80104ace <end_op>
+    return -1;
+8010850d:	83 c4 10             	add    $0x10,%esp
+80108510:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108515:	eb ce                	jmp    801084e5 <sys_link+0xea>
+    iunlockput(dp);
+80108517:	83 ec 0c             	sub    $0xc,%esp
+8010851a:	56                   	push   %esi
+8010851b:	e8 e8 9c ff ff       	call   80102208 <iunlockput>
+    goto bad;
+80108520:	83 c4 10             	add    $0x10,%esp
+  ilock(ip);
+80108523:	83 ec 0c             	sub    $0xc,%esp
+80108526:	53                   	push   %ebx
+80108527:	e8 35 9b ff ff       	call   80102061 <ilock>
+  ip->nlink--;
+8010852c:	0f b7 43 56          	movzwl 0x56(%ebx),%eax
+80108530:	83 e8 01             	sub    $0x1,%eax
+80108533:	66 89 43 56          	mov    %ax,0x56(%ebx)
+  iupdate(ip);
+80108537:	89 1c 24             	mov    %ebx,(%esp)
+8010853a:	e8 b9 99 ff ff       	call   80101ef8 <iupdate>
+  iunlockput(ip);
+8010853f:	89 1c 24             	mov    %ebx,(%esp)
+80108542:	e8 c1 9c ff ff       	call   80102208 <iunlockput>
+  end_op();
+80108547:	e8 82 c5 ff ff       	call   80104ace <end_op>
+  return -1;
+8010854c:	83 c4 10             	add    $0x10,%esp
+8010854f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108554:	eb 8f                	jmp    801084e5 <sys_link+0xea>
+
+80108556 <sys_unlink>:
+{
+80108556:	55                   	push   %ebp
+80108557:	89 e5                	mov    %esp,%ebp
+80108559:	57                   	push   %edi
+8010855a:	56                   	push   %esi
+8010855b:	53                   	push   %ebx
+8010855c:	83 ec 44             	sub    $0x44,%esp
+  if(argstr(0, &path) < 0)
+8010855f:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+80108562:	50                   	push   %eax
+80108563:	6a 00                	push   $0x0
+80108565:	e8 6c f9 ff ff       	call   80107ed6 <argstr>
+8010856a:	83 c4 10             	add    $0x10,%esp
+8010856d:	85 c0                	test   %eax,%eax
+8010856f:	0f 88 83 01 00 00    	js     801086f8 <sys_unlink+0x1a2>
+  begin_op();
+80108575:	e8 c0 c4 ff ff       	call   80104a3a <begin_op>
+  if((dp = nameiparent(path, name)) == 0){
+8010857a:	83 ec 08             	sub    $0x8,%esp
+8010857d:	8d 45 ca             	lea    -0x36(%ebp),%eax
+80108580:	50                   	push   %eax
+80108581:	ff 75 c4             	push   -0x3c(%ebp)
+80108584:	e8 81 a2 ff ff       	call   8010280a <nameiparent>
+80108589:	89 c6                	mov    %eax,%esi
+8010858b:	83 c4 10             	add    $0x10,%esp
+8010858e:	85 c0                	test   %eax,%eax
+80108590:	0f 84 ed 00 00 00    	je     80108683 <sys_unlink+0x12d>
+  ilock(dp);
+80108596:	83 ec 0c             	sub    $0xc,%esp
+80108599:	50                   	push   %eax
+8010859a:	e8 c2 9a ff ff       	call   80102061 <ilock>
+  if(namecmp(name, ".") == 0 || namecmp(name, "..") == 0)
+8010859f:	83 c4 08             	add    $0x8,%esp
+801085a2:	68 62 c2 10 80       	push   $0x8010c262
+801085a7:	8d 45 ca             	lea    -0x36(%ebp),%eax
+801085aa:	50                   	push   %eax
+801085ab:	e8 ff 9f ff ff       	call   801025af <namecmp>
+801085b0:	83 c4 10             	add    $0x10,%esp
+801085b3:	85 c0                	test   %eax,%eax
+801085b5:	0f 84 fc 00 00 00    	je     801086b7 <sys_unlink+0x161>
+801085bb:	83 ec 08             	sub    $0x8,%esp
+801085be:	68 61 c2 10 80       	push   $0x8010c261
+801085c3:	8d 45 ca             	lea    -0x36(%ebp),%eax
+801085c6:	50                   	push   %eax
+801085c7:	e8 e3 9f ff ff       	call   801025af <namecmp>
+801085cc:	83 c4 10             	add    $0x10,%esp
+801085cf:	85 c0                	test   %eax,%eax
+801085d1:	0f 84 e0 00 00 00    	je     801086b7 <sys_unlink+0x161>
+  if((ip = dirlookup(dp, name, &off)) == 0)
+801085d7:	83 ec 04             	sub    $0x4,%esp
+801085da:	8d 45 c0             	lea    -0x40(%ebp),%eax
+801085dd:	50                   	push   %eax
+801085de:	8d 45 ca             	lea    -0x36(%ebp),%eax
+801085e1:	50                   	push   %eax
+801085e2:	56                   	push   %esi
+801085e3:	e8 dc 9f ff ff       	call   801025c4 <dirlookup>
+801085e8:	89 c3                	mov    %eax,%ebx
+801085ea:	83 c4 10             	add    $0x10,%esp
+801085ed:	85 c0                	test   %eax,%eax
+801085ef:	0f 84 c2 00 00 00    	je     801086b7 <sys_unlink+0x161>
+  ilock(ip);
+801085f5:	83 ec 0c             	sub    $0xc,%esp
+801085f8:	50                   	push   %eax
+801085f9:	e8 63 9a ff ff       	call   80102061 <ilock>
+  if(ip->nlink < 1)
+801085fe:	83 c4 10             	add    $0x10,%esp
+80108601:	66 83 7b 56 00       	cmpw   $0x0,0x56(%ebx)
+80108606:	0f 8e 83 00 00 00    	jle    8010868f <sys_unlink+0x139>
+  if(ip->type == T_DIR && !isdirempty(ip)){
+8010860c:	66 83 7b 50 01       	cmpw   $0x1,0x50(%ebx)
+80108611:	0f 84 85 00 00 00    	je     8010869c <sys_unlink+0x146>
+  memset(&de, 0, sizeof(de));
+80108617:	83 ec 04             	sub    $0x4,%esp
+8010861a:	6a 10                	push   $0x10
+8010861c:	6a 00                	push   $0x0
+8010861e:	8d 7d d8             	lea    -0x28(%ebp),%edi
+80108621:	57                   	push   %edi
+80108622:	e8 17 f5 ff ff       	call   80107b3e <memset>
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80108627:	6a 10                	push   $0x10
+80108629:	ff 75 c0             	push   -0x40(%ebp)
+8010862c:	57                   	push   %edi
+8010862d:	56                   	push   %esi
+8010862e:	e8 40 9e ff ff       	call   80102473 <writei>
+80108633:	83 c4 20             	add    $0x20,%esp
+80108636:	83 f8 10             	cmp    $0x10,%eax
+80108639:	0f 85 90 00 00 00    	jne    801086cf <sys_unlink+0x179>
+  if(ip->type == T_DIR){
+8010863f:	66 83 7b 50 01       	cmpw   $0x1,0x50(%ebx)
+80108644:	0f 84 92 00 00 00    	je     801086dc <sys_unlink+0x186>
+  iunlockput(dp);
+8010864a:	83 ec 0c             	sub    $0xc,%esp
+8010864d:	56                   	push   %esi
+8010864e:	e8 b5 9b ff ff       	call   80102208 <iunlockput>
+  ip->nlink--;
+80108653:	0f b7 43 56          	movzwl 0x56(%ebx),%eax
+80108657:	83 e8 01             	sub    $0x1,%eax
+8010865a:	66 89 43 56          	mov    %ax,0x56(%ebx)
+  iupdate(ip);
+8010865e:	89 1c 24             	mov    %ebx,(%esp)
+80108661:	e8 92 98 ff ff       	call   80101ef8 <iupdate>
+  iunlockput(ip);
+80108666:	89 1c 24             	mov    %ebx,(%esp)
+80108669:	e8 9a 9b ff ff       	call   80102208 <iunlockput>
+  end_op();
+8010866e:	e8 5b c4 ff ff       	call   80104ace <end_op>
+  return 0;
+80108673:	83 c4 10             	add    $0x10,%esp
+80108676:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010867b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010867e:	5b                   	pop    %ebx
+8010867f:	5e                   	pop    %esi
+80108680:	5f                   	pop    %edi
+80108681:	5d                   	pop    %ebp
+80108682:	c3                   	ret
+    end_op();
+80108683:	e8 46 c4 ff ff       	call   80104ace <end_op>
+    return -1;
+80108688:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010868d:	eb ec                	jmp    8010867b <sys_unlink+0x125>
+    panic("unlink: nlink < 1");
+8010868f:	83 ec 0c             	sub    $0xc,%esp
+80108692:	68 80 c2 10 80       	push   $0x8010c280
+80108697:	e8 8f 86 ff ff       	call   80100d2b <panic>
+  if(ip->type == T_DIR && !isdirempty(ip)){
+8010869c:	89 d8                	mov    %ebx,%eax
+8010869e:	e8 53 f9 ff ff       	call   80107ff6 <isdirempty>
+801086a3:	85 c0                	test   %eax,%eax
+801086a5:	0f 85 6c ff ff ff    	jne    80108617 <sys_unlink+0xc1>
+    iunlockput(ip);
+801086ab:	83 ec 0c             	sub    $0xc,%esp
+801086ae:	53                   	push   %ebx
+801086af:	e8 54 9b ff ff       	call   80102208 <iunlockput>
+    goto bad;
+801086b4:	83 c4 10             	add    $0x10,%esp
+  iunlockput(dp);
+801086b7:	83 ec 0c             	sub    $0xc,%esp
+801086ba:	56                   	push   %esi
+801086bb:	e8 48 9b ff ff       	call   80102208 <iunlockput>
+  end_op();
+801086c0:	e8 09 c4 ff ff       	call   80104ace <end_op>
+  return -1;
+801086c5:	83 c4 10             	add    $0x10,%esp
+801086c8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801086cd:	eb ac                	jmp    8010867b <sys_unlink+0x125>
+    panic("unlink: writei");
+801086cf:	83 ec 0c             	sub    $0xc,%esp
+801086d2:	68 92 c2 10 80       	push   $0x8010c292
+801086d7:	e8 4f 86 ff ff       	call   80100d2b <panic>
+    dp->nlink--;
+801086dc:	0f b7 46 56          	movzwl 0x56(%esi),%eax
+801086e0:	83 e8 01             	sub    $0x1,%eax
+801086e3:	66 89 46 56          	mov    %ax,0x56(%esi)
+    iupdate(dp);
+801086e7:	83 ec 0c             	sub    $0xc,%esp
+801086ea:	56                   	push   %esi
+801086eb:	e8 08 98 ff ff       	call   80101ef8 <iupdate>
+801086f0:	83 c4 10             	add    $0x10,%esp
+801086f3:	e9 52 ff ff ff       	jmp    8010864a <sys_unlink+0xf4>
+    return -1;
+801086f8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801086fd:	e9 79 ff ff ff       	jmp    8010867b <sys_unlink+0x125>
+
+80108702 <sys_open>:
+{
+80108702:	55                   	push   %ebp
+80108703:	89 e5                	mov    %esp,%ebp
+80108705:	57                   	push   %edi
+80108706:	56                   	push   %esi
+80108707:	53                   	push   %ebx
+80108708:	83 ec 24             	sub    $0x24,%esp
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+8010870b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+8010870e:	50                   	push   %eax
+8010870f:	6a 00                	push   $0x0
+80108711:	e8 c0 f7 ff ff       	call   80107ed6 <argstr>
+80108716:	83 c4 10             	add    $0x10,%esp
+80108719:	85 c0                	test   %eax,%eax
+8010871b:	0f 88 a0 00 00 00    	js     801087c1 <sys_open+0xbf>
+80108721:	83 ec 08             	sub    $0x8,%esp
+80108724:	8d 45 e0             	lea    -0x20(%ebp),%eax
+80108727:	50                   	push   %eax
+80108728:	6a 01                	push   $0x1
+8010872a:	e8 c4 f6 ff ff       	call   80107df3 <argint>
+8010872f:	83 c4 10             	add    $0x10,%esp
+80108732:	85 c0                	test   %eax,%eax
+80108734:	0f 88 87 00 00 00    	js     801087c1 <sys_open+0xbf>
+  begin_op();
+8010873a:	e8 fb c2 ff ff       	call   80104a3a <begin_op>
+  if(omode & O_CREATE){
+8010873f:	f6 45 e1 02          	testb  $0x2,-0x1f(%ebp)
+80108743:	0f 84 8b 00 00 00    	je     801087d4 <sys_open+0xd2>
+    ip = create(path, T_FILE, 0, 0);
+80108749:	83 ec 0c             	sub    $0xc,%esp
+8010874c:	6a 00                	push   $0x0
+8010874e:	b9 00 00 00 00       	mov    $0x0,%ecx
+80108753:	ba 02 00 00 00       	mov    $0x2,%edx
+80108758:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010875b:	e8 ed f8 ff ff       	call   8010804d <create>
+80108760:	89 c6                	mov    %eax,%esi
+    if(ip == 0){
+80108762:	83 c4 10             	add    $0x10,%esp
+80108765:	85 c0                	test   %eax,%eax
+80108767:	74 5f                	je     801087c8 <sys_open+0xc6>
+  if((f = filealloc()) == 0 || (fd = fdalloc(f)) < 0){
+80108769:	e8 89 8f ff ff       	call   801016f7 <filealloc>
+8010876e:	89 c3                	mov    %eax,%ebx
+80108770:	85 c0                	test   %eax,%eax
+80108772:	0f 84 c1 00 00 00    	je     80108839 <sys_open+0x137>
+80108778:	e8 43 f8 ff ff       	call   80107fc0 <fdalloc>
+8010877d:	89 c7                	mov    %eax,%edi
+8010877f:	85 c0                	test   %eax,%eax
+80108781:	0f 88 a6 00 00 00    	js     8010882d <sys_open+0x12b>
+  iunlock(ip);
+80108787:	83 ec 0c             	sub    $0xc,%esp
+8010878a:	56                   	push   %esi
+8010878b:	e8 93 99 ff ff       	call   80102123 <iunlock>
+  end_op();
+80108790:	e8 39 c3 ff ff       	call   80104ace <end_op>
+  f->type = FD_INODE;
+80108795:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  f->ip = ip;
+8010879b:	89 73 10             	mov    %esi,0x10(%ebx)
+  f->off = 0;
+8010879e:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+  f->readable = !(omode & O_WRONLY);
+801087a5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801087a8:	83 c4 10             	add    $0x10,%esp
+801087ab:	a8 01                	test   $0x1,%al
+801087ad:	0f 94 43 08          	sete   0x8(%ebx)
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+801087b1:	a8 03                	test   $0x3,%al
+801087b3:	0f 95 43 09          	setne  0x9(%ebx)
+}
+801087b7:	89 f8                	mov    %edi,%eax
+801087b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801087bc:	5b                   	pop    %ebx
+801087bd:	5e                   	pop    %esi
+801087be:	5f                   	pop    %edi
+801087bf:	5d                   	pop    %ebp
+801087c0:	c3                   	ret
+    return -1;
+801087c1:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+801087c6:	eb ef                	jmp    801087b7 <sys_open+0xb5>
+      end_op();
+801087c8:	e8 01 c3 ff ff       	call   80104ace <end_op>
+      return -1;
+801087cd:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+801087d2:	eb e3                	jmp    801087b7 <sys_open+0xb5>
+    if((ip = namei(path)) == 0){
+801087d4:	83 ec 0c             	sub    $0xc,%esp
+801087d7:	ff 75 e4             	push   -0x1c(%ebp)
+801087da:	e8 13 a0 ff ff       	call   801027f2 <namei>
+801087df:	89 c6                	mov    %eax,%esi
+801087e1:	83 c4 10             	add    $0x10,%esp
+801087e4:	85 c0                	test   %eax,%eax
+801087e6:	74 39                	je     80108821 <sys_open+0x11f>
+    ilock(ip);
+801087e8:	83 ec 0c             	sub    $0xc,%esp
+801087eb:	50                   	push   %eax
+801087ec:	e8 70 98 ff ff       	call   80102061 <ilock>
+    if(ip->type == T_DIR && omode != O_RDONLY){
+801087f1:	83 c4 10             	add    $0x10,%esp
+801087f4:	66 83 7e 50 01       	cmpw   $0x1,0x50(%esi)
+801087f9:	0f 85 6a ff ff ff    	jne    80108769 <sys_open+0x67>
+801087ff:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+80108803:	0f 84 60 ff ff ff    	je     80108769 <sys_open+0x67>
+      iunlockput(ip);
+80108809:	83 ec 0c             	sub    $0xc,%esp
+8010880c:	56                   	push   %esi
+8010880d:	e8 f6 99 ff ff       	call   80102208 <iunlockput>
+      end_op();
+80108812:	e8 b7 c2 ff ff       	call   80104ace <end_op>
+      return -1;
+80108817:	83 c4 10             	add    $0x10,%esp
+8010881a:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+8010881f:	eb 96                	jmp    801087b7 <sys_open+0xb5>
+      end_op();
+80108821:	e8 a8 c2 ff ff       	call   80104ace <end_op>
+      return -1;
+80108826:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+8010882b:	eb 8a                	jmp    801087b7 <sys_open+0xb5>
+      fileclose(f);
+8010882d:	83 ec 0c             	sub    $0xc,%esp
+80108830:	53                   	push   %ebx
+80108831:	e8 3f 8f ff ff       	call   80101775 <fileclose>
+80108836:	83 c4 10             	add    $0x10,%esp
+    iunlockput(ip);
+80108839:	83 ec 0c             	sub    $0xc,%esp
+8010883c:	56                   	push   %esi
+8010883d:	e8 c6 99 ff ff       	call   80102208 <iunlockput>
+    end_op();
+80108842:	e8 87 c2 ff ff       	call   80104ace <end_op>
+    return -1;
+80108847:	83 c4 10             	add    $0x10,%esp
+8010884a:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+8010884f:	e9 63 ff ff ff       	jmp    801087b7 <sys_open+0xb5>
+
+80108854 <sys_mkdir>:
+{
+80108854:	55                   	push   %ebp
+80108855:	89 e5                	mov    %esp,%ebp
+80108857:	83 ec 18             	sub    $0x18,%esp
+  begin_op();
+8010885a:	e8 db c1 ff ff       	call   80104a3a <begin_op>
+  if(argstr(0, &path) < 0 || (ip = create(path, T_DIR, 0, 0)) == 0){
+8010885f:	83 ec 08             	sub    $0x8,%esp
+80108862:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108865:	50                   	push   %eax
+80108866:	6a 00                	push   $0x0
+80108868:	e8 69 f6 ff ff       	call   80107ed6 <argstr>
+8010886d:	83 c4 10             	add    $0x10,%esp
+80108870:	85 c0                	test   %eax,%eax
+80108872:	78 36                	js     801088aa <sys_mkdir+0x56>
+80108874:	83 ec 0c             	sub    $0xc,%esp
+80108877:	6a 00                	push   $0x0
+80108879:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010887e:	ba 01 00 00 00       	mov    $0x1,%edx
+80108883:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108886:	e8 c2 f7 ff ff       	call   8010804d <create>
+8010888b:	83 c4 10             	add    $0x10,%esp
+8010888e:	85 c0                	test   %eax,%eax
+80108890:	74 18                	je     801088aa <sys_mkdir+0x56>
+  iunlockput(ip);
+80108892:	83 ec 0c             	sub    $0xc,%esp
+80108895:	50                   	push   %eax
+80108896:	e8 6d 99 ff ff       	call   80102208 <iunlockput>
+  end_op();
+8010889b:	e8 2e c2 ff ff       	call   80104ace <end_op>
+  return 0;
+801088a0:	83 c4 10             	add    $0x10,%esp
+801088a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+801088a8:	c9                   	leave
+801088a9:	c3                   	ret
+    end_op();
+801088aa:	e8 1f c2 ff ff       	call   80104ace <end_op>
+    return -1;
+801088af:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801088b4:	eb f2                	jmp    801088a8 <sys_mkdir+0x54>
+
+801088b6 <sys_mknod>:
+{
+801088b6:	55                   	push   %ebp
+801088b7:	89 e5                	mov    %esp,%ebp
+801088b9:	83 ec 18             	sub    $0x18,%esp
+  begin_op();
+801088bc:	e8 79 c1 ff ff       	call   80104a3a <begin_op>
+  if((argstr(0, &path)) < 0 ||
+801088c1:	83 ec 08             	sub    $0x8,%esp
+801088c4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801088c7:	50                   	push   %eax
+801088c8:	6a 00                	push   $0x0
+801088ca:	e8 07 f6 ff ff       	call   80107ed6 <argstr>
+801088cf:	83 c4 10             	add    $0x10,%esp
+801088d2:	85 c0                	test   %eax,%eax
+801088d4:	78 62                	js     80108938 <sys_mknod+0x82>
+     argint(1, &major) < 0 ||
+801088d6:	83 ec 08             	sub    $0x8,%esp
+801088d9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801088dc:	50                   	push   %eax
+801088dd:	6a 01                	push   $0x1
+801088df:	e8 0f f5 ff ff       	call   80107df3 <argint>
+  if((argstr(0, &path)) < 0 ||
+801088e4:	83 c4 10             	add    $0x10,%esp
+801088e7:	85 c0                	test   %eax,%eax
+801088e9:	78 4d                	js     80108938 <sys_mknod+0x82>
+     argint(2, &minor) < 0 ||
+801088eb:	83 ec 08             	sub    $0x8,%esp
+801088ee:	8d 45 ec             	lea    -0x14(%ebp),%eax
+801088f1:	50                   	push   %eax
+801088f2:	6a 02                	push   $0x2
+801088f4:	e8 fa f4 ff ff       	call   80107df3 <argint>
+     argint(1, &major) < 0 ||
+801088f9:	83 c4 10             	add    $0x10,%esp
+801088fc:	85 c0                	test   %eax,%eax
+801088fe:	78 38                	js     80108938 <sys_mknod+0x82>
+     (ip = create(path, T_DEV, major, minor)) == 0){
+80108900:	0f bf 4d f0          	movswl -0x10(%ebp),%ecx
+80108904:	83 ec 0c             	sub    $0xc,%esp
+80108907:	0f bf 45 ec          	movswl -0x14(%ebp),%eax
+8010890b:	50                   	push   %eax
+8010890c:	ba 03 00 00 00       	mov    $0x3,%edx
+80108911:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108914:	e8 34 f7 ff ff       	call   8010804d <create>
+     argint(2, &minor) < 0 ||
+80108919:	83 c4 10             	add    $0x10,%esp
+8010891c:	85 c0                	test   %eax,%eax
+8010891e:	74 18                	je     80108938 <sys_mknod+0x82>
+  iunlockput(ip);
+80108920:	83 ec 0c             	sub    $0xc,%esp
+80108923:	50                   	push   %eax
+80108924:	e8 df 98 ff ff       	call   80102208 <iunlockput>
+  end_op();
+80108929:	e8 a0 c1 ff ff       	call   80104ace <end_op>
+  return 0;
+8010892e:	83 c4 10             	add    $0x10,%esp
+80108931:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80108936:	c9                   	leave
+80108937:	c3                   	ret
+    end_op();
+80108938:	e8 91 c1 ff ff       	call   80104ace <end_op>
+    return -1;
+8010893d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108942:	eb f2                	jmp    80108936 <sys_mknod+0x80>
+
+80108944 <sys_chdir>:
+{
+80108944:	55                   	push   %ebp
+80108945:	89 e5                	mov    %esp,%ebp
+80108947:	56                   	push   %esi
+80108948:	53                   	push   %ebx
+80108949:	83 ec 10             	sub    $0x10,%esp
+  struct proc *curproc = myproc();
+8010894c:	e8 ba d3 ff ff       	call   80105d0b <myproc>
+80108951:	89 c6                	mov    %eax,%esi
+  begin_op();
+80108953:	e8 e2 c0 ff ff       	call   80104a3a <begin_op>
+  if(argstr(0, &path) < 0 || (ip = namei(path)) == 0){
+80108958:	83 ec 08             	sub    $0x8,%esp
+8010895b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+8010895e:	50                   	push   %eax
+8010895f:	6a 00                	push   $0x0
+80108961:	e8 70 f5 ff ff       	call   80107ed6 <argstr>
+80108966:	83 c4 10             	add    $0x10,%esp
+80108969:	85 c0                	test   %eax,%eax
+8010896b:	78 52                	js     801089bf <sys_chdir+0x7b>
+8010896d:	83 ec 0c             	sub    $0xc,%esp
+80108970:	ff 75 f4             	push   -0xc(%ebp)
+80108973:	e8 7a 9e ff ff       	call   801027f2 <namei>
+80108978:	89 c3                	mov    %eax,%ebx
+8010897a:	83 c4 10             	add    $0x10,%esp
+8010897d:	85 c0                	test   %eax,%eax
+8010897f:	74 3e                	je     801089bf <sys_chdir+0x7b>
+  ilock(ip);
+80108981:	83 ec 0c             	sub    $0xc,%esp
+80108984:	50                   	push   %eax
+80108985:	e8 d7 96 ff ff       	call   80102061 <ilock>
+  if(ip->type != T_DIR){
+8010898a:	83 c4 10             	add    $0x10,%esp
+8010898d:	66 83 7b 50 01       	cmpw   $0x1,0x50(%ebx)
+80108992:	75 37                	jne    801089cb <sys_chdir+0x87>
+  iunlock(ip);
+80108994:	83 ec 0c             	sub    $0xc,%esp
+80108997:	53                   	push   %ebx
+80108998:	e8 86 97 ff ff       	call   80102123 <iunlock>
+  iput(curproc->cwd);
+8010899d:	83 c4 04             	add    $0x4,%esp
+801089a0:	ff 76 68             	push   0x68(%esi)
+801089a3:	e8 c0 97 ff ff       	call   80102168 <iput>
+  end_op();
+801089a8:	e8 21 c1 ff ff       	call   80104ace <end_op>
+  curproc->cwd = ip;
+801089ad:	89 5e 68             	mov    %ebx,0x68(%esi)
+  return 0;
+801089b0:	83 c4 10             	add    $0x10,%esp
+801089b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+801089b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801089bb:	5b                   	pop    %ebx
+801089bc:	5e                   	pop    %esi
+801089bd:	5d                   	pop    %ebp
+801089be:	c3                   	ret
+    end_op();
+801089bf:	e8 0a c1 ff ff       	call   80104ace <end_op>
+    return -1;
+801089c4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801089c9:	eb ed                	jmp    801089b8 <sys_chdir+0x74>
+    iunlockput(ip);
+801089cb:	83 ec 0c             	sub    $0xc,%esp
+801089ce:	53                   	push   %ebx
+801089cf:	e8 34 98 ff ff       	call   80102208 <iunlockput>
+    end_op();
+801089d4:	e8 f5 c0 ff ff       	call   80104ace <end_op>
+    return -1;
+801089d9:	83 c4 10             	add    $0x10,%esp
+801089dc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801089e1:	eb d5                	jmp    801089b8 <sys_chdir+0x74>
+
+801089e3 <sys_exec>:
+
+int
+sys_exec(void)
+{
+801089e3:	55                   	push   %ebp
+801089e4:	89 e5                	mov    %esp,%ebp
+801089e6:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+  char *path, *argv[MAXARG];
+
+  if(argstr(0, &path) < 0 || argargv(1, argv) < 0){
+801089ec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801089ef:	50                   	push   %eax
+801089f0:	6a 00                	push   $0x0
+801089f2:	e8 df f4 ff ff       	call   80107ed6 <argstr>
+801089f7:	83 c4 10             	add    $0x10,%esp
+801089fa:	85 c0                	test   %eax,%eax
+801089fc:	78 2b                	js     80108a29 <sys_exec+0x46>
+801089fe:	8d 95 74 ff ff ff    	lea    -0x8c(%ebp),%edx
+80108a04:	b8 01 00 00 00       	mov    $0x1,%eax
+80108a09:	e8 a4 f7 ff ff       	call   801081b2 <argargv>
+80108a0e:	85 c0                	test   %eax,%eax
+80108a10:	78 17                	js     80108a29 <sys_exec+0x46>
+    return -1;
+  }
+  return exec(path, argv);
+80108a12:	83 ec 08             	sub    $0x8,%esp
+80108a15:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+80108a1b:	50                   	push   %eax
+80108a1c:	ff 75 f4             	push   -0xc(%ebp)
+80108a1f:	e8 89 8c ff ff       	call   801016ad <exec>
+80108a24:	83 c4 10             	add    $0x10,%esp
+}
+80108a27:	c9                   	leave
+80108a28:	c3                   	ret
+    return -1;
+80108a29:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108a2e:	eb f7                	jmp    80108a27 <sys_exec+0x44>
+
+80108a30 <sys_spawn>:
+
+int
+sys_spawn(void)
+{
+80108a30:	55                   	push   %ebp
+80108a31:	89 e5                	mov    %esp,%ebp
+80108a33:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+  char *path, *argv[MAXARG];
+  int pri;
+
+  if(argstr(0, &path) < 0 || argargv(1, argv) < 0 || argint(2, &pri) < 0)
+80108a39:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108a3c:	50                   	push   %eax
+80108a3d:	6a 00                	push   $0x0
+80108a3f:	e8 92 f4 ff ff       	call   80107ed6 <argstr>
+80108a44:	83 c4 10             	add    $0x10,%esp
+80108a47:	85 c0                	test   %eax,%eax
+80108a49:	78 49                	js     80108a94 <sys_spawn+0x64>
+80108a4b:	8d 95 74 ff ff ff    	lea    -0x8c(%ebp),%edx
+80108a51:	b8 01 00 00 00       	mov    $0x1,%eax
+80108a56:	e8 57 f7 ff ff       	call   801081b2 <argargv>
+80108a5b:	85 c0                	test   %eax,%eax
+80108a5d:	78 35                	js     80108a94 <sys_spawn+0x64>
+80108a5f:	83 ec 08             	sub    $0x8,%esp
+80108a62:	8d 85 70 ff ff ff    	lea    -0x90(%ebp),%eax
+80108a68:	50                   	push   %eax
+80108a69:	6a 02                	push   $0x2
+80108a6b:	e8 83 f3 ff ff       	call   80107df3 <argint>
+80108a70:	83 c4 10             	add    $0x10,%esp
+80108a73:	85 c0                	test   %eax,%eax
+80108a75:	78 1d                	js     80108a94 <sys_spawn+0x64>
+    return -1;
+  return spawn(path, argv, pri);
+80108a77:	83 ec 04             	sub    $0x4,%esp
+80108a7a:	ff b5 70 ff ff ff    	push   -0x90(%ebp)
+80108a80:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+80108a86:	50                   	push   %eax
+80108a87:	ff 75 f4             	push   -0xc(%ebp)
+80108a8a:	e8 13 e2 ff ff       	call   80106ca2 <spawn>
+80108a8f:	83 c4 10             	add    $0x10,%esp
+}
+80108a92:	c9                   	leave
+80108a93:	c3                   	ret
+    return -1;
+80108a94:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108a99:	eb f7                	jmp    80108a92 <sys_spawn+0x62>
+
+80108a9b <sys_spawnn>:
+
+int
+sys_spawnn(void)
+{
+80108a9b:	55                   	push   %ebp
+80108a9c:	89 e5                	mov    %esp,%ebp
+80108a9e:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+  char *path, *argv[MAXARG];
+  int pri, n, *pids;
+
+  if(argstr(0, &path) < 0 || argargv(1, argv) < 0 || argint(2, &pri) < 0)
+80108aa4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108aa7:	50                   	push   %eax
+80108aa8:	6a 00                	push   $0x0
+80108aaa:	e8 27 f4 ff ff       	call   80107ed6 <argstr>
+80108aaf:	83 c4 10             	add    $0x10,%esp
+80108ab2:	85 c0                	test   %eax,%eax
+80108ab4:	0f 88 9c 00 00 00    	js     80108b56 <sys_spawnn+0xbb>
+80108aba:	8d 95 74 ff ff ff    	lea    -0x8c(%ebp),%edx
+80108ac0:	b8 01 00 00 00       	mov    $0x1,%eax
+80108ac5:	e8 e8 f6 ff ff       	call   801081b2 <argargv>
+80108aca:	85 c0                	test   %eax,%eax
+80108acc:	0f 88 84 00 00 00    	js     80108b56 <sys_spawnn+0xbb>
+80108ad2:	83 ec 08             	sub    $0x8,%esp
+80108ad5:	8d 85 70 ff ff ff    	lea    -0x90(%ebp),%eax
+80108adb:	50                   	push   %eax
+80108adc:	6a 02                	push   $0x2
+80108ade:	e8 10 f3 ff ff       	call   80107df3 <argint>
+80108ae3:	83 c4 10             	add    $0x10,%esp
+80108ae6:	85 c0                	test   %eax,%eax
+80108ae8:	78 6c                	js     80108b56 <sys_spawnn+0xbb>
+    return -1;
+  if(argint(3, &n) < 0 || n < 0 || n > NPROC)
+80108aea:	83 ec 08             	sub    $0x8,%esp
+80108aed:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+80108af3:	50                   	push   %eax
+80108af4:	6a 03                	push   $0x3
+80108af6:	e8 f8 f2 ff ff       	call   80107df3 <argint>
+80108afb:	83 c4 10             	add    $0x10,%esp
+80108afe:	85 c0                	test   %eax,%eax
+80108b00:	78 5b                	js     80108b5d <sys_spawnn+0xc2>
+80108b02:	8b 85 6c ff ff ff    	mov    -0x94(%ebp),%eax
+80108b08:	85 c0                	test   %eax,%eax
+80108b0a:	78 58                	js     80108b64 <sys_spawnn+0xc9>
+80108b0c:	83 f8 40             	cmp    $0x40,%eax
+80108b0f:	7f 5a                	jg     80108b6b <sys_spawnn+0xd0>
+    return -1;
+  if(argptrw(4, (void*)&pids, n*sizeof(pids[0])) < 0)
+80108b11:	c1 e0 02             	shl    $0x2,%eax
+80108b14:	83 ec 04             	sub    $0x4,%esp
+80108b17:	50                   	push   %eax
+80108b18:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+80108b1e:	50                   	push   %eax
+80108b1f:	6a 04                	push   $0x4
+80108b21:	e8 98 f3 ff ff       	call   80107ebe <argptrw>
+80108b26:	83 c4 10             	add    $0x10,%esp
+80108b29:	85 c0                	test   %eax,%eax
+80108b2b:	78 45                	js     80108b72 <sys_spawnn+0xd7>
+    return -1;
+  return spawnn(path, argv, pri, n, pids);
+80108b2d:	83 ec 0c             	sub    $0xc,%esp
+80108b30:	ff b5 68 ff ff ff    	push   -0x98(%ebp)
+80108b36:	ff b5 6c ff ff ff    	push   -0x94(%ebp)
+80108b3c:	ff b5 70 ff ff ff    	push   -0x90(%ebp)
+80108b42:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+80108b48:	50                   	push   %eax
+80108b49:	ff 75 f4             	push   -0xc(%ebp)
+80108b4c:	e8 b4 e2 ff ff       	call   80106e05 <spawnn>
+80108b51:	83 c4 20             	add    $0x20,%esp
+}
+80108b54:	c9                   	leave
+80108b55:	c3                   	ret
+    return -1;
+80108b56:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108b5b:	eb f7                	jmp    80108b54 <sys_spawnn+0xb9>
+    return -1;
+80108b5d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108b62:	eb f0                	jmp    80108b54 <sys_spawnn+0xb9>
+80108b64:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108b69:	eb e9                	jmp    80108b54 <sys_spawnn+0xb9>
+80108b6b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108b70:	eb e2                	jmp    80108b54 <sys_spawnn+0xb9>
+    return -1;
+80108b72:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108b77:	eb db                	jmp    80108b54 <sys_spawnn+0xb9>
+
+80108b79 <sys_mmap>:
+
+// mmap(addr, len, prot, flags, fd, off).  addr is only a
+// hint in other systems and is ignored here.
+int
+sys_mmap(void)
+{
+80108b79:	55                   	push   %ebp
+80108b7a:	89 e5                	mov    %esp,%ebp
+80108b7c:	83 ec 30             	sub    $0x30,%esp
+  struct file *f;
+  int len, prot, flags, off;
+
+  if(argint(1, &len) < 0 || argint(2, &prot) < 0 || argint(3, &flags) < 0 ||
+80108b7f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108b82:	50                   	push   %eax
+80108b83:	6a 01                	push   $0x1
+80108b85:	e8 69 f2 ff ff       	call   80107df3 <argint>
+80108b8a:	83 c4 10             	add    $0x10,%esp
+80108b8d:	85 c0                	test   %eax,%eax
+80108b8f:	78 71                	js     80108c02 <sys_mmap+0x89>
+80108b91:	83 ec 08             	sub    $0x8,%esp
+80108b94:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80108b97:	50                   	push   %eax
+80108b98:	6a 02                	push   $0x2
+80108b9a:	e8 54 f2 ff ff       	call   80107df3 <argint>
+80108b9f:	83 c4 10             	add    $0x10,%esp
+80108ba2:	85 c0                	test   %eax,%eax
+80108ba4:	78 5c                	js     80108c02 <sys_mmap+0x89>
+80108ba6:	83 ec 08             	sub    $0x8,%esp
+80108ba9:	8d 45 e8             	lea    -0x18(%ebp),%eax
+80108bac:	50                   	push   %eax
+80108bad:	6a 03                	push   $0x3
+80108baf:	e8 3f f2 ff ff       	call   80107df3 <argint>
+80108bb4:	83 c4 10             	add    $0x10,%esp
+80108bb7:	85 c0                	test   %eax,%eax
+80108bb9:	78 47                	js     80108c02 <sys_mmap+0x89>
+     argfd(4, 0, &f) < 0 || argint(5, &off) < 0)
+80108bbb:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+80108bbe:	ba 00 00 00 00       	mov    $0x0,%edx
+80108bc3:	b8 04 00 00 00       	mov    $0x4,%eax
+80108bc8:	e8 93 f3 ff ff       	call   80107f60 <argfd>
+  if(argint(1, &len) < 0 || argint(2, &prot) < 0 || argint(3, &flags) < 0 ||
+80108bcd:	85 c0                	test   %eax,%eax
+80108bcf:	78 31                	js     80108c02 <sys_mmap+0x89>
+     argfd(4, 0, &f) < 0 || argint(5, &off) < 0)
+80108bd1:	83 ec 08             	sub    $0x8,%esp
+80108bd4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80108bd7:	50                   	push   %eax
+80108bd8:	6a 05                	push   $0x5
+80108bda:	e8 14 f2 ff ff       	call   80107df3 <argint>
+80108bdf:	83 c4 10             	add    $0x10,%esp
+80108be2:	85 c0                	test   %eax,%eax
+80108be4:	78 1c                	js     80108c02 <sys_mmap+0x89>
+    return -1;
+  return mmap(f, off, len, prot, flags);
+80108be6:	83 ec 0c             	sub    $0xc,%esp
+80108be9:	ff 75 e8             	push   -0x18(%ebp)
+80108bec:	ff 75 ec             	push   -0x14(%ebp)
+80108bef:	ff 75 f0             	push   -0x10(%ebp)
+80108bf2:	ff 75 e4             	push   -0x1c(%ebp)
+80108bf5:	ff 75 f4             	push   -0xc(%ebp)
+80108bf8:	e8 1e c2 ff ff       	call   80104e1b <mmap>
+80108bfd:	83 c4 20             	add    $0x20,%esp
+}
+80108c00:	c9                   	leave
+80108c01:	c3                   	ret
+    return -1;
+80108c02:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108c07:	eb f7                	jmp    80108c00 <sys_mmap+0x87>
+
+80108c09 <sys_munmap>:
+
+// munmap(addr, len) removes a whole mapping; len is ignored.
+int
+sys_munmap(void)
+{
+80108c09:	55                   	push   %ebp
+80108c0a:	89 e5                	mov    %esp,%ebp
+80108c0c:	83 ec 20             	sub    $0x20,%esp
+  int addr;
+
+  if(argint(0, &addr) < 0)
+80108c0f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108c12:	50                   	push   %eax
+80108c13:	6a 00                	push   $0x0
+80108c15:	e8 d9 f1 ff ff       	call   80107df3 <argint>
+80108c1a:	83 c4 10             	add    $0x10,%esp
+80108c1d:	85 c0                	test   %eax,%eax
+80108c1f:	78 10                	js     80108c31 <sys_munmap+0x28>
+    return -1;
+  return munmap(addr);
+80108c21:	83 ec 0c             	sub    $0xc,%esp
+80108c24:	ff 75 f4             	push   -0xc(%ebp)
+80108c27:	e8 dd c3 ff ff       	call   80105009 <munmap>
+80108c2c:	83 c4 10             	add    $0x10,%esp
+}
+80108c2f:	c9                   	leave
+80108c30:	c3                   	ret
+    return -1;
+80108c31:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108c36:	eb f7                	jmp    80108c2f <sys_munmap+0x26>
+
+80108c38 <sys_aread>:
+
+int
+sys_aread(void)
+{
+80108c38:	55                   	push   %ebp
+80108c39:	89 e5                	mov    %esp,%ebp
+80108c3b:	83 ec 18             	sub    $0x18,%esp
+  struct file *f;
+  int n;
+  char *p;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptrw(1, &p, n) < 0)
+80108c3e:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+80108c41:	ba 00 00 00 00       	mov    $0x0,%edx
+80108c46:	b8 00 00 00 00       	mov    $0x0,%eax
+80108c4b:	e8 10 f3 ff ff       	call   80107f60 <argfd>
+80108c50:	85 c0                	test   %eax,%eax
+80108c52:	78 43                	js     80108c97 <sys_aread+0x5f>
+80108c54:	83 ec 08             	sub    $0x8,%esp
+80108c57:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108c5a:	50                   	push   %eax
+80108c5b:	6a 02                	push   $0x2
+80108c5d:	e8 91 f1 ff ff       	call   80107df3 <argint>
+80108c62:	83 c4 10             	add    $0x10,%esp
+80108c65:	85 c0                	test   %eax,%eax
+80108c67:	78 2e                	js     80108c97 <sys_aread+0x5f>
+80108c69:	83 ec 04             	sub    $0x4,%esp
+80108c6c:	ff 75 f0             	push   -0x10(%ebp)
+80108c6f:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80108c72:	50                   	push   %eax
+80108c73:	6a 01                	push   $0x1
+80108c75:	e8 44 f2 ff ff       	call   80107ebe <argptrw>
+80108c7a:	83 c4 10             	add    $0x10,%esp
+80108c7d:	85 c0                	test   %eax,%eax
+80108c7f:	78 16                	js     80108c97 <sys_aread+0x5f>
+    return -1;
+  return aread(f, p, n);
+80108c81:	83 ec 04             	sub    $0x4,%esp
+80108c84:	ff 75 f0             	push   -0x10(%ebp)
+80108c87:	ff 75 ec             	push   -0x14(%ebp)
+80108c8a:	ff 75 f4             	push   -0xc(%ebp)
+80108c8d:	e8 a2 73 ff ff       	call   80100034 <aread>
+80108c92:	83 c4 10             	add    $0x10,%esp
+}
+80108c95:	c9                   	leave
+80108c96:	c3                   	ret
+    return -1;
+80108c97:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108c9c:	eb f7                	jmp    80108c95 <sys_aread+0x5d>
+
+80108c9e <sys_await>:
+
+int
+sys_await(void)
+{
+80108c9e:	55                   	push   %ebp
+80108c9f:	89 e5                	mov    %esp,%ebp
+80108ca1:	83 ec 20             	sub    $0x20,%esp
+  int id;
+
+  if(argint(0, &id) < 0)
+80108ca4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108ca7:	50                   	push   %eax
+80108ca8:	6a 00                	push   $0x0
+80108caa:	e8 44 f1 ff ff       	call   80107df3 <argint>
+80108caf:	83 c4 10             	add    $0x10,%esp
+80108cb2:	85 c0                	test   %eax,%eax
+80108cb4:	78 10                	js     80108cc6 <sys_await+0x28>
+    return -1;
+  return await(id);
+80108cb6:	83 ec 0c             	sub    $0xc,%esp
+80108cb9:	ff 75 f4             	push   -0xc(%ebp)
+80108cbc:	e8 76 74 ff ff       	call   80100137 <await>
+80108cc1:	83 c4 10             	add    $0x10,%esp
+}
+80108cc4:	c9                   	leave
+80108cc5:	c3                   	ret
+    return -1;
+80108cc6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108ccb:	eb f7                	jmp    80108cc4 <sys_await+0x26>
+
+80108ccd <sys_bdrop>:
+#ifdef BDROP
+  return bdrop();
+#else
+  return -1;
+#endif
+}
+80108ccd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108cd2:	c3                   	ret
+
+80108cd3 <sys_bstat>:
+
+int
+sys_bstat(void)
+{
+80108cd3:	55                   	push   %ebp
+80108cd4:	89 e5                	mov    %esp,%ebp
+80108cd6:	83 ec 1c             	sub    $0x1c,%esp
+  struct bstat *st;
+
+  if(argptrw(0, (void*)&st, sizeof(*st)) < 0)
+80108cd9:	6a 20                	push   $0x20
+80108cdb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108cde:	50                   	push   %eax
+80108cdf:	6a 00                	push   $0x0
+80108ce1:	e8 d8 f1 ff ff       	call   80107ebe <argptrw>
+80108ce6:	83 c4 10             	add    $0x10,%esp
+80108ce9:	85 c0                	test   %eax,%eax
+80108ceb:	78 10                	js     80108cfd <sys_bstat+0x2a>
+    return -1;
+  return bstat(st);
+80108ced:	83 ec 0c             	sub    $0xc,%esp
+80108cf0:	ff 75 f4             	push   -0xc(%ebp)
+80108cf3:	e8 ab 7e ff ff       	call   80100ba3 <bstat>
+80108cf8:	83 c4 10             	add    $0x10,%esp
+}
+80108cfb:	c9                   	leave
+80108cfc:	c3                   	ret
+    return -1;
+80108cfd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108d02:	eb f7                	jmp    80108cfb <sys_bstat+0x28>
+
+80108d04 <sys_pipe>:
+
+int
+sys_pipe(void)
+{
+80108d04:	55                   	push   %ebp
+80108d05:	89 e5                	mov    %esp,%ebp
+80108d07:	53                   	push   %ebx
+80108d08:	83 ec 18             	sub    $0x18,%esp
+  int *fd;
+  struct file *rf, *wf;
+  int fd0, fd1;
+
+  if(argptrw(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+80108d0b:	6a 08                	push   $0x8
+80108d0d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108d10:	50                   	push   %eax
+80108d11:	6a 00                	push   $0x0
+80108d13:	e8 a6 f1 ff ff       	call   80107ebe <argptrw>
+80108d18:	83 c4 10             	add    $0x10,%esp
+80108d1b:	85 c0                	test   %eax,%eax
+80108d1d:	78 73                	js     80108d92 <sys_pipe+0x8e>
+    return -1;
+  if(pipealloc(&rf, &wf) < 0)
+80108d1f:	83 ec 08             	sub    $0x8,%esp
+80108d22:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80108d25:	50                   	push   %eax
+80108d26:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108d29:	50                   	push   %eax
+80108d2a:	e8 1e ca ff ff       	call   8010574d <pipealloc>
+80108d2f:	83 c4 10             	add    $0x10,%esp
+80108d32:	85 c0                	test   %eax,%eax
+80108d34:	78 63                	js     80108d99 <sys_pipe+0x95>
+    return -1;
+  fd0 = -1;
+  if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
+80108d36:	8b 45 f0             	mov    -0x10(%ebp),%eax
+80108d39:	e8 82 f2 ff ff       	call   80107fc0 <fdalloc>
+80108d3e:	89 c3                	mov    %eax,%ebx
+80108d40:	85 c0                	test   %eax,%eax
+80108d42:	78 2e                	js     80108d72 <sys_pipe+0x6e>
+80108d44:	8b 45 ec             	mov    -0x14(%ebp),%eax
+80108d47:	e8 74 f2 ff ff       	call   80107fc0 <fdalloc>
+80108d4c:	85 c0                	test   %eax,%eax
+80108d4e:	78 15                	js     80108d65 <sys_pipe+0x61>
+      myproc()->ofile[fd0] = 0;
+    fileclose(rf);
+    fileclose(wf);
+    return -1;
+  }
+  fd[0] = fd0;
+80108d50:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80108d53:	89 1a                	mov    %ebx,(%edx)
+  fd[1] = fd1;
+80108d55:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80108d58:	89 42 04             	mov    %eax,0x4(%edx)
+  return 0;
+80108d5b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80108d60:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108d63:	c9                   	leave
+80108d64:	c3                   	ret
+      myproc()->ofile[fd0] = 0;
+80108d65:	e8 a1 cf ff ff       	call   80105d0b <myproc>
+80108d6a:	c7 44 98 28 00 00 00 	movl   $0x0,0x28(%eax,%ebx,4)
+80108d71:	00 
+    fileclose(rf);
+80108d72:	83 ec 0c             	sub    $0xc,%esp
+80108d75:	ff 75 f0             	push   -0x10(%ebp)
+80108d78:	e8 f8 89 ff ff       	call   80101775 <fileclose>
+    fileclose(wf);
+80108d7d:	83 c4 04             	add    $0x4,%esp
+80108d80:	ff 75 ec             	push   -0x14(%ebp)
+80108d83:	e8 ed 89 ff ff       	call   80101775 <fileclose>
+    return -1;
+80108d88:	83 c4 10             	add    $0x10,%esp
+80108d8b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108d90:	eb ce                	jmp    80108d60 <sys_pipe+0x5c>
+    return -1;
+80108d92:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108d97:	eb c7                	jmp    80108d60 <sys_pipe+0x5c>
+    return -1;
+80108d99:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108d9e:	eb c0                	jmp    80108d60 <sys_pipe+0x5c>
+
+80108da0 <sys_fork>:
+#include "proc.h"
+#include "kmstat.h"
+
+int
+sys_fork(void)
+{
+80108da0:	55                   	push   %ebp
+80108da1:	89 e5                	mov    %esp,%ebp
+80108da3:	83 ec 08             	sub    $0x8,%esp
+  return fork();
+80108da6:	e8 43 d2 ff ff       	call   80105fee <fork>
+}
+80108dab:	c9                   	leave
+80108dac:	c3                   	ret
+
+80108dad <sys_vfork>:
+
+int
+sys_vfork(void)
+{
+80108dad:	55                   	push   %ebp
+80108dae:	89 e5                	mov    %esp,%ebp
+80108db0:	83 ec 08             	sub    $0x8,%esp
+  return vfork();
+80108db3:	e8 3f d8 ff ff       	call   801065f7 <vfork>
+}
+80108db8:	c9                   	leave
+80108db9:	c3                   	ret
+
+80108dba <sys_exit>:
+
+int
+sys_exit(void)
+{
+80108dba:	55                   	push   %ebp
+80108dbb:	89 e5                	mov    %esp,%ebp
+80108dbd:	83 ec 08             	sub    $0x8,%esp
+  exit();
+80108dc0:	e8 4a d6 ff ff       	call   8010640f <exit>
+  return 0;  // not reached
+}
+80108dc5:	b8 00 00 00 00       	mov    $0x0,%eax
+80108dca:	c9                   	leave
+80108dcb:	c3                   	ret
+
+80108dcc <sys_wait>:
+
+int
+sys_wait(void)
+{
+80108dcc:	55                   	push   %ebp
+80108dcd:	89 e5                	mov    %esp,%ebp
+80108dcf:	83 ec 08             	sub    $0x8,%esp
+  return wait();
+80108dd2:	e8 70 d9 ff ff       	call   80106747 <wait>
+}
+80108dd7:	c9                   	leave
+80108dd8:	c3                   	ret
+
+80108dd9 <sys_kill>:
+
+int
+sys_kill(void)
+{
+80108dd9:	55                   	push   %ebp
+80108dda:	89 e5                	mov    %esp,%ebp
+80108ddc:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+
+  if(argint(0, &pid) < 0)
+80108ddf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108de2:	50                   	push   %eax
+80108de3:	6a 00                	push   $0x0
+80108de5:	e8 09 f0 ff ff       	call   80107df3 <argint>
+80108dea:	83 c4 10             	add    $0x10,%esp
+80108ded:	85 c0                	test   %eax,%eax
+80108def:	78 10                	js     80108e01 <sys_kill+0x28>
+    return -1;
+  return kill(pid);
+80108df1:	83 ec 0c             	sub    $0xc,%esp
+80108df4:	ff 75 f4             	push   -0xc(%ebp)
+80108df7:	e8 62 da ff ff       	call   8010685e <kill>
+80108dfc:	83 c4 10             	add    $0x10,%esp
+}
+80108dff:	c9                   	leave
+80108e00:	c3                   	ret
+    return -1;
+80108e01:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108e06:	eb f7                	jmp    80108dff <sys_kill+0x26>
+
+80108e08 <sys_getpid>:
+
+int
+sys_getpid(void)
+{
+80108e08:	55                   	push   %ebp
+80108e09:	89 e5                	mov    %esp,%ebp
+80108e0b:	83 ec 08             	sub    $0x8,%esp
+  return myproc()->pid;
+80108e0e:	e8 f8 ce ff ff       	call   80105d0b <myproc>
+80108e13:	8b 40 10             	mov    0x10(%eax),%eax
+}
+80108e16:	c9                   	leave
+80108e17:	c3                   	ret
+
+80108e18 <sys_sbrk>:
+
+int
+sys_sbrk(void)
+{
+80108e18:	55                   	push   %ebp
+80108e19:	89 e5                	mov    %esp,%ebp
+80108e1b:	53                   	push   %ebx
+80108e1c:	83 ec 1c             	sub    $0x1c,%esp
+  int addr;
+  int n;
+
+  if(argint(0, &n) < 0)
+80108e1f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108e22:	50                   	push   %eax
+80108e23:	6a 00                	push   $0x0
+80108e25:	e8 c9 ef ff ff       	call   80107df3 <argint>
+80108e2a:	83 c4 10             	add    $0x10,%esp
+80108e2d:	85 c0                	test   %eax,%eax
+80108e2f:	78 20                	js     80108e51 <sys_sbrk+0x39>
+    return -1;
+  addr = myproc()->sz;
+80108e31:	e8 d5 ce ff ff       	call   80105d0b <myproc>
+80108e36:	8b 18                	mov    (%eax),%ebx
+  if(growproc(n) < 0)
+80108e38:	83 ec 0c             	sub    $0xc,%esp
+80108e3b:	ff 75 f4             	push   -0xc(%ebp)
+80108e3e:	e8 03 d1 ff ff       	call   80105f46 <growproc>
+80108e43:	83 c4 10             	add    $0x10,%esp
+80108e46:	85 c0                	test   %eax,%eax
+80108e48:	78 0e                	js     80108e58 <sys_sbrk+0x40>
+    return -1;
+  return addr;
+}
+80108e4a:	89 d8                	mov    %ebx,%eax
+80108e4c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108e4f:	c9                   	leave
+80108e50:	c3                   	ret
+    return -1;
+80108e51:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80108e56:	eb f2                	jmp    80108e4a <sys_sbrk+0x32>
+    return -1;
+80108e58:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80108e5d:	eb eb                	jmp    80108e4a <sys_sbrk+0x32>
+
+80108e5f <sys_shmget>:
+
+int
+sys_shmget(void)
+{
+80108e5f:	55                   	push   %ebp
+80108e60:	89 e5                	mov    %esp,%ebp
+80108e62:	83 ec 20             	sub    $0x20,%esp
+  char *name;
+  int n;
+
+  if(argstr(0, &name) < 0 || argint(1, &n) < 0)
+80108e65:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108e68:	50                   	push   %eax
+80108e69:	6a 00                	push   $0x0
+80108e6b:	e8 66 f0 ff ff       	call   80107ed6 <argstr>
+80108e70:	83 c4 10             	add    $0x10,%esp
+80108e73:	85 c0                	test   %eax,%eax
+80108e75:	78 28                	js     80108e9f <sys_shmget+0x40>
+80108e77:	83 ec 08             	sub    $0x8,%esp
+80108e7a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108e7d:	50                   	push   %eax
+80108e7e:	6a 01                	push   $0x1
+80108e80:	e8 6e ef ff ff       	call   80107df3 <argint>
+80108e85:	83 c4 10             	add    $0x10,%esp
+80108e88:	85 c0                	test   %eax,%eax
+80108e8a:	78 13                	js     80108e9f <sys_shmget+0x40>
+    return -1;
+  return shmget(name, n);
+80108e8c:	83 ec 08             	sub    $0x8,%esp
+80108e8f:	ff 75 f0             	push   -0x10(%ebp)
+80108e92:	ff 75 f4             	push   -0xc(%ebp)
+80108e95:	e8 82 e0 ff ff       	call   80106f1c <shmget>
+80108e9a:	83 c4 10             	add    $0x10,%esp
+}
+80108e9d:	c9                   	leave
+80108e9e:	c3                   	ret
+    return -1;
+80108e9f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108ea4:	eb f7                	jmp    80108e9d <sys_shmget+0x3e>
+
+80108ea6 <sys_shmat>:
+
+int
+sys_shmat(void)
+{
+80108ea6:	55                   	push   %ebp
+80108ea7:	89 e5                	mov    %esp,%ebp
+80108ea9:	83 ec 20             	sub    $0x20,%esp
+  int id;
+
+  if(argint(0, &id) < 0)
+80108eac:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108eaf:	50                   	push   %eax
+80108eb0:	6a 00                	push   $0x0
+80108eb2:	e8 3c ef ff ff       	call   80107df3 <argint>
+80108eb7:	83 c4 10             	add    $0x10,%esp
+80108eba:	85 c0                	test   %eax,%eax
+80108ebc:	78 10                	js     80108ece <sys_shmat+0x28>
+    return -1;
+  return shmat(id);
+80108ebe:	83 ec 0c             	sub    $0xc,%esp
+80108ec1:	ff 75 f4             	push   -0xc(%ebp)
+80108ec4:	e8 a0 e1 ff ff       	call   80107069 <shmat>
+80108ec9:	83 c4 10             	add    $0x10,%esp
+}
+80108ecc:	c9                   	leave
+80108ecd:	c3                   	ret
+    return -1;
+80108ece:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108ed3:	eb f7                	jmp    80108ecc <sys_shmat+0x26>
+
+80108ed5 <sys_shmdt>:
+
+int
+sys_shmdt(void)
+{
+80108ed5:	55                   	push   %ebp
+80108ed6:	89 e5                	mov    %esp,%ebp
+80108ed8:	83 ec 20             	sub    $0x20,%esp
+  int addr;
+
+  if(argint(0, &addr) < 0)
+80108edb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108ede:	50                   	push   %eax
+80108edf:	6a 00                	push   $0x0
+80108ee1:	e8 0d ef ff ff       	call   80107df3 <argint>
+80108ee6:	83 c4 10             	add    $0x10,%esp
+80108ee9:	85 c0                	test   %eax,%eax
+80108eeb:	78 10                	js     80108efd <sys_shmdt+0x28>
+    return -1;
+  return shmdt(addr);
+80108eed:	83 ec 0c             	sub    $0xc,%esp
+80108ef0:	ff 75 f4             	push   -0xc(%ebp)
+80108ef3:	e8 40 e3 ff ff       	call   80107238 <shmdt>
+80108ef8:	83 c4 10             	add    $0x10,%esp
+}
+80108efb:	c9                   	leave
+80108efc:	c3                   	ret
+    return -1;
+80108efd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108f02:	eb f7                	jmp    80108efb <sys_shmdt+0x26>
+
+80108f04 <sys_sleep>:
+
+int
+sys_sleep(void)
+{
+80108f04:	55                   	push   %ebp
+80108f05:	89 e5                	mov    %esp,%ebp
+80108f07:	53                   	push   %ebx
+80108f08:	83 ec 1c             	sub    $0x1c,%esp
+  int n;
+  uint ticks0;
+
+  if(argint(0, &n) < 0)
+80108f0b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108f0e:	50                   	push   %eax
+80108f0f:	6a 00                	push   $0x0
+80108f11:	e8 dd ee ff ff       	call   80107df3 <argint>
+80108f16:	83 c4 10             	add    $0x10,%esp
+80108f19:	85 c0                	test   %eax,%eax
+80108f1b:	78 75                	js     80108f92 <sys_sleep+0x8e>
+    return -1;
+  acquire(&tickslock);
+80108f1d:	83 ec 0c             	sub    $0xc,%esp
+80108f20:	68 a0 34 13 80       	push   $0x801334a0
+80108f25:	e8 68 eb ff ff       	call   80107a92 <acquire>
+  ticks0 = ticks;
+80108f2a:	8b 1d 80 34 13 80    	mov    0x80133480,%ebx
+  while(ticks - ticks0 < n){
+80108f30:	83 c4 10             	add    $0x10,%esp
+80108f33:	a1 80 34 13 80       	mov    0x80133480,%eax
+80108f38:	29 d8                	sub    %ebx,%eax
+80108f3a:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+80108f3d:	73 39                	jae    80108f78 <sys_sleep+0x74>
+    if(myproc()->killed){
+80108f3f:	e8 c7 cd ff ff       	call   80105d0b <myproc>
+80108f44:	83 78 24 00          	cmpl   $0x0,0x24(%eax)
+80108f48:	75 17                	jne    80108f61 <sys_sleep+0x5d>
+      release(&tickslock);
+      return -1;
+    }
+    sleep(&ticks, &tickslock);
+80108f4a:	83 ec 08             	sub    $0x8,%esp
+80108f4d:	68 a0 34 13 80       	push   $0x801334a0
+80108f52:	68 80 34 13 80       	push   $0x80133480
+80108f57:	e8 0a d6 ff ff       	call   80106566 <sleep>
+80108f5c:	83 c4 10             	add    $0x10,%esp
+80108f5f:	eb d2                	jmp    80108f33 <sys_sleep+0x2f>
+      release(&tickslock);
+80108f61:	83 ec 0c             	sub    $0xc,%esp
+80108f64:	68 a0 34 13 80       	push   $0x801334a0
+80108f69:	e8 89 eb ff ff       	call   80107af7 <release>
+      return -1;
+80108f6e:	83 c4 10             	add    $0x10,%esp
+80108f71:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108f76:	eb 15                	jmp    80108f8d <sys_sleep+0x89>
+  }
+  release(&tickslock);
+80108f78:	83 ec 0c             	sub    $0xc,%esp
+80108f7b:	68 a0 34 13 80       	push   $0x801334a0
+80108f80:	e8 72 eb ff ff       	call   80107af7 <release>
+  return 0;
+80108f85:	83 c4 10             	add    $0x10,%esp
+80108f88:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+80108f8d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108f90:	c9                   	leave
+80108f91:	c3                   	ret
+    return -1;
+80108f92:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108f97:	eb f4                	jmp    80108f8d <sys_sleep+0x89>
+
+80108f99 <sys_uptime>:
+
+// return how many clock tick interrupts have occurred
+// since start.
+int
+sys_uptime(void)
+{
+80108f99:	55                   	push   %ebp
+80108f9a:	89 e5                	mov    %esp,%ebp
+80108f9c:	53                   	push   %ebx
+80108f9d:	83 ec 10             	sub    $0x10,%esp
+  uint xticks;
+
+  acquire(&tickslock);
+80108fa0:	68 a0 34 13 80       	push   $0x801334a0
+80108fa5:	e8 e8 ea ff ff       	call   80107a92 <acquire>
+  xticks = ticks;
+80108faa:	8b 1d 80 34 13 80    	mov    0x80133480,%ebx
+  release(&tickslock);
+80108fb0:	c7 04 24 a0 34 13 80 	movl   $0x801334a0,(%esp)
+80108fb7:	e8 3b eb ff ff       	call   80107af7 <release>
+  return xticks;
+}
+80108fbc:	89 d8                	mov    %ebx,%eax
+80108fbe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108fc1:	c9                   	leave
+80108fc2:	c3                   	ret
+
+80108fc3 <sys_setpri>:
+
+int
+sys_setpri(void)
+{
+80108fc3:	55                   	push   %ebp
+80108fc4:	89 e5                	mov    %esp,%ebp
+80108fc6:	83 ec 20             	sub    $0x20,%esp
+    int pid, pri;
+
+    if (argint(0, &pid) < 0) {
+80108fc9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108fcc:	50                   	push   %eax
+80108fcd:	6a 00                	push   $0x0
+80108fcf:	e8 1f ee ff ff       	call   80107df3 <argint>
+80108fd4:	83 c4 10             	add    $0x10,%esp
+80108fd7:	85 c0                	test   %eax,%eax
+80108fd9:	78 28                	js     80109003 <sys_setpri+0x40>
+        return -1;
+    }
+    if (argint(1, &pri) < 0) {
+80108fdb:	83 ec 08             	sub    $0x8,%esp
+80108fde:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108fe1:	50                   	push   %eax
+80108fe2:	6a 01                	push   $0x1
+80108fe4:	e8 0a ee ff ff       	call   80107df3 <argint>
+80108fe9:	83 c4 10             	add    $0x10,%esp
+80108fec:	85 c0                	test   %eax,%eax
+80108fee:	78 1a                	js     8010900a <sys_setpri+0x47>
+        return -1;
+    }
+    return setpri(pid, pri);
+80108ff0:	83 ec 08             	sub    $0x8,%esp
+80108ff3:	ff 75 f0             	push   -0x10(%ebp)
+80108ff6:	ff 75 f4             	push   -0xc(%ebp)
+80108ff9:	e8 8b d9 ff ff       	call   80106989 <setpri>
+80108ffe:	83 c4 10             	add    $0x10,%esp
+}
+80109001:	c9                   	leave
+80109002:	c3                   	ret
+        return -1;
+80109003:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80109008:	eb f7                	jmp    80109001 <sys_setpri+0x3e>
+        return -1;
+8010900a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010900f:	eb f0                	jmp    80109001 <sys_setpri+0x3e>
+
+80109011 <sys_getpri>:
+
+int
+sys_getpri(void)
+{
+80109011:	55                   	push   %ebp
+80109012:	89 e5                	mov    %esp,%ebp
+80109014:	83 ec 20             	sub    $0x20,%esp
+    int pid;
+
+    if (argint(0, &pid) < 0) {
+80109017:	8d 45 f4             	lea    -0xc(%ebp),%eax
+8010901a:	50                   	push   %eax
+8010901b:	6a 00                	push   $0x0
+8010901d:	e8 d1 ed ff ff       	call   80107df3 <argint>
+80109022:	83 c4 10             	add    $0x10,%esp
+80109025:	85 c0                	test   %eax,%eax
+80109027:	78 10                	js     80109039 <sys_getpri+0x28>
+        return -1;
+    }
+    return getpri(pid);
+80109029:	83 ec 0c             	sub    $0xc,%esp
+8010902c:	ff 75 f4             	push   -0xc(%ebp)
+8010902f:	e8 a2 da ff ff       	call   80106ad6 <getpri>
+80109034:	83 c4 10             	add    $0x10,%esp
+}
+80109037:	c9                   	leave
+80109038:	c3                   	ret
+        return -1;
+80109039:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010903e:	eb f7                	jmp    80109037 <sys_getpri+0x26>
+
+80109040 <sys_fork2>:
+
+int
+sys_fork2(void)
+{
+80109040:	55                   	push   %ebp
+80109041:	89 e5                	mov    %esp,%ebp
+80109043:	83 ec 20             	sub    $0x20,%esp
+    int pri;
+
+    if (argint(0, &pri) < 0) {
+80109046:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80109049:	50                   	push   %eax
+8010904a:	6a 00                	push   $0x0
+8010904c:	e8 a2 ed ff ff       	call   80107df3 <argint>
+80109051:	83 c4 10             	add    $0x10,%esp
+80109054:	85 c0                	test   %eax,%eax
+80109056:	78 10                	js     80109068 <sys_fork2+0x28>
+        return -1;
+    }
+    return fork2(pri);
+80109058:	83 ec 0c             	sub    $0xc,%esp
+8010905b:	ff 75 f4             	push   -0xc(%ebp)
+8010905e:	e8 d6 da ff ff       	call   80106b39 <fork2>
+80109063:	83 c4 10             	add    $0x10,%esp
+}
+80109066:	c9                   	leave
+80109067:	c3                   	ret
+        return -1;
+80109068:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010906d:	eb f7                	jmp    80109066 <sys_fork2+0x26>
+
+8010906f <sys_getpinfo>:
+
+int
+sys_getpinfo(void)
+{
+8010906f:	55                   	push   %ebp
+80109070:	89 e5                	mov    %esp,%ebp
+80109072:	83 ec 1c             	sub    $0x1c,%esp
+    struct pstat* stat;
+
+    if (argptrw(0, (char**)&stat, sizeof(struct pstat*)) < 0) {
+80109075:	6a 04                	push   $0x4
+80109077:	8d 45 f4             	lea    -0xc(%ebp),%eax
+8010907a:	50                   	push   %eax
+8010907b:	6a 00                	push   $0x0
+8010907d:	e8 3c ee ff ff       	call   80107ebe <argptrw>
+80109082:	83 c4 10             	add    $0x10,%esp
+80109085:	85 c0                	test   %eax,%eax
+80109087:	78 10                	js     80109099 <sys_getpinfo+0x2a>
+        return -1;
+    }
+
+    return getpinfo((struct pstat*) stat);
+80109089:	83 ec 0c             	sub    $0xc,%esp
+8010908c:	ff 75 f4             	push   -0xc(%ebp)
+8010908f:	e8 b5 dd ff ff       	call   80106e49 <getpinfo>
+80109094:	83 c4 10             	add    $0x10,%esp
+}
+80109097:	c9                   	leave
+80109098:	c3                   	ret
+        return -1;
+80109099:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010909e:	eb f7                	jmp    80109097 <sys_getpinfo+0x28>
+
+801090a0 <sys_kmstat>:
+
+int
+sys_kmstat(void)
+{
+801090a0:	55                   	push   %ebp
+801090a1:	89 e5                	mov    %esp,%ebp
+801090a3:	83 ec 1c             	sub    $0x1c,%esp
+  struct kmstat *st;
+
+  if(argptrw(0, (void*)&st, sizeof(*st)) < 0)
+801090a6:	68 08 01 00 00       	push   $0x108
+801090ab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801090ae:	50                   	push   %eax
+801090af:	6a 00                	push   $0x0
+801090b1:	e8 08 ee ff ff       	call   80107ebe <argptrw>
+801090b6:	83 c4 10             	add    $0x10,%esp
+801090b9:	85 c0                	test   %eax,%eax
+801090bb:	78 10                	js     801090cd <sys_kmstat+0x2d>
+    return -1;
+  return kmstat(st);
+801090bd:	83 ec 0c             	sub    $0xc,%esp
+801090c0:	ff 75 f4             	push   -0xc(%ebp)
+801090c3:	e8 e8 ac ff ff       	call   80103db0 <kmstat>
+801090c8:	83 c4 10             	add    $0x10,%esp
+}
+801090cb:	c9                   	leave
+801090cc:	c3                   	ret
+    return -1;
+801090cd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801090d2:	eb f7                	jmp    801090cb <sys_kmstat+0x2b>
+
+801090d4 <sys_slabstat>:
+
+int
+sys_slabstat(void)
+{
+801090d4:	55                   	push   %ebp
+801090d5:	89 e5                	mov    %esp,%ebp
+801090d7:	83 ec 1c             	sub    $0x1c,%esp
+  struct slabstat *st;
+
+  if(argptrw(0, (void*)&st, sizeof(*st)) < 0)
+801090da:	68 64 01 00 00       	push   $0x164
+801090df:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801090e2:	50                   	push   %eax
+801090e3:	6a 00                	push   $0x0
+801090e5:	e8 d4 ed ff ff       	call   80107ebe <argptrw>
+801090ea:	83 c4 10             	add    $0x10,%esp
+801090ed:	85 c0                	test   %eax,%eax
+801090ef:	78 10                	js     80109101 <sys_slabstat+0x2d>
+    return -1;
+  return slabstat(st);
+801090f1:	83 ec 0c             	sub    $0xc,%esp
+801090f4:	ff 75 f4             	push   -0xc(%ebp)
+801090f7:	e8 1a e7 ff ff       	call   80107816 <slabstat>
+801090fc:	83 c4 10             	add    $0x10,%esp
+}
+801090ff:	c9                   	leave
+80109100:	c3                   	ret
+    return -1;
+80109101:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80109106:	eb f7                	jmp    801090ff <sys_slabstat+0x2b>
+
+80109108 <alltraps>:
+
+  # vectors.S sends all traps here.
+.globl alltraps
+alltraps:
+  # Build trap frame.
+  pushl %ds
+80109108:	1e                   	push   %ds
+  pushl %es
+80109109:	06                   	push   %es
+  pushl %fs
+8010910a:	0f a0                	push   %fs
+  pushl %gs
+8010910c:	0f a8                	push   %gs
+  pushal
+8010910e:	60                   	pusha
+  
+  # Set up data segments.
+  movw $(SEG_KDATA<<3), %ax
+8010910f:	66 b8 10 00          	mov    $0x10,%ax
+  movw %ax, %ds
+80109113:	8e d8                	mov    %eax,%ds
+  movw %ax, %es
+80109115:	8e c0                	mov    %eax,%es
+
+  # Call trap(tf), where tf=%esp
+  pushl %esp
+80109117:	54                   	push   %esp
+  call trap
+80109118:	e8 37 01 00 00       	call   80109254 <trap>
+  addl $4, %esp
+8010911d:	83 c4 04             	add    $0x4,%esp
+
+80109120 <trapret>:
+
+  # Return falls through to trapret...
+.globl trapret
+trapret:
+  popal
+80109120:	61                   	popa
+  popl %gs
+80109121:	0f a9                	pop    %gs
+  popl %fs
+80109123:	0f a1                	pop    %fs
+  popl %es
+80109125:	07                   	pop    %es
+  popl %ds
+80109126:	1f                   	pop    %ds
+  addl $0x8, %esp  # trapno and errcode
+80109127:	83 c4 08             	add    $0x8,%esp
+  iret
+8010912a:	cf                   	iret
+
+8010912b <tvinit>:
+struct spinlock tickslock;
+uint ticks;
+
+void
+tvinit(void)
+{
+8010912b:	55                   	push   %ebp
+8010912c:	89 e5                	mov    %esp,%ebp
+8010912e:	53                   	push   %ebx
+8010912f:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for(i = 0; i < 256; i++)
+80109132:	b8 00 00 00 00       	mov    $0x0,%eax
+80109137:	eb 76                	jmp    801091af <tvinit+0x84>
+    SETGATE(idt[i], 0, SEG_KCODE<<3, vectors[i], 0);
+80109139:	8b 0c 85 08 f0 10 80 	mov    -0x7fef0ff8(,%eax,4),%ecx
+80109140:	66 89 0c c5 e0 34 13 	mov    %cx,-0x7feccb20(,%eax,8)
+80109147:	80 
+80109148:	66 c7 04 c5 e2 34 13 	movw   $0x8,-0x7feccb1e(,%eax,8)
+8010914f:	80 08 00 
+80109152:	0f b6 14 c5 e4 34 13 	movzbl -0x7feccb1c(,%eax,8),%edx
+80109159:	80 
+8010915a:	83 e2 e0             	and    $0xffffffe0,%edx
+8010915d:	88 14 c5 e4 34 13 80 	mov    %dl,-0x7feccb1c(,%eax,8)
+80109164:	c6 04 c5 e4 34 13 80 	movb   $0x0,-0x7feccb1c(,%eax,8)
+8010916b:	00 
+8010916c:	0f b6 14 c5 e5 34 13 	movzbl -0x7feccb1b(,%eax,8),%edx
+80109173:	80 
+80109174:	83 e2 f0             	and    $0xfffffff0,%edx
+80109177:	83 ca 0e             	or     $0xe,%edx
+8010917a:	88 14 c5 e5 34 13 80 	mov    %dl,-0x7feccb1b(,%eax,8)
+80109181:	89 d3                	mov    %edx,%ebx
+80109183:	83 e3 ef             	and    $0xffffffef,%ebx
+80109186:	88 1c c5 e5 34 13 80 	mov    %bl,-0x7feccb1b(,%eax,8)
+8010918d:	83 e2 8f             	and    $0xffffff8f,%edx
+80109190:	88 14 c5 e5 34 13 80 	mov    %dl,-0x7feccb1b(,%eax,8)
+80109197:	83 ca 80             	or     $0xffffff80,%edx
+8010919a:	88 14 c5 e5 34 13 80 	mov    %dl,-0x7feccb1b(,%eax,8)
+801091a1:	c1 e9 10             	shr    $0x10,%ecx
+801091a4:	66 89 0c c5 e6 34 13 	mov    %cx,-0x7feccb1a(,%eax,8)
+801091ab:	80 
+  for(i = 0; i < 256; i++)
+801091ac:	83 c0 01             	add    $0x1,%eax
+801091af:	3d ff 00 00 00       	cmp    $0xff,%eax
+801091b4:	7e 83                	jle    80109139 <tvinit+0xe>
+  SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
+801091b6:	8b 15 08 f1 10 80    	mov    0x8010f108,%edx
+801091bc:	66 89 15 e0 36 13 80 	mov    %dx,0x801336e0
+801091c3:	66 c7 05 e2 36 13 80 	movw   $0x8,0x801336e2
+801091ca:	08 00 
+801091cc:	0f b6 05 e4 36 13 80 	movzbl 0x801336e4,%eax
+801091d3:	83 e0 e0             	and    $0xffffffe0,%eax
+801091d6:	a2 e4 36 13 80       	mov    %al,0x801336e4
+801091db:	c6 05 e4 36 13 80 00 	movb   $0x0,0x801336e4
+801091e2:	0f b6 05 e5 36 13 80 	movzbl 0x801336e5,%eax
+801091e9:	83 c8 0f             	or     $0xf,%eax
+801091ec:	a2 e5 36 13 80       	mov    %al,0x801336e5
+801091f1:	83 e0 ef             	and    $0xffffffef,%eax
+801091f4:	a2 e5 36 13 80       	mov    %al,0x801336e5
+801091f9:	89 c1                	mov    %eax,%ecx
+801091fb:	83 c9 60             	or     $0x60,%ecx
+801091fe:	88 0d e5 36 13 80    	mov    %cl,0x801336e5
+80109204:	83 c8 e0             	or     $0xffffffe0,%eax
+80109207:	a2 e5 36 13 80       	mov    %al,0x801336e5
+8010920c:	c1 ea 10             	shr    $0x10,%edx
+8010920f:	66 89 15 e6 36 13 80 	mov    %dx,0x801336e6
+
+  initlock(&tickslock, "time");
+80109216:	83 ec 08             	sub    $0x8,%esp
+80109219:	68 a1 c2 10 80       	push   $0x8010c2a1
+8010921e:	68 a0 34 13 80       	push   $0x801334a0
+80109223:	e8 26 e7 ff ff       	call   8010794e <initlock>
+}
+80109228:	83 c4 10             	add    $0x10,%esp
+8010922b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010922e:	c9                   	leave
+8010922f:	c3                   	ret
+
+80109230 <idtinit>:
+
+void
+idtinit(void)
+{
+80109230:	55                   	push   %ebp
+80109231:	89 e5                	mov    %esp,%ebp
+80109233:	83 ec 10             	sub    $0x10,%esp
+  pd[0] = size-1;
+80109236:	66 c7 45 fa ff 07    	movw   $0x7ff,-0x6(%ebp)
+  pd[1] = (uint)p;
+8010923c:	b8 e0 34 13 80       	mov    $0x801334e0,%eax
+80109241:	66 89 45 fc          	mov    %ax,-0x4(%ebp)
+  pd[2] = (uint)p >> 16;
+80109245:	c1 e8 10             	shr    $0x10,%eax
+80109248:	66 89 45 fe          	mov    %ax,-0x2(%ebp)
+  asm volatile("lidt (%0)" : : "r" (pd));
+8010924c:	8d 45 fa             	lea    -0x6(%ebp),%eax
+8010924f:	0f 01 18             	lidtl  (%eax)
+  lidt(idt, sizeof(idt));
+}
+80109252:	c9                   	leave
+80109253:	c3                   	ret
+
+80109254 <trap>:
+
+void
+trap(struct trapframe *tf)
+{
+80109254:	55                   	push   %ebp
+80109255:	89 e5                	mov    %esp,%ebp
+80109257:	57                   	push   %edi
+80109258:	56                   	push   %esi
+80109259:	53                   	push   %ebx
+8010925a:	83 ec 1c             	sub    $0x1c,%esp
+8010925d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(tf->trapno == T_SYSCALL){
+80109260:	8b 43 30             	mov    0x30(%ebx),%eax
+80109263:	83 f8 40             	cmp    $0x40,%eax
+80109266:	74 24                	je     8010928c <trap+0x38>
+    return;
+  }
+
+  // The virtio disk's vector comes from PCI configuration at
+  // boot, so it can't be a case label.
+  if(virtioirq >= 0 && tf->trapno == T_IRQ0 + virtioirq){
+80109268:	8b 15 08 f4 10 80    	mov    0x8010f408,%edx
+8010926e:	85 d2                	test   %edx,%edx
+80109270:	78 07                	js     80109279 <trap+0x25>
+80109272:	83 c2 20             	add    $0x20,%edx
+80109275:	39 d0                	cmp    %edx,%eax
+80109277:	74 4b                	je     801092c4 <trap+0x70>
+    virtiointr();
+    lapiceoi();
+  } else switch(tf->trapno){
+80109279:	83 e8 0e             	sub    $0xe,%eax
+8010927c:	83 f8 31             	cmp    $0x31,%eax
+8010927f:	0f 87 0e 01 00 00    	ja     80109393 <trap+0x13f>
+80109285:	ff 24 85 48 c3 10 80 	jmp    *-0x7fef3cb8(,%eax,4)
+    if(myproc()->killed)
+8010928c:	e8 7a ca ff ff       	call   80105d0b <myproc>
+80109291:	83 78 24 00          	cmpl   $0x0,0x24(%eax)
+80109295:	75 26                	jne    801092bd <trap+0x69>
+    myproc()->tf = tf;
+80109297:	e8 6f ca ff ff       	call   80105d0b <myproc>
+8010929c:	89 58 18             	mov    %ebx,0x18(%eax)
+    syscall();
+8010929f:	e8 65 ec ff ff       	call   80107f09 <syscall>
+    if(myproc()->killed)
+801092a4:	e8 62 ca ff ff       	call   80105d0b <myproc>
+801092a9:	83 78 24 00          	cmpl   $0x0,0x24(%eax)
+801092ad:	0f 84 a1 01 00 00    	je     80109454 <trap+0x200>
+      exit();
+801092b3:	e8 57 d1 ff ff       	call   8010640f <exit>
+    return;
+801092b8:	e9 97 01 00 00       	jmp    80109454 <trap+0x200>
+      exit();
+801092bd:	e8 4d d1 ff ff       	call   8010640f <exit>
+801092c2:	eb d3                	jmp    80109297 <trap+0x43>
+    virtiointr();
+801092c4:	e8 a7 11 00 00       	call   8010a470 <virtiointr>
+    lapiceoi();
+801092c9:	e8 7c ae ff ff       	call   8010414a <lapiceoi>
+801092ce:	e9 2b 01 00 00       	jmp    801093fe <trap+0x1aa>
+  case T_IRQ0 + IRQ_TIMER:
+    if(cpuid() == 0){
+801092d3:	e8 18 ca ff ff       	call   80105cf0 <cpuid>
+801092d8:	85 c0                	test   %eax,%eax
+801092da:	74 0a                	je     801092e6 <trap+0x92>
+      acquire(&tickslock);
+      ticks++;
+      wakeup(&ticks);
+      release(&tickslock);
+    }
+    lapiceoi();
+801092dc:	e8 69 ae ff ff       	call   8010414a <lapiceoi>
+    break;
+801092e1:	e9 18 01 00 00       	jmp    801093fe <trap+0x1aa>
+      acquire(&tickslock);
+801092e6:	83 ec 0c             	sub    $0xc,%esp
+801092e9:	68 a0 34 13 80       	push   $0x801334a0
+801092ee:	e8 9f e7 ff ff       	call   80107a92 <acquire>
+      ticks++;
+801092f3:	83 05 80 34 13 80 01 	addl   $0x1,0x80133480
+      wakeup(&ticks);
+801092fa:	c7 04 24 80 34 13 80 	movl   $0x80133480,(%esp)
+80109301:	e8 2f d5 ff ff       	call   80106835 <wakeup>
+      release(&tickslock);
+80109306:	c7 04 24 a0 34 13 80 	movl   $0x801334a0,(%esp)
+8010930d:	e8 e5 e7 ff ff       	call   80107af7 <release>
+80109312:	83 c4 10             	add    $0x10,%esp
+80109315:	eb c5                	jmp    801092dc <trap+0x88>
+  case T_IRQ0 + IRQ_IDE:
+    ideintr();
+80109317:	e8 36 9c ff ff       	call   80102f52 <ideintr>
+    lapiceoi();
+8010931c:	e8 29 ae ff ff       	call   8010414a <lapiceoi>
+    break;
+80109321:	e9 d8 00 00 00       	jmp    801093fe <trap+0x1aa>
+  case T_IRQ0 + IRQ_IDE+1:
+    // Bochs generates spurious IDE1 interrupts.
+    break;
+  case T_IRQ0 + IRQ_KBD:
+    kbdintr();
+80109326:	e8 69 ac ff ff       	call   80103f94 <kbdintr>
+    lapiceoi();
+8010932b:	e8 1a ae ff ff       	call   8010414a <lapiceoi>
+    break;
+80109330:	e9 c9 00 00 00       	jmp    801093fe <trap+0x1aa>
+  case T_IRQ0 + IRQ_COM1:
+    uartintr();
+80109335:	e8 78 02 00 00       	call   801095b2 <uartintr>
+    lapiceoi();
+8010933a:	e8 0b ae ff ff       	call   8010414a <lapiceoi>
+    break;
+8010933f:	e9 ba 00 00 00       	jmp    801093fe <trap+0x1aa>
+  case T_IRQ0 + 7:
+  case T_IRQ0 + IRQ_SPURIOUS:
+    cprintf("cpu%d: spurious interrupt at %x:%x\n",
+80109344:	8b 7b 38             	mov    0x38(%ebx),%edi
+            cpuid(), tf->cs, tf->eip);
+80109347:	0f b7 73 3c          	movzwl 0x3c(%ebx),%esi
+    cprintf("cpu%d: spurious interrupt at %x:%x\n",
+8010934b:	e8 a0 c9 ff ff       	call   80105cf0 <cpuid>
+80109350:	57                   	push   %edi
+80109351:	0f b7 f6             	movzwl %si,%esi
+80109354:	56                   	push   %esi
+80109355:	50                   	push   %eax
+80109356:	68 ac c2 10 80       	push   $0x8010c2ac
+8010935b:	e8 8c 7c ff ff       	call   80100fec <cprintf>
+    lapiceoi();
+80109360:	e8 e5 ad ff ff       	call   8010414a <lapiceoi>
+    break;
+80109365:	83 c4 10             	add    $0x10,%esp
+80109368:	e9 91 00 00 00       	jmp    801093fe <trap+0x1aa>
+
+  case T_PGFLT:
+    // A first touch of a heap page or a write to a page shared
+    // copy-on-write, either from user code or from the kernel
+    // using a user buffer.
+    if(myproc() && pagefault(myproc(), rcr2(), tf->err) == 0)
+8010936d:	e8 99 c9 ff ff       	call   80105d0b <myproc>
+80109372:	85 c0                	test   %eax,%eax
+80109374:	74 1d                	je     80109393 <trap+0x13f>
+80109376:	8b 7b 34             	mov    0x34(%ebx),%edi
+
+static inline uint
+rcr2(void)
+{
+  uint val;
+  asm volatile("movl %%cr2,%0" : "=r" (val));
+80109379:	0f 20 d6             	mov    %cr2,%esi
+8010937c:	e8 8a c9 ff ff       	call   80105d0b <myproc>
+80109381:	83 ec 04             	sub    $0x4,%esp
+80109384:	57                   	push   %edi
+80109385:	56                   	push   %esi
+80109386:	50                   	push   %eax
+80109387:	e8 55 23 00 00       	call   8010b6e1 <pagefault>
+8010938c:	83 c4 10             	add    $0x10,%esp
+8010938f:	85 c0                	test   %eax,%eax
+80109391:	74 6b                	je     801093fe <trap+0x1aa>
+      break;
+    // Otherwise a real fault: fall through.
+  default:
+    if(myproc() == 0 || (tf->cs&3) == 0){
+80109393:	e8 73 c9 ff ff       	call   80105d0b <myproc>
+80109398:	85 c0                	test   %eax,%eax
+8010939a:	0f 84 bc 00 00 00    	je     8010945c <trap+0x208>
+801093a0:	f6 43 3c 03          	testb  $0x3,0x3c(%ebx)
+801093a4:	0f 84 b2 00 00 00    	je     8010945c <trap+0x208>
+801093aa:	0f 20 d7             	mov    %cr2,%edi
+      cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
+              tf->trapno, cpuid(), tf->eip, rcr2());
+      panic("trap");
+    }
+    // In user space, assume process misbehaved.
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+801093ad:	8b 43 38             	mov    0x38(%ebx),%eax
+801093b0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801093b3:	e8 38 c9 ff ff       	call   80105cf0 <cpuid>
+801093b8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801093bb:	8b 4b 34             	mov    0x34(%ebx),%ecx
+801093be:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+801093c1:	8b 73 30             	mov    0x30(%ebx),%esi
+            "eip 0x%x addr 0x%x--kill proc\n",
+            myproc()->pid, myproc()->name, tf->trapno,
+801093c4:	e8 42 c9 ff ff       	call   80105d0b <myproc>
+801093c9:	8d 50 6c             	lea    0x6c(%eax),%edx
+801093cc:	89 55 d8             	mov    %edx,-0x28(%ebp)
+801093cf:	e8 37 c9 ff ff       	call   80105d0b <myproc>
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+801093d4:	57                   	push   %edi
+801093d5:	ff 75 e4             	push   -0x1c(%ebp)
+801093d8:	ff 75 e0             	push   -0x20(%ebp)
+801093db:	ff 75 dc             	push   -0x24(%ebp)
+801093de:	56                   	push   %esi
+801093df:	ff 75 d8             	push   -0x28(%ebp)
+801093e2:	ff 70 10             	push   0x10(%eax)
+801093e5:	68 04 c3 10 80       	push   $0x8010c304
+801093ea:	e8 fd 7b ff ff       	call   80100fec <cprintf>
+            tf->err, cpuid(), tf->eip, rcr2());
+    myproc()->killed = 1;
+801093ef:	83 c4 20             	add    $0x20,%esp
+801093f2:	e8 14 c9 ff ff       	call   80105d0b <myproc>
+801093f7:	c7 40 24 01 00 00 00 	movl   $0x1,0x24(%eax)
+  }
+
+  // Force process exit if it has been killed and is in user space.
+  // (If it is still executing in the kernel, let it keep running
+  // until it gets to the regular system call return.)
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER) {
+801093fe:	e8 08 c9 ff ff       	call   80105d0b <myproc>
+80109403:	85 c0                	test   %eax,%eax
+80109405:	74 18                	je     8010941f <trap+0x1cb>
+80109407:	e8 ff c8 ff ff       	call   80105d0b <myproc>
+8010940c:	83 78 24 00          	cmpl   $0x0,0x24(%eax)
+80109410:	74 0d                	je     8010941f <trap+0x1cb>
+80109412:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+80109416:	83 e0 03             	and    $0x3,%eax
+80109419:	66 83 f8 03          	cmp    $0x3,%ax
+8010941d:	74 68                	je     80109487 <trap+0x233>
+      exit();
+  }
+
+  // Force process to give up CPU on clock tick.
+  // If interrupts were on while locks held, would need to check nlock.
+  if(myproc() && myproc()->state == RUNNING &&
+8010941f:	e8 e7 c8 ff ff       	call   80105d0b <myproc>
+80109424:	85 c0                	test   %eax,%eax
+80109426:	74 0b                	je     80109433 <trap+0x1df>
+80109428:	e8 de c8 ff ff       	call   80105d0b <myproc>
+8010942d:	83 78 0c 04          	cmpl   $0x4,0xc(%eax)
+80109431:	74 5b                	je     8010948e <trap+0x23a>
+     tf->trapno == T_IRQ0+IRQ_TIMER)
+    yield();
+
+  // Check if the process has been killed since we yielded
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER) {
+80109433:	e8 d3 c8 ff ff       	call   80105d0b <myproc>
+80109438:	85 c0                	test   %eax,%eax
+8010943a:	74 18                	je     80109454 <trap+0x200>
+8010943c:	e8 ca c8 ff ff       	call   80105d0b <myproc>
+80109441:	83 78 24 00          	cmpl   $0x0,0x24(%eax)
+80109445:	74 0d                	je     80109454 <trap+0x200>
+80109447:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+8010944b:	83 e0 03             	and    $0x3,%eax
+8010944e:	66 83 f8 03          	cmp    $0x3,%ax
+80109452:	74 47                	je     8010949b <trap+0x247>
+      exit();
+  }
+}
+80109454:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109457:	5b                   	pop    %ebx
+80109458:	5e                   	pop    %esi
+80109459:	5f                   	pop    %edi
+8010945a:	5d                   	pop    %ebp
+8010945b:	c3                   	ret
+8010945c:	0f 20 d7             	mov    %cr2,%edi
+      cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
+8010945f:	8b 73 38             	mov    0x38(%ebx),%esi
+80109462:	e8 89 c8 ff ff       	call   80105cf0 <cpuid>
+80109467:	83 ec 0c             	sub    $0xc,%esp
+8010946a:	57                   	push   %edi
+8010946b:	56                   	push   %esi
+8010946c:	50                   	push   %eax
+8010946d:	ff 73 30             	push   0x30(%ebx)
+80109470:	68 d0 c2 10 80       	push   $0x8010c2d0
+80109475:	e8 72 7b ff ff       	call   80100fec <cprintf>
+      panic("trap");
+8010947a:	83 c4 14             	add    $0x14,%esp
+8010947d:	68 a6 c2 10 80       	push   $0x8010c2a6
+80109482:	e8 a4 78 ff ff       	call   80100d2b <panic>
+      exit();
+80109487:	e8 83 cf ff ff       	call   8010640f <exit>
+8010948c:	eb 91                	jmp    8010941f <trap+0x1cb>
+  if(myproc() && myproc()->state == RUNNING &&
+8010948e:	83 7b 30 20          	cmpl   $0x20,0x30(%ebx)
+80109492:	75 9f                	jne    80109433 <trap+0x1df>
+    yield();
+80109494:	e8 9b d0 ff ff       	call   80106534 <yield>
+80109499:	eb 98                	jmp    80109433 <trap+0x1df>
+      exit();
+8010949b:	e8 6f cf ff ff       	call   8010640f <exit>
+801094a0:	eb b2                	jmp    80109454 <trap+0x200>
+
+801094a2 <uartgetc>:
+}
+
+static int
+uartgetc(void)
+{
+  if(!uart)
+801094a2:	83 3d e0 3c 13 80 00 	cmpl   $0x0,0x80133ce0
+801094a9:	74 14                	je     801094bf <uartgetc+0x1d>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801094ab:	ba fd 03 00 00       	mov    $0x3fd,%edx
+801094b0:	ec                   	in     (%dx),%al
+    return -1;
+  if(!(inb(COM1+5) & 0x01))
+801094b1:	a8 01                	test   $0x1,%al
+801094b3:	74 10                	je     801094c5 <uartgetc+0x23>
+801094b5:	ba f8 03 00 00       	mov    $0x3f8,%edx
+801094ba:	ec                   	in     (%dx),%al
+    return -1;
+  return inb(COM1+0);
+801094bb:	0f b6 c0             	movzbl %al,%eax
+801094be:	c3                   	ret
+    return -1;
+801094bf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801094c4:	c3                   	ret
+    return -1;
+801094c5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801094ca:	c3                   	ret
+
+801094cb <uartputc>:
+  if(!uart)
+801094cb:	83 3d e0 3c 13 80 00 	cmpl   $0x0,0x80133ce0
+801094d2:	74 3b                	je     8010950f <uartputc+0x44>
+{
+801094d4:	55                   	push   %ebp
+801094d5:	89 e5                	mov    %esp,%ebp
+801094d7:	53                   	push   %ebx
+801094d8:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+801094db:	bb 00 00 00 00       	mov    $0x0,%ebx
+801094e0:	eb 10                	jmp    801094f2 <uartputc+0x27>
+    microdelay(10);
+801094e2:	83 ec 0c             	sub    $0xc,%esp
+801094e5:	6a 0a                	push   $0xa
+801094e7:	e8 7f ac ff ff       	call   8010416b <microdelay>
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+801094ec:	83 c3 01             	add    $0x1,%ebx
+801094ef:	83 c4 10             	add    $0x10,%esp
+801094f2:	83 fb 7f             	cmp    $0x7f,%ebx
+801094f5:	7f 0a                	jg     80109501 <uartputc+0x36>
+801094f7:	ba fd 03 00 00       	mov    $0x3fd,%edx
+801094fc:	ec                   	in     (%dx),%al
+801094fd:	a8 20                	test   $0x20,%al
+801094ff:	74 e1                	je     801094e2 <uartputc+0x17>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109501:	8b 45 08             	mov    0x8(%ebp),%eax
+80109504:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109509:	ee                   	out    %al,(%dx)
+}
+8010950a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010950d:	c9                   	leave
+8010950e:	c3                   	ret
+8010950f:	c3                   	ret
+
+80109510 <uartinit>:
+{
+80109510:	55                   	push   %ebp
+80109511:	89 e5                	mov    %esp,%ebp
+80109513:	56                   	push   %esi
+80109514:	53                   	push   %ebx
+80109515:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010951a:	ba fa 03 00 00       	mov    $0x3fa,%edx
+8010951f:	89 c8                	mov    %ecx,%eax
+80109521:	ee                   	out    %al,(%dx)
+80109522:	be fb 03 00 00       	mov    $0x3fb,%esi
+80109527:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+8010952c:	89 f2                	mov    %esi,%edx
+8010952e:	ee                   	out    %al,(%dx)
+8010952f:	b8 0c 00 00 00       	mov    $0xc,%eax
+80109534:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109539:	ee                   	out    %al,(%dx)
+8010953a:	bb f9 03 00 00       	mov    $0x3f9,%ebx
+8010953f:	89 c8                	mov    %ecx,%eax
+80109541:	89 da                	mov    %ebx,%edx
+80109543:	ee                   	out    %al,(%dx)
+80109544:	b8 03 00 00 00       	mov    $0x3,%eax
+80109549:	89 f2                	mov    %esi,%edx
+8010954b:	ee                   	out    %al,(%dx)
+8010954c:	ba fc 03 00 00       	mov    $0x3fc,%edx
+80109551:	89 c8                	mov    %ecx,%eax
+80109553:	ee                   	out    %al,(%dx)
+80109554:	b8 01 00 00 00       	mov    $0x1,%eax
+80109559:	89 da                	mov    %ebx,%edx
+8010955b:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010955c:	ba fd 03 00 00       	mov    $0x3fd,%edx
+80109561:	ec                   	in     (%dx),%al
+  if(inb(COM1+5) == 0xFF)
+80109562:	3c ff                	cmp    $0xff,%al
+80109564:	74 45                	je     801095ab <uartinit+0x9b>
+  uart = 1;
+80109566:	c7 05 e0 3c 13 80 01 	movl   $0x1,0x80133ce0
+8010956d:	00 00 00 
+80109570:	ba fa 03 00 00       	mov    $0x3fa,%edx
+80109575:	ec                   	in     (%dx),%al
+80109576:	ba f8 03 00 00       	mov    $0x3f8,%edx
+8010957b:	ec                   	in     (%dx),%al
+  ioapicenable(IRQ_COM1, 0);
+8010957c:	83 ec 08             	sub    $0x8,%esp
+8010957f:	6a 00                	push   $0x0
+80109581:	6a 04                	push   $0x4
+80109583:	e8 b5 9c ff ff       	call   8010323d <ioapicenable>
+  for(p="xv6...\n"; *p; p++)
+80109588:	83 c4 10             	add    $0x10,%esp
+8010958b:	bb 10 c4 10 80       	mov    $0x8010c410,%ebx
+80109590:	eb 12                	jmp    801095a4 <uartinit+0x94>
+    uartputc(*p);
+80109592:	83 ec 0c             	sub    $0xc,%esp
+80109595:	0f be c0             	movsbl %al,%eax
+80109598:	50                   	push   %eax
+80109599:	e8 2d ff ff ff       	call   801094cb <uartputc>
+  for(p="xv6...\n"; *p; p++)
+8010959e:	83 c3 01             	add    $0x1,%ebx
+801095a1:	83 c4 10             	add    $0x10,%esp
+801095a4:	0f b6 03             	movzbl (%ebx),%eax
+801095a7:	84 c0                	test   %al,%al
+801095a9:	75 e7                	jne    80109592 <uartinit+0x82>
+}
+801095ab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801095ae:	5b                   	pop    %ebx
+801095af:	5e                   	pop    %esi
+801095b0:	5d                   	pop    %ebp
+801095b1:	c3                   	ret
+
+801095b2 <uartintr>:
+
+void
+uartintr(void)
+{
+801095b2:	55                   	push   %ebp
+801095b3:	89 e5                	mov    %esp,%ebp
+801095b5:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(uartgetc);
+801095b8:	68 a2 94 10 80       	push   $0x801094a2
+801095bd:	e8 56 7b ff ff       	call   80101118 <consoleintr>
+}
+801095c2:	83 c4 10             	add    $0x10,%esp
+801095c5:	c9                   	leave
+801095c6:	c3                   	ret
+
+801095c7 <vector0>:
+# generated by vectors.pl - do not edit
+# handlers
+.globl alltraps
+.globl vector0
+vector0:
+  pushl $0
+801095c7:	6a 00                	push   $0x0
+  pushl $0
+801095c9:	6a 00                	push   $0x0
+  jmp alltraps
+801095cb:	e9 38 fb ff ff       	jmp    80109108 <alltraps>
+
+801095d0 <vector1>:
+.globl vector1
+vector1:
+  pushl $0
+801095d0:	6a 00                	push   $0x0
+  pushl $1
+801095d2:	6a 01                	push   $0x1
+  jmp alltraps
+801095d4:	e9 2f fb ff ff       	jmp    80109108 <alltraps>
+
+801095d9 <vector2>:
+.globl vector2
+vector2:
+  pushl $0
+801095d9:	6a 00                	push   $0x0
+  pushl $2
+801095db:	6a 02                	push   $0x2
+  jmp alltraps
+801095dd:	e9 26 fb ff ff       	jmp    80109108 <alltraps>
+
+801095e2 <vector3>:
+.globl vector3
+vector3:
+  pushl $0
+801095e2:	6a 00                	push   $0x0
+  pushl $3
+801095e4:	6a 03                	push   $0x3
+  jmp alltraps
+801095e6:	e9 1d fb ff ff       	jmp    80109108 <alltraps>
+
+801095eb <vector4>:
+.globl vector4
+vector4:
+  pushl $0
+801095eb:	6a 00                	push   $0x0
+  pushl $4
+801095ed:	6a 04                	push   $0x4
+  jmp alltraps
+801095ef:	e9 14 fb ff ff       	jmp    80109108 <alltraps>
+
+801095f4 <vector5>:
+.globl vector5
+vector5:
+  pushl $0
+801095f4:	6a 00                	push   $0x0
+  pushl $5
+801095f6:	6a 05                	push   $0x5
+  jmp alltraps
+801095f8:	e9 0b fb ff ff       	jmp    80109108 <alltraps>
+
+801095fd <vector6>:
+.globl vector6
+vector6:
+  pushl $0
+801095fd:	6a 00                	push   $0x0
+  pushl $6
+801095ff:	6a 06                	push   $0x6
+  jmp alltraps
+80109601:	e9 02 fb ff ff       	jmp    80109108 <alltraps>
+
+80109606 <vector7>:
+.globl vector7
+vector7:
+  pushl $0
+80109606:	6a 00                	push   $0x0
+  pushl $7
+80109608:	6a 07                	push   $0x7
+  jmp alltraps
+8010960a:	e9 f9 fa ff ff       	jmp    80109108 <alltraps>
+
+8010960f <vector8>:
+.globl vector8
+vector8:
+  pushl $8
+8010960f:	6a 08                	push   $0x8
+  jmp alltraps
+80109611:	e9 f2 fa ff ff       	jmp    80109108 <alltraps>
+
+80109616 <vector9>:
+.globl vector9
+vector9:
+  pushl $0
+80109616:	6a 00                	push   $0x0
+  pushl $9
+80109618:	6a 09                	push   $0x9
+  jmp alltraps
+8010961a:	e9 e9 fa ff ff       	jmp    80109108 <alltraps>
+
+8010961f <vector10>:
+.globl vector10
+vector10:
+  pushl $10
+8010961f:	6a 0a                	push   $0xa
+  jmp alltraps
+80109621:	e9 e2 fa ff ff       	jmp    80109108 <alltraps>
+
+80109626 <vector11>:
+.globl vector11
+vector11:
+  pushl $11
+80109626:	6a 0b                	push   $0xb
+  jmp alltraps
+80109628:	e9 db fa ff ff       	jmp    80109108 <alltraps>
+
+8010962d <vector12>:
+.globl vector12
+vector12:
+  pushl $12
+8010962d:	6a 0c                	push   $0xc
+  jmp alltraps
+8010962f:	e9 d4 fa ff ff       	jmp    80109108 <alltraps>
+
+80109634 <vector13>:
+.globl vector13
+vector13:
+  pushl $13
+80109634:	6a 0d                	push   $0xd
+  jmp alltraps
+80109636:	e9 cd fa ff ff       	jmp    80109108 <alltraps>
+
+8010963b <vector14>:
+.globl vector14
+vector14:
+  pushl $14
+8010963b:	6a 0e                	push   $0xe
+  jmp alltraps
+8010963d:	e9 c6 fa ff ff       	jmp    80109108 <alltraps>
+
+80109642 <vector15>:
+.globl vector15
+vector15:
+  pushl $0
+80109642:	6a 00                	push   $0x0
+  pushl $15
+80109644:	6a 0f                	push   $0xf
+  jmp alltraps
+80109646:	e9 bd fa ff ff       	jmp    80109108 <alltraps>
+
+8010964b <vector16>:
+.globl vector16
+vector16:
+  pushl $0
+8010964b:	6a 00                	push   $0x0
+  pushl $16
+8010964d:	6a 10                	push   $0x10
+  jmp alltraps
+8010964f:	e9 b4 fa ff ff       	jmp    80109108 <alltraps>
+
+80109654 <vector17>:
+.globl vector17
+vector17:
+  pushl $17
+80109654:	6a 11                	push   $0x11
+  jmp alltraps
+80109656:	e9 ad fa ff ff       	jmp    80109108 <alltraps>
+
+8010965b <vector18>:
+.globl vector18
+vector18:
+  pushl $0
+8010965b:	6a 00                	push   $0x0
+  pushl $18
+8010965d:	6a 12                	push   $0x12
+  jmp alltraps
+8010965f:	e9 a4 fa ff ff       	jmp    80109108 <alltraps>
+
+80109664 <vector19>:
+.globl vector19
+vector19:
+  pushl $0
+80109664:	6a 00                	push   $0x0
+  pushl $19
+80109666:	6a 13                	push   $0x13
+  jmp alltraps
+80109668:	e9 9b fa ff ff       	jmp    80109108 <alltraps>
+
+8010966d <vector20>:
+.globl vector20
+vector20:
+  pushl $0
+8010966d:	6a 00                	push   $0x0
+  pushl $20
+8010966f:	6a 14                	push   $0x14
+  jmp alltraps
+80109671:	e9 92 fa ff ff       	jmp    80109108 <alltraps>
+
+80109676 <vector21>:
+.globl vector21
+vector21:
+  pushl $0
+80109676:	6a 00                	push   $0x0
+  pushl $21
+80109678:	6a 15                	push   $0x15
+  jmp alltraps
+8010967a:	e9 89 fa ff ff       	jmp    80109108 <alltraps>
+
+8010967f <vector22>:
+.globl vector22
+vector22:
+  pushl $0
+8010967f:	6a 00                	push   $0x0
+  pushl $22
+80109681:	6a 16                	push   $0x16
+  jmp alltraps
+80109683:	e9 80 fa ff ff       	jmp    80109108 <alltraps>
+
+80109688 <vector23>:
+.globl vector23
+vector23:
+  pushl $0
+80109688:	6a 00                	push   $0x0
+  pushl $23
+8010968a:	6a 17                	push   $0x17
+  jmp alltraps
+8010968c:	e9 77 fa ff ff       	jmp    80109108 <alltraps>
+
+80109691 <vector24>:
+.globl vector24
+vector24:
+  pushl $0
+80109691:	6a 00                	push   $0x0
+  pushl $24
+80109693:	6a 18                	push   $0x18
+  jmp alltraps
+80109695:	e9 6e fa ff ff       	jmp    80109108 <alltraps>
+
+8010969a <vector25>:
+.globl vector25
+vector25:
+  pushl $0
+8010969a:	6a 00                	push   $0x0
+  pushl $25
+8010969c:	6a 19                	push   $0x19
+  jmp alltraps
+8010969e:	e9 65 fa ff ff       	jmp    80109108 <alltraps>
+
+801096a3 <vector26>:
+.globl vector26
+vector26:
+  pushl $0
+801096a3:	6a 00                	push   $0x0
+  pushl $26
+801096a5:	6a 1a                	push   $0x1a
+  jmp alltraps
+801096a7:	e9 5c fa ff ff       	jmp    80109108 <alltraps>
+
+801096ac <vector27>:
+.globl vector27
+vector27:
+  pushl $0
+801096ac:	6a 00                	push   $0x0
+  pushl $27
+801096ae:	6a 1b                	push   $0x1b
+  jmp alltraps
+801096b0:	e9 53 fa ff ff       	jmp    80109108 <alltraps>
+
+801096b5 <vector28>:
+.globl vector28
+vector28:
+  pushl $0
+801096b5:	6a 00                	push   $0x0
+  pushl $28
+801096b7:	6a 1c                	push   $0x1c
+  jmp alltraps
+801096b9:	e9 4a fa ff ff       	jmp    80109108 <alltraps>
+
+801096be <vector29>:
+.globl vector29
+vector29:
+  pushl $0
+801096be:	6a 00                	push   $0x0
+  pushl $29
+801096c0:	6a 1d                	push   $0x1d
+  jmp alltraps
+801096c2:	e9 41 fa ff ff       	jmp    80109108 <alltraps>
+
+801096c7 <vector30>:
+.globl vector30
+vector30:
+  pushl $0
+801096c7:	6a 00                	push   $0x0
+  pushl $30
+801096c9:	6a 1e                	push   $0x1e
+  jmp alltraps
+801096cb:	e9 38 fa ff ff       	jmp    80109108 <alltraps>
+
+801096d0 <vector31>:
+.globl vector31
+vector31:
+  pushl $0
+801096d0:	6a 00                	push   $0x0
+  pushl $31
+801096d2:	6a 1f                	push   $0x1f
+  jmp alltraps
+801096d4:	e9 2f fa ff ff       	jmp    80109108 <alltraps>
+
+801096d9 <vector32>:
+.globl vector32
+vector32:
+  pushl $0
+801096d9:	6a 00                	push   $0x0
+  pushl $32
+801096db:	6a 20                	push   $0x20
+  jmp alltraps
+801096dd:	e9 26 fa ff ff       	jmp    80109108 <alltraps>
+
+801096e2 <vector33>:
+.globl vector33
+vector33:
+  pushl $0
+801096e2:	6a 00                	push   $0x0
+  pushl $33
+801096e4:	6a 21                	push   $0x21
+  jmp alltraps
+801096e6:	e9 1d fa ff ff       	jmp    80109108 <alltraps>
+
+801096eb <vector34>:
+.globl vector34
+vector34:
+  pushl $0
+801096eb:	6a 00                	push   $0x0
+  pushl $34
+801096ed:	6a 22                	push   $0x22
+  jmp alltraps
+801096ef:	e9 14 fa ff ff       	jmp    80109108 <alltraps>
+
+801096f4 <vector35>:
+.globl vector35
+vector35:
+  pushl $0
+801096f4:	6a 00                	push   $0x0
+  pushl $35
+801096f6:	6a 23                	push   $0x23
+  jmp alltraps
+801096f8:	e9 0b fa ff ff       	jmp    80109108 <alltraps>
+
+801096fd <vector36>:
+.globl vector36
+vector36:
+  pushl $0
+801096fd:	6a 00                	push   $0x0
+  pushl $36
+801096ff:	6a 24                	push   $0x24
+  jmp alltraps
+80109701:	e9 02 fa ff ff       	jmp    80109108 <alltraps>
+
+80109706 <vector37>:
+.globl vector37
+vector37:
+  pushl $0
+80109706:	6a 00                	push   $0x0
+  pushl $37
+80109708:	6a 25                	push   $0x25
+  jmp alltraps
+8010970a:	e9 f9 f9 ff ff       	jmp    80109108 <alltraps>
+
+8010970f <vector38>:
+.globl vector38
+vector38:
+  pushl $0
+8010970f:	6a 00                	push   $0x0
+  pushl $38
+80109711:	6a 26                	push   $0x26
+  jmp alltraps
+80109713:	e9 f0 f9 ff ff       	jmp    80109108 <alltraps>
+
+80109718 <vector39>:
+.globl vector39
+vector39:
+  pushl $0
+80109718:	6a 00                	push   $0x0
+  pushl $39
+8010971a:	6a 27                	push   $0x27
+  jmp alltraps
+8010971c:	e9 e7 f9 ff ff       	jmp    80109108 <alltraps>
+
+80109721 <vector40>:
+.globl vector40
+vector40:
+  pushl $0
+80109721:	6a 00                	push   $0x0
+  pushl $40
+80109723:	6a 28                	push   $0x28
+  jmp alltraps
+80109725:	e9 de f9 ff ff       	jmp    80109108 <alltraps>
+
+8010972a <vector41>:
+.globl vector41
+vector41:
+  pushl $0
+8010972a:	6a 00                	push   $0x0
+  pushl $41
+8010972c:	6a 29                	push   $0x29
+  jmp alltraps
+8010972e:	e9 d5 f9 ff ff       	jmp    80109108 <alltraps>
+
+80109733 <vector42>:
+.globl vector42
+vector42:
+  pushl $0
+80109733:	6a 00                	push   $0x0
+  pushl $42
+80109735:	6a 2a                	push   $0x2a
+  jmp alltraps
+80109737:	e9 cc f9 ff ff       	jmp    80109108 <alltraps>
+
+8010973c <vector43>:
+.globl vector43
+vector43:
+  pushl $0
+8010973c:	6a 00                	push   $0x0
+  pushl $43
+8010973e:	6a 2b                	push   $0x2b
+  jmp alltraps
+80109740:	e9 c3 f9 ff ff       	jmp    80109108 <alltraps>
+
+80109745 <vector44>:
+.globl vector44
+vector44:
+  pushl $0
+80109745:	6a 00                	push   $0x0
+  pushl $44
+80109747:	6a 2c                	push   $0x2c
+  jmp alltraps
+80109749:	e9 ba f9 ff ff       	jmp    80109108 <alltraps>
+
+8010974e <vector45>:
+.globl vector45
+vector45:
+  pushl $0
+8010974e:	6a 00                	push   $0x0
+  pushl $45
+80109750:	6a 2d                	push   $0x2d
+  jmp alltraps
+80109752:	e9 b1 f9 ff ff       	jmp    80109108 <alltraps>
+
+80109757 <vector46>:
+.globl vector46
+vector46:
+  pushl $0
+80109757:	6a 00                	push   $0x0
+  pushl $46
+80109759:	6a 2e                	push   $0x2e
+  jmp alltraps
+8010975b:	e9 a8 f9 ff ff       	jmp    80109108 <alltraps>
+
+80109760 <vector47>:
+.globl vector47
+vector47:
+  pushl $0
+80109760:	6a 00                	push   $0x0
+  pushl $47
+80109762:	6a 2f                	push   $0x2f
+  jmp alltraps
+80109764:	e9 9f f9 ff ff       	jmp    80109108 <alltraps>
+
+80109769 <vector48>:
+.globl vector48
+vector48:
+  pushl $0
+80109769:	6a 00                	push   $0x0
+  pushl $48
+8010976b:	6a 30                	push   $0x30
+  jmp alltraps
+8010976d:	e9 96 f9 ff ff       	jmp    80109108 <alltraps>
+
+80109772 <vector49>:
+.globl vector49
+vector49:
+  pushl $0
+80109772:	6a 00                	push   $0x0
+  pushl $49
+80109774:	6a 31                	push   $0x31
+  jmp alltraps
+80109776:	e9 8d f9 ff ff       	jmp    80109108 <alltraps>
+
+8010977b <vector50>:
+.globl vector50
+vector50:
+  pushl $0
+8010977b:	6a 00                	push   $0x0
+  pushl $50
+8010977d:	6a 32                	push   $0x32
+  jmp alltraps
+8010977f:	e9 84 f9 ff ff       	jmp    80109108 <alltraps>
+
+80109784 <vector51>:
+.globl vector51
+vector51:
+  pushl $0
+80109784:	6a 00                	push   $0x0
+  pushl $51
+80109786:	6a 33                	push   $0x33
+  jmp alltraps
+80109788:	e9 7b f9 ff ff       	jmp    80109108 <alltraps>
+
+8010978d <vector52>:
+.globl vector52
+vector52:
+  pushl $0
+8010978d:	6a 00                	push   $0x0
+  pushl $52
+8010978f:	6a 34                	push   $0x34
+  jmp alltraps
+80109791:	e9 72 f9 ff ff       	jmp    80109108 <alltraps>
+
+80109796 <vector53>:
+.globl vector53
+vector53:
+  pushl $0
+80109796:	6a 00                	push   $0x0
+  pushl $53
+80109798:	6a 35                	push   $0x35
+  jmp alltraps
+8010979a:	e9 69 f9 ff ff       	jmp    80109108 <alltraps>
+
+8010979f <vector54>:
+.globl vector54
+vector54:
+  pushl $0
+8010979f:	6a 00                	push   $0x0
+  pushl $54
+801097a1:	6a 36                	push   $0x36
+  jmp alltraps
+801097a3:	e9 60 f9 ff ff       	jmp    80109108 <alltraps>
+
+801097a8 <vector55>:
+.globl vector55
+vector55:
+  pushl $0
+801097a8:	6a 00                	push   $0x0
+  pushl $55
+801097aa:	6a 37                	push   $0x37
+  jmp alltraps
+801097ac:	e9 57 f9 ff ff       	jmp    80109108 <alltraps>
+
+801097b1 <vector56>:
+.globl vector56
+vector56:
+  pushl $0
+801097b1:	6a 00                	push   $0x0
+  pushl $56
+801097b3:	6a 38                	push   $0x38
+  jmp alltraps
+801097b5:	e9 4e f9 ff ff       	jmp    80109108 <alltraps>
+
+801097ba <vector57>:
+.globl vector57
+vector57:
+  pushl $0
+801097ba:	6a 00                	push   $0x0
+  pushl $57
+801097bc:	6a 39                	push   $0x39
+  jmp alltraps
+801097be:	e9 45 f9 ff ff       	jmp    80109108 <alltraps>
+
+801097c3 <vector58>:
+.globl vector58
+vector58:
+  pushl $0
+801097c3:	6a 00                	push   $0x0
+  pushl $58
+801097c5:	6a 3a                	push   $0x3a
+  jmp alltraps
+801097c7:	e9 3c f9 ff ff       	jmp    80109108 <alltraps>
+
+801097cc <vector59>:
+.globl vector59
+vector59:
+  pushl $0
+801097cc:	6a 00                	push   $0x0
+  pushl $59
+801097ce:	6a 3b                	push   $0x3b
+  jmp alltraps
+801097d0:	e9 33 f9 ff ff       	jmp    80109108 <alltraps>
+
+801097d5 <vector60>:
+.globl vector60
+vector60:
+  pushl $0
+801097d5:	6a 00                	push   $0x0
+  pushl $60
+801097d7:	6a 3c                	push   $0x3c
+  jmp alltraps
+801097d9:	e9 2a f9 ff ff       	jmp    80109108 <alltraps>
+
+801097de <vector61>:
+.globl vector61
+vector61:
+  pushl $0
+801097de:	6a 00                	push   $0x0
+  pushl $61
+801097e0:	6a 3d                	push   $0x3d
+  jmp alltraps
+801097e2:	e9 21 f9 ff ff       	jmp    80109108 <alltraps>
+
+801097e7 <vector62>:
+.globl vector62
+vector62:
+  pushl $0
+801097e7:	6a 00                	push   $0x0
+  pushl $62
+801097e9:	6a 3e                	push   $0x3e
+  jmp alltraps
+801097eb:	e9 18 f9 ff ff       	jmp    80109108 <alltraps>
+
+801097f0 <vector63>:
+.globl vector63
+vector63:
+  pushl $0
+801097f0:	6a 00                	push   $0x0
+  pushl $63
+801097f2:	6a 3f                	push   $0x3f
+  jmp alltraps
+801097f4:	e9 0f f9 ff ff       	jmp    80109108 <alltraps>
+
+801097f9 <vector64>:
+.globl vector64
+vector64:
+  pushl $0
+801097f9:	6a 00                	push   $0x0
+  pushl $64
+801097fb:	6a 40                	push   $0x40
+  jmp alltraps
+801097fd:	e9 06 f9 ff ff       	jmp    80109108 <alltraps>
+
+80109802 <vector65>:
+.globl vector65
+vector65:
+  pushl $0
+80109802:	6a 00                	push   $0x0
+  pushl $65
+80109804:	6a 41                	push   $0x41
+  jmp alltraps
+80109806:	e9 fd f8 ff ff       	jmp    80109108 <alltraps>
+
+8010980b <vector66>:
+.globl vector66
+vector66:
+  pushl $0
+8010980b:	6a 00                	push   $0x0
+  pushl $66
+8010980d:	6a 42                	push   $0x42
+  jmp alltraps
+8010980f:	e9 f4 f8 ff ff       	jmp    80109108 <alltraps>
+
+80109814 <vector67>:
+.globl vector67
+vector67:
+  pushl $0
+80109814:	6a 00                	push   $0x0
+  pushl $67
+80109816:	6a 43                	push   $0x43
+  jmp alltraps
+80109818:	e9 eb f8 ff ff       	jmp    80109108 <alltraps>
+
+8010981d <vector68>:
+.globl vector68
+vector68:
+  pushl $0
+8010981d:	6a 00                	push   $0x0
+  pushl $68
+8010981f:	6a 44                	push   $0x44
+  jmp alltraps
+80109821:	e9 e2 f8 ff ff       	jmp    80109108 <alltraps>
+
+80109826 <vector69>:
+.globl vector69
+vector69:
+  pushl $0
+80109826:	6a 00                	push   $0x0
+  pushl $69
+80109828:	6a 45                	push   $0x45
+  jmp alltraps
+8010982a:	e9 d9 f8 ff ff       	jmp    80109108 <alltraps>
+
+8010982f <vector70>:
+.globl vector70
+vector70:
+  pushl $0
+8010982f:	6a 00                	push   $0x0
+  pushl $70
+80109831:	6a 46                	push   $0x46
+  jmp alltraps
+80109833:	e9 d0 f8 ff ff       	jmp    80109108 <alltraps>
+
+80109838 <vector71>:
+.globl vector71
+vector71:
+  pushl $0
+80109838:	6a 00                	push   $0x0
+  pushl $71
+8010983a:	6a 47                	push   $0x47
+  jmp alltraps
+8010983c:	e9 c7 f8 ff ff       	jmp    80109108 <alltraps>
+
+80109841 <vector72>:
+.globl vector72
+vector72:
+  pushl $0
+80109841:	6a 00                	push   $0x0
+  pushl $72
+80109843:	6a 48                	push   $0x48
+  jmp alltraps
+80109845:	e9 be f8 ff ff       	jmp    80109108 <alltraps>
+
+8010984a <vector73>:
+.globl vector73
+vector73:
+  pushl $0
+8010984a:	6a 00                	push   $0x0
+  pushl $73
+8010984c:	6a 49                	push   $0x49
+  jmp alltraps
+8010984e:	e9 b5 f8 ff ff       	jmp    80109108 <alltraps>
+
+80109853 <vector74>:
+.globl vector74
+vector74:
+  pushl $0
+80109853:	6a 00                	push   $0x0
+  pushl $74
+80109855:	6a 4a                	push   $0x4a
+  jmp alltraps
+80109857:	e9 ac f8 ff ff       	jmp    80109108 <alltraps>
+
+8010985c <vector75>:
+.globl vector75
+vector75:
+  pushl $0
+8010985c:	6a 00                	push   $0x0
+  pushl $75
+8010985e:	6a 4b                	push   $0x4b
+  jmp alltraps
+80109860:	e9 a3 f8 ff ff       	jmp    80109108 <alltraps>
+
+80109865 <vector76>:
+.globl vector76
+vector76:
+  pushl $0
+80109865:	6a 00                	push   $0x0
+  pushl $76
+80109867:	6a 4c                	push   $0x4c
+  jmp alltraps
+80109869:	e9 9a f8 ff ff       	jmp    80109108 <alltraps>
+
+8010986e <vector77>:
+.globl vector77
+vector77:
+  pushl $0
+8010986e:	6a 00                	push   $0x0
+  pushl $77
+80109870:	6a 4d                	push   $0x4d
+  jmp alltraps
+80109872:	e9 91 f8 ff ff       	jmp    80109108 <alltraps>
+
+80109877 <vector78>:
+.globl vector78
+vector78:
+  pushl $0
+80109877:	6a 00                	push   $0x0
+  pushl $78
+80109879:	6a 4e                	push   $0x4e
+  jmp alltraps
+8010987b:	e9 88 f8 ff ff       	jmp    80109108 <alltraps>
+
+80109880 <vector79>:
+.globl vector79
+vector79:
+  pushl $0
+80109880:	6a 00                	push   $0x0
+  pushl $79
+80109882:	6a 4f                	push   $0x4f
+  jmp alltraps
+80109884:	e9 7f f8 ff ff       	jmp    80109108 <alltraps>
+
+80109889 <vector80>:
+.globl vector80
+vector80:
+  pushl $0
+80109889:	6a 00                	push   $0x0
+  pushl $80
+8010988b:	6a 50                	push   $0x50
+  jmp alltraps
+8010988d:	e9 76 f8 ff ff       	jmp    80109108 <alltraps>
+
+80109892 <vector81>:
+.globl vector81
+vector81:
+  pushl $0
+80109892:	6a 00                	push   $0x0
+  pushl $81
+80109894:	6a 51                	push   $0x51
+  jmp alltraps
+80109896:	e9 6d f8 ff ff       	jmp    80109108 <alltraps>
+
+8010989b <vector82>:
+.globl vector82
+vector82:
+  pushl $0
+8010989b:	6a 00                	push   $0x0
+  pushl $82
+8010989d:	6a 52                	push   $0x52
+  jmp alltraps
+8010989f:	e9 64 f8 ff ff       	jmp    80109108 <alltraps>
+
+801098a4 <vector83>:
+.globl vector83
+vector83:
+  pushl $0
+801098a4:	6a 00                	push   $0x0
+  pushl $83
+801098a6:	6a 53                	push   $0x53
+  jmp alltraps
+801098a8:	e9 5b f8 ff ff       	jmp    80109108 <alltraps>
+
+801098ad <vector84>:
+.globl vector84
+vector84:
+  pushl $0
+801098ad:	6a 00                	push   $0x0
+  pushl $84
+801098af:	6a 54                	push   $0x54
+  jmp alltraps
+801098b1:	e9 52 f8 ff ff       	jmp    80109108 <alltraps>
+
+801098b6 <vector85>:
+.globl vector85
+vector85:
+  pushl $0
+801098b6:	6a 00                	push   $0x0
+  pushl $85
+801098b8:	6a 55                	push   $0x55
+  jmp alltraps
+801098ba:	e9 49 f8 ff ff       	jmp    80109108 <alltraps>
+
+801098bf <vector86>:
+.globl vector86
+vector86:
+  pushl $0
+801098bf:	6a 00                	push   $0x0
+  pushl $86
+801098c1:	6a 56                	push   $0x56
+  jmp alltraps
+801098c3:	e9 40 f8 ff ff       	jmp    80109108 <alltraps>
+
+801098c8 <vector87>:
+.globl vector87
+vector87:
+  pushl $0
+801098c8:	6a 00                	push   $0x0
+  pushl $87
+801098ca:	6a 57                	push   $0x57
+  jmp alltraps
+801098cc:	e9 37 f8 ff ff       	jmp    80109108 <alltraps>
+
+801098d1 <vector88>:
+.globl vector88
+vector88:
+  pushl $0
+801098d1:	6a 00                	push   $0x0
+  pushl $88
+801098d3:	6a 58                	push   $0x58
+  jmp alltraps
+801098d5:	e9 2e f8 ff ff       	jmp    80109108 <alltraps>
+
+801098da <vector89>:
+.globl vector89
+vector89:
+  pushl $0
+801098da:	6a 00                	push   $0x0
+  pushl $89
+801098dc:	6a 59                	push   $0x59
+  jmp alltraps
+801098de:	e9 25 f8 ff ff       	jmp    80109108 <alltraps>
+
+801098e3 <vector90>:
+.globl vector90
+vector90:
+  pushl $0
+801098e3:	6a 00                	push   $0x0
+  pushl $90
+801098e5:	6a 5a                	push   $0x5a
+  jmp alltraps
+801098e7:	e9 1c f8 ff ff       	jmp    80109108 <alltraps>
+
+801098ec <vector91>:
+.globl vector91
+vector91:
+  pushl $0
+801098ec:	6a 00                	push   $0x0
+  pushl $91
+801098ee:	6a 5b                	push   $0x5b
+  jmp alltraps
+801098f0:	e9 13 f8 ff ff       	jmp    80109108 <alltraps>
+
+801098f5 <vector92>:
+.globl vector92
+vector92:
+  pushl $0
+801098f5:	6a 00                	push   $0x0
+  pushl $92
+801098f7:	6a 5c                	push   $0x5c
+  jmp alltraps
+801098f9:	e9 0a f8 ff ff       	jmp    80109108 <alltraps>
+
+801098fe <vector93>:
+.globl vector93
+vector93:
+  pushl $0
+801098fe:	6a 00                	push   $0x0
+  pushl $93
+80109900:	6a 5d                	push   $0x5d
+  jmp alltraps
+80109902:	e9 01 f8 ff ff       	jmp    80109108 <alltraps>
+
+80109907 <vector94>:
+.globl vector94
+vector94:
+  pushl $0
+80109907:	6a 00                	push   $0x0
+  pushl $94
+80109909:	6a 5e                	push   $0x5e
+  jmp alltraps
+8010990b:	e9 f8 f7 ff ff       	jmp    80109108 <alltraps>
+
+80109910 <vector95>:
+.globl vector95
+vector95:
+  pushl $0
+80109910:	6a 00                	push   $0x0
+  pushl $95
+80109912:	6a 5f                	push   $0x5f
+  jmp alltraps
+80109914:	e9 ef f7 ff ff       	jmp    80109108 <alltraps>
+
+80109919 <vector96>:
+.globl vector96
+vector96:
+  pushl $0
+80109919:	6a 00                	push   $0x0
+  pushl $96
+8010991b:	6a 60                	push   $0x60
+  jmp alltraps
+8010991d:	e9 e6 f7 ff ff       	jmp    80109108 <alltraps>
+
+80109922 <vector97>:
+.globl vector97
+vector97:
+  pushl $0
+80109922:	6a 00                	push   $0x0
+  pushl $97
+80109924:	6a 61                	push   $0x61
+  jmp alltraps
+80109926:	e9 dd f7 ff ff       	jmp    80109108 <alltraps>
+
+8010992b <vector98>:
+.globl vector98
+vector98:
+  pushl $0
+8010992b:	6a 00                	push   $0x0
+  pushl $98
+8010992d:	6a 62                	push   $0x62
+  jmp alltraps
+8010992f:	e9 d4 f7 ff ff       	jmp    80109108 <alltraps>
+
+80109934 <vector99>:
+.globl vector99
+vector99:
+  pushl $0
+80109934:	6a 00                	push   $0x0
+  pushl $99
+80109936:	6a 63                	push   $0x63
+  jmp alltraps
+80109938:	e9 cb f7 ff ff       	jmp    80109108 <alltraps>
+
+8010993d <vector100>:
+.globl vector100
+vector100:
+  pushl $0
+8010993d:	6a 00                	push   $0x0
+  pushl $100
+8010993f:	6a 64                	push   $0x64
+  jmp alltraps
+80109941:	e9 c2 f7 ff ff       	jmp    80109108 <alltraps>
+
+80109946 <vector101>:
+.globl vector101
+vector101:
+  pushl $0
+80109946:	6a 00                	push   $0x0
+  pushl $101
+80109948:	6a 65                	push   $0x65
+  jmp alltraps
+8010994a:	e9 b9 f7 ff ff       	jmp    80109108 <alltraps>
+
+8010994f <vector102>:
+.globl vector102
+vector102:
+  pushl $0
+8010994f:	6a 00                	push   $0x0
+  pushl $102
+80109951:	6a 66                	push   $0x66
+  jmp alltraps
+80109953:	e9 b0 f7 ff ff       	jmp    80109108 <alltraps>
+
+80109958 <vector103>:
+.globl vector103
+vector103:
+  pushl $0
+80109958:	6a 00                	push   $0x0
+  pushl $103
+8010995a:	6a 67                	push   $0x67
+  jmp alltraps
+8010995c:	e9 a7 f7 ff ff       	jmp    80109108 <alltraps>
+
+80109961 <vector104>:
+.globl vector104
+vector104:
+  pushl $0
+80109961:	6a 00                	push   $0x0
+  pushl $104
+80109963:	6a 68                	push   $0x68
+  jmp alltraps
+80109965:	e9 9e f7 ff ff       	jmp    80109108 <alltraps>
+
+8010996a <vector105>:
+.globl vector105
+vector105:
+  pushl $0
+8010996a:	6a 00                	push   $0x0
+  pushl $105
+8010996c:	6a 69                	push   $0x69
+  jmp alltraps
+8010996e:	e9 95 f7 ff ff       	jmp    80109108 <alltraps>
+
+80109973 <vector106>:
+.globl vector106
+vector106:
+  pushl $0
+80109973:	6a 00                	push   $0x0
+  pushl $106
+80109975:	6a 6a                	push   $0x6a
+  jmp alltraps
+80109977:	e9 8c f7 ff ff       	jmp    80109108 <alltraps>
+
+8010997c <vector107>:
+.globl vector107
+vector107:
+  pushl $0
+8010997c:	6a 00                	push   $0x0
+  pushl $107
+8010997e:	6a 6b                	push   $0x6b
+  jmp alltraps
+80109980:	e9 83 f7 ff ff       	jmp    80109108 <alltraps>
+
+80109985 <vector108>:
+.globl vector108
+vector108:
+  pushl $0
+80109985:	6a 00                	push   $0x0
+  pushl $108
+80109987:	6a 6c                	push   $0x6c
+  jmp alltraps
+80109989:	e9 7a f7 ff ff       	jmp    80109108 <alltraps>
+
+8010998e <vector109>:
+.globl vector109
+vector109:
+  pushl $0
+8010998e:	6a 00                	push   $0x0
+  pushl $109
+80109990:	6a 6d                	push   $0x6d
+  jmp alltraps
+80109992:	e9 71 f7 ff ff       	jmp    80109108 <alltraps>
+
+80109997 <vector110>:
+.globl vector110
+vector110:
+  pushl $0
+80109997:	6a 00                	push   $0x0
+  pushl $110
+80109999:	6a 6e                	push   $0x6e
+  jmp alltraps
+8010999b:	e9 68 f7 ff ff       	jmp    80109108 <alltraps>
+
+801099a0 <vector111>:
+.globl vector111
+vector111:
+  pushl $0
+801099a0:	6a 00                	push   $0x0
+  pushl $111
+801099a2:	6a 6f                	push   $0x6f
+  jmp alltraps
+801099a4:	e9 5f f7 ff ff       	jmp    80109108 <alltraps>
+
+801099a9 <vector112>:
+.globl vector112
+vector112:
+  pushl $0
+801099a9:	6a 00                	push   $0x0
+  pushl $112
+801099ab:	6a 70                	push   $0x70
+  jmp alltraps
+801099ad:	e9 56 f7 ff ff       	jmp    80109108 <alltraps>
+
+801099b2 <vector113>:
+.globl vector113
+vector113:
+  pushl $0
+801099b2:	6a 00                	push   $0x0
+  pushl $113
+801099b4:	6a 71                	push   $0x71
+  jmp alltraps
+801099b6:	e9 4d f7 ff ff       	jmp    80109108 <alltraps>
+
+801099bb <vector114>:
+.globl vector114
+vector114:
+  pushl $0
+801099bb:	6a 00                	push   $0x0
+  pushl $114
+801099bd:	6a 72                	push   $0x72
+  jmp alltraps
+801099bf:	e9 44 f7 ff ff       	jmp    80109108 <alltraps>
+
+801099c4 <vector115>:
+.globl vector115
+vector115:
+  pushl $0
+801099c4:	6a 00                	push   $0x0
+  pushl $115
+801099c6:	6a 73                	push   $0x73
+  jmp alltraps
+801099c8:	e9 3b f7 ff ff       	jmp    80109108 <alltraps>
+
+801099cd <vector116>:
+.globl vector116
+vector116:
+  pushl $0
+801099cd:	6a 00                	push   $0x0
+  pushl $116
+801099cf:	6a 74                	push   $0x74
+  jmp alltraps
+801099d1:	e9 32 f7 ff ff       	jmp    80109108 <alltraps>
+
+801099d6 <vector117>:
+.globl vector117
+vector117:
+  pushl $0
+801099d6:	6a 00                	push   $0x0
+  pushl $117
+801099d8:	6a 75                	push   $0x75
+  jmp alltraps
+801099da:	e9 29 f7 ff ff       	jmp    80109108 <alltraps>
+
+801099df <vector118>:
+.globl vector118
+vector118:
+  pushl $0
+801099df:	6a 00                	push   $0x0
+  pushl $118
+801099e1:	6a 76                	push   $0x76
+  jmp alltraps
+801099e3:	e9 20 f7 ff ff       	jmp    80109108 <alltraps>
+
+801099e8 <vector119>:
+.globl vector119
+vector119:
+  pushl $0
+801099e8:	6a 00                	push   $0x0
+  pushl $119
+801099ea:	6a 77                	push   $0x77
+  jmp alltraps
+801099ec:	e9 17 f7 ff ff       	jmp    80109108 <alltraps>
+
+801099f1 <vector120>:
+.globl vector120
+vector120:
+  pushl $0
+801099f1:	6a 00                	push   $0x0
+  pushl $120
+801099f3:	6a 78                	push   $0x78
+  jmp alltraps
+801099f5:	e9 0e f7 ff ff       	jmp    80109108 <alltraps>
+
+801099fa <vector121>:
+.globl vector121
+vector121:
+  pushl $0
+801099fa:	6a 00                	push   $0x0
+  pushl $121
+801099fc:	6a 79                	push   $0x79
+  jmp alltraps
+801099fe:	e9 05 f7 ff ff       	jmp    80109108 <alltraps>
+
+80109a03 <vector122>:
+.globl vector122
+vector122:
+  pushl $0
+80109a03:	6a 00                	push   $0x0
+  pushl $122
+80109a05:	6a 7a                	push   $0x7a
+  jmp alltraps
+80109a07:	e9 fc f6 ff ff       	jmp    80109108 <alltraps>
+
+80109a0c <vector123>:
+.globl vector123
+vector123:
+  pushl $0
+80109a0c:	6a 00                	push   $0x0
+  pushl $123
+80109a0e:	6a 7b                	push   $0x7b
+  jmp alltraps
+80109a10:	e9 f3 f6 ff ff       	jmp    80109108 <alltraps>
+
+80109a15 <vector124>:
+.globl vector124
+vector124:
+  pushl $0
+80109a15:	6a 00                	push   $0x0
+  pushl $124
+80109a17:	6a 7c                	push   $0x7c
+  jmp alltraps
+80109a19:	e9 ea f6 ff ff       	jmp    80109108 <alltraps>
+
+80109a1e <vector125>:
+.globl vector125
+vector125:
+  pushl $0
+80109a1e:	6a 00                	push   $0x0
+  pushl $125
+80109a20:	6a 7d                	push   $0x7d
+  jmp alltraps
+80109a22:	e9 e1 f6 ff ff       	jmp    80109108 <alltraps>
+
+80109a27 <vector126>:
+.globl vector126
+vector126:
+  pushl $0
+80109a27:	6a 00                	push   $0x0
+  pushl $126
+80109a29:	6a 7e                	push   $0x7e
+  jmp alltraps
+80109a2b:	e9 d8 f6 ff ff       	jmp    80109108 <alltraps>
+
+80109a30 <vector127>:
+.globl vector127
+vector127:
+  pushl $0
+80109a30:	6a 00                	push   $0x0
+  pushl $127
+80109a32:	6a 7f                	push   $0x7f
+  jmp alltraps
+80109a34:	e9 cf f6 ff ff       	jmp    80109108 <alltraps>
+
+80109a39 <vector128>:
+.globl vector128
+vector128:
+  pushl $0
+80109a39:	6a 00                	push   $0x0
+  pushl $128
+80109a3b:	68 80 00 00 00       	push   $0x80
+  jmp alltraps
+80109a40:	e9 c3 f6 ff ff       	jmp    80109108 <alltraps>
+
+80109a45 <vector129>:
+.globl vector129
+vector129:
+  pushl $0
+80109a45:	6a 00                	push   $0x0
+  pushl $129
+80109a47:	68 81 00 00 00       	push   $0x81
+  jmp alltraps
+80109a4c:	e9 b7 f6 ff ff       	jmp    80109108 <alltraps>
+
+80109a51 <vector130>:
+.globl vector130
+vector130:
+  pushl $0
+80109a51:	6a 00                	push   $0x0
+  pushl $130
+80109a53:	68 82 00 00 00       	push   $0x82
+  jmp alltraps
+80109a58:	e9 ab f6 ff ff       	jmp    80109108 <alltraps>
+
+80109a5d <vector131>:
+.globl vector131
+vector131:
+  pushl $0
+80109a5d:	6a 00                	push   $0x0
+  pushl $131
+80109a5f:	68 83 00 00 00       	push   $0x83
+  jmp alltraps
+80109a64:	e9 9f f6 ff ff       	jmp    80109108 <alltraps>
+
+80109a69 <vector132>:
+.globl vector132
+vector132:
+  pushl $0
+80109a69:	6a 00                	push   $0x0
+  pushl $132
+80109a6b:	68 84 00 00 00       	push   $0x84
+  jmp alltraps
+80109a70:	e9 93 f6 ff ff       	jmp    80109108 <alltraps>
+
+80109a75 <vector133>:
+.globl vector133
+vector133:
+  pushl $0
+80109a75:	6a 00                	push   $0x0
+  pushl $133
+80109a77:	68 85 00 00 00       	push   $0x85
+  jmp alltraps
+80109a7c:	e9 87 f6 ff ff       	jmp    80109108 <alltraps>
+
+80109a81 <vector134>:
+.globl vector134
+vector134:
+  pushl $0
+80109a81:	6a 00                	push   $0x0
+  pushl $134
+80109a83:	68 86 00 00 00       	push   $0x86
+  jmp alltraps
+80109a88:	e9 7b f6 ff ff       	jmp    80109108 <alltraps>
+
+80109a8d <vector135>:
+.globl vector135
+vector135:
+  pushl $0
+80109a8d:	6a 00                	push   $0x0
+  pushl $135
+80109a8f:	68 87 00 00 00       	push   $0x87
+  jmp alltraps
+80109a94:	e9 6f f6 ff ff       	jmp    80109108 <alltraps>
+
+80109a99 <vector136>:
+.globl vector136
+vector136:
+  pushl $0
+80109a99:	6a 00                	push   $0x0
+  pushl $136
+80109a9b:	68 88 00 00 00       	push   $0x88
+  jmp alltraps
+80109aa0:	e9 63 f6 ff ff       	jmp    80109108 <alltraps>
+
+80109aa5 <vector137>:
+.globl vector137
+vector137:
+  pushl $0
+80109aa5:	6a 00                	push   $0x0
+  pushl $137
+80109aa7:	68 89 00 00 00       	push   $0x89
+  jmp alltraps
+80109aac:	e9 57 f6 ff ff       	jmp    80109108 <alltraps>
+
+80109ab1 <vector138>:
+.globl vector138
+vector138:
+  pushl $0
+80109ab1:	6a 00                	push   $0x0
+  pushl $138
+80109ab3:	68 8a 00 00 00       	push   $0x8a
+  jmp alltraps
+80109ab8:	e9 4b f6 ff ff       	jmp    80109108 <alltraps>
+
+80109abd <vector139>:
+.globl vector139
+vector139:
+  pushl $0
+80109abd:	6a 00                	push   $0x0
+  pushl $139
+80109abf:	68 8b 00 00 00       	push   $0x8b
+  jmp alltraps
+80109ac4:	e9 3f f6 ff ff       	jmp    80109108 <alltraps>
+
+80109ac9 <vector140>:
+.globl vector140
+vector140:
+  pushl $0
+80109ac9:	6a 00                	push   $0x0
+  pushl $140
+80109acb:	68 8c 00 00 00       	push   $0x8c
+  jmp alltraps
+80109ad0:	e9 33 f6 ff ff       	jmp    80109108 <alltraps>
+
+80109ad5 <vector141>:
+.globl vector141
+vector141:
+  pushl $0
+80109ad5:	6a 00                	push   $0x0
+  pushl $141
+80109ad7:	68 8d 00 00 00       	push   $0x8d
+  jmp alltraps
+80109adc:	e9 27 f6 ff ff       	jmp    80109108 <alltraps>
+
+80109ae1 <vector142>:
+.globl vector142
+vector142:
+  pushl $0
+80109ae1:	6a 00                	push   $0x0
+  pushl $142
+80109ae3:	68 8e 00 00 00       	push   $0x8e
+  jmp alltraps
+80109ae8:	e9 1b f6 ff ff       	jmp    80109108 <alltraps>
+
+80109aed <vector143>:
+.globl vector143
+vector143:
+  pushl $0
+80109aed:	6a 00                	push   $0x0
+  pushl $143
+80109aef:	68 8f 00 00 00       	push   $0x8f
+  jmp alltraps
+80109af4:	e9 0f f6 ff ff       	jmp    80109108 <alltraps>
+
+80109af9 <vector144>:
+.globl vector144
+vector144:
+  pushl $0
+80109af9:	6a 00                	push   $0x0
+  pushl $144
+80109afb:	68 90 00 00 00       	push   $0x90
+  jmp alltraps
+80109b00:	e9 03 f6 ff ff       	jmp    80109108 <alltraps>
+
+80109b05 <vector145>:
+.globl vector145
+vector145:
+  pushl $0
+80109b05:	6a 00                	push   $0x0
+  pushl $145
+80109b07:	68 91 00 00 00       	push   $0x91
+  jmp alltraps
+80109b0c:	e9 f7 f5 ff ff       	jmp    80109108 <alltraps>
+
+80109b11 <vector146>:
+.globl vector146
+vector146:
+  pushl $0
+80109b11:	6a 00                	push   $0x0
+  pushl $146
+80109b13:	68 92 00 00 00       	push   $0x92
+  jmp alltraps
+80109b18:	e9 eb f5 ff ff       	jmp    80109108 <alltraps>
+
+80109b1d <vector147>:
+.globl vector147
+vector147:
+  pushl $0
+80109b1d:	6a 00                	push   $0x0
+  pushl $147
+80109b1f:	68 93 00 00 00       	push   $0x93
+  jmp alltraps
+80109b24:	e9 df f5 ff ff       	jmp    80109108 <alltraps>
+
+80109b29 <vector148>:
+.globl vector148
+vector148:
+  pushl $0
+80109b29:	6a 00                	push   $0x0
+  pushl $148
+80109b2b:	68 94 00 00 00       	push   $0x94
+  jmp alltraps
+80109b30:	e9 d3 f5 ff ff       	jmp    80109108 <alltraps>
+
+80109b35 <vector149>:
+.globl vector149
+vector149:
+  pushl $0
+80109b35:	6a 00                	push   $0x0
+  pushl $149
+80109b37:	68 95 00 00 00       	push   $0x95
+  jmp alltraps
+80109b3c:	e9 c7 f5 ff ff       	jmp    80109108 <alltraps>
+
+80109b41 <vector150>:
+.globl vector150
+vector150:
+  pushl $0
+80109b41:	6a 00                	push   $0x0
+  pushl $150
+80109b43:	68 96 00 00 00       	push   $0x96
+  jmp alltraps
+80109b48:	e9 bb f5 ff ff       	jmp    80109108 <alltraps>
+
+80109b4d <vector151>:
+.globl vector151
+vector151:
+  pushl $0
+80109b4d:	6a 00                	push   $0x0
+  pushl $151
+80109b4f:	68 97 00 00 00       	push   $0x97
+  jmp alltraps
+80109b54:	e9 af f5 ff ff       	jmp    80109108 <alltraps>
+
+80109b59 <vector152>:
+.globl vector152
+vector152:
+  pushl $0
+80109b59:	6a 00                	push   $0x0
+  pushl $152
+80109b5b:	68 98 00 00 00       	push   $0x98
+  jmp alltraps
+80109b60:	e9 a3 f5 ff ff       	jmp    80109108 <alltraps>
+
+80109b65 <vector153>:
+.globl vector153
+vector153:
+  pushl $0
+80109b65:	6a 00                	push   $0x0
+  pushl $153
+80109b67:	68 99 00 00 00       	push   $0x99
+  jmp alltraps
+80109b6c:	e9 97 f5 ff ff       	jmp    80109108 <alltraps>
+
+80109b71 <vector154>:
+.globl vector154
+vector154:
+  pushl $0
+80109b71:	6a 00                	push   $0x0
+  pushl $154
+80109b73:	68 9a 00 00 00       	push   $0x9a
+  jmp alltraps
+80109b78:	e9 8b f5 ff ff       	jmp    80109108 <alltraps>
+
+80109b7d <vector155>:
+.globl vector155
+vector155:
+  pushl $0
+80109b7d:	6a 00                	push   $0x0
+  pushl $155
+80109b7f:	68 9b 00 00 00       	push   $0x9b
+  jmp alltraps
+80109b84:	e9 7f f5 ff ff       	jmp    80109108 <alltraps>
+
+80109b89 <vector156>:
+.globl vector156
+vector156:
+  pushl $0
+80109b89:	6a 00                	push   $0x0
+  pushl $156
+80109b8b:	68 9c 00 00 00       	push   $0x9c
+  jmp alltraps
+80109b90:	e9 73 f5 ff ff       	jmp    80109108 <alltraps>
+
+80109b95 <vector157>:
+.globl vector157
+vector157:
+  pushl $0
+80109b95:	6a 00                	push   $0x0
+  pushl $157
+80109b97:	68 9d 00 00 00       	push   $0x9d
+  jmp alltraps
+80109b9c:	e9 67 f5 ff ff       	jmp    80109108 <alltraps>
+
+80109ba1 <vector158>:
+.globl vector158
+vector158:
+  pushl $0
+80109ba1:	6a 00                	push   $0x0
+  pushl $158
+80109ba3:	68 9e 00 00 00       	push   $0x9e
+  jmp alltraps
+80109ba8:	e9 5b f5 ff ff       	jmp    80109108 <alltraps>
+
+80109bad <vector159>:
+.globl vector159
+vector159:
+  pushl $0
+80109bad:	6a 00                	push   $0x0
+  pushl $159
+80109baf:	68 9f 00 00 00       	push   $0x9f
+  jmp alltraps
+80109bb4:	e9 4f f5 ff ff       	jmp    80109108 <alltraps>
+
+80109bb9 <vector160>:
+.globl vector160
+vector160:
+  pushl $0
+80109bb9:	6a 00                	push   $0x0
+  pushl $160
+80109bbb:	68 a0 00 00 00       	push   $0xa0
+  jmp alltraps
+80109bc0:	e9 43 f5 ff ff       	jmp    80109108 <alltraps>
+
+80109bc5 <vector161>:
+.globl vector161
+vector161:
+  pushl $0
+80109bc5:	6a 00                	push   $0x0
+  pushl $161
+80109bc7:	68 a1 00 00 00       	push   $0xa1
+  jmp alltraps
+80109bcc:	e9 37 f5 ff ff       	jmp    80109108 <alltraps>
+
+80109bd1 <vector162>:
+.globl vector162
+vector162:
+  pushl $0
+80109bd1:	6a 00                	push   $0x0
+  pushl $162
+80109bd3:	68 a2 00 00 00       	push   $0xa2
+  jmp alltraps
+80109bd8:	e9 2b f5 ff ff       	jmp    80109108 <alltraps>
+
+80109bdd <vector163>:
+.globl vector163
+vector163:
+  pushl $0
+80109bdd:	6a 00                	push   $0x0
+  pushl $163
+80109bdf:	68 a3 00 00 00       	push   $0xa3
+  jmp alltraps
+80109be4:	e9 1f f5 ff ff       	jmp    80109108 <alltraps>
+
+80109be9 <vector164>:
+.globl vector164
+vector164:
+  pushl $0
+80109be9:	6a 00                	push   $0x0
+  pushl $164
+80109beb:	68 a4 00 00 00       	push   $0xa4
+  jmp alltraps
+80109bf0:	e9 13 f5 ff ff       	jmp    80109108 <alltraps>
+
+80109bf5 <vector165>:
+.globl vector165
+vector165:
+  pushl $0
+80109bf5:	6a 00                	push   $0x0
+  pushl $165
+80109bf7:	68 a5 00 00 00       	push   $0xa5
+  jmp alltraps
+80109bfc:	e9 07 f5 ff ff       	jmp    80109108 <alltraps>
+
+80109c01 <vector166>:
+.globl vector166
+vector166:
+  pushl $0
+80109c01:	6a 00                	push   $0x0
+  pushl $166
+80109c03:	68 a6 00 00 00       	push   $0xa6
+  jmp alltraps
+80109c08:	e9 fb f4 ff ff       	jmp    80109108 <alltraps>
+
+80109c0d <vector167>:
+.globl vector167
+vector167:
+  pushl $0
+80109c0d:	6a 00                	push   $0x0
+  pushl $167
+80109c0f:	68 a7 00 00 00       	push   $0xa7
+  jmp alltraps
+80109c14:	e9 ef f4 ff ff       	jmp    80109108 <alltraps>
+
+80109c19 <vector168>:
+.globl vector168
+vector168:
+  pushl $0
+80109c19:	6a 00                	push   $0x0
+  pushl $168
+80109c1b:	68 a8 00 00 00       	push   $0xa8
+  jmp alltraps
+80109c20:	e9 e3 f4 ff ff       	jmp    80109108 <alltraps>
+
+80109c25 <vector169>:
+.globl vector169
+vector169:
+  pushl $0
+80109c25:	6a 00                	push   $0x0
+  pushl $169
+80109c27:	68 a9 00 00 00       	push   $0xa9
+  jmp alltraps
+80109c2c:	e9 d7 f4 ff ff       	jmp    80109108 <alltraps>
+
+80109c31 <vector170>:
+.globl vector170
+vector170:
+  pushl $0
+80109c31:	6a 00                	push   $0x0
+  pushl $170
+80109c33:	68 aa 00 00 00       	push   $0xaa
+  jmp alltraps
+80109c38:	e9 cb f4 ff ff       	jmp    80109108 <alltraps>
+
+80109c3d <vector171>:
+.globl vector171
+vector171:
+  pushl $0
+80109c3d:	6a 00                	push   $0x0
+  pushl $171
+80109c3f:	68 ab 00 00 00       	push   $0xab
+  jmp alltraps
+80109c44:	e9 bf f4 ff ff       	jmp    80109108 <alltraps>
+
+80109c49 <vector172>:
+.globl vector172
+vector172:
+  pushl $0
+80109c49:	6a 00                	push   $0x0
+  pushl $172
+80109c4b:	68 ac 00 00 00       	push   $0xac
+  jmp alltraps
+80109c50:	e9 b3 f4 ff ff       	jmp    80109108 <alltraps>
+
+80109c55 <vector173>:
+.globl vector173
+vector173:
+  pushl $0
+80109c55:	6a 00                	push   $0x0
+  pushl $173
+80109c57:	68 ad 00 00 00       	push   $0xad
+  jmp alltraps
+80109c5c:	e9 a7 f4 ff ff       	jmp    80109108 <alltraps>
+
+80109c61 <vector174>:
+.globl vector174
+vector174:
+  pushl $0
+80109c61:	6a 00                	push   $0x0
+  pushl $174
+80109c63:	68 ae 00 00 00       	push   $0xae
+  jmp alltraps
+80109c68:	e9 9b f4 ff ff       	jmp    80109108 <alltraps>
+
+80109c6d <vector175>:
+.globl vector175
+vector175:
+  pushl $0
+80109c6d:	6a 00                	push   $0x0
+  pushl $175
+80109c6f:	68 af 00 00 00       	push   $0xaf
+  jmp alltraps
+80109c74:	e9 8f f4 ff ff       	jmp    80109108 <alltraps>
+
+80109c79 <vector176>:
+.globl vector176
+vector176:
+  pushl $0
+80109c79:	6a 00                	push   $0x0
+  pushl $176
+80109c7b:	68 b0 00 00 00       	push   $0xb0
+  jmp alltraps
+80109c80:	e9 83 f4 ff ff       	jmp    80109108 <alltraps>
+
+80109c85 <vector177>:
+.globl vector177
+vector177:
+  pushl $0
+80109c85:	6a 00                	push   $0x0
+  pushl $177
+80109c87:	68 b1 00 00 00       	push   $0xb1
+  jmp alltraps
+80109c8c:	e9 77 f4 ff ff       	jmp    80109108 <alltraps>
+
+80109c91 <vector178>:
+.globl vector178
+vector178:
+  pushl $0
+80109c91:	6a 00                	push   $0x0
+  pushl $178
+80109c93:	68 b2 00 00 00       	push   $0xb2
+  jmp alltraps
+80109c98:	e9 6b f4 ff ff       	jmp    80109108 <alltraps>
+
+80109c9d <vector179>:
+.globl vector179
+vector179:
+  pushl $0
+80109c9d:	6a 00                	push   $0x0
+  pushl $179
+80109c9f:	68 b3 00 00 00       	push   $0xb3
+  jmp alltraps
+80109ca4:	e9 5f f4 ff ff       	jmp    80109108 <alltraps>
+
+80109ca9 <vector180>:
+.globl vector180
+vector180:
+  pushl $0
+80109ca9:	6a 00                	push   $0x0
+  pushl $180
+80109cab:	68 b4 00 00 00       	push   $0xb4
+  jmp alltraps
+80109cb0:	e9 53 f4 ff ff       	jmp    80109108 <alltraps>
+
+80109cb5 <vector181>:
+.globl vector181
+vector181:
+  pushl $0
+80109cb5:	6a 00                	push   $0x0
+  pushl $181
+80109cb7:	68 b5 00 00 00       	push   $0xb5
+  jmp alltraps
+80109cbc:	e9 47 f4 ff ff       	jmp    80109108 <alltraps>
+
+80109cc1 <vector182>:
+.globl vector182
+vector182:
+  pushl $0
+80109cc1:	6a 00                	push   $0x0
+  pushl $182
+80109cc3:	68 b6 00 00 00       	push   $0xb6
+  jmp alltraps
+80109cc8:	e9 3b f4 ff ff       	jmp    80109108 <alltraps>
+
+80109ccd <vector183>:
+.globl vector183
+vector183:
+  pushl $0
+80109ccd:	6a 00                	push   $0x0
+  pushl $183
+80109ccf:	68 b7 00 00 00       	push   $0xb7
+  jmp alltraps
+80109cd4:	e9 2f f4 ff ff       	jmp    80109108 <alltraps>
+
+80109cd9 <vector184>:
+.globl vector184
+vector184:
+  pushl $0
+80109cd9:	6a 00                	push   $0x0
+  pushl $184
+80109cdb:	68 b8 00 00 00       	push   $0xb8
+  jmp alltraps
+80109ce0:	e9 23 f4 ff ff       	jmp    80109108 <alltraps>
+
+80109ce5 <vector185>:
+.globl vector185
+vector185:
+  pushl $0
+80109ce5:	6a 00                	push   $0x0
+  pushl $185
+80109ce7:	68 b9 00 00 00       	push   $0xb9
+  jmp alltraps
+80109cec:	e9 17 f4 ff ff       	jmp    80109108 <alltraps>
+
+80109cf1 <vector186>:
+.globl vector186
+vector186:
+  pushl $0
+80109cf1:	6a 00                	push   $0x0
+  pushl $186
+80109cf3:	68 ba 00 00 00       	push   $0xba
+  jmp alltraps
+80109cf8:	e9 0b f4 ff ff       	jmp    80109108 <alltraps>
+
+80109cfd <vector187>:
+.globl vector187
+vector187:
+  pushl $0
+80109cfd:	6a 00                	push   $0x0
+  pushl $187
+80109cff:	68 bb 00 00 00       	push   $0xbb
+  jmp alltraps
+80109d04:	e9 ff f3 ff ff       	jmp    80109108 <alltraps>
+
+80109d09 <vector188>:
+.globl vector188
+vector188:
+  pushl $0
+80109d09:	6a 00                	push   $0x0
+  pushl $188
+80109d0b:	68 bc 00 00 00       	push   $0xbc
+  jmp alltraps
+80109d10:	e9 f3 f3 ff ff       	jmp    80109108 <alltraps>
+
+80109d15 <vector189>:
+.globl vector189
+vector189:
+  pushl $0
+80109d15:	6a 00                	push   $0x0
+  pushl $189
+80109d17:	68 bd 00 00 00       	push   $0xbd
+  jmp alltraps
+80109d1c:	e9 e7 f3 ff ff       	jmp    80109108 <alltraps>
+
+80109d21 <vector190>:
+.globl vector190
+vector190:
+  pushl $0
+80109d21:	6a 00                	push   $0x0
+  pushl $190
+80109d23:	68 be 00 00 00       	push   $0xbe
+  jmp alltraps
+80109d28:	e9 db f3 ff ff       	jmp    80109108 <alltraps>
+
+80109d2d <vector191>:
+.globl vector191
+vector191:
+  pushl $0
+80109d2d:	6a 00                	push   $0x0
+  pushl $191
+80109d2f:	68 bf 00 00 00       	push   $0xbf
+  jmp alltraps
+80109d34:	e9 cf f3 ff ff       	jmp    80109108 <alltraps>
+
+80109d39 <vector192>:
+.globl vector192
+vector192:
+  pushl $0
+80109d39:	6a 00                	push   $0x0
+  pushl $192
+80109d3b:	68 c0 00 00 00       	push   $0xc0
+  jmp alltraps
+80109d40:	e9 c3 f3 ff ff       	jmp    80109108 <alltraps>
+
+80109d45 <vector193>:
+.globl vector193
+vector193:
+  pushl $0
+80109d45:	6a 00                	push   $0x0
+  pushl $193
+80109d47:	68 c1 00 00 00       	push   $0xc1
+  jmp alltraps
+80109d4c:	e9 b7 f3 ff ff       	jmp    80109108 <alltraps>
+
+80109d51 <vector194>:
+.globl vector194
+vector194:
+  pushl $0
+80109d51:	6a 00                	push   $0x0
+  pushl $194
+80109d53:	68 c2 00 00 00       	push   $0xc2
+  jmp alltraps
+80109d58:	e9 ab f3 ff ff       	jmp    80109108 <alltraps>
+
+80109d5d <vector195>:
+.globl vector195
+vector195:
+  pushl $0
+80109d5d:	6a 00                	push   $0x0
+  pushl $195
+80109d5f:	68 c3 00 00 00       	push   $0xc3
+  jmp alltraps
+80109d64:	e9 9f f3 ff ff       	jmp    80109108 <alltraps>
+
+80109d69 <vector196>:
+.globl vector196
+vector196:
+  pushl $0
+80109d69:	6a 00                	push   $0x0
+  pushl $196
+80109d6b:	68 c4 00 00 00       	push   $0xc4
+  jmp alltraps
+80109d70:	e9 93 f3 ff ff       	jmp    80109108 <alltraps>
+
+80109d75 <vector197>:
+.globl vector197
+vector197:
+  pushl $0
+80109d75:	6a 00                	push   $0x0
+  pushl $197
+80109d77:	68 c5 00 00 00       	push   $0xc5
+  jmp alltraps
+80109d7c:	e9 87 f3 ff ff       	jmp    80109108 <alltraps>
+
+80109d81 <vector198>:
+.globl vector198
+vector198:
+  pushl $0
+80109d81:	6a 00                	push   $0x0
+  pushl $198
+80109d83:	68 c6 00 00 00       	push   $0xc6
+  jmp alltraps
+80109d88:	e9 7b f3 ff ff       	jmp    80109108 <alltraps>
+
+80109d8d <vector199>:
+.globl vector199
+vector199:
+  pushl $0
+80109d8d:	6a 00                	push   $0x0
+  pushl $199
+80109d8f:	68 c7 00 00 00       	push   $0xc7
+  jmp alltraps
+80109d94:	e9 6f f3 ff ff       	jmp    80109108 <alltraps>
+
+80109d99 <vector200>:
+.globl vector200
+vector200:
+  pushl $0
+80109d99:	6a 00                	push   $0x0
+  pushl $200
+80109d9b:	68 c8 00 00 00       	push   $0xc8
+  jmp alltraps
+80109da0:	e9 63 f3 ff ff       	jmp    80109108 <alltraps>
+
+80109da5 <vector201>:
+.globl vector201
+vector201:
+  pushl $0
+80109da5:	6a 00                	push   $0x0
+  pushl $201
+80109da7:	68 c9 00 00 00       	push   $0xc9
+  jmp alltraps
+80109dac:	e9 57 f3 ff ff       	jmp    80109108 <alltraps>
+
+80109db1 <vector202>:
+.globl vector202
+vector202:
+  pushl $0
+80109db1:	6a 00                	push   $0x0
+  pushl $202
+80109db3:	68 ca 00 00 00       	push   $0xca
+  jmp alltraps
+80109db8:	e9 4b f3 ff ff       	jmp    80109108 <alltraps>
+
+80109dbd <vector203>:
+.globl vector203
+vector203:
+  pushl $0
+80109dbd:	6a 00                	push   $0x0
+  pushl $203
+80109dbf:	68 cb 00 00 00       	push   $0xcb
+  jmp alltraps
+80109dc4:	e9 3f f3 ff ff       	jmp    80109108 <alltraps>
+
+80109dc9 <vector204>:
+.globl vector204
+vector204:
+  pushl $0
+80109dc9:	6a 00                	push   $0x0
+  pushl $204
+80109dcb:	68 cc 00 00 00       	push   $0xcc
+  jmp alltraps
+80109dd0:	e9 33 f3 ff ff       	jmp    80109108 <alltraps>
+
+80109dd5 <vector205>:
+.globl vector205
+vector205:
+  pushl $0
+80109dd5:	6a 00                	push   $0x0
+  pushl $205
+80109dd7:	68 cd 00 00 00       	push   $0xcd
+  jmp alltraps
+80109ddc:	e9 27 f3 ff ff       	jmp    80109108 <alltraps>
+
+80109de1 <vector206>:
+.globl vector206
+vector206:
+  pushl $0
+80109de1:	6a 00                	push   $0x0
+  pushl $206
+80109de3:	68 ce 00 00 00       	push   $0xce
+  jmp alltraps
+80109de8:	e9 1b f3 ff ff       	jmp    80109108 <alltraps>
+
+80109ded <vector207>:
+.globl vector207
+vector207:
+  pushl $0
+80109ded:	6a 00                	push   $0x0
+  pushl $207
+80109def:	68 cf 00 00 00       	push   $0xcf
+  jmp alltraps
+80109df4:	e9 0f f3 ff ff       	jmp    80109108 <alltraps>
+
+80109df9 <vector208>:
+.globl vector208
+vector208:
+  pushl $0
+80109df9:	6a 00                	push   $0x0
+  pushl $208
+80109dfb:	68 d0 00 00 00       	push   $0xd0
+  jmp alltraps
+80109e00:	e9 03 f3 ff ff       	jmp    80109108 <alltraps>
+
+80109e05 <vector209>:
+.globl vector209
+vector209:
+  pushl $0
+80109e05:	6a 00                	push   $0x0
+  pushl $209
+80109e07:	68 d1 00 00 00       	push   $0xd1
+  jmp alltraps
+80109e0c:	e9 f7 f2 ff ff       	jmp    80109108 <alltraps>
+
+80109e11 <vector210>:
+.globl vector210
+vector210:
+  pushl $0
+80109e11:	6a 00                	push   $0x0
+  pushl $210
+80109e13:	68 d2 00 00 00       	push   $0xd2
+  jmp alltraps
+80109e18:	e9 eb f2 ff ff       	jmp    80109108 <alltraps>
+
+80109e1d <vector211>:
+.globl vector211
+vector211:
+  pushl $0
+80109e1d:	6a 00                	push   $0x0
+  pushl $211
+80109e1f:	68 d3 00 00 00       	push   $0xd3
+  jmp alltraps
+80109e24:	e9 df f2 ff ff       	jmp    80109108 <alltraps>
+
+80109e29 <vector212>:
+.globl vector212
+vector212:
+  pushl $0
+80109e29:	6a 00                	push   $0x0
+  pushl $212
+80109e2b:	68 d4 00 00 00       	push   $0xd4
+  jmp alltraps
+80109e30:	e9 d3 f2 ff ff       	jmp    80109108 <alltraps>
+
+80109e35 <vector213>:
+.globl vector213
+vector213:
+  pushl $0
+80109e35:	6a 00                	push   $0x0
+  pushl $213
+80109e37:	68 d5 00 00 00       	push   $0xd5
+  jmp alltraps
+80109e3c:	e9 c7 f2 ff ff       	jmp    80109108 <alltraps>
+
+80109e41 <vector214>:
+.globl vector214
+vector214:
+  pushl $0
+80109e41:	6a 00                	push   $0x0
+  pushl $214
+80109e43:	68 d6 00 00 00       	push   $0xd6
+  jmp alltraps
+80109e48:	e9 bb f2 ff ff       	jmp    80109108 <alltraps>
+
+80109e4d <vector215>:
+.globl vector215
+vector215:
+  pushl $0
+80109e4d:	6a 00                	push   $0x0
+  pushl $215
+80109e4f:	68 d7 00 00 00       	push   $0xd7
+  jmp alltraps
+80109e54:	e9 af f2 ff ff       	jmp    80109108 <alltraps>
+
+80109e59 <vector216>:
+.globl vector216
+vector216:
+  pushl $0
+80109e59:	6a 00                	push   $0x0
+  pushl $216
+80109e5b:	68 d8 00 00 00       	push   $0xd8
+  jmp alltraps
+80109e60:	e9 a3 f2 ff ff       	jmp    80109108 <alltraps>
+
+80109e65 <vector217>:
+.globl vector217
+vector217:
+  pushl $0
+80109e65:	6a 00                	push   $0x0
+  pushl $217
+80109e67:	68 d9 00 00 00       	push   $0xd9
+  jmp alltraps
+80109e6c:	e9 97 f2 ff ff       	jmp    80109108 <alltraps>
+
+80109e71 <vector218>:
+.globl vector218
+vector218:
+  pushl $0
+80109e71:	6a 00                	push   $0x0
+  pushl $218
+80109e73:	68 da 00 00 00       	push   $0xda
+  jmp alltraps
+80109e78:	e9 8b f2 ff ff       	jmp    80109108 <alltraps>
+
+80109e7d <vector219>:
+.globl vector219
+vector219:
+  pushl $0
+80109e7d:	6a 00                	push   $0x0
+  pushl $219
+80109e7f:	68 db 00 00 00       	push   $0xdb
+  jmp alltraps
+80109e84:	e9 7f f2 ff ff       	jmp    80109108 <alltraps>
+
+80109e89 <vector220>:
+.globl vector220
+vector220:
+  pushl $0
+80109e89:	6a 00                	push   $0x0
+  pushl $220
+80109e8b:	68 dc 00 00 00       	push   $0xdc
+  jmp alltraps
+80109e90:	e9 73 f2 ff ff       	jmp    80109108 <alltraps>
+
+80109e95 <vector221>:
+.globl vector221
+vector221:
+  pushl $0
+80109e95:	6a 00                	push   $0x0
+  pushl $221
+80109e97:	68 dd 00 00 00       	push   $0xdd
+  jmp alltraps
+80109e9c:	e9 67 f2 ff ff       	jmp    80109108 <alltraps>
+
+80109ea1 <vector222>:
+.globl vector222
+vector222:
+  pushl $0
+80109ea1:	6a 00                	push   $0x0
+  pushl $222
+80109ea3:	68 de 00 00 00       	push   $0xde
+  jmp alltraps
+80109ea8:	e9 5b f2 ff ff       	jmp    80109108 <alltraps>
+
+80109ead <vector223>:
+.globl vector223
+vector223:
+  pushl $0
+80109ead:	6a 00                	push   $0x0
+  pushl $223
+80109eaf:	68 df 00 00 00       	push   $0xdf
+  jmp alltraps
+80109eb4:	e9 4f f2 ff ff       	jmp    80109108 <alltraps>
+
+80109eb9 <vector224>:
+.globl vector224
+vector224:
+  pushl $0
+80109eb9:	6a 00                	push   $0x0
+  pushl $224
+80109ebb:	68 e0 00 00 00       	push   $0xe0
+  jmp alltraps
+80109ec0:	e9 43 f2 ff ff       	jmp    80109108 <alltraps>
+
+80109ec5 <vector225>:
+.globl vector225
+vector225:
+  pushl $0
+80109ec5:	6a 00                	push   $0x0
+  pushl $225
+80109ec7:	68 e1 00 00 00       	push   $0xe1
+  jmp alltraps
+80109ecc:	e9 37 f2 ff ff       	jmp    80109108 <alltraps>
+
+80109ed1 <vector226>:
+.globl vector226
+vector226:
+  pushl $0
+80109ed1:	6a 00                	push   $0x0
+  pushl $226
+80109ed3:	68 e2 00 00 00       	push   $0xe2
+  jmp alltraps
+80109ed8:	e9 2b f2 ff ff       	jmp    80109108 <alltraps>
+
+80109edd <vector227>:
+.globl vector227
+vector227:
+  pushl $0
+80109edd:	6a 00                	push   $0x0
+  pushl $227
+80109edf:	68 e3 00 00 00       	push   $0xe3
+  jmp alltraps
+80109ee4:	e9 1f f2 ff ff       	jmp    80109108 <alltraps>
+
+80109ee9 <vector228>:
+.globl vector228
+vector228:
+  pushl $0
+80109ee9:	6a 00                	push   $0x0
+  pushl $228
+80109eeb:	68 e4 00 00 00       	push   $0xe4
+  jmp alltraps
+80109ef0:	e9 13 f2 ff ff       	jmp    80109108 <alltraps>
+
+80109ef5 <vector229>:
+.globl vector229
+vector229:
+  pushl $0
+80109ef5:	6a 00                	push   $0x0
+  pushl $229
+80109ef7:	68 e5 00 00 00       	push   $0xe5
+  jmp alltraps
+80109efc:	e9 07 f2 ff ff       	jmp    80109108 <alltraps>
+
+80109f01 <vector230>:
+.globl vector230
+vector230:
+  pushl $0
+80109f01:	6a 00                	push   $0x0
+  pushl $230
+80109f03:	68 e6 00 00 00       	push   $0xe6
+  jmp alltraps
+80109f08:	e9 fb f1 ff ff       	jmp    80109108 <alltraps>
+
+80109f0d <vector231>:
+.globl vector231
+vector231:
+  pushl $0
+80109f0d:	6a 00                	push   $0x0
+  pushl $231
+80109f0f:	68 e7 00 00 00       	push   $0xe7
+  jmp alltraps
+80109f14:	e9 ef f1 ff ff       	jmp    80109108 <alltraps>
+
+80109f19 <vector232>:
+.globl vector232
+vector232:
+  pushl $0
+80109f19:	6a 00                	push   $0x0
+  pushl $232
+80109f1b:	68 e8 00 00 00       	push   $0xe8
+  jmp alltraps
+80109f20:	e9 e3 f1 ff ff       	jmp    80109108 <alltraps>
+
+80109f25 <vector233>:
+.globl vector233
+vector233:
+  pushl $0
+80109f25:	6a 00                	push   $0x0
+  pushl $233
+80109f27:	68 e9 00 00 00       	push   $0xe9
+  jmp alltraps
+80109f2c:	e9 d7 f1 ff ff       	jmp    80109108 <alltraps>
+
+80109f31 <vector234>:
+.globl vector234
+vector234:
+  pushl $0
+80109f31:	6a 00                	push   $0x0
+  pushl $234
+80109f33:	68 ea 00 00 00       	push   $0xea
+  jmp alltraps
+80109f38:	e9 cb f1 ff ff       	jmp    80109108 <alltraps>
+
+80109f3d <vector235>:
+.globl vector235
+vector235:
+  pushl $0
+80109f3d:	6a 00                	push   $0x0
+  pushl $235
+80109f3f:	68 eb 00 00 00       	push   $0xeb
+  jmp alltraps
+80109f44:	e9 bf f1 ff ff       	jmp    80109108 <alltraps>
+
+80109f49 <vector236>:
+.globl vector236
+vector236:
+  pushl $0
+80109f49:	6a 00                	push   $0x0
+  pushl $236
+80109f4b:	68 ec 00 00 00       	push   $0xec
+  jmp alltraps
+80109f50:	e9 b3 f1 ff ff       	jmp    80109108 <alltraps>
+
+80109f55 <vector237>:
+.globl vector237
+vector237:
+  pushl $0
+80109f55:	6a 00                	push   $0x0
+  pushl $237
+80109f57:	68 ed 00 00 00       	push   $0xed
+  jmp alltraps
+80109f5c:	e9 a7 f1 ff ff       	jmp    80109108 <alltraps>
+
+80109f61 <vector238>:
+.globl vector238
+vector238:
+  pushl $0
+80109f61:	6a 00                	push   $0x0
+  pushl $238
+80109f63:	68 ee 00 00 00       	push   $0xee
+  jmp alltraps
+80109f68:	e9 9b f1 ff ff       	jmp    80109108 <alltraps>
+
+80109f6d <vector239>:
+.globl vector239
+vector239:
+  pushl $0
+80109f6d:	6a 00                	push   $0x0
+  pushl $239
+80109f6f:	68 ef 00 00 00       	push   $0xef
+  jmp alltraps
+80109f74:	e9 8f f1 ff ff       	jmp    80109108 <alltraps>
+
+80109f79 <vector240>:
+.globl vector240
+vector240:
+  pushl $0
+80109f79:	6a 00                	push   $0x0
+  pushl $240
+80109f7b:	68 f0 00 00 00       	push   $0xf0
+  jmp alltraps
+80109f80:	e9 83 f1 ff ff       	jmp    80109108 <alltraps>
+
+80109f85 <vector241>:
+.globl vector241
+vector241:
+  pushl $0
+80109f85:	6a 00                	push   $0x0
+  pushl $241
+80109f87:	68 f1 00 00 00       	push   $0xf1
+  jmp alltraps
+80109f8c:	e9 77 f1 ff ff       	jmp    80109108 <alltraps>
+
+80109f91 <vector242>:
+.globl vector242
+vector242:
+  pushl $0
+80109f91:	6a 00                	push   $0x0
+  pushl $242
+80109f93:	68 f2 00 00 00       	push   $0xf2
+  jmp alltraps
+80109f98:	e9 6b f1 ff ff       	jmp    80109108 <alltraps>
+
+80109f9d <vector243>:
+.globl vector243
+vector243:
+  pushl $0
+80109f9d:	6a 00                	push   $0x0
+  pushl $243
+80109f9f:	68 f3 00 00 00       	push   $0xf3
+  jmp alltraps
+80109fa4:	e9 5f f1 ff ff       	jmp    80109108 <alltraps>
+
+80109fa9 <vector244>:
+.globl vector244
+vector244:
+  pushl $0
+80109fa9:	6a 00                	push   $0x0
+  pushl $244
+80109fab:	68 f4 00 00 00       	push   $0xf4
+  jmp alltraps
+80109fb0:	e9 53 f1 ff ff       	jmp    80109108 <alltraps>
+
+80109fb5 <vector245>:
+.globl vector245
+vector245:
+  pushl $0
+80109fb5:	6a 00                	push   $0x0
+  pushl $245
+80109fb7:	68 f5 00 00 00       	push   $0xf5
+  jmp alltraps
+80109fbc:	e9 47 f1 ff ff       	jmp    80109108 <alltraps>
+
+80109fc1 <vector246>:
+.globl vector246
+vector246:
+  pushl $0
+80109fc1:	6a 00                	push   $0x0
+  pushl $246
+80109fc3:	68 f6 00 00 00       	push   $0xf6
+  jmp alltraps
+80109fc8:	e9 3b f1 ff ff       	jmp    80109108 <alltraps>
+
+80109fcd <vector247>:
+.globl vector247
+vector247:
+  pushl $0
+80109fcd:	6a 00                	push   $0x0
+  pushl $247
+80109fcf:	68 f7 00 00 00       	push   $0xf7
+  jmp alltraps
+80109fd4:	e9 2f f1 ff ff       	jmp    80109108 <alltraps>
+
+80109fd9 <vector248>:
+.globl vector248
+vector248:
+  pushl $0
+80109fd9:	6a 00                	push   $0x0
+  pushl $248
+80109fdb:	68 f8 00 00 00       	push   $0xf8
+  jmp alltraps
+80109fe0:	e9 23 f1 ff ff       	jmp    80109108 <alltraps>
+
+80109fe5 <vector249>:
+.globl vector249
+vector249:
+  pushl $0
+80109fe5:	6a 00                	push   $0x0
+  pushl $249
+80109fe7:	68 f9 00 00 00       	push   $0xf9
+  jmp alltraps
+80109fec:	e9 17 f1 ff ff       	jmp    80109108 <alltraps>
+
+80109ff1 <vector250>:
+.globl vector250
+vector250:
+  pushl $0
+80109ff1:	6a 00                	push   $0x0
+  pushl $250
+80109ff3:	68 fa 00 00 00       	push   $0xfa
+  jmp alltraps
+80109ff8:	e9 0b f1 ff ff       	jmp    80109108 <alltraps>
+
+80109ffd <vector251>:
+.globl vector251
+vector251:
+  pushl $0
+80109ffd:	6a 00                	push   $0x0
+  pushl $251
+80109fff:	68 fb 00 00 00       	push   $0xfb
+  jmp alltraps
+8010a004:	e9 ff f0 ff ff       	jmp    80109108 <alltraps>
+
+8010a009 <vector252>:
+.globl vector252
+vector252:
+  pushl $0
+8010a009:	6a 00                	push   $0x0
+  pushl $252
+8010a00b:	68 fc 00 00 00       	push   $0xfc
+  jmp alltraps
+8010a010:	e9 f3 f0 ff ff       	jmp    80109108 <alltraps>
+
+8010a015 <vector253>:
+.globl vector253
+vector253:
+  pushl $0
+8010a015:	6a 00                	push   $0x0
+  pushl $253
+8010a017:	68 fd 00 00 00       	push   $0xfd
+  jmp alltraps
+8010a01c:	e9 e7 f0 ff ff       	jmp    80109108 <alltraps>
+
+8010a021 <vector254>:
+.globl vector254
+vector254:
+  pushl $0
+8010a021:	6a 00                	push   $0x0
+  pushl $254
+8010a023:	68 fe 00 00 00       	push   $0xfe
+  jmp alltraps
+8010a028:	e9 db f0 ff ff       	jmp    80109108 <alltraps>
+
+8010a02d <vector255>:
+.globl vector255
+vector255:
+  pushl $0
+8010a02d:	6a 00                	push   $0x0
+  pushl $255
+8010a02f:	68 ff 00 00 00       	push   $0xff
+  jmp alltraps
+8010a034:	e9 cf f0 ff ff       	jmp    80109108 <alltraps>
+
+8010a039 <vstart>:
+
+// Post b to the device.  Caller holds vdisk.lock and has
+// checked that there are three free descriptors.
+static void
+vstart(struct buf *b)
+{
+8010a039:	55                   	push   %ebp
+8010a03a:	89 e5                	mov    %esp,%ebp
+8010a03c:	57                   	push   %edi
+8010a03d:	56                   	push   %esi
+8010a03e:	53                   	push   %ebx
+8010a03f:	83 ec 04             	sub    $0x4,%esp
+8010a042:	89 c2                	mov    %eax,%edx
+  int d0, d1, d2;
+  struct vreq *r;
+
+  d0 = vdisk.freedesc[--vdisk.nfree];
+8010a044:	be 00 3d 13 80       	mov    $0x80133d00,%esi
+8010a049:	8b 1d 54 3f 13 80    	mov    0x80133f54,%ebx
+8010a04f:	8d 43 ff             	lea    -0x1(%ebx),%eax
+8010a052:	a3 54 3f 13 80       	mov    %eax,0x80133f54
+8010a057:	0f b7 44 5e 50       	movzwl 0x50(%esi,%ebx,2),%eax
+8010a05c:	66 89 45 f2          	mov    %ax,-0xe(%ebp)
+8010a060:	0f b7 c8             	movzwl %ax,%ecx
+  d1 = vdisk.freedesc[--vdisk.nfree];
+8010a063:	8d 43 fe             	lea    -0x2(%ebx),%eax
+8010a066:	a3 54 3f 13 80       	mov    %eax,0x80133f54
+8010a06b:	0f b7 44 5e 4e       	movzwl 0x4e(%esi,%ebx,2),%eax
+  d2 = vdisk.freedesc[--vdisk.nfree];
+8010a070:	8d 7b fd             	lea    -0x3(%ebx),%edi
+8010a073:	89 3d 54 3f 13 80    	mov    %edi,0x80133f54
+8010a079:	0f b7 7c 5e 4c       	movzwl 0x4c(%esi,%ebx,2),%edi
+8010a07e:	66 89 7d f0          	mov    %di,-0x10(%ebp)
+  r = &vdisk.req[d0];
+8010a082:	8d 1c 09             	lea    (%ecx,%ecx,1),%ebx
+8010a085:	8d 3c 0b             	lea    (%ebx,%ecx,1),%edi
+  r->type = (b->flags & B_DIRTY) ? VBLK_OUT : VBLK_IN;
+8010a088:	8b 32                	mov    (%edx),%esi
+8010a08a:	c1 fe 02             	sar    $0x2,%esi
+8010a08d:	83 e6 01             	and    $0x1,%esi
+8010a090:	8d 1c fd 00 3d 13 80 	lea    -0x7fecc300(,%edi,8),%ebx
+8010a097:	89 b3 58 02 00 00    	mov    %esi,0x258(%ebx)
+  r->reserved = 0;
+8010a09d:	c7 83 5c 02 00 00 00 	movl   $0x0,0x25c(%ebx)
+8010a0a4:	00 00 00 
+  r->sector = b->blockno * (BSIZE / 512);
+8010a0a7:	8b 72 08             	mov    0x8(%edx),%esi
+8010a0aa:	89 b3 60 02 00 00    	mov    %esi,0x260(%ebx)
+  r->sectorhi = 0;
+8010a0b0:	c7 83 64 02 00 00 00 	movl   $0x0,0x264(%ebx)
+8010a0b7:	00 00 00 
+  r->status = 0xFF;
+8010a0ba:	c6 83 68 02 00 00 ff 	movb   $0xff,0x268(%ebx)
+  r->b = b;
+8010a0c1:	89 93 6c 02 00 00    	mov    %edx,0x26c(%ebx)
+
+  vdisk.desc[d0].addr = V2P(r);
+8010a0c7:	89 cb                	mov    %ecx,%ebx
+8010a0c9:	c1 e3 04             	shl    $0x4,%ebx
+8010a0cc:	89 de                	mov    %ebx,%esi
+8010a0ce:	03 35 44 3d 13 80    	add    0x80133d44,%esi
+8010a0d4:	8d 3c fd 58 3f 13 00 	lea    0x133f58(,%edi,8),%edi
+8010a0db:	89 3e                	mov    %edi,(%esi)
+  vdisk.desc[d0].len = 16;
+8010a0dd:	89 de                	mov    %ebx,%esi
+8010a0df:	03 35 44 3d 13 80    	add    0x80133d44,%esi
+8010a0e5:	c7 46 08 10 00 00 00 	movl   $0x10,0x8(%esi)
+  vdisk.desc[d0].flags = VD_NEXT;
+8010a0ec:	89 de                	mov    %ebx,%esi
+8010a0ee:	03 35 44 3d 13 80    	add    0x80133d44,%esi
+8010a0f4:	66 c7 46 0c 01 00    	movw   $0x1,0xc(%esi)
+  vdisk.desc[d0].next = d1;
+8010a0fa:	03 1d 44 3d 13 80    	add    0x80133d44,%ebx
+8010a100:	66 89 43 0e          	mov    %ax,0xe(%ebx)
+  vdisk.desc[d1].addr = V2P(b->data);
+8010a104:	0f b7 c0             	movzwl %ax,%eax
+8010a107:	c1 e0 04             	shl    $0x4,%eax
+8010a10a:	89 c3                	mov    %eax,%ebx
+8010a10c:	03 1d 44 3d 13 80    	add    0x80133d44,%ebx
+8010a112:	8d b2 74 00 00 80    	lea    -0x7fffff8c(%edx),%esi
+8010a118:	89 33                	mov    %esi,(%ebx)
+  vdisk.desc[d1].len = BSIZE;
+8010a11a:	89 c3                	mov    %eax,%ebx
+8010a11c:	03 1d 44 3d 13 80    	add    0x80133d44,%ebx
+8010a122:	c7 43 08 00 02 00 00 	movl   $0x200,0x8(%ebx)
+  vdisk.desc[d1].flags = VD_NEXT | ((b->flags & B_DIRTY) ? 0 : VD_WRITE);
+8010a129:	f6 02 04             	testb  $0x4,(%edx)
+8010a12c:	0f 84 9f 00 00 00    	je     8010a1d1 <vstart+0x198>
+8010a132:	bb 01 00 00 00       	mov    $0x1,%ebx
+8010a137:	89 c2                	mov    %eax,%edx
+8010a139:	03 15 44 3d 13 80    	add    0x80133d44,%edx
+8010a13f:	66 89 5a 0c          	mov    %bx,0xc(%edx)
+  vdisk.desc[d1].next = d2;
+8010a143:	03 05 44 3d 13 80    	add    0x80133d44,%eax
+8010a149:	0f b7 7d f0          	movzwl -0x10(%ebp),%edi
+8010a14d:	66 89 78 0e          	mov    %di,0xe(%eax)
+  vdisk.desc[d2].addr = V2P(&r->status);
+8010a151:	8d 0c 49             	lea    (%ecx,%ecx,2),%ecx
+8010a154:	0f b7 c7             	movzwl %di,%eax
+8010a157:	c1 e0 04             	shl    $0x4,%eax
+8010a15a:	89 c2                	mov    %eax,%edx
+8010a15c:	03 15 44 3d 13 80    	add    0x80133d44,%edx
+8010a162:	8d 0c cd 68 3f 13 00 	lea    0x133f68(,%ecx,8),%ecx
+8010a169:	89 0a                	mov    %ecx,(%edx)
+  vdisk.desc[d2].len = 1;
+8010a16b:	89 c2                	mov    %eax,%edx
+8010a16d:	03 15 44 3d 13 80    	add    0x80133d44,%edx
+8010a173:	c7 42 08 01 00 00 00 	movl   $0x1,0x8(%edx)
+  vdisk.desc[d2].flags = VD_WRITE;
+8010a17a:	89 c2                	mov    %eax,%edx
+8010a17c:	03 15 44 3d 13 80    	add    0x80133d44,%edx
+8010a182:	66 c7 42 0c 02 00    	movw   $0x2,0xc(%edx)
+  vdisk.desc[d2].next = 0;
+8010a188:	03 05 44 3d 13 80    	add    0x80133d44,%eax
+8010a18e:	66 c7 40 0e 00 00    	movw   $0x0,0xe(%eax)
+
+  vdisk.avail->ring[vdisk.avail->idx % vdisk.n] = d0;
+8010a194:	8b 0d 48 3d 13 80    	mov    0x80133d48,%ecx
+8010a19a:	0f b7 41 02          	movzwl 0x2(%ecx),%eax
+8010a19e:	99                   	cltd
+8010a19f:	f7 3d 38 3d 13 80    	idivl  0x80133d38
+8010a1a5:	0f b7 45 f2          	movzwl -0xe(%ebp),%eax
+8010a1a9:	66 89 44 51 04       	mov    %ax,0x4(%ecx,%edx,2)
+  __sync_synchronize();
+8010a1ae:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  vdisk.avail->idx++;
+8010a1b3:	8b 15 48 3d 13 80    	mov    0x80133d48,%edx
+8010a1b9:	0f b7 42 02          	movzwl 0x2(%edx),%eax
+8010a1bd:	83 c0 01             	add    $0x1,%eax
+8010a1c0:	66 89 42 02          	mov    %ax,0x2(%edx)
+  __sync_synchronize();
+8010a1c4:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+}
+8010a1c9:	83 c4 04             	add    $0x4,%esp
+8010a1cc:	5b                   	pop    %ebx
+8010a1cd:	5e                   	pop    %esi
+8010a1ce:	5f                   	pop    %edi
+8010a1cf:	5d                   	pop    %ebp
+8010a1d0:	c3                   	ret
+  vdisk.desc[d1].flags = VD_NEXT | ((b->flags & B_DIRTY) ? 0 : VD_WRITE);
+8010a1d1:	bb 03 00 00 00       	mov    $0x3,%ebx
+8010a1d6:	e9 5c ff ff ff       	jmp    8010a137 <vstart+0xfe>
+
+8010a1db <virtioinit>:
+{
+8010a1db:	55                   	push   %ebp
+8010a1dc:	89 e5                	mov    %esp,%ebp
+8010a1de:	56                   	push   %esi
+8010a1df:	53                   	push   %ebx
+  if((tag = pcifindid(VIRTIO_VENDOR, VIRTIO_BLK)) < 0)
+8010a1e0:	83 ec 08             	sub    $0x8,%esp
+8010a1e3:	68 01 10 00 00       	push   $0x1001
+8010a1e8:	68 f4 1a 00 00       	push   $0x1af4
+8010a1ed:	e8 38 b2 ff ff       	call   8010542a <pcifindid>
+8010a1f2:	83 c4 10             	add    $0x10,%esp
+8010a1f5:	85 c0                	test   %eax,%eax
+8010a1f7:	0f 88 d9 01 00 00    	js     8010a3d6 <virtioinit+0x1fb>
+8010a1fd:	89 c3                	mov    %eax,%ebx
+  bar = pciread(tag, 0x10);                     // BAR0
+8010a1ff:	83 ec 08             	sub    $0x8,%esp
+8010a202:	6a 10                	push   $0x10
+8010a204:	50                   	push   %eax
+8010a205:	e8 fe b0 ff ff       	call   80105308 <pciread>
+8010a20a:	89 c6                	mov    %eax,%esi
+  if(!(bar & 1))
+8010a20c:	83 c4 10             	add    $0x10,%esp
+8010a20f:	a8 01                	test   $0x1,%al
+8010a211:	0f 84 c6 01 00 00    	je     8010a3dd <virtioinit+0x202>
+  pciwrite(tag, 0x04, pciread(tag, 0x04) | 0x5);  // I/O and bus master
+8010a217:	83 ec 08             	sub    $0x8,%esp
+8010a21a:	6a 04                	push   $0x4
+8010a21c:	53                   	push   %ebx
+8010a21d:	e8 e6 b0 ff ff       	call   80105308 <pciread>
+8010a222:	83 c4 0c             	add    $0xc,%esp
+8010a225:	83 c8 05             	or     $0x5,%eax
+8010a228:	50                   	push   %eax
+8010a229:	6a 04                	push   $0x4
+8010a22b:	53                   	push   %ebx
+8010a22c:	e8 d5 b1 ff ff       	call   80105406 <pciwrite>
+  vdisk.base = bar & ~3;
+8010a231:	83 e6 fc             	and    $0xfffffffc,%esi
+8010a234:	66 89 35 34 3d 13 80 	mov    %si,0x80133d34
+  initlock(&vdisk.lock, "virtio");
+8010a23b:	83 c4 08             	add    $0x8,%esp
+8010a23e:	68 18 c4 10 80       	push   $0x8010c418
+8010a243:	68 00 3d 13 80       	push   $0x80133d00
+8010a248:	e8 01 d7 ff ff       	call   8010794e <initlock>
+  outb(vdisk.base + VIO_STATUS, 0);             // reset
+8010a24d:	0f b7 0d 34 3d 13 80 	movzwl 0x80133d34,%ecx
+8010a254:	8d 51 12             	lea    0x12(%ecx),%edx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010a257:	b8 00 00 00 00       	mov    $0x0,%eax
+8010a25c:	ee                   	out    %al,(%dx)
+8010a25d:	b8 01 00 00 00       	mov    $0x1,%eax
+8010a262:	ee                   	out    %al,(%dx)
+8010a263:	b8 03 00 00 00       	mov    $0x3,%eax
+8010a268:	ee                   	out    %al,(%dx)
+  outl(vdisk.base + VIO_GUESTFEAT, 0);          // no optional features
+8010a269:	8d 51 04             	lea    0x4(%ecx),%edx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010a26c:	b8 00 00 00 00       	mov    $0x0,%eax
+8010a271:	ef                   	out    %eax,(%dx)
+  outw(vdisk.base + VIO_QSELECT, 0);
+8010a272:	8d 51 0e             	lea    0xe(%ecx),%edx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010a275:	66 ef                	out    %ax,(%dx)
+  vdisk.n = inw(vdisk.base + VIO_QSIZE);
+8010a277:	8d 51 0c             	lea    0xc(%ecx),%edx
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010a27a:	66 ed                	in     (%dx),%ax
+8010a27c:	0f b7 c0             	movzwl %ax,%eax
+8010a27f:	a3 38 3d 13 80       	mov    %eax,0x80133d38
+  if(vdisk.n == 0 || vdisk.n > VQMAX)
+8010a284:	83 c4 10             	add    $0x10,%esp
+8010a287:	85 c0                	test   %eax,%eax
+8010a289:	0f 94 c2             	sete   %dl
+8010a28c:	3d 00 01 00 00       	cmp    $0x100,%eax
+8010a291:	0f 9f c1             	setg   %cl
+8010a294:	08 ca                	or     %cl,%dl
+8010a296:	0f 85 48 01 00 00    	jne    8010a3e4 <virtioinit+0x209>
+  usedoff = PGROUNDUP(16*vdisk.n + 6 + 2*vdisk.n);
+8010a29c:	89 c2                	mov    %eax,%edx
+8010a29e:	c1 e2 04             	shl    $0x4,%edx
+8010a2a1:	8d b4 42 05 10 00 00 	lea    0x1005(%edx,%eax,2),%esi
+8010a2a8:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  sz = usedoff + PGROUNDUP(6 + 8*vdisk.n);
+8010a2ae:	8d 04 c5 05 10 00 00 	lea    0x1005(,%eax,8),%eax
+8010a2b5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010a2ba:	01 f0                	add    %esi,%eax
+  for(vdisk.order = 0; (PGSIZE << vdisk.order) < sz; vdisk.order++)
+8010a2bc:	c7 05 40 3d 13 80 00 	movl   $0x0,0x80133d40
+8010a2c3:	00 00 00 
+8010a2c6:	eb 09                	jmp    8010a2d1 <virtioinit+0xf6>
+8010a2c8:	83 c1 01             	add    $0x1,%ecx
+8010a2cb:	89 0d 40 3d 13 80    	mov    %ecx,0x80133d40
+8010a2d1:	8b 0d 40 3d 13 80    	mov    0x80133d40,%ecx
+8010a2d7:	ba 00 10 00 00       	mov    $0x1000,%edx
+8010a2dc:	d3 e2                	shl    %cl,%edx
+8010a2de:	39 c2                	cmp    %eax,%edx
+8010a2e0:	7c e6                	jl     8010a2c8 <virtioinit+0xed>
+  if((vdisk.mem = kalloc_order(vdisk.order)) == 0)
+8010a2e2:	83 ec 0c             	sub    $0xc,%esp
+8010a2e5:	51                   	push   %ecx
+8010a2e6:	e8 87 97 ff ff       	call   80103a72 <kalloc_order>
+8010a2eb:	a3 3c 3d 13 80       	mov    %eax,0x80133d3c
+8010a2f0:	83 c4 10             	add    $0x10,%esp
+8010a2f3:	85 c0                	test   %eax,%eax
+8010a2f5:	0f 84 f0 00 00 00    	je     8010a3eb <virtioinit+0x210>
+  memset(vdisk.mem, 0, PGSIZE << vdisk.order);
+8010a2fb:	8b 0d 40 3d 13 80    	mov    0x80133d40,%ecx
+8010a301:	ba 00 10 00 00       	mov    $0x1000,%edx
+8010a306:	d3 e2                	shl    %cl,%edx
+8010a308:	83 ec 04             	sub    $0x4,%esp
+8010a30b:	52                   	push   %edx
+8010a30c:	6a 00                	push   $0x0
+8010a30e:	50                   	push   %eax
+8010a30f:	e8 2a d8 ff ff       	call   80107b3e <memset>
+  vdisk.desc = (struct vdesc*)vdisk.mem;
+8010a314:	a1 3c 3d 13 80       	mov    0x80133d3c,%eax
+8010a319:	a3 44 3d 13 80       	mov    %eax,0x80133d44
+  vdisk.avail = (struct vavail*)(vdisk.mem + 16*vdisk.n);
+8010a31e:	8b 0d 38 3d 13 80    	mov    0x80133d38,%ecx
+8010a324:	89 ca                	mov    %ecx,%edx
+8010a326:	c1 e2 04             	shl    $0x4,%edx
+8010a329:	01 c2                	add    %eax,%edx
+8010a32b:	89 15 48 3d 13 80    	mov    %edx,0x80133d48
+  vdisk.used = (struct vused*)(vdisk.mem + usedoff);
+8010a331:	01 c6                	add    %eax,%esi
+8010a333:	89 35 4c 3d 13 80    	mov    %esi,0x80133d4c
+  for(i = 0; i < vdisk.n; i++)
+8010a339:	83 c4 10             	add    $0x10,%esp
+8010a33c:	ba 00 00 00 00       	mov    $0x0,%edx
+8010a341:	eb 0b                	jmp    8010a34e <virtioinit+0x173>
+    vdisk.freedesc[i] = i;
+8010a343:	66 89 94 12 52 3d 13 	mov    %dx,-0x7fecc2ae(%edx,%edx,1)
+8010a34a:	80 
+  for(i = 0; i < vdisk.n; i++)
+8010a34b:	83 c2 01             	add    $0x1,%edx
+8010a34e:	39 d1                	cmp    %edx,%ecx
+8010a350:	7f f1                	jg     8010a343 <virtioinit+0x168>
+  vdisk.nfree = vdisk.n;
+8010a352:	89 0d 54 3f 13 80    	mov    %ecx,0x80133f54
+  outl(vdisk.base + VIO_QADDR, V2P(vdisk.mem) / PGSIZE);
+8010a358:	05 00 00 00 80       	add    $0x80000000,%eax
+8010a35d:	c1 e8 0c             	shr    $0xc,%eax
+8010a360:	0f b7 0d 34 3d 13 80 	movzwl 0x80133d34,%ecx
+8010a367:	8d 51 08             	lea    0x8(%ecx),%edx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010a36a:	ef                   	out    %eax,(%dx)
+  outb(vdisk.base + VIO_STATUS, VS_ACK|VS_DRIVER|VS_DRIVER_OK);
+8010a36b:	8d 51 12             	lea    0x12(%ecx),%edx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010a36e:	b8 07 00 00 00       	mov    $0x7,%eax
+8010a373:	ee                   	out    %al,(%dx)
+  virtioirq = pciread(tag, 0x3C) & 0xFF;        // interrupt line
+8010a374:	83 ec 08             	sub    $0x8,%esp
+8010a377:	6a 3c                	push   $0x3c
+8010a379:	53                   	push   %ebx
+8010a37a:	e8 89 af ff ff       	call   80105308 <pciread>
+8010a37f:	0f b6 c0             	movzbl %al,%eax
+8010a382:	a3 08 f4 10 80       	mov    %eax,0x8010f408
+  ioapicenable(virtioirq, ncpu - 1);
+8010a387:	83 c4 08             	add    $0x8,%esp
+8010a38a:	8b 1d 64 1e 12 80    	mov    0x80121e64,%ebx
+8010a390:	8d 53 ff             	lea    -0x1(%ebx),%edx
+8010a393:	52                   	push   %edx
+8010a394:	50                   	push   %eax
+8010a395:	e8 a3 8e ff ff       	call   8010323d <ioapicenable>
+          vdisk.base, virtioirq, vdisk.n / 3);
+8010a39a:	8b 0d 38 3d 13 80    	mov    0x80133d38,%ecx
+  cprintf("virtio: block device at 0x%x irq %d, %d requests\n",
+8010a3a0:	ba 56 55 55 55       	mov    $0x55555556,%edx
+8010a3a5:	89 c8                	mov    %ecx,%eax
+8010a3a7:	f7 ea                	imul   %edx
+8010a3a9:	c1 f9 1f             	sar    $0x1f,%ecx
+8010a3ac:	29 ca                	sub    %ecx,%edx
+8010a3ae:	52                   	push   %edx
+8010a3af:	ff 35 08 f4 10 80    	push   0x8010f408
+8010a3b5:	0f b7 05 34 3d 13 80 	movzwl 0x80133d34,%eax
+8010a3bc:	50                   	push   %eax
+8010a3bd:	68 34 c4 10 80       	push   $0x8010c434
+8010a3c2:	e8 25 6c ff ff       	call   80100fec <cprintf>
+  return 0;
+8010a3c7:	83 c4 20             	add    $0x20,%esp
+8010a3ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010a3cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010a3d2:	5b                   	pop    %ebx
+8010a3d3:	5e                   	pop    %esi
+8010a3d4:	5d                   	pop    %ebp
+8010a3d5:	c3                   	ret
+    return -1;
+8010a3d6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010a3db:	eb f2                	jmp    8010a3cf <virtioinit+0x1f4>
+    return -1;
+8010a3dd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010a3e2:	eb eb                	jmp    8010a3cf <virtioinit+0x1f4>
+    return -1;
+8010a3e4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010a3e9:	eb e4                	jmp    8010a3cf <virtioinit+0x1f4>
+    return -1;
+8010a3eb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010a3f0:	eb dd                	jmp    8010a3cf <virtioinit+0x1f4>
+
+8010a3f2 <virtiosubmit>:
+
+// Start the request for b, or queue it until descriptors
+// are free.  Caller holds idelock.
+void
+virtiosubmit(struct buf *b)
+{
+8010a3f2:	55                   	push   %ebp
+8010a3f3:	89 e5                	mov    %esp,%ebp
+8010a3f5:	53                   	push   %ebx
+8010a3f6:	83 ec 10             	sub    $0x10,%esp
+8010a3f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&vdisk.lock);
+8010a3fc:	68 00 3d 13 80       	push   $0x80133d00
+8010a401:	e8 8c d6 ff ff       	call   80107a92 <acquire>
+  if(vdisk.pending == 0 && vdisk.nfree >= 3){
+8010a406:	83 c4 10             	add    $0x10,%esp
+8010a409:	83 3d 58 57 13 80 00 	cmpl   $0x0,0x80135758
+8010a410:	74 33                	je     8010a445 <virtiosubmit+0x53>
+    vstart(b);
+    outw(vdisk.base + VIO_QNOTIFY, 0);
+  } else {
+    b->qnext = 0;
+8010a412:	c7 43 60 00 00 00 00 	movl   $0x0,0x60(%ebx)
+    if(vdisk.pending)
+8010a419:	83 3d 58 57 13 80 00 	cmpl   $0x0,0x80135758
+8010a420:	74 46                	je     8010a468 <virtiosubmit+0x76>
+      vdisk.pendtail->qnext = b;
+8010a422:	a1 5c 57 13 80       	mov    0x8013575c,%eax
+8010a427:	89 58 60             	mov    %ebx,0x60(%eax)
+    else
+      vdisk.pending = b;
+    vdisk.pendtail = b;
+8010a42a:	89 1d 5c 57 13 80    	mov    %ebx,0x8013575c
+  }
+  release(&vdisk.lock);
+8010a430:	83 ec 0c             	sub    $0xc,%esp
+8010a433:	68 00 3d 13 80       	push   $0x80133d00
+8010a438:	e8 ba d6 ff ff       	call   80107af7 <release>
+}
+8010a43d:	83 c4 10             	add    $0x10,%esp
+8010a440:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010a443:	c9                   	leave
+8010a444:	c3                   	ret
+  if(vdisk.pending == 0 && vdisk.nfree >= 3){
+8010a445:	83 3d 54 3f 13 80 02 	cmpl   $0x2,0x80133f54
+8010a44c:	7e c4                	jle    8010a412 <virtiosubmit+0x20>
+    vstart(b);
+8010a44e:	89 d8                	mov    %ebx,%eax
+8010a450:	e8 e4 fb ff ff       	call   8010a039 <vstart>
+    outw(vdisk.base + VIO_QNOTIFY, 0);
+8010a455:	0f b7 05 34 3d 13 80 	movzwl 0x80133d34,%eax
+8010a45c:	8d 50 10             	lea    0x10(%eax),%edx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010a45f:	b8 00 00 00 00       	mov    $0x0,%eax
+8010a464:	66 ef                	out    %ax,(%dx)
+}
+8010a466:	eb c8                	jmp    8010a430 <virtiosubmit+0x3e>
+      vdisk.pending = b;
+8010a468:	89 1d 58 57 13 80    	mov    %ebx,0x80135758
+8010a46e:	eb ba                	jmp    8010a42a <virtiosubmit+0x38>
+
+8010a470 <virtiointr>:
+
+// Interrupt handler.
+void
+virtiointr(void)
+{
+8010a470:	55                   	push   %ebp
+8010a471:	89 e5                	mov    %esp,%ebp
+8010a473:	57                   	push   %edi
+8010a474:	56                   	push   %esi
+8010a475:	53                   	push   %ebx
+8010a476:	83 ec 28             	sub    $0x28,%esp
+  struct buf *b, *done;
+  struct vreq *r;
+  int d, started;
+
+  inb(vdisk.base + VIO_ISR);  // acknowledge the interrupt
+8010a479:	0f b7 05 34 3d 13 80 	movzwl 0x80133d34,%eax
+8010a480:	8d 50 13             	lea    0x13(%eax),%edx
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010a483:	ec                   	in     (%dx),%al
+
+  acquire(&vdisk.lock);
+8010a484:	68 00 3d 13 80       	push   $0x80133d00
+8010a489:	e8 04 d6 ff ff       	call   80107a92 <acquire>
+  done = 0;
+  while(vdisk.usedidx != vdisk.used->idx){
+8010a48e:	83 c4 10             	add    $0x10,%esp
+  done = 0;
+8010a491:	be 00 00 00 00       	mov    $0x0,%esi
+  while(vdisk.usedidx != vdisk.used->idx){
+8010a496:	a1 4c 3d 13 80       	mov    0x80133d4c,%eax
+8010a49b:	0f b7 40 02          	movzwl 0x2(%eax),%eax
+8010a49f:	66 39 05 50 3d 13 80 	cmp    %ax,0x80133d50
+8010a4a6:	0f 84 d2 00 00 00    	je     8010a57e <virtiointr+0x10e>
+    __sync_synchronize();
+8010a4ac:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    d = vdisk.used->ring[vdisk.usedidx % vdisk.n].id;
+8010a4b1:	0f b7 0d 50 3d 13 80 	movzwl 0x80133d50,%ecx
+8010a4b8:	0f b7 c1             	movzwl %cx,%eax
+8010a4bb:	99                   	cltd
+8010a4bc:	f7 3d 38 3d 13 80    	idivl  0x80133d38
+8010a4c2:	a1 4c 3d 13 80       	mov    0x80133d4c,%eax
+8010a4c7:	8b 44 d0 04          	mov    0x4(%eax,%edx,8),%eax
+    vdisk.usedidx++;
+8010a4cb:	83 c1 01             	add    $0x1,%ecx
+8010a4ce:	66 89 0d 50 3d 13 80 	mov    %cx,0x80133d50
+    r = &vdisk.req[d];
+    if(r->status != 0)
+8010a4d5:	8d 0c 40             	lea    (%eax,%eax,2),%ecx
+8010a4d8:	8d 14 cd 00 00 00 00 	lea    0x0(,%ecx,8),%edx
+8010a4df:	80 ba 68 3f 13 80 00 	cmpb   $0x0,-0x7fecc098(%edx)
+8010a4e6:	0f 85 85 00 00 00    	jne    8010a571 <virtiointr+0x101>
+      panic("virtio: disk error");
+    b = r->b;
+8010a4ec:	bb 00 3d 13 80       	mov    $0x80133d00,%ebx
+8010a4f1:	8d 14 00             	lea    (%eax,%eax,1),%edx
+8010a4f4:	8d 3c 02             	lea    (%edx,%eax,1),%edi
+8010a4f7:	8d 0c fd 00 00 00 00 	lea    0x0(,%edi,8),%ecx
+8010a4fe:	8b b9 6c 3f 13 80    	mov    -0x7fecc094(%ecx),%edi
+    r->b = 0;
+8010a504:	c7 81 6c 3f 13 80 00 	movl   $0x0,-0x7fecc094(%ecx)
+8010a50b:	00 00 00 
+    b->qnext = done;
+8010a50e:	89 77 60             	mov    %esi,0x60(%edi)
+    done = b;
+    vdisk.freedesc[vdisk.nfree++] = vdisk.desc[vdisk.desc[d].next].next;
+8010a511:	89 c1                	mov    %eax,%ecx
+8010a513:	c1 e1 04             	shl    $0x4,%ecx
+8010a516:	03 0d 44 3d 13 80    	add    0x80133d44,%ecx
+8010a51c:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+8010a51f:	0f b7 71 0e          	movzwl 0xe(%ecx),%esi
+8010a523:	c1 e6 04             	shl    $0x4,%esi
+8010a526:	89 f1                	mov    %esi,%ecx
+8010a528:	8b 15 54 3f 13 80    	mov    0x80133f54,%edx
+8010a52e:	8d 72 01             	lea    0x1(%edx),%esi
+8010a531:	89 35 54 3f 13 80    	mov    %esi,0x80133f54
+8010a537:	8b 35 44 3d 13 80    	mov    0x80133d44,%esi
+8010a53d:	0f b7 74 0e 0e       	movzwl 0xe(%esi,%ecx,1),%esi
+8010a542:	66 89 74 53 52       	mov    %si,0x52(%ebx,%edx,2)
+    vdisk.freedesc[vdisk.nfree++] = vdisk.desc[d].next;
+8010a547:	8d 72 02             	lea    0x2(%edx),%esi
+8010a54a:	89 35 54 3f 13 80    	mov    %esi,0x80133f54
+8010a550:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+8010a553:	0f b7 4e 0e          	movzwl 0xe(%esi),%ecx
+8010a557:	66 89 4c 53 54       	mov    %cx,0x54(%ebx,%edx,2)
+    vdisk.freedesc[vdisk.nfree++] = d;
+8010a55c:	8d 4a 03             	lea    0x3(%edx),%ecx
+8010a55f:	89 0d 54 3f 13 80    	mov    %ecx,0x80133f54
+8010a565:	66 89 44 53 56       	mov    %ax,0x56(%ebx,%edx,2)
+    done = b;
+8010a56a:	89 fe                	mov    %edi,%esi
+8010a56c:	e9 25 ff ff ff       	jmp    8010a496 <virtiointr+0x26>
+      panic("virtio: disk error");
+8010a571:	83 ec 0c             	sub    $0xc,%esp
+8010a574:	68 1f c4 10 80       	push   $0x8010c41f
+8010a579:	e8 ad 67 ff ff       	call   80100d2b <panic>
+  }
+
+  // Start waiting requests in the freed descriptors.
+  started = 0;
+8010a57e:	ba 00 00 00 00       	mov    $0x0,%edx
+8010a583:	eb 13                	jmp    8010a598 <virtiointr+0x128>
+  while(vdisk.pending && vdisk.nfree >= 3){
+    b = vdisk.pending;
+    vdisk.pending = b->qnext;
+8010a585:	8b 50 60             	mov    0x60(%eax),%edx
+8010a588:	89 15 58 57 13 80    	mov    %edx,0x80135758
+    vstart(b);
+8010a58e:	e8 a6 fa ff ff       	call   8010a039 <vstart>
+    started = 1;
+8010a593:	ba 01 00 00 00       	mov    $0x1,%edx
+  while(vdisk.pending && vdisk.nfree >= 3){
+8010a598:	a1 58 57 13 80       	mov    0x80135758,%eax
+8010a59d:	85 c0                	test   %eax,%eax
+8010a59f:	74 09                	je     8010a5aa <virtiointr+0x13a>
+8010a5a1:	83 3d 54 3f 13 80 02 	cmpl   $0x2,0x80133f54
+8010a5a8:	7f db                	jg     8010a585 <virtiointr+0x115>
+  }
+  if(started)
+8010a5aa:	85 d2                	test   %edx,%edx
+8010a5ac:	74 11                	je     8010a5bf <virtiointr+0x14f>
+    outw(vdisk.base + VIO_QNOTIFY, 0);
+8010a5ae:	0f b7 05 34 3d 13 80 	movzwl 0x80133d34,%eax
+8010a5b5:	8d 50 10             	lea    0x10(%eax),%edx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010a5b8:	b8 00 00 00 00       	mov    $0x0,%eax
+8010a5bd:	66 ef                	out    %ax,(%dx)
+  release(&vdisk.lock);
+8010a5bf:	83 ec 0c             	sub    $0xc,%esp
+8010a5c2:	68 00 3d 13 80       	push   $0x80133d00
+8010a5c7:	e8 2b d5 ff ff       	call   80107af7 <release>
+
+  if(done)
+8010a5cc:	83 c4 10             	add    $0x10,%esp
+8010a5cf:	85 f6                	test   %esi,%esi
+8010a5d1:	74 0c                	je     8010a5df <virtiointr+0x16f>
+    idedone(done);
+8010a5d3:	83 ec 0c             	sub    $0xc,%esp
+8010a5d6:	56                   	push   %esi
+8010a5d7:	e8 9d 8a ff ff       	call   80103079 <idedone>
+8010a5dc:	83 c4 10             	add    $0x10,%esp
+}
+8010a5df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a5e2:	5b                   	pop    %ebx
+8010a5e3:	5e                   	pop    %esi
+8010a5e4:	5f                   	pop    %edi
+8010a5e5:	5d                   	pop    %ebp
+8010a5e6:	c3                   	ret
+
+8010a5e7 <vmafind>:
+}
+
+// Return the file-backed region of p containing va, or 0.
+static struct vma*
+vmafind(struct proc *p, uint va)
+{
+8010a5e7:	55                   	push   %ebp
+8010a5e8:	89 e5                	mov    %esp,%ebp
+8010a5ea:	53                   	push   %ebx
+8010a5eb:	89 c1                	mov    %eax,%ecx
+8010a5ed:	89 d3                	mov    %edx,%ebx
+  struct vma *v;
+
+  for(v = p->vma; v < &p->vma[NVMA]; v++)
+8010a5ef:	8d 80 a8 00 00 00    	lea    0xa8(%eax),%eax
+8010a5f5:	eb 03                	jmp    8010a5fa <vmafind+0x13>
+8010a5f7:	83 c0 18             	add    $0x18,%eax
+8010a5fa:	8d 91 28 02 00 00    	lea    0x228(%ecx),%edx
+8010a600:	39 d0                	cmp    %edx,%eax
+8010a602:	73 21                	jae    8010a625 <vmafind+0x3e>
+    if(v->ip && va >= v->start && va < PGROUNDUP(v->start + v->len))
+8010a604:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+8010a608:	74 ed                	je     8010a5f7 <vmafind+0x10>
+8010a60a:	8b 10                	mov    (%eax),%edx
+8010a60c:	39 d3                	cmp    %edx,%ebx
+8010a60e:	72 e7                	jb     8010a5f7 <vmafind+0x10>
+8010a610:	03 50 04             	add    0x4(%eax),%edx
+8010a613:	81 c2 ff 0f 00 00    	add    $0xfff,%edx
+8010a619:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+8010a61f:	39 d3                	cmp    %edx,%ebx
+8010a621:	73 d4                	jae    8010a5f7 <vmafind+0x10>
+8010a623:	eb 05                	jmp    8010a62a <vmafind+0x43>
+      return v;
+  return 0;
+8010a625:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010a62a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010a62d:	c9                   	leave
+8010a62e:	c3                   	ret
+
+8010a62f <walkpgdir>:
+{
+8010a62f:	55                   	push   %ebp
+8010a630:	89 e5                	mov    %esp,%ebp
+8010a632:	56                   	push   %esi
+8010a633:	53                   	push   %ebx
+8010a634:	89 d3                	mov    %edx,%ebx
+  pde = &pgdir[PDX(va)];
+8010a636:	c1 ea 16             	shr    $0x16,%edx
+8010a639:	8d 34 90             	lea    (%eax,%edx,4),%esi
+  if(*pde & PTE_PS)
+8010a63c:	8b 06                	mov    (%esi),%eax
+8010a63e:	a8 80                	test   $0x80,%al
+8010a640:	75 21                	jne    8010a663 <walkpgdir+0x34>
+  if(*pde & PTE_P){
+8010a642:	a8 01                	test   $0x1,%al
+8010a644:	74 2a                	je     8010a670 <walkpgdir+0x41>
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010a646:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010a64b:	05 00 00 00 80       	add    $0x80000000,%eax
+  return &pgtab[PTX(va)];
+8010a650:	c1 eb 0c             	shr    $0xc,%ebx
+8010a653:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+8010a659:	8d 04 98             	lea    (%eax,%ebx,4),%eax
+}
+8010a65c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010a65f:	5b                   	pop    %ebx
+8010a660:	5e                   	pop    %esi
+8010a661:	5d                   	pop    %ebp
+8010a662:	c3                   	ret
+    panic("walkpgdir: large page");
+8010a663:	83 ec 0c             	sub    $0xc,%esp
+8010a666:	68 66 c4 10 80       	push   $0x8010c466
+8010a66b:	e8 bb 66 ff ff       	call   80100d2b <panic>
+    if(!alloc || (pgtab = (pte_t*)kalloc_zeroed()) == 0)
+8010a670:	85 c9                	test   %ecx,%ecx
+8010a672:	74 16                	je     8010a68a <walkpgdir+0x5b>
+8010a674:	e8 7c 95 ff ff       	call   80103bf5 <kalloc_zeroed>
+8010a679:	85 c0                	test   %eax,%eax
+8010a67b:	74 0d                	je     8010a68a <walkpgdir+0x5b>
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+8010a67d:	8d 90 00 00 00 80    	lea    -0x80000000(%eax),%edx
+8010a683:	83 ca 07             	or     $0x7,%edx
+8010a686:	89 16                	mov    %edx,(%esi)
+8010a688:	eb c6                	jmp    8010a650 <walkpgdir+0x21>
+      return 0;
+8010a68a:	b8 00 00 00 00       	mov    $0x0,%eax
+8010a68f:	eb cb                	jmp    8010a65c <walkpgdir+0x2d>
+
+8010a691 <mappages>:
+{
+8010a691:	55                   	push   %ebp
+8010a692:	89 e5                	mov    %esp,%ebp
+8010a694:	57                   	push   %edi
+8010a695:	56                   	push   %esi
+8010a696:	53                   	push   %ebx
+8010a697:	83 ec 1c             	sub    $0x1c,%esp
+8010a69a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010a69d:	8b 75 08             	mov    0x8(%ebp),%esi
+  a = (char*)PGROUNDDOWN((uint)va);
+8010a6a0:	89 d3                	mov    %edx,%ebx
+8010a6a2:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  last = (char*)PGROUNDDOWN(((uint)va) + size - 1);
+8010a6a8:	8d 44 0a ff          	lea    -0x1(%edx,%ecx,1),%eax
+8010a6ac:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010a6b1:	89 c7                	mov    %eax,%edi
+    if((pte = walkpgdir(pgdir, a, 1)) == 0)
+8010a6b3:	b9 01 00 00 00       	mov    $0x1,%ecx
+8010a6b8:	89 da                	mov    %ebx,%edx
+8010a6ba:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010a6bd:	e8 6d ff ff ff       	call   8010a62f <walkpgdir>
+8010a6c2:	85 c0                	test   %eax,%eax
+8010a6c4:	74 2e                	je     8010a6f4 <mappages+0x63>
+    if(*pte & PTE_P)
+8010a6c6:	f6 00 01             	testb  $0x1,(%eax)
+8010a6c9:	75 1c                	jne    8010a6e7 <mappages+0x56>
+    *pte = pa | perm | PTE_P;
+8010a6cb:	89 f2                	mov    %esi,%edx
+8010a6cd:	0b 55 0c             	or     0xc(%ebp),%edx
+8010a6d0:	83 ca 01             	or     $0x1,%edx
+8010a6d3:	89 10                	mov    %edx,(%eax)
+    if(a == last)
+8010a6d5:	39 fb                	cmp    %edi,%ebx
+8010a6d7:	74 28                	je     8010a701 <mappages+0x70>
+    a += PGSIZE;
+8010a6d9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    pa += PGSIZE;
+8010a6df:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    if((pte = walkpgdir(pgdir, a, 1)) == 0)
+8010a6e5:	eb cc                	jmp    8010a6b3 <mappages+0x22>
+      panic("remap");
+8010a6e7:	83 ec 0c             	sub    $0xc,%esp
+8010a6ea:	68 7c c4 10 80       	push   $0x8010c47c
+8010a6ef:	e8 37 66 ff ff       	call   80100d2b <panic>
+      return -1;
+8010a6f4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010a6f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a6fc:	5b                   	pop    %ebx
+8010a6fd:	5e                   	pop    %esi
+8010a6fe:	5f                   	pop    %edi
+8010a6ff:	5d                   	pop    %ebp
+8010a700:	c3                   	ret
+  return 0;
+8010a701:	b8 00 00 00 00       	mov    $0x0,%eax
+8010a706:	eb f1                	jmp    8010a6f9 <mappages+0x68>
+
+8010a708 <mapkernel>:
+{
+8010a708:	55                   	push   %ebp
+8010a709:	89 e5                	mov    %esp,%ebp
+8010a70b:	57                   	push   %edi
+8010a70c:	56                   	push   %esi
+8010a70d:	53                   	push   %ebx
+8010a70e:	83 ec 1c             	sub    $0x1c,%esp
+8010a711:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010a714:	89 d6                	mov    %edx,%esi
+8010a716:	89 cf                	mov    %ecx,%edi
+  while(size > 0){
+8010a718:	eb 32                	jmp    8010a74c <mapkernel+0x44>
+        panic("remap");
+8010a71a:	83 ec 0c             	sub    $0xc,%esp
+8010a71d:	68 7c c4 10 80       	push   $0x8010c47c
+8010a722:	e8 04 66 ff ff       	call   80100d2b <panic>
+      n = size;
+8010a727:	89 fb                	mov    %edi,%ebx
+    } else if(mappages(pgdir, va, n, pa, perm) < 0)
+8010a729:	83 ec 08             	sub    $0x8,%esp
+8010a72c:	ff 75 0c             	push   0xc(%ebp)
+8010a72f:	ff 75 08             	push   0x8(%ebp)
+8010a732:	89 d9                	mov    %ebx,%ecx
+8010a734:	89 f2                	mov    %esi,%edx
+8010a736:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010a739:	e8 53 ff ff ff       	call   8010a691 <mappages>
+8010a73e:	83 c4 10             	add    $0x10,%esp
+8010a741:	85 c0                	test   %eax,%eax
+8010a743:	78 57                	js     8010a79c <mapkernel+0x94>
+    va += n;
+8010a745:	01 de                	add    %ebx,%esi
+    pa += n;
+8010a747:	01 5d 08             	add    %ebx,0x8(%ebp)
+    size -= n;
+8010a74a:	29 df                	sub    %ebx,%edi
+  while(size > 0){
+8010a74c:	85 ff                	test   %edi,%edi
+8010a74e:	74 3f                	je     8010a78f <mapkernel+0x87>
+    n = LPGSIZE - (uint)va % LPGSIZE;
+8010a750:	89 f2                	mov    %esi,%edx
+8010a752:	89 f0                	mov    %esi,%eax
+8010a754:	25 ff ff 3f 00       	and    $0x3fffff,%eax
+8010a759:	bb 00 00 40 00       	mov    $0x400000,%ebx
+8010a75e:	29 c3                	sub    %eax,%ebx
+    if(n > size)
+8010a760:	39 df                	cmp    %ebx,%edi
+8010a762:	72 c3                	jb     8010a727 <mapkernel+0x1f>
+    if(n == LPGSIZE && pa % LPGSIZE == 0){
+8010a764:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+8010a76a:	75 bd                	jne    8010a729 <mapkernel+0x21>
+8010a76c:	f7 45 08 ff ff 3f 00 	testl  $0x3fffff,0x8(%ebp)
+8010a773:	75 b4                	jne    8010a729 <mapkernel+0x21>
+      if(pgdir[PDX(va)] & PTE_P)
+8010a775:	c1 ea 16             	shr    $0x16,%edx
+8010a778:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010a77b:	8d 14 90             	lea    (%eax,%edx,4),%edx
+8010a77e:	f6 02 01             	testb  $0x1,(%edx)
+8010a781:	75 97                	jne    8010a71a <mapkernel+0x12>
+      pgdir[PDX(va)] = pa | perm | PTE_P | PTE_PS;
+8010a783:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010a786:	0b 45 08             	or     0x8(%ebp),%eax
+8010a789:	0c 81                	or     $0x81,%al
+8010a78b:	89 02                	mov    %eax,(%edx)
+8010a78d:	eb b6                	jmp    8010a745 <mapkernel+0x3d>
+  return 0;
+8010a78f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010a794:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a797:	5b                   	pop    %ebx
+8010a798:	5e                   	pop    %esi
+8010a799:	5f                   	pop    %edi
+8010a79a:	5d                   	pop    %ebp
+8010a79b:	c3                   	ret
+      return -1;
+8010a79c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010a7a1:	eb f1                	jmp    8010a794 <mapkernel+0x8c>
+
+8010a7a3 <zerofault>:
+{
+8010a7a3:	55                   	push   %ebp
+8010a7a4:	89 e5                	mov    %esp,%ebp
+8010a7a6:	57                   	push   %edi
+8010a7a7:	56                   	push   %esi
+8010a7a8:	53                   	push   %ebx
+8010a7a9:	83 ec 0c             	sub    $0xc,%esp
+8010a7ac:	89 c7                	mov    %eax,%edi
+8010a7ae:	89 d3                	mov    %edx,%ebx
+  if((mem = kalloc_zeroed()) == 0)
+8010a7b0:	e8 40 94 ff ff       	call   80103bf5 <kalloc_zeroed>
+8010a7b5:	85 c0                	test   %eax,%eax
+8010a7b7:	74 49                	je     8010a802 <zerofault+0x5f>
+8010a7b9:	89 c6                	mov    %eax,%esi
+  if(mappages(pgdir, (char*)PGROUNDDOWN(va), PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+8010a7bb:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+8010a7c1:	89 da                	mov    %ebx,%edx
+8010a7c3:	83 ec 08             	sub    $0x8,%esp
+8010a7c6:	6a 06                	push   $0x6
+8010a7c8:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+8010a7ce:	50                   	push   %eax
+8010a7cf:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010a7d4:	89 f8                	mov    %edi,%eax
+8010a7d6:	e8 b6 fe ff ff       	call   8010a691 <mappages>
+8010a7db:	83 c4 10             	add    $0x10,%esp
+8010a7de:	85 c0                	test   %eax,%eax
+8010a7e0:	78 0d                	js     8010a7ef <zerofault+0x4c>
+  return 0;
+8010a7e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010a7e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a7ea:	5b                   	pop    %ebx
+8010a7eb:	5e                   	pop    %esi
+8010a7ec:	5f                   	pop    %edi
+8010a7ed:	5d                   	pop    %ebp
+8010a7ee:	c3                   	ret
+    kfree(mem);
+8010a7ef:	83 ec 0c             	sub    $0xc,%esp
+8010a7f2:	56                   	push   %esi
+8010a7f3:	e8 17 8d ff ff       	call   8010350f <kfree>
+    return -1;
+8010a7f8:	83 c4 10             	add    $0x10,%esp
+8010a7fb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010a800:	eb e5                	jmp    8010a7e7 <zerofault+0x44>
+    return -1;
+8010a802:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010a807:	eb de                	jmp    8010a7e7 <zerofault+0x44>
+
+8010a809 <tlbflush>:
+{
+8010a809:	55                   	push   %ebp
+8010a80a:	89 e5                	mov    %esp,%ebp
+8010a80c:	57                   	push   %edi
+8010a80d:	56                   	push   %esi
+8010a80e:	53                   	push   %ebx
+8010a80f:	83 ec 0c             	sub    $0xc,%esp
+8010a812:	89 c3                	mov    %eax,%ebx
+8010a814:	89 d7                	mov    %edx,%edi
+8010a816:	89 ce                	mov    %ecx,%esi
+  struct proc *p = myproc();
+8010a818:	e8 ee b4 ff ff       	call   80105d0b <myproc>
+  if(p == 0 || p->pgdir != pgdir || len == 0)
+8010a81d:	85 c0                	test   %eax,%eax
+8010a81f:	74 05                	je     8010a826 <tlbflush+0x1d>
+8010a821:	39 58 04             	cmp    %ebx,0x4(%eax)
+8010a824:	74 08                	je     8010a82e <tlbflush+0x25>
+}
+8010a826:	83 c4 0c             	add    $0xc,%esp
+8010a829:	5b                   	pop    %ebx
+8010a82a:	5e                   	pop    %esi
+8010a82b:	5f                   	pop    %edi
+8010a82c:	5d                   	pop    %ebp
+8010a82d:	c3                   	ret
+  if(p == 0 || p->pgdir != pgdir || len == 0)
+8010a82e:	85 f6                	test   %esi,%esi
+8010a830:	74 f4                	je     8010a826 <tlbflush+0x1d>
+  a = PGROUNDDOWN(va);
+8010a832:	89 f8                	mov    %edi,%eax
+8010a834:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  last = PGROUNDDOWN(va + len - 1);
+8010a839:	8d 54 37 ff          	lea    -0x1(%edi,%esi,1),%edx
+8010a83d:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  if((last - a) / PGSIZE >= TLBFLUSHMAX){
+8010a843:	89 d1                	mov    %edx,%ecx
+8010a845:	29 c1                	sub    %eax,%ecx
+8010a847:	81 f9 ff ff 01 00    	cmp    $0x1ffff,%ecx
+8010a84d:	76 10                	jbe    8010a85f <tlbflush+0x56>
+    lcr3(V2P(pgdir));
+8010a84f:	81 c3 00 00 00 80    	add    $0x80000000,%ebx
+}
+
+static inline void
+lcr3(uint val)
+{
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+8010a855:	0f 22 db             	mov    %ebx,%cr3
+    return;
+8010a858:	eb cc                	jmp    8010a826 <tlbflush+0x1d>
+  for(;; a += PGSIZE){
+8010a85a:	05 00 10 00 00       	add    $0x1000,%eax
+  asm volatile("invlpg (%0)" : : "r" (addr) : "memory");
+8010a85f:	0f 01 38             	invlpg (%eax)
+    if(a == last)
+8010a862:	39 d0                	cmp    %edx,%eax
+8010a864:	75 f4                	jne    8010a85a <tlbflush+0x51>
+8010a866:	eb be                	jmp    8010a826 <tlbflush+0x1d>
+
+8010a868 <sharedfault>:
+// Like filefault(), but for a shared writable mapping: give
+// the page a private copy of the file data, writable and
+// PTE_SHM so that fork() shares rather than copies it.
+static int
+sharedfault(pde_t *pgdir, struct vma *v, uint va)
+{
+8010a868:	55                   	push   %ebp
+8010a869:	89 e5                	mov    %esp,%ebp
+8010a86b:	57                   	push   %edi
+8010a86c:	56                   	push   %esi
+8010a86d:	53                   	push   %ebx
+8010a86e:	83 ec 1c             	sub    $0x1c,%esp
+8010a871:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010a874:	89 d0                	mov    %edx,%eax
+  char *page, *mem;
+  uint a, n;
+  pte_t *pte;
+
+  a = PGROUNDDOWN(va);
+8010a876:	89 cb                	mov    %ecx,%ebx
+8010a878:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  n = v->start + v->len - a;
+8010a87e:	8b 0a                	mov    (%edx),%ecx
+8010a880:	89 ca                	mov    %ecx,%edx
+8010a882:	03 50 04             	add    0x4(%eax),%edx
+8010a885:	29 da                	sub    %ebx,%edx
+  if(n > PGSIZE)
+8010a887:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+8010a88d:	76 05                	jbe    8010a894 <sharedfault+0x2c>
+    n = PGSIZE;
+8010a88f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  if((page = pcget(v->ip, v->off + (a - v->start), n)) == 0)
+8010a894:	89 de                	mov    %ebx,%esi
+8010a896:	29 ce                	sub    %ecx,%esi
+8010a898:	83 ec 04             	sub    $0x4,%esp
+8010a89b:	52                   	push   %edx
+8010a89c:	03 70 08             	add    0x8(%eax),%esi
+8010a89f:	56                   	push   %esi
+8010a8a0:	ff 70 0c             	push   0xc(%eax)
+8010a8a3:	e8 bd ac ff ff       	call   80105565 <pcget>
+8010a8a8:	89 c6                	mov    %eax,%esi
+8010a8aa:	83 c4 10             	add    $0x10,%esp
+8010a8ad:	85 c0                	test   %eax,%eax
+8010a8af:	0f 84 a8 00 00 00    	je     8010a95d <sharedfault+0xf5>
+    return -1;
+  if((mem = kalloc()) == 0){
+8010a8b5:	e8 6a 8f ff ff       	call   80103824 <kalloc>
+8010a8ba:	89 c7                	mov    %eax,%edi
+8010a8bc:	85 c0                	test   %eax,%eax
+8010a8be:	74 64                	je     8010a924 <sharedfault+0xbc>
+    kfree(page);
+    return -1;
+  }
+  memmove(mem, page, PGSIZE);
+8010a8c0:	83 ec 04             	sub    $0x4,%esp
+8010a8c3:	68 00 10 00 00       	push   $0x1000
+8010a8c8:	56                   	push   %esi
+8010a8c9:	50                   	push   %eax
+8010a8ca:	e8 e7 d2 ff ff       	call   80107bb6 <memmove>
+  kfree(page);
+8010a8cf:	89 34 24             	mov    %esi,(%esp)
+8010a8d2:	e8 38 8c ff ff       	call   8010350f <kfree>
+  // Someone else may have mapped the page while we slept.
+  if((pte = walkpgdir(pgdir, (char*)a, 0)) != 0 && (*pte & PTE_P)){
+8010a8d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010a8dc:	89 da                	mov    %ebx,%edx
+8010a8de:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010a8e1:	e8 49 fd ff ff       	call   8010a62f <walkpgdir>
+8010a8e6:	83 c4 10             	add    $0x10,%esp
+8010a8e9:	85 c0                	test   %eax,%eax
+8010a8eb:	74 05                	je     8010a8f2 <sharedfault+0x8a>
+8010a8ed:	f6 00 01             	testb  $0x1,(%eax)
+8010a8f0:	75 45                	jne    8010a937 <sharedfault+0xcf>
+    kfree(mem);
+    return 0;
+  }
+  if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U|PTE_SHM) < 0){
+8010a8f2:	83 ec 08             	sub    $0x8,%esp
+8010a8f5:	68 06 04 00 00       	push   $0x406
+8010a8fa:	8d 87 00 00 00 80    	lea    -0x80000000(%edi),%eax
+8010a900:	50                   	push   %eax
+8010a901:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010a906:	89 da                	mov    %ebx,%edx
+8010a908:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010a90b:	e8 81 fd ff ff       	call   8010a691 <mappages>
+8010a910:	83 c4 10             	add    $0x10,%esp
+8010a913:	85 c0                	test   %eax,%eax
+8010a915:	78 33                	js     8010a94a <sharedfault+0xe2>
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+8010a917:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010a91c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a91f:	5b                   	pop    %ebx
+8010a920:	5e                   	pop    %esi
+8010a921:	5f                   	pop    %edi
+8010a922:	5d                   	pop    %ebp
+8010a923:	c3                   	ret
+    kfree(page);
+8010a924:	83 ec 0c             	sub    $0xc,%esp
+8010a927:	56                   	push   %esi
+8010a928:	e8 e2 8b ff ff       	call   8010350f <kfree>
+    return -1;
+8010a92d:	83 c4 10             	add    $0x10,%esp
+8010a930:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010a935:	eb e5                	jmp    8010a91c <sharedfault+0xb4>
+    kfree(mem);
+8010a937:	83 ec 0c             	sub    $0xc,%esp
+8010a93a:	57                   	push   %edi
+8010a93b:	e8 cf 8b ff ff       	call   8010350f <kfree>
+    return 0;
+8010a940:	83 c4 10             	add    $0x10,%esp
+8010a943:	b8 00 00 00 00       	mov    $0x0,%eax
+8010a948:	eb d2                	jmp    8010a91c <sharedfault+0xb4>
+    kfree(mem);
+8010a94a:	83 ec 0c             	sub    $0xc,%esp
+8010a94d:	57                   	push   %edi
+8010a94e:	e8 bc 8b ff ff       	call   8010350f <kfree>
+    return -1;
+8010a953:	83 c4 10             	add    $0x10,%esp
+8010a956:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010a95b:	eb bf                	jmp    8010a91c <sharedfault+0xb4>
+    return -1;
+8010a95d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010a962:	eb b8                	jmp    8010a91c <sharedfault+0xb4>
+
+8010a964 <filefault>:
+{
+8010a964:	55                   	push   %ebp
+8010a965:	89 e5                	mov    %esp,%ebp
+8010a967:	57                   	push   %edi
+8010a968:	56                   	push   %esi
+8010a969:	53                   	push   %ebx
+8010a96a:	83 ec 0c             	sub    $0xc,%esp
+8010a96d:	89 c6                	mov    %eax,%esi
+8010a96f:	89 d0                	mov    %edx,%eax
+  a = PGROUNDDOWN(va);
+8010a971:	89 cb                	mov    %ecx,%ebx
+8010a973:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  n = v->start + v->len - a;
+8010a979:	8b 0a                	mov    (%edx),%ecx
+8010a97b:	89 ca                	mov    %ecx,%edx
+8010a97d:	03 50 04             	add    0x4(%eax),%edx
+8010a980:	29 da                	sub    %ebx,%edx
+  if(n > PGSIZE)
+8010a982:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+8010a988:	76 05                	jbe    8010a98f <filefault+0x2b>
+    n = PGSIZE;
+8010a98a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  if((mem = pcget(v->ip, v->off + (a - v->start), n)) == 0)
+8010a98f:	89 df                	mov    %ebx,%edi
+8010a991:	29 cf                	sub    %ecx,%edi
+8010a993:	83 ec 04             	sub    $0x4,%esp
+8010a996:	52                   	push   %edx
+8010a997:	03 78 08             	add    0x8(%eax),%edi
+8010a99a:	57                   	push   %edi
+8010a99b:	ff 70 0c             	push   0xc(%eax)
+8010a99e:	e8 c2 ab ff ff       	call   80105565 <pcget>
+8010a9a3:	89 c7                	mov    %eax,%edi
+8010a9a5:	83 c4 10             	add    $0x10,%esp
+8010a9a8:	85 c0                	test   %eax,%eax
+8010a9aa:	74 6e                	je     8010aa1a <filefault+0xb6>
+  if((pte = walkpgdir(pgdir, (char*)a, 0)) != 0 && (*pte & PTE_P)){
+8010a9ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010a9b1:	89 da                	mov    %ebx,%edx
+8010a9b3:	89 f0                	mov    %esi,%eax
+8010a9b5:	e8 75 fc ff ff       	call   8010a62f <walkpgdir>
+8010a9ba:	85 c0                	test   %eax,%eax
+8010a9bc:	74 05                	je     8010a9c3 <filefault+0x5f>
+8010a9be:	f6 00 01             	testb  $0x1,(%eax)
+8010a9c1:	75 31                	jne    8010a9f4 <filefault+0x90>
+  if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_COW|PTE_U) < 0){
+8010a9c3:	83 ec 08             	sub    $0x8,%esp
+8010a9c6:	68 04 08 00 00       	push   $0x804
+8010a9cb:	8d 87 00 00 00 80    	lea    -0x80000000(%edi),%eax
+8010a9d1:	50                   	push   %eax
+8010a9d2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010a9d7:	89 da                	mov    %ebx,%edx
+8010a9d9:	89 f0                	mov    %esi,%eax
+8010a9db:	e8 b1 fc ff ff       	call   8010a691 <mappages>
+8010a9e0:	83 c4 10             	add    $0x10,%esp
+8010a9e3:	85 c0                	test   %eax,%eax
+8010a9e5:	78 20                	js     8010aa07 <filefault+0xa3>
+  return 0;
+8010a9e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010a9ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a9ef:	5b                   	pop    %ebx
+8010a9f0:	5e                   	pop    %esi
+8010a9f1:	5f                   	pop    %edi
+8010a9f2:	5d                   	pop    %ebp
+8010a9f3:	c3                   	ret
+    kfree(mem);
+8010a9f4:	83 ec 0c             	sub    $0xc,%esp
+8010a9f7:	57                   	push   %edi
+8010a9f8:	e8 12 8b ff ff       	call   8010350f <kfree>
+    return 0;
+8010a9fd:	83 c4 10             	add    $0x10,%esp
+8010aa00:	b8 00 00 00 00       	mov    $0x0,%eax
+8010aa05:	eb e5                	jmp    8010a9ec <filefault+0x88>
+    kfree(mem);
+8010aa07:	83 ec 0c             	sub    $0xc,%esp
+8010aa0a:	57                   	push   %edi
+8010aa0b:	e8 ff 8a ff ff       	call   8010350f <kfree>
+    return -1;
+8010aa10:	83 c4 10             	add    $0x10,%esp
+8010aa13:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010aa18:	eb d2                	jmp    8010a9ec <filefault+0x88>
+    return -1;
+8010aa1a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010aa1f:	eb cb                	jmp    8010a9ec <filefault+0x88>
+
+8010aa21 <seginit>:
+{
+8010aa21:	55                   	push   %ebp
+8010aa22:	89 e5                	mov    %esp,%ebp
+8010aa24:	57                   	push   %edi
+8010aa25:	56                   	push   %esi
+8010aa26:	53                   	push   %ebx
+8010aa27:	83 ec 1c             	sub    $0x1c,%esp
+  c = &cpus[cpuid()];
+8010aa2a:	e8 c1 b2 ff ff       	call   80105cf0 <cpuid>
+  c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
+8010aa2f:	69 f8 b0 00 00 00    	imul   $0xb0,%eax,%edi
+8010aa35:	66 c7 87 f8 1e 12 80 	movw   $0xffff,-0x7fede108(%edi)
+8010aa3c:	ff ff 
+8010aa3e:	66 c7 87 fa 1e 12 80 	movw   $0x0,-0x7fede106(%edi)
+8010aa45:	00 00 
+8010aa47:	c6 87 fc 1e 12 80 00 	movb   $0x0,-0x7fede104(%edi)
+8010aa4e:	0f b6 8f fd 1e 12 80 	movzbl -0x7fede103(%edi),%ecx
+8010aa55:	83 e1 f0             	and    $0xfffffff0,%ecx
+8010aa58:	89 ce                	mov    %ecx,%esi
+8010aa5a:	83 ce 0a             	or     $0xa,%esi
+8010aa5d:	89 f2                	mov    %esi,%edx
+8010aa5f:	88 97 fd 1e 12 80    	mov    %dl,-0x7fede103(%edi)
+8010aa65:	83 c9 1a             	or     $0x1a,%ecx
+8010aa68:	88 8f fd 1e 12 80    	mov    %cl,-0x7fede103(%edi)
+8010aa6e:	83 e1 9f             	and    $0xffffff9f,%ecx
+8010aa71:	88 8f fd 1e 12 80    	mov    %cl,-0x7fede103(%edi)
+8010aa77:	83 c9 80             	or     $0xffffff80,%ecx
+8010aa7a:	88 8f fd 1e 12 80    	mov    %cl,-0x7fede103(%edi)
+8010aa80:	0f b6 8f fe 1e 12 80 	movzbl -0x7fede102(%edi),%ecx
+8010aa87:	83 c9 0f             	or     $0xf,%ecx
+8010aa8a:	88 8f fe 1e 12 80    	mov    %cl,-0x7fede102(%edi)
+8010aa90:	89 ce                	mov    %ecx,%esi
+8010aa92:	83 e6 ef             	and    $0xffffffef,%esi
+8010aa95:	89 f2                	mov    %esi,%edx
+8010aa97:	88 97 fe 1e 12 80    	mov    %dl,-0x7fede102(%edi)
+8010aa9d:	83 e1 cf             	and    $0xffffffcf,%ecx
+8010aaa0:	88 8f fe 1e 12 80    	mov    %cl,-0x7fede102(%edi)
+8010aaa6:	89 ce                	mov    %ecx,%esi
+8010aaa8:	83 ce 40             	or     $0x40,%esi
+8010aaab:	89 f2                	mov    %esi,%edx
+8010aaad:	88 97 fe 1e 12 80    	mov    %dl,-0x7fede102(%edi)
+8010aab3:	83 c9 c0             	or     $0xffffffc0,%ecx
+8010aab6:	88 8f fe 1e 12 80    	mov    %cl,-0x7fede102(%edi)
+8010aabc:	c6 87 ff 1e 12 80 00 	movb   $0x0,-0x7fede101(%edi)
+  c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
+8010aac3:	66 c7 87 00 1f 12 80 	movw   $0xffff,-0x7fede100(%edi)
+8010aaca:	ff ff 
+8010aacc:	66 c7 87 02 1f 12 80 	movw   $0x0,-0x7fede0fe(%edi)
+8010aad3:	00 00 
+8010aad5:	c6 87 04 1f 12 80 00 	movb   $0x0,-0x7fede0fc(%edi)
+8010aadc:	0f b6 8f 05 1f 12 80 	movzbl -0x7fede0fb(%edi),%ecx
+8010aae3:	83 e1 f0             	and    $0xfffffff0,%ecx
+8010aae6:	89 ce                	mov    %ecx,%esi
+8010aae8:	83 ce 02             	or     $0x2,%esi
+8010aaeb:	89 f2                	mov    %esi,%edx
+8010aaed:	88 97 05 1f 12 80    	mov    %dl,-0x7fede0fb(%edi)
+8010aaf3:	83 c9 12             	or     $0x12,%ecx
+8010aaf6:	88 8f 05 1f 12 80    	mov    %cl,-0x7fede0fb(%edi)
+8010aafc:	83 e1 9f             	and    $0xffffff9f,%ecx
+8010aaff:	88 8f 05 1f 12 80    	mov    %cl,-0x7fede0fb(%edi)
+8010ab05:	83 c9 80             	or     $0xffffff80,%ecx
+8010ab08:	88 8f 05 1f 12 80    	mov    %cl,-0x7fede0fb(%edi)
+8010ab0e:	0f b6 8f 06 1f 12 80 	movzbl -0x7fede0fa(%edi),%ecx
+8010ab15:	83 c9 0f             	or     $0xf,%ecx
+8010ab18:	88 8f 06 1f 12 80    	mov    %cl,-0x7fede0fa(%edi)
+8010ab1e:	89 ce                	mov    %ecx,%esi
+8010ab20:	83 e6 ef             	and    $0xffffffef,%esi
+8010ab23:	89 f2                	mov    %esi,%edx
+8010ab25:	88 97 06 1f 12 80    	mov    %dl,-0x7fede0fa(%edi)
+8010ab2b:	83 e1 cf             	and    $0xffffffcf,%ecx
+8010ab2e:	88 8f 06 1f 12 80    	mov    %cl,-0x7fede0fa(%edi)
+8010ab34:	89 ce                	mov    %ecx,%esi
+8010ab36:	83 ce 40             	or     $0x40,%esi
+8010ab39:	89 f2                	mov    %esi,%edx
+8010ab3b:	88 97 06 1f 12 80    	mov    %dl,-0x7fede0fa(%edi)
+8010ab41:	83 c9 c0             	or     $0xffffffc0,%ecx
+8010ab44:	88 8f 06 1f 12 80    	mov    %cl,-0x7fede0fa(%edi)
+8010ab4a:	c6 87 07 1f 12 80 00 	movb   $0x0,-0x7fede0f9(%edi)
+  c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
+8010ab51:	66 c7 87 08 1f 12 80 	movw   $0xffff,-0x7fede0f8(%edi)
+8010ab58:	ff ff 
+8010ab5a:	66 c7 87 0a 1f 12 80 	movw   $0x0,-0x7fede0f6(%edi)
+8010ab61:	00 00 
+8010ab63:	c6 87 0c 1f 12 80 00 	movb   $0x0,-0x7fede0f4(%edi)
+8010ab6a:	0f b6 9f 0d 1f 12 80 	movzbl -0x7fede0f3(%edi),%ebx
+8010ab71:	83 e3 f0             	and    $0xfffffff0,%ebx
+8010ab74:	89 de                	mov    %ebx,%esi
+8010ab76:	83 ce 0a             	or     $0xa,%esi
+8010ab79:	89 f2                	mov    %esi,%edx
+8010ab7b:	88 97 0d 1f 12 80    	mov    %dl,-0x7fede0f3(%edi)
+8010ab81:	89 de                	mov    %ebx,%esi
+8010ab83:	83 ce 1a             	or     $0x1a,%esi
+8010ab86:	89 f2                	mov    %esi,%edx
+8010ab88:	88 97 0d 1f 12 80    	mov    %dl,-0x7fede0f3(%edi)
+8010ab8e:	83 cb 7a             	or     $0x7a,%ebx
+8010ab91:	88 9f 0d 1f 12 80    	mov    %bl,-0x7fede0f3(%edi)
+8010ab97:	c6 87 0d 1f 12 80 fa 	movb   $0xfa,-0x7fede0f3(%edi)
+8010ab9e:	0f b6 9f 0e 1f 12 80 	movzbl -0x7fede0f2(%edi),%ebx
+8010aba5:	83 cb 0f             	or     $0xf,%ebx
+8010aba8:	88 9f 0e 1f 12 80    	mov    %bl,-0x7fede0f2(%edi)
+8010abae:	89 de                	mov    %ebx,%esi
+8010abb0:	83 e6 ef             	and    $0xffffffef,%esi
+8010abb3:	89 f2                	mov    %esi,%edx
+8010abb5:	88 97 0e 1f 12 80    	mov    %dl,-0x7fede0f2(%edi)
+8010abbb:	83 e3 cf             	and    $0xffffffcf,%ebx
+8010abbe:	88 9f 0e 1f 12 80    	mov    %bl,-0x7fede0f2(%edi)
+8010abc4:	89 de                	mov    %ebx,%esi
+8010abc6:	83 ce 40             	or     $0x40,%esi
+8010abc9:	89 f2                	mov    %esi,%edx
+8010abcb:	88 97 0e 1f 12 80    	mov    %dl,-0x7fede0f2(%edi)
+8010abd1:	83 cb c0             	or     $0xffffffc0,%ebx
+8010abd4:	88 9f 0e 1f 12 80    	mov    %bl,-0x7fede0f2(%edi)
+8010abda:	c6 87 0f 1f 12 80 00 	movb   $0x0,-0x7fede0f1(%edi)
+  c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+8010abe1:	66 c7 87 10 1f 12 80 	movw   $0xffff,-0x7fede0f0(%edi)
+8010abe8:	ff ff 
+8010abea:	66 c7 87 12 1f 12 80 	movw   $0x0,-0x7fede0ee(%edi)
+8010abf1:	00 00 
+8010abf3:	c6 87 14 1f 12 80 00 	movb   $0x0,-0x7fede0ec(%edi)
+8010abfa:	0f b6 9f 15 1f 12 80 	movzbl -0x7fede0eb(%edi),%ebx
+8010ac01:	83 e3 f0             	and    $0xfffffff0,%ebx
+8010ac04:	89 de                	mov    %ebx,%esi
+8010ac06:	83 ce 02             	or     $0x2,%esi
+8010ac09:	89 f2                	mov    %esi,%edx
+8010ac0b:	88 97 15 1f 12 80    	mov    %dl,-0x7fede0eb(%edi)
+8010ac11:	89 de                	mov    %ebx,%esi
+8010ac13:	83 ce 12             	or     $0x12,%esi
+8010ac16:	89 f2                	mov    %esi,%edx
+8010ac18:	88 97 15 1f 12 80    	mov    %dl,-0x7fede0eb(%edi)
+8010ac1e:	83 cb 72             	or     $0x72,%ebx
+8010ac21:	88 9f 15 1f 12 80    	mov    %bl,-0x7fede0eb(%edi)
+8010ac27:	c6 87 15 1f 12 80 f2 	movb   $0xf2,-0x7fede0eb(%edi)
+8010ac2e:	0f b6 9f 16 1f 12 80 	movzbl -0x7fede0ea(%edi),%ebx
+8010ac35:	83 cb 0f             	or     $0xf,%ebx
+8010ac38:	88 9f 16 1f 12 80    	mov    %bl,-0x7fede0ea(%edi)
+8010ac3e:	89 de                	mov    %ebx,%esi
+8010ac40:	83 e6 ef             	and    $0xffffffef,%esi
+8010ac43:	89 f2                	mov    %esi,%edx
+8010ac45:	88 97 16 1f 12 80    	mov    %dl,-0x7fede0ea(%edi)
+8010ac4b:	83 e3 cf             	and    $0xffffffcf,%ebx
+8010ac4e:	88 9f 16 1f 12 80    	mov    %bl,-0x7fede0ea(%edi)
+8010ac54:	89 de                	mov    %ebx,%esi
+8010ac56:	83 ce 40             	or     $0x40,%esi
+8010ac59:	89 f2                	mov    %esi,%edx
+8010ac5b:	88 97 16 1f 12 80    	mov    %dl,-0x7fede0ea(%edi)
+8010ac61:	83 cb c0             	or     $0xffffffc0,%ebx
+8010ac64:	88 9f 16 1f 12 80    	mov    %bl,-0x7fede0ea(%edi)
+8010ac6a:	c6 87 17 1f 12 80 00 	movb   $0x0,-0x7fede0e9(%edi)
+  lgdt(c->gdt, sizeof(c->gdt));
+8010ac71:	8d 97 f0 1e 12 80    	lea    -0x7fede110(%edi),%edx
+  pd[0] = size-1;
+8010ac77:	66 c7 45 e2 2f 00    	movw   $0x2f,-0x1e(%ebp)
+  pd[1] = (uint)p;
+8010ac7d:	66 89 55 e4          	mov    %dx,-0x1c(%ebp)
+  pd[2] = (uint)p >> 16;
+8010ac81:	c1 ea 10             	shr    $0x10,%edx
+8010ac84:	66 89 55 e6          	mov    %dx,-0x1a(%ebp)
+  asm volatile("lgdt (%0)" : : "r" (pd));
+8010ac88:	8d 45 e2             	lea    -0x1e(%ebp),%eax
+8010ac8b:	0f 01 10             	lgdtl  (%eax)
+}
+8010ac8e:	83 c4 1c             	add    $0x1c,%esp
+8010ac91:	5b                   	pop    %ebx
+8010ac92:	5e                   	pop    %esi
+8010ac93:	5f                   	pop    %edi
+8010ac94:	5d                   	pop    %ebp
+8010ac95:	c3                   	ret
+
+8010ac96 <switchkvm>:
+  lcr3(V2P(kpgdir));   // switch to the kernel page table
+8010ac96:	a1 60 57 13 80       	mov    0x80135760,%eax
+8010ac9b:	05 00 00 00 80       	add    $0x80000000,%eax
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+8010aca0:	0f 22 d8             	mov    %eax,%cr3
+}
+8010aca3:	c3                   	ret
+
+8010aca4 <switchuvm>:
+{
+8010aca4:	55                   	push   %ebp
+8010aca5:	89 e5                	mov    %esp,%ebp
+8010aca7:	57                   	push   %edi
+8010aca8:	56                   	push   %esi
+8010aca9:	53                   	push   %ebx
+8010acaa:	83 ec 1c             	sub    $0x1c,%esp
+8010acad:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(p == 0)
+8010acb0:	85 f6                	test   %esi,%esi
+8010acb2:	0f 84 25 01 00 00    	je     8010addd <switchuvm+0x139>
+  if(p->kstack == 0)
+8010acb8:	83 7e 08 00          	cmpl   $0x0,0x8(%esi)
+8010acbc:	0f 84 28 01 00 00    	je     8010adea <switchuvm+0x146>
+  if(p->pgdir == 0)
+8010acc2:	83 7e 04 00          	cmpl   $0x0,0x4(%esi)
+8010acc6:	0f 84 2b 01 00 00    	je     8010adf7 <switchuvm+0x153>
+  pushcli();
+8010accc:	e8 de cc ff ff       	call   801079af <pushcli>
+  mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts,
+8010acd1:	e8 be af ff ff       	call   80105c94 <mycpu>
+8010acd6:	89 c3                	mov    %eax,%ebx
+8010acd8:	e8 b7 af ff ff       	call   80105c94 <mycpu>
+8010acdd:	8d 78 08             	lea    0x8(%eax),%edi
+8010ace0:	e8 af af ff ff       	call   80105c94 <mycpu>
+8010ace5:	83 c0 08             	add    $0x8,%eax
+8010ace8:	c1 e8 10             	shr    $0x10,%eax
+8010aceb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010acee:	e8 a1 af ff ff       	call   80105c94 <mycpu>
+8010acf3:	83 c0 08             	add    $0x8,%eax
+8010acf6:	c1 e8 18             	shr    $0x18,%eax
+8010acf9:	66 c7 83 98 00 00 00 	movw   $0x67,0x98(%ebx)
+8010ad00:	67 00 
+8010ad02:	66 89 bb 9a 00 00 00 	mov    %di,0x9a(%ebx)
+8010ad09:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+8010ad0d:	88 8b 9c 00 00 00    	mov    %cl,0x9c(%ebx)
+8010ad13:	0f b6 93 9d 00 00 00 	movzbl 0x9d(%ebx),%edx
+8010ad1a:	83 e2 f0             	and    $0xfffffff0,%edx
+8010ad1d:	89 d1                	mov    %edx,%ecx
+8010ad1f:	83 c9 09             	or     $0x9,%ecx
+8010ad22:	88 8b 9d 00 00 00    	mov    %cl,0x9d(%ebx)
+8010ad28:	83 ca 19             	or     $0x19,%edx
+8010ad2b:	88 93 9d 00 00 00    	mov    %dl,0x9d(%ebx)
+8010ad31:	83 e2 9f             	and    $0xffffff9f,%edx
+8010ad34:	88 93 9d 00 00 00    	mov    %dl,0x9d(%ebx)
+8010ad3a:	83 ca 80             	or     $0xffffff80,%edx
+8010ad3d:	88 93 9d 00 00 00    	mov    %dl,0x9d(%ebx)
+8010ad43:	0f b6 93 9e 00 00 00 	movzbl 0x9e(%ebx),%edx
+8010ad4a:	89 d1                	mov    %edx,%ecx
+8010ad4c:	83 e1 f0             	and    $0xfffffff0,%ecx
+8010ad4f:	88 8b 9e 00 00 00    	mov    %cl,0x9e(%ebx)
+8010ad55:	89 d1                	mov    %edx,%ecx
+8010ad57:	83 e1 e0             	and    $0xffffffe0,%ecx
+8010ad5a:	88 8b 9e 00 00 00    	mov    %cl,0x9e(%ebx)
+8010ad60:	83 e2 c0             	and    $0xffffffc0,%edx
+8010ad63:	88 93 9e 00 00 00    	mov    %dl,0x9e(%ebx)
+8010ad69:	83 ca 40             	or     $0x40,%edx
+8010ad6c:	88 93 9e 00 00 00    	mov    %dl,0x9e(%ebx)
+8010ad72:	83 e2 7f             	and    $0x7f,%edx
+8010ad75:	88 93 9e 00 00 00    	mov    %dl,0x9e(%ebx)
+8010ad7b:	88 83 9f 00 00 00    	mov    %al,0x9f(%ebx)
+  mycpu()->gdt[SEG_TSS].s = 0;
+8010ad81:	e8 0e af ff ff       	call   80105c94 <mycpu>
+8010ad86:	0f b6 90 9d 00 00 00 	movzbl 0x9d(%eax),%edx
+8010ad8d:	83 e2 ef             	and    $0xffffffef,%edx
+8010ad90:	88 90 9d 00 00 00    	mov    %dl,0x9d(%eax)
+  mycpu()->ts.ss0 = SEG_KDATA << 3;
+8010ad96:	e8 f9 ae ff ff       	call   80105c94 <mycpu>
+8010ad9b:	66 c7 40 10 10 00    	movw   $0x10,0x10(%eax)
+  mycpu()->ts.esp0 = (uint)p->kstack + KSTACKSIZE;
+8010ada1:	8b 5e 08             	mov    0x8(%esi),%ebx
+8010ada4:	e8 eb ae ff ff       	call   80105c94 <mycpu>
+8010ada9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010adaf:	89 58 0c             	mov    %ebx,0xc(%eax)
+  mycpu()->ts.iomb = (ushort) 0xFFFF;
+8010adb2:	e8 dd ae ff ff       	call   80105c94 <mycpu>
+8010adb7:	66 c7 40 6e ff ff    	movw   $0xffff,0x6e(%eax)
+  asm volatile("ltr %0" : : "r" (sel));
+8010adbd:	b8 28 00 00 00       	mov    $0x28,%eax
+8010adc2:	0f 00 d8             	ltr    %ax
+  lcr3(V2P(p->pgdir));  // switch to process's address space
+8010adc5:	8b 46 04             	mov    0x4(%esi),%eax
+8010adc8:	05 00 00 00 80       	add    $0x80000000,%eax
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+8010adcd:	0f 22 d8             	mov    %eax,%cr3
+  popcli();
+8010add0:	e8 1e cc ff ff       	call   801079f3 <popcli>
+}
+8010add5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010add8:	5b                   	pop    %ebx
+8010add9:	5e                   	pop    %esi
+8010adda:	5f                   	pop    %edi
+8010addb:	5d                   	pop    %ebp
+8010addc:	c3                   	ret
+    panic("switchuvm: no process");
+8010addd:	83 ec 0c             	sub    $0xc,%esp
+8010ade0:	68 82 c4 10 80       	push   $0x8010c482
+8010ade5:	e8 41 5f ff ff       	call   80100d2b <panic>
+    panic("switchuvm: no kstack");
+8010adea:	83 ec 0c             	sub    $0xc,%esp
+8010aded:	68 98 c4 10 80       	push   $0x8010c498
+8010adf2:	e8 34 5f ff ff       	call   80100d2b <panic>
+    panic("switchuvm: no pgdir");
+8010adf7:	83 ec 0c             	sub    $0xc,%esp
+8010adfa:	68 ad c4 10 80       	push   $0x8010c4ad
+8010adff:	e8 27 5f ff ff       	call   80100d2b <panic>
+
+8010ae04 <inituvm>:
+{
+8010ae04:	55                   	push   %ebp
+8010ae05:	89 e5                	mov    %esp,%ebp
+8010ae07:	56                   	push   %esi
+8010ae08:	53                   	push   %ebx
+8010ae09:	8b 75 10             	mov    0x10(%ebp),%esi
+  if(sz >= PGSIZE)
+8010ae0c:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+8010ae12:	77 3c                	ja     8010ae50 <inituvm+0x4c>
+  mem = kalloc_zeroed();
+8010ae14:	e8 dc 8d ff ff       	call   80103bf5 <kalloc_zeroed>
+8010ae19:	89 c3                	mov    %eax,%ebx
+  mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
+8010ae1b:	83 ec 08             	sub    $0x8,%esp
+8010ae1e:	6a 06                	push   $0x6
+8010ae20:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+8010ae26:	50                   	push   %eax
+8010ae27:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010ae2c:	ba 00 00 00 00       	mov    $0x0,%edx
+8010ae31:	8b 45 08             	mov    0x8(%ebp),%eax
+8010ae34:	e8 58 f8 ff ff       	call   8010a691 <mappages>
+  memmove(mem, init, sz);
+8010ae39:	83 c4 0c             	add    $0xc,%esp
+8010ae3c:	56                   	push   %esi
+8010ae3d:	ff 75 0c             	push   0xc(%ebp)
+8010ae40:	53                   	push   %ebx
+8010ae41:	e8 70 cd ff ff       	call   80107bb6 <memmove>
+}
+8010ae46:	83 c4 10             	add    $0x10,%esp
+8010ae49:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010ae4c:	5b                   	pop    %ebx
+8010ae4d:	5e                   	pop    %esi
+8010ae4e:	5d                   	pop    %ebp
+8010ae4f:	c3                   	ret
+    panic("inituvm: more than a page");
+8010ae50:	83 ec 0c             	sub    $0xc,%esp
+8010ae53:	68 c1 c4 10 80       	push   $0x8010c4c1
+8010ae58:	e8 ce 5e ff ff       	call   80100d2b <panic>
+
+8010ae5d <deallocuvm>:
+{
+8010ae5d:	55                   	push   %ebp
+8010ae5e:	89 e5                	mov    %esp,%ebp
+8010ae60:	57                   	push   %edi
+8010ae61:	56                   	push   %esi
+8010ae62:	53                   	push   %ebx
+8010ae63:	83 ec 1c             	sub    $0x1c,%esp
+8010ae66:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(newsz >= oldsz)
+8010ae69:	39 7d 10             	cmp    %edi,0x10(%ebp)
+8010ae6c:	73 20                	jae    8010ae8e <deallocuvm+0x31>
+  a = PGROUNDUP(newsz);
+8010ae6e:	8b 45 10             	mov    0x10(%ebp),%eax
+8010ae71:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+8010ae77:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  lo = hi = 0;
+8010ae7d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+8010ae84:	ba 00 00 00 00       	mov    $0x0,%edx
+8010ae89:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  for(; a  < oldsz; a += PGSIZE){
+8010ae8c:	eb 34                	jmp    8010aec2 <deallocuvm+0x65>
+    return oldsz;
+8010ae8e:	89 f8                	mov    %edi,%eax
+8010ae90:	e9 88 00 00 00       	jmp    8010af1d <deallocuvm+0xc0>
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+8010ae95:	c1 eb 16             	shr    $0x16,%ebx
+8010ae98:	83 c3 01             	add    $0x1,%ebx
+8010ae9b:	c1 e3 16             	shl    $0x16,%ebx
+8010ae9e:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+8010aea4:	eb 16                	jmp    8010aebc <deallocuvm+0x5f>
+        panic("kfree");
+8010aea6:	83 ec 0c             	sub    $0xc,%esp
+8010aea9:	68 3e bc 10 80       	push   $0x8010bc3e
+8010aeae:	e8 78 5e ff ff       	call   80100d2b <panic>
+      hi = a + PGSIZE;
+8010aeb3:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+8010aeb9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(; a  < oldsz; a += PGSIZE){
+8010aebc:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010aec2:	39 fb                	cmp    %edi,%ebx
+8010aec4:	73 44                	jae    8010af0a <deallocuvm+0xad>
+    pte = walkpgdir(pgdir, (char*)a, 0);
+8010aec6:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010aecb:	89 da                	mov    %ebx,%edx
+8010aecd:	8b 45 08             	mov    0x8(%ebp),%eax
+8010aed0:	e8 5a f7 ff ff       	call   8010a62f <walkpgdir>
+8010aed5:	89 c6                	mov    %eax,%esi
+    if(!pte)
+8010aed7:	85 c0                	test   %eax,%eax
+8010aed9:	74 ba                	je     8010ae95 <deallocuvm+0x38>
+    else if((*pte & PTE_P) != 0){
+8010aedb:	8b 00                	mov    (%eax),%eax
+8010aedd:	a8 01                	test   $0x1,%al
+8010aedf:	74 db                	je     8010aebc <deallocuvm+0x5f>
+      if(pa == 0)
+8010aee1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010aee6:	74 be                	je     8010aea6 <deallocuvm+0x49>
+      char *v = P2V(pa);
+8010aee8:	05 00 00 00 80       	add    $0x80000000,%eax
+      kfree(v);
+8010aeed:	83 ec 0c             	sub    $0xc,%esp
+8010aef0:	50                   	push   %eax
+8010aef1:	e8 19 86 ff ff       	call   8010350f <kfree>
+      *pte = 0;
+8010aef6:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+      if(hi == 0)
+8010aefc:	83 c4 10             	add    $0x10,%esp
+8010aeff:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+8010af03:	75 ae                	jne    8010aeb3 <deallocuvm+0x56>
+        lo = a;
+8010af05:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+8010af08:	eb a9                	jmp    8010aeb3 <deallocuvm+0x56>
+  tlbflush(pgdir, lo, hi - lo);
+8010af0a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+8010af0d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010af10:	29 d1                	sub    %edx,%ecx
+8010af12:	8b 45 08             	mov    0x8(%ebp),%eax
+8010af15:	e8 ef f8 ff ff       	call   8010a809 <tlbflush>
+  return newsz;
+8010af1a:	8b 45 10             	mov    0x10(%ebp),%eax
+}
+8010af1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010af20:	5b                   	pop    %ebx
+8010af21:	5e                   	pop    %esi
+8010af22:	5f                   	pop    %edi
+8010af23:	5d                   	pop    %ebp
+8010af24:	c3                   	ret
+
+8010af25 <allocuvm>:
+{
+8010af25:	55                   	push   %ebp
+8010af26:	89 e5                	mov    %esp,%ebp
+8010af28:	57                   	push   %edi
+8010af29:	56                   	push   %esi
+8010af2a:	53                   	push   %ebx
+8010af2b:	83 ec 0c             	sub    $0xc,%esp
+8010af2e:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(newsz >= UMAPBASE)
+8010af31:	81 ff ff ff ff 5f    	cmp    $0x5fffffff,%edi
+8010af37:	0f 87 ae 00 00 00    	ja     8010afeb <allocuvm+0xc6>
+  if(newsz < oldsz)
+8010af3d:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+8010af40:	72 4c                	jb     8010af8e <allocuvm+0x69>
+  a = PGROUNDUP(oldsz);
+8010af42:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010af45:	8d b0 ff 0f 00 00    	lea    0xfff(%eax),%esi
+8010af4b:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  for(; a < newsz; a += PGSIZE){
+8010af51:	39 fe                	cmp    %edi,%esi
+8010af53:	0f 83 8e 00 00 00    	jae    8010afe7 <allocuvm+0xc2>
+    mem = kalloc_zeroed();
+8010af59:	e8 97 8c ff ff       	call   80103bf5 <kalloc_zeroed>
+8010af5e:	89 c3                	mov    %eax,%ebx
+    if(mem == 0){
+8010af60:	85 c0                	test   %eax,%eax
+8010af62:	74 2f                	je     8010af93 <allocuvm+0x6e>
+    if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+8010af64:	83 ec 08             	sub    $0x8,%esp
+8010af67:	6a 06                	push   $0x6
+8010af69:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+8010af6f:	50                   	push   %eax
+8010af70:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010af75:	89 f2                	mov    %esi,%edx
+8010af77:	8b 45 08             	mov    0x8(%ebp),%eax
+8010af7a:	e8 12 f7 ff ff       	call   8010a691 <mappages>
+8010af7f:	83 c4 10             	add    $0x10,%esp
+8010af82:	85 c0                	test   %eax,%eax
+8010af84:	78 33                	js     8010afb9 <allocuvm+0x94>
+  for(; a < newsz; a += PGSIZE){
+8010af86:	81 c6 00 10 00 00    	add    $0x1000,%esi
+8010af8c:	eb c3                	jmp    8010af51 <allocuvm+0x2c>
+    return oldsz;
+8010af8e:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010af91:	eb 5d                	jmp    8010aff0 <allocuvm+0xcb>
+      cprintf("allocuvm out of memory\n");
+8010af93:	83 ec 0c             	sub    $0xc,%esp
+8010af96:	68 db c4 10 80       	push   $0x8010c4db
+8010af9b:	e8 4c 60 ff ff       	call   80100fec <cprintf>
+      deallocuvm(pgdir, newsz, oldsz);
+8010afa0:	83 c4 0c             	add    $0xc,%esp
+8010afa3:	ff 75 0c             	push   0xc(%ebp)
+8010afa6:	57                   	push   %edi
+8010afa7:	ff 75 08             	push   0x8(%ebp)
+8010afaa:	e8 ae fe ff ff       	call   8010ae5d <deallocuvm>
+      return 0;
+8010afaf:	83 c4 10             	add    $0x10,%esp
+8010afb2:	b8 00 00 00 00       	mov    $0x0,%eax
+8010afb7:	eb 37                	jmp    8010aff0 <allocuvm+0xcb>
+      cprintf("allocuvm out of memory (2)\n");
+8010afb9:	83 ec 0c             	sub    $0xc,%esp
+8010afbc:	68 f3 c4 10 80       	push   $0x8010c4f3
+8010afc1:	e8 26 60 ff ff       	call   80100fec <cprintf>
+      deallocuvm(pgdir, newsz, oldsz);
+8010afc6:	83 c4 0c             	add    $0xc,%esp
+8010afc9:	ff 75 0c             	push   0xc(%ebp)
+8010afcc:	57                   	push   %edi
+8010afcd:	ff 75 08             	push   0x8(%ebp)
+8010afd0:	e8 88 fe ff ff       	call   8010ae5d <deallocuvm>
+      kfree(mem);
+8010afd5:	89 1c 24             	mov    %ebx,(%esp)
+8010afd8:	e8 32 85 ff ff       	call   8010350f <kfree>
+      return 0;
+8010afdd:	83 c4 10             	add    $0x10,%esp
+8010afe0:	b8 00 00 00 00       	mov    $0x0,%eax
+8010afe5:	eb 09                	jmp    8010aff0 <allocuvm+0xcb>
+  return newsz;
+8010afe7:	89 f8                	mov    %edi,%eax
+8010afe9:	eb 05                	jmp    8010aff0 <allocuvm+0xcb>
+    return 0;
+8010afeb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010aff0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010aff3:	5b                   	pop    %ebx
+8010aff4:	5e                   	pop    %esi
+8010aff5:	5f                   	pop    %edi
+8010aff6:	5d                   	pop    %ebp
+8010aff7:	c3                   	ret
+
+8010aff8 <freevm>:
+{
+8010aff8:	55                   	push   %ebp
+8010aff9:	89 e5                	mov    %esp,%ebp
+8010affb:	56                   	push   %esi
+8010affc:	53                   	push   %ebx
+8010affd:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(pgdir == 0)
+8010b000:	85 f6                	test   %esi,%esi
+8010b002:	74 1a                	je     8010b01e <freevm+0x26>
+  deallocuvm(pgdir, KERNBASE, 0);
+8010b004:	83 ec 04             	sub    $0x4,%esp
+8010b007:	6a 00                	push   $0x0
+8010b009:	68 00 00 00 80       	push   $0x80000000
+8010b00e:	56                   	push   %esi
+8010b00f:	e8 49 fe ff ff       	call   8010ae5d <deallocuvm>
+  for(i = 0; i < NPDENTRIES; i++){
+8010b014:	83 c4 10             	add    $0x10,%esp
+8010b017:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010b01c:	eb 10                	jmp    8010b02e <freevm+0x36>
+    panic("freevm: no pgdir");
+8010b01e:	83 ec 0c             	sub    $0xc,%esp
+8010b021:	68 0f c5 10 80       	push   $0x8010c50f
+8010b026:	e8 00 5d ff ff       	call   80100d2b <panic>
+  for(i = 0; i < NPDENTRIES; i++){
+8010b02b:	83 c3 01             	add    $0x1,%ebx
+8010b02e:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+8010b034:	77 28                	ja     8010b05e <freevm+0x66>
+    if((pgdir[i] & PTE_P) && !(pgdir[i] & PTE_PS)){
+8010b036:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+8010b039:	89 c2                	mov    %eax,%edx
+8010b03b:	81 e2 81 00 00 00    	and    $0x81,%edx
+8010b041:	83 fa 01             	cmp    $0x1,%edx
+8010b044:	75 e5                	jne    8010b02b <freevm+0x33>
+      char * v = P2V(PTE_ADDR(pgdir[i]));
+8010b046:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010b04b:	05 00 00 00 80       	add    $0x80000000,%eax
+      kfree(v);
+8010b050:	83 ec 0c             	sub    $0xc,%esp
+8010b053:	50                   	push   %eax
+8010b054:	e8 b6 84 ff ff       	call   8010350f <kfree>
+8010b059:	83 c4 10             	add    $0x10,%esp
+8010b05c:	eb cd                	jmp    8010b02b <freevm+0x33>
+  kfree((char*)pgdir);
+8010b05e:	83 ec 0c             	sub    $0xc,%esp
+8010b061:	56                   	push   %esi
+8010b062:	e8 a8 84 ff ff       	call   8010350f <kfree>
+}
+8010b067:	83 c4 10             	add    $0x10,%esp
+8010b06a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010b06d:	5b                   	pop    %ebx
+8010b06e:	5e                   	pop    %esi
+8010b06f:	5d                   	pop    %ebp
+8010b070:	c3                   	ret
+
+8010b071 <setupkvm>:
+{
+8010b071:	55                   	push   %ebp
+8010b072:	89 e5                	mov    %esp,%ebp
+8010b074:	56                   	push   %esi
+8010b075:	53                   	push   %ebx
+  if((pgdir = (pde_t*)kalloc_zeroed()) == 0)
+8010b076:	e8 7a 8b ff ff       	call   80103bf5 <kalloc_zeroed>
+8010b07b:	89 c6                	mov    %eax,%esi
+8010b07d:	85 c0                	test   %eax,%eax
+8010b07f:	74 52                	je     8010b0d3 <setupkvm+0x62>
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++){
+8010b081:	bb 20 f4 10 80       	mov    $0x8010f420,%ebx
+8010b086:	eb 1d                	jmp    8010b0a5 <setupkvm+0x34>
+                 (uint)k->phys_start, k->perm) < 0) {
+8010b088:	8b 43 04             	mov    0x4(%ebx),%eax
+    if(mapkernel(pgdir, k->virt, end - k->phys_start,
+8010b08b:	29 c1                	sub    %eax,%ecx
+8010b08d:	83 ec 08             	sub    $0x8,%esp
+8010b090:	ff 73 0c             	push   0xc(%ebx)
+8010b093:	50                   	push   %eax
+8010b094:	89 f0                	mov    %esi,%eax
+8010b096:	e8 6d f6 ff ff       	call   8010a708 <mapkernel>
+8010b09b:	83 c4 10             	add    $0x10,%esp
+8010b09e:	85 c0                	test   %eax,%eax
+8010b0a0:	78 20                	js     8010b0c2 <setupkvm+0x51>
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++){
+8010b0a2:	83 c3 10             	add    $0x10,%ebx
+8010b0a5:	81 fb 60 f4 10 80    	cmp    $0x8010f460,%ebx
+8010b0ab:	73 26                	jae    8010b0d3 <setupkvm+0x62>
+    end = k->phys_end;
+8010b0ad:	8b 4b 08             	mov    0x8(%ebx),%ecx
+    if(k->virt == data)
+8010b0b0:	8b 13                	mov    (%ebx),%edx
+8010b0b2:	81 fa 00 d0 10 80    	cmp    $0x8010d000,%edx
+8010b0b8:	75 ce                	jne    8010b088 <setupkvm+0x17>
+      end = phystop;
+8010b0ba:	8b 0d 60 1c 12 80    	mov    0x80121c60,%ecx
+8010b0c0:	eb c6                	jmp    8010b088 <setupkvm+0x17>
+      freevm(pgdir);
+8010b0c2:	83 ec 0c             	sub    $0xc,%esp
+8010b0c5:	56                   	push   %esi
+8010b0c6:	e8 2d ff ff ff       	call   8010aff8 <freevm>
+      return 0;
+8010b0cb:	83 c4 10             	add    $0x10,%esp
+8010b0ce:	be 00 00 00 00       	mov    $0x0,%esi
+}
+8010b0d3:	89 f0                	mov    %esi,%eax
+8010b0d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010b0d8:	5b                   	pop    %ebx
+8010b0d9:	5e                   	pop    %esi
+8010b0da:	5d                   	pop    %ebp
+8010b0db:	c3                   	ret
+
+8010b0dc <kvmalloc>:
+{
+8010b0dc:	55                   	push   %ebp
+8010b0dd:	89 e5                	mov    %esp,%ebp
+8010b0df:	83 ec 08             	sub    $0x8,%esp
+  kpgdir = setupkvm();
+8010b0e2:	e8 8a ff ff ff       	call   8010b071 <setupkvm>
+8010b0e7:	a3 60 57 13 80       	mov    %eax,0x80135760
+  switchkvm();
+8010b0ec:	e8 a5 fb ff ff       	call   8010ac96 <switchkvm>
+}
+8010b0f1:	c9                   	leave
+8010b0f2:	c3                   	ret
+
+8010b0f3 <clearpteu>:
+{
+8010b0f3:	55                   	push   %ebp
+8010b0f4:	89 e5                	mov    %esp,%ebp
+8010b0f6:	83 ec 08             	sub    $0x8,%esp
+  pte = walkpgdir(pgdir, uva, 0);
+8010b0f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010b0fe:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010b101:	8b 45 08             	mov    0x8(%ebp),%eax
+8010b104:	e8 26 f5 ff ff       	call   8010a62f <walkpgdir>
+  if(pte == 0)
+8010b109:	85 c0                	test   %eax,%eax
+8010b10b:	74 09                	je     8010b116 <clearpteu+0x23>
+  *pte &= ~PTE_U;
+8010b10d:	8b 10                	mov    (%eax),%edx
+8010b10f:	83 e2 fb             	and    $0xfffffffb,%edx
+8010b112:	89 10                	mov    %edx,(%eax)
+}
+8010b114:	c9                   	leave
+8010b115:	c3                   	ret
+    panic("clearpteu");
+8010b116:	83 ec 0c             	sub    $0xc,%esp
+8010b119:	68 20 c5 10 80       	push   $0x8010c520
+8010b11e:	e8 08 5c ff ff       	call   80100d2b <panic>
+
+8010b123 <copyuvm>:
+{
+8010b123:	55                   	push   %ebp
+8010b124:	89 e5                	mov    %esp,%ebp
+8010b126:	57                   	push   %edi
+8010b127:	56                   	push   %esi
+8010b128:	53                   	push   %ebx
+8010b129:	83 ec 1c             	sub    $0x1c,%esp
+8010b12c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if((d = setupkvm()) == 0)
+8010b12f:	e8 3d ff ff ff       	call   8010b071 <setupkvm>
+8010b134:	89 45 e0             	mov    %eax,-0x20(%ebp)
+8010b137:	85 c0                	test   %eax,%eax
+8010b139:	0f 84 25 01 00 00    	je     8010b264 <copyuvm+0x141>
+  lo = hi = 0;
+8010b13f:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+8010b146:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  for(i = 0; i < KERNBASE; i += PGSIZE){
+8010b14d:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010b152:	89 7d 08             	mov    %edi,0x8(%ebp)
+8010b155:	8b 7d 0c             	mov    0xc(%ebp),%edi
+8010b158:	eb 61                	jmp    8010b1bb <copyuvm+0x98>
+      i = PGADDR(PDX(i) + 1, 0, 0) - PGSIZE;
+8010b15a:	c1 eb 16             	shr    $0x16,%ebx
+8010b15d:	83 c3 01             	add    $0x1,%ebx
+8010b160:	c1 e3 16             	shl    $0x16,%ebx
+8010b163:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+      continue;
+8010b169:	eb 4a                	jmp    8010b1b5 <copyuvm+0x92>
+      hi = i + PGSIZE;
+8010b16b:	8d 8b 00 10 00 00    	lea    0x1000(%ebx),%ecx
+8010b171:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+    pa = PTE_ADDR(*pte);
+8010b174:	8b 00                	mov    (%eax),%eax
+8010b176:	89 c6                	mov    %eax,%esi
+8010b178:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+    flags = PTE_FLAGS(*pte);
+8010b17e:	25 ff 0f 00 00       	and    $0xfff,%eax
+    if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
+8010b183:	83 ec 08             	sub    $0x8,%esp
+8010b186:	50                   	push   %eax
+8010b187:	56                   	push   %esi
+8010b188:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010b18d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010b190:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010b193:	e8 f9 f4 ff ff       	call   8010a691 <mappages>
+8010b198:	83 c4 10             	add    $0x10,%esp
+8010b19b:	85 c0                	test   %eax,%eax
+8010b19d:	0f 88 86 00 00 00    	js     8010b229 <copyuvm+0x106>
+    kdup(P2V(pa));
+8010b1a3:	81 c6 00 00 00 80    	add    $0x80000000,%esi
+8010b1a9:	83 ec 0c             	sub    $0xc,%esp
+8010b1ac:	56                   	push   %esi
+8010b1ad:	e8 11 8b ff ff       	call   80103cc3 <kdup>
+8010b1b2:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < KERNBASE; i += PGSIZE){
+8010b1b5:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010b1bb:	85 db                	test   %ebx,%ebx
+8010b1bd:	0f 88 8f 00 00 00    	js     8010b252 <copyuvm+0x12f>
+    if(i >= sz && i < UMAPBASE)
+8010b1c3:	39 fb                	cmp    %edi,%ebx
+8010b1c5:	0f 93 c2             	setae  %dl
+8010b1c8:	81 fb ff ff ff 5f    	cmp    $0x5fffffff,%ebx
+8010b1ce:	0f 96 c0             	setbe  %al
+8010b1d1:	84 c2                	test   %al,%dl
+8010b1d3:	74 05                	je     8010b1da <copyuvm+0xb7>
+      i = UMAPBASE;
+8010b1d5:	bb 00 00 00 60       	mov    $0x60000000,%ebx
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0){
+8010b1da:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+8010b1dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010b1e2:	89 da                	mov    %ebx,%edx
+8010b1e4:	8b 45 08             	mov    0x8(%ebp),%eax
+8010b1e7:	e8 43 f4 ff ff       	call   8010a62f <walkpgdir>
+8010b1ec:	85 c0                	test   %eax,%eax
+8010b1ee:	0f 84 66 ff ff ff    	je     8010b15a <copyuvm+0x37>
+    if(!(*pte & PTE_P))
+8010b1f4:	8b 10                	mov    (%eax),%edx
+8010b1f6:	f6 c2 01             	test   $0x1,%dl
+8010b1f9:	74 ba                	je     8010b1b5 <copyuvm+0x92>
+    if((*pte & PTE_W) && !(*pte & PTE_SHM)){
+8010b1fb:	89 d1                	mov    %edx,%ecx
+8010b1fd:	81 e1 02 04 00 00    	and    $0x402,%ecx
+8010b203:	83 f9 02             	cmp    $0x2,%ecx
+8010b206:	0f 85 68 ff ff ff    	jne    8010b174 <copyuvm+0x51>
+      *pte = (*pte & ~PTE_W) | PTE_COW;
+8010b20c:	81 e2 fd f7 ff ff    	and    $0xfffff7fd,%edx
+8010b212:	80 ce 08             	or     $0x8,%dh
+8010b215:	89 10                	mov    %edx,(%eax)
+      if(hi == 0)
+8010b217:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+8010b21b:	0f 85 4a ff ff ff    	jne    8010b16b <copyuvm+0x48>
+        lo = i;
+8010b221:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+8010b224:	e9 42 ff ff ff       	jmp    8010b16b <copyuvm+0x48>
+  tlbflush(pgdir, lo, hi - lo);
+8010b229:	8b 7d 08             	mov    0x8(%ebp),%edi
+8010b22c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+8010b22f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+8010b232:	29 d1                	sub    %edx,%ecx
+8010b234:	89 f8                	mov    %edi,%eax
+8010b236:	e8 ce f5 ff ff       	call   8010a809 <tlbflush>
+  freevm(d);
+8010b23b:	83 ec 0c             	sub    $0xc,%esp
+8010b23e:	ff 75 e0             	push   -0x20(%ebp)
+8010b241:	e8 b2 fd ff ff       	call   8010aff8 <freevm>
+  return 0;
+8010b246:	83 c4 10             	add    $0x10,%esp
+8010b249:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+8010b250:	eb 12                	jmp    8010b264 <copyuvm+0x141>
+  tlbflush(pgdir, lo, hi - lo);
+8010b252:	8b 7d 08             	mov    0x8(%ebp),%edi
+8010b255:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+8010b258:	8b 55 d8             	mov    -0x28(%ebp),%edx
+8010b25b:	29 d1                	sub    %edx,%ecx
+8010b25d:	89 f8                	mov    %edi,%eax
+8010b25f:	e8 a5 f5 ff ff       	call   8010a809 <tlbflush>
+}
+8010b264:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010b267:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b26a:	5b                   	pop    %ebx
+8010b26b:	5e                   	pop    %esi
+8010b26c:	5f                   	pop    %edi
+8010b26d:	5d                   	pop    %ebp
+8010b26e:	c3                   	ret
+
+8010b26f <cowfault>:
+{
+8010b26f:	55                   	push   %ebp
+8010b270:	89 e5                	mov    %esp,%ebp
+8010b272:	57                   	push   %edi
+8010b273:	56                   	push   %esi
+8010b274:	53                   	push   %ebx
+8010b275:	83 ec 1c             	sub    $0x1c,%esp
+  if(va >= KERNBASE || (pte = walkpgdir(pgdir, (void*)va, 0)) == 0)
+8010b278:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+8010b27c:	78 7a                	js     8010b2f8 <cowfault+0x89>
+8010b27e:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010b283:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010b286:	8b 45 08             	mov    0x8(%ebp),%eax
+8010b289:	e8 a1 f3 ff ff       	call   8010a62f <walkpgdir>
+8010b28e:	89 c3                	mov    %eax,%ebx
+8010b290:	85 c0                	test   %eax,%eax
+8010b292:	74 64                	je     8010b2f8 <cowfault+0x89>
+  if((*pte & (PTE_P|PTE_U|PTE_COW)) != (PTE_P|PTE_U|PTE_COW))
+8010b294:	8b 00                	mov    (%eax),%eax
+8010b296:	89 c2                	mov    %eax,%edx
+8010b298:	81 e2 05 08 00 00    	and    $0x805,%edx
+8010b29e:	81 fa 05 08 00 00    	cmp    $0x805,%edx
+8010b2a4:	0f 85 89 00 00 00    	jne    8010b333 <cowfault+0xc4>
+  pa = PTE_ADDR(*pte);
+8010b2aa:	89 c6                	mov    %eax,%esi
+8010b2ac:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  flags = (PTE_FLAGS(*pte) | PTE_W) & ~PTE_COW;
+8010b2b2:	25 fd 07 00 00       	and    $0x7fd,%eax
+8010b2b7:	83 c8 02             	or     $0x2,%eax
+8010b2ba:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(krefcnt(P2V(pa)) == 1){
+8010b2bd:	8d be 00 00 00 80    	lea    -0x80000000(%esi),%edi
+8010b2c3:	83 ec 0c             	sub    $0xc,%esp
+8010b2c6:	57                   	push   %edi
+8010b2c7:	e8 ab 8a ff ff       	call   80103d77 <krefcnt>
+8010b2cc:	83 c4 10             	add    $0x10,%esp
+8010b2cf:	83 f8 01             	cmp    $0x1,%eax
+8010b2d2:	75 2b                	jne    8010b2ff <cowfault+0x90>
+    *pte = pa | flags;
+8010b2d4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010b2d7:	09 c6                	or     %eax,%esi
+8010b2d9:	89 33                	mov    %esi,(%ebx)
+  tlbflush(pgdir, va, 1);
+8010b2db:	b9 01 00 00 00       	mov    $0x1,%ecx
+8010b2e0:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010b2e3:	8b 45 08             	mov    0x8(%ebp),%eax
+8010b2e6:	e8 1e f5 ff ff       	call   8010a809 <tlbflush>
+  return 0;
+8010b2eb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010b2f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b2f3:	5b                   	pop    %ebx
+8010b2f4:	5e                   	pop    %esi
+8010b2f5:	5f                   	pop    %edi
+8010b2f6:	5d                   	pop    %ebp
+8010b2f7:	c3                   	ret
+    return -1;
+8010b2f8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010b2fd:	eb f1                	jmp    8010b2f0 <cowfault+0x81>
+    if((mem = kalloc()) == 0)
+8010b2ff:	e8 20 85 ff ff       	call   80103824 <kalloc>
+8010b304:	89 c6                	mov    %eax,%esi
+8010b306:	85 c0                	test   %eax,%eax
+8010b308:	74 30                	je     8010b33a <cowfault+0xcb>
+    memmove(mem, (char*)P2V(pa), PGSIZE);
+8010b30a:	83 ec 04             	sub    $0x4,%esp
+8010b30d:	68 00 10 00 00       	push   $0x1000
+8010b312:	57                   	push   %edi
+8010b313:	50                   	push   %eax
+8010b314:	e8 9d c8 ff ff       	call   80107bb6 <memmove>
+    *pte = V2P(mem) | flags;
+8010b319:	81 c6 00 00 00 80    	add    $0x80000000,%esi
+8010b31f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010b322:	09 c6                	or     %eax,%esi
+8010b324:	89 33                	mov    %esi,(%ebx)
+    kfree(P2V(pa));
+8010b326:	89 3c 24             	mov    %edi,(%esp)
+8010b329:	e8 e1 81 ff ff       	call   8010350f <kfree>
+8010b32e:	83 c4 10             	add    $0x10,%esp
+8010b331:	eb a8                	jmp    8010b2db <cowfault+0x6c>
+    return -1;
+8010b333:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010b338:	eb b6                	jmp    8010b2f0 <cowfault+0x81>
+      return -1;
+8010b33a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010b33f:	eb af                	jmp    8010b2f0 <cowfault+0x81>
+
+8010b341 <vmaslot>:
+{
+8010b341:	55                   	push   %ebp
+8010b342:	89 e5                	mov    %esp,%ebp
+8010b344:	53                   	push   %ebx
+8010b345:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  for(i = 0; i < NVMA; i++)
+8010b348:	ba 00 00 00 00       	mov    $0x0,%edx
+8010b34d:	eb 03                	jmp    8010b352 <vmaslot+0x11>
+8010b34f:	83 c2 01             	add    $0x1,%edx
+8010b352:	83 fa 0f             	cmp    $0xf,%edx
+8010b355:	7f 1a                	jg     8010b371 <vmaslot+0x30>
+    if(v[i].ip == 0 && v[i].shm == 0)
+8010b357:	8d 0c 52             	lea    (%edx,%edx,2),%ecx
+8010b35a:	8d 04 cd 00 00 00 00 	lea    0x0(,%ecx,8),%eax
+8010b361:	01 d8                	add    %ebx,%eax
+8010b363:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+8010b367:	75 e6                	jne    8010b34f <vmaslot+0xe>
+8010b369:	83 78 10 00          	cmpl   $0x0,0x10(%eax)
+8010b36d:	75 e0                	jne    8010b34f <vmaslot+0xe>
+8010b36f:	eb 05                	jmp    8010b376 <vmaslot+0x35>
+  return 0;
+8010b371:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010b376:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010b379:	c9                   	leave
+8010b37a:	c3                   	ret
+
+8010b37b <vmaadd>:
+{
+8010b37b:	55                   	push   %ebp
+8010b37c:	89 e5                	mov    %esp,%ebp
+8010b37e:	53                   	push   %ebx
+8010b37f:	83 ec 10             	sub    $0x10,%esp
+  if((s = vmaslot(v)) == 0)
+8010b382:	ff 75 08             	push   0x8(%ebp)
+8010b385:	e8 b7 ff ff ff       	call   8010b341 <vmaslot>
+8010b38a:	83 c4 10             	add    $0x10,%esp
+8010b38d:	85 c0                	test   %eax,%eax
+8010b38f:	74 34                	je     8010b3c5 <vmaadd+0x4a>
+8010b391:	89 c3                	mov    %eax,%ebx
+  s->start = start;
+8010b393:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010b396:	89 03                	mov    %eax,(%ebx)
+  s->len = len;
+8010b398:	8b 45 10             	mov    0x10(%ebp),%eax
+8010b39b:	89 43 04             	mov    %eax,0x4(%ebx)
+  s->off = off;
+8010b39e:	8b 45 14             	mov    0x14(%ebp),%eax
+8010b3a1:	89 43 08             	mov    %eax,0x8(%ebx)
+  s->ip = idup(ip);
+8010b3a4:	83 ec 0c             	sub    $0xc,%esp
+8010b3a7:	ff 75 18             	push   0x18(%ebp)
+8010b3aa:	e8 82 6c ff ff       	call   80102031 <idup>
+8010b3af:	89 43 0c             	mov    %eax,0xc(%ebx)
+  s->flags = flags;
+8010b3b2:	8b 45 1c             	mov    0x1c(%ebp),%eax
+8010b3b5:	89 43 14             	mov    %eax,0x14(%ebx)
+  return 0;
+8010b3b8:	83 c4 10             	add    $0x10,%esp
+8010b3bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010b3c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010b3c3:	c9                   	leave
+8010b3c4:	c3                   	ret
+    return -1;
+8010b3c5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010b3ca:	eb f4                	jmp    8010b3c0 <vmaadd+0x45>
+
+8010b3cc <vmagap>:
+{
+8010b3cc:	55                   	push   %ebp
+8010b3cd:	89 e5                	mov    %esp,%ebp
+8010b3cf:	57                   	push   %edi
+8010b3d0:	56                   	push   %esi
+8010b3d1:	53                   	push   %ebx
+8010b3d2:	83 ec 04             	sub    $0x4,%esp
+8010b3d5:	8b 75 08             	mov    0x8(%ebp),%esi
+  len = PGROUNDUP(len);
+8010b3d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010b3db:	05 ff 0f 00 00       	add    $0xfff,%eax
+8010b3e0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  for(a = UMAPBASE; a + len > a && a + len <= KERNBASE; ){
+8010b3e5:	b9 00 00 00 60       	mov    $0x60000000,%ecx
+8010b3ea:	89 45 f0             	mov    %eax,-0x10(%ebp)
+8010b3ed:	eb 5b                	jmp    8010b44a <vmagap+0x7e>
+      if((v[i].ip || v[i].shm) && v[i].start < a + len &&
+8010b3ef:	83 78 10 00          	cmpl   $0x0,0x10(%eax)
+8010b3f3:	75 1a                	jne    8010b40f <vmagap+0x43>
+    for(i = 0; i < NVMA; i++){
+8010b3f5:	83 c2 01             	add    $0x1,%edx
+8010b3f8:	83 fa 0f             	cmp    $0xf,%edx
+8010b3fb:	7f 2b                	jg     8010b428 <vmagap+0x5c>
+      if((v[i].ip || v[i].shm) && v[i].start < a + len &&
+8010b3fd:	8d 3c 52             	lea    (%edx,%edx,2),%edi
+8010b400:	8d 04 fd 00 00 00 00 	lea    0x0(,%edi,8),%eax
+8010b407:	01 f0                	add    %esi,%eax
+8010b409:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+8010b40d:	74 e0                	je     8010b3ef <vmagap+0x23>
+8010b40f:	8b 38                	mov    (%eax),%edi
+8010b411:	39 df                	cmp    %ebx,%edi
+8010b413:	73 e0                	jae    8010b3f5 <vmagap+0x29>
+         a < PGROUNDUP(v[i].start + v[i].len))
+8010b415:	03 78 04             	add    0x4(%eax),%edi
+8010b418:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+8010b41e:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+      if((v[i].ip || v[i].shm) && v[i].start < a + len &&
+8010b424:	39 f9                	cmp    %edi,%ecx
+8010b426:	73 cd                	jae    8010b3f5 <vmagap+0x29>
+    if(i == NVMA)
+8010b428:	83 fa 10             	cmp    $0x10,%edx
+8010b42b:	74 42                	je     8010b46f <vmagap+0xa3>
+    a = PGROUNDUP(v[i].start + v[i].len);
+8010b42d:	8d 14 52             	lea    (%edx,%edx,2),%edx
+8010b430:	8d 04 d5 00 00 00 00 	lea    0x0(,%edx,8),%eax
+8010b437:	01 f0                	add    %esi,%eax
+8010b439:	8b 48 04             	mov    0x4(%eax),%ecx
+8010b43c:	03 08                	add    (%eax),%ecx
+8010b43e:	81 c1 ff 0f 00 00    	add    $0xfff,%ecx
+8010b444:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  for(a = UMAPBASE; a + len > a && a + len <= KERNBASE; ){
+8010b44a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+8010b44d:	8d 1c 01             	lea    (%ecx,%eax,1),%ebx
+8010b450:	39 d9                	cmp    %ebx,%ecx
+8010b452:	73 16                	jae    8010b46a <vmagap+0x9e>
+8010b454:	81 fb 00 00 00 80    	cmp    $0x80000000,%ebx
+8010b45a:	77 07                	ja     8010b463 <vmagap+0x97>
+    for(i = 0; i < NVMA; i++){
+8010b45c:	ba 00 00 00 00       	mov    $0x0,%edx
+8010b461:	eb 95                	jmp    8010b3f8 <vmagap+0x2c>
+  return 0;
+8010b463:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010b468:	eb 05                	jmp    8010b46f <vmagap+0xa3>
+8010b46a:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+8010b46f:	89 c8                	mov    %ecx,%eax
+8010b471:	83 c4 04             	add    $0x4,%esp
+8010b474:	5b                   	pop    %ebx
+8010b475:	5e                   	pop    %esi
+8010b476:	5f                   	pop    %edi
+8010b477:	5d                   	pop    %ebp
+8010b478:	c3                   	ret
+
+8010b479 <vmadup>:
+{
+8010b479:	55                   	push   %ebp
+8010b47a:	89 e5                	mov    %esp,%ebp
+8010b47c:	57                   	push   %edi
+8010b47d:	56                   	push   %esi
+8010b47e:	53                   	push   %ebx
+8010b47f:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < NVMA; i++){
+8010b482:	bf 00 00 00 00       	mov    $0x0,%edi
+8010b487:	eb 03                	jmp    8010b48c <vmadup+0x13>
+8010b489:	83 c7 01             	add    $0x1,%edi
+8010b48c:	83 ff 0f             	cmp    $0xf,%edi
+8010b48f:	7f 5b                	jg     8010b4ec <vmadup+0x73>
+    dst[i] = src[i];
+8010b491:	8d 1c 7f             	lea    (%edi,%edi,2),%ebx
+8010b494:	c1 e3 03             	shl    $0x3,%ebx
+8010b497:	89 de                	mov    %ebx,%esi
+8010b499:	03 75 0c             	add    0xc(%ebp),%esi
+8010b49c:	03 5d 08             	add    0x8(%ebp),%ebx
+8010b49f:	8b 06                	mov    (%esi),%eax
+8010b4a1:	89 03                	mov    %eax,(%ebx)
+8010b4a3:	8b 46 04             	mov    0x4(%esi),%eax
+8010b4a6:	89 43 04             	mov    %eax,0x4(%ebx)
+8010b4a9:	8b 46 08             	mov    0x8(%esi),%eax
+8010b4ac:	89 43 08             	mov    %eax,0x8(%ebx)
+8010b4af:	8b 46 0c             	mov    0xc(%esi),%eax
+8010b4b2:	89 43 0c             	mov    %eax,0xc(%ebx)
+8010b4b5:	8b 46 10             	mov    0x10(%esi),%eax
+8010b4b8:	89 43 10             	mov    %eax,0x10(%ebx)
+8010b4bb:	8b 46 14             	mov    0x14(%esi),%eax
+8010b4be:	89 43 14             	mov    %eax,0x14(%ebx)
+    if(src[i].ip)
+8010b4c1:	8b 46 0c             	mov    0xc(%esi),%eax
+8010b4c4:	85 c0                	test   %eax,%eax
+8010b4c6:	74 0f                	je     8010b4d7 <vmadup+0x5e>
+      dst[i].ip = idup(src[i].ip);
+8010b4c8:	83 ec 0c             	sub    $0xc,%esp
+8010b4cb:	50                   	push   %eax
+8010b4cc:	e8 60 6b ff ff       	call   80102031 <idup>
+8010b4d1:	89 43 0c             	mov    %eax,0xc(%ebx)
+8010b4d4:	83 c4 10             	add    $0x10,%esp
+    if(src[i].shm)
+8010b4d7:	8b 46 10             	mov    0x10(%esi),%eax
+8010b4da:	85 c0                	test   %eax,%eax
+8010b4dc:	74 ab                	je     8010b489 <vmadup+0x10>
+      shmdup(src[i].shm);
+8010b4de:	83 ec 0c             	sub    $0xc,%esp
+8010b4e1:	50                   	push   %eax
+8010b4e2:	e8 b5 bc ff ff       	call   8010719c <shmdup>
+8010b4e7:	83 c4 10             	add    $0x10,%esp
+8010b4ea:	eb 9d                	jmp    8010b489 <vmadup+0x10>
+}
+8010b4ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b4ef:	5b                   	pop    %ebx
+8010b4f0:	5e                   	pop    %esi
+8010b4f1:	5f                   	pop    %edi
+8010b4f2:	5d                   	pop    %ebp
+8010b4f3:	c3                   	ret
+
+8010b4f4 <vmafree>:
+{
+8010b4f4:	55                   	push   %ebp
+8010b4f5:	89 e5                	mov    %esp,%ebp
+8010b4f7:	57                   	push   %edi
+8010b4f8:	56                   	push   %esi
+8010b4f9:	53                   	push   %ebx
+8010b4fa:	83 ec 0c             	sub    $0xc,%esp
+8010b4fd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; i < NVMA; i++){
+8010b500:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010b505:	eb 03                	jmp    8010b50a <vmafree+0x16>
+8010b507:	83 c3 01             	add    $0x1,%ebx
+8010b50a:	83 fb 0f             	cmp    $0xf,%ebx
+8010b50d:	7f 29                	jg     8010b538 <vmafree+0x44>
+    if(v[i].shm){
+8010b50f:	8d 14 5b             	lea    (%ebx,%ebx,2),%edx
+8010b512:	8d 04 d5 00 00 00 00 	lea    0x0(,%edx,8),%eax
+8010b519:	8d 34 07             	lea    (%edi,%eax,1),%esi
+8010b51c:	8b 46 10             	mov    0x10(%esi),%eax
+8010b51f:	85 c0                	test   %eax,%eax
+8010b521:	74 e4                	je     8010b507 <vmafree+0x13>
+      shmput(v[i].shm);
+8010b523:	83 ec 0c             	sub    $0xc,%esp
+8010b526:	50                   	push   %eax
+8010b527:	e8 a1 bc ff ff       	call   801071cd <shmput>
+      v[i].shm = 0;
+8010b52c:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+8010b533:	83 c4 10             	add    $0x10,%esp
+8010b536:	eb cf                	jmp    8010b507 <vmafree+0x13>
+  for(i = 0; i < NVMA; i++)
+8010b538:	b8 00 00 00 00       	mov    $0x0,%eax
+8010b53d:	83 f8 0f             	cmp    $0xf,%eax
+8010b540:	7f 16                	jg     8010b558 <vmafree+0x64>
+    if(v[i].ip)
+8010b542:	8d 0c 40             	lea    (%eax,%eax,2),%ecx
+8010b545:	8d 14 cd 00 00 00 00 	lea    0x0(,%ecx,8),%edx
+8010b54c:	83 7c 17 0c 00       	cmpl   $0x0,0xc(%edi,%edx,1)
+8010b551:	75 05                	jne    8010b558 <vmafree+0x64>
+  for(i = 0; i < NVMA; i++)
+8010b553:	83 c0 01             	add    $0x1,%eax
+8010b556:	eb e5                	jmp    8010b53d <vmafree+0x49>
+  if(i == NVMA)
+8010b558:	83 f8 10             	cmp    $0x10,%eax
+8010b55b:	74 48                	je     8010b5a5 <vmafree+0xb1>
+  begin_op();
+8010b55d:	e8 d8 94 ff ff       	call   80104a3a <begin_op>
+  for(i = 0; i < NVMA; i++){
+8010b562:	be 00 00 00 00       	mov    $0x0,%esi
+8010b567:	eb 03                	jmp    8010b56c <vmafree+0x78>
+8010b569:	83 c6 01             	add    $0x1,%esi
+8010b56c:	83 fe 0f             	cmp    $0xf,%esi
+8010b56f:	7f 2f                	jg     8010b5a0 <vmafree+0xac>
+    if(v[i].ip){
+8010b571:	8d 04 76             	lea    (%esi,%esi,2),%eax
+8010b574:	8d 1c c5 00 00 00 00 	lea    0x0(,%eax,8),%ebx
+8010b57b:	01 fb                	add    %edi,%ebx
+8010b57d:	8b 43 0c             	mov    0xc(%ebx),%eax
+8010b580:	85 c0                	test   %eax,%eax
+8010b582:	74 e5                	je     8010b569 <vmafree+0x75>
+      iput(v[i].ip);
+8010b584:	83 ec 0c             	sub    $0xc,%esp
+8010b587:	50                   	push   %eax
+8010b588:	e8 db 6b ff ff       	call   80102168 <iput>
+      v[i].ip = 0;
+8010b58d:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+      v[i].flags = 0;
+8010b594:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+8010b59b:	83 c4 10             	add    $0x10,%esp
+8010b59e:	eb c9                	jmp    8010b569 <vmafree+0x75>
+  end_op();
+8010b5a0:	e8 29 95 ff ff       	call   80104ace <end_op>
+}
+8010b5a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b5a8:	5b                   	pop    %ebx
+8010b5a9:	5e                   	pop    %esi
+8010b5aa:	5f                   	pop    %edi
+8010b5ab:	5d                   	pop    %ebp
+8010b5ac:	c3                   	ret
+
+8010b5ad <mapshared>:
+{
+8010b5ad:	55                   	push   %ebp
+8010b5ae:	89 e5                	mov    %esp,%ebp
+8010b5b0:	57                   	push   %edi
+8010b5b1:	56                   	push   %esi
+8010b5b2:	53                   	push   %ebx
+8010b5b3:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < n; i++){
+8010b5b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010b5bb:	eb 10                	jmp    8010b5cd <mapshared+0x20>
+    kdup(page[i]);
+8010b5bd:	83 ec 0c             	sub    $0xc,%esp
+8010b5c0:	ff 37                	push   (%edi)
+8010b5c2:	e8 fc 86 ff ff       	call   80103cc3 <kdup>
+  for(i = 0; i < n; i++){
+8010b5c7:	83 c3 01             	add    $0x1,%ebx
+8010b5ca:	83 c4 10             	add    $0x10,%esp
+8010b5cd:	3b 5d 14             	cmp    0x14(%ebp),%ebx
+8010b5d0:	7d 4d                	jge    8010b61f <mapshared+0x72>
+    if(mappages(pgdir, (char*)va + i*PGSIZE, PGSIZE, V2P(page[i]),
+8010b5d2:	8b 45 10             	mov    0x10(%ebp),%eax
+8010b5d5:	8d 3c 98             	lea    (%eax,%ebx,4),%edi
+8010b5d8:	89 de                	mov    %ebx,%esi
+8010b5da:	c1 e6 0c             	shl    $0xc,%esi
+8010b5dd:	03 75 0c             	add    0xc(%ebp),%esi
+8010b5e0:	83 ec 08             	sub    $0x8,%esp
+8010b5e3:	68 06 04 00 00       	push   $0x406
+8010b5e8:	8b 07                	mov    (%edi),%eax
+8010b5ea:	05 00 00 00 80       	add    $0x80000000,%eax
+8010b5ef:	50                   	push   %eax
+8010b5f0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010b5f5:	89 f2                	mov    %esi,%edx
+8010b5f7:	8b 45 08             	mov    0x8(%ebp),%eax
+8010b5fa:	e8 92 f0 ff ff       	call   8010a691 <mappages>
+8010b5ff:	83 c4 10             	add    $0x10,%esp
+8010b602:	85 c0                	test   %eax,%eax
+8010b604:	79 b7                	jns    8010b5bd <mapshared+0x10>
+      deallocuvm(pgdir, va + i*PGSIZE, va);
+8010b606:	83 ec 04             	sub    $0x4,%esp
+8010b609:	ff 75 0c             	push   0xc(%ebp)
+8010b60c:	56                   	push   %esi
+8010b60d:	ff 75 08             	push   0x8(%ebp)
+8010b610:	e8 48 f8 ff ff       	call   8010ae5d <deallocuvm>
+      return -1;
+8010b615:	83 c4 10             	add    $0x10,%esp
+8010b618:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010b61d:	eb 05                	jmp    8010b624 <mapshared+0x77>
+  return 0;
+8010b61f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010b624:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b627:	5b                   	pop    %ebx
+8010b628:	5e                   	pop    %esi
+8010b629:	5f                   	pop    %edi
+8010b62a:	5d                   	pop    %ebp
+8010b62b:	c3                   	ret
+
+8010b62c <uend>:
+{
+8010b62c:	55                   	push   %ebp
+8010b62d:	89 e5                	mov    %esp,%ebp
+8010b62f:	53                   	push   %ebx
+8010b630:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010b633:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  if(va < p->sz)
+8010b636:	8b 03                	mov    (%ebx),%eax
+8010b638:	39 c1                	cmp    %eax,%ecx
+8010b63a:	72 3f                	jb     8010b67b <uend+0x4f>
+  for(v = p->vma; v < &p->vma[NVMA]; v++)
+8010b63c:	8d 93 a8 00 00 00    	lea    0xa8(%ebx),%edx
+8010b642:	eb 09                	jmp    8010b64d <uend+0x21>
+    if((v->shm || (v->flags & VMA_MMAP)) &&
+8010b644:	f6 42 14 04          	testb  $0x4,0x14(%edx)
+8010b648:	75 13                	jne    8010b65d <uend+0x31>
+  for(v = p->vma; v < &p->vma[NVMA]; v++)
+8010b64a:	83 c2 18             	add    $0x18,%edx
+8010b64d:	8d 83 28 02 00 00    	lea    0x228(%ebx),%eax
+8010b653:	39 c2                	cmp    %eax,%edx
+8010b655:	73 1f                	jae    8010b676 <uend+0x4a>
+    if((v->shm || (v->flags & VMA_MMAP)) &&
+8010b657:	83 7a 10 00          	cmpl   $0x0,0x10(%edx)
+8010b65b:	74 e7                	je     8010b644 <uend+0x18>
+       va >= v->start && va < PGROUNDUP(v->start + v->len))
+8010b65d:	8b 02                	mov    (%edx),%eax
+    if((v->shm || (v->flags & VMA_MMAP)) &&
+8010b65f:	39 c1                	cmp    %eax,%ecx
+8010b661:	72 e7                	jb     8010b64a <uend+0x1e>
+       va >= v->start && va < PGROUNDUP(v->start + v->len))
+8010b663:	03 42 04             	add    0x4(%edx),%eax
+8010b666:	05 ff 0f 00 00       	add    $0xfff,%eax
+8010b66b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010b670:	39 c1                	cmp    %eax,%ecx
+8010b672:	73 d6                	jae    8010b64a <uend+0x1e>
+8010b674:	eb 05                	jmp    8010b67b <uend+0x4f>
+  return 0;
+8010b676:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010b67b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010b67e:	c9                   	leave
+8010b67f:	c3                   	ret
+
+8010b680 <uvmclean>:
+{
+8010b680:	55                   	push   %ebp
+8010b681:	89 e5                	mov    %esp,%ebp
+8010b683:	57                   	push   %edi
+8010b684:	56                   	push   %esi
+8010b685:	53                   	push   %ebx
+8010b686:	83 ec 0c             	sub    $0xc,%esp
+8010b689:	8b 75 08             	mov    0x8(%ebp),%esi
+8010b68c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  pte = walkpgdir(pgdir, (char*)va, 0);
+8010b68f:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010b694:	89 fa                	mov    %edi,%edx
+8010b696:	89 f0                	mov    %esi,%eax
+8010b698:	e8 92 ef ff ff       	call   8010a62f <walkpgdir>
+8010b69d:	89 c3                	mov    %eax,%ebx
+  if(pte == 0 || (*pte & (PTE_P|PTE_D)) != (PTE_P|PTE_D))
+8010b69f:	85 c0                	test   %eax,%eax
+8010b6a1:	74 2d                	je     8010b6d0 <uvmclean+0x50>
+8010b6a3:	8b 00                	mov    (%eax),%eax
+8010b6a5:	89 c2                	mov    %eax,%edx
+8010b6a7:	83 e2 41             	and    $0x41,%edx
+8010b6aa:	83 fa 41             	cmp    $0x41,%edx
+8010b6ad:	75 2b                	jne    8010b6da <uvmclean+0x5a>
+  *pte &= ~PTE_D;
+8010b6af:	83 e0 bf             	and    $0xffffffbf,%eax
+8010b6b2:	89 03                	mov    %eax,(%ebx)
+  tlbflush(pgdir, va, 1);
+8010b6b4:	b9 01 00 00 00       	mov    $0x1,%ecx
+8010b6b9:	89 fa                	mov    %edi,%edx
+8010b6bb:	89 f0                	mov    %esi,%eax
+8010b6bd:	e8 47 f1 ff ff       	call   8010a809 <tlbflush>
+  return P2V(PTE_ADDR(*pte));
+8010b6c2:	8b 1b                	mov    (%ebx),%ebx
+8010b6c4:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+8010b6ca:	81 c3 00 00 00 80    	add    $0x80000000,%ebx
+}
+8010b6d0:	89 d8                	mov    %ebx,%eax
+8010b6d2:	83 c4 0c             	add    $0xc,%esp
+8010b6d5:	5b                   	pop    %ebx
+8010b6d6:	5e                   	pop    %esi
+8010b6d7:	5f                   	pop    %edi
+8010b6d8:	5d                   	pop    %ebp
+8010b6d9:	c3                   	ret
+    return 0;
+8010b6da:	bb 00 00 00 00       	mov    $0x0,%ebx
+8010b6df:	eb ef                	jmp    8010b6d0 <uvmclean+0x50>
+
+8010b6e1 <pagefault>:
+// read-only mapping is a real fault; syscalls check their
+// buffers with faultin() first, so the kernel never takes one.
+// Returns 0 if the access can be retried, -1 for a real fault.
+int
+pagefault(struct proc *p, uint va, int err)
+{
+8010b6e1:	55                   	push   %ebp
+8010b6e2:	89 e5                	mov    %esp,%ebp
+8010b6e4:	57                   	push   %edi
+8010b6e5:	56                   	push   %esi
+8010b6e6:	53                   	push   %ebx
+8010b6e7:	83 ec 0c             	sub    $0xc,%esp
+8010b6ea:	8b 75 08             	mov    0x8(%ebp),%esi
+8010b6ed:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  pte_t *pte;
+  struct vma *v;
+
+  v = vmafind(p, va);
+8010b6f0:	89 fa                	mov    %edi,%edx
+8010b6f2:	89 f0                	mov    %esi,%eax
+8010b6f4:	e8 ee ee ff ff       	call   8010a5e7 <vmafind>
+8010b6f9:	89 c3                	mov    %eax,%ebx
+  if(va >= p->sz && v == 0)
+8010b6fb:	3b 3e                	cmp    (%esi),%edi
+8010b6fd:	72 04                	jb     8010b703 <pagefault+0x22>
+8010b6ff:	85 c0                	test   %eax,%eax
+8010b701:	74 71                	je     8010b774 <pagefault+0x93>
+    return -1;
+  pte = walkpgdir(p->pgdir, (char*)va, 0);
+8010b703:	8b 46 04             	mov    0x4(%esi),%eax
+8010b706:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010b70b:	89 fa                	mov    %edi,%edx
+8010b70d:	e8 1d ef ff ff       	call   8010a62f <walkpgdir>
+  if(pte == 0 || (*pte & PTE_P) == 0){
+8010b712:	85 c0                	test   %eax,%eax
+8010b714:	74 05                	je     8010b71b <pagefault+0x3a>
+8010b716:	f6 00 01             	testb  $0x1,(%eax)
+8010b719:	75 32                	jne    8010b74d <pagefault+0x6c>
+    if(v && (v->flags & VMA_SHARED))
+8010b71b:	85 db                	test   %ebx,%ebx
+8010b71d:	74 22                	je     8010b741 <pagefault+0x60>
+8010b71f:	f6 43 14 02          	testb  $0x2,0x14(%ebx)
+8010b723:	74 0e                	je     8010b733 <pagefault+0x52>
+      return sharedfault(p->pgdir, v, va);
+8010b725:	8b 46 04             	mov    0x4(%esi),%eax
+8010b728:	89 f9                	mov    %edi,%ecx
+8010b72a:	89 da                	mov    %ebx,%edx
+8010b72c:	e8 37 f1 ff ff       	call   8010a868 <sharedfault>
+8010b731:	eb 39                	jmp    8010b76c <pagefault+0x8b>
+    if(v)
+      return filefault(p->pgdir, v, va);
+8010b733:	8b 46 04             	mov    0x4(%esi),%eax
+8010b736:	89 f9                	mov    %edi,%ecx
+8010b738:	89 da                	mov    %ebx,%edx
+8010b73a:	e8 25 f2 ff ff       	call   8010a964 <filefault>
+8010b73f:	eb 2b                	jmp    8010b76c <pagefault+0x8b>
+    return zerofault(p->pgdir, va);
+8010b741:	8b 46 04             	mov    0x4(%esi),%eax
+8010b744:	89 fa                	mov    %edi,%edx
+8010b746:	e8 58 f0 ff ff       	call   8010a7a3 <zerofault>
+8010b74b:	eb 1f                	jmp    8010b76c <pagefault+0x8b>
+  }
+  if(!(err & FEC_WR))
+8010b74d:	f6 45 10 02          	testb  $0x2,0x10(%ebp)
+8010b751:	74 28                	je     8010b77b <pagefault+0x9a>
+    return -1;
+  if(v && !(v->flags & VMA_WRITE))
+8010b753:	85 db                	test   %ebx,%ebx
+8010b755:	74 06                	je     8010b75d <pagefault+0x7c>
+8010b757:	f6 43 14 01          	testb  $0x1,0x14(%ebx)
+8010b75b:	74 25                	je     8010b782 <pagefault+0xa1>
+    return -1;
+  return cowfault(p->pgdir, va);
+8010b75d:	83 ec 08             	sub    $0x8,%esp
+8010b760:	57                   	push   %edi
+8010b761:	ff 76 04             	push   0x4(%esi)
+8010b764:	e8 06 fb ff ff       	call   8010b26f <cowfault>
+8010b769:	83 c4 10             	add    $0x10,%esp
+}
+8010b76c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b76f:	5b                   	pop    %ebx
+8010b770:	5e                   	pop    %esi
+8010b771:	5f                   	pop    %edi
+8010b772:	5d                   	pop    %ebp
+8010b773:	c3                   	ret
+    return -1;
+8010b774:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010b779:	eb f1                	jmp    8010b76c <pagefault+0x8b>
+    return -1;
+8010b77b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010b780:	eb ea                	jmp    8010b76c <pagefault+0x8b>
+    return -1;
+8010b782:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010b787:	eb e3                	jmp    8010b76c <pagefault+0x8b>
+
+8010b789 <faultin>:
+// that the kernel can use them without faulting on pages that
+// pagefault() would have to allocate or copy.
+// Returns 0 on success, -1 if some page can't be backed.
+int
+faultin(struct proc *p, uint va, uint n, int write)
+{
+8010b789:	55                   	push   %ebp
+8010b78a:	89 e5                	mov    %esp,%ebp
+8010b78c:	57                   	push   %edi
+8010b78d:	56                   	push   %esi
+8010b78e:	53                   	push   %ebx
+8010b78f:	83 ec 1c             	sub    $0x1c,%esp
+8010b792:	8b 75 08             	mov    0x8(%ebp),%esi
+8010b795:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010b798:	8b 45 10             	mov    0x10(%ebp),%eax
+  uint a, last;
+  pte_t *pte;
+
+  if(n == 0)
+8010b79b:	85 c0                	test   %eax,%eax
+8010b79d:	0f 84 82 00 00 00    	je     8010b825 <faultin+0x9c>
+    return 0;
+  a = PGROUNDDOWN(va);
+8010b7a3:	89 d3                	mov    %edx,%ebx
+8010b7a5:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  last = PGROUNDDOWN(va + n - 1);
+8010b7ab:	8d 44 02 ff          	lea    -0x1(%edx,%eax,1),%eax
+8010b7af:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010b7b4:	89 c7                	mov    %eax,%edi
+8010b7b6:	eb 0a                	jmp    8010b7c2 <faultin+0x39>
+        return -1;
+      pte = walkpgdir(p->pgdir, (char*)a, 0);
+    }
+    if(write && (*pte & PTE_W) == 0 && pagefault(p, a, FEC_WR) < 0)
+      return -1;
+    if(a == last)
+8010b7b8:	39 fb                	cmp    %edi,%ebx
+8010b7ba:	74 77                	je     8010b833 <faultin+0xaa>
+      break;
+    a += PGSIZE;
+8010b7bc:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    pte = walkpgdir(p->pgdir, (char*)a, 0);
+8010b7c2:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+8010b7c5:	8b 46 04             	mov    0x4(%esi),%eax
+8010b7c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010b7cd:	89 da                	mov    %ebx,%edx
+8010b7cf:	e8 5b ee ff ff       	call   8010a62f <walkpgdir>
+    if(pte == 0 || (*pte & PTE_P) == 0){
+8010b7d4:	85 c0                	test   %eax,%eax
+8010b7d6:	74 05                	je     8010b7dd <faultin+0x54>
+8010b7d8:	f6 00 01             	testb  $0x1,(%eax)
+8010b7db:	75 23                	jne    8010b800 <faultin+0x77>
+      if(pagefault(p, a, 0) < 0)
+8010b7dd:	83 ec 04             	sub    $0x4,%esp
+8010b7e0:	6a 00                	push   $0x0
+8010b7e2:	53                   	push   %ebx
+8010b7e3:	56                   	push   %esi
+8010b7e4:	e8 f8 fe ff ff       	call   8010b6e1 <pagefault>
+8010b7e9:	83 c4 10             	add    $0x10,%esp
+8010b7ec:	85 c0                	test   %eax,%eax
+8010b7ee:	78 3c                	js     8010b82c <faultin+0xa3>
+      pte = walkpgdir(p->pgdir, (char*)a, 0);
+8010b7f0:	8b 46 04             	mov    0x4(%esi),%eax
+8010b7f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010b7f8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010b7fb:	e8 2f ee ff ff       	call   8010a62f <walkpgdir>
+    if(write && (*pte & PTE_W) == 0 && pagefault(p, a, FEC_WR) < 0)
+8010b800:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+8010b804:	74 b2                	je     8010b7b8 <faultin+0x2f>
+8010b806:	f6 00 02             	testb  $0x2,(%eax)
+8010b809:	75 ad                	jne    8010b7b8 <faultin+0x2f>
+8010b80b:	83 ec 04             	sub    $0x4,%esp
+8010b80e:	6a 02                	push   $0x2
+8010b810:	53                   	push   %ebx
+8010b811:	56                   	push   %esi
+8010b812:	e8 ca fe ff ff       	call   8010b6e1 <pagefault>
+8010b817:	83 c4 10             	add    $0x10,%esp
+8010b81a:	85 c0                	test   %eax,%eax
+8010b81c:	79 9a                	jns    8010b7b8 <faultin+0x2f>
+      return -1;
+8010b81e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010b823:	eb 13                	jmp    8010b838 <faultin+0xaf>
+    return 0;
+8010b825:	b8 00 00 00 00       	mov    $0x0,%eax
+8010b82a:	eb 0c                	jmp    8010b838 <faultin+0xaf>
+        return -1;
+8010b82c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010b831:	eb 05                	jmp    8010b838 <faultin+0xaf>
+  }
+  return 0;
+8010b833:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010b838:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b83b:	5b                   	pop    %ebx
+8010b83c:	5e                   	pop    %esi
+8010b83d:	5f                   	pop    %edi
+8010b83e:	5d                   	pop    %ebp
+8010b83f:	c3                   	ret
+
+8010b840 <uva2ka>:
+
+// Map user virtual address to kernel address.
+char*
+uva2ka(pde_t *pgdir, char *uva)
+{
+8010b840:	55                   	push   %ebp
+8010b841:	89 e5                	mov    %esp,%ebp
+8010b843:	83 ec 08             	sub    $0x8,%esp
+  pte_t *pte;
+
+  pte = walkpgdir(pgdir, uva, 0);
+8010b846:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010b84b:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010b84e:	8b 45 08             	mov    0x8(%ebp),%eax
+8010b851:	e8 d9 ed ff ff       	call   8010a62f <walkpgdir>
+  if(pte == 0 || (*pte & PTE_P) == 0)
+8010b856:	85 c0                	test   %eax,%eax
+8010b858:	74 14                	je     8010b86e <uva2ka+0x2e>
+8010b85a:	8b 00                	mov    (%eax),%eax
+8010b85c:	a8 01                	test   $0x1,%al
+8010b85e:	74 10                	je     8010b870 <uva2ka+0x30>
+    return 0;
+  if((*pte & PTE_U) == 0)
+8010b860:	a8 04                	test   $0x4,%al
+8010b862:	74 13                	je     8010b877 <uva2ka+0x37>
+    return 0;
+  return (char*)P2V(PTE_ADDR(*pte));
+8010b864:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010b869:	05 00 00 00 80       	add    $0x80000000,%eax
+}
+8010b86e:	c9                   	leave
+8010b86f:	c3                   	ret
+    return 0;
+8010b870:	b8 00 00 00 00       	mov    $0x0,%eax
+8010b875:	eb f7                	jmp    8010b86e <uva2ka+0x2e>
+    return 0;
+8010b877:	b8 00 00 00 00       	mov    $0x0,%eax
+8010b87c:	eb f0                	jmp    8010b86e <uva2ka+0x2e>
+
+8010b87e <copyout>:
+// Unbacked pages are allocated and copy-on-write pages are
+// copied first, since the caller has already checked that
+// va lies within the process.
+int
+copyout(pde_t *pgdir, uint va, void *p, uint len)
+{
+8010b87e:	55                   	push   %ebp
+8010b87f:	89 e5                	mov    %esp,%ebp
+8010b881:	57                   	push   %edi
+8010b882:	56                   	push   %esi
+8010b883:	53                   	push   %ebx
+8010b884:	83 ec 0c             	sub    $0xc,%esp
+8010b887:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *buf, *pa0;
+  uint n, va0;
+  pte_t *pte;
+
+  buf = (char*)p;
+  while(len > 0){
+8010b88a:	eb 5b                	jmp    8010b8e7 <copyout+0x69>
+    va0 = (uint)PGROUNDDOWN(va);
+    pte = walkpgdir(pgdir, (char*)va0, 0);
+    if(pte == 0 || (*pte & PTE_P) == 0){
+      if(zerofault(pgdir, va0) < 0)
+8010b88c:	89 f2                	mov    %esi,%edx
+8010b88e:	8b 45 08             	mov    0x8(%ebp),%eax
+8010b891:	e8 0d ef ff ff       	call   8010a7a3 <zerofault>
+8010b896:	85 c0                	test   %eax,%eax
+8010b898:	0f 88 a4 00 00 00    	js     8010b942 <copyout+0xc4>
+        return -1;
+    } else if(*pte & PTE_COW){
+      if(cowfault(pgdir, va0) < 0)
+        return -1;
+    }
+    pa0 = uva2ka(pgdir, (char*)va0);
+8010b89e:	83 ec 08             	sub    $0x8,%esp
+8010b8a1:	56                   	push   %esi
+8010b8a2:	ff 75 08             	push   0x8(%ebp)
+8010b8a5:	e8 96 ff ff ff       	call   8010b840 <uva2ka>
+    if(pa0 == 0)
+8010b8aa:	83 c4 10             	add    $0x10,%esp
+8010b8ad:	85 c0                	test   %eax,%eax
+8010b8af:	0f 84 94 00 00 00    	je     8010b949 <copyout+0xcb>
+      return -1;
+    n = PGSIZE - (va - va0);
+8010b8b5:	89 f3                	mov    %esi,%ebx
+8010b8b7:	29 fb                	sub    %edi,%ebx
+8010b8b9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    if(n > len)
+8010b8bf:	39 5d 14             	cmp    %ebx,0x14(%ebp)
+8010b8c2:	73 03                	jae    8010b8c7 <copyout+0x49>
+      n = len;
+8010b8c4:	8b 5d 14             	mov    0x14(%ebp),%ebx
+    memmove(pa0 + (va - va0), buf, n);
+8010b8c7:	29 f7                	sub    %esi,%edi
+8010b8c9:	01 f8                	add    %edi,%eax
+8010b8cb:	83 ec 04             	sub    $0x4,%esp
+8010b8ce:	53                   	push   %ebx
+8010b8cf:	ff 75 10             	push   0x10(%ebp)
+8010b8d2:	50                   	push   %eax
+8010b8d3:	e8 de c2 ff ff       	call   80107bb6 <memmove>
+    len -= n;
+8010b8d8:	29 5d 14             	sub    %ebx,0x14(%ebp)
+    buf += n;
+8010b8db:	01 5d 10             	add    %ebx,0x10(%ebp)
+    va = va0 + PGSIZE;
+8010b8de:	8d be 00 10 00 00    	lea    0x1000(%esi),%edi
+8010b8e4:	83 c4 10             	add    $0x10,%esp
+  while(len > 0){
+8010b8e7:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+8010b8eb:	74 48                	je     8010b935 <copyout+0xb7>
+    va0 = (uint)PGROUNDDOWN(va);
+8010b8ed:	89 fe                	mov    %edi,%esi
+8010b8ef:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+    pte = walkpgdir(pgdir, (char*)va0, 0);
+8010b8f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+8010b8fa:	89 f2                	mov    %esi,%edx
+8010b8fc:	8b 45 08             	mov    0x8(%ebp),%eax
+8010b8ff:	e8 2b ed ff ff       	call   8010a62f <walkpgdir>
+    if(pte == 0 || (*pte & PTE_P) == 0){
+8010b904:	85 c0                	test   %eax,%eax
+8010b906:	74 84                	je     8010b88c <copyout+0xe>
+8010b908:	8b 00                	mov    (%eax),%eax
+8010b90a:	a8 01                	test   $0x1,%al
+8010b90c:	0f 84 7a ff ff ff    	je     8010b88c <copyout+0xe>
+    } else if(*pte & PTE_COW){
+8010b912:	f6 c4 08             	test   $0x8,%ah
+8010b915:	74 87                	je     8010b89e <copyout+0x20>
+      if(cowfault(pgdir, va0) < 0)
+8010b917:	83 ec 08             	sub    $0x8,%esp
+8010b91a:	56                   	push   %esi
+8010b91b:	ff 75 08             	push   0x8(%ebp)
+8010b91e:	e8 4c f9 ff ff       	call   8010b26f <cowfault>
+8010b923:	83 c4 10             	add    $0x10,%esp
+8010b926:	85 c0                	test   %eax,%eax
+8010b928:	0f 89 70 ff ff ff    	jns    8010b89e <copyout+0x20>
+        return -1;
+8010b92e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010b933:	eb 05                	jmp    8010b93a <copyout+0xbc>
+  }
+  return 0;
+8010b935:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+8010b93a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b93d:	5b                   	pop    %ebx
+8010b93e:	5e                   	pop    %esi
+8010b93f:	5f                   	pop    %edi
+8010b940:	5d                   	pop    %ebp
+8010b941:	c3                   	ret
+        return -1;
+8010b942:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010b947:	eb f1                	jmp    8010b93a <copyout+0xbc>
+      return -1;
+8010b949:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010b94e:	eb ea                	jmp    8010b93a <copyout+0xbc>
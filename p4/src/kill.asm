@@ -0,0 +1,1106 @@
+
+_kill:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char **argv)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+  19:	83 fe 01             	cmp    $0x1,%esi
+  1c:	7e 07                	jle    25 <main+0x25>
+    printf(2, "usage: kill pid...\n");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+  1e:	bb 01 00 00 00       	mov    $0x1,%ebx
+  23:	eb 2d                	jmp    52 <main+0x52>
+    printf(2, "usage: kill pid...\n");
+  25:	83 ec 08             	sub    $0x8,%esp
+  28:	68 80 06 00 00       	push   $0x680
+  2d:	6a 02                	push   $0x2
+  2f:	e8 9d 03 00 00       	call   3d1 <printf>
+    exit();
+  34:	e8 c1 01 00 00       	call   1fa <exit>
+    kill(atoi(argv[i]));
+  39:	83 ec 0c             	sub    $0xc,%esp
+  3c:	ff 34 9f             	push   (%edi,%ebx,4)
+  3f:	e8 52 01 00 00       	call   196 <atoi>
+  44:	89 04 24             	mov    %eax,(%esp)
+  47:	e8 de 01 00 00       	call   22a <kill>
+  for(i=1; i<argc; i++)
+  4c:	83 c3 01             	add    $0x1,%ebx
+  4f:	83 c4 10             	add    $0x10,%esp
+  52:	39 f3                	cmp    %esi,%ebx
+  54:	7c e3                	jl     39 <main+0x39>
+  exit();
+  56:	e8 9f 01 00 00       	call   1fa <exit>
+
+0000005b <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  5b:	55                   	push   %ebp
+  5c:	89 e5                	mov    %esp,%ebp
+  5e:	56                   	push   %esi
+  5f:	53                   	push   %ebx
+  60:	8b 75 08             	mov    0x8(%ebp),%esi
+  63:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  66:	89 f0                	mov    %esi,%eax
+  68:	89 d1                	mov    %edx,%ecx
+  6a:	83 c2 01             	add    $0x1,%edx
+  6d:	89 c3                	mov    %eax,%ebx
+  6f:	83 c0 01             	add    $0x1,%eax
+  72:	0f b6 09             	movzbl (%ecx),%ecx
+  75:	88 0b                	mov    %cl,(%ebx)
+  77:	84 c9                	test   %cl,%cl
+  79:	75 ed                	jne    68 <strcpy+0xd>
+    ;
+  return os;
+}
+  7b:	89 f0                	mov    %esi,%eax
+  7d:	5b                   	pop    %ebx
+  7e:	5e                   	pop    %esi
+  7f:	5d                   	pop    %ebp
+  80:	c3                   	ret
+
+00000081 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  81:	55                   	push   %ebp
+  82:	89 e5                	mov    %esp,%ebp
+  84:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  87:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+  8a:	eb 06                	jmp    92 <strcmp+0x11>
+    p++, q++;
+  8c:	83 c1 01             	add    $0x1,%ecx
+  8f:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+  92:	0f b6 01             	movzbl (%ecx),%eax
+  95:	84 c0                	test   %al,%al
+  97:	74 04                	je     9d <strcmp+0x1c>
+  99:	3a 02                	cmp    (%edx),%al
+  9b:	74 ef                	je     8c <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+  9d:	0f b6 c0             	movzbl %al,%eax
+  a0:	0f b6 12             	movzbl (%edx),%edx
+  a3:	29 d0                	sub    %edx,%eax
+}
+  a5:	5d                   	pop    %ebp
+  a6:	c3                   	ret
+
+000000a7 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  a7:	55                   	push   %ebp
+  a8:	89 e5                	mov    %esp,%ebp
+  aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  b2:	eb 03                	jmp    b7 <strlen+0x10>
+  b4:	83 c0 01             	add    $0x1,%eax
+  b7:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  bb:	75 f7                	jne    b4 <strlen+0xd>
+    ;
+  return n;
+}
+  bd:	5d                   	pop    %ebp
+  be:	c3                   	ret
+
+000000bf <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  bf:	55                   	push   %ebp
+  c0:	89 e5                	mov    %esp,%ebp
+  c2:	57                   	push   %edi
+  c3:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  c6:	89 d7                	mov    %edx,%edi
+  c8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  ce:	fc                   	cld
+  cf:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  d1:	89 d0                	mov    %edx,%eax
+  d3:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  d6:	c9                   	leave
+  d7:	c3                   	ret
+
+000000d8 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  d8:	55                   	push   %ebp
+  d9:	89 e5                	mov    %esp,%ebp
+  db:	8b 45 08             	mov    0x8(%ebp),%eax
+  de:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+  e2:	eb 03                	jmp    e7 <strchr+0xf>
+  e4:	83 c0 01             	add    $0x1,%eax
+  e7:	0f b6 10             	movzbl (%eax),%edx
+  ea:	84 d2                	test   %dl,%dl
+  ec:	74 06                	je     f4 <strchr+0x1c>
+    if(*s == c)
+  ee:	38 ca                	cmp    %cl,%dl
+  f0:	75 f2                	jne    e4 <strchr+0xc>
+  f2:	eb 05                	jmp    f9 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  f9:	5d                   	pop    %ebp
+  fa:	c3                   	ret
+
+000000fb <gets>:
+
+char*
+gets(char *buf, int max)
+{
+  fb:	55                   	push   %ebp
+  fc:	89 e5                	mov    %esp,%ebp
+  fe:	57                   	push   %edi
+  ff:	56                   	push   %esi
+ 100:	53                   	push   %ebx
+ 101:	83 ec 1c             	sub    $0x1c,%esp
+ 104:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 107:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 10c:	89 de                	mov    %ebx,%esi
+ 10e:	83 c3 01             	add    $0x1,%ebx
+ 111:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 114:	7d 2e                	jge    144 <gets+0x49>
+    cc = read(0, &c, 1);
+ 116:	83 ec 04             	sub    $0x4,%esp
+ 119:	6a 01                	push   $0x1
+ 11b:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 11e:	50                   	push   %eax
+ 11f:	6a 00                	push   $0x0
+ 121:	e8 ec 00 00 00       	call   212 <read>
+    if(cc < 1)
+ 126:	83 c4 10             	add    $0x10,%esp
+ 129:	85 c0                	test   %eax,%eax
+ 12b:	7e 17                	jle    144 <gets+0x49>
+      break;
+    buf[i++] = c;
+ 12d:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 131:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 134:	3c 0a                	cmp    $0xa,%al
+ 136:	0f 94 c2             	sete   %dl
+ 139:	3c 0d                	cmp    $0xd,%al
+ 13b:	0f 94 c0             	sete   %al
+ 13e:	08 c2                	or     %al,%dl
+ 140:	74 ca                	je     10c <gets+0x11>
+    buf[i++] = c;
+ 142:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 144:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 148:	89 f8                	mov    %edi,%eax
+ 14a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 14d:	5b                   	pop    %ebx
+ 14e:	5e                   	pop    %esi
+ 14f:	5f                   	pop    %edi
+ 150:	5d                   	pop    %ebp
+ 151:	c3                   	ret
+
+00000152 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 152:	55                   	push   %ebp
+ 153:	89 e5                	mov    %esp,%ebp
+ 155:	56                   	push   %esi
+ 156:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 157:	83 ec 08             	sub    $0x8,%esp
+ 15a:	6a 00                	push   $0x0
+ 15c:	ff 75 08             	push   0x8(%ebp)
+ 15f:	e8 d6 00 00 00       	call   23a <open>
+  if(fd < 0)
+ 164:	83 c4 10             	add    $0x10,%esp
+ 167:	85 c0                	test   %eax,%eax
+ 169:	78 24                	js     18f <stat+0x3d>
+ 16b:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 16d:	83 ec 08             	sub    $0x8,%esp
+ 170:	ff 75 0c             	push   0xc(%ebp)
+ 173:	50                   	push   %eax
+ 174:	e8 d9 00 00 00       	call   252 <fstat>
+ 179:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 17b:	89 1c 24             	mov    %ebx,(%esp)
+ 17e:	e8 9f 00 00 00       	call   222 <close>
+  return r;
+ 183:	83 c4 10             	add    $0x10,%esp
+}
+ 186:	89 f0                	mov    %esi,%eax
+ 188:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 18b:	5b                   	pop    %ebx
+ 18c:	5e                   	pop    %esi
+ 18d:	5d                   	pop    %ebp
+ 18e:	c3                   	ret
+    return -1;
+ 18f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 194:	eb f0                	jmp    186 <stat+0x34>
+
+00000196 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 196:	55                   	push   %ebp
+ 197:	89 e5                	mov    %esp,%ebp
+ 199:	53                   	push   %ebx
+ 19a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+ 19d:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+ 1a2:	eb 10                	jmp    1b4 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+ 1a4:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+ 1a7:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+ 1aa:	83 c1 01             	add    $0x1,%ecx
+ 1ad:	0f be c0             	movsbl %al,%eax
+ 1b0:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+ 1b4:	0f b6 01             	movzbl (%ecx),%eax
+ 1b7:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 1ba:	80 fb 09             	cmp    $0x9,%bl
+ 1bd:	76 e5                	jbe    1a4 <atoi+0xe>
+  return n;
+}
+ 1bf:	89 d0                	mov    %edx,%eax
+ 1c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1c4:	c9                   	leave
+ 1c5:	c3                   	ret
+
+000001c6 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 1c6:	55                   	push   %ebp
+ 1c7:	89 e5                	mov    %esp,%ebp
+ 1c9:	56                   	push   %esi
+ 1ca:	53                   	push   %ebx
+ 1cb:	8b 75 08             	mov    0x8(%ebp),%esi
+ 1ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 1d1:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 1d4:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 1d6:	eb 0d                	jmp    1e5 <memmove+0x1f>
+    *dst++ = *src++;
+ 1d8:	0f b6 01             	movzbl (%ecx),%eax
+ 1db:	88 02                	mov    %al,(%edx)
+ 1dd:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 1e0:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 1e3:	89 d8                	mov    %ebx,%eax
+ 1e5:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 1e8:	85 c0                	test   %eax,%eax
+ 1ea:	7f ec                	jg     1d8 <memmove+0x12>
+  return vdst;
+}
+ 1ec:	89 f0                	mov    %esi,%eax
+ 1ee:	5b                   	pop    %ebx
+ 1ef:	5e                   	pop    %esi
+ 1f0:	5d                   	pop    %ebp
+ 1f1:	c3                   	ret
+
+000001f2 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 1f2:	b8 01 00 00 00       	mov    $0x1,%eax
+ 1f7:	cd 40                	int    $0x40
+ 1f9:	c3                   	ret
+
+000001fa <exit>:
+SYSCALL(exit)
+ 1fa:	b8 02 00 00 00       	mov    $0x2,%eax
+ 1ff:	cd 40                	int    $0x40
+ 201:	c3                   	ret
+
+00000202 <wait>:
+SYSCALL(wait)
+ 202:	b8 03 00 00 00       	mov    $0x3,%eax
+ 207:	cd 40                	int    $0x40
+ 209:	c3                   	ret
+
+0000020a <pipe>:
+SYSCALL(pipe)
+ 20a:	b8 04 00 00 00       	mov    $0x4,%eax
+ 20f:	cd 40                	int    $0x40
+ 211:	c3                   	ret
+
+00000212 <read>:
+SYSCALL(read)
+ 212:	b8 05 00 00 00       	mov    $0x5,%eax
+ 217:	cd 40                	int    $0x40
+ 219:	c3                   	ret
+
+0000021a <write>:
+SYSCALL(write)
+ 21a:	b8 10 00 00 00       	mov    $0x10,%eax
+ 21f:	cd 40                	int    $0x40
+ 221:	c3                   	ret
+
+00000222 <close>:
+SYSCALL(close)
+ 222:	b8 15 00 00 00       	mov    $0x15,%eax
+ 227:	cd 40                	int    $0x40
+ 229:	c3                   	ret
+
+0000022a <kill>:
+SYSCALL(kill)
+ 22a:	b8 06 00 00 00       	mov    $0x6,%eax
+ 22f:	cd 40                	int    $0x40
+ 231:	c3                   	ret
+
+00000232 <exec>:
+SYSCALL(exec)
+ 232:	b8 07 00 00 00       	mov    $0x7,%eax
+ 237:	cd 40                	int    $0x40
+ 239:	c3                   	ret
+
+0000023a <open>:
+SYSCALL(open)
+ 23a:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 23f:	cd 40                	int    $0x40
+ 241:	c3                   	ret
+
+00000242 <mknod>:
+SYSCALL(mknod)
+ 242:	b8 11 00 00 00       	mov    $0x11,%eax
+ 247:	cd 40                	int    $0x40
+ 249:	c3                   	ret
+
+0000024a <unlink>:
+SYSCALL(unlink)
+ 24a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 24f:	cd 40                	int    $0x40
+ 251:	c3                   	ret
+
+00000252 <fstat>:
+SYSCALL(fstat)
+ 252:	b8 08 00 00 00       	mov    $0x8,%eax
+ 257:	cd 40                	int    $0x40
+ 259:	c3                   	ret
+
+0000025a <link>:
+SYSCALL(link)
+ 25a:	b8 13 00 00 00       	mov    $0x13,%eax
+ 25f:	cd 40                	int    $0x40
+ 261:	c3                   	ret
+
+00000262 <mkdir>:
+SYSCALL(mkdir)
+ 262:	b8 14 00 00 00       	mov    $0x14,%eax
+ 267:	cd 40                	int    $0x40
+ 269:	c3                   	ret
+
+0000026a <chdir>:
+SYSCALL(chdir)
+ 26a:	b8 09 00 00 00       	mov    $0x9,%eax
+ 26f:	cd 40                	int    $0x40
+ 271:	c3                   	ret
+
+00000272 <dup>:
+SYSCALL(dup)
+ 272:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 277:	cd 40                	int    $0x40
+ 279:	c3                   	ret
+
+0000027a <getpid>:
+SYSCALL(getpid)
+ 27a:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 27f:	cd 40                	int    $0x40
+ 281:	c3                   	ret
+
+00000282 <sbrk>:
+SYSCALL(sbrk)
+ 282:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 287:	cd 40                	int    $0x40
+ 289:	c3                   	ret
+
+0000028a <sleep>:
+SYSCALL(sleep)
+ 28a:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 28f:	cd 40                	int    $0x40
+ 291:	c3                   	ret
+
+00000292 <uptime>:
+SYSCALL(uptime)
+ 292:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 297:	cd 40                	int    $0x40
+ 299:	c3                   	ret
+
+0000029a <setpri>:
+SYSCALL(setpri)
+ 29a:	b8 16 00 00 00       	mov    $0x16,%eax
+ 29f:	cd 40                	int    $0x40
+ 2a1:	c3                   	ret
+
+000002a2 <getpri>:
+SYSCALL(getpri)
+ 2a2:	b8 17 00 00 00       	mov    $0x17,%eax
+ 2a7:	cd 40                	int    $0x40
+ 2a9:	c3                   	ret
+
+000002aa <fork2>:
+SYSCALL(fork2)
+ 2aa:	b8 18 00 00 00       	mov    $0x18,%eax
+ 2af:	cd 40                	int    $0x40
+ 2b1:	c3                   	ret
+
+000002b2 <getpinfo>:
+SYSCALL(getpinfo)
+ 2b2:	b8 19 00 00 00       	mov    $0x19,%eax
+ 2b7:	cd 40                	int    $0x40
+ 2b9:	c3                   	ret
+
+000002ba <spawn>:
+SYSCALL(spawn)
+ 2ba:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 2bf:	cd 40                	int    $0x40
+ 2c1:	c3                   	ret
+
+000002c2 <spawnn>:
+SYSCALL(spawnn)
+ 2c2:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 2c7:	cd 40                	int    $0x40
+ 2c9:	c3                   	ret
+
+000002ca <kmstat>:
+SYSCALL(kmstat)
+ 2ca:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 2cf:	cd 40                	int    $0x40
+ 2d1:	c3                   	ret
+
+000002d2 <slabstat>:
+SYSCALL(slabstat)
+ 2d2:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 2d7:	cd 40                	int    $0x40
+ 2d9:	c3                   	ret
+
+000002da <shmget>:
+SYSCALL(shmget)
+ 2da:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 2df:	cd 40                	int    $0x40
+ 2e1:	c3                   	ret
+
+000002e2 <shmat>:
+SYSCALL(shmat)
+ 2e2:	b8 20 00 00 00       	mov    $0x20,%eax
+ 2e7:	cd 40                	int    $0x40
+ 2e9:	c3                   	ret
+
+000002ea <shmdt>:
+SYSCALL(shmdt)
+ 2ea:	b8 21 00 00 00       	mov    $0x21,%eax
+ 2ef:	cd 40                	int    $0x40
+ 2f1:	c3                   	ret
+
+000002f2 <mmap>:
+SYSCALL(mmap)
+ 2f2:	b8 22 00 00 00       	mov    $0x22,%eax
+ 2f7:	cd 40                	int    $0x40
+ 2f9:	c3                   	ret
+
+000002fa <munmap>:
+SYSCALL(munmap)
+ 2fa:	b8 23 00 00 00       	mov    $0x23,%eax
+ 2ff:	cd 40                	int    $0x40
+ 301:	c3                   	ret
+
+00000302 <bstat>:
+SYSCALL(bstat)
+ 302:	b8 24 00 00 00       	mov    $0x24,%eax
+ 307:	cd 40                	int    $0x40
+ 309:	c3                   	ret
+
+0000030a <aread>:
+SYSCALL(aread)
+ 30a:	b8 25 00 00 00       	mov    $0x25,%eax
+ 30f:	cd 40                	int    $0x40
+ 311:	c3                   	ret
+
+00000312 <await>:
+SYSCALL(await)
+ 312:	b8 26 00 00 00       	mov    $0x26,%eax
+ 317:	cd 40                	int    $0x40
+ 319:	c3                   	ret
+
+0000031a <bdrop>:
+SYSCALL(bdrop)
+ 31a:	b8 27 00 00 00       	mov    $0x27,%eax
+ 31f:	cd 40                	int    $0x40
+ 321:	c3                   	ret
+
+00000322 <vfork>:
+# exec or exit, and its ret would leave the slot holding our
+# return address free for it to overwrite.  Keep the return
+# address in %ecx, which the kernel restores for both sides.
+.globl vfork
+vfork:
+  popl %ecx
+ 322:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+ 323:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  int $T_SYSCALL
+ 328:	cd 40                	int    $0x40
+  pushl %ecx
+ 32a:	51                   	push   %ecx
+  ret
+ 32b:	c3                   	ret
+
+0000032c <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 32c:	55                   	push   %ebp
+ 32d:	89 e5                	mov    %esp,%ebp
+ 32f:	83 ec 1c             	sub    $0x1c,%esp
+ 332:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 335:	6a 01                	push   $0x1
+ 337:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 33a:	52                   	push   %edx
+ 33b:	50                   	push   %eax
+ 33c:	e8 d9 fe ff ff       	call   21a <write>
+}
+ 341:	83 c4 10             	add    $0x10,%esp
+ 344:	c9                   	leave
+ 345:	c3                   	ret
+
+00000346 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 346:	55                   	push   %ebp
+ 347:	89 e5                	mov    %esp,%ebp
+ 349:	57                   	push   %edi
+ 34a:	56                   	push   %esi
+ 34b:	53                   	push   %ebx
+ 34c:	83 ec 2c             	sub    $0x2c,%esp
+ 34f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 352:	89 d0                	mov    %edx,%eax
+ 354:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 356:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 35a:	0f 95 c1             	setne  %cl
+ 35d:	c1 ea 1f             	shr    $0x1f,%edx
+ 360:	84 d1                	test   %dl,%cl
+ 362:	74 44                	je     3a8 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 364:	f7 d8                	neg    %eax
+ 366:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 368:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 36f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 374:	89 c8                	mov    %ecx,%eax
+ 376:	ba 00 00 00 00       	mov    $0x0,%edx
+ 37b:	f7 f6                	div    %esi
+ 37d:	89 df                	mov    %ebx,%edi
+ 37f:	83 c3 01             	add    $0x1,%ebx
+ 382:	0f b6 92 f4 06 00 00 	movzbl 0x6f4(%edx),%edx
+ 389:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 38d:	89 ca                	mov    %ecx,%edx
+ 38f:	89 c1                	mov    %eax,%ecx
+ 391:	39 f2                	cmp    %esi,%edx
+ 393:	73 df                	jae    374 <printint+0x2e>
+  if(neg)
+ 395:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 399:	74 31                	je     3cc <printint+0x86>
+    buf[i++] = '-';
+ 39b:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 3a0:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 3a3:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 3a6:	eb 17                	jmp    3bf <printint+0x79>
+    x = xx;
+ 3a8:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 3aa:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 3b1:	eb bc                	jmp    36f <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 3b3:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 3b8:	89 f0                	mov    %esi,%eax
+ 3ba:	e8 6d ff ff ff       	call   32c <putc>
+  while(--i >= 0)
+ 3bf:	83 eb 01             	sub    $0x1,%ebx
+ 3c2:	79 ef                	jns    3b3 <printint+0x6d>
+}
+ 3c4:	83 c4 2c             	add    $0x2c,%esp
+ 3c7:	5b                   	pop    %ebx
+ 3c8:	5e                   	pop    %esi
+ 3c9:	5f                   	pop    %edi
+ 3ca:	5d                   	pop    %ebp
+ 3cb:	c3                   	ret
+ 3cc:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 3cf:	eb ee                	jmp    3bf <printint+0x79>
+
+000003d1 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 3d1:	55                   	push   %ebp
+ 3d2:	89 e5                	mov    %esp,%ebp
+ 3d4:	57                   	push   %edi
+ 3d5:	56                   	push   %esi
+ 3d6:	53                   	push   %ebx
+ 3d7:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 3da:	8d 45 10             	lea    0x10(%ebp),%eax
+ 3dd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 3e0:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 3e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 3ea:	eb 14                	jmp    400 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 3ec:	89 fa                	mov    %edi,%edx
+ 3ee:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f1:	e8 36 ff ff ff       	call   32c <putc>
+ 3f6:	eb 05                	jmp    3fd <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 3f8:	83 fe 25             	cmp    $0x25,%esi
+ 3fb:	74 25                	je     422 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 3fd:	83 c3 01             	add    $0x1,%ebx
+ 400:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 403:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 407:	84 c0                	test   %al,%al
+ 409:	0f 84 20 01 00 00    	je     52f <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 40f:	0f be f8             	movsbl %al,%edi
+ 412:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 415:	85 f6                	test   %esi,%esi
+ 417:	75 df                	jne    3f8 <printf+0x27>
+      if(c == '%'){
+ 419:	83 f8 25             	cmp    $0x25,%eax
+ 41c:	75 ce                	jne    3ec <printf+0x1b>
+        state = '%';
+ 41e:	89 c6                	mov    %eax,%esi
+ 420:	eb db                	jmp    3fd <printf+0x2c>
+      if(c == 'd'){
+ 422:	83 f8 25             	cmp    $0x25,%eax
+ 425:	0f 84 cf 00 00 00    	je     4fa <printf+0x129>
+ 42b:	0f 8c dd 00 00 00    	jl     50e <printf+0x13d>
+ 431:	83 f8 78             	cmp    $0x78,%eax
+ 434:	0f 8f d4 00 00 00    	jg     50e <printf+0x13d>
+ 43a:	83 f8 63             	cmp    $0x63,%eax
+ 43d:	0f 8c cb 00 00 00    	jl     50e <printf+0x13d>
+ 443:	83 e8 63             	sub    $0x63,%eax
+ 446:	83 f8 15             	cmp    $0x15,%eax
+ 449:	0f 87 bf 00 00 00    	ja     50e <printf+0x13d>
+ 44f:	ff 24 85 9c 06 00 00 	jmp    *0x69c(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 456:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 459:	8b 17                	mov    (%edi),%edx
+ 45b:	83 ec 0c             	sub    $0xc,%esp
+ 45e:	6a 01                	push   $0x1
+ 460:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 465:	8b 45 08             	mov    0x8(%ebp),%eax
+ 468:	e8 d9 fe ff ff       	call   346 <printint>
+        ap++;
+ 46d:	83 c7 04             	add    $0x4,%edi
+ 470:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 473:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 476:	be 00 00 00 00       	mov    $0x0,%esi
+ 47b:	eb 80                	jmp    3fd <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 47d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 480:	8b 17                	mov    (%edi),%edx
+ 482:	83 ec 0c             	sub    $0xc,%esp
+ 485:	6a 00                	push   $0x0
+ 487:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 48c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 48f:	e8 b2 fe ff ff       	call   346 <printint>
+        ap++;
+ 494:	83 c7 04             	add    $0x4,%edi
+ 497:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 49a:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 49d:	be 00 00 00 00       	mov    $0x0,%esi
+ 4a2:	e9 56 ff ff ff       	jmp    3fd <printf+0x2c>
+        s = (char*)*ap;
+ 4a7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 4aa:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 4ac:	83 c0 04             	add    $0x4,%eax
+ 4af:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 4b2:	85 f6                	test   %esi,%esi
+ 4b4:	75 15                	jne    4cb <printf+0xfa>
+          s = "(null)";
+ 4b6:	be 94 06 00 00       	mov    $0x694,%esi
+ 4bb:	eb 0e                	jmp    4cb <printf+0xfa>
+          putc(fd, *s);
+ 4bd:	0f be d2             	movsbl %dl,%edx
+ 4c0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4c3:	e8 64 fe ff ff       	call   32c <putc>
+          s++;
+ 4c8:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 4cb:	0f b6 16             	movzbl (%esi),%edx
+ 4ce:	84 d2                	test   %dl,%dl
+ 4d0:	75 eb                	jne    4bd <printf+0xec>
+      state = 0;
+ 4d2:	be 00 00 00 00       	mov    $0x0,%esi
+ 4d7:	e9 21 ff ff ff       	jmp    3fd <printf+0x2c>
+        putc(fd, *ap);
+ 4dc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 4df:	0f be 17             	movsbl (%edi),%edx
+ 4e2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4e5:	e8 42 fe ff ff       	call   32c <putc>
+        ap++;
+ 4ea:	83 c7 04             	add    $0x4,%edi
+ 4ed:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 4f0:	be 00 00 00 00       	mov    $0x0,%esi
+ 4f5:	e9 03 ff ff ff       	jmp    3fd <printf+0x2c>
+        putc(fd, c);
+ 4fa:	89 fa                	mov    %edi,%edx
+ 4fc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4ff:	e8 28 fe ff ff       	call   32c <putc>
+      state = 0;
+ 504:	be 00 00 00 00       	mov    $0x0,%esi
+ 509:	e9 ef fe ff ff       	jmp    3fd <printf+0x2c>
+        putc(fd, '%');
+ 50e:	ba 25 00 00 00       	mov    $0x25,%edx
+ 513:	8b 45 08             	mov    0x8(%ebp),%eax
+ 516:	e8 11 fe ff ff       	call   32c <putc>
+        putc(fd, c);
+ 51b:	89 fa                	mov    %edi,%edx
+ 51d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 520:	e8 07 fe ff ff       	call   32c <putc>
+      state = 0;
+ 525:	be 00 00 00 00       	mov    $0x0,%esi
+ 52a:	e9 ce fe ff ff       	jmp    3fd <printf+0x2c>
+    }
+  }
+}
+ 52f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 532:	5b                   	pop    %ebx
+ 533:	5e                   	pop    %esi
+ 534:	5f                   	pop    %edi
+ 535:	5d                   	pop    %ebp
+ 536:	c3                   	ret
+
+00000537 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 537:	55                   	push   %ebp
+ 538:	89 e5                	mov    %esp,%ebp
+ 53a:	57                   	push   %edi
+ 53b:	56                   	push   %esi
+ 53c:	53                   	push   %ebx
+ 53d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 540:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 543:	a1 a0 09 00 00       	mov    0x9a0,%eax
+ 548:	eb 02                	jmp    54c <free+0x15>
+ 54a:	89 d0                	mov    %edx,%eax
+ 54c:	39 c8                	cmp    %ecx,%eax
+ 54e:	73 04                	jae    554 <free+0x1d>
+ 550:	3b 08                	cmp    (%eax),%ecx
+ 552:	72 12                	jb     566 <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 554:	8b 10                	mov    (%eax),%edx
+ 556:	39 d0                	cmp    %edx,%eax
+ 558:	72 f0                	jb     54a <free+0x13>
+ 55a:	39 c8                	cmp    %ecx,%eax
+ 55c:	72 08                	jb     566 <free+0x2f>
+ 55e:	39 d1                	cmp    %edx,%ecx
+ 560:	72 04                	jb     566 <free+0x2f>
+ 562:	89 d0                	mov    %edx,%eax
+ 564:	eb e6                	jmp    54c <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 566:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 569:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 56c:	8b 10                	mov    (%eax),%edx
+ 56e:	39 d7                	cmp    %edx,%edi
+ 570:	74 19                	je     58b <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 572:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 575:	8b 50 04             	mov    0x4(%eax),%edx
+ 578:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 57b:	39 ce                	cmp    %ecx,%esi
+ 57d:	74 1b                	je     59a <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 57f:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 581:	a3 a0 09 00 00       	mov    %eax,0x9a0
+}
+ 586:	5b                   	pop    %ebx
+ 587:	5e                   	pop    %esi
+ 588:	5f                   	pop    %edi
+ 589:	5d                   	pop    %ebp
+ 58a:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 58b:	03 72 04             	add    0x4(%edx),%esi
+ 58e:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 591:	8b 10                	mov    (%eax),%edx
+ 593:	8b 12                	mov    (%edx),%edx
+ 595:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 598:	eb db                	jmp    575 <free+0x3e>
+    p->s.size += bp->s.size;
+ 59a:	03 53 fc             	add    -0x4(%ebx),%edx
+ 59d:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 5a0:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 5a3:	89 10                	mov    %edx,(%eax)
+ 5a5:	eb da                	jmp    581 <free+0x4a>
+
+000005a7 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 5a7:	55                   	push   %ebp
+ 5a8:	89 e5                	mov    %esp,%ebp
+ 5aa:	53                   	push   %ebx
+ 5ab:	83 ec 04             	sub    $0x4,%esp
+ 5ae:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 5b0:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 5b5:	77 05                	ja     5bc <morecore+0x15>
+    nu = 4096;
+ 5b7:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 5bc:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 5c3:	83 ec 0c             	sub    $0xc,%esp
+ 5c6:	50                   	push   %eax
+ 5c7:	e8 b6 fc ff ff       	call   282 <sbrk>
+  if(p == (char*)-1)
+ 5cc:	83 c4 10             	add    $0x10,%esp
+ 5cf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 5d2:	74 1c                	je     5f0 <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 5d4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 5d7:	83 c0 08             	add    $0x8,%eax
+ 5da:	83 ec 0c             	sub    $0xc,%esp
+ 5dd:	50                   	push   %eax
+ 5de:	e8 54 ff ff ff       	call   537 <free>
+  return freep;
+ 5e3:	a1 a0 09 00 00       	mov    0x9a0,%eax
+ 5e8:	83 c4 10             	add    $0x10,%esp
+}
+ 5eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5ee:	c9                   	leave
+ 5ef:	c3                   	ret
+    return 0;
+ 5f0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 5f5:	eb f4                	jmp    5eb <morecore+0x44>
+
+000005f7 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 5f7:	55                   	push   %ebp
+ 5f8:	89 e5                	mov    %esp,%ebp
+ 5fa:	53                   	push   %ebx
+ 5fb:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 5fe:	8b 45 08             	mov    0x8(%ebp),%eax
+ 601:	8d 58 07             	lea    0x7(%eax),%ebx
+ 604:	c1 eb 03             	shr    $0x3,%ebx
+ 607:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 60a:	8b 0d a0 09 00 00    	mov    0x9a0,%ecx
+ 610:	85 c9                	test   %ecx,%ecx
+ 612:	74 04                	je     618 <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 614:	8b 01                	mov    (%ecx),%eax
+ 616:	eb 4a                	jmp    662 <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 618:	c7 05 a0 09 00 00 a4 	movl   $0x9a4,0x9a0
+ 61f:	09 00 00 
+ 622:	c7 05 a4 09 00 00 a4 	movl   $0x9a4,0x9a4
+ 629:	09 00 00 
+    base.s.size = 0;
+ 62c:	c7 05 a8 09 00 00 00 	movl   $0x0,0x9a8
+ 633:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 636:	b9 a4 09 00 00       	mov    $0x9a4,%ecx
+ 63b:	eb d7                	jmp    614 <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 63d:	74 19                	je     658 <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 63f:	29 da                	sub    %ebx,%edx
+ 641:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 644:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 647:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 64a:	89 0d a0 09 00 00    	mov    %ecx,0x9a0
+      return (void*)(p + 1);
+ 650:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 653:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 656:	c9                   	leave
+ 657:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 658:	8b 10                	mov    (%eax),%edx
+ 65a:	89 11                	mov    %edx,(%ecx)
+ 65c:	eb ec                	jmp    64a <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 65e:	89 c1                	mov    %eax,%ecx
+ 660:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 662:	8b 50 04             	mov    0x4(%eax),%edx
+ 665:	39 da                	cmp    %ebx,%edx
+ 667:	73 d4                	jae    63d <malloc+0x46>
+    if(p == freep)
+ 669:	39 05 a0 09 00 00    	cmp    %eax,0x9a0
+ 66f:	75 ed                	jne    65e <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 671:	89 d8                	mov    %ebx,%eax
+ 673:	e8 2f ff ff ff       	call   5a7 <morecore>
+ 678:	85 c0                	test   %eax,%eax
+ 67a:	75 e2                	jne    65e <malloc+0x67>
+ 67c:	eb d5                	jmp    653 <malloc+0x5c>
@@ -0,0 +1,39 @@
+#ifndef _KMSTAT_H_
+#define _KMSTAT_H_
+
+#include "param.h"
+
+// Page allocator statistics, filled in by the kmstat() system call.
+struct kmstat {
+  int ncpu;           // number of CPUs with a page cache
+  uint phystop;       // top of physical memory found at boot
+  int npage;          // pages managed by the allocator
+  int nfree;          // free pages, buddy lists plus all caches
+  int cached[NCPU];   // free pages sitting in each CPU's cache
+  uint allocs[NCPU];  // kalloc() calls on each CPU
+  uint hits[NCPU];    // kalloc() calls served from the CPU's own cache
+  uint frees[NCPU];   // pages freed into each CPU's cache
+  uint refills[NCPU]; // batches moved from the global list to the cache
+  uint drains[NCPU];  // batches moved from the cache to the global list
+  int zeroed;         // pages in the pre-zeroed pool
+  uint zhits;         // kalloc_zeroed() calls served from the pool
+  uint zmisses;       // kalloc_zeroed() calls that had to zero a page
+  int nblock[MAXORDER+1];  // free blocks of 2^i pages in the buddy allocator
+};
+
+// Slab allocator statistics, filled in by the slabstat() system call.
+struct slabstat {
+  int n;              // number of caches
+  struct {
+    char name[16];
+    int size;         // object size in bytes
+    int inuse;        // objects allocated
+    int cached;       // free objects held in per-CPU caches
+    int total;        // objects that fit in the cache's slabs
+    int slabs;        // pages held by the cache
+    uint allocs;
+    uint frees;
+  } cache[NKMCACHE];
+};
+
+#endif // _KMSTAT_H_
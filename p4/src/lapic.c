@@ -179,6 +179,21 @@ cmos_read(uint reg)
   return inb(CMOS_RETURN);
 }
 
+// Return the top of physical memory as recorded in CMOS by
+// the BIOS: memory above 16MB in 64KB units if there is any,
+// else memory above 1MB in KB.
+uint
+cmosmemtop(void)
+{
+  uint n;
+
+  n = cmos_read(0x34) | (cmos_read(0x35) << 8);
+  if(n > 0)
+    return 16*1024*1024 + n*64*1024;
+  n = cmos_read(0x30) | (cmos_read(0x31) << 8);
+  return 1024*1024 + n*1024;
+}
+
 static void
 fill_rtcdate(struct rtcdate *r)
 {
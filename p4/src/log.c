@@ -18,7 +18,26 @@
 // its start and end. Usually begin_op() just increments
 // the count of in-progress FS system calls and returns.
 // But if it thinks the log is close to running out, it
-// sleeps until the last outstanding end_op() commits.
+// sleeps until the commit thread has made room.
+//
+// Commits are done by a kernel thread, logd, so end_op()
+// does not wait for the disk, and an operation that has
+// ended is not durable yet: a crash within COMMITTICKS,
+// plus the time the commit takes to write, loses it.
+// logsync() (the sync() system call) commits at once and
+// waits for the operations that have ended to be durable.  logd lets a transaction
+// gather operations for COMMITTICKS, or until the log
+// fills, before committing it (group commit).  It copies
+// the transaction's blocks into private shadow buffers and
+// swaps headers while no operation is active, then lets new
+// operations fill the next transaction while it appends the
+// shadows to the log.
+//
+// Committed blocks are not installed right away: they stay
+// pinned in the cache with B_DIRTY, and logd checkpoints
+// the whole log to the home locations only when it fills or
+// CHECKPOINTTICKS after the first commit, so a hot block
+// logged by many transactions is installed once.
 //
 // The log is a physical re-do log containing disk blocks.
 // The on-disk log format:
@@ -27,7 +46,13 @@
 //   block B
 //   block C
 //   ...
-// Log appends are synchronous.
+// Each commit appends its blocks and rewrites the header to
+// cover them, so a block may appear more than once; the last
+// copy is the current one.
+
+#define COMMITTICKS 2        // how long a transaction may gather operations,
+                             // and so how long end_op() may not be durable
+#define CHECKPOINTTICKS 100  // how long committed blocks may stay uninstalled
 
 // Contents of the header block, used for both the on-disk header block
 // and to keep track in memory of logged block# before commit.
@@ -41,14 +66,25 @@ struct log {
   int start;
   int size;
   int outstanding; // how many FS sys calls are executing.
-  int committing;  // in commit(), please wait.
+  int committing;  // logd is snapshotting lh, please wait.
+  int waiting;     // begin_op() calls waiting for log space.
+  uint first;      // ticks when lh logged its first block.
+  uint ckpt;       // ticks when dlh committed its first block.
+  uint deadline;   // ticks at which logd next has work to do,
+  int timed;       // if logd is sleeping until then.
+  uint started;    // commits logd has started,
+  uint done;       // and finished.
+  uint want;       // commit logsync() is waiting for.
   int dev;
-  struct logheader lh;
+  struct logheader lh;   // open transaction
+  struct logheader dlh;  // committed, uninstalled blocks in the log
 };
 struct log log;
 
+static struct buf *shadow[LOGSIZE];  // copies of dlh's log blocks
+
 static void recover_from_log(void);
-static void commit();
+static void logd(void);
 
 void
 initlog(int dev)
@@ -63,22 +99,54 @@ initlog(int dev)
   log.size = sb.nlog;
   log.dev = dev;
   recover_from_log();
+  if(kthread("logd", logd) < 0)
+    panic("initlog: logd");
+}
+
+// Wait for the writes of the n buffers in b to finish,
+// releasing each as soon as it does.
+static void
+brelseall(struct buf **b, int n)
+{
+  int i;
+
+  while (n > 0) {
+    i = bwaitany(b, n);
+    brelse(b[i]);
+    b[i] = b[--n];
+  }
+}
+
+// Is log block i the last copy of its block in lh?
+static int
+latest(struct logheader *lh, int i)
+{
+  int j;
+
+  for (j = i+1; j < lh->n; j++)
+    if (lh->block[j] == lh->block[i])
+      return 0;
+  return 1;
 }
 
 // Copy committed blocks from log to their home location
 static void
 install_trans(void)
 {
-  int tail;
+  struct buf *dbuf[LOGSIZE];
+  int tail, n;
 
+  n = 0;
   for (tail = 0; tail < log.lh.n; tail++) {
+    if (!latest(&log.lh, tail))
+      continue;
     struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
-    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
-    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
-    bwrite(dbuf);  // write dst to disk
+    dbuf[n] = bread(log.dev, log.lh.block[tail]); // read dst
+    memmove(dbuf[n]->data, lbuf->data, BSIZE);  // copy block to dst
+    bawrite(dbuf[n++]);  // start writing dst to disk
     brelse(lbuf);
-    brelse(dbuf);
   }
+  brelseall(dbuf, n);
 }
 
 // Read the log header from disk into the in-memory log header
@@ -99,14 +167,14 @@ read_head(void)
 // This is the true point at which the
 // current transaction commits.
 static void
-write_head(void)
+write_head(struct logheader *lh)
 {
   struct buf *buf = bread(log.dev, log.start);
   struct logheader *hb = (struct logheader *) (buf->data);
   int i;
-  hb->n = log.lh.n;
-  for (i = 0; i < log.lh.n; i++) {
-    hb->block[i] = log.lh.block[i];
+  hb->n = lh->n;
+  for (i = 0; i < lh->n; i++) {
+    hb->block[i] = lh->block[i];
   }
   bwrite(buf);
   brelse(buf);
@@ -118,7 +186,7 @@ recover_from_log(void)
   read_head();
   install_trans(); // if committed, copy from log to disk
   log.lh.n = 0;
-  write_head(); // clear the log
+  write_head(&log.lh); // clear the log
 }
 
 // called at the start of each FS system call.
@@ -131,7 +199,10 @@ begin_op(void)
       sleep(&log, &log.lock);
     } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
       // this op might exhaust log space; wait for commit.
+      log.waiting++;
+      wakeup(&log.lh);  // logd
       sleep(&log, &log.lock);
+      log.waiting--;
     } else {
       log.outstanding += 1;
       release(&log.lock);
@@ -141,69 +212,232 @@ begin_op(void)
 }
 
 // called at the end of each FS system call.
-// commits if this was the last outstanding operation.
+// logd commits the transaction later.
 void
 end_op(void)
 {
-  int do_commit = 0;
-
   acquire(&log.lock);
   log.outstanding -= 1;
-  if(log.committing)
-    panic("log.committing");
-  if(log.outstanding == 0){
-    do_commit = 1;
-    log.committing = 1;
-  } else {
-    // begin_op() may be waiting for log space,
-    // and decrementing log.outstanding has decreased
-    // the amount of reserved space.
-    wakeup(&log);
+  // logd may be waiting for the last operation to finish, and
+  // begin_op() may be waiting for log space, since decrementing
+  // log.outstanding has decreased the amount of reserved space.
+  wakeup(&log);
+  release(&log.lock);
+}
+
+// Append the open transaction's blocks to dlh, copying them
+// from the cache into the shadow buffers.  Called by logd
+// while log.committing holds off new operations.
+static void
+snapshot(void)
+{
+  struct buf *b;
+  int tail;
+
+  for (tail = 0; tail < log.lh.n; tail++) {
+    b = bread(log.dev, log.lh.block[tail]); // pinned, so cached
+    memmove(shadow[log.dlh.n+tail]->data, b->data, BSIZE);
+    log.dlh.block[log.dlh.n+tail] = log.lh.block[tail];
+    brelse(b);
   }
+  acquire(&log.lock);
+  log.dlh.n += log.lh.n;
+  log.lh.n = 0;
+  log.committing = 0;
+  wakeup(&log);
   release(&log.lock);
+}
 
-  if(do_commit){
-    // call commit w/o holding locks, since not allowed
-    // to sleep with locks.
-    commit();
+// Wait for the writes of the n shadow buffers in b.
+static void
+shadowwait(struct buf **b, int n)
+{
+  int i;
+
+  while (n > 0) {
+    i = bwaitany(b, n);
+    b[i] = b[--n];
+  }
+}
+
+// Write the shadows of dlh's blocks from tail on to the log
+// and commit them.
+static void
+commit(int tail)
+{
+  struct buf *b[LOGSIZE];
+  int i, n;
+
+  if (tail == log.dlh.n)
+    return;
+  n = 0;
+  for (i = tail; i < log.dlh.n; i++) {
+    b[n] = shadow[i];
+    b[n]->blockno = log.start+i+1;
+    bawrite(b[n++]);
+  }
+  shadowwait(b, n);
+  write_head(&log.dlh); // Write header to disk -- the real commit
+  if (tail == 0)
+    log.ckpt = ticks;
+}
+
+// Install the current copy of each block in the log to its
+// home location, unpin the cached copies the open transaction
+// has not logged again, and empty the log.
+static void
+checkpoint(void)
+{
+  struct buf *b[LOGSIZE];
+  int i, j, n;
+
+  if (log.dlh.n == 0)
+    return;
+  n = 0;
+  for (i = 0; i < log.dlh.n; i++) {
+    if (!latest(&log.dlh, i))
+      continue;
+    b[n] = shadow[i];
+    b[n]->blockno = log.dlh.block[i];
+    bawrite(b[n++]);
+  }
+  shadowwait(b, n);
+
+  for (i = 0; i < log.dlh.n; i++) {
+    if (!latest(&log.dlh, i))
+      continue;
+    b[0] = bread(log.dev, log.dlh.block[i]);
     acquire(&log.lock);
-    log.committing = 0;
-    wakeup(&log);
+    for (j = 0; j < log.lh.n; j++)
+      if (log.lh.block[j] == b[0]->blockno)
+        break;
+    if (j == log.lh.n)
+      b[0]->flags &= ~B_DIRTY;
     release(&log.lock);
+    brelse(b[0]);
   }
+
+  log.dlh.n = 0;
+  write_head(&log.dlh); // Erase the checkpointed blocks from the log
 }
 
-// Copy modified blocks from cache to log.
-static void
-write_log(void)
+// The tick at which the open transaction is due to commit
+// or the log to be checkpointed, whichever is first.  One
+// of lh and dlh must be nonempty.
+static uint
+deadline(void)
 {
-  int tail;
+  uint d;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *to = bread(log.dev, log.start+tail+1); // log block
-    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
-    memmove(to->data, from->data, BSIZE);
-    bwrite(to);  // write the log
-    brelse(from);
-    brelse(to);
+  if (log.lh.n == 0)
+    return log.ckpt + CHECKPOINTTICKS;
+  d = log.first + COMMITTICKS;
+  if (log.dlh.n > 0 && (int)(log.ckpt + CHECKPOINTTICKS - d) < 0)
+    d = log.ckpt + CHECKPOINTTICKS;
+  return d;
+}
+
+// Called by the timer interrupt on each tick.  Wakes logd
+// once the deadline it is sleeping until has passed.
+void
+logtick(void)
+{
+  if (log.dev == 0)  // initlog() hasn't set up log.lock yet
+    return;
+  acquire(&log.lock);
+  if (log.timed && (int)(ticks - log.deadline) >= 0) {
+    log.timed = 0;
+    wakeup(&log.lh);
   }
+  release(&log.lock);
 }
 
+// Commit thread.  Waits until the open transaction is
+// COMMITTICKS old or begin_op() is out of log space, then
+// waits for its operations to end and commits it.  Also
+// checkpoints the log when it is full or CHECKPOINTTICKS old.
 static void
-commit()
+logd(void)
 {
-  if (log.lh.n > 0) {
-    write_log();     // Write modified blocks from cache to log
-    write_head();    // Write header to disk -- the real commit
-    install_trans(); // Now install writes to home locations
-    log.lh.n = 0;
-    write_head();    // Erase the transaction from the log
+  int i, tail;
+
+  for (i = 0; i < LOGSIZE; i++) {
+    if ((shadow[i] = bprivate(log.dev)) == 0)
+      panic("logd: shadow");
+    acquiresleep(&shadow[i]->lock);
+  }
+
+  for (;;) {
+    acquire(&log.lock);
+    while ((log.lh.n == 0 ||
+            (log.waiting == 0 && (int)(log.want - log.started) <= 0 &&
+             ticks - log.first < COMMITTICKS)) &&
+           (log.dlh.n == 0 || ticks - log.ckpt < CHECKPOINTTICKS)) {
+      // Sleep until there is something to do: log_write()
+      // begin_op() and logsync() wake logd when lh gets its
+      // first block, runs out of room or must be committed
+      // now, and logtick() at the deadline.
+      if (log.lh.n > 0 || log.dlh.n > 0) {
+        log.deadline = deadline();
+        log.timed = 1;
+      }
+      sleep(&log.lh, &log.lock);
+      log.timed = 0;
+    }
+    if (log.lh.n == 0) {
+      release(&log.lock);
+      checkpoint();
+      continue;
+    }
+    // Make room in the log before holding off operations,
+    // counting what the active ones may still log.
+    if (log.dlh.n + log.lh.n + log.outstanding*MAXOPBLOCKS > log.size - 1 ||
+       (log.dlh.n > 0 && ticks - log.ckpt >= CHECKPOINTTICKS)) {
+      release(&log.lock);
+      checkpoint();
+      acquire(&log.lock);
+    }
+    log.committing = 1;
+    log.started++;
+    while (log.outstanding > 0)
+      sleep(&log, &log.lock);
+    release(&log.lock);
+
+    if (log.dlh.n + log.lh.n > log.size - 1)
+      checkpoint();
+    tail = log.dlh.n;
+    snapshot();
+    commit(tail);
+    acquire(&log.lock);
+    log.done++;
+    wakeup(&log.done);
+    release(&log.lock);
   }
 }
 
+// Wait until every operation that has ended is committed,
+// asking logd to commit the open transaction now.
+void
+logsync(void)
+{
+  uint seq;
+
+  acquire(&log.lock);
+  seq = log.started;
+  if (log.lh.n > 0 && !log.committing)
+    seq++;  // lh isn't part of a started commit yet
+  if (seq != log.started) {
+    log.want = seq;
+    wakeup(&log.lh);  // logd
+  }
+  while ((int)(log.done - seq) < 0)
+    sleep(&log.done, &log.lock);
+  release(&log.lock);
+}
+
 // Caller has modified b->data and is done with the buffer.
 // Record the block number and pin in the cache with B_DIRTY.
-// commit()/write_log() will do the disk write.
+// logd will do the disk write.
 //
 // log_write() replaces bwrite(); a typical use is:
 //   bp = bread(...)
@@ -226,8 +460,13 @@ log_write(struct buf *b)
       break;
   }
   log.lh.block[i] = b->blockno;
-  if (i == log.lh.n)
+  if (i == log.lh.n) {
+    if (log.lh.n == 0) {
+      log.first = ticks;
+      wakeup(&log.lh);  // logd
+    }
     log.lh.n++;
+  }
   b->flags |= B_DIRTY; // prevent eviction
   release(&log.lock);
 }
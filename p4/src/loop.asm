@@ -0,0 +1,1084 @@
+
+_loop:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fcntl.h"
+#include "syscall.h"
+#include "traps.h"
+#include "memlayout.h"
+
+int main(void) {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+    for(;;) {
+        sleep(10);
+  11:	83 ec 0c             	sub    $0xc,%esp
+  14:	6a 0a                	push   $0xa
+  16:	e8 49 02 00 00       	call   264 <sleep>
+        printf(1, "%d\n", getpid());
+  1b:	e8 34 02 00 00       	call   254 <getpid>
+  20:	83 c4 0c             	add    $0xc,%esp
+  23:	50                   	push   %eax
+  24:	68 58 06 00 00       	push   $0x658
+  29:	6a 01                	push   $0x1
+  2b:	e8 7b 03 00 00       	call   3ab <printf>
+  30:	83 c4 10             	add    $0x10,%esp
+  33:	eb dc                	jmp    11 <main+0x11>
+
+00000035 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  35:	55                   	push   %ebp
+  36:	89 e5                	mov    %esp,%ebp
+  38:	56                   	push   %esi
+  39:	53                   	push   %ebx
+  3a:	8b 75 08             	mov    0x8(%ebp),%esi
+  3d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  40:	89 f0                	mov    %esi,%eax
+  42:	89 d1                	mov    %edx,%ecx
+  44:	83 c2 01             	add    $0x1,%edx
+  47:	89 c3                	mov    %eax,%ebx
+  49:	83 c0 01             	add    $0x1,%eax
+  4c:	0f b6 09             	movzbl (%ecx),%ecx
+  4f:	88 0b                	mov    %cl,(%ebx)
+  51:	84 c9                	test   %cl,%cl
+  53:	75 ed                	jne    42 <strcpy+0xd>
+    ;
+  return os;
+}
+  55:	89 f0                	mov    %esi,%eax
+  57:	5b                   	pop    %ebx
+  58:	5e                   	pop    %esi
+  59:	5d                   	pop    %ebp
+  5a:	c3                   	ret
+
+0000005b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  5b:	55                   	push   %ebp
+  5c:	89 e5                	mov    %esp,%ebp
+  5e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  61:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+  64:	eb 06                	jmp    6c <strcmp+0x11>
+    p++, q++;
+  66:	83 c1 01             	add    $0x1,%ecx
+  69:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+  6c:	0f b6 01             	movzbl (%ecx),%eax
+  6f:	84 c0                	test   %al,%al
+  71:	74 04                	je     77 <strcmp+0x1c>
+  73:	3a 02                	cmp    (%edx),%al
+  75:	74 ef                	je     66 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+  77:	0f b6 c0             	movzbl %al,%eax
+  7a:	0f b6 12             	movzbl (%edx),%edx
+  7d:	29 d0                	sub    %edx,%eax
+}
+  7f:	5d                   	pop    %ebp
+  80:	c3                   	ret
+
+00000081 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  81:	55                   	push   %ebp
+  82:	89 e5                	mov    %esp,%ebp
+  84:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  87:	b8 00 00 00 00       	mov    $0x0,%eax
+  8c:	eb 03                	jmp    91 <strlen+0x10>
+  8e:	83 c0 01             	add    $0x1,%eax
+  91:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  95:	75 f7                	jne    8e <strlen+0xd>
+    ;
+  return n;
+}
+  97:	5d                   	pop    %ebp
+  98:	c3                   	ret
+
+00000099 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  99:	55                   	push   %ebp
+  9a:	89 e5                	mov    %esp,%ebp
+  9c:	57                   	push   %edi
+  9d:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  a0:	89 d7                	mov    %edx,%edi
+  a2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  a8:	fc                   	cld
+  a9:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  ab:	89 d0                	mov    %edx,%eax
+  ad:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  b0:	c9                   	leave
+  b1:	c3                   	ret
+
+000000b2 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  b2:	55                   	push   %ebp
+  b3:	89 e5                	mov    %esp,%ebp
+  b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  b8:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+  bc:	eb 03                	jmp    c1 <strchr+0xf>
+  be:	83 c0 01             	add    $0x1,%eax
+  c1:	0f b6 10             	movzbl (%eax),%edx
+  c4:	84 d2                	test   %dl,%dl
+  c6:	74 06                	je     ce <strchr+0x1c>
+    if(*s == c)
+  c8:	38 ca                	cmp    %cl,%dl
+  ca:	75 f2                	jne    be <strchr+0xc>
+  cc:	eb 05                	jmp    d3 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  ce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  d3:	5d                   	pop    %ebp
+  d4:	c3                   	ret
+
+000000d5 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+  d5:	55                   	push   %ebp
+  d6:	89 e5                	mov    %esp,%ebp
+  d8:	57                   	push   %edi
+  d9:	56                   	push   %esi
+  da:	53                   	push   %ebx
+  db:	83 ec 1c             	sub    $0x1c,%esp
+  de:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+  e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  e6:	89 de                	mov    %ebx,%esi
+  e8:	83 c3 01             	add    $0x1,%ebx
+  eb:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+  ee:	7d 2e                	jge    11e <gets+0x49>
+    cc = read(0, &c, 1);
+  f0:	83 ec 04             	sub    $0x4,%esp
+  f3:	6a 01                	push   $0x1
+  f5:	8d 45 e7             	lea    -0x19(%ebp),%eax
+  f8:	50                   	push   %eax
+  f9:	6a 00                	push   $0x0
+  fb:	e8 ec 00 00 00       	call   1ec <read>
+    if(cc < 1)
+ 100:	83 c4 10             	add    $0x10,%esp
+ 103:	85 c0                	test   %eax,%eax
+ 105:	7e 17                	jle    11e <gets+0x49>
+      break;
+    buf[i++] = c;
+ 107:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 10b:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 10e:	3c 0a                	cmp    $0xa,%al
+ 110:	0f 94 c2             	sete   %dl
+ 113:	3c 0d                	cmp    $0xd,%al
+ 115:	0f 94 c0             	sete   %al
+ 118:	08 c2                	or     %al,%dl
+ 11a:	74 ca                	je     e6 <gets+0x11>
+    buf[i++] = c;
+ 11c:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 11e:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 122:	89 f8                	mov    %edi,%eax
+ 124:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 127:	5b                   	pop    %ebx
+ 128:	5e                   	pop    %esi
+ 129:	5f                   	pop    %edi
+ 12a:	5d                   	pop    %ebp
+ 12b:	c3                   	ret
+
+0000012c <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 12c:	55                   	push   %ebp
+ 12d:	89 e5                	mov    %esp,%ebp
+ 12f:	56                   	push   %esi
+ 130:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 131:	83 ec 08             	sub    $0x8,%esp
+ 134:	6a 00                	push   $0x0
+ 136:	ff 75 08             	push   0x8(%ebp)
+ 139:	e8 d6 00 00 00       	call   214 <open>
+  if(fd < 0)
+ 13e:	83 c4 10             	add    $0x10,%esp
+ 141:	85 c0                	test   %eax,%eax
+ 143:	78 24                	js     169 <stat+0x3d>
+ 145:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 147:	83 ec 08             	sub    $0x8,%esp
+ 14a:	ff 75 0c             	push   0xc(%ebp)
+ 14d:	50                   	push   %eax
+ 14e:	e8 d9 00 00 00       	call   22c <fstat>
+ 153:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 155:	89 1c 24             	mov    %ebx,(%esp)
+ 158:	e8 9f 00 00 00       	call   1fc <close>
+  return r;
+ 15d:	83 c4 10             	add    $0x10,%esp
+}
+ 160:	89 f0                	mov    %esi,%eax
+ 162:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 165:	5b                   	pop    %ebx
+ 166:	5e                   	pop    %esi
+ 167:	5d                   	pop    %ebp
+ 168:	c3                   	ret
+    return -1;
+ 169:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 16e:	eb f0                	jmp    160 <stat+0x34>
+
+00000170 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 170:	55                   	push   %ebp
+ 171:	89 e5                	mov    %esp,%ebp
+ 173:	53                   	push   %ebx
+ 174:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+ 177:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+ 17c:	eb 10                	jmp    18e <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+ 17e:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+ 181:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+ 184:	83 c1 01             	add    $0x1,%ecx
+ 187:	0f be c0             	movsbl %al,%eax
+ 18a:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+ 18e:	0f b6 01             	movzbl (%ecx),%eax
+ 191:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 194:	80 fb 09             	cmp    $0x9,%bl
+ 197:	76 e5                	jbe    17e <atoi+0xe>
+  return n;
+}
+ 199:	89 d0                	mov    %edx,%eax
+ 19b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 19e:	c9                   	leave
+ 19f:	c3                   	ret
+
+000001a0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	56                   	push   %esi
+ 1a4:	53                   	push   %ebx
+ 1a5:	8b 75 08             	mov    0x8(%ebp),%esi
+ 1a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 1ab:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 1ae:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 1b0:	eb 0d                	jmp    1bf <memmove+0x1f>
+    *dst++ = *src++;
+ 1b2:	0f b6 01             	movzbl (%ecx),%eax
+ 1b5:	88 02                	mov    %al,(%edx)
+ 1b7:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 1ba:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 1bd:	89 d8                	mov    %ebx,%eax
+ 1bf:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 1c2:	85 c0                	test   %eax,%eax
+ 1c4:	7f ec                	jg     1b2 <memmove+0x12>
+  return vdst;
+}
+ 1c6:	89 f0                	mov    %esi,%eax
+ 1c8:	5b                   	pop    %ebx
+ 1c9:	5e                   	pop    %esi
+ 1ca:	5d                   	pop    %ebp
+ 1cb:	c3                   	ret
+
+000001cc <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 1cc:	b8 01 00 00 00       	mov    $0x1,%eax
+ 1d1:	cd 40                	int    $0x40
+ 1d3:	c3                   	ret
+
+000001d4 <exit>:
+SYSCALL(exit)
+ 1d4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 1d9:	cd 40                	int    $0x40
+ 1db:	c3                   	ret
+
+000001dc <wait>:
+SYSCALL(wait)
+ 1dc:	b8 03 00 00 00       	mov    $0x3,%eax
+ 1e1:	cd 40                	int    $0x40
+ 1e3:	c3                   	ret
+
+000001e4 <pipe>:
+SYSCALL(pipe)
+ 1e4:	b8 04 00 00 00       	mov    $0x4,%eax
+ 1e9:	cd 40                	int    $0x40
+ 1eb:	c3                   	ret
+
+000001ec <read>:
+SYSCALL(read)
+ 1ec:	b8 05 00 00 00       	mov    $0x5,%eax
+ 1f1:	cd 40                	int    $0x40
+ 1f3:	c3                   	ret
+
+000001f4 <write>:
+SYSCALL(write)
+ 1f4:	b8 10 00 00 00       	mov    $0x10,%eax
+ 1f9:	cd 40                	int    $0x40
+ 1fb:	c3                   	ret
+
+000001fc <close>:
+SYSCALL(close)
+ 1fc:	b8 15 00 00 00       	mov    $0x15,%eax
+ 201:	cd 40                	int    $0x40
+ 203:	c3                   	ret
+
+00000204 <kill>:
+SYSCALL(kill)
+ 204:	b8 06 00 00 00       	mov    $0x6,%eax
+ 209:	cd 40                	int    $0x40
+ 20b:	c3                   	ret
+
+0000020c <exec>:
+SYSCALL(exec)
+ 20c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 211:	cd 40                	int    $0x40
+ 213:	c3                   	ret
+
+00000214 <open>:
+SYSCALL(open)
+ 214:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 219:	cd 40                	int    $0x40
+ 21b:	c3                   	ret
+
+0000021c <mknod>:
+SYSCALL(mknod)
+ 21c:	b8 11 00 00 00       	mov    $0x11,%eax
+ 221:	cd 40                	int    $0x40
+ 223:	c3                   	ret
+
+00000224 <unlink>:
+SYSCALL(unlink)
+ 224:	b8 12 00 00 00       	mov    $0x12,%eax
+ 229:	cd 40                	int    $0x40
+ 22b:	c3                   	ret
+
+0000022c <fstat>:
+SYSCALL(fstat)
+ 22c:	b8 08 00 00 00       	mov    $0x8,%eax
+ 231:	cd 40                	int    $0x40
+ 233:	c3                   	ret
+
+00000234 <link>:
+SYSCALL(link)
+ 234:	b8 13 00 00 00       	mov    $0x13,%eax
+ 239:	cd 40                	int    $0x40
+ 23b:	c3                   	ret
+
+0000023c <mkdir>:
+SYSCALL(mkdir)
+ 23c:	b8 14 00 00 00       	mov    $0x14,%eax
+ 241:	cd 40                	int    $0x40
+ 243:	c3                   	ret
+
+00000244 <chdir>:
+SYSCALL(chdir)
+ 244:	b8 09 00 00 00       	mov    $0x9,%eax
+ 249:	cd 40                	int    $0x40
+ 24b:	c3                   	ret
+
+0000024c <dup>:
+SYSCALL(dup)
+ 24c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 251:	cd 40                	int    $0x40
+ 253:	c3                   	ret
+
+00000254 <getpid>:
+SYSCALL(getpid)
+ 254:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 259:	cd 40                	int    $0x40
+ 25b:	c3                   	ret
+
+0000025c <sbrk>:
+SYSCALL(sbrk)
+ 25c:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 261:	cd 40                	int    $0x40
+ 263:	c3                   	ret
+
+00000264 <sleep>:
+SYSCALL(sleep)
+ 264:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 269:	cd 40                	int    $0x40
+ 26b:	c3                   	ret
+
+0000026c <uptime>:
+SYSCALL(uptime)
+ 26c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 271:	cd 40                	int    $0x40
+ 273:	c3                   	ret
+
+00000274 <setpri>:
+SYSCALL(setpri)
+ 274:	b8 16 00 00 00       	mov    $0x16,%eax
+ 279:	cd 40                	int    $0x40
+ 27b:	c3                   	ret
+
+0000027c <getpri>:
+SYSCALL(getpri)
+ 27c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 281:	cd 40                	int    $0x40
+ 283:	c3                   	ret
+
+00000284 <fork2>:
+SYSCALL(fork2)
+ 284:	b8 18 00 00 00       	mov    $0x18,%eax
+ 289:	cd 40                	int    $0x40
+ 28b:	c3                   	ret
+
+0000028c <getpinfo>:
+SYSCALL(getpinfo)
+ 28c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 291:	cd 40                	int    $0x40
+ 293:	c3                   	ret
+
+00000294 <spawn>:
+SYSCALL(spawn)
+ 294:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 299:	cd 40                	int    $0x40
+ 29b:	c3                   	ret
+
+0000029c <spawnn>:
+SYSCALL(spawnn)
+ 29c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 2a1:	cd 40                	int    $0x40
+ 2a3:	c3                   	ret
+
+000002a4 <kmstat>:
+SYSCALL(kmstat)
+ 2a4:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 2a9:	cd 40                	int    $0x40
+ 2ab:	c3                   	ret
+
+000002ac <slabstat>:
+SYSCALL(slabstat)
+ 2ac:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 2b1:	cd 40                	int    $0x40
+ 2b3:	c3                   	ret
+
+000002b4 <shmget>:
+SYSCALL(shmget)
+ 2b4:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 2b9:	cd 40                	int    $0x40
+ 2bb:	c3                   	ret
+
+000002bc <shmat>:
+SYSCALL(shmat)
+ 2bc:	b8 20 00 00 00       	mov    $0x20,%eax
+ 2c1:	cd 40                	int    $0x40
+ 2c3:	c3                   	ret
+
+000002c4 <shmdt>:
+SYSCALL(shmdt)
+ 2c4:	b8 21 00 00 00       	mov    $0x21,%eax
+ 2c9:	cd 40                	int    $0x40
+ 2cb:	c3                   	ret
+
+000002cc <mmap>:
+SYSCALL(mmap)
+ 2cc:	b8 22 00 00 00       	mov    $0x22,%eax
+ 2d1:	cd 40                	int    $0x40
+ 2d3:	c3                   	ret
+
+000002d4 <munmap>:
+SYSCALL(munmap)
+ 2d4:	b8 23 00 00 00       	mov    $0x23,%eax
+ 2d9:	cd 40                	int    $0x40
+ 2db:	c3                   	ret
+
+000002dc <bstat>:
+SYSCALL(bstat)
+ 2dc:	b8 24 00 00 00       	mov    $0x24,%eax
+ 2e1:	cd 40                	int    $0x40
+ 2e3:	c3                   	ret
+
+000002e4 <aread>:
+SYSCALL(aread)
+ 2e4:	b8 25 00 00 00       	mov    $0x25,%eax
+ 2e9:	cd 40                	int    $0x40
+ 2eb:	c3                   	ret
+
+000002ec <await>:
+SYSCALL(await)
+ 2ec:	b8 26 00 00 00       	mov    $0x26,%eax
+ 2f1:	cd 40                	int    $0x40
+ 2f3:	c3                   	ret
+
+000002f4 <bdrop>:
+SYSCALL(bdrop)
+ 2f4:	b8 27 00 00 00       	mov    $0x27,%eax
+ 2f9:	cd 40                	int    $0x40
+ 2fb:	c3                   	ret
+
+000002fc <vfork>:
+# exec or exit, and its ret would leave the slot holding our
+# return address free for it to overwrite.  Keep the return
+# address in %ecx, which the kernel restores for both sides.
+.globl vfork
+vfork:
+  popl %ecx
+ 2fc:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+ 2fd:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  int $T_SYSCALL
+ 302:	cd 40                	int    $0x40
+  pushl %ecx
+ 304:	51                   	push   %ecx
+  ret
+ 305:	c3                   	ret
+
+00000306 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 306:	55                   	push   %ebp
+ 307:	89 e5                	mov    %esp,%ebp
+ 309:	83 ec 1c             	sub    $0x1c,%esp
+ 30c:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 30f:	6a 01                	push   $0x1
+ 311:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 314:	52                   	push   %edx
+ 315:	50                   	push   %eax
+ 316:	e8 d9 fe ff ff       	call   1f4 <write>
+}
+ 31b:	83 c4 10             	add    $0x10,%esp
+ 31e:	c9                   	leave
+ 31f:	c3                   	ret
+
+00000320 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	57                   	push   %edi
+ 324:	56                   	push   %esi
+ 325:	53                   	push   %ebx
+ 326:	83 ec 2c             	sub    $0x2c,%esp
+ 329:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 32c:	89 d0                	mov    %edx,%eax
+ 32e:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 330:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 334:	0f 95 c1             	setne  %cl
+ 337:	c1 ea 1f             	shr    $0x1f,%edx
+ 33a:	84 d1                	test   %dl,%cl
+ 33c:	74 44                	je     382 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 33e:	f7 d8                	neg    %eax
+ 340:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 342:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 349:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 34e:	89 c8                	mov    %ecx,%eax
+ 350:	ba 00 00 00 00       	mov    $0x0,%edx
+ 355:	f7 f6                	div    %esi
+ 357:	89 df                	mov    %ebx,%edi
+ 359:	83 c3 01             	add    $0x1,%ebx
+ 35c:	0f b6 92 bc 06 00 00 	movzbl 0x6bc(%edx),%edx
+ 363:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 367:	89 ca                	mov    %ecx,%edx
+ 369:	89 c1                	mov    %eax,%ecx
+ 36b:	39 f2                	cmp    %esi,%edx
+ 36d:	73 df                	jae    34e <printint+0x2e>
+  if(neg)
+ 36f:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 373:	74 31                	je     3a6 <printint+0x86>
+    buf[i++] = '-';
+ 375:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 37a:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 37d:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 380:	eb 17                	jmp    399 <printint+0x79>
+    x = xx;
+ 382:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 384:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 38b:	eb bc                	jmp    349 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 38d:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 392:	89 f0                	mov    %esi,%eax
+ 394:	e8 6d ff ff ff       	call   306 <putc>
+  while(--i >= 0)
+ 399:	83 eb 01             	sub    $0x1,%ebx
+ 39c:	79 ef                	jns    38d <printint+0x6d>
+}
+ 39e:	83 c4 2c             	add    $0x2c,%esp
+ 3a1:	5b                   	pop    %ebx
+ 3a2:	5e                   	pop    %esi
+ 3a3:	5f                   	pop    %edi
+ 3a4:	5d                   	pop    %ebp
+ 3a5:	c3                   	ret
+ 3a6:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 3a9:	eb ee                	jmp    399 <printint+0x79>
+
+000003ab <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 3ab:	55                   	push   %ebp
+ 3ac:	89 e5                	mov    %esp,%ebp
+ 3ae:	57                   	push   %edi
+ 3af:	56                   	push   %esi
+ 3b0:	53                   	push   %ebx
+ 3b1:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 3b4:	8d 45 10             	lea    0x10(%ebp),%eax
+ 3b7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 3ba:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 3bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 3c4:	eb 14                	jmp    3da <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 3c6:	89 fa                	mov    %edi,%edx
+ 3c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3cb:	e8 36 ff ff ff       	call   306 <putc>
+ 3d0:	eb 05                	jmp    3d7 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 3d2:	83 fe 25             	cmp    $0x25,%esi
+ 3d5:	74 25                	je     3fc <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 3d7:	83 c3 01             	add    $0x1,%ebx
+ 3da:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3dd:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 3e1:	84 c0                	test   %al,%al
+ 3e3:	0f 84 20 01 00 00    	je     509 <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 3e9:	0f be f8             	movsbl %al,%edi
+ 3ec:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 3ef:	85 f6                	test   %esi,%esi
+ 3f1:	75 df                	jne    3d2 <printf+0x27>
+      if(c == '%'){
+ 3f3:	83 f8 25             	cmp    $0x25,%eax
+ 3f6:	75 ce                	jne    3c6 <printf+0x1b>
+        state = '%';
+ 3f8:	89 c6                	mov    %eax,%esi
+ 3fa:	eb db                	jmp    3d7 <printf+0x2c>
+      if(c == 'd'){
+ 3fc:	83 f8 25             	cmp    $0x25,%eax
+ 3ff:	0f 84 cf 00 00 00    	je     4d4 <printf+0x129>
+ 405:	0f 8c dd 00 00 00    	jl     4e8 <printf+0x13d>
+ 40b:	83 f8 78             	cmp    $0x78,%eax
+ 40e:	0f 8f d4 00 00 00    	jg     4e8 <printf+0x13d>
+ 414:	83 f8 63             	cmp    $0x63,%eax
+ 417:	0f 8c cb 00 00 00    	jl     4e8 <printf+0x13d>
+ 41d:	83 e8 63             	sub    $0x63,%eax
+ 420:	83 f8 15             	cmp    $0x15,%eax
+ 423:	0f 87 bf 00 00 00    	ja     4e8 <printf+0x13d>
+ 429:	ff 24 85 64 06 00 00 	jmp    *0x664(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 430:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 433:	8b 17                	mov    (%edi),%edx
+ 435:	83 ec 0c             	sub    $0xc,%esp
+ 438:	6a 01                	push   $0x1
+ 43a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 43f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 442:	e8 d9 fe ff ff       	call   320 <printint>
+        ap++;
+ 447:	83 c7 04             	add    $0x4,%edi
+ 44a:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 44d:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 450:	be 00 00 00 00       	mov    $0x0,%esi
+ 455:	eb 80                	jmp    3d7 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 457:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 45a:	8b 17                	mov    (%edi),%edx
+ 45c:	83 ec 0c             	sub    $0xc,%esp
+ 45f:	6a 00                	push   $0x0
+ 461:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 466:	8b 45 08             	mov    0x8(%ebp),%eax
+ 469:	e8 b2 fe ff ff       	call   320 <printint>
+        ap++;
+ 46e:	83 c7 04             	add    $0x4,%edi
+ 471:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 474:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 477:	be 00 00 00 00       	mov    $0x0,%esi
+ 47c:	e9 56 ff ff ff       	jmp    3d7 <printf+0x2c>
+        s = (char*)*ap;
+ 481:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 484:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 486:	83 c0 04             	add    $0x4,%eax
+ 489:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 48c:	85 f6                	test   %esi,%esi
+ 48e:	75 15                	jne    4a5 <printf+0xfa>
+          s = "(null)";
+ 490:	be 5c 06 00 00       	mov    $0x65c,%esi
+ 495:	eb 0e                	jmp    4a5 <printf+0xfa>
+          putc(fd, *s);
+ 497:	0f be d2             	movsbl %dl,%edx
+ 49a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 49d:	e8 64 fe ff ff       	call   306 <putc>
+          s++;
+ 4a2:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 4a5:	0f b6 16             	movzbl (%esi),%edx
+ 4a8:	84 d2                	test   %dl,%dl
+ 4aa:	75 eb                	jne    497 <printf+0xec>
+      state = 0;
+ 4ac:	be 00 00 00 00       	mov    $0x0,%esi
+ 4b1:	e9 21 ff ff ff       	jmp    3d7 <printf+0x2c>
+        putc(fd, *ap);
+ 4b6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 4b9:	0f be 17             	movsbl (%edi),%edx
+ 4bc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4bf:	e8 42 fe ff ff       	call   306 <putc>
+        ap++;
+ 4c4:	83 c7 04             	add    $0x4,%edi
+ 4c7:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 4ca:	be 00 00 00 00       	mov    $0x0,%esi
+ 4cf:	e9 03 ff ff ff       	jmp    3d7 <printf+0x2c>
+        putc(fd, c);
+ 4d4:	89 fa                	mov    %edi,%edx
+ 4d6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4d9:	e8 28 fe ff ff       	call   306 <putc>
+      state = 0;
+ 4de:	be 00 00 00 00       	mov    $0x0,%esi
+ 4e3:	e9 ef fe ff ff       	jmp    3d7 <printf+0x2c>
+        putc(fd, '%');
+ 4e8:	ba 25 00 00 00       	mov    $0x25,%edx
+ 4ed:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4f0:	e8 11 fe ff ff       	call   306 <putc>
+        putc(fd, c);
+ 4f5:	89 fa                	mov    %edi,%edx
+ 4f7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4fa:	e8 07 fe ff ff       	call   306 <putc>
+      state = 0;
+ 4ff:	be 00 00 00 00       	mov    $0x0,%esi
+ 504:	e9 ce fe ff ff       	jmp    3d7 <printf+0x2c>
+    }
+  }
+}
+ 509:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 50c:	5b                   	pop    %ebx
+ 50d:	5e                   	pop    %esi
+ 50e:	5f                   	pop    %edi
+ 50f:	5d                   	pop    %ebp
+ 510:	c3                   	ret
+
+00000511 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 511:	55                   	push   %ebp
+ 512:	89 e5                	mov    %esp,%ebp
+ 514:	57                   	push   %edi
+ 515:	56                   	push   %esi
+ 516:	53                   	push   %ebx
+ 517:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 51a:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 51d:	a1 5c 09 00 00       	mov    0x95c,%eax
+ 522:	eb 02                	jmp    526 <free+0x15>
+ 524:	89 d0                	mov    %edx,%eax
+ 526:	39 c8                	cmp    %ecx,%eax
+ 528:	73 04                	jae    52e <free+0x1d>
+ 52a:	3b 08                	cmp    (%eax),%ecx
+ 52c:	72 12                	jb     540 <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 52e:	8b 10                	mov    (%eax),%edx
+ 530:	39 d0                	cmp    %edx,%eax
+ 532:	72 f0                	jb     524 <free+0x13>
+ 534:	39 c8                	cmp    %ecx,%eax
+ 536:	72 08                	jb     540 <free+0x2f>
+ 538:	39 d1                	cmp    %edx,%ecx
+ 53a:	72 04                	jb     540 <free+0x2f>
+ 53c:	89 d0                	mov    %edx,%eax
+ 53e:	eb e6                	jmp    526 <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 540:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 543:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 546:	8b 10                	mov    (%eax),%edx
+ 548:	39 d7                	cmp    %edx,%edi
+ 54a:	74 19                	je     565 <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 54c:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 54f:	8b 50 04             	mov    0x4(%eax),%edx
+ 552:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 555:	39 ce                	cmp    %ecx,%esi
+ 557:	74 1b                	je     574 <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 559:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 55b:	a3 5c 09 00 00       	mov    %eax,0x95c
+}
+ 560:	5b                   	pop    %ebx
+ 561:	5e                   	pop    %esi
+ 562:	5f                   	pop    %edi
+ 563:	5d                   	pop    %ebp
+ 564:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 565:	03 72 04             	add    0x4(%edx),%esi
+ 568:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 56b:	8b 10                	mov    (%eax),%edx
+ 56d:	8b 12                	mov    (%edx),%edx
+ 56f:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 572:	eb db                	jmp    54f <free+0x3e>
+    p->s.size += bp->s.size;
+ 574:	03 53 fc             	add    -0x4(%ebx),%edx
+ 577:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 57a:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 57d:	89 10                	mov    %edx,(%eax)
+ 57f:	eb da                	jmp    55b <free+0x4a>
+
+00000581 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 581:	55                   	push   %ebp
+ 582:	89 e5                	mov    %esp,%ebp
+ 584:	53                   	push   %ebx
+ 585:	83 ec 04             	sub    $0x4,%esp
+ 588:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 58a:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 58f:	77 05                	ja     596 <morecore+0x15>
+    nu = 4096;
+ 591:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 596:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 59d:	83 ec 0c             	sub    $0xc,%esp
+ 5a0:	50                   	push   %eax
+ 5a1:	e8 b6 fc ff ff       	call   25c <sbrk>
+  if(p == (char*)-1)
+ 5a6:	83 c4 10             	add    $0x10,%esp
+ 5a9:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 5ac:	74 1c                	je     5ca <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 5ae:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 5b1:	83 c0 08             	add    $0x8,%eax
+ 5b4:	83 ec 0c             	sub    $0xc,%esp
+ 5b7:	50                   	push   %eax
+ 5b8:	e8 54 ff ff ff       	call   511 <free>
+  return freep;
+ 5bd:	a1 5c 09 00 00       	mov    0x95c,%eax
+ 5c2:	83 c4 10             	add    $0x10,%esp
+}
+ 5c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5c8:	c9                   	leave
+ 5c9:	c3                   	ret
+    return 0;
+ 5ca:	b8 00 00 00 00       	mov    $0x0,%eax
+ 5cf:	eb f4                	jmp    5c5 <morecore+0x44>
+
+000005d1 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 5d1:	55                   	push   %ebp
+ 5d2:	89 e5                	mov    %esp,%ebp
+ 5d4:	53                   	push   %ebx
+ 5d5:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 5d8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5db:	8d 58 07             	lea    0x7(%eax),%ebx
+ 5de:	c1 eb 03             	shr    $0x3,%ebx
+ 5e1:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 5e4:	8b 0d 5c 09 00 00    	mov    0x95c,%ecx
+ 5ea:	85 c9                	test   %ecx,%ecx
+ 5ec:	74 04                	je     5f2 <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 5ee:	8b 01                	mov    (%ecx),%eax
+ 5f0:	eb 4a                	jmp    63c <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 5f2:	c7 05 5c 09 00 00 60 	movl   $0x960,0x95c
+ 5f9:	09 00 00 
+ 5fc:	c7 05 60 09 00 00 60 	movl   $0x960,0x960
+ 603:	09 00 00 
+    base.s.size = 0;
+ 606:	c7 05 64 09 00 00 00 	movl   $0x0,0x964
+ 60d:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 610:	b9 60 09 00 00       	mov    $0x960,%ecx
+ 615:	eb d7                	jmp    5ee <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 617:	74 19                	je     632 <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 619:	29 da                	sub    %ebx,%edx
+ 61b:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 61e:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 621:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 624:	89 0d 5c 09 00 00    	mov    %ecx,0x95c
+      return (void*)(p + 1);
+ 62a:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 62d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 630:	c9                   	leave
+ 631:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 632:	8b 10                	mov    (%eax),%edx
+ 634:	89 11                	mov    %edx,(%ecx)
+ 636:	eb ec                	jmp    624 <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 638:	89 c1                	mov    %eax,%ecx
+ 63a:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 63c:	8b 50 04             	mov    0x4(%eax),%edx
+ 63f:	39 da                	cmp    %ebx,%edx
+ 641:	73 d4                	jae    617 <malloc+0x46>
+    if(p == freep)
+ 643:	39 05 5c 09 00 00    	cmp    %eax,0x95c
+ 649:	75 ed                	jne    638 <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 64b:	89 d8                	mov    %ebx,%eax
+ 64d:	e8 2f ff ff ff       	call   581 <morecore>
+ 652:	85 c0                	test   %eax,%eax
+ 654:	75 e2                	jne    638 <malloc+0x67>
+ 656:	eb d5                	jmp    62d <malloc+0x5c>
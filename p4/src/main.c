@@ -28,11 +28,15 @@ main(void)
   uartinit();      // serial port
   pinit();         // process table
   tvinit();        // trap vectors
+  kmcacheinit();   // slab allocator
   binit();         // buffer cache
+  pcinit();        // executable page cache
   fileinit();      // file table
+  pipeinit();      // pipes
+  shminit();       // shared memory segments
   ideinit();       // disk 
   startothers();   // start other processors
-  kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+  kinit2(P2V(4*1024*1024), P2V(phystop)); // must come after startothers()
   userinit();      // first user process
   mpmain();        // finish this processor's setup
 }
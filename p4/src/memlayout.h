@@ -1,10 +1,13 @@
 // Memory layout
 
 #define EXTMEM  0x100000            // Start of extended memory
-#define PHYSTOP 0xE000000           // Top physical memory
+#define PHYSMAX 0x7E000000          // Most physical memory the kernel uses;
+                                    // the actual top (phystop) is detected
 #define DEVSPACE 0xFE000000         // Other devices are at high addresses
 
 // Key addresses for address space layout (see kmap in vm.c for layout)
+#define UMAPBASE 0x60000000         // Shared mappings live in UMAPBASE..KERNBASE;
+                                    // the heap must stay below
 #define KERNBASE 0x80000000         // First kernel virtual address
 #define KERNLINK (KERNBASE+EXTMEM)  // Address where kernel is linked
 
@@ -0,0 +1,85 @@
+// Memory-mapped files.
+//
+// mmap() records a region of a file as a vma above the heap;
+// pages are read in by pagefault() when first touched, like
+// program text, sharing the executable page cache's pages
+// copy-on-write.  Writes to a private mapping stay in memory.
+// Shared writable mappings are refused: file reads and writes
+// go through the buffer cache, not these pages, so there is
+// no way to keep such a mapping coherent with them.  A shared
+// read-only mapping is the same as a private one.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
+#include "stat.h"
+#include "fs.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "file.h"
+#include "fcntl.h"
+
+// Map len bytes of f starting at offset off, which must be
+// page-aligned and lie within the file.  Returns the address
+// of the mapping, or -1.
+int
+mmap(struct file *f, uint off, uint len, int prot, int flags)
+{
+  struct proc *curproc = myproc();
+  struct vma *v;
+  uint va;
+  int bad;
+
+  // A vfork child's page table belongs to its parent.
+  if(curproc->borrowed || f->type != FD_INODE || !f->readable)
+    return -1;
+  // Exactly one of MAP_SHARED and MAP_PRIVATE.
+  if(!(prot & PROT_READ) || !(flags & MAP_SHARED) == !(flags & MAP_PRIVATE))
+    return -1;
+  if((prot & PROT_WRITE) && (flags & MAP_SHARED))
+    return -1;
+  if(len == 0 || off % PGSIZE != 0 || off + len < off)
+    return -1;
+  ilock(f->ip);
+  bad = f->ip->type != T_FILE || off + len > f->ip->size;
+  iunlock(f->ip);
+  if(bad)
+    return -1;
+
+  if((va = vmagap(curproc->vma, len)) == 0 || (v = vmaslot(curproc->vma)) == 0)
+    return -1;
+  v->start = va;
+  v->len = len;
+  v->off = off;
+  v->flags = VMA_MMAP;
+  if(prot & PROT_WRITE)
+    v->flags |= VMA_WRITE;
+  v->ip = idup(f->ip);
+  return va;
+}
+
+// Remove the mapping that mmap() placed at addr, which must
+// be len bytes long, give or take the last page.
+int
+munmap(uint addr, uint len)
+{
+  struct proc *curproc = myproc();
+  struct vma *v;
+
+  if(curproc->borrowed)
+    return -1;
+  for(v = curproc->vma; v < &curproc->vma[NVMA]; v++)
+    if(v->ip && (v->flags & VMA_MMAP) && v->start == addr)
+      break;
+  if(v == &curproc->vma[NVMA] || PGROUNDUP(len) != PGROUNDUP(v->len))
+    return -1;
+  deallocuvm(curproc->pgdir, PGROUNDUP(v->start + v->len), v->start);
+  begin_op();
+  iput(v->ip);
+  end_op();
+  v->ip = 0;
+  v->flags = 0;
+  return 0;
+}
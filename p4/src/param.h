@@ -2,13 +2,23 @@
 #define KSTACKSIZE 4096  // size of per-process kernel stack
 #define NCPU          8  // maximum number of CPUs
 #define NOFILE       16  // open files per process
-#define NFILE       100  // open files per system
 #define NINODE       50  // maximum number of active i-nodes
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
 #define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
+#define NBUF         (LOGSIZE*4)  // minimum size of disk block cache
+#define MAXNBUF    4096  // maximum size of disk block cache
+#define RAMAX        32  // maximum read-ahead window in blocks
 #define FSSIZE       1000  // size of file system in blocks
 #define NLAYER        4     // number of layers in priority queue
+#define NVMA         16  // file-backed memory regions per process
+#define NPGCACHE    128  // size of executable page cache
+#define MAXORDER     10  // largest physical block is 2^MAXORDER pages
+#define NKMCACHE      8  // maximum number of slab caches
+#define NSHM         16  // shared memory segments per system
+#define SHMMAXPG    256  // pages per shared memory segment
+#define SHMNAME      16  // length of a shared memory segment name
+#define NAIO          8  // asynchronous reads per process
+#define NAIOBLK      16  // most blocks one asynchronous read may span
@@ -0,0 +1,80 @@
+// PCI configuration space access, using configuration
+// mechanism #1 (ports 0xCF8 and 0xCFC).  Just enough for
+// drivers to find their controller on bus 0 and read and set
+// its registers.
+//
+// A device is named by a tag, (bus<<16)|(dev<<11)|(func<<8),
+// as it appears in the configuration address.
+
+#include "types.h"
+#include "defs.h"
+#include "x86.h"
+
+#define PCI_CONFADDR  0xCF8
+#define PCI_CONFDATA  0xCFC
+
+#define PCI_ID        0x00   // device and vendor IDs
+#define PCI_CLASS     0x08   // class, subclass, prog IF, revision
+#define PCI_HEADER    0x0C   // header type in bits 16-23
+
+uint
+pciread(uint tag, int reg)
+{
+  outl(PCI_CONFADDR, 0x80000000 | tag | (reg & 0xFC));
+  return inl(PCI_CONFDATA);
+}
+
+void
+pciwrite(uint tag, int reg, uint v)
+{
+  outl(PCI_CONFADDR, 0x80000000 | tag | (reg & 0xFC));
+  outl(PCI_CONFDATA, v);
+}
+
+// Return the tag of the first device on bus 0 for which
+// match(tag, arg) is true, or -1 if there is none.
+static int
+pciscan(int (*match)(uint, uint), uint arg)
+{
+  uint dev, func, nfunc, tag;
+
+  for(dev = 0; dev < 32; dev++){
+    nfunc = 1;
+    for(func = 0; func < nfunc; func++){
+      tag = (dev<<11) | (func<<8);
+      if((pciread(tag, PCI_ID) & 0xFFFF) == 0xFFFF)
+        continue;
+      if(func == 0 && (pciread(tag, PCI_HEADER) & 0x800000))
+        nfunc = 8;   // multi-function device
+      if(match(tag, arg))
+        return tag;
+    }
+  }
+  return -1;
+}
+
+static int
+matchid(uint tag, uint id)
+{
+  return pciread(tag, PCI_ID) == id;
+}
+
+static int
+matchclass(uint tag, uint class)
+{
+  return (pciread(tag, PCI_CLASS) >> 16) == class;
+}
+
+// Find a device by vendor and device ID.
+int
+pcifindid(ushort vendor, ushort device)
+{
+  return pciscan(matchid, ((uint)device << 16) | vendor);
+}
+
+// Find a device by class and subclass.
+int
+pcifindclass(uchar class, uchar subclass)
+{
+  return pciscan(matchclass, ((uint)class << 8) | subclass);
+}
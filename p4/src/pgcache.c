@@ -0,0 +1,142 @@
+// Executable page cache.
+//
+// Processes running the same program share the pages of its
+// segments instead of each reading a private copy.  The cache
+// holds one reference (see kdup) to each page it knows about,
+// keyed by the file and the range of it the page holds, and
+// pagefault() maps cached pages read-only and copy-on-write,
+// so a process that writes to one gets its own copy.
+//
+// Interface:
+// * pcget() returns a referenced page holding part of a file,
+//     reading it only if it isn't cached.
+// * pcinval() must be called when a file's contents change;
+//     processes keep the pages they already have mapped.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+
+struct pcent {
+  uint dev;
+  uint inum;
+  uint off;    // file offset of the page's first byte
+  uint n;      // bytes of file data; the rest is zero
+  char *page;  // 0 if the entry is unused
+};
+
+struct {
+  struct spinlock lock;
+  struct pcent ent[NPGCACHE];
+  int hand;    // next eviction candidate
+} pgcache;
+
+void
+pcinit(void)
+{
+  initlock(&pgcache.lock, "pgcache");
+}
+
+// Look up a page.  Caller must hold pgcache.lock.
+static struct pcent*
+pclookup(uint dev, uint inum, uint off, uint n)
+{
+  struct pcent *e;
+
+  for(e = pgcache.ent; e < &pgcache.ent[NPGCACHE]; e++)
+    if(e->page && e->dev == dev && e->inum == inum &&
+       e->off == off && e->n == n)
+      return e;
+  return 0;
+}
+
+// Choose an entry to reuse, preferring one that is unused or
+// whose page no process has mapped.  Caller must hold
+// pgcache.lock.
+static struct pcent*
+pcvictim(void)
+{
+  struct pcent *e;
+  int i;
+
+  for(i = 0; i < NPGCACHE; i++){
+    e = &pgcache.ent[(pgcache.hand + i) % NPGCACHE];
+    if(e->page == 0 || krefcnt(e->page) == 1){
+      pgcache.hand = (e - pgcache.ent + 1) % NPGCACHE;
+      return e;
+    }
+  }
+  e = &pgcache.ent[pgcache.hand];
+  pgcache.hand = (pgcache.hand + 1) % NPGCACHE;
+  return e;
+}
+
+// Return a page holding n bytes of ip starting at off, followed
+// by zeroes, with a reference for the caller to drop with kfree().
+// Returns 0 if out of memory or the read fails.
+// ip must not be locked by the caller.
+char*
+pcget(struct inode *ip, uint off, uint n)
+{
+  struct pcent *e;
+  char *mem;
+
+  acquire(&pgcache.lock);
+  if((e = pclookup(ip->dev, ip->inum, off, n)) != 0){
+    mem = kdup(e->page);
+    release(&pgcache.lock);
+    return mem;
+  }
+  release(&pgcache.lock);
+
+  if((mem = kalloc_zeroed()) == 0)
+    return 0;
+  ilock(ip);
+  if(readi(ip, mem, off, n) != n){
+    iunlock(ip);
+    kfree(mem);
+    return 0;
+  }
+
+  // Insert before unlocking ip, so that a writei() can't
+  // invalidate the file between our read and the insert.
+  acquire(&pgcache.lock);
+  if((e = pclookup(ip->dev, ip->inum, off, n)) != 0){
+    // Another process read the same page meanwhile.
+    kfree(mem);
+    mem = kdup(e->page);
+  } else {
+    e = pcvictim();
+    if(e->page)
+      kfree(e->page);
+    e->dev = ip->dev;
+    e->inum = ip->inum;
+    e->off = off;
+    e->n = n;
+    e->page = kdup(mem);
+  }
+  release(&pgcache.lock);
+  iunlock(ip);
+  return mem;
+}
+
+// Forget all cached pages of ip, whose contents have changed.
+void
+pcinval(struct inode *ip)
+{
+  struct pcent *e;
+
+  acquire(&pgcache.lock);
+  for(e = pgcache.ent; e < &pgcache.ent[NPGCACHE]; e++){
+    if(e->page && e->dev == ip->dev && e->inum == ip->inum){
+      kfree(e->page);
+      e->page = 0;
+    }
+  }
+  release(&pgcache.lock);
+}
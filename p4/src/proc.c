@@ -127,6 +127,8 @@ found:
       p->qtail[level] = 0;
   }
   p->ticks_thisturn = 0;
+  p->borrowed = 0;
+  p->kthread = 0;
   return p;
 }
 
@@ -173,6 +175,38 @@ userinit(void)
   release(&ptable.lock);
 }
 
+// Start a kernel thread running fn, which must never return.
+// It is an ordinary process with no user memory; forkret
+// returns into fn instead of trapret.
+int
+kthread(char *name, void (*fn)(void))
+{
+  struct proc *p;
+
+  if((p = allocproc()) == 0)
+    return -1;
+  if((p->pgdir = setupkvm()) == 0){
+    kfree(p->kstack);
+    p->kstack = 0;
+    p->state = UNUSED;
+    return -1;
+  }
+  *(uint*)(p->context + 1) = (uint)fn;
+  p->sz = 0;
+  p->kthread = 1;
+  p->parent = initproc;
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  acquire(&ptable.lock);
+  p->pri = NLAYER-1;
+  p->state = RUNNABLE;
+  ptable.pri_queue[p->pri].queue[ptable.pri_queue[p->pri].tail] = p;
+  ptable.pri_queue[p->pri].tail++;
+  p->qtail[p->pri]++;
+  release(&ptable.lock);
+  return p->pid;
+}
+
 // Grow current process's memory by n bytes.
 // Return 0 on success, -1 on failure.
 int
@@ -181,16 +215,28 @@ growproc(int n)
   uint sz;
   struct proc *curproc = myproc();
 
+  // A vfork child's page table belongs to its parent.
+  if(curproc->borrowed)
+    return -1;
+
   sz = curproc->sz;
   if(n > 0){
-    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    // Only reserve the range; pagefault() backs each page
+    // with zeroed memory when it is first touched.  Refuse to
+    // promise more than is free now, so that malloc() fails
+    // cleanly instead of the process dying on a later fault.
+    if(sz + n < sz || sz + n >= UMAPBASE)
+      return -1;
+    if((PGROUNDUP(sz + n) - PGROUNDUP(sz)) / PGSIZE > kfreepages())
       return -1;
+    sz += n;
   } else if(n < 0){
     if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
       return -1;
   }
+  // deallocuvm() flushed any TLB entries it invalidated;
+  // growing only reserves address space, so nothing to flush.
   curproc->sz = sz;
-  switchuvm(curproc);
   return 0;
 }
 
@@ -227,6 +273,7 @@ fork(void)
     if(curproc->ofile[i])
       np->ofile[i] = filedup(curproc->ofile[i]);
   np->cwd = idup(curproc->cwd);
+  vmadup(np->vma, curproc->vma);
 
   safestrcpy(np->name, curproc->name, sizeof(curproc->name));
 
@@ -246,6 +293,72 @@ fork(void)
   return pid;
 }
 
+// Create a child that runs on this process's address space,
+// with no page table of its own, until it calls exec() or
+// exit().  The parent sleeps until then, so the child may use
+// the parent's memory (and stack) freely.  This is cheaper than
+// fork() for the fork-then-exec pattern.
+int
+vfork(void)
+{
+  int i, pid;
+  struct proc *np;
+  struct proc *curproc = myproc();
+
+  // Allocate process.
+  if((np = allocproc()) == 0){
+    return -1;
+  }
+
+  // Borrow the parent's page table.
+  np->pgdir = curproc->pgdir;
+  np->borrowed = 1;
+  np->sz = curproc->sz;
+  np->parent = curproc;
+  *np->tf = *curproc->tf;
+
+  // Clear %eax so that vfork returns 0 in the child.
+  np->tf->eax = 0;
+
+  for(i = 0; i < NOFILE; i++)
+    if(curproc->ofile[i])
+      np->ofile[i] = filedup(curproc->ofile[i]);
+  np->cwd = idup(curproc->cwd);
+  vmadup(np->vma, curproc->vma);
+
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+
+  pid = np->pid;
+
+  acquire(&ptable.lock);
+
+  np->state = RUNNABLE;
+  np->pri = curproc->pri;
+  ptable.pri_queue[np->pri].queue[ptable.pri_queue[np->pri].tail] = np;
+  ptable.pri_queue[np->pri].tail++;
+  np->qtail[np->pri]++;
+
+  // Stay off our memory until the child is done with it.
+  // The child can't be reaped meanwhile since only we can wait() for it.
+  while(np->borrowed)
+    sleep(curproc, &ptable.lock);
+
+  release(&ptable.lock);
+
+  return pid;
+}
+
+// Called by exec() once a vfork child has its own page table:
+// let the parent run again.
+void
+vforkdone(struct proc *p)
+{
+  acquire(&ptable.lock);
+  p->borrowed = 0;
+  wakeup1(p->parent);
+  release(&ptable.lock);
+}
+
 // Exit the current process.  Does not return.
 // An exited process remains in the zombie state
 // until its parent calls wait() to find out it exited.
@@ -267,6 +380,11 @@ exit(void)
     }
   }
 
+  aiofree(curproc);
+  shmrelease(curproc);
+
+  vmafree(curproc->vma);
+
   begin_op();
   iput(curproc->cwd);
   end_op();
@@ -274,7 +392,14 @@ exit(void)
 
   acquire(&ptable.lock);
 
-  // Parent might be sleeping in wait().
+  // A vfork child hands its parent's address space back.
+  if(curproc->borrowed){
+    switchkvm();
+    curproc->pgdir = 0;
+    curproc->borrowed = 0;
+  }
+
+  // Parent might be sleeping in wait() or vfork().
   wakeup1(curproc->parent);
   //cprintf("exiting %d\n", curproc->pid);
   // Pass abandoned children to init.
@@ -314,7 +439,9 @@ wait(void)
         pid = p->pid;
         kfree(p->kstack);
         p->kstack = 0;
-        freevm(p->pgdir);
+        if(p->pgdir)
+          freevm(p->pgdir);
+        p->pgdir = 0;
         p->pid = 0;
         p->parent = 0;
         p->name[0] = 0;
@@ -413,6 +540,8 @@ start:
     }
     release(&ptable.lock);
 
+    // Nothing to run; pre-zero a page for kalloc_zeroed().
+    kzeroidle();
   }
 }
 
@@ -695,6 +824,7 @@ fork2(int pri)
       if(curproc->ofile[i])
         np->ofile[i] = filedup(curproc->ofile[i]);
     np->cwd = idup(curproc->cwd);
+    vmadup(np->vma, curproc->vma);
 
     safestrcpy(np->name, curproc->name, sizeof(curproc->name));
 
@@ -714,6 +844,79 @@ fork2(int pri)
     return pid;
 }
 
+// Create a new process running the program at path with
+// arguments argv at priority pri.  Unlike fork2() followed by
+// exec(), the caller's memory is never copied: the child's
+// page table is built directly from the executable.
+// Returns the child's pid, or -1 on failure.
+int
+spawn(char *path, char **argv, int pri)
+{
+    if (pri > 3 || pri < 0) {
+        return -1;
+    }
+    int i, pid;
+    struct proc *np;
+    struct proc *curproc = myproc();
+
+    // Allocate process.
+    if((np = allocproc()) == 0){
+      return -1;
+    }
+
+    // Start in user mode at the entry point exec sets up.
+    memset(np->tf, 0, sizeof(*np->tf));
+    np->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+    np->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+    np->tf->es = np->tf->ds;
+    np->tf->ss = np->tf->ds;
+    np->tf->eflags = FL_IF;
+
+    np->pgdir = 0;
+    if(execinto(np, path, argv) < 0){
+      kfree(np->kstack);
+      np->kstack = 0;
+      np->state = UNUSED;
+      return -1;
+    }
+    np->parent = curproc;
+
+    for(i = 0; i < NOFILE; i++)
+      if(curproc->ofile[i])
+        np->ofile[i] = filedup(curproc->ofile[i]);
+    np->cwd = idup(curproc->cwd);
+
+    pid = np->pid;
+
+    acquire(&ptable.lock);
+
+    np->state = RUNNABLE;
+    np->pri = pri;
+    ptable.pri_queue[np->pri].queue[ptable.pri_queue[np->pri].tail] = np;
+    ptable.pri_queue[pri].tail++;
+    np->qtail[pri]++;
+
+    release(&ptable.lock);
+
+    return pid;
+}
+
+// Launch n copies of path at priority pri, storing their
+// pids in pids[].  Stops at the first failure.
+// Returns the number of processes created.
+int
+spawnn(char *path, char **argv, int pri, int n, int *pids)
+{
+    int i;
+
+    for (i = 0; i < n; i++) {
+        if ((pids[i] = spawn(path, argv, pri)) < 0) {
+            break;
+        }
+    }
+    return i;
+}
+
 int
 getpinfo(struct pstat *outStat)
 {
@@ -721,7 +924,9 @@ getpinfo(struct pstat *outStat)
         return -1;
     }
     for(int n = 0; n < NPROC; n++){
-        if (ptable.proc[n].state == UNUSED) {
+        // Kernel threads are not scheduled by anything a
+        // user process does, so leave them out.
+        if (ptable.proc[n].state == UNUSED || ptable.proc[n].kthread) {
             outStat->inuse[n] = 0;
         } else {
             outStat->inuse[n] = 1;
@@ -33,6 +33,34 @@ struct context {
   uint eip;
 };
 
+// A region of user memory backed by a file or a shared memory
+// segment.  For a file, the bytes [start, start+len) are read
+// from ip at offset off when first touched; the rest of the
+// last page is zero.  Shared memory segments and mmap()ed files
+// are placed above the heap, at or above UMAPBASE.
+struct vma {
+  uint start;                  // Page-aligned user virtual address
+  uint len;                    // Bytes of file data
+  uint off;                    // Offset of start in the file
+  struct inode *ip;            // Backing file, or 0
+  struct shm *shm;             // Shared memory segment, or 0
+  int flags;                   // VMA_* flags for a file region
+};
+
+#define VMA_WRITE  0x1         // writable (copy-on-write)
+#define VMA_MMAP   0x4         // created by mmap()
+
+// A read started by aread(): the blocks are being read into
+// the buffer cache, and await() copies them out.
+struct aio {
+  struct file *f;              // 0 if the slot is unused
+  char *dst;                   // User address to read into
+  uint off;                    // Offset in f
+  int n;                       // Bytes to read
+  int nb;                      // # of bufs in b
+  struct buf *b[NAIOBLK];      // Blocks of the range, held in the cache
+};
+
 // Per-process state
 struct proc {
   uint sz;                     // Size of process memory (bytes)
@@ -52,6 +80,11 @@ struct proc {
   int ticks[NLAYER];           // ticks lapsed on this process
   int ticks_thisturn;          // ticks lapsed since this processor scheduled
   int qtail[NLAYER];                   // total num times moved to tail of queue
+  int borrowed;                // Running on parent's pgdir after vfork()
+  struct vma vma[NVMA];        // Program segments and shared memory
+  struct aio aio[NAIO];        // Reads started by aread()
+  uint shmheld;                // Bit i: holds shm segment slot i
+  int kthread;                 // Kernel thread, hidden from getpinfo()
 };
 
 // Process memory is laid out contiguously, low addresses first:
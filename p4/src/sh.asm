@@ -0,0 +1,2475 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <getcmd>:
+  exit();
+}
+
+int
+getcmd(char *buf, int nbuf)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	56                   	push   %esi
+       4:	53                   	push   %ebx
+       5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+       8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(2, "$ ");
+       b:	83 ec 08             	sub    $0x8,%esp
+       e:	68 d4 10 00 00       	push   $0x10d4
+      13:	6a 02                	push   $0x2
+      15:	e8 0d 0e 00 00       	call   e27 <printf>
+  memset(buf, 0, nbuf);
+      1a:	83 c4 0c             	add    $0xc,%esp
+      1d:	56                   	push   %esi
+      1e:	6a 00                	push   $0x0
+      20:	53                   	push   %ebx
+      21:	e8 ef 0a 00 00       	call   b15 <memset>
+  gets(buf, nbuf);
+      26:	83 c4 08             	add    $0x8,%esp
+      29:	56                   	push   %esi
+      2a:	53                   	push   %ebx
+      2b:	e8 21 0b 00 00       	call   b51 <gets>
+  if(buf[0] == 0) // EOF
+      30:	83 c4 10             	add    $0x10,%esp
+      33:	80 3b 00             	cmpb   $0x0,(%ebx)
+      36:	74 0c                	je     44 <getcmd+0x44>
+    return -1;
+  return 0;
+      38:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+      3d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      40:	5b                   	pop    %ebx
+      41:	5e                   	pop    %esi
+      42:	5d                   	pop    %ebp
+      43:	c3                   	ret
+    return -1;
+      44:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+      49:	eb f2                	jmp    3d <getcmd+0x3d>
+
+0000004b <panic>:
+  exit();
+}
+
+void
+panic(char *s)
+{
+      4b:	55                   	push   %ebp
+      4c:	89 e5                	mov    %esp,%ebp
+      4e:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "%s\n", s);
+      51:	ff 75 08             	push   0x8(%ebp)
+      54:	68 6c 11 00 00       	push   $0x116c
+      59:	6a 02                	push   $0x2
+      5b:	e8 c7 0d 00 00       	call   e27 <printf>
+  exit();
+      60:	e8 eb 0b 00 00       	call   c50 <exit>
+
+00000065 <fork1>:
+}
+
+int
+fork1(void)
+{
+      65:	55                   	push   %ebp
+      66:	89 e5                	mov    %esp,%ebp
+      68:	83 ec 08             	sub    $0x8,%esp
+  int pid;
+
+  pid = fork();
+      6b:	e8 d8 0b 00 00       	call   c48 <fork>
+  if(pid == -1)
+      70:	83 f8 ff             	cmp    $0xffffffff,%eax
+      73:	74 02                	je     77 <fork1+0x12>
+    panic("fork");
+  return pid;
+}
+      75:	c9                   	leave
+      76:	c3                   	ret
+    panic("fork");
+      77:	83 ec 0c             	sub    $0xc,%esp
+      7a:	68 87 11 00 00       	push   $0x1187
+      7f:	e8 c7 ff ff ff       	call   4b <panic>
+
+00000084 <runcmd>:
+{
+      84:	55                   	push   %ebp
+      85:	89 e5                	mov    %esp,%ebp
+      87:	53                   	push   %ebx
+      88:	83 ec 14             	sub    $0x14,%esp
+      8b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd == 0)
+      8e:	85 db                	test   %ebx,%ebx
+      90:	74 0e                	je     a0 <runcmd+0x1c>
+  switch(cmd->type){
+      92:	8b 03                	mov    (%ebx),%eax
+      94:	83 f8 05             	cmp    $0x5,%eax
+      97:	77 0c                	ja     a5 <runcmd+0x21>
+      99:	ff 24 85 8c 11 00 00 	jmp    *0x118c(,%eax,4)
+    exit();
+      a0:	e8 ab 0b 00 00       	call   c50 <exit>
+    panic("runcmd");
+      a5:	83 ec 0c             	sub    $0xc,%esp
+      a8:	68 d7 10 00 00       	push   $0x10d7
+      ad:	e8 99 ff ff ff       	call   4b <panic>
+    if(ecmd->argv[0] == 0)
+      b2:	8b 43 04             	mov    0x4(%ebx),%eax
+      b5:	85 c0                	test   %eax,%eax
+      b7:	74 27                	je     e0 <runcmd+0x5c>
+    exec(ecmd->argv[0], ecmd->argv);
+      b9:	8d 53 04             	lea    0x4(%ebx),%edx
+      bc:	83 ec 08             	sub    $0x8,%esp
+      bf:	52                   	push   %edx
+      c0:	50                   	push   %eax
+      c1:	e8 c2 0b 00 00       	call   c88 <exec>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+      c6:	83 c4 0c             	add    $0xc,%esp
+      c9:	ff 73 04             	push   0x4(%ebx)
+      cc:	68 de 10 00 00       	push   $0x10de
+      d1:	6a 02                	push   $0x2
+      d3:	e8 4f 0d 00 00       	call   e27 <printf>
+    break;
+      d8:	83 c4 10             	add    $0x10,%esp
+  exit();
+      db:	e8 70 0b 00 00       	call   c50 <exit>
+      exit();
+      e0:	e8 6b 0b 00 00       	call   c50 <exit>
+    close(rcmd->fd);
+      e5:	83 ec 0c             	sub    $0xc,%esp
+      e8:	ff 73 14             	push   0x14(%ebx)
+      eb:	e8 88 0b 00 00       	call   c78 <close>
+    if(open(rcmd->file, rcmd->mode) < 0){
+      f0:	83 c4 08             	add    $0x8,%esp
+      f3:	ff 73 10             	push   0x10(%ebx)
+      f6:	ff 73 08             	push   0x8(%ebx)
+      f9:	e8 92 0b 00 00       	call   c90 <open>
+      fe:	83 c4 10             	add    $0x10,%esp
+     101:	85 c0                	test   %eax,%eax
+     103:	78 0b                	js     110 <runcmd+0x8c>
+    runcmd(rcmd->cmd);
+     105:	83 ec 0c             	sub    $0xc,%esp
+     108:	ff 73 04             	push   0x4(%ebx)
+     10b:	e8 74 ff ff ff       	call   84 <runcmd>
+      printf(2, "open %s failed\n", rcmd->file);
+     110:	83 ec 04             	sub    $0x4,%esp
+     113:	ff 73 08             	push   0x8(%ebx)
+     116:	68 ee 10 00 00       	push   $0x10ee
+     11b:	6a 02                	push   $0x2
+     11d:	e8 05 0d 00 00       	call   e27 <printf>
+      exit();
+     122:	e8 29 0b 00 00       	call   c50 <exit>
+    if(fork1() == 0)
+     127:	e8 39 ff ff ff       	call   65 <fork1>
+     12c:	85 c0                	test   %eax,%eax
+     12e:	74 10                	je     140 <runcmd+0xbc>
+    wait();
+     130:	e8 23 0b 00 00       	call   c58 <wait>
+    runcmd(lcmd->right);
+     135:	83 ec 0c             	sub    $0xc,%esp
+     138:	ff 73 08             	push   0x8(%ebx)
+     13b:	e8 44 ff ff ff       	call   84 <runcmd>
+      runcmd(lcmd->left);
+     140:	83 ec 0c             	sub    $0xc,%esp
+     143:	ff 73 04             	push   0x4(%ebx)
+     146:	e8 39 ff ff ff       	call   84 <runcmd>
+    if(pipe(p) < 0)
+     14b:	83 ec 0c             	sub    $0xc,%esp
+     14e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     151:	50                   	push   %eax
+     152:	e8 09 0b 00 00       	call   c60 <pipe>
+     157:	83 c4 10             	add    $0x10,%esp
+     15a:	85 c0                	test   %eax,%eax
+     15c:	78 3a                	js     198 <runcmd+0x114>
+    if(fork1() == 0){
+     15e:	e8 02 ff ff ff       	call   65 <fork1>
+     163:	85 c0                	test   %eax,%eax
+     165:	74 3e                	je     1a5 <runcmd+0x121>
+    if(fork1() == 0){
+     167:	e8 f9 fe ff ff       	call   65 <fork1>
+     16c:	85 c0                	test   %eax,%eax
+     16e:	74 6b                	je     1db <runcmd+0x157>
+    close(p[0]);
+     170:	83 ec 0c             	sub    $0xc,%esp
+     173:	ff 75 f0             	push   -0x10(%ebp)
+     176:	e8 fd 0a 00 00       	call   c78 <close>
+    close(p[1]);
+     17b:	83 c4 04             	add    $0x4,%esp
+     17e:	ff 75 f4             	push   -0xc(%ebp)
+     181:	e8 f2 0a 00 00       	call   c78 <close>
+    wait();
+     186:	e8 cd 0a 00 00       	call   c58 <wait>
+    wait();
+     18b:	e8 c8 0a 00 00       	call   c58 <wait>
+    break;
+     190:	83 c4 10             	add    $0x10,%esp
+     193:	e9 43 ff ff ff       	jmp    db <runcmd+0x57>
+      panic("pipe");
+     198:	83 ec 0c             	sub    $0xc,%esp
+     19b:	68 fe 10 00 00       	push   $0x10fe
+     1a0:	e8 a6 fe ff ff       	call   4b <panic>
+      close(1);
+     1a5:	83 ec 0c             	sub    $0xc,%esp
+     1a8:	6a 01                	push   $0x1
+     1aa:	e8 c9 0a 00 00       	call   c78 <close>
+      dup(p[1]);
+     1af:	83 c4 04             	add    $0x4,%esp
+     1b2:	ff 75 f4             	push   -0xc(%ebp)
+     1b5:	e8 0e 0b 00 00       	call   cc8 <dup>
+      close(p[0]);
+     1ba:	83 c4 04             	add    $0x4,%esp
+     1bd:	ff 75 f0             	push   -0x10(%ebp)
+     1c0:	e8 b3 0a 00 00       	call   c78 <close>
+      close(p[1]);
+     1c5:	83 c4 04             	add    $0x4,%esp
+     1c8:	ff 75 f4             	push   -0xc(%ebp)
+     1cb:	e8 a8 0a 00 00       	call   c78 <close>
+      runcmd(pcmd->left);
+     1d0:	83 c4 04             	add    $0x4,%esp
+     1d3:	ff 73 04             	push   0x4(%ebx)
+     1d6:	e8 a9 fe ff ff       	call   84 <runcmd>
+      close(0);
+     1db:	83 ec 0c             	sub    $0xc,%esp
+     1de:	6a 00                	push   $0x0
+     1e0:	e8 93 0a 00 00       	call   c78 <close>
+      dup(p[0]);
+     1e5:	83 c4 04             	add    $0x4,%esp
+     1e8:	ff 75 f0             	push   -0x10(%ebp)
+     1eb:	e8 d8 0a 00 00       	call   cc8 <dup>
+      close(p[0]);
+     1f0:	83 c4 04             	add    $0x4,%esp
+     1f3:	ff 75 f0             	push   -0x10(%ebp)
+     1f6:	e8 7d 0a 00 00       	call   c78 <close>
+      close(p[1]);
+     1fb:	83 c4 04             	add    $0x4,%esp
+     1fe:	ff 75 f4             	push   -0xc(%ebp)
+     201:	e8 72 0a 00 00       	call   c78 <close>
+      runcmd(pcmd->right);
+     206:	83 c4 04             	add    $0x4,%esp
+     209:	ff 73 08             	push   0x8(%ebx)
+     20c:	e8 73 fe ff ff       	call   84 <runcmd>
+    if(fork1() == 0)
+     211:	e8 4f fe ff ff       	call   65 <fork1>
+     216:	85 c0                	test   %eax,%eax
+     218:	0f 85 bd fe ff ff    	jne    db <runcmd+0x57>
+      runcmd(bcmd->cmd);
+     21e:	83 ec 0c             	sub    $0xc,%esp
+     221:	ff 73 04             	push   0x4(%ebx)
+     224:	e8 5b fe ff ff       	call   84 <runcmd>
+
+00000229 <execcmd>:
+
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+     229:	55                   	push   %ebp
+     22a:	89 e5                	mov    %esp,%ebp
+     22c:	53                   	push   %ebx
+     22d:	83 ec 10             	sub    $0x10,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     230:	6a 54                	push   $0x54
+     232:	e8 16 0e 00 00       	call   104d <malloc>
+     237:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     239:	83 c4 0c             	add    $0xc,%esp
+     23c:	6a 54                	push   $0x54
+     23e:	6a 00                	push   $0x0
+     240:	50                   	push   %eax
+     241:	e8 cf 08 00 00       	call   b15 <memset>
+  cmd->type = EXEC;
+     246:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  return (struct cmd*)cmd;
+}
+     24c:	89 d8                	mov    %ebx,%eax
+     24e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     251:	c9                   	leave
+     252:	c3                   	ret
+
+00000253 <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     253:	55                   	push   %ebp
+     254:	89 e5                	mov    %esp,%ebp
+     256:	53                   	push   %ebx
+     257:	83 ec 10             	sub    $0x10,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     25a:	6a 18                	push   $0x18
+     25c:	e8 ec 0d 00 00       	call   104d <malloc>
+     261:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     263:	83 c4 0c             	add    $0xc,%esp
+     266:	6a 18                	push   $0x18
+     268:	6a 00                	push   $0x0
+     26a:	50                   	push   %eax
+     26b:	e8 a5 08 00 00       	call   b15 <memset>
+  cmd->type = REDIR;
+     270:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  cmd->cmd = subcmd;
+     276:	8b 45 08             	mov    0x8(%ebp),%eax
+     279:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->file = file;
+     27c:	8b 45 0c             	mov    0xc(%ebp),%eax
+     27f:	89 43 08             	mov    %eax,0x8(%ebx)
+  cmd->efile = efile;
+     282:	8b 45 10             	mov    0x10(%ebp),%eax
+     285:	89 43 0c             	mov    %eax,0xc(%ebx)
+  cmd->mode = mode;
+     288:	8b 45 14             	mov    0x14(%ebp),%eax
+     28b:	89 43 10             	mov    %eax,0x10(%ebx)
+  cmd->fd = fd;
+     28e:	8b 45 18             	mov    0x18(%ebp),%eax
+     291:	89 43 14             	mov    %eax,0x14(%ebx)
+  return (struct cmd*)cmd;
+}
+     294:	89 d8                	mov    %ebx,%eax
+     296:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     299:	c9                   	leave
+     29a:	c3                   	ret
+
+0000029b <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     29b:	55                   	push   %ebp
+     29c:	89 e5                	mov    %esp,%ebp
+     29e:	53                   	push   %ebx
+     29f:	83 ec 10             	sub    $0x10,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     2a2:	6a 0c                	push   $0xc
+     2a4:	e8 a4 0d 00 00       	call   104d <malloc>
+     2a9:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     2ab:	83 c4 0c             	add    $0xc,%esp
+     2ae:	6a 0c                	push   $0xc
+     2b0:	6a 00                	push   $0x0
+     2b2:	50                   	push   %eax
+     2b3:	e8 5d 08 00 00       	call   b15 <memset>
+  cmd->type = PIPE;
+     2b8:	c7 03 03 00 00 00    	movl   $0x3,(%ebx)
+  cmd->left = left;
+     2be:	8b 45 08             	mov    0x8(%ebp),%eax
+     2c1:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     2c4:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2c7:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     2ca:	89 d8                	mov    %ebx,%eax
+     2cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2cf:	c9                   	leave
+     2d0:	c3                   	ret
+
+000002d1 <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+     2d1:	55                   	push   %ebp
+     2d2:	89 e5                	mov    %esp,%ebp
+     2d4:	53                   	push   %ebx
+     2d5:	83 ec 10             	sub    $0x10,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     2d8:	6a 0c                	push   $0xc
+     2da:	e8 6e 0d 00 00       	call   104d <malloc>
+     2df:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     2e1:	83 c4 0c             	add    $0xc,%esp
+     2e4:	6a 0c                	push   $0xc
+     2e6:	6a 00                	push   $0x0
+     2e8:	50                   	push   %eax
+     2e9:	e8 27 08 00 00       	call   b15 <memset>
+  cmd->type = LIST;
+     2ee:	c7 03 04 00 00 00    	movl   $0x4,(%ebx)
+  cmd->left = left;
+     2f4:	8b 45 08             	mov    0x8(%ebp),%eax
+     2f7:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     2fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2fd:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     300:	89 d8                	mov    %ebx,%eax
+     302:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     305:	c9                   	leave
+     306:	c3                   	ret
+
+00000307 <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+     307:	55                   	push   %ebp
+     308:	89 e5                	mov    %esp,%ebp
+     30a:	53                   	push   %ebx
+     30b:	83 ec 10             	sub    $0x10,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     30e:	6a 08                	push   $0x8
+     310:	e8 38 0d 00 00       	call   104d <malloc>
+     315:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     317:	83 c4 0c             	add    $0xc,%esp
+     31a:	6a 08                	push   $0x8
+     31c:	6a 00                	push   $0x0
+     31e:	50                   	push   %eax
+     31f:	e8 f1 07 00 00       	call   b15 <memset>
+  cmd->type = BACK;
+     324:	c7 03 05 00 00 00    	movl   $0x5,(%ebx)
+  cmd->cmd = subcmd;
+     32a:	8b 45 08             	mov    0x8(%ebp),%eax
+     32d:	89 43 04             	mov    %eax,0x4(%ebx)
+  return (struct cmd*)cmd;
+}
+     330:	89 d8                	mov    %ebx,%eax
+     332:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     335:	c9                   	leave
+     336:	c3                   	ret
+
+00000337 <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+     337:	55                   	push   %ebp
+     338:	89 e5                	mov    %esp,%ebp
+     33a:	57                   	push   %edi
+     33b:	56                   	push   %esi
+     33c:	53                   	push   %ebx
+     33d:	83 ec 0c             	sub    $0xc,%esp
+     340:	8b 75 0c             	mov    0xc(%ebp),%esi
+     343:	8b 7d 10             	mov    0x10(%ebp),%edi
+  char *s;
+  int ret;
+
+  s = *ps;
+     346:	8b 45 08             	mov    0x8(%ebp),%eax
+     349:	8b 18                	mov    (%eax),%ebx
+  while(s < es && strchr(whitespace, *s))
+     34b:	eb 03                	jmp    350 <gettoken+0x19>
+    s++;
+     34d:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     350:	39 f3                	cmp    %esi,%ebx
+     352:	73 18                	jae    36c <gettoken+0x35>
+     354:	83 ec 08             	sub    $0x8,%esp
+     357:	0f be 03             	movsbl (%ebx),%eax
+     35a:	50                   	push   %eax
+     35b:	68 c4 17 00 00       	push   $0x17c4
+     360:	e8 c9 07 00 00       	call   b2e <strchr>
+     365:	83 c4 10             	add    $0x10,%esp
+     368:	85 c0                	test   %eax,%eax
+     36a:	75 e1                	jne    34d <gettoken+0x16>
+  if(q)
+     36c:	85 ff                	test   %edi,%edi
+     36e:	74 02                	je     372 <gettoken+0x3b>
+    *q = s;
+     370:	89 1f                	mov    %ebx,(%edi)
+  ret = *s;
+     372:	0f b6 03             	movzbl (%ebx),%eax
+     375:	0f be f8             	movsbl %al,%edi
+  switch(*s){
+     378:	3c 3c                	cmp    $0x3c,%al
+     37a:	7f 27                	jg     3a3 <gettoken+0x6c>
+     37c:	3c 3b                	cmp    $0x3b,%al
+     37e:	7d 13                	jge    393 <gettoken+0x5c>
+     380:	84 c0                	test   %al,%al
+     382:	74 12                	je     396 <gettoken+0x5f>
+     384:	78 41                	js     3c7 <gettoken+0x90>
+     386:	3c 26                	cmp    $0x26,%al
+     388:	74 09                	je     393 <gettoken+0x5c>
+     38a:	7c 3b                	jl     3c7 <gettoken+0x90>
+     38c:	83 e8 28             	sub    $0x28,%eax
+     38f:	3c 01                	cmp    $0x1,%al
+     391:	77 34                	ja     3c7 <gettoken+0x90>
+  case '(':
+  case ')':
+  case ';':
+  case '&':
+  case '<':
+    s++;
+     393:	83 c3 01             	add    $0x1,%ebx
+    ret = 'a';
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+      s++;
+    break;
+  }
+  if(eq)
+     396:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     39a:	74 77                	je     413 <gettoken+0xdc>
+    *eq = s;
+     39c:	8b 45 14             	mov    0x14(%ebp),%eax
+     39f:	89 18                	mov    %ebx,(%eax)
+     3a1:	eb 70                	jmp    413 <gettoken+0xdc>
+  switch(*s){
+     3a3:	3c 3e                	cmp    $0x3e,%al
+     3a5:	75 0d                	jne    3b4 <gettoken+0x7d>
+    s++;
+     3a7:	8d 43 01             	lea    0x1(%ebx),%eax
+    if(*s == '>'){
+     3aa:	80 7b 01 3e          	cmpb   $0x3e,0x1(%ebx)
+     3ae:	74 0a                	je     3ba <gettoken+0x83>
+    s++;
+     3b0:	89 c3                	mov    %eax,%ebx
+     3b2:	eb e2                	jmp    396 <gettoken+0x5f>
+  switch(*s){
+     3b4:	3c 7c                	cmp    $0x7c,%al
+     3b6:	75 0f                	jne    3c7 <gettoken+0x90>
+     3b8:	eb d9                	jmp    393 <gettoken+0x5c>
+      s++;
+     3ba:	83 c3 02             	add    $0x2,%ebx
+      ret = '+';
+     3bd:	bf 2b 00 00 00       	mov    $0x2b,%edi
+     3c2:	eb d2                	jmp    396 <gettoken+0x5f>
+      s++;
+     3c4:	83 c3 01             	add    $0x1,%ebx
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     3c7:	39 f3                	cmp    %esi,%ebx
+     3c9:	73 37                	jae    402 <gettoken+0xcb>
+     3cb:	83 ec 08             	sub    $0x8,%esp
+     3ce:	0f be 03             	movsbl (%ebx),%eax
+     3d1:	50                   	push   %eax
+     3d2:	68 c4 17 00 00       	push   $0x17c4
+     3d7:	e8 52 07 00 00       	call   b2e <strchr>
+     3dc:	83 c4 10             	add    $0x10,%esp
+     3df:	85 c0                	test   %eax,%eax
+     3e1:	75 26                	jne    409 <gettoken+0xd2>
+     3e3:	83 ec 08             	sub    $0x8,%esp
+     3e6:	0f be 03             	movsbl (%ebx),%eax
+     3e9:	50                   	push   %eax
+     3ea:	68 bc 17 00 00       	push   $0x17bc
+     3ef:	e8 3a 07 00 00       	call   b2e <strchr>
+     3f4:	83 c4 10             	add    $0x10,%esp
+     3f7:	85 c0                	test   %eax,%eax
+     3f9:	74 c9                	je     3c4 <gettoken+0x8d>
+    ret = 'a';
+     3fb:	bf 61 00 00 00       	mov    $0x61,%edi
+     400:	eb 94                	jmp    396 <gettoken+0x5f>
+     402:	bf 61 00 00 00       	mov    $0x61,%edi
+     407:	eb 8d                	jmp    396 <gettoken+0x5f>
+     409:	bf 61 00 00 00       	mov    $0x61,%edi
+     40e:	eb 86                	jmp    396 <gettoken+0x5f>
+
+  while(s < es && strchr(whitespace, *s))
+    s++;
+     410:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     413:	39 f3                	cmp    %esi,%ebx
+     415:	73 18                	jae    42f <gettoken+0xf8>
+     417:	83 ec 08             	sub    $0x8,%esp
+     41a:	0f be 03             	movsbl (%ebx),%eax
+     41d:	50                   	push   %eax
+     41e:	68 c4 17 00 00       	push   $0x17c4
+     423:	e8 06 07 00 00       	call   b2e <strchr>
+     428:	83 c4 10             	add    $0x10,%esp
+     42b:	85 c0                	test   %eax,%eax
+     42d:	75 e1                	jne    410 <gettoken+0xd9>
+  *ps = s;
+     42f:	8b 45 08             	mov    0x8(%ebp),%eax
+     432:	89 18                	mov    %ebx,(%eax)
+  return ret;
+}
+     434:	89 f8                	mov    %edi,%eax
+     436:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     439:	5b                   	pop    %ebx
+     43a:	5e                   	pop    %esi
+     43b:	5f                   	pop    %edi
+     43c:	5d                   	pop    %ebp
+     43d:	c3                   	ret
+
+0000043e <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+     43e:	55                   	push   %ebp
+     43f:	89 e5                	mov    %esp,%ebp
+     441:	57                   	push   %edi
+     442:	56                   	push   %esi
+     443:	53                   	push   %ebx
+     444:	83 ec 0c             	sub    $0xc,%esp
+     447:	8b 7d 08             	mov    0x8(%ebp),%edi
+     44a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *s;
+
+  s = *ps;
+     44d:	8b 1f                	mov    (%edi),%ebx
+  while(s < es && strchr(whitespace, *s))
+     44f:	eb 03                	jmp    454 <peek+0x16>
+    s++;
+     451:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     454:	39 f3                	cmp    %esi,%ebx
+     456:	73 18                	jae    470 <peek+0x32>
+     458:	83 ec 08             	sub    $0x8,%esp
+     45b:	0f be 03             	movsbl (%ebx),%eax
+     45e:	50                   	push   %eax
+     45f:	68 c4 17 00 00       	push   $0x17c4
+     464:	e8 c5 06 00 00       	call   b2e <strchr>
+     469:	83 c4 10             	add    $0x10,%esp
+     46c:	85 c0                	test   %eax,%eax
+     46e:	75 e1                	jne    451 <peek+0x13>
+  *ps = s;
+     470:	89 1f                	mov    %ebx,(%edi)
+  return *s && strchr(toks, *s);
+     472:	0f b6 03             	movzbl (%ebx),%eax
+     475:	84 c0                	test   %al,%al
+     477:	75 0d                	jne    486 <peek+0x48>
+     479:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     47e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     481:	5b                   	pop    %ebx
+     482:	5e                   	pop    %esi
+     483:	5f                   	pop    %edi
+     484:	5d                   	pop    %ebp
+     485:	c3                   	ret
+  return *s && strchr(toks, *s);
+     486:	83 ec 08             	sub    $0x8,%esp
+     489:	0f be c0             	movsbl %al,%eax
+     48c:	50                   	push   %eax
+     48d:	ff 75 10             	push   0x10(%ebp)
+     490:	e8 99 06 00 00       	call   b2e <strchr>
+     495:	83 c4 10             	add    $0x10,%esp
+     498:	85 c0                	test   %eax,%eax
+     49a:	74 07                	je     4a3 <peek+0x65>
+     49c:	b8 01 00 00 00       	mov    $0x1,%eax
+     4a1:	eb db                	jmp    47e <peek+0x40>
+     4a3:	b8 00 00 00 00       	mov    $0x0,%eax
+     4a8:	eb d4                	jmp    47e <peek+0x40>
+
+000004aa <simplecmd>:
+// Can s be parsed as a single command with no redirection,
+// pipes or lists?  Such a command can't fail to parse, and
+// parsing it allocates only the execcmd itself.
+int
+simplecmd(char *s)
+{
+     4aa:	55                   	push   %ebp
+     4ab:	89 e5                	mov    %esp,%ebp
+     4ad:	56                   	push   %esi
+     4ae:	53                   	push   %ebx
+     4af:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int n;
+
+  for(n = 0; *s; n++){
+     4b2:	be 00 00 00 00       	mov    $0x0,%esi
+     4b7:	eb 66                	jmp    51f <simplecmd+0x75>
+    while(*s && strchr(whitespace, *s))
+      s++;
+     4b9:	83 c3 01             	add    $0x1,%ebx
+    while(*s && strchr(whitespace, *s))
+     4bc:	0f b6 03             	movzbl (%ebx),%eax
+     4bf:	84 c0                	test   %al,%al
+     4c1:	74 18                	je     4db <simplecmd+0x31>
+     4c3:	83 ec 08             	sub    $0x8,%esp
+     4c6:	0f be c0             	movsbl %al,%eax
+     4c9:	50                   	push   %eax
+     4ca:	68 c4 17 00 00       	push   $0x17c4
+     4cf:	e8 5a 06 00 00       	call   b2e <strchr>
+     4d4:	83 c4 10             	add    $0x10,%esp
+     4d7:	85 c0                	test   %eax,%eax
+     4d9:	75 de                	jne    4b9 <simplecmd+0xf>
+    if(*s == 0)
+     4db:	80 3b 00             	cmpb   $0x0,(%ebx)
+     4de:	74 44                	je     524 <simplecmd+0x7a>
+      break;
+    while(*s && !strchr(whitespace, *s)){
+     4e0:	0f b6 03             	movzbl (%ebx),%eax
+     4e3:	84 c0                	test   %al,%al
+     4e5:	74 35                	je     51c <simplecmd+0x72>
+     4e7:	83 ec 08             	sub    $0x8,%esp
+     4ea:	0f be c0             	movsbl %al,%eax
+     4ed:	50                   	push   %eax
+     4ee:	68 c4 17 00 00       	push   $0x17c4
+     4f3:	e8 36 06 00 00       	call   b2e <strchr>
+     4f8:	83 c4 10             	add    $0x10,%esp
+     4fb:	85 c0                	test   %eax,%eax
+     4fd:	75 1d                	jne    51c <simplecmd+0x72>
+      if(strchr(symbols, *s))
+     4ff:	83 ec 08             	sub    $0x8,%esp
+     502:	0f be 03             	movsbl (%ebx),%eax
+     505:	50                   	push   %eax
+     506:	68 bc 17 00 00       	push   $0x17bc
+     50b:	e8 1e 06 00 00       	call   b2e <strchr>
+     510:	83 c4 10             	add    $0x10,%esp
+     513:	85 c0                	test   %eax,%eax
+     515:	75 18                	jne    52f <simplecmd+0x85>
+        return 0;
+      s++;
+     517:	83 c3 01             	add    $0x1,%ebx
+     51a:	eb c4                	jmp    4e0 <simplecmd+0x36>
+  for(n = 0; *s; n++){
+     51c:	83 c6 01             	add    $0x1,%esi
+     51f:	80 3b 00             	cmpb   $0x0,(%ebx)
+     522:	75 98                	jne    4bc <simplecmd+0x12>
+    }
+  }
+  return n < MAXARGS;
+     524:	83 fe 09             	cmp    $0x9,%esi
+     527:	0f 9e c0             	setle  %al
+     52a:	0f b6 c0             	movzbl %al,%eax
+     52d:	eb 05                	jmp    534 <simplecmd+0x8a>
+        return 0;
+     52f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     534:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     537:	5b                   	pop    %ebx
+     538:	5e                   	pop    %esi
+     539:	5d                   	pop    %ebp
+     53a:	c3                   	ret
+
+0000053b <parseredirs>:
+  return cmd;
+}
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     53b:	55                   	push   %ebp
+     53c:	89 e5                	mov    %esp,%ebp
+     53e:	57                   	push   %edi
+     53f:	56                   	push   %esi
+     540:	53                   	push   %ebx
+     541:	83 ec 1c             	sub    $0x1c,%esp
+     544:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     547:	8b 75 10             	mov    0x10(%ebp),%esi
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+     54a:	eb 28                	jmp    574 <parseredirs+0x39>
+    tok = gettoken(ps, es, 0, 0);
+    if(gettoken(ps, es, &q, &eq) != 'a')
+      panic("missing file for redirection");
+     54c:	83 ec 0c             	sub    $0xc,%esp
+     54f:	68 03 11 00 00       	push   $0x1103
+     554:	e8 f2 fa ff ff       	call   4b <panic>
+    switch(tok){
+    case '<':
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     559:	83 ec 0c             	sub    $0xc,%esp
+     55c:	6a 00                	push   $0x0
+     55e:	6a 00                	push   $0x0
+     560:	ff 75 e0             	push   -0x20(%ebp)
+     563:	ff 75 e4             	push   -0x1c(%ebp)
+     566:	ff 75 08             	push   0x8(%ebp)
+     569:	e8 e5 fc ff ff       	call   253 <redircmd>
+     56e:	89 45 08             	mov    %eax,0x8(%ebp)
+      break;
+     571:	83 c4 20             	add    $0x20,%esp
+  while(peek(ps, es, "<>")){
+     574:	83 ec 04             	sub    $0x4,%esp
+     577:	68 20 11 00 00       	push   $0x1120
+     57c:	56                   	push   %esi
+     57d:	57                   	push   %edi
+     57e:	e8 bb fe ff ff       	call   43e <peek>
+     583:	83 c4 10             	add    $0x10,%esp
+     586:	85 c0                	test   %eax,%eax
+     588:	74 76                	je     600 <parseredirs+0xc5>
+    tok = gettoken(ps, es, 0, 0);
+     58a:	6a 00                	push   $0x0
+     58c:	6a 00                	push   $0x0
+     58e:	56                   	push   %esi
+     58f:	57                   	push   %edi
+     590:	e8 a2 fd ff ff       	call   337 <gettoken>
+     595:	89 c3                	mov    %eax,%ebx
+    if(gettoken(ps, es, &q, &eq) != 'a')
+     597:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     59a:	50                   	push   %eax
+     59b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     59e:	50                   	push   %eax
+     59f:	56                   	push   %esi
+     5a0:	57                   	push   %edi
+     5a1:	e8 91 fd ff ff       	call   337 <gettoken>
+     5a6:	83 c4 20             	add    $0x20,%esp
+     5a9:	83 f8 61             	cmp    $0x61,%eax
+     5ac:	75 9e                	jne    54c <parseredirs+0x11>
+    switch(tok){
+     5ae:	83 fb 3c             	cmp    $0x3c,%ebx
+     5b1:	74 a6                	je     559 <parseredirs+0x1e>
+     5b3:	83 fb 3e             	cmp    $0x3e,%ebx
+     5b6:	74 25                	je     5dd <parseredirs+0xa2>
+     5b8:	83 fb 2b             	cmp    $0x2b,%ebx
+     5bb:	75 b7                	jne    574 <parseredirs+0x39>
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+      break;
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     5bd:	83 ec 0c             	sub    $0xc,%esp
+     5c0:	6a 01                	push   $0x1
+     5c2:	68 01 02 00 00       	push   $0x201
+     5c7:	ff 75 e0             	push   -0x20(%ebp)
+     5ca:	ff 75 e4             	push   -0x1c(%ebp)
+     5cd:	ff 75 08             	push   0x8(%ebp)
+     5d0:	e8 7e fc ff ff       	call   253 <redircmd>
+     5d5:	89 45 08             	mov    %eax,0x8(%ebp)
+      break;
+     5d8:	83 c4 20             	add    $0x20,%esp
+     5db:	eb 97                	jmp    574 <parseredirs+0x39>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     5dd:	83 ec 0c             	sub    $0xc,%esp
+     5e0:	6a 01                	push   $0x1
+     5e2:	68 01 02 00 00       	push   $0x201
+     5e7:	ff 75 e0             	push   -0x20(%ebp)
+     5ea:	ff 75 e4             	push   -0x1c(%ebp)
+     5ed:	ff 75 08             	push   0x8(%ebp)
+     5f0:	e8 5e fc ff ff       	call   253 <redircmd>
+     5f5:	89 45 08             	mov    %eax,0x8(%ebp)
+      break;
+     5f8:	83 c4 20             	add    $0x20,%esp
+     5fb:	e9 74 ff ff ff       	jmp    574 <parseredirs+0x39>
+    }
+  }
+  return cmd;
+}
+     600:	8b 45 08             	mov    0x8(%ebp),%eax
+     603:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     606:	5b                   	pop    %ebx
+     607:	5e                   	pop    %esi
+     608:	5f                   	pop    %edi
+     609:	5d                   	pop    %ebp
+     60a:	c3                   	ret
+
+0000060b <parseexec>:
+  return cmd;
+}
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+     60b:	55                   	push   %ebp
+     60c:	89 e5                	mov    %esp,%ebp
+     60e:	57                   	push   %edi
+     60f:	56                   	push   %esi
+     610:	53                   	push   %ebx
+     611:	83 ec 30             	sub    $0x30,%esp
+     614:	8b 75 08             	mov    0x8(%ebp),%esi
+     617:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if(peek(ps, es, "("))
+     61a:	68 23 11 00 00       	push   $0x1123
+     61f:	57                   	push   %edi
+     620:	56                   	push   %esi
+     621:	e8 18 fe ff ff       	call   43e <peek>
+     626:	83 c4 10             	add    $0x10,%esp
+     629:	85 c0                	test   %eax,%eax
+     62b:	75 1d                	jne    64a <parseexec+0x3f>
+     62d:	89 c3                	mov    %eax,%ebx
+    return parseblock(ps, es);
+
+  ret = execcmd();
+     62f:	e8 f5 fb ff ff       	call   229 <execcmd>
+     634:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  cmd = (struct execcmd*)ret;
+
+  argc = 0;
+  ret = parseredirs(ret, ps, es);
+     637:	83 ec 04             	sub    $0x4,%esp
+     63a:	57                   	push   %edi
+     63b:	56                   	push   %esi
+     63c:	50                   	push   %eax
+     63d:	e8 f9 fe ff ff       	call   53b <parseredirs>
+     642:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     645:	83 c4 10             	add    $0x10,%esp
+     648:	eb 3b                	jmp    685 <parseexec+0x7a>
+    return parseblock(ps, es);
+     64a:	83 ec 08             	sub    $0x8,%esp
+     64d:	57                   	push   %edi
+     64e:	56                   	push   %esi
+     64f:	e8 8f 01 00 00       	call   7e3 <parseblock>
+     654:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     657:	83 c4 10             	add    $0x10,%esp
+    ret = parseredirs(ret, ps, es);
+  }
+  cmd->argv[argc] = 0;
+  cmd->eargv[argc] = 0;
+  return ret;
+}
+     65a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     65d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     660:	5b                   	pop    %ebx
+     661:	5e                   	pop    %esi
+     662:	5f                   	pop    %edi
+     663:	5d                   	pop    %ebp
+     664:	c3                   	ret
+      panic("syntax");
+     665:	83 ec 0c             	sub    $0xc,%esp
+     668:	68 25 11 00 00       	push   $0x1125
+     66d:	e8 d9 f9 ff ff       	call   4b <panic>
+    ret = parseredirs(ret, ps, es);
+     672:	83 ec 04             	sub    $0x4,%esp
+     675:	57                   	push   %edi
+     676:	56                   	push   %esi
+     677:	ff 75 d4             	push   -0x2c(%ebp)
+     67a:	e8 bc fe ff ff       	call   53b <parseredirs>
+     67f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     682:	83 c4 10             	add    $0x10,%esp
+  while(!peek(ps, es, "|)&;")){
+     685:	83 ec 04             	sub    $0x4,%esp
+     688:	68 3a 11 00 00       	push   $0x113a
+     68d:	57                   	push   %edi
+     68e:	56                   	push   %esi
+     68f:	e8 aa fd ff ff       	call   43e <peek>
+     694:	83 c4 10             	add    $0x10,%esp
+     697:	85 c0                	test   %eax,%eax
+     699:	75 41                	jne    6dc <parseexec+0xd1>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     69b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     69e:	50                   	push   %eax
+     69f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     6a2:	50                   	push   %eax
+     6a3:	57                   	push   %edi
+     6a4:	56                   	push   %esi
+     6a5:	e8 8d fc ff ff       	call   337 <gettoken>
+     6aa:	83 c4 10             	add    $0x10,%esp
+     6ad:	85 c0                	test   %eax,%eax
+     6af:	74 2b                	je     6dc <parseexec+0xd1>
+    if(tok != 'a')
+     6b1:	83 f8 61             	cmp    $0x61,%eax
+     6b4:	75 af                	jne    665 <parseexec+0x5a>
+    cmd->argv[argc] = q;
+     6b6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     6b9:	8b 55 d0             	mov    -0x30(%ebp),%edx
+     6bc:	89 44 9a 04          	mov    %eax,0x4(%edx,%ebx,4)
+    cmd->eargv[argc] = eq;
+     6c0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     6c3:	89 44 9a 2c          	mov    %eax,0x2c(%edx,%ebx,4)
+    argc++;
+     6c7:	83 c3 01             	add    $0x1,%ebx
+    if(argc >= MAXARGS)
+     6ca:	83 fb 09             	cmp    $0x9,%ebx
+     6cd:	7e a3                	jle    672 <parseexec+0x67>
+      panic("too many args");
+     6cf:	83 ec 0c             	sub    $0xc,%esp
+     6d2:	68 2c 11 00 00       	push   $0x112c
+     6d7:	e8 6f f9 ff ff       	call   4b <panic>
+  cmd->argv[argc] = 0;
+     6dc:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     6df:	c7 44 98 04 00 00 00 	movl   $0x0,0x4(%eax,%ebx,4)
+     6e6:	00 
+  cmd->eargv[argc] = 0;
+     6e7:	c7 44 98 2c 00 00 00 	movl   $0x0,0x2c(%eax,%ebx,4)
+     6ee:	00 
+  return ret;
+     6ef:	e9 66 ff ff ff       	jmp    65a <parseexec+0x4f>
+
+000006f4 <parsepipe>:
+{
+     6f4:	55                   	push   %ebp
+     6f5:	89 e5                	mov    %esp,%ebp
+     6f7:	57                   	push   %edi
+     6f8:	56                   	push   %esi
+     6f9:	53                   	push   %ebx
+     6fa:	83 ec 14             	sub    $0x14,%esp
+     6fd:	8b 75 08             	mov    0x8(%ebp),%esi
+     700:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parseexec(ps, es);
+     703:	57                   	push   %edi
+     704:	56                   	push   %esi
+     705:	e8 01 ff ff ff       	call   60b <parseexec>
+     70a:	89 c3                	mov    %eax,%ebx
+  if(peek(ps, es, "|")){
+     70c:	83 c4 0c             	add    $0xc,%esp
+     70f:	68 3f 11 00 00       	push   $0x113f
+     714:	57                   	push   %edi
+     715:	56                   	push   %esi
+     716:	e8 23 fd ff ff       	call   43e <peek>
+     71b:	83 c4 10             	add    $0x10,%esp
+     71e:	85 c0                	test   %eax,%eax
+     720:	75 0a                	jne    72c <parsepipe+0x38>
+}
+     722:	89 d8                	mov    %ebx,%eax
+     724:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     727:	5b                   	pop    %ebx
+     728:	5e                   	pop    %esi
+     729:	5f                   	pop    %edi
+     72a:	5d                   	pop    %ebp
+     72b:	c3                   	ret
+    gettoken(ps, es, 0, 0);
+     72c:	6a 00                	push   $0x0
+     72e:	6a 00                	push   $0x0
+     730:	57                   	push   %edi
+     731:	56                   	push   %esi
+     732:	e8 00 fc ff ff       	call   337 <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     737:	83 c4 08             	add    $0x8,%esp
+     73a:	57                   	push   %edi
+     73b:	56                   	push   %esi
+     73c:	e8 b3 ff ff ff       	call   6f4 <parsepipe>
+     741:	83 c4 08             	add    $0x8,%esp
+     744:	50                   	push   %eax
+     745:	53                   	push   %ebx
+     746:	e8 50 fb ff ff       	call   29b <pipecmd>
+     74b:	89 c3                	mov    %eax,%ebx
+     74d:	83 c4 10             	add    $0x10,%esp
+  return cmd;
+     750:	eb d0                	jmp    722 <parsepipe+0x2e>
+
+00000752 <parseline>:
+{
+     752:	55                   	push   %ebp
+     753:	89 e5                	mov    %esp,%ebp
+     755:	57                   	push   %edi
+     756:	56                   	push   %esi
+     757:	53                   	push   %ebx
+     758:	83 ec 14             	sub    $0x14,%esp
+     75b:	8b 75 08             	mov    0x8(%ebp),%esi
+     75e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parsepipe(ps, es);
+     761:	57                   	push   %edi
+     762:	56                   	push   %esi
+     763:	e8 8c ff ff ff       	call   6f4 <parsepipe>
+     768:	89 c3                	mov    %eax,%ebx
+  while(peek(ps, es, "&")){
+     76a:	83 c4 10             	add    $0x10,%esp
+     76d:	eb 18                	jmp    787 <parseline+0x35>
+    gettoken(ps, es, 0, 0);
+     76f:	6a 00                	push   $0x0
+     771:	6a 00                	push   $0x0
+     773:	57                   	push   %edi
+     774:	56                   	push   %esi
+     775:	e8 bd fb ff ff       	call   337 <gettoken>
+    cmd = backcmd(cmd);
+     77a:	89 1c 24             	mov    %ebx,(%esp)
+     77d:	e8 85 fb ff ff       	call   307 <backcmd>
+     782:	89 c3                	mov    %eax,%ebx
+     784:	83 c4 10             	add    $0x10,%esp
+  while(peek(ps, es, "&")){
+     787:	83 ec 04             	sub    $0x4,%esp
+     78a:	68 41 11 00 00       	push   $0x1141
+     78f:	57                   	push   %edi
+     790:	56                   	push   %esi
+     791:	e8 a8 fc ff ff       	call   43e <peek>
+     796:	83 c4 10             	add    $0x10,%esp
+     799:	85 c0                	test   %eax,%eax
+     79b:	75 d2                	jne    76f <parseline+0x1d>
+  if(peek(ps, es, ";")){
+     79d:	83 ec 04             	sub    $0x4,%esp
+     7a0:	68 3d 11 00 00       	push   $0x113d
+     7a5:	57                   	push   %edi
+     7a6:	56                   	push   %esi
+     7a7:	e8 92 fc ff ff       	call   43e <peek>
+     7ac:	83 c4 10             	add    $0x10,%esp
+     7af:	85 c0                	test   %eax,%eax
+     7b1:	75 0a                	jne    7bd <parseline+0x6b>
+}
+     7b3:	89 d8                	mov    %ebx,%eax
+     7b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     7b8:	5b                   	pop    %ebx
+     7b9:	5e                   	pop    %esi
+     7ba:	5f                   	pop    %edi
+     7bb:	5d                   	pop    %ebp
+     7bc:	c3                   	ret
+    gettoken(ps, es, 0, 0);
+     7bd:	6a 00                	push   $0x0
+     7bf:	6a 00                	push   $0x0
+     7c1:	57                   	push   %edi
+     7c2:	56                   	push   %esi
+     7c3:	e8 6f fb ff ff       	call   337 <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+     7c8:	83 c4 08             	add    $0x8,%esp
+     7cb:	57                   	push   %edi
+     7cc:	56                   	push   %esi
+     7cd:	e8 80 ff ff ff       	call   752 <parseline>
+     7d2:	83 c4 08             	add    $0x8,%esp
+     7d5:	50                   	push   %eax
+     7d6:	53                   	push   %ebx
+     7d7:	e8 f5 fa ff ff       	call   2d1 <listcmd>
+     7dc:	89 c3                	mov    %eax,%ebx
+     7de:	83 c4 10             	add    $0x10,%esp
+  return cmd;
+     7e1:	eb d0                	jmp    7b3 <parseline+0x61>
+
+000007e3 <parseblock>:
+{
+     7e3:	55                   	push   %ebp
+     7e4:	89 e5                	mov    %esp,%ebp
+     7e6:	57                   	push   %edi
+     7e7:	56                   	push   %esi
+     7e8:	53                   	push   %ebx
+     7e9:	83 ec 10             	sub    $0x10,%esp
+     7ec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     7ef:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(!peek(ps, es, "("))
+     7f2:	68 23 11 00 00       	push   $0x1123
+     7f7:	56                   	push   %esi
+     7f8:	53                   	push   %ebx
+     7f9:	e8 40 fc ff ff       	call   43e <peek>
+     7fe:	83 c4 10             	add    $0x10,%esp
+     801:	85 c0                	test   %eax,%eax
+     803:	74 4b                	je     850 <parseblock+0x6d>
+  gettoken(ps, es, 0, 0);
+     805:	6a 00                	push   $0x0
+     807:	6a 00                	push   $0x0
+     809:	56                   	push   %esi
+     80a:	53                   	push   %ebx
+     80b:	e8 27 fb ff ff       	call   337 <gettoken>
+  cmd = parseline(ps, es);
+     810:	83 c4 08             	add    $0x8,%esp
+     813:	56                   	push   %esi
+     814:	53                   	push   %ebx
+     815:	e8 38 ff ff ff       	call   752 <parseline>
+     81a:	89 c7                	mov    %eax,%edi
+  if(!peek(ps, es, ")"))
+     81c:	83 c4 0c             	add    $0xc,%esp
+     81f:	68 5f 11 00 00       	push   $0x115f
+     824:	56                   	push   %esi
+     825:	53                   	push   %ebx
+     826:	e8 13 fc ff ff       	call   43e <peek>
+     82b:	83 c4 10             	add    $0x10,%esp
+     82e:	85 c0                	test   %eax,%eax
+     830:	74 2b                	je     85d <parseblock+0x7a>
+  gettoken(ps, es, 0, 0);
+     832:	6a 00                	push   $0x0
+     834:	6a 00                	push   $0x0
+     836:	56                   	push   %esi
+     837:	53                   	push   %ebx
+     838:	e8 fa fa ff ff       	call   337 <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+     83d:	83 c4 0c             	add    $0xc,%esp
+     840:	56                   	push   %esi
+     841:	53                   	push   %ebx
+     842:	57                   	push   %edi
+     843:	e8 f3 fc ff ff       	call   53b <parseredirs>
+}
+     848:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     84b:	5b                   	pop    %ebx
+     84c:	5e                   	pop    %esi
+     84d:	5f                   	pop    %edi
+     84e:	5d                   	pop    %ebp
+     84f:	c3                   	ret
+    panic("parseblock");
+     850:	83 ec 0c             	sub    $0xc,%esp
+     853:	68 43 11 00 00       	push   $0x1143
+     858:	e8 ee f7 ff ff       	call   4b <panic>
+    panic("syntax - missing )");
+     85d:	83 ec 0c             	sub    $0xc,%esp
+     860:	68 4e 11 00 00       	push   $0x114e
+     865:	e8 e1 f7 ff ff       	call   4b <panic>
+
+0000086a <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+     86a:	55                   	push   %ebp
+     86b:	89 e5                	mov    %esp,%ebp
+     86d:	53                   	push   %ebx
+     86e:	83 ec 04             	sub    $0x4,%esp
+     871:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     874:	85 db                	test   %ebx,%ebx
+     876:	74 1f                	je     897 <nulterminate+0x2d>
+    return 0;
+
+  switch(cmd->type){
+     878:	8b 03                	mov    (%ebx),%eax
+     87a:	83 f8 05             	cmp    $0x5,%eax
+     87d:	77 18                	ja     897 <nulterminate+0x2d>
+     87f:	ff 24 85 a4 11 00 00 	jmp    *0x11a4(,%eax,4)
+  case EXEC:
+    ecmd = (struct execcmd*)cmd;
+    for(i=0; ecmd->argv[i]; i++)
+      *ecmd->eargv[i] = 0;
+     886:	8b 54 83 2c          	mov    0x2c(%ebx,%eax,4),%edx
+     88a:	c6 02 00             	movb   $0x0,(%edx)
+    for(i=0; ecmd->argv[i]; i++)
+     88d:	83 c0 01             	add    $0x1,%eax
+     890:	83 7c 83 04 00       	cmpl   $0x0,0x4(%ebx,%eax,4)
+     895:	75 ef                	jne    886 <nulterminate+0x1c>
+    bcmd = (struct backcmd*)cmd;
+    nulterminate(bcmd->cmd);
+    break;
+  }
+  return cmd;
+}
+     897:	89 d8                	mov    %ebx,%eax
+     899:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     89c:	c9                   	leave
+     89d:	c3                   	ret
+  switch(cmd->type){
+     89e:	b8 00 00 00 00       	mov    $0x0,%eax
+     8a3:	eb eb                	jmp    890 <nulterminate+0x26>
+    nulterminate(rcmd->cmd);
+     8a5:	83 ec 0c             	sub    $0xc,%esp
+     8a8:	ff 73 04             	push   0x4(%ebx)
+     8ab:	e8 ba ff ff ff       	call   86a <nulterminate>
+    *rcmd->efile = 0;
+     8b0:	8b 43 0c             	mov    0xc(%ebx),%eax
+     8b3:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+     8b6:	83 c4 10             	add    $0x10,%esp
+     8b9:	eb dc                	jmp    897 <nulterminate+0x2d>
+    nulterminate(pcmd->left);
+     8bb:	83 ec 0c             	sub    $0xc,%esp
+     8be:	ff 73 04             	push   0x4(%ebx)
+     8c1:	e8 a4 ff ff ff       	call   86a <nulterminate>
+    nulterminate(pcmd->right);
+     8c6:	83 c4 04             	add    $0x4,%esp
+     8c9:	ff 73 08             	push   0x8(%ebx)
+     8cc:	e8 99 ff ff ff       	call   86a <nulterminate>
+    break;
+     8d1:	83 c4 10             	add    $0x10,%esp
+     8d4:	eb c1                	jmp    897 <nulterminate+0x2d>
+    nulterminate(lcmd->left);
+     8d6:	83 ec 0c             	sub    $0xc,%esp
+     8d9:	ff 73 04             	push   0x4(%ebx)
+     8dc:	e8 89 ff ff ff       	call   86a <nulterminate>
+    nulterminate(lcmd->right);
+     8e1:	83 c4 04             	add    $0x4,%esp
+     8e4:	ff 73 08             	push   0x8(%ebx)
+     8e7:	e8 7e ff ff ff       	call   86a <nulterminate>
+    break;
+     8ec:	83 c4 10             	add    $0x10,%esp
+     8ef:	eb a6                	jmp    897 <nulterminate+0x2d>
+    nulterminate(bcmd->cmd);
+     8f1:	83 ec 0c             	sub    $0xc,%esp
+     8f4:	ff 73 04             	push   0x4(%ebx)
+     8f7:	e8 6e ff ff ff       	call   86a <nulterminate>
+    break;
+     8fc:	83 c4 10             	add    $0x10,%esp
+     8ff:	eb 96                	jmp    897 <nulterminate+0x2d>
+
+00000901 <parsecmd>:
+{
+     901:	55                   	push   %ebp
+     902:	89 e5                	mov    %esp,%ebp
+     904:	56                   	push   %esi
+     905:	53                   	push   %ebx
+  es = s + strlen(s);
+     906:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     909:	83 ec 0c             	sub    $0xc,%esp
+     90c:	53                   	push   %ebx
+     90d:	e8 eb 01 00 00       	call   afd <strlen>
+     912:	01 c3                	add    %eax,%ebx
+  cmd = parseline(&s, es);
+     914:	83 c4 08             	add    $0x8,%esp
+     917:	53                   	push   %ebx
+     918:	8d 45 08             	lea    0x8(%ebp),%eax
+     91b:	50                   	push   %eax
+     91c:	e8 31 fe ff ff       	call   752 <parseline>
+     921:	89 c6                	mov    %eax,%esi
+  peek(&s, es, "");
+     923:	83 c4 0c             	add    $0xc,%esp
+     926:	68 ed 10 00 00       	push   $0x10ed
+     92b:	53                   	push   %ebx
+     92c:	8d 45 08             	lea    0x8(%ebp),%eax
+     92f:	50                   	push   %eax
+     930:	e8 09 fb ff ff       	call   43e <peek>
+  if(s != es){
+     935:	8b 45 08             	mov    0x8(%ebp),%eax
+     938:	83 c4 10             	add    $0x10,%esp
+     93b:	39 d8                	cmp    %ebx,%eax
+     93d:	75 12                	jne    951 <parsecmd+0x50>
+  nulterminate(cmd);
+     93f:	83 ec 0c             	sub    $0xc,%esp
+     942:	56                   	push   %esi
+     943:	e8 22 ff ff ff       	call   86a <nulterminate>
+}
+     948:	89 f0                	mov    %esi,%eax
+     94a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     94d:	5b                   	pop    %ebx
+     94e:	5e                   	pop    %esi
+     94f:	5d                   	pop    %ebp
+     950:	c3                   	ret
+    printf(2, "leftovers: %s\n", s);
+     951:	83 ec 04             	sub    $0x4,%esp
+     954:	50                   	push   %eax
+     955:	68 61 11 00 00       	push   $0x1161
+     95a:	6a 02                	push   $0x2
+     95c:	e8 c6 04 00 00       	call   e27 <printf>
+    panic("syntax");
+     961:	c7 04 24 25 11 00 00 	movl   $0x1125,(%esp)
+     968:	e8 de f6 ff ff       	call   4b <panic>
+
+0000096d <main>:
+{
+     96d:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     971:	83 e4 f0             	and    $0xfffffff0,%esp
+     974:	ff 71 fc             	push   -0x4(%ecx)
+     977:	55                   	push   %ebp
+     978:	89 e5                	mov    %esp,%ebp
+     97a:	51                   	push   %ecx
+     97b:	83 ec 14             	sub    $0x14,%esp
+  while((fd = open("console", O_RDWR)) >= 0){
+     97e:	83 ec 08             	sub    $0x8,%esp
+     981:	6a 02                	push   $0x2
+     983:	68 70 11 00 00       	push   $0x1170
+     988:	e8 03 03 00 00       	call   c90 <open>
+     98d:	83 c4 10             	add    $0x10,%esp
+     990:	85 c0                	test   %eax,%eax
+     992:	78 3d                	js     9d1 <main+0x64>
+    if(fd >= 3){
+     994:	83 f8 02             	cmp    $0x2,%eax
+     997:	7e e5                	jle    97e <main+0x11>
+      close(fd);
+     999:	83 ec 0c             	sub    $0xc,%esp
+     99c:	50                   	push   %eax
+     99d:	e8 d6 02 00 00       	call   c78 <close>
+     9a2:	83 c4 10             	add    $0x10,%esp
+     9a5:	eb 2a                	jmp    9d1 <main+0x64>
+    if(simplecmd(buf)){
+     9a7:	83 ec 0c             	sub    $0xc,%esp
+     9aa:	68 e0 17 00 00       	push   $0x17e0
+     9af:	e8 f6 fa ff ff       	call   4aa <simplecmd>
+     9b4:	83 c4 10             	add    $0x10,%esp
+     9b7:	85 c0                	test   %eax,%eax
+     9b9:	0f 85 87 00 00 00    	jne    a46 <main+0xd9>
+    if(fork1() == 0)
+     9bf:	e8 a1 f6 ff ff       	call   65 <fork1>
+     9c4:	85 c0                	test   %eax,%eax
+     9c6:	0f 84 cb 00 00 00    	je     a97 <main+0x12a>
+    wait();
+     9cc:	e8 87 02 00 00       	call   c58 <wait>
+  while(getcmd(buf, sizeof(buf)) >= 0){
+     9d1:	83 ec 08             	sub    $0x8,%esp
+     9d4:	6a 64                	push   $0x64
+     9d6:	68 e0 17 00 00       	push   $0x17e0
+     9db:	e8 20 f6 ff ff       	call   0 <getcmd>
+     9e0:	83 c4 10             	add    $0x10,%esp
+     9e3:	85 c0                	test   %eax,%eax
+     9e5:	0f 88 c1 00 00 00    	js     aac <main+0x13f>
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+     9eb:	80 3d e0 17 00 00 63 	cmpb   $0x63,0x17e0
+     9f2:	75 b3                	jne    9a7 <main+0x3a>
+     9f4:	80 3d e1 17 00 00 64 	cmpb   $0x64,0x17e1
+     9fb:	75 aa                	jne    9a7 <main+0x3a>
+     9fd:	80 3d e2 17 00 00 20 	cmpb   $0x20,0x17e2
+     a04:	75 a1                	jne    9a7 <main+0x3a>
+      buf[strlen(buf)-1] = 0;  // chop \n
+     a06:	83 ec 0c             	sub    $0xc,%esp
+     a09:	68 e0 17 00 00       	push   $0x17e0
+     a0e:	e8 ea 00 00 00       	call   afd <strlen>
+     a13:	c6 80 df 17 00 00 00 	movb   $0x0,0x17df(%eax)
+      if(chdir(buf+3) < 0)
+     a1a:	c7 04 24 e3 17 00 00 	movl   $0x17e3,(%esp)
+     a21:	e8 9a 02 00 00       	call   cc0 <chdir>
+     a26:	83 c4 10             	add    $0x10,%esp
+     a29:	85 c0                	test   %eax,%eax
+     a2b:	79 a4                	jns    9d1 <main+0x64>
+        printf(2, "cannot cd %s\n", buf+3);
+     a2d:	83 ec 04             	sub    $0x4,%esp
+     a30:	68 e3 17 00 00       	push   $0x17e3
+     a35:	68 78 11 00 00       	push   $0x1178
+     a3a:	6a 02                	push   $0x2
+     a3c:	e8 e6 03 00 00       	call   e27 <printf>
+     a41:	83 c4 10             	add    $0x10,%esp
+      continue;
+     a44:	eb 8b                	jmp    9d1 <main+0x64>
+      cmd = parsecmd(buf);
+     a46:	83 ec 0c             	sub    $0xc,%esp
+     a49:	68 e0 17 00 00       	push   $0x17e0
+     a4e:	e8 ae fe ff ff       	call   901 <parsecmd>
+     a53:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     a56:	83 c4 10             	add    $0x10,%esp
+      pid = vfork();
+     a59:	e8 1a 03 00 00       	call   d78 <vfork>
+      if(pid == -1)
+     a5e:	83 f8 ff             	cmp    $0xffffffff,%eax
+     a61:	74 0f                	je     a72 <main+0x105>
+      if(pid == 0)
+     a63:	85 c0                	test   %eax,%eax
+     a65:	75 18                	jne    a7f <main+0x112>
+        runcmd(cmd);
+     a67:	83 ec 0c             	sub    $0xc,%esp
+     a6a:	ff 75 f4             	push   -0xc(%ebp)
+     a6d:	e8 12 f6 ff ff       	call   84 <runcmd>
+        panic("vfork");
+     a72:	83 ec 0c             	sub    $0xc,%esp
+     a75:	68 86 11 00 00       	push   $0x1186
+     a7a:	e8 cc f5 ff ff       	call   4b <panic>
+      wait();
+     a7f:	e8 d4 01 00 00       	call   c58 <wait>
+      free(cmd);
+     a84:	83 ec 0c             	sub    $0xc,%esp
+     a87:	ff 75 f4             	push   -0xc(%ebp)
+     a8a:	e8 fe 04 00 00       	call   f8d <free>
+     a8f:	83 c4 10             	add    $0x10,%esp
+     a92:	e9 3a ff ff ff       	jmp    9d1 <main+0x64>
+      runcmd(parsecmd(buf));
+     a97:	83 ec 0c             	sub    $0xc,%esp
+     a9a:	68 e0 17 00 00       	push   $0x17e0
+     a9f:	e8 5d fe ff ff       	call   901 <parsecmd>
+     aa4:	89 04 24             	mov    %eax,(%esp)
+     aa7:	e8 d8 f5 ff ff       	call   84 <runcmd>
+  exit();
+     aac:	e8 9f 01 00 00       	call   c50 <exit>
+
+00000ab1 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     ab1:	55                   	push   %ebp
+     ab2:	89 e5                	mov    %esp,%ebp
+     ab4:	56                   	push   %esi
+     ab5:	53                   	push   %ebx
+     ab6:	8b 75 08             	mov    0x8(%ebp),%esi
+     ab9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     abc:	89 f0                	mov    %esi,%eax
+     abe:	89 d1                	mov    %edx,%ecx
+     ac0:	83 c2 01             	add    $0x1,%edx
+     ac3:	89 c3                	mov    %eax,%ebx
+     ac5:	83 c0 01             	add    $0x1,%eax
+     ac8:	0f b6 09             	movzbl (%ecx),%ecx
+     acb:	88 0b                	mov    %cl,(%ebx)
+     acd:	84 c9                	test   %cl,%cl
+     acf:	75 ed                	jne    abe <strcpy+0xd>
+    ;
+  return os;
+}
+     ad1:	89 f0                	mov    %esi,%eax
+     ad3:	5b                   	pop    %ebx
+     ad4:	5e                   	pop    %esi
+     ad5:	5d                   	pop    %ebp
+     ad6:	c3                   	ret
+
+00000ad7 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     ad7:	55                   	push   %ebp
+     ad8:	89 e5                	mov    %esp,%ebp
+     ada:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     add:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+     ae0:	eb 06                	jmp    ae8 <strcmp+0x11>
+    p++, q++;
+     ae2:	83 c1 01             	add    $0x1,%ecx
+     ae5:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+     ae8:	0f b6 01             	movzbl (%ecx),%eax
+     aeb:	84 c0                	test   %al,%al
+     aed:	74 04                	je     af3 <strcmp+0x1c>
+     aef:	3a 02                	cmp    (%edx),%al
+     af1:	74 ef                	je     ae2 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+     af3:	0f b6 c0             	movzbl %al,%eax
+     af6:	0f b6 12             	movzbl (%edx),%edx
+     af9:	29 d0                	sub    %edx,%eax
+}
+     afb:	5d                   	pop    %ebp
+     afc:	c3                   	ret
+
+00000afd <strlen>:
+
+uint
+strlen(const char *s)
+{
+     afd:	55                   	push   %ebp
+     afe:	89 e5                	mov    %esp,%ebp
+     b00:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     b03:	b8 00 00 00 00       	mov    $0x0,%eax
+     b08:	eb 03                	jmp    b0d <strlen+0x10>
+     b0a:	83 c0 01             	add    $0x1,%eax
+     b0d:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     b11:	75 f7                	jne    b0a <strlen+0xd>
+    ;
+  return n;
+}
+     b13:	5d                   	pop    %ebp
+     b14:	c3                   	ret
+
+00000b15 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     b15:	55                   	push   %ebp
+     b16:	89 e5                	mov    %esp,%ebp
+     b18:	57                   	push   %edi
+     b19:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     b1c:	89 d7                	mov    %edx,%edi
+     b1e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     b21:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b24:	fc                   	cld
+     b25:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     b27:	89 d0                	mov    %edx,%eax
+     b29:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     b2c:	c9                   	leave
+     b2d:	c3                   	ret
+
+00000b2e <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     b2e:	55                   	push   %ebp
+     b2f:	89 e5                	mov    %esp,%ebp
+     b31:	8b 45 08             	mov    0x8(%ebp),%eax
+     b34:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     b38:	eb 03                	jmp    b3d <strchr+0xf>
+     b3a:	83 c0 01             	add    $0x1,%eax
+     b3d:	0f b6 10             	movzbl (%eax),%edx
+     b40:	84 d2                	test   %dl,%dl
+     b42:	74 06                	je     b4a <strchr+0x1c>
+    if(*s == c)
+     b44:	38 ca                	cmp    %cl,%dl
+     b46:	75 f2                	jne    b3a <strchr+0xc>
+     b48:	eb 05                	jmp    b4f <strchr+0x21>
+      return (char*)s;
+  return 0;
+     b4a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     b4f:	5d                   	pop    %ebp
+     b50:	c3                   	ret
+
+00000b51 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     b51:	55                   	push   %ebp
+     b52:	89 e5                	mov    %esp,%ebp
+     b54:	57                   	push   %edi
+     b55:	56                   	push   %esi
+     b56:	53                   	push   %ebx
+     b57:	83 ec 1c             	sub    $0x1c,%esp
+     b5a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     b5d:	bb 00 00 00 00       	mov    $0x0,%ebx
+     b62:	89 de                	mov    %ebx,%esi
+     b64:	83 c3 01             	add    $0x1,%ebx
+     b67:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     b6a:	7d 2e                	jge    b9a <gets+0x49>
+    cc = read(0, &c, 1);
+     b6c:	83 ec 04             	sub    $0x4,%esp
+     b6f:	6a 01                	push   $0x1
+     b71:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     b74:	50                   	push   %eax
+     b75:	6a 00                	push   $0x0
+     b77:	e8 ec 00 00 00       	call   c68 <read>
+    if(cc < 1)
+     b7c:	83 c4 10             	add    $0x10,%esp
+     b7f:	85 c0                	test   %eax,%eax
+     b81:	7e 17                	jle    b9a <gets+0x49>
+      break;
+    buf[i++] = c;
+     b83:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     b87:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     b8a:	3c 0a                	cmp    $0xa,%al
+     b8c:	0f 94 c2             	sete   %dl
+     b8f:	3c 0d                	cmp    $0xd,%al
+     b91:	0f 94 c0             	sete   %al
+     b94:	08 c2                	or     %al,%dl
+     b96:	74 ca                	je     b62 <gets+0x11>
+    buf[i++] = c;
+     b98:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     b9a:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     b9e:	89 f8                	mov    %edi,%eax
+     ba0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ba3:	5b                   	pop    %ebx
+     ba4:	5e                   	pop    %esi
+     ba5:	5f                   	pop    %edi
+     ba6:	5d                   	pop    %ebp
+     ba7:	c3                   	ret
+
+00000ba8 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     ba8:	55                   	push   %ebp
+     ba9:	89 e5                	mov    %esp,%ebp
+     bab:	56                   	push   %esi
+     bac:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     bad:	83 ec 08             	sub    $0x8,%esp
+     bb0:	6a 00                	push   $0x0
+     bb2:	ff 75 08             	push   0x8(%ebp)
+     bb5:	e8 d6 00 00 00       	call   c90 <open>
+  if(fd < 0)
+     bba:	83 c4 10             	add    $0x10,%esp
+     bbd:	85 c0                	test   %eax,%eax
+     bbf:	78 24                	js     be5 <stat+0x3d>
+     bc1:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+     bc3:	83 ec 08             	sub    $0x8,%esp
+     bc6:	ff 75 0c             	push   0xc(%ebp)
+     bc9:	50                   	push   %eax
+     bca:	e8 d9 00 00 00       	call   ca8 <fstat>
+     bcf:	89 c6                	mov    %eax,%esi
+  close(fd);
+     bd1:	89 1c 24             	mov    %ebx,(%esp)
+     bd4:	e8 9f 00 00 00       	call   c78 <close>
+  return r;
+     bd9:	83 c4 10             	add    $0x10,%esp
+}
+     bdc:	89 f0                	mov    %esi,%eax
+     bde:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     be1:	5b                   	pop    %ebx
+     be2:	5e                   	pop    %esi
+     be3:	5d                   	pop    %ebp
+     be4:	c3                   	ret
+    return -1;
+     be5:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     bea:	eb f0                	jmp    bdc <stat+0x34>
+
+00000bec <atoi>:
+
+int
+atoi(const char *s)
+{
+     bec:	55                   	push   %ebp
+     bed:	89 e5                	mov    %esp,%ebp
+     bef:	53                   	push   %ebx
+     bf0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+     bf3:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+     bf8:	eb 10                	jmp    c0a <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+     bfa:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+     bfd:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+     c00:	83 c1 01             	add    $0x1,%ecx
+     c03:	0f be c0             	movsbl %al,%eax
+     c06:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+     c0a:	0f b6 01             	movzbl (%ecx),%eax
+     c0d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     c10:	80 fb 09             	cmp    $0x9,%bl
+     c13:	76 e5                	jbe    bfa <atoi+0xe>
+  return n;
+}
+     c15:	89 d0                	mov    %edx,%eax
+     c17:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c1a:	c9                   	leave
+     c1b:	c3                   	ret
+
+00000c1c <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     c1c:	55                   	push   %ebp
+     c1d:	89 e5                	mov    %esp,%ebp
+     c1f:	56                   	push   %esi
+     c20:	53                   	push   %ebx
+     c21:	8b 75 08             	mov    0x8(%ebp),%esi
+     c24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     c27:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+     c2a:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+     c2c:	eb 0d                	jmp    c3b <memmove+0x1f>
+    *dst++ = *src++;
+     c2e:	0f b6 01             	movzbl (%ecx),%eax
+     c31:	88 02                	mov    %al,(%edx)
+     c33:	8d 49 01             	lea    0x1(%ecx),%ecx
+     c36:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+     c39:	89 d8                	mov    %ebx,%eax
+     c3b:	8d 58 ff             	lea    -0x1(%eax),%ebx
+     c3e:	85 c0                	test   %eax,%eax
+     c40:	7f ec                	jg     c2e <memmove+0x12>
+  return vdst;
+}
+     c42:	89 f0                	mov    %esi,%eax
+     c44:	5b                   	pop    %ebx
+     c45:	5e                   	pop    %esi
+     c46:	5d                   	pop    %ebp
+     c47:	c3                   	ret
+
+00000c48 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     c48:	b8 01 00 00 00       	mov    $0x1,%eax
+     c4d:	cd 40                	int    $0x40
+     c4f:	c3                   	ret
+
+00000c50 <exit>:
+SYSCALL(exit)
+     c50:	b8 02 00 00 00       	mov    $0x2,%eax
+     c55:	cd 40                	int    $0x40
+     c57:	c3                   	ret
+
+00000c58 <wait>:
+SYSCALL(wait)
+     c58:	b8 03 00 00 00       	mov    $0x3,%eax
+     c5d:	cd 40                	int    $0x40
+     c5f:	c3                   	ret
+
+00000c60 <pipe>:
+SYSCALL(pipe)
+     c60:	b8 04 00 00 00       	mov    $0x4,%eax
+     c65:	cd 40                	int    $0x40
+     c67:	c3                   	ret
+
+00000c68 <read>:
+SYSCALL(read)
+     c68:	b8 05 00 00 00       	mov    $0x5,%eax
+     c6d:	cd 40                	int    $0x40
+     c6f:	c3                   	ret
+
+00000c70 <write>:
+SYSCALL(write)
+     c70:	b8 10 00 00 00       	mov    $0x10,%eax
+     c75:	cd 40                	int    $0x40
+     c77:	c3                   	ret
+
+00000c78 <close>:
+SYSCALL(close)
+     c78:	b8 15 00 00 00       	mov    $0x15,%eax
+     c7d:	cd 40                	int    $0x40
+     c7f:	c3                   	ret
+
+00000c80 <kill>:
+SYSCALL(kill)
+     c80:	b8 06 00 00 00       	mov    $0x6,%eax
+     c85:	cd 40                	int    $0x40
+     c87:	c3                   	ret
+
+00000c88 <exec>:
+SYSCALL(exec)
+     c88:	b8 07 00 00 00       	mov    $0x7,%eax
+     c8d:	cd 40                	int    $0x40
+     c8f:	c3                   	ret
+
+00000c90 <open>:
+SYSCALL(open)
+     c90:	b8 0f 00 00 00       	mov    $0xf,%eax
+     c95:	cd 40                	int    $0x40
+     c97:	c3                   	ret
+
+00000c98 <mknod>:
+SYSCALL(mknod)
+     c98:	b8 11 00 00 00       	mov    $0x11,%eax
+     c9d:	cd 40                	int    $0x40
+     c9f:	c3                   	ret
+
+00000ca0 <unlink>:
+SYSCALL(unlink)
+     ca0:	b8 12 00 00 00       	mov    $0x12,%eax
+     ca5:	cd 40                	int    $0x40
+     ca7:	c3                   	ret
+
+00000ca8 <fstat>:
+SYSCALL(fstat)
+     ca8:	b8 08 00 00 00       	mov    $0x8,%eax
+     cad:	cd 40                	int    $0x40
+     caf:	c3                   	ret
+
+00000cb0 <link>:
+SYSCALL(link)
+     cb0:	b8 13 00 00 00       	mov    $0x13,%eax
+     cb5:	cd 40                	int    $0x40
+     cb7:	c3                   	ret
+
+00000cb8 <mkdir>:
+SYSCALL(mkdir)
+     cb8:	b8 14 00 00 00       	mov    $0x14,%eax
+     cbd:	cd 40                	int    $0x40
+     cbf:	c3                   	ret
+
+00000cc0 <chdir>:
+SYSCALL(chdir)
+     cc0:	b8 09 00 00 00       	mov    $0x9,%eax
+     cc5:	cd 40                	int    $0x40
+     cc7:	c3                   	ret
+
+00000cc8 <dup>:
+SYSCALL(dup)
+     cc8:	b8 0a 00 00 00       	mov    $0xa,%eax
+     ccd:	cd 40                	int    $0x40
+     ccf:	c3                   	ret
+
+00000cd0 <getpid>:
+SYSCALL(getpid)
+     cd0:	b8 0b 00 00 00       	mov    $0xb,%eax
+     cd5:	cd 40                	int    $0x40
+     cd7:	c3                   	ret
+
+00000cd8 <sbrk>:
+SYSCALL(sbrk)
+     cd8:	b8 0c 00 00 00       	mov    $0xc,%eax
+     cdd:	cd 40                	int    $0x40
+     cdf:	c3                   	ret
+
+00000ce0 <sleep>:
+SYSCALL(sleep)
+     ce0:	b8 0d 00 00 00       	mov    $0xd,%eax
+     ce5:	cd 40                	int    $0x40
+     ce7:	c3                   	ret
+
+00000ce8 <uptime>:
+SYSCALL(uptime)
+     ce8:	b8 0e 00 00 00       	mov    $0xe,%eax
+     ced:	cd 40                	int    $0x40
+     cef:	c3                   	ret
+
+00000cf0 <setpri>:
+SYSCALL(setpri)
+     cf0:	b8 16 00 00 00       	mov    $0x16,%eax
+     cf5:	cd 40                	int    $0x40
+     cf7:	c3                   	ret
+
+00000cf8 <getpri>:
+SYSCALL(getpri)
+     cf8:	b8 17 00 00 00       	mov    $0x17,%eax
+     cfd:	cd 40                	int    $0x40
+     cff:	c3                   	ret
+
+00000d00 <fork2>:
+SYSCALL(fork2)
+     d00:	b8 18 00 00 00       	mov    $0x18,%eax
+     d05:	cd 40                	int    $0x40
+     d07:	c3                   	ret
+
+00000d08 <getpinfo>:
+SYSCALL(getpinfo)
+     d08:	b8 19 00 00 00       	mov    $0x19,%eax
+     d0d:	cd 40                	int    $0x40
+     d0f:	c3                   	ret
+
+00000d10 <spawn>:
+SYSCALL(spawn)
+     d10:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     d15:	cd 40                	int    $0x40
+     d17:	c3                   	ret
+
+00000d18 <spawnn>:
+SYSCALL(spawnn)
+     d18:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     d1d:	cd 40                	int    $0x40
+     d1f:	c3                   	ret
+
+00000d20 <kmstat>:
+SYSCALL(kmstat)
+     d20:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     d25:	cd 40                	int    $0x40
+     d27:	c3                   	ret
+
+00000d28 <slabstat>:
+SYSCALL(slabstat)
+     d28:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     d2d:	cd 40                	int    $0x40
+     d2f:	c3                   	ret
+
+00000d30 <shmget>:
+SYSCALL(shmget)
+     d30:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     d35:	cd 40                	int    $0x40
+     d37:	c3                   	ret
+
+00000d38 <shmat>:
+SYSCALL(shmat)
+     d38:	b8 20 00 00 00       	mov    $0x20,%eax
+     d3d:	cd 40                	int    $0x40
+     d3f:	c3                   	ret
+
+00000d40 <shmdt>:
+SYSCALL(shmdt)
+     d40:	b8 21 00 00 00       	mov    $0x21,%eax
+     d45:	cd 40                	int    $0x40
+     d47:	c3                   	ret
+
+00000d48 <mmap>:
+SYSCALL(mmap)
+     d48:	b8 22 00 00 00       	mov    $0x22,%eax
+     d4d:	cd 40                	int    $0x40
+     d4f:	c3                   	ret
+
+00000d50 <munmap>:
+SYSCALL(munmap)
+     d50:	b8 23 00 00 00       	mov    $0x23,%eax
+     d55:	cd 40                	int    $0x40
+     d57:	c3                   	ret
+
+00000d58 <bstat>:
+SYSCALL(bstat)
+     d58:	b8 24 00 00 00       	mov    $0x24,%eax
+     d5d:	cd 40                	int    $0x40
+     d5f:	c3                   	ret
+
+00000d60 <aread>:
+SYSCALL(aread)
+     d60:	b8 25 00 00 00       	mov    $0x25,%eax
+     d65:	cd 40                	int    $0x40
+     d67:	c3                   	ret
+
+00000d68 <await>:
+SYSCALL(await)
+     d68:	b8 26 00 00 00       	mov    $0x26,%eax
+     d6d:	cd 40                	int    $0x40
+     d6f:	c3                   	ret
+
+00000d70 <bdrop>:
+SYSCALL(bdrop)
+     d70:	b8 27 00 00 00       	mov    $0x27,%eax
+     d75:	cd 40                	int    $0x40
+     d77:	c3                   	ret
+
+00000d78 <vfork>:
+# exec or exit, and its ret would leave the slot holding our
+# return address free for it to overwrite.  Keep the return
+# address in %ecx, which the kernel restores for both sides.
+.globl vfork
+vfork:
+  popl %ecx
+     d78:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+     d79:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  int $T_SYSCALL
+     d7e:	cd 40                	int    $0x40
+  pushl %ecx
+     d80:	51                   	push   %ecx
+  ret
+     d81:	c3                   	ret
+
+00000d82 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+     d82:	55                   	push   %ebp
+     d83:	89 e5                	mov    %esp,%ebp
+     d85:	83 ec 1c             	sub    $0x1c,%esp
+     d88:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+     d8b:	6a 01                	push   $0x1
+     d8d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+     d90:	52                   	push   %edx
+     d91:	50                   	push   %eax
+     d92:	e8 d9 fe ff ff       	call   c70 <write>
+}
+     d97:	83 c4 10             	add    $0x10,%esp
+     d9a:	c9                   	leave
+     d9b:	c3                   	ret
+
+00000d9c <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     d9c:	55                   	push   %ebp
+     d9d:	89 e5                	mov    %esp,%ebp
+     d9f:	57                   	push   %edi
+     da0:	56                   	push   %esi
+     da1:	53                   	push   %ebx
+     da2:	83 ec 2c             	sub    $0x2c,%esp
+     da5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     da8:	89 d0                	mov    %edx,%eax
+     daa:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     dac:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     db0:	0f 95 c1             	setne  %cl
+     db3:	c1 ea 1f             	shr    $0x1f,%edx
+     db6:	84 d1                	test   %dl,%cl
+     db8:	74 44                	je     dfe <printint+0x62>
+    neg = 1;
+    x = -xx;
+     dba:	f7 d8                	neg    %eax
+     dbc:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+     dbe:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     dc5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     dca:	89 c8                	mov    %ecx,%eax
+     dcc:	ba 00 00 00 00       	mov    $0x0,%edx
+     dd1:	f7 f6                	div    %esi
+     dd3:	89 df                	mov    %ebx,%edi
+     dd5:	83 c3 01             	add    $0x1,%ebx
+     dd8:	0f b6 92 1c 12 00 00 	movzbl 0x121c(%edx),%edx
+     ddf:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+     de3:	89 ca                	mov    %ecx,%edx
+     de5:	89 c1                	mov    %eax,%ecx
+     de7:	39 f2                	cmp    %esi,%edx
+     de9:	73 df                	jae    dca <printint+0x2e>
+  if(neg)
+     deb:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     def:	74 31                	je     e22 <printint+0x86>
+    buf[i++] = '-';
+     df1:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+     df6:	8d 5f 02             	lea    0x2(%edi),%ebx
+     df9:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     dfc:	eb 17                	jmp    e15 <printint+0x79>
+    x = xx;
+     dfe:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+     e00:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     e07:	eb bc                	jmp    dc5 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     e09:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+     e0e:	89 f0                	mov    %esi,%eax
+     e10:	e8 6d ff ff ff       	call   d82 <putc>
+  while(--i >= 0)
+     e15:	83 eb 01             	sub    $0x1,%ebx
+     e18:	79 ef                	jns    e09 <printint+0x6d>
+}
+     e1a:	83 c4 2c             	add    $0x2c,%esp
+     e1d:	5b                   	pop    %ebx
+     e1e:	5e                   	pop    %esi
+     e1f:	5f                   	pop    %edi
+     e20:	5d                   	pop    %ebp
+     e21:	c3                   	ret
+     e22:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     e25:	eb ee                	jmp    e15 <printint+0x79>
+
+00000e27 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     e27:	55                   	push   %ebp
+     e28:	89 e5                	mov    %esp,%ebp
+     e2a:	57                   	push   %edi
+     e2b:	56                   	push   %esi
+     e2c:	53                   	push   %ebx
+     e2d:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+     e30:	8d 45 10             	lea    0x10(%ebp),%eax
+     e33:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+     e36:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+     e3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+     e40:	eb 14                	jmp    e56 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+     e42:	89 fa                	mov    %edi,%edx
+     e44:	8b 45 08             	mov    0x8(%ebp),%eax
+     e47:	e8 36 ff ff ff       	call   d82 <putc>
+     e4c:	eb 05                	jmp    e53 <printf+0x2c>
+      }
+    } else if(state == '%'){
+     e4e:	83 fe 25             	cmp    $0x25,%esi
+     e51:	74 25                	je     e78 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+     e53:	83 c3 01             	add    $0x1,%ebx
+     e56:	8b 45 0c             	mov    0xc(%ebp),%eax
+     e59:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+     e5d:	84 c0                	test   %al,%al
+     e5f:	0f 84 20 01 00 00    	je     f85 <printf+0x15e>
+    c = fmt[i] & 0xff;
+     e65:	0f be f8             	movsbl %al,%edi
+     e68:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     e6b:	85 f6                	test   %esi,%esi
+     e6d:	75 df                	jne    e4e <printf+0x27>
+      if(c == '%'){
+     e6f:	83 f8 25             	cmp    $0x25,%eax
+     e72:	75 ce                	jne    e42 <printf+0x1b>
+        state = '%';
+     e74:	89 c6                	mov    %eax,%esi
+     e76:	eb db                	jmp    e53 <printf+0x2c>
+      if(c == 'd'){
+     e78:	83 f8 25             	cmp    $0x25,%eax
+     e7b:	0f 84 cf 00 00 00    	je     f50 <printf+0x129>
+     e81:	0f 8c dd 00 00 00    	jl     f64 <printf+0x13d>
+     e87:	83 f8 78             	cmp    $0x78,%eax
+     e8a:	0f 8f d4 00 00 00    	jg     f64 <printf+0x13d>
+     e90:	83 f8 63             	cmp    $0x63,%eax
+     e93:	0f 8c cb 00 00 00    	jl     f64 <printf+0x13d>
+     e99:	83 e8 63             	sub    $0x63,%eax
+     e9c:	83 f8 15             	cmp    $0x15,%eax
+     e9f:	0f 87 bf 00 00 00    	ja     f64 <printf+0x13d>
+     ea5:	ff 24 85 c4 11 00 00 	jmp    *0x11c4(,%eax,4)
+        printint(fd, *ap, 10, 1);
+     eac:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     eaf:	8b 17                	mov    (%edi),%edx
+     eb1:	83 ec 0c             	sub    $0xc,%esp
+     eb4:	6a 01                	push   $0x1
+     eb6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     ebb:	8b 45 08             	mov    0x8(%ebp),%eax
+     ebe:	e8 d9 fe ff ff       	call   d9c <printint>
+        ap++;
+     ec3:	83 c7 04             	add    $0x4,%edi
+     ec6:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     ec9:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+     ecc:	be 00 00 00 00       	mov    $0x0,%esi
+     ed1:	eb 80                	jmp    e53 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+     ed3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     ed6:	8b 17                	mov    (%edi),%edx
+     ed8:	83 ec 0c             	sub    $0xc,%esp
+     edb:	6a 00                	push   $0x0
+     edd:	b9 10 00 00 00       	mov    $0x10,%ecx
+     ee2:	8b 45 08             	mov    0x8(%ebp),%eax
+     ee5:	e8 b2 fe ff ff       	call   d9c <printint>
+        ap++;
+     eea:	83 c7 04             	add    $0x4,%edi
+     eed:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     ef0:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     ef3:	be 00 00 00 00       	mov    $0x0,%esi
+     ef8:	e9 56 ff ff ff       	jmp    e53 <printf+0x2c>
+        s = (char*)*ap;
+     efd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     f00:	8b 30                	mov    (%eax),%esi
+        ap++;
+     f02:	83 c0 04             	add    $0x4,%eax
+     f05:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+     f08:	85 f6                	test   %esi,%esi
+     f0a:	75 15                	jne    f21 <printf+0xfa>
+          s = "(null)";
+     f0c:	be bc 11 00 00       	mov    $0x11bc,%esi
+     f11:	eb 0e                	jmp    f21 <printf+0xfa>
+          putc(fd, *s);
+     f13:	0f be d2             	movsbl %dl,%edx
+     f16:	8b 45 08             	mov    0x8(%ebp),%eax
+     f19:	e8 64 fe ff ff       	call   d82 <putc>
+          s++;
+     f1e:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+     f21:	0f b6 16             	movzbl (%esi),%edx
+     f24:	84 d2                	test   %dl,%dl
+     f26:	75 eb                	jne    f13 <printf+0xec>
+      state = 0;
+     f28:	be 00 00 00 00       	mov    $0x0,%esi
+     f2d:	e9 21 ff ff ff       	jmp    e53 <printf+0x2c>
+        putc(fd, *ap);
+     f32:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     f35:	0f be 17             	movsbl (%edi),%edx
+     f38:	8b 45 08             	mov    0x8(%ebp),%eax
+     f3b:	e8 42 fe ff ff       	call   d82 <putc>
+        ap++;
+     f40:	83 c7 04             	add    $0x4,%edi
+     f43:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+     f46:	be 00 00 00 00       	mov    $0x0,%esi
+     f4b:	e9 03 ff ff ff       	jmp    e53 <printf+0x2c>
+        putc(fd, c);
+     f50:	89 fa                	mov    %edi,%edx
+     f52:	8b 45 08             	mov    0x8(%ebp),%eax
+     f55:	e8 28 fe ff ff       	call   d82 <putc>
+      state = 0;
+     f5a:	be 00 00 00 00       	mov    $0x0,%esi
+     f5f:	e9 ef fe ff ff       	jmp    e53 <printf+0x2c>
+        putc(fd, '%');
+     f64:	ba 25 00 00 00       	mov    $0x25,%edx
+     f69:	8b 45 08             	mov    0x8(%ebp),%eax
+     f6c:	e8 11 fe ff ff       	call   d82 <putc>
+        putc(fd, c);
+     f71:	89 fa                	mov    %edi,%edx
+     f73:	8b 45 08             	mov    0x8(%ebp),%eax
+     f76:	e8 07 fe ff ff       	call   d82 <putc>
+      state = 0;
+     f7b:	be 00 00 00 00       	mov    $0x0,%esi
+     f80:	e9 ce fe ff ff       	jmp    e53 <printf+0x2c>
+    }
+  }
+}
+     f85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f88:	5b                   	pop    %ebx
+     f89:	5e                   	pop    %esi
+     f8a:	5f                   	pop    %edi
+     f8b:	5d                   	pop    %ebp
+     f8c:	c3                   	ret
+
+00000f8d <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     f8d:	55                   	push   %ebp
+     f8e:	89 e5                	mov    %esp,%ebp
+     f90:	57                   	push   %edi
+     f91:	56                   	push   %esi
+     f92:	53                   	push   %ebx
+     f93:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     f96:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f99:	a1 44 18 00 00       	mov    0x1844,%eax
+     f9e:	eb 02                	jmp    fa2 <free+0x15>
+     fa0:	89 d0                	mov    %edx,%eax
+     fa2:	39 c8                	cmp    %ecx,%eax
+     fa4:	73 04                	jae    faa <free+0x1d>
+     fa6:	3b 08                	cmp    (%eax),%ecx
+     fa8:	72 12                	jb     fbc <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     faa:	8b 10                	mov    (%eax),%edx
+     fac:	39 d0                	cmp    %edx,%eax
+     fae:	72 f0                	jb     fa0 <free+0x13>
+     fb0:	39 c8                	cmp    %ecx,%eax
+     fb2:	72 08                	jb     fbc <free+0x2f>
+     fb4:	39 d1                	cmp    %edx,%ecx
+     fb6:	72 04                	jb     fbc <free+0x2f>
+     fb8:	89 d0                	mov    %edx,%eax
+     fba:	eb e6                	jmp    fa2 <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     fbc:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     fbf:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     fc2:	8b 10                	mov    (%eax),%edx
+     fc4:	39 d7                	cmp    %edx,%edi
+     fc6:	74 19                	je     fe1 <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+     fc8:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     fcb:	8b 50 04             	mov    0x4(%eax),%edx
+     fce:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+     fd1:	39 ce                	cmp    %ecx,%esi
+     fd3:	74 1b                	je     ff0 <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+     fd5:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+     fd7:	a3 44 18 00 00       	mov    %eax,0x1844
+}
+     fdc:	5b                   	pop    %ebx
+     fdd:	5e                   	pop    %esi
+     fde:	5f                   	pop    %edi
+     fdf:	5d                   	pop    %ebp
+     fe0:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+     fe1:	03 72 04             	add    0x4(%edx),%esi
+     fe4:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     fe7:	8b 10                	mov    (%eax),%edx
+     fe9:	8b 12                	mov    (%edx),%edx
+     feb:	89 53 f8             	mov    %edx,-0x8(%ebx)
+     fee:	eb db                	jmp    fcb <free+0x3e>
+    p->s.size += bp->s.size;
+     ff0:	03 53 fc             	add    -0x4(%ebx),%edx
+     ff3:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+     ff6:	8b 53 f8             	mov    -0x8(%ebx),%edx
+     ff9:	89 10                	mov    %edx,(%eax)
+     ffb:	eb da                	jmp    fd7 <free+0x4a>
+
+00000ffd <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+     ffd:	55                   	push   %ebp
+     ffe:	89 e5                	mov    %esp,%ebp
+    1000:	53                   	push   %ebx
+    1001:	83 ec 04             	sub    $0x4,%esp
+    1004:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    1006:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+    100b:	77 05                	ja     1012 <morecore+0x15>
+    nu = 4096;
+    100d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1012:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+    1019:	83 ec 0c             	sub    $0xc,%esp
+    101c:	50                   	push   %eax
+    101d:	e8 b6 fc ff ff       	call   cd8 <sbrk>
+  if(p == (char*)-1)
+    1022:	83 c4 10             	add    $0x10,%esp
+    1025:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1028:	74 1c                	je     1046 <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+    102a:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    102d:	83 c0 08             	add    $0x8,%eax
+    1030:	83 ec 0c             	sub    $0xc,%esp
+    1033:	50                   	push   %eax
+    1034:	e8 54 ff ff ff       	call   f8d <free>
+  return freep;
+    1039:	a1 44 18 00 00       	mov    0x1844,%eax
+    103e:	83 c4 10             	add    $0x10,%esp
+}
+    1041:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1044:	c9                   	leave
+    1045:	c3                   	ret
+    return 0;
+    1046:	b8 00 00 00 00       	mov    $0x0,%eax
+    104b:	eb f4                	jmp    1041 <morecore+0x44>
+
+0000104d <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    104d:	55                   	push   %ebp
+    104e:	89 e5                	mov    %esp,%ebp
+    1050:	53                   	push   %ebx
+    1051:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1054:	8b 45 08             	mov    0x8(%ebp),%eax
+    1057:	8d 58 07             	lea    0x7(%eax),%ebx
+    105a:	c1 eb 03             	shr    $0x3,%ebx
+    105d:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+    1060:	8b 0d 44 18 00 00    	mov    0x1844,%ecx
+    1066:	85 c9                	test   %ecx,%ecx
+    1068:	74 04                	je     106e <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    106a:	8b 01                	mov    (%ecx),%eax
+    106c:	eb 4a                	jmp    10b8 <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+    106e:	c7 05 44 18 00 00 48 	movl   $0x1848,0x1844
+    1075:	18 00 00 
+    1078:	c7 05 48 18 00 00 48 	movl   $0x1848,0x1848
+    107f:	18 00 00 
+    base.s.size = 0;
+    1082:	c7 05 4c 18 00 00 00 	movl   $0x0,0x184c
+    1089:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+    108c:	b9 48 18 00 00       	mov    $0x1848,%ecx
+    1091:	eb d7                	jmp    106a <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+    1093:	74 19                	je     10ae <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+    1095:	29 da                	sub    %ebx,%edx
+    1097:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    109a:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+    109d:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+    10a0:	89 0d 44 18 00 00    	mov    %ecx,0x1844
+      return (void*)(p + 1);
+    10a6:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+    10a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10ac:	c9                   	leave
+    10ad:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+    10ae:	8b 10                	mov    (%eax),%edx
+    10b0:	89 11                	mov    %edx,(%ecx)
+    10b2:	eb ec                	jmp    10a0 <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    10b4:	89 c1                	mov    %eax,%ecx
+    10b6:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+    10b8:	8b 50 04             	mov    0x4(%eax),%edx
+    10bb:	39 da                	cmp    %ebx,%edx
+    10bd:	73 d4                	jae    1093 <malloc+0x46>
+    if(p == freep)
+    10bf:	39 05 44 18 00 00    	cmp    %eax,0x1844
+    10c5:	75 ed                	jne    10b4 <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+    10c7:	89 d8                	mov    %ebx,%eax
+    10c9:	e8 2f ff ff ff       	call   ffd <morecore>
+    10ce:	85 c0                	test   %eax,%eax
+    10d0:	75 e2                	jne    10b4 <malloc+0x67>
+    10d2:	eb d5                	jmp    10a9 <malloc+0x5c>
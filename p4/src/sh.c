@@ -52,6 +52,7 @@ struct backcmd {
 int fork1(void);  // Fork but panics on failure.
 void panic(char*);
 struct cmd *parsecmd(char*);
+int simplecmd(char*);
 
 // Execute cmd.  Never returns.
 void
@@ -145,7 +146,8 @@ int
 main(void)
 {
   static char buf[100];
-  int fd;
+  int fd, pid;
+  struct cmd *cmd;
 
   // Ensure that three file descriptors are open.
   while((fd = open("console", O_RDWR)) >= 0){
@@ -164,6 +166,19 @@ main(void)
         printf(2, "cannot cd %s\n", buf+3);
       continue;
     }
+    if(simplecmd(buf)){
+      // Plain "prog args": parse here and let a vfork child
+      // exec it, rather than copying the shell for the child.
+      cmd = parsecmd(buf);
+      pid = vfork();
+      if(pid == -1)
+        panic("vfork");
+      if(pid == 0)
+        runcmd(cmd);
+      wait();
+      free(cmd);
+      continue;
+    }
     if(fork1() == 0)
       runcmd(parsecmd(buf));
     wait();
@@ -322,6 +337,28 @@ struct cmd *parsepipe(char**, char*);
 struct cmd *parseexec(char**, char*);
 struct cmd *nulterminate(struct cmd*);
 
+// Can s be parsed as a single command with no redirection,
+// pipes or lists?  Such a command can't fail to parse, and
+// parsing it allocates only the execcmd itself.
+int
+simplecmd(char *s)
+{
+  int n;
+
+  for(n = 0; *s; n++){
+    while(*s && strchr(whitespace, *s))
+      s++;
+    if(*s == 0)
+      break;
+    while(*s && !strchr(whitespace, *s)){
+      if(strchr(symbols, *s))
+        return 0;
+      s++;
+    }
+  }
+  return n < MAXARGS;
+}
+
 struct cmd*
 parsecmd(char *s)
 {
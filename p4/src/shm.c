@@ -0,0 +1,235 @@
+// Shared memory segments.
+//
+// A segment is a named set of zeroed pages.  shmat() maps all
+// of a segment's pages, writable, into the caller's address
+// space above the heap and records the attachment as a vma;
+// fork() passes attachments on to the child (sharing, not
+// copying, the pages), and exec() and exit() drop them.
+//
+// The segment holds one reference to each of its pages and
+// every mapping holds another, so freevm() and deallocuvm()
+// release mapped pages with plain kfree().  A process that
+// gets a segment's id holds it until exec() or exit(), so a
+// segment is freed when it has neither attachments nor
+// holders.  An id includes the slot's generation, so an id
+// kept past its segment's end can't attach the slot's next
+// segment.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+
+struct shm {
+  char name[SHMNAME];
+  int npage;              // 0 if this slot is unused
+  int nattach;            // # of vmas referring to this segment
+  int nhold;              // # of processes holding its id
+  int gen;                // bumped each time the slot is reused
+  char *page[SHMMAXPG];
+};
+
+#define SHMMAXGEN (0x7fffffff / NSHM)
+
+struct {
+  struct spinlock lock;
+  struct shm seg[NSHM];
+} shmtab;
+
+void
+shminit(void)
+{
+  initlock(&shmtab.lock, "shm");
+}
+
+// Free s if nothing refers to it.  Caller must hold shmtab.lock.
+static void
+shmfree(struct shm *s)
+{
+  int i;
+
+  if(s->nattach > 0 || s->nhold > 0)
+    return;
+  for(i = 0; i < s->npage; i++)
+    kfree(s->page[i]);
+  s->npage = 0;
+}
+
+// Record that the current process holds segment s, and
+// return its id.  Caller must hold shmtab.lock.
+static int
+shmhold(struct shm *s)
+{
+  struct proc *curproc = myproc();
+  int i;
+
+  i = s - shmtab.seg;
+  if(!(curproc->shmheld & (1 << i))){
+    curproc->shmheld |= 1 << i;
+    s->nhold++;
+  }
+  return s->gen * NSHM + i;
+}
+
+// Return the live segment with the given id, or 0.
+// Caller must hold shmtab.lock.
+static struct shm*
+shmlookup(int id)
+{
+  struct shm *s;
+
+  if(id < 0)
+    return 0;
+  s = &shmtab.seg[id % NSHM];
+  if(s->npage == 0 || s->gen != id / NSHM)
+    return 0;
+  return s;
+}
+
+// Return the id of the segment called name, creating it
+// with npage zeroed pages if there is none.  An existing
+// segment must have npage pages, or npage may be 0.
+// Returns -1 on error.
+int
+shmget(char *name, int npage)
+{
+  struct shm *s, *free;
+  int i, id;
+
+  if(npage < 0 || npage > SHMMAXPG)
+    return -1;
+  acquire(&shmtab.lock);
+  free = 0;
+  for(s = shmtab.seg; s < &shmtab.seg[NSHM]; s++){
+    if(s->npage == 0){
+      if(free == 0)
+        free = s;
+    } else if(strncmp(s->name, name, SHMNAME) == 0){
+      id = -1;
+      if(npage == 0 || npage == s->npage)
+        id = shmhold(s);
+      release(&shmtab.lock);
+      return id;
+    }
+  }
+  if(free == 0 || npage == 0){
+    release(&shmtab.lock);
+    return -1;
+  }
+  s = free;
+  for(i = 0; i < npage; i++){
+    if((s->page[i] = kalloc_zeroed()) == 0){
+      while(--i >= 0)
+        kfree(s->page[i]);
+      release(&shmtab.lock);
+      return -1;
+    }
+  }
+  safestrcpy(s->name, name, SHMNAME);
+  s->npage = npage;
+  s->nattach = 0;
+  s->nhold = 0;
+  s->gen = (s->gen + 1) % SHMMAXGEN;
+  id = shmhold(s);
+  release(&shmtab.lock);
+  return id;
+}
+
+// Map segment id into the current process.
+// Returns the address it is mapped at, or -1.
+int
+shmat(int id)
+{
+  struct proc *curproc = myproc();
+  struct shm *s;
+  struct vma *v;
+  uint va, len;
+
+  // A vfork child's page table belongs to its parent.
+  if(curproc->borrowed)
+    return -1;
+  acquire(&shmtab.lock);
+  if((s = shmlookup(id)) == 0){
+    release(&shmtab.lock);
+    return -1;
+  }
+  len = s->npage * PGSIZE;
+  if((va = vmagap(curproc->vma, len)) == 0 ||
+     (v = vmaslot(curproc->vma)) == 0 ||
+     mapshared(curproc->pgdir, va, s->page, s->npage) < 0){
+    release(&shmtab.lock);
+    return -1;
+  }
+  v->start = va;
+  v->len = len;
+  v->off = 0;
+  v->shm = s;
+  s->nattach++;
+  release(&shmtab.lock);
+  return va;
+}
+
+// Unmap the segment attached at va from the current process.
+int
+shmdt(uint va)
+{
+  struct proc *curproc = myproc();
+  struct vma *v;
+
+  if(curproc->borrowed)
+    return -1;
+  for(v = curproc->vma; v < &curproc->vma[NVMA]; v++)
+    if(v->shm && v->start == va)
+      break;
+  if(v == &curproc->vma[NVMA])
+    return -1;
+  deallocuvm(curproc->pgdir, v->start + v->len, v->start);
+  shmput(v->shm);
+  v->shm = 0;
+  return 0;
+}
+
+// Add an attachment to segment s.  Used by fork.
+void
+shmdup(struct shm *s)
+{
+  acquire(&shmtab.lock);
+  s->nattach++;
+  release(&shmtab.lock);
+}
+
+// Drop an attachment to segment s, freeing the segment
+// if nothing else refers to it.  The pages survive as long as some
+// page table still maps them.
+void
+shmput(struct shm *s)
+{
+  acquire(&shmtab.lock);
+  if(s->nattach < 1)
+    panic("shmput");
+  s->nattach--;
+  shmfree(s);
+  release(&shmtab.lock);
+}
+
+// Drop p's holds on the segments whose ids it got, freeing
+// those left with no attachments.  Called by exec and exit.
+void
+shmrelease(struct proc *p)
+{
+  struct shm *s;
+  int i;
+
+  acquire(&shmtab.lock);
+  for(i = 0; i < NSHM; i++){
+    if(p->shmheld & (1 << i)){
+      s = &shmtab.seg[i];
+      s->nhold--;
+      shmfree(s);
+    }
+  }
+  p->shmheld = 0;
+  release(&shmtab.lock);
+}
@@ -0,0 +1,245 @@
+// Slab allocator for small, fixed-size kernel objects.
+//
+// Each cache hands out objects of one size, carved out of
+// pages from kalloc().  A page (a slab) starts with a struct
+// slab header followed by as many objects as fit.  Slabs with
+// free objects are kept on the cache's partial list; a slab
+// whose objects are all free is given back to kalloc(), except
+// that one is kept around to avoid thrashing.
+//
+// As in kalloc.c, each CPU keeps a small stack of free objects
+// per cache, so that most allocations and frees only touch
+// per-CPU state with interrupts off.  The stack is refilled
+// from and drained to the slabs KMBATCH objects at a time.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "kmstat.h"
+
+#define KMCPU   16
+#define KMBATCH 8
+
+struct slab {
+  struct slab *next;   // on the cache's partial list
+  struct slab *prev;
+  struct kmcache *c;
+  int inuse;           // objects handed out from this slab
+  void *free;          // list of free objects, linked through
+                       // their first word
+};
+
+struct kmcache {
+  struct spinlock lock;
+  char name[16];
+  uint size;           // object size, rounded up to a word
+  int perslab;         // objects per slab
+  struct slab *partial;
+  int nslab;           // pages held by this cache
+  int inuse;           // objects allocated from slabs
+  int empty;           // slabs with no objects in use
+  struct {
+    void *obj[KMCPU];
+    int n;
+    uint allocs, frees;
+  } cpu[NCPU];
+};
+
+struct {
+  struct spinlock lock;
+  struct kmcache cache[NKMCACHE];
+  int n;
+} kmcaches;
+
+void
+kmcacheinit(void)
+{
+  initlock(&kmcaches.lock, "kmcaches");
+}
+
+// Create a cache for objects of the given size.
+// Panics if out of cache slots; caches are set up at boot.
+struct kmcache*
+kmcache_create(char *name, uint size)
+{
+  struct kmcache *c;
+
+  size = (size + sizeof(void*) - 1) & ~(sizeof(void*) - 1);
+  if(size == 0 || size > PGSIZE - sizeof(struct slab))
+    panic("kmcache_create: size");
+  acquire(&kmcaches.lock);
+  if(kmcaches.n >= NKMCACHE)
+    panic("kmcache_create: too many caches");
+  c = &kmcaches.cache[kmcaches.n++];
+  release(&kmcaches.lock);
+
+  memset(c, 0, sizeof(*c));
+  initlock(&c->lock, name);
+  safestrcpy(c->name, name, sizeof(c->name));
+  c->size = size;
+  c->perslab = (PGSIZE - sizeof(struct slab)) / size;
+  return c;
+}
+
+static void
+slabunlink(struct kmcache *c, struct slab *s)
+{
+  if(s->prev)
+    s->prev->next = s->next;
+  else
+    c->partial = s->next;
+  if(s->next)
+    s->next->prev = s->prev;
+  s->next = s->prev = 0;
+}
+
+static void
+slabpush(struct kmcache *c, struct slab *s)
+{
+  s->prev = 0;
+  s->next = c->partial;
+  if(s->next)
+    s->next->prev = s;
+  c->partial = s;
+}
+
+// Take one object from the slabs.  Caller holds c->lock.
+static void*
+slabget(struct kmcache *c)
+{
+  struct slab *s;
+  char *p;
+  void *obj;
+  int i;
+
+  if((s = c->partial) == 0){
+    if((s = (struct slab*)kalloc()) == 0)
+      return 0;
+    s->next = s->prev = 0;
+    s->c = c;
+    s->inuse = 0;
+    s->free = 0;
+    p = (char*)(s + 1);
+    for(i = 0; i < c->perslab; i++, p += c->size){
+      *(void**)p = s->free;
+      s->free = p;
+    }
+    slabpush(c, s);
+    c->nslab++;
+    c->empty++;
+  }
+  obj = s->free;
+  s->free = *(void**)obj;
+  if(s->inuse++ == 0)
+    c->empty--;
+  if(s->free == 0)
+    slabunlink(c, s);
+  c->inuse++;
+  return obj;
+}
+
+// Return one object to its slab.  Caller holds c->lock.
+static void
+slabput(struct kmcache *c, void *obj)
+{
+  struct slab *s;
+
+  s = (struct slab*)PGROUNDDOWN((uint)obj);
+  if(s->c != c || s->inuse < 1)
+    panic("kmcache_free");
+  if(s->free == 0)
+    slabpush(c, s);
+  *(void**)obj = s->free;
+  s->free = obj;
+  c->inuse--;
+  if(--s->inuse == 0){
+    if(c->empty > 0){
+      // Already have an empty slab; give this one back.
+      slabunlink(c, s);
+      c->nslab--;
+      kfree((char*)s);
+    } else
+      c->empty++;
+  }
+}
+
+// Allocate an object from cache c.
+// Returns 0 if out of memory.
+void*
+kmcache_alloc(struct kmcache *c)
+{
+  void *obj;
+  int i, id;
+
+  pushcli();
+  id = cpuid();
+  if(c->cpu[id].n == 0){
+    acquire(&c->lock);
+    for(i = 0; i < KMBATCH; i++){
+      if((obj = slabget(c)) == 0)
+        break;
+      c->cpu[id].obj[c->cpu[id].n++] = obj;
+    }
+    release(&c->lock);
+  }
+  obj = 0;
+  if(c->cpu[id].n > 0){
+    obj = c->cpu[id].obj[--c->cpu[id].n];
+    c->cpu[id].allocs++;
+  }
+  popcli();
+  return obj;
+}
+
+// Free an object allocated from cache c.
+void
+kmcache_free(struct kmcache *c, void *obj)
+{
+  int i, id;
+
+  pushcli();
+  id = cpuid();
+  if(c->cpu[id].n == KMCPU){
+    acquire(&c->lock);
+    for(i = 0; i < KMBATCH; i++)
+      slabput(c, c->cpu[id].obj[--c->cpu[id].n]);
+    release(&c->lock);
+  }
+  c->cpu[id].obj[c->cpu[id].n++] = obj;
+  c->cpu[id].frees++;
+  popcli();
+}
+
+// Copy usage statistics for every cache into *st.
+int
+slabstat(struct slabstat *st)
+{
+  struct kmcache *c;
+  int i, j, cached;
+
+  memset(st, 0, sizeof(*st));
+  acquire(&kmcaches.lock);
+  st->n = kmcaches.n;
+  release(&kmcaches.lock);
+  for(i = 0; i < st->n; i++){
+    c = &kmcaches.cache[i];
+    acquire(&c->lock);
+    cached = 0;
+    for(j = 0; j < ncpu; j++){
+      cached += c->cpu[j].n;
+      st->cache[i].allocs += c->cpu[j].allocs;
+      st->cache[i].frees += c->cpu[j].frees;
+    }
+    safestrcpy(st->cache[i].name, c->name, sizeof(st->cache[i].name));
+    st->cache[i].size = c->size;
+    st->cache[i].inuse = c->inuse - cached;
+    st->cache[i].cached = cached;
+    st->cache[i].total = c->nslab * c->perslab;
+    st->cache[i].slabs = c->nslab;
+    release(&c->lock);
+  }
+  return 0;
+}
@@ -18,8 +18,11 @@ int
 fetchint(uint addr, int *ip)
 {
   struct proc *curproc = myproc();
+  uint end;
 
-  if(addr >= curproc->sz || addr+4 > curproc->sz)
+  if((end = uend(curproc, addr)) == 0 || addr+4 < addr || addr+4 > end)
+    return -1;
+  if(faultin(curproc, addr, 4, 0) < 0)
     return -1;
   *ip = *(int*)(addr);
   return 0;
@@ -39,6 +42,8 @@ fetchstr(uint addr, char **pp)
   *pp = (char*)addr;
   ep = (char*)curproc->sz;
   for(s = *pp; s < ep; s++){
+    if((s == *pp || (uint)s % PGSIZE == 0) && faultin(curproc, (uint)s, 1, 0) < 0)
+      return -1;
     if(*s == 0)
       return s - *pp;
   }
@@ -53,26 +58,48 @@ argint(int n, int *ip)
 }
 
 // Fetch the nth word-sized system call argument as a pointer
-// to a block of memory of size bytes.  Check that the pointer
-// lies within the process address space.
-int
-argptr(int n, char **pp, int size)
+// to a block of memory of size bytes, which the kernel will
+// write to if write is set.
+static int
+argbuf(int n, char **pp, int size, int write)
 {
   int i;
+  uint end;
   struct proc *curproc = myproc();
 
   if(argint(n, &i) < 0)
     return -1;
-  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+  if(size < 0 || (end = uend(curproc, i)) == 0 ||
+     (uint)i+size < (uint)i || (uint)i+size > end)
+    return -1;
+  if(faultin(curproc, i, size, write) < 0)
     return -1;
   *pp = (char*)i;
   return 0;
 }
 
+// Fetch the nth word-sized system call argument as a pointer
+// to a block of memory of size bytes.  Check that the pointer
+// lies within the process address space.
+int
+argptr(int n, char **pp, int size)
+{
+  return argbuf(n, pp, size, 0);
+}
+
+// Like argptr, for a buffer the kernel will write to: also
+// check that it is writable, breaking copy-on-write sharing
+// now rather than faulting later, perhaps with a lock held.
+int
+argptrw(int n, char **pp, int size)
+{
+  return argbuf(n, pp, size, 1);
+}
+
 // Fetch the nth word-sized system call argument as a string pointer.
 // Check that the pointer is valid and the string is nul-terminated.
-// (There is no shared writable memory, so the string can't change
-// between this check and being used by the kernel.)
+// (Strings are not accepted from shared memory segments, so the
+// string can't change between this check and being used by the kernel.)
 int
 argstr(int n, char **pp)
 {
@@ -107,6 +134,22 @@ extern int sys_setpri(void);
 extern int sys_getpri(void);
 extern int sys_fork2(void);
 extern int sys_getpinfo(void);
+extern int sys_spawn(void);
+extern int sys_spawnn(void);
+extern int sys_vfork(void);
+extern int sys_kmstat(void);
+extern int sys_slabstat(void);
+extern int sys_shmget(void);
+extern int sys_shmat(void);
+extern int sys_shmdt(void);
+extern int sys_mmap(void);
+extern int sys_munmap(void);
+extern int sys_bstat(void);
+extern int sys_aread(void);
+extern int sys_await(void);
+extern int sys_bdrop(void);
+extern int sys_apoll(void);
+extern int sys_sync(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -134,6 +177,22 @@ static int (*syscalls[])(void) = {
 [SYS_getpri]  sys_getpri,
 [SYS_fork2]   sys_fork2,
 [SYS_getpinfo] sys_getpinfo,
+[SYS_spawn]   sys_spawn,
+[SYS_spawnn]  sys_spawnn,
+[SYS_vfork]   sys_vfork,
+[SYS_kmstat]  sys_kmstat,
+[SYS_slabstat] sys_slabstat,
+[SYS_shmget]  sys_shmget,
+[SYS_shmat]   sys_shmat,
+[SYS_shmdt]   sys_shmdt,
+[SYS_mmap]    sys_mmap,
+[SYS_munmap]  sys_munmap,
+[SYS_bstat]   sys_bstat,
+[SYS_aread]   sys_aread,
+[SYS_await]   sys_await,
+[SYS_bdrop]   sys_bdrop,
+[SYS_apoll]   sys_apoll,
+[SYS_sync]    sys_sync,
 };
 
 void
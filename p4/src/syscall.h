@@ -24,3 +24,19 @@
 #define SYS_getpri 23
 #define SYS_fork2  24
 #define SYS_getpinfo 25
+#define SYS_spawn  26
+#define SYS_spawnn 27
+#define SYS_vfork  28
+#define SYS_kmstat 29
+#define SYS_slabstat 30
+#define SYS_shmget 31
+#define SYS_shmat  32
+#define SYS_shmdt  33
+#define SYS_mmap   34
+#define SYS_munmap 35
+#define SYS_bstat  36
+#define SYS_aread  37
+#define SYS_await  38
+#define SYS_bdrop  39
+#define SYS_apoll  40
+#define SYS_sync   41
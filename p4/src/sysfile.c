@@ -15,6 +15,7 @@
 #include "sleeplock.h"
 #include "file.h"
 #include "fcntl.h"
+#include "bstat.h"
 
 // Fetch the nth word-sized system call argument as a file descriptor
 // and return both the descriptor and the corresponding struct file.
@@ -73,7 +74,7 @@ sys_read(void)
   int n;
   char *p;
 
-  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptrw(1, &p, n) < 0)
     return -1;
   return fileread(f, p, n);
 }
@@ -109,7 +110,7 @@ sys_fstat(void)
   struct file *f;
   struct stat *st;
 
-  if(argfd(0, 0, &f) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+  if(argfd(0, 0, &f) < 0 || argptrw(1, (void*)&st, sizeof(*st)) < 0)
     return -1;
   return filestat(f, st);
 }
@@ -393,19 +394,19 @@ sys_chdir(void)
   return 0;
 }
 
-int
-sys_exec(void)
+// Fetch the nth system call argument as a user argv array
+// of at most MAXARG strings, terminated by a null pointer.
+static int
+argargv(int n, char **argv)
 {
-  char *path, *argv[MAXARG];
   int i;
   uint uargv, uarg;
 
-  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+  if(argint(n, (int*)&uargv) < 0)
     return -1;
-  }
-  memset(argv, 0, sizeof(argv));
+  memset(argv, 0, MAXARG*sizeof(argv[0]));
   for(i=0;; i++){
-    if(i >= NELEM(argv))
+    if(i >= MAXARG)
       return -1;
     if(fetchint(uargv+4*i, (int*)&uarg) < 0)
       return -1;
@@ -416,9 +417,134 @@ sys_exec(void)
     if(fetchstr(uarg, &argv[i]) < 0)
       return -1;
   }
+  return 0;
+}
+
+int
+sys_exec(void)
+{
+  char *path, *argv[MAXARG];
+
+  if(argstr(0, &path) < 0 || argargv(1, argv) < 0){
+    return -1;
+  }
   return exec(path, argv);
 }
 
+int
+sys_spawn(void)
+{
+  char *path, *argv[MAXARG];
+  int pri;
+
+  if(argstr(0, &path) < 0 || argargv(1, argv) < 0 || argint(2, &pri) < 0)
+    return -1;
+  return spawn(path, argv, pri);
+}
+
+int
+sys_spawnn(void)
+{
+  char *path, *argv[MAXARG];
+  int pri, n, *pids;
+
+  if(argstr(0, &path) < 0 || argargv(1, argv) < 0 || argint(2, &pri) < 0)
+    return -1;
+  if(argint(3, &n) < 0 || n < 0 || n > NPROC)
+    return -1;
+  if(argptrw(4, (void*)&pids, n*sizeof(pids[0])) < 0)
+    return -1;
+  return spawnn(path, argv, pri, n, pids);
+}
+
+// mmap(addr, len, prot, flags, fd, off).  addr is only a
+// hint in other systems and is ignored here.
+int
+sys_mmap(void)
+{
+  struct file *f;
+  int len, prot, flags, off;
+
+  if(argint(1, &len) < 0 || argint(2, &prot) < 0 || argint(3, &flags) < 0 ||
+     argfd(4, 0, &f) < 0 || argint(5, &off) < 0)
+    return -1;
+  return mmap(f, off, len, prot, flags);
+}
+
+// munmap(addr, len) removes a whole mapping; len must cover it.
+int
+sys_munmap(void)
+{
+  int addr, len;
+
+  if(argint(0, &addr) < 0 || argint(1, &len) < 0)
+    return -1;
+  return munmap(addr, len);
+}
+
+int
+sys_aread(void)
+{
+  struct file *f;
+  int n;
+  char *p;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptrw(1, &p, n) < 0)
+    return -1;
+  return aread(f, p, n);
+}
+
+int
+sys_await(void)
+{
+  int id;
+
+  if(argint(0, &id) < 0)
+    return -1;
+  return await(id);
+}
+
+int
+sys_apoll(void)
+{
+  int id;
+
+  if(argint(0, &id) < 0)
+    return -1;
+  return apoll(id);
+}
+
+// Dropping the cache slows every process down, so it is only
+// allowed in kernels built for benchmarking.
+int
+sys_bdrop(void)
+{
+#ifdef BDROP
+  return bdrop();
+#else
+  return -1;
+#endif
+}
+
+// Wait for the file system operations that have returned
+// to be committed to disk.
+int
+sys_sync(void)
+{
+  logsync();
+  return 0;
+}
+
+int
+sys_bstat(void)
+{
+  struct bstat *st;
+
+  if(argptrw(0, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  return bstat(st);
+}
+
 int
 sys_pipe(void)
 {
@@ -426,7 +552,7 @@ sys_pipe(void)
   struct file *rf, *wf;
   int fd0, fd1;
 
-  if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+  if(argptrw(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
     return -1;
   if(pipealloc(&rf, &wf) < 0)
     return -1;
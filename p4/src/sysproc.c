@@ -6,6 +6,7 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "kmstat.h"
 
 int
 sys_fork(void)
@@ -13,6 +14,12 @@ sys_fork(void)
   return fork();
 }
 
+int
+sys_vfork(void)
+{
+  return vfork();
+}
+
 int
 sys_exit(void)
 {
@@ -56,6 +63,37 @@ sys_sbrk(void)
   return addr;
 }
 
+int
+sys_shmget(void)
+{
+  char *name;
+  int n;
+
+  if(argstr(0, &name) < 0 || argint(1, &n) < 0)
+    return -1;
+  return shmget(name, n);
+}
+
+int
+sys_shmat(void)
+{
+  int id;
+
+  if(argint(0, &id) < 0)
+    return -1;
+  return shmat(id);
+}
+
+int
+sys_shmdt(void)
+{
+  int addr;
+
+  if(argint(0, &addr) < 0)
+    return -1;
+  return shmdt(addr);
+}
+
 int
 sys_sleep(void)
 {
@@ -131,9 +169,29 @@ sys_getpinfo(void)
 {
     struct pstat* stat;
 
-    if (argptr(0, (char**)&stat, sizeof(struct pstat*)) < 0) {
+    if (argptrw(0, (char**)&stat, sizeof(*stat)) < 0) {
         return -1;
     }
 
     return getpinfo((struct pstat*) stat);
 }
+
+int
+sys_kmstat(void)
+{
+  struct kmstat *st;
+
+  if(argptrw(0, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  return kmstat(st);
+}
+
+int
+sys_slabstat(void)
+{
+  struct slabstat *st;
+
+  if(argptrw(0, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  return slabstat(st);
+}
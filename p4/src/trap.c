@@ -45,13 +45,19 @@ trap(struct trapframe *tf)
     return;
   }
 
-  switch(tf->trapno){
+  // The virtio disk's vector comes from PCI configuration at
+  // boot, so it can't be a case label.
+  if(virtioirq >= 0 && tf->trapno == T_IRQ0 + virtioirq){
+    virtiointr();
+    lapiceoi();
+  } else switch(tf->trapno){
   case T_IRQ0 + IRQ_TIMER:
     if(cpuid() == 0){
       acquire(&tickslock);
       ticks++;
       wakeup(&ticks);
       release(&tickslock);
+      logtick();
     }
     lapiceoi();
     break;
@@ -77,6 +83,13 @@ trap(struct trapframe *tf)
     lapiceoi();
     break;
 
+  case T_PGFLT:
+    // A first touch of a heap page or a write to a page shared
+    // copy-on-write, either from user code or from the kernel
+    // using a user buffer.
+    if(myproc() && pagefault(myproc(), rcr2(), tf->err) == 0)
+      break;
+    // Otherwise a real fault: fall through.
   default:
     if(myproc() == 0 || (tf->cs&3) == 0){
       // In kernel, it must be our mistake.
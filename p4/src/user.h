@@ -1,6 +1,9 @@
 struct stat;
 struct rtcdate;
 struct pstat;
+struct kmstat;
+struct slabstat;
+struct bstat;
 
 // system calls
 int fork(void);
@@ -28,6 +31,22 @@ int setpri(int, int);
 int getpri(int);
 int fork2(int);
 int getpinfo(struct pstat *);
+int spawn(char*, char**, int);
+int spawnn(char*, char**, int, int, int*);
+int vfork(void);
+int kmstat(struct kmstat*);
+int slabstat(struct slabstat*);
+int shmget(char*, int);
+void* shmat(int);
+int shmdt(void*);
+void* mmap(void*, int, int, int, int, int);
+int munmap(void*, int);
+int bstat(struct bstat*);
+int aread(int, void*, int);
+int await(int);
+int bdrop(void);
+int apoll(int);
+int sync(void);
 
 // ulib.c
 int stat(const char*, struct stat*);
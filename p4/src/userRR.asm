@@ -0,0 +1,1349 @@
+
+_userRR:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <parseInt>:
+#include "syscall.h"
+#include "traps.h"
+#include "memlayout.h"
+#include "pstat.h"
+
+int parseInt(char *str) {
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	56                   	push   %esi
+   4:	53                   	push   %ebx
+   5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    int number = 0;
+    for (int ps = 0; str[ps] != '\0'; ps++) {
+   8:	b9 00 00 00 00       	mov    $0x0,%ecx
+    int number = 0;
+   d:	ba 00 00 00 00       	mov    $0x0,%edx
+    for (int ps = 0; str[ps] != '\0'; ps++) {
+  12:	eb 10                	jmp    24 <parseInt+0x24>
+        int thisnum = str[ps] - '0';
+  14:	0f be c0             	movsbl %al,%eax
+        number = number * 10 + thisnum;
+  17:	8d 34 92             	lea    (%edx,%edx,4),%esi
+  1a:	8d 14 36             	lea    (%esi,%esi,1),%edx
+  1d:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+    for (int ps = 0; str[ps] != '\0'; ps++) {
+  21:	83 c1 01             	add    $0x1,%ecx
+  24:	0f b6 04 0b          	movzbl (%ebx,%ecx,1),%eax
+  28:	84 c0                	test   %al,%al
+  2a:	75 e8                	jne    14 <parseInt+0x14>
+    }
+    return number;
+}
+  2c:	89 d0                	mov    %edx,%eax
+  2e:	5b                   	pop    %ebx
+  2f:	5e                   	pop    %esi
+  30:	5d                   	pop    %ebp
+  31:	c3                   	ret
+
+00000032 <main>:
+
+int main(int argc, char* argv[]) {
+  32:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  36:	83 e4 f0             	and    $0xfffffff0,%esp
+  39:	ff 71 fc             	push   -0x4(%ecx)
+  3c:	55                   	push   %ebp
+  3d:	89 e5                	mov    %esp,%ebp
+  3f:	57                   	push   %edi
+  40:	56                   	push   %esi
+  41:	53                   	push   %ebx
+  42:	51                   	push   %ecx
+  43:	81 ec 28 0c 00 00    	sub    $0xc28,%esp
+  49:	8b 59 04             	mov    0x4(%ecx),%ebx
+    if (argc != 5) {
+  4c:	83 39 05             	cmpl   $0x5,(%ecx)
+  4f:	74 14                	je     65 <main+0x33>
+        printf(1, "Usage: userRR <user-level-timeslice> <iterations> <job> <jobcount>\n");
+  51:	83 ec 08             	sub    $0x8,%esp
+  54:	68 cc 08 00 00       	push   $0x8cc
+  59:	6a 01                	push   $0x1
+  5b:	e8 bd 05 00 00       	call   61d <printf>
+        exit();
+  60:	e8 e1 03 00 00       	call   446 <exit>
+    }
+    int timeslice = parseInt(argv[1]);
+  65:	83 ec 0c             	sub    $0xc,%esp
+  68:	ff 73 04             	push   0x4(%ebx)
+  6b:	e8 90 ff ff ff       	call   0 <parseInt>
+  70:	83 c4 04             	add    $0x4,%esp
+  73:	89 85 d4 f3 ff ff    	mov    %eax,-0xc2c(%ebp)
+    int iterations = parseInt(argv[2]);
+  79:	ff 73 08             	push   0x8(%ebx)
+  7c:	e8 7f ff ff ff       	call   0 <parseInt>
+  81:	83 c4 04             	add    $0x4,%esp
+  84:	89 85 cc f3 ff ff    	mov    %eax,-0xc34(%ebp)
+    char* job = argv[3];
+  8a:	8b 7b 0c             	mov    0xc(%ebx),%edi
+    int job_count = parseInt(argv[4]);
+  8d:	ff 73 10             	push   0x10(%ebx)
+  90:	e8 6b ff ff ff       	call   0 <parseInt>
+  95:	83 c4 10             	add    $0x10,%esp
+  98:	89 c3                	mov    %eax,%ebx
+    int pids[job_count];
+  9a:	8d 04 85 0f 00 00 00 	lea    0xf(,%eax,4),%eax
+  a1:	83 e0 f0             	and    $0xfffffff0,%eax
+  a4:	29 c4                	sub    %eax,%esp
+  a6:	89 e6                	mov    %esp,%esi
+    // launch every job at priority 1 in a single call instead of
+    // fork2()+exec() per job, so our image is never copied
+    char* temp_argv[] = {job, 0};
+  a8:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  ab:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    int launched = spawnn(job, temp_argv, 1, job_count, pids);
+  b2:	83 ec 0c             	sub    $0xc,%esp
+  b5:	56                   	push   %esi
+  b6:	53                   	push   %ebx
+  b7:	6a 01                	push   $0x1
+  b9:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  bc:	50                   	push   %eax
+  bd:	57                   	push   %edi
+  be:	e8 4b 04 00 00       	call   50e <spawnn>
+  c3:	89 c7                	mov    %eax,%edi
+    if (launched < job_count) {
+  c5:	83 c4 20             	add    $0x20,%esp
+  c8:	39 c3                	cmp    %eax,%ebx
+  ca:	7f 0c                	jg     d8 <main+0xa6>
+        printf(1, "exec failed\n");
+    }
+    for (int i = launched < 0 ? 0 : launched; i < job_count; i++) {
+  cc:	85 ff                	test   %edi,%edi
+  ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  d3:	0f 48 f8             	cmovs  %eax,%edi
+  d6:	eb 1e                	jmp    f6 <main+0xc4>
+        printf(1, "exec failed\n");
+  d8:	83 ec 08             	sub    $0x8,%esp
+  db:	68 3b 09 00 00       	push   $0x93b
+  e0:	6a 01                	push   $0x1
+  e2:	e8 36 05 00 00       	call   61d <printf>
+  e7:	83 c4 10             	add    $0x10,%esp
+  ea:	eb e0                	jmp    cc <main+0x9a>
+        pids[i] = -1;
+  ec:	c7 04 be ff ff ff ff 	movl   $0xffffffff,(%esi,%edi,4)
+    for (int i = launched < 0 ? 0 : launched; i < job_count; i++) {
+  f3:	83 c7 01             	add    $0x1,%edi
+  f6:	39 df                	cmp    %ebx,%edi
+  f8:	7c f2                	jl     ec <main+0xba>
+    }
+    for (int itr = 0; itr < iterations; itr++) {
+  fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  ff:	eb 63                	jmp    164 <main+0x132>
+                continue;
+            }
+            if (setpri(pids[i], 2) < 0) {
+                printf(1, "setpri failed\n");
+            }
+            sleep(timeslice);
+ 101:	83 ec 0c             	sub    $0xc,%esp
+ 104:	ff b5 d4 f3 ff ff    	push   -0xc2c(%ebp)
+ 10a:	e8 c7 03 00 00       	call   4d6 <sleep>
+            setpri(pids[i], 1);
+ 10f:	83 c4 08             	add    $0x8,%esp
+ 112:	6a 01                	push   $0x1
+ 114:	ff 34 be             	push   (%esi,%edi,4)
+ 117:	e8 ca 03 00 00       	call   4e6 <setpri>
+ 11c:	83 c4 10             	add    $0x10,%esp
+        for(int i = 0; i < sizeof(pids)/sizeof(pids[0]); i++) {
+ 11f:	83 c7 01             	add    $0x1,%edi
+ 122:	89 d8                	mov    %ebx,%eax
+ 124:	25 ff ff ff 3f       	and    $0x3fffffff,%eax
+ 129:	39 c7                	cmp    %eax,%edi
+ 12b:	73 2e                	jae    15b <main+0x129>
+            if (pids[i] == -1) {
+ 12d:	8b 04 be             	mov    (%esi,%edi,4),%eax
+ 130:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 133:	74 ea                	je     11f <main+0xed>
+            if (setpri(pids[i], 2) < 0) {
+ 135:	83 ec 08             	sub    $0x8,%esp
+ 138:	6a 02                	push   $0x2
+ 13a:	50                   	push   %eax
+ 13b:	e8 a6 03 00 00       	call   4e6 <setpri>
+ 140:	83 c4 10             	add    $0x10,%esp
+ 143:	85 c0                	test   %eax,%eax
+ 145:	79 ba                	jns    101 <main+0xcf>
+                printf(1, "setpri failed\n");
+ 147:	83 ec 08             	sub    $0x8,%esp
+ 14a:	68 48 09 00 00       	push   $0x948
+ 14f:	6a 01                	push   $0x1
+ 151:	e8 c7 04 00 00       	call   61d <printf>
+ 156:	83 c4 10             	add    $0x10,%esp
+ 159:	eb a6                	jmp    101 <main+0xcf>
+    for (int itr = 0; itr < iterations; itr++) {
+ 15b:	8b 95 d0 f3 ff ff    	mov    -0xc30(%ebp),%edx
+ 161:	83 c2 01             	add    $0x1,%edx
+ 164:	8b 85 cc f3 ff ff    	mov    -0xc34(%ebp),%eax
+ 16a:	39 c2                	cmp    %eax,%edx
+ 16c:	7d 0d                	jge    17b <main+0x149>
+        for(int i = 0; i < sizeof(pids)/sizeof(pids[0]); i++) {
+ 16e:	bf 00 00 00 00       	mov    $0x0,%edi
+ 173:	89 95 d0 f3 ff ff    	mov    %edx,-0xc30(%ebp)
+ 179:	eb a7                	jmp    122 <main+0xf0>
+        }
+    }
+    struct pstat outStat = {0};
+ 17b:	8d bd e0 f3 ff ff    	lea    -0xc20(%ebp),%edi
+ 181:	b9 00 03 00 00       	mov    $0x300,%ecx
+ 186:	b8 00 00 00 00       	mov    $0x0,%eax
+ 18b:	f3 ab                	rep stos %eax,%es:(%edi)
+    getpinfo(&outStat);
+ 18d:	83 ec 0c             	sub    $0xc,%esp
+ 190:	8d 85 e0 f3 ff ff    	lea    -0xc20(%ebp),%eax
+ 196:	50                   	push   %eax
+ 197:	e8 62 03 00 00       	call   4fe <getpinfo>
+    [SLEEPING]  "sleep ",
+    [RUNNABLE]  "runble",
+    [RUNNING]   "run   ",
+    [ZOMBIE]    "zombie"
+    };
+    for (int i = 0; i < NPROC; i++) {
+ 19c:	83 c4 10             	add    $0x10,%esp
+ 19f:	bf 00 00 00 00       	mov    $0x0,%edi
+ 1a4:	89 9d d4 f3 ff ff    	mov    %ebx,-0xc2c(%ebp)
+ 1aa:	eb 7c                	jmp    228 <main+0x1f6>
+                                outStat.pid[i],
+                                outStat.inuse[i],
+                                outStat.priority[i],
+                                state);
+        for (int j = NLAYER-1; j >= 0; j--) {
+            printf(1, "%d ", outStat.ticks[i][j]);
+ 1ac:	83 ec 04             	sub    $0x4,%esp
+ 1af:	8d 84 bb 00 01 00 00 	lea    0x100(%ebx,%edi,4),%eax
+ 1b6:	ff b4 85 e0 f3 ff ff 	push   -0xc20(%ebp,%eax,4)
+ 1bd:	68 57 09 00 00       	push   $0x957
+ 1c2:	6a 01                	push   $0x1
+ 1c4:	e8 54 04 00 00       	call   61d <printf>
+        for (int j = NLAYER-1; j >= 0; j--) {
+ 1c9:	83 eb 01             	sub    $0x1,%ebx
+ 1cc:	83 c4 10             	add    $0x10,%esp
+ 1cf:	85 db                	test   %ebx,%ebx
+ 1d1:	79 d9                	jns    1ac <main+0x17a>
+        }
+        printf(1, "qtail: ");
+ 1d3:	83 ec 08             	sub    $0x8,%esp
+ 1d6:	68 5b 09 00 00       	push   $0x95b
+ 1db:	6a 01                	push   $0x1
+ 1dd:	e8 3b 04 00 00       	call   61d <printf>
+        for (int j = NLAYER-1; j >= 0; j--) {
+ 1e2:	83 c4 10             	add    $0x10,%esp
+ 1e5:	bb 03 00 00 00       	mov    $0x3,%ebx
+ 1ea:	eb 23                	jmp    20f <main+0x1dd>
+            printf(1, "%d ", outStat.qtail[i][j]);
+ 1ec:	83 ec 04             	sub    $0x4,%esp
+ 1ef:	8d 84 bb 00 02 00 00 	lea    0x200(%ebx,%edi,4),%eax
+ 1f6:	ff b4 85 e0 f3 ff ff 	push   -0xc20(%ebp,%eax,4)
+ 1fd:	68 57 09 00 00       	push   $0x957
+ 202:	6a 01                	push   $0x1
+ 204:	e8 14 04 00 00       	call   61d <printf>
+        for (int j = NLAYER-1; j >= 0; j--) {
+ 209:	83 eb 01             	sub    $0x1,%ebx
+ 20c:	83 c4 10             	add    $0x10,%esp
+ 20f:	85 db                	test   %ebx,%ebx
+ 211:	79 d9                	jns    1ec <main+0x1ba>
+        }
+        printf(1, "\n");
+ 213:	83 ec 08             	sub    $0x8,%esp
+ 216:	68 46 09 00 00       	push   $0x946
+ 21b:	6a 01                	push   $0x1
+ 21d:	e8 fb 03 00 00       	call   61d <printf>
+    for (int i = 0; i < NPROC; i++) {
+ 222:	83 c7 01             	add    $0x1,%edi
+ 225:	83 c4 10             	add    $0x10,%esp
+ 228:	83 ff 3f             	cmp    $0x3f,%edi
+ 22b:	7f 3f                	jg     26c <main+0x23a>
+            state = states[outStat.state[i]];
+ 22d:	8b 84 bd e0 f6 ff ff 	mov    -0x920(%ebp,%edi,4),%eax
+        printf(1, "[%d] inuse:%d priority:%d state:%s ticks: ",
+ 234:	83 ec 08             	sub    $0x8,%esp
+ 237:	ff 34 85 90 09 00 00 	push   0x990(,%eax,4)
+ 23e:	ff b4 bd e0 f5 ff ff 	push   -0xa20(%ebp,%edi,4)
+ 245:	ff b4 bd e0 f3 ff ff 	push   -0xc20(%ebp,%edi,4)
+ 24c:	ff b4 bd e0 f4 ff ff 	push   -0xb20(%ebp,%edi,4)
+ 253:	68 10 09 00 00       	push   $0x910
+ 258:	6a 01                	push   $0x1
+ 25a:	e8 be 03 00 00       	call   61d <printf>
+        for (int j = NLAYER-1; j >= 0; j--) {
+ 25f:	83 c4 20             	add    $0x20,%esp
+ 262:	bb 03 00 00 00       	mov    $0x3,%ebx
+ 267:	e9 63 ff ff ff       	jmp    1cf <main+0x19d>
+    }
+    for(int i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+ 26c:	8b 9d d4 f3 ff ff    	mov    -0xc2c(%ebp),%ebx
+ 272:	bf 00 00 00 00       	mov    $0x0,%edi
+ 277:	eb 03                	jmp    27c <main+0x24a>
+ 279:	83 c7 01             	add    $0x1,%edi
+ 27c:	89 d8                	mov    %ebx,%eax
+ 27e:	25 ff ff ff 3f       	and    $0x3fffffff,%eax
+ 283:	39 c7                	cmp    %eax,%edi
+ 285:	73 1b                	jae    2a2 <main+0x270>
+      if(pids[i] == -1)
+ 287:	8b 04 be             	mov    (%esi,%edi,4),%eax
+ 28a:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 28d:	74 ea                	je     279 <main+0x247>
+        continue;
+      kill(pids[i]);
+ 28f:	83 ec 0c             	sub    $0xc,%esp
+ 292:	50                   	push   %eax
+ 293:	e8 de 01 00 00       	call   476 <kill>
+      wait();
+ 298:	e8 b1 01 00 00       	call   44e <wait>
+ 29d:	83 c4 10             	add    $0x10,%esp
+ 2a0:	eb d7                	jmp    279 <main+0x247>
+    }
+    exit();
+ 2a2:	e8 9f 01 00 00       	call   446 <exit>
+
+000002a7 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 2a7:	55                   	push   %ebp
+ 2a8:	89 e5                	mov    %esp,%ebp
+ 2aa:	56                   	push   %esi
+ 2ab:	53                   	push   %ebx
+ 2ac:	8b 75 08             	mov    0x8(%ebp),%esi
+ 2af:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 2b2:	89 f0                	mov    %esi,%eax
+ 2b4:	89 d1                	mov    %edx,%ecx
+ 2b6:	83 c2 01             	add    $0x1,%edx
+ 2b9:	89 c3                	mov    %eax,%ebx
+ 2bb:	83 c0 01             	add    $0x1,%eax
+ 2be:	0f b6 09             	movzbl (%ecx),%ecx
+ 2c1:	88 0b                	mov    %cl,(%ebx)
+ 2c3:	84 c9                	test   %cl,%cl
+ 2c5:	75 ed                	jne    2b4 <strcpy+0xd>
+    ;
+  return os;
+}
+ 2c7:	89 f0                	mov    %esi,%eax
+ 2c9:	5b                   	pop    %ebx
+ 2ca:	5e                   	pop    %esi
+ 2cb:	5d                   	pop    %ebp
+ 2cc:	c3                   	ret
+
+000002cd <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2cd:	55                   	push   %ebp
+ 2ce:	89 e5                	mov    %esp,%ebp
+ 2d0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 2d6:	eb 06                	jmp    2de <strcmp+0x11>
+    p++, q++;
+ 2d8:	83 c1 01             	add    $0x1,%ecx
+ 2db:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 2de:	0f b6 01             	movzbl (%ecx),%eax
+ 2e1:	84 c0                	test   %al,%al
+ 2e3:	74 04                	je     2e9 <strcmp+0x1c>
+ 2e5:	3a 02                	cmp    (%edx),%al
+ 2e7:	74 ef                	je     2d8 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 2e9:	0f b6 c0             	movzbl %al,%eax
+ 2ec:	0f b6 12             	movzbl (%edx),%edx
+ 2ef:	29 d0                	sub    %edx,%eax
+}
+ 2f1:	5d                   	pop    %ebp
+ 2f2:	c3                   	ret
+
+000002f3 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 2f3:	55                   	push   %ebp
+ 2f4:	89 e5                	mov    %esp,%ebp
+ 2f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2f9:	b8 00 00 00 00       	mov    $0x0,%eax
+ 2fe:	eb 03                	jmp    303 <strlen+0x10>
+ 300:	83 c0 01             	add    $0x1,%eax
+ 303:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 307:	75 f7                	jne    300 <strlen+0xd>
+    ;
+  return n;
+}
+ 309:	5d                   	pop    %ebp
+ 30a:	c3                   	ret
+
+0000030b <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 30b:	55                   	push   %ebp
+ 30c:	89 e5                	mov    %esp,%ebp
+ 30e:	57                   	push   %edi
+ 30f:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 312:	89 d7                	mov    %edx,%edi
+ 314:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 317:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 31a:	fc                   	cld
+ 31b:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 31d:	89 d0                	mov    %edx,%eax
+ 31f:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 322:	c9                   	leave
+ 323:	c3                   	ret
+
+00000324 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 324:	55                   	push   %ebp
+ 325:	89 e5                	mov    %esp,%ebp
+ 327:	8b 45 08             	mov    0x8(%ebp),%eax
+ 32a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 32e:	eb 03                	jmp    333 <strchr+0xf>
+ 330:	83 c0 01             	add    $0x1,%eax
+ 333:	0f b6 10             	movzbl (%eax),%edx
+ 336:	84 d2                	test   %dl,%dl
+ 338:	74 06                	je     340 <strchr+0x1c>
+    if(*s == c)
+ 33a:	38 ca                	cmp    %cl,%dl
+ 33c:	75 f2                	jne    330 <strchr+0xc>
+ 33e:	eb 05                	jmp    345 <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 340:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 345:	5d                   	pop    %ebp
+ 346:	c3                   	ret
+
+00000347 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 347:	55                   	push   %ebp
+ 348:	89 e5                	mov    %esp,%ebp
+ 34a:	57                   	push   %edi
+ 34b:	56                   	push   %esi
+ 34c:	53                   	push   %ebx
+ 34d:	83 ec 1c             	sub    $0x1c,%esp
+ 350:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 353:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 358:	89 de                	mov    %ebx,%esi
+ 35a:	83 c3 01             	add    $0x1,%ebx
+ 35d:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 360:	7d 2e                	jge    390 <gets+0x49>
+    cc = read(0, &c, 1);
+ 362:	83 ec 04             	sub    $0x4,%esp
+ 365:	6a 01                	push   $0x1
+ 367:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 36a:	50                   	push   %eax
+ 36b:	6a 00                	push   $0x0
+ 36d:	e8 ec 00 00 00       	call   45e <read>
+    if(cc < 1)
+ 372:	83 c4 10             	add    $0x10,%esp
+ 375:	85 c0                	test   %eax,%eax
+ 377:	7e 17                	jle    390 <gets+0x49>
+      break;
+    buf[i++] = c;
+ 379:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 37d:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 380:	3c 0a                	cmp    $0xa,%al
+ 382:	0f 94 c2             	sete   %dl
+ 385:	3c 0d                	cmp    $0xd,%al
+ 387:	0f 94 c0             	sete   %al
+ 38a:	08 c2                	or     %al,%dl
+ 38c:	74 ca                	je     358 <gets+0x11>
+    buf[i++] = c;
+ 38e:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 390:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 394:	89 f8                	mov    %edi,%eax
+ 396:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 399:	5b                   	pop    %ebx
+ 39a:	5e                   	pop    %esi
+ 39b:	5f                   	pop    %edi
+ 39c:	5d                   	pop    %ebp
+ 39d:	c3                   	ret
+
+0000039e <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 39e:	55                   	push   %ebp
+ 39f:	89 e5                	mov    %esp,%ebp
+ 3a1:	56                   	push   %esi
+ 3a2:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3a3:	83 ec 08             	sub    $0x8,%esp
+ 3a6:	6a 00                	push   $0x0
+ 3a8:	ff 75 08             	push   0x8(%ebp)
+ 3ab:	e8 d6 00 00 00       	call   486 <open>
+  if(fd < 0)
+ 3b0:	83 c4 10             	add    $0x10,%esp
+ 3b3:	85 c0                	test   %eax,%eax
+ 3b5:	78 24                	js     3db <stat+0x3d>
+ 3b7:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 3b9:	83 ec 08             	sub    $0x8,%esp
+ 3bc:	ff 75 0c             	push   0xc(%ebp)
+ 3bf:	50                   	push   %eax
+ 3c0:	e8 d9 00 00 00       	call   49e <fstat>
+ 3c5:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3c7:	89 1c 24             	mov    %ebx,(%esp)
+ 3ca:	e8 9f 00 00 00       	call   46e <close>
+  return r;
+ 3cf:	83 c4 10             	add    $0x10,%esp
+}
+ 3d2:	89 f0                	mov    %esi,%eax
+ 3d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3d7:	5b                   	pop    %ebx
+ 3d8:	5e                   	pop    %esi
+ 3d9:	5d                   	pop    %ebp
+ 3da:	c3                   	ret
+    return -1;
+ 3db:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3e0:	eb f0                	jmp    3d2 <stat+0x34>
+
+000003e2 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3e2:	55                   	push   %ebp
+ 3e3:	89 e5                	mov    %esp,%ebp
+ 3e5:	53                   	push   %ebx
+ 3e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+ 3e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+ 3ee:	eb 10                	jmp    400 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+ 3f0:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+ 3f3:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+ 3f6:	83 c1 01             	add    $0x1,%ecx
+ 3f9:	0f be c0             	movsbl %al,%eax
+ 3fc:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+ 400:	0f b6 01             	movzbl (%ecx),%eax
+ 403:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 406:	80 fb 09             	cmp    $0x9,%bl
+ 409:	76 e5                	jbe    3f0 <atoi+0xe>
+  return n;
+}
+ 40b:	89 d0                	mov    %edx,%eax
+ 40d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 410:	c9                   	leave
+ 411:	c3                   	ret
+
+00000412 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 412:	55                   	push   %ebp
+ 413:	89 e5                	mov    %esp,%ebp
+ 415:	56                   	push   %esi
+ 416:	53                   	push   %ebx
+ 417:	8b 75 08             	mov    0x8(%ebp),%esi
+ 41a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 41d:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 420:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 422:	eb 0d                	jmp    431 <memmove+0x1f>
+    *dst++ = *src++;
+ 424:	0f b6 01             	movzbl (%ecx),%eax
+ 427:	88 02                	mov    %al,(%edx)
+ 429:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 42c:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 42f:	89 d8                	mov    %ebx,%eax
+ 431:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 434:	85 c0                	test   %eax,%eax
+ 436:	7f ec                	jg     424 <memmove+0x12>
+  return vdst;
+}
+ 438:	89 f0                	mov    %esi,%eax
+ 43a:	5b                   	pop    %ebx
+ 43b:	5e                   	pop    %esi
+ 43c:	5d                   	pop    %ebp
+ 43d:	c3                   	ret
+
+0000043e <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 43e:	b8 01 00 00 00       	mov    $0x1,%eax
+ 443:	cd 40                	int    $0x40
+ 445:	c3                   	ret
+
+00000446 <exit>:
+SYSCALL(exit)
+ 446:	b8 02 00 00 00       	mov    $0x2,%eax
+ 44b:	cd 40                	int    $0x40
+ 44d:	c3                   	ret
+
+0000044e <wait>:
+SYSCALL(wait)
+ 44e:	b8 03 00 00 00       	mov    $0x3,%eax
+ 453:	cd 40                	int    $0x40
+ 455:	c3                   	ret
+
+00000456 <pipe>:
+SYSCALL(pipe)
+ 456:	b8 04 00 00 00       	mov    $0x4,%eax
+ 45b:	cd 40                	int    $0x40
+ 45d:	c3                   	ret
+
+0000045e <read>:
+SYSCALL(read)
+ 45e:	b8 05 00 00 00       	mov    $0x5,%eax
+ 463:	cd 40                	int    $0x40
+ 465:	c3                   	ret
+
+00000466 <write>:
+SYSCALL(write)
+ 466:	b8 10 00 00 00       	mov    $0x10,%eax
+ 46b:	cd 40                	int    $0x40
+ 46d:	c3                   	ret
+
+0000046e <close>:
+SYSCALL(close)
+ 46e:	b8 15 00 00 00       	mov    $0x15,%eax
+ 473:	cd 40                	int    $0x40
+ 475:	c3                   	ret
+
+00000476 <kill>:
+SYSCALL(kill)
+ 476:	b8 06 00 00 00       	mov    $0x6,%eax
+ 47b:	cd 40                	int    $0x40
+ 47d:	c3                   	ret
+
+0000047e <exec>:
+SYSCALL(exec)
+ 47e:	b8 07 00 00 00       	mov    $0x7,%eax
+ 483:	cd 40                	int    $0x40
+ 485:	c3                   	ret
+
+00000486 <open>:
+SYSCALL(open)
+ 486:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 48b:	cd 40                	int    $0x40
+ 48d:	c3                   	ret
+
+0000048e <mknod>:
+SYSCALL(mknod)
+ 48e:	b8 11 00 00 00       	mov    $0x11,%eax
+ 493:	cd 40                	int    $0x40
+ 495:	c3                   	ret
+
+00000496 <unlink>:
+SYSCALL(unlink)
+ 496:	b8 12 00 00 00       	mov    $0x12,%eax
+ 49b:	cd 40                	int    $0x40
+ 49d:	c3                   	ret
+
+0000049e <fstat>:
+SYSCALL(fstat)
+ 49e:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4a3:	cd 40                	int    $0x40
+ 4a5:	c3                   	ret
+
+000004a6 <link>:
+SYSCALL(link)
+ 4a6:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4ab:	cd 40                	int    $0x40
+ 4ad:	c3                   	ret
+
+000004ae <mkdir>:
+SYSCALL(mkdir)
+ 4ae:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4b3:	cd 40                	int    $0x40
+ 4b5:	c3                   	ret
+
+000004b6 <chdir>:
+SYSCALL(chdir)
+ 4b6:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4bb:	cd 40                	int    $0x40
+ 4bd:	c3                   	ret
+
+000004be <dup>:
+SYSCALL(dup)
+ 4be:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4c3:	cd 40                	int    $0x40
+ 4c5:	c3                   	ret
+
+000004c6 <getpid>:
+SYSCALL(getpid)
+ 4c6:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4cb:	cd 40                	int    $0x40
+ 4cd:	c3                   	ret
+
+000004ce <sbrk>:
+SYSCALL(sbrk)
+ 4ce:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4d3:	cd 40                	int    $0x40
+ 4d5:	c3                   	ret
+
+000004d6 <sleep>:
+SYSCALL(sleep)
+ 4d6:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4db:	cd 40                	int    $0x40
+ 4dd:	c3                   	ret
+
+000004de <uptime>:
+SYSCALL(uptime)
+ 4de:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4e3:	cd 40                	int    $0x40
+ 4e5:	c3                   	ret
+
+000004e6 <setpri>:
+SYSCALL(setpri)
+ 4e6:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4eb:	cd 40                	int    $0x40
+ 4ed:	c3                   	ret
+
+000004ee <getpri>:
+SYSCALL(getpri)
+ 4ee:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4f3:	cd 40                	int    $0x40
+ 4f5:	c3                   	ret
+
+000004f6 <fork2>:
+SYSCALL(fork2)
+ 4f6:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4fb:	cd 40                	int    $0x40
+ 4fd:	c3                   	ret
+
+000004fe <getpinfo>:
+SYSCALL(getpinfo)
+ 4fe:	b8 19 00 00 00       	mov    $0x19,%eax
+ 503:	cd 40                	int    $0x40
+ 505:	c3                   	ret
+
+00000506 <spawn>:
+SYSCALL(spawn)
+ 506:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 50b:	cd 40                	int    $0x40
+ 50d:	c3                   	ret
+
+0000050e <spawnn>:
+SYSCALL(spawnn)
+ 50e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 513:	cd 40                	int    $0x40
+ 515:	c3                   	ret
+
+00000516 <kmstat>:
+SYSCALL(kmstat)
+ 516:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 51b:	cd 40                	int    $0x40
+ 51d:	c3                   	ret
+
+0000051e <slabstat>:
+SYSCALL(slabstat)
+ 51e:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 523:	cd 40                	int    $0x40
+ 525:	c3                   	ret
+
+00000526 <shmget>:
+SYSCALL(shmget)
+ 526:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 52b:	cd 40                	int    $0x40
+ 52d:	c3                   	ret
+
+0000052e <shmat>:
+SYSCALL(shmat)
+ 52e:	b8 20 00 00 00       	mov    $0x20,%eax
+ 533:	cd 40                	int    $0x40
+ 535:	c3                   	ret
+
+00000536 <shmdt>:
+SYSCALL(shmdt)
+ 536:	b8 21 00 00 00       	mov    $0x21,%eax
+ 53b:	cd 40                	int    $0x40
+ 53d:	c3                   	ret
+
+0000053e <mmap>:
+SYSCALL(mmap)
+ 53e:	b8 22 00 00 00       	mov    $0x22,%eax
+ 543:	cd 40                	int    $0x40
+ 545:	c3                   	ret
+
+00000546 <munmap>:
+SYSCALL(munmap)
+ 546:	b8 23 00 00 00       	mov    $0x23,%eax
+ 54b:	cd 40                	int    $0x40
+ 54d:	c3                   	ret
+
+0000054e <bstat>:
+SYSCALL(bstat)
+ 54e:	b8 24 00 00 00       	mov    $0x24,%eax
+ 553:	cd 40                	int    $0x40
+ 555:	c3                   	ret
+
+00000556 <aread>:
+SYSCALL(aread)
+ 556:	b8 25 00 00 00       	mov    $0x25,%eax
+ 55b:	cd 40                	int    $0x40
+ 55d:	c3                   	ret
+
+0000055e <await>:
+SYSCALL(await)
+ 55e:	b8 26 00 00 00       	mov    $0x26,%eax
+ 563:	cd 40                	int    $0x40
+ 565:	c3                   	ret
+
+00000566 <bdrop>:
+SYSCALL(bdrop)
+ 566:	b8 27 00 00 00       	mov    $0x27,%eax
+ 56b:	cd 40                	int    $0x40
+ 56d:	c3                   	ret
+
+0000056e <vfork>:
+# exec or exit, and its ret would leave the slot holding our
+# return address free for it to overwrite.  Keep the return
+# address in %ecx, which the kernel restores for both sides.
+.globl vfork
+vfork:
+  popl %ecx
+ 56e:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+ 56f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  int $T_SYSCALL
+ 574:	cd 40                	int    $0x40
+  pushl %ecx
+ 576:	51                   	push   %ecx
+  ret
+ 577:	c3                   	ret
+
+00000578 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 578:	55                   	push   %ebp
+ 579:	89 e5                	mov    %esp,%ebp
+ 57b:	83 ec 1c             	sub    $0x1c,%esp
+ 57e:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 581:	6a 01                	push   $0x1
+ 583:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 586:	52                   	push   %edx
+ 587:	50                   	push   %eax
+ 588:	e8 d9 fe ff ff       	call   466 <write>
+}
+ 58d:	83 c4 10             	add    $0x10,%esp
+ 590:	c9                   	leave
+ 591:	c3                   	ret
+
+00000592 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 592:	55                   	push   %ebp
+ 593:	89 e5                	mov    %esp,%ebp
+ 595:	57                   	push   %edi
+ 596:	56                   	push   %esi
+ 597:	53                   	push   %ebx
+ 598:	83 ec 2c             	sub    $0x2c,%esp
+ 59b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 59e:	89 d0                	mov    %edx,%eax
+ 5a0:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 5a2:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 5a6:	0f 95 c1             	setne  %cl
+ 5a9:	c1 ea 1f             	shr    $0x1f,%edx
+ 5ac:	84 d1                	test   %dl,%cl
+ 5ae:	74 44                	je     5f4 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 5b0:	f7 d8                	neg    %eax
+ 5b2:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 5b4:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 5c0:	89 c8                	mov    %ecx,%eax
+ 5c2:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5c7:	f7 f6                	div    %esi
+ 5c9:	89 df                	mov    %ebx,%edi
+ 5cb:	83 c3 01             	add    $0x1,%ebx
+ 5ce:	0f b6 92 08 0a 00 00 	movzbl 0xa08(%edx),%edx
+ 5d5:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 5d9:	89 ca                	mov    %ecx,%edx
+ 5db:	89 c1                	mov    %eax,%ecx
+ 5dd:	39 f2                	cmp    %esi,%edx
+ 5df:	73 df                	jae    5c0 <printint+0x2e>
+  if(neg)
+ 5e1:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 5e5:	74 31                	je     618 <printint+0x86>
+    buf[i++] = '-';
+ 5e7:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 5ec:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 5ef:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 5f2:	eb 17                	jmp    60b <printint+0x79>
+    x = xx;
+ 5f4:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 5f6:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 5fd:	eb bc                	jmp    5bb <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5ff:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 604:	89 f0                	mov    %esi,%eax
+ 606:	e8 6d ff ff ff       	call   578 <putc>
+  while(--i >= 0)
+ 60b:	83 eb 01             	sub    $0x1,%ebx
+ 60e:	79 ef                	jns    5ff <printint+0x6d>
+}
+ 610:	83 c4 2c             	add    $0x2c,%esp
+ 613:	5b                   	pop    %ebx
+ 614:	5e                   	pop    %esi
+ 615:	5f                   	pop    %edi
+ 616:	5d                   	pop    %ebp
+ 617:	c3                   	ret
+ 618:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 61b:	eb ee                	jmp    60b <printint+0x79>
+
+0000061d <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 61d:	55                   	push   %ebp
+ 61e:	89 e5                	mov    %esp,%ebp
+ 620:	57                   	push   %edi
+ 621:	56                   	push   %esi
+ 622:	53                   	push   %ebx
+ 623:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 626:	8d 45 10             	lea    0x10(%ebp),%eax
+ 629:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 62c:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 631:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 636:	eb 14                	jmp    64c <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 638:	89 fa                	mov    %edi,%edx
+ 63a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 63d:	e8 36 ff ff ff       	call   578 <putc>
+ 642:	eb 05                	jmp    649 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 644:	83 fe 25             	cmp    $0x25,%esi
+ 647:	74 25                	je     66e <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 649:	83 c3 01             	add    $0x1,%ebx
+ 64c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 64f:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 653:	84 c0                	test   %al,%al
+ 655:	0f 84 20 01 00 00    	je     77b <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 65b:	0f be f8             	movsbl %al,%edi
+ 65e:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 661:	85 f6                	test   %esi,%esi
+ 663:	75 df                	jne    644 <printf+0x27>
+      if(c == '%'){
+ 665:	83 f8 25             	cmp    $0x25,%eax
+ 668:	75 ce                	jne    638 <printf+0x1b>
+        state = '%';
+ 66a:	89 c6                	mov    %eax,%esi
+ 66c:	eb db                	jmp    649 <printf+0x2c>
+      if(c == 'd'){
+ 66e:	83 f8 25             	cmp    $0x25,%eax
+ 671:	0f 84 cf 00 00 00    	je     746 <printf+0x129>
+ 677:	0f 8c dd 00 00 00    	jl     75a <printf+0x13d>
+ 67d:	83 f8 78             	cmp    $0x78,%eax
+ 680:	0f 8f d4 00 00 00    	jg     75a <printf+0x13d>
+ 686:	83 f8 63             	cmp    $0x63,%eax
+ 689:	0f 8c cb 00 00 00    	jl     75a <printf+0x13d>
+ 68f:	83 e8 63             	sub    $0x63,%eax
+ 692:	83 f8 15             	cmp    $0x15,%eax
+ 695:	0f 87 bf 00 00 00    	ja     75a <printf+0x13d>
+ 69b:	ff 24 85 b0 09 00 00 	jmp    *0x9b0(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 6a2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 6a5:	8b 17                	mov    (%edi),%edx
+ 6a7:	83 ec 0c             	sub    $0xc,%esp
+ 6aa:	6a 01                	push   $0x1
+ 6ac:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 6b1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6b4:	e8 d9 fe ff ff       	call   592 <printint>
+        ap++;
+ 6b9:	83 c7 04             	add    $0x4,%edi
+ 6bc:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 6bf:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 6c2:	be 00 00 00 00       	mov    $0x0,%esi
+ 6c7:	eb 80                	jmp    649 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 6c9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 6cc:	8b 17                	mov    (%edi),%edx
+ 6ce:	83 ec 0c             	sub    $0xc,%esp
+ 6d1:	6a 00                	push   $0x0
+ 6d3:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6d8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6db:	e8 b2 fe ff ff       	call   592 <printint>
+        ap++;
+ 6e0:	83 c7 04             	add    $0x4,%edi
+ 6e3:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 6e6:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6e9:	be 00 00 00 00       	mov    $0x0,%esi
+ 6ee:	e9 56 ff ff ff       	jmp    649 <printf+0x2c>
+        s = (char*)*ap;
+ 6f3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6f6:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 6f8:	83 c0 04             	add    $0x4,%eax
+ 6fb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 6fe:	85 f6                	test   %esi,%esi
+ 700:	75 15                	jne    717 <printf+0xfa>
+          s = "(null)";
+ 702:	be a8 09 00 00       	mov    $0x9a8,%esi
+ 707:	eb 0e                	jmp    717 <printf+0xfa>
+          putc(fd, *s);
+ 709:	0f be d2             	movsbl %dl,%edx
+ 70c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 70f:	e8 64 fe ff ff       	call   578 <putc>
+          s++;
+ 714:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 717:	0f b6 16             	movzbl (%esi),%edx
+ 71a:	84 d2                	test   %dl,%dl
+ 71c:	75 eb                	jne    709 <printf+0xec>
+      state = 0;
+ 71e:	be 00 00 00 00       	mov    $0x0,%esi
+ 723:	e9 21 ff ff ff       	jmp    649 <printf+0x2c>
+        putc(fd, *ap);
+ 728:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 72b:	0f be 17             	movsbl (%edi),%edx
+ 72e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 731:	e8 42 fe ff ff       	call   578 <putc>
+        ap++;
+ 736:	83 c7 04             	add    $0x4,%edi
+ 739:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 73c:	be 00 00 00 00       	mov    $0x0,%esi
+ 741:	e9 03 ff ff ff       	jmp    649 <printf+0x2c>
+        putc(fd, c);
+ 746:	89 fa                	mov    %edi,%edx
+ 748:	8b 45 08             	mov    0x8(%ebp),%eax
+ 74b:	e8 28 fe ff ff       	call   578 <putc>
+      state = 0;
+ 750:	be 00 00 00 00       	mov    $0x0,%esi
+ 755:	e9 ef fe ff ff       	jmp    649 <printf+0x2c>
+        putc(fd, '%');
+ 75a:	ba 25 00 00 00       	mov    $0x25,%edx
+ 75f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 762:	e8 11 fe ff ff       	call   578 <putc>
+        putc(fd, c);
+ 767:	89 fa                	mov    %edi,%edx
+ 769:	8b 45 08             	mov    0x8(%ebp),%eax
+ 76c:	e8 07 fe ff ff       	call   578 <putc>
+      state = 0;
+ 771:	be 00 00 00 00       	mov    $0x0,%esi
+ 776:	e9 ce fe ff ff       	jmp    649 <printf+0x2c>
+    }
+  }
+}
+ 77b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 77e:	5b                   	pop    %ebx
+ 77f:	5e                   	pop    %esi
+ 780:	5f                   	pop    %edi
+ 781:	5d                   	pop    %ebp
+ 782:	c3                   	ret
+
+00000783 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 783:	55                   	push   %ebp
+ 784:	89 e5                	mov    %esp,%ebp
+ 786:	57                   	push   %edi
+ 787:	56                   	push   %esi
+ 788:	53                   	push   %ebx
+ 789:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 78c:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 78f:	a1 dc 0c 00 00       	mov    0xcdc,%eax
+ 794:	eb 02                	jmp    798 <free+0x15>
+ 796:	89 d0                	mov    %edx,%eax
+ 798:	39 c8                	cmp    %ecx,%eax
+ 79a:	73 04                	jae    7a0 <free+0x1d>
+ 79c:	3b 08                	cmp    (%eax),%ecx
+ 79e:	72 12                	jb     7b2 <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7a0:	8b 10                	mov    (%eax),%edx
+ 7a2:	39 d0                	cmp    %edx,%eax
+ 7a4:	72 f0                	jb     796 <free+0x13>
+ 7a6:	39 c8                	cmp    %ecx,%eax
+ 7a8:	72 08                	jb     7b2 <free+0x2f>
+ 7aa:	39 d1                	cmp    %edx,%ecx
+ 7ac:	72 04                	jb     7b2 <free+0x2f>
+ 7ae:	89 d0                	mov    %edx,%eax
+ 7b0:	eb e6                	jmp    798 <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7b2:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 7b5:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 7b8:	8b 10                	mov    (%eax),%edx
+ 7ba:	39 d7                	cmp    %edx,%edi
+ 7bc:	74 19                	je     7d7 <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 7be:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 7c1:	8b 50 04             	mov    0x4(%eax),%edx
+ 7c4:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 7c7:	39 ce                	cmp    %ecx,%esi
+ 7c9:	74 1b                	je     7e6 <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 7cb:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 7cd:	a3 dc 0c 00 00       	mov    %eax,0xcdc
+}
+ 7d2:	5b                   	pop    %ebx
+ 7d3:	5e                   	pop    %esi
+ 7d4:	5f                   	pop    %edi
+ 7d5:	5d                   	pop    %ebp
+ 7d6:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 7d7:	03 72 04             	add    0x4(%edx),%esi
+ 7da:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7dd:	8b 10                	mov    (%eax),%edx
+ 7df:	8b 12                	mov    (%edx),%edx
+ 7e1:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 7e4:	eb db                	jmp    7c1 <free+0x3e>
+    p->s.size += bp->s.size;
+ 7e6:	03 53 fc             	add    -0x4(%ebx),%edx
+ 7e9:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 7ec:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 7ef:	89 10                	mov    %edx,(%eax)
+ 7f1:	eb da                	jmp    7cd <free+0x4a>
+
+000007f3 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 7f3:	55                   	push   %ebp
+ 7f4:	89 e5                	mov    %esp,%ebp
+ 7f6:	53                   	push   %ebx
+ 7f7:	83 ec 04             	sub    $0x4,%esp
+ 7fa:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 7fc:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 801:	77 05                	ja     808 <morecore+0x15>
+    nu = 4096;
+ 803:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 808:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 80f:	83 ec 0c             	sub    $0xc,%esp
+ 812:	50                   	push   %eax
+ 813:	e8 b6 fc ff ff       	call   4ce <sbrk>
+  if(p == (char*)-1)
+ 818:	83 c4 10             	add    $0x10,%esp
+ 81b:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 81e:	74 1c                	je     83c <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 820:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 823:	83 c0 08             	add    $0x8,%eax
+ 826:	83 ec 0c             	sub    $0xc,%esp
+ 829:	50                   	push   %eax
+ 82a:	e8 54 ff ff ff       	call   783 <free>
+  return freep;
+ 82f:	a1 dc 0c 00 00       	mov    0xcdc,%eax
+ 834:	83 c4 10             	add    $0x10,%esp
+}
+ 837:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 83a:	c9                   	leave
+ 83b:	c3                   	ret
+    return 0;
+ 83c:	b8 00 00 00 00       	mov    $0x0,%eax
+ 841:	eb f4                	jmp    837 <morecore+0x44>
+
+00000843 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 843:	55                   	push   %ebp
+ 844:	89 e5                	mov    %esp,%ebp
+ 846:	53                   	push   %ebx
+ 847:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 84a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 84d:	8d 58 07             	lea    0x7(%eax),%ebx
+ 850:	c1 eb 03             	shr    $0x3,%ebx
+ 853:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 856:	8b 0d dc 0c 00 00    	mov    0xcdc,%ecx
+ 85c:	85 c9                	test   %ecx,%ecx
+ 85e:	74 04                	je     864 <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 860:	8b 01                	mov    (%ecx),%eax
+ 862:	eb 4a                	jmp    8ae <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 864:	c7 05 dc 0c 00 00 e0 	movl   $0xce0,0xcdc
+ 86b:	0c 00 00 
+ 86e:	c7 05 e0 0c 00 00 e0 	movl   $0xce0,0xce0
+ 875:	0c 00 00 
+    base.s.size = 0;
+ 878:	c7 05 e4 0c 00 00 00 	movl   $0x0,0xce4
+ 87f:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 882:	b9 e0 0c 00 00       	mov    $0xce0,%ecx
+ 887:	eb d7                	jmp    860 <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 889:	74 19                	je     8a4 <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 88b:	29 da                	sub    %ebx,%edx
+ 88d:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 890:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 893:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 896:	89 0d dc 0c 00 00    	mov    %ecx,0xcdc
+      return (void*)(p + 1);
+ 89c:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 89f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 8a2:	c9                   	leave
+ 8a3:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 8a4:	8b 10                	mov    (%eax),%edx
+ 8a6:	89 11                	mov    %edx,(%ecx)
+ 8a8:	eb ec                	jmp    896 <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8aa:	89 c1                	mov    %eax,%ecx
+ 8ac:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 8ae:	8b 50 04             	mov    0x4(%eax),%edx
+ 8b1:	39 da                	cmp    %ebx,%edx
+ 8b3:	73 d4                	jae    889 <malloc+0x46>
+    if(p == freep)
+ 8b5:	39 05 dc 0c 00 00    	cmp    %eax,0xcdc
+ 8bb:	75 ed                	jne    8aa <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 8bd:	89 d8                	mov    %ebx,%eax
+ 8bf:	e8 2f ff ff ff       	call   7f3 <morecore>
+ 8c4:	85 c0                	test   %eax,%eax
+ 8c6:	75 e2                	jne    8aa <malloc+0x67>
+ 8c8:	eb d5                	jmp    89f <malloc+0x5c>
@@ -28,16 +28,15 @@ int main(int argc, char* argv[]) {
     char* job = argv[3];
     int job_count = parseInt(argv[4]);
     int pids[job_count];
-    for (int i = 0; i < job_count; i++) {
-        pids[i] = fork2(1);
-        if (pids[i] < 0) {
-        } else if (pids[i] == 0) {
-            // child process
-            char* temp_argv[] = {job, 0};
-            exec(job, temp_argv);
-            printf(1, "exec failed\n");
-            exit();
-        }
+    // launch every job at priority 1 in a single call instead of
+    // fork2()+exec() per job, so our image is never copied
+    char* temp_argv[] = {job, 0};
+    int launched = spawnn(job, temp_argv, 1, job_count, pids);
+    if (launched < job_count) {
+        printf(1, "exec failed\n");
+    }
+    for (int i = launched < 0 ? 0 : launched; i < job_count; i++) {
+        pids[i] = -1;
     }
     for (int itr = 0; itr < iterations; itr++) {
         for(int i = 0; i < sizeof(pids)/sizeof(pids[0]); i++) {
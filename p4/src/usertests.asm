@@ -0,0 +1,9377 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <iputtest>:
+int stdout = 1;
+
+// does chdir() call iput(p->cwd) in a transaction?
+void
+iputtest(void)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+       6:	68 d4 4f 00 00       	push   $0x4fd4
+       b:	ff 35 48 78 00 00    	push   0x7848
+      11:	e8 7d 4c 00 00       	call   4c93 <printf>
+
+  if(mkdir("iputdir") < 0){
+      16:	c7 04 24 67 4f 00 00 	movl   $0x4f67,(%esp)
+      1d:	e8 02 4b 00 00       	call   4b24 <mkdir>
+      22:	83 c4 10             	add    $0x10,%esp
+      25:	85 c0                	test   %eax,%eax
+      27:	78 54                	js     7d <iputtest+0x7d>
+    printf(stdout, "mkdir failed\n");
+    exit();
+  }
+  if(chdir("iputdir") < 0){
+      29:	83 ec 0c             	sub    $0xc,%esp
+      2c:	68 67 4f 00 00       	push   $0x4f67
+      31:	e8 f6 4a 00 00       	call   4b2c <chdir>
+      36:	83 c4 10             	add    $0x10,%esp
+      39:	85 c0                	test   %eax,%eax
+      3b:	78 58                	js     95 <iputtest+0x95>
+    printf(stdout, "chdir iputdir failed\n");
+    exit();
+  }
+  if(unlink("../iputdir") < 0){
+      3d:	83 ec 0c             	sub    $0xc,%esp
+      40:	68 64 4f 00 00       	push   $0x4f64
+      45:	e8 c2 4a 00 00       	call   4b0c <unlink>
+      4a:	83 c4 10             	add    $0x10,%esp
+      4d:	85 c0                	test   %eax,%eax
+      4f:	78 5c                	js     ad <iputtest+0xad>
+    printf(stdout, "unlink ../iputdir failed\n");
+    exit();
+  }
+  if(chdir("/") < 0){
+      51:	83 ec 0c             	sub    $0xc,%esp
+      54:	68 89 4f 00 00       	push   $0x4f89
+      59:	e8 ce 4a 00 00       	call   4b2c <chdir>
+      5e:	83 c4 10             	add    $0x10,%esp
+      61:	85 c0                	test   %eax,%eax
+      63:	78 60                	js     c5 <iputtest+0xc5>
+    printf(stdout, "chdir / failed\n");
+    exit();
+  }
+  printf(stdout, "iput test ok\n");
+      65:	83 ec 08             	sub    $0x8,%esp
+      68:	68 0c 50 00 00       	push   $0x500c
+      6d:	ff 35 48 78 00 00    	push   0x7848
+      73:	e8 1b 4c 00 00       	call   4c93 <printf>
+}
+      78:	83 c4 10             	add    $0x10,%esp
+      7b:	c9                   	leave
+      7c:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+      7d:	83 ec 08             	sub    $0x8,%esp
+      80:	68 40 4f 00 00       	push   $0x4f40
+      85:	ff 35 48 78 00 00    	push   0x7848
+      8b:	e8 03 4c 00 00       	call   4c93 <printf>
+    exit();
+      90:	e8 27 4a 00 00       	call   4abc <exit>
+    printf(stdout, "chdir iputdir failed\n");
+      95:	83 ec 08             	sub    $0x8,%esp
+      98:	68 4e 4f 00 00       	push   $0x4f4e
+      9d:	ff 35 48 78 00 00    	push   0x7848
+      a3:	e8 eb 4b 00 00       	call   4c93 <printf>
+    exit();
+      a8:	e8 0f 4a 00 00       	call   4abc <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+      ad:	83 ec 08             	sub    $0x8,%esp
+      b0:	68 6f 4f 00 00       	push   $0x4f6f
+      b5:	ff 35 48 78 00 00    	push   0x7848
+      bb:	e8 d3 4b 00 00       	call   4c93 <printf>
+    exit();
+      c0:	e8 f7 49 00 00       	call   4abc <exit>
+    printf(stdout, "chdir / failed\n");
+      c5:	83 ec 08             	sub    $0x8,%esp
+      c8:	68 8b 4f 00 00       	push   $0x4f8b
+      cd:	ff 35 48 78 00 00    	push   0x7848
+      d3:	e8 bb 4b 00 00       	call   4c93 <printf>
+    exit();
+      d8:	e8 df 49 00 00       	call   4abc <exit>
+
+000000dd <exitiputtest>:
+
+// does exit() call iput(p->cwd) in a transaction?
+void
+exitiputtest(void)
+{
+      dd:	55                   	push   %ebp
+      de:	89 e5                	mov    %esp,%ebp
+      e0:	83 ec 10             	sub    $0x10,%esp
+  int pid;
+
+  printf(stdout, "exitiput test\n");
+      e3:	68 9b 4f 00 00       	push   $0x4f9b
+      e8:	ff 35 48 78 00 00    	push   0x7848
+      ee:	e8 a0 4b 00 00       	call   4c93 <printf>
+
+  pid = fork();
+      f3:	e8 bc 49 00 00       	call   4ab4 <fork>
+  if(pid < 0){
+      f8:	83 c4 10             	add    $0x10,%esp
+      fb:	85 c0                	test   %eax,%eax
+      fd:	78 47                	js     146 <exitiputtest+0x69>
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+      ff:	0f 85 a1 00 00 00    	jne    1a6 <exitiputtest+0xc9>
+    if(mkdir("iputdir") < 0){
+     105:	83 ec 0c             	sub    $0xc,%esp
+     108:	68 67 4f 00 00       	push   $0x4f67
+     10d:	e8 12 4a 00 00       	call   4b24 <mkdir>
+     112:	83 c4 10             	add    $0x10,%esp
+     115:	85 c0                	test   %eax,%eax
+     117:	78 45                	js     15e <exitiputtest+0x81>
+      printf(stdout, "mkdir failed\n");
+      exit();
+    }
+    if(chdir("iputdir") < 0){
+     119:	83 ec 0c             	sub    $0xc,%esp
+     11c:	68 67 4f 00 00       	push   $0x4f67
+     121:	e8 06 4a 00 00       	call   4b2c <chdir>
+     126:	83 c4 10             	add    $0x10,%esp
+     129:	85 c0                	test   %eax,%eax
+     12b:	78 49                	js     176 <exitiputtest+0x99>
+      printf(stdout, "child chdir failed\n");
+      exit();
+    }
+    if(unlink("../iputdir") < 0){
+     12d:	83 ec 0c             	sub    $0xc,%esp
+     130:	68 64 4f 00 00       	push   $0x4f64
+     135:	e8 d2 49 00 00       	call   4b0c <unlink>
+     13a:	83 c4 10             	add    $0x10,%esp
+     13d:	85 c0                	test   %eax,%eax
+     13f:	78 4d                	js     18e <exitiputtest+0xb1>
+      printf(stdout, "unlink ../iputdir failed\n");
+      exit();
+    }
+    exit();
+     141:	e8 76 49 00 00       	call   4abc <exit>
+    printf(stdout, "fork failed\n");
+     146:	83 ec 08             	sub    $0x8,%esp
+     149:	68 61 63 00 00       	push   $0x6361
+     14e:	ff 35 48 78 00 00    	push   0x7848
+     154:	e8 3a 4b 00 00       	call   4c93 <printf>
+    exit();
+     159:	e8 5e 49 00 00       	call   4abc <exit>
+      printf(stdout, "mkdir failed\n");
+     15e:	83 ec 08             	sub    $0x8,%esp
+     161:	68 40 4f 00 00       	push   $0x4f40
+     166:	ff 35 48 78 00 00    	push   0x7848
+     16c:	e8 22 4b 00 00       	call   4c93 <printf>
+      exit();
+     171:	e8 46 49 00 00       	call   4abc <exit>
+      printf(stdout, "child chdir failed\n");
+     176:	83 ec 08             	sub    $0x8,%esp
+     179:	68 aa 4f 00 00       	push   $0x4faa
+     17e:	ff 35 48 78 00 00    	push   0x7848
+     184:	e8 0a 4b 00 00       	call   4c93 <printf>
+      exit();
+     189:	e8 2e 49 00 00       	call   4abc <exit>
+      printf(stdout, "unlink ../iputdir failed\n");
+     18e:	83 ec 08             	sub    $0x8,%esp
+     191:	68 6f 4f 00 00       	push   $0x4f6f
+     196:	ff 35 48 78 00 00    	push   0x7848
+     19c:	e8 f2 4a 00 00       	call   4c93 <printf>
+      exit();
+     1a1:	e8 16 49 00 00       	call   4abc <exit>
+  }
+  wait();
+     1a6:	e8 19 49 00 00       	call   4ac4 <wait>
+  printf(stdout, "exitiput test ok\n");
+     1ab:	83 ec 08             	sub    $0x8,%esp
+     1ae:	68 be 4f 00 00       	push   $0x4fbe
+     1b3:	ff 35 48 78 00 00    	push   0x7848
+     1b9:	e8 d5 4a 00 00       	call   4c93 <printf>
+}
+     1be:	83 c4 10             	add    $0x10,%esp
+     1c1:	c9                   	leave
+     1c2:	c3                   	ret
+
+000001c3 <openiputtest>:
+//      for(i = 0; i < 10000; i++)
+//        yield();
+//    }
+void
+openiputtest(void)
+{
+     1c3:	55                   	push   %ebp
+     1c4:	89 e5                	mov    %esp,%ebp
+     1c6:	83 ec 10             	sub    $0x10,%esp
+  int pid;
+
+  printf(stdout, "openiput test\n");
+     1c9:	68 d0 4f 00 00       	push   $0x4fd0
+     1ce:	ff 35 48 78 00 00    	push   0x7848
+     1d4:	e8 ba 4a 00 00       	call   4c93 <printf>
+  if(mkdir("oidir") < 0){
+     1d9:	c7 04 24 df 4f 00 00 	movl   $0x4fdf,(%esp)
+     1e0:	e8 3f 49 00 00       	call   4b24 <mkdir>
+     1e5:	83 c4 10             	add    $0x10,%esp
+     1e8:	85 c0                	test   %eax,%eax
+     1ea:	78 39                	js     225 <openiputtest+0x62>
+    printf(stdout, "mkdir oidir failed\n");
+    exit();
+  }
+  pid = fork();
+     1ec:	e8 c3 48 00 00       	call   4ab4 <fork>
+  if(pid < 0){
+     1f1:	85 c0                	test   %eax,%eax
+     1f3:	78 48                	js     23d <openiputtest+0x7a>
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+     1f5:	75 63                	jne    25a <openiputtest+0x97>
+    int fd = open("oidir", O_RDWR);
+     1f7:	83 ec 08             	sub    $0x8,%esp
+     1fa:	6a 02                	push   $0x2
+     1fc:	68 df 4f 00 00       	push   $0x4fdf
+     201:	e8 f6 48 00 00       	call   4afc <open>
+    if(fd >= 0){
+     206:	83 c4 10             	add    $0x10,%esp
+     209:	85 c0                	test   %eax,%eax
+     20b:	78 48                	js     255 <openiputtest+0x92>
+      printf(stdout, "open directory for write succeeded\n");
+     20d:	83 ec 08             	sub    $0x8,%esp
+     210:	68 34 64 00 00       	push   $0x6434
+     215:	ff 35 48 78 00 00    	push   0x7848
+     21b:	e8 73 4a 00 00       	call   4c93 <printf>
+      exit();
+     220:	e8 97 48 00 00       	call   4abc <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     225:	83 ec 08             	sub    $0x8,%esp
+     228:	68 e5 4f 00 00       	push   $0x4fe5
+     22d:	ff 35 48 78 00 00    	push   0x7848
+     233:	e8 5b 4a 00 00       	call   4c93 <printf>
+    exit();
+     238:	e8 7f 48 00 00       	call   4abc <exit>
+    printf(stdout, "fork failed\n");
+     23d:	83 ec 08             	sub    $0x8,%esp
+     240:	68 61 63 00 00       	push   $0x6361
+     245:	ff 35 48 78 00 00    	push   0x7848
+     24b:	e8 43 4a 00 00       	call   4c93 <printf>
+    exit();
+     250:	e8 67 48 00 00       	call   4abc <exit>
+    }
+    exit();
+     255:	e8 62 48 00 00       	call   4abc <exit>
+  }
+  sleep(1);
+     25a:	83 ec 0c             	sub    $0xc,%esp
+     25d:	6a 01                	push   $0x1
+     25f:	e8 e8 48 00 00       	call   4b4c <sleep>
+  if(unlink("oidir") != 0){
+     264:	c7 04 24 df 4f 00 00 	movl   $0x4fdf,(%esp)
+     26b:	e8 9c 48 00 00       	call   4b0c <unlink>
+     270:	83 c4 10             	add    $0x10,%esp
+     273:	85 c0                	test   %eax,%eax
+     275:	75 1d                	jne    294 <openiputtest+0xd1>
+    printf(stdout, "unlink failed\n");
+    exit();
+  }
+  wait();
+     277:	e8 48 48 00 00       	call   4ac4 <wait>
+  printf(stdout, "openiput test ok\n");
+     27c:	83 ec 08             	sub    $0x8,%esp
+     27f:	68 08 50 00 00       	push   $0x5008
+     284:	ff 35 48 78 00 00    	push   0x7848
+     28a:	e8 04 4a 00 00       	call   4c93 <printf>
+}
+     28f:	83 c4 10             	add    $0x10,%esp
+     292:	c9                   	leave
+     293:	c3                   	ret
+    printf(stdout, "unlink failed\n");
+     294:	83 ec 08             	sub    $0x8,%esp
+     297:	68 f9 4f 00 00       	push   $0x4ff9
+     29c:	ff 35 48 78 00 00    	push   0x7848
+     2a2:	e8 ec 49 00 00       	call   4c93 <printf>
+    exit();
+     2a7:	e8 10 48 00 00       	call   4abc <exit>
+
+000002ac <opentest>:
+
+// simple file system tests
+
+void
+opentest(void)
+{
+     2ac:	55                   	push   %ebp
+     2ad:	89 e5                	mov    %esp,%ebp
+     2af:	83 ec 10             	sub    $0x10,%esp
+  int fd;
+
+  printf(stdout, "open test\n");
+     2b2:	68 1a 50 00 00       	push   $0x501a
+     2b7:	ff 35 48 78 00 00    	push   0x7848
+     2bd:	e8 d1 49 00 00       	call   4c93 <printf>
+  fd = open("echo", 0);
+     2c2:	83 c4 08             	add    $0x8,%esp
+     2c5:	6a 00                	push   $0x0
+     2c7:	68 25 50 00 00       	push   $0x5025
+     2cc:	e8 2b 48 00 00       	call   4afc <open>
+  if(fd < 0){
+     2d1:	83 c4 10             	add    $0x10,%esp
+     2d4:	85 c0                	test   %eax,%eax
+     2d6:	78 37                	js     30f <opentest+0x63>
+    printf(stdout, "open echo failed!\n");
+    exit();
+  }
+  close(fd);
+     2d8:	83 ec 0c             	sub    $0xc,%esp
+     2db:	50                   	push   %eax
+     2dc:	e8 03 48 00 00       	call   4ae4 <close>
+  fd = open("doesnotexist", 0);
+     2e1:	83 c4 08             	add    $0x8,%esp
+     2e4:	6a 00                	push   $0x0
+     2e6:	68 3d 50 00 00       	push   $0x503d
+     2eb:	e8 0c 48 00 00       	call   4afc <open>
+  if(fd >= 0){
+     2f0:	83 c4 10             	add    $0x10,%esp
+     2f3:	85 c0                	test   %eax,%eax
+     2f5:	79 30                	jns    327 <opentest+0x7b>
+    printf(stdout, "open doesnotexist succeeded!\n");
+    exit();
+  }
+  printf(stdout, "open test ok\n");
+     2f7:	83 ec 08             	sub    $0x8,%esp
+     2fa:	68 68 50 00 00       	push   $0x5068
+     2ff:	ff 35 48 78 00 00    	push   0x7848
+     305:	e8 89 49 00 00       	call   4c93 <printf>
+}
+     30a:	83 c4 10             	add    $0x10,%esp
+     30d:	c9                   	leave
+     30e:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     30f:	83 ec 08             	sub    $0x8,%esp
+     312:	68 2a 50 00 00       	push   $0x502a
+     317:	ff 35 48 78 00 00    	push   0x7848
+     31d:	e8 71 49 00 00       	call   4c93 <printf>
+    exit();
+     322:	e8 95 47 00 00       	call   4abc <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     327:	83 ec 08             	sub    $0x8,%esp
+     32a:	68 4a 50 00 00       	push   $0x504a
+     32f:	ff 35 48 78 00 00    	push   0x7848
+     335:	e8 59 49 00 00       	call   4c93 <printf>
+    exit();
+     33a:	e8 7d 47 00 00       	call   4abc <exit>
+
+0000033f <writetest>:
+
+void
+writetest(void)
+{
+     33f:	55                   	push   %ebp
+     340:	89 e5                	mov    %esp,%ebp
+     342:	56                   	push   %esi
+     343:	53                   	push   %ebx
+  int fd;
+  int i;
+
+  printf(stdout, "small file test\n");
+     344:	83 ec 08             	sub    $0x8,%esp
+     347:	68 76 50 00 00       	push   $0x5076
+     34c:	ff 35 48 78 00 00    	push   0x7848
+     352:	e8 3c 49 00 00       	call   4c93 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     357:	83 c4 08             	add    $0x8,%esp
+     35a:	68 02 02 00 00       	push   $0x202
+     35f:	68 87 50 00 00       	push   $0x5087
+     364:	e8 93 47 00 00       	call   4afc <open>
+  if(fd >= 0){
+     369:	83 c4 10             	add    $0x10,%esp
+     36c:	85 c0                	test   %eax,%eax
+     36e:	78 57                	js     3c7 <writetest+0x88>
+     370:	89 c6                	mov    %eax,%esi
+    printf(stdout, "creat small succeeded; ok\n");
+     372:	83 ec 08             	sub    $0x8,%esp
+     375:	68 8d 50 00 00       	push   $0x508d
+     37a:	ff 35 48 78 00 00    	push   0x7848
+     380:	e8 0e 49 00 00       	call   4c93 <printf>
+  } else {
+    printf(stdout, "error: creat small failed!\n");
+    exit();
+  }
+  for(i = 0; i < 100; i++){
+     385:	83 c4 10             	add    $0x10,%esp
+     388:	bb 00 00 00 00       	mov    $0x0,%ebx
+     38d:	83 fb 63             	cmp    $0x63,%ebx
+     390:	7f 7f                	jg     411 <writetest+0xd2>
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     392:	83 ec 04             	sub    $0x4,%esp
+     395:	6a 0a                	push   $0xa
+     397:	68 c4 50 00 00       	push   $0x50c4
+     39c:	56                   	push   %esi
+     39d:	e8 3a 47 00 00       	call   4adc <write>
+     3a2:	83 c4 10             	add    $0x10,%esp
+     3a5:	83 f8 0a             	cmp    $0xa,%eax
+     3a8:	75 35                	jne    3df <writetest+0xa0>
+      printf(stdout, "error: write aa %d new file failed\n", i);
+      exit();
+    }
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     3aa:	83 ec 04             	sub    $0x4,%esp
+     3ad:	6a 0a                	push   $0xa
+     3af:	68 cf 50 00 00       	push   $0x50cf
+     3b4:	56                   	push   %esi
+     3b5:	e8 22 47 00 00       	call   4adc <write>
+     3ba:	83 c4 10             	add    $0x10,%esp
+     3bd:	83 f8 0a             	cmp    $0xa,%eax
+     3c0:	75 36                	jne    3f8 <writetest+0xb9>
+  for(i = 0; i < 100; i++){
+     3c2:	83 c3 01             	add    $0x1,%ebx
+     3c5:	eb c6                	jmp    38d <writetest+0x4e>
+    printf(stdout, "error: creat small failed!\n");
+     3c7:	83 ec 08             	sub    $0x8,%esp
+     3ca:	68 a8 50 00 00       	push   $0x50a8
+     3cf:	ff 35 48 78 00 00    	push   0x7848
+     3d5:	e8 b9 48 00 00       	call   4c93 <printf>
+    exit();
+     3da:	e8 dd 46 00 00       	call   4abc <exit>
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     3df:	83 ec 04             	sub    $0x4,%esp
+     3e2:	53                   	push   %ebx
+     3e3:	68 58 64 00 00       	push   $0x6458
+     3e8:	ff 35 48 78 00 00    	push   0x7848
+     3ee:	e8 a0 48 00 00       	call   4c93 <printf>
+      exit();
+     3f3:	e8 c4 46 00 00       	call   4abc <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     3f8:	83 ec 04             	sub    $0x4,%esp
+     3fb:	53                   	push   %ebx
+     3fc:	68 7c 64 00 00       	push   $0x647c
+     401:	ff 35 48 78 00 00    	push   0x7848
+     407:	e8 87 48 00 00       	call   4c93 <printf>
+      exit();
+     40c:	e8 ab 46 00 00       	call   4abc <exit>
+    }
+  }
+  printf(stdout, "writes ok\n");
+     411:	83 ec 08             	sub    $0x8,%esp
+     414:	68 da 50 00 00       	push   $0x50da
+     419:	ff 35 48 78 00 00    	push   0x7848
+     41f:	e8 6f 48 00 00       	call   4c93 <printf>
+  close(fd);
+     424:	89 34 24             	mov    %esi,(%esp)
+     427:	e8 b8 46 00 00       	call   4ae4 <close>
+  fd = open("small", O_RDONLY);
+     42c:	83 c4 08             	add    $0x8,%esp
+     42f:	6a 00                	push   $0x0
+     431:	68 87 50 00 00       	push   $0x5087
+     436:	e8 c1 46 00 00       	call   4afc <open>
+     43b:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     43d:	83 c4 10             	add    $0x10,%esp
+     440:	85 c0                	test   %eax,%eax
+     442:	78 7b                	js     4bf <writetest+0x180>
+    printf(stdout, "open small succeeded ok\n");
+     444:	83 ec 08             	sub    $0x8,%esp
+     447:	68 e5 50 00 00       	push   $0x50e5
+     44c:	ff 35 48 78 00 00    	push   0x7848
+     452:	e8 3c 48 00 00       	call   4c93 <printf>
+  } else {
+    printf(stdout, "error: open small failed!\n");
+    exit();
+  }
+  i = read(fd, buf, 2000);
+     457:	83 c4 0c             	add    $0xc,%esp
+     45a:	68 d0 07 00 00       	push   $0x7d0
+     45f:	68 a0 cf 00 00       	push   $0xcfa0
+     464:	53                   	push   %ebx
+     465:	e8 6a 46 00 00       	call   4ad4 <read>
+  if(i == 2000){
+     46a:	83 c4 10             	add    $0x10,%esp
+     46d:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     472:	75 63                	jne    4d7 <writetest+0x198>
+    printf(stdout, "read succeeded ok\n");
+     474:	83 ec 08             	sub    $0x8,%esp
+     477:	68 19 51 00 00       	push   $0x5119
+     47c:	ff 35 48 78 00 00    	push   0x7848
+     482:	e8 0c 48 00 00       	call   4c93 <printf>
+  } else {
+    printf(stdout, "read failed\n");
+    exit();
+  }
+  close(fd);
+     487:	89 1c 24             	mov    %ebx,(%esp)
+     48a:	e8 55 46 00 00       	call   4ae4 <close>
+
+  if(unlink("small") < 0){
+     48f:	c7 04 24 87 50 00 00 	movl   $0x5087,(%esp)
+     496:	e8 71 46 00 00       	call   4b0c <unlink>
+     49b:	83 c4 10             	add    $0x10,%esp
+     49e:	85 c0                	test   %eax,%eax
+     4a0:	78 4d                	js     4ef <writetest+0x1b0>
+    printf(stdout, "unlink small failed\n");
+    exit();
+  }
+  printf(stdout, "small file test ok\n");
+     4a2:	83 ec 08             	sub    $0x8,%esp
+     4a5:	68 41 51 00 00       	push   $0x5141
+     4aa:	ff 35 48 78 00 00    	push   0x7848
+     4b0:	e8 de 47 00 00       	call   4c93 <printf>
+}
+     4b5:	83 c4 10             	add    $0x10,%esp
+     4b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4bb:	5b                   	pop    %ebx
+     4bc:	5e                   	pop    %esi
+     4bd:	5d                   	pop    %ebp
+     4be:	c3                   	ret
+    printf(stdout, "error: open small failed!\n");
+     4bf:	83 ec 08             	sub    $0x8,%esp
+     4c2:	68 fe 50 00 00       	push   $0x50fe
+     4c7:	ff 35 48 78 00 00    	push   0x7848
+     4cd:	e8 c1 47 00 00       	call   4c93 <printf>
+    exit();
+     4d2:	e8 e5 45 00 00       	call   4abc <exit>
+    printf(stdout, "read failed\n");
+     4d7:	83 ec 08             	sub    $0x8,%esp
+     4da:	68 9c 5d 00 00       	push   $0x5d9c
+     4df:	ff 35 48 78 00 00    	push   0x7848
+     4e5:	e8 a9 47 00 00       	call   4c93 <printf>
+    exit();
+     4ea:	e8 cd 45 00 00       	call   4abc <exit>
+    printf(stdout, "unlink small failed\n");
+     4ef:	83 ec 08             	sub    $0x8,%esp
+     4f2:	68 2c 51 00 00       	push   $0x512c
+     4f7:	ff 35 48 78 00 00    	push   0x7848
+     4fd:	e8 91 47 00 00       	call   4c93 <printf>
+    exit();
+     502:	e8 b5 45 00 00       	call   4abc <exit>
+
+00000507 <writetest1>:
+
+void
+writetest1(void)
+{
+     507:	55                   	push   %ebp
+     508:	89 e5                	mov    %esp,%ebp
+     50a:	56                   	push   %esi
+     50b:	53                   	push   %ebx
+  int i, fd, n;
+
+  printf(stdout, "big files test\n");
+     50c:	83 ec 08             	sub    $0x8,%esp
+     50f:	68 55 51 00 00       	push   $0x5155
+     514:	ff 35 48 78 00 00    	push   0x7848
+     51a:	e8 74 47 00 00       	call   4c93 <printf>
+
+  fd = open("big", O_CREATE|O_RDWR);
+     51f:	83 c4 08             	add    $0x8,%esp
+     522:	68 02 02 00 00       	push   $0x202
+     527:	68 cf 51 00 00       	push   $0x51cf
+     52c:	e8 cb 45 00 00       	call   4afc <open>
+  if(fd < 0){
+     531:	83 c4 10             	add    $0x10,%esp
+     534:	85 c0                	test   %eax,%eax
+     536:	78 37                	js     56f <writetest1+0x68>
+     538:	89 c6                	mov    %eax,%esi
+    printf(stdout, "error: creat big failed!\n");
+    exit();
+  }
+
+  for(i = 0; i < MAXFILE; i++){
+     53a:	bb 00 00 00 00       	mov    $0x0,%ebx
+     53f:	81 fb 8b 00 00 00    	cmp    $0x8b,%ebx
+     545:	77 59                	ja     5a0 <writetest1+0x99>
+    ((int*)buf)[0] = i;
+     547:	89 1d a0 cf 00 00    	mov    %ebx,0xcfa0
+    if(write(fd, buf, 512) != 512){
+     54d:	83 ec 04             	sub    $0x4,%esp
+     550:	68 00 02 00 00       	push   $0x200
+     555:	68 a0 cf 00 00       	push   $0xcfa0
+     55a:	56                   	push   %esi
+     55b:	e8 7c 45 00 00       	call   4adc <write>
+     560:	83 c4 10             	add    $0x10,%esp
+     563:	3d 00 02 00 00       	cmp    $0x200,%eax
+     568:	75 1d                	jne    587 <writetest1+0x80>
+  for(i = 0; i < MAXFILE; i++){
+     56a:	83 c3 01             	add    $0x1,%ebx
+     56d:	eb d0                	jmp    53f <writetest1+0x38>
+    printf(stdout, "error: creat big failed!\n");
+     56f:	83 ec 08             	sub    $0x8,%esp
+     572:	68 65 51 00 00       	push   $0x5165
+     577:	ff 35 48 78 00 00    	push   0x7848
+     57d:	e8 11 47 00 00       	call   4c93 <printf>
+    exit();
+     582:	e8 35 45 00 00       	call   4abc <exit>
+      printf(stdout, "error: write big file failed\n", i);
+     587:	83 ec 04             	sub    $0x4,%esp
+     58a:	53                   	push   %ebx
+     58b:	68 7f 51 00 00       	push   $0x517f
+     590:	ff 35 48 78 00 00    	push   0x7848
+     596:	e8 f8 46 00 00       	call   4c93 <printf>
+      exit();
+     59b:	e8 1c 45 00 00       	call   4abc <exit>
+    }
+  }
+
+  close(fd);
+     5a0:	83 ec 0c             	sub    $0xc,%esp
+     5a3:	56                   	push   %esi
+     5a4:	e8 3b 45 00 00       	call   4ae4 <close>
+
+  fd = open("big", O_RDONLY);
+     5a9:	83 c4 08             	add    $0x8,%esp
+     5ac:	6a 00                	push   $0x0
+     5ae:	68 cf 51 00 00       	push   $0x51cf
+     5b3:	e8 44 45 00 00       	call   4afc <open>
+     5b8:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+     5ba:	83 c4 10             	add    $0x10,%esp
+     5bd:	85 c0                	test   %eax,%eax
+     5bf:	78 3c                	js     5fd <writetest1+0xf6>
+    printf(stdout, "error: open big failed!\n");
+    exit();
+  }
+
+  n = 0;
+     5c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(;;){
+    i = read(fd, buf, 512);
+     5c6:	83 ec 04             	sub    $0x4,%esp
+     5c9:	68 00 02 00 00       	push   $0x200
+     5ce:	68 a0 cf 00 00       	push   $0xcfa0
+     5d3:	56                   	push   %esi
+     5d4:	e8 fb 44 00 00       	call   4ad4 <read>
+    if(i == 0){
+     5d9:	83 c4 10             	add    $0x10,%esp
+     5dc:	85 c0                	test   %eax,%eax
+     5de:	74 35                	je     615 <writetest1+0x10e>
+      if(n == MAXFILE - 1){
+        printf(stdout, "read only %d blocks from big", n);
+        exit();
+      }
+      break;
+    } else if(i != 512){
+     5e0:	3d 00 02 00 00       	cmp    $0x200,%eax
+     5e5:	0f 85 84 00 00 00    	jne    66f <writetest1+0x168>
+      printf(stdout, "read failed %d\n", i);
+      exit();
+    }
+    if(((int*)buf)[0] != n){
+     5eb:	a1 a0 cf 00 00       	mov    0xcfa0,%eax
+     5f0:	39 d8                	cmp    %ebx,%eax
+     5f2:	0f 85 90 00 00 00    	jne    688 <writetest1+0x181>
+      printf(stdout, "read content of block %d is %d\n",
+             n, ((int*)buf)[0]);
+      exit();
+    }
+    n++;
+     5f8:	83 c3 01             	add    $0x1,%ebx
+    i = read(fd, buf, 512);
+     5fb:	eb c9                	jmp    5c6 <writetest1+0xbf>
+    printf(stdout, "error: open big failed!\n");
+     5fd:	83 ec 08             	sub    $0x8,%esp
+     600:	68 9d 51 00 00       	push   $0x519d
+     605:	ff 35 48 78 00 00    	push   0x7848
+     60b:	e8 83 46 00 00       	call   4c93 <printf>
+    exit();
+     610:	e8 a7 44 00 00       	call   4abc <exit>
+      if(n == MAXFILE - 1){
+     615:	81 fb 8b 00 00 00    	cmp    $0x8b,%ebx
+     61b:	74 39                	je     656 <writetest1+0x14f>
+  }
+  close(fd);
+     61d:	83 ec 0c             	sub    $0xc,%esp
+     620:	56                   	push   %esi
+     621:	e8 be 44 00 00       	call   4ae4 <close>
+  if(unlink("big") < 0){
+     626:	c7 04 24 cf 51 00 00 	movl   $0x51cf,(%esp)
+     62d:	e8 da 44 00 00       	call   4b0c <unlink>
+     632:	83 c4 10             	add    $0x10,%esp
+     635:	85 c0                	test   %eax,%eax
+     637:	78 66                	js     69f <writetest1+0x198>
+    printf(stdout, "unlink big failed\n");
+    exit();
+  }
+  printf(stdout, "big files ok\n");
+     639:	83 ec 08             	sub    $0x8,%esp
+     63c:	68 f6 51 00 00       	push   $0x51f6
+     641:	ff 35 48 78 00 00    	push   0x7848
+     647:	e8 47 46 00 00       	call   4c93 <printf>
+}
+     64c:	83 c4 10             	add    $0x10,%esp
+     64f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     652:	5b                   	pop    %ebx
+     653:	5e                   	pop    %esi
+     654:	5d                   	pop    %ebp
+     655:	c3                   	ret
+        printf(stdout, "read only %d blocks from big", n);
+     656:	83 ec 04             	sub    $0x4,%esp
+     659:	53                   	push   %ebx
+     65a:	68 b6 51 00 00       	push   $0x51b6
+     65f:	ff 35 48 78 00 00    	push   0x7848
+     665:	e8 29 46 00 00       	call   4c93 <printf>
+        exit();
+     66a:	e8 4d 44 00 00       	call   4abc <exit>
+      printf(stdout, "read failed %d\n", i);
+     66f:	83 ec 04             	sub    $0x4,%esp
+     672:	50                   	push   %eax
+     673:	68 d3 51 00 00       	push   $0x51d3
+     678:	ff 35 48 78 00 00    	push   0x7848
+     67e:	e8 10 46 00 00       	call   4c93 <printf>
+      exit();
+     683:	e8 34 44 00 00       	call   4abc <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     688:	50                   	push   %eax
+     689:	53                   	push   %ebx
+     68a:	68 a0 64 00 00       	push   $0x64a0
+     68f:	ff 35 48 78 00 00    	push   0x7848
+     695:	e8 f9 45 00 00       	call   4c93 <printf>
+      exit();
+     69a:	e8 1d 44 00 00       	call   4abc <exit>
+    printf(stdout, "unlink big failed\n");
+     69f:	83 ec 08             	sub    $0x8,%esp
+     6a2:	68 e3 51 00 00       	push   $0x51e3
+     6a7:	ff 35 48 78 00 00    	push   0x7848
+     6ad:	e8 e1 45 00 00       	call   4c93 <printf>
+    exit();
+     6b2:	e8 05 44 00 00       	call   4abc <exit>
+
+000006b7 <createtest>:
+
+void
+createtest(void)
+{
+     6b7:	55                   	push   %ebp
+     6b8:	89 e5                	mov    %esp,%ebp
+     6ba:	53                   	push   %ebx
+     6bb:	83 ec 0c             	sub    $0xc,%esp
+  int i, fd;
+
+  printf(stdout, "many creates, followed by unlink test\n");
+     6be:	68 c0 64 00 00       	push   $0x64c0
+     6c3:	ff 35 48 78 00 00    	push   0x7848
+     6c9:	e8 c5 45 00 00       	call   4c93 <printf>
+
+  name[0] = 'a';
+     6ce:	c6 05 80 cf 00 00 61 	movb   $0x61,0xcf80
+  name[2] = '\0';
+     6d5:	c6 05 82 cf 00 00 00 	movb   $0x0,0xcf82
+  for(i = 0; i < 52; i++){
+     6dc:	83 c4 10             	add    $0x10,%esp
+     6df:	bb 00 00 00 00       	mov    $0x0,%ebx
+     6e4:	eb 28                	jmp    70e <createtest+0x57>
+    name[1] = '0' + i;
+     6e6:	8d 43 30             	lea    0x30(%ebx),%eax
+     6e9:	a2 81 cf 00 00       	mov    %al,0xcf81
+    fd = open(name, O_CREATE|O_RDWR);
+     6ee:	83 ec 08             	sub    $0x8,%esp
+     6f1:	68 02 02 00 00       	push   $0x202
+     6f6:	68 80 cf 00 00       	push   $0xcf80
+     6fb:	e8 fc 43 00 00       	call   4afc <open>
+    close(fd);
+     700:	89 04 24             	mov    %eax,(%esp)
+     703:	e8 dc 43 00 00       	call   4ae4 <close>
+  for(i = 0; i < 52; i++){
+     708:	83 c3 01             	add    $0x1,%ebx
+     70b:	83 c4 10             	add    $0x10,%esp
+     70e:	83 fb 33             	cmp    $0x33,%ebx
+     711:	7e d3                	jle    6e6 <createtest+0x2f>
+  }
+  name[0] = 'a';
+     713:	c6 05 80 cf 00 00 61 	movb   $0x61,0xcf80
+  name[2] = '\0';
+     71a:	c6 05 82 cf 00 00 00 	movb   $0x0,0xcf82
+  for(i = 0; i < 52; i++){
+     721:	bb 00 00 00 00       	mov    $0x0,%ebx
+     726:	eb 1b                	jmp    743 <createtest+0x8c>
+    name[1] = '0' + i;
+     728:	8d 43 30             	lea    0x30(%ebx),%eax
+     72b:	a2 81 cf 00 00       	mov    %al,0xcf81
+    unlink(name);
+     730:	83 ec 0c             	sub    $0xc,%esp
+     733:	68 80 cf 00 00       	push   $0xcf80
+     738:	e8 cf 43 00 00       	call   4b0c <unlink>
+  for(i = 0; i < 52; i++){
+     73d:	83 c3 01             	add    $0x1,%ebx
+     740:	83 c4 10             	add    $0x10,%esp
+     743:	83 fb 33             	cmp    $0x33,%ebx
+     746:	7e e0                	jle    728 <createtest+0x71>
+  }
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     748:	83 ec 08             	sub    $0x8,%esp
+     74b:	68 e8 64 00 00       	push   $0x64e8
+     750:	ff 35 48 78 00 00    	push   0x7848
+     756:	e8 38 45 00 00       	call   4c93 <printf>
+}
+     75b:	83 c4 10             	add    $0x10,%esp
+     75e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     761:	c9                   	leave
+     762:	c3                   	ret
+
+00000763 <dirtest>:
+
+void dirtest(void)
+{
+     763:	55                   	push   %ebp
+     764:	89 e5                	mov    %esp,%ebp
+     766:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     769:	68 04 52 00 00       	push   $0x5204
+     76e:	ff 35 48 78 00 00    	push   0x7848
+     774:	e8 1a 45 00 00       	call   4c93 <printf>
+
+  if(mkdir("dir0") < 0){
+     779:	c7 04 24 10 52 00 00 	movl   $0x5210,(%esp)
+     780:	e8 9f 43 00 00       	call   4b24 <mkdir>
+     785:	83 c4 10             	add    $0x10,%esp
+     788:	85 c0                	test   %eax,%eax
+     78a:	78 54                	js     7e0 <dirtest+0x7d>
+    printf(stdout, "mkdir failed\n");
+    exit();
+  }
+
+  if(chdir("dir0") < 0){
+     78c:	83 ec 0c             	sub    $0xc,%esp
+     78f:	68 10 52 00 00       	push   $0x5210
+     794:	e8 93 43 00 00       	call   4b2c <chdir>
+     799:	83 c4 10             	add    $0x10,%esp
+     79c:	85 c0                	test   %eax,%eax
+     79e:	78 58                	js     7f8 <dirtest+0x95>
+    printf(stdout, "chdir dir0 failed\n");
+    exit();
+  }
+
+  if(chdir("..") < 0){
+     7a0:	83 ec 0c             	sub    $0xc,%esp
+     7a3:	68 b5 57 00 00       	push   $0x57b5
+     7a8:	e8 7f 43 00 00       	call   4b2c <chdir>
+     7ad:	83 c4 10             	add    $0x10,%esp
+     7b0:	85 c0                	test   %eax,%eax
+     7b2:	78 5c                	js     810 <dirtest+0xad>
+    printf(stdout, "chdir .. failed\n");
+    exit();
+  }
+
+  if(unlink("dir0") < 0){
+     7b4:	83 ec 0c             	sub    $0xc,%esp
+     7b7:	68 10 52 00 00       	push   $0x5210
+     7bc:	e8 4b 43 00 00       	call   4b0c <unlink>
+     7c1:	83 c4 10             	add    $0x10,%esp
+     7c4:	85 c0                	test   %eax,%eax
+     7c6:	78 60                	js     828 <dirtest+0xc5>
+    printf(stdout, "unlink dir0 failed\n");
+    exit();
+  }
+  printf(stdout, "mkdir test ok\n");
+     7c8:	83 ec 08             	sub    $0x8,%esp
+     7cb:	68 4d 52 00 00       	push   $0x524d
+     7d0:	ff 35 48 78 00 00    	push   0x7848
+     7d6:	e8 b8 44 00 00       	call   4c93 <printf>
+}
+     7db:	83 c4 10             	add    $0x10,%esp
+     7de:	c9                   	leave
+     7df:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     7e0:	83 ec 08             	sub    $0x8,%esp
+     7e3:	68 40 4f 00 00       	push   $0x4f40
+     7e8:	ff 35 48 78 00 00    	push   0x7848
+     7ee:	e8 a0 44 00 00       	call   4c93 <printf>
+    exit();
+     7f3:	e8 c4 42 00 00       	call   4abc <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     7f8:	83 ec 08             	sub    $0x8,%esp
+     7fb:	68 15 52 00 00       	push   $0x5215
+     800:	ff 35 48 78 00 00    	push   0x7848
+     806:	e8 88 44 00 00       	call   4c93 <printf>
+    exit();
+     80b:	e8 ac 42 00 00       	call   4abc <exit>
+    printf(stdout, "chdir .. failed\n");
+     810:	83 ec 08             	sub    $0x8,%esp
+     813:	68 28 52 00 00       	push   $0x5228
+     818:	ff 35 48 78 00 00    	push   0x7848
+     81e:	e8 70 44 00 00       	call   4c93 <printf>
+    exit();
+     823:	e8 94 42 00 00       	call   4abc <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     828:	83 ec 08             	sub    $0x8,%esp
+     82b:	68 39 52 00 00       	push   $0x5239
+     830:	ff 35 48 78 00 00    	push   0x7848
+     836:	e8 58 44 00 00       	call   4c93 <printf>
+    exit();
+     83b:	e8 7c 42 00 00       	call   4abc <exit>
+
+00000840 <exectest>:
+
+void
+exectest(void)
+{
+     840:	55                   	push   %ebp
+     841:	89 e5                	mov    %esp,%ebp
+     843:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     846:	68 5c 52 00 00       	push   $0x525c
+     84b:	ff 35 48 78 00 00    	push   0x7848
+     851:	e8 3d 44 00 00       	call   4c93 <printf>
+  if(exec("echo", echoargv) < 0){
+     856:	83 c4 08             	add    $0x8,%esp
+     859:	68 4c 78 00 00       	push   $0x784c
+     85e:	68 25 50 00 00       	push   $0x5025
+     863:	e8 8c 42 00 00       	call   4af4 <exec>
+     868:	83 c4 10             	add    $0x10,%esp
+     86b:	85 c0                	test   %eax,%eax
+     86d:	78 02                	js     871 <exectest+0x31>
+    printf(stdout, "exec echo failed\n");
+    exit();
+  }
+}
+     86f:	c9                   	leave
+     870:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     871:	83 ec 08             	sub    $0x8,%esp
+     874:	68 67 52 00 00       	push   $0x5267
+     879:	ff 35 48 78 00 00    	push   0x7848
+     87f:	e8 0f 44 00 00       	call   4c93 <printf>
+    exit();
+     884:	e8 33 42 00 00       	call   4abc <exit>
+
+00000889 <pipe1>:
+
+// simple fork and pipe read/write
+
+void
+pipe1(void)
+{
+     889:	55                   	push   %ebp
+     88a:	89 e5                	mov    %esp,%ebp
+     88c:	57                   	push   %edi
+     88d:	56                   	push   %esi
+     88e:	53                   	push   %ebx
+     88f:	83 ec 38             	sub    $0x38,%esp
+  int fds[2], pid;
+  int seq, i, n, cc, total;
+
+  if(pipe(fds) != 0){
+     892:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     895:	50                   	push   %eax
+     896:	e8 31 42 00 00       	call   4acc <pipe>
+     89b:	83 c4 10             	add    $0x10,%esp
+     89e:	85 c0                	test   %eax,%eax
+     8a0:	75 74                	jne    916 <pipe1+0x8d>
+     8a2:	89 c6                	mov    %eax,%esi
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  pid = fork();
+     8a4:	e8 0b 42 00 00       	call   4ab4 <fork>
+     8a9:	89 c7                	mov    %eax,%edi
+  seq = 0;
+  if(pid == 0){
+     8ab:	85 c0                	test   %eax,%eax
+     8ad:	74 7b                	je     92a <pipe1+0xa1>
+        printf(1, "pipe1 oops 1\n");
+        exit();
+      }
+    }
+    exit();
+  } else if(pid > 0){
+     8af:	0f 8e 60 01 00 00    	jle    a15 <pipe1+0x18c>
+    close(fds[1]);
+     8b5:	83 ec 0c             	sub    $0xc,%esp
+     8b8:	ff 75 e4             	push   -0x1c(%ebp)
+     8bb:	e8 24 42 00 00       	call   4ae4 <close>
+    total = 0;
+    cc = 1;
+    while((n = read(fds[0], buf, cc)) > 0){
+     8c0:	83 c4 10             	add    $0x10,%esp
+    total = 0;
+     8c3:	89 75 d0             	mov    %esi,-0x30(%ebp)
+  seq = 0;
+     8c6:	89 f3                	mov    %esi,%ebx
+    cc = 1;
+     8c8:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+    while((n = read(fds[0], buf, cc)) > 0){
+     8cf:	83 ec 04             	sub    $0x4,%esp
+     8d2:	ff 75 d4             	push   -0x2c(%ebp)
+     8d5:	68 a0 cf 00 00       	push   $0xcfa0
+     8da:	ff 75 e0             	push   -0x20(%ebp)
+     8dd:	e8 f2 41 00 00       	call   4ad4 <read>
+     8e2:	89 c7                	mov    %eax,%edi
+     8e4:	83 c4 10             	add    $0x10,%esp
+     8e7:	85 c0                	test   %eax,%eax
+     8e9:	0f 8e e2 00 00 00    	jle    9d1 <pipe1+0x148>
+      for(i = 0; i < n; i++){
+     8ef:	89 f0                	mov    %esi,%eax
+     8f1:	89 d9                	mov    %ebx,%ecx
+     8f3:	39 f8                	cmp    %edi,%eax
+     8f5:	0f 8d b4 00 00 00    	jge    9af <pipe1+0x126>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     8fb:	0f be 98 a0 cf 00 00 	movsbl 0xcfa0(%eax),%ebx
+     902:	8d 51 01             	lea    0x1(%ecx),%edx
+     905:	31 cb                	xor    %ecx,%ebx
+     907:	84 db                	test   %bl,%bl
+     909:	0f 85 86 00 00 00    	jne    995 <pipe1+0x10c>
+      for(i = 0; i < n; i++){
+     90f:	83 c0 01             	add    $0x1,%eax
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     912:	89 d1                	mov    %edx,%ecx
+     914:	eb dd                	jmp    8f3 <pipe1+0x6a>
+    printf(1, "pipe() failed\n");
+     916:	83 ec 08             	sub    $0x8,%esp
+     919:	68 79 52 00 00       	push   $0x5279
+     91e:	6a 01                	push   $0x1
+     920:	e8 6e 43 00 00       	call   4c93 <printf>
+    exit();
+     925:	e8 92 41 00 00       	call   4abc <exit>
+    close(fds[0]);
+     92a:	83 ec 0c             	sub    $0xc,%esp
+     92d:	ff 75 e0             	push   -0x20(%ebp)
+     930:	e8 af 41 00 00       	call   4ae4 <close>
+    for(n = 0; n < 5; n++){
+     935:	83 c4 10             	add    $0x10,%esp
+     938:	89 fe                	mov    %edi,%esi
+  seq = 0;
+     93a:	89 fb                	mov    %edi,%ebx
+    for(n = 0; n < 5; n++){
+     93c:	eb 35                	jmp    973 <pipe1+0xea>
+        buf[i] = seq++;
+     93e:	88 98 a0 cf 00 00    	mov    %bl,0xcfa0(%eax)
+      for(i = 0; i < 1033; i++)
+     944:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     947:	8d 5b 01             	lea    0x1(%ebx),%ebx
+      for(i = 0; i < 1033; i++)
+     94a:	3d 08 04 00 00       	cmp    $0x408,%eax
+     94f:	7e ed                	jle    93e <pipe1+0xb5>
+      if(write(fds[1], buf, 1033) != 1033){
+     951:	83 ec 04             	sub    $0x4,%esp
+     954:	68 09 04 00 00       	push   $0x409
+     959:	68 a0 cf 00 00       	push   $0xcfa0
+     95e:	ff 75 e4             	push   -0x1c(%ebp)
+     961:	e8 76 41 00 00       	call   4adc <write>
+     966:	83 c4 10             	add    $0x10,%esp
+     969:	3d 09 04 00 00       	cmp    $0x409,%eax
+     96e:	75 0c                	jne    97c <pipe1+0xf3>
+    for(n = 0; n < 5; n++){
+     970:	83 c6 01             	add    $0x1,%esi
+     973:	83 fe 04             	cmp    $0x4,%esi
+     976:	7f 18                	jg     990 <pipe1+0x107>
+      for(i = 0; i < 1033; i++)
+     978:	89 f8                	mov    %edi,%eax
+     97a:	eb ce                	jmp    94a <pipe1+0xc1>
+        printf(1, "pipe1 oops 1\n");
+     97c:	83 ec 08             	sub    $0x8,%esp
+     97f:	68 88 52 00 00       	push   $0x5288
+     984:	6a 01                	push   $0x1
+     986:	e8 08 43 00 00       	call   4c93 <printf>
+        exit();
+     98b:	e8 2c 41 00 00       	call   4abc <exit>
+    exit();
+     990:	e8 27 41 00 00       	call   4abc <exit>
+          printf(1, "pipe1 oops 2\n");
+     995:	83 ec 08             	sub    $0x8,%esp
+     998:	68 96 52 00 00       	push   $0x5296
+     99d:	6a 01                	push   $0x1
+     99f:	e8 ef 42 00 00       	call   4c93 <printf>
+          return;
+     9a4:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(1, "fork() failed\n");
+    exit();
+  }
+  printf(1, "pipe1 ok\n");
+}
+     9a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     9aa:	5b                   	pop    %ebx
+     9ab:	5e                   	pop    %esi
+     9ac:	5f                   	pop    %edi
+     9ad:	5d                   	pop    %ebp
+     9ae:	c3                   	ret
+      total += n;
+     9af:	89 cb                	mov    %ecx,%ebx
+     9b1:	01 7d d0             	add    %edi,-0x30(%ebp)
+      cc = cc * 2;
+     9b4:	d1 65 d4             	shll   -0x2c(%ebp)
+     9b7:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+      if(cc > sizeof(buf))
+     9ba:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     9bf:	0f 86 0a ff ff ff    	jbe    8cf <pipe1+0x46>
+        cc = sizeof(buf);
+     9c5:	c7 45 d4 00 20 00 00 	movl   $0x2000,-0x2c(%ebp)
+     9cc:	e9 fe fe ff ff       	jmp    8cf <pipe1+0x46>
+    if(total != 5 * 1033){
+     9d1:	81 7d d0 2d 14 00 00 	cmpl   $0x142d,-0x30(%ebp)
+     9d8:	75 24                	jne    9fe <pipe1+0x175>
+    close(fds[0]);
+     9da:	83 ec 0c             	sub    $0xc,%esp
+     9dd:	ff 75 e0             	push   -0x20(%ebp)
+     9e0:	e8 ff 40 00 00       	call   4ae4 <close>
+    wait();
+     9e5:	e8 da 40 00 00       	call   4ac4 <wait>
+  printf(1, "pipe1 ok\n");
+     9ea:	83 c4 08             	add    $0x8,%esp
+     9ed:	68 bb 52 00 00       	push   $0x52bb
+     9f2:	6a 01                	push   $0x1
+     9f4:	e8 9a 42 00 00       	call   4c93 <printf>
+     9f9:	83 c4 10             	add    $0x10,%esp
+     9fc:	eb a9                	jmp    9a7 <pipe1+0x11e>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     9fe:	83 ec 04             	sub    $0x4,%esp
+     a01:	ff 75 d0             	push   -0x30(%ebp)
+     a04:	68 a4 52 00 00       	push   $0x52a4
+     a09:	6a 01                	push   $0x1
+     a0b:	e8 83 42 00 00       	call   4c93 <printf>
+      exit();
+     a10:	e8 a7 40 00 00       	call   4abc <exit>
+    printf(1, "fork() failed\n");
+     a15:	83 ec 08             	sub    $0x8,%esp
+     a18:	68 c5 52 00 00       	push   $0x52c5
+     a1d:	6a 01                	push   $0x1
+     a1f:	e8 6f 42 00 00       	call   4c93 <printf>
+    exit();
+     a24:	e8 93 40 00 00       	call   4abc <exit>
+
+00000a29 <preempt>:
+
+// meant to be run w/ at most two CPUs
+void
+preempt(void)
+{
+     a29:	55                   	push   %ebp
+     a2a:	89 e5                	mov    %esp,%ebp
+     a2c:	57                   	push   %edi
+     a2d:	56                   	push   %esi
+     a2e:	53                   	push   %ebx
+     a2f:	83 ec 24             	sub    $0x24,%esp
+  int pid1, pid2, pid3;
+  int pfds[2];
+
+  printf(1, "preempt: ");
+     a32:	68 d4 52 00 00       	push   $0x52d4
+     a37:	6a 01                	push   $0x1
+     a39:	e8 55 42 00 00       	call   4c93 <printf>
+  pid1 = fork();
+     a3e:	e8 71 40 00 00       	call   4ab4 <fork>
+  if(pid1 == 0)
+     a43:	83 c4 10             	add    $0x10,%esp
+     a46:	85 c0                	test   %eax,%eax
+     a48:	75 02                	jne    a4c <preempt+0x23>
+    for(;;)
+     a4a:	eb fe                	jmp    a4a <preempt+0x21>
+     a4c:	89 c3                	mov    %eax,%ebx
+      ;
+
+  pid2 = fork();
+     a4e:	e8 61 40 00 00       	call   4ab4 <fork>
+     a53:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+     a55:	85 c0                	test   %eax,%eax
+     a57:	75 02                	jne    a5b <preempt+0x32>
+    for(;;)
+     a59:	eb fe                	jmp    a59 <preempt+0x30>
+      ;
+
+  pipe(pfds);
+     a5b:	83 ec 0c             	sub    $0xc,%esp
+     a5e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     a61:	50                   	push   %eax
+     a62:	e8 65 40 00 00       	call   4acc <pipe>
+  pid3 = fork();
+     a67:	e8 48 40 00 00       	call   4ab4 <fork>
+     a6c:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+     a6e:	83 c4 10             	add    $0x10,%esp
+     a71:	85 c0                	test   %eax,%eax
+     a73:	75 49                	jne    abe <preempt+0x95>
+    close(pfds[0]);
+     a75:	83 ec 0c             	sub    $0xc,%esp
+     a78:	ff 75 e0             	push   -0x20(%ebp)
+     a7b:	e8 64 40 00 00       	call   4ae4 <close>
+    if(write(pfds[1], "x", 1) != 1)
+     a80:	83 c4 0c             	add    $0xc,%esp
+     a83:	6a 01                	push   $0x1
+     a85:	68 99 58 00 00       	push   $0x5899
+     a8a:	ff 75 e4             	push   -0x1c(%ebp)
+     a8d:	e8 4a 40 00 00       	call   4adc <write>
+     a92:	83 c4 10             	add    $0x10,%esp
+     a95:	83 f8 01             	cmp    $0x1,%eax
+     a98:	75 10                	jne    aaa <preempt+0x81>
+      printf(1, "preempt write error");
+    close(pfds[1]);
+     a9a:	83 ec 0c             	sub    $0xc,%esp
+     a9d:	ff 75 e4             	push   -0x1c(%ebp)
+     aa0:	e8 3f 40 00 00       	call   4ae4 <close>
+     aa5:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+     aa8:	eb fe                	jmp    aa8 <preempt+0x7f>
+      printf(1, "preempt write error");
+     aaa:	83 ec 08             	sub    $0x8,%esp
+     aad:	68 de 52 00 00       	push   $0x52de
+     ab2:	6a 01                	push   $0x1
+     ab4:	e8 da 41 00 00       	call   4c93 <printf>
+     ab9:	83 c4 10             	add    $0x10,%esp
+     abc:	eb dc                	jmp    a9a <preempt+0x71>
+      ;
+  }
+
+  close(pfds[1]);
+     abe:	83 ec 0c             	sub    $0xc,%esp
+     ac1:	ff 75 e4             	push   -0x1c(%ebp)
+     ac4:	e8 1b 40 00 00       	call   4ae4 <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     ac9:	83 c4 0c             	add    $0xc,%esp
+     acc:	68 00 20 00 00       	push   $0x2000
+     ad1:	68 a0 cf 00 00       	push   $0xcfa0
+     ad6:	ff 75 e0             	push   -0x20(%ebp)
+     ad9:	e8 f6 3f 00 00       	call   4ad4 <read>
+     ade:	83 c4 10             	add    $0x10,%esp
+     ae1:	83 f8 01             	cmp    $0x1,%eax
+     ae4:	74 1a                	je     b00 <preempt+0xd7>
+    printf(1, "preempt read error");
+     ae6:	83 ec 08             	sub    $0x8,%esp
+     ae9:	68 f2 52 00 00       	push   $0x52f2
+     aee:	6a 01                	push   $0x1
+     af0:	e8 9e 41 00 00       	call   4c93 <printf>
+    return;
+     af5:	83 c4 10             	add    $0x10,%esp
+  printf(1, "wait... ");
+  wait();
+  wait();
+  wait();
+  printf(1, "preempt ok\n");
+}
+     af8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     afb:	5b                   	pop    %ebx
+     afc:	5e                   	pop    %esi
+     afd:	5f                   	pop    %edi
+     afe:	5d                   	pop    %ebp
+     aff:	c3                   	ret
+  close(pfds[0]);
+     b00:	83 ec 0c             	sub    $0xc,%esp
+     b03:	ff 75 e0             	push   -0x20(%ebp)
+     b06:	e8 d9 3f 00 00       	call   4ae4 <close>
+  printf(1, "kill... ");
+     b0b:	83 c4 08             	add    $0x8,%esp
+     b0e:	68 05 53 00 00       	push   $0x5305
+     b13:	6a 01                	push   $0x1
+     b15:	e8 79 41 00 00       	call   4c93 <printf>
+  kill(pid1);
+     b1a:	89 1c 24             	mov    %ebx,(%esp)
+     b1d:	e8 ca 3f 00 00       	call   4aec <kill>
+  kill(pid2);
+     b22:	89 34 24             	mov    %esi,(%esp)
+     b25:	e8 c2 3f 00 00       	call   4aec <kill>
+  kill(pid3);
+     b2a:	89 3c 24             	mov    %edi,(%esp)
+     b2d:	e8 ba 3f 00 00       	call   4aec <kill>
+  printf(1, "wait... ");
+     b32:	83 c4 08             	add    $0x8,%esp
+     b35:	68 0e 53 00 00       	push   $0x530e
+     b3a:	6a 01                	push   $0x1
+     b3c:	e8 52 41 00 00       	call   4c93 <printf>
+  wait();
+     b41:	e8 7e 3f 00 00       	call   4ac4 <wait>
+  wait();
+     b46:	e8 79 3f 00 00       	call   4ac4 <wait>
+  wait();
+     b4b:	e8 74 3f 00 00       	call   4ac4 <wait>
+  printf(1, "preempt ok\n");
+     b50:	83 c4 08             	add    $0x8,%esp
+     b53:	68 17 53 00 00       	push   $0x5317
+     b58:	6a 01                	push   $0x1
+     b5a:	e8 34 41 00 00       	call   4c93 <printf>
+     b5f:	83 c4 10             	add    $0x10,%esp
+     b62:	eb 94                	jmp    af8 <preempt+0xcf>
+
+00000b64 <exitwait>:
+
+// try to find any races between exit and wait
+void
+exitwait(void)
+{
+     b64:	55                   	push   %ebp
+     b65:	89 e5                	mov    %esp,%ebp
+     b67:	56                   	push   %esi
+     b68:	53                   	push   %ebx
+  int i, pid;
+
+  for(i = 0; i < 100; i++){
+     b69:	be 00 00 00 00       	mov    $0x0,%esi
+     b6e:	83 fe 63             	cmp    $0x63,%esi
+     b71:	7f 4d                	jg     bc0 <exitwait+0x5c>
+    pid = fork();
+     b73:	e8 3c 3f 00 00       	call   4ab4 <fork>
+     b78:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+     b7a:	85 c0                	test   %eax,%eax
+     b7c:	78 10                	js     b8e <exitwait+0x2a>
+      printf(1, "fork failed\n");
+      return;
+    }
+    if(pid){
+     b7e:	74 3b                	je     bbb <exitwait+0x57>
+      if(wait() != pid){
+     b80:	e8 3f 3f 00 00       	call   4ac4 <wait>
+     b85:	39 d8                	cmp    %ebx,%eax
+     b87:	75 1e                	jne    ba7 <exitwait+0x43>
+  for(i = 0; i < 100; i++){
+     b89:	83 c6 01             	add    $0x1,%esi
+     b8c:	eb e0                	jmp    b6e <exitwait+0xa>
+      printf(1, "fork failed\n");
+     b8e:	83 ec 08             	sub    $0x8,%esp
+     b91:	68 61 63 00 00       	push   $0x6361
+     b96:	6a 01                	push   $0x1
+     b98:	e8 f6 40 00 00       	call   4c93 <printf>
+      return;
+     b9d:	83 c4 10             	add    $0x10,%esp
+    } else {
+      exit();
+    }
+  }
+  printf(1, "exitwait ok\n");
+}
+     ba0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ba3:	5b                   	pop    %ebx
+     ba4:	5e                   	pop    %esi
+     ba5:	5d                   	pop    %ebp
+     ba6:	c3                   	ret
+        printf(1, "wait wrong pid\n");
+     ba7:	83 ec 08             	sub    $0x8,%esp
+     baa:	68 23 53 00 00       	push   $0x5323
+     baf:	6a 01                	push   $0x1
+     bb1:	e8 dd 40 00 00       	call   4c93 <printf>
+        return;
+     bb6:	83 c4 10             	add    $0x10,%esp
+     bb9:	eb e5                	jmp    ba0 <exitwait+0x3c>
+      exit();
+     bbb:	e8 fc 3e 00 00       	call   4abc <exit>
+  printf(1, "exitwait ok\n");
+     bc0:	83 ec 08             	sub    $0x8,%esp
+     bc3:	68 33 53 00 00       	push   $0x5333
+     bc8:	6a 01                	push   $0x1
+     bca:	e8 c4 40 00 00       	call   4c93 <printf>
+     bcf:	83 c4 10             	add    $0x10,%esp
+     bd2:	eb cc                	jmp    ba0 <exitwait+0x3c>
+
+00000bd4 <mem>:
+
+void
+mem(void)
+{
+     bd4:	55                   	push   %ebp
+     bd5:	89 e5                	mov    %esp,%ebp
+     bd7:	57                   	push   %edi
+     bd8:	56                   	push   %esi
+     bd9:	53                   	push   %ebx
+     bda:	83 ec 14             	sub    $0x14,%esp
+  void *m1, *m2;
+  int pid, ppid;
+
+  printf(1, "mem test\n");
+     bdd:	68 40 53 00 00       	push   $0x5340
+     be2:	6a 01                	push   $0x1
+     be4:	e8 aa 40 00 00       	call   4c93 <printf>
+  ppid = getpid();
+     be9:	e8 4e 3f 00 00       	call   4b3c <getpid>
+     bee:	89 c6                	mov    %eax,%esi
+  if((pid = fork()) == 0){
+     bf0:	e8 bf 3e 00 00       	call   4ab4 <fork>
+     bf5:	83 c4 10             	add    $0x10,%esp
+     bf8:	85 c0                	test   %eax,%eax
+     bfa:	0f 85 82 00 00 00    	jne    c82 <mem+0xae>
+    m1 = 0;
+     c00:	bb 00 00 00 00       	mov    $0x0,%ebx
+     c05:	eb 04                	jmp    c0b <mem+0x37>
+    while((m2 = malloc(10001)) != 0){
+      *(char**)m2 = m1;
+     c07:	89 18                	mov    %ebx,(%eax)
+      m1 = m2;
+     c09:	89 c3                	mov    %eax,%ebx
+    while((m2 = malloc(10001)) != 0){
+     c0b:	83 ec 0c             	sub    $0xc,%esp
+     c0e:	68 11 27 00 00       	push   $0x2711
+     c13:	e8 a1 42 00 00       	call   4eb9 <malloc>
+     c18:	83 c4 10             	add    $0x10,%esp
+     c1b:	85 c0                	test   %eax,%eax
+     c1d:	75 e8                	jne    c07 <mem+0x33>
+     c1f:	eb 10                	jmp    c31 <mem+0x5d>
+    }
+    while(m1){
+      m2 = *(char**)m1;
+     c21:	8b 3b                	mov    (%ebx),%edi
+      free(m1);
+     c23:	83 ec 0c             	sub    $0xc,%esp
+     c26:	53                   	push   %ebx
+     c27:	e8 cd 41 00 00       	call   4df9 <free>
+     c2c:	83 c4 10             	add    $0x10,%esp
+      m1 = m2;
+     c2f:	89 fb                	mov    %edi,%ebx
+    while(m1){
+     c31:	85 db                	test   %ebx,%ebx
+     c33:	75 ec                	jne    c21 <mem+0x4d>
+    }
+    m1 = malloc(1024*20);
+     c35:	83 ec 0c             	sub    $0xc,%esp
+     c38:	68 00 50 00 00       	push   $0x5000
+     c3d:	e8 77 42 00 00       	call   4eb9 <malloc>
+    if(m1 == 0){
+     c42:	83 c4 10             	add    $0x10,%esp
+     c45:	85 c0                	test   %eax,%eax
+     c47:	74 1d                	je     c66 <mem+0x92>
+      printf(1, "couldn't allocate mem?!!\n");
+      kill(ppid);
+      exit();
+    }
+    free(m1);
+     c49:	83 ec 0c             	sub    $0xc,%esp
+     c4c:	50                   	push   %eax
+     c4d:	e8 a7 41 00 00       	call   4df9 <free>
+    printf(1, "mem ok\n");
+     c52:	83 c4 08             	add    $0x8,%esp
+     c55:	68 64 53 00 00       	push   $0x5364
+     c5a:	6a 01                	push   $0x1
+     c5c:	e8 32 40 00 00       	call   4c93 <printf>
+    exit();
+     c61:	e8 56 3e 00 00       	call   4abc <exit>
+      printf(1, "couldn't allocate mem?!!\n");
+     c66:	83 ec 08             	sub    $0x8,%esp
+     c69:	68 4a 53 00 00       	push   $0x534a
+     c6e:	6a 01                	push   $0x1
+     c70:	e8 1e 40 00 00       	call   4c93 <printf>
+      kill(ppid);
+     c75:	89 34 24             	mov    %esi,(%esp)
+     c78:	e8 6f 3e 00 00       	call   4aec <kill>
+      exit();
+     c7d:	e8 3a 3e 00 00       	call   4abc <exit>
+  } else {
+    wait();
+     c82:	e8 3d 3e 00 00       	call   4ac4 <wait>
+  }
+}
+     c87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c8a:	5b                   	pop    %ebx
+     c8b:	5e                   	pop    %esi
+     c8c:	5f                   	pop    %edi
+     c8d:	5d                   	pop    %ebp
+     c8e:	c3                   	ret
+
+00000c8f <sharedfd>:
+
+// two processes write to the same file descriptor
+// is the offset shared? does inode locking work?
+void
+sharedfd(void)
+{
+     c8f:	55                   	push   %ebp
+     c90:	89 e5                	mov    %esp,%ebp
+     c92:	57                   	push   %edi
+     c93:	56                   	push   %esi
+     c94:	53                   	push   %ebx
+     c95:	83 ec 24             	sub    $0x24,%esp
+  int fd, pid, i, n, nc, np;
+  char buf[10];
+
+  printf(1, "sharedfd test\n");
+     c98:	68 6c 53 00 00       	push   $0x536c
+     c9d:	6a 01                	push   $0x1
+     c9f:	e8 ef 3f 00 00       	call   4c93 <printf>
+
+  unlink("sharedfd");
+     ca4:	c7 04 24 7b 53 00 00 	movl   $0x537b,(%esp)
+     cab:	e8 5c 3e 00 00       	call   4b0c <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+     cb0:	83 c4 08             	add    $0x8,%esp
+     cb3:	68 02 02 00 00       	push   $0x202
+     cb8:	68 7b 53 00 00       	push   $0x537b
+     cbd:	e8 3a 3e 00 00       	call   4afc <open>
+  if(fd < 0){
+     cc2:	83 c4 10             	add    $0x10,%esp
+     cc5:	85 c0                	test   %eax,%eax
+     cc7:	78 4d                	js     d16 <sharedfd+0x87>
+     cc9:	89 c6                	mov    %eax,%esi
+    printf(1, "fstests: cannot open sharedfd for writing");
+    return;
+  }
+  pid = fork();
+     ccb:	e8 e4 3d 00 00       	call   4ab4 <fork>
+     cd0:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     cd2:	85 c0                	test   %eax,%eax
+     cd4:	75 57                	jne    d2d <sharedfd+0x9e>
+     cd6:	b8 63 00 00 00       	mov    $0x63,%eax
+     cdb:	83 ec 04             	sub    $0x4,%esp
+     cde:	6a 0a                	push   $0xa
+     ce0:	50                   	push   %eax
+     ce1:	8d 45 de             	lea    -0x22(%ebp),%eax
+     ce4:	50                   	push   %eax
+     ce5:	e8 97 3c 00 00       	call   4981 <memset>
+  for(i = 0; i < 1000; i++){
+     cea:	83 c4 10             	add    $0x10,%esp
+     ced:	bb 00 00 00 00       	mov    $0x0,%ebx
+     cf2:	81 fb e7 03 00 00    	cmp    $0x3e7,%ebx
+     cf8:	7f 4c                	jg     d46 <sharedfd+0xb7>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+     cfa:	83 ec 04             	sub    $0x4,%esp
+     cfd:	6a 0a                	push   $0xa
+     cff:	8d 45 de             	lea    -0x22(%ebp),%eax
+     d02:	50                   	push   %eax
+     d03:	56                   	push   %esi
+     d04:	e8 d3 3d 00 00       	call   4adc <write>
+     d09:	83 c4 10             	add    $0x10,%esp
+     d0c:	83 f8 0a             	cmp    $0xa,%eax
+     d0f:	75 23                	jne    d34 <sharedfd+0xa5>
+  for(i = 0; i < 1000; i++){
+     d11:	83 c3 01             	add    $0x1,%ebx
+     d14:	eb dc                	jmp    cf2 <sharedfd+0x63>
+    printf(1, "fstests: cannot open sharedfd for writing");
+     d16:	83 ec 08             	sub    $0x8,%esp
+     d19:	68 10 65 00 00       	push   $0x6510
+     d1e:	6a 01                	push   $0x1
+     d20:	e8 6e 3f 00 00       	call   4c93 <printf>
+    return;
+     d25:	83 c4 10             	add    $0x10,%esp
+     d28:	e9 e4 00 00 00       	jmp    e11 <sharedfd+0x182>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     d2d:	b8 70 00 00 00       	mov    $0x70,%eax
+     d32:	eb a7                	jmp    cdb <sharedfd+0x4c>
+      printf(1, "fstests: write sharedfd failed\n");
+     d34:	83 ec 08             	sub    $0x8,%esp
+     d37:	68 3c 65 00 00       	push   $0x653c
+     d3c:	6a 01                	push   $0x1
+     d3e:	e8 50 3f 00 00       	call   4c93 <printf>
+      break;
+     d43:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+  if(pid == 0)
+     d46:	85 ff                	test   %edi,%edi
+     d48:	74 4d                	je     d97 <sharedfd+0x108>
+    exit();
+  else
+    wait();
+     d4a:	e8 75 3d 00 00       	call   4ac4 <wait>
+  close(fd);
+     d4f:	83 ec 0c             	sub    $0xc,%esp
+     d52:	56                   	push   %esi
+     d53:	e8 8c 3d 00 00       	call   4ae4 <close>
+  fd = open("sharedfd", 0);
+     d58:	83 c4 08             	add    $0x8,%esp
+     d5b:	6a 00                	push   $0x0
+     d5d:	68 7b 53 00 00       	push   $0x537b
+     d62:	e8 95 3d 00 00       	call   4afc <open>
+     d67:	89 c7                	mov    %eax,%edi
+  if(fd < 0){
+     d69:	83 c4 10             	add    $0x10,%esp
+     d6c:	85 c0                	test   %eax,%eax
+     d6e:	78 2c                	js     d9c <sharedfd+0x10d>
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    return;
+  }
+  nc = np = 0;
+     d70:	be 00 00 00 00       	mov    $0x0,%esi
+     d75:	bb 00 00 00 00       	mov    $0x0,%ebx
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+     d7a:	83 ec 04             	sub    $0x4,%esp
+     d7d:	6a 0a                	push   $0xa
+     d7f:	8d 45 de             	lea    -0x22(%ebp),%eax
+     d82:	50                   	push   %eax
+     d83:	57                   	push   %edi
+     d84:	e8 4b 3d 00 00       	call   4ad4 <read>
+     d89:	83 c4 10             	add    $0x10,%esp
+     d8c:	85 c0                	test   %eax,%eax
+     d8e:	7e 41                	jle    dd1 <sharedfd+0x142>
+    for(i = 0; i < sizeof(buf); i++){
+     d90:	b8 00 00 00 00       	mov    $0x0,%eax
+     d95:	eb 21                	jmp    db8 <sharedfd+0x129>
+    exit();
+     d97:	e8 20 3d 00 00       	call   4abc <exit>
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+     d9c:	83 ec 08             	sub    $0x8,%esp
+     d9f:	68 5c 65 00 00       	push   $0x655c
+     da4:	6a 01                	push   $0x1
+     da6:	e8 e8 3e 00 00       	call   4c93 <printf>
+    return;
+     dab:	83 c4 10             	add    $0x10,%esp
+     dae:	eb 61                	jmp    e11 <sharedfd+0x182>
+      if(buf[i] == 'c')
+        nc++;
+      if(buf[i] == 'p')
+     db0:	80 fa 70             	cmp    $0x70,%dl
+     db3:	74 17                	je     dcc <sharedfd+0x13d>
+    for(i = 0; i < sizeof(buf); i++){
+     db5:	83 c0 01             	add    $0x1,%eax
+     db8:	83 f8 09             	cmp    $0x9,%eax
+     dbb:	77 bd                	ja     d7a <sharedfd+0xeb>
+      if(buf[i] == 'c')
+     dbd:	0f b6 54 05 de       	movzbl -0x22(%ebp,%eax,1),%edx
+     dc2:	80 fa 63             	cmp    $0x63,%dl
+     dc5:	75 e9                	jne    db0 <sharedfd+0x121>
+        nc++;
+     dc7:	83 c3 01             	add    $0x1,%ebx
+     dca:	eb e4                	jmp    db0 <sharedfd+0x121>
+        np++;
+     dcc:	83 c6 01             	add    $0x1,%esi
+     dcf:	eb e4                	jmp    db5 <sharedfd+0x126>
+    }
+  }
+  close(fd);
+     dd1:	83 ec 0c             	sub    $0xc,%esp
+     dd4:	57                   	push   %edi
+     dd5:	e8 0a 3d 00 00       	call   4ae4 <close>
+  unlink("sharedfd");
+     dda:	c7 04 24 7b 53 00 00 	movl   $0x537b,(%esp)
+     de1:	e8 26 3d 00 00       	call   4b0c <unlink>
+  if(nc == 10000 && np == 10000){
+     de6:	83 c4 10             	add    $0x10,%esp
+     de9:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+     def:	0f 94 c2             	sete   %dl
+     df2:	81 fe 10 27 00 00    	cmp    $0x2710,%esi
+     df8:	0f 94 c0             	sete   %al
+     dfb:	84 c2                	test   %al,%dl
+     dfd:	74 1a                	je     e19 <sharedfd+0x18a>
+    printf(1, "sharedfd ok\n");
+     dff:	83 ec 08             	sub    $0x8,%esp
+     e02:	68 84 53 00 00       	push   $0x5384
+     e07:	6a 01                	push   $0x1
+     e09:	e8 85 3e 00 00       	call   4c93 <printf>
+     e0e:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    exit();
+  }
+}
+     e11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e14:	5b                   	pop    %ebx
+     e15:	5e                   	pop    %esi
+     e16:	5f                   	pop    %edi
+     e17:	5d                   	pop    %ebp
+     e18:	c3                   	ret
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+     e19:	56                   	push   %esi
+     e1a:	53                   	push   %ebx
+     e1b:	68 91 53 00 00       	push   $0x5391
+     e20:	6a 01                	push   $0x1
+     e22:	e8 6c 3e 00 00       	call   4c93 <printf>
+    exit();
+     e27:	e8 90 3c 00 00       	call   4abc <exit>
+
+00000e2c <fourfiles>:
+
+// four processes write different files at the same
+// time, to test block allocation.
+void
+fourfiles(void)
+{
+     e2c:	55                   	push   %ebp
+     e2d:	89 e5                	mov    %esp,%ebp
+     e2f:	57                   	push   %edi
+     e30:	56                   	push   %esi
+     e31:	53                   	push   %ebx
+     e32:	83 ec 34             	sub    $0x34,%esp
+  int fd, pid, i, j, n, total, pi;
+  char *names[] = { "f0", "f1", "f2", "f3" };
+     e35:	c7 45 d8 a6 53 00 00 	movl   $0x53a6,-0x28(%ebp)
+     e3c:	c7 45 dc ef 54 00 00 	movl   $0x54ef,-0x24(%ebp)
+     e43:	c7 45 e0 f3 54 00 00 	movl   $0x54f3,-0x20(%ebp)
+     e4a:	c7 45 e4 a9 53 00 00 	movl   $0x53a9,-0x1c(%ebp)
+  char *fname;
+
+  printf(1, "fourfiles test\n");
+     e51:	68 ac 53 00 00       	push   $0x53ac
+     e56:	6a 01                	push   $0x1
+     e58:	e8 36 3e 00 00       	call   4c93 <printf>
+
+  for(pi = 0; pi < 4; pi++){
+     e5d:	83 c4 10             	add    $0x10,%esp
+     e60:	be 00 00 00 00       	mov    $0x0,%esi
+     e65:	eb 45                	jmp    eac <fourfiles+0x80>
+    fname = names[pi];
+    unlink(fname);
+
+    pid = fork();
+    if(pid < 0){
+      printf(1, "fork failed\n");
+     e67:	83 ec 08             	sub    $0x8,%esp
+     e6a:	68 61 63 00 00       	push   $0x6361
+     e6f:	6a 01                	push   $0x1
+     e71:	e8 1d 3e 00 00       	call   4c93 <printf>
+      exit();
+     e76:	e8 41 3c 00 00       	call   4abc <exit>
+    }
+
+    if(pid == 0){
+      fd = open(fname, O_CREATE | O_RDWR);
+      if(fd < 0){
+        printf(1, "create failed\n");
+     e7b:	83 ec 08             	sub    $0x8,%esp
+     e7e:	68 60 60 00 00       	push   $0x6060
+     e83:	6a 01                	push   $0x1
+     e85:	e8 09 3e 00 00       	call   4c93 <printf>
+        exit();
+     e8a:	e8 2d 3c 00 00       	call   4abc <exit>
+      }
+
+      memset(buf, '0'+pi, 512);
+      for(i = 0; i < 12; i++){
+        if((n = write(fd, buf, 500)) != 500){
+          printf(1, "write failed %d\n", n);
+     e8f:	83 ec 04             	sub    $0x4,%esp
+     e92:	50                   	push   %eax
+     e93:	68 bc 53 00 00       	push   $0x53bc
+     e98:	6a 01                	push   $0x1
+     e9a:	e8 f4 3d 00 00       	call   4c93 <printf>
+          exit();
+     e9f:	e8 18 3c 00 00       	call   4abc <exit>
+        }
+      }
+      exit();
+     ea4:	e8 13 3c 00 00       	call   4abc <exit>
+  for(pi = 0; pi < 4; pi++){
+     ea9:	83 c6 01             	add    $0x1,%esi
+     eac:	83 fe 03             	cmp    $0x3,%esi
+     eaf:	7f 78                	jg     f29 <fourfiles+0xfd>
+    fname = names[pi];
+     eb1:	8b 7c b5 d8          	mov    -0x28(%ebp,%esi,4),%edi
+    unlink(fname);
+     eb5:	83 ec 0c             	sub    $0xc,%esp
+     eb8:	57                   	push   %edi
+     eb9:	e8 4e 3c 00 00       	call   4b0c <unlink>
+    pid = fork();
+     ebe:	e8 f1 3b 00 00       	call   4ab4 <fork>
+    if(pid < 0){
+     ec3:	83 c4 10             	add    $0x10,%esp
+     ec6:	85 c0                	test   %eax,%eax
+     ec8:	78 9d                	js     e67 <fourfiles+0x3b>
+    if(pid == 0){
+     eca:	75 dd                	jne    ea9 <fourfiles+0x7d>
+      fd = open(fname, O_CREATE | O_RDWR);
+     ecc:	89 c3                	mov    %eax,%ebx
+     ece:	83 ec 08             	sub    $0x8,%esp
+     ed1:	68 02 02 00 00       	push   $0x202
+     ed6:	57                   	push   %edi
+     ed7:	e8 20 3c 00 00       	call   4afc <open>
+     edc:	89 c7                	mov    %eax,%edi
+      if(fd < 0){
+     ede:	83 c4 10             	add    $0x10,%esp
+     ee1:	85 c0                	test   %eax,%eax
+     ee3:	78 96                	js     e7b <fourfiles+0x4f>
+      memset(buf, '0'+pi, 512);
+     ee5:	83 ec 04             	sub    $0x4,%esp
+     ee8:	68 00 02 00 00       	push   $0x200
+     eed:	83 c6 30             	add    $0x30,%esi
+     ef0:	56                   	push   %esi
+     ef1:	68 a0 cf 00 00       	push   $0xcfa0
+     ef6:	e8 86 3a 00 00       	call   4981 <memset>
+      for(i = 0; i < 12; i++){
+     efb:	83 c4 10             	add    $0x10,%esp
+     efe:	83 fb 0b             	cmp    $0xb,%ebx
+     f01:	7f a1                	jg     ea4 <fourfiles+0x78>
+        if((n = write(fd, buf, 500)) != 500){
+     f03:	83 ec 04             	sub    $0x4,%esp
+     f06:	68 f4 01 00 00       	push   $0x1f4
+     f0b:	68 a0 cf 00 00       	push   $0xcfa0
+     f10:	57                   	push   %edi
+     f11:	e8 c6 3b 00 00       	call   4adc <write>
+     f16:	83 c4 10             	add    $0x10,%esp
+     f19:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+     f1e:	0f 85 6b ff ff ff    	jne    e8f <fourfiles+0x63>
+      for(i = 0; i < 12; i++){
+     f24:	83 c3 01             	add    $0x1,%ebx
+     f27:	eb d5                	jmp    efe <fourfiles+0xd2>
+    }
+  }
+
+  for(pi = 0; pi < 4; pi++){
+     f29:	bb 00 00 00 00       	mov    $0x0,%ebx
+     f2e:	eb 08                	jmp    f38 <fourfiles+0x10c>
+    wait();
+     f30:	e8 8f 3b 00 00       	call   4ac4 <wait>
+  for(pi = 0; pi < 4; pi++){
+     f35:	83 c3 01             	add    $0x1,%ebx
+     f38:	83 fb 03             	cmp    $0x3,%ebx
+     f3b:	7e f3                	jle    f30 <fourfiles+0x104>
+  }
+
+  for(i = 0; i < 2; i++){
+     f3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+     f42:	eb 78                	jmp    fbc <fourfiles+0x190>
+    fd = open(fname, 0);
+    total = 0;
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+      for(j = 0; j < n; j++){
+        if(buf[j] != '0'+i){
+          printf(1, "wrong char\n");
+     f44:	83 ec 08             	sub    $0x8,%esp
+     f47:	68 cd 53 00 00       	push   $0x53cd
+     f4c:	6a 01                	push   $0x1
+     f4e:	e8 40 3d 00 00       	call   4c93 <printf>
+          exit();
+     f53:	e8 64 3b 00 00       	call   4abc <exit>
+        }
+      }
+      total += n;
+     f58:	01 fe                	add    %edi,%esi
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+     f5a:	83 ec 04             	sub    $0x4,%esp
+     f5d:	68 00 20 00 00       	push   $0x2000
+     f62:	68 a0 cf 00 00       	push   $0xcfa0
+     f67:	ff 75 d4             	push   -0x2c(%ebp)
+     f6a:	e8 65 3b 00 00       	call   4ad4 <read>
+     f6f:	89 c7                	mov    %eax,%edi
+     f71:	83 c4 10             	add    $0x10,%esp
+     f74:	85 c0                	test   %eax,%eax
+     f76:	7e 1c                	jle    f94 <fourfiles+0x168>
+      for(j = 0; j < n; j++){
+     f78:	b8 00 00 00 00       	mov    $0x0,%eax
+     f7d:	39 f8                	cmp    %edi,%eax
+     f7f:	7d d7                	jge    f58 <fourfiles+0x12c>
+        if(buf[j] != '0'+i){
+     f81:	0f be 88 a0 cf 00 00 	movsbl 0xcfa0(%eax),%ecx
+     f88:	8d 53 30             	lea    0x30(%ebx),%edx
+     f8b:	39 d1                	cmp    %edx,%ecx
+     f8d:	75 b5                	jne    f44 <fourfiles+0x118>
+      for(j = 0; j < n; j++){
+     f8f:	83 c0 01             	add    $0x1,%eax
+     f92:	eb e9                	jmp    f7d <fourfiles+0x151>
+    }
+    close(fd);
+     f94:	8b 7d d0             	mov    -0x30(%ebp),%edi
+     f97:	83 ec 0c             	sub    $0xc,%esp
+     f9a:	ff 75 d4             	push   -0x2c(%ebp)
+     f9d:	e8 42 3b 00 00       	call   4ae4 <close>
+    if(total != 12*500){
+     fa2:	83 c4 10             	add    $0x10,%esp
+     fa5:	81 fe 70 17 00 00    	cmp    $0x1770,%esi
+     fab:	75 36                	jne    fe3 <fourfiles+0x1b7>
+      printf(1, "wrong length %d\n", total);
+      exit();
+    }
+    unlink(fname);
+     fad:	83 ec 0c             	sub    $0xc,%esp
+     fb0:	57                   	push   %edi
+     fb1:	e8 56 3b 00 00       	call   4b0c <unlink>
+  for(i = 0; i < 2; i++){
+     fb6:	83 c3 01             	add    $0x1,%ebx
+     fb9:	83 c4 10             	add    $0x10,%esp
+     fbc:	83 fb 01             	cmp    $0x1,%ebx
+     fbf:	7f 37                	jg     ff8 <fourfiles+0x1cc>
+    fname = names[i];
+     fc1:	8b 7c 9d d8          	mov    -0x28(%ebp,%ebx,4),%edi
+    fd = open(fname, 0);
+     fc5:	83 ec 08             	sub    $0x8,%esp
+     fc8:	6a 00                	push   $0x0
+     fca:	57                   	push   %edi
+     fcb:	e8 2c 3b 00 00       	call   4afc <open>
+     fd0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+     fd3:	83 c4 10             	add    $0x10,%esp
+    total = 0;
+     fd6:	be 00 00 00 00       	mov    $0x0,%esi
+     fdb:	89 7d d0             	mov    %edi,-0x30(%ebp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+     fde:	e9 77 ff ff ff       	jmp    f5a <fourfiles+0x12e>
+      printf(1, "wrong length %d\n", total);
+     fe3:	83 ec 04             	sub    $0x4,%esp
+     fe6:	56                   	push   %esi
+     fe7:	68 d9 53 00 00       	push   $0x53d9
+     fec:	6a 01                	push   $0x1
+     fee:	e8 a0 3c 00 00       	call   4c93 <printf>
+      exit();
+     ff3:	e8 c4 3a 00 00       	call   4abc <exit>
+  }
+
+  printf(1, "fourfiles ok\n");
+     ff8:	83 ec 08             	sub    $0x8,%esp
+     ffb:	68 ea 53 00 00       	push   $0x53ea
+    1000:	6a 01                	push   $0x1
+    1002:	e8 8c 3c 00 00       	call   4c93 <printf>
+}
+    1007:	83 c4 10             	add    $0x10,%esp
+    100a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    100d:	5b                   	pop    %ebx
+    100e:	5e                   	pop    %esi
+    100f:	5f                   	pop    %edi
+    1010:	5d                   	pop    %ebp
+    1011:	c3                   	ret
+
+00001012 <createdelete>:
+
+// four processes create and delete different files in same directory
+void
+createdelete(void)
+{
+    1012:	55                   	push   %ebp
+    1013:	89 e5                	mov    %esp,%ebp
+    1015:	56                   	push   %esi
+    1016:	53                   	push   %ebx
+    1017:	83 ec 28             	sub    $0x28,%esp
+  enum { N = 20 };
+  int pid, i, fd, pi;
+  char name[32];
+
+  printf(1, "createdelete test\n");
+    101a:	68 f8 53 00 00       	push   $0x53f8
+    101f:	6a 01                	push   $0x1
+    1021:	e8 6d 3c 00 00       	call   4c93 <printf>
+
+  for(pi = 0; pi < 4; pi++){
+    1026:	83 c4 10             	add    $0x10,%esp
+    1029:	be 00 00 00 00       	mov    $0x0,%esi
+    102e:	83 fe 03             	cmp    $0x3,%esi
+    1031:	0f 8f bc 00 00 00    	jg     10f3 <createdelete+0xe1>
+    pid = fork();
+    1037:	e8 78 3a 00 00       	call   4ab4 <fork>
+    103c:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    103e:	85 c0                	test   %eax,%eax
+    1040:	78 07                	js     1049 <createdelete+0x37>
+      printf(1, "fork failed\n");
+      exit();
+    }
+
+    if(pid == 0){
+    1042:	74 19                	je     105d <createdelete+0x4b>
+  for(pi = 0; pi < 4; pi++){
+    1044:	83 c6 01             	add    $0x1,%esi
+    1047:	eb e5                	jmp    102e <createdelete+0x1c>
+      printf(1, "fork failed\n");
+    1049:	83 ec 08             	sub    $0x8,%esp
+    104c:	68 61 63 00 00       	push   $0x6361
+    1051:	6a 01                	push   $0x1
+    1053:	e8 3b 3c 00 00       	call   4c93 <printf>
+      exit();
+    1058:	e8 5f 3a 00 00       	call   4abc <exit>
+      name[0] = 'p' + pi;
+    105d:	8d 46 70             	lea    0x70(%esi),%eax
+    1060:	88 45 d8             	mov    %al,-0x28(%ebp)
+      name[2] = '\0';
+    1063:	c6 45 da 00          	movb   $0x0,-0x26(%ebp)
+      for(i = 0; i < N; i++){
+    1067:	eb 17                	jmp    1080 <createdelete+0x6e>
+        name[1] = '0' + i;
+        fd = open(name, O_CREATE | O_RDWR);
+        if(fd < 0){
+          printf(1, "create failed\n");
+    1069:	83 ec 08             	sub    $0x8,%esp
+    106c:	68 60 60 00 00       	push   $0x6060
+    1071:	6a 01                	push   $0x1
+    1073:	e8 1b 3c 00 00       	call   4c93 <printf>
+          exit();
+    1078:	e8 3f 3a 00 00       	call   4abc <exit>
+      for(i = 0; i < N; i++){
+    107d:	83 c3 01             	add    $0x1,%ebx
+    1080:	83 fb 13             	cmp    $0x13,%ebx
+    1083:	7f 69                	jg     10ee <createdelete+0xdc>
+        name[1] = '0' + i;
+    1085:	8d 43 30             	lea    0x30(%ebx),%eax
+    1088:	88 45 d9             	mov    %al,-0x27(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    108b:	83 ec 08             	sub    $0x8,%esp
+    108e:	68 02 02 00 00       	push   $0x202
+    1093:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    1096:	50                   	push   %eax
+    1097:	e8 60 3a 00 00       	call   4afc <open>
+        if(fd < 0){
+    109c:	83 c4 10             	add    $0x10,%esp
+    109f:	85 c0                	test   %eax,%eax
+    10a1:	78 c6                	js     1069 <createdelete+0x57>
+        }
+        close(fd);
+    10a3:	83 ec 0c             	sub    $0xc,%esp
+    10a6:	50                   	push   %eax
+    10a7:	e8 38 3a 00 00       	call   4ae4 <close>
+        if(i > 0 && (i % 2 ) == 0){
+    10ac:	83 c4 10             	add    $0x10,%esp
+    10af:	85 db                	test   %ebx,%ebx
+    10b1:	7e ca                	jle    107d <createdelete+0x6b>
+    10b3:	f6 c3 01             	test   $0x1,%bl
+    10b6:	75 c5                	jne    107d <createdelete+0x6b>
+          name[1] = '0' + (i / 2);
+    10b8:	89 d8                	mov    %ebx,%eax
+    10ba:	c1 e8 1f             	shr    $0x1f,%eax
+    10bd:	01 d8                	add    %ebx,%eax
+    10bf:	d1 f8                	sar    %eax
+    10c1:	83 c0 30             	add    $0x30,%eax
+    10c4:	88 45 d9             	mov    %al,-0x27(%ebp)
+          if(unlink(name) < 0){
+    10c7:	83 ec 0c             	sub    $0xc,%esp
+    10ca:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    10cd:	50                   	push   %eax
+    10ce:	e8 39 3a 00 00       	call   4b0c <unlink>
+    10d3:	83 c4 10             	add    $0x10,%esp
+    10d6:	85 c0                	test   %eax,%eax
+    10d8:	79 a3                	jns    107d <createdelete+0x6b>
+            printf(1, "unlink failed\n");
+    10da:	83 ec 08             	sub    $0x8,%esp
+    10dd:	68 f9 4f 00 00       	push   $0x4ff9
+    10e2:	6a 01                	push   $0x1
+    10e4:	e8 aa 3b 00 00       	call   4c93 <printf>
+            exit();
+    10e9:	e8 ce 39 00 00       	call   4abc <exit>
+          }
+        }
+      }
+      exit();
+    10ee:	e8 c9 39 00 00       	call   4abc <exit>
+    }
+  }
+
+  for(pi = 0; pi < 4; pi++){
+    10f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+    10f8:	eb 08                	jmp    1102 <createdelete+0xf0>
+    wait();
+    10fa:	e8 c5 39 00 00       	call   4ac4 <wait>
+  for(pi = 0; pi < 4; pi++){
+    10ff:	83 c3 01             	add    $0x1,%ebx
+    1102:	83 fb 03             	cmp    $0x3,%ebx
+    1105:	7e f3                	jle    10fa <createdelete+0xe8>
+  }
+
+  name[0] = name[1] = name[2] = 0;
+    1107:	c6 45 da 00          	movb   $0x0,-0x26(%ebp)
+    110b:	c6 45 d9 00          	movb   $0x0,-0x27(%ebp)
+    110f:	c6 45 d8 00          	movb   $0x0,-0x28(%ebp)
+  for(i = 0; i < N; i++){
+    1113:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1118:	e9 89 00 00 00       	jmp    11a6 <createdelete+0x194>
+      name[1] = '0' + i;
+      fd = open(name, 0);
+      if((i == 0 || i >= N/2) && fd < 0){
+        printf(1, "oops createdelete %s didn't exist\n", name);
+        exit();
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    111d:	8d 53 ff             	lea    -0x1(%ebx),%edx
+    1120:	83 fa 08             	cmp    $0x8,%edx
+    1123:	76 54                	jbe    1179 <createdelete+0x167>
+        printf(1, "oops createdelete %s did exist\n", name);
+        exit();
+      }
+      if(fd >= 0)
+    1125:	85 c0                	test   %eax,%eax
+    1127:	79 6c                	jns    1195 <createdelete+0x183>
+    for(pi = 0; pi < 4; pi++){
+    1129:	83 c6 01             	add    $0x1,%esi
+    112c:	83 fe 03             	cmp    $0x3,%esi
+    112f:	7f 72                	jg     11a3 <createdelete+0x191>
+      name[0] = 'p' + pi;
+    1131:	8d 46 70             	lea    0x70(%esi),%eax
+    1134:	88 45 d8             	mov    %al,-0x28(%ebp)
+      name[1] = '0' + i;
+    1137:	8d 43 30             	lea    0x30(%ebx),%eax
+    113a:	88 45 d9             	mov    %al,-0x27(%ebp)
+      fd = open(name, 0);
+    113d:	83 ec 08             	sub    $0x8,%esp
+    1140:	6a 00                	push   $0x0
+    1142:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    1145:	50                   	push   %eax
+    1146:	e8 b1 39 00 00       	call   4afc <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    114b:	83 c4 10             	add    $0x10,%esp
+    114e:	85 db                	test   %ebx,%ebx
+    1150:	0f 94 c2             	sete   %dl
+    1153:	83 fb 09             	cmp    $0x9,%ebx
+    1156:	0f 9f c1             	setg   %cl
+    1159:	08 ca                	or     %cl,%dl
+    115b:	74 c0                	je     111d <createdelete+0x10b>
+    115d:	85 c0                	test   %eax,%eax
+    115f:	79 bc                	jns    111d <createdelete+0x10b>
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    1161:	83 ec 04             	sub    $0x4,%esp
+    1164:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    1167:	50                   	push   %eax
+    1168:	68 88 65 00 00       	push   $0x6588
+    116d:	6a 01                	push   $0x1
+    116f:	e8 1f 3b 00 00       	call   4c93 <printf>
+        exit();
+    1174:	e8 43 39 00 00       	call   4abc <exit>
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    1179:	85 c0                	test   %eax,%eax
+    117b:	78 ac                	js     1129 <createdelete+0x117>
+        printf(1, "oops createdelete %s did exist\n", name);
+    117d:	83 ec 04             	sub    $0x4,%esp
+    1180:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    1183:	50                   	push   %eax
+    1184:	68 ac 65 00 00       	push   $0x65ac
+    1189:	6a 01                	push   $0x1
+    118b:	e8 03 3b 00 00       	call   4c93 <printf>
+        exit();
+    1190:	e8 27 39 00 00       	call   4abc <exit>
+        close(fd);
+    1195:	83 ec 0c             	sub    $0xc,%esp
+    1198:	50                   	push   %eax
+    1199:	e8 46 39 00 00       	call   4ae4 <close>
+    119e:	83 c4 10             	add    $0x10,%esp
+    11a1:	eb 86                	jmp    1129 <createdelete+0x117>
+  for(i = 0; i < N; i++){
+    11a3:	83 c3 01             	add    $0x1,%ebx
+    11a6:	83 fb 13             	cmp    $0x13,%ebx
+    11a9:	7f 0a                	jg     11b5 <createdelete+0x1a3>
+    for(pi = 0; pi < 4; pi++){
+    11ab:	be 00 00 00 00       	mov    $0x0,%esi
+    11b0:	e9 77 ff ff ff       	jmp    112c <createdelete+0x11a>
+    }
+  }
+
+  for(i = 0; i < N; i++){
+    11b5:	be 00 00 00 00       	mov    $0x0,%esi
+    11ba:	eb 26                	jmp    11e2 <createdelete+0x1d0>
+    for(pi = 0; pi < 4; pi++){
+      name[0] = 'p' + i;
+    11bc:	8d 46 70             	lea    0x70(%esi),%eax
+    11bf:	88 45 d8             	mov    %al,-0x28(%ebp)
+      name[1] = '0' + i;
+    11c2:	8d 46 30             	lea    0x30(%esi),%eax
+    11c5:	88 45 d9             	mov    %al,-0x27(%ebp)
+      unlink(name);
+    11c8:	83 ec 0c             	sub    $0xc,%esp
+    11cb:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    11ce:	50                   	push   %eax
+    11cf:	e8 38 39 00 00       	call   4b0c <unlink>
+    for(pi = 0; pi < 4; pi++){
+    11d4:	83 c3 01             	add    $0x1,%ebx
+    11d7:	83 c4 10             	add    $0x10,%esp
+    11da:	83 fb 03             	cmp    $0x3,%ebx
+    11dd:	7e dd                	jle    11bc <createdelete+0x1aa>
+  for(i = 0; i < N; i++){
+    11df:	83 c6 01             	add    $0x1,%esi
+    11e2:	83 fe 13             	cmp    $0x13,%esi
+    11e5:	7f 07                	jg     11ee <createdelete+0x1dc>
+    for(pi = 0; pi < 4; pi++){
+    11e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    11ec:	eb ec                	jmp    11da <createdelete+0x1c8>
+    }
+  }
+
+  printf(1, "createdelete ok\n");
+    11ee:	83 ec 08             	sub    $0x8,%esp
+    11f1:	68 0b 54 00 00       	push   $0x540b
+    11f6:	6a 01                	push   $0x1
+    11f8:	e8 96 3a 00 00       	call   4c93 <printf>
+}
+    11fd:	83 c4 10             	add    $0x10,%esp
+    1200:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1203:	5b                   	pop    %ebx
+    1204:	5e                   	pop    %esi
+    1205:	5d                   	pop    %ebp
+    1206:	c3                   	ret
+
+00001207 <unlinkread>:
+
+// can I unlink a file and still read it?
+void
+unlinkread(void)
+{
+    1207:	55                   	push   %ebp
+    1208:	89 e5                	mov    %esp,%ebp
+    120a:	56                   	push   %esi
+    120b:	53                   	push   %ebx
+  int fd, fd1;
+
+  printf(1, "unlinkread test\n");
+    120c:	83 ec 08             	sub    $0x8,%esp
+    120f:	68 1c 54 00 00       	push   $0x541c
+    1214:	6a 01                	push   $0x1
+    1216:	e8 78 3a 00 00       	call   4c93 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    121b:	83 c4 08             	add    $0x8,%esp
+    121e:	68 02 02 00 00       	push   $0x202
+    1223:	68 2d 54 00 00       	push   $0x542d
+    1228:	e8 cf 38 00 00       	call   4afc <open>
+  if(fd < 0){
+    122d:	83 c4 10             	add    $0x10,%esp
+    1230:	85 c0                	test   %eax,%eax
+    1232:	0f 88 f0 00 00 00    	js     1328 <unlinkread+0x121>
+    1238:	89 c3                	mov    %eax,%ebx
+    printf(1, "create unlinkread failed\n");
+    exit();
+  }
+  write(fd, "hello", 5);
+    123a:	83 ec 04             	sub    $0x4,%esp
+    123d:	6a 05                	push   $0x5
+    123f:	68 52 54 00 00       	push   $0x5452
+    1244:	50                   	push   %eax
+    1245:	e8 92 38 00 00       	call   4adc <write>
+  close(fd);
+    124a:	89 1c 24             	mov    %ebx,(%esp)
+    124d:	e8 92 38 00 00       	call   4ae4 <close>
+
+  fd = open("unlinkread", O_RDWR);
+    1252:	83 c4 08             	add    $0x8,%esp
+    1255:	6a 02                	push   $0x2
+    1257:	68 2d 54 00 00       	push   $0x542d
+    125c:	e8 9b 38 00 00       	call   4afc <open>
+    1261:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1263:	83 c4 10             	add    $0x10,%esp
+    1266:	85 c0                	test   %eax,%eax
+    1268:	0f 88 ce 00 00 00    	js     133c <unlinkread+0x135>
+    printf(1, "open unlinkread failed\n");
+    exit();
+  }
+  if(unlink("unlinkread") != 0){
+    126e:	83 ec 0c             	sub    $0xc,%esp
+    1271:	68 2d 54 00 00       	push   $0x542d
+    1276:	e8 91 38 00 00       	call   4b0c <unlink>
+    127b:	83 c4 10             	add    $0x10,%esp
+    127e:	85 c0                	test   %eax,%eax
+    1280:	0f 85 ca 00 00 00    	jne    1350 <unlinkread+0x149>
+    printf(1, "unlink unlinkread failed\n");
+    exit();
+  }
+
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    1286:	83 ec 08             	sub    $0x8,%esp
+    1289:	68 02 02 00 00       	push   $0x202
+    128e:	68 2d 54 00 00       	push   $0x542d
+    1293:	e8 64 38 00 00       	call   4afc <open>
+    1298:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    129a:	83 c4 0c             	add    $0xc,%esp
+    129d:	6a 03                	push   $0x3
+    129f:	68 8a 54 00 00       	push   $0x548a
+    12a4:	50                   	push   %eax
+    12a5:	e8 32 38 00 00       	call   4adc <write>
+  close(fd1);
+    12aa:	89 34 24             	mov    %esi,(%esp)
+    12ad:	e8 32 38 00 00       	call   4ae4 <close>
+
+  if(read(fd, buf, sizeof(buf)) != 5){
+    12b2:	83 c4 0c             	add    $0xc,%esp
+    12b5:	68 00 20 00 00       	push   $0x2000
+    12ba:	68 a0 cf 00 00       	push   $0xcfa0
+    12bf:	53                   	push   %ebx
+    12c0:	e8 0f 38 00 00       	call   4ad4 <read>
+    12c5:	83 c4 10             	add    $0x10,%esp
+    12c8:	83 f8 05             	cmp    $0x5,%eax
+    12cb:	0f 85 93 00 00 00    	jne    1364 <unlinkread+0x15d>
+    printf(1, "unlinkread read failed");
+    exit();
+  }
+  if(buf[0] != 'h'){
+    12d1:	80 3d a0 cf 00 00 68 	cmpb   $0x68,0xcfa0
+    12d8:	0f 85 9a 00 00 00    	jne    1378 <unlinkread+0x171>
+    printf(1, "unlinkread wrong data\n");
+    exit();
+  }
+  if(write(fd, buf, 10) != 10){
+    12de:	83 ec 04             	sub    $0x4,%esp
+    12e1:	6a 0a                	push   $0xa
+    12e3:	68 a0 cf 00 00       	push   $0xcfa0
+    12e8:	53                   	push   %ebx
+    12e9:	e8 ee 37 00 00       	call   4adc <write>
+    12ee:	83 c4 10             	add    $0x10,%esp
+    12f1:	83 f8 0a             	cmp    $0xa,%eax
+    12f4:	0f 85 92 00 00 00    	jne    138c <unlinkread+0x185>
+    printf(1, "unlinkread write failed\n");
+    exit();
+  }
+  close(fd);
+    12fa:	83 ec 0c             	sub    $0xc,%esp
+    12fd:	53                   	push   %ebx
+    12fe:	e8 e1 37 00 00       	call   4ae4 <close>
+  unlink("unlinkread");
+    1303:	c7 04 24 2d 54 00 00 	movl   $0x542d,(%esp)
+    130a:	e8 fd 37 00 00       	call   4b0c <unlink>
+  printf(1, "unlinkread ok\n");
+    130f:	83 c4 08             	add    $0x8,%esp
+    1312:	68 d5 54 00 00       	push   $0x54d5
+    1317:	6a 01                	push   $0x1
+    1319:	e8 75 39 00 00       	call   4c93 <printf>
+}
+    131e:	83 c4 10             	add    $0x10,%esp
+    1321:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1324:	5b                   	pop    %ebx
+    1325:	5e                   	pop    %esi
+    1326:	5d                   	pop    %ebp
+    1327:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    1328:	83 ec 08             	sub    $0x8,%esp
+    132b:	68 38 54 00 00       	push   $0x5438
+    1330:	6a 01                	push   $0x1
+    1332:	e8 5c 39 00 00       	call   4c93 <printf>
+    exit();
+    1337:	e8 80 37 00 00       	call   4abc <exit>
+    printf(1, "open unlinkread failed\n");
+    133c:	83 ec 08             	sub    $0x8,%esp
+    133f:	68 58 54 00 00       	push   $0x5458
+    1344:	6a 01                	push   $0x1
+    1346:	e8 48 39 00 00       	call   4c93 <printf>
+    exit();
+    134b:	e8 6c 37 00 00       	call   4abc <exit>
+    printf(1, "unlink unlinkread failed\n");
+    1350:	83 ec 08             	sub    $0x8,%esp
+    1353:	68 70 54 00 00       	push   $0x5470
+    1358:	6a 01                	push   $0x1
+    135a:	e8 34 39 00 00       	call   4c93 <printf>
+    exit();
+    135f:	e8 58 37 00 00       	call   4abc <exit>
+    printf(1, "unlinkread read failed");
+    1364:	83 ec 08             	sub    $0x8,%esp
+    1367:	68 8e 54 00 00       	push   $0x548e
+    136c:	6a 01                	push   $0x1
+    136e:	e8 20 39 00 00       	call   4c93 <printf>
+    exit();
+    1373:	e8 44 37 00 00       	call   4abc <exit>
+    printf(1, "unlinkread wrong data\n");
+    1378:	83 ec 08             	sub    $0x8,%esp
+    137b:	68 a5 54 00 00       	push   $0x54a5
+    1380:	6a 01                	push   $0x1
+    1382:	e8 0c 39 00 00       	call   4c93 <printf>
+    exit();
+    1387:	e8 30 37 00 00       	call   4abc <exit>
+    printf(1, "unlinkread write failed\n");
+    138c:	83 ec 08             	sub    $0x8,%esp
+    138f:	68 bc 54 00 00       	push   $0x54bc
+    1394:	6a 01                	push   $0x1
+    1396:	e8 f8 38 00 00       	call   4c93 <printf>
+    exit();
+    139b:	e8 1c 37 00 00       	call   4abc <exit>
+
+000013a0 <linktest>:
+
+void
+linktest(void)
+{
+    13a0:	55                   	push   %ebp
+    13a1:	89 e5                	mov    %esp,%ebp
+    13a3:	53                   	push   %ebx
+    13a4:	83 ec 0c             	sub    $0xc,%esp
+  int fd;
+
+  printf(1, "linktest\n");
+    13a7:	68 e4 54 00 00       	push   $0x54e4
+    13ac:	6a 01                	push   $0x1
+    13ae:	e8 e0 38 00 00       	call   4c93 <printf>
+
+  unlink("lf1");
+    13b3:	c7 04 24 ee 54 00 00 	movl   $0x54ee,(%esp)
+    13ba:	e8 4d 37 00 00       	call   4b0c <unlink>
+  unlink("lf2");
+    13bf:	c7 04 24 f2 54 00 00 	movl   $0x54f2,(%esp)
+    13c6:	e8 41 37 00 00       	call   4b0c <unlink>
+
+  fd = open("lf1", O_CREATE|O_RDWR);
+    13cb:	83 c4 08             	add    $0x8,%esp
+    13ce:	68 02 02 00 00       	push   $0x202
+    13d3:	68 ee 54 00 00       	push   $0x54ee
+    13d8:	e8 1f 37 00 00       	call   4afc <open>
+  if(fd < 0){
+    13dd:	83 c4 10             	add    $0x10,%esp
+    13e0:	85 c0                	test   %eax,%eax
+    13e2:	0f 88 2a 01 00 00    	js     1512 <linktest+0x172>
+    13e8:	89 c3                	mov    %eax,%ebx
+    printf(1, "create lf1 failed\n");
+    exit();
+  }
+  if(write(fd, "hello", 5) != 5){
+    13ea:	83 ec 04             	sub    $0x4,%esp
+    13ed:	6a 05                	push   $0x5
+    13ef:	68 52 54 00 00       	push   $0x5452
+    13f4:	50                   	push   %eax
+    13f5:	e8 e2 36 00 00       	call   4adc <write>
+    13fa:	83 c4 10             	add    $0x10,%esp
+    13fd:	83 f8 05             	cmp    $0x5,%eax
+    1400:	0f 85 20 01 00 00    	jne    1526 <linktest+0x186>
+    printf(1, "write lf1 failed\n");
+    exit();
+  }
+  close(fd);
+    1406:	83 ec 0c             	sub    $0xc,%esp
+    1409:	53                   	push   %ebx
+    140a:	e8 d5 36 00 00       	call   4ae4 <close>
+
+  if(link("lf1", "lf2") < 0){
+    140f:	83 c4 08             	add    $0x8,%esp
+    1412:	68 f2 54 00 00       	push   $0x54f2
+    1417:	68 ee 54 00 00       	push   $0x54ee
+    141c:	e8 fb 36 00 00       	call   4b1c <link>
+    1421:	83 c4 10             	add    $0x10,%esp
+    1424:	85 c0                	test   %eax,%eax
+    1426:	0f 88 0e 01 00 00    	js     153a <linktest+0x19a>
+    printf(1, "link lf1 lf2 failed\n");
+    exit();
+  }
+  unlink("lf1");
+    142c:	83 ec 0c             	sub    $0xc,%esp
+    142f:	68 ee 54 00 00       	push   $0x54ee
+    1434:	e8 d3 36 00 00       	call   4b0c <unlink>
+
+  if(open("lf1", 0) >= 0){
+    1439:	83 c4 08             	add    $0x8,%esp
+    143c:	6a 00                	push   $0x0
+    143e:	68 ee 54 00 00       	push   $0x54ee
+    1443:	e8 b4 36 00 00       	call   4afc <open>
+    1448:	83 c4 10             	add    $0x10,%esp
+    144b:	85 c0                	test   %eax,%eax
+    144d:	0f 89 fb 00 00 00    	jns    154e <linktest+0x1ae>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    exit();
+  }
+
+  fd = open("lf2", 0);
+    1453:	83 ec 08             	sub    $0x8,%esp
+    1456:	6a 00                	push   $0x0
+    1458:	68 f2 54 00 00       	push   $0x54f2
+    145d:	e8 9a 36 00 00       	call   4afc <open>
+    1462:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1464:	83 c4 10             	add    $0x10,%esp
+    1467:	85 c0                	test   %eax,%eax
+    1469:	0f 88 f3 00 00 00    	js     1562 <linktest+0x1c2>
+    printf(1, "open lf2 failed\n");
+    exit();
+  }
+  if(read(fd, buf, sizeof(buf)) != 5){
+    146f:	83 ec 04             	sub    $0x4,%esp
+    1472:	68 00 20 00 00       	push   $0x2000
+    1477:	68 a0 cf 00 00       	push   $0xcfa0
+    147c:	50                   	push   %eax
+    147d:	e8 52 36 00 00       	call   4ad4 <read>
+    1482:	83 c4 10             	add    $0x10,%esp
+    1485:	83 f8 05             	cmp    $0x5,%eax
+    1488:	0f 85 e8 00 00 00    	jne    1576 <linktest+0x1d6>
+    printf(1, "read lf2 failed\n");
+    exit();
+  }
+  close(fd);
+    148e:	83 ec 0c             	sub    $0xc,%esp
+    1491:	53                   	push   %ebx
+    1492:	e8 4d 36 00 00       	call   4ae4 <close>
+
+  if(link("lf2", "lf2") >= 0){
+    1497:	83 c4 08             	add    $0x8,%esp
+    149a:	68 f2 54 00 00       	push   $0x54f2
+    149f:	68 f2 54 00 00       	push   $0x54f2
+    14a4:	e8 73 36 00 00       	call   4b1c <link>
+    14a9:	83 c4 10             	add    $0x10,%esp
+    14ac:	85 c0                	test   %eax,%eax
+    14ae:	0f 89 d6 00 00 00    	jns    158a <linktest+0x1ea>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    exit();
+  }
+
+  unlink("lf2");
+    14b4:	83 ec 0c             	sub    $0xc,%esp
+    14b7:	68 f2 54 00 00       	push   $0x54f2
+    14bc:	e8 4b 36 00 00       	call   4b0c <unlink>
+  if(link("lf2", "lf1") >= 0){
+    14c1:	83 c4 08             	add    $0x8,%esp
+    14c4:	68 ee 54 00 00       	push   $0x54ee
+    14c9:	68 f2 54 00 00       	push   $0x54f2
+    14ce:	e8 49 36 00 00       	call   4b1c <link>
+    14d3:	83 c4 10             	add    $0x10,%esp
+    14d6:	85 c0                	test   %eax,%eax
+    14d8:	0f 89 c0 00 00 00    	jns    159e <linktest+0x1fe>
+    printf(1, "link non-existant succeeded! oops\n");
+    exit();
+  }
+
+  if(link(".", "lf1") >= 0){
+    14de:	83 ec 08             	sub    $0x8,%esp
+    14e1:	68 ee 54 00 00       	push   $0x54ee
+    14e6:	68 b6 57 00 00       	push   $0x57b6
+    14eb:	e8 2c 36 00 00       	call   4b1c <link>
+    14f0:	83 c4 10             	add    $0x10,%esp
+    14f3:	85 c0                	test   %eax,%eax
+    14f5:	0f 89 b7 00 00 00    	jns    15b2 <linktest+0x212>
+    printf(1, "link . lf1 succeeded! oops\n");
+    exit();
+  }
+
+  printf(1, "linktest ok\n");
+    14fb:	83 ec 08             	sub    $0x8,%esp
+    14fe:	68 8c 55 00 00       	push   $0x558c
+    1503:	6a 01                	push   $0x1
+    1505:	e8 89 37 00 00       	call   4c93 <printf>
+}
+    150a:	83 c4 10             	add    $0x10,%esp
+    150d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1510:	c9                   	leave
+    1511:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    1512:	83 ec 08             	sub    $0x8,%esp
+    1515:	68 f6 54 00 00       	push   $0x54f6
+    151a:	6a 01                	push   $0x1
+    151c:	e8 72 37 00 00       	call   4c93 <printf>
+    exit();
+    1521:	e8 96 35 00 00       	call   4abc <exit>
+    printf(1, "write lf1 failed\n");
+    1526:	83 ec 08             	sub    $0x8,%esp
+    1529:	68 09 55 00 00       	push   $0x5509
+    152e:	6a 01                	push   $0x1
+    1530:	e8 5e 37 00 00       	call   4c93 <printf>
+    exit();
+    1535:	e8 82 35 00 00       	call   4abc <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    153a:	83 ec 08             	sub    $0x8,%esp
+    153d:	68 1b 55 00 00       	push   $0x551b
+    1542:	6a 01                	push   $0x1
+    1544:	e8 4a 37 00 00       	call   4c93 <printf>
+    exit();
+    1549:	e8 6e 35 00 00       	call   4abc <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    154e:	83 ec 08             	sub    $0x8,%esp
+    1551:	68 cc 65 00 00       	push   $0x65cc
+    1556:	6a 01                	push   $0x1
+    1558:	e8 36 37 00 00       	call   4c93 <printf>
+    exit();
+    155d:	e8 5a 35 00 00       	call   4abc <exit>
+    printf(1, "open lf2 failed\n");
+    1562:	83 ec 08             	sub    $0x8,%esp
+    1565:	68 30 55 00 00       	push   $0x5530
+    156a:	6a 01                	push   $0x1
+    156c:	e8 22 37 00 00       	call   4c93 <printf>
+    exit();
+    1571:	e8 46 35 00 00       	call   4abc <exit>
+    printf(1, "read lf2 failed\n");
+    1576:	83 ec 08             	sub    $0x8,%esp
+    1579:	68 41 55 00 00       	push   $0x5541
+    157e:	6a 01                	push   $0x1
+    1580:	e8 0e 37 00 00       	call   4c93 <printf>
+    exit();
+    1585:	e8 32 35 00 00       	call   4abc <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    158a:	83 ec 08             	sub    $0x8,%esp
+    158d:	68 52 55 00 00       	push   $0x5552
+    1592:	6a 01                	push   $0x1
+    1594:	e8 fa 36 00 00       	call   4c93 <printf>
+    exit();
+    1599:	e8 1e 35 00 00       	call   4abc <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    159e:	83 ec 08             	sub    $0x8,%esp
+    15a1:	68 f4 65 00 00       	push   $0x65f4
+    15a6:	6a 01                	push   $0x1
+    15a8:	e8 e6 36 00 00       	call   4c93 <printf>
+    exit();
+    15ad:	e8 0a 35 00 00       	call   4abc <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    15b2:	83 ec 08             	sub    $0x8,%esp
+    15b5:	68 70 55 00 00       	push   $0x5570
+    15ba:	6a 01                	push   $0x1
+    15bc:	e8 d2 36 00 00       	call   4c93 <printf>
+    exit();
+    15c1:	e8 f6 34 00 00       	call   4abc <exit>
+
+000015c6 <concreate>:
+
+// test concurrent create/link/unlink of the same file
+void
+concreate(void)
+{
+    15c6:	55                   	push   %ebp
+    15c7:	89 e5                	mov    %esp,%ebp
+    15c9:	57                   	push   %edi
+    15ca:	56                   	push   %esi
+    15cb:	53                   	push   %ebx
+    15cc:	83 ec 54             	sub    $0x54,%esp
+  struct {
+    ushort inum;
+    char name[14];
+  } de;
+
+  printf(1, "concreate test\n");
+    15cf:	68 99 55 00 00       	push   $0x5599
+    15d4:	6a 01                	push   $0x1
+    15d6:	e8 b8 36 00 00       	call   4c93 <printf>
+  file[0] = 'C';
+    15db:	c6 45 e5 43          	movb   $0x43,-0x1b(%ebp)
+  file[2] = '\0';
+    15df:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+  for(i = 0; i < 40; i++){
+    15e3:	83 c4 10             	add    $0x10,%esp
+    15e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+    15eb:	eb 5a                	jmp    1647 <concreate+0x81>
+    file[1] = '0' + i;
+    unlink(file);
+    pid = fork();
+    if(pid && (i % 3) == 1){
+      link("C0", file);
+    } else if(pid == 0 && (i % 5) == 1){
+    15ed:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    15f2:	89 d8                	mov    %ebx,%eax
+    15f4:	f7 ea                	imul   %edx
+    15f6:	d1 fa                	sar    %edx
+    15f8:	89 d8                	mov    %ebx,%eax
+    15fa:	c1 f8 1f             	sar    $0x1f,%eax
+    15fd:	29 c2                	sub    %eax,%edx
+    15ff:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    1602:	89 da                	mov    %ebx,%edx
+    1604:	29 c2                	sub    %eax,%edx
+    1606:	83 fa 01             	cmp    $0x1,%edx
+    1609:	0f 84 9b 00 00 00    	je     16aa <concreate+0xe4>
+      link("C0", file);
+    } else {
+      fd = open(file, O_CREATE | O_RDWR);
+    160f:	83 ec 08             	sub    $0x8,%esp
+    1612:	68 02 02 00 00       	push   $0x202
+    1617:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    161a:	50                   	push   %eax
+    161b:	e8 dc 34 00 00       	call   4afc <open>
+      if(fd < 0){
+    1620:	83 c4 10             	add    $0x10,%esp
+    1623:	85 c0                	test   %eax,%eax
+    1625:	0f 88 98 00 00 00    	js     16c3 <concreate+0xfd>
+        printf(1, "concreate create %s failed\n", file);
+        exit();
+      }
+      close(fd);
+    162b:	83 ec 0c             	sub    $0xc,%esp
+    162e:	50                   	push   %eax
+    162f:	e8 b0 34 00 00       	call   4ae4 <close>
+    1634:	83 c4 10             	add    $0x10,%esp
+    }
+    if(pid == 0)
+    1637:	85 f6                	test   %esi,%esi
+    1639:	0f 84 9c 00 00 00    	je     16db <concreate+0x115>
+      exit();
+    else
+      wait();
+    163f:	e8 80 34 00 00       	call   4ac4 <wait>
+  for(i = 0; i < 40; i++){
+    1644:	83 c3 01             	add    $0x1,%ebx
+    1647:	83 fb 27             	cmp    $0x27,%ebx
+    164a:	0f 8f 90 00 00 00    	jg     16e0 <concreate+0x11a>
+    file[1] = '0' + i;
+    1650:	8d 43 30             	lea    0x30(%ebx),%eax
+    1653:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    unlink(file);
+    1656:	83 ec 0c             	sub    $0xc,%esp
+    1659:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    165c:	50                   	push   %eax
+    165d:	e8 aa 34 00 00       	call   4b0c <unlink>
+    pid = fork();
+    1662:	e8 4d 34 00 00       	call   4ab4 <fork>
+    1667:	89 c6                	mov    %eax,%esi
+    if(pid && (i % 3) == 1){
+    1669:	83 c4 10             	add    $0x10,%esp
+    166c:	85 c0                	test   %eax,%eax
+    166e:	0f 84 79 ff ff ff    	je     15ed <concreate+0x27>
+    1674:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    1679:	89 d8                	mov    %ebx,%eax
+    167b:	f7 ea                	imul   %edx
+    167d:	89 d8                	mov    %ebx,%eax
+    167f:	c1 f8 1f             	sar    $0x1f,%eax
+    1682:	29 c2                	sub    %eax,%edx
+    1684:	8d 04 52             	lea    (%edx,%edx,2),%eax
+    1687:	89 da                	mov    %ebx,%edx
+    1689:	29 c2                	sub    %eax,%edx
+    168b:	83 fa 01             	cmp    $0x1,%edx
+    168e:	0f 85 7b ff ff ff    	jne    160f <concreate+0x49>
+      link("C0", file);
+    1694:	83 ec 08             	sub    $0x8,%esp
+    1697:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    169a:	50                   	push   %eax
+    169b:	68 a9 55 00 00       	push   $0x55a9
+    16a0:	e8 77 34 00 00       	call   4b1c <link>
+    16a5:	83 c4 10             	add    $0x10,%esp
+    16a8:	eb 8d                	jmp    1637 <concreate+0x71>
+      link("C0", file);
+    16aa:	83 ec 08             	sub    $0x8,%esp
+    16ad:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    16b0:	50                   	push   %eax
+    16b1:	68 a9 55 00 00       	push   $0x55a9
+    16b6:	e8 61 34 00 00       	call   4b1c <link>
+    16bb:	83 c4 10             	add    $0x10,%esp
+    16be:	e9 74 ff ff ff       	jmp    1637 <concreate+0x71>
+        printf(1, "concreate create %s failed\n", file);
+    16c3:	83 ec 04             	sub    $0x4,%esp
+    16c6:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    16c9:	50                   	push   %eax
+    16ca:	68 ac 55 00 00       	push   $0x55ac
+    16cf:	6a 01                	push   $0x1
+    16d1:	e8 bd 35 00 00       	call   4c93 <printf>
+        exit();
+    16d6:	e8 e1 33 00 00       	call   4abc <exit>
+      exit();
+    16db:	e8 dc 33 00 00       	call   4abc <exit>
+  }
+
+  memset(fa, 0, sizeof(fa));
+    16e0:	83 ec 04             	sub    $0x4,%esp
+    16e3:	6a 28                	push   $0x28
+    16e5:	6a 00                	push   $0x0
+    16e7:	8d 45 bd             	lea    -0x43(%ebp),%eax
+    16ea:	50                   	push   %eax
+    16eb:	e8 91 32 00 00       	call   4981 <memset>
+  fd = open(".", 0);
+    16f0:	83 c4 08             	add    $0x8,%esp
+    16f3:	6a 00                	push   $0x0
+    16f5:	68 b6 57 00 00       	push   $0x57b6
+    16fa:	e8 fd 33 00 00       	call   4afc <open>
+    16ff:	89 c3                	mov    %eax,%ebx
+  n = 0;
+  while(read(fd, &de, sizeof(de)) > 0){
+    1701:	83 c4 10             	add    $0x10,%esp
+  n = 0;
+    1704:	be 00 00 00 00       	mov    $0x0,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    1709:	83 ec 04             	sub    $0x4,%esp
+    170c:	6a 10                	push   $0x10
+    170e:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    1711:	50                   	push   %eax
+    1712:	53                   	push   %ebx
+    1713:	e8 bc 33 00 00       	call   4ad4 <read>
+    1718:	83 c4 10             	add    $0x10,%esp
+    171b:	85 c0                	test   %eax,%eax
+    171d:	7e 60                	jle    177f <concreate+0x1b9>
+    if(de.inum == 0)
+    171f:	66 83 7d ac 00       	cmpw   $0x0,-0x54(%ebp)
+    1724:	74 e3                	je     1709 <concreate+0x143>
+      continue;
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    1726:	80 7d ae 43          	cmpb   $0x43,-0x52(%ebp)
+    172a:	75 dd                	jne    1709 <concreate+0x143>
+    172c:	80 7d b0 00          	cmpb   $0x0,-0x50(%ebp)
+    1730:	75 d7                	jne    1709 <concreate+0x143>
+      i = de.name[1] - '0';
+    1732:	0f be 45 af          	movsbl -0x51(%ebp),%eax
+    1736:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    1739:	83 f8 27             	cmp    $0x27,%eax
+    173c:	77 11                	ja     174f <concreate+0x189>
+        printf(1, "concreate weird file %s\n", de.name);
+        exit();
+      }
+      if(fa[i]){
+    173e:	80 7c 05 bd 00       	cmpb   $0x0,-0x43(%ebp,%eax,1)
+    1743:	75 22                	jne    1767 <concreate+0x1a1>
+        printf(1, "concreate duplicate file %s\n", de.name);
+        exit();
+      }
+      fa[i] = 1;
+    1745:	c6 44 05 bd 01       	movb   $0x1,-0x43(%ebp,%eax,1)
+      n++;
+    174a:	83 c6 01             	add    $0x1,%esi
+    174d:	eb ba                	jmp    1709 <concreate+0x143>
+        printf(1, "concreate weird file %s\n", de.name);
+    174f:	83 ec 04             	sub    $0x4,%esp
+    1752:	8d 45 ae             	lea    -0x52(%ebp),%eax
+    1755:	50                   	push   %eax
+    1756:	68 c8 55 00 00       	push   $0x55c8
+    175b:	6a 01                	push   $0x1
+    175d:	e8 31 35 00 00       	call   4c93 <printf>
+        exit();
+    1762:	e8 55 33 00 00       	call   4abc <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    1767:	83 ec 04             	sub    $0x4,%esp
+    176a:	8d 45 ae             	lea    -0x52(%ebp),%eax
+    176d:	50                   	push   %eax
+    176e:	68 e1 55 00 00       	push   $0x55e1
+    1773:	6a 01                	push   $0x1
+    1775:	e8 19 35 00 00       	call   4c93 <printf>
+        exit();
+    177a:	e8 3d 33 00 00       	call   4abc <exit>
+    }
+  }
+  close(fd);
+    177f:	83 ec 0c             	sub    $0xc,%esp
+    1782:	53                   	push   %ebx
+    1783:	e8 5c 33 00 00       	call   4ae4 <close>
+
+  if(n != 40){
+    1788:	83 c4 10             	add    $0x10,%esp
+    178b:	83 fe 28             	cmp    $0x28,%esi
+    178e:	75 0a                	jne    179a <concreate+0x1d4>
+    printf(1, "concreate not enough files in directory listing\n");
+    exit();
+  }
+
+  for(i = 0; i < 40; i++){
+    1790:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1795:	e9 86 00 00 00       	jmp    1820 <concreate+0x25a>
+    printf(1, "concreate not enough files in directory listing\n");
+    179a:	83 ec 08             	sub    $0x8,%esp
+    179d:	68 18 66 00 00       	push   $0x6618
+    17a2:	6a 01                	push   $0x1
+    17a4:	e8 ea 34 00 00       	call   4c93 <printf>
+    exit();
+    17a9:	e8 0e 33 00 00       	call   4abc <exit>
+    file[1] = '0' + i;
+    pid = fork();
+    if(pid < 0){
+      printf(1, "fork failed\n");
+    17ae:	83 ec 08             	sub    $0x8,%esp
+    17b1:	68 61 63 00 00       	push   $0x6361
+    17b6:	6a 01                	push   $0x1
+    17b8:	e8 d6 34 00 00       	call   4c93 <printf>
+      exit();
+    17bd:	e8 fa 32 00 00       	call   4abc <exit>
+    }
+    if(((i % 3) == 0 && pid == 0) ||
+       ((i % 3) == 1 && pid != 0)){
+      close(open(file, 0));
+    17c2:	83 ec 08             	sub    $0x8,%esp
+    17c5:	6a 00                	push   $0x0
+    17c7:	8d 7d e5             	lea    -0x1b(%ebp),%edi
+    17ca:	57                   	push   %edi
+    17cb:	e8 2c 33 00 00       	call   4afc <open>
+    17d0:	89 04 24             	mov    %eax,(%esp)
+    17d3:	e8 0c 33 00 00       	call   4ae4 <close>
+      close(open(file, 0));
+    17d8:	83 c4 08             	add    $0x8,%esp
+    17db:	6a 00                	push   $0x0
+    17dd:	57                   	push   %edi
+    17de:	e8 19 33 00 00       	call   4afc <open>
+    17e3:	89 04 24             	mov    %eax,(%esp)
+    17e6:	e8 f9 32 00 00       	call   4ae4 <close>
+      close(open(file, 0));
+    17eb:	83 c4 08             	add    $0x8,%esp
+    17ee:	6a 00                	push   $0x0
+    17f0:	57                   	push   %edi
+    17f1:	e8 06 33 00 00       	call   4afc <open>
+    17f6:	89 04 24             	mov    %eax,(%esp)
+    17f9:	e8 e6 32 00 00       	call   4ae4 <close>
+      close(open(file, 0));
+    17fe:	83 c4 08             	add    $0x8,%esp
+    1801:	6a 00                	push   $0x0
+    1803:	57                   	push   %edi
+    1804:	e8 f3 32 00 00       	call   4afc <open>
+    1809:	89 04 24             	mov    %eax,(%esp)
+    180c:	e8 d3 32 00 00       	call   4ae4 <close>
+    1811:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+      unlink(file);
+      unlink(file);
+      unlink(file);
+    }
+    if(pid == 0)
+    1814:	85 f6                	test   %esi,%esi
+    1816:	74 79                	je     1891 <concreate+0x2cb>
+      exit();
+    else
+      wait();
+    1818:	e8 a7 32 00 00       	call   4ac4 <wait>
+  for(i = 0; i < 40; i++){
+    181d:	83 c3 01             	add    $0x1,%ebx
+    1820:	83 fb 27             	cmp    $0x27,%ebx
+    1823:	7f 71                	jg     1896 <concreate+0x2d0>
+    file[1] = '0' + i;
+    1825:	8d 43 30             	lea    0x30(%ebx),%eax
+    1828:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    pid = fork();
+    182b:	e8 84 32 00 00       	call   4ab4 <fork>
+    1830:	89 c6                	mov    %eax,%esi
+    if(pid < 0){
+    1832:	85 c0                	test   %eax,%eax
+    1834:	0f 88 74 ff ff ff    	js     17ae <concreate+0x1e8>
+    if(((i % 3) == 0 && pid == 0) ||
+    183a:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    183f:	89 d8                	mov    %ebx,%eax
+    1841:	f7 ea                	imul   %edx
+    1843:	89 d8                	mov    %ebx,%eax
+    1845:	c1 f8 1f             	sar    $0x1f,%eax
+    1848:	29 c2                	sub    %eax,%edx
+    184a:	8d 04 52             	lea    (%edx,%edx,2),%eax
+    184d:	89 da                	mov    %ebx,%edx
+    184f:	29 c2                	sub    %eax,%edx
+    1851:	89 d0                	mov    %edx,%eax
+    1853:	09 f0                	or     %esi,%eax
+    1855:	0f 84 67 ff ff ff    	je     17c2 <concreate+0x1fc>
+    185b:	83 fa 01             	cmp    $0x1,%edx
+    185e:	75 08                	jne    1868 <concreate+0x2a2>
+       ((i % 3) == 1 && pid != 0)){
+    1860:	85 f6                	test   %esi,%esi
+    1862:	0f 85 5a ff ff ff    	jne    17c2 <concreate+0x1fc>
+      unlink(file);
+    1868:	83 ec 0c             	sub    $0xc,%esp
+    186b:	8d 7d e5             	lea    -0x1b(%ebp),%edi
+    186e:	57                   	push   %edi
+    186f:	e8 98 32 00 00       	call   4b0c <unlink>
+      unlink(file);
+    1874:	89 3c 24             	mov    %edi,(%esp)
+    1877:	e8 90 32 00 00       	call   4b0c <unlink>
+      unlink(file);
+    187c:	89 3c 24             	mov    %edi,(%esp)
+    187f:	e8 88 32 00 00       	call   4b0c <unlink>
+      unlink(file);
+    1884:	89 3c 24             	mov    %edi,(%esp)
+    1887:	e8 80 32 00 00       	call   4b0c <unlink>
+    188c:	83 c4 10             	add    $0x10,%esp
+    188f:	eb 83                	jmp    1814 <concreate+0x24e>
+      exit();
+    1891:	e8 26 32 00 00       	call   4abc <exit>
+  }
+
+  printf(1, "concreate ok\n");
+    1896:	83 ec 08             	sub    $0x8,%esp
+    1899:	68 fe 55 00 00       	push   $0x55fe
+    189e:	6a 01                	push   $0x1
+    18a0:	e8 ee 33 00 00       	call   4c93 <printf>
+}
+    18a5:	83 c4 10             	add    $0x10,%esp
+    18a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    18ab:	5b                   	pop    %ebx
+    18ac:	5e                   	pop    %esi
+    18ad:	5f                   	pop    %edi
+    18ae:	5d                   	pop    %ebp
+    18af:	c3                   	ret
+
+000018b0 <linkunlink>:
+
+// another concurrent link/unlink/create test,
+// to look for deadlocks.
+void
+linkunlink()
+{
+    18b0:	55                   	push   %ebp
+    18b1:	89 e5                	mov    %esp,%ebp
+    18b3:	57                   	push   %edi
+    18b4:	56                   	push   %esi
+    18b5:	53                   	push   %ebx
+    18b6:	83 ec 14             	sub    $0x14,%esp
+  int pid, i;
+
+  printf(1, "linkunlink test\n");
+    18b9:	68 0c 56 00 00       	push   $0x560c
+    18be:	6a 01                	push   $0x1
+    18c0:	e8 ce 33 00 00       	call   4c93 <printf>
+
+  unlink("x");
+    18c5:	c7 04 24 99 58 00 00 	movl   $0x5899,(%esp)
+    18cc:	e8 3b 32 00 00       	call   4b0c <unlink>
+  pid = fork();
+    18d1:	e8 de 31 00 00       	call   4ab4 <fork>
+  if(pid < 0){
+    18d6:	83 c4 10             	add    $0x10,%esp
+    18d9:	85 c0                	test   %eax,%eax
+    18db:	78 10                	js     18ed <linkunlink+0x3d>
+    18dd:	89 c7                	mov    %eax,%edi
+    printf(1, "fork failed\n");
+    exit();
+  }
+
+  unsigned int x = (pid ? 1 : 97);
+    18df:	74 20                	je     1901 <linkunlink+0x51>
+    18e1:	bb 01 00 00 00       	mov    $0x1,%ebx
+    18e6:	be 00 00 00 00       	mov    $0x0,%esi
+    18eb:	eb 3b                	jmp    1928 <linkunlink+0x78>
+    printf(1, "fork failed\n");
+    18ed:	83 ec 08             	sub    $0x8,%esp
+    18f0:	68 61 63 00 00       	push   $0x6361
+    18f5:	6a 01                	push   $0x1
+    18f7:	e8 97 33 00 00       	call   4c93 <printf>
+    exit();
+    18fc:	e8 bb 31 00 00       	call   4abc <exit>
+  unsigned int x = (pid ? 1 : 97);
+    1901:	bb 61 00 00 00       	mov    $0x61,%ebx
+    1906:	eb de                	jmp    18e6 <linkunlink+0x36>
+  for(i = 0; i < 100; i++){
+    x = x * 1103515245 + 12345;
+    if((x % 3) == 0){
+      close(open("x", O_RDWR | O_CREATE));
+    1908:	83 ec 08             	sub    $0x8,%esp
+    190b:	68 02 02 00 00       	push   $0x202
+    1910:	68 99 58 00 00       	push   $0x5899
+    1915:	e8 e2 31 00 00       	call   4afc <open>
+    191a:	89 04 24             	mov    %eax,(%esp)
+    191d:	e8 c2 31 00 00       	call   4ae4 <close>
+    1922:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1925:	83 c6 01             	add    $0x1,%esi
+    1928:	83 fe 63             	cmp    $0x63,%esi
+    192b:	7f 52                	jg     197f <linkunlink+0xcf>
+    x = x * 1103515245 + 12345;
+    192d:	69 db 6d 4e c6 41    	imul   $0x41c64e6d,%ebx,%ebx
+    1933:	81 c3 39 30 00 00    	add    $0x3039,%ebx
+    if((x % 3) == 0){
+    1939:	ba ab aa aa aa       	mov    $0xaaaaaaab,%edx
+    193e:	89 d8                	mov    %ebx,%eax
+    1940:	f7 e2                	mul    %edx
+    1942:	89 d0                	mov    %edx,%eax
+    1944:	d1 e8                	shr    %eax
+    1946:	83 e2 fe             	and    $0xfffffffe,%edx
+    1949:	01 c2                	add    %eax,%edx
+    194b:	89 d8                	mov    %ebx,%eax
+    194d:	29 d0                	sub    %edx,%eax
+    194f:	74 b7                	je     1908 <linkunlink+0x58>
+    } else if((x % 3) == 1){
+    1951:	83 f8 01             	cmp    $0x1,%eax
+    1954:	74 12                	je     1968 <linkunlink+0xb8>
+      link("cat", "x");
+    } else {
+      unlink("x");
+    1956:	83 ec 0c             	sub    $0xc,%esp
+    1959:	68 99 58 00 00       	push   $0x5899
+    195e:	e8 a9 31 00 00       	call   4b0c <unlink>
+    1963:	83 c4 10             	add    $0x10,%esp
+    1966:	eb bd                	jmp    1925 <linkunlink+0x75>
+      link("cat", "x");
+    1968:	83 ec 08             	sub    $0x8,%esp
+    196b:	68 99 58 00 00       	push   $0x5899
+    1970:	68 1d 56 00 00       	push   $0x561d
+    1975:	e8 a2 31 00 00       	call   4b1c <link>
+    197a:	83 c4 10             	add    $0x10,%esp
+    197d:	eb a6                	jmp    1925 <linkunlink+0x75>
+    }
+  }
+
+  if(pid)
+    197f:	85 ff                	test   %edi,%edi
+    1981:	74 1c                	je     199f <linkunlink+0xef>
+    wait();
+    1983:	e8 3c 31 00 00       	call   4ac4 <wait>
+  else
+    exit();
+
+  printf(1, "linkunlink ok\n");
+    1988:	83 ec 08             	sub    $0x8,%esp
+    198b:	68 21 56 00 00       	push   $0x5621
+    1990:	6a 01                	push   $0x1
+    1992:	e8 fc 32 00 00       	call   4c93 <printf>
+}
+    1997:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    199a:	5b                   	pop    %ebx
+    199b:	5e                   	pop    %esi
+    199c:	5f                   	pop    %edi
+    199d:	5d                   	pop    %ebp
+    199e:	c3                   	ret
+    exit();
+    199f:	e8 18 31 00 00       	call   4abc <exit>
+
+000019a4 <bigdir>:
+
+// directory that uses indirect blocks
+void
+bigdir(void)
+{
+    19a4:	55                   	push   %ebp
+    19a5:	89 e5                	mov    %esp,%ebp
+    19a7:	53                   	push   %ebx
+    19a8:	83 ec 1c             	sub    $0x1c,%esp
+  int i, fd;
+  char name[10];
+
+  printf(1, "bigdir test\n");
+    19ab:	68 30 56 00 00       	push   $0x5630
+    19b0:	6a 01                	push   $0x1
+    19b2:	e8 dc 32 00 00       	call   4c93 <printf>
+  unlink("bd");
+    19b7:	c7 04 24 3d 56 00 00 	movl   $0x563d,(%esp)
+    19be:	e8 49 31 00 00       	call   4b0c <unlink>
+
+  fd = open("bd", O_CREATE);
+    19c3:	83 c4 08             	add    $0x8,%esp
+    19c6:	68 00 02 00 00       	push   $0x200
+    19cb:	68 3d 56 00 00       	push   $0x563d
+    19d0:	e8 27 31 00 00       	call   4afc <open>
+  if(fd < 0){
+    19d5:	83 c4 10             	add    $0x10,%esp
+    19d8:	85 c0                	test   %eax,%eax
+    19da:	78 65                	js     1a41 <bigdir+0x9d>
+    printf(1, "bigdir create failed\n");
+    exit();
+  }
+  close(fd);
+    19dc:	83 ec 0c             	sub    $0xc,%esp
+    19df:	50                   	push   %eax
+    19e0:	e8 ff 30 00 00       	call   4ae4 <close>
+
+  for(i = 0; i < 500; i++){
+    19e5:	83 c4 10             	add    $0x10,%esp
+    19e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    19ed:	81 fb f3 01 00 00    	cmp    $0x1f3,%ebx
+    19f3:	7f 74                	jg     1a69 <bigdir+0xc5>
+    name[0] = 'x';
+    19f5:	c6 45 ee 78          	movb   $0x78,-0x12(%ebp)
+    name[1] = '0' + (i / 64);
+    19f9:	8d 43 3f             	lea    0x3f(%ebx),%eax
+    19fc:	85 db                	test   %ebx,%ebx
+    19fe:	0f 49 c3             	cmovns %ebx,%eax
+    1a01:	c1 f8 06             	sar    $0x6,%eax
+    1a04:	83 c0 30             	add    $0x30,%eax
+    1a07:	88 45 ef             	mov    %al,-0x11(%ebp)
+    name[2] = '0' + (i % 64);
+    1a0a:	89 da                	mov    %ebx,%edx
+    1a0c:	c1 fa 1f             	sar    $0x1f,%edx
+    1a0f:	c1 ea 1a             	shr    $0x1a,%edx
+    1a12:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+    1a15:	83 e0 3f             	and    $0x3f,%eax
+    1a18:	29 d0                	sub    %edx,%eax
+    1a1a:	83 c0 30             	add    $0x30,%eax
+    1a1d:	88 45 f0             	mov    %al,-0x10(%ebp)
+    name[3] = '\0';
+    1a20:	c6 45 f1 00          	movb   $0x0,-0xf(%ebp)
+    if(link("bd", name) != 0){
+    1a24:	83 ec 08             	sub    $0x8,%esp
+    1a27:	8d 45 ee             	lea    -0x12(%ebp),%eax
+    1a2a:	50                   	push   %eax
+    1a2b:	68 3d 56 00 00       	push   $0x563d
+    1a30:	e8 e7 30 00 00       	call   4b1c <link>
+    1a35:	83 c4 10             	add    $0x10,%esp
+    1a38:	85 c0                	test   %eax,%eax
+    1a3a:	75 19                	jne    1a55 <bigdir+0xb1>
+  for(i = 0; i < 500; i++){
+    1a3c:	83 c3 01             	add    $0x1,%ebx
+    1a3f:	eb ac                	jmp    19ed <bigdir+0x49>
+    printf(1, "bigdir create failed\n");
+    1a41:	83 ec 08             	sub    $0x8,%esp
+    1a44:	68 40 56 00 00       	push   $0x5640
+    1a49:	6a 01                	push   $0x1
+    1a4b:	e8 43 32 00 00       	call   4c93 <printf>
+    exit();
+    1a50:	e8 67 30 00 00       	call   4abc <exit>
+      printf(1, "bigdir link failed\n");
+    1a55:	83 ec 08             	sub    $0x8,%esp
+    1a58:	68 56 56 00 00       	push   $0x5656
+    1a5d:	6a 01                	push   $0x1
+    1a5f:	e8 2f 32 00 00       	call   4c93 <printf>
+      exit();
+    1a64:	e8 53 30 00 00       	call   4abc <exit>
+    }
+  }
+
+  unlink("bd");
+    1a69:	83 ec 0c             	sub    $0xc,%esp
+    1a6c:	68 3d 56 00 00       	push   $0x563d
+    1a71:	e8 96 30 00 00       	call   4b0c <unlink>
+  for(i = 0; i < 500; i++){
+    1a76:	83 c4 10             	add    $0x10,%esp
+    1a79:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1a7e:	eb 03                	jmp    1a83 <bigdir+0xdf>
+    1a80:	83 c3 01             	add    $0x1,%ebx
+    1a83:	81 fb f3 01 00 00    	cmp    $0x1f3,%ebx
+    1a89:	7f 56                	jg     1ae1 <bigdir+0x13d>
+    name[0] = 'x';
+    1a8b:	c6 45 ee 78          	movb   $0x78,-0x12(%ebp)
+    name[1] = '0' + (i / 64);
+    1a8f:	8d 43 3f             	lea    0x3f(%ebx),%eax
+    1a92:	85 db                	test   %ebx,%ebx
+    1a94:	0f 49 c3             	cmovns %ebx,%eax
+    1a97:	c1 f8 06             	sar    $0x6,%eax
+    1a9a:	83 c0 30             	add    $0x30,%eax
+    1a9d:	88 45 ef             	mov    %al,-0x11(%ebp)
+    name[2] = '0' + (i % 64);
+    1aa0:	89 da                	mov    %ebx,%edx
+    1aa2:	c1 fa 1f             	sar    $0x1f,%edx
+    1aa5:	c1 ea 1a             	shr    $0x1a,%edx
+    1aa8:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+    1aab:	83 e0 3f             	and    $0x3f,%eax
+    1aae:	29 d0                	sub    %edx,%eax
+    1ab0:	83 c0 30             	add    $0x30,%eax
+    1ab3:	88 45 f0             	mov    %al,-0x10(%ebp)
+    name[3] = '\0';
+    1ab6:	c6 45 f1 00          	movb   $0x0,-0xf(%ebp)
+    if(unlink(name) != 0){
+    1aba:	83 ec 0c             	sub    $0xc,%esp
+    1abd:	8d 45 ee             	lea    -0x12(%ebp),%eax
+    1ac0:	50                   	push   %eax
+    1ac1:	e8 46 30 00 00       	call   4b0c <unlink>
+    1ac6:	83 c4 10             	add    $0x10,%esp
+    1ac9:	85 c0                	test   %eax,%eax
+    1acb:	74 b3                	je     1a80 <bigdir+0xdc>
+      printf(1, "bigdir unlink failed");
+    1acd:	83 ec 08             	sub    $0x8,%esp
+    1ad0:	68 6a 56 00 00       	push   $0x566a
+    1ad5:	6a 01                	push   $0x1
+    1ad7:	e8 b7 31 00 00       	call   4c93 <printf>
+      exit();
+    1adc:	e8 db 2f 00 00       	call   4abc <exit>
+    }
+  }
+
+  printf(1, "bigdir ok\n");
+    1ae1:	83 ec 08             	sub    $0x8,%esp
+    1ae4:	68 7f 56 00 00       	push   $0x567f
+    1ae9:	6a 01                	push   $0x1
+    1aeb:	e8 a3 31 00 00       	call   4c93 <printf>
+}
+    1af0:	83 c4 10             	add    $0x10,%esp
+    1af3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1af6:	c9                   	leave
+    1af7:	c3                   	ret
+
+00001af8 <subdir>:
+
+void
+subdir(void)
+{
+    1af8:	55                   	push   %ebp
+    1af9:	89 e5                	mov    %esp,%ebp
+    1afb:	53                   	push   %ebx
+    1afc:	83 ec 0c             	sub    $0xc,%esp
+  int fd, cc;
+
+  printf(1, "subdir test\n");
+    1aff:	68 8a 56 00 00       	push   $0x568a
+    1b04:	6a 01                	push   $0x1
+    1b06:	e8 88 31 00 00       	call   4c93 <printf>
+
+  unlink("ff");
+    1b0b:	c7 04 24 13 57 00 00 	movl   $0x5713,(%esp)
+    1b12:	e8 f5 2f 00 00       	call   4b0c <unlink>
+  if(mkdir("dd") != 0){
+    1b17:	c7 04 24 b0 57 00 00 	movl   $0x57b0,(%esp)
+    1b1e:	e8 01 30 00 00       	call   4b24 <mkdir>
+    1b23:	83 c4 10             	add    $0x10,%esp
+    1b26:	85 c0                	test   %eax,%eax
+    1b28:	0f 85 14 04 00 00    	jne    1f42 <subdir+0x44a>
+    printf(1, "subdir mkdir dd failed\n");
+    exit();
+  }
+
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    1b2e:	83 ec 08             	sub    $0x8,%esp
+    1b31:	68 02 02 00 00       	push   $0x202
+    1b36:	68 e9 56 00 00       	push   $0x56e9
+    1b3b:	e8 bc 2f 00 00       	call   4afc <open>
+    1b40:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1b42:	83 c4 10             	add    $0x10,%esp
+    1b45:	85 c0                	test   %eax,%eax
+    1b47:	0f 88 09 04 00 00    	js     1f56 <subdir+0x45e>
+    printf(1, "create dd/ff failed\n");
+    exit();
+  }
+  write(fd, "ff", 2);
+    1b4d:	83 ec 04             	sub    $0x4,%esp
+    1b50:	6a 02                	push   $0x2
+    1b52:	68 13 57 00 00       	push   $0x5713
+    1b57:	50                   	push   %eax
+    1b58:	e8 7f 2f 00 00       	call   4adc <write>
+  close(fd);
+    1b5d:	89 1c 24             	mov    %ebx,(%esp)
+    1b60:	e8 7f 2f 00 00       	call   4ae4 <close>
+
+  if(unlink("dd") >= 0){
+    1b65:	c7 04 24 b0 57 00 00 	movl   $0x57b0,(%esp)
+    1b6c:	e8 9b 2f 00 00       	call   4b0c <unlink>
+    1b71:	83 c4 10             	add    $0x10,%esp
+    1b74:	85 c0                	test   %eax,%eax
+    1b76:	0f 89 ee 03 00 00    	jns    1f6a <subdir+0x472>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    exit();
+  }
+
+  if(mkdir("/dd/dd") != 0){
+    1b7c:	83 ec 0c             	sub    $0xc,%esp
+    1b7f:	68 c4 56 00 00       	push   $0x56c4
+    1b84:	e8 9b 2f 00 00       	call   4b24 <mkdir>
+    1b89:	83 c4 10             	add    $0x10,%esp
+    1b8c:	85 c0                	test   %eax,%eax
+    1b8e:	0f 85 ea 03 00 00    	jne    1f7e <subdir+0x486>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    exit();
+  }
+
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    1b94:	83 ec 08             	sub    $0x8,%esp
+    1b97:	68 02 02 00 00       	push   $0x202
+    1b9c:	68 e6 56 00 00       	push   $0x56e6
+    1ba1:	e8 56 2f 00 00       	call   4afc <open>
+    1ba6:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1ba8:	83 c4 10             	add    $0x10,%esp
+    1bab:	85 c0                	test   %eax,%eax
+    1bad:	0f 88 df 03 00 00    	js     1f92 <subdir+0x49a>
+    printf(1, "create dd/dd/ff failed\n");
+    exit();
+  }
+  write(fd, "FF", 2);
+    1bb3:	83 ec 04             	sub    $0x4,%esp
+    1bb6:	6a 02                	push   $0x2
+    1bb8:	68 07 57 00 00       	push   $0x5707
+    1bbd:	50                   	push   %eax
+    1bbe:	e8 19 2f 00 00       	call   4adc <write>
+  close(fd);
+    1bc3:	89 1c 24             	mov    %ebx,(%esp)
+    1bc6:	e8 19 2f 00 00       	call   4ae4 <close>
+
+  fd = open("dd/dd/../ff", 0);
+    1bcb:	83 c4 08             	add    $0x8,%esp
+    1bce:	6a 00                	push   $0x0
+    1bd0:	68 0a 57 00 00       	push   $0x570a
+    1bd5:	e8 22 2f 00 00       	call   4afc <open>
+    1bda:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1bdc:	83 c4 10             	add    $0x10,%esp
+    1bdf:	85 c0                	test   %eax,%eax
+    1be1:	0f 88 bf 03 00 00    	js     1fa6 <subdir+0x4ae>
+    printf(1, "open dd/dd/../ff failed\n");
+    exit();
+  }
+  cc = read(fd, buf, sizeof(buf));
+    1be7:	83 ec 04             	sub    $0x4,%esp
+    1bea:	68 00 20 00 00       	push   $0x2000
+    1bef:	68 a0 cf 00 00       	push   $0xcfa0
+    1bf4:	50                   	push   %eax
+    1bf5:	e8 da 2e 00 00       	call   4ad4 <read>
+  if(cc != 2 || buf[0] != 'f'){
+    1bfa:	83 c4 10             	add    $0x10,%esp
+    1bfd:	83 f8 02             	cmp    $0x2,%eax
+    1c00:	0f 85 b4 03 00 00    	jne    1fba <subdir+0x4c2>
+    1c06:	80 3d a0 cf 00 00 66 	cmpb   $0x66,0xcfa0
+    1c0d:	0f 85 a7 03 00 00    	jne    1fba <subdir+0x4c2>
+    printf(1, "dd/dd/../ff wrong content\n");
+    exit();
+  }
+  close(fd);
+    1c13:	83 ec 0c             	sub    $0xc,%esp
+    1c16:	53                   	push   %ebx
+    1c17:	e8 c8 2e 00 00       	call   4ae4 <close>
+
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    1c1c:	83 c4 08             	add    $0x8,%esp
+    1c1f:	68 4a 57 00 00       	push   $0x574a
+    1c24:	68 e6 56 00 00       	push   $0x56e6
+    1c29:	e8 ee 2e 00 00       	call   4b1c <link>
+    1c2e:	83 c4 10             	add    $0x10,%esp
+    1c31:	85 c0                	test   %eax,%eax
+    1c33:	0f 85 95 03 00 00    	jne    1fce <subdir+0x4d6>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    exit();
+  }
+
+  if(unlink("dd/dd/ff") != 0){
+    1c39:	83 ec 0c             	sub    $0xc,%esp
+    1c3c:	68 e6 56 00 00       	push   $0x56e6
+    1c41:	e8 c6 2e 00 00       	call   4b0c <unlink>
+    1c46:	83 c4 10             	add    $0x10,%esp
+    1c49:	85 c0                	test   %eax,%eax
+    1c4b:	0f 85 91 03 00 00    	jne    1fe2 <subdir+0x4ea>
+    printf(1, "unlink dd/dd/ff failed\n");
+    exit();
+  }
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    1c51:	83 ec 08             	sub    $0x8,%esp
+    1c54:	6a 00                	push   $0x0
+    1c56:	68 e6 56 00 00       	push   $0x56e6
+    1c5b:	e8 9c 2e 00 00       	call   4afc <open>
+    1c60:	83 c4 10             	add    $0x10,%esp
+    1c63:	85 c0                	test   %eax,%eax
+    1c65:	0f 89 8b 03 00 00    	jns    1ff6 <subdir+0x4fe>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    exit();
+  }
+
+  if(chdir("dd") != 0){
+    1c6b:	83 ec 0c             	sub    $0xc,%esp
+    1c6e:	68 b0 57 00 00       	push   $0x57b0
+    1c73:	e8 b4 2e 00 00       	call   4b2c <chdir>
+    1c78:	83 c4 10             	add    $0x10,%esp
+    1c7b:	85 c0                	test   %eax,%eax
+    1c7d:	0f 85 87 03 00 00    	jne    200a <subdir+0x512>
+    printf(1, "chdir dd failed\n");
+    exit();
+  }
+  if(chdir("dd/../../dd") != 0){
+    1c83:	83 ec 0c             	sub    $0xc,%esp
+    1c86:	68 7e 57 00 00       	push   $0x577e
+    1c8b:	e8 9c 2e 00 00       	call   4b2c <chdir>
+    1c90:	83 c4 10             	add    $0x10,%esp
+    1c93:	85 c0                	test   %eax,%eax
+    1c95:	0f 85 83 03 00 00    	jne    201e <subdir+0x526>
+    printf(1, "chdir dd/../../dd failed\n");
+    exit();
+  }
+  if(chdir("dd/../../../dd") != 0){
+    1c9b:	83 ec 0c             	sub    $0xc,%esp
+    1c9e:	68 a4 57 00 00       	push   $0x57a4
+    1ca3:	e8 84 2e 00 00       	call   4b2c <chdir>
+    1ca8:	83 c4 10             	add    $0x10,%esp
+    1cab:	85 c0                	test   %eax,%eax
+    1cad:	0f 85 7f 03 00 00    	jne    2032 <subdir+0x53a>
+    printf(1, "chdir dd/../../dd failed\n");
+    exit();
+  }
+  if(chdir("./..") != 0){
+    1cb3:	83 ec 0c             	sub    $0xc,%esp
+    1cb6:	68 b3 57 00 00       	push   $0x57b3
+    1cbb:	e8 6c 2e 00 00       	call   4b2c <chdir>
+    1cc0:	83 c4 10             	add    $0x10,%esp
+    1cc3:	85 c0                	test   %eax,%eax
+    1cc5:	0f 85 7b 03 00 00    	jne    2046 <subdir+0x54e>
+    printf(1, "chdir ./.. failed\n");
+    exit();
+  }
+
+  fd = open("dd/dd/ffff", 0);
+    1ccb:	83 ec 08             	sub    $0x8,%esp
+    1cce:	6a 00                	push   $0x0
+    1cd0:	68 4a 57 00 00       	push   $0x574a
+    1cd5:	e8 22 2e 00 00       	call   4afc <open>
+    1cda:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1cdc:	83 c4 10             	add    $0x10,%esp
+    1cdf:	85 c0                	test   %eax,%eax
+    1ce1:	0f 88 73 03 00 00    	js     205a <subdir+0x562>
+    printf(1, "open dd/dd/ffff failed\n");
+    exit();
+  }
+  if(read(fd, buf, sizeof(buf)) != 2){
+    1ce7:	83 ec 04             	sub    $0x4,%esp
+    1cea:	68 00 20 00 00       	push   $0x2000
+    1cef:	68 a0 cf 00 00       	push   $0xcfa0
+    1cf4:	50                   	push   %eax
+    1cf5:	e8 da 2d 00 00       	call   4ad4 <read>
+    1cfa:	83 c4 10             	add    $0x10,%esp
+    1cfd:	83 f8 02             	cmp    $0x2,%eax
+    1d00:	0f 85 68 03 00 00    	jne    206e <subdir+0x576>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    exit();
+  }
+  close(fd);
+    1d06:	83 ec 0c             	sub    $0xc,%esp
+    1d09:	53                   	push   %ebx
+    1d0a:	e8 d5 2d 00 00       	call   4ae4 <close>
+
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    1d0f:	83 c4 08             	add    $0x8,%esp
+    1d12:	6a 00                	push   $0x0
+    1d14:	68 e6 56 00 00       	push   $0x56e6
+    1d19:	e8 de 2d 00 00       	call   4afc <open>
+    1d1e:	83 c4 10             	add    $0x10,%esp
+    1d21:	85 c0                	test   %eax,%eax
+    1d23:	0f 89 59 03 00 00    	jns    2082 <subdir+0x58a>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    exit();
+  }
+
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    1d29:	83 ec 08             	sub    $0x8,%esp
+    1d2c:	68 02 02 00 00       	push   $0x202
+    1d31:	68 fe 57 00 00       	push   $0x57fe
+    1d36:	e8 c1 2d 00 00       	call   4afc <open>
+    1d3b:	83 c4 10             	add    $0x10,%esp
+    1d3e:	85 c0                	test   %eax,%eax
+    1d40:	0f 89 50 03 00 00    	jns    2096 <subdir+0x59e>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    exit();
+  }
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    1d46:	83 ec 08             	sub    $0x8,%esp
+    1d49:	68 02 02 00 00       	push   $0x202
+    1d4e:	68 23 58 00 00       	push   $0x5823
+    1d53:	e8 a4 2d 00 00       	call   4afc <open>
+    1d58:	83 c4 10             	add    $0x10,%esp
+    1d5b:	85 c0                	test   %eax,%eax
+    1d5d:	0f 89 47 03 00 00    	jns    20aa <subdir+0x5b2>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    exit();
+  }
+  if(open("dd", O_CREATE) >= 0){
+    1d63:	83 ec 08             	sub    $0x8,%esp
+    1d66:	68 00 02 00 00       	push   $0x200
+    1d6b:	68 b0 57 00 00       	push   $0x57b0
+    1d70:	e8 87 2d 00 00       	call   4afc <open>
+    1d75:	83 c4 10             	add    $0x10,%esp
+    1d78:	85 c0                	test   %eax,%eax
+    1d7a:	0f 89 3e 03 00 00    	jns    20be <subdir+0x5c6>
+    printf(1, "create dd succeeded!\n");
+    exit();
+  }
+  if(open("dd", O_RDWR) >= 0){
+    1d80:	83 ec 08             	sub    $0x8,%esp
+    1d83:	6a 02                	push   $0x2
+    1d85:	68 b0 57 00 00       	push   $0x57b0
+    1d8a:	e8 6d 2d 00 00       	call   4afc <open>
+    1d8f:	83 c4 10             	add    $0x10,%esp
+    1d92:	85 c0                	test   %eax,%eax
+    1d94:	0f 89 38 03 00 00    	jns    20d2 <subdir+0x5da>
+    printf(1, "open dd rdwr succeeded!\n");
+    exit();
+  }
+  if(open("dd", O_WRONLY) >= 0){
+    1d9a:	83 ec 08             	sub    $0x8,%esp
+    1d9d:	6a 01                	push   $0x1
+    1d9f:	68 b0 57 00 00       	push   $0x57b0
+    1da4:	e8 53 2d 00 00       	call   4afc <open>
+    1da9:	83 c4 10             	add    $0x10,%esp
+    1dac:	85 c0                	test   %eax,%eax
+    1dae:	0f 89 32 03 00 00    	jns    20e6 <subdir+0x5ee>
+    printf(1, "open dd wronly succeeded!\n");
+    exit();
+  }
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    1db4:	83 ec 08             	sub    $0x8,%esp
+    1db7:	68 92 58 00 00       	push   $0x5892
+    1dbc:	68 fe 57 00 00       	push   $0x57fe
+    1dc1:	e8 56 2d 00 00       	call   4b1c <link>
+    1dc6:	83 c4 10             	add    $0x10,%esp
+    1dc9:	85 c0                	test   %eax,%eax
+    1dcb:	0f 84 29 03 00 00    	je     20fa <subdir+0x602>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    exit();
+  }
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    1dd1:	83 ec 08             	sub    $0x8,%esp
+    1dd4:	68 92 58 00 00       	push   $0x5892
+    1dd9:	68 23 58 00 00       	push   $0x5823
+    1dde:	e8 39 2d 00 00       	call   4b1c <link>
+    1de3:	83 c4 10             	add    $0x10,%esp
+    1de6:	85 c0                	test   %eax,%eax
+    1de8:	0f 84 20 03 00 00    	je     210e <subdir+0x616>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    exit();
+  }
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    1dee:	83 ec 08             	sub    $0x8,%esp
+    1df1:	68 4a 57 00 00       	push   $0x574a
+    1df6:	68 e9 56 00 00       	push   $0x56e9
+    1dfb:	e8 1c 2d 00 00       	call   4b1c <link>
+    1e00:	83 c4 10             	add    $0x10,%esp
+    1e03:	85 c0                	test   %eax,%eax
+    1e05:	0f 84 17 03 00 00    	je     2122 <subdir+0x62a>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    exit();
+  }
+  if(mkdir("dd/ff/ff") == 0){
+    1e0b:	83 ec 0c             	sub    $0xc,%esp
+    1e0e:	68 fe 57 00 00       	push   $0x57fe
+    1e13:	e8 0c 2d 00 00       	call   4b24 <mkdir>
+    1e18:	83 c4 10             	add    $0x10,%esp
+    1e1b:	85 c0                	test   %eax,%eax
+    1e1d:	0f 84 13 03 00 00    	je     2136 <subdir+0x63e>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    exit();
+  }
+  if(mkdir("dd/xx/ff") == 0){
+    1e23:	83 ec 0c             	sub    $0xc,%esp
+    1e26:	68 23 58 00 00       	push   $0x5823
+    1e2b:	e8 f4 2c 00 00       	call   4b24 <mkdir>
+    1e30:	83 c4 10             	add    $0x10,%esp
+    1e33:	85 c0                	test   %eax,%eax
+    1e35:	0f 84 0f 03 00 00    	je     214a <subdir+0x652>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    exit();
+  }
+  if(mkdir("dd/dd/ffff") == 0){
+    1e3b:	83 ec 0c             	sub    $0xc,%esp
+    1e3e:	68 4a 57 00 00       	push   $0x574a
+    1e43:	e8 dc 2c 00 00       	call   4b24 <mkdir>
+    1e48:	83 c4 10             	add    $0x10,%esp
+    1e4b:	85 c0                	test   %eax,%eax
+    1e4d:	0f 84 0b 03 00 00    	je     215e <subdir+0x666>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    exit();
+  }
+  if(unlink("dd/xx/ff") == 0){
+    1e53:	83 ec 0c             	sub    $0xc,%esp
+    1e56:	68 23 58 00 00       	push   $0x5823
+    1e5b:	e8 ac 2c 00 00       	call   4b0c <unlink>
+    1e60:	83 c4 10             	add    $0x10,%esp
+    1e63:	85 c0                	test   %eax,%eax
+    1e65:	0f 84 07 03 00 00    	je     2172 <subdir+0x67a>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    exit();
+  }
+  if(unlink("dd/ff/ff") == 0){
+    1e6b:	83 ec 0c             	sub    $0xc,%esp
+    1e6e:	68 fe 57 00 00       	push   $0x57fe
+    1e73:	e8 94 2c 00 00       	call   4b0c <unlink>
+    1e78:	83 c4 10             	add    $0x10,%esp
+    1e7b:	85 c0                	test   %eax,%eax
+    1e7d:	0f 84 03 03 00 00    	je     2186 <subdir+0x68e>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    exit();
+  }
+  if(chdir("dd/ff") == 0){
+    1e83:	83 ec 0c             	sub    $0xc,%esp
+    1e86:	68 e9 56 00 00       	push   $0x56e9
+    1e8b:	e8 9c 2c 00 00       	call   4b2c <chdir>
+    1e90:	83 c4 10             	add    $0x10,%esp
+    1e93:	85 c0                	test   %eax,%eax
+    1e95:	0f 84 ff 02 00 00    	je     219a <subdir+0x6a2>
+    printf(1, "chdir dd/ff succeeded!\n");
+    exit();
+  }
+  if(chdir("dd/xx") == 0){
+    1e9b:	83 ec 0c             	sub    $0xc,%esp
+    1e9e:	68 95 58 00 00       	push   $0x5895
+    1ea3:	e8 84 2c 00 00       	call   4b2c <chdir>
+    1ea8:	83 c4 10             	add    $0x10,%esp
+    1eab:	85 c0                	test   %eax,%eax
+    1ead:	0f 84 fb 02 00 00    	je     21ae <subdir+0x6b6>
+    printf(1, "chdir dd/xx succeeded!\n");
+    exit();
+  }
+
+  if(unlink("dd/dd/ffff") != 0){
+    1eb3:	83 ec 0c             	sub    $0xc,%esp
+    1eb6:	68 4a 57 00 00       	push   $0x574a
+    1ebb:	e8 4c 2c 00 00       	call   4b0c <unlink>
+    1ec0:	83 c4 10             	add    $0x10,%esp
+    1ec3:	85 c0                	test   %eax,%eax
+    1ec5:	0f 85 f7 02 00 00    	jne    21c2 <subdir+0x6ca>
+    printf(1, "unlink dd/dd/ff failed\n");
+    exit();
+  }
+  if(unlink("dd/ff") != 0){
+    1ecb:	83 ec 0c             	sub    $0xc,%esp
+    1ece:	68 e9 56 00 00       	push   $0x56e9
+    1ed3:	e8 34 2c 00 00       	call   4b0c <unlink>
+    1ed8:	83 c4 10             	add    $0x10,%esp
+    1edb:	85 c0                	test   %eax,%eax
+    1edd:	0f 85 f3 02 00 00    	jne    21d6 <subdir+0x6de>
+    printf(1, "unlink dd/ff failed\n");
+    exit();
+  }
+  if(unlink("dd") == 0){
+    1ee3:	83 ec 0c             	sub    $0xc,%esp
+    1ee6:	68 b0 57 00 00       	push   $0x57b0
+    1eeb:	e8 1c 2c 00 00       	call   4b0c <unlink>
+    1ef0:	83 c4 10             	add    $0x10,%esp
+    1ef3:	85 c0                	test   %eax,%eax
+    1ef5:	0f 84 ef 02 00 00    	je     21ea <subdir+0x6f2>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    exit();
+  }
+  if(unlink("dd/dd") < 0){
+    1efb:	83 ec 0c             	sub    $0xc,%esp
+    1efe:	68 c5 56 00 00       	push   $0x56c5
+    1f03:	e8 04 2c 00 00       	call   4b0c <unlink>
+    1f08:	83 c4 10             	add    $0x10,%esp
+    1f0b:	85 c0                	test   %eax,%eax
+    1f0d:	0f 88 eb 02 00 00    	js     21fe <subdir+0x706>
+    printf(1, "unlink dd/dd failed\n");
+    exit();
+  }
+  if(unlink("dd") < 0){
+    1f13:	83 ec 0c             	sub    $0xc,%esp
+    1f16:	68 b0 57 00 00       	push   $0x57b0
+    1f1b:	e8 ec 2b 00 00       	call   4b0c <unlink>
+    1f20:	83 c4 10             	add    $0x10,%esp
+    1f23:	85 c0                	test   %eax,%eax
+    1f25:	0f 88 e7 02 00 00    	js     2212 <subdir+0x71a>
+    printf(1, "unlink dd failed\n");
+    exit();
+  }
+
+  printf(1, "subdir ok\n");
+    1f2b:	83 ec 08             	sub    $0x8,%esp
+    1f2e:	68 92 59 00 00       	push   $0x5992
+    1f33:	6a 01                	push   $0x1
+    1f35:	e8 59 2d 00 00       	call   4c93 <printf>
+}
+    1f3a:	83 c4 10             	add    $0x10,%esp
+    1f3d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1f40:	c9                   	leave
+    1f41:	c3                   	ret
+    printf(1, "subdir mkdir dd failed\n");
+    1f42:	83 ec 08             	sub    $0x8,%esp
+    1f45:	68 97 56 00 00       	push   $0x5697
+    1f4a:	6a 01                	push   $0x1
+    1f4c:	e8 42 2d 00 00       	call   4c93 <printf>
+    exit();
+    1f51:	e8 66 2b 00 00       	call   4abc <exit>
+    printf(1, "create dd/ff failed\n");
+    1f56:	83 ec 08             	sub    $0x8,%esp
+    1f59:	68 af 56 00 00       	push   $0x56af
+    1f5e:	6a 01                	push   $0x1
+    1f60:	e8 2e 2d 00 00       	call   4c93 <printf>
+    exit();
+    1f65:	e8 52 2b 00 00       	call   4abc <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    1f6a:	83 ec 08             	sub    $0x8,%esp
+    1f6d:	68 4c 66 00 00       	push   $0x664c
+    1f72:	6a 01                	push   $0x1
+    1f74:	e8 1a 2d 00 00       	call   4c93 <printf>
+    exit();
+    1f79:	e8 3e 2b 00 00       	call   4abc <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    1f7e:	83 ec 08             	sub    $0x8,%esp
+    1f81:	68 cb 56 00 00       	push   $0x56cb
+    1f86:	6a 01                	push   $0x1
+    1f88:	e8 06 2d 00 00       	call   4c93 <printf>
+    exit();
+    1f8d:	e8 2a 2b 00 00       	call   4abc <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    1f92:	83 ec 08             	sub    $0x8,%esp
+    1f95:	68 ef 56 00 00       	push   $0x56ef
+    1f9a:	6a 01                	push   $0x1
+    1f9c:	e8 f2 2c 00 00       	call   4c93 <printf>
+    exit();
+    1fa1:	e8 16 2b 00 00       	call   4abc <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    1fa6:	83 ec 08             	sub    $0x8,%esp
+    1fa9:	68 16 57 00 00       	push   $0x5716
+    1fae:	6a 01                	push   $0x1
+    1fb0:	e8 de 2c 00 00       	call   4c93 <printf>
+    exit();
+    1fb5:	e8 02 2b 00 00       	call   4abc <exit>
+    printf(1, "dd/dd/../ff wrong content\n");
+    1fba:	83 ec 08             	sub    $0x8,%esp
+    1fbd:	68 2f 57 00 00       	push   $0x572f
+    1fc2:	6a 01                	push   $0x1
+    1fc4:	e8 ca 2c 00 00       	call   4c93 <printf>
+    exit();
+    1fc9:	e8 ee 2a 00 00       	call   4abc <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    1fce:	83 ec 08             	sub    $0x8,%esp
+    1fd1:	68 74 66 00 00       	push   $0x6674
+    1fd6:	6a 01                	push   $0x1
+    1fd8:	e8 b6 2c 00 00       	call   4c93 <printf>
+    exit();
+    1fdd:	e8 da 2a 00 00       	call   4abc <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    1fe2:	83 ec 08             	sub    $0x8,%esp
+    1fe5:	68 55 57 00 00       	push   $0x5755
+    1fea:	6a 01                	push   $0x1
+    1fec:	e8 a2 2c 00 00       	call   4c93 <printf>
+    exit();
+    1ff1:	e8 c6 2a 00 00       	call   4abc <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    1ff6:	83 ec 08             	sub    $0x8,%esp
+    1ff9:	68 98 66 00 00       	push   $0x6698
+    1ffe:	6a 01                	push   $0x1
+    2000:	e8 8e 2c 00 00       	call   4c93 <printf>
+    exit();
+    2005:	e8 b2 2a 00 00       	call   4abc <exit>
+    printf(1, "chdir dd failed\n");
+    200a:	83 ec 08             	sub    $0x8,%esp
+    200d:	68 6d 57 00 00       	push   $0x576d
+    2012:	6a 01                	push   $0x1
+    2014:	e8 7a 2c 00 00       	call   4c93 <printf>
+    exit();
+    2019:	e8 9e 2a 00 00       	call   4abc <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    201e:	83 ec 08             	sub    $0x8,%esp
+    2021:	68 8a 57 00 00       	push   $0x578a
+    2026:	6a 01                	push   $0x1
+    2028:	e8 66 2c 00 00       	call   4c93 <printf>
+    exit();
+    202d:	e8 8a 2a 00 00       	call   4abc <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    2032:	83 ec 08             	sub    $0x8,%esp
+    2035:	68 8a 57 00 00       	push   $0x578a
+    203a:	6a 01                	push   $0x1
+    203c:	e8 52 2c 00 00       	call   4c93 <printf>
+    exit();
+    2041:	e8 76 2a 00 00       	call   4abc <exit>
+    printf(1, "chdir ./.. failed\n");
+    2046:	83 ec 08             	sub    $0x8,%esp
+    2049:	68 b8 57 00 00       	push   $0x57b8
+    204e:	6a 01                	push   $0x1
+    2050:	e8 3e 2c 00 00       	call   4c93 <printf>
+    exit();
+    2055:	e8 62 2a 00 00       	call   4abc <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    205a:	83 ec 08             	sub    $0x8,%esp
+    205d:	68 cb 57 00 00       	push   $0x57cb
+    2062:	6a 01                	push   $0x1
+    2064:	e8 2a 2c 00 00       	call   4c93 <printf>
+    exit();
+    2069:	e8 4e 2a 00 00       	call   4abc <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    206e:	83 ec 08             	sub    $0x8,%esp
+    2071:	68 e3 57 00 00       	push   $0x57e3
+    2076:	6a 01                	push   $0x1
+    2078:	e8 16 2c 00 00       	call   4c93 <printf>
+    exit();
+    207d:	e8 3a 2a 00 00       	call   4abc <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    2082:	83 ec 08             	sub    $0x8,%esp
+    2085:	68 bc 66 00 00       	push   $0x66bc
+    208a:	6a 01                	push   $0x1
+    208c:	e8 02 2c 00 00       	call   4c93 <printf>
+    exit();
+    2091:	e8 26 2a 00 00       	call   4abc <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    2096:	83 ec 08             	sub    $0x8,%esp
+    2099:	68 07 58 00 00       	push   $0x5807
+    209e:	6a 01                	push   $0x1
+    20a0:	e8 ee 2b 00 00       	call   4c93 <printf>
+    exit();
+    20a5:	e8 12 2a 00 00       	call   4abc <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    20aa:	83 ec 08             	sub    $0x8,%esp
+    20ad:	68 2c 58 00 00       	push   $0x582c
+    20b2:	6a 01                	push   $0x1
+    20b4:	e8 da 2b 00 00       	call   4c93 <printf>
+    exit();
+    20b9:	e8 fe 29 00 00       	call   4abc <exit>
+    printf(1, "create dd succeeded!\n");
+    20be:	83 ec 08             	sub    $0x8,%esp
+    20c1:	68 48 58 00 00       	push   $0x5848
+    20c6:	6a 01                	push   $0x1
+    20c8:	e8 c6 2b 00 00       	call   4c93 <printf>
+    exit();
+    20cd:	e8 ea 29 00 00       	call   4abc <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    20d2:	83 ec 08             	sub    $0x8,%esp
+    20d5:	68 5e 58 00 00       	push   $0x585e
+    20da:	6a 01                	push   $0x1
+    20dc:	e8 b2 2b 00 00       	call   4c93 <printf>
+    exit();
+    20e1:	e8 d6 29 00 00       	call   4abc <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    20e6:	83 ec 08             	sub    $0x8,%esp
+    20e9:	68 77 58 00 00       	push   $0x5877
+    20ee:	6a 01                	push   $0x1
+    20f0:	e8 9e 2b 00 00       	call   4c93 <printf>
+    exit();
+    20f5:	e8 c2 29 00 00       	call   4abc <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    20fa:	83 ec 08             	sub    $0x8,%esp
+    20fd:	68 e4 66 00 00       	push   $0x66e4
+    2102:	6a 01                	push   $0x1
+    2104:	e8 8a 2b 00 00       	call   4c93 <printf>
+    exit();
+    2109:	e8 ae 29 00 00       	call   4abc <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    210e:	83 ec 08             	sub    $0x8,%esp
+    2111:	68 08 67 00 00       	push   $0x6708
+    2116:	6a 01                	push   $0x1
+    2118:	e8 76 2b 00 00       	call   4c93 <printf>
+    exit();
+    211d:	e8 9a 29 00 00       	call   4abc <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    2122:	83 ec 08             	sub    $0x8,%esp
+    2125:	68 2c 67 00 00       	push   $0x672c
+    212a:	6a 01                	push   $0x1
+    212c:	e8 62 2b 00 00       	call   4c93 <printf>
+    exit();
+    2131:	e8 86 29 00 00       	call   4abc <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    2136:	83 ec 08             	sub    $0x8,%esp
+    2139:	68 9b 58 00 00       	push   $0x589b
+    213e:	6a 01                	push   $0x1
+    2140:	e8 4e 2b 00 00       	call   4c93 <printf>
+    exit();
+    2145:	e8 72 29 00 00       	call   4abc <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    214a:	83 ec 08             	sub    $0x8,%esp
+    214d:	68 b6 58 00 00       	push   $0x58b6
+    2152:	6a 01                	push   $0x1
+    2154:	e8 3a 2b 00 00       	call   4c93 <printf>
+    exit();
+    2159:	e8 5e 29 00 00       	call   4abc <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    215e:	83 ec 08             	sub    $0x8,%esp
+    2161:	68 d1 58 00 00       	push   $0x58d1
+    2166:	6a 01                	push   $0x1
+    2168:	e8 26 2b 00 00       	call   4c93 <printf>
+    exit();
+    216d:	e8 4a 29 00 00       	call   4abc <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    2172:	83 ec 08             	sub    $0x8,%esp
+    2175:	68 ee 58 00 00       	push   $0x58ee
+    217a:	6a 01                	push   $0x1
+    217c:	e8 12 2b 00 00       	call   4c93 <printf>
+    exit();
+    2181:	e8 36 29 00 00       	call   4abc <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    2186:	83 ec 08             	sub    $0x8,%esp
+    2189:	68 0a 59 00 00       	push   $0x590a
+    218e:	6a 01                	push   $0x1
+    2190:	e8 fe 2a 00 00       	call   4c93 <printf>
+    exit();
+    2195:	e8 22 29 00 00       	call   4abc <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    219a:	83 ec 08             	sub    $0x8,%esp
+    219d:	68 26 59 00 00       	push   $0x5926
+    21a2:	6a 01                	push   $0x1
+    21a4:	e8 ea 2a 00 00       	call   4c93 <printf>
+    exit();
+    21a9:	e8 0e 29 00 00       	call   4abc <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    21ae:	83 ec 08             	sub    $0x8,%esp
+    21b1:	68 3e 59 00 00       	push   $0x593e
+    21b6:	6a 01                	push   $0x1
+    21b8:	e8 d6 2a 00 00       	call   4c93 <printf>
+    exit();
+    21bd:	e8 fa 28 00 00       	call   4abc <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    21c2:	83 ec 08             	sub    $0x8,%esp
+    21c5:	68 55 57 00 00       	push   $0x5755
+    21ca:	6a 01                	push   $0x1
+    21cc:	e8 c2 2a 00 00       	call   4c93 <printf>
+    exit();
+    21d1:	e8 e6 28 00 00       	call   4abc <exit>
+    printf(1, "unlink dd/ff failed\n");
+    21d6:	83 ec 08             	sub    $0x8,%esp
+    21d9:	68 56 59 00 00       	push   $0x5956
+    21de:	6a 01                	push   $0x1
+    21e0:	e8 ae 2a 00 00       	call   4c93 <printf>
+    exit();
+    21e5:	e8 d2 28 00 00       	call   4abc <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    21ea:	83 ec 08             	sub    $0x8,%esp
+    21ed:	68 50 67 00 00       	push   $0x6750
+    21f2:	6a 01                	push   $0x1
+    21f4:	e8 9a 2a 00 00       	call   4c93 <printf>
+    exit();
+    21f9:	e8 be 28 00 00       	call   4abc <exit>
+    printf(1, "unlink dd/dd failed\n");
+    21fe:	83 ec 08             	sub    $0x8,%esp
+    2201:	68 6b 59 00 00       	push   $0x596b
+    2206:	6a 01                	push   $0x1
+    2208:	e8 86 2a 00 00       	call   4c93 <printf>
+    exit();
+    220d:	e8 aa 28 00 00       	call   4abc <exit>
+    printf(1, "unlink dd failed\n");
+    2212:	83 ec 08             	sub    $0x8,%esp
+    2215:	68 80 59 00 00       	push   $0x5980
+    221a:	6a 01                	push   $0x1
+    221c:	e8 72 2a 00 00       	call   4c93 <printf>
+    exit();
+    2221:	e8 96 28 00 00       	call   4abc <exit>
+
+00002226 <bigwrite>:
+
+// test writes that are larger than the log.
+void
+bigwrite(void)
+{
+    2226:	55                   	push   %ebp
+    2227:	89 e5                	mov    %esp,%ebp
+    2229:	57                   	push   %edi
+    222a:	56                   	push   %esi
+    222b:	53                   	push   %ebx
+    222c:	83 ec 14             	sub    $0x14,%esp
+  int fd, sz;
+
+  printf(1, "bigwrite test\n");
+    222f:	68 9d 59 00 00       	push   $0x599d
+    2234:	6a 01                	push   $0x1
+    2236:	e8 58 2a 00 00       	call   4c93 <printf>
+
+  unlink("bigwrite");
+    223b:	c7 04 24 ac 59 00 00 	movl   $0x59ac,(%esp)
+    2242:	e8 c5 28 00 00       	call   4b0c <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    2247:	83 c4 10             	add    $0x10,%esp
+    224a:	be f3 01 00 00       	mov    $0x1f3,%esi
+    224f:	eb 45                	jmp    2296 <bigwrite+0x70>
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    if(fd < 0){
+      printf(1, "cannot create bigwrite\n");
+    2251:	83 ec 08             	sub    $0x8,%esp
+    2254:	68 b5 59 00 00       	push   $0x59b5
+    2259:	6a 01                	push   $0x1
+    225b:	e8 33 2a 00 00       	call   4c93 <printf>
+      exit();
+    2260:	e8 57 28 00 00       	call   4abc <exit>
+    }
+    int i;
+    for(i = 0; i < 2; i++){
+      int cc = write(fd, buf, sz);
+      if(cc != sz){
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    2265:	50                   	push   %eax
+    2266:	56                   	push   %esi
+    2267:	68 cd 59 00 00       	push   $0x59cd
+    226c:	6a 01                	push   $0x1
+    226e:	e8 20 2a 00 00       	call   4c93 <printf>
+        exit();
+    2273:	e8 44 28 00 00       	call   4abc <exit>
+      }
+    }
+    close(fd);
+    2278:	83 ec 0c             	sub    $0xc,%esp
+    227b:	57                   	push   %edi
+    227c:	e8 63 28 00 00       	call   4ae4 <close>
+    unlink("bigwrite");
+    2281:	c7 04 24 ac 59 00 00 	movl   $0x59ac,(%esp)
+    2288:	e8 7f 28 00 00       	call   4b0c <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    228d:	81 c6 d7 01 00 00    	add    $0x1d7,%esi
+    2293:	83 c4 10             	add    $0x10,%esp
+    2296:	81 fe ff 17 00 00    	cmp    $0x17ff,%esi
+    229c:	7f 40                	jg     22de <bigwrite+0xb8>
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    229e:	83 ec 08             	sub    $0x8,%esp
+    22a1:	68 02 02 00 00       	push   $0x202
+    22a6:	68 ac 59 00 00       	push   $0x59ac
+    22ab:	e8 4c 28 00 00       	call   4afc <open>
+    22b0:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    22b2:	83 c4 10             	add    $0x10,%esp
+    22b5:	85 c0                	test   %eax,%eax
+    22b7:	78 98                	js     2251 <bigwrite+0x2b>
+    for(i = 0; i < 2; i++){
+    22b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+    22be:	83 fb 01             	cmp    $0x1,%ebx
+    22c1:	7f b5                	jg     2278 <bigwrite+0x52>
+      int cc = write(fd, buf, sz);
+    22c3:	83 ec 04             	sub    $0x4,%esp
+    22c6:	56                   	push   %esi
+    22c7:	68 a0 cf 00 00       	push   $0xcfa0
+    22cc:	57                   	push   %edi
+    22cd:	e8 0a 28 00 00       	call   4adc <write>
+      if(cc != sz){
+    22d2:	83 c4 10             	add    $0x10,%esp
+    22d5:	39 c6                	cmp    %eax,%esi
+    22d7:	75 8c                	jne    2265 <bigwrite+0x3f>
+    for(i = 0; i < 2; i++){
+    22d9:	83 c3 01             	add    $0x1,%ebx
+    22dc:	eb e0                	jmp    22be <bigwrite+0x98>
+  }
+
+  printf(1, "bigwrite ok\n");
+    22de:	83 ec 08             	sub    $0x8,%esp
+    22e1:	68 df 59 00 00       	push   $0x59df
+    22e6:	6a 01                	push   $0x1
+    22e8:	e8 a6 29 00 00       	call   4c93 <printf>
+}
+    22ed:	83 c4 10             	add    $0x10,%esp
+    22f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    22f3:	5b                   	pop    %ebx
+    22f4:	5e                   	pop    %esi
+    22f5:	5f                   	pop    %edi
+    22f6:	5d                   	pop    %ebp
+    22f7:	c3                   	ret
+
+000022f8 <bigfile>:
+
+void
+bigfile(void)
+{
+    22f8:	55                   	push   %ebp
+    22f9:	89 e5                	mov    %esp,%ebp
+    22fb:	57                   	push   %edi
+    22fc:	56                   	push   %esi
+    22fd:	53                   	push   %ebx
+    22fe:	83 ec 14             	sub    $0x14,%esp
+  int fd, i, total, cc;
+
+  printf(1, "bigfile test\n");
+    2301:	68 ec 59 00 00       	push   $0x59ec
+    2306:	6a 01                	push   $0x1
+    2308:	e8 86 29 00 00       	call   4c93 <printf>
+
+  unlink("bigfile");
+    230d:	c7 04 24 08 5a 00 00 	movl   $0x5a08,(%esp)
+    2314:	e8 f3 27 00 00       	call   4b0c <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    2319:	83 c4 08             	add    $0x8,%esp
+    231c:	68 02 02 00 00       	push   $0x202
+    2321:	68 08 5a 00 00       	push   $0x5a08
+    2326:	e8 d1 27 00 00       	call   4afc <open>
+  if(fd < 0){
+    232b:	83 c4 10             	add    $0x10,%esp
+    232e:	85 c0                	test   %eax,%eax
+    2330:	78 41                	js     2373 <bigfile+0x7b>
+    2332:	89 c6                	mov    %eax,%esi
+    printf(1, "cannot create bigfile");
+    exit();
+  }
+  for(i = 0; i < 20; i++){
+    2334:	bb 00 00 00 00       	mov    $0x0,%ebx
+    2339:	83 fb 13             	cmp    $0x13,%ebx
+    233c:	7f 5d                	jg     239b <bigfile+0xa3>
+    memset(buf, i, 600);
+    233e:	83 ec 04             	sub    $0x4,%esp
+    2341:	68 58 02 00 00       	push   $0x258
+    2346:	53                   	push   %ebx
+    2347:	68 a0 cf 00 00       	push   $0xcfa0
+    234c:	e8 30 26 00 00       	call   4981 <memset>
+    if(write(fd, buf, 600) != 600){
+    2351:	83 c4 0c             	add    $0xc,%esp
+    2354:	68 58 02 00 00       	push   $0x258
+    2359:	68 a0 cf 00 00       	push   $0xcfa0
+    235e:	56                   	push   %esi
+    235f:	e8 78 27 00 00       	call   4adc <write>
+    2364:	83 c4 10             	add    $0x10,%esp
+    2367:	3d 58 02 00 00       	cmp    $0x258,%eax
+    236c:	75 19                	jne    2387 <bigfile+0x8f>
+  for(i = 0; i < 20; i++){
+    236e:	83 c3 01             	add    $0x1,%ebx
+    2371:	eb c6                	jmp    2339 <bigfile+0x41>
+    printf(1, "cannot create bigfile");
+    2373:	83 ec 08             	sub    $0x8,%esp
+    2376:	68 fa 59 00 00       	push   $0x59fa
+    237b:	6a 01                	push   $0x1
+    237d:	e8 11 29 00 00       	call   4c93 <printf>
+    exit();
+    2382:	e8 35 27 00 00       	call   4abc <exit>
+      printf(1, "write bigfile failed\n");
+    2387:	83 ec 08             	sub    $0x8,%esp
+    238a:	68 10 5a 00 00       	push   $0x5a10
+    238f:	6a 01                	push   $0x1
+    2391:	e8 fd 28 00 00       	call   4c93 <printf>
+      exit();
+    2396:	e8 21 27 00 00       	call   4abc <exit>
+    }
+  }
+  close(fd);
+    239b:	83 ec 0c             	sub    $0xc,%esp
+    239e:	56                   	push   %esi
+    239f:	e8 40 27 00 00       	call   4ae4 <close>
+
+  fd = open("bigfile", 0);
+    23a4:	83 c4 08             	add    $0x8,%esp
+    23a7:	6a 00                	push   $0x0
+    23a9:	68 08 5a 00 00       	push   $0x5a08
+    23ae:	e8 49 27 00 00       	call   4afc <open>
+    23b3:	89 c7                	mov    %eax,%edi
+  if(fd < 0){
+    23b5:	83 c4 10             	add    $0x10,%esp
+    23b8:	85 c0                	test   %eax,%eax
+    23ba:	78 53                	js     240f <bigfile+0x117>
+    printf(1, "cannot open bigfile\n");
+    exit();
+  }
+  total = 0;
+    23bc:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; ; i++){
+    23c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(fd, buf, 300);
+    23c6:	83 ec 04             	sub    $0x4,%esp
+    23c9:	68 2c 01 00 00       	push   $0x12c
+    23ce:	68 a0 cf 00 00       	push   $0xcfa0
+    23d3:	57                   	push   %edi
+    23d4:	e8 fb 26 00 00       	call   4ad4 <read>
+    if(cc < 0){
+    23d9:	83 c4 10             	add    $0x10,%esp
+    23dc:	85 c0                	test   %eax,%eax
+    23de:	78 43                	js     2423 <bigfile+0x12b>
+      printf(1, "read bigfile failed\n");
+      exit();
+    }
+    if(cc == 0)
+    23e0:	74 7d                	je     245f <bigfile+0x167>
+      break;
+    if(cc != 300){
+    23e2:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    23e7:	75 4e                	jne    2437 <bigfile+0x13f>
+      printf(1, "short read bigfile\n");
+      exit();
+    }
+    if(buf[0] != i/2 || buf[299] != i/2){
+    23e9:	0f be 0d a0 cf 00 00 	movsbl 0xcfa0,%ecx
+    23f0:	89 da                	mov    %ebx,%edx
+    23f2:	c1 ea 1f             	shr    $0x1f,%edx
+    23f5:	01 da                	add    %ebx,%edx
+    23f7:	d1 fa                	sar    %edx
+    23f9:	39 d1                	cmp    %edx,%ecx
+    23fb:	75 4e                	jne    244b <bigfile+0x153>
+    23fd:	0f be 0d cb d0 00 00 	movsbl 0xd0cb,%ecx
+    2404:	39 ca                	cmp    %ecx,%edx
+    2406:	75 43                	jne    244b <bigfile+0x153>
+      printf(1, "read bigfile wrong data\n");
+      exit();
+    }
+    total += cc;
+    2408:	01 c6                	add    %eax,%esi
+  for(i = 0; ; i++){
+    240a:	83 c3 01             	add    $0x1,%ebx
+    cc = read(fd, buf, 300);
+    240d:	eb b7                	jmp    23c6 <bigfile+0xce>
+    printf(1, "cannot open bigfile\n");
+    240f:	83 ec 08             	sub    $0x8,%esp
+    2412:	68 26 5a 00 00       	push   $0x5a26
+    2417:	6a 01                	push   $0x1
+    2419:	e8 75 28 00 00       	call   4c93 <printf>
+    exit();
+    241e:	e8 99 26 00 00       	call   4abc <exit>
+      printf(1, "read bigfile failed\n");
+    2423:	83 ec 08             	sub    $0x8,%esp
+    2426:	68 3b 5a 00 00       	push   $0x5a3b
+    242b:	6a 01                	push   $0x1
+    242d:	e8 61 28 00 00       	call   4c93 <printf>
+      exit();
+    2432:	e8 85 26 00 00       	call   4abc <exit>
+      printf(1, "short read bigfile\n");
+    2437:	83 ec 08             	sub    $0x8,%esp
+    243a:	68 50 5a 00 00       	push   $0x5a50
+    243f:	6a 01                	push   $0x1
+    2441:	e8 4d 28 00 00       	call   4c93 <printf>
+      exit();
+    2446:	e8 71 26 00 00       	call   4abc <exit>
+      printf(1, "read bigfile wrong data\n");
+    244b:	83 ec 08             	sub    $0x8,%esp
+    244e:	68 64 5a 00 00       	push   $0x5a64
+    2453:	6a 01                	push   $0x1
+    2455:	e8 39 28 00 00       	call   4c93 <printf>
+      exit();
+    245a:	e8 5d 26 00 00       	call   4abc <exit>
+  }
+  close(fd);
+    245f:	83 ec 0c             	sub    $0xc,%esp
+    2462:	57                   	push   %edi
+    2463:	e8 7c 26 00 00       	call   4ae4 <close>
+  if(total != 20*600){
+    2468:	83 c4 10             	add    $0x10,%esp
+    246b:	81 fe e0 2e 00 00    	cmp    $0x2ee0,%esi
+    2471:	75 27                	jne    249a <bigfile+0x1a2>
+    printf(1, "read bigfile wrong total\n");
+    exit();
+  }
+  unlink("bigfile");
+    2473:	83 ec 0c             	sub    $0xc,%esp
+    2476:	68 08 5a 00 00       	push   $0x5a08
+    247b:	e8 8c 26 00 00       	call   4b0c <unlink>
+
+  printf(1, "bigfile test ok\n");
+    2480:	83 c4 08             	add    $0x8,%esp
+    2483:	68 97 5a 00 00       	push   $0x5a97
+    2488:	6a 01                	push   $0x1
+    248a:	e8 04 28 00 00       	call   4c93 <printf>
+}
+    248f:	83 c4 10             	add    $0x10,%esp
+    2492:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2495:	5b                   	pop    %ebx
+    2496:	5e                   	pop    %esi
+    2497:	5f                   	pop    %edi
+    2498:	5d                   	pop    %ebp
+    2499:	c3                   	ret
+    printf(1, "read bigfile wrong total\n");
+    249a:	83 ec 08             	sub    $0x8,%esp
+    249d:	68 7d 5a 00 00       	push   $0x5a7d
+    24a2:	6a 01                	push   $0x1
+    24a4:	e8 ea 27 00 00       	call   4c93 <printf>
+    exit();
+    24a9:	e8 0e 26 00 00       	call   4abc <exit>
+
+000024ae <fourteen>:
+
+void
+fourteen(void)
+{
+    24ae:	55                   	push   %ebp
+    24af:	89 e5                	mov    %esp,%ebp
+    24b1:	83 ec 10             	sub    $0x10,%esp
+  int fd;
+
+  // DIRSIZ is 14.
+  printf(1, "fourteen test\n");
+    24b4:	68 a8 5a 00 00       	push   $0x5aa8
+    24b9:	6a 01                	push   $0x1
+    24bb:	e8 d3 27 00 00       	call   4c93 <printf>
+
+  if(mkdir("12345678901234") != 0){
+    24c0:	c7 04 24 e3 5a 00 00 	movl   $0x5ae3,(%esp)
+    24c7:	e8 58 26 00 00       	call   4b24 <mkdir>
+    24cc:	83 c4 10             	add    $0x10,%esp
+    24cf:	85 c0                	test   %eax,%eax
+    24d1:	0f 85 9c 00 00 00    	jne    2573 <fourteen+0xc5>
+    printf(1, "mkdir 12345678901234 failed\n");
+    exit();
+  }
+  if(mkdir("12345678901234/123456789012345") != 0){
+    24d7:	83 ec 0c             	sub    $0xc,%esp
+    24da:	68 70 67 00 00       	push   $0x6770
+    24df:	e8 40 26 00 00       	call   4b24 <mkdir>
+    24e4:	83 c4 10             	add    $0x10,%esp
+    24e7:	85 c0                	test   %eax,%eax
+    24e9:	0f 85 98 00 00 00    	jne    2587 <fourteen+0xd9>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    exit();
+  }
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    24ef:	83 ec 08             	sub    $0x8,%esp
+    24f2:	68 00 02 00 00       	push   $0x200
+    24f7:	68 c0 67 00 00       	push   $0x67c0
+    24fc:	e8 fb 25 00 00       	call   4afc <open>
+  if(fd < 0){
+    2501:	83 c4 10             	add    $0x10,%esp
+    2504:	85 c0                	test   %eax,%eax
+    2506:	0f 88 8f 00 00 00    	js     259b <fourteen+0xed>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    exit();
+  }
+  close(fd);
+    250c:	83 ec 0c             	sub    $0xc,%esp
+    250f:	50                   	push   %eax
+    2510:	e8 cf 25 00 00       	call   4ae4 <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    2515:	83 c4 08             	add    $0x8,%esp
+    2518:	6a 00                	push   $0x0
+    251a:	68 30 68 00 00       	push   $0x6830
+    251f:	e8 d8 25 00 00       	call   4afc <open>
+  if(fd < 0){
+    2524:	83 c4 10             	add    $0x10,%esp
+    2527:	85 c0                	test   %eax,%eax
+    2529:	0f 88 80 00 00 00    	js     25af <fourteen+0x101>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    exit();
+  }
+  close(fd);
+    252f:	83 ec 0c             	sub    $0xc,%esp
+    2532:	50                   	push   %eax
+    2533:	e8 ac 25 00 00       	call   4ae4 <close>
+
+  if(mkdir("12345678901234/12345678901234") == 0){
+    2538:	c7 04 24 d4 5a 00 00 	movl   $0x5ad4,(%esp)
+    253f:	e8 e0 25 00 00       	call   4b24 <mkdir>
+    2544:	83 c4 10             	add    $0x10,%esp
+    2547:	85 c0                	test   %eax,%eax
+    2549:	74 78                	je     25c3 <fourteen+0x115>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    exit();
+  }
+  if(mkdir("123456789012345/12345678901234") == 0){
+    254b:	83 ec 0c             	sub    $0xc,%esp
+    254e:	68 cc 68 00 00       	push   $0x68cc
+    2553:	e8 cc 25 00 00       	call   4b24 <mkdir>
+    2558:	83 c4 10             	add    $0x10,%esp
+    255b:	85 c0                	test   %eax,%eax
+    255d:	74 78                	je     25d7 <fourteen+0x129>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    exit();
+  }
+
+  printf(1, "fourteen ok\n");
+    255f:	83 ec 08             	sub    $0x8,%esp
+    2562:	68 f2 5a 00 00       	push   $0x5af2
+    2567:	6a 01                	push   $0x1
+    2569:	e8 25 27 00 00       	call   4c93 <printf>
+}
+    256e:	83 c4 10             	add    $0x10,%esp
+    2571:	c9                   	leave
+    2572:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    2573:	83 ec 08             	sub    $0x8,%esp
+    2576:	68 b7 5a 00 00       	push   $0x5ab7
+    257b:	6a 01                	push   $0x1
+    257d:	e8 11 27 00 00       	call   4c93 <printf>
+    exit();
+    2582:	e8 35 25 00 00       	call   4abc <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    2587:	83 ec 08             	sub    $0x8,%esp
+    258a:	68 90 67 00 00       	push   $0x6790
+    258f:	6a 01                	push   $0x1
+    2591:	e8 fd 26 00 00       	call   4c93 <printf>
+    exit();
+    2596:	e8 21 25 00 00       	call   4abc <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    259b:	83 ec 08             	sub    $0x8,%esp
+    259e:	68 f0 67 00 00       	push   $0x67f0
+    25a3:	6a 01                	push   $0x1
+    25a5:	e8 e9 26 00 00       	call   4c93 <printf>
+    exit();
+    25aa:	e8 0d 25 00 00       	call   4abc <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    25af:	83 ec 08             	sub    $0x8,%esp
+    25b2:	68 60 68 00 00       	push   $0x6860
+    25b7:	6a 01                	push   $0x1
+    25b9:	e8 d5 26 00 00       	call   4c93 <printf>
+    exit();
+    25be:	e8 f9 24 00 00       	call   4abc <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    25c3:	83 ec 08             	sub    $0x8,%esp
+    25c6:	68 9c 68 00 00       	push   $0x689c
+    25cb:	6a 01                	push   $0x1
+    25cd:	e8 c1 26 00 00       	call   4c93 <printf>
+    exit();
+    25d2:	e8 e5 24 00 00       	call   4abc <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    25d7:	83 ec 08             	sub    $0x8,%esp
+    25da:	68 ec 68 00 00       	push   $0x68ec
+    25df:	6a 01                	push   $0x1
+    25e1:	e8 ad 26 00 00       	call   4c93 <printf>
+    exit();
+    25e6:	e8 d1 24 00 00       	call   4abc <exit>
+
+000025eb <rmdot>:
+
+void
+rmdot(void)
+{
+    25eb:	55                   	push   %ebp
+    25ec:	89 e5                	mov    %esp,%ebp
+    25ee:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    25f1:	68 ff 5a 00 00       	push   $0x5aff
+    25f6:	6a 01                	push   $0x1
+    25f8:	e8 96 26 00 00       	call   4c93 <printf>
+  if(mkdir("dots") != 0){
+    25fd:	c7 04 24 0b 5b 00 00 	movl   $0x5b0b,(%esp)
+    2604:	e8 1b 25 00 00       	call   4b24 <mkdir>
+    2609:	83 c4 10             	add    $0x10,%esp
+    260c:	85 c0                	test   %eax,%eax
+    260e:	0f 85 bc 00 00 00    	jne    26d0 <rmdot+0xe5>
+    printf(1, "mkdir dots failed\n");
+    exit();
+  }
+  if(chdir("dots") != 0){
+    2614:	83 ec 0c             	sub    $0xc,%esp
+    2617:	68 0b 5b 00 00       	push   $0x5b0b
+    261c:	e8 0b 25 00 00       	call   4b2c <chdir>
+    2621:	83 c4 10             	add    $0x10,%esp
+    2624:	85 c0                	test   %eax,%eax
+    2626:	0f 85 b8 00 00 00    	jne    26e4 <rmdot+0xf9>
+    printf(1, "chdir dots failed\n");
+    exit();
+  }
+  if(unlink(".") == 0){
+    262c:	83 ec 0c             	sub    $0xc,%esp
+    262f:	68 b6 57 00 00       	push   $0x57b6
+    2634:	e8 d3 24 00 00       	call   4b0c <unlink>
+    2639:	83 c4 10             	add    $0x10,%esp
+    263c:	85 c0                	test   %eax,%eax
+    263e:	0f 84 b4 00 00 00    	je     26f8 <rmdot+0x10d>
+    printf(1, "rm . worked!\n");
+    exit();
+  }
+  if(unlink("..") == 0){
+    2644:	83 ec 0c             	sub    $0xc,%esp
+    2647:	68 b5 57 00 00       	push   $0x57b5
+    264c:	e8 bb 24 00 00       	call   4b0c <unlink>
+    2651:	83 c4 10             	add    $0x10,%esp
+    2654:	85 c0                	test   %eax,%eax
+    2656:	0f 84 b0 00 00 00    	je     270c <rmdot+0x121>
+    printf(1, "rm .. worked!\n");
+    exit();
+  }
+  if(chdir("/") != 0){
+    265c:	83 ec 0c             	sub    $0xc,%esp
+    265f:	68 89 4f 00 00       	push   $0x4f89
+    2664:	e8 c3 24 00 00       	call   4b2c <chdir>
+    2669:	83 c4 10             	add    $0x10,%esp
+    266c:	85 c0                	test   %eax,%eax
+    266e:	0f 85 ac 00 00 00    	jne    2720 <rmdot+0x135>
+    printf(1, "chdir / failed\n");
+    exit();
+  }
+  if(unlink("dots/.") == 0){
+    2674:	83 ec 0c             	sub    $0xc,%esp
+    2677:	68 53 5b 00 00       	push   $0x5b53
+    267c:	e8 8b 24 00 00       	call   4b0c <unlink>
+    2681:	83 c4 10             	add    $0x10,%esp
+    2684:	85 c0                	test   %eax,%eax
+    2686:	0f 84 a8 00 00 00    	je     2734 <rmdot+0x149>
+    printf(1, "unlink dots/. worked!\n");
+    exit();
+  }
+  if(unlink("dots/..") == 0){
+    268c:	83 ec 0c             	sub    $0xc,%esp
+    268f:	68 71 5b 00 00       	push   $0x5b71
+    2694:	e8 73 24 00 00       	call   4b0c <unlink>
+    2699:	83 c4 10             	add    $0x10,%esp
+    269c:	85 c0                	test   %eax,%eax
+    269e:	0f 84 a4 00 00 00    	je     2748 <rmdot+0x15d>
+    printf(1, "unlink dots/.. worked!\n");
+    exit();
+  }
+  if(unlink("dots") != 0){
+    26a4:	83 ec 0c             	sub    $0xc,%esp
+    26a7:	68 0b 5b 00 00       	push   $0x5b0b
+    26ac:	e8 5b 24 00 00       	call   4b0c <unlink>
+    26b1:	83 c4 10             	add    $0x10,%esp
+    26b4:	85 c0                	test   %eax,%eax
+    26b6:	0f 85 a0 00 00 00    	jne    275c <rmdot+0x171>
+    printf(1, "unlink dots failed!\n");
+    exit();
+  }
+  printf(1, "rmdot ok\n");
+    26bc:	83 ec 08             	sub    $0x8,%esp
+    26bf:	68 a6 5b 00 00       	push   $0x5ba6
+    26c4:	6a 01                	push   $0x1
+    26c6:	e8 c8 25 00 00       	call   4c93 <printf>
+}
+    26cb:	83 c4 10             	add    $0x10,%esp
+    26ce:	c9                   	leave
+    26cf:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    26d0:	83 ec 08             	sub    $0x8,%esp
+    26d3:	68 10 5b 00 00       	push   $0x5b10
+    26d8:	6a 01                	push   $0x1
+    26da:	e8 b4 25 00 00       	call   4c93 <printf>
+    exit();
+    26df:	e8 d8 23 00 00       	call   4abc <exit>
+    printf(1, "chdir dots failed\n");
+    26e4:	83 ec 08             	sub    $0x8,%esp
+    26e7:	68 23 5b 00 00       	push   $0x5b23
+    26ec:	6a 01                	push   $0x1
+    26ee:	e8 a0 25 00 00       	call   4c93 <printf>
+    exit();
+    26f3:	e8 c4 23 00 00       	call   4abc <exit>
+    printf(1, "rm . worked!\n");
+    26f8:	83 ec 08             	sub    $0x8,%esp
+    26fb:	68 36 5b 00 00       	push   $0x5b36
+    2700:	6a 01                	push   $0x1
+    2702:	e8 8c 25 00 00       	call   4c93 <printf>
+    exit();
+    2707:	e8 b0 23 00 00       	call   4abc <exit>
+    printf(1, "rm .. worked!\n");
+    270c:	83 ec 08             	sub    $0x8,%esp
+    270f:	68 44 5b 00 00       	push   $0x5b44
+    2714:	6a 01                	push   $0x1
+    2716:	e8 78 25 00 00       	call   4c93 <printf>
+    exit();
+    271b:	e8 9c 23 00 00       	call   4abc <exit>
+    printf(1, "chdir / failed\n");
+    2720:	83 ec 08             	sub    $0x8,%esp
+    2723:	68 8b 4f 00 00       	push   $0x4f8b
+    2728:	6a 01                	push   $0x1
+    272a:	e8 64 25 00 00       	call   4c93 <printf>
+    exit();
+    272f:	e8 88 23 00 00       	call   4abc <exit>
+    printf(1, "unlink dots/. worked!\n");
+    2734:	83 ec 08             	sub    $0x8,%esp
+    2737:	68 5a 5b 00 00       	push   $0x5b5a
+    273c:	6a 01                	push   $0x1
+    273e:	e8 50 25 00 00       	call   4c93 <printf>
+    exit();
+    2743:	e8 74 23 00 00       	call   4abc <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    2748:	83 ec 08             	sub    $0x8,%esp
+    274b:	68 79 5b 00 00       	push   $0x5b79
+    2750:	6a 01                	push   $0x1
+    2752:	e8 3c 25 00 00       	call   4c93 <printf>
+    exit();
+    2757:	e8 60 23 00 00       	call   4abc <exit>
+    printf(1, "unlink dots failed!\n");
+    275c:	83 ec 08             	sub    $0x8,%esp
+    275f:	68 91 5b 00 00       	push   $0x5b91
+    2764:	6a 01                	push   $0x1
+    2766:	e8 28 25 00 00       	call   4c93 <printf>
+    exit();
+    276b:	e8 4c 23 00 00       	call   4abc <exit>
+
+00002770 <dirfile>:
+
+void
+dirfile(void)
+{
+    2770:	55                   	push   %ebp
+    2771:	89 e5                	mov    %esp,%ebp
+    2773:	53                   	push   %ebx
+    2774:	83 ec 0c             	sub    $0xc,%esp
+  int fd;
+
+  printf(1, "dir vs file\n");
+    2777:	68 b0 5b 00 00       	push   $0x5bb0
+    277c:	6a 01                	push   $0x1
+    277e:	e8 10 25 00 00       	call   4c93 <printf>
+
+  fd = open("dirfile", O_CREATE);
+    2783:	83 c4 08             	add    $0x8,%esp
+    2786:	68 00 02 00 00       	push   $0x200
+    278b:	68 bd 5b 00 00       	push   $0x5bbd
+    2790:	e8 67 23 00 00       	call   4afc <open>
+  if(fd < 0){
+    2795:	83 c4 10             	add    $0x10,%esp
+    2798:	85 c0                	test   %eax,%eax
+    279a:	0f 88 22 01 00 00    	js     28c2 <dirfile+0x152>
+    printf(1, "create dirfile failed\n");
+    exit();
+  }
+  close(fd);
+    27a0:	83 ec 0c             	sub    $0xc,%esp
+    27a3:	50                   	push   %eax
+    27a4:	e8 3b 23 00 00       	call   4ae4 <close>
+  if(chdir("dirfile") == 0){
+    27a9:	c7 04 24 bd 5b 00 00 	movl   $0x5bbd,(%esp)
+    27b0:	e8 77 23 00 00       	call   4b2c <chdir>
+    27b5:	83 c4 10             	add    $0x10,%esp
+    27b8:	85 c0                	test   %eax,%eax
+    27ba:	0f 84 16 01 00 00    	je     28d6 <dirfile+0x166>
+    printf(1, "chdir dirfile succeeded!\n");
+    exit();
+  }
+  fd = open("dirfile/xx", 0);
+    27c0:	83 ec 08             	sub    $0x8,%esp
+    27c3:	6a 00                	push   $0x0
+    27c5:	68 f6 5b 00 00       	push   $0x5bf6
+    27ca:	e8 2d 23 00 00       	call   4afc <open>
+  if(fd >= 0){
+    27cf:	83 c4 10             	add    $0x10,%esp
+    27d2:	85 c0                	test   %eax,%eax
+    27d4:	0f 89 10 01 00 00    	jns    28ea <dirfile+0x17a>
+    printf(1, "create dirfile/xx succeeded!\n");
+    exit();
+  }
+  fd = open("dirfile/xx", O_CREATE);
+    27da:	83 ec 08             	sub    $0x8,%esp
+    27dd:	68 00 02 00 00       	push   $0x200
+    27e2:	68 f6 5b 00 00       	push   $0x5bf6
+    27e7:	e8 10 23 00 00       	call   4afc <open>
+  if(fd >= 0){
+    27ec:	83 c4 10             	add    $0x10,%esp
+    27ef:	85 c0                	test   %eax,%eax
+    27f1:	0f 89 07 01 00 00    	jns    28fe <dirfile+0x18e>
+    printf(1, "create dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(mkdir("dirfile/xx") == 0){
+    27f7:	83 ec 0c             	sub    $0xc,%esp
+    27fa:	68 f6 5b 00 00       	push   $0x5bf6
+    27ff:	e8 20 23 00 00       	call   4b24 <mkdir>
+    2804:	83 c4 10             	add    $0x10,%esp
+    2807:	85 c0                	test   %eax,%eax
+    2809:	0f 84 03 01 00 00    	je     2912 <dirfile+0x1a2>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(unlink("dirfile/xx") == 0){
+    280f:	83 ec 0c             	sub    $0xc,%esp
+    2812:	68 f6 5b 00 00       	push   $0x5bf6
+    2817:	e8 f0 22 00 00       	call   4b0c <unlink>
+    281c:	83 c4 10             	add    $0x10,%esp
+    281f:	85 c0                	test   %eax,%eax
+    2821:	0f 84 ff 00 00 00    	je     2926 <dirfile+0x1b6>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(link("README", "dirfile/xx") == 0){
+    2827:	83 ec 08             	sub    $0x8,%esp
+    282a:	68 f6 5b 00 00       	push   $0x5bf6
+    282f:	68 5a 5c 00 00       	push   $0x5c5a
+    2834:	e8 e3 22 00 00       	call   4b1c <link>
+    2839:	83 c4 10             	add    $0x10,%esp
+    283c:	85 c0                	test   %eax,%eax
+    283e:	0f 84 f6 00 00 00    	je     293a <dirfile+0x1ca>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(unlink("dirfile") != 0){
+    2844:	83 ec 0c             	sub    $0xc,%esp
+    2847:	68 bd 5b 00 00       	push   $0x5bbd
+    284c:	e8 bb 22 00 00       	call   4b0c <unlink>
+    2851:	83 c4 10             	add    $0x10,%esp
+    2854:	85 c0                	test   %eax,%eax
+    2856:	0f 85 f2 00 00 00    	jne    294e <dirfile+0x1de>
+    printf(1, "unlink dirfile failed!\n");
+    exit();
+  }
+
+  fd = open(".", O_RDWR);
+    285c:	83 ec 08             	sub    $0x8,%esp
+    285f:	6a 02                	push   $0x2
+    2861:	68 b6 57 00 00       	push   $0x57b6
+    2866:	e8 91 22 00 00       	call   4afc <open>
+  if(fd >= 0){
+    286b:	83 c4 10             	add    $0x10,%esp
+    286e:	85 c0                	test   %eax,%eax
+    2870:	0f 89 ec 00 00 00    	jns    2962 <dirfile+0x1f2>
+    printf(1, "open . for writing succeeded!\n");
+    exit();
+  }
+  fd = open(".", 0);
+    2876:	83 ec 08             	sub    $0x8,%esp
+    2879:	6a 00                	push   $0x0
+    287b:	68 b6 57 00 00       	push   $0x57b6
+    2880:	e8 77 22 00 00       	call   4afc <open>
+    2885:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    2887:	83 c4 0c             	add    $0xc,%esp
+    288a:	6a 01                	push   $0x1
+    288c:	68 99 58 00 00       	push   $0x5899
+    2891:	50                   	push   %eax
+    2892:	e8 45 22 00 00       	call   4adc <write>
+    2897:	83 c4 10             	add    $0x10,%esp
+    289a:	85 c0                	test   %eax,%eax
+    289c:	0f 8f d4 00 00 00    	jg     2976 <dirfile+0x206>
+    printf(1, "write . succeeded!\n");
+    exit();
+  }
+  close(fd);
+    28a2:	83 ec 0c             	sub    $0xc,%esp
+    28a5:	53                   	push   %ebx
+    28a6:	e8 39 22 00 00       	call   4ae4 <close>
+
+  printf(1, "dir vs file OK\n");
+    28ab:	83 c4 08             	add    $0x8,%esp
+    28ae:	68 8d 5c 00 00       	push   $0x5c8d
+    28b3:	6a 01                	push   $0x1
+    28b5:	e8 d9 23 00 00       	call   4c93 <printf>
+}
+    28ba:	83 c4 10             	add    $0x10,%esp
+    28bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    28c0:	c9                   	leave
+    28c1:	c3                   	ret
+    printf(1, "create dirfile failed\n");
+    28c2:	83 ec 08             	sub    $0x8,%esp
+    28c5:	68 c5 5b 00 00       	push   $0x5bc5
+    28ca:	6a 01                	push   $0x1
+    28cc:	e8 c2 23 00 00       	call   4c93 <printf>
+    exit();
+    28d1:	e8 e6 21 00 00       	call   4abc <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    28d6:	83 ec 08             	sub    $0x8,%esp
+    28d9:	68 dc 5b 00 00       	push   $0x5bdc
+    28de:	6a 01                	push   $0x1
+    28e0:	e8 ae 23 00 00       	call   4c93 <printf>
+    exit();
+    28e5:	e8 d2 21 00 00       	call   4abc <exit>
+    printf(1, "create dirfile/xx succeeded!\n");
+    28ea:	83 ec 08             	sub    $0x8,%esp
+    28ed:	68 01 5c 00 00       	push   $0x5c01
+    28f2:	6a 01                	push   $0x1
+    28f4:	e8 9a 23 00 00       	call   4c93 <printf>
+    exit();
+    28f9:	e8 be 21 00 00       	call   4abc <exit>
+    printf(1, "create dirfile/xx succeeded!\n");
+    28fe:	83 ec 08             	sub    $0x8,%esp
+    2901:	68 01 5c 00 00       	push   $0x5c01
+    2906:	6a 01                	push   $0x1
+    2908:	e8 86 23 00 00       	call   4c93 <printf>
+    exit();
+    290d:	e8 aa 21 00 00       	call   4abc <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    2912:	83 ec 08             	sub    $0x8,%esp
+    2915:	68 1f 5c 00 00       	push   $0x5c1f
+    291a:	6a 01                	push   $0x1
+    291c:	e8 72 23 00 00       	call   4c93 <printf>
+    exit();
+    2921:	e8 96 21 00 00       	call   4abc <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    2926:	83 ec 08             	sub    $0x8,%esp
+    2929:	68 3c 5c 00 00       	push   $0x5c3c
+    292e:	6a 01                	push   $0x1
+    2930:	e8 5e 23 00 00       	call   4c93 <printf>
+    exit();
+    2935:	e8 82 21 00 00       	call   4abc <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    293a:	83 ec 08             	sub    $0x8,%esp
+    293d:	68 20 69 00 00       	push   $0x6920
+    2942:	6a 01                	push   $0x1
+    2944:	e8 4a 23 00 00       	call   4c93 <printf>
+    exit();
+    2949:	e8 6e 21 00 00       	call   4abc <exit>
+    printf(1, "unlink dirfile failed!\n");
+    294e:	83 ec 08             	sub    $0x8,%esp
+    2951:	68 61 5c 00 00       	push   $0x5c61
+    2956:	6a 01                	push   $0x1
+    2958:	e8 36 23 00 00       	call   4c93 <printf>
+    exit();
+    295d:	e8 5a 21 00 00       	call   4abc <exit>
+    printf(1, "open . for writing succeeded!\n");
+    2962:	83 ec 08             	sub    $0x8,%esp
+    2965:	68 40 69 00 00       	push   $0x6940
+    296a:	6a 01                	push   $0x1
+    296c:	e8 22 23 00 00       	call   4c93 <printf>
+    exit();
+    2971:	e8 46 21 00 00       	call   4abc <exit>
+    printf(1, "write . succeeded!\n");
+    2976:	83 ec 08             	sub    $0x8,%esp
+    2979:	68 79 5c 00 00       	push   $0x5c79
+    297e:	6a 01                	push   $0x1
+    2980:	e8 0e 23 00 00       	call   4c93 <printf>
+    exit();
+    2985:	e8 32 21 00 00       	call   4abc <exit>
+
+0000298a <iref>:
+
+// test that iput() is called at the end of _namei()
+void
+iref(void)
+{
+    298a:	55                   	push   %ebp
+    298b:	89 e5                	mov    %esp,%ebp
+    298d:	53                   	push   %ebx
+    298e:	83 ec 0c             	sub    $0xc,%esp
+  int i, fd;
+
+  printf(1, "empty file name\n");
+    2991:	68 9d 5c 00 00       	push   $0x5c9d
+    2996:	6a 01                	push   $0x1
+    2998:	e8 f6 22 00 00       	call   4c93 <printf>
+
+  // the 50 is NINODE
+  for(i = 0; i < 50 + 1; i++){
+    299d:	83 c4 10             	add    $0x10,%esp
+    29a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    29a5:	eb 4c                	jmp    29f3 <iref+0x69>
+    if(mkdir("irefd") != 0){
+      printf(1, "mkdir irefd failed\n");
+    29a7:	83 ec 08             	sub    $0x8,%esp
+    29aa:	68 b4 5c 00 00       	push   $0x5cb4
+    29af:	6a 01                	push   $0x1
+    29b1:	e8 dd 22 00 00       	call   4c93 <printf>
+      exit();
+    29b6:	e8 01 21 00 00       	call   4abc <exit>
+    }
+    if(chdir("irefd") != 0){
+      printf(1, "chdir irefd failed\n");
+    29bb:	83 ec 08             	sub    $0x8,%esp
+    29be:	68 c8 5c 00 00       	push   $0x5cc8
+    29c3:	6a 01                	push   $0x1
+    29c5:	e8 c9 22 00 00       	call   4c93 <printf>
+      exit();
+    29ca:	e8 ed 20 00 00       	call   4abc <exit>
+
+    mkdir("");
+    link("README", "");
+    fd = open("", O_CREATE);
+    if(fd >= 0)
+      close(fd);
+    29cf:	83 ec 0c             	sub    $0xc,%esp
+    29d2:	50                   	push   %eax
+    29d3:	e8 0c 21 00 00       	call   4ae4 <close>
+    29d8:	83 c4 10             	add    $0x10,%esp
+    29db:	e9 80 00 00 00       	jmp    2a60 <iref+0xd6>
+    fd = open("xx", O_CREATE);
+    if(fd >= 0)
+      close(fd);
+    unlink("xx");
+    29e0:	83 ec 0c             	sub    $0xc,%esp
+    29e3:	68 98 58 00 00       	push   $0x5898
+    29e8:	e8 1f 21 00 00       	call   4b0c <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    29ed:	83 c3 01             	add    $0x1,%ebx
+    29f0:	83 c4 10             	add    $0x10,%esp
+    29f3:	83 fb 32             	cmp    $0x32,%ebx
+    29f6:	0f 8f 92 00 00 00    	jg     2a8e <iref+0x104>
+    if(mkdir("irefd") != 0){
+    29fc:	83 ec 0c             	sub    $0xc,%esp
+    29ff:	68 ae 5c 00 00       	push   $0x5cae
+    2a04:	e8 1b 21 00 00       	call   4b24 <mkdir>
+    2a09:	83 c4 10             	add    $0x10,%esp
+    2a0c:	85 c0                	test   %eax,%eax
+    2a0e:	75 97                	jne    29a7 <iref+0x1d>
+    if(chdir("irefd") != 0){
+    2a10:	83 ec 0c             	sub    $0xc,%esp
+    2a13:	68 ae 5c 00 00       	push   $0x5cae
+    2a18:	e8 0f 21 00 00       	call   4b2c <chdir>
+    2a1d:	83 c4 10             	add    $0x10,%esp
+    2a20:	85 c0                	test   %eax,%eax
+    2a22:	75 97                	jne    29bb <iref+0x31>
+    mkdir("");
+    2a24:	83 ec 0c             	sub    $0xc,%esp
+    2a27:	68 63 53 00 00       	push   $0x5363
+    2a2c:	e8 f3 20 00 00       	call   4b24 <mkdir>
+    link("README", "");
+    2a31:	83 c4 08             	add    $0x8,%esp
+    2a34:	68 63 53 00 00       	push   $0x5363
+    2a39:	68 5a 5c 00 00       	push   $0x5c5a
+    2a3e:	e8 d9 20 00 00       	call   4b1c <link>
+    fd = open("", O_CREATE);
+    2a43:	83 c4 08             	add    $0x8,%esp
+    2a46:	68 00 02 00 00       	push   $0x200
+    2a4b:	68 63 53 00 00       	push   $0x5363
+    2a50:	e8 a7 20 00 00       	call   4afc <open>
+    if(fd >= 0)
+    2a55:	83 c4 10             	add    $0x10,%esp
+    2a58:	85 c0                	test   %eax,%eax
+    2a5a:	0f 89 6f ff ff ff    	jns    29cf <iref+0x45>
+    fd = open("xx", O_CREATE);
+    2a60:	83 ec 08             	sub    $0x8,%esp
+    2a63:	68 00 02 00 00       	push   $0x200
+    2a68:	68 98 58 00 00       	push   $0x5898
+    2a6d:	e8 8a 20 00 00       	call   4afc <open>
+    if(fd >= 0)
+    2a72:	83 c4 10             	add    $0x10,%esp
+    2a75:	85 c0                	test   %eax,%eax
+    2a77:	0f 88 63 ff ff ff    	js     29e0 <iref+0x56>
+      close(fd);
+    2a7d:	83 ec 0c             	sub    $0xc,%esp
+    2a80:	50                   	push   %eax
+    2a81:	e8 5e 20 00 00       	call   4ae4 <close>
+    2a86:	83 c4 10             	add    $0x10,%esp
+    2a89:	e9 52 ff ff ff       	jmp    29e0 <iref+0x56>
+  }
+
+  chdir("/");
+    2a8e:	83 ec 0c             	sub    $0xc,%esp
+    2a91:	68 89 4f 00 00       	push   $0x4f89
+    2a96:	e8 91 20 00 00       	call   4b2c <chdir>
+  printf(1, "empty file name OK\n");
+    2a9b:	83 c4 08             	add    $0x8,%esp
+    2a9e:	68 dc 5c 00 00       	push   $0x5cdc
+    2aa3:	6a 01                	push   $0x1
+    2aa5:	e8 e9 21 00 00       	call   4c93 <printf>
+}
+    2aaa:	83 c4 10             	add    $0x10,%esp
+    2aad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2ab0:	c9                   	leave
+    2ab1:	c3                   	ret
+
+00002ab2 <forktest>:
+// test that fork fails gracefully
+// the forktest binary also does this, but it runs out of proc entries first.
+// inside the bigger usertests binary, we run out of memory first.
+void
+forktest(void)
+{
+    2ab2:	55                   	push   %ebp
+    2ab3:	89 e5                	mov    %esp,%ebp
+    2ab5:	53                   	push   %ebx
+    2ab6:	83 ec 0c             	sub    $0xc,%esp
+  int n, pid;
+
+  printf(1, "fork test\n");
+    2ab9:	68 ca 5d 00 00       	push   $0x5dca
+    2abe:	6a 01                	push   $0x1
+    2ac0:	e8 ce 21 00 00       	call   4c93 <printf>
+
+  for(n=0; n<1000; n++){
+    2ac5:	83 c4 10             	add    $0x10,%esp
+    2ac8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    2acd:	81 fb e7 03 00 00    	cmp    $0x3e7,%ebx
+    2ad3:	7f 15                	jg     2aea <forktest+0x38>
+    pid = fork();
+    2ad5:	e8 da 1f 00 00       	call   4ab4 <fork>
+    if(pid < 0)
+    2ada:	85 c0                	test   %eax,%eax
+    2adc:	78 0c                	js     2aea <forktest+0x38>
+      break;
+    if(pid == 0)
+    2ade:	74 05                	je     2ae5 <forktest+0x33>
+  for(n=0; n<1000; n++){
+    2ae0:	83 c3 01             	add    $0x1,%ebx
+    2ae3:	eb e8                	jmp    2acd <forktest+0x1b>
+      exit();
+    2ae5:	e8 d2 1f 00 00       	call   4abc <exit>
+  }
+
+  if(n == 1000){
+    2aea:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    2af0:	74 12                	je     2b04 <forktest+0x52>
+    printf(1, "fork claimed to work 1000 times!\n");
+    exit();
+  }
+
+  for(; n > 0; n--){
+    2af2:	85 db                	test   %ebx,%ebx
+    2af4:	7e 36                	jle    2b2c <forktest+0x7a>
+    if(wait() < 0){
+    2af6:	e8 c9 1f 00 00       	call   4ac4 <wait>
+    2afb:	85 c0                	test   %eax,%eax
+    2afd:	78 19                	js     2b18 <forktest+0x66>
+  for(; n > 0; n--){
+    2aff:	83 eb 01             	sub    $0x1,%ebx
+    2b02:	eb ee                	jmp    2af2 <forktest+0x40>
+    printf(1, "fork claimed to work 1000 times!\n");
+    2b04:	83 ec 08             	sub    $0x8,%esp
+    2b07:	68 60 69 00 00       	push   $0x6960
+    2b0c:	6a 01                	push   $0x1
+    2b0e:	e8 80 21 00 00       	call   4c93 <printf>
+    exit();
+    2b13:	e8 a4 1f 00 00       	call   4abc <exit>
+      printf(1, "wait stopped early\n");
+    2b18:	83 ec 08             	sub    $0x8,%esp
+    2b1b:	68 ed 61 00 00       	push   $0x61ed
+    2b20:	6a 01                	push   $0x1
+    2b22:	e8 6c 21 00 00       	call   4c93 <printf>
+      exit();
+    2b27:	e8 90 1f 00 00       	call   4abc <exit>
+    }
+  }
+
+  if(wait() != -1){
+    2b2c:	e8 93 1f 00 00       	call   4ac4 <wait>
+    2b31:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2b34:	75 17                	jne    2b4d <forktest+0x9b>
+    printf(1, "wait got too many\n");
+    exit();
+  }
+
+  printf(1, "fork test OK\n");
+    2b36:	83 ec 08             	sub    $0x8,%esp
+    2b39:	68 35 5e 00 00       	push   $0x5e35
+    2b3e:	6a 01                	push   $0x1
+    2b40:	e8 4e 21 00 00       	call   4c93 <printf>
+}
+    2b45:	83 c4 10             	add    $0x10,%esp
+    2b48:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2b4b:	c9                   	leave
+    2b4c:	c3                   	ret
+    printf(1, "wait got too many\n");
+    2b4d:	83 ec 08             	sub    $0x8,%esp
+    2b50:	68 07 62 00 00       	push   $0x6207
+    2b55:	6a 01                	push   $0x1
+    2b57:	e8 37 21 00 00       	call   4c93 <printf>
+    exit();
+    2b5c:	e8 5b 1f 00 00       	call   4abc <exit>
+
+00002b61 <lazytest>:
+
+// sbrk() only reserves memory; pages appear on first touch,
+// whether the touch comes from user code or from a system call.
+void
+lazytest(void)
+{
+    2b61:	55                   	push   %ebp
+    2b62:	89 e5                	mov    %esp,%ebp
+    2b64:	53                   	push   %ebx
+    2b65:	83 ec 1c             	sub    $0x1c,%esp
+  char *a, *p;
+  int fds[2], pid;
+
+  printf(1, "lazy sbrk test\n");
+    2b68:	68 f0 5c 00 00       	push   $0x5cf0
+    2b6d:	6a 01                	push   $0x1
+    2b6f:	e8 1f 21 00 00       	call   4c93 <printf>
+  a = sbrk(8*1024*1024);
+    2b74:	c7 04 24 00 00 80 00 	movl   $0x800000,(%esp)
+    2b7b:	e8 c4 1f 00 00       	call   4b44 <sbrk>
+  if(a == (char*)-1){
+    2b80:	83 c4 10             	add    $0x10,%esp
+    2b83:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2b86:	74 1b                	je     2ba3 <lazytest+0x42>
+    2b88:	89 c3                	mov    %eax,%ebx
+    printf(1, "lazy sbrk failed\n");
+    exit();
+  }
+  for(p = a; p < a + 8*1024*1024; p += 1024*1024){
+    2b8a:	8d 93 00 00 80 00    	lea    0x800000(%ebx),%edx
+    2b90:	39 d0                	cmp    %edx,%eax
+    2b92:	73 37                	jae    2bcb <lazytest+0x6a>
+    if(*p != 0){
+    2b94:	80 38 00             	cmpb   $0x0,(%eax)
+    2b97:	75 1e                	jne    2bb7 <lazytest+0x56>
+      printf(1, "lazy page not zero\n");
+      exit();
+    }
+    *p = 'z';
+    2b99:	c6 00 7a             	movb   $0x7a,(%eax)
+  for(p = a; p < a + 8*1024*1024; p += 1024*1024){
+    2b9c:	05 00 00 10 00       	add    $0x100000,%eax
+    2ba1:	eb e7                	jmp    2b8a <lazytest+0x29>
+    printf(1, "lazy sbrk failed\n");
+    2ba3:	83 ec 08             	sub    $0x8,%esp
+    2ba6:	68 00 5d 00 00       	push   $0x5d00
+    2bab:	6a 01                	push   $0x1
+    2bad:	e8 e1 20 00 00       	call   4c93 <printf>
+    exit();
+    2bb2:	e8 05 1f 00 00       	call   4abc <exit>
+      printf(1, "lazy page not zero\n");
+    2bb7:	83 ec 08             	sub    $0x8,%esp
+    2bba:	68 12 5d 00 00       	push   $0x5d12
+    2bbf:	6a 01                	push   $0x1
+    2bc1:	e8 cd 20 00 00       	call   4c93 <printf>
+      exit();
+    2bc6:	e8 f1 1e 00 00       	call   4abc <exit>
+  }
+  if(pipe(fds) != 0){
+    2bcb:	83 ec 0c             	sub    $0xc,%esp
+    2bce:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    2bd1:	50                   	push   %eax
+    2bd2:	e8 f5 1e 00 00       	call   4acc <pipe>
+    2bd7:	83 c4 10             	add    $0x10,%esp
+    2bda:	85 c0                	test   %eax,%eax
+    2bdc:	75 2f                	jne    2c0d <lazytest+0xac>
+    printf(1, "lazy pipe failed\n");
+    exit();
+  }
+  pid = fork();
+    2bde:	e8 d1 1e 00 00       	call   4ab4 <fork>
+  if(pid == 0){
+    2be3:	85 c0                	test   %eax,%eax
+    2be5:	75 51                	jne    2c38 <lazytest+0xd7>
+    if(a[4*1024*1024] != 'z' || a[4*1024*1024 + 4096] != 0){
+    2be7:	80 bb 00 00 40 00 7a 	cmpb   $0x7a,0x400000(%ebx)
+    2bee:	75 09                	jne    2bf9 <lazytest+0x98>
+    2bf0:	80 bb 00 10 40 00 00 	cmpb   $0x0,0x401000(%ebx)
+    2bf7:	74 28                	je     2c21 <lazytest+0xc0>
+      printf(1, "lazy child saw wrong data\n");
+    2bf9:	83 ec 08             	sub    $0x8,%esp
+    2bfc:	68 38 5d 00 00       	push   $0x5d38
+    2c01:	6a 01                	push   $0x1
+    2c03:	e8 8b 20 00 00       	call   4c93 <printf>
+      exit();
+    2c08:	e8 af 1e 00 00       	call   4abc <exit>
+    printf(1, "lazy pipe failed\n");
+    2c0d:	83 ec 08             	sub    $0x8,%esp
+    2c10:	68 26 5d 00 00       	push   $0x5d26
+    2c15:	6a 01                	push   $0x1
+    2c17:	e8 77 20 00 00       	call   4c93 <printf>
+    exit();
+    2c1c:	e8 9b 1e 00 00       	call   4abc <exit>
+    }
+    write(fds[1], "k", 1);
+    2c21:	83 ec 04             	sub    $0x4,%esp
+    2c24:	6a 01                	push   $0x1
+    2c26:	68 36 63 00 00       	push   $0x6336
+    2c2b:	ff 75 f4             	push   -0xc(%ebp)
+    2c2e:	e8 a9 1e 00 00       	call   4adc <write>
+    exit();
+    2c33:	e8 84 1e 00 00       	call   4abc <exit>
+  }
+  if(read(fds[0], a + 8*1024*1024 - 1, 1) != 1 || a[8*1024*1024 - 1] != 'k'){
+    2c38:	8d 83 ff ff 7f 00    	lea    0x7fffff(%ebx),%eax
+    2c3e:	83 ec 04             	sub    $0x4,%esp
+    2c41:	6a 01                	push   $0x1
+    2c43:	50                   	push   %eax
+    2c44:	ff 75 f0             	push   -0x10(%ebp)
+    2c47:	e8 88 1e 00 00       	call   4ad4 <read>
+    2c4c:	83 c4 10             	add    $0x10,%esp
+    2c4f:	83 f8 01             	cmp    $0x1,%eax
+    2c52:	75 47                	jne    2c9b <lazytest+0x13a>
+    2c54:	80 bb ff ff 7f 00 6b 	cmpb   $0x6b,0x7fffff(%ebx)
+    2c5b:	75 3e                	jne    2c9b <lazytest+0x13a>
+    printf(1, "lazy read into untouched page failed\n");
+    exit();
+  }
+  wait();
+    2c5d:	e8 62 1e 00 00       	call   4ac4 <wait>
+  close(fds[0]);
+    2c62:	83 ec 0c             	sub    $0xc,%esp
+    2c65:	ff 75 f0             	push   -0x10(%ebp)
+    2c68:	e8 77 1e 00 00       	call   4ae4 <close>
+  close(fds[1]);
+    2c6d:	83 c4 04             	add    $0x4,%esp
+    2c70:	ff 75 f4             	push   -0xc(%ebp)
+    2c73:	e8 6c 1e 00 00       	call   4ae4 <close>
+  sbrk(-8*1024*1024);
+    2c78:	c7 04 24 00 00 80 ff 	movl   $0xff800000,(%esp)
+    2c7f:	e8 c0 1e 00 00       	call   4b44 <sbrk>
+  printf(1, "lazy sbrk test OK\n");
+    2c84:	83 c4 08             	add    $0x8,%esp
+    2c87:	68 53 5d 00 00       	push   $0x5d53
+    2c8c:	6a 01                	push   $0x1
+    2c8e:	e8 00 20 00 00       	call   4c93 <printf>
+}
+    2c93:	83 c4 10             	add    $0x10,%esp
+    2c96:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2c99:	c9                   	leave
+    2c9a:	c3                   	ret
+    printf(1, "lazy read into untouched page failed\n");
+    2c9b:	83 ec 08             	sub    $0x8,%esp
+    2c9e:	68 84 69 00 00       	push   $0x6984
+    2ca3:	6a 01                	push   $0x1
+    2ca5:	e8 e9 1f 00 00       	call   4c93 <printf>
+    exit();
+    2caa:	e8 0d 1e 00 00       	call   4abc <exit>
+
+00002caf <cowtest>:
+// fork() shares pages copy-on-write; writes on either side,
+// including by the kernel into a user buffer, must stay private.
+char cowbuf[3*4096];
+void
+cowtest(void)
+{
+    2caf:	55                   	push   %ebp
+    2cb0:	89 e5                	mov    %esp,%ebp
+    2cb2:	56                   	push   %esi
+    2cb3:	53                   	push   %ebx
+    2cb4:	83 ec 18             	sub    $0x18,%esp
+  int fds[2], pid, i;
+
+  printf(1, "cow test\n");
+    2cb7:	68 66 5d 00 00       	push   $0x5d66
+    2cbc:	6a 01                	push   $0x1
+    2cbe:	e8 d0 1f 00 00       	call   4c93 <printf>
+  for(i = 0; i < sizeof(cowbuf); i++)
+    2cc3:	83 c4 10             	add    $0x10,%esp
+    2cc6:	b8 00 00 00 00       	mov    $0x0,%eax
+    2ccb:	eb 0a                	jmp    2cd7 <cowtest+0x28>
+    cowbuf[i] = 'p';
+    2ccd:	c6 80 80 9f 00 00 70 	movb   $0x70,0x9f80(%eax)
+  for(i = 0; i < sizeof(cowbuf); i++)
+    2cd4:	83 c0 01             	add    $0x1,%eax
+    2cd7:	3d ff 2f 00 00       	cmp    $0x2fff,%eax
+    2cdc:	76 ef                	jbe    2ccd <cowtest+0x1e>
+  if(pipe(fds) != 0){
+    2cde:	83 ec 0c             	sub    $0xc,%esp
+    2ce1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    2ce4:	50                   	push   %eax
+    2ce5:	e8 e2 1d 00 00       	call   4acc <pipe>
+    2cea:	89 c3                	mov    %eax,%ebx
+    2cec:	83 c4 10             	add    $0x10,%esp
+    2cef:	85 c0                	test   %eax,%eax
+    2cf1:	75 14                	jne    2d07 <cowtest+0x58>
+    printf(1, "cow pipe failed\n");
+    exit();
+  }
+  pid = fork();
+    2cf3:	e8 bc 1d 00 00       	call   4ab4 <fork>
+    2cf8:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    2cfa:	85 c0                	test   %eax,%eax
+    2cfc:	78 1d                	js     2d1b <cowtest+0x6c>
+    printf(1, "cow fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    2cfe:	74 2f                	je     2d2f <cowtest+0x80>
+        exit();
+      }
+    }
+    exit();
+  }
+  for(i = 0; i < sizeof(cowbuf); i++)
+    2d00:	89 d8                	mov    %ebx,%eax
+    2d02:	e9 a9 00 00 00       	jmp    2db0 <cowtest+0x101>
+    printf(1, "cow pipe failed\n");
+    2d07:	83 ec 08             	sub    $0x8,%esp
+    2d0a:	68 70 5d 00 00       	push   $0x5d70
+    2d0f:	6a 01                	push   $0x1
+    2d11:	e8 7d 1f 00 00       	call   4c93 <printf>
+    exit();
+    2d16:	e8 a1 1d 00 00       	call   4abc <exit>
+    printf(1, "cow fork failed\n");
+    2d1b:	83 ec 08             	sub    $0x8,%esp
+    2d1e:	68 81 5d 00 00       	push   $0x5d81
+    2d23:	6a 01                	push   $0x1
+    2d25:	e8 69 1f 00 00       	call   4c93 <printf>
+    exit();
+    2d2a:	e8 8d 1d 00 00       	call   4abc <exit>
+    if(read(fds[0], cowbuf + 4096, 10) != 10){
+    2d2f:	83 ec 04             	sub    $0x4,%esp
+    2d32:	6a 0a                	push   $0xa
+    2d34:	68 80 af 00 00       	push   $0xaf80
+    2d39:	ff 75 f0             	push   -0x10(%ebp)
+    2d3c:	e8 93 1d 00 00       	call   4ad4 <read>
+    2d41:	83 c4 10             	add    $0x10,%esp
+    2d44:	83 f8 0a             	cmp    $0xa,%eax
+    2d47:	75 28                	jne    2d71 <cowtest+0xc2>
+    for(i = 0; i < sizeof(cowbuf); i++){
+    2d49:	81 fe ff 2f 00 00    	cmp    $0x2fff,%esi
+    2d4f:	77 50                	ja     2da1 <cowtest+0xf2>
+      if(cowbuf[i] != (i >= 4096 && i < 4096+10 ? 'c' : 'p')){
+    2d51:	0f be 96 80 9f 00 00 	movsbl 0x9f80(%esi),%edx
+    2d58:	8d 86 00 f0 ff ff    	lea    -0x1000(%esi),%eax
+    2d5e:	83 f8 09             	cmp    $0x9,%eax
+    2d61:	76 22                	jbe    2d85 <cowtest+0xd6>
+    2d63:	b8 70 00 00 00       	mov    $0x70,%eax
+    2d68:	39 c2                	cmp    %eax,%edx
+    2d6a:	75 20                	jne    2d8c <cowtest+0xdd>
+    for(i = 0; i < sizeof(cowbuf); i++){
+    2d6c:	83 c6 01             	add    $0x1,%esi
+    2d6f:	eb d8                	jmp    2d49 <cowtest+0x9a>
+      printf(1, "cow child read failed\n");
+    2d71:	83 ec 08             	sub    $0x8,%esp
+    2d74:	68 92 5d 00 00       	push   $0x5d92
+    2d79:	6a 01                	push   $0x1
+    2d7b:	e8 13 1f 00 00       	call   4c93 <printf>
+      exit();
+    2d80:	e8 37 1d 00 00       	call   4abc <exit>
+      if(cowbuf[i] != (i >= 4096 && i < 4096+10 ? 'c' : 'p')){
+    2d85:	b8 63 00 00 00       	mov    $0x63,%eax
+    2d8a:	eb dc                	jmp    2d68 <cowtest+0xb9>
+        printf(1, "cow child saw wrong data at %d\n", i);
+    2d8c:	83 ec 04             	sub    $0x4,%esp
+    2d8f:	56                   	push   %esi
+    2d90:	68 ac 69 00 00       	push   $0x69ac
+    2d95:	6a 01                	push   $0x1
+    2d97:	e8 f7 1e 00 00       	call   4c93 <printf>
+        exit();
+    2d9c:	e8 1b 1d 00 00       	call   4abc <exit>
+    exit();
+    2da1:	e8 16 1d 00 00       	call   4abc <exit>
+    cowbuf[i] = 'x';
+    2da6:	c6 80 80 9f 00 00 78 	movb   $0x78,0x9f80(%eax)
+  for(i = 0; i < sizeof(cowbuf); i++)
+    2dad:	83 c0 01             	add    $0x1,%eax
+    2db0:	3d ff 2f 00 00       	cmp    $0x2fff,%eax
+    2db5:	76 ef                	jbe    2da6 <cowtest+0xf7>
+  write(fds[1], "cccccccccc", 10);
+    2db7:	83 ec 04             	sub    $0x4,%esp
+    2dba:	6a 0a                	push   $0xa
+    2dbc:	68 a9 5d 00 00       	push   $0x5da9
+    2dc1:	ff 75 f4             	push   -0xc(%ebp)
+    2dc4:	e8 13 1d 00 00       	call   4adc <write>
+  wait();
+    2dc9:	e8 f6 1c 00 00       	call   4ac4 <wait>
+  for(i = 0; i < sizeof(cowbuf); i++){
+    2dce:	83 c4 10             	add    $0x10,%esp
+    2dd1:	81 fb ff 2f 00 00    	cmp    $0x2fff,%ebx
+    2dd7:	77 23                	ja     2dfc <cowtest+0x14d>
+    if(cowbuf[i] != 'x'){
+    2dd9:	80 bb 80 9f 00 00 78 	cmpb   $0x78,0x9f80(%ebx)
+    2de0:	75 05                	jne    2de7 <cowtest+0x138>
+  for(i = 0; i < sizeof(cowbuf); i++){
+    2de2:	83 c3 01             	add    $0x1,%ebx
+    2de5:	eb ea                	jmp    2dd1 <cowtest+0x122>
+      printf(1, "cow parent saw wrong data at %d\n", i);
+    2de7:	83 ec 04             	sub    $0x4,%esp
+    2dea:	53                   	push   %ebx
+    2deb:	68 cc 69 00 00       	push   $0x69cc
+    2df0:	6a 01                	push   $0x1
+    2df2:	e8 9c 1e 00 00       	call   4c93 <printf>
+      exit();
+    2df7:	e8 c0 1c 00 00       	call   4abc <exit>
+    }
+  }
+  close(fds[0]);
+    2dfc:	83 ec 0c             	sub    $0xc,%esp
+    2dff:	ff 75 f0             	push   -0x10(%ebp)
+    2e02:	e8 dd 1c 00 00       	call   4ae4 <close>
+  close(fds[1]);
+    2e07:	83 c4 04             	add    $0x4,%esp
+    2e0a:	ff 75 f4             	push   -0xc(%ebp)
+    2e0d:	e8 d2 1c 00 00       	call   4ae4 <close>
+  printf(1, "cow test OK\n");
+    2e12:	83 c4 08             	add    $0x8,%esp
+    2e15:	68 b4 5d 00 00       	push   $0x5db4
+    2e1a:	6a 01                	push   $0x1
+    2e1c:	e8 72 1e 00 00       	call   4c93 <printf>
+}
+    2e21:	83 c4 10             	add    $0x10,%esp
+    2e24:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2e27:	5b                   	pop    %ebx
+    2e28:	5e                   	pop    %esi
+    2e29:	5d                   	pop    %ebp
+    2e2a:	c3                   	ret
+
+00002e2b <vforktest>:
+
+// vfork() children run on the parent's memory until exec or exit.
+void
+vforktest(void)
+{
+    2e2b:	55                   	push   %ebp
+    2e2c:	89 e5                	mov    %esp,%ebp
+    2e2e:	53                   	push   %ebx
+    2e2f:	83 ec 2c             	sub    $0x2c,%esp
+  int pid, xpid;
+  char *args[] = { "echo", "vforked", 0 };
+    2e32:	c7 45 ec 25 50 00 00 	movl   $0x5025,-0x14(%ebp)
+    2e39:	c7 45 f0 c1 5d 00 00 	movl   $0x5dc1,-0x10(%ebp)
+    2e40:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  printf(1, "vfork test\n");
+    2e47:	68 c9 5d 00 00       	push   $0x5dc9
+    2e4c:	6a 01                	push   $0x1
+    2e4e:	e8 40 1e 00 00       	call   4c93 <printf>
+    2e53:	83 c4 10             	add    $0x10,%esp
+  xpid = getpid();
+    2e56:	e8 e1 1c 00 00       	call   4b3c <getpid>
+    2e5b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  pid = vfork();
+    2e5e:	e8 81 1d 00 00       	call   4be4 <vfork>
+  if(pid < 0){
+    2e63:	85 c0                	test   %eax,%eax
+    2e65:	78 44                	js     2eab <vforktest+0x80>
+    2e67:	89 c3                	mov    %eax,%ebx
+    printf(1, "vfork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    2e69:	74 57                	je     2ec2 <vforktest+0x97>
+    exec("echo", args);
+    printf(1, "vfork child exec failed\n");
+    exit();
+  }
+  if(getpid() != xpid || wait() != pid){
+    2e6b:	e8 cc 1c 00 00       	call   4b3c <getpid>
+    2e70:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    2e73:	75 75                	jne    2eea <vforktest+0xbf>
+    2e75:	e8 4a 1c 00 00       	call   4ac4 <wait>
+    2e7a:	39 c3                	cmp    %eax,%ebx
+    2e7c:	75 6c                	jne    2eea <vforktest+0xbf>
+    printf(1, "vfork parent lost its state\n");
+    exit();
+  }
+
+  pid = vfork();
+    2e7e:	e8 61 1d 00 00       	call   4be4 <vfork>
+    2e83:	89 c3                	mov    %eax,%ebx
+  if(pid == 0)
+    2e85:	85 c0                	test   %eax,%eax
+    2e87:	74 78                	je     2f01 <vforktest+0xd6>
+    exit();
+  if(pid < 0 || wait() != pid){
+    2e89:	78 7b                	js     2f06 <vforktest+0xdb>
+    2e8b:	e8 34 1c 00 00       	call   4ac4 <wait>
+    2e90:	39 c3                	cmp    %eax,%ebx
+    2e92:	75 72                	jne    2f06 <vforktest+0xdb>
+    printf(1, "vfork child exit not seen\n");
+    exit();
+  }
+  printf(1, "vfork test OK\n");
+    2e94:	83 ec 08             	sub    $0x8,%esp
+    2e97:	68 34 5e 00 00       	push   $0x5e34
+    2e9c:	6a 01                	push   $0x1
+    2e9e:	e8 f0 1d 00 00       	call   4c93 <printf>
+    2ea3:	83 c4 10             	add    $0x10,%esp
+}
+    2ea6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2ea9:	c9                   	leave
+    2eaa:	c3                   	ret
+    printf(1, "vfork failed\n");
+    2eab:	83 ec 08             	sub    $0x8,%esp
+    2eae:	68 d5 5d 00 00       	push   $0x5dd5
+    2eb3:	6a 01                	push   $0x1
+    2eb5:	e8 d9 1d 00 00       	call   4c93 <printf>
+    2eba:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2ebd:	e8 fa 1b 00 00       	call   4abc <exit>
+    exec("echo", args);
+    2ec2:	83 ec 08             	sub    $0x8,%esp
+    2ec5:	8d 45 ec             	lea    -0x14(%ebp),%eax
+    2ec8:	50                   	push   %eax
+    2ec9:	68 25 50 00 00       	push   $0x5025
+    2ece:	e8 21 1c 00 00       	call   4af4 <exec>
+    2ed3:	83 c4 08             	add    $0x8,%esp
+    printf(1, "vfork child exec failed\n");
+    2ed6:	68 e3 5d 00 00       	push   $0x5de3
+    2edb:	6a 01                	push   $0x1
+    2edd:	e8 b1 1d 00 00       	call   4c93 <printf>
+    2ee2:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2ee5:	e8 d2 1b 00 00       	call   4abc <exit>
+    printf(1, "vfork parent lost its state\n");
+    2eea:	83 ec 08             	sub    $0x8,%esp
+    2eed:	68 fc 5d 00 00       	push   $0x5dfc
+    2ef2:	6a 01                	push   $0x1
+    2ef4:	e8 9a 1d 00 00       	call   4c93 <printf>
+    2ef9:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2efc:	e8 bb 1b 00 00       	call   4abc <exit>
+    exit();
+    2f01:	e8 b6 1b 00 00       	call   4abc <exit>
+    printf(1, "vfork child exit not seen\n");
+    2f06:	83 ec 08             	sub    $0x8,%esp
+    2f09:	68 19 5e 00 00       	push   $0x5e19
+    2f0e:	6a 01                	push   $0x1
+    2f10:	e8 7e 1d 00 00       	call   4c93 <printf>
+    2f15:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2f18:	e8 9f 1b 00 00       	call   4abc <exit>
+
+00002f1d <shmtest>:
+// A shared memory segment is seen by forked children and
+// by unrelated processes that attach it by name, and system
+// calls can read and write buffers in it.
+void
+shmtest(void)
+{
+    2f1d:	55                   	push   %ebp
+    2f1e:	89 e5                	mov    %esp,%ebp
+    2f20:	53                   	push   %ebx
+    2f21:	83 ec 1c             	sub    $0x1c,%esp
+  int id, fds[2], pid;
+  char *a, *b;
+
+  printf(1, "shm test\n");
+    2f24:	68 43 5e 00 00       	push   $0x5e43
+    2f29:	6a 01                	push   $0x1
+    2f2b:	e8 63 1d 00 00       	call   4c93 <printf>
+  id = shmget("shmtest", 2);
+    2f30:	83 c4 08             	add    $0x8,%esp
+    2f33:	6a 02                	push   $0x2
+    2f35:	68 4d 5e 00 00       	push   $0x5e4d
+    2f3a:	e8 5d 1c 00 00       	call   4b9c <shmget>
+  if(id < 0 || (a = shmat(id)) == (char*)-1){
+    2f3f:	83 c4 10             	add    $0x10,%esp
+    2f42:	85 c0                	test   %eax,%eax
+    2f44:	0f 88 87 00 00 00    	js     2fd1 <shmtest+0xb4>
+    2f4a:	83 ec 0c             	sub    $0xc,%esp
+    2f4d:	50                   	push   %eax
+    2f4e:	e8 51 1c 00 00       	call   4ba4 <shmat>
+    2f53:	89 c3                	mov    %eax,%ebx
+    2f55:	83 c4 10             	add    $0x10,%esp
+    2f58:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2f5b:	74 74                	je     2fd1 <shmtest+0xb4>
+    printf(1, "shm attach failed\n");
+    exit();
+  }
+  if(a < (char*)sbrk(0) || a[0] != 0 || a[2*4096-1] != 0){
+    2f5d:	83 ec 0c             	sub    $0xc,%esp
+    2f60:	6a 00                	push   $0x0
+    2f62:	e8 dd 1b 00 00       	call   4b44 <sbrk>
+    2f67:	83 c4 10             	add    $0x10,%esp
+    2f6a:	39 c3                	cmp    %eax,%ebx
+    2f6c:	72 77                	jb     2fe5 <shmtest+0xc8>
+    2f6e:	80 3b 00             	cmpb   $0x0,(%ebx)
+    2f71:	75 72                	jne    2fe5 <shmtest+0xc8>
+    2f73:	80 bb ff 1f 00 00 00 	cmpb   $0x0,0x1fff(%ebx)
+    2f7a:	75 69                	jne    2fe5 <shmtest+0xc8>
+    printf(1, "shm segment not zeroed or misplaced\n");
+    exit();
+  }
+  a[0] = 'p';
+    2f7c:	c6 03 70             	movb   $0x70,(%ebx)
+  pid = fork();
+    2f7f:	e8 30 1b 00 00       	call   4ab4 <fork>
+  if(pid < 0){
+    2f84:	85 c0                	test   %eax,%eax
+    2f86:	78 71                	js     2ff9 <shmtest+0xdc>
+    printf(1, "shm fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    2f88:	0f 85 91 00 00 00    	jne    301f <shmtest+0x102>
+    // Inherited mapping: writes are seen by the parent.
+    a[4096] = 'c';
+    2f8e:	c6 83 00 10 00 00 63 	movb   $0x63,0x1000(%ebx)
+    // A second attachment maps the same pages elsewhere.
+    if((b = shmat(shmget("shmtest", 0))) == (char*)-1 || b == a || b[0] != 'p'){
+    2f95:	83 ec 08             	sub    $0x8,%esp
+    2f98:	6a 00                	push   $0x0
+    2f9a:	68 4d 5e 00 00       	push   $0x5e4d
+    2f9f:	e8 f8 1b 00 00       	call   4b9c <shmget>
+    2fa4:	89 04 24             	mov    %eax,(%esp)
+    2fa7:	e8 f8 1b 00 00       	call   4ba4 <shmat>
+    2fac:	83 c4 10             	add    $0x10,%esp
+    2faf:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2fb2:	74 09                	je     2fbd <shmtest+0xa0>
+    2fb4:	39 c3                	cmp    %eax,%ebx
+    2fb6:	74 05                	je     2fbd <shmtest+0xa0>
+    2fb8:	80 38 70             	cmpb   $0x70,(%eax)
+    2fbb:	74 50                	je     300d <shmtest+0xf0>
+      printf(1, "shm child attach failed\n");
+    2fbd:	83 ec 08             	sub    $0x8,%esp
+    2fc0:	68 79 5e 00 00       	push   $0x5e79
+    2fc5:	6a 01                	push   $0x1
+    2fc7:	e8 c7 1c 00 00       	call   4c93 <printf>
+      exit();
+    2fcc:	e8 eb 1a 00 00       	call   4abc <exit>
+    printf(1, "shm attach failed\n");
+    2fd1:	83 ec 08             	sub    $0x8,%esp
+    2fd4:	68 55 5e 00 00       	push   $0x5e55
+    2fd9:	6a 01                	push   $0x1
+    2fdb:	e8 b3 1c 00 00       	call   4c93 <printf>
+    exit();
+    2fe0:	e8 d7 1a 00 00       	call   4abc <exit>
+    printf(1, "shm segment not zeroed or misplaced\n");
+    2fe5:	83 ec 08             	sub    $0x8,%esp
+    2fe8:	68 f0 69 00 00       	push   $0x69f0
+    2fed:	6a 01                	push   $0x1
+    2fef:	e8 9f 1c 00 00       	call   4c93 <printf>
+    exit();
+    2ff4:	e8 c3 1a 00 00       	call   4abc <exit>
+    printf(1, "shm fork failed\n");
+    2ff9:	83 ec 08             	sub    $0x8,%esp
+    2ffc:	68 68 5e 00 00       	push   $0x5e68
+    3001:	6a 01                	push   $0x1
+    3003:	e8 8b 1c 00 00       	call   4c93 <printf>
+    exit();
+    3008:	e8 af 1a 00 00       	call   4abc <exit>
+    }
+    b[1] = 'b';
+    300d:	c6 40 01 62          	movb   $0x62,0x1(%eax)
+    shmdt(b);
+    3011:	83 ec 0c             	sub    $0xc,%esp
+    3014:	50                   	push   %eax
+    3015:	e8 92 1b 00 00       	call   4bac <shmdt>
+    exit();
+    301a:	e8 9d 1a 00 00       	call   4abc <exit>
+  }
+  wait();
+    301f:	e8 a0 1a 00 00       	call   4ac4 <wait>
+  if(a[4096] != 'c' || a[1] != 'b'){
+    3024:	80 bb 00 10 00 00 63 	cmpb   $0x63,0x1000(%ebx)
+    302b:	0f 85 ac 00 00 00    	jne    30dd <shmtest+0x1c0>
+    3031:	80 7b 01 62          	cmpb   $0x62,0x1(%ebx)
+    3035:	0f 85 a2 00 00 00    	jne    30dd <shmtest+0x1c0>
+    printf(1, "shm parent didn't see child's writes\n");
+    exit();
+  }
+  if(pipe(fds) != 0 || write(fds[1], a, 2) != 2 || read(fds[0], a + 100, 2) != 2 ||
+    303b:	83 ec 0c             	sub    $0xc,%esp
+    303e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    3041:	50                   	push   %eax
+    3042:	e8 85 1a 00 00       	call   4acc <pipe>
+    3047:	83 c4 10             	add    $0x10,%esp
+    304a:	85 c0                	test   %eax,%eax
+    304c:	0f 85 9f 00 00 00    	jne    30f1 <shmtest+0x1d4>
+    3052:	83 ec 04             	sub    $0x4,%esp
+    3055:	6a 02                	push   $0x2
+    3057:	53                   	push   %ebx
+    3058:	ff 75 f4             	push   -0xc(%ebp)
+    305b:	e8 7c 1a 00 00       	call   4adc <write>
+    3060:	83 c4 10             	add    $0x10,%esp
+    3063:	83 f8 02             	cmp    $0x2,%eax
+    3066:	0f 85 85 00 00 00    	jne    30f1 <shmtest+0x1d4>
+    306c:	8d 43 64             	lea    0x64(%ebx),%eax
+    306f:	83 ec 04             	sub    $0x4,%esp
+    3072:	6a 02                	push   $0x2
+    3074:	50                   	push   %eax
+    3075:	ff 75 f0             	push   -0x10(%ebp)
+    3078:	e8 57 1a 00 00       	call   4ad4 <read>
+    307d:	83 c4 10             	add    $0x10,%esp
+    3080:	83 f8 02             	cmp    $0x2,%eax
+    3083:	75 6c                	jne    30f1 <shmtest+0x1d4>
+    3085:	80 7b 64 70          	cmpb   $0x70,0x64(%ebx)
+    3089:	75 66                	jne    30f1 <shmtest+0x1d4>
+     a[100] != 'p' || a[101] != 'b'){
+    308b:	80 7b 65 62          	cmpb   $0x62,0x65(%ebx)
+    308f:	75 60                	jne    30f1 <shmtest+0x1d4>
+    printf(1, "shm pipe i/o failed\n");
+    exit();
+  }
+  close(fds[0]);
+    3091:	83 ec 0c             	sub    $0xc,%esp
+    3094:	ff 75 f0             	push   -0x10(%ebp)
+    3097:	e8 48 1a 00 00       	call   4ae4 <close>
+  close(fds[1]);
+    309c:	83 c4 04             	add    $0x4,%esp
+    309f:	ff 75 f4             	push   -0xc(%ebp)
+    30a2:	e8 3d 1a 00 00       	call   4ae4 <close>
+  if(shmdt(a) != 0 || shmdt(a) == 0){
+    30a7:	89 1c 24             	mov    %ebx,(%esp)
+    30aa:	e8 fd 1a 00 00       	call   4bac <shmdt>
+    30af:	83 c4 10             	add    $0x10,%esp
+    30b2:	85 c0                	test   %eax,%eax
+    30b4:	75 4f                	jne    3105 <shmtest+0x1e8>
+    30b6:	83 ec 0c             	sub    $0xc,%esp
+    30b9:	53                   	push   %ebx
+    30ba:	e8 ed 1a 00 00       	call   4bac <shmdt>
+    30bf:	83 c4 10             	add    $0x10,%esp
+    30c2:	85 c0                	test   %eax,%eax
+    30c4:	74 3f                	je     3105 <shmtest+0x1e8>
+    printf(1, "shm detach failed\n");
+    exit();
+  }
+  printf(1, "shm test OK\n");
+    30c6:	83 ec 08             	sub    $0x8,%esp
+    30c9:	68 ba 5e 00 00       	push   $0x5eba
+    30ce:	6a 01                	push   $0x1
+    30d0:	e8 be 1b 00 00       	call   4c93 <printf>
+}
+    30d5:	83 c4 10             	add    $0x10,%esp
+    30d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    30db:	c9                   	leave
+    30dc:	c3                   	ret
+    printf(1, "shm parent didn't see child's writes\n");
+    30dd:	83 ec 08             	sub    $0x8,%esp
+    30e0:	68 18 6a 00 00       	push   $0x6a18
+    30e5:	6a 01                	push   $0x1
+    30e7:	e8 a7 1b 00 00       	call   4c93 <printf>
+    exit();
+    30ec:	e8 cb 19 00 00       	call   4abc <exit>
+    printf(1, "shm pipe i/o failed\n");
+    30f1:	83 ec 08             	sub    $0x8,%esp
+    30f4:	68 92 5e 00 00       	push   $0x5e92
+    30f9:	6a 01                	push   $0x1
+    30fb:	e8 93 1b 00 00       	call   4c93 <printf>
+    exit();
+    3100:	e8 b7 19 00 00       	call   4abc <exit>
+    printf(1, "shm detach failed\n");
+    3105:	83 ec 08             	sub    $0x8,%esp
+    3108:	68 a7 5e 00 00       	push   $0x5ea7
+    310d:	6a 01                	push   $0x1
+    310f:	e8 7f 1b 00 00       	call   4c93 <printf>
+    exit();
+    3114:	e8 a3 19 00 00       	call   4abc <exit>
+
+00003119 <mmaptest>:
+
+// Map a file read-only, privately and shared.
+void
+mmaptest(void)
+{
+    3119:	55                   	push   %ebp
+    311a:	89 e5                	mov    %esp,%ebp
+    311c:	57                   	push   %edi
+    311d:	56                   	push   %esi
+    311e:	53                   	push   %ebx
+    311f:	83 ec 34             	sub    $0x34,%esp
+  int fd, fds[2], i, n, pid;
+  char *a, buf[16];
+
+  printf(1, "mmap test\n");
+    3122:	68 c7 5e 00 00       	push   $0x5ec7
+    3127:	6a 01                	push   $0x1
+    3129:	e8 65 1b 00 00       	call   4c93 <printf>
+  unlink("mmapfile");
+    312e:	c7 04 24 d2 5e 00 00 	movl   $0x5ed2,(%esp)
+    3135:	e8 d2 19 00 00       	call   4b0c <unlink>
+  fd = open("mmapfile", O_CREATE|O_RDWR);
+    313a:	83 c4 08             	add    $0x8,%esp
+    313d:	68 02 02 00 00       	push   $0x202
+    3142:	68 d2 5e 00 00       	push   $0x5ed2
+    3147:	e8 b0 19 00 00       	call   4afc <open>
+  if(fd < 0){
+    314c:	83 c4 10             	add    $0x10,%esp
+    314f:	85 c0                	test   %eax,%eax
+    3151:	78 4a                	js     319d <mmaptest+0x84>
+    3153:	89 c6                	mov    %eax,%esi
+    printf(1, "mmap create failed\n");
+    exit();
+  }
+  n = 2*4096 + 100;
+  for(i = 0; i < n; i++)
+    3155:	bb 00 00 00 00       	mov    $0x0,%ebx
+    315a:	81 fb 63 20 00 00    	cmp    $0x2063,%ebx
+    3160:	7f 63                	jg     31c5 <mmaptest+0xac>
+    if(write(fd, "abcdefghij" + i % 10, 1) != 1){
+    3162:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    3167:	89 d8                	mov    %ebx,%eax
+    3169:	f7 ea                	imul   %edx
+    316b:	c1 fa 02             	sar    $0x2,%edx
+    316e:	89 d8                	mov    %ebx,%eax
+    3170:	c1 f8 1f             	sar    $0x1f,%eax
+    3173:	29 c2                	sub    %eax,%edx
+    3175:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    3178:	01 c0                	add    %eax,%eax
+    317a:	89 da                	mov    %ebx,%edx
+    317c:	29 c2                	sub    %eax,%edx
+    317e:	83 ec 04             	sub    $0x4,%esp
+    3181:	6a 01                	push   $0x1
+    3183:	81 c2 ef 5e 00 00    	add    $0x5eef,%edx
+    3189:	52                   	push   %edx
+    318a:	56                   	push   %esi
+    318b:	e8 4c 19 00 00       	call   4adc <write>
+    3190:	83 c4 10             	add    $0x10,%esp
+    3193:	83 f8 01             	cmp    $0x1,%eax
+    3196:	75 19                	jne    31b1 <mmaptest+0x98>
+  for(i = 0; i < n; i++)
+    3198:	83 c3 01             	add    $0x1,%ebx
+    319b:	eb bd                	jmp    315a <mmaptest+0x41>
+    printf(1, "mmap create failed\n");
+    319d:	83 ec 08             	sub    $0x8,%esp
+    31a0:	68 db 5e 00 00       	push   $0x5edb
+    31a5:	6a 01                	push   $0x1
+    31a7:	e8 e7 1a 00 00       	call   4c93 <printf>
+    exit();
+    31ac:	e8 0b 19 00 00       	call   4abc <exit>
+      printf(1, "mmap write failed\n");
+    31b1:	83 ec 08             	sub    $0x8,%esp
+    31b4:	68 fa 5e 00 00       	push   $0x5efa
+    31b9:	6a 01                	push   $0x1
+    31bb:	e8 d3 1a 00 00       	call   4c93 <printf>
+      exit();
+    31c0:	e8 f7 18 00 00       	call   4abc <exit>
+    }
+  if(mmap(0, n, PROT_READ, MAP_PRIVATE, fd, 1) != (char*)-1 ||
+    31c5:	83 ec 08             	sub    $0x8,%esp
+    31c8:	6a 01                	push   $0x1
+    31ca:	56                   	push   %esi
+    31cb:	6a 02                	push   $0x2
+    31cd:	6a 01                	push   $0x1
+    31cf:	68 64 20 00 00       	push   $0x2064
+    31d4:	6a 00                	push   $0x0
+    31d6:	e8 d9 19 00 00       	call   4bb4 <mmap>
+    31db:	83 c4 20             	add    $0x20,%esp
+    31de:	83 f8 ff             	cmp    $0xffffffff,%eax
+    31e1:	0f 85 ab 00 00 00    	jne    3292 <mmaptest+0x179>
+     mmap(0, n + 4096, PROT_READ, MAP_PRIVATE, fd, 0) != (char*)-1 ||
+    31e7:	83 ec 08             	sub    $0x8,%esp
+    31ea:	6a 00                	push   $0x0
+    31ec:	56                   	push   %esi
+    31ed:	6a 02                	push   $0x2
+    31ef:	6a 01                	push   $0x1
+    31f1:	68 64 30 00 00       	push   $0x3064
+    31f6:	6a 00                	push   $0x0
+    31f8:	e8 b7 19 00 00       	call   4bb4 <mmap>
+  if(mmap(0, n, PROT_READ, MAP_PRIVATE, fd, 1) != (char*)-1 ||
+    31fd:	83 c4 20             	add    $0x20,%esp
+    3200:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3203:	0f 85 89 00 00 00    	jne    3292 <mmaptest+0x179>
+     mmap(0, n, PROT_READ, MAP_SHARED|MAP_PRIVATE, fd, 0) != (char*)-1){
+    3209:	83 ec 08             	sub    $0x8,%esp
+    320c:	6a 00                	push   $0x0
+    320e:	56                   	push   %esi
+    320f:	6a 03                	push   $0x3
+    3211:	6a 01                	push   $0x1
+    3213:	68 64 20 00 00       	push   $0x2064
+    3218:	6a 00                	push   $0x0
+    321a:	e8 95 19 00 00       	call   4bb4 <mmap>
+     mmap(0, n + 4096, PROT_READ, MAP_PRIVATE, fd, 0) != (char*)-1 ||
+    321f:	83 c4 20             	add    $0x20,%esp
+    3222:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3225:	75 6b                	jne    3292 <mmaptest+0x179>
+    exit();
+  }
+
+  // Read-only: contents match, the kernel can read the mapping
+  // but not read() into it, and a user write kills the process.
+  a = mmap(0, n, PROT_READ, MAP_PRIVATE, fd, 0);
+    3227:	83 ec 08             	sub    $0x8,%esp
+    322a:	6a 00                	push   $0x0
+    322c:	56                   	push   %esi
+    322d:	6a 02                	push   $0x2
+    322f:	6a 01                	push   $0x1
+    3231:	68 64 20 00 00       	push   $0x2064
+    3236:	6a 00                	push   $0x0
+    3238:	e8 77 19 00 00       	call   4bb4 <mmap>
+    323d:	89 c3                	mov    %eax,%ebx
+  if(a == (char*)-1 || a < (char*)sbrk(0)){
+    323f:	83 c4 20             	add    $0x20,%esp
+    3242:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3245:	74 5f                	je     32a6 <mmaptest+0x18d>
+    3247:	83 ec 0c             	sub    $0xc,%esp
+    324a:	6a 00                	push   $0x0
+    324c:	e8 f3 18 00 00       	call   4b44 <sbrk>
+    3251:	83 c4 10             	add    $0x10,%esp
+    3254:	39 c3                	cmp    %eax,%ebx
+    3256:	72 4e                	jb     32a6 <mmaptest+0x18d>
+    printf(1, "mmap failed\n");
+    exit();
+  }
+  for(i = 0; i < n; i++)
+    3258:	b9 00 00 00 00       	mov    $0x0,%ecx
+    325d:	81 f9 63 20 00 00    	cmp    $0x2063,%ecx
+    3263:	7f 6a                	jg     32cf <mmaptest+0x1b6>
+    if(a[i] != "abcdefghij"[i % 10]){
+    3265:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    326a:	89 c8                	mov    %ecx,%eax
+    326c:	f7 ea                	imul   %edx
+    326e:	c1 fa 02             	sar    $0x2,%edx
+    3271:	89 c8                	mov    %ecx,%eax
+    3273:	c1 f8 1f             	sar    $0x1f,%eax
+    3276:	29 c2                	sub    %eax,%edx
+    3278:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    327b:	01 c0                	add    %eax,%eax
+    327d:	89 ca                	mov    %ecx,%edx
+    327f:	29 c2                	sub    %eax,%edx
+    3281:	0f b6 82 ef 5e 00 00 	movzbl 0x5eef(%edx),%eax
+    3288:	38 04 0b             	cmp    %al,(%ebx,%ecx,1)
+    328b:	75 2d                	jne    32ba <mmaptest+0x1a1>
+  for(i = 0; i < n; i++)
+    328d:	83 c1 01             	add    $0x1,%ecx
+    3290:	eb cb                	jmp    325d <mmaptest+0x144>
+    printf(1, "mmap accepted a bad offset, length or flags\n");
+    3292:	83 ec 08             	sub    $0x8,%esp
+    3295:	68 40 6a 00 00       	push   $0x6a40
+    329a:	6a 01                	push   $0x1
+    329c:	e8 f2 19 00 00       	call   4c93 <printf>
+    exit();
+    32a1:	e8 16 18 00 00       	call   4abc <exit>
+    printf(1, "mmap failed\n");
+    32a6:	83 ec 08             	sub    $0x8,%esp
+    32a9:	68 0d 5f 00 00       	push   $0x5f0d
+    32ae:	6a 01                	push   $0x1
+    32b0:	e8 de 19 00 00       	call   4c93 <printf>
+    exit();
+    32b5:	e8 02 18 00 00       	call   4abc <exit>
+      printf(1, "mmap contents wrong at %d\n", i);
+    32ba:	83 ec 04             	sub    $0x4,%esp
+    32bd:	51                   	push   %ecx
+    32be:	68 1a 5f 00 00       	push   $0x5f1a
+    32c3:	6a 01                	push   $0x1
+    32c5:	e8 c9 19 00 00       	call   4c93 <printf>
+      exit();
+    32ca:	e8 ed 17 00 00       	call   4abc <exit>
+    }
+  if(pipe(fds) != 0 || write(fds[1], a + 4096, 4) != 4 || read(fds[0], a, 2) != -1 ||
+    32cf:	83 ec 0c             	sub    $0xc,%esp
+    32d2:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    32d5:	50                   	push   %eax
+    32d6:	e8 f1 17 00 00       	call   4acc <pipe>
+    32db:	83 c4 10             	add    $0x10,%esp
+    32de:	85 c0                	test   %eax,%eax
+    32e0:	0f 85 75 01 00 00    	jne    345b <mmaptest+0x342>
+    32e6:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    32ec:	83 ec 04             	sub    $0x4,%esp
+    32ef:	6a 04                	push   $0x4
+    32f1:	50                   	push   %eax
+    32f2:	ff 75 e4             	push   -0x1c(%ebp)
+    32f5:	e8 e2 17 00 00       	call   4adc <write>
+    32fa:	83 c4 10             	add    $0x10,%esp
+    32fd:	83 f8 04             	cmp    $0x4,%eax
+    3300:	0f 85 55 01 00 00    	jne    345b <mmaptest+0x342>
+    3306:	83 ec 04             	sub    $0x4,%esp
+    3309:	6a 02                	push   $0x2
+    330b:	53                   	push   %ebx
+    330c:	ff 75 e0             	push   -0x20(%ebp)
+    330f:	e8 c0 17 00 00       	call   4ad4 <read>
+    3314:	83 c4 10             	add    $0x10,%esp
+    3317:	83 f8 ff             	cmp    $0xffffffff,%eax
+    331a:	0f 85 3b 01 00 00    	jne    345b <mmaptest+0x342>
+    3320:	80 3b 61             	cmpb   $0x61,(%ebx)
+    3323:	0f 85 32 01 00 00    	jne    345b <mmaptest+0x342>
+     a[0] != 'a' || read(fds[0], buf, 4) != 4 || buf[0] != "abcdefghij"[4096 % 10]){
+    3329:	83 ec 04             	sub    $0x4,%esp
+    332c:	6a 04                	push   $0x4
+    332e:	8d 45 d0             	lea    -0x30(%ebp),%eax
+    3331:	50                   	push   %eax
+    3332:	ff 75 e0             	push   -0x20(%ebp)
+    3335:	e8 9a 17 00 00       	call   4ad4 <read>
+    333a:	83 c4 10             	add    $0x10,%esp
+    333d:	83 f8 04             	cmp    $0x4,%eax
+    3340:	0f 85 15 01 00 00    	jne    345b <mmaptest+0x342>
+    3346:	80 7d d0 67          	cmpb   $0x67,-0x30(%ebp)
+    334a:	0f 85 0b 01 00 00    	jne    345b <mmaptest+0x342>
+    printf(1, "mmap pipe i/o failed\n");
+    exit();
+  }
+  close(fds[0]);
+    3350:	83 ec 0c             	sub    $0xc,%esp
+    3353:	ff 75 e0             	push   -0x20(%ebp)
+    3356:	e8 89 17 00 00       	call   4ae4 <close>
+  close(fds[1]);
+    335b:	83 c4 04             	add    $0x4,%esp
+    335e:	ff 75 e4             	push   -0x1c(%ebp)
+    3361:	e8 7e 17 00 00       	call   4ae4 <close>
+  pid = fork();
+    3366:	e8 49 17 00 00       	call   4ab4 <fork>
+  if(pid == 0){
+    336b:	83 c4 10             	add    $0x10,%esp
+    336e:	85 c0                	test   %eax,%eax
+    3370:	0f 84 f9 00 00 00    	je     346f <mmaptest+0x356>
+    a[4096] = 'x';
+    printf(1, "mmap write to read-only mapping succeeded\n");
+    exit();
+  }
+  wait();
+    3376:	e8 49 17 00 00       	call   4ac4 <wait>
+  if(munmap(a, n) != 0 || munmap(a, n) == 0){
+    337b:	83 ec 08             	sub    $0x8,%esp
+    337e:	68 64 20 00 00       	push   $0x2064
+    3383:	53                   	push   %ebx
+    3384:	e8 33 18 00 00       	call   4bbc <munmap>
+    3389:	89 c7                	mov    %eax,%edi
+    338b:	83 c4 10             	add    $0x10,%esp
+    338e:	85 c0                	test   %eax,%eax
+    3390:	0f 85 f4 00 00 00    	jne    348a <mmaptest+0x371>
+    3396:	83 ec 08             	sub    $0x8,%esp
+    3399:	68 64 20 00 00       	push   $0x2064
+    339e:	53                   	push   %ebx
+    339f:	e8 18 18 00 00       	call   4bbc <munmap>
+    33a4:	83 c4 10             	add    $0x10,%esp
+    33a7:	85 c0                	test   %eax,%eax
+    33a9:	0f 84 db 00 00 00    	je     348a <mmaptest+0x371>
+    printf(1, "munmap failed\n");
+    exit();
+  }
+
+  // Private: writes stay in memory.
+  a = mmap(0, n - 4096, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 4096);
+    33af:	83 ec 08             	sub    $0x8,%esp
+    33b2:	68 00 10 00 00       	push   $0x1000
+    33b7:	56                   	push   %esi
+    33b8:	6a 02                	push   $0x2
+    33ba:	6a 03                	push   $0x3
+    33bc:	68 64 10 00 00       	push   $0x1064
+    33c1:	6a 00                	push   $0x0
+    33c3:	e8 ec 17 00 00       	call   4bb4 <mmap>
+  if(a == (char*)-1){
+    33c8:	83 c4 20             	add    $0x20,%esp
+    33cb:	83 f8 ff             	cmp    $0xffffffff,%eax
+    33ce:	0f 84 ca 00 00 00    	je     349e <mmaptest+0x385>
+    printf(1, "mmap private failed\n");
+    exit();
+  }
+  a[0] = 'P';
+    33d4:	c6 00 50             	movb   $0x50,(%eax)
+  munmap(a, n - 4096);
+    33d7:	83 ec 08             	sub    $0x8,%esp
+    33da:	68 64 10 00 00       	push   $0x1064
+    33df:	50                   	push   %eax
+    33e0:	e8 d7 17 00 00       	call   4bbc <munmap>
+
+  // Shared: writes reach the file once unmapped.
+  a = mmap(0, 4096 + 100, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 4096);
+    33e5:	83 c4 08             	add    $0x8,%esp
+    33e8:	68 00 10 00 00       	push   $0x1000
+    33ed:	56                   	push   %esi
+    33ee:	6a 01                	push   $0x1
+    33f0:	6a 03                	push   $0x3
+    33f2:	68 64 10 00 00       	push   $0x1064
+    33f7:	6a 00                	push   $0x0
+    33f9:	e8 b6 17 00 00       	call   4bb4 <mmap>
+  if(a == (char*)-1){
+    33fe:	83 c4 20             	add    $0x20,%esp
+    3401:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3404:	0f 84 a8 00 00 00    	je     34b2 <mmaptest+0x399>
+    printf(1, "mmap shared failed\n");
+    exit();
+  }
+  a[1] = 'S';
+    340a:	c6 40 01 53          	movb   $0x53,0x1(%eax)
+  a[4096 + 99] = 'T';
+    340e:	c6 80 63 10 00 00 54 	movb   $0x54,0x1063(%eax)
+  munmap(a, 4096 + 100);
+    3415:	83 ec 08             	sub    $0x8,%esp
+    3418:	68 64 10 00 00       	push   $0x1064
+    341d:	50                   	push   %eax
+    341e:	e8 99 17 00 00       	call   4bbc <munmap>
+  close(fd);
+    3423:	89 34 24             	mov    %esi,(%esp)
+    3426:	e8 b9 16 00 00       	call   4ae4 <close>
+
+  fd = open("mmapfile", O_RDONLY);
+    342b:	83 c4 08             	add    $0x8,%esp
+    342e:	6a 00                	push   $0x0
+    3430:	68 d2 5e 00 00       	push   $0x5ed2
+    3435:	e8 c2 16 00 00       	call   4afc <open>
+    343a:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    343c:	83 c4 10             	add    $0x10,%esp
+    343f:	85 c0                	test   %eax,%eax
+    3441:	0f 89 bd 00 00 00    	jns    3504 <mmaptest+0x3eb>
+    printf(1, "mmap reopen failed\n");
+    3447:	83 ec 08             	sub    $0x8,%esp
+    344a:	68 83 5f 00 00       	push   $0x5f83
+    344f:	6a 01                	push   $0x1
+    3451:	e8 3d 18 00 00       	call   4c93 <printf>
+    exit();
+    3456:	e8 61 16 00 00       	call   4abc <exit>
+    printf(1, "mmap pipe i/o failed\n");
+    345b:	83 ec 08             	sub    $0x8,%esp
+    345e:	68 35 5f 00 00       	push   $0x5f35
+    3463:	6a 01                	push   $0x1
+    3465:	e8 29 18 00 00       	call   4c93 <printf>
+    exit();
+    346a:	e8 4d 16 00 00       	call   4abc <exit>
+    a[4096] = 'x';
+    346f:	c6 83 00 10 00 00 78 	movb   $0x78,0x1000(%ebx)
+    printf(1, "mmap write to read-only mapping succeeded\n");
+    3476:	83 ec 08             	sub    $0x8,%esp
+    3479:	68 70 6a 00 00       	push   $0x6a70
+    347e:	6a 01                	push   $0x1
+    3480:	e8 0e 18 00 00       	call   4c93 <printf>
+    exit();
+    3485:	e8 32 16 00 00       	call   4abc <exit>
+    printf(1, "munmap failed\n");
+    348a:	83 ec 08             	sub    $0x8,%esp
+    348d:	68 4b 5f 00 00       	push   $0x5f4b
+    3492:	6a 01                	push   $0x1
+    3494:	e8 fa 17 00 00       	call   4c93 <printf>
+    exit();
+    3499:	e8 1e 16 00 00       	call   4abc <exit>
+    printf(1, "mmap private failed\n");
+    349e:	83 ec 08             	sub    $0x8,%esp
+    34a1:	68 5a 5f 00 00       	push   $0x5f5a
+    34a6:	6a 01                	push   $0x1
+    34a8:	e8 e6 17 00 00       	call   4c93 <printf>
+    exit();
+    34ad:	e8 0a 16 00 00       	call   4abc <exit>
+    printf(1, "mmap shared failed\n");
+    34b2:	83 ec 08             	sub    $0x8,%esp
+    34b5:	68 6f 5f 00 00       	push   $0x5f6f
+    34ba:	6a 01                	push   $0x1
+    34bc:	e8 d2 17 00 00       	call   4c93 <printf>
+    exit();
+    34c1:	e8 f6 15 00 00       	call   4abc <exit>
+  }
+  for(i = 0; i < n; i++){
+    if(read(fd, buf, 1) != 1){
+      printf(1, "mmap read back failed\n");
+    34c6:	83 ec 08             	sub    $0x8,%esp
+    34c9:	68 97 5f 00 00       	push   $0x5f97
+    34ce:	6a 01                	push   $0x1
+    34d0:	e8 be 17 00 00       	call   4c93 <printf>
+      exit();
+    34d5:	e8 e2 15 00 00       	call   4abc <exit>
+    }
+    if(buf[0] != (i == 4097 ? 'S' : i == n - 1 ? 'T' : "abcdefghij"[i % 10])){
+    34da:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    34df:	89 f8                	mov    %edi,%eax
+    34e1:	f7 ea                	imul   %edx
+    34e3:	c1 fa 02             	sar    $0x2,%edx
+    34e6:	89 f8                	mov    %edi,%eax
+    34e8:	c1 f8 1f             	sar    $0x1f,%eax
+    34eb:	29 c2                	sub    %eax,%edx
+    34ed:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    34f0:	01 c0                	add    %eax,%eax
+    34f2:	89 fa                	mov    %edi,%edx
+    34f4:	29 c2                	sub    %eax,%edx
+    34f6:	0f be 82 ef 5e 00 00 	movsbl 0x5eef(%edx),%eax
+    34fd:	39 c1                	cmp    %eax,%ecx
+    34ff:	75 44                	jne    3545 <mmaptest+0x42c>
+  for(i = 0; i < n; i++){
+    3501:	83 c7 01             	add    $0x1,%edi
+    3504:	81 ff 63 20 00 00    	cmp    $0x2063,%edi
+    350a:	7f 4e                	jg     355a <mmaptest+0x441>
+    if(read(fd, buf, 1) != 1){
+    350c:	83 ec 04             	sub    $0x4,%esp
+    350f:	6a 01                	push   $0x1
+    3511:	8d 45 d0             	lea    -0x30(%ebp),%eax
+    3514:	50                   	push   %eax
+    3515:	53                   	push   %ebx
+    3516:	e8 b9 15 00 00       	call   4ad4 <read>
+    351b:	83 c4 10             	add    $0x10,%esp
+    351e:	83 f8 01             	cmp    $0x1,%eax
+    3521:	75 a3                	jne    34c6 <mmaptest+0x3ad>
+    if(buf[0] != (i == 4097 ? 'S' : i == n - 1 ? 'T' : "abcdefghij"[i % 10])){
+    3523:	0f be 4d d0          	movsbl -0x30(%ebp),%ecx
+    3527:	81 ff 01 10 00 00    	cmp    $0x1001,%edi
+    352d:	74 0f                	je     353e <mmaptest+0x425>
+    352f:	81 ff 63 20 00 00    	cmp    $0x2063,%edi
+    3535:	75 a3                	jne    34da <mmaptest+0x3c1>
+    3537:	b8 54 00 00 00       	mov    $0x54,%eax
+    353c:	eb bf                	jmp    34fd <mmaptest+0x3e4>
+    353e:	b8 53 00 00 00       	mov    $0x53,%eax
+    3543:	eb b8                	jmp    34fd <mmaptest+0x3e4>
+      printf(1, "mmap file wrong at %d\n", i);
+    3545:	83 ec 04             	sub    $0x4,%esp
+    3548:	57                   	push   %edi
+    3549:	68 ae 5f 00 00       	push   $0x5fae
+    354e:	6a 01                	push   $0x1
+    3550:	e8 3e 17 00 00       	call   4c93 <printf>
+      exit();
+    3555:	e8 62 15 00 00       	call   4abc <exit>
+    }
+  }
+  close(fd);
+    355a:	83 ec 0c             	sub    $0xc,%esp
+    355d:	53                   	push   %ebx
+    355e:	e8 81 15 00 00       	call   4ae4 <close>
+  unlink("mmapfile");
+    3563:	c7 04 24 d2 5e 00 00 	movl   $0x5ed2,(%esp)
+    356a:	e8 9d 15 00 00       	call   4b0c <unlink>
+  printf(1, "mmap test OK\n");
+    356f:	83 c4 08             	add    $0x8,%esp
+    3572:	68 c5 5f 00 00       	push   $0x5fc5
+    3577:	6a 01                	push   $0x1
+    3579:	e8 15 17 00 00       	call   4c93 <printf>
+}
+    357e:	83 c4 10             	add    $0x10,%esp
+    3581:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3584:	5b                   	pop    %ebx
+    3585:	5e                   	pop    %esi
+    3586:	5f                   	pop    %edi
+    3587:	5d                   	pop    %ebp
+    3588:	c3                   	ret
+
+00003589 <logtest>:
+
+// Many small transactions back to back fill the log between
+// checkpoints; the inode table and the files must survive.
+void
+logtest(void)
+{
+    3589:	55                   	push   %ebp
+    358a:	89 e5                	mov    %esp,%ebp
+    358c:	57                   	push   %edi
+    358d:	56                   	push   %esi
+    358e:	53                   	push   %ebx
+    358f:	83 ec 54             	sub    $0x54,%esp
+  struct dirent de;
+  struct stat st;
+  char name[DIRSIZ+1];
+  int fd, i, round;
+
+  printf(1, "log test\n");
+    3592:	68 d3 5f 00 00       	push   $0x5fd3
+    3597:	6a 01                	push   $0x1
+    3599:	e8 f5 16 00 00       	call   4c93 <printf>
+  name[0] = 'L';
+    359e:	c6 45 b5 4c          	movb   $0x4c,-0x4b(%ebp)
+  name[3] = 0;
+    35a2:	c6 45 b8 00          	movb   $0x0,-0x48(%ebp)
+  for(round = 0; round < 4; round++){
+    35a6:	83 c4 10             	add    $0x10,%esp
+    35a9:	be 00 00 00 00       	mov    $0x0,%esi
+    35ae:	eb 2f                	jmp    35df <logtest+0x56>
+    for(i = 0; i < 40; i++){
+      name[1] = '0' + i / 10;
+      name[2] = '0' + i % 10;
+      fd = open(name, O_CREATE|O_RDWR);
+      if(fd < 0){
+        printf(1, "log create %s failed\n", name);
+    35b0:	83 ec 04             	sub    $0x4,%esp
+    35b3:	8d 45 b5             	lea    -0x4b(%ebp),%eax
+    35b6:	50                   	push   %eax
+    35b7:	68 dd 5f 00 00       	push   $0x5fdd
+    35bc:	6a 01                	push   $0x1
+    35be:	e8 d0 16 00 00       	call   4c93 <printf>
+        exit();
+    35c3:	e8 f4 14 00 00       	call   4abc <exit>
+      }
+      buf[0] = round;
+      buf[1] = i;
+      if(write(fd, buf, 512) != 512){
+        printf(1, "log write failed\n");
+    35c8:	83 ec 08             	sub    $0x8,%esp
+    35cb:	68 f3 5f 00 00       	push   $0x5ff3
+    35d0:	6a 01                	push   $0x1
+    35d2:	e8 bc 16 00 00       	call   4c93 <printf>
+        exit();
+    35d7:	e8 e0 14 00 00       	call   4abc <exit>
+  for(round = 0; round < 4; round++){
+    35dc:	83 c6 01             	add    $0x1,%esi
+    35df:	83 fe 03             	cmp    $0x3,%esi
+    35e2:	0f 8f 92 00 00 00    	jg     367a <logtest+0xf1>
+    for(i = 0; i < 40; i++){
+    35e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    35ed:	83 fb 27             	cmp    $0x27,%ebx
+    35f0:	7f ea                	jg     35dc <logtest+0x53>
+      name[1] = '0' + i / 10;
+    35f2:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    35f7:	89 d8                	mov    %ebx,%eax
+    35f9:	f7 ea                	imul   %edx
+    35fb:	c1 fa 02             	sar    $0x2,%edx
+    35fe:	89 d8                	mov    %ebx,%eax
+    3600:	c1 f8 1f             	sar    $0x1f,%eax
+    3603:	29 c2                	sub    %eax,%edx
+    3605:	8d 42 30             	lea    0x30(%edx),%eax
+    3608:	88 45 b6             	mov    %al,-0x4a(%ebp)
+      name[2] = '0' + i % 10;
+    360b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    360e:	01 d2                	add    %edx,%edx
+    3610:	89 d8                	mov    %ebx,%eax
+    3612:	29 d0                	sub    %edx,%eax
+    3614:	83 c0 30             	add    $0x30,%eax
+    3617:	88 45 b7             	mov    %al,-0x49(%ebp)
+      fd = open(name, O_CREATE|O_RDWR);
+    361a:	83 ec 08             	sub    $0x8,%esp
+    361d:	68 02 02 00 00       	push   $0x202
+    3622:	8d 45 b5             	lea    -0x4b(%ebp),%eax
+    3625:	50                   	push   %eax
+    3626:	e8 d1 14 00 00       	call   4afc <open>
+    362b:	89 c7                	mov    %eax,%edi
+      if(fd < 0){
+    362d:	83 c4 10             	add    $0x10,%esp
+    3630:	85 c0                	test   %eax,%eax
+    3632:	0f 88 78 ff ff ff    	js     35b0 <logtest+0x27>
+      buf[0] = round;
+    3638:	89 f0                	mov    %esi,%eax
+    363a:	a2 a0 cf 00 00       	mov    %al,0xcfa0
+      buf[1] = i;
+    363f:	88 1d a1 cf 00 00    	mov    %bl,0xcfa1
+      if(write(fd, buf, 512) != 512){
+    3645:	83 ec 04             	sub    $0x4,%esp
+    3648:	68 00 02 00 00       	push   $0x200
+    364d:	68 a0 cf 00 00       	push   $0xcfa0
+    3652:	57                   	push   %edi
+    3653:	e8 84 14 00 00       	call   4adc <write>
+    3658:	83 c4 10             	add    $0x10,%esp
+    365b:	3d 00 02 00 00       	cmp    $0x200,%eax
+    3660:	0f 85 62 ff ff ff    	jne    35c8 <logtest+0x3f>
+      }
+      close(fd);
+    3666:	83 ec 0c             	sub    $0xc,%esp
+    3669:	57                   	push   %edi
+    366a:	e8 75 14 00 00       	call   4ae4 <close>
+    for(i = 0; i < 40; i++){
+    366f:	83 c3 01             	add    $0x1,%ebx
+    3672:	83 c4 10             	add    $0x10,%esp
+    3675:	e9 73 ff ff ff       	jmp    35ed <logtest+0x64>
+    }
+  }
+
+  // Re-read every inode in the directory, from disk if the
+  // kernel allows dropping the cache.
+  bdrop();
+    367a:	e8 5d 15 00 00       	call   4bdc <bdrop>
+  fd = open(".", O_RDONLY);
+    367f:	83 ec 08             	sub    $0x8,%esp
+    3682:	6a 00                	push   $0x0
+    3684:	68 b6 57 00 00       	push   $0x57b6
+    3689:	e8 6e 14 00 00       	call   4afc <open>
+    368e:	89 c3                	mov    %eax,%ebx
+  while(read(fd, &de, sizeof(de)) == sizeof(de)){
+    3690:	83 c4 10             	add    $0x10,%esp
+    3693:	83 ec 04             	sub    $0x4,%esp
+    3696:	6a 10                	push   $0x10
+    3698:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    369b:	50                   	push   %eax
+    369c:	53                   	push   %ebx
+    369d:	e8 32 14 00 00       	call   4ad4 <read>
+    36a2:	83 c4 10             	add    $0x10,%esp
+    36a5:	83 f8 10             	cmp    $0x10,%eax
+    36a8:	75 62                	jne    370c <logtest+0x183>
+    if(de.inum == 0)
+    36aa:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+    36af:	74 e2                	je     3693 <logtest+0x10a>
+      continue;
+    memmove(name, de.name, DIRSIZ);
+    36b1:	83 ec 04             	sub    $0x4,%esp
+    36b4:	6a 0e                	push   $0xe
+    36b6:	8d 45 da             	lea    -0x26(%ebp),%eax
+    36b9:	50                   	push   %eax
+    36ba:	8d 75 b5             	lea    -0x4b(%ebp),%esi
+    36bd:	56                   	push   %esi
+    36be:	e8 c5 13 00 00       	call   4a88 <memmove>
+    name[DIRSIZ] = 0;
+    36c3:	c6 45 c3 00          	movb   $0x0,-0x3d(%ebp)
+    if(stat(name, &st) < 0 || st.ino != de.inum || st.type == 0 || st.nlink < 1){
+    36c7:	83 c4 08             	add    $0x8,%esp
+    36ca:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+    36cd:	50                   	push   %eax
+    36ce:	56                   	push   %esi
+    36cf:	e8 40 13 00 00       	call   4a14 <stat>
+    36d4:	83 c4 10             	add    $0x10,%esp
+    36d7:	85 c0                	test   %eax,%eax
+    36d9:	78 17                	js     36f2 <logtest+0x169>
+    36db:	0f b7 45 d8          	movzwl -0x28(%ebp),%eax
+    36df:	39 45 cc             	cmp    %eax,-0x34(%ebp)
+    36e2:	75 0e                	jne    36f2 <logtest+0x169>
+    36e4:	66 83 7d c4 00       	cmpw   $0x0,-0x3c(%ebp)
+    36e9:	74 07                	je     36f2 <logtest+0x169>
+    36eb:	66 83 7d d0 00       	cmpw   $0x0,-0x30(%ebp)
+    36f0:	7f a1                	jg     3693 <logtest+0x10a>
+      printf(1, "log inode %d (%s) corrupt\n", de.inum, name);
+    36f2:	8d 45 b5             	lea    -0x4b(%ebp),%eax
+    36f5:	50                   	push   %eax
+    36f6:	0f b7 45 d8          	movzwl -0x28(%ebp),%eax
+    36fa:	50                   	push   %eax
+    36fb:	68 05 60 00 00       	push   $0x6005
+    3700:	6a 01                	push   $0x1
+    3702:	e8 8c 15 00 00       	call   4c93 <printf>
+      exit();
+    3707:	e8 b0 13 00 00       	call   4abc <exit>
+    }
+  }
+  close(fd);
+    370c:	83 ec 0c             	sub    $0xc,%esp
+    370f:	53                   	push   %ebx
+    3710:	e8 cf 13 00 00       	call   4ae4 <close>
+
+  name[3] = 0;
+    3715:	c6 45 b8 00          	movb   $0x0,-0x48(%ebp)
+  for(i = 0; i < 40; i++){
+    3719:	83 c4 10             	add    $0x10,%esp
+    371c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    3721:	83 fb 27             	cmp    $0x27,%ebx
+    3724:	0f 8f a7 00 00 00    	jg     37d1 <logtest+0x248>
+    name[1] = '0' + i / 10;
+    372a:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    372f:	89 d8                	mov    %ebx,%eax
+    3731:	f7 ea                	imul   %edx
+    3733:	c1 fa 02             	sar    $0x2,%edx
+    3736:	89 d8                	mov    %ebx,%eax
+    3738:	c1 f8 1f             	sar    $0x1f,%eax
+    373b:	29 c2                	sub    %eax,%edx
+    373d:	8d 42 30             	lea    0x30(%edx),%eax
+    3740:	88 45 b6             	mov    %al,-0x4a(%ebp)
+    name[2] = '0' + i % 10;
+    3743:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    3746:	01 d2                	add    %edx,%edx
+    3748:	89 d8                	mov    %ebx,%eax
+    374a:	29 d0                	sub    %edx,%eax
+    374c:	83 c0 30             	add    $0x30,%eax
+    374f:	88 45 b7             	mov    %al,-0x49(%ebp)
+    fd = open(name, O_RDONLY);
+    3752:	83 ec 08             	sub    $0x8,%esp
+    3755:	6a 00                	push   $0x0
+    3757:	8d 45 b5             	lea    -0x4b(%ebp),%eax
+    375a:	50                   	push   %eax
+    375b:	e8 9c 13 00 00       	call   4afc <open>
+    3760:	89 c6                	mov    %eax,%esi
+    if(fd < 0 || read(fd, buf, 512) != 512 || buf[0] != 3 || buf[1] != i){
+    3762:	83 c4 10             	add    $0x10,%esp
+    3765:	85 c0                	test   %eax,%eax
+    3767:	78 50                	js     37b9 <logtest+0x230>
+    3769:	83 ec 04             	sub    $0x4,%esp
+    376c:	68 00 02 00 00       	push   $0x200
+    3771:	68 a0 cf 00 00       	push   $0xcfa0
+    3776:	50                   	push   %eax
+    3777:	e8 58 13 00 00       	call   4ad4 <read>
+    377c:	83 c4 10             	add    $0x10,%esp
+    377f:	3d 00 02 00 00       	cmp    $0x200,%eax
+    3784:	75 33                	jne    37b9 <logtest+0x230>
+    3786:	80 3d a0 cf 00 00 03 	cmpb   $0x3,0xcfa0
+    378d:	75 2a                	jne    37b9 <logtest+0x230>
+    378f:	0f be 05 a1 cf 00 00 	movsbl 0xcfa1,%eax
+    3796:	39 d8                	cmp    %ebx,%eax
+    3798:	75 1f                	jne    37b9 <logtest+0x230>
+      printf(1, "log read %s failed\n", name);
+      exit();
+    }
+    close(fd);
+    379a:	83 ec 0c             	sub    $0xc,%esp
+    379d:	56                   	push   %esi
+    379e:	e8 41 13 00 00       	call   4ae4 <close>
+    unlink(name);
+    37a3:	8d 45 b5             	lea    -0x4b(%ebp),%eax
+    37a6:	89 04 24             	mov    %eax,(%esp)
+    37a9:	e8 5e 13 00 00       	call   4b0c <unlink>
+  for(i = 0; i < 40; i++){
+    37ae:	83 c3 01             	add    $0x1,%ebx
+    37b1:	83 c4 10             	add    $0x10,%esp
+    37b4:	e9 68 ff ff ff       	jmp    3721 <logtest+0x198>
+      printf(1, "log read %s failed\n", name);
+    37b9:	83 ec 04             	sub    $0x4,%esp
+    37bc:	8d 45 b5             	lea    -0x4b(%ebp),%eax
+    37bf:	50                   	push   %eax
+    37c0:	68 20 60 00 00       	push   $0x6020
+    37c5:	6a 01                	push   $0x1
+    37c7:	e8 c7 14 00 00       	call   4c93 <printf>
+      exit();
+    37cc:	e8 eb 12 00 00       	call   4abc <exit>
+  }
+  printf(1, "log test OK\n");
+    37d1:	83 ec 08             	sub    $0x8,%esp
+    37d4:	68 34 60 00 00       	push   $0x6034
+    37d9:	6a 01                	push   $0x1
+    37db:	e8 b3 14 00 00       	call   4c93 <printf>
+}
+    37e0:	83 c4 10             	add    $0x10,%esp
+    37e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    37e6:	5b                   	pop    %ebx
+    37e7:	5e                   	pop    %esi
+    37e8:	5f                   	pop    %edi
+    37e9:	5d                   	pop    %ebp
+    37ea:	c3                   	ret
+
+000037eb <bcachetest>:
+
+// Blocks just written are found in the buffer cache when
+// read back.
+void
+bcachetest(void)
+{
+    37eb:	55                   	push   %ebp
+    37ec:	89 e5                	mov    %esp,%ebp
+    37ee:	56                   	push   %esi
+    37ef:	53                   	push   %ebx
+  static struct bstat st0, st1;
+  static char buf[BSIZE];
+  int fd, i;
+
+  printf(1, "bcache test\n");
+    37f0:	83 ec 08             	sub    $0x8,%esp
+    37f3:	68 41 60 00 00       	push   $0x6041
+    37f8:	6a 01                	push   $0x1
+    37fa:	e8 94 14 00 00       	call   4c93 <printf>
+  unlink("bcachefile");
+    37ff:	c7 04 24 4e 60 00 00 	movl   $0x604e,(%esp)
+    3806:	e8 01 13 00 00       	call   4b0c <unlink>
+  fd = open("bcachefile", O_CREATE|O_RDWR);
+    380b:	83 c4 08             	add    $0x8,%esp
+    380e:	68 02 02 00 00       	push   $0x202
+    3813:	68 4e 60 00 00       	push   $0x604e
+    3818:	e8 df 12 00 00       	call   4afc <open>
+  if(fd < 0){
+    381d:	83 c4 10             	add    $0x10,%esp
+    3820:	85 c0                	test   %eax,%eax
+    3822:	78 34                	js     3858 <bcachetest+0x6d>
+    3824:	89 c6                	mov    %eax,%esi
+    printf(1, "bcache create failed\n");
+    exit();
+  }
+  for(i = 0; i < 20; i++){
+    3826:	bb 00 00 00 00       	mov    $0x0,%ebx
+    382b:	83 fb 13             	cmp    $0x13,%ebx
+    382e:	7f 50                	jg     3880 <bcachetest+0x95>
+    buf[0] = i;
+    3830:	88 1d e0 f7 00 00    	mov    %bl,0xf7e0
+    if(write(fd, buf, BSIZE) != BSIZE){
+    3836:	83 ec 04             	sub    $0x4,%esp
+    3839:	68 00 02 00 00       	push   $0x200
+    383e:	68 e0 f7 00 00       	push   $0xf7e0
+    3843:	56                   	push   %esi
+    3844:	e8 93 12 00 00       	call   4adc <write>
+    3849:	83 c4 10             	add    $0x10,%esp
+    384c:	3d 00 02 00 00       	cmp    $0x200,%eax
+    3851:	75 19                	jne    386c <bcachetest+0x81>
+  for(i = 0; i < 20; i++){
+    3853:	83 c3 01             	add    $0x1,%ebx
+    3856:	eb d3                	jmp    382b <bcachetest+0x40>
+    printf(1, "bcache create failed\n");
+    3858:	83 ec 08             	sub    $0x8,%esp
+    385b:	68 59 60 00 00       	push   $0x6059
+    3860:	6a 01                	push   $0x1
+    3862:	e8 2c 14 00 00       	call   4c93 <printf>
+    exit();
+    3867:	e8 50 12 00 00       	call   4abc <exit>
+      printf(1, "bcache write failed\n");
+    386c:	83 ec 08             	sub    $0x8,%esp
+    386f:	68 6f 60 00 00       	push   $0x606f
+    3874:	6a 01                	push   $0x1
+    3876:	e8 18 14 00 00       	call   4c93 <printf>
+      exit();
+    387b:	e8 3c 12 00 00       	call   4abc <exit>
+    }
+  }
+  close(fd);
+    3880:	83 ec 0c             	sub    $0xc,%esp
+    3883:	56                   	push   %esi
+    3884:	e8 5b 12 00 00       	call   4ae4 <close>
+  if(bstat(&st0) < 0){
+    3889:	c7 04 24 c0 f7 00 00 	movl   $0xf7c0,(%esp)
+    3890:	e8 2f 13 00 00       	call   4bc4 <bstat>
+    3895:	83 c4 10             	add    $0x10,%esp
+    3898:	85 c0                	test   %eax,%eax
+    389a:	78 4b                	js     38e7 <bcachetest+0xfc>
+    printf(1, "bstat failed\n");
+    exit();
+  }
+  fd = open("bcachefile", O_RDONLY);
+    389c:	83 ec 08             	sub    $0x8,%esp
+    389f:	6a 00                	push   $0x0
+    38a1:	68 4e 60 00 00       	push   $0x604e
+    38a6:	e8 51 12 00 00       	call   4afc <open>
+    38ab:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    38ad:	83 c4 10             	add    $0x10,%esp
+    38b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    38b5:	83 fb 13             	cmp    $0x13,%ebx
+    38b8:	7f 55                	jg     390f <bcachetest+0x124>
+    if(read(fd, buf, BSIZE) != BSIZE || buf[0] != i){
+    38ba:	83 ec 04             	sub    $0x4,%esp
+    38bd:	68 00 02 00 00       	push   $0x200
+    38c2:	68 e0 f7 00 00       	push   $0xf7e0
+    38c7:	56                   	push   %esi
+    38c8:	e8 07 12 00 00       	call   4ad4 <read>
+    38cd:	83 c4 10             	add    $0x10,%esp
+    38d0:	3d 00 02 00 00       	cmp    $0x200,%eax
+    38d5:	75 24                	jne    38fb <bcachetest+0x110>
+    38d7:	0f be 05 e0 f7 00 00 	movsbl 0xf7e0,%eax
+    38de:	39 d8                	cmp    %ebx,%eax
+    38e0:	75 19                	jne    38fb <bcachetest+0x110>
+  for(i = 0; i < 20; i++){
+    38e2:	83 c3 01             	add    $0x1,%ebx
+    38e5:	eb ce                	jmp    38b5 <bcachetest+0xca>
+    printf(1, "bstat failed\n");
+    38e7:	83 ec 08             	sub    $0x8,%esp
+    38ea:	68 18 61 00 00       	push   $0x6118
+    38ef:	6a 01                	push   $0x1
+    38f1:	e8 9d 13 00 00       	call   4c93 <printf>
+    exit();
+    38f6:	e8 c1 11 00 00       	call   4abc <exit>
+      printf(1, "bcache read failed\n");
+    38fb:	83 ec 08             	sub    $0x8,%esp
+    38fe:	68 84 60 00 00       	push   $0x6084
+    3903:	6a 01                	push   $0x1
+    3905:	e8 89 13 00 00       	call   4c93 <printf>
+      exit();
+    390a:	e8 ad 11 00 00       	call   4abc <exit>
+    }
+  }
+  close(fd);
+    390f:	83 ec 0c             	sub    $0xc,%esp
+    3912:	56                   	push   %esi
+    3913:	e8 cc 11 00 00       	call   4ae4 <close>
+  bstat(&st1);
+    3918:	c7 04 24 a0 f7 00 00 	movl   $0xf7a0,(%esp)
+    391f:	e8 a0 12 00 00       	call   4bc4 <bstat>
+  if(st1.hits - st0.hits < 20 || st1.misses != st0.misses){
+    3924:	a1 b0 f7 00 00       	mov    0xf7b0,%eax
+    3929:	2b 05 d0 f7 00 00    	sub    0xf7d0,%eax
+    392f:	83 c4 10             	add    $0x10,%esp
+    3932:	83 f8 13             	cmp    $0x13,%eax
+    3935:	76 51                	jbe    3988 <bcachetest+0x19d>
+    3937:	8b 0d d4 f7 00 00    	mov    0xf7d4,%ecx
+    393d:	39 0d b4 f7 00 00    	cmp    %ecx,0xf7b4
+    3943:	75 43                	jne    3988 <bcachetest+0x19d>
+    printf(1, "bcache read back missed: %d hits, %d misses\n",
+           st1.hits - st0.hits, st1.misses - st0.misses);
+    exit();
+  }
+  if(st1.nbuf > st1.maxbuf || st1.nin + st1.nam != st1.nbuf){
+    3945:	8b 15 a0 f7 00 00    	mov    0xf7a0,%edx
+    394b:	3b 15 a4 f7 00 00    	cmp    0xf7a4,%edx
+    3951:	7f 54                	jg     39a7 <bcachetest+0x1bc>
+    3953:	a1 ac f7 00 00       	mov    0xf7ac,%eax
+    3958:	03 05 a8 f7 00 00    	add    0xf7a8,%eax
+    395e:	39 c2                	cmp    %eax,%edx
+    3960:	75 45                	jne    39a7 <bcachetest+0x1bc>
+    printf(1, "bcache counts inconsistent\n");
+    exit();
+  }
+  unlink("bcachefile");
+    3962:	83 ec 0c             	sub    $0xc,%esp
+    3965:	68 4e 60 00 00       	push   $0x604e
+    396a:	e8 9d 11 00 00       	call   4b0c <unlink>
+  printf(1, "bcache test OK\n");
+    396f:	83 c4 08             	add    $0x8,%esp
+    3972:	68 b4 60 00 00       	push   $0x60b4
+    3977:	6a 01                	push   $0x1
+    3979:	e8 15 13 00 00       	call   4c93 <printf>
+}
+    397e:	83 c4 10             	add    $0x10,%esp
+    3981:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3984:	5b                   	pop    %ebx
+    3985:	5e                   	pop    %esi
+    3986:	5d                   	pop    %ebp
+    3987:	c3                   	ret
+    printf(1, "bcache read back missed: %d hits, %d misses\n",
+    3988:	8b 15 b4 f7 00 00    	mov    0xf7b4,%edx
+    398e:	2b 15 d4 f7 00 00    	sub    0xf7d4,%edx
+    3994:	52                   	push   %edx
+    3995:	50                   	push   %eax
+    3996:	68 9c 6a 00 00       	push   $0x6a9c
+    399b:	6a 01                	push   $0x1
+    399d:	e8 f1 12 00 00       	call   4c93 <printf>
+    exit();
+    39a2:	e8 15 11 00 00       	call   4abc <exit>
+    printf(1, "bcache counts inconsistent\n");
+    39a7:	83 ec 08             	sub    $0x8,%esp
+    39aa:	68 98 60 00 00       	push   $0x6098
+    39af:	6a 01                	push   $0x1
+    39b1:	e8 dd 12 00 00       	call   4c93 <printf>
+    exit();
+    39b6:	e8 01 11 00 00       	call   4abc <exit>
+
+000039bb <aiotest>:
+
+// Start several asynchronous reads and finish them out of order.
+void
+aiotest(void)
+{
+    39bb:	55                   	push   %ebp
+    39bc:	89 e5                	mov    %esp,%ebp
+    39be:	56                   	push   %esi
+    39bf:	53                   	push   %ebx
+    39c0:	83 ec 18             	sub    $0x18,%esp
+  static char buf[3*BSIZE];
+  int fd, i, id[3];
+
+  printf(1, "aio test\n");
+    39c3:	68 c4 60 00 00       	push   $0x60c4
+    39c8:	6a 01                	push   $0x1
+    39ca:	e8 c4 12 00 00       	call   4c93 <printf>
+  unlink("aiofile");
+    39cf:	c7 04 24 ce 60 00 00 	movl   $0x60ce,(%esp)
+    39d6:	e8 31 11 00 00       	call   4b0c <unlink>
+  fd = open("aiofile", O_CREATE|O_RDWR);
+    39db:	83 c4 08             	add    $0x8,%esp
+    39de:	68 02 02 00 00       	push   $0x202
+    39e3:	68 ce 60 00 00       	push   $0x60ce
+    39e8:	e8 0f 11 00 00       	call   4afc <open>
+    39ed:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < sizeof(buf); i++)
+    39ef:	83 c4 10             	add    $0x10,%esp
+    39f2:	ba 00 00 00 00       	mov    $0x0,%edx
+    39f7:	eb 1a                	jmp    3a13 <aiotest+0x58>
+    buf[i] = i / BSIZE + 'a';
+    39f9:	8d 82 ff 01 00 00    	lea    0x1ff(%edx),%eax
+    39ff:	85 d2                	test   %edx,%edx
+    3a01:	0f 49 c2             	cmovns %edx,%eax
+    3a04:	c1 f8 09             	sar    $0x9,%eax
+    3a07:	83 c0 61             	add    $0x61,%eax
+    3a0a:	88 82 a0 f1 00 00    	mov    %al,0xf1a0(%edx)
+  for(i = 0; i < sizeof(buf); i++)
+    3a10:	83 c2 01             	add    $0x1,%edx
+    3a13:	81 fa ff 05 00 00    	cmp    $0x5ff,%edx
+    3a19:	76 de                	jbe    39f9 <aiotest+0x3e>
+  if(fd < 0 || write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    3a1b:	85 db                	test   %ebx,%ebx
+    3a1d:	0f 88 81 00 00 00    	js     3aa4 <aiotest+0xe9>
+    3a23:	83 ec 04             	sub    $0x4,%esp
+    3a26:	68 00 06 00 00       	push   $0x600
+    3a2b:	68 a0 f1 00 00       	push   $0xf1a0
+    3a30:	53                   	push   %ebx
+    3a31:	e8 a6 10 00 00       	call   4adc <write>
+    3a36:	83 c4 10             	add    $0x10,%esp
+    3a39:	3d 00 06 00 00       	cmp    $0x600,%eax
+    3a3e:	75 64                	jne    3aa4 <aiotest+0xe9>
+    printf(1, "aio create failed\n");
+    exit();
+  }
+  close(fd);
+    3a40:	83 ec 0c             	sub    $0xc,%esp
+    3a43:	53                   	push   %ebx
+    3a44:	e8 9b 10 00 00       	call   4ae4 <close>
+
+  fd = open("aiofile", O_RDONLY);
+    3a49:	83 c4 08             	add    $0x8,%esp
+    3a4c:	6a 00                	push   $0x0
+    3a4e:	68 ce 60 00 00       	push   $0x60ce
+    3a53:	e8 a4 10 00 00       	call   4afc <open>
+    3a58:	89 c6                	mov    %eax,%esi
+  memset(buf, 0, sizeof(buf));
+    3a5a:	83 c4 0c             	add    $0xc,%esp
+    3a5d:	68 00 06 00 00       	push   $0x600
+    3a62:	6a 00                	push   $0x0
+    3a64:	68 a0 f1 00 00       	push   $0xf1a0
+    3a69:	e8 13 0f 00 00       	call   4981 <memset>
+  for(i = 0; i < 3; i++){
+    3a6e:	83 c4 10             	add    $0x10,%esp
+    3a71:	bb 00 00 00 00       	mov    $0x0,%ebx
+    3a76:	83 fb 02             	cmp    $0x2,%ebx
+    3a79:	7f 51                	jg     3acc <aiotest+0x111>
+    if((id[i] = aread(fd, buf + i*BSIZE, BSIZE)) < 0){
+    3a7b:	89 d8                	mov    %ebx,%eax
+    3a7d:	c1 e0 09             	shl    $0x9,%eax
+    3a80:	83 ec 04             	sub    $0x4,%esp
+    3a83:	68 00 02 00 00       	push   $0x200
+    3a88:	05 a0 f1 00 00       	add    $0xf1a0,%eax
+    3a8d:	50                   	push   %eax
+    3a8e:	56                   	push   %esi
+    3a8f:	e8 38 11 00 00       	call   4bcc <aread>
+    3a94:	89 44 9d ec          	mov    %eax,-0x14(%ebp,%ebx,4)
+    3a98:	83 c4 10             	add    $0x10,%esp
+    3a9b:	85 c0                	test   %eax,%eax
+    3a9d:	78 19                	js     3ab8 <aiotest+0xfd>
+  for(i = 0; i < 3; i++){
+    3a9f:	83 c3 01             	add    $0x1,%ebx
+    3aa2:	eb d2                	jmp    3a76 <aiotest+0xbb>
+    printf(1, "aio create failed\n");
+    3aa4:	83 ec 08             	sub    $0x8,%esp
+    3aa7:	68 d6 60 00 00       	push   $0x60d6
+    3aac:	6a 01                	push   $0x1
+    3aae:	e8 e0 11 00 00       	call   4c93 <printf>
+    exit();
+    3ab3:	e8 04 10 00 00       	call   4abc <exit>
+      printf(1, "aread failed\n");
+    3ab8:	83 ec 08             	sub    $0x8,%esp
+    3abb:	68 e9 60 00 00       	push   $0x60e9
+    3ac0:	6a 01                	push   $0x1
+    3ac2:	e8 cc 11 00 00       	call   4c93 <printf>
+      exit();
+    3ac7:	e8 f0 0f 00 00       	call   4abc <exit>
+    }
+  }
+  // The reads advanced the offset; the file is now at its end.
+  if(aread(fd, buf, 1) < 0 || read(fd, buf, 1) != 0){
+    3acc:	83 ec 04             	sub    $0x4,%esp
+    3acf:	6a 01                	push   $0x1
+    3ad1:	68 a0 f1 00 00       	push   $0xf1a0
+    3ad6:	56                   	push   %esi
+    3ad7:	e8 f0 10 00 00       	call   4bcc <aread>
+    3adc:	83 c4 10             	add    $0x10,%esp
+    3adf:	85 c0                	test   %eax,%eax
+    3ae1:	78 6b                	js     3b4e <aiotest+0x193>
+    3ae3:	83 ec 04             	sub    $0x4,%esp
+    3ae6:	6a 01                	push   $0x1
+    3ae8:	68 a0 f1 00 00       	push   $0xf1a0
+    3aed:	56                   	push   %esi
+    3aee:	e8 e1 0f 00 00       	call   4ad4 <read>
+    3af3:	83 c4 10             	add    $0x10,%esp
+    3af6:	85 c0                	test   %eax,%eax
+    3af8:	75 54                	jne    3b4e <aiotest+0x193>
+    printf(1, "aread didn't advance the offset\n");
+    exit();
+  }
+  close(fd);
+    3afa:	83 ec 0c             	sub    $0xc,%esp
+    3afd:	56                   	push   %esi
+    3afe:	e8 e1 0f 00 00       	call   4ae4 <close>
+  for(i = 2; i >= 0; i--){
+    3b03:	83 c4 10             	add    $0x10,%esp
+    3b06:	bb 02 00 00 00       	mov    $0x2,%ebx
+    3b0b:	85 db                	test   %ebx,%ebx
+    3b0d:	78 68                	js     3b77 <aiotest+0x1bc>
+    if(await(id[i]) != BSIZE || buf[i*BSIZE] != i + 'a' || buf[i*BSIZE + BSIZE-1] != i + 'a'){
+    3b0f:	83 ec 0c             	sub    $0xc,%esp
+    3b12:	ff 74 9d ec          	push   -0x14(%ebp,%ebx,4)
+    3b16:	e8 b9 10 00 00       	call   4bd4 <await>
+    3b1b:	83 c4 10             	add    $0x10,%esp
+    3b1e:	3d 00 02 00 00       	cmp    $0x200,%eax
+    3b23:	75 3d                	jne    3b62 <aiotest+0x1a7>
+    3b25:	89 d8                	mov    %ebx,%eax
+    3b27:	c1 e0 09             	shl    $0x9,%eax
+    3b2a:	0f be 80 a0 f1 00 00 	movsbl 0xf1a0(%eax),%eax
+    3b31:	8d 53 61             	lea    0x61(%ebx),%edx
+    3b34:	39 d0                	cmp    %edx,%eax
+    3b36:	75 2a                	jne    3b62 <aiotest+0x1a7>
+    3b38:	8d 43 01             	lea    0x1(%ebx),%eax
+    3b3b:	c1 e0 09             	shl    $0x9,%eax
+    3b3e:	0f be 80 9f f1 00 00 	movsbl 0xf19f(%eax),%eax
+    3b45:	39 c2                	cmp    %eax,%edx
+    3b47:	75 19                	jne    3b62 <aiotest+0x1a7>
+  for(i = 2; i >= 0; i--){
+    3b49:	83 eb 01             	sub    $0x1,%ebx
+    3b4c:	eb bd                	jmp    3b0b <aiotest+0x150>
+    printf(1, "aread didn't advance the offset\n");
+    3b4e:	83 ec 08             	sub    $0x8,%esp
+    3b51:	68 cc 6a 00 00       	push   $0x6acc
+    3b56:	6a 01                	push   $0x1
+    3b58:	e8 36 11 00 00       	call   4c93 <printf>
+    exit();
+    3b5d:	e8 5a 0f 00 00       	call   4abc <exit>
+      printf(1, "await %d failed\n", i);
+    3b62:	83 ec 04             	sub    $0x4,%esp
+    3b65:	53                   	push   %ebx
+    3b66:	68 f7 60 00 00       	push   $0x60f7
+    3b6b:	6a 01                	push   $0x1
+    3b6d:	e8 21 11 00 00       	call   4c93 <printf>
+      exit();
+    3b72:	e8 45 0f 00 00       	call   4abc <exit>
+    }
+  }
+  if(await(id[0]) != -1 || await(-1) != -1){
+    3b77:	83 ec 0c             	sub    $0xc,%esp
+    3b7a:	ff 75 ec             	push   -0x14(%ebp)
+    3b7d:	e8 52 10 00 00       	call   4bd4 <await>
+    3b82:	83 c4 10             	add    $0x10,%esp
+    3b85:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3b88:	75 38                	jne    3bc2 <aiotest+0x207>
+    3b8a:	83 ec 0c             	sub    $0xc,%esp
+    3b8d:	6a ff                	push   $0xffffffff
+    3b8f:	e8 40 10 00 00       	call   4bd4 <await>
+    3b94:	83 c4 10             	add    $0x10,%esp
+    3b97:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3b9a:	75 26                	jne    3bc2 <aiotest+0x207>
+    printf(1, "await of a finished read succeeded\n");
+    exit();
+  }
+  unlink("aiofile");
+    3b9c:	83 ec 0c             	sub    $0xc,%esp
+    3b9f:	68 ce 60 00 00       	push   $0x60ce
+    3ba4:	e8 63 0f 00 00       	call   4b0c <unlink>
+  printf(1, "aio test OK\n");
+    3ba9:	83 c4 08             	add    $0x8,%esp
+    3bac:	68 08 61 00 00       	push   $0x6108
+    3bb1:	6a 01                	push   $0x1
+    3bb3:	e8 db 10 00 00       	call   4c93 <printf>
+}
+    3bb8:	83 c4 10             	add    $0x10,%esp
+    3bbb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3bbe:	5b                   	pop    %ebx
+    3bbf:	5e                   	pop    %esi
+    3bc0:	5d                   	pop    %ebp
+    3bc1:	c3                   	ret
+    printf(1, "await of a finished read succeeded\n");
+    3bc2:	83 ec 08             	sub    $0x8,%esp
+    3bc5:	68 f0 6a 00 00       	push   $0x6af0
+    3bca:	6a 01                	push   $0x1
+    3bcc:	e8 c2 10 00 00       	call   4c93 <printf>
+    exit();
+    3bd1:	e8 e6 0e 00 00       	call   4abc <exit>
+
+00003bd6 <filesinuse>:
+
+// Number of struct files allocated from the slab cache.
+int
+filesinuse(void)
+{
+    3bd6:	55                   	push   %ebp
+    3bd7:	89 e5                	mov    %esp,%ebp
+    3bd9:	53                   	push   %ebx
+    3bda:	83 ec 10             	sub    $0x10,%esp
+  static struct slabstat st;
+  int i;
+
+  if(slabstat(&st) < 0){
+    3bdd:	68 20 f0 00 00       	push   $0xf020
+    3be2:	e8 ad 0f 00 00       	call   4b94 <slabstat>
+    3be7:	83 c4 10             	add    $0x10,%esp
+    3bea:	85 c0                	test   %eax,%eax
+    3bec:	78 2f                	js     3c1d <filesinuse+0x47>
+    printf(1, "slabstat failed\n");
+    exit();
+  }
+  for(i = 0; i < st.n; i++)
+    3bee:	bb 00 00 00 00       	mov    $0x0,%ebx
+    3bf3:	39 1d 20 f0 00 00    	cmp    %ebx,0xf020
+    3bf9:	7e 36                	jle    3c31 <filesinuse+0x5b>
+    if(strcmp(st.cache[i].name, "file") == 0)
+    3bfb:	6b c3 2c             	imul   $0x2c,%ebx,%eax
+    3bfe:	05 24 f0 00 00       	add    $0xf024,%eax
+    3c03:	83 ec 08             	sub    $0x8,%esp
+    3c06:	68 54 60 00 00       	push   $0x6054
+    3c0b:	50                   	push   %eax
+    3c0c:	e8 32 0d 00 00       	call   4943 <strcmp>
+    3c11:	83 c4 10             	add    $0x10,%esp
+    3c14:	85 c0                	test   %eax,%eax
+    3c16:	74 2d                	je     3c45 <filesinuse+0x6f>
+  for(i = 0; i < st.n; i++)
+    3c18:	83 c3 01             	add    $0x1,%ebx
+    3c1b:	eb d6                	jmp    3bf3 <filesinuse+0x1d>
+    printf(1, "slabstat failed\n");
+    3c1d:	83 ec 08             	sub    $0x8,%esp
+    3c20:	68 15 61 00 00       	push   $0x6115
+    3c25:	6a 01                	push   $0x1
+    3c27:	e8 67 10 00 00       	call   4c93 <printf>
+    exit();
+    3c2c:	e8 8b 0e 00 00       	call   4abc <exit>
+      return st.cache[i].inuse;
+  printf(1, "no file slab cache\n");
+    3c31:	83 ec 08             	sub    $0x8,%esp
+    3c34:	68 26 61 00 00       	push   $0x6126
+    3c39:	6a 01                	push   $0x1
+    3c3b:	e8 53 10 00 00       	call   4c93 <printf>
+  exit();
+    3c40:	e8 77 0e 00 00       	call   4abc <exit>
+      return st.cache[i].inuse;
+    3c45:	6b db 2c             	imul   $0x2c,%ebx,%ebx
+    3c48:	8b 83 38 f0 00 00    	mov    0xf038(%ebx),%eax
+}
+    3c4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3c51:	c9                   	leave
+    3c52:	c3                   	ret
+
+00003c53 <slabtest>:
+
+// Files come from a slab cache instead of a fixed table,
+// so more than the old limit of 100 can be open at once.
+void
+slabtest(void)
+{
+    3c53:	55                   	push   %ebp
+    3c54:	89 e5                	mov    %esp,%ebp
+    3c56:	57                   	push   %edi
+    3c57:	56                   	push   %esi
+    3c58:	53                   	push   %ebx
+    3c59:	83 ec 44             	sub    $0x44,%esp
+  int go[2], fds[2], i, j, n0, t;
+  char c;
+
+  printf(1, "slab test\n");
+    3c5c:	68 3a 61 00 00       	push   $0x613a
+    3c61:	6a 01                	push   $0x1
+    3c63:	e8 2b 10 00 00       	call   4c93 <printf>
+  n0 = filesinuse();
+    3c68:	e8 69 ff ff ff       	call   3bd6 <filesinuse>
+    3c6d:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  if(pipe(go) != 0){
+    3c70:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    3c73:	89 04 24             	mov    %eax,(%esp)
+    3c76:	e8 51 0e 00 00       	call   4acc <pipe>
+    3c7b:	83 c4 10             	add    $0x10,%esp
+    3c7e:	85 c0                	test   %eax,%eax
+    3c80:	75 19                	jne    3c9b <slabtest+0x48>
+    3c82:	89 c6                	mov    %eax,%esi
+    printf(1, "slab pipe failed\n");
+    exit();
+  }
+  for(i = 0; i < 10; i++){
+    3c84:	89 c7                	mov    %eax,%edi
+    3c86:	83 ff 09             	cmp    $0x9,%edi
+    3c89:	7f 79                	jg     3d04 <slabtest+0xb1>
+    if(fork() == 0){
+    3c8b:	e8 24 0e 00 00       	call   4ab4 <fork>
+    3c90:	89 c3                	mov    %eax,%ebx
+    3c92:	85 c0                	test   %eax,%eax
+    3c94:	74 19                	je     3caf <slabtest+0x5c>
+  for(i = 0; i < 10; i++){
+    3c96:	83 c7 01             	add    $0x1,%edi
+    3c99:	eb eb                	jmp    3c86 <slabtest+0x33>
+    printf(1, "slab pipe failed\n");
+    3c9b:	83 ec 08             	sub    $0x8,%esp
+    3c9e:	68 45 61 00 00       	push   $0x6145
+    3ca3:	6a 01                	push   $0x1
+    3ca5:	e8 e9 0f 00 00       	call   4c93 <printf>
+    exit();
+    3caa:	e8 0d 0e 00 00       	call   4abc <exit>
+      close(go[1]);
+    3caf:	83 ec 0c             	sub    $0xc,%esp
+    3cb2:	ff 75 e4             	push   -0x1c(%ebp)
+    3cb5:	e8 2a 0e 00 00       	call   4ae4 <close>
+      for(j = 0; j < 6; j++){
+    3cba:	83 c4 10             	add    $0x10,%esp
+    3cbd:	83 fb 05             	cmp    $0x5,%ebx
+    3cc0:	7f 2c                	jg     3cee <slabtest+0x9b>
+        if(pipe(fds) != 0){
+    3cc2:	83 ec 0c             	sub    $0xc,%esp
+    3cc5:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    3cc8:	50                   	push   %eax
+    3cc9:	e8 fe 0d 00 00       	call   4acc <pipe>
+    3cce:	83 c4 10             	add    $0x10,%esp
+    3cd1:	85 c0                	test   %eax,%eax
+    3cd3:	75 05                	jne    3cda <slabtest+0x87>
+      for(j = 0; j < 6; j++){
+    3cd5:	83 c3 01             	add    $0x1,%ebx
+    3cd8:	eb e3                	jmp    3cbd <slabtest+0x6a>
+          printf(1, "slab child pipe failed\n");
+    3cda:	83 ec 08             	sub    $0x8,%esp
+    3cdd:	68 57 61 00 00       	push   $0x6157
+    3ce2:	6a 01                	push   $0x1
+    3ce4:	e8 aa 0f 00 00       	call   4c93 <printf>
+          exit();
+    3ce9:	e8 ce 0d 00 00       	call   4abc <exit>
+        }
+      }
+      read(go[0], &c, 1);
+    3cee:	83 ec 04             	sub    $0x4,%esp
+    3cf1:	6a 01                	push   $0x1
+    3cf3:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    3cf6:	50                   	push   %eax
+    3cf7:	ff 75 e0             	push   -0x20(%ebp)
+    3cfa:	e8 d5 0d 00 00       	call   4ad4 <read>
+      exit();
+    3cff:	e8 b8 0d 00 00       	call   4abc <exit>
+    }
+  }
+  for(t = 0; filesinuse() < n0 + 2 + 10*12; t++){
+    3d04:	89 f3                	mov    %esi,%ebx
+    3d06:	e8 cb fe ff ff       	call   3bd6 <filesinuse>
+    3d0b:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+    3d0e:	8d 51 79             	lea    0x79(%ecx),%edx
+    3d11:	39 c2                	cmp    %eax,%edx
+    3d13:	7c 35                	jl     3d4a <slabtest+0xf7>
+    if(t > 500){
+    3d15:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    3d1b:	7f 12                	jg     3d2f <slabtest+0xdc>
+      printf(1, "slab files never reached %d\n", n0 + 2 + 10*12);
+      exit();
+    }
+    sleep(1);
+    3d1d:	83 ec 0c             	sub    $0xc,%esp
+    3d20:	6a 01                	push   $0x1
+    3d22:	e8 25 0e 00 00       	call   4b4c <sleep>
+  for(t = 0; filesinuse() < n0 + 2 + 10*12; t++){
+    3d27:	83 c3 01             	add    $0x1,%ebx
+    3d2a:	83 c4 10             	add    $0x10,%esp
+    3d2d:	eb d7                	jmp    3d06 <slabtest+0xb3>
+      printf(1, "slab files never reached %d\n", n0 + 2 + 10*12);
+    3d2f:	83 ec 04             	sub    $0x4,%esp
+    3d32:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    3d35:	83 c0 7a             	add    $0x7a,%eax
+    3d38:	50                   	push   %eax
+    3d39:	68 6f 61 00 00       	push   $0x616f
+    3d3e:	6a 01                	push   $0x1
+    3d40:	e8 4e 0f 00 00       	call   4c93 <printf>
+      exit();
+    3d45:	e8 72 0d 00 00       	call   4abc <exit>
+  }
+  close(go[0]);
+    3d4a:	83 ec 0c             	sub    $0xc,%esp
+    3d4d:	ff 75 e0             	push   -0x20(%ebp)
+    3d50:	e8 8f 0d 00 00       	call   4ae4 <close>
+  close(go[1]);
+    3d55:	83 c4 04             	add    $0x4,%esp
+    3d58:	ff 75 e4             	push   -0x1c(%ebp)
+    3d5b:	e8 84 0d 00 00       	call   4ae4 <close>
+  for(i = 0; i < 10; i++)
+    3d60:	83 c4 10             	add    $0x10,%esp
+    3d63:	eb 08                	jmp    3d6d <slabtest+0x11a>
+    wait();
+    3d65:	e8 5a 0d 00 00       	call   4ac4 <wait>
+  for(i = 0; i < 10; i++)
+    3d6a:	83 c6 01             	add    $0x1,%esi
+    3d6d:	83 fe 09             	cmp    $0x9,%esi
+    3d70:	7e f3                	jle    3d65 <slabtest+0x112>
+  if(filesinuse() != n0){
+    3d72:	e8 5f fe ff ff       	call   3bd6 <filesinuse>
+    3d77:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+    3d7a:	39 f8                	cmp    %edi,%eax
+    3d7c:	75 1a                	jne    3d98 <slabtest+0x145>
+    printf(1, "slab leaked %d files\n", filesinuse() - n0);
+    exit();
+  }
+  printf(1, "slab test OK\n");
+    3d7e:	83 ec 08             	sub    $0x8,%esp
+    3d81:	68 a2 61 00 00       	push   $0x61a2
+    3d86:	6a 01                	push   $0x1
+    3d88:	e8 06 0f 00 00       	call   4c93 <printf>
+}
+    3d8d:	83 c4 10             	add    $0x10,%esp
+    3d90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3d93:	5b                   	pop    %ebx
+    3d94:	5e                   	pop    %esi
+    3d95:	5f                   	pop    %edi
+    3d96:	5d                   	pop    %ebp
+    3d97:	c3                   	ret
+    printf(1, "slab leaked %d files\n", filesinuse() - n0);
+    3d98:	e8 39 fe ff ff       	call   3bd6 <filesinuse>
+    3d9d:	83 ec 04             	sub    $0x4,%esp
+    3da0:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+    3da3:	29 f0                	sub    %esi,%eax
+    3da5:	50                   	push   %eax
+    3da6:	68 8c 61 00 00       	push   $0x618c
+    3dab:	6a 01                	push   $0x1
+    3dad:	e8 e1 0e 00 00       	call   4c93 <printf>
+    exit();
+    3db2:	e8 05 0d 00 00       	call   4abc <exit>
+
+00003db7 <spawntest>:
+
+// spawn() and spawnn() create children without fork().
+void
+spawntest(void)
+{
+    3db7:	55                   	push   %ebp
+    3db8:	89 e5                	mov    %esp,%ebp
+    3dba:	53                   	push   %ebx
+    3dbb:	83 ec 2c             	sub    $0x2c,%esp
+  int n, pids[4];
+  char *args[] = { "echo", "spawned", 0 };
+    3dbe:	c7 45 dc 25 50 00 00 	movl   $0x5025,-0x24(%ebp)
+    3dc5:	c7 45 e0 b0 61 00 00 	movl   $0x61b0,-0x20(%ebp)
+    3dcc:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+
+  printf(1, "spawn test\n");
+    3dd3:	68 b8 61 00 00       	push   $0x61b8
+    3dd8:	6a 01                	push   $0x1
+    3dda:	e8 b4 0e 00 00       	call   4c93 <printf>
+
+  if(spawn("nosuchprog", args, 1) != -1){
+    3ddf:	83 c4 0c             	add    $0xc,%esp
+    3de2:	6a 01                	push   $0x1
+    3de4:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    3de7:	50                   	push   %eax
+    3de8:	68 c4 61 00 00       	push   $0x61c4
+    3ded:	e8 8a 0d 00 00       	call   4b7c <spawn>
+    3df2:	83 c4 10             	add    $0x10,%esp
+    3df5:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3df8:	75 50                	jne    3e4a <spawntest+0x93>
+    printf(1, "spawn of missing program succeeded\n");
+    exit();
+  }
+  if(spawn("echo", args, 4) != -1){
+    3dfa:	83 ec 04             	sub    $0x4,%esp
+    3dfd:	6a 04                	push   $0x4
+    3dff:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    3e02:	50                   	push   %eax
+    3e03:	68 25 50 00 00       	push   $0x5025
+    3e08:	e8 6f 0d 00 00       	call   4b7c <spawn>
+    3e0d:	83 c4 10             	add    $0x10,%esp
+    3e10:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3e13:	75 49                	jne    3e5e <spawntest+0xa7>
+    printf(1, "spawn with bad priority succeeded\n");
+    exit();
+  }
+
+  n = spawnn("echo", args, 1, 4, pids);
+    3e15:	83 ec 0c             	sub    $0xc,%esp
+    3e18:	8d 45 e8             	lea    -0x18(%ebp),%eax
+    3e1b:	50                   	push   %eax
+    3e1c:	6a 04                	push   $0x4
+    3e1e:	6a 01                	push   $0x1
+    3e20:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    3e23:	50                   	push   %eax
+    3e24:	68 25 50 00 00       	push   $0x5025
+    3e29:	e8 56 0d 00 00       	call   4b84 <spawnn>
+    3e2e:	89 c3                	mov    %eax,%ebx
+  if(n != 4){
+    3e30:	83 c4 20             	add    $0x20,%esp
+    3e33:	83 f8 04             	cmp    $0x4,%eax
+    3e36:	75 3a                	jne    3e72 <spawntest+0xbb>
+    printf(1, "spawnn created %d of 4\n", n);
+    exit();
+  }
+  for(; n > 0; n--){
+    3e38:	85 db                	test   %ebx,%ebx
+    3e3a:	7e 5f                	jle    3e9b <spawntest+0xe4>
+    if(wait() < 0){
+    3e3c:	e8 83 0c 00 00       	call   4ac4 <wait>
+    3e41:	85 c0                	test   %eax,%eax
+    3e43:	78 42                	js     3e87 <spawntest+0xd0>
+  for(; n > 0; n--){
+    3e45:	83 eb 01             	sub    $0x1,%ebx
+    3e48:	eb ee                	jmp    3e38 <spawntest+0x81>
+    printf(1, "spawn of missing program succeeded\n");
+    3e4a:	83 ec 08             	sub    $0x8,%esp
+    3e4d:	68 14 6b 00 00       	push   $0x6b14
+    3e52:	6a 01                	push   $0x1
+    3e54:	e8 3a 0e 00 00       	call   4c93 <printf>
+    exit();
+    3e59:	e8 5e 0c 00 00       	call   4abc <exit>
+    printf(1, "spawn with bad priority succeeded\n");
+    3e5e:	83 ec 08             	sub    $0x8,%esp
+    3e61:	68 38 6b 00 00       	push   $0x6b38
+    3e66:	6a 01                	push   $0x1
+    3e68:	e8 26 0e 00 00       	call   4c93 <printf>
+    exit();
+    3e6d:	e8 4a 0c 00 00       	call   4abc <exit>
+    printf(1, "spawnn created %d of 4\n", n);
+    3e72:	83 ec 04             	sub    $0x4,%esp
+    3e75:	50                   	push   %eax
+    3e76:	68 cf 61 00 00       	push   $0x61cf
+    3e7b:	6a 01                	push   $0x1
+    3e7d:	e8 11 0e 00 00       	call   4c93 <printf>
+    exit();
+    3e82:	e8 35 0c 00 00       	call   4abc <exit>
+      printf(1, "spawn wait stopped early\n");
+    3e87:	83 ec 08             	sub    $0x8,%esp
+    3e8a:	68 e7 61 00 00       	push   $0x61e7
+    3e8f:	6a 01                	push   $0x1
+    3e91:	e8 fd 0d 00 00       	call   4c93 <printf>
+      exit();
+    3e96:	e8 21 0c 00 00       	call   4abc <exit>
+    }
+  }
+  if(wait() != -1){
+    3e9b:	e8 24 0c 00 00       	call   4ac4 <wait>
+    3ea0:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3ea3:	75 17                	jne    3ebc <spawntest+0x105>
+    printf(1, "spawn wait got too many\n");
+    exit();
+  }
+
+  printf(1, "spawn test OK\n");
+    3ea5:	83 ec 08             	sub    $0x8,%esp
+    3ea8:	68 1a 62 00 00       	push   $0x621a
+    3ead:	6a 01                	push   $0x1
+    3eaf:	e8 df 0d 00 00       	call   4c93 <printf>
+}
+    3eb4:	83 c4 10             	add    $0x10,%esp
+    3eb7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3eba:	c9                   	leave
+    3ebb:	c3                   	ret
+    printf(1, "spawn wait got too many\n");
+    3ebc:	83 ec 08             	sub    $0x8,%esp
+    3ebf:	68 01 62 00 00       	push   $0x6201
+    3ec4:	6a 01                	push   $0x1
+    3ec6:	e8 c8 0d 00 00       	call   4c93 <printf>
+    exit();
+    3ecb:	e8 ec 0b 00 00       	call   4abc <exit>
+
+00003ed0 <sbrktest>:
+
+void
+sbrktest(void)
+{
+    3ed0:	55                   	push   %ebp
+    3ed1:	89 e5                	mov    %esp,%ebp
+    3ed3:	57                   	push   %edi
+    3ed4:	56                   	push   %esi
+    3ed5:	53                   	push   %ebx
+    3ed6:	83 ec 54             	sub    $0x54,%esp
+  int fds[2], pid, pids[10], ppid;
+  char *a, *b, *c, *lastaddr, *oldbrk, *p, scratch;
+  uint amt;
+
+  printf(stdout, "sbrk test\n");
+    3ed9:	68 f5 5c 00 00       	push   $0x5cf5
+    3ede:	ff 35 48 78 00 00    	push   0x7848
+    3ee4:	e8 aa 0d 00 00       	call   4c93 <printf>
+  oldbrk = sbrk(0);
+    3ee9:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3ef0:	e8 4f 0c 00 00       	call   4b44 <sbrk>
+    3ef5:	89 c7                	mov    %eax,%edi
+
+  // can one sbrk() less than a page?
+  a = sbrk(0);
+    3ef7:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3efe:	e8 41 0c 00 00       	call   4b44 <sbrk>
+    3f03:	89 c6                	mov    %eax,%esi
+  int i;
+  for(i = 0; i < 5000; i++){
+    3f05:	83 c4 10             	add    $0x10,%esp
+    3f08:	bb 00 00 00 00       	mov    $0x0,%ebx
+    3f0d:	81 fb 87 13 00 00    	cmp    $0x1387,%ebx
+    3f13:	7f 3a                	jg     3f4f <sbrktest+0x7f>
+    b = sbrk(1);
+    3f15:	83 ec 0c             	sub    $0xc,%esp
+    3f18:	6a 01                	push   $0x1
+    3f1a:	e8 25 0c 00 00       	call   4b44 <sbrk>
+    if(b != a){
+    3f1f:	83 c4 10             	add    $0x10,%esp
+    3f22:	39 c6                	cmp    %eax,%esi
+    3f24:	75 0b                	jne    3f31 <sbrktest+0x61>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+      exit();
+    }
+    *b = 1;
+    3f26:	c6 00 01             	movb   $0x1,(%eax)
+    a = b + 1;
+    3f29:	8d 70 01             	lea    0x1(%eax),%esi
+  for(i = 0; i < 5000; i++){
+    3f2c:	83 c3 01             	add    $0x1,%ebx
+    3f2f:	eb dc                	jmp    3f0d <sbrktest+0x3d>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    3f31:	83 ec 0c             	sub    $0xc,%esp
+    3f34:	50                   	push   %eax
+    3f35:	56                   	push   %esi
+    3f36:	53                   	push   %ebx
+    3f37:	68 29 62 00 00       	push   $0x6229
+    3f3c:	ff 35 48 78 00 00    	push   0x7848
+    3f42:	e8 4c 0d 00 00       	call   4c93 <printf>
+      exit();
+    3f47:	83 c4 20             	add    $0x20,%esp
+    3f4a:	e8 6d 0b 00 00       	call   4abc <exit>
+  }
+  pid = fork();
+    3f4f:	e8 60 0b 00 00       	call   4ab4 <fork>
+    3f54:	89 c3                	mov    %eax,%ebx
+  if(pid < 0){
+    3f56:	85 c0                	test   %eax,%eax
+    3f58:	0f 88 53 01 00 00    	js     40b1 <sbrktest+0x1e1>
+    printf(stdout, "sbrk test fork failed\n");
+    exit();
+  }
+  c = sbrk(1);
+    3f5e:	83 ec 0c             	sub    $0xc,%esp
+    3f61:	6a 01                	push   $0x1
+    3f63:	e8 dc 0b 00 00       	call   4b44 <sbrk>
+  c = sbrk(1);
+    3f68:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3f6f:	e8 d0 0b 00 00       	call   4b44 <sbrk>
+  if(c != a + 1){
+    3f74:	83 c6 01             	add    $0x1,%esi
+    3f77:	83 c4 10             	add    $0x10,%esp
+    3f7a:	39 c6                	cmp    %eax,%esi
+    3f7c:	0f 85 47 01 00 00    	jne    40c9 <sbrktest+0x1f9>
+    printf(stdout, "sbrk test failed post-fork\n");
+    exit();
+  }
+  if(pid == 0)
+    3f82:	85 db                	test   %ebx,%ebx
+    3f84:	0f 84 57 01 00 00    	je     40e1 <sbrktest+0x211>
+    exit();
+  wait();
+    3f8a:	e8 35 0b 00 00       	call   4ac4 <wait>
+  // can one grow address space to something big?
+#define BIG (100*1024*1024)
+  a = sbrk(0);
+    3f8f:	83 ec 0c             	sub    $0xc,%esp
+    3f92:	6a 00                	push   $0x0
+    3f94:	e8 ab 0b 00 00       	call   4b44 <sbrk>
+    3f99:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    3f9b:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3fa0:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    3fa2:	89 04 24             	mov    %eax,(%esp)
+    3fa5:	e8 9a 0b 00 00       	call   4b44 <sbrk>
+  if (p != a) {
+    3faa:	83 c4 10             	add    $0x10,%esp
+    3fad:	39 c3                	cmp    %eax,%ebx
+    3faf:	0f 85 31 01 00 00    	jne    40e6 <sbrktest+0x216>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    exit();
+  }
+  lastaddr = (char*) (BIG-1);
+  *lastaddr = 99;
+    3fb5:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  // can one de-allocate?
+  a = sbrk(0);
+    3fbc:	83 ec 0c             	sub    $0xc,%esp
+    3fbf:	6a 00                	push   $0x0
+    3fc1:	e8 7e 0b 00 00       	call   4b44 <sbrk>
+    3fc6:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    3fc8:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+    3fcf:	e8 70 0b 00 00       	call   4b44 <sbrk>
+  if(c == (char*)0xffffffff){
+    3fd4:	83 c4 10             	add    $0x10,%esp
+    3fd7:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3fda:	0f 84 1e 01 00 00    	je     40fe <sbrktest+0x22e>
+    printf(stdout, "sbrk could not deallocate\n");
+    exit();
+  }
+  c = sbrk(0);
+    3fe0:	83 ec 0c             	sub    $0xc,%esp
+    3fe3:	6a 00                	push   $0x0
+    3fe5:	e8 5a 0b 00 00       	call   4b44 <sbrk>
+  if(c != a - 4096){
+    3fea:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    3ff0:	83 c4 10             	add    $0x10,%esp
+    3ff3:	39 c2                	cmp    %eax,%edx
+    3ff5:	0f 85 1b 01 00 00    	jne    4116 <sbrktest+0x246>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    exit();
+  }
+
+  // can one re-allocate that page?
+  a = sbrk(0);
+    3ffb:	83 ec 0c             	sub    $0xc,%esp
+    3ffe:	6a 00                	push   $0x0
+    4000:	e8 3f 0b 00 00       	call   4b44 <sbrk>
+    4005:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    4007:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+    400e:	e8 31 0b 00 00       	call   4b44 <sbrk>
+    4013:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    4015:	83 c4 10             	add    $0x10,%esp
+    4018:	39 c3                	cmp    %eax,%ebx
+    401a:	0f 85 0d 01 00 00    	jne    412d <sbrktest+0x25d>
+    4020:	83 ec 0c             	sub    $0xc,%esp
+    4023:	6a 00                	push   $0x0
+    4025:	e8 1a 0b 00 00       	call   4b44 <sbrk>
+    402a:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    4030:	83 c4 10             	add    $0x10,%esp
+    4033:	39 c2                	cmp    %eax,%edx
+    4035:	0f 85 f2 00 00 00    	jne    412d <sbrktest+0x25d>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    exit();
+  }
+  if(*lastaddr == 99){
+    403b:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    4042:	0f 84 fc 00 00 00    	je     4144 <sbrktest+0x274>
+    // should be zero
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    exit();
+  }
+
+  a = sbrk(0);
+    4048:	83 ec 0c             	sub    $0xc,%esp
+    404b:	6a 00                	push   $0x0
+    404d:	e8 f2 0a 00 00       	call   4b44 <sbrk>
+    4052:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    4054:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    405b:	e8 e4 0a 00 00       	call   4b44 <sbrk>
+    4060:	89 c2                	mov    %eax,%edx
+    4062:	89 f8                	mov    %edi,%eax
+    4064:	29 d0                	sub    %edx,%eax
+    4066:	89 04 24             	mov    %eax,(%esp)
+    4069:	e8 d6 0a 00 00       	call   4b44 <sbrk>
+  if(c != a){
+    406e:	83 c4 10             	add    $0x10,%esp
+    4071:	39 c3                	cmp    %eax,%ebx
+    4073:	0f 85 e3 00 00 00    	jne    415c <sbrktest+0x28c>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    exit();
+  }
+
+  // can we read the kernel's memory?
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    4079:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    407e:	81 fb 7f 84 1e 80    	cmp    $0x801e847f,%ebx
+    4084:	0f 87 23 01 00 00    	ja     41ad <sbrktest+0x2dd>
+    ppid = getpid();
+    408a:	e8 ad 0a 00 00       	call   4b3c <getpid>
+    408f:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    4091:	e8 1e 0a 00 00       	call   4ab4 <fork>
+    if(pid < 0){
+    4096:	85 c0                	test   %eax,%eax
+    4098:	0f 88 d5 00 00 00    	js     4173 <sbrktest+0x2a3>
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+    409e:	0f 84 e7 00 00 00    	je     418b <sbrktest+0x2bb>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+      kill(ppid);
+      exit();
+    }
+    wait();
+    40a4:	e8 1b 0a 00 00       	call   4ac4 <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    40a9:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    40af:	eb cd                	jmp    407e <sbrktest+0x1ae>
+    printf(stdout, "sbrk test fork failed\n");
+    40b1:	83 ec 08             	sub    $0x8,%esp
+    40b4:	68 44 62 00 00       	push   $0x6244
+    40b9:	ff 35 48 78 00 00    	push   0x7848
+    40bf:	e8 cf 0b 00 00       	call   4c93 <printf>
+    exit();
+    40c4:	e8 f3 09 00 00       	call   4abc <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    40c9:	83 ec 08             	sub    $0x8,%esp
+    40cc:	68 5b 62 00 00       	push   $0x625b
+    40d1:	ff 35 48 78 00 00    	push   0x7848
+    40d7:	e8 b7 0b 00 00       	call   4c93 <printf>
+    exit();
+    40dc:	e8 db 09 00 00       	call   4abc <exit>
+    exit();
+    40e1:	e8 d6 09 00 00       	call   4abc <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    40e6:	83 ec 08             	sub    $0x8,%esp
+    40e9:	68 5c 6b 00 00       	push   $0x6b5c
+    40ee:	ff 35 48 78 00 00    	push   0x7848
+    40f4:	e8 9a 0b 00 00       	call   4c93 <printf>
+    exit();
+    40f9:	e8 be 09 00 00       	call   4abc <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    40fe:	83 ec 08             	sub    $0x8,%esp
+    4101:	68 77 62 00 00       	push   $0x6277
+    4106:	ff 35 48 78 00 00    	push   0x7848
+    410c:	e8 82 0b 00 00       	call   4c93 <printf>
+    exit();
+    4111:	e8 a6 09 00 00       	call   4abc <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    4116:	50                   	push   %eax
+    4117:	53                   	push   %ebx
+    4118:	68 9c 6b 00 00       	push   $0x6b9c
+    411d:	ff 35 48 78 00 00    	push   0x7848
+    4123:	e8 6b 0b 00 00       	call   4c93 <printf>
+    exit();
+    4128:	e8 8f 09 00 00       	call   4abc <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    412d:	56                   	push   %esi
+    412e:	53                   	push   %ebx
+    412f:	68 d4 6b 00 00       	push   $0x6bd4
+    4134:	ff 35 48 78 00 00    	push   0x7848
+    413a:	e8 54 0b 00 00       	call   4c93 <printf>
+    exit();
+    413f:	e8 78 09 00 00       	call   4abc <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    4144:	83 ec 08             	sub    $0x8,%esp
+    4147:	68 fc 6b 00 00       	push   $0x6bfc
+    414c:	ff 35 48 78 00 00    	push   0x7848
+    4152:	e8 3c 0b 00 00       	call   4c93 <printf>
+    exit();
+    4157:	e8 60 09 00 00       	call   4abc <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    415c:	50                   	push   %eax
+    415d:	53                   	push   %ebx
+    415e:	68 2c 6c 00 00       	push   $0x6c2c
+    4163:	ff 35 48 78 00 00    	push   0x7848
+    4169:	e8 25 0b 00 00       	call   4c93 <printf>
+    exit();
+    416e:	e8 49 09 00 00       	call   4abc <exit>
+      printf(stdout, "fork failed\n");
+    4173:	83 ec 08             	sub    $0x8,%esp
+    4176:	68 61 63 00 00       	push   $0x6361
+    417b:	ff 35 48 78 00 00    	push   0x7848
+    4181:	e8 0d 0b 00 00       	call   4c93 <printf>
+      exit();
+    4186:	e8 31 09 00 00       	call   4abc <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    418b:	0f be 03             	movsbl (%ebx),%eax
+    418e:	50                   	push   %eax
+    418f:	53                   	push   %ebx
+    4190:	68 92 62 00 00       	push   $0x6292
+    4195:	ff 35 48 78 00 00    	push   0x7848
+    419b:	e8 f3 0a 00 00       	call   4c93 <printf>
+      kill(ppid);
+    41a0:	89 34 24             	mov    %esi,(%esp)
+    41a3:	e8 44 09 00 00       	call   4aec <kill>
+      exit();
+    41a8:	e8 0f 09 00 00       	call   4abc <exit>
+  }
+  // if we run the system out of memory, does it clean up the last
+  // failed allocation?
+  if(pipe(fds) != 0){
+    41ad:	83 ec 0c             	sub    $0xc,%esp
+    41b0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    41b3:	50                   	push   %eax
+    41b4:	e8 13 09 00 00       	call   4acc <pipe>
+    41b9:	89 c3                	mov    %eax,%ebx
+    41bb:	83 c4 10             	add    $0x10,%esp
+    41be:	85 c0                	test   %eax,%eax
+    41c0:	75 04                	jne    41c6 <sbrktest+0x2f6>
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    41c2:	89 c6                	mov    %eax,%esi
+    41c4:	eb 59                	jmp    421f <sbrktest+0x34f>
+    printf(1, "pipe() failed\n");
+    41c6:	83 ec 08             	sub    $0x8,%esp
+    41c9:	68 79 52 00 00       	push   $0x5279
+    41ce:	6a 01                	push   $0x1
+    41d0:	e8 be 0a 00 00       	call   4c93 <printf>
+    exit();
+    41d5:	e8 e2 08 00 00       	call   4abc <exit>
+    if((pids[i] = fork()) == 0){
+      // allocate a lot of memory
+      sbrk(BIG - (uint)sbrk(0));
+    41da:	83 ec 0c             	sub    $0xc,%esp
+    41dd:	6a 00                	push   $0x0
+    41df:	e8 60 09 00 00       	call   4b44 <sbrk>
+    41e4:	89 c2                	mov    %eax,%edx
+    41e6:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    41eb:	29 d0                	sub    %edx,%eax
+    41ed:	89 04 24             	mov    %eax,(%esp)
+    41f0:	e8 4f 09 00 00       	call   4b44 <sbrk>
+      write(fds[1], "x", 1);
+    41f5:	83 c4 0c             	add    $0xc,%esp
+    41f8:	6a 01                	push   $0x1
+    41fa:	68 99 58 00 00       	push   $0x5899
+    41ff:	ff 75 e4             	push   -0x1c(%ebp)
+    4202:	e8 d5 08 00 00       	call   4adc <write>
+    4207:	83 c4 10             	add    $0x10,%esp
+      // sit around until killed
+      for(;;) {
+          sleep(1000);
+    420a:	83 ec 0c             	sub    $0xc,%esp
+    420d:	68 e8 03 00 00       	push   $0x3e8
+    4212:	e8 35 09 00 00       	call   4b4c <sleep>
+    4217:	83 c4 10             	add    $0x10,%esp
+    421a:	eb ee                	jmp    420a <sbrktest+0x33a>
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    421c:	83 c6 01             	add    $0x1,%esi
+    421f:	83 fe 09             	cmp    $0x9,%esi
+    4222:	77 28                	ja     424c <sbrktest+0x37c>
+    if((pids[i] = fork()) == 0){
+    4224:	e8 8b 08 00 00       	call   4ab4 <fork>
+    4229:	89 44 b5 b8          	mov    %eax,-0x48(%ebp,%esi,4)
+    422d:	85 c0                	test   %eax,%eax
+    422f:	74 a9                	je     41da <sbrktest+0x30a>
+      }
+    }
+    if(pids[i] != -1)
+    4231:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4234:	74 e6                	je     421c <sbrktest+0x34c>
+      read(fds[0], &scratch, 1);
+    4236:	83 ec 04             	sub    $0x4,%esp
+    4239:	6a 01                	push   $0x1
+    423b:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    423e:	50                   	push   %eax
+    423f:	ff 75 e0             	push   -0x20(%ebp)
+    4242:	e8 8d 08 00 00       	call   4ad4 <read>
+    4247:	83 c4 10             	add    $0x10,%esp
+    424a:	eb d0                	jmp    421c <sbrktest+0x34c>
+  }
+  // if those failed allocations freed up the pages they did allocate,
+  // we'll be able to allocate here
+  c = sbrk(4096);
+    424c:	83 ec 0c             	sub    $0xc,%esp
+    424f:	68 00 10 00 00       	push   $0x1000
+    4254:	e8 eb 08 00 00       	call   4b44 <sbrk>
+    4259:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    425b:	83 c4 10             	add    $0x10,%esp
+    425e:	eb 03                	jmp    4263 <sbrktest+0x393>
+    4260:	83 c3 01             	add    $0x1,%ebx
+    4263:	83 fb 09             	cmp    $0x9,%ebx
+    4266:	77 1c                	ja     4284 <sbrktest+0x3b4>
+    if(pids[i] == -1)
+    4268:	8b 44 9d b8          	mov    -0x48(%ebp,%ebx,4),%eax
+    426c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    426f:	74 ef                	je     4260 <sbrktest+0x390>
+      continue;
+    kill(pids[i]);
+    4271:	83 ec 0c             	sub    $0xc,%esp
+    4274:	50                   	push   %eax
+    4275:	e8 72 08 00 00       	call   4aec <kill>
+    wait();
+    427a:	e8 45 08 00 00       	call   4ac4 <wait>
+    427f:	83 c4 10             	add    $0x10,%esp
+    4282:	eb dc                	jmp    4260 <sbrktest+0x390>
+  }
+  if(c == (char*)0xffffffff){
+    4284:	83 fe ff             	cmp    $0xffffffff,%esi
+    4287:	74 2f                	je     42b8 <sbrktest+0x3e8>
+    printf(stdout, "failed sbrk leaked memory\n");
+    exit();
+  }
+
+  if(sbrk(0) > oldbrk)
+    4289:	83 ec 0c             	sub    $0xc,%esp
+    428c:	6a 00                	push   $0x0
+    428e:	e8 b1 08 00 00       	call   4b44 <sbrk>
+    4293:	83 c4 10             	add    $0x10,%esp
+    4296:	39 c7                	cmp    %eax,%edi
+    4298:	72 36                	jb     42d0 <sbrktest+0x400>
+    sbrk(-(sbrk(0) - oldbrk));
+
+  printf(stdout, "sbrk test OK\n");
+    429a:	83 ec 08             	sub    $0x8,%esp
+    429d:	68 58 5d 00 00       	push   $0x5d58
+    42a2:	ff 35 48 78 00 00    	push   0x7848
+    42a8:	e8 e6 09 00 00       	call   4c93 <printf>
+}
+    42ad:	83 c4 10             	add    $0x10,%esp
+    42b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    42b3:	5b                   	pop    %ebx
+    42b4:	5e                   	pop    %esi
+    42b5:	5f                   	pop    %edi
+    42b6:	5d                   	pop    %ebp
+    42b7:	c3                   	ret
+    printf(stdout, "failed sbrk leaked memory\n");
+    42b8:	83 ec 08             	sub    $0x8,%esp
+    42bb:	68 ab 62 00 00       	push   $0x62ab
+    42c0:	ff 35 48 78 00 00    	push   0x7848
+    42c6:	e8 c8 09 00 00       	call   4c93 <printf>
+    exit();
+    42cb:	e8 ec 07 00 00       	call   4abc <exit>
+    sbrk(-(sbrk(0) - oldbrk));
+    42d0:	83 ec 0c             	sub    $0xc,%esp
+    42d3:	6a 00                	push   $0x0
+    42d5:	e8 6a 08 00 00       	call   4b44 <sbrk>
+    42da:	29 c7                	sub    %eax,%edi
+    42dc:	89 3c 24             	mov    %edi,(%esp)
+    42df:	e8 60 08 00 00       	call   4b44 <sbrk>
+    42e4:	83 c4 10             	add    $0x10,%esp
+    42e7:	eb b1                	jmp    429a <sbrktest+0x3ca>
+
+000042e9 <validateint>:
+      "int %2\n\t"
+      "mov %%ebx, %%esp" :
+      "=a" (res) :
+      "a" (SYS_sleep), "n" (T_SYSCALL), "c" (p) :
+      "ebx");
+}
+    42e9:	c3                   	ret
+
+000042ea <validatetest>:
+
+void
+validatetest(void)
+{
+    42ea:	55                   	push   %ebp
+    42eb:	89 e5                	mov    %esp,%ebp
+    42ed:	56                   	push   %esi
+    42ee:	53                   	push   %ebx
+  int hi, pid;
+  uint p;
+
+  printf(stdout, "validate test\n");
+    42ef:	83 ec 08             	sub    $0x8,%esp
+    42f2:	68 c6 62 00 00       	push   $0x62c6
+    42f7:	ff 35 48 78 00 00    	push   0x7848
+    42fd:	e8 91 09 00 00       	call   4c93 <printf>
+  hi = 1100*1024;
+
+  for(p = 0; p <= (uint)hi; p += 4096){
+    4302:	83 c4 10             	add    $0x10,%esp
+    4305:	be 00 00 00 00       	mov    $0x0,%esi
+    430a:	81 fe 00 30 11 00    	cmp    $0x113000,%esi
+    4310:	77 69                	ja     437b <validatetest+0x91>
+    if((pid = fork()) == 0){
+    4312:	e8 9d 07 00 00       	call   4ab4 <fork>
+    4317:	89 c3                	mov    %eax,%ebx
+    4319:	85 c0                	test   %eax,%eax
+    431b:	74 41                	je     435e <validatetest+0x74>
+      // try to crash the kernel by passing in a badly placed integer
+      validateint((int*)p);
+      exit();
+    }
+    sleep(0);
+    431d:	83 ec 0c             	sub    $0xc,%esp
+    4320:	6a 00                	push   $0x0
+    4322:	e8 25 08 00 00       	call   4b4c <sleep>
+    sleep(0);
+    4327:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    432e:	e8 19 08 00 00       	call   4b4c <sleep>
+    kill(pid);
+    4333:	89 1c 24             	mov    %ebx,(%esp)
+    4336:	e8 b1 07 00 00       	call   4aec <kill>
+    wait();
+    433b:	e8 84 07 00 00       	call   4ac4 <wait>
+
+    // try to crash the kernel by passing in a bad string pointer
+    if(link("nosuchfile", (char*)p) != -1){
+    4340:	83 c4 08             	add    $0x8,%esp
+    4343:	56                   	push   %esi
+    4344:	68 d5 62 00 00       	push   $0x62d5
+    4349:	e8 ce 07 00 00       	call   4b1c <link>
+    434e:	83 c4 10             	add    $0x10,%esp
+    4351:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4354:	75 0d                	jne    4363 <validatetest+0x79>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    4356:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    435c:	eb ac                	jmp    430a <validatetest+0x20>
+      exit();
+    435e:	e8 59 07 00 00       	call   4abc <exit>
+      printf(stdout, "link should not succeed\n");
+    4363:	83 ec 08             	sub    $0x8,%esp
+    4366:	68 e0 62 00 00       	push   $0x62e0
+    436b:	ff 35 48 78 00 00    	push   0x7848
+    4371:	e8 1d 09 00 00       	call   4c93 <printf>
+      exit();
+    4376:	e8 41 07 00 00       	call   4abc <exit>
+    }
+  }
+
+  printf(stdout, "validate ok\n");
+    437b:	83 ec 08             	sub    $0x8,%esp
+    437e:	68 f9 62 00 00       	push   $0x62f9
+    4383:	ff 35 48 78 00 00    	push   0x7848
+    4389:	e8 05 09 00 00       	call   4c93 <printf>
+}
+    438e:	83 c4 10             	add    $0x10,%esp
+    4391:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    4394:	5b                   	pop    %ebx
+    4395:	5e                   	pop    %esi
+    4396:	5d                   	pop    %ebp
+    4397:	c3                   	ret
+
+00004398 <bsstest>:
+
+// does unintialized data start out zero?
+char uninit[10000];
+void
+bsstest(void)
+{
+    4398:	55                   	push   %ebp
+    4399:	89 e5                	mov    %esp,%ebp
+    439b:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  printf(stdout, "bss test\n");
+    439e:	68 06 63 00 00       	push   $0x6306
+    43a3:	ff 35 48 78 00 00    	push   0x7848
+    43a9:	e8 e5 08 00 00       	call   4c93 <printf>
+  for(i = 0; i < sizeof(uninit); i++){
+    43ae:	83 c4 10             	add    $0x10,%esp
+    43b1:	b8 00 00 00 00       	mov    $0x0,%eax
+    43b6:	3d 0f 27 00 00       	cmp    $0x270f,%eax
+    43bb:	77 26                	ja     43e3 <bsstest+0x4b>
+    if(uninit[i] != '\0'){
+    43bd:	80 b8 60 78 00 00 00 	cmpb   $0x0,0x7860(%eax)
+    43c4:	75 05                	jne    43cb <bsstest+0x33>
+  for(i = 0; i < sizeof(uninit); i++){
+    43c6:	83 c0 01             	add    $0x1,%eax
+    43c9:	eb eb                	jmp    43b6 <bsstest+0x1e>
+      printf(stdout, "bss test failed\n");
+    43cb:	83 ec 08             	sub    $0x8,%esp
+    43ce:	68 10 63 00 00       	push   $0x6310
+    43d3:	ff 35 48 78 00 00    	push   0x7848
+    43d9:	e8 b5 08 00 00       	call   4c93 <printf>
+      exit();
+    43de:	e8 d9 06 00 00       	call   4abc <exit>
+    }
+  }
+  printf(stdout, "bss test ok\n");
+    43e3:	83 ec 08             	sub    $0x8,%esp
+    43e6:	68 21 63 00 00       	push   $0x6321
+    43eb:	ff 35 48 78 00 00    	push   0x7848
+    43f1:	e8 9d 08 00 00       	call   4c93 <printf>
+}
+    43f6:	83 c4 10             	add    $0x10,%esp
+    43f9:	c9                   	leave
+    43fa:	c3                   	ret
+
+000043fb <bigargtest>:
+// does exec return an error if the arguments
+// are larger than a page? or does it write
+// below the stack and wreck the instructions/data?
+void
+bigargtest(void)
+{
+    43fb:	55                   	push   %ebp
+    43fc:	89 e5                	mov    %esp,%ebp
+    43fe:	83 ec 14             	sub    $0x14,%esp
+  int pid, fd;
+
+  unlink("bigarg-ok");
+    4401:	68 2e 63 00 00       	push   $0x632e
+    4406:	e8 01 07 00 00       	call   4b0c <unlink>
+  pid = fork();
+    440b:	e8 a4 06 00 00       	call   4ab4 <fork>
+  if(pid == 0){
+    4410:	83 c4 10             	add    $0x10,%esp
+    4413:	85 c0                	test   %eax,%eax
+    4415:	74 4d                	je     4464 <bigargtest+0x69>
+    exec("echo", args);
+    printf(stdout, "bigarg test ok\n");
+    fd = open("bigarg-ok", O_CREATE);
+    close(fd);
+    exit();
+  } else if(pid < 0){
+    4417:	0f 88 ad 00 00 00    	js     44ca <bigargtest+0xcf>
+    printf(stdout, "bigargtest: fork failed\n");
+    exit();
+  }
+  wait();
+    441d:	e8 a2 06 00 00       	call   4ac4 <wait>
+  fd = open("bigarg-ok", 0);
+    4422:	83 ec 08             	sub    $0x8,%esp
+    4425:	6a 00                	push   $0x0
+    4427:	68 2e 63 00 00       	push   $0x632e
+    442c:	e8 cb 06 00 00       	call   4afc <open>
+  if(fd < 0){
+    4431:	83 c4 10             	add    $0x10,%esp
+    4434:	85 c0                	test   %eax,%eax
+    4436:	0f 88 a6 00 00 00    	js     44e2 <bigargtest+0xe7>
+    printf(stdout, "bigarg test failed!\n");
+    exit();
+  }
+  close(fd);
+    443c:	83 ec 0c             	sub    $0xc,%esp
+    443f:	50                   	push   %eax
+    4440:	e8 9f 06 00 00       	call   4ae4 <close>
+  unlink("bigarg-ok");
+    4445:	c7 04 24 2e 63 00 00 	movl   $0x632e,(%esp)
+    444c:	e8 bb 06 00 00       	call   4b0c <unlink>
+}
+    4451:	83 c4 10             	add    $0x10,%esp
+    4454:	c9                   	leave
+    4455:	c3                   	ret
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    4456:	c7 04 85 a0 ef 00 00 	movl   $0x6c50,0xefa0(,%eax,4)
+    445d:	50 6c 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    4461:	83 c0 01             	add    $0x1,%eax
+    4464:	83 f8 1e             	cmp    $0x1e,%eax
+    4467:	7e ed                	jle    4456 <bigargtest+0x5b>
+    args[MAXARG-1] = 0;
+    4469:	c7 05 1c f0 00 00 00 	movl   $0x0,0xf01c
+    4470:	00 00 00 
+    printf(stdout, "bigarg test\n");
+    4473:	83 ec 08             	sub    $0x8,%esp
+    4476:	68 38 63 00 00       	push   $0x6338
+    447b:	ff 35 48 78 00 00    	push   0x7848
+    4481:	e8 0d 08 00 00       	call   4c93 <printf>
+    exec("echo", args);
+    4486:	83 c4 08             	add    $0x8,%esp
+    4489:	68 a0 ef 00 00       	push   $0xefa0
+    448e:	68 25 50 00 00       	push   $0x5025
+    4493:	e8 5c 06 00 00       	call   4af4 <exec>
+    printf(stdout, "bigarg test ok\n");
+    4498:	83 c4 08             	add    $0x8,%esp
+    449b:	68 45 63 00 00       	push   $0x6345
+    44a0:	ff 35 48 78 00 00    	push   0x7848
+    44a6:	e8 e8 07 00 00       	call   4c93 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    44ab:	83 c4 08             	add    $0x8,%esp
+    44ae:	68 00 02 00 00       	push   $0x200
+    44b3:	68 2e 63 00 00       	push   $0x632e
+    44b8:	e8 3f 06 00 00       	call   4afc <open>
+    close(fd);
+    44bd:	89 04 24             	mov    %eax,(%esp)
+    44c0:	e8 1f 06 00 00       	call   4ae4 <close>
+    exit();
+    44c5:	e8 f2 05 00 00       	call   4abc <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    44ca:	83 ec 08             	sub    $0x8,%esp
+    44cd:	68 55 63 00 00       	push   $0x6355
+    44d2:	ff 35 48 78 00 00    	push   0x7848
+    44d8:	e8 b6 07 00 00       	call   4c93 <printf>
+    exit();
+    44dd:	e8 da 05 00 00       	call   4abc <exit>
+    printf(stdout, "bigarg test failed!\n");
+    44e2:	83 ec 08             	sub    $0x8,%esp
+    44e5:	68 6e 63 00 00       	push   $0x636e
+    44ea:	ff 35 48 78 00 00    	push   0x7848
+    44f0:	e8 9e 07 00 00       	call   4c93 <printf>
+    exit();
+    44f5:	e8 c2 05 00 00       	call   4abc <exit>
+
+000044fa <fsfull>:
+
+// what happens when the file system runs out of blocks?
+// answer: balloc panics, so this test is not useful.
+void
+fsfull()
+{
+    44fa:	55                   	push   %ebp
+    44fb:	89 e5                	mov    %esp,%ebp
+    44fd:	57                   	push   %edi
+    44fe:	56                   	push   %esi
+    44ff:	53                   	push   %ebx
+    4500:	83 ec 54             	sub    $0x54,%esp
+  int nfiles;
+  int fsblocks = 0;
+
+  printf(1, "fsfull test\n");
+    4503:	68 83 63 00 00       	push   $0x6383
+    4508:	6a 01                	push   $0x1
+    450a:	e8 84 07 00 00       	call   4c93 <printf>
+    450f:	83 c4 10             	add    $0x10,%esp
+
+  for(nfiles = 0; ; nfiles++){
+    4512:	bb 00 00 00 00       	mov    $0x0,%ebx
+    char name[64];
+    name[0] = 'f';
+    4517:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    451b:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    4520:	89 d8                	mov    %ebx,%eax
+    4522:	f7 ea                	imul   %edx
+    4524:	c1 fa 06             	sar    $0x6,%edx
+    4527:	89 de                	mov    %ebx,%esi
+    4529:	c1 fe 1f             	sar    $0x1f,%esi
+    452c:	29 f2                	sub    %esi,%edx
+    452e:	8d 42 30             	lea    0x30(%edx),%eax
+    4531:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4534:	69 d2 e8 03 00 00    	imul   $0x3e8,%edx,%edx
+    453a:	89 d9                	mov    %ebx,%ecx
+    453c:	29 d1                	sub    %edx,%ecx
+    453e:	bf 1f 85 eb 51       	mov    $0x51eb851f,%edi
+    4543:	89 c8                	mov    %ecx,%eax
+    4545:	f7 ef                	imul   %edi
+    4547:	c1 fa 05             	sar    $0x5,%edx
+    454a:	c1 f9 1f             	sar    $0x1f,%ecx
+    454d:	29 ca                	sub    %ecx,%edx
+    454f:	83 c2 30             	add    $0x30,%edx
+    4552:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    4555:	89 d8                	mov    %ebx,%eax
+    4557:	f7 ef                	imul   %edi
+    4559:	89 d7                	mov    %edx,%edi
+    455b:	c1 ff 05             	sar    $0x5,%edi
+    455e:	29 f7                	sub    %esi,%edi
+    4560:	6b c7 64             	imul   $0x64,%edi,%eax
+    4563:	89 df                	mov    %ebx,%edi
+    4565:	29 c7                	sub    %eax,%edi
+    4567:	b9 67 66 66 66       	mov    $0x66666667,%ecx
+    456c:	89 f8                	mov    %edi,%eax
+    456e:	f7 e9                	imul   %ecx
+    4570:	c1 fa 02             	sar    $0x2,%edx
+    4573:	c1 ff 1f             	sar    $0x1f,%edi
+    4576:	29 fa                	sub    %edi,%edx
+    4578:	83 c2 30             	add    $0x30,%edx
+    457b:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    457e:	89 d8                	mov    %ebx,%eax
+    4580:	f7 e9                	imul   %ecx
+    4582:	c1 fa 02             	sar    $0x2,%edx
+    4585:	29 f2                	sub    %esi,%edx
+    4587:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    458a:	01 c0                	add    %eax,%eax
+    458c:	89 da                	mov    %ebx,%edx
+    458e:	29 c2                	sub    %eax,%edx
+    4590:	83 c2 30             	add    $0x30,%edx
+    4593:	88 55 ac             	mov    %dl,-0x54(%ebp)
+    name[5] = '\0';
+    4596:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    printf(1, "writing %s\n", name);
+    459a:	83 ec 04             	sub    $0x4,%esp
+    459d:	8d 75 a8             	lea    -0x58(%ebp),%esi
+    45a0:	56                   	push   %esi
+    45a1:	68 90 63 00 00       	push   $0x6390
+    45a6:	6a 01                	push   $0x1
+    45a8:	e8 e6 06 00 00       	call   4c93 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    45ad:	83 c4 08             	add    $0x8,%esp
+    45b0:	68 02 02 00 00       	push   $0x202
+    45b5:	56                   	push   %esi
+    45b6:	e8 41 05 00 00       	call   4afc <open>
+    45bb:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    45bd:	83 c4 10             	add    $0x10,%esp
+    45c0:	85 c0                	test   %eax,%eax
+    45c2:	79 1b                	jns    45df <fsfull+0xe5>
+      printf(1, "open %s failed\n", name);
+    45c4:	83 ec 04             	sub    $0x4,%esp
+    45c7:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    45ca:	50                   	push   %eax
+    45cb:	68 9c 63 00 00       	push   $0x639c
+    45d0:	6a 01                	push   $0x1
+    45d2:	e8 bc 06 00 00       	call   4c93 <printf>
+      break;
+    45d7:	83 c4 10             	add    $0x10,%esp
+    45da:	e9 e6 00 00 00       	jmp    46c5 <fsfull+0x1cb>
+    }
+    int total = 0;
+    45df:	bf 00 00 00 00       	mov    $0x0,%edi
+    while(1){
+      int cc = write(fd, buf, 512);
+    45e4:	83 ec 04             	sub    $0x4,%esp
+    45e7:	68 00 02 00 00       	push   $0x200
+    45ec:	68 a0 cf 00 00       	push   $0xcfa0
+    45f1:	56                   	push   %esi
+    45f2:	e8 e5 04 00 00       	call   4adc <write>
+      if(cc < 512)
+    45f7:	83 c4 10             	add    $0x10,%esp
+    45fa:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    45ff:	7e 04                	jle    4605 <fsfull+0x10b>
+        break;
+      total += cc;
+    4601:	01 c7                	add    %eax,%edi
+    while(1){
+    4603:	eb df                	jmp    45e4 <fsfull+0xea>
+      fsblocks++;
+    }
+    printf(1, "wrote %d bytes\n", total);
+    4605:	83 ec 04             	sub    $0x4,%esp
+    4608:	57                   	push   %edi
+    4609:	68 ac 63 00 00       	push   $0x63ac
+    460e:	6a 01                	push   $0x1
+    4610:	e8 7e 06 00 00       	call   4c93 <printf>
+    close(fd);
+    4615:	89 34 24             	mov    %esi,(%esp)
+    4618:	e8 c7 04 00 00       	call   4ae4 <close>
+    if(total == 0)
+    461d:	83 c4 10             	add    $0x10,%esp
+    4620:	85 ff                	test   %edi,%edi
+    4622:	0f 84 9d 00 00 00    	je     46c5 <fsfull+0x1cb>
+  for(nfiles = 0; ; nfiles++){
+    4628:	83 c3 01             	add    $0x1,%ebx
+    462b:	e9 e7 fe ff ff       	jmp    4517 <fsfull+0x1d>
+      break;
+  }
+
+  while(nfiles >= 0){
+    char name[64];
+    name[0] = 'f';
+    4630:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4634:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    4639:	89 d8                	mov    %ebx,%eax
+    463b:	f7 ea                	imul   %edx
+    463d:	c1 fa 06             	sar    $0x6,%edx
+    4640:	89 de                	mov    %ebx,%esi
+    4642:	c1 fe 1f             	sar    $0x1f,%esi
+    4645:	29 f2                	sub    %esi,%edx
+    4647:	8d 42 30             	lea    0x30(%edx),%eax
+    464a:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    464d:	69 d2 e8 03 00 00    	imul   $0x3e8,%edx,%edx
+    4653:	89 d9                	mov    %ebx,%ecx
+    4655:	29 d1                	sub    %edx,%ecx
+    4657:	bf 1f 85 eb 51       	mov    $0x51eb851f,%edi
+    465c:	89 c8                	mov    %ecx,%eax
+    465e:	f7 ef                	imul   %edi
+    4660:	c1 fa 05             	sar    $0x5,%edx
+    4663:	c1 f9 1f             	sar    $0x1f,%ecx
+    4666:	29 ca                	sub    %ecx,%edx
+    4668:	83 c2 30             	add    $0x30,%edx
+    466b:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    466e:	89 d8                	mov    %ebx,%eax
+    4670:	f7 ef                	imul   %edi
+    4672:	89 d7                	mov    %edx,%edi
+    4674:	c1 ff 05             	sar    $0x5,%edi
+    4677:	29 f7                	sub    %esi,%edi
+    4679:	6b c7 64             	imul   $0x64,%edi,%eax
+    467c:	89 df                	mov    %ebx,%edi
+    467e:	29 c7                	sub    %eax,%edi
+    4680:	b9 67 66 66 66       	mov    $0x66666667,%ecx
+    4685:	89 f8                	mov    %edi,%eax
+    4687:	f7 e9                	imul   %ecx
+    4689:	c1 fa 02             	sar    $0x2,%edx
+    468c:	c1 ff 1f             	sar    $0x1f,%edi
+    468f:	29 fa                	sub    %edi,%edx
+    4691:	83 c2 30             	add    $0x30,%edx
+    4694:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    4697:	89 d8                	mov    %ebx,%eax
+    4699:	f7 e9                	imul   %ecx
+    469b:	c1 fa 02             	sar    $0x2,%edx
+    469e:	29 f2                	sub    %esi,%edx
+    46a0:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    46a3:	01 c0                	add    %eax,%eax
+    46a5:	89 da                	mov    %ebx,%edx
+    46a7:	29 c2                	sub    %eax,%edx
+    46a9:	83 c2 30             	add    $0x30,%edx
+    46ac:	88 55 ac             	mov    %dl,-0x54(%ebp)
+    name[5] = '\0';
+    46af:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    unlink(name);
+    46b3:	83 ec 0c             	sub    $0xc,%esp
+    46b6:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    46b9:	50                   	push   %eax
+    46ba:	e8 4d 04 00 00       	call   4b0c <unlink>
+    nfiles--;
+    46bf:	83 eb 01             	sub    $0x1,%ebx
+    46c2:	83 c4 10             	add    $0x10,%esp
+  while(nfiles >= 0){
+    46c5:	85 db                	test   %ebx,%ebx
+    46c7:	0f 89 63 ff ff ff    	jns    4630 <fsfull+0x136>
+  }
+
+  printf(1, "fsfull test finished\n");
+    46cd:	83 ec 08             	sub    $0x8,%esp
+    46d0:	68 bc 63 00 00       	push   $0x63bc
+    46d5:	6a 01                	push   $0x1
+    46d7:	e8 b7 05 00 00       	call   4c93 <printf>
+}
+    46dc:	83 c4 10             	add    $0x10,%esp
+    46df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    46e2:	5b                   	pop    %ebx
+    46e3:	5e                   	pop    %esi
+    46e4:	5f                   	pop    %edi
+    46e5:	5d                   	pop    %ebp
+    46e6:	c3                   	ret
+
+000046e7 <uio>:
+
+void
+uio()
+{
+    46e7:	55                   	push   %ebp
+    46e8:	89 e5                	mov    %esp,%ebp
+    46ea:	83 ec 10             	sub    $0x10,%esp
+
+  ushort port = 0;
+  uchar val = 0;
+  int pid;
+
+  printf(1, "uio test\n");
+    46ed:	68 d2 63 00 00       	push   $0x63d2
+    46f2:	6a 01                	push   $0x1
+    46f4:	e8 9a 05 00 00       	call   4c93 <printf>
+  pid = fork();
+    46f9:	e8 b6 03 00 00       	call   4ab4 <fork>
+  if(pid == 0){
+    46fe:	83 c4 10             	add    $0x10,%esp
+    4701:	85 c0                	test   %eax,%eax
+    4703:	74 1b                	je     4720 <uio+0x39>
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    port = RTC_DATA;
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    exit();
+  } else if(pid < 0){
+    4705:	78 3e                	js     4745 <uio+0x5e>
+    printf (1, "fork failed\n");
+    exit();
+  }
+  wait();
+    4707:	e8 b8 03 00 00       	call   4ac4 <wait>
+  printf(1, "uio test done\n");
+    470c:	83 ec 08             	sub    $0x8,%esp
+    470f:	68 dc 63 00 00       	push   $0x63dc
+    4714:	6a 01                	push   $0x1
+    4716:	e8 78 05 00 00       	call   4c93 <printf>
+}
+    471b:	83 c4 10             	add    $0x10,%esp
+    471e:	c9                   	leave
+    471f:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    4720:	b8 09 00 00 00       	mov    $0x9,%eax
+    4725:	ba 70 00 00 00       	mov    $0x70,%edx
+    472a:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    472b:	ba 71 00 00 00       	mov    $0x71,%edx
+    4730:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    4731:	83 ec 08             	sub    $0x8,%esp
+    4734:	68 30 6d 00 00       	push   $0x6d30
+    4739:	6a 01                	push   $0x1
+    473b:	e8 53 05 00 00       	call   4c93 <printf>
+    exit();
+    4740:	e8 77 03 00 00       	call   4abc <exit>
+    printf (1, "fork failed\n");
+    4745:	83 ec 08             	sub    $0x8,%esp
+    4748:	68 61 63 00 00       	push   $0x6361
+    474d:	6a 01                	push   $0x1
+    474f:	e8 3f 05 00 00       	call   4c93 <printf>
+    exit();
+    4754:	e8 63 03 00 00       	call   4abc <exit>
+
+00004759 <argptest>:
+
+void argptest()
+{
+    4759:	55                   	push   %ebp
+    475a:	89 e5                	mov    %esp,%ebp
+    475c:	53                   	push   %ebx
+    475d:	83 ec 0c             	sub    $0xc,%esp
+  int fd;
+  fd = open("init", O_RDONLY);
+    4760:	6a 00                	push   $0x0
+    4762:	68 eb 63 00 00       	push   $0x63eb
+    4767:	e8 90 03 00 00       	call   4afc <open>
+  if (fd < 0) {
+    476c:	83 c4 10             	add    $0x10,%esp
+    476f:	85 c0                	test   %eax,%eax
+    4771:	78 3a                	js     47ad <argptest+0x54>
+    4773:	89 c3                	mov    %eax,%ebx
+    printf(2, "open failed\n");
+    exit();
+  }
+  read(fd, sbrk(0) - 1, -1);
+    4775:	83 ec 0c             	sub    $0xc,%esp
+    4778:	6a 00                	push   $0x0
+    477a:	e8 c5 03 00 00       	call   4b44 <sbrk>
+    477f:	83 e8 01             	sub    $0x1,%eax
+    4782:	83 c4 0c             	add    $0xc,%esp
+    4785:	6a ff                	push   $0xffffffff
+    4787:	50                   	push   %eax
+    4788:	53                   	push   %ebx
+    4789:	e8 46 03 00 00       	call   4ad4 <read>
+  close(fd);
+    478e:	89 1c 24             	mov    %ebx,(%esp)
+    4791:	e8 4e 03 00 00       	call   4ae4 <close>
+  printf(1, "arg test passed\n");
+    4796:	83 c4 08             	add    $0x8,%esp
+    4799:	68 f0 63 00 00       	push   $0x63f0
+    479e:	6a 01                	push   $0x1
+    47a0:	e8 ee 04 00 00       	call   4c93 <printf>
+}
+    47a5:	83 c4 10             	add    $0x10,%esp
+    47a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    47ab:	c9                   	leave
+    47ac:	c3                   	ret
+    printf(2, "open failed\n");
+    47ad:	83 ec 08             	sub    $0x8,%esp
+    47b0:	68 8a 5f 00 00       	push   $0x5f8a
+    47b5:	6a 02                	push   $0x2
+    47b7:	e8 d7 04 00 00       	call   4c93 <printf>
+    exit();
+    47bc:	e8 fb 02 00 00       	call   4abc <exit>
+
+000047c1 <rand>:
+
+unsigned long randstate = 1;
+unsigned int
+rand()
+{
+  randstate = randstate * 1664525 + 1013904223;
+    47c1:	69 05 44 78 00 00 0d 	imul   $0x19660d,0x7844,%eax
+    47c8:	66 19 00 
+    47cb:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    47d0:	a3 44 78 00 00       	mov    %eax,0x7844
+  return randstate;
+}
+    47d5:	c3                   	ret
+
+000047d6 <main>:
+
+int
+main(int argc, char *argv[])
+{
+    47d6:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    47da:	83 e4 f0             	and    $0xfffffff0,%esp
+    47dd:	ff 71 fc             	push   -0x4(%ecx)
+    47e0:	55                   	push   %ebp
+    47e1:	89 e5                	mov    %esp,%ebp
+    47e3:	51                   	push   %ecx
+    47e4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+    47e7:	68 01 64 00 00       	push   $0x6401
+    47ec:	6a 01                	push   $0x1
+    47ee:	e8 a0 04 00 00       	call   4c93 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+    47f3:	83 c4 08             	add    $0x8,%esp
+    47f6:	6a 00                	push   $0x0
+    47f8:	68 15 64 00 00       	push   $0x6415
+    47fd:	e8 fa 02 00 00       	call   4afc <open>
+    4802:	83 c4 10             	add    $0x10,%esp
+    4805:	85 c0                	test   %eax,%eax
+    4807:	78 14                	js     481d <main+0x47>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+    4809:	83 ec 08             	sub    $0x8,%esp
+    480c:	68 54 6d 00 00       	push   $0x6d54
+    4811:	6a 01                	push   $0x1
+    4813:	e8 7b 04 00 00       	call   4c93 <printf>
+    exit();
+    4818:	e8 9f 02 00 00       	call   4abc <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+    481d:	83 ec 08             	sub    $0x8,%esp
+    4820:	68 00 02 00 00       	push   $0x200
+    4825:	68 15 64 00 00       	push   $0x6415
+    482a:	e8 cd 02 00 00       	call   4afc <open>
+    482f:	89 04 24             	mov    %eax,(%esp)
+    4832:	e8 ad 02 00 00       	call   4ae4 <close>
+
+  argptest();
+    4837:	e8 1d ff ff ff       	call   4759 <argptest>
+  createdelete();
+    483c:	e8 d1 c7 ff ff       	call   1012 <createdelete>
+  linkunlink();
+    4841:	e8 6a d0 ff ff       	call   18b0 <linkunlink>
+  concreate();
+    4846:	e8 7b cd ff ff       	call   15c6 <concreate>
+  fourfiles();
+    484b:	e8 dc c5 ff ff       	call   e2c <fourfiles>
+  sharedfd();
+    4850:	e8 3a c4 ff ff       	call   c8f <sharedfd>
+
+  bigargtest();
+    4855:	e8 a1 fb ff ff       	call   43fb <bigargtest>
+  bigwrite();
+    485a:	e8 c7 d9 ff ff       	call   2226 <bigwrite>
+  bigargtest();
+    485f:	e8 97 fb ff ff       	call   43fb <bigargtest>
+  bsstest();
+    4864:	e8 2f fb ff ff       	call   4398 <bsstest>
+  sbrktest();
+    4869:	e8 62 f6 ff ff       	call   3ed0 <sbrktest>
+  lazytest();
+    486e:	e8 ee e2 ff ff       	call   2b61 <lazytest>
+  validatetest();
+    4873:	e8 72 fa ff ff       	call   42ea <validatetest>
+
+  opentest();
+    4878:	e8 2f ba ff ff       	call   2ac <opentest>
+  writetest();
+    487d:	e8 bd ba ff ff       	call   33f <writetest>
+  writetest1();
+    4882:	e8 80 bc ff ff       	call   507 <writetest1>
+  createtest();
+    4887:	e8 2b be ff ff       	call   6b7 <createtest>
+
+  openiputtest();
+    488c:	e8 32 b9 ff ff       	call   1c3 <openiputtest>
+  exitiputtest();
+    4891:	e8 47 b8 ff ff       	call   dd <exitiputtest>
+  iputtest();
+    4896:	e8 65 b7 ff ff       	call   0 <iputtest>
+
+  mem();
+    489b:	e8 34 c3 ff ff       	call   bd4 <mem>
+  pipe1();
+    48a0:	e8 e4 bf ff ff       	call   889 <pipe1>
+  preempt();
+    48a5:	e8 7f c1 ff ff       	call   a29 <preempt>
+  exitwait();
+    48aa:	e8 b5 c2 ff ff       	call   b64 <exitwait>
+
+  rmdot();
+    48af:	e8 37 dd ff ff       	call   25eb <rmdot>
+  fourteen();
+    48b4:	e8 f5 db ff ff       	call   24ae <fourteen>
+  bigfile();
+    48b9:	e8 3a da ff ff       	call   22f8 <bigfile>
+  subdir();
+    48be:	e8 35 d2 ff ff       	call   1af8 <subdir>
+  linktest();
+    48c3:	e8 d8 ca ff ff       	call   13a0 <linktest>
+  unlinkread();
+    48c8:	e8 3a c9 ff ff       	call   1207 <unlinkread>
+  dirfile();
+    48cd:	e8 9e de ff ff       	call   2770 <dirfile>
+  iref();
+    48d2:	e8 b3 e0 ff ff       	call   298a <iref>
+  forktest();
+    48d7:	e8 d6 e1 ff ff       	call   2ab2 <forktest>
+  cowtest();
+    48dc:	e8 ce e3 ff ff       	call   2caf <cowtest>
+  vforktest();
+    48e1:	e8 45 e5 ff ff       	call   2e2b <vforktest>
+  spawntest();
+    48e6:	e8 cc f4 ff ff       	call   3db7 <spawntest>
+  slabtest();
+    48eb:	e8 63 f3 ff ff       	call   3c53 <slabtest>
+  shmtest();
+    48f0:	e8 28 e6 ff ff       	call   2f1d <shmtest>
+  mmaptest();
+    48f5:	e8 1f e8 ff ff       	call   3119 <mmaptest>
+  logtest();
+    48fa:	e8 8a ec ff ff       	call   3589 <logtest>
+  bcachetest();
+    48ff:	e8 e7 ee ff ff       	call   37eb <bcachetest>
+  aiotest();
+    4904:	e8 b2 f0 ff ff       	call   39bb <aiotest>
+  bigdir(); // slow
+    4909:	e8 96 d0 ff ff       	call   19a4 <bigdir>
+
+  uio();
+    490e:	e8 d4 fd ff ff       	call   46e7 <uio>
+
+  exectest();
+    4913:	e8 28 bf ff ff       	call   840 <exectest>
+
+  exit();
+    4918:	e8 9f 01 00 00       	call   4abc <exit>
+
+0000491d <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    491d:	55                   	push   %ebp
+    491e:	89 e5                	mov    %esp,%ebp
+    4920:	56                   	push   %esi
+    4921:	53                   	push   %ebx
+    4922:	8b 75 08             	mov    0x8(%ebp),%esi
+    4925:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    4928:	89 f0                	mov    %esi,%eax
+    492a:	89 d1                	mov    %edx,%ecx
+    492c:	83 c2 01             	add    $0x1,%edx
+    492f:	89 c3                	mov    %eax,%ebx
+    4931:	83 c0 01             	add    $0x1,%eax
+    4934:	0f b6 09             	movzbl (%ecx),%ecx
+    4937:	88 0b                	mov    %cl,(%ebx)
+    4939:	84 c9                	test   %cl,%cl
+    493b:	75 ed                	jne    492a <strcpy+0xd>
+    ;
+  return os;
+}
+    493d:	89 f0                	mov    %esi,%eax
+    493f:	5b                   	pop    %ebx
+    4940:	5e                   	pop    %esi
+    4941:	5d                   	pop    %ebp
+    4942:	c3                   	ret
+
+00004943 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    4943:	55                   	push   %ebp
+    4944:	89 e5                	mov    %esp,%ebp
+    4946:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    4949:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+    494c:	eb 06                	jmp    4954 <strcmp+0x11>
+    p++, q++;
+    494e:	83 c1 01             	add    $0x1,%ecx
+    4951:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+    4954:	0f b6 01             	movzbl (%ecx),%eax
+    4957:	84 c0                	test   %al,%al
+    4959:	74 04                	je     495f <strcmp+0x1c>
+    495b:	3a 02                	cmp    (%edx),%al
+    495d:	74 ef                	je     494e <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+    495f:	0f b6 c0             	movzbl %al,%eax
+    4962:	0f b6 12             	movzbl (%edx),%edx
+    4965:	29 d0                	sub    %edx,%eax
+}
+    4967:	5d                   	pop    %ebp
+    4968:	c3                   	ret
+
+00004969 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    4969:	55                   	push   %ebp
+    496a:	89 e5                	mov    %esp,%ebp
+    496c:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    496f:	b8 00 00 00 00       	mov    $0x0,%eax
+    4974:	eb 03                	jmp    4979 <strlen+0x10>
+    4976:	83 c0 01             	add    $0x1,%eax
+    4979:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    497d:	75 f7                	jne    4976 <strlen+0xd>
+    ;
+  return n;
+}
+    497f:	5d                   	pop    %ebp
+    4980:	c3                   	ret
+
+00004981 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    4981:	55                   	push   %ebp
+    4982:	89 e5                	mov    %esp,%ebp
+    4984:	57                   	push   %edi
+    4985:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    4988:	89 d7                	mov    %edx,%edi
+    498a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    498d:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4990:	fc                   	cld
+    4991:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    4993:	89 d0                	mov    %edx,%eax
+    4995:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    4998:	c9                   	leave
+    4999:	c3                   	ret
+
+0000499a <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    499a:	55                   	push   %ebp
+    499b:	89 e5                	mov    %esp,%ebp
+    499d:	8b 45 08             	mov    0x8(%ebp),%eax
+    49a0:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    49a4:	eb 03                	jmp    49a9 <strchr+0xf>
+    49a6:	83 c0 01             	add    $0x1,%eax
+    49a9:	0f b6 10             	movzbl (%eax),%edx
+    49ac:	84 d2                	test   %dl,%dl
+    49ae:	74 06                	je     49b6 <strchr+0x1c>
+    if(*s == c)
+    49b0:	38 ca                	cmp    %cl,%dl
+    49b2:	75 f2                	jne    49a6 <strchr+0xc>
+    49b4:	eb 05                	jmp    49bb <strchr+0x21>
+      return (char*)s;
+  return 0;
+    49b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    49bb:	5d                   	pop    %ebp
+    49bc:	c3                   	ret
+
+000049bd <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    49bd:	55                   	push   %ebp
+    49be:	89 e5                	mov    %esp,%ebp
+    49c0:	57                   	push   %edi
+    49c1:	56                   	push   %esi
+    49c2:	53                   	push   %ebx
+    49c3:	83 ec 1c             	sub    $0x1c,%esp
+    49c6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    49c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+    49ce:	89 de                	mov    %ebx,%esi
+    49d0:	83 c3 01             	add    $0x1,%ebx
+    49d3:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    49d6:	7d 2e                	jge    4a06 <gets+0x49>
+    cc = read(0, &c, 1);
+    49d8:	83 ec 04             	sub    $0x4,%esp
+    49db:	6a 01                	push   $0x1
+    49dd:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    49e0:	50                   	push   %eax
+    49e1:	6a 00                	push   $0x0
+    49e3:	e8 ec 00 00 00       	call   4ad4 <read>
+    if(cc < 1)
+    49e8:	83 c4 10             	add    $0x10,%esp
+    49eb:	85 c0                	test   %eax,%eax
+    49ed:	7e 17                	jle    4a06 <gets+0x49>
+      break;
+    buf[i++] = c;
+    49ef:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    49f3:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    49f6:	3c 0a                	cmp    $0xa,%al
+    49f8:	0f 94 c2             	sete   %dl
+    49fb:	3c 0d                	cmp    $0xd,%al
+    49fd:	0f 94 c0             	sete   %al
+    4a00:	08 c2                	or     %al,%dl
+    4a02:	74 ca                	je     49ce <gets+0x11>
+    buf[i++] = c;
+    4a04:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+    4a06:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+    4a0a:	89 f8                	mov    %edi,%eax
+    4a0c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4a0f:	5b                   	pop    %ebx
+    4a10:	5e                   	pop    %esi
+    4a11:	5f                   	pop    %edi
+    4a12:	5d                   	pop    %ebp
+    4a13:	c3                   	ret
+
+00004a14 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    4a14:	55                   	push   %ebp
+    4a15:	89 e5                	mov    %esp,%ebp
+    4a17:	56                   	push   %esi
+    4a18:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    4a19:	83 ec 08             	sub    $0x8,%esp
+    4a1c:	6a 00                	push   $0x0
+    4a1e:	ff 75 08             	push   0x8(%ebp)
+    4a21:	e8 d6 00 00 00       	call   4afc <open>
+  if(fd < 0)
+    4a26:	83 c4 10             	add    $0x10,%esp
+    4a29:	85 c0                	test   %eax,%eax
+    4a2b:	78 24                	js     4a51 <stat+0x3d>
+    4a2d:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+    4a2f:	83 ec 08             	sub    $0x8,%esp
+    4a32:	ff 75 0c             	push   0xc(%ebp)
+    4a35:	50                   	push   %eax
+    4a36:	e8 d9 00 00 00       	call   4b14 <fstat>
+    4a3b:	89 c6                	mov    %eax,%esi
+  close(fd);
+    4a3d:	89 1c 24             	mov    %ebx,(%esp)
+    4a40:	e8 9f 00 00 00       	call   4ae4 <close>
+  return r;
+    4a45:	83 c4 10             	add    $0x10,%esp
+}
+    4a48:	89 f0                	mov    %esi,%eax
+    4a4a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    4a4d:	5b                   	pop    %ebx
+    4a4e:	5e                   	pop    %esi
+    4a4f:	5d                   	pop    %ebp
+    4a50:	c3                   	ret
+    return -1;
+    4a51:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    4a56:	eb f0                	jmp    4a48 <stat+0x34>
+
+00004a58 <atoi>:
+
+int
+atoi(const char *s)
+{
+    4a58:	55                   	push   %ebp
+    4a59:	89 e5                	mov    %esp,%ebp
+    4a5b:	53                   	push   %ebx
+    4a5c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+    4a5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+    4a64:	eb 10                	jmp    4a76 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+    4a66:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+    4a69:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+    4a6c:	83 c1 01             	add    $0x1,%ecx
+    4a6f:	0f be c0             	movsbl %al,%eax
+    4a72:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+    4a76:	0f b6 01             	movzbl (%ecx),%eax
+    4a79:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    4a7c:	80 fb 09             	cmp    $0x9,%bl
+    4a7f:	76 e5                	jbe    4a66 <atoi+0xe>
+  return n;
+}
+    4a81:	89 d0                	mov    %edx,%eax
+    4a83:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4a86:	c9                   	leave
+    4a87:	c3                   	ret
+
+00004a88 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    4a88:	55                   	push   %ebp
+    4a89:	89 e5                	mov    %esp,%ebp
+    4a8b:	56                   	push   %esi
+    4a8c:	53                   	push   %ebx
+    4a8d:	8b 75 08             	mov    0x8(%ebp),%esi
+    4a90:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    4a93:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+    4a96:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+    4a98:	eb 0d                	jmp    4aa7 <memmove+0x1f>
+    *dst++ = *src++;
+    4a9a:	0f b6 01             	movzbl (%ecx),%eax
+    4a9d:	88 02                	mov    %al,(%edx)
+    4a9f:	8d 49 01             	lea    0x1(%ecx),%ecx
+    4aa2:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+    4aa5:	89 d8                	mov    %ebx,%eax
+    4aa7:	8d 58 ff             	lea    -0x1(%eax),%ebx
+    4aaa:	85 c0                	test   %eax,%eax
+    4aac:	7f ec                	jg     4a9a <memmove+0x12>
+  return vdst;
+}
+    4aae:	89 f0                	mov    %esi,%eax
+    4ab0:	5b                   	pop    %ebx
+    4ab1:	5e                   	pop    %esi
+    4ab2:	5d                   	pop    %ebp
+    4ab3:	c3                   	ret
+
+00004ab4 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    4ab4:	b8 01 00 00 00       	mov    $0x1,%eax
+    4ab9:	cd 40                	int    $0x40
+    4abb:	c3                   	ret
+
+00004abc <exit>:
+SYSCALL(exit)
+    4abc:	b8 02 00 00 00       	mov    $0x2,%eax
+    4ac1:	cd 40                	int    $0x40
+    4ac3:	c3                   	ret
+
+00004ac4 <wait>:
+SYSCALL(wait)
+    4ac4:	b8 03 00 00 00       	mov    $0x3,%eax
+    4ac9:	cd 40                	int    $0x40
+    4acb:	c3                   	ret
+
+00004acc <pipe>:
+SYSCALL(pipe)
+    4acc:	b8 04 00 00 00       	mov    $0x4,%eax
+    4ad1:	cd 40                	int    $0x40
+    4ad3:	c3                   	ret
+
+00004ad4 <read>:
+SYSCALL(read)
+    4ad4:	b8 05 00 00 00       	mov    $0x5,%eax
+    4ad9:	cd 40                	int    $0x40
+    4adb:	c3                   	ret
+
+00004adc <write>:
+SYSCALL(write)
+    4adc:	b8 10 00 00 00       	mov    $0x10,%eax
+    4ae1:	cd 40                	int    $0x40
+    4ae3:	c3                   	ret
+
+00004ae4 <close>:
+SYSCALL(close)
+    4ae4:	b8 15 00 00 00       	mov    $0x15,%eax
+    4ae9:	cd 40                	int    $0x40
+    4aeb:	c3                   	ret
+
+00004aec <kill>:
+SYSCALL(kill)
+    4aec:	b8 06 00 00 00       	mov    $0x6,%eax
+    4af1:	cd 40                	int    $0x40
+    4af3:	c3                   	ret
+
+00004af4 <exec>:
+SYSCALL(exec)
+    4af4:	b8 07 00 00 00       	mov    $0x7,%eax
+    4af9:	cd 40                	int    $0x40
+    4afb:	c3                   	ret
+
+00004afc <open>:
+SYSCALL(open)
+    4afc:	b8 0f 00 00 00       	mov    $0xf,%eax
+    4b01:	cd 40                	int    $0x40
+    4b03:	c3                   	ret
+
+00004b04 <mknod>:
+SYSCALL(mknod)
+    4b04:	b8 11 00 00 00       	mov    $0x11,%eax
+    4b09:	cd 40                	int    $0x40
+    4b0b:	c3                   	ret
+
+00004b0c <unlink>:
+SYSCALL(unlink)
+    4b0c:	b8 12 00 00 00       	mov    $0x12,%eax
+    4b11:	cd 40                	int    $0x40
+    4b13:	c3                   	ret
+
+00004b14 <fstat>:
+SYSCALL(fstat)
+    4b14:	b8 08 00 00 00       	mov    $0x8,%eax
+    4b19:	cd 40                	int    $0x40
+    4b1b:	c3                   	ret
+
+00004b1c <link>:
+SYSCALL(link)
+    4b1c:	b8 13 00 00 00       	mov    $0x13,%eax
+    4b21:	cd 40                	int    $0x40
+    4b23:	c3                   	ret
+
+00004b24 <mkdir>:
+SYSCALL(mkdir)
+    4b24:	b8 14 00 00 00       	mov    $0x14,%eax
+    4b29:	cd 40                	int    $0x40
+    4b2b:	c3                   	ret
+
+00004b2c <chdir>:
+SYSCALL(chdir)
+    4b2c:	b8 09 00 00 00       	mov    $0x9,%eax
+    4b31:	cd 40                	int    $0x40
+    4b33:	c3                   	ret
+
+00004b34 <dup>:
+SYSCALL(dup)
+    4b34:	b8 0a 00 00 00       	mov    $0xa,%eax
+    4b39:	cd 40                	int    $0x40
+    4b3b:	c3                   	ret
+
+00004b3c <getpid>:
+SYSCALL(getpid)
+    4b3c:	b8 0b 00 00 00       	mov    $0xb,%eax
+    4b41:	cd 40                	int    $0x40
+    4b43:	c3                   	ret
+
+00004b44 <sbrk>:
+SYSCALL(sbrk)
+    4b44:	b8 0c 00 00 00       	mov    $0xc,%eax
+    4b49:	cd 40                	int    $0x40
+    4b4b:	c3                   	ret
+
+00004b4c <sleep>:
+SYSCALL(sleep)
+    4b4c:	b8 0d 00 00 00       	mov    $0xd,%eax
+    4b51:	cd 40                	int    $0x40
+    4b53:	c3                   	ret
+
+00004b54 <uptime>:
+SYSCALL(uptime)
+    4b54:	b8 0e 00 00 00       	mov    $0xe,%eax
+    4b59:	cd 40                	int    $0x40
+    4b5b:	c3                   	ret
+
+00004b5c <setpri>:
+SYSCALL(setpri)
+    4b5c:	b8 16 00 00 00       	mov    $0x16,%eax
+    4b61:	cd 40                	int    $0x40
+    4b63:	c3                   	ret
+
+00004b64 <getpri>:
+SYSCALL(getpri)
+    4b64:	b8 17 00 00 00       	mov    $0x17,%eax
+    4b69:	cd 40                	int    $0x40
+    4b6b:	c3                   	ret
+
+00004b6c <fork2>:
+SYSCALL(fork2)
+    4b6c:	b8 18 00 00 00       	mov    $0x18,%eax
+    4b71:	cd 40                	int    $0x40
+    4b73:	c3                   	ret
+
+00004b74 <getpinfo>:
+SYSCALL(getpinfo)
+    4b74:	b8 19 00 00 00       	mov    $0x19,%eax
+    4b79:	cd 40                	int    $0x40
+    4b7b:	c3                   	ret
+
+00004b7c <spawn>:
+SYSCALL(spawn)
+    4b7c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    4b81:	cd 40                	int    $0x40
+    4b83:	c3                   	ret
+
+00004b84 <spawnn>:
+SYSCALL(spawnn)
+    4b84:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    4b89:	cd 40                	int    $0x40
+    4b8b:	c3                   	ret
+
+00004b8c <kmstat>:
+SYSCALL(kmstat)
+    4b8c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    4b91:	cd 40                	int    $0x40
+    4b93:	c3                   	ret
+
+00004b94 <slabstat>:
+SYSCALL(slabstat)
+    4b94:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    4b99:	cd 40                	int    $0x40
+    4b9b:	c3                   	ret
+
+00004b9c <shmget>:
+SYSCALL(shmget)
+    4b9c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    4ba1:	cd 40                	int    $0x40
+    4ba3:	c3                   	ret
+
+00004ba4 <shmat>:
+SYSCALL(shmat)
+    4ba4:	b8 20 00 00 00       	mov    $0x20,%eax
+    4ba9:	cd 40                	int    $0x40
+    4bab:	c3                   	ret
+
+00004bac <shmdt>:
+SYSCALL(shmdt)
+    4bac:	b8 21 00 00 00       	mov    $0x21,%eax
+    4bb1:	cd 40                	int    $0x40
+    4bb3:	c3                   	ret
+
+00004bb4 <mmap>:
+SYSCALL(mmap)
+    4bb4:	b8 22 00 00 00       	mov    $0x22,%eax
+    4bb9:	cd 40                	int    $0x40
+    4bbb:	c3                   	ret
+
+00004bbc <munmap>:
+SYSCALL(munmap)
+    4bbc:	b8 23 00 00 00       	mov    $0x23,%eax
+    4bc1:	cd 40                	int    $0x40
+    4bc3:	c3                   	ret
+
+00004bc4 <bstat>:
+SYSCALL(bstat)
+    4bc4:	b8 24 00 00 00       	mov    $0x24,%eax
+    4bc9:	cd 40                	int    $0x40
+    4bcb:	c3                   	ret
+
+00004bcc <aread>:
+SYSCALL(aread)
+    4bcc:	b8 25 00 00 00       	mov    $0x25,%eax
+    4bd1:	cd 40                	int    $0x40
+    4bd3:	c3                   	ret
+
+00004bd4 <await>:
+SYSCALL(await)
+    4bd4:	b8 26 00 00 00       	mov    $0x26,%eax
+    4bd9:	cd 40                	int    $0x40
+    4bdb:	c3                   	ret
+
+00004bdc <bdrop>:
+SYSCALL(bdrop)
+    4bdc:	b8 27 00 00 00       	mov    $0x27,%eax
+    4be1:	cd 40                	int    $0x40
+    4be3:	c3                   	ret
+
+00004be4 <vfork>:
+# exec or exit, and its ret would leave the slot holding our
+# return address free for it to overwrite.  Keep the return
+# address in %ecx, which the kernel restores for both sides.
+.globl vfork
+vfork:
+  popl %ecx
+    4be4:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+    4be5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  int $T_SYSCALL
+    4bea:	cd 40                	int    $0x40
+  pushl %ecx
+    4bec:	51                   	push   %ecx
+  ret
+    4bed:	c3                   	ret
+
+00004bee <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+    4bee:	55                   	push   %ebp
+    4bef:	89 e5                	mov    %esp,%ebp
+    4bf1:	83 ec 1c             	sub    $0x1c,%esp
+    4bf4:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+    4bf7:	6a 01                	push   $0x1
+    4bf9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+    4bfc:	52                   	push   %edx
+    4bfd:	50                   	push   %eax
+    4bfe:	e8 d9 fe ff ff       	call   4adc <write>
+}
+    4c03:	83 c4 10             	add    $0x10,%esp
+    4c06:	c9                   	leave
+    4c07:	c3                   	ret
+
+00004c08 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    4c08:	55                   	push   %ebp
+    4c09:	89 e5                	mov    %esp,%ebp
+    4c0b:	57                   	push   %edi
+    4c0c:	56                   	push   %esi
+    4c0d:	53                   	push   %ebx
+    4c0e:	83 ec 2c             	sub    $0x2c,%esp
+    4c11:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    4c14:	89 d0                	mov    %edx,%eax
+    4c16:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    4c18:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    4c1c:	0f 95 c1             	setne  %cl
+    4c1f:	c1 ea 1f             	shr    $0x1f,%edx
+    4c22:	84 d1                	test   %dl,%cl
+    4c24:	74 44                	je     4c6a <printint+0x62>
+    neg = 1;
+    x = -xx;
+    4c26:	f7 d8                	neg    %eax
+    4c28:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+    4c2a:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    4c31:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+    4c36:	89 c8                	mov    %ecx,%eax
+    4c38:	ba 00 00 00 00       	mov    $0x0,%edx
+    4c3d:	f7 f6                	div    %esi
+    4c3f:	89 df                	mov    %ebx,%edi
+    4c41:	83 c3 01             	add    $0x1,%ebx
+    4c44:	0f b6 92 e0 6d 00 00 	movzbl 0x6de0(%edx),%edx
+    4c4b:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+    4c4f:	89 ca                	mov    %ecx,%edx
+    4c51:	89 c1                	mov    %eax,%ecx
+    4c53:	39 f2                	cmp    %esi,%edx
+    4c55:	73 df                	jae    4c36 <printint+0x2e>
+  if(neg)
+    4c57:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+    4c5b:	74 31                	je     4c8e <printint+0x86>
+    buf[i++] = '-';
+    4c5d:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+    4c62:	8d 5f 02             	lea    0x2(%edi),%ebx
+    4c65:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    4c68:	eb 17                	jmp    4c81 <printint+0x79>
+    x = xx;
+    4c6a:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+    4c6c:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+    4c73:	eb bc                	jmp    4c31 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    4c75:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+    4c7a:	89 f0                	mov    %esi,%eax
+    4c7c:	e8 6d ff ff ff       	call   4bee <putc>
+  while(--i >= 0)
+    4c81:	83 eb 01             	sub    $0x1,%ebx
+    4c84:	79 ef                	jns    4c75 <printint+0x6d>
+}
+    4c86:	83 c4 2c             	add    $0x2c,%esp
+    4c89:	5b                   	pop    %ebx
+    4c8a:	5e                   	pop    %esi
+    4c8b:	5f                   	pop    %edi
+    4c8c:	5d                   	pop    %ebp
+    4c8d:	c3                   	ret
+    4c8e:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    4c91:	eb ee                	jmp    4c81 <printint+0x79>
+
+00004c93 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    4c93:	55                   	push   %ebp
+    4c94:	89 e5                	mov    %esp,%ebp
+    4c96:	57                   	push   %edi
+    4c97:	56                   	push   %esi
+    4c98:	53                   	push   %ebx
+    4c99:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+    4c9c:	8d 45 10             	lea    0x10(%ebp),%eax
+    4c9f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+    4ca2:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+    4ca7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    4cac:	eb 14                	jmp    4cc2 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+    4cae:	89 fa                	mov    %edi,%edx
+    4cb0:	8b 45 08             	mov    0x8(%ebp),%eax
+    4cb3:	e8 36 ff ff ff       	call   4bee <putc>
+    4cb8:	eb 05                	jmp    4cbf <printf+0x2c>
+      }
+    } else if(state == '%'){
+    4cba:	83 fe 25             	cmp    $0x25,%esi
+    4cbd:	74 25                	je     4ce4 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+    4cbf:	83 c3 01             	add    $0x1,%ebx
+    4cc2:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4cc5:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+    4cc9:	84 c0                	test   %al,%al
+    4ccb:	0f 84 20 01 00 00    	je     4df1 <printf+0x15e>
+    c = fmt[i] & 0xff;
+    4cd1:	0f be f8             	movsbl %al,%edi
+    4cd4:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    4cd7:	85 f6                	test   %esi,%esi
+    4cd9:	75 df                	jne    4cba <printf+0x27>
+      if(c == '%'){
+    4cdb:	83 f8 25             	cmp    $0x25,%eax
+    4cde:	75 ce                	jne    4cae <printf+0x1b>
+        state = '%';
+    4ce0:	89 c6                	mov    %eax,%esi
+    4ce2:	eb db                	jmp    4cbf <printf+0x2c>
+      if(c == 'd'){
+    4ce4:	83 f8 25             	cmp    $0x25,%eax
+    4ce7:	0f 84 cf 00 00 00    	je     4dbc <printf+0x129>
+    4ced:	0f 8c dd 00 00 00    	jl     4dd0 <printf+0x13d>
+    4cf3:	83 f8 78             	cmp    $0x78,%eax
+    4cf6:	0f 8f d4 00 00 00    	jg     4dd0 <printf+0x13d>
+    4cfc:	83 f8 63             	cmp    $0x63,%eax
+    4cff:	0f 8c cb 00 00 00    	jl     4dd0 <printf+0x13d>
+    4d05:	83 e8 63             	sub    $0x63,%eax
+    4d08:	83 f8 15             	cmp    $0x15,%eax
+    4d0b:	0f 87 bf 00 00 00    	ja     4dd0 <printf+0x13d>
+    4d11:	ff 24 85 88 6d 00 00 	jmp    *0x6d88(,%eax,4)
+        printint(fd, *ap, 10, 1);
+    4d18:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    4d1b:	8b 17                	mov    (%edi),%edx
+    4d1d:	83 ec 0c             	sub    $0xc,%esp
+    4d20:	6a 01                	push   $0x1
+    4d22:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    4d27:	8b 45 08             	mov    0x8(%ebp),%eax
+    4d2a:	e8 d9 fe ff ff       	call   4c08 <printint>
+        ap++;
+    4d2f:	83 c7 04             	add    $0x4,%edi
+    4d32:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    4d35:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+    4d38:	be 00 00 00 00       	mov    $0x0,%esi
+    4d3d:	eb 80                	jmp    4cbf <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+    4d3f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    4d42:	8b 17                	mov    (%edi),%edx
+    4d44:	83 ec 0c             	sub    $0xc,%esp
+    4d47:	6a 00                	push   $0x0
+    4d49:	b9 10 00 00 00       	mov    $0x10,%ecx
+    4d4e:	8b 45 08             	mov    0x8(%ebp),%eax
+    4d51:	e8 b2 fe ff ff       	call   4c08 <printint>
+        ap++;
+    4d56:	83 c7 04             	add    $0x4,%edi
+    4d59:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    4d5c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    4d5f:	be 00 00 00 00       	mov    $0x0,%esi
+    4d64:	e9 56 ff ff ff       	jmp    4cbf <printf+0x2c>
+        s = (char*)*ap;
+    4d69:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    4d6c:	8b 30                	mov    (%eax),%esi
+        ap++;
+    4d6e:	83 c0 04             	add    $0x4,%eax
+    4d71:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+    4d74:	85 f6                	test   %esi,%esi
+    4d76:	75 15                	jne    4d8d <printf+0xfa>
+          s = "(null)";
+    4d78:	be 7e 6d 00 00       	mov    $0x6d7e,%esi
+    4d7d:	eb 0e                	jmp    4d8d <printf+0xfa>
+          putc(fd, *s);
+    4d7f:	0f be d2             	movsbl %dl,%edx
+    4d82:	8b 45 08             	mov    0x8(%ebp),%eax
+    4d85:	e8 64 fe ff ff       	call   4bee <putc>
+          s++;
+    4d8a:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+    4d8d:	0f b6 16             	movzbl (%esi),%edx
+    4d90:	84 d2                	test   %dl,%dl
+    4d92:	75 eb                	jne    4d7f <printf+0xec>
+      state = 0;
+    4d94:	be 00 00 00 00       	mov    $0x0,%esi
+    4d99:	e9 21 ff ff ff       	jmp    4cbf <printf+0x2c>
+        putc(fd, *ap);
+    4d9e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    4da1:	0f be 17             	movsbl (%edi),%edx
+    4da4:	8b 45 08             	mov    0x8(%ebp),%eax
+    4da7:	e8 42 fe ff ff       	call   4bee <putc>
+        ap++;
+    4dac:	83 c7 04             	add    $0x4,%edi
+    4daf:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+    4db2:	be 00 00 00 00       	mov    $0x0,%esi
+    4db7:	e9 03 ff ff ff       	jmp    4cbf <printf+0x2c>
+        putc(fd, c);
+    4dbc:	89 fa                	mov    %edi,%edx
+    4dbe:	8b 45 08             	mov    0x8(%ebp),%eax
+    4dc1:	e8 28 fe ff ff       	call   4bee <putc>
+      state = 0;
+    4dc6:	be 00 00 00 00       	mov    $0x0,%esi
+    4dcb:	e9 ef fe ff ff       	jmp    4cbf <printf+0x2c>
+        putc(fd, '%');
+    4dd0:	ba 25 00 00 00       	mov    $0x25,%edx
+    4dd5:	8b 45 08             	mov    0x8(%ebp),%eax
+    4dd8:	e8 11 fe ff ff       	call   4bee <putc>
+        putc(fd, c);
+    4ddd:	89 fa                	mov    %edi,%edx
+    4ddf:	8b 45 08             	mov    0x8(%ebp),%eax
+    4de2:	e8 07 fe ff ff       	call   4bee <putc>
+      state = 0;
+    4de7:	be 00 00 00 00       	mov    $0x0,%esi
+    4dec:	e9 ce fe ff ff       	jmp    4cbf <printf+0x2c>
+    }
+  }
+}
+    4df1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4df4:	5b                   	pop    %ebx
+    4df5:	5e                   	pop    %esi
+    4df6:	5f                   	pop    %edi
+    4df7:	5d                   	pop    %ebp
+    4df8:	c3                   	ret
+
+00004df9 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    4df9:	55                   	push   %ebp
+    4dfa:	89 e5                	mov    %esp,%ebp
+    4dfc:	57                   	push   %edi
+    4dfd:	56                   	push   %esi
+    4dfe:	53                   	push   %ebx
+    4dff:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    4e02:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4e05:	a1 e0 f9 00 00       	mov    0xf9e0,%eax
+    4e0a:	eb 02                	jmp    4e0e <free+0x15>
+    4e0c:	89 d0                	mov    %edx,%eax
+    4e0e:	39 c8                	cmp    %ecx,%eax
+    4e10:	73 04                	jae    4e16 <free+0x1d>
+    4e12:	3b 08                	cmp    (%eax),%ecx
+    4e14:	72 12                	jb     4e28 <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4e16:	8b 10                	mov    (%eax),%edx
+    4e18:	39 d0                	cmp    %edx,%eax
+    4e1a:	72 f0                	jb     4e0c <free+0x13>
+    4e1c:	39 c8                	cmp    %ecx,%eax
+    4e1e:	72 08                	jb     4e28 <free+0x2f>
+    4e20:	39 d1                	cmp    %edx,%ecx
+    4e22:	72 04                	jb     4e28 <free+0x2f>
+    4e24:	89 d0                	mov    %edx,%eax
+    4e26:	eb e6                	jmp    4e0e <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    4e28:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    4e2b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    4e2e:	8b 10                	mov    (%eax),%edx
+    4e30:	39 d7                	cmp    %edx,%edi
+    4e32:	74 19                	je     4e4d <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+    4e34:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    4e37:	8b 50 04             	mov    0x4(%eax),%edx
+    4e3a:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+    4e3d:	39 ce                	cmp    %ecx,%esi
+    4e3f:	74 1b                	je     4e5c <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+    4e41:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+    4e43:	a3 e0 f9 00 00       	mov    %eax,0xf9e0
+}
+    4e48:	5b                   	pop    %ebx
+    4e49:	5e                   	pop    %esi
+    4e4a:	5f                   	pop    %edi
+    4e4b:	5d                   	pop    %ebp
+    4e4c:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+    4e4d:	03 72 04             	add    0x4(%edx),%esi
+    4e50:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    4e53:	8b 10                	mov    (%eax),%edx
+    4e55:	8b 12                	mov    (%edx),%edx
+    4e57:	89 53 f8             	mov    %edx,-0x8(%ebx)
+    4e5a:	eb db                	jmp    4e37 <free+0x3e>
+    p->s.size += bp->s.size;
+    4e5c:	03 53 fc             	add    -0x4(%ebx),%edx
+    4e5f:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+    4e62:	8b 53 f8             	mov    -0x8(%ebx),%edx
+    4e65:	89 10                	mov    %edx,(%eax)
+    4e67:	eb da                	jmp    4e43 <free+0x4a>
+
+00004e69 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    4e69:	55                   	push   %ebp
+    4e6a:	89 e5                	mov    %esp,%ebp
+    4e6c:	53                   	push   %ebx
+    4e6d:	83 ec 04             	sub    $0x4,%esp
+    4e70:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    4e72:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+    4e77:	77 05                	ja     4e7e <morecore+0x15>
+    nu = 4096;
+    4e79:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+    4e7e:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+    4e85:	83 ec 0c             	sub    $0xc,%esp
+    4e88:	50                   	push   %eax
+    4e89:	e8 b6 fc ff ff       	call   4b44 <sbrk>
+  if(p == (char*)-1)
+    4e8e:	83 c4 10             	add    $0x10,%esp
+    4e91:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4e94:	74 1c                	je     4eb2 <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+    4e96:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    4e99:	83 c0 08             	add    $0x8,%eax
+    4e9c:	83 ec 0c             	sub    $0xc,%esp
+    4e9f:	50                   	push   %eax
+    4ea0:	e8 54 ff ff ff       	call   4df9 <free>
+  return freep;
+    4ea5:	a1 e0 f9 00 00       	mov    0xf9e0,%eax
+    4eaa:	83 c4 10             	add    $0x10,%esp
+}
+    4ead:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4eb0:	c9                   	leave
+    4eb1:	c3                   	ret
+    return 0;
+    4eb2:	b8 00 00 00 00       	mov    $0x0,%eax
+    4eb7:	eb f4                	jmp    4ead <morecore+0x44>
+
+00004eb9 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    4eb9:	55                   	push   %ebp
+    4eba:	89 e5                	mov    %esp,%ebp
+    4ebc:	53                   	push   %ebx
+    4ebd:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4ec0:	8b 45 08             	mov    0x8(%ebp),%eax
+    4ec3:	8d 58 07             	lea    0x7(%eax),%ebx
+    4ec6:	c1 eb 03             	shr    $0x3,%ebx
+    4ec9:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+    4ecc:	8b 0d e0 f9 00 00    	mov    0xf9e0,%ecx
+    4ed2:	85 c9                	test   %ecx,%ecx
+    4ed4:	74 04                	je     4eda <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4ed6:	8b 01                	mov    (%ecx),%eax
+    4ed8:	eb 4a                	jmp    4f24 <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+    4eda:	c7 05 e0 f9 00 00 e4 	movl   $0xf9e4,0xf9e0
+    4ee1:	f9 00 00 
+    4ee4:	c7 05 e4 f9 00 00 e4 	movl   $0xf9e4,0xf9e4
+    4eeb:	f9 00 00 
+    base.s.size = 0;
+    4eee:	c7 05 e8 f9 00 00 00 	movl   $0x0,0xf9e8
+    4ef5:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+    4ef8:	b9 e4 f9 00 00       	mov    $0xf9e4,%ecx
+    4efd:	eb d7                	jmp    4ed6 <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+    4eff:	74 19                	je     4f1a <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+    4f01:	29 da                	sub    %ebx,%edx
+    4f03:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    4f06:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+    4f09:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+    4f0c:	89 0d e0 f9 00 00    	mov    %ecx,0xf9e0
+      return (void*)(p + 1);
+    4f12:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+    4f15:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4f18:	c9                   	leave
+    4f19:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+    4f1a:	8b 10                	mov    (%eax),%edx
+    4f1c:	89 11                	mov    %edx,(%ecx)
+    4f1e:	eb ec                	jmp    4f0c <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4f20:	89 c1                	mov    %eax,%ecx
+    4f22:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+    4f24:	8b 50 04             	mov    0x4(%eax),%edx
+    4f27:	39 da                	cmp    %ebx,%edx
+    4f29:	73 d4                	jae    4eff <malloc+0x46>
+    if(p == freep)
+    4f2b:	39 05 e0 f9 00 00    	cmp    %eax,0xf9e0
+    4f31:	75 ed                	jne    4f20 <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+    4f33:	89 d8                	mov    %ebx,%eax
+    4f35:	e8 2f ff ff ff       	call   4e69 <morecore>
+    4f3a:	85 c0                	test   %eax,%eax
+    4f3c:	75 e2                	jne    4f20 <malloc+0x67>
+    4f3e:	eb d5                	jmp    4f15 <malloc+0x5c>
@@ -7,6 +7,8 @@
 #include "syscall.h"
 #include "traps.h"
 #include "memlayout.h"
+#include "kmstat.h"
+#include "bstat.h"
 
 char buf[8192];
 char name[3];
@@ -1411,6 +1413,604 @@ forktest(void)
   printf(1, "fork test OK\n");
 }
 
+// sbrk() only reserves memory; pages appear on first touch,
+// whether the touch comes from user code or from a system call.
+void
+lazytest(void)
+{
+  char *a, *p;
+  int fds[2], pid;
+
+  printf(1, "lazy sbrk test\n");
+  a = sbrk(8*1024*1024);
+  if(a == (char*)-1){
+    printf(1, "lazy sbrk failed\n");
+    exit();
+  }
+  for(p = a; p < a + 8*1024*1024; p += 1024*1024){
+    if(*p != 0){
+      printf(1, "lazy page not zero\n");
+      exit();
+    }
+    *p = 'z';
+  }
+  if(pipe(fds) != 0){
+    printf(1, "lazy pipe failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid == 0){
+    if(a[4*1024*1024] != 'z' || a[4*1024*1024 + 4096] != 0){
+      printf(1, "lazy child saw wrong data\n");
+      exit();
+    }
+    write(fds[1], "k", 1);
+    exit();
+  }
+  if(read(fds[0], a + 8*1024*1024 - 1, 1) != 1 || a[8*1024*1024 - 1] != 'k'){
+    printf(1, "lazy read into untouched page failed\n");
+    exit();
+  }
+  wait();
+  close(fds[0]);
+  close(fds[1]);
+  sbrk(-8*1024*1024);
+  printf(1, "lazy sbrk test OK\n");
+}
+
+// fork() shares pages copy-on-write; writes on either side,
+// including by the kernel into a user buffer, must stay private.
+char cowbuf[3*4096];
+void
+cowtest(void)
+{
+  int fds[2], pid, i;
+
+  printf(1, "cow test\n");
+  for(i = 0; i < sizeof(cowbuf); i++)
+    cowbuf[i] = 'p';
+  if(pipe(fds) != 0){
+    printf(1, "cow pipe failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(1, "cow fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    if(read(fds[0], cowbuf + 4096, 10) != 10){
+      printf(1, "cow child read failed\n");
+      exit();
+    }
+    for(i = 0; i < sizeof(cowbuf); i++){
+      if(cowbuf[i] != (i >= 4096 && i < 4096+10 ? 'c' : 'p')){
+        printf(1, "cow child saw wrong data at %d\n", i);
+        exit();
+      }
+    }
+    exit();
+  }
+  for(i = 0; i < sizeof(cowbuf); i++)
+    cowbuf[i] = 'x';
+  write(fds[1], "cccccccccc", 10);
+  wait();
+  for(i = 0; i < sizeof(cowbuf); i++){
+    if(cowbuf[i] != 'x'){
+      printf(1, "cow parent saw wrong data at %d\n", i);
+      exit();
+    }
+  }
+  close(fds[0]);
+  close(fds[1]);
+  printf(1, "cow test OK\n");
+}
+
+// vfork() children run on the parent's memory until exec or exit.
+void
+vforktest(void)
+{
+  int pid, xpid;
+  char *args[] = { "echo", "vforked", 0 };
+
+  printf(1, "vfork test\n");
+  xpid = getpid();
+  pid = vfork();
+  if(pid < 0){
+    printf(1, "vfork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    exec("echo", args);
+    printf(1, "vfork child exec failed\n");
+    exit();
+  }
+  if(getpid() != xpid || wait() != pid){
+    printf(1, "vfork parent lost its state\n");
+    exit();
+  }
+
+  pid = vfork();
+  if(pid == 0)
+    exit();
+  if(pid < 0 || wait() != pid){
+    printf(1, "vfork child exit not seen\n");
+    exit();
+  }
+  printf(1, "vfork test OK\n");
+}
+
+// A shared memory segment is seen by forked children and
+// by unrelated processes that attach it by name, and system
+// calls can read and write buffers in it.
+void
+shmtest(void)
+{
+  int id, fds[2], pid;
+  char *a, *b;
+
+  printf(1, "shm test\n");
+  id = shmget("shmtest", 2);
+  if(id < 0 || (a = shmat(id)) == (char*)-1){
+    printf(1, "shm attach failed\n");
+    exit();
+  }
+  if(a < (char*)sbrk(0) || a[0] != 0 || a[2*4096-1] != 0){
+    printf(1, "shm segment not zeroed or misplaced\n");
+    exit();
+  }
+  a[0] = 'p';
+  pid = fork();
+  if(pid < 0){
+    printf(1, "shm fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    // Inherited mapping: writes are seen by the parent.
+    a[4096] = 'c';
+    // A second attachment maps the same pages elsewhere.
+    if((b = shmat(shmget("shmtest", 0))) == (char*)-1 || b == a || b[0] != 'p'){
+      printf(1, "shm child attach failed\n");
+      exit();
+    }
+    b[1] = 'b';
+    shmdt(b);
+    exit();
+  }
+  wait();
+  if(a[4096] != 'c' || a[1] != 'b'){
+    printf(1, "shm parent didn't see child's writes\n");
+    exit();
+  }
+  if(pipe(fds) != 0 || write(fds[1], a, 2) != 2 || read(fds[0], a + 100, 2) != 2 ||
+     a[100] != 'p' || a[101] != 'b'){
+    printf(1, "shm pipe i/o failed\n");
+    exit();
+  }
+  close(fds[0]);
+  close(fds[1]);
+  if(shmdt(a) != 0 || shmdt(a) == 0){
+    printf(1, "shm detach failed\n");
+    exit();
+  }
+
+  // A segment no one attached goes away with its creator,
+  // and its id doesn't attach the slot's next segment.
+  if(pipe(fds) != 0){
+    printf(1, "shm pipe failed\n");
+    exit();
+  }
+  if(fork() == 0){
+    id = shmget("shmstale", 1);
+    write(fds[1], &id, sizeof(id));
+    exit();
+  }
+  wait();
+  if(read(fds[0], &pid, sizeof(pid)) != sizeof(pid) || pid < 0 ||
+     shmat(pid) != (char*)-1 || (id = shmget("shmstale", 1)) < 0 ||
+     id == pid || shmat(pid) != (char*)-1){
+    printf(1, "shm stale id attached\n");
+    exit();
+  }
+  close(fds[0]);
+  close(fds[1]);
+  printf(1, "shm test OK\n");
+}
+
+// Map a file read-only, privately and shared.
+void
+mmaptest(void)
+{
+  int fd, fds[2], i, n, pid;
+  char *a, buf[16];
+
+  printf(1, "mmap test\n");
+  unlink("mmapfile");
+  fd = open("mmapfile", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(1, "mmap create failed\n");
+    exit();
+  }
+  n = 2*4096 + 100;
+  for(i = 0; i < n; i++)
+    if(write(fd, "abcdefghij" + i % 10, 1) != 1){
+      printf(1, "mmap write failed\n");
+      exit();
+    }
+  if(mmap(0, n, PROT_READ, MAP_PRIVATE, fd, 1) != (char*)-1 ||
+     mmap(0, n + 4096, PROT_READ, MAP_PRIVATE, fd, 0) != (char*)-1 ||
+     mmap(0, n, PROT_READ, MAP_SHARED|MAP_PRIVATE, fd, 0) != (char*)-1){
+    printf(1, "mmap accepted a bad offset, length or flags\n");
+    exit();
+  }
+
+  // Read-only: contents match, the kernel can read the mapping
+  // but not read() into it, and a user write kills the process.
+  a = mmap(0, n, PROT_READ, MAP_PRIVATE, fd, 0);
+  if(a == (char*)-1 || a < (char*)sbrk(0)){
+    printf(1, "mmap failed\n");
+    exit();
+  }
+  for(i = 0; i < n; i++)
+    if(a[i] != "abcdefghij"[i % 10]){
+      printf(1, "mmap contents wrong at %d\n", i);
+      exit();
+    }
+  if(pipe(fds) != 0 || write(fds[1], a + 4096, 4) != 4 || read(fds[0], a, 2) != -1 ||
+     a[0] != 'a' || read(fds[0], buf, 4) != 4 || buf[0] != "abcdefghij"[4096 % 10]){
+    printf(1, "mmap pipe i/o failed\n");
+    exit();
+  }
+  close(fds[0]);
+  close(fds[1]);
+  pid = fork();
+  if(pid == 0){
+    a[4096] = 'x';
+    printf(1, "mmap write to read-only mapping succeeded\n");
+    exit();
+  }
+  wait();
+  if(munmap(a, n) != 0 || munmap(a, n) == 0){
+    printf(1, "munmap failed\n");
+    exit();
+  }
+
+  // Private: writes stay in memory.
+  a = mmap(0, n - 4096, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 4096);
+  if(a == (char*)-1){
+    printf(1, "mmap private failed\n");
+    exit();
+  }
+  a[0] = 'P';
+  if(munmap(a, 4096) == 0 || munmap(a, n - 4096) != 0){
+    printf(1, "munmap length not checked\n");
+    exit();
+  }
+
+  // Shared: read-only only, since it can't be kept coherent
+  // with write().
+  if(mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 4096) != (char*)-1){
+    printf(1, "mmap shared writable accepted\n");
+    exit();
+  }
+  a = mmap(0, 4096 + 100, PROT_READ, MAP_SHARED, fd, 4096);
+  if(a == (char*)-1 || a[1] != "abcdefghij"[4097 % 10]){
+    printf(1, "mmap shared failed\n");
+    exit();
+  }
+  munmap(a, 4096 + 100);
+  close(fd);
+
+  fd = open("mmapfile", O_RDONLY);
+  if(fd < 0){
+    printf(1, "mmap reopen failed\n");
+    exit();
+  }
+  for(i = 0; i < n; i++){
+    if(read(fd, buf, 1) != 1){
+      printf(1, "mmap read back failed\n");
+      exit();
+    }
+    if(buf[0] != "abcdefghij"[i % 10]){
+      printf(1, "mmap file wrong at %d\n", i);
+      exit();
+    }
+  }
+  close(fd);
+  unlink("mmapfile");
+  printf(1, "mmap test OK\n");
+}
+
+// A running program's file can't be written.
+void
+textbusytest(void)
+{
+  int fd;
+
+  printf(1, "text busy test\n");
+  fd = open("usertests", O_RDWR);
+  if(fd < 0){
+    printf(1, "text busy open failed\n");
+    exit();
+  }
+  if(write(fd, "x", 1) != -1){
+    printf(1, "text busy write succeeded\n");
+    exit();
+  }
+  close(fd);
+  printf(1, "text busy test OK\n");
+}
+
+// Many small transactions back to back fill the log between
+// checkpoints; the inode table and the files must survive.
+void
+logtest(void)
+{
+  struct dirent de;
+  struct stat st;
+  char name[DIRSIZ+1];
+  int fd, i, round;
+
+  printf(1, "log test\n");
+  name[0] = 'L';
+  name[3] = 0;
+  for(round = 0; round < 4; round++){
+    for(i = 0; i < 40; i++){
+      name[1] = '0' + i / 10;
+      name[2] = '0' + i % 10;
+      fd = open(name, O_CREATE|O_RDWR);
+      if(fd < 0){
+        printf(1, "log create %s failed\n", name);
+        exit();
+      }
+      buf[0] = round;
+      buf[1] = i;
+      if(write(fd, buf, 512) != 512){
+        printf(1, "log write failed\n");
+        exit();
+      }
+      close(fd);
+    }
+  }
+
+  if(sync() != 0){
+    printf(1, "log sync failed\n");
+    exit();
+  }
+
+  // Re-read every inode in the directory, from disk if the
+  // kernel allows dropping the cache.
+  bdrop();
+  fd = open(".", O_RDONLY);
+  while(read(fd, &de, sizeof(de)) == sizeof(de)){
+    if(de.inum == 0)
+      continue;
+    memmove(name, de.name, DIRSIZ);
+    name[DIRSIZ] = 0;
+    if(stat(name, &st) < 0 || st.ino != de.inum || st.type == 0 || st.nlink < 1){
+      printf(1, "log inode %d (%s) corrupt\n", de.inum, name);
+      exit();
+    }
+  }
+  close(fd);
+
+  name[3] = 0;
+  for(i = 0; i < 40; i++){
+    name[1] = '0' + i / 10;
+    name[2] = '0' + i % 10;
+    fd = open(name, O_RDONLY);
+    if(fd < 0 || read(fd, buf, 512) != 512 || buf[0] != 3 || buf[1] != i){
+      printf(1, "log read %s failed\n", name);
+      exit();
+    }
+    close(fd);
+    unlink(name);
+  }
+  printf(1, "log test OK\n");
+}
+
+// Blocks just written are found in the buffer cache when
+// read back.
+void
+bcachetest(void)
+{
+  static struct bstat st0, st1;
+  static char buf[BSIZE];
+  int fd, i;
+
+  printf(1, "bcache test\n");
+  unlink("bcachefile");
+  fd = open("bcachefile", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(1, "bcache create failed\n");
+    exit();
+  }
+  for(i = 0; i < 20; i++){
+    buf[0] = i;
+    if(write(fd, buf, BSIZE) != BSIZE){
+      printf(1, "bcache write failed\n");
+      exit();
+    }
+  }
+  close(fd);
+  if(bstat(&st0) < 0){
+    printf(1, "bstat failed\n");
+    exit();
+  }
+  fd = open("bcachefile", O_RDONLY);
+  for(i = 0; i < 20; i++){
+    if(read(fd, buf, BSIZE) != BSIZE || buf[0] != i){
+      printf(1, "bcache read failed\n");
+      exit();
+    }
+  }
+  close(fd);
+  bstat(&st1);
+  if(st1.hits - st0.hits < 20 || st1.misses != st0.misses){
+    printf(1, "bcache read back missed: %d hits, %d misses\n",
+           st1.hits - st0.hits, st1.misses - st0.misses);
+    exit();
+  }
+  if(st1.nbuf > st1.maxbuf || st1.nin + st1.nam != st1.nbuf){
+    printf(1, "bcache counts inconsistent\n");
+    exit();
+  }
+  unlink("bcachefile");
+  printf(1, "bcache test OK\n");
+}
+
+// Start several asynchronous reads and finish them out of order.
+void
+aiotest(void)
+{
+  static char buf[3*BSIZE];
+  int fd, i, id[3];
+
+  printf(1, "aio test\n");
+  unlink("aiofile");
+  fd = open("aiofile", O_CREATE|O_RDWR);
+  for(i = 0; i < sizeof(buf); i++)
+    buf[i] = i / BSIZE + 'a';
+  if(fd < 0 || write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    printf(1, "aio create failed\n");
+    exit();
+  }
+  close(fd);
+
+  fd = open("aiofile", O_RDONLY);
+  memset(buf, 0, sizeof(buf));
+  for(i = 0; i < 3; i++){
+    if((id[i] = aread(fd, buf + i*BSIZE, BSIZE)) < 0){
+      printf(1, "aread failed\n");
+      exit();
+    }
+  }
+  // The reads advanced the offset; the file is now at its end.
+  if(aread(fd, buf, 1) < 0 || read(fd, buf, 1) != 0){
+    printf(1, "aread didn't advance the offset\n");
+    exit();
+  }
+  close(fd);
+  while(apoll(id[0]) == 0)
+    ;
+  if(apoll(id[0]) != 1 || apoll(-1) != -1){
+    printf(1, "apoll failed\n");
+    exit();
+  }
+  for(i = 2; i >= 0; i--){
+    if(await(id[i]) != BSIZE || buf[i*BSIZE] != i + 'a' || buf[i*BSIZE + BSIZE-1] != i + 'a'){
+      printf(1, "await %d failed\n", i);
+      exit();
+    }
+  }
+  if(await(id[0]) != -1 || await(-1) != -1){
+    printf(1, "await of a finished read succeeded\n");
+    exit();
+  }
+  unlink("aiofile");
+  printf(1, "aio test OK\n");
+}
+
+// Number of struct files allocated from the slab cache.
+int
+filesinuse(void)
+{
+  static struct slabstat st;
+  int i;
+
+  if(slabstat(&st) < 0){
+    printf(1, "slabstat failed\n");
+    exit();
+  }
+  for(i = 0; i < st.n; i++)
+    if(strcmp(st.cache[i].name, "file") == 0)
+      return st.cache[i].inuse;
+  printf(1, "no file slab cache\n");
+  exit();
+}
+
+// Files come from a slab cache instead of a fixed table,
+// so more than the old limit of 100 can be open at once.
+void
+slabtest(void)
+{
+  int go[2], fds[2], i, j, n0, t;
+  char c;
+
+  printf(1, "slab test\n");
+  n0 = filesinuse();
+  if(pipe(go) != 0){
+    printf(1, "slab pipe failed\n");
+    exit();
+  }
+  for(i = 0; i < 10; i++){
+    if(fork() == 0){
+      close(go[1]);
+      for(j = 0; j < 6; j++){
+        if(pipe(fds) != 0){
+          printf(1, "slab child pipe failed\n");
+          exit();
+        }
+      }
+      read(go[0], &c, 1);
+      exit();
+    }
+  }
+  for(t = 0; filesinuse() < n0 + 2 + 10*12; t++){
+    if(t > 500){
+      printf(1, "slab files never reached %d\n", n0 + 2 + 10*12);
+      exit();
+    }
+    sleep(1);
+  }
+  close(go[0]);
+  close(go[1]);
+  for(i = 0; i < 10; i++)
+    wait();
+  if(filesinuse() != n0){
+    printf(1, "slab leaked %d files\n", filesinuse() - n0);
+    exit();
+  }
+  printf(1, "slab test OK\n");
+}
+
+// spawn() and spawnn() create children without fork().
+void
+spawntest(void)
+{
+  int n, pids[4];
+  char *args[] = { "echo", "spawned", 0 };
+
+  printf(1, "spawn test\n");
+
+  if(spawn("nosuchprog", args, 1) != -1){
+    printf(1, "spawn of missing program succeeded\n");
+    exit();
+  }
+  if(spawn("echo", args, 4) != -1){
+    printf(1, "spawn with bad priority succeeded\n");
+    exit();
+  }
+
+  n = spawnn("echo", args, 1, 4, pids);
+  if(n != 4){
+    printf(1, "spawnn created %d of 4\n", n);
+    exit();
+  }
+  for(; n > 0; n--){
+    if(wait() < 0){
+      printf(1, "spawn wait stopped early\n");
+      exit();
+    }
+  }
+  if(wait() != -1){
+    printf(1, "spawn wait got too many\n");
+    exit();
+  }
+
+  printf(1, "spawn test OK\n");
+}
+
 void
 sbrktest(void)
 {
@@ -1767,6 +2367,7 @@ main(int argc, char *argv[])
   bigargtest();
   bsstest();
   sbrktest();
+  lazytest();
   validatetest();
 
   opentest();
@@ -1792,6 +2393,16 @@ main(int argc, char *argv[])
   dirfile();
   iref();
   forktest();
+  cowtest();
+  vforktest();
+  spawntest();
+  slabtest();
+  shmtest();
+  mmaptest();
+  textbusytest();
+  logtest();
+  bcachetest();
+  aiotest();
   bigdir(); // slow
 
   uio();
@@ -0,0 +1,260 @@
+// Driver for a virtio block device (legacy PCI interface),
+// used instead of IDE for the file system disk (ROOTDEV) when
+// QEMU provides one; see "make qemu DISK=virtio".
+//
+// Requests go to the device through a virtqueue: a table of
+// descriptors naming the memory of each request, a ring in
+// which the driver posts requests (avail), and a ring in which
+// the device returns them when done (used).  Unlike the IDE
+// disk, the device takes as many requests at once as there are
+// descriptors for, and each interrupt returns every request
+// that has finished since the last.  Requests that don't fit
+// wait on a pending list until descriptors are freed.
+//
+// The disk driver in ide.c hands requests for the device to
+// virtiosubmit() with idelock held, and virtiointr() passes
+// finished ones back to idedone().
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+
+#define VIRTIO_VENDOR     0x1AF4
+#define VIRTIO_BLK        0x1001   // legacy block device ID
+
+// Legacy virtio registers, at the I/O address in BAR0.
+#define VIO_GUESTFEAT     0x04
+#define VIO_QADDR         0x08     // queue address / PGSIZE
+#define VIO_QSIZE         0x0C
+#define VIO_QSELECT       0x0E
+#define VIO_QNOTIFY       0x10
+#define VIO_STATUS        0x12
+#define VIO_ISR           0x13
+
+// Device status bits.
+#define VS_ACK            1
+#define VS_DRIVER         2
+#define VS_DRIVER_OK      4
+
+#define VQMAX             256      // largest queue we handle
+
+struct vdesc {
+  uint addr;
+  uint addrhi;
+  uint len;
+  ushort flags;
+  ushort next;
+};
+#define VD_NEXT           1        // chained with next
+#define VD_WRITE          2        // device writes (vs read)
+
+struct vavail {
+  ushort flags;
+  ushort idx;
+  ushort ring[];
+};
+
+struct vused {
+  ushort flags;
+  ushort idx;
+  struct {
+    uint id;
+    uint len;
+  } ring[];
+};
+
+// The header and status of a block request.
+struct vreq {
+  uint type;
+  uint reserved;
+  uint sector;
+  uint sectorhi;
+  uchar status;
+  struct buf *b;
+};
+#define VBLK_IN           0
+#define VBLK_OUT          1
+
+int virtioirq = -1;
+
+static struct {
+  struct spinlock lock;
+  ushort base;
+  int n;                   // queue size
+  char *mem;
+  int order;
+  struct vdesc *desc;
+  struct vavail *avail;
+  struct vused *used;
+  ushort usedidx;          // next used entry to look at
+  ushort freedesc[VQMAX];  // stack of free descriptors
+  int nfree;
+  struct vreq req[VQMAX];  // indexed by first descriptor
+  struct buf *pending;     // waiting for descriptors, through qnext
+  struct buf *pendtail;
+} vdisk;
+
+// Find and set up a virtio block device.
+// Returns 0 on success, -1 if there is none.
+int
+virtioinit(void)
+{
+  int tag, i, sz;
+  uint bar, usedoff;
+
+  if((tag = pcifindid(VIRTIO_VENDOR, VIRTIO_BLK)) < 0)
+    return -1;
+  bar = pciread(tag, 0x10);                     // BAR0
+  if(!(bar & 1))
+    return -1;
+  pciwrite(tag, 0x04, pciread(tag, 0x04) | 0x5);  // I/O and bus master
+  vdisk.base = bar & ~3;
+  initlock(&vdisk.lock, "virtio");
+
+  outb(vdisk.base + VIO_STATUS, 0);             // reset
+  outb(vdisk.base + VIO_STATUS, VS_ACK);
+  outb(vdisk.base + VIO_STATUS, VS_ACK|VS_DRIVER);
+  outl(vdisk.base + VIO_GUESTFEAT, 0);          // no optional features
+
+  // The queue's size is set by the device; lay it out as the
+  // legacy interface requires, with the used ring on a page
+  // boundary after the descriptors and the avail ring.
+  outw(vdisk.base + VIO_QSELECT, 0);
+  vdisk.n = inw(vdisk.base + VIO_QSIZE);
+  if(vdisk.n == 0 || vdisk.n > VQMAX)
+    return -1;
+  usedoff = PGROUNDUP(16*vdisk.n + 6 + 2*vdisk.n);
+  sz = usedoff + PGROUNDUP(6 + 8*vdisk.n);
+  for(vdisk.order = 0; (PGSIZE << vdisk.order) < sz; vdisk.order++)
+    ;
+  if((vdisk.mem = kalloc_order(vdisk.order)) == 0)
+    return -1;
+  memset(vdisk.mem, 0, PGSIZE << vdisk.order);
+  vdisk.desc = (struct vdesc*)vdisk.mem;
+  vdisk.avail = (struct vavail*)(vdisk.mem + 16*vdisk.n);
+  vdisk.used = (struct vused*)(vdisk.mem + usedoff);
+  for(i = 0; i < vdisk.n; i++)
+    vdisk.freedesc[i] = i;
+  vdisk.nfree = vdisk.n;
+  outl(vdisk.base + VIO_QADDR, V2P(vdisk.mem) / PGSIZE);
+
+  outb(vdisk.base + VIO_STATUS, VS_ACK|VS_DRIVER|VS_DRIVER_OK);
+  virtioirq = pciread(tag, 0x3C) & 0xFF;        // interrupt line
+  ioapicenablelevel(virtioirq, ncpu - 1);
+  cprintf("virtio: block device at 0x%x irq %d, %d requests\n",
+          vdisk.base, virtioirq, vdisk.n / 3);
+  return 0;
+}
+
+// Post b to the device.  Caller holds vdisk.lock and has
+// checked that there are three free descriptors.
+static void
+vstart(struct buf *b)
+{
+  int d0, d1, d2;
+  struct vreq *r;
+
+  d0 = vdisk.freedesc[--vdisk.nfree];
+  d1 = vdisk.freedesc[--vdisk.nfree];
+  d2 = vdisk.freedesc[--vdisk.nfree];
+  r = &vdisk.req[d0];
+  r->type = (b->flags & B_DIRTY) ? VBLK_OUT : VBLK_IN;
+  r->reserved = 0;
+  r->sector = b->blockno * (BSIZE / 512);
+  r->sectorhi = 0;
+  r->status = 0xFF;
+  r->b = b;
+
+  vdisk.desc[d0].addr = V2P(r);
+  vdisk.desc[d0].len = 16;
+  vdisk.desc[d0].flags = VD_NEXT;
+  vdisk.desc[d0].next = d1;
+  vdisk.desc[d1].addr = V2P(b->data);
+  vdisk.desc[d1].len = BSIZE;
+  vdisk.desc[d1].flags = VD_NEXT | ((b->flags & B_DIRTY) ? 0 : VD_WRITE);
+  vdisk.desc[d1].next = d2;
+  vdisk.desc[d2].addr = V2P(&r->status);
+  vdisk.desc[d2].len = 1;
+  vdisk.desc[d2].flags = VD_WRITE;
+  vdisk.desc[d2].next = 0;
+
+  vdisk.avail->ring[vdisk.avail->idx % vdisk.n] = d0;
+  __sync_synchronize();
+  vdisk.avail->idx++;
+  __sync_synchronize();
+}
+
+// Start the request for b, or queue it until descriptors
+// are free.  Caller holds idelock.
+void
+virtiosubmit(struct buf *b)
+{
+  acquire(&vdisk.lock);
+  if(vdisk.pending == 0 && vdisk.nfree >= 3){
+    vstart(b);
+    outw(vdisk.base + VIO_QNOTIFY, 0);
+  } else {
+    b->qnext = 0;
+    if(vdisk.pending)
+      vdisk.pendtail->qnext = b;
+    else
+      vdisk.pending = b;
+    vdisk.pendtail = b;
+  }
+  release(&vdisk.lock);
+}
+
+// Interrupt handler.
+void
+virtiointr(void)
+{
+  struct buf *b, *done;
+  struct vreq *r;
+  int d, started;
+
+  // Acknowledge the interrupt, dropping the line, before
+  // looking at the used ring: a request that finishes after
+  // this raises the line again.
+  inb(vdisk.base + VIO_ISR);
+
+  acquire(&vdisk.lock);
+  done = 0;
+  while(vdisk.usedidx != vdisk.used->idx){
+    __sync_synchronize();
+    d = vdisk.used->ring[vdisk.usedidx % vdisk.n].id;
+    vdisk.usedidx++;
+    r = &vdisk.req[d];
+    if(r->status != 0)
+      panic("virtio: disk error");
+    b = r->b;
+    r->b = 0;
+    b->qnext = done;
+    done = b;
+    vdisk.freedesc[vdisk.nfree++] = vdisk.desc[vdisk.desc[d].next].next;
+    vdisk.freedesc[vdisk.nfree++] = vdisk.desc[d].next;
+    vdisk.freedesc[vdisk.nfree++] = d;
+  }
+
+  // Start waiting requests in the freed descriptors.
+  started = 0;
+  while(vdisk.pending && vdisk.nfree >= 3){
+    b = vdisk.pending;
+    vdisk.pending = b->qnext;
+    vstart(b);
+    started = 1;
+  }
+  if(started)
+    outw(vdisk.base + VIO_QNOTIFY, 0);
+  release(&vdisk.lock);
+
+  if(done)
+    idedone(done);
+}
@@ -39,13 +39,14 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
   pte_t *pgtab;
 
   pde = &pgdir[PDX(va)];
+  if(*pde & PTE_PS)
+    panic("walkpgdir: large page");
   if(*pde & PTE_P){
     pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
   } else {
-    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
-      return 0;
     // Make sure all those PTE_P bits are zero.
-    memset(pgtab, 0, PGSIZE);
+    if(!alloc || (pgtab = (pte_t*)kalloc_zeroed()) == 0)
+      return 0;
     // The permissions here are overly generous, but they can
     // be further restricted by the permissions in the page table
     // entries, if necessary.
@@ -79,6 +80,32 @@ mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
   return 0;
 }
 
+// Map [va, va+size) to pa for the kernel, using 4MB pages
+// wherever va and pa are 4MB-aligned and a whole 4MB remains,
+// and mappages() for the rest.  va, size and pa must be
+// page-aligned.
+static int
+mapkernel(pde_t *pgdir, char *va, uint size, uint pa, int perm)
+{
+  uint n;
+
+  while(size > 0){
+    n = LPGSIZE - (uint)va % LPGSIZE;
+    if(n > size)
+      n = size;
+    if(n == LPGSIZE && pa % LPGSIZE == 0){
+      if(pgdir[PDX(va)] & PTE_P)
+        panic("remap");
+      pgdir[PDX(va)] = pa | perm | PTE_P | PTE_PS;
+    } else if(mappages(pgdir, va, n, pa, perm) < 0)
+      return -1;
+    va += n;
+    pa += n;
+    size -= n;
+  }
+  return 0;
+}
+
 // There is one page table per process, plus one that's used when
 // a CPU is not running any process (kpgdir). The kernel uses the
 // current process's page table during system calls and interrupts;
@@ -92,16 +119,18 @@ mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
 //   KERNBASE..KERNBASE+EXTMEM: mapped to 0..EXTMEM (for I/O space)
 //   KERNBASE+EXTMEM..data: mapped to EXTMEM..V2P(data)
 //                for the kernel's instructions and r/o data
-//   data..KERNBASE+PHYSTOP: mapped to V2P(data)..PHYSTOP,
-//                                  rw data + free physical memory
+//   data..KERNBASE+phystop: mapped to V2P(data)..phystop,
+//                                  rw data + free physical memory,
+//                                  with 4MB pages above the first 4MB
 //   0xfe000000..0: mapped direct (devices such as ioapic)
 //
 // The kernel allocates physical memory for its heap and for user memory
-// between V2P(end) and the end of physical memory (PHYSTOP)
-// (directly addressable from end..P2V(PHYSTOP)).
+// between V2P(end) and the end of physical memory (phystop, found
+// at boot) (directly addressable from end..P2V(phystop)).
 
 // This table defines the kernel's mappings, which are present in
-// every process's page table.
+// every process's page table.  The data entry really ends at
+// phystop, which isn't known until boot; setupkvm() fills it in.
 static struct kmap {
   void *virt;
   uint phys_start;
@@ -110,7 +139,7 @@ static struct kmap {
 } kmap[] = {
  { (void*)KERNBASE, 0,             EXTMEM,    PTE_W}, // I/O space
  { (void*)KERNLINK, V2P(KERNLINK), V2P(data), 0},     // kern text+rodata
- { (void*)data,     V2P(data),     PHYSTOP,   PTE_W}, // kern data+memory
+ { (void*)data,     V2P(data),     0,         PTE_W}, // kern data+memory
  { (void*)DEVSPACE, DEVSPACE,      0,         PTE_W}, // more devices
 };
 
@@ -120,18 +149,22 @@ setupkvm(void)
 {
   pde_t *pgdir;
   struct kmap *k;
+  uint end;
 
-  if((pgdir = (pde_t*)kalloc()) == 0)
+  if((pgdir = (pde_t*)kalloc_zeroed()) == 0)
     return 0;
-  memset(pgdir, 0, PGSIZE);
-  if (P2V(PHYSTOP) > (void*)DEVSPACE)
-    panic("PHYSTOP too high");
-  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
-    if(mappages(pgdir, k->virt, k->phys_end - k->phys_start,
-                (uint)k->phys_start, k->perm) < 0) {
+  if (P2V(PHYSMAX) > (void*)DEVSPACE)
+    panic("PHYSMAX too high");
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++){
+    end = k->phys_end;
+    if(k->virt == data)
+      end = phystop;
+    if(mapkernel(pgdir, k->virt, end - k->phys_start,
+                 (uint)k->phys_start, k->perm) < 0) {
       freevm(pgdir);
       return 0;
     }
+  }
   return pgdir;
 }
 
@@ -177,6 +210,38 @@ switchuvm(struct proc *p)
   popcli();
 }
 
+// Discard stale TLB entries after changing PTEs for
+// [va, va+len) in pgdir, if pgdir is the page table this
+// CPU is using.  A process's page table is only loaded on
+// the CPU running it, and switchuvm() reloads CR3 whenever
+// it moves, so other CPUs never need flushing.  Up to
+// TLBFLUSHMAX pages are flushed one at a time with invlpg;
+// past that a CR3 reload is cheaper.
+// Only PTEs that were present need flushing: the TLB
+// never caches not-present entries.
+#define TLBFLUSHMAX 32
+
+static void
+tlbflush(pde_t *pgdir, uint va, uint len)
+{
+  struct proc *p = myproc();
+  uint a, last;
+
+  if(p == 0 || p->pgdir != pgdir || len == 0)
+    return;
+  a = PGROUNDDOWN(va);
+  last = PGROUNDDOWN(va + len - 1);
+  if((last - a) / PGSIZE >= TLBFLUSHMAX){
+    lcr3(V2P(pgdir));
+    return;
+  }
+  for(;; a += PGSIZE){
+    invlpg((void*)a);
+    if(a == last)
+      break;
+  }
+}
+
 // Load the initcode into address 0 of pgdir.
 // sz must be less than a page.
 void
@@ -186,58 +251,33 @@ inituvm(pde_t *pgdir, char *init, uint sz)
 
   if(sz >= PGSIZE)
     panic("inituvm: more than a page");
-  mem = kalloc();
-  memset(mem, 0, PGSIZE);
+  mem = kalloc_zeroed();
   mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
   memmove(mem, init, sz);
 }
 
-// Load a program segment into pgdir.  addr must be page-aligned
-// and the pages from addr to addr+sz must already be mapped.
-int
-loaduvm(pde_t *pgdir, char *addr, struct inode *ip, uint offset, uint sz)
-{
-  uint i, pa, n;
-  pte_t *pte;
-
-  if((uint) addr % PGSIZE != 0)
-    panic("loaduvm: addr must be page aligned");
-  for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
-      panic("loaduvm: address should exist");
-    pa = PTE_ADDR(*pte);
-    if(sz - i < PGSIZE)
-      n = sz - i;
-    else
-      n = PGSIZE;
-    if(readi(ip, P2V(pa), offset+i, n) != n)
-      return -1;
-  }
-  return 0;
-}
-
 // Allocate page tables and physical memory to grow process from oldsz to
 // newsz, which need not be page aligned.  Returns new size or 0 on error.
+// Only not-present PTEs change, so there is nothing to flush.
 int
 allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 {
   char *mem;
   uint a;
 
-  if(newsz >= KERNBASE)
+  if(newsz >= UMAPBASE)
     return 0;
   if(newsz < oldsz)
     return oldsz;
 
   a = PGROUNDUP(oldsz);
   for(; a < newsz; a += PGSIZE){
-    mem = kalloc();
+    mem = kalloc_zeroed();
     if(mem == 0){
       cprintf("allocuvm out of memory\n");
       deallocuvm(pgdir, newsz, oldsz);
       return 0;
     }
-    memset(mem, 0, PGSIZE);
     if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
       cprintf("allocuvm out of memory (2)\n");
       deallocuvm(pgdir, newsz, oldsz);
@@ -256,11 +296,13 @@ int
 deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 {
   pte_t *pte;
-  uint a, pa;
+  uint a, pa, lo, hi;
 
   if(newsz >= oldsz)
     return oldsz;
 
+  // [lo, hi) covers the pages actually unmapped.
+  lo = hi = 0;
   a = PGROUNDUP(newsz);
   for(; a  < oldsz; a += PGSIZE){
     pte = walkpgdir(pgdir, (char*)a, 0);
@@ -273,8 +315,12 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
       char *v = P2V(pa);
       kfree(v);
       *pte = 0;
+      if(hi == 0)
+        lo = a;
+      hi = a + PGSIZE;
     }
   }
+  tlbflush(pgdir, lo, hi - lo);
   return newsz;
 }
 
@@ -289,7 +335,8 @@ freevm(pde_t *pgdir)
     panic("freevm: no pgdir");
   deallocuvm(pgdir, KERNBASE, 0);
   for(i = 0; i < NPDENTRIES; i++){
-    if(pgdir[i] & PTE_P){
+    // Large pages map memory directly, with no page table.
+    if((pgdir[i] & PTE_P) && !(pgdir[i] & PTE_PS)){
       char * v = P2V(PTE_ADDR(pgdir[i]));
       kfree(v);
     }
@@ -311,39 +358,353 @@ clearpteu(pde_t *pgdir, char *uva)
 }
 
 // Given a parent process's page table, create a copy
-// of it for a child.
+// of it for a child.  No memory is copied: writable pages
+// are made read-only and PTE_COW in both page tables and
+// shared, and cowfault() copies a page when either side
+// first writes to it.  Shared memory (PTE_SHM) stays writable
+// and is simply shared.
 pde_t*
 copyuvm(pde_t *pgdir, uint sz)
 {
   pde_t *d;
   pte_t *pte;
-  uint pa, i, flags;
-  char *mem;
+  uint pa, i, flags, lo, hi;
 
   if((d = setupkvm()) == 0)
     return 0;
-  for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
-      panic("copyuvm: pte should exist");
+  // [lo, hi) covers the parent's pages made read-only.
+  lo = hi = 0;
+  for(i = 0; i < KERNBASE; i += PGSIZE){
+    // Skip the unused space between the heap and the shared
+    // mappings at UMAPBASE.
+    if(i >= sz && i < UMAPBASE)
+      i = UMAPBASE;
+    // Heap pages never touched stay unbacked in the child too.
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0){
+      i = PGADDR(PDX(i) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
     if(!(*pte & PTE_P))
-      panic("copyuvm: page not present");
+      continue;
+    if((*pte & PTE_W) && !(*pte & PTE_SHM)){
+      *pte = (*pte & ~PTE_W) | PTE_COW;
+      if(hi == 0)
+        lo = i;
+      hi = i + PGSIZE;
+    }
     pa = PTE_ADDR(*pte);
     flags = PTE_FLAGS(*pte);
-    if((mem = kalloc()) == 0)
+    if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
       goto bad;
-    memmove(mem, (char*)P2V(pa), PGSIZE);
-    if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0) {
-      kfree(mem);
-      goto bad;
-    }
+    kdup(P2V(pa));
   }
+  // The parent may still hold writable TLB entries.
+  tlbflush(pgdir, lo, hi - lo);
   return d;
 
 bad:
+  tlbflush(pgdir, lo, hi - lo);
   freevm(d);
   return 0;
 }
 
+// Handle a write to the copy-on-write page at user virtual
+// address va in pgdir, which must be the current page table.
+// The last sharer of a page simply gets it back writable;
+// others get a private copy.  Returns 0 if the write can be
+// retried, -1 if va is not a copy-on-write page or memory
+// is exhausted.
+int
+cowfault(pde_t *pgdir, uint va)
+{
+  pte_t *pte;
+  uint pa, flags;
+  char *mem;
+
+  if(va >= KERNBASE || (pte = walkpgdir(pgdir, (void*)va, 0)) == 0)
+    return -1;
+  if((*pte & (PTE_P|PTE_U|PTE_COW)) != (PTE_P|PTE_U|PTE_COW))
+    return -1;
+  pa = PTE_ADDR(*pte);
+  flags = (PTE_FLAGS(*pte) | PTE_W) & ~PTE_COW;
+  if(krefcnt(P2V(pa)) == 1){
+    *pte = pa | flags;
+  } else {
+    if((mem = kalloc()) == 0)
+      return -1;
+    memmove(mem, (char*)P2V(pa), PGSIZE);
+    *pte = V2P(mem) | flags;
+    kfree(P2V(pa));
+  }
+  tlbflush(pgdir, va, 1);
+  return 0;
+}
+
+// Back the unmapped user page containing va with a zeroed page.
+// Returns 0 on success, -1 if out of memory.
+static int
+zerofault(pde_t *pgdir, uint va)
+{
+  char *mem;
+
+  if((mem = kalloc_zeroed()) == 0)
+    return -1;
+  if(mappages(pgdir, (char*)PGROUNDDOWN(va), PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
+// Record a region of len bytes of ip at offset off, to be
+// mapped at start, in the first unused slot of v.
+// Returns 0 on success, -1 if v is full.
+int
+vmaadd(struct vma *v, uint start, uint len, uint off, struct inode *ip, int flags)
+{
+  struct vma *s;
+
+  if((s = vmaslot(v)) == 0)
+    return -1;
+  s->start = start;
+  s->len = len;
+  s->off = off;
+  s->ip = idup(ip);
+  s->flags = flags;
+  if(!(flags & VMA_MMAP))
+    itext(ip, 1);
+  return 0;
+}
+
+// Return the first unused slot of v, or 0 if v is full.
+struct vma*
+vmaslot(struct vma *v)
+{
+  int i;
+
+  for(i = 0; i < NVMA; i++)
+    if(v[i].ip == 0 && v[i].shm == 0)
+      return &v[i];
+  return 0;
+}
+
+// Find len bytes of address space in UMAPBASE..KERNBASE not
+// used by any region of v.  Returns the start, or 0 if none.
+uint
+vmagap(struct vma *v, uint len)
+{
+  uint a;
+  int i;
+
+  len = PGROUNDUP(len);
+  for(a = UMAPBASE; a + len > a && a + len <= KERNBASE; ){
+    for(i = 0; i < NVMA; i++){
+      if((v[i].ip || v[i].shm) && v[i].start < a + len &&
+         a < PGROUNDUP(v[i].start + v[i].len))
+        break;
+    }
+    if(i == NVMA)
+      return a;
+    a = PGROUNDUP(v[i].start + v[i].len);
+  }
+  return 0;
+}
+
+// Copy the regions in src to dst, taking new references
+// to their files and segments.  Used by fork.
+void
+vmadup(struct vma *dst, struct vma *src)
+{
+  int i;
+
+  for(i = 0; i < NVMA; i++){
+    dst[i] = src[i];
+    if(src[i].ip){
+      dst[i].ip = idup(src[i].ip);
+      if(!(src[i].flags & VMA_MMAP))
+        itext(src[i].ip, 1);
+    }
+    if(src[i].shm)
+      shmdup(src[i].shm);
+  }
+}
+
+// Release all regions in v.  Must not be called inside a
+// transaction, since iput() needs one of its own.  The
+// pages mapped for the regions are left to freevm().
+void
+vmafree(struct vma *v)
+{
+  int i;
+
+  for(i = 0; i < NVMA; i++){
+    if(v[i].shm){
+      shmput(v[i].shm);
+      v[i].shm = 0;
+    }
+  }
+  for(i = 0; i < NVMA; i++)
+    if(v[i].ip)
+      break;
+  if(i == NVMA)
+    return;
+  begin_op();
+  for(i = 0; i < NVMA; i++){
+    if(v[i].ip){
+      if(!(v[i].flags & VMA_MMAP))
+        itext(v[i].ip, -1);
+      iput(v[i].ip);
+      v[i].ip = 0;
+      v[i].flags = 0;
+    }
+  }
+  end_op();
+}
+
+// Map the n pages in page[] at va in pgdir, writable and
+// shared: fork gives the child the same pages, not copies.
+// Each mapping takes its own reference to the page.
+// Returns 0 on success, -1 (with nothing mapped) on failure.
+int
+mapshared(pde_t *pgdir, uint va, char **page, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++){
+    if(mappages(pgdir, (char*)va + i*PGSIZE, PGSIZE, V2P(page[i]),
+                PTE_W|PTE_U|PTE_SHM) < 0){
+      deallocuvm(pgdir, va + i*PGSIZE, va);
+      return -1;
+    }
+    kdup(page[i]);
+  }
+  return 0;
+}
+
+// Return the end of the part of p's address space that
+// contains va: the heap top if va is below it, or the end
+// of the mapped region containing va.  Returns 0 if va
+// isn't a valid user address.
+uint
+uend(struct proc *p, uint va)
+{
+  struct vma *v;
+
+  if(va < p->sz)
+    return p->sz;
+  for(v = p->vma; v < &p->vma[NVMA]; v++)
+    if((v->shm || (v->flags & VMA_MMAP)) &&
+       va >= v->start && va < PGROUNDUP(v->start + v->len))
+      return PGROUNDUP(v->start + v->len);
+  return 0;
+}
+
+// Return the file-backed region of p containing va, or 0.
+static struct vma*
+vmafind(struct proc *p, uint va)
+{
+  struct vma *v;
+
+  for(v = p->vma; v < &p->vma[NVMA]; v++)
+    if(v->ip && va >= v->start && va < PGROUNDUP(v->start + v->len))
+      return v;
+  return 0;
+}
+
+// Back the unmapped user page containing va, which lies in
+// region v, with the page of v's file from the executable page
+// cache.  The page is shared with every other process running
+// the same program, so map it copy-on-write.  May sleep, so must
+// not be reached from a kernel fault taken with a spinlock held;
+// syscalls use faultin() on their user buffers to avoid that.
+// Returns 0 on success, -1 on error.
+static int
+filefault(pde_t *pgdir, struct vma *v, uint va)
+{
+  char *mem;
+  uint a, n;
+  pte_t *pte;
+
+  a = PGROUNDDOWN(va);
+  n = v->start + v->len - a;
+  if(n > PGSIZE)
+    n = PGSIZE;
+  if((mem = pcget(v->ip, v->off + (a - v->start), n)) == 0)
+    return -1;
+  // Someone else may have mapped the page while we slept.
+  if((pte = walkpgdir(pgdir, (char*)a, 0)) != 0 && (*pte & PTE_P)){
+    kfree(mem);
+    return 0;
+  }
+  if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_COW|PTE_U) < 0){
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
+// Handle a page fault at user virtual address va in process p,
+// raised by p itself or by the kernel touching p's memory;
+// err holds the FEC_* bits of the fault.
+// Program pages are read from the executable and heap pages
+// reserved by sbrk() are zeroed on first touch, and writes to
+// copy-on-write pages get a private copy.  A write to a
+// read-only mapping is a real fault; syscalls check their
+// buffers with faultin() first, so the kernel never takes one.
+// Returns 0 if the access can be retried, -1 for a real fault.
+int
+pagefault(struct proc *p, uint va, int err)
+{
+  pte_t *pte;
+  struct vma *v;
+
+  v = vmafind(p, va);
+  if(va >= p->sz && v == 0)
+    return -1;
+  pte = walkpgdir(p->pgdir, (char*)va, 0);
+  if(pte == 0 || (*pte & PTE_P) == 0){
+    if(v)
+      return filefault(p->pgdir, v, va);
+    return zerofault(p->pgdir, va);
+  }
+  if(!(err & FEC_WR))
+    return -1;
+  if(v && !(v->flags & VMA_WRITE))
+    return -1;
+  return cowfault(p->pgdir, va);
+}
+
+// Make sure the user pages of p covering [va, va+n) are
+// present, and writable if the kernel will write to them, so
+// that the kernel can use them without faulting on pages that
+// pagefault() would have to allocate or copy.
+// Returns 0 on success, -1 if some page can't be backed.
+int
+faultin(struct proc *p, uint va, uint n, int write)
+{
+  uint a, last;
+  pte_t *pte;
+
+  if(n == 0)
+    return 0;
+  a = PGROUNDDOWN(va);
+  last = PGROUNDDOWN(va + n - 1);
+  for(;;){
+    pte = walkpgdir(p->pgdir, (char*)a, 0);
+    if(pte == 0 || (*pte & PTE_P) == 0){
+      if(pagefault(p, a, 0) < 0)
+        return -1;
+      pte = walkpgdir(p->pgdir, (char*)a, 0);
+    }
+    if(write && (*pte & PTE_W) == 0 && pagefault(p, a, FEC_WR) < 0)
+      return -1;
+    if(a == last)
+      break;
+    a += PGSIZE;
+  }
+  return 0;
+}
+
 // Map user virtual address to kernel address.
 char*
 uva2ka(pde_t *pgdir, char *uva)
@@ -351,7 +712,7 @@ uva2ka(pde_t *pgdir, char *uva)
   pte_t *pte;
 
   pte = walkpgdir(pgdir, uva, 0);
-  if((*pte & PTE_P) == 0)
+  if(pte == 0 || (*pte & PTE_P) == 0)
     return 0;
   if((*pte & PTE_U) == 0)
     return 0;
@@ -361,15 +722,27 @@ uva2ka(pde_t *pgdir, char *uva)
 // Copy len bytes from p to user address va in page table pgdir.
 // Most useful when pgdir is not the current page table.
 // uva2ka ensures this only works for PTE_U pages.
+// Unbacked pages are allocated and copy-on-write pages are
+// copied first, since the caller has already checked that
+// va lies within the process.
 int
 copyout(pde_t *pgdir, uint va, void *p, uint len)
 {
   char *buf, *pa0;
   uint n, va0;
+  pte_t *pte;
 
   buf = (char*)p;
   while(len > 0){
     va0 = (uint)PGROUNDDOWN(va);
+    pte = walkpgdir(pgdir, (char*)va0, 0);
+    if(pte == 0 || (*pte & PTE_P) == 0){
+      if(zerofault(pgdir, va0) < 0)
+        return -1;
+    } else if(*pte & PTE_COW){
+      if(cowfault(pgdir, va0) < 0)
+        return -1;
+    }
     pa0 = uva2ka(pgdir, (char*)va0);
     if(pa0 == 0)
       return -1;
@@ -0,0 +1,1238 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <wc>:
+
+char buf[512];
+
+void
+wc(int fd, char *name)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	57                   	push   %edi
+   4:	56                   	push   %esi
+   5:	53                   	push   %ebx
+   6:	83 ec 1c             	sub    $0x1c,%esp
+  int i, n;
+  int l, w, c, inword;
+
+  l = w = c = 0;
+  inword = 0;
+   9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  l = w = c = 0;
+  10:	be 00 00 00 00       	mov    $0x0,%esi
+  15:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  1c:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  23:	83 ec 04             	sub    $0x4,%esp
+  26:	68 00 02 00 00       	push   $0x200
+  2b:	68 00 0b 00 00       	push   $0xb00
+  30:	ff 75 08             	push   0x8(%ebp)
+  33:	e8 e3 02 00 00       	call   31b <read>
+  38:	89 c7                	mov    %eax,%edi
+  3a:	83 c4 10             	add    $0x10,%esp
+  3d:	85 c0                	test   %eax,%eax
+  3f:	7e 54                	jle    95 <wc+0x95>
+    for(i=0; i<n; i++){
+  41:	bb 00 00 00 00       	mov    $0x0,%ebx
+  46:	eb 22                	jmp    6a <wc+0x6a>
+      c++;
+      if(buf[i] == '\n')
+        l++;
+      if(strchr(" \r\t\n\v", buf[i]))
+  48:	83 ec 08             	sub    $0x8,%esp
+  4b:	0f be c0             	movsbl %al,%eax
+  4e:	50                   	push   %eax
+  4f:	68 88 07 00 00       	push   $0x788
+  54:	e8 88 01 00 00       	call   1e1 <strchr>
+  59:	83 c4 10             	add    $0x10,%esp
+  5c:	85 c0                	test   %eax,%eax
+  5e:	74 22                	je     82 <wc+0x82>
+        inword = 0;
+  60:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    for(i=0; i<n; i++){
+  67:	83 c3 01             	add    $0x1,%ebx
+  6a:	39 fb                	cmp    %edi,%ebx
+  6c:	7d b5                	jge    23 <wc+0x23>
+      c++;
+  6e:	83 c6 01             	add    $0x1,%esi
+      if(buf[i] == '\n')
+  71:	0f b6 83 00 0b 00 00 	movzbl 0xb00(%ebx),%eax
+  78:	3c 0a                	cmp    $0xa,%al
+  7a:	75 cc                	jne    48 <wc+0x48>
+        l++;
+  7c:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+  80:	eb c6                	jmp    48 <wc+0x48>
+      else if(!inword){
+  82:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  86:	75 df                	jne    67 <wc+0x67>
+        w++;
+  88:	83 45 dc 01          	addl   $0x1,-0x24(%ebp)
+        inword = 1;
+  8c:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+  93:	eb d2                	jmp    67 <wc+0x67>
+      }
+    }
+  }
+  if(n < 0){
+  95:	78 24                	js     bb <wc+0xbb>
+    printf(1, "wc: read error\n");
+    exit();
+  }
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+  97:	83 ec 08             	sub    $0x8,%esp
+  9a:	ff 75 0c             	push   0xc(%ebp)
+  9d:	56                   	push   %esi
+  9e:	ff 75 dc             	push   -0x24(%ebp)
+  a1:	ff 75 e0             	push   -0x20(%ebp)
+  a4:	68 9e 07 00 00       	push   $0x79e
+  a9:	6a 01                	push   $0x1
+  ab:	e8 2a 04 00 00       	call   4da <printf>
+}
+  b0:	83 c4 20             	add    $0x20,%esp
+  b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  b6:	5b                   	pop    %ebx
+  b7:	5e                   	pop    %esi
+  b8:	5f                   	pop    %edi
+  b9:	5d                   	pop    %ebp
+  ba:	c3                   	ret
+    printf(1, "wc: read error\n");
+  bb:	83 ec 08             	sub    $0x8,%esp
+  be:	68 8e 07 00 00       	push   $0x78e
+  c3:	6a 01                	push   $0x1
+  c5:	e8 10 04 00 00       	call   4da <printf>
+    exit();
+  ca:	e8 34 02 00 00       	call   303 <exit>
+
+000000cf <main>:
+
+int
+main(int argc, char *argv[])
+{
+  cf:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  d3:	83 e4 f0             	and    $0xfffffff0,%esp
+  d6:	ff 71 fc             	push   -0x4(%ecx)
+  d9:	55                   	push   %ebp
+  da:	89 e5                	mov    %esp,%ebp
+  dc:	57                   	push   %edi
+  dd:	56                   	push   %esi
+  de:	53                   	push   %ebx
+  df:	51                   	push   %ecx
+  e0:	83 ec 18             	sub    $0x18,%esp
+  e3:	8b 01                	mov    (%ecx),%eax
+  e5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  e8:	8b 51 04             	mov    0x4(%ecx),%edx
+  eb:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  int fd, i;
+
+  if(argc <= 1){
+  ee:	83 f8 01             	cmp    $0x1,%eax
+  f1:	7e 07                	jle    fa <main+0x2b>
+    wc(0, "");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  f3:	be 01 00 00 00       	mov    $0x1,%esi
+  f8:	eb 2d                	jmp    127 <main+0x58>
+    wc(0, "");
+  fa:	83 ec 08             	sub    $0x8,%esp
+  fd:	68 9d 07 00 00       	push   $0x79d
+ 102:	6a 00                	push   $0x0
+ 104:	e8 f7 fe ff ff       	call   0 <wc>
+    exit();
+ 109:	e8 f5 01 00 00       	call   303 <exit>
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "wc: cannot open %s\n", argv[i]);
+      exit();
+    }
+    wc(fd, argv[i]);
+ 10e:	83 ec 08             	sub    $0x8,%esp
+ 111:	ff 37                	push   (%edi)
+ 113:	50                   	push   %eax
+ 114:	e8 e7 fe ff ff       	call   0 <wc>
+    close(fd);
+ 119:	89 1c 24             	mov    %ebx,(%esp)
+ 11c:	e8 0a 02 00 00       	call   32b <close>
+  for(i = 1; i < argc; i++){
+ 121:	83 c6 01             	add    $0x1,%esi
+ 124:	83 c4 10             	add    $0x10,%esp
+ 127:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 12a:	39 c6                	cmp    %eax,%esi
+ 12c:	7d 31                	jge    15f <main+0x90>
+    if((fd = open(argv[i], 0)) < 0){
+ 12e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 131:	8d 3c b0             	lea    (%eax,%esi,4),%edi
+ 134:	83 ec 08             	sub    $0x8,%esp
+ 137:	6a 00                	push   $0x0
+ 139:	ff 37                	push   (%edi)
+ 13b:	e8 03 02 00 00       	call   343 <open>
+ 140:	89 c3                	mov    %eax,%ebx
+ 142:	83 c4 10             	add    $0x10,%esp
+ 145:	85 c0                	test   %eax,%eax
+ 147:	79 c5                	jns    10e <main+0x3f>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+ 149:	83 ec 04             	sub    $0x4,%esp
+ 14c:	ff 37                	push   (%edi)
+ 14e:	68 ab 07 00 00       	push   $0x7ab
+ 153:	6a 01                	push   $0x1
+ 155:	e8 80 03 00 00       	call   4da <printf>
+      exit();
+ 15a:	e8 a4 01 00 00       	call   303 <exit>
+  }
+  exit();
+ 15f:	e8 9f 01 00 00       	call   303 <exit>
+
+00000164 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 164:	55                   	push   %ebp
+ 165:	89 e5                	mov    %esp,%ebp
+ 167:	56                   	push   %esi
+ 168:	53                   	push   %ebx
+ 169:	8b 75 08             	mov    0x8(%ebp),%esi
+ 16c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 16f:	89 f0                	mov    %esi,%eax
+ 171:	89 d1                	mov    %edx,%ecx
+ 173:	83 c2 01             	add    $0x1,%edx
+ 176:	89 c3                	mov    %eax,%ebx
+ 178:	83 c0 01             	add    $0x1,%eax
+ 17b:	0f b6 09             	movzbl (%ecx),%ecx
+ 17e:	88 0b                	mov    %cl,(%ebx)
+ 180:	84 c9                	test   %cl,%cl
+ 182:	75 ed                	jne    171 <strcpy+0xd>
+    ;
+  return os;
+}
+ 184:	89 f0                	mov    %esi,%eax
+ 186:	5b                   	pop    %ebx
+ 187:	5e                   	pop    %esi
+ 188:	5d                   	pop    %ebp
+ 189:	c3                   	ret
+
+0000018a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 18a:	55                   	push   %ebp
+ 18b:	89 e5                	mov    %esp,%ebp
+ 18d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 190:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 193:	eb 06                	jmp    19b <strcmp+0x11>
+    p++, q++;
+ 195:	83 c1 01             	add    $0x1,%ecx
+ 198:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 19b:	0f b6 01             	movzbl (%ecx),%eax
+ 19e:	84 c0                	test   %al,%al
+ 1a0:	74 04                	je     1a6 <strcmp+0x1c>
+ 1a2:	3a 02                	cmp    (%edx),%al
+ 1a4:	74 ef                	je     195 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 1a6:	0f b6 c0             	movzbl %al,%eax
+ 1a9:	0f b6 12             	movzbl (%edx),%edx
+ 1ac:	29 d0                	sub    %edx,%eax
+}
+ 1ae:	5d                   	pop    %ebp
+ 1af:	c3                   	ret
+
+000001b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1b6:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1bb:	eb 03                	jmp    1c0 <strlen+0x10>
+ 1bd:	83 c0 01             	add    $0x1,%eax
+ 1c0:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1c4:	75 f7                	jne    1bd <strlen+0xd>
+    ;
+  return n;
+}
+ 1c6:	5d                   	pop    %ebp
+ 1c7:	c3                   	ret
+
+000001c8 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1c8:	55                   	push   %ebp
+ 1c9:	89 e5                	mov    %esp,%ebp
+ 1cb:	57                   	push   %edi
+ 1cc:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1cf:	89 d7                	mov    %edx,%edi
+ 1d1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1d7:	fc                   	cld
+ 1d8:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1da:	89 d0                	mov    %edx,%eax
+ 1dc:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1df:	c9                   	leave
+ 1e0:	c3                   	ret
+
+000001e1 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1e1:	55                   	push   %ebp
+ 1e2:	89 e5                	mov    %esp,%ebp
+ 1e4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e7:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1eb:	eb 03                	jmp    1f0 <strchr+0xf>
+ 1ed:	83 c0 01             	add    $0x1,%eax
+ 1f0:	0f b6 10             	movzbl (%eax),%edx
+ 1f3:	84 d2                	test   %dl,%dl
+ 1f5:	74 06                	je     1fd <strchr+0x1c>
+    if(*s == c)
+ 1f7:	38 ca                	cmp    %cl,%dl
+ 1f9:	75 f2                	jne    1ed <strchr+0xc>
+ 1fb:	eb 05                	jmp    202 <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 1fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 202:	5d                   	pop    %ebp
+ 203:	c3                   	ret
+
+00000204 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 204:	55                   	push   %ebp
+ 205:	89 e5                	mov    %esp,%ebp
+ 207:	57                   	push   %edi
+ 208:	56                   	push   %esi
+ 209:	53                   	push   %ebx
+ 20a:	83 ec 1c             	sub    $0x1c,%esp
+ 20d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 210:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 215:	89 de                	mov    %ebx,%esi
+ 217:	83 c3 01             	add    $0x1,%ebx
+ 21a:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 21d:	7d 2e                	jge    24d <gets+0x49>
+    cc = read(0, &c, 1);
+ 21f:	83 ec 04             	sub    $0x4,%esp
+ 222:	6a 01                	push   $0x1
+ 224:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 227:	50                   	push   %eax
+ 228:	6a 00                	push   $0x0
+ 22a:	e8 ec 00 00 00       	call   31b <read>
+    if(cc < 1)
+ 22f:	83 c4 10             	add    $0x10,%esp
+ 232:	85 c0                	test   %eax,%eax
+ 234:	7e 17                	jle    24d <gets+0x49>
+      break;
+    buf[i++] = c;
+ 236:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 23a:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 23d:	3c 0a                	cmp    $0xa,%al
+ 23f:	0f 94 c2             	sete   %dl
+ 242:	3c 0d                	cmp    $0xd,%al
+ 244:	0f 94 c0             	sete   %al
+ 247:	08 c2                	or     %al,%dl
+ 249:	74 ca                	je     215 <gets+0x11>
+    buf[i++] = c;
+ 24b:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 24d:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 251:	89 f8                	mov    %edi,%eax
+ 253:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 256:	5b                   	pop    %ebx
+ 257:	5e                   	pop    %esi
+ 258:	5f                   	pop    %edi
+ 259:	5d                   	pop    %ebp
+ 25a:	c3                   	ret
+
+0000025b <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 25b:	55                   	push   %ebp
+ 25c:	89 e5                	mov    %esp,%ebp
+ 25e:	56                   	push   %esi
+ 25f:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 260:	83 ec 08             	sub    $0x8,%esp
+ 263:	6a 00                	push   $0x0
+ 265:	ff 75 08             	push   0x8(%ebp)
+ 268:	e8 d6 00 00 00       	call   343 <open>
+  if(fd < 0)
+ 26d:	83 c4 10             	add    $0x10,%esp
+ 270:	85 c0                	test   %eax,%eax
+ 272:	78 24                	js     298 <stat+0x3d>
+ 274:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 276:	83 ec 08             	sub    $0x8,%esp
+ 279:	ff 75 0c             	push   0xc(%ebp)
+ 27c:	50                   	push   %eax
+ 27d:	e8 d9 00 00 00       	call   35b <fstat>
+ 282:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 284:	89 1c 24             	mov    %ebx,(%esp)
+ 287:	e8 9f 00 00 00       	call   32b <close>
+  return r;
+ 28c:	83 c4 10             	add    $0x10,%esp
+}
+ 28f:	89 f0                	mov    %esi,%eax
+ 291:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 294:	5b                   	pop    %ebx
+ 295:	5e                   	pop    %esi
+ 296:	5d                   	pop    %ebp
+ 297:	c3                   	ret
+    return -1;
+ 298:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 29d:	eb f0                	jmp    28f <stat+0x34>
+
+0000029f <atoi>:
+
+int
+atoi(const char *s)
+{
+ 29f:	55                   	push   %ebp
+ 2a0:	89 e5                	mov    %esp,%ebp
+ 2a2:	53                   	push   %ebx
+ 2a3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+ 2a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+ 2ab:	eb 10                	jmp    2bd <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+ 2ad:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+ 2b0:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+ 2b3:	83 c1 01             	add    $0x1,%ecx
+ 2b6:	0f be c0             	movsbl %al,%eax
+ 2b9:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+ 2bd:	0f b6 01             	movzbl (%ecx),%eax
+ 2c0:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2c3:	80 fb 09             	cmp    $0x9,%bl
+ 2c6:	76 e5                	jbe    2ad <atoi+0xe>
+  return n;
+}
+ 2c8:	89 d0                	mov    %edx,%eax
+ 2ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2cd:	c9                   	leave
+ 2ce:	c3                   	ret
+
+000002cf <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 2cf:	55                   	push   %ebp
+ 2d0:	89 e5                	mov    %esp,%ebp
+ 2d2:	56                   	push   %esi
+ 2d3:	53                   	push   %ebx
+ 2d4:	8b 75 08             	mov    0x8(%ebp),%esi
+ 2d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 2da:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 2dd:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 2df:	eb 0d                	jmp    2ee <memmove+0x1f>
+    *dst++ = *src++;
+ 2e1:	0f b6 01             	movzbl (%ecx),%eax
+ 2e4:	88 02                	mov    %al,(%edx)
+ 2e6:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 2e9:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 2ec:	89 d8                	mov    %ebx,%eax
+ 2ee:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 2f1:	85 c0                	test   %eax,%eax
+ 2f3:	7f ec                	jg     2e1 <memmove+0x12>
+  return vdst;
+}
+ 2f5:	89 f0                	mov    %esi,%eax
+ 2f7:	5b                   	pop    %ebx
+ 2f8:	5e                   	pop    %esi
+ 2f9:	5d                   	pop    %ebp
+ 2fa:	c3                   	ret
+
+000002fb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2fb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <exit>:
+SYSCALL(exit)
+ 303:	b8 02 00 00 00       	mov    $0x2,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <wait>:
+SYSCALL(wait)
+ 30b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <pipe>:
+SYSCALL(pipe)
+ 313:	b8 04 00 00 00       	mov    $0x4,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <read>:
+SYSCALL(read)
+ 31b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <write>:
+SYSCALL(write)
+ 323:	b8 10 00 00 00       	mov    $0x10,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <close>:
+SYSCALL(close)
+ 32b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <kill>:
+SYSCALL(kill)
+ 333:	b8 06 00 00 00       	mov    $0x6,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <exec>:
+SYSCALL(exec)
+ 33b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <open>:
+SYSCALL(open)
+ 343:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <mknod>:
+SYSCALL(mknod)
+ 34b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <unlink>:
+SYSCALL(unlink)
+ 353:	b8 12 00 00 00       	mov    $0x12,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <fstat>:
+SYSCALL(fstat)
+ 35b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <link>:
+SYSCALL(link)
+ 363:	b8 13 00 00 00       	mov    $0x13,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <mkdir>:
+SYSCALL(mkdir)
+ 36b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <chdir>:
+SYSCALL(chdir)
+ 373:	b8 09 00 00 00       	mov    $0x9,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <dup>:
+SYSCALL(dup)
+ 37b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <getpid>:
+SYSCALL(getpid)
+ 383:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <sbrk>:
+SYSCALL(sbrk)
+ 38b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <sleep>:
+SYSCALL(sleep)
+ 393:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <uptime>:
+SYSCALL(uptime)
+ 39b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <setpri>:
+SYSCALL(setpri)
+ 3a3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <getpri>:
+SYSCALL(getpri)
+ 3ab:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <fork2>:
+SYSCALL(fork2)
+ 3b3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <getpinfo>:
+SYSCALL(getpinfo)
+ 3bb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <spawn>:
+SYSCALL(spawn)
+ 3c3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <spawnn>:
+SYSCALL(spawnn)
+ 3cb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <kmstat>:
+SYSCALL(kmstat)
+ 3d3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <slabstat>:
+SYSCALL(slabstat)
+ 3db:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <shmget>:
+SYSCALL(shmget)
+ 3e3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <shmat>:
+SYSCALL(shmat)
+ 3eb:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <shmdt>:
+SYSCALL(shmdt)
+ 3f3:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <mmap>:
+SYSCALL(mmap)
+ 3fb:	b8 22 00 00 00       	mov    $0x22,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <munmap>:
+SYSCALL(munmap)
+ 403:	b8 23 00 00 00       	mov    $0x23,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <bstat>:
+SYSCALL(bstat)
+ 40b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <aread>:
+SYSCALL(aread)
+ 413:	b8 25 00 00 00       	mov    $0x25,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <await>:
+SYSCALL(await)
+ 41b:	b8 26 00 00 00       	mov    $0x26,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <bdrop>:
+SYSCALL(bdrop)
+ 423:	b8 27 00 00 00       	mov    $0x27,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <vfork>:
+# exec or exit, and its ret would leave the slot holding our
+# return address free for it to overwrite.  Keep the return
+# address in %ecx, which the kernel restores for both sides.
+.globl vfork
+vfork:
+  popl %ecx
+ 42b:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+ 42c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  int $T_SYSCALL
+ 431:	cd 40                	int    $0x40
+  pushl %ecx
+ 433:	51                   	push   %ecx
+  ret
+ 434:	c3                   	ret
+
+00000435 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 435:	55                   	push   %ebp
+ 436:	89 e5                	mov    %esp,%ebp
+ 438:	83 ec 1c             	sub    $0x1c,%esp
+ 43b:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 43e:	6a 01                	push   $0x1
+ 440:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 443:	52                   	push   %edx
+ 444:	50                   	push   %eax
+ 445:	e8 d9 fe ff ff       	call   323 <write>
+}
+ 44a:	83 c4 10             	add    $0x10,%esp
+ 44d:	c9                   	leave
+ 44e:	c3                   	ret
+
+0000044f <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 44f:	55                   	push   %ebp
+ 450:	89 e5                	mov    %esp,%ebp
+ 452:	57                   	push   %edi
+ 453:	56                   	push   %esi
+ 454:	53                   	push   %ebx
+ 455:	83 ec 2c             	sub    $0x2c,%esp
+ 458:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 45b:	89 d0                	mov    %edx,%eax
+ 45d:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 45f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 463:	0f 95 c1             	setne  %cl
+ 466:	c1 ea 1f             	shr    $0x1f,%edx
+ 469:	84 d1                	test   %dl,%cl
+ 46b:	74 44                	je     4b1 <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 46d:	f7 d8                	neg    %eax
+ 46f:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 471:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 478:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 47d:	89 c8                	mov    %ecx,%eax
+ 47f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 484:	f7 f6                	div    %esi
+ 486:	89 df                	mov    %ebx,%edi
+ 488:	83 c3 01             	add    $0x1,%ebx
+ 48b:	0f b6 92 20 08 00 00 	movzbl 0x820(%edx),%edx
+ 492:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 496:	89 ca                	mov    %ecx,%edx
+ 498:	89 c1                	mov    %eax,%ecx
+ 49a:	39 f2                	cmp    %esi,%edx
+ 49c:	73 df                	jae    47d <printint+0x2e>
+  if(neg)
+ 49e:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 4a2:	74 31                	je     4d5 <printint+0x86>
+    buf[i++] = '-';
+ 4a4:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 4a9:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 4ac:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 4af:	eb 17                	jmp    4c8 <printint+0x79>
+    x = xx;
+ 4b1:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 4b3:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 4ba:	eb bc                	jmp    478 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 4bc:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 4c1:	89 f0                	mov    %esi,%eax
+ 4c3:	e8 6d ff ff ff       	call   435 <putc>
+  while(--i >= 0)
+ 4c8:	83 eb 01             	sub    $0x1,%ebx
+ 4cb:	79 ef                	jns    4bc <printint+0x6d>
+}
+ 4cd:	83 c4 2c             	add    $0x2c,%esp
+ 4d0:	5b                   	pop    %ebx
+ 4d1:	5e                   	pop    %esi
+ 4d2:	5f                   	pop    %edi
+ 4d3:	5d                   	pop    %ebp
+ 4d4:	c3                   	ret
+ 4d5:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 4d8:	eb ee                	jmp    4c8 <printint+0x79>
+
+000004da <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 4da:	55                   	push   %ebp
+ 4db:	89 e5                	mov    %esp,%ebp
+ 4dd:	57                   	push   %edi
+ 4de:	56                   	push   %esi
+ 4df:	53                   	push   %ebx
+ 4e0:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 4e3:	8d 45 10             	lea    0x10(%ebp),%eax
+ 4e6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 4e9:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 4ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 4f3:	eb 14                	jmp    509 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 4f5:	89 fa                	mov    %edi,%edx
+ 4f7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4fa:	e8 36 ff ff ff       	call   435 <putc>
+ 4ff:	eb 05                	jmp    506 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 501:	83 fe 25             	cmp    $0x25,%esi
+ 504:	74 25                	je     52b <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 506:	83 c3 01             	add    $0x1,%ebx
+ 509:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 50c:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 510:	84 c0                	test   %al,%al
+ 512:	0f 84 20 01 00 00    	je     638 <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 518:	0f be f8             	movsbl %al,%edi
+ 51b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 51e:	85 f6                	test   %esi,%esi
+ 520:	75 df                	jne    501 <printf+0x27>
+      if(c == '%'){
+ 522:	83 f8 25             	cmp    $0x25,%eax
+ 525:	75 ce                	jne    4f5 <printf+0x1b>
+        state = '%';
+ 527:	89 c6                	mov    %eax,%esi
+ 529:	eb db                	jmp    506 <printf+0x2c>
+      if(c == 'd'){
+ 52b:	83 f8 25             	cmp    $0x25,%eax
+ 52e:	0f 84 cf 00 00 00    	je     603 <printf+0x129>
+ 534:	0f 8c dd 00 00 00    	jl     617 <printf+0x13d>
+ 53a:	83 f8 78             	cmp    $0x78,%eax
+ 53d:	0f 8f d4 00 00 00    	jg     617 <printf+0x13d>
+ 543:	83 f8 63             	cmp    $0x63,%eax
+ 546:	0f 8c cb 00 00 00    	jl     617 <printf+0x13d>
+ 54c:	83 e8 63             	sub    $0x63,%eax
+ 54f:	83 f8 15             	cmp    $0x15,%eax
+ 552:	0f 87 bf 00 00 00    	ja     617 <printf+0x13d>
+ 558:	ff 24 85 c8 07 00 00 	jmp    *0x7c8(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 55f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 562:	8b 17                	mov    (%edi),%edx
+ 564:	83 ec 0c             	sub    $0xc,%esp
+ 567:	6a 01                	push   $0x1
+ 569:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 56e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 571:	e8 d9 fe ff ff       	call   44f <printint>
+        ap++;
+ 576:	83 c7 04             	add    $0x4,%edi
+ 579:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 57c:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 57f:	be 00 00 00 00       	mov    $0x0,%esi
+ 584:	eb 80                	jmp    506 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 586:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 589:	8b 17                	mov    (%edi),%edx
+ 58b:	83 ec 0c             	sub    $0xc,%esp
+ 58e:	6a 00                	push   $0x0
+ 590:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 595:	8b 45 08             	mov    0x8(%ebp),%eax
+ 598:	e8 b2 fe ff ff       	call   44f <printint>
+        ap++;
+ 59d:	83 c7 04             	add    $0x4,%edi
+ 5a0:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 5a3:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5a6:	be 00 00 00 00       	mov    $0x0,%esi
+ 5ab:	e9 56 ff ff ff       	jmp    506 <printf+0x2c>
+        s = (char*)*ap;
+ 5b0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 5b3:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 5b5:	83 c0 04             	add    $0x4,%eax
+ 5b8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 5bb:	85 f6                	test   %esi,%esi
+ 5bd:	75 15                	jne    5d4 <printf+0xfa>
+          s = "(null)";
+ 5bf:	be bf 07 00 00       	mov    $0x7bf,%esi
+ 5c4:	eb 0e                	jmp    5d4 <printf+0xfa>
+          putc(fd, *s);
+ 5c6:	0f be d2             	movsbl %dl,%edx
+ 5c9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5cc:	e8 64 fe ff ff       	call   435 <putc>
+          s++;
+ 5d1:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 5d4:	0f b6 16             	movzbl (%esi),%edx
+ 5d7:	84 d2                	test   %dl,%dl
+ 5d9:	75 eb                	jne    5c6 <printf+0xec>
+      state = 0;
+ 5db:	be 00 00 00 00       	mov    $0x0,%esi
+ 5e0:	e9 21 ff ff ff       	jmp    506 <printf+0x2c>
+        putc(fd, *ap);
+ 5e5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 5e8:	0f be 17             	movsbl (%edi),%edx
+ 5eb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5ee:	e8 42 fe ff ff       	call   435 <putc>
+        ap++;
+ 5f3:	83 c7 04             	add    $0x4,%edi
+ 5f6:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 5f9:	be 00 00 00 00       	mov    $0x0,%esi
+ 5fe:	e9 03 ff ff ff       	jmp    506 <printf+0x2c>
+        putc(fd, c);
+ 603:	89 fa                	mov    %edi,%edx
+ 605:	8b 45 08             	mov    0x8(%ebp),%eax
+ 608:	e8 28 fe ff ff       	call   435 <putc>
+      state = 0;
+ 60d:	be 00 00 00 00       	mov    $0x0,%esi
+ 612:	e9 ef fe ff ff       	jmp    506 <printf+0x2c>
+        putc(fd, '%');
+ 617:	ba 25 00 00 00       	mov    $0x25,%edx
+ 61c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 61f:	e8 11 fe ff ff       	call   435 <putc>
+        putc(fd, c);
+ 624:	89 fa                	mov    %edi,%edx
+ 626:	8b 45 08             	mov    0x8(%ebp),%eax
+ 629:	e8 07 fe ff ff       	call   435 <putc>
+      state = 0;
+ 62e:	be 00 00 00 00       	mov    $0x0,%esi
+ 633:	e9 ce fe ff ff       	jmp    506 <printf+0x2c>
+    }
+  }
+}
+ 638:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 63b:	5b                   	pop    %ebx
+ 63c:	5e                   	pop    %esi
+ 63d:	5f                   	pop    %edi
+ 63e:	5d                   	pop    %ebp
+ 63f:	c3                   	ret
+
+00000640 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+ 643:	57                   	push   %edi
+ 644:	56                   	push   %esi
+ 645:	53                   	push   %ebx
+ 646:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 649:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 64c:	a1 00 0d 00 00       	mov    0xd00,%eax
+ 651:	eb 02                	jmp    655 <free+0x15>
+ 653:	89 d0                	mov    %edx,%eax
+ 655:	39 c8                	cmp    %ecx,%eax
+ 657:	73 04                	jae    65d <free+0x1d>
+ 659:	3b 08                	cmp    (%eax),%ecx
+ 65b:	72 12                	jb     66f <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 65d:	8b 10                	mov    (%eax),%edx
+ 65f:	39 d0                	cmp    %edx,%eax
+ 661:	72 f0                	jb     653 <free+0x13>
+ 663:	39 c8                	cmp    %ecx,%eax
+ 665:	72 08                	jb     66f <free+0x2f>
+ 667:	39 d1                	cmp    %edx,%ecx
+ 669:	72 04                	jb     66f <free+0x2f>
+ 66b:	89 d0                	mov    %edx,%eax
+ 66d:	eb e6                	jmp    655 <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 66f:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 672:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 675:	8b 10                	mov    (%eax),%edx
+ 677:	39 d7                	cmp    %edx,%edi
+ 679:	74 19                	je     694 <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 67b:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 67e:	8b 50 04             	mov    0x4(%eax),%edx
+ 681:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 684:	39 ce                	cmp    %ecx,%esi
+ 686:	74 1b                	je     6a3 <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 688:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 68a:	a3 00 0d 00 00       	mov    %eax,0xd00
+}
+ 68f:	5b                   	pop    %ebx
+ 690:	5e                   	pop    %esi
+ 691:	5f                   	pop    %edi
+ 692:	5d                   	pop    %ebp
+ 693:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 694:	03 72 04             	add    0x4(%edx),%esi
+ 697:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 69a:	8b 10                	mov    (%eax),%edx
+ 69c:	8b 12                	mov    (%edx),%edx
+ 69e:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 6a1:	eb db                	jmp    67e <free+0x3e>
+    p->s.size += bp->s.size;
+ 6a3:	03 53 fc             	add    -0x4(%ebx),%edx
+ 6a6:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 6a9:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 6ac:	89 10                	mov    %edx,(%eax)
+ 6ae:	eb da                	jmp    68a <free+0x4a>
+
+000006b0 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 6b0:	55                   	push   %ebp
+ 6b1:	89 e5                	mov    %esp,%ebp
+ 6b3:	53                   	push   %ebx
+ 6b4:	83 ec 04             	sub    $0x4,%esp
+ 6b7:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 6b9:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 6be:	77 05                	ja     6c5 <morecore+0x15>
+    nu = 4096;
+ 6c0:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 6c5:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 6cc:	83 ec 0c             	sub    $0xc,%esp
+ 6cf:	50                   	push   %eax
+ 6d0:	e8 b6 fc ff ff       	call   38b <sbrk>
+  if(p == (char*)-1)
+ 6d5:	83 c4 10             	add    $0x10,%esp
+ 6d8:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 6db:	74 1c                	je     6f9 <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 6dd:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 6e0:	83 c0 08             	add    $0x8,%eax
+ 6e3:	83 ec 0c             	sub    $0xc,%esp
+ 6e6:	50                   	push   %eax
+ 6e7:	e8 54 ff ff ff       	call   640 <free>
+  return freep;
+ 6ec:	a1 00 0d 00 00       	mov    0xd00,%eax
+ 6f1:	83 c4 10             	add    $0x10,%esp
+}
+ 6f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 6f7:	c9                   	leave
+ 6f8:	c3                   	ret
+    return 0;
+ 6f9:	b8 00 00 00 00       	mov    $0x0,%eax
+ 6fe:	eb f4                	jmp    6f4 <morecore+0x44>
+
+00000700 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 700:	55                   	push   %ebp
+ 701:	89 e5                	mov    %esp,%ebp
+ 703:	53                   	push   %ebx
+ 704:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 707:	8b 45 08             	mov    0x8(%ebp),%eax
+ 70a:	8d 58 07             	lea    0x7(%eax),%ebx
+ 70d:	c1 eb 03             	shr    $0x3,%ebx
+ 710:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 713:	8b 0d 00 0d 00 00    	mov    0xd00,%ecx
+ 719:	85 c9                	test   %ecx,%ecx
+ 71b:	74 04                	je     721 <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 71d:	8b 01                	mov    (%ecx),%eax
+ 71f:	eb 4a                	jmp    76b <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 721:	c7 05 00 0d 00 00 04 	movl   $0xd04,0xd00
+ 728:	0d 00 00 
+ 72b:	c7 05 04 0d 00 00 04 	movl   $0xd04,0xd04
+ 732:	0d 00 00 
+    base.s.size = 0;
+ 735:	c7 05 08 0d 00 00 00 	movl   $0x0,0xd08
+ 73c:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 73f:	b9 04 0d 00 00       	mov    $0xd04,%ecx
+ 744:	eb d7                	jmp    71d <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 746:	74 19                	je     761 <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 748:	29 da                	sub    %ebx,%edx
+ 74a:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 74d:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 750:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 753:	89 0d 00 0d 00 00    	mov    %ecx,0xd00
+      return (void*)(p + 1);
+ 759:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 75c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 75f:	c9                   	leave
+ 760:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 761:	8b 10                	mov    (%eax),%edx
+ 763:	89 11                	mov    %edx,(%ecx)
+ 765:	eb ec                	jmp    753 <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 767:	89 c1                	mov    %eax,%ecx
+ 769:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 76b:	8b 50 04             	mov    0x4(%eax),%edx
+ 76e:	39 da                	cmp    %ebx,%edx
+ 770:	73 d4                	jae    746 <malloc+0x46>
+    if(p == freep)
+ 772:	39 05 00 0d 00 00    	cmp    %eax,0xd00
+ 778:	75 ed                	jne    767 <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 77a:	89 d8                	mov    %ebx,%eax
+ 77c:	e8 2f ff ff ff       	call   6b0 <morecore>
+ 781:	85 c0                	test   %eax,%eax
+ 783:	75 e2                	jne    767 <malloc+0x67>
+ 785:	eb d5                	jmp    75c <malloc+0x5c>
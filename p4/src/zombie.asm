@@ -0,0 +1,1083 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 af 01 00 00       	call   1c5 <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7f 05                	jg     1f <main+0x1f>
+    sleep(5);  // Let child exit before parent.
+  exit();
+  1a:	e8 ae 01 00 00       	call   1cd <exit>
+    sleep(5);  // Let child exit before parent.
+  1f:	83 ec 0c             	sub    $0xc,%esp
+  22:	6a 05                	push   $0x5
+  24:	e8 34 02 00 00       	call   25d <sleep>
+  29:	83 c4 10             	add    $0x10,%esp
+  2c:	eb ec                	jmp    1a <main+0x1a>
+
+0000002e <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  2e:	55                   	push   %ebp
+  2f:	89 e5                	mov    %esp,%ebp
+  31:	56                   	push   %esi
+  32:	53                   	push   %ebx
+  33:	8b 75 08             	mov    0x8(%ebp),%esi
+  36:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  39:	89 f0                	mov    %esi,%eax
+  3b:	89 d1                	mov    %edx,%ecx
+  3d:	83 c2 01             	add    $0x1,%edx
+  40:	89 c3                	mov    %eax,%ebx
+  42:	83 c0 01             	add    $0x1,%eax
+  45:	0f b6 09             	movzbl (%ecx),%ecx
+  48:	88 0b                	mov    %cl,(%ebx)
+  4a:	84 c9                	test   %cl,%cl
+  4c:	75 ed                	jne    3b <strcpy+0xd>
+    ;
+  return os;
+}
+  4e:	89 f0                	mov    %esi,%eax
+  50:	5b                   	pop    %ebx
+  51:	5e                   	pop    %esi
+  52:	5d                   	pop    %ebp
+  53:	c3                   	ret
+
+00000054 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  54:	55                   	push   %ebp
+  55:	89 e5                	mov    %esp,%ebp
+  57:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  5a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+  5d:	eb 06                	jmp    65 <strcmp+0x11>
+    p++, q++;
+  5f:	83 c1 01             	add    $0x1,%ecx
+  62:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+  65:	0f b6 01             	movzbl (%ecx),%eax
+  68:	84 c0                	test   %al,%al
+  6a:	74 04                	je     70 <strcmp+0x1c>
+  6c:	3a 02                	cmp    (%edx),%al
+  6e:	74 ef                	je     5f <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+  70:	0f b6 c0             	movzbl %al,%eax
+  73:	0f b6 12             	movzbl (%edx),%edx
+  76:	29 d0                	sub    %edx,%eax
+}
+  78:	5d                   	pop    %ebp
+  79:	c3                   	ret
+
+0000007a <strlen>:
+
+uint
+strlen(const char *s)
+{
+  7a:	55                   	push   %ebp
+  7b:	89 e5                	mov    %esp,%ebp
+  7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  80:	b8 00 00 00 00       	mov    $0x0,%eax
+  85:	eb 03                	jmp    8a <strlen+0x10>
+  87:	83 c0 01             	add    $0x1,%eax
+  8a:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8e:	75 f7                	jne    87 <strlen+0xd>
+    ;
+  return n;
+}
+  90:	5d                   	pop    %ebp
+  91:	c3                   	ret
+
+00000092 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  92:	55                   	push   %ebp
+  93:	89 e5                	mov    %esp,%ebp
+  95:	57                   	push   %edi
+  96:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  99:	89 d7                	mov    %edx,%edi
+  9b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  9e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  a1:	fc                   	cld
+  a2:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  a4:	89 d0                	mov    %edx,%eax
+  a6:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  a9:	c9                   	leave
+  aa:	c3                   	ret
+
+000000ab <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  ab:	55                   	push   %ebp
+  ac:	89 e5                	mov    %esp,%ebp
+  ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  b1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+  b5:	eb 03                	jmp    ba <strchr+0xf>
+  b7:	83 c0 01             	add    $0x1,%eax
+  ba:	0f b6 10             	movzbl (%eax),%edx
+  bd:	84 d2                	test   %dl,%dl
+  bf:	74 06                	je     c7 <strchr+0x1c>
+    if(*s == c)
+  c1:	38 ca                	cmp    %cl,%dl
+  c3:	75 f2                	jne    b7 <strchr+0xc>
+  c5:	eb 05                	jmp    cc <strchr+0x21>
+      return (char*)s;
+  return 0;
+  c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  cc:	5d                   	pop    %ebp
+  cd:	c3                   	ret
+
+000000ce <gets>:
+
+char*
+gets(char *buf, int max)
+{
+  ce:	55                   	push   %ebp
+  cf:	89 e5                	mov    %esp,%ebp
+  d1:	57                   	push   %edi
+  d2:	56                   	push   %esi
+  d3:	53                   	push   %ebx
+  d4:	83 ec 1c             	sub    $0x1c,%esp
+  d7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+  da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  df:	89 de                	mov    %ebx,%esi
+  e1:	83 c3 01             	add    $0x1,%ebx
+  e4:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+  e7:	7d 2e                	jge    117 <gets+0x49>
+    cc = read(0, &c, 1);
+  e9:	83 ec 04             	sub    $0x4,%esp
+  ec:	6a 01                	push   $0x1
+  ee:	8d 45 e7             	lea    -0x19(%ebp),%eax
+  f1:	50                   	push   %eax
+  f2:	6a 00                	push   $0x0
+  f4:	e8 ec 00 00 00       	call   1e5 <read>
+    if(cc < 1)
+  f9:	83 c4 10             	add    $0x10,%esp
+  fc:	85 c0                	test   %eax,%eax
+  fe:	7e 17                	jle    117 <gets+0x49>
+      break;
+    buf[i++] = c;
+ 100:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 104:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 107:	3c 0a                	cmp    $0xa,%al
+ 109:	0f 94 c2             	sete   %dl
+ 10c:	3c 0d                	cmp    $0xd,%al
+ 10e:	0f 94 c0             	sete   %al
+ 111:	08 c2                	or     %al,%dl
+ 113:	74 ca                	je     df <gets+0x11>
+    buf[i++] = c;
+ 115:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 117:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 11b:	89 f8                	mov    %edi,%eax
+ 11d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 120:	5b                   	pop    %ebx
+ 121:	5e                   	pop    %esi
+ 122:	5f                   	pop    %edi
+ 123:	5d                   	pop    %ebp
+ 124:	c3                   	ret
+
+00000125 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 125:	55                   	push   %ebp
+ 126:	89 e5                	mov    %esp,%ebp
+ 128:	56                   	push   %esi
+ 129:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 12a:	83 ec 08             	sub    $0x8,%esp
+ 12d:	6a 00                	push   $0x0
+ 12f:	ff 75 08             	push   0x8(%ebp)
+ 132:	e8 d6 00 00 00       	call   20d <open>
+  if(fd < 0)
+ 137:	83 c4 10             	add    $0x10,%esp
+ 13a:	85 c0                	test   %eax,%eax
+ 13c:	78 24                	js     162 <stat+0x3d>
+ 13e:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 140:	83 ec 08             	sub    $0x8,%esp
+ 143:	ff 75 0c             	push   0xc(%ebp)
+ 146:	50                   	push   %eax
+ 147:	e8 d9 00 00 00       	call   225 <fstat>
+ 14c:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 14e:	89 1c 24             	mov    %ebx,(%esp)
+ 151:	e8 9f 00 00 00       	call   1f5 <close>
+  return r;
+ 156:	83 c4 10             	add    $0x10,%esp
+}
+ 159:	89 f0                	mov    %esi,%eax
+ 15b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 15e:	5b                   	pop    %ebx
+ 15f:	5e                   	pop    %esi
+ 160:	5d                   	pop    %ebp
+ 161:	c3                   	ret
+    return -1;
+ 162:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 167:	eb f0                	jmp    159 <stat+0x34>
+
+00000169 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 169:	55                   	push   %ebp
+ 16a:	89 e5                	mov    %esp,%ebp
+ 16c:	53                   	push   %ebx
+ 16d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+ 170:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+ 175:	eb 10                	jmp    187 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+ 177:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+ 17a:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+ 17d:	83 c1 01             	add    $0x1,%ecx
+ 180:	0f be c0             	movsbl %al,%eax
+ 183:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+ 187:	0f b6 01             	movzbl (%ecx),%eax
+ 18a:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 18d:	80 fb 09             	cmp    $0x9,%bl
+ 190:	76 e5                	jbe    177 <atoi+0xe>
+  return n;
+}
+ 192:	89 d0                	mov    %edx,%eax
+ 194:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 197:	c9                   	leave
+ 198:	c3                   	ret
+
+00000199 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 199:	55                   	push   %ebp
+ 19a:	89 e5                	mov    %esp,%ebp
+ 19c:	56                   	push   %esi
+ 19d:	53                   	push   %ebx
+ 19e:	8b 75 08             	mov    0x8(%ebp),%esi
+ 1a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 1a4:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+ 1a7:	89 f2                	mov    %esi,%edx
+  src = vsrc;
+  while(n-- > 0)
+ 1a9:	eb 0d                	jmp    1b8 <memmove+0x1f>
+    *dst++ = *src++;
+ 1ab:	0f b6 01             	movzbl (%ecx),%eax
+ 1ae:	88 02                	mov    %al,(%edx)
+ 1b0:	8d 49 01             	lea    0x1(%ecx),%ecx
+ 1b3:	8d 52 01             	lea    0x1(%edx),%edx
+  while(n-- > 0)
+ 1b6:	89 d8                	mov    %ebx,%eax
+ 1b8:	8d 58 ff             	lea    -0x1(%eax),%ebx
+ 1bb:	85 c0                	test   %eax,%eax
+ 1bd:	7f ec                	jg     1ab <memmove+0x12>
+  return vdst;
+}
+ 1bf:	89 f0                	mov    %esi,%eax
+ 1c1:	5b                   	pop    %ebx
+ 1c2:	5e                   	pop    %esi
+ 1c3:	5d                   	pop    %ebp
+ 1c4:	c3                   	ret
+
+000001c5 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 1c5:	b8 01 00 00 00       	mov    $0x1,%eax
+ 1ca:	cd 40                	int    $0x40
+ 1cc:	c3                   	ret
+
+000001cd <exit>:
+SYSCALL(exit)
+ 1cd:	b8 02 00 00 00       	mov    $0x2,%eax
+ 1d2:	cd 40                	int    $0x40
+ 1d4:	c3                   	ret
+
+000001d5 <wait>:
+SYSCALL(wait)
+ 1d5:	b8 03 00 00 00       	mov    $0x3,%eax
+ 1da:	cd 40                	int    $0x40
+ 1dc:	c3                   	ret
+
+000001dd <pipe>:
+SYSCALL(pipe)
+ 1dd:	b8 04 00 00 00       	mov    $0x4,%eax
+ 1e2:	cd 40                	int    $0x40
+ 1e4:	c3                   	ret
+
+000001e5 <read>:
+SYSCALL(read)
+ 1e5:	b8 05 00 00 00       	mov    $0x5,%eax
+ 1ea:	cd 40                	int    $0x40
+ 1ec:	c3                   	ret
+
+000001ed <write>:
+SYSCALL(write)
+ 1ed:	b8 10 00 00 00       	mov    $0x10,%eax
+ 1f2:	cd 40                	int    $0x40
+ 1f4:	c3                   	ret
+
+000001f5 <close>:
+SYSCALL(close)
+ 1f5:	b8 15 00 00 00       	mov    $0x15,%eax
+ 1fa:	cd 40                	int    $0x40
+ 1fc:	c3                   	ret
+
+000001fd <kill>:
+SYSCALL(kill)
+ 1fd:	b8 06 00 00 00       	mov    $0x6,%eax
+ 202:	cd 40                	int    $0x40
+ 204:	c3                   	ret
+
+00000205 <exec>:
+SYSCALL(exec)
+ 205:	b8 07 00 00 00       	mov    $0x7,%eax
+ 20a:	cd 40                	int    $0x40
+ 20c:	c3                   	ret
+
+0000020d <open>:
+SYSCALL(open)
+ 20d:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 212:	cd 40                	int    $0x40
+ 214:	c3                   	ret
+
+00000215 <mknod>:
+SYSCALL(mknod)
+ 215:	b8 11 00 00 00       	mov    $0x11,%eax
+ 21a:	cd 40                	int    $0x40
+ 21c:	c3                   	ret
+
+0000021d <unlink>:
+SYSCALL(unlink)
+ 21d:	b8 12 00 00 00       	mov    $0x12,%eax
+ 222:	cd 40                	int    $0x40
+ 224:	c3                   	ret
+
+00000225 <fstat>:
+SYSCALL(fstat)
+ 225:	b8 08 00 00 00       	mov    $0x8,%eax
+ 22a:	cd 40                	int    $0x40
+ 22c:	c3                   	ret
+
+0000022d <link>:
+SYSCALL(link)
+ 22d:	b8 13 00 00 00       	mov    $0x13,%eax
+ 232:	cd 40                	int    $0x40
+ 234:	c3                   	ret
+
+00000235 <mkdir>:
+SYSCALL(mkdir)
+ 235:	b8 14 00 00 00       	mov    $0x14,%eax
+ 23a:	cd 40                	int    $0x40
+ 23c:	c3                   	ret
+
+0000023d <chdir>:
+SYSCALL(chdir)
+ 23d:	b8 09 00 00 00       	mov    $0x9,%eax
+ 242:	cd 40                	int    $0x40
+ 244:	c3                   	ret
+
+00000245 <dup>:
+SYSCALL(dup)
+ 245:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 24a:	cd 40                	int    $0x40
+ 24c:	c3                   	ret
+
+0000024d <getpid>:
+SYSCALL(getpid)
+ 24d:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 252:	cd 40                	int    $0x40
+ 254:	c3                   	ret
+
+00000255 <sbrk>:
+SYSCALL(sbrk)
+ 255:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 25a:	cd 40                	int    $0x40
+ 25c:	c3                   	ret
+
+0000025d <sleep>:
+SYSCALL(sleep)
+ 25d:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 262:	cd 40                	int    $0x40
+ 264:	c3                   	ret
+
+00000265 <uptime>:
+SYSCALL(uptime)
+ 265:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 26a:	cd 40                	int    $0x40
+ 26c:	c3                   	ret
+
+0000026d <setpri>:
+SYSCALL(setpri)
+ 26d:	b8 16 00 00 00       	mov    $0x16,%eax
+ 272:	cd 40                	int    $0x40
+ 274:	c3                   	ret
+
+00000275 <getpri>:
+SYSCALL(getpri)
+ 275:	b8 17 00 00 00       	mov    $0x17,%eax
+ 27a:	cd 40                	int    $0x40
+ 27c:	c3                   	ret
+
+0000027d <fork2>:
+SYSCALL(fork2)
+ 27d:	b8 18 00 00 00       	mov    $0x18,%eax
+ 282:	cd 40                	int    $0x40
+ 284:	c3                   	ret
+
+00000285 <getpinfo>:
+SYSCALL(getpinfo)
+ 285:	b8 19 00 00 00       	mov    $0x19,%eax
+ 28a:	cd 40                	int    $0x40
+ 28c:	c3                   	ret
+
+0000028d <spawn>:
+SYSCALL(spawn)
+ 28d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 292:	cd 40                	int    $0x40
+ 294:	c3                   	ret
+
+00000295 <spawnn>:
+SYSCALL(spawnn)
+ 295:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 29a:	cd 40                	int    $0x40
+ 29c:	c3                   	ret
+
+0000029d <kmstat>:
+SYSCALL(kmstat)
+ 29d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 2a2:	cd 40                	int    $0x40
+ 2a4:	c3                   	ret
+
+000002a5 <slabstat>:
+SYSCALL(slabstat)
+ 2a5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 2aa:	cd 40                	int    $0x40
+ 2ac:	c3                   	ret
+
+000002ad <shmget>:
+SYSCALL(shmget)
+ 2ad:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 2b2:	cd 40                	int    $0x40
+ 2b4:	c3                   	ret
+
+000002b5 <shmat>:
+SYSCALL(shmat)
+ 2b5:	b8 20 00 00 00       	mov    $0x20,%eax
+ 2ba:	cd 40                	int    $0x40
+ 2bc:	c3                   	ret
+
+000002bd <shmdt>:
+SYSCALL(shmdt)
+ 2bd:	b8 21 00 00 00       	mov    $0x21,%eax
+ 2c2:	cd 40                	int    $0x40
+ 2c4:	c3                   	ret
+
+000002c5 <mmap>:
+SYSCALL(mmap)
+ 2c5:	b8 22 00 00 00       	mov    $0x22,%eax
+ 2ca:	cd 40                	int    $0x40
+ 2cc:	c3                   	ret
+
+000002cd <munmap>:
+SYSCALL(munmap)
+ 2cd:	b8 23 00 00 00       	mov    $0x23,%eax
+ 2d2:	cd 40                	int    $0x40
+ 2d4:	c3                   	ret
+
+000002d5 <bstat>:
+SYSCALL(bstat)
+ 2d5:	b8 24 00 00 00       	mov    $0x24,%eax
+ 2da:	cd 40                	int    $0x40
+ 2dc:	c3                   	ret
+
+000002dd <aread>:
+SYSCALL(aread)
+ 2dd:	b8 25 00 00 00       	mov    $0x25,%eax
+ 2e2:	cd 40                	int    $0x40
+ 2e4:	c3                   	ret
+
+000002e5 <await>:
+SYSCALL(await)
+ 2e5:	b8 26 00 00 00       	mov    $0x26,%eax
+ 2ea:	cd 40                	int    $0x40
+ 2ec:	c3                   	ret
+
+000002ed <bdrop>:
+SYSCALL(bdrop)
+ 2ed:	b8 27 00 00 00       	mov    $0x27,%eax
+ 2f2:	cd 40                	int    $0x40
+ 2f4:	c3                   	ret
+
+000002f5 <vfork>:
+# exec or exit, and its ret would leave the slot holding our
+# return address free for it to overwrite.  Keep the return
+# address in %ecx, which the kernel restores for both sides.
+.globl vfork
+vfork:
+  popl %ecx
+ 2f5:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+ 2f6:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  int $T_SYSCALL
+ 2fb:	cd 40                	int    $0x40
+  pushl %ecx
+ 2fd:	51                   	push   %ecx
+  ret
+ 2fe:	c3                   	ret
+
+000002ff <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 2ff:	55                   	push   %ebp
+ 300:	89 e5                	mov    %esp,%ebp
+ 302:	83 ec 1c             	sub    $0x1c,%esp
+ 305:	88 55 f4             	mov    %dl,-0xc(%ebp)
+  write(fd, &c, 1);
+ 308:	6a 01                	push   $0x1
+ 30a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+ 30d:	52                   	push   %edx
+ 30e:	50                   	push   %eax
+ 30f:	e8 d9 fe ff ff       	call   1ed <write>
+}
+ 314:	83 c4 10             	add    $0x10,%esp
+ 317:	c9                   	leave
+ 318:	c3                   	ret
+
+00000319 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 319:	55                   	push   %ebp
+ 31a:	89 e5                	mov    %esp,%ebp
+ 31c:	57                   	push   %edi
+ 31d:	56                   	push   %esi
+ 31e:	53                   	push   %ebx
+ 31f:	83 ec 2c             	sub    $0x2c,%esp
+ 322:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 325:	89 d0                	mov    %edx,%eax
+ 327:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 329:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 32d:	0f 95 c1             	setne  %cl
+ 330:	c1 ea 1f             	shr    $0x1f,%edx
+ 333:	84 d1                	test   %dl,%cl
+ 335:	74 44                	je     37b <printint+0x62>
+    neg = 1;
+    x = -xx;
+ 337:	f7 d8                	neg    %eax
+ 339:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+ 33b:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 342:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 347:	89 c8                	mov    %ecx,%eax
+ 349:	ba 00 00 00 00       	mov    $0x0,%edx
+ 34e:	f7 f6                	div    %esi
+ 350:	89 df                	mov    %ebx,%edi
+ 352:	83 c3 01             	add    $0x1,%ebx
+ 355:	0f b6 92 b4 06 00 00 	movzbl 0x6b4(%edx),%edx
+ 35c:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+ 360:	89 ca                	mov    %ecx,%edx
+ 362:	89 c1                	mov    %eax,%ecx
+ 364:	39 f2                	cmp    %esi,%edx
+ 366:	73 df                	jae    347 <printint+0x2e>
+  if(neg)
+ 368:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 36c:	74 31                	je     39f <printint+0x86>
+    buf[i++] = '-';
+ 36e:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 373:	8d 5f 02             	lea    0x2(%edi),%ebx
+ 376:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 379:	eb 17                	jmp    392 <printint+0x79>
+    x = xx;
+ 37b:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+ 37d:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 384:	eb bc                	jmp    342 <printint+0x29>
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 386:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+ 38b:	89 f0                	mov    %esi,%eax
+ 38d:	e8 6d ff ff ff       	call   2ff <putc>
+  while(--i >= 0)
+ 392:	83 eb 01             	sub    $0x1,%ebx
+ 395:	79 ef                	jns    386 <printint+0x6d>
+}
+ 397:	83 c4 2c             	add    $0x2c,%esp
+ 39a:	5b                   	pop    %ebx
+ 39b:	5e                   	pop    %esi
+ 39c:	5f                   	pop    %edi
+ 39d:	5d                   	pop    %ebp
+ 39e:	c3                   	ret
+ 39f:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 3a2:	eb ee                	jmp    392 <printint+0x79>
+
+000003a4 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 3a4:	55                   	push   %ebp
+ 3a5:	89 e5                	mov    %esp,%ebp
+ 3a7:	57                   	push   %edi
+ 3a8:	56                   	push   %esi
+ 3a9:	53                   	push   %ebx
+ 3aa:	83 ec 1c             	sub    $0x1c,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+ 3ad:	8d 45 10             	lea    0x10(%ebp),%eax
+ 3b0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  state = 0;
+ 3b3:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+ 3b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 3bd:	eb 14                	jmp    3d3 <printf+0x2f>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 3bf:	89 fa                	mov    %edi,%edx
+ 3c1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c4:	e8 36 ff ff ff       	call   2ff <putc>
+ 3c9:	eb 05                	jmp    3d0 <printf+0x2c>
+      }
+    } else if(state == '%'){
+ 3cb:	83 fe 25             	cmp    $0x25,%esi
+ 3ce:	74 25                	je     3f5 <printf+0x51>
+  for(i = 0; fmt[i]; i++){
+ 3d0:	83 c3 01             	add    $0x1,%ebx
+ 3d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3d6:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+ 3da:	84 c0                	test   %al,%al
+ 3dc:	0f 84 20 01 00 00    	je     502 <printf+0x15e>
+    c = fmt[i] & 0xff;
+ 3e2:	0f be f8             	movsbl %al,%edi
+ 3e5:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 3e8:	85 f6                	test   %esi,%esi
+ 3ea:	75 df                	jne    3cb <printf+0x27>
+      if(c == '%'){
+ 3ec:	83 f8 25             	cmp    $0x25,%eax
+ 3ef:	75 ce                	jne    3bf <printf+0x1b>
+        state = '%';
+ 3f1:	89 c6                	mov    %eax,%esi
+ 3f3:	eb db                	jmp    3d0 <printf+0x2c>
+      if(c == 'd'){
+ 3f5:	83 f8 25             	cmp    $0x25,%eax
+ 3f8:	0f 84 cf 00 00 00    	je     4cd <printf+0x129>
+ 3fe:	0f 8c dd 00 00 00    	jl     4e1 <printf+0x13d>
+ 404:	83 f8 78             	cmp    $0x78,%eax
+ 407:	0f 8f d4 00 00 00    	jg     4e1 <printf+0x13d>
+ 40d:	83 f8 63             	cmp    $0x63,%eax
+ 410:	0f 8c cb 00 00 00    	jl     4e1 <printf+0x13d>
+ 416:	83 e8 63             	sub    $0x63,%eax
+ 419:	83 f8 15             	cmp    $0x15,%eax
+ 41c:	0f 87 bf 00 00 00    	ja     4e1 <printf+0x13d>
+ 422:	ff 24 85 5c 06 00 00 	jmp    *0x65c(,%eax,4)
+        printint(fd, *ap, 10, 1);
+ 429:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 42c:	8b 17                	mov    (%edi),%edx
+ 42e:	83 ec 0c             	sub    $0xc,%esp
+ 431:	6a 01                	push   $0x1
+ 433:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 438:	8b 45 08             	mov    0x8(%ebp),%eax
+ 43b:	e8 d9 fe ff ff       	call   319 <printint>
+        ap++;
+ 440:	83 c7 04             	add    $0x4,%edi
+ 443:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 446:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 449:	be 00 00 00 00       	mov    $0x0,%esi
+ 44e:	eb 80                	jmp    3d0 <printf+0x2c>
+        printint(fd, *ap, 16, 0);
+ 450:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 453:	8b 17                	mov    (%edi),%edx
+ 455:	83 ec 0c             	sub    $0xc,%esp
+ 458:	6a 00                	push   $0x0
+ 45a:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 45f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 462:	e8 b2 fe ff ff       	call   319 <printint>
+        ap++;
+ 467:	83 c7 04             	add    $0x4,%edi
+ 46a:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 46d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 470:	be 00 00 00 00       	mov    $0x0,%esi
+ 475:	e9 56 ff ff ff       	jmp    3d0 <printf+0x2c>
+        s = (char*)*ap;
+ 47a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 47d:	8b 30                	mov    (%eax),%esi
+        ap++;
+ 47f:	83 c0 04             	add    $0x4,%eax
+ 482:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(s == 0)
+ 485:	85 f6                	test   %esi,%esi
+ 487:	75 15                	jne    49e <printf+0xfa>
+          s = "(null)";
+ 489:	be 54 06 00 00       	mov    $0x654,%esi
+ 48e:	eb 0e                	jmp    49e <printf+0xfa>
+          putc(fd, *s);
+ 490:	0f be d2             	movsbl %dl,%edx
+ 493:	8b 45 08             	mov    0x8(%ebp),%eax
+ 496:	e8 64 fe ff ff       	call   2ff <putc>
+          s++;
+ 49b:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+ 49e:	0f b6 16             	movzbl (%esi),%edx
+ 4a1:	84 d2                	test   %dl,%dl
+ 4a3:	75 eb                	jne    490 <printf+0xec>
+      state = 0;
+ 4a5:	be 00 00 00 00       	mov    $0x0,%esi
+ 4aa:	e9 21 ff ff ff       	jmp    3d0 <printf+0x2c>
+        putc(fd, *ap);
+ 4af:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 4b2:	0f be 17             	movsbl (%edi),%edx
+ 4b5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b8:	e8 42 fe ff ff       	call   2ff <putc>
+        ap++;
+ 4bd:	83 c7 04             	add    $0x4,%edi
+ 4c0:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      state = 0;
+ 4c3:	be 00 00 00 00       	mov    $0x0,%esi
+ 4c8:	e9 03 ff ff ff       	jmp    3d0 <printf+0x2c>
+        putc(fd, c);
+ 4cd:	89 fa                	mov    %edi,%edx
+ 4cf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4d2:	e8 28 fe ff ff       	call   2ff <putc>
+      state = 0;
+ 4d7:	be 00 00 00 00       	mov    $0x0,%esi
+ 4dc:	e9 ef fe ff ff       	jmp    3d0 <printf+0x2c>
+        putc(fd, '%');
+ 4e1:	ba 25 00 00 00       	mov    $0x25,%edx
+ 4e6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4e9:	e8 11 fe ff ff       	call   2ff <putc>
+        putc(fd, c);
+ 4ee:	89 fa                	mov    %edi,%edx
+ 4f0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4f3:	e8 07 fe ff ff       	call   2ff <putc>
+      state = 0;
+ 4f8:	be 00 00 00 00       	mov    $0x0,%esi
+ 4fd:	e9 ce fe ff ff       	jmp    3d0 <printf+0x2c>
+    }
+  }
+}
+ 502:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 505:	5b                   	pop    %ebx
+ 506:	5e                   	pop    %esi
+ 507:	5f                   	pop    %edi
+ 508:	5d                   	pop    %ebp
+ 509:	c3                   	ret
+
+0000050a <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 50a:	55                   	push   %ebp
+ 50b:	89 e5                	mov    %esp,%ebp
+ 50d:	57                   	push   %edi
+ 50e:	56                   	push   %esi
+ 50f:	53                   	push   %ebx
+ 510:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 513:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 516:	a1 54 09 00 00       	mov    0x954,%eax
+ 51b:	eb 02                	jmp    51f <free+0x15>
+ 51d:	89 d0                	mov    %edx,%eax
+ 51f:	39 c8                	cmp    %ecx,%eax
+ 521:	73 04                	jae    527 <free+0x1d>
+ 523:	3b 08                	cmp    (%eax),%ecx
+ 525:	72 12                	jb     539 <free+0x2f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 527:	8b 10                	mov    (%eax),%edx
+ 529:	39 d0                	cmp    %edx,%eax
+ 52b:	72 f0                	jb     51d <free+0x13>
+ 52d:	39 c8                	cmp    %ecx,%eax
+ 52f:	72 08                	jb     539 <free+0x2f>
+ 531:	39 d1                	cmp    %edx,%ecx
+ 533:	72 04                	jb     539 <free+0x2f>
+ 535:	89 d0                	mov    %edx,%eax
+ 537:	eb e6                	jmp    51f <free+0x15>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 539:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 53c:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 53f:	8b 10                	mov    (%eax),%edx
+ 541:	39 d7                	cmp    %edx,%edi
+ 543:	74 19                	je     55e <free+0x54>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+ 545:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 548:	8b 50 04             	mov    0x4(%eax),%edx
+ 54b:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 54e:	39 ce                	cmp    %ecx,%esi
+ 550:	74 1b                	je     56d <free+0x63>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+ 552:	89 08                	mov    %ecx,(%eax)
+  freep = p;
+ 554:	a3 54 09 00 00       	mov    %eax,0x954
+}
+ 559:	5b                   	pop    %ebx
+ 55a:	5e                   	pop    %esi
+ 55b:	5f                   	pop    %edi
+ 55c:	5d                   	pop    %ebp
+ 55d:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 55e:	03 72 04             	add    0x4(%edx),%esi
+ 561:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 564:	8b 10                	mov    (%eax),%edx
+ 566:	8b 12                	mov    (%edx),%edx
+ 568:	89 53 f8             	mov    %edx,-0x8(%ebx)
+ 56b:	eb db                	jmp    548 <free+0x3e>
+    p->s.size += bp->s.size;
+ 56d:	03 53 fc             	add    -0x4(%ebx),%edx
+ 570:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 573:	8b 53 f8             	mov    -0x8(%ebx),%edx
+ 576:	89 10                	mov    %edx,(%eax)
+ 578:	eb da                	jmp    554 <free+0x4a>
+
+0000057a <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 57a:	55                   	push   %ebp
+ 57b:	89 e5                	mov    %esp,%ebp
+ 57d:	53                   	push   %ebx
+ 57e:	83 ec 04             	sub    $0x4,%esp
+ 581:	89 c3                	mov    %eax,%ebx
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 583:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ 588:	77 05                	ja     58f <morecore+0x15>
+    nu = 4096;
+ 58a:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 58f:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 596:	83 ec 0c             	sub    $0xc,%esp
+ 599:	50                   	push   %eax
+ 59a:	e8 b6 fc ff ff       	call   255 <sbrk>
+  if(p == (char*)-1)
+ 59f:	83 c4 10             	add    $0x10,%esp
+ 5a2:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 5a5:	74 1c                	je     5c3 <morecore+0x49>
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+ 5a7:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 5aa:	83 c0 08             	add    $0x8,%eax
+ 5ad:	83 ec 0c             	sub    $0xc,%esp
+ 5b0:	50                   	push   %eax
+ 5b1:	e8 54 ff ff ff       	call   50a <free>
+  return freep;
+ 5b6:	a1 54 09 00 00       	mov    0x954,%eax
+ 5bb:	83 c4 10             	add    $0x10,%esp
+}
+ 5be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5c1:	c9                   	leave
+ 5c2:	c3                   	ret
+    return 0;
+ 5c3:	b8 00 00 00 00       	mov    $0x0,%eax
+ 5c8:	eb f4                	jmp    5be <morecore+0x44>
+
+000005ca <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 5ca:	55                   	push   %ebp
+ 5cb:	89 e5                	mov    %esp,%ebp
+ 5cd:	53                   	push   %ebx
+ 5ce:	83 ec 04             	sub    $0x4,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 5d1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d4:	8d 58 07             	lea    0x7(%eax),%ebx
+ 5d7:	c1 eb 03             	shr    $0x3,%ebx
+ 5da:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 5dd:	8b 0d 54 09 00 00    	mov    0x954,%ecx
+ 5e3:	85 c9                	test   %ecx,%ecx
+ 5e5:	74 04                	je     5eb <malloc+0x21>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 5e7:	8b 01                	mov    (%ecx),%eax
+ 5e9:	eb 4a                	jmp    635 <malloc+0x6b>
+    base.s.ptr = freep = prevp = &base;
+ 5eb:	c7 05 54 09 00 00 58 	movl   $0x958,0x954
+ 5f2:	09 00 00 
+ 5f5:	c7 05 58 09 00 00 58 	movl   $0x958,0x958
+ 5fc:	09 00 00 
+    base.s.size = 0;
+ 5ff:	c7 05 5c 09 00 00 00 	movl   $0x0,0x95c
+ 606:	00 00 00 
+    base.s.ptr = freep = prevp = &base;
+ 609:	b9 58 09 00 00       	mov    $0x958,%ecx
+ 60e:	eb d7                	jmp    5e7 <malloc+0x1d>
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+ 610:	74 19                	je     62b <malloc+0x61>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 612:	29 da                	sub    %ebx,%edx
+ 614:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 617:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+        p->s.size = nunits;
+ 61a:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 61d:	89 0d 54 09 00 00    	mov    %ecx,0x954
+      return (void*)(p + 1);
+ 623:	83 c0 08             	add    $0x8,%eax
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 626:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 629:	c9                   	leave
+ 62a:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 62b:	8b 10                	mov    (%eax),%edx
+ 62d:	89 11                	mov    %edx,(%ecx)
+ 62f:	eb ec                	jmp    61d <malloc+0x53>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 631:	89 c1                	mov    %eax,%ecx
+ 633:	8b 00                	mov    (%eax),%eax
+    if(p->s.size >= nunits){
+ 635:	8b 50 04             	mov    0x4(%eax),%edx
+ 638:	39 da                	cmp    %ebx,%edx
+ 63a:	73 d4                	jae    610 <malloc+0x46>
+    if(p == freep)
+ 63c:	39 05 54 09 00 00    	cmp    %eax,0x954
+ 642:	75 ed                	jne    631 <malloc+0x67>
+      if((p = morecore(nunits)) == 0)
+ 644:	89 d8                	mov    %ebx,%eax
+ 646:	e8 2f ff ff ff       	call   57a <morecore>
+ 64b:	85 c0                	test   %eax,%eax
+ 64d:	75 e2                	jne    631 <malloc+0x67>
+ 64f:	eb d5                	jmp    626 <malloc+0x5c>